@@ -0,0 +1,13 @@
+#
+# METIS
+#
+# Sets METIS_INCLUDE_DIR and METIS_LIBRARY, looks in METIS_ROOT first.
+
+FIND_PATH(METIS_INCLUDE_DIR metis.h ${METIS_ROOT}/include NO_DEFAULT_PATH)
+FIND_PATH(METIS_INCLUDE_DIR metis.h /usr/include /usr/include/metis /usr/local/include)
+
+FIND_LIBRARY(METIS_LIBRARY NAMES metis libmetis PATHS ${METIS_ROOT}/lib NO_DEFAULT_PATH)
+FIND_LIBRARY(METIS_LIBRARY NAMES metis libmetis PATHS /usr/lib /usr/lib64 /usr/local/lib)
+
+INCLUDE(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(METIS DEFAULT_MSG METIS_LIBRARY METIS_INCLUDE_DIR)
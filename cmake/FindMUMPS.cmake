@@ -40,6 +40,14 @@ LIST(APPEND REQUIRED_REAL_LIBRARIES "MUMPSD_SEQ_LIBRARY")
 FIND_LIBRARY(MUMPSZ_SEQ_LIBRARY zmumps_seq  ${MUMPS_LIB_SEARCH_PATH})
 LIST(APPEND REQUIRED_CPLX_LIBRARIES "MUMPSZ_SEQ_LIBRARY")
 
+IF(WITH_MUMPS_MIXED_PRECISION)
+  FIND_LIBRARY(MUMPSS_SEQ_LIBRARY smumps_seq  ${MUMPS_LIB_SEARCH_PATH})
+  LIST(APPEND REQUIRED_REAL_LIBRARIES "MUMPSS_SEQ_LIBRARY")
+
+  FIND_LIBRARY(MUMPSC_SEQ_LIBRARY cmumps_seq  ${MUMPS_LIB_SEARCH_PATH})
+  LIST(APPEND REQUIRED_CPLX_LIBRARIES "MUMPSC_SEQ_LIBRARY")
+ENDIF(WITH_MUMPS_MIXED_PRECISION)
+
 LIST(APPEND REQUIRED_REAL_LIBRARIES "MUMPS_MPISEQ_LIBRARY")
 LIST(APPEND REQUIRED_CPLX_LIBRARIES "MUMPS_MPISEQ_LIBRARY")  
 
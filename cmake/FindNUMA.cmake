@@ -0,0 +1,13 @@
+#
+# NUMA (libnuma)
+#
+# Sets NUMA_INCLUDE_DIR and NUMA_LIBRARY, looks in NUMA_ROOT first.
+
+FIND_PATH(NUMA_INCLUDE_DIR numa.h ${NUMA_ROOT}/include NO_DEFAULT_PATH)
+FIND_PATH(NUMA_INCLUDE_DIR numa.h /usr/include /usr/local/include)
+
+FIND_LIBRARY(NUMA_LIBRARY NAMES numa libnuma PATHS ${NUMA_ROOT}/lib NO_DEFAULT_PATH)
+FIND_LIBRARY(NUMA_LIBRARY NAMES numa libnuma PATHS /usr/lib /usr/lib64 /usr/local/lib)
+
+INCLUDE(FindPackageHandleStandardArgs)
+FIND_PACKAGE_HANDLE_STANDARD_ARGS(NUMA DEFAULT_MSG NUMA_LIBRARY NUMA_INCLUDE_DIR)
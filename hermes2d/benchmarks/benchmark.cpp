@@ -0,0 +1,165 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "benchmark.h"
+#include <fstream>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace Hermes::Hermes2D;
+
+Benchmark::Benchmark(const char* name, int argc, char* argv[], int default_refinements, int default_order, int default_steps)
+  : refinements(default_refinements), order(default_order), threads(omp_get_max_threads()), repeat(3), steps(default_steps),
+  name(name), output(std::string(name) + ".json"), run_start(0.0)
+{
+  for(int i = 1; i < argc; i++)
+  {
+    std::string arg(argv[i]);
+    if(i + 1 == argc)
+      throw Hermes::Exceptions::Exception("Benchmark: missing value of the parameter %s.", argv[i]);
+    if(arg == "--ref")
+      this->refinements = atoi(argv[++i]);
+    else if(arg == "--p")
+      this->order = atoi(argv[++i]);
+    else if(arg == "--threads")
+      this->threads = atoi(argv[++i]);
+    else if(arg == "--repeat")
+      this->repeat = atoi(argv[++i]);
+    else if(arg == "--steps")
+      this->steps = atoi(argv[++i]);
+    else if(arg == "--output")
+      this->output = argv[++i];
+    else
+      throw Hermes::Exceptions::Exception("Benchmark: unknown parameter %s.", argv[i]);
+  }
+  if(this->threads < 1 || this->repeat < 1 || this->steps < 1 || this->order < 0 || this->refinements < 0)
+    throw Hermes::Exceptions::Exception("Benchmark: invalid parameters.");
+
+  Hermes2DApi.set_integral_param_value(numThreads, this->threads);
+}
+
+std::string Benchmark::data_file(const char* file) const
+{
+  return std::string(TEST_EXAMPLE_DIR) + "/" + file;
+}
+
+void Benchmark::begin_run()
+{
+  this->run_start = omp_get_wtime();
+}
+
+void Benchmark::end_run(int ndof, const AssemblyProfile& profile, int work_units)
+{
+  Run run;
+  run.wall_time = omp_get_wtime() - this->run_start;
+  run.ndof = ndof;
+  run.work_units = work_units;
+  run.profile = profile;
+  this->runs.push_back(run);
+}
+
+void Benchmark::add_value(const char* name, double value)
+{
+  if(this->runs.empty())
+    throw Hermes::Exceptions::Exception("Benchmark::add_value() called before end_run().");
+  this->runs.back().values.push_back(std::pair<std::string, double>(name, value));
+}
+
+size_t Benchmark::get_memory_high_water()
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return counters.PeakWorkingSetSize;
+  return 0;
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#ifdef __APPLE__
+  // Bytes on Mac OS X, kilobytes elsewhere.
+  return (size_t) usage.ru_maxrss;
+#else
+  return (size_t) usage.ru_maxrss * 1024;
+#endif
+#endif
+}
+
+// The phase names as JSON keys ("shape precalculation" -> "shape_precalculation").
+static std::string json_key(const char* name)
+{
+  std::string key(name);
+  for(unsigned int i = 0; i < key.length(); i++)
+    if(key[i] == ' ')
+      key[i] = '_';
+  return key;
+}
+
+void Benchmark::save() const
+{
+  std::ofstream out(this->output.c_str());
+  if(!out)
+    throw Hermes::Exceptions::Exception("Benchmark: could not open %s for writing.", this->output.c_str());
+  out.precision(9);
+
+  out << "{\n";
+  out << "  \"benchmark\": \"" << this->name << "\",\n";
+  out << "  \"parameters\": { \"refinements\": " << this->refinements << ", \"order\": " << this->order << ", \"threads\": " << this->threads
+    << ", \"repeat\": " << this->repeat << ", \"steps\": " << this->steps << " },\n";
+  out << "  \"memory_high_water\": " << get_memory_high_water() << ",\n";
+  out << "  \"runs\": [\n";
+  for(unsigned int run_i = 0; run_i < this->runs.size(); run_i++)
+  {
+    const Run& run = this->runs[run_i];
+    out << "    {\n";
+    out << "      \"wall_time\": " << run.wall_time << ",\n";
+    out << "      \"ndof\": " << run.ndof << ",\n";
+    out << "      \"dofs_per_second\": " << (run.wall_time > 0.0 ? run.ndof * (double) run.work_units / run.wall_time : 0.0) << ",\n";
+    for(unsigned int value_i = 0; value_i < run.values.size(); value_i++)
+      out << "      \"" << run.values[value_i].first << "\": " << run.values[value_i].second << ",\n";
+    out << "      \"assembly\": {\n";
+    for(int phase_i = 0; phase_i < AssemblyProfile::NumPhases; phase_i++)
+    {
+      AssemblyProfile::Phase phase = (AssemblyProfile::Phase) phase_i;
+      out << "        \"" << json_key(AssemblyProfile::get_phase_name(phase)) << "\": " << run.profile.get_time(phase) << ",\n";
+    }
+    out << "        \"total\": " << run.profile.get_total_time() << ",\n";
+    out << "        \"states\": " << run.profile.states << ",\n";
+    out << "        \"forms_evaluated\": " << run.profile.forms_evaluated << ",\n";
+    out << "        \"cache_hits\": " << run.profile.cache_hits << ",\n";
+    out << "        \"cache_misses\": " << run.profile.cache_misses << ",\n";
+    out << "        \"scatter_operations\": " << run.profile.scatter_operations << ",\n";
+    out << "        \"bytes_allocated\": " << run.profile.bytes_allocated << "\n";
+    out << "      }\n";
+    out << "    }" << (run_i + 1 < this->runs.size() ? "," : "") << "\n";
+  }
+  out << "  ]\n";
+  out << "}\n";
+
+  // Summary - the fastest run.
+  double best = -1.0;
+  int best_ndof = 0;
+  for(unsigned int run_i = 0; run_i < this->runs.size(); run_i++)
+    if(best < 0.0 || this->runs[run_i].wall_time < best)
+    {
+      best = this->runs[run_i].wall_time;
+      best_ndof = this->runs[run_i].ndof;
+    }
+  std::cout << this->name << ": ndof " << best_ndof << ", best of " << this->runs.size() << " runs " << best << " s, results in " << this->output << std::endl;
+}
@@ -0,0 +1,88 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the common part of the benchmarks (class Benchmark) - the parameters from the command line,
+/// the measured runs and their output in JSON.
+
+#ifndef __H2D_BENCHMARK_H
+#define __H2D_BENCHMARK_H
+
+#include "hermes2d.h"
+
+/// Parameters of a benchmark (the command line), the measured runs, and their output.
+/// Usage:<br>
+/// Benchmark benchmark("poisson-assembly", argc, argv);<br>
+/// for(int run_i = 0; run_i < benchmark.repeat; run_i++)<br>
+/// {<br>
+///&nbsp;benchmark.begin_run();<br>
+///&nbsp;// The workload.<br>
+///&nbsp;benchmark.end_run(ndof, dp.get_accumulated_assembly_profile());<br>
+/// }<br>
+/// benchmark.save();<br>
+class Benchmark
+{
+public:
+  /// Reads the parameters:<br>
+  ///&nbsp;--ref N ... number of the initial uniform mesh refinements (the size of the problem),<br>
+  ///&nbsp;--p N ... (initial) polynomial degree,<br>
+  ///&nbsp;--threads N ... number of the assembling threads,<br>
+  ///&nbsp;--repeat N ... number of the measured runs,<br>
+  ///&nbsp;--steps N ... number of the steps of a run (assemblies, time steps, adaptivity steps),<br>
+  ///&nbsp;--output file ... the JSON file, "name.json" by default.<br>
+  /// The defaults are those of the workload. Sets the number of threads to the Hermes2D API.
+  Benchmark(const char* name, int argc, char* argv[], int default_refinements, int default_order, int default_steps);
+
+  /// The full path of a data file (mesh) of the test example the benchmark is built from.
+  std::string data_file(const char* file) const;
+
+  /// Starts measuring one run.
+  void begin_run();
+
+  /// Ends the run - ndof is the (largest) number of DOFs of the run, work_units the number of times it was
+  /// processed (e.g. assemblies) - DOFs/s is then ndof * work_units per the wall-clock time.
+  void end_run(int ndof, const Hermes::Hermes2D::AssemblyProfile& profile, int work_units = 1);
+
+  /// An additional quantity of the last run (Newton iterations, adaptivity steps, ...).
+  void add_value(const char* name, double value);
+
+  /// Writes the parameters, the runs and the memory high-water mark to the output file, and a summary to the standard output.
+  void save() const;
+
+  /// The memory high-water mark of the process in bytes (0 if not available on the platform).
+  static size_t get_memory_high_water();
+
+  int refinements;
+  int order;
+  int threads;
+  int repeat;
+  int steps;
+
+private:
+  struct Run
+  {
+    double wall_time;
+    int ndof;
+    int work_units;
+    Hermes::Hermes2D::AssemblyProfile profile;
+    std::vector<std::pair<std::string, double> > values;
+  };
+
+  std::string name;
+  std::string output;
+  std::vector<Run> runs;
+  double run_start;
+};
+
+#endif
@@ -0,0 +1,93 @@
+#include "../benchmark.h"
+#include "../../test_examples/04-complex-adapt/definitions.h"
+
+using namespace Hermes::Hermes2D::RefinementSelectors;
+
+// hp-adaptivity of the complex-valued eddy current problem of the test example 04-complex-adapt
+// (wire, air and iron) - --steps adaptivity steps per run, each one a Newton's solve on the reference
+// space, the projection, the error estimate and the adaptation.
+//
+// Size: --ref uniform refinements of the initial mesh, --p initial polynomial degree.
+
+const double THRESHOLD = 0.3;
+const int STRATEGY = 0;
+const CandList CAND_LIST = H2D_HP_ANISO;
+const int MESH_REGULARITY = -1;
+const double CONV_EXP = 1.0;
+
+const double MU_0 = 4.0*M_PI*1e-7;
+const double MU_IRON = 1e3 * MU_0;
+const double GAMMA_IRON = 6e6;
+const double J_EXT = 1e6;
+const double FREQ = 5e3;
+const double OMEGA = 2 * M_PI * FREQ;
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    Benchmark benchmark("complex-adapt", argc, argv, 0, 1, 8);
+
+    Mesh basemesh;
+    MeshReaderH2D mloader;
+    mloader.load(benchmark.data_file("domain.mesh").c_str(), &basemesh);
+    for(int i = 0; i < benchmark.refinements; i++)
+      basemesh.refine_all_elements();
+
+    DefaultEssentialBCConst<std::complex<double> > bc_essential("Dirichlet", std::complex<double>(0.0, 0.0));
+    EssentialBCs<std::complex<double> > bcs(&bc_essential);
+
+    CustomWeakForm wf("Air", MU_0, "Iron", MU_IRON, GAMMA_IRON,
+      "Wire", MU_0, std::complex<double>(J_EXT, 0.0), OMEGA);
+
+    H1ProjBasedSelector<std::complex<double> > selector(CAND_LIST, CONV_EXP, H2DRS_DEFAULT_ORDER);
+
+    for(int run_i = 0; run_i < benchmark.repeat; run_i++)
+    {
+      // Every run adapts from the same initial mesh.
+      Mesh mesh;
+      mesh.copy(&basemesh);
+      H1Space<std::complex<double> > space(&mesh, &bcs, benchmark.order);
+      Solution<std::complex<double> > sln, ref_sln;
+
+      DiscreteProblem<std::complex<double> > dp(&wf, &space);
+      NewtonSolver<std::complex<double> > newton(&dp);
+
+      int max_ndof = 0, steps_done = 0;
+      benchmark.begin_run();
+      for(bool done = false; !done && steps_done < benchmark.steps; steps_done++)
+      {
+        Space<std::complex<double> >::ReferenceSpaceCreator ref_space_creator(&space, &mesh);
+        Space<std::complex<double> >* ref_space = ref_space_creator.create_ref_space();
+        newton.set_space(ref_space);
+        int ndof_ref = ref_space->get_num_dofs();
+        max_ndof = std::max(max_ndof, ndof_ref);
+
+        std::complex<double>* coeff_vec = new std::complex<double>[ndof_ref];
+        memset(coeff_vec, 0, ndof_ref * sizeof(std::complex<double>));
+        newton.solve_keep_jacobian(coeff_vec);
+        Solution<std::complex<double> >::vector_to_solution(newton.get_sln_vector(), ref_space, &ref_sln);
+
+        OGProjection<std::complex<double> > ogProjection;
+        ogProjection.project_global(&space, &ref_sln, &sln);
+
+        Adapt<std::complex<double> > adaptivity(&space);
+        adaptivity.calc_err_est(&sln, &ref_sln);
+        done = adaptivity.adapt(&selector, THRESHOLD, STRATEGY, MESH_REGULARITY);
+
+        delete [] coeff_vec;
+        delete ref_space;
+      }
+      benchmark.end_run(max_ndof, dp.get_accumulated_assembly_profile());
+      benchmark.add_value("adaptivity_steps", steps_done);
+    }
+
+    benchmark.save();
+  }
+  catch(std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include "../benchmark.h"
+#include "../../test_examples/10-linear-advection-dg-adapt/definitions.h"
+
+// hp-adaptivity of the linear advection of the test example 10-linear-advection-dg-adapt (discontinuous
+// Galerkin, circular flow in a square) - --steps adaptivity steps per run, each one a linear solve on the
+// globally refined reference mesh, the projection, the error estimate and the adaptation.
+//
+// Size: --ref uniform refinements of the initial mesh, --p initial polynomial degree.
+
+const double THRESHOLD = 0.9;
+const int STRATEGY = 0;
+const CandList CAND_LIST = H2D_HP_ANISO;
+const int MESH_REGULARITY = -1;
+const double CONV_EXP = 1.0;
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    Benchmark benchmark("linear-advection-dg-adapt", argc, argv, 2, 1, 6);
+
+    Mesh basemesh;
+    MeshReaderH2D mloader;
+    mloader.load(benchmark.data_file("square.mesh").c_str(), &basemesh);
+    for(int i = 0; i < benchmark.refinements; i++)
+      basemesh.refine_all_elements();
+
+    L2ProjBasedSelector<double> selector(CAND_LIST, CONV_EXP, H2DRS_DEFAULT_ORDER);
+    selector.set_error_weights(1, 1, 1);
+
+    for(int run_i = 0; run_i < benchmark.repeat; run_i++)
+    {
+      // Every run adapts from the same initial mesh.
+      Mesh mesh;
+      mesh.copy(&basemesh);
+      L2Space<double> space(&mesh, benchmark.order);
+      Solution<double> sln, ref_sln;
+
+      CustomWeakForm wf("Bdy_bottom_left", &mesh);
+      DiscreteProblemLinear<double> dp(&wf, &space);
+      LinearSolver<double> linear_solver(&dp);
+
+      int max_ndof = 0, steps_done = 0;
+      benchmark.begin_run();
+      for(bool done = false; !done && steps_done < benchmark.steps; steps_done++)
+      {
+        Mesh::ReferenceMeshCreator ref_mesh_creator(&mesh);
+        Mesh* ref_mesh = ref_mesh_creator.create_ref_mesh();
+        Space<double>::ReferenceSpaceCreator ref_space_creator(&space, ref_mesh);
+        Space<double>* ref_space = ref_space_creator.create_ref_space();
+        linear_solver.set_space(ref_space);
+        max_ndof = std::max(max_ndof, ref_space->get_num_dofs());
+
+        linear_solver.solve();
+        Solution<double>::vector_to_solution(linear_solver.get_sln_vector(), ref_space, &ref_sln);
+
+        OGProjection<double> ogProjection;
+        ogProjection.project_global(&space, &ref_sln, &sln, HERMES_L2_NORM);
+
+        Adapt<double> adaptivity(&space);
+        adaptivity.calc_err_est(&sln, &ref_sln);
+        done = adaptivity.adapt(&selector, THRESHOLD, STRATEGY, MESH_REGULARITY);
+
+        delete ref_space;
+        delete ref_mesh;
+      }
+      benchmark.end_run(max_ndof, dp.get_accumulated_assembly_profile());
+      benchmark.add_value("adaptivity_steps", steps_done);
+    }
+
+    benchmark.save();
+  }
+  catch(std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
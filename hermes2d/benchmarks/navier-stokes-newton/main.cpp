@@ -0,0 +1,99 @@
+#include "../benchmark.h"
+
+using namespace Hermes;
+using namespace Hermes::Hermes2D;
+
+// Newton's method for the time-dependent Navier-Stokes equations of the test example 03-navier-stokes
+// (channel with a circular obstacle, implicit Euler, pressure in L2) - --steps time steps per run.
+//
+// Size: --ref uniform refinements of the mesh (after those towards the boundaries), --p degree of
+// the velocity, at least 2 (the pressure has one less - the inf-sup condition).
+
+const bool STOKES = false;
+const double RE = 200.0;
+const double VEL_INLET = 1.0;
+const double STARTUP_TIME = 1.0;
+const double TAU = 0.1;
+const double NEWTON_TOL = 1e-3;
+const int NEWTON_MAX_ITER = 10;
+const double H = 5;
+
+const std::string BDY_BOTTOM = "1";
+const std::string BDY_RIGHT = "2";
+const std::string BDY_TOP = "3";
+const std::string BDY_LEFT = "4";
+const std::string BDY_OBSTACLE = "5";
+
+// Current time (used in weak forms).
+double current_time = 0;
+
+// Weak forms.
+#include "../../test_examples/03-navier-stokes/definitions.cpp"
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    Benchmark benchmark("navier-stokes-newton", argc, argv, 1, 2, 5);
+
+    Mesh mesh;
+    MeshReaderH2D mloader;
+    mloader.load(benchmark.data_file("domain.mesh").c_str(), &mesh);
+    mesh.refine_towards_boundary(BDY_OBSTACLE, 1, false);
+    mesh.refine_towards_boundary(BDY_TOP, 1, true);
+    mesh.refine_towards_boundary(BDY_BOTTOM, 1, true);
+    for(int i = 0; i < benchmark.refinements; i++)
+      mesh.refine_all_elements();
+
+    EssentialBCNonConst bc_left_vel_x(BDY_LEFT, VEL_INLET, H, STARTUP_TIME);
+    DefaultEssentialBCConst<double> bc_other_vel_x(Hermes::vector<std::string>(BDY_BOTTOM, BDY_TOP, BDY_OBSTACLE), 0.0);
+    EssentialBCs<double> bcs_vel_x(Hermes::vector<EssentialBoundaryCondition<double> *>(&bc_left_vel_x, &bc_other_vel_x));
+    DefaultEssentialBCConst<double> bc_vel_y(Hermes::vector<std::string>(BDY_LEFT, BDY_BOTTOM, BDY_TOP, BDY_OBSTACLE), 0.0);
+    EssentialBCs<double> bcs_vel_y(&bc_vel_y);
+
+    H1Space<double> xvel_space(&mesh, &bcs_vel_x, std::max(benchmark.order, 2));
+    H1Space<double> yvel_space(&mesh, &bcs_vel_y, std::max(benchmark.order, 2));
+    L2Space<double> p_space(&mesh, std::max(benchmark.order, 2) - 1);
+    Hermes::vector<const Space<double> *> spaces(&xvel_space, &yvel_space, &p_space);
+    int ndof = Space<double>::get_num_dofs(spaces);
+
+    for(int run_i = 0; run_i < benchmark.repeat; run_i++)
+    {
+      current_time = 0;
+      ConstantSolution<double> xvel_prev_time(&mesh, 0.0), yvel_prev_time(&mesh, 0.0), p_prev_time(&mesh, 0.0);
+      WeakFormNSNewton wf(STOKES, RE, TAU, &xvel_prev_time, &yvel_prev_time);
+      wf.set_ext(Hermes::vector<MeshFunction<double>*>(&xvel_prev_time, &yvel_prev_time));
+
+      DiscreteProblem<double> dp(&wf, spaces);
+      NewtonSolver<double> newton(&dp);
+      newton.set_newton_max_iter(NEWTON_MAX_ITER);
+      newton.set_newton_tol(NEWTON_TOL);
+
+      double* coeff_vec = new double[ndof];
+      memset(coeff_vec, 0, ndof * sizeof(double));
+
+      benchmark.begin_run();
+      for(int ts = 1; ts <= benchmark.steps; ts++)
+      {
+        current_time += TAU;
+        if(current_time <= STARTUP_TIME)
+          newton.set_time(current_time);
+        newton.solve_keep_jacobian(coeff_vec);
+        memcpy(coeff_vec, newton.get_sln_vector(), ndof * sizeof(double));
+        Hermes::vector<Solution<double> *> tmp(&xvel_prev_time, &yvel_prev_time, &p_prev_time);
+        Solution<double>::vector_to_solutions(newton.get_sln_vector(), spaces, tmp);
+      }
+      benchmark.end_run(ndof, dp.get_accumulated_assembly_profile(), benchmark.steps);
+
+      delete [] coeff_vec;
+    }
+
+    benchmark.save();
+  }
+  catch(std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
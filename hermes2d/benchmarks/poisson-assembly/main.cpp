@@ -0,0 +1,59 @@
+#include "../benchmark.h"
+#include "../../test_examples/01-poisson/definitions.h"
+
+using namespace Hermes::Algebra;
+
+// Assembly of the Poisson problem of the test example 01-poisson (two materials, L-shape domain) -
+// the matrix and the right-hand side are assembled --steps times per run, nothing is solved.
+//
+// Size: --ref uniform refinements of the mesh, --p uniform polynomial degree.
+
+const double LAMBDA_AL = 236.0;
+const double LAMBDA_CU = 386.0;
+const double VOLUME_HEAT_SRC = 5e2;
+const double FIXED_BDY_TEMP = 20.0;
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    Benchmark benchmark("poisson-assembly", argc, argv, 4, 4, 5);
+
+    Mesh mesh;
+    MeshReaderH2DXML mloader;
+    mloader.load(benchmark.data_file("domain.xml").c_str(), &mesh);
+    for(int i = 0; i < benchmark.refinements; i++)
+      mesh.refine_all_elements();
+
+    DefaultEssentialBCConst<double> bc_essential(Hermes::vector<std::string>("Bottom", "Inner", "Outer", "Left"), FIXED_BDY_TEMP);
+    EssentialBCs<double> bcs(&bc_essential);
+    H1Space<double> space(&mesh, &bcs, benchmark.order);
+
+    CustomWeakFormPoisson wf("Aluminum", new Hermes1DFunction<double>(LAMBDA_AL), "Copper",
+      new Hermes1DFunction<double>(LAMBDA_CU), new Hermes2DFunction<double>(-VOLUME_HEAT_SRC));
+
+    SparseMatrix<double>* matrix = create_matrix<double>();
+    Vector<double>* rhs = create_vector<double>();
+
+    for(int run_i = 0; run_i < benchmark.repeat; run_i++)
+    {
+      // A new DiscreteProblem per run - the first assembly fills the cache, the others reuse it.
+      DiscreteProblem<double> dp(&wf, &space);
+      benchmark.begin_run();
+      for(int step_i = 0; step_i < benchmark.steps; step_i++)
+        dp.assemble(matrix, rhs);
+      benchmark.end_run(space.get_num_dofs(), dp.get_accumulated_assembly_profile(), benchmark.steps);
+    }
+
+    delete matrix;
+    delete rhs;
+
+    benchmark.save();
+  }
+  catch(std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
@@ -28,6 +28,8 @@
 #include "exceptions.h"
 #include "../global.h"
 
+#define H2D_REGULAR_QUEUE_MIN_SORTED 256 ///< A minimum number of elements of the regular queue sorted at once by Adapt::sort_regular_queue(). \internal \ingroup g_adapt
+
 namespace Hermes
 {
   namespace Hermes2D
@@ -175,6 +177,19 @@ namespace Hermes
       bool adapt(RefinementSelectors::Selector<Scalar>* refinement_selector, double thr, int strat = 0,
         int regularize = -1, double to_be_processed = 0.0);
 
+      /// Coarsens the meshes and the orders based on results from calc_err_est(), the counterpart of adapt() for transient problems.
+      /** The sons of an element (all active, not the initial elements) whose errors sum up to less than thr times the largest element error
+      *  are merged back into it, the element gets the highest order of the sons. An active element with an error so small that
+      *  it stays below the same bound after it grows p_decay times is lowered by one order (if p_coarsening is set).
+      *  Meshes shared by more components are merged on the sum of the errors of all the components.
+      *  The typical use in a time step: calc_err_est() of the solution of the previous time step, coarsen(), then the usual
+      *  adaptivity loop, so that the refinements follow a moving front instead of accumulating.
+      *  \param[in] thr A threshold relative to the largest (squared) element error, e.g. 0.01.
+      *  \param[in] p_coarsening True to lower the orders, not just merge the elements.
+      *  \param[in] p_decay Assumed growth of the squared element error when its order is lowered by one.
+      *  \return The number of merged plus the number of lowered elements. */
+      int coarsen(double thr, bool p_coarsening = true, double p_decay = 10.0);
+
       /// Returns a squared error of an element.
       /** \param[in] A component index.
       *  \param[in] An element index.
@@ -192,7 +207,7 @@ namespace Hermes
       };
 
       /// Returns regular queue of elements
-      /** \return A regular queue. */
+      /** \return A regular queue. Only the first Adapt::regular_queue_sorted elements are guaranteed to be ordered, see sort_regular_queue(). */
       const Hermes::vector<ElementReference>& get_regular_queue() const;
 
       /// Apply a single refinement.
@@ -200,7 +215,8 @@ namespace Hermes
       void apply_refinement(const ElementToRefine& elem_ref);
 
       /// Apply a vector of refinements.
-      /** \param[in] A vector of refinements to apply. */
+      /** The meshes are refined in one batch each (Mesh::refine_elements_id()), the orders are set afterwards.
+       *  \param[in] A vector of refinements to apply. */
       virtual void apply_refinements(std::vector<ElementToRefine>& elems_to_refine);
 
       /// Returns a vector of refinements generated during the last execution of the method adapt().
@@ -209,6 +225,15 @@ namespace Hermes
 
       std::queue<ElementReference> priority_queue; ///< A queue of priority elements. Elements in this queue are processed before the elements in the Adapt::regular_queue.
       Hermes::vector<ElementReference> regular_queue; ///< A queue of elements which should be processes. The queue had to be filled by the method fill_regular_queue().
+      int regular_queue_sorted; ///< A number of leading elements of Adapt::regular_queue that are in their final order.
+
+      /// Makes sure that the first \a count elements of Adapt::regular_queue are sorted according to their error descending.
+      /** Only the needed part of the queue is selected (std::nth_element) and sorted, the rest stays unordered.
+      *  \param[in] count A number of elements that are needed. */
+      void sort_regular_queue(int count);
+
+      /// Returns a number of elements of Adapt::regular_queue whose error is at least \a threshold.
+      int count_regular_queue_errors_above(double threshold) const;
       std::vector<ElementToRefine> last_refinements; ///< A vector of refinements generated during the last finished execution of the method adapt().
 
       /// Fixes refinements of a mesh which is shared among multiple components of a multimesh.
@@ -234,6 +259,22 @@ namespace Hermes
       bool have_coarse_solutions;           ///< True if the coarse solutions were set.
       bool have_reference_solutions;        ///< True if the reference solutions were set.
 
+      /// Coarse and reference adjoint (dual) solutions, set by GoalOrientedAdapt.
+      /** If set (Adapt::have_dual_solutions), calc_err_internal() weights the error of the solution by the error of the adjoint solution,
+      *  i.e. the error form is evaluated on the pairs (rsln - sln, dual_rsln - dual_sln), and the errors are not squared. */
+      Solution<Scalar>* dual_sln[H2D_MAX_COMPONENTS];
+      Solution<Scalar>* dual_rsln[H2D_MAX_COMPONENTS];
+      bool have_dual_solutions;             ///< True if the adjoint solutions were set.
+
+      /// Copies of the reference solutions for threads, made by calc_err_internal() and reused by adapt().
+      /** The first index is the thread, the second one the component. NULL if not available.
+      *  The copies are handed over to adapt(), so that the reference solutions are not copied again for the selection. */
+      Solution<Scalar>*** rsln_thread_copies;
+      int rsln_thread_copies_num_threads;   ///< Number of threads the copies in Adapt::rsln_thread_copies were made for.
+
+      /// Deallocates Adapt::rsln_thread_copies.
+      void free_rsln_thread_copies();
+
       double* errors[H2D_MAX_COMPONENTS];   ///< Errors of elements. Meaning of the error depeds on flags used when the
       ///< method calc_errors_internal() was calls. Initialized in the method calc_errors_internal().
       double  errors_squared_sum;           ///< Sum of errors in the array Adapt::errors_squared. Used by a method adapt() in some strategies.
@@ -287,7 +328,8 @@ namespace Hermes
         MeshFunction<Scalar>*rsln1, MeshFunction<Scalar>*rsln2);
 
       /// Builds an ordered queue of elements that are be examined.
-      /** The method fills Adapt::standard_queue by elements sorted accordin to their error descending.
+      /** The method fills Adapt::standard_queue by elements, they are sorted accordin to their error descending on demand by sort_regular_queue().
+      *  An override that fills the queue in its own order should leave Adapt::regular_queue_sorted untouched.
       *  The method assumes that Adapt::errors_squared contains valid values.
       *  If a special order of elements is requested, this method has to be overridden.
       *  /param[in] meshes An array of pointers to meshes of a (coarse) solution. An index into the array is an index of a component.
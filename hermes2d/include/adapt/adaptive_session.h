@@ -0,0 +1,105 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef __H2D_ADAPTIVE_SESSION_H
+#define __H2D_ADAPTIVE_SESSION_H
+
+#include "../linear_solver.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// \class AdaptiveSession
+    /// \ingroup g_adapt
+    /// \brief The reference problems of the successive steps of an adaptivity loop (of a linear problem).
+    ///
+    /// Keeps what carries over from one step to the next, instead of creating it again in every step:
+    /// - the reference meshes are cached by the coarse meshes (Mesh::ReferenceMeshCreator), a step which changed only the orders does not refine again,
+    /// - the reference spaces keep the DOF numbers of the previous ones where the two coincide (ReferenceSpaceCreator::set_previous_ref_space()),
+    ///   so that the matrix changes only locally and the direct solvers can reuse the symbolic analysis if the pattern is the same,
+    /// - the one DiscreteProblemLinear keeps its cache, the elements not changed by the adaptivity (Space::ElementData::changed_in_last_adaptation)
+    ///   are not evaluated again with set_incremental_reassembly(),
+    /// - the previous reference solution is transferred to the new reference spaces (Space::transfer_coefficients())
+    ///   as the initial guess of an iterative matrix solver.
+    ///
+    /// Typical usage:<br>
+    /// AdaptiveSession<double> session(&wf, &space);<br>
+    /// do<br>
+    /// {<br>
+    ///&nbsp;session.solve();<br>
+    ///&nbsp;Solution<double>::vector_to_solution(session.get_sln_vector(), session.get_ref_spaces()[0], &ref_sln);<br>
+    ///&nbsp;OGProjection<double> ogProjection; ogProjection.project_global(&space, &ref_sln, &sln);<br>
+    ///&nbsp;Adapt<double> adaptivity(&space);<br>
+    ///&nbsp;err_est_rel = adaptivity.calc_err_est(&sln, &ref_sln) * 100;<br>
+    ///&nbsp;if(err_est_rel < ERR_STOP) break;<br>
+    ///&nbsp;adaptivity.adapt(&selector, THRESHOLD, STRATEGY, MESH_REGULARITY);<br>
+    /// }<br>
+    /// while(true);<br>
+    template<typename Scalar>
+    class HERMES_API AdaptiveSession : public Hermes::Mixins::Loggable, public Hermes::Mixins::TimeMeasurable
+    {
+    public:
+      /// Constructor.
+      /// \param[in] wf The weak formulation (of a linear problem).
+      /// \param[in] spaces The coarse spaces, changed by the adaptivity between the steps.
+      /// \param[in] order_increase The increase of the polynomial order of the reference spaces (see Space::ReferenceSpaceCreator).
+      /// \param[in] refinement The refinement of the reference meshes (see Mesh::ReferenceMeshCreator), -1 - p-only reference.
+      AdaptiveSession(const WeakForm<Scalar>* wf, Hermes::vector<Space<Scalar>*> spaces, unsigned int order_increase = 1, int refinement = 0);
+
+      /// Constructor for one equation.
+      AdaptiveSession(const WeakForm<Scalar>* wf, Space<Scalar>* space, unsigned int order_increase = 1, int refinement = 0);
+
+      virtual ~AdaptiveSession();
+
+      /// One step: creates the reference spaces of the current coarse spaces and solves the problem on them.
+      /// The reference spaces and the solution vector of the previous step are released.
+      void solve();
+
+      /// The reference spaces of the last solve(), owned by the session.
+      Hermes::vector<Space<Scalar>*> get_ref_spaces() const;
+
+      /// The solution vector of the last solve() (on the reference spaces).
+      Scalar* get_sln_vector();
+
+      /// The solver, e.g. for its settings (see LinearSolver::set_static_condensation()).
+      LinearSolver<Scalar>* get_linear_solver();
+
+      /// Incremental reassembly of the matrix, see DiscreteProblemLinear::set_incremental_reassembly().
+      /// Only for forms that do not change between the steps. Default: off.
+      void set_incremental_reassembly(bool to_set = true);
+
+      /// The previous reference solution as the initial guess of an iterative matrix solver. Default: on.
+      void set_use_initial_guess(bool to_set = true);
+
+    protected:
+      const WeakForm<Scalar>* wf;
+      Hermes::vector<Space<Scalar>*> spaces;
+      unsigned int order_increase;
+      int refinement;
+
+      /// The problem and the solver of all the steps.
+      DiscreteProblemLinear<Scalar>* dp;
+      LinearSolver<Scalar>* linear_solver;
+
+      /// The reference spaces and meshes of the last step (the spaces sharing a coarse mesh share the reference mesh).
+      Hermes::vector<Space<Scalar>*> ref_spaces;
+      Hermes::vector<Mesh*> ref_meshes;
+
+      /// See set_use_initial_guess().
+      bool use_initial_guess;
+    };
+  }
+}
+#endif
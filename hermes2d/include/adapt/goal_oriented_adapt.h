@@ -0,0 +1,81 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef __H2D_GOAL_ORIENTED_ADAPT_H
+#define __H2D_GOAL_ORIENTED_ADAPT_H
+
+#include "adapt.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// \class GoalOrientedAdapt
+    /// \ingroup g_adapt
+    /// \brief Goal-oriented (dual-weighted residual) adaptivity.
+    ///
+    /// The elements are refined in order to decrease the error of a goal functional, J(u) - J(u_h), instead of the error
+    /// in a norm ([1]). The error of the solution is weighted by the error of the adjoint (dual) solution z,
+    /// J'(u)(v) = a'(u)(v, z) for all v, element by element:
+    /// eta_K = sum_ij |a_ij,K(u_ref_i - u_i, z_ref_j - z_j)|,
+    /// where a_ij are the error forms (set_error_form()), which should be the bilinear form of the problem
+    /// (its Jacobian for a nonlinear one). The default forms are the ones of the projection norms,
+    /// e.g. the H1 product is the bilinear form of the Poisson equation.
+    /// The indicators and the returned estimate are not squared and always absolute (HERMES_TOTAL_ERROR_ABS | HERMES_ELEMENT_ERROR_ABS).
+    ///
+    /// Typical usage:<br>
+    /// // The primal problem on the reference space.<br>
+    /// NewtonSolver<double> newton(&wf, ref_space);<br>
+    /// newton.solve(coeff_vec);<br>
+    /// Solution<double>::vector_to_solution(newton.get_sln_vector(), ref_space, &ref_sln);<br>
+    /// // The adjoint problem with the (transposed) Jacobian and its factorization, goal_wf holds J'(u).<br>
+    /// newton.solve_adjoint(&goal_wf, dual_coeff_vec);<br>
+    /// Solution<double>::vector_to_solution(dual_coeff_vec, ref_space, &dual_ref_sln);<br>
+    /// // The coarse solutions are the projections to the coarse space.<br>
+    /// OGProjection<double> ogProjection; ogProjection.project_global(&space, &ref_sln, &sln);<br>
+    /// ogProjection.project_global(&space, &dual_ref_sln, &dual_sln);<br>
+    /// GoalOrientedAdapt<double> adaptivity(&space);<br>
+    /// double goal_err_est = adaptivity.calc_err_est(&sln, &ref_sln, &dual_sln, &dual_ref_sln);<br>
+    /// adaptivity.adapt(&selector, THRESHOLD, STRATEGY, MESH_REGULARITY);<br>
+    ///
+    /// References:
+    ///  [1] Becker R., Rannacher R.:
+    ///&nbsp;    An optimal control approach to a posteriori error estimation in finite element methods.
+    ///&nbsp;    Acta Numerica 10 (2001) 1–102.
+    template<typename Scalar>
+    class HERMES_API GoalOrientedAdapt : public Adapt<Scalar>
+    {
+    public:
+      /// Constructor, see Adapt::Adapt().
+      GoalOrientedAdapt(Hermes::vector<Space<Scalar>*> spaces, Hermes::vector<ProjNormType> proj_norms = Hermes::vector<ProjNormType>());
+
+      /// Constructor, see Adapt::Adapt().
+      GoalOrientedAdapt(Space<Scalar>* space, ProjNormType proj_norm = HERMES_UNSET_NORM);
+
+      /// Calculates the goal-oriented error estimate for one solution.
+      /// @param[in] sln, rsln - the coarse and the reference solution, as in Adapt::calc_err_est().
+      /// @param[in] dual_sln, dual_rsln - the coarse and the reference adjoint solution.
+      /// @param[in] solutions_for_adapt - if sln and rsln are the solutions error of which is used in the function adapt().
+      double calc_err_est(Solution<Scalar>* sln, Solution<Scalar>* rsln, Solution<Scalar>* dual_sln, Solution<Scalar>* dual_rsln,
+        bool solutions_for_adapt = true);
+
+      /// Calculates the goal-oriented error estimate, the vectors have the size of the number of the spaces.
+      /// @param[in] solutions_for_adapt - if slns and rslns are the solutions error of which is used in the function adapt().
+      double calc_err_est(Hermes::vector<Solution<Scalar>*> slns, Hermes::vector<Solution<Scalar>*> rslns,
+        Hermes::vector<Solution<Scalar>*> dual_slns, Hermes::vector<Solution<Scalar>*> dual_rslns,
+        Hermes::vector<double>* component_errors = NULL, bool solutions_for_adapt = true);
+    };
+  }
+}
+#endif
@@ -122,21 +122,22 @@ namespace Hermes
       };
 
     protected:
-      DiscreteProblem<Scalar> dp; // Only needed for gaining access to NeighborSearch methods.
-
       ///
       /// Functions used for evaluating the actual error estimator forms for an active element or edge segment.
+      /// The solutions are passed explicitly, so that each thread may use its own copies.
       ///
       double eval_volumetric_estimator(typename KellyTypeAdapt::ErrorEstimatorForm* err_est_form,
+                                       Solution<Scalar>** slns,
                                        RefMap* rm);
       double eval_boundary_estimator(typename KellyTypeAdapt::ErrorEstimatorForm* err_est_form,
+                                     Solution<Scalar>** slns,
                                      RefMap* rm,
                                      SurfPos* surf_pos);
+      /// Evaluates the estimator on the active segment of \c nbs. Sets the active element and transformations
+      /// of \c sln itself.
       double eval_interface_estimator(typename KellyTypeAdapt::ErrorEstimatorForm* err_est_form,
-                                      RefMap *rm,
-                                      SurfPos* surf_pos,
-                                      LightArray<NeighborSearch<Scalar>*>& neighbor_searches,
-                                      int neighbor_index);
+                                      Solution<Scalar>* sln,
+                                      NeighborSearch<Scalar>* nbs);
       double eval_solution_norm(typename Adapt<Scalar>::MatrixFormVolError* form,
                                 RefMap* rm,
                                 MeshFunction<Scalar>* sln);
@@ -169,6 +170,22 @@ namespace Hermes
       /// (<c>ignore_visited_segments == true</c>).
       bool ignore_visited_segments;
 
+      /// A segment of an inner edge of the mesh of a component, shared by the active element \c e and its neighbor
+      /// \c neighb across the edge \c edge (\c neighbor is its index in EdgeNeighborTable::get_neighbors()).
+      struct InterfaceSegment
+      {
+        int component;
+        Element* e;
+        int edge;
+        int neighbor;
+        Element* neighb;
+      };
+
+      /// Appends the segments of the inner edges of \c mesh on which the interface estimators of \c component
+      /// are evaluated. With \c ignore_visited_segments, each segment is listed once - from the bigger element,
+      /// or from the one with the lower id if both are of the same size - otherwise once from each side.
+      void get_interface_segments(int component, const Mesh* mesh, Hermes::vector<InterfaceSegment>& segments) const;
+
       /// Calculates error estimates for each solution component, the total error estimate, and possibly also
       /// their normalizations. If called with a pair of solutions, the version from Adapt is used (this is e.g.
       /// done when comparing approximate solution to the exact one - in this case, we do not want to compute
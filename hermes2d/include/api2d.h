@@ -39,7 +39,15 @@ namespace Hermes
     {
       numThreads,
 			xmlSchemasDirPath,
-			precalculatedFormsDirPath
+      /// Directory of the on-disk cache of the precalculated tables (see PrecalculatedTables), empty - no cache.
+			precalculatedFormsDirPath,
+      /// Non-zero: the XML files are loaded by the streaming XMLStreamReader when the validation is off (default 0).
+      xmlStreaming,
+      /// Budget in megabytes of the precalculated shape function tables shared by all threads (default 256).
+      precalcSharedCacheSize,
+      /// Non-zero: compensated (Kahan) / pairwise summation in the quadrature sums of the norms and errors
+      /// (integrals/h1.h), in the reductions of Global::calc_norm() etc. and in the error totals of Adapt (default 0).
+      compensatedSummation
     };
 
     /// API Class containing settings for the whole Hermes2D.
@@ -66,6 +74,7 @@ namespace Hermes
       /// The storage of parameters.
       /// This storage is not optimized for speed, but for comfort of users.
       /// There should not be any parameters, values of which are sought very often, because of the above reason.
+      /// The ones that are have the cached typed accessors below.
 
 			std::map<Hermes2DApiParam, Parameter<int>*> integral_parameters;
       std::map<Hermes2DApiParam, Parameter<std::string>*> text_parameters;
@@ -75,7 +84,35 @@ namespace Hermes
 
 			void set_integral_param_value(Hermes2DApiParam, int value);
 			void set_text_param_value(Hermes2DApiParam, std::string value);
+
+      /// Typed accessors of the integral parameters read in the hot paths (assembly, adaptivity, linearization,
+      /// integration). The values are cached when set, no lookup in the storage.
+      /// The value of numThreads.
+      int get_num_threads() const { return this->num_threads; }
+      /// The value of xmlStreaming.
+      bool get_xml_streaming() const { return this->xml_streaming; }
+      /// The value of precalcSharedCacheSize (megabytes).
+      int get_precalc_shared_cache_size() const { return this->precalc_shared_cache_size; }
+      /// The value of compensatedSummation.
+      bool get_compensated_summation() const { return this->compensated_summation; }
+
+      /// Change notification: the callback is called with the parameter, its new value and data after every
+      /// set_integral_param_value() and set_text_param_value(), e.g. for the values cached outside of the Api.
+      /// The same signature as Hermes::Api::ParamChangedCallback; for a text parameter the value is 0,
+      /// the new text is get_text_param_value(param).
+      typedef void (*ParamChangedCallback)(Hermes2DApiParam param, int value, void* data);
+      void add_param_changed_callback(ParamChangedCallback callback, void* data = NULL);
+      void remove_param_changed_callback(ParamChangedCallback callback, void* data = NULL);
 		private:
+      /// Notifies the callbacks.
+      void param_changed(Hermes2DApiParam param, int value);
+
+      int num_threads;
+      bool xml_streaming;
+      int precalc_shared_cache_size;
+      bool compensated_summation;
+
+      std::vector<std::pair<ParamChangedCallback, void*> > param_changed_callbacks;
 
 			friend class Mesh;
 			friend class MeshReaderH2DXML;
@@ -0,0 +1,92 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the bump allocator for short-lived assembling temporaries (class Arena).
+
+#ifndef __H2D_ARENA_H
+#define __H2D_ARENA_H
+
+#include "global.h"
+
+/// Alignment of the Arena allocations (a cache line, enough for any SIMD load).
+#define H2D_ARENA_ALIGNMENT 64
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup inner
+    /// Bump allocator for the temporaries of one assembled state (ext functions, local matrices, pointer arrays).
+    /// Allocation is a pointer increment, nothing is freed individually - reset() releases everything at once
+    /// and keeps the memory for the next state. Not thread-safe, every assembling thread owns one.
+    /// Only for data without destructors (POD arrays, Func<Scalar> filled by init_fn()).
+    class HERMES_API Arena
+    {
+    public:
+      /// \param[in] block_size Size of the first block in bytes, further blocks grow as needed.
+      Arena(size_t block_size = 64 * 1024);
+      ~Arena();
+
+      /// Uninitialized memory, aligned to H2D_ARENA_ALIGNMENT bytes.
+      void* allocate(size_t bytes);
+
+      /// Uninitialized array.
+      template<typename T>
+      T* allocate_array(size_t count)
+      {
+        return (T*)this->allocate(count * sizeof(T));
+      }
+
+      /// Zeroed m x n matrix with the layout of new_matrix() (row pointers followed by the rows).
+      template<typename T>
+      T** allocate_matrix(unsigned int m, unsigned int n = 0)
+      {
+        if(!n) n = m;
+        T** vec = (T**)this->allocate(sizeof(T*) * m + sizeof(T) * m * n);
+        memset(vec, 0, sizeof(T*) * m + sizeof(T) * m * n);
+        T* row = (T*)(vec + m);
+        for (unsigned int i = 0; i < m; i++, row += n)
+          vec[i] = row;
+        return vec;
+      }
+
+      /// Releases all the allocations. If the state did not fit into one block, the blocks are merged
+      /// so that the next state of the same size does not reach for the heap at all.
+      void reset();
+
+      /// Bytes reserved from the heap.
+      size_t get_reserved_size() const;
+
+      /// Bytes handed out since the last reset().
+      size_t get_used_size() const;
+
+    private:
+      struct Block
+      {
+        char* data;
+        size_t size;
+      };
+      std::vector<Block> blocks;
+      /// The block being filled and the first free byte in it.
+      unsigned int current_block;
+      size_t offset;
+      /// Bytes handed out since the last reset().
+      size_t used;
+
+      void add_block(size_t min_size);
+    };
+  }
+}
+#endif
@@ -0,0 +1,166 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the per-phase times and counters of one assembling (class AssemblyProfile).
+
+#ifndef __H2D_ASSEMBLY_PROFILE_H
+#define __H2D_ASSEMBLY_PROFILE_H
+
+#include "global.h"
+
+/// Every H2D_FORM_PROFILE_SAMPLING-th evaluation of a form is timed (see FormProfile), the counters are exact.
+#define H2D_FORM_PROFILE_SAMPLING 16
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup inner
+    /// The counters and times of one form (see DiscreteProblem::set_form_profiling(), WeakForm::print_form_profile()).
+    /// An evaluation is the local block (vector) of the form on one element, or one edge for the surface and DG forms.
+    /// Only every H2D_FORM_PROFILE_SAMPLING-th evaluation is timed, the evaluation time is extrapolated from these.
+    class HERMES_API FormProfile
+    {
+    public:
+      FormProfile();
+
+      void reset();
+      void add(const FormProfile& other);
+
+      /// Estimated time of all the evaluations (thread-seconds).
+      double get_evaluation_time() const;
+      /// Average integration order and number of the integration points of the evaluations.
+      double get_average_order() const;
+      double get_average_points() const;
+
+      /// Number of the evaluations, and of those timed.
+      unsigned long long evaluations;
+      unsigned long long sampled_evaluations;
+      /// Time of the timed evaluations.
+      double sampled_time;
+      /// Sums of the orders and the points of the evaluations.
+      unsigned long long order_sum;
+      unsigned long long points_sum;
+      /// Calls of ord() (the integration order of the form, cached - see Form::set_order_caching()) and their time.
+      unsigned long long ord_calls;
+      double ord_time;
+      /// The elements (edges) where the form was not assembled (areas, missing components, zero scaling).
+      unsigned long long skipped;
+
+      /// Counts one evaluation from its construction to its destruction, nothing if profile is NULL.
+      class HERMES_API Evaluation
+      {
+      public:
+        Evaluation(FormProfile* profile, int order, int n_quadrature_points);
+        ~Evaluation();
+      private:
+        FormProfile* profile;
+        double start;
+      };
+
+      /// Times one ord() call, nothing if profile is NULL.
+      class HERMES_API OrdCall
+      {
+      public:
+        OrdCall(FormProfile* profile);
+        ~OrdCall();
+      private:
+        FormProfile* profile;
+        double start;
+      };
+    };
+
+    /// @ingroup inner
+    /// Times of the phases and counters of one DiscreteProblem::assemble() call (see DiscreteProblem::get_assembly_profile()).
+    /// Every assembling thread fills its own instance, these are summed after the assembling - the times are thread-seconds,
+    /// with more threads their sum exceeds the wall-clock time of assemble().
+    class HERMES_API AssemblyProfile
+    {
+    public:
+      /// The phases of the assembling.
+      enum Phase
+      {
+        /// Getting the states, the assembly lists and setting the active elements.
+        Traversal = 0,
+        /// The integration points, their geometry and the jacobians times the weights.
+        Geometry,
+        /// The values of the shape functions in the integration points.
+        ShapePrecalculation,
+        /// The integration orders of the forms (the Ord evaluation).
+        OrderEstimation,
+        /// The forms evaluated on the local blocks.
+        FormEvaluation,
+        /// Adding the local blocks to the matrix and the vector.
+        Scatter,
+        NumPhases
+      };
+
+      AssemblyProfile();
+
+      /// Zero times and counters.
+      void reset();
+
+      /// Adds the times and counters of other (of another thread).
+      void add(const AssemblyProfile& other);
+
+      /// Time of the phase in seconds, summed over the threads.
+      double get_time(Phase phase) const;
+
+      /// Sum of the times of all the phases.
+      double get_total_time() const;
+
+      /// Name of the phase (for logs).
+      static const char* get_phase_name(Phase phase);
+
+      /// Times of the phases.
+      double times[NumPhases];
+      /// Number of the assembled states.
+      unsigned long long states;
+      /// Number of the forms evaluated on local blocks.
+      unsigned long long forms_evaluated;
+      /// States with the (volumetric) cache records found, and those calculated.
+      unsigned long long cache_hits;
+      unsigned long long cache_misses;
+      /// Number of the local blocks added to the matrix and the vector.
+      unsigned long long scatter_operations;
+      /// Bytes of the short-lived temporaries (Arena) and of the new cache records.
+      unsigned long long bytes_allocated;
+      /// Per form (by the position in WeakForm::get_forms()), empty unless DiscreteProblem::set_form_profiling() is on.
+      std::vector<FormProfile> forms;
+
+      /// Adds the time from its construction to its destruction to the phase of profile, nothing if profile is NULL.
+      /// The timers nest (e.g. the scatter inside the form evaluation), the enclosing phase is paused meanwhile - the times
+      /// of the phases are exclusive.
+      class HERMES_API Timer
+      {
+      public:
+        Timer(AssemblyProfile* profile, Phase phase);
+        ~Timer();
+        /// Ends the measurement before the destruction.
+        void stop();
+      private:
+        AssemblyProfile* profile;
+        Phase phase;
+        int enclosing_phase;
+      };
+
+    private:
+      /// The phase being measured (-1 for none) and the time since when.
+      int active_phase;
+      double phase_start;
+    };
+  }
+}
+#endif
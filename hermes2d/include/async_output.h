@@ -0,0 +1,156 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_ASYNC_OUTPUT_H
+#define __H2D_ASYNC_OUTPUT_H
+
+#include "calculation_continuity.h"
+#include "views/linearizer_base.h"
+#include <deque>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// Output written by a background thread while the computation proceeds: Solution::save(), Linearizer::save_solution_vtk()
+    /// and the records of CalculationContinuity. The state to write is snapshotted when it is queued: the solutions are copied,
+    /// the meshes only when they changed (see Mesh::get_seq()) since their last snapshot. So the next time step may change the
+    /// solutions and refine the meshes right away.
+    /// The errors of the writing are thrown by the next call (and by wait()).
+    /// Typical usage:
+    /// Hermes::Hermes2D::AsyncOutput<double> output;
+    /// for(int ts = 1; ...)
+    /// {
+    ///   ...
+    ///   output.save_solution_vtk(&sln, "sln.vtk", "u");
+    ///   output.add_record(&continuity, time, ts, meshes, spaces, slns);
+    /// }
+    /// output.wait();
+    template<typename Scalar>
+    class HERMES_API AsyncOutput
+    {
+    public:
+      /// With more than max_queued_jobs jobs waiting, queueing waits for the writing (the snapshots take memory).
+      AsyncOutput(int max_queued_jobs = 4);
+
+      /// Writes the queued output first.
+      ~AsyncOutput();
+
+      /// Solution::save() of the current state of sln.
+      void save_solution(Solution<Scalar>* sln, const char* filename);
+
+      /// Solution::save_binary() of the current state of sln.
+      void save_solution_binary(Solution<Scalar>* sln, const char* filename);
+
+      /// Linearizer::save_solution_vtk() of the current state of sln (the linearization is done by the background thread, too).
+      /// Real solutions only.
+      void save_solution_vtk(Solution<Scalar>* sln, const char* filename, const char* quantity_name, bool mode_3D = true, int item = H2D_FN_VAL_0, double eps = Views::HERMES_EPS_NORMAL);
+
+      /// CalculationContinuity::add_record(), see there. The record, its spaces, time steps and error are saved at once,
+      /// the meshes and the solutions by the background thread. The calls of continuity (and the loading from its records)
+      /// have to wait() for the records queued before.
+      void add_record(CalculationContinuity<Scalar>* continuity, double time, unsigned int number, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces = Hermes::vector<Space<Scalar>*>(), Hermes::vector<Solution<Scalar>*> slns = Hermes::vector<Solution<Scalar>*>(), double time_step = 0.0, double time_step_n_minus_one = 0.0, double error = 0.0);
+      void add_record(CalculationContinuity<Scalar>* continuity, double time, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces = Hermes::vector<Space<Scalar>*>(), Hermes::vector<Solution<Scalar>*> slns = Hermes::vector<Solution<Scalar>*>(), double time_step = 0.0, double time_step_n_minus_one = 0.0, double error = 0.0);
+      void add_record(CalculationContinuity<Scalar>* continuity, unsigned int number, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces = Hermes::vector<Space<Scalar>*>(), Hermes::vector<Solution<Scalar>*> slns = Hermes::vector<Solution<Scalar>*>(), double time_step = 0.0, double time_step_n_minus_one = 0.0, double error = 0.0);
+
+      /// Waits until all the queued output is written. Throws the first error of the writing.
+      void wait();
+
+    protected:
+      /// A copy of a mesh, shared by the jobs queued while the mesh stays unchanged.
+      struct MeshSnapshot
+      {
+        Mesh* mesh;
+        unsigned seq;
+        /// The queued jobs using the snapshot, and the snapshot being the current one of its mesh.
+        int references;
+      };
+
+      enum JobType
+      {
+        saveSolution,
+        saveSolutionBinary,
+        saveSolutionVtk,
+        saveRecord
+      };
+
+      struct Job
+      {
+        JobType type;
+        std::string filename;
+        std::string quantity_name;
+        bool mode_3D;
+        int item;
+        double eps;
+        /// The copies of the solutions, on the meshes of the snapshots.
+        Hermes::vector<Solution<Scalar>*> slns;
+        Hermes::vector<MeshSnapshot*> meshes;
+        /// The copies of the meshes of the record.
+        Hermes::vector<Mesh*> record_meshes;
+        /// The record the meshes and solutions are saved into.
+        typename CalculationContinuity<Scalar>::Record* record;
+      };
+
+      /// The current snapshot of the mesh, a new one if the mesh changed. Adds a reference of a job.
+      MeshSnapshot* snapshot(Mesh* mesh);
+      /// A copy of the solution on the snapshot of its mesh, added to the job.
+      Solution<Scalar>* snapshot(Solution<Scalar>* sln, Job* job);
+
+      /// A record job with the snapshots of the meshes and the solutions.
+      Job* new_record_job(Hermes::vector<Mesh*> meshes, Hermes::vector<Solution<Scalar>*> slns);
+
+      /// Queues the job, waits while the queue is full.
+      void enqueue(Job* job);
+
+      /// A new job of the type, throwing the error of the writing first.
+      Job* new_job(JobType type);
+
+      /// Writes the job (in the background thread).
+      void write(Job* job);
+
+      /// Frees the copies of the job (in the background thread).
+      void free_job(Job* job);
+
+      void release(MeshSnapshot* snapshot);
+
+      /// Throws (and forgets) the first error of the writing.
+      void rethrow_caught_exception();
+
+      static void* thread_func(void* param);
+
+      int max_queued_jobs;
+
+      /// The latest snapshot of every mesh.
+      std::map<Mesh*, MeshSnapshot*> snapshots;
+
+      std::deque<Job*> jobs;
+
+      /// A job is being written by the thread.
+      bool writing;
+
+      bool should_quit;
+
+      Hermes::Exceptions::Exception* caughtException;
+
+      pthread_t thread;
+
+      /// Protects everything above, the conditions signal a new job and a written one.
+      pthread_mutex_t mutex;
+      pthread_cond_t cond_job_queued;
+      pthread_cond_t cond_job_written;
+    };
+  }
+}
+#endif
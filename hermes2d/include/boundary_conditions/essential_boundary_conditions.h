@@ -62,6 +62,10 @@ namespace Hermes
       /// \param[in] t_y the y-component of the tangent(perpendicular to normal).
       virtual Scalar value(double x, double y, double n_x, double n_y, double t_x, double t_y) const = 0;
 
+      /// The values at n points at once (all the points of a boundary edge) into result, the default calls value()
+      /// point by point. Override it if the condition is cheaper to evaluate at many points together.
+      virtual void values(int n, const double* x, const double* y, const double* n_x, const double* n_y, const double* t_x, const double* t_y, Scalar* result) const;
+
       /// Set the current time for time-dependent boundary conditions.
       void set_current_time(double time);
 
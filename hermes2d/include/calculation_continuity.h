@@ -20,6 +20,9 @@
 \brief Calculation CalculationContinuity functionality.
 */
 
+#ifndef __H2D_CALCULATION_CONTINUITY_H
+#define __H2D_CALCULATION_CONTINUITY_H
+
 #include "config.h"
 #include "compat.h"
 #include "function/solution.h"
@@ -74,8 +77,25 @@ namespace Hermes
         onlyNumber
       };
 
+      /// Format of the mesh and solution files of the records.
+      /// The spaces are saved in the binary format of Space::save_binary() in both.
+      enum RecordFormat
+      {
+        xmlRecords,
+        binaryRecords
+      };
+
       CalculationContinuity(IdentificationMethod identification_method);
 
+      /// Sets the format of the records added from now on, XML by default.
+      /// The binary records hold the meshes in the format of MeshReaderH2DBinary and the solutions in the one of
+      /// Solution::save_binary() (the exact solutions are saved in XML).
+      void set_record_format(RecordFormat record_format);
+
+      /// Compresses the binary files (also the spaces) of the records added from now on, by gzip on its fastest level.
+      /// Needs Hermes built WITH_ZLIB.
+      void set_compression(bool compression);
+
       /// One record of the calculation. Stores every information to resume a calculation from this one point.
       class HERMES_API Record
       {
@@ -86,11 +106,13 @@ namespace Hermes
         Record(unsigned int number);
 
         /// Saves vector of meshes.
+        /// In a record added to a CalculationContinuity, a mesh unchanged (see Mesh::get_seq()) since the last record is
+        /// not saved again, the record refers to the file of the earlier one.
         void save_meshes(Hermes::vector<Mesh*> meshes);
         /// Saves one mesh.
         void save_mesh(Mesh* mesh);
 
-        /// Saves vector of spaces.
+        /// Saves vector of spaces (in the binary format of Space::save_binary(), loading also reads the older XML records).
         void save_spaces(Hermes::vector<Space<Scalar>*> spaces);
         /// Saves one space.
         void save_space(Space<Scalar>* space);
@@ -141,6 +163,19 @@ namespace Hermes
         unsigned int get_number();
 
       private:
+        /// The name of the file of the i-th entity of this record with the given prefix, the names of the other formats
+        /// are derived from this one.
+        std::string file_name(const std::string& prefix, unsigned int i) const;
+
+        void save_mesh_file(unsigned int i, Mesh* mesh);
+        void load_mesh_file(unsigned int i, Mesh* mesh);
+        void save_space_file(unsigned int i, Space<Scalar>* space);
+        void save_solution_file(unsigned int i, Solution<Scalar>* solution);
+        void load_solution_file(unsigned int i, Solution<Scalar>* solution, Space<Scalar>* space);
+
+        /// The CalculationContinuity the record was added to, NULL for the records created by the user.
+        CalculationContinuity<Scalar>* continuity;
+
         /// Storage of filenames of needed mesh files.
         Hermes::vector<std::string> meshFiles;
         /// Storage of filenames of needed space files.
@@ -151,6 +186,8 @@ namespace Hermes
         /// Internals. Used for identifying.
         double time;
         unsigned int number;
+
+        friend class CalculationContinuity<Scalar>;
       };
 
       /// Add a record.
@@ -215,7 +252,17 @@ namespace Hermes
       /// Count of records.
       int num;
 
+      /// See set_record_format().
+      RecordFormat record_format;
+
+      /// See set_compression().
+      bool compression;
+
+      /// The Mesh::get_seq() of every mesh saved by the records and the file it was saved into.
+      std::map<Mesh*, std::pair<unsigned, std::string> > saved_meshes;
+
       friend class Record;
     };
   }
-}
\ No newline at end of file
+}
+#endif
@@ -26,12 +26,27 @@
 #include "refinement_selectors/selector.h"
 #include "exceptions.h"
 #include "mixins2d.h"
+#include "assembly_profile.h"
+#include <list>
+
+/// Number of locks guarding the assembly cache (elements are distributed among them by their id).
+#define H2D_CACHE_LOCKS 64
+
+/// Maximum number of the local matrices kept per form for the congruent elements (see MatrixFormVol::set_constant_coefficients()).
+#define H2D_MAX_CONGRUENT_MATRICES 256
+
+/// Maximum number of the states assembled as one batch (see DiscreteProblem::set_state_batching()).
+#define H2D_STATE_BATCH_SIZE 8
+
+/// Number of 64-bit words of the integration order cache key (ten orders of six bits per word, see DiscreteProblem::OrderKey).
+#define H2D_ORDER_KEY_WORDS 3
 
 namespace Hermes
 {
   namespace Hermes2D
   {
     class PrecalcShapeset;
+    class ReferenceMatrices;
 
     /// @ingroup inner
     /// Multimesh neighbors traversal class.
@@ -54,13 +69,15 @@ namespace Hermes
       template<typename Scalar> friend class KellyTypeAdapt;
     };
 
+    template<typename Scalar> class AssemblyTask;
+
     /// @ingroup inner
     /// Discrete problem class.
     ///
     /// This class does assembling into external matrix / vector structures.
     ///
     template<typename Scalar>
-    class HERMES_API DiscreteProblem : public DiscreteProblemInterface<Scalar>, public Hermes::Mixins::TimeMeasurable, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable
+    class HERMES_API DiscreteProblem : public DiscreteProblemInterface<Scalar>, public Hermes::Mixins::TimeMeasurable, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       /// Constructor for multiple components / equations.
@@ -73,8 +90,11 @@ namespace Hermes
       virtual bool isOkay() const;
       virtual inline std::string getClassName() const { return "DiscreteProblem"; }
 
-      /// Set this problem to Finite Volume (no integration order calculation).
-      void set_fvm();
+      /// Set this problem to Finite Volume (no integration order calculation) - for the piecewise constant spaces
+      /// (L2Space of order 0): the forms are integrated by the one-point (midpoint) rules on the elements and on the edges
+      /// instead of the orders estimated by Ord (and the order 20 of the DG edges), and the interfaces of the DG forms are
+      /// found once per assembling (set_DG_interfaces_precalculation()). Other spaces throw in the assembling.
+      void set_fvm(bool to_set = true);
 
       /// Sets new spaces for the instance.
       virtual void set_spaces(Hermes::vector<const Space<Scalar>*> spaces);
@@ -89,6 +109,72 @@ namespace Hermes
       /// If the cache should not be used for any reason.
       inline void set_do_not_use_cache() { this->do_not_use_cache = true; }
 
+      /// If the traversal of the union mesh should not be stored up-front (a flat array of states handed out to the threads
+      /// without any locking), but generated state by state in a critical section. Uses less memory, scales worse.
+      inline void set_do_not_store_states() { this->do_not_store_states = true; }
+
+      /// If the matrix should be assembled through thread-private buffers (if the matrix type supports it),
+      /// summed up in an order independent of the number of threads. Then the assembled matrix is bit-reproducible.
+      /// Requires the states to be stored (see set_do_not_store_states()).
+      inline void set_reproducible_assembly() { this->reproducible_assembly = true; }
+
+      /// If the states should be coloured so that no two states of the same colour share a DOF, and assembled colour by colour.
+      /// The states of one colour are assembled in parallel adding to the matrix and vector without any synchronization
+      /// (see Matrix::set_conflict_free_assembly()), the order of additions to every entry does not depend on the threads.
+      /// Requires the states to be stored (see set_do_not_store_states()), not used with DG forms (they add to the neighbors' DOFs).
+      inline void set_coloured_assembly(bool to_set = true) { this->coloured_assembly = to_set; }
+
+      /// If the states should be assembled in batches of the states of the same type (element mode, orders of the elements
+      /// of all the spaces and the marker, hence the same integration orders), at most H2D_STATE_BATCH_SIZE states each.
+      /// The states are sorted by the type (within every colour, see set_coloured_assembly()), a batch is assembled by one thread,
+      /// and the volumetric matrix forms from the reference element matrices (see MatrixFormVol::set_reference_matrices())
+      /// are evaluated for all the elements of the batch at once, the elements being the innermost (vectorized) loop.
+      /// Meant for the low orders, where there are too few quadrature points per element to vectorize over.
+      /// Requires the states to be stored (see set_do_not_store_states()), the forms are evaluated state by state with
+      /// the reproducible assembly (see set_reproducible_assembly()), with the gathered state local matrices and (DiscreteProblemLinear)
+      /// on the elements with a Dirichlet lift.
+      inline void set_state_batching(bool to_set = true) { this->state_batching = to_set; }
+
+      /// If the neighbors along the interior edges (DG forms) of all states should be found up-front, in the order of the states,
+      /// before the parallel assembly. The states are then assembled in parallel including their DG forms, without the critical section
+      /// searching the neighbors state by state, and every edge segment is assembled by the same state regardless of the threads.
+      /// Requires the states to be stored (see set_do_not_store_states()). Memory demanding - the neighbors of all the states at once.
+      inline void set_DG_interfaces_precalculation(bool to_set = true) { this->DG_interfaces_precalculation = to_set; }
+
+      /// If the positions of the local matrix entries in the matrix storage should be precalculated in create_sparse_structure()
+      /// for every pair of elements, and reused in all subsequent assemblies on the same structure (e.g. Newton's iterations).
+      /// Volumetric matrix forms are then added without any search in the matrix structure.
+      /// Memory demanding - one integer per local matrix entry.
+      inline void set_use_scatter_maps() { this->use_scatter_maps = true; }
+
+      /// If the bubble DOFs should be eliminated during the assembly (static condensation, linear problems - DiscreteProblemLinear).
+      /// The interior (bubble) functions couple only within their element, so the local system of every element is condensed to the Schur
+      /// complement on the other DOFs and only that is added - the assembled matrix and vector are those of the condensed system
+      /// (see get_num_condensed_dofs()), the bubble DOFs are recovered from its solution by recover_condensed_solution().
+      /// Only used if all the spaces and external functions are on one mesh (every state is a whole element), there are no DG forms,
+      /// both the matrix (not a BSRMatrix) and the vector are assembled, and there are both bubble and other DOFs - see is_system_condensed().
+      inline void set_static_condensation(bool to_set = true) { this->static_condensation = to_set; }
+
+      /// Restricts the assembling to the states of one subdomain (the distributed assembling, one subdomain per MPI rank):
+      /// only the states whose elements descend from the base elements with base_element_parts[id] == part are assembled,
+      /// each rank adds the rows of its elements and the matrix (e.g. PETScMatrix) exchanges the entries of the other ranks' rows.
+      /// See MeshPartitioner::partition(). The states of the base elements outside base_element_parts belong to no subdomain.
+      void set_subdomain(const std::vector<int>& base_element_parts, int part);
+      /// Back to the assembling of all the states.
+      void unset_subdomain();
+
+      /// The last assembled system is the condensed one (see set_static_condensation()).
+      inline bool is_system_condensed() const { return !this->condensed_dofs.empty(); }
+
+      /// The number of unknowns of the condensed system (see set_static_condensation()).
+      inline int get_num_condensed_dofs() const { return this->condensed_ndof; }
+
+      /// Static condensation - the solution vector of all the DOFs from the solution of the condensed system.
+      /// The bubble DOFs are recovered element by element in parallel.
+      /// \param[in] condensed_sln Vector of length get_num_condensed_dofs().
+      /// \param[out] sln Vector of length get_num_dofs().
+      void recover_condensed_solution(const Scalar* condensed_sln, Scalar* sln) const;
+
       /// Get the weak forms.
       const WeakForm<Scalar>* get_weak_formulation() const;
 
@@ -110,6 +196,42 @@ namespace Hermes
 
       void delete_cache();
 
+      /// Limit the (approximate) memory taken by the assembly cache to this number of bytes.
+      /// When the limit is exceeded, the records not used recently are evicted (but never those
+      /// that are being used by an assembling thread at the moment) and recalculated when needed again.
+      /// Default: 0 - unlimited.
+      void set_cache_budget(size_t bytes);
+
+      /// Cache statistics of the last assembly.
+      /// Hits - states assembled with the cached data, misses - states that had to (re)calculate their records,
+      /// evictions - records removed because of the budget (see set_cache_budget()).
+      inline unsigned int get_cache_hits() const { return this->cache_hits; }
+      inline unsigned int get_cache_misses() const { return this->cache_misses; }
+      inline unsigned int get_cache_evictions() const { return this->cache_evictions; }
+      /// Current (approximate) memory taken by the cache records in bytes.
+      inline size_t get_cache_bytes() const { return this->cache_bytes; }
+
+      /// Memory accounting - the cache records and the arenas, reported after every assembling.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemoryAssemblyCaches; }
+
+      /// Times of the assembling phases and the counters of the last assemble() (or apply()), summed over the threads.
+      inline const AssemblyProfile& get_assembly_profile() const { return this->assembly_profile; }
+
+      /// The profiles of all the assemble() calls since the construction or reset_accumulated_assembly_profile()
+      /// (e.g. of all the iterations of a Newton solve).
+      inline const AssemblyProfile& get_accumulated_assembly_profile() const { return this->accumulated_assembly_profile; }
+      inline void reset_accumulated_assembly_profile() { this->accumulated_assembly_profile.reset(); }
+
+      /// Turns the measurement of the phases on or off (the counters are kept in either case). Default: on,
+      /// the overhead is a few timer reads per state and form.
+      void set_profiling(bool to_set);
+
+      /// Turns the per-form counters and times on or off (AssemblyProfile::forms, reported by WeakForm::print_form_profile()).
+      /// Default: off. The counters are exact, only a sample of the form evaluations is timed (see H2D_FORM_PROFILE_SAMPLING).
+      /// The forms are evaluated one by one then (no state batching, see set_state_batching()).
+      void set_form_profiling(bool to_set = true);
+
       /// Assembling.
       /// General assembling procedure for nonlinear problems. coeff_vec is the
       /// previous Newton vector. If force_diagonal_block == true, then (zero) matrix
@@ -127,6 +249,16 @@ namespace Hermes
       void assemble(Scalar* coeff_vec, Vector<Scalar>* rhs = NULL,
         bool force_diagonal_blocks = false, Table* block_weights = NULL);
 
+      /// Assembling of several operators sharing the spaces in one traversal of the meshes - every form is added to the matrix
+      /// and the vector of its Form::get_assembly_target() (see also WeakForm::add_forms()). The geometry, the shape functions,
+      /// the assembly lists and the cached form values of an element are evaluated once for all the operators.
+      /// The matrices get the same sparse structure. Either vector may be empty (no matrices / no right-hand sides),
+      /// otherwise it has one entry per target.
+      /// Not available with DG forms, node-blocked (BSR) matrices, the load cases and the matrix-free weak forms;
+      /// the static condensation, the state batching and the reproducible assembling are not used.
+      void assemble(Scalar* coeff_vec, Hermes::vector<SparseMatrix<Scalar>*> mats, Hermes::vector<Vector<Scalar>*> rhss,
+        bool force_diagonal_blocks = false, Table* block_weights = NULL);
+
       /// Light version passing NULL for the coefficient vector. External solutions
       /// are initialized with zeros.
       virtual void assemble(SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs = NULL, bool force_diagonal_blocks = false,
@@ -138,16 +270,49 @@ namespace Hermes
       void assemble(Vector<Scalar>* rhs = NULL, bool force_diagonal_blocks = false,
         Table* block_weights = NULL);
 
+      /// Starts the assembling on its own thread (see AsyncTask), to overlap it with the work of other stages, e.g. the
+      /// factorization of the previous block (LinearMatrixSolver::solve_async()) or the assembling of other problems.
+      /// coeff_vec == NULL - assemble(mat, rhs, ...) (also the linear problems, DiscreteProblemLinear), otherwise
+      /// assemble(coeff_vec, mat, rhs, ...). This problem, coeff_vec, the matrix and the vector must not be touched until
+      /// the task's wait() returned. Assemblings running at the same time must be of different DiscreteProblem instances.
+      /// @param[in] dependency - the assembling starts after this task finished, NULL - right away
+      /// @return the started task, deleted by the caller (the destructor waits for it)
+      AssemblyTask<Scalar>* assemble_async(Scalar* coeff_vec, SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs = NULL,
+        bool force_diagonal_blocks = false, Table* block_weights = NULL, AsyncTask* dependency = NULL);
+
+      /// Matrix-free application of the (Jacobian) matrix: y = J(u) * x.
+      /// The matrix forms are evaluated element by element (using the cache as assemble() does)
+      /// and multiplied right away, no SparseMatrix is ever formed.
+      /// u is the linearization point set by set_linearization_point().
+      /// \param[in] x Vector of length get_num_dofs().
+      /// \param[out] y Vector of length get_num_dofs(), overwritten.
+      virtual void apply(const Scalar* x, Scalar* y);
+
+      /// Set the linearization point u (the previous Newton vector) used by apply(). The vector is copied.
+      /// NULL (default) - external solutions initialized with zeros. Reset when the spaces change.
+      void set_linearization_point(Scalar* coeff_vec);
+
       /// \ingroup Helper methods inside {calc_order_*, assemble_*}
       /// Init geometry, jacobian * weights, return the number of integration points.
       static int init_geometry_points(RefMap* reference_mapping, int order, Geom<double>*& geometry, double*& jacobian_x_weights);
       static int init_surface_geometry_points(RefMap* reference_mapping, int& order, Traverse::State* current_state, Geom<double>*& geometry, double*& jacobian_x_weights);
+      /// Copy of the geometry, jacobian * weights initialized by the above for the same element on another space.
+      static int copy_geometry_points(int np, const Geom<double>* from_geometry, const double* from_jacobian_x_weights, Geom<double>*& geometry, double*& jacobian_x_weights);
 
     protected:
+      class CacheRecordPerSubIdx;
+
       void init_assembling(Scalar* coeff_vec, PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms);
 
       void deinit_assembling(PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms);
 
+      /// Makes sure the thread contexts (see thread_pss) exist for the current number of threads and equations,
+      /// and re-binds their shapesets to those of the current spaces. Called from init_assembling().
+      void init_thread_contexts();
+
+      /// Frees the thread contexts.
+      void free_thread_contexts();
+
       /// The form will be assembled.
       bool form_to_be_assembled(MatrixForm<Scalar>* form, Traverse::State* current_state);
       bool form_to_be_assembled(MatrixFormVol<Scalar>* form, Traverse::State* current_state);
@@ -156,6 +321,20 @@ namespace Hermes
       bool form_to_be_assembled(VectorFormVol<Scalar>* form, Traverse::State* current_state);
       bool form_to_be_assembled(VectorFormSurf<Scalar>* form, Traverse::State* current_state);
 
+      /// Resolves the areas of the forms of the weak formulation to the internal markers of the meshes of their spaces
+      /// (the tables element_marker_forms, boundary_marker_forms). Called from init_assembling().
+      void init_form_markers();
+
+      /// One of the areas of the form is the internal (element or boundary) marker on the meshes of the spaces i and j.
+      bool form_area_has_marker(Form<Scalar>* form, unsigned int i, unsigned int j, int marker, bool boundary) const;
+
+      /// The edges of the state (bit isurf) with surface forms: boundary edges with a marker some surface form may be assembled on
+      /// (the table surface_marker_forms). The other edges skip the surface assembly lists, geometry and forms.
+      unsigned int get_surface_edges(Traverse::State* current_state, WeakForm<Scalar>* current_wf) const;
+
+      /// The internal element (boundary) marker of the area on the mesh.
+      static Mesh::MarkersConversion::IntValid get_internal_marker(const Mesh* mesh, const std::string& area, bool boundary);
+
       // Return scaling coefficient.
       double block_scaling_coeff(MatrixForm<Scalar>* form) const;
       double block_scaling_coeff(MatrixFormDG<Scalar>* form) const;
@@ -170,6 +349,153 @@ namespace Hermes
       void create_sparse_structure();
       void create_sparse_structure(SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs = NULL);
 
+      /// The structure from the sparsity pattern - reused if already built for the same spaces and meshes (seqs) by any instance
+      /// (unless the scatter maps are used), otherwise built by build_sparsity_pattern(). Not for DG (needs the traversal).
+      void create_sparsity_pattern(bool** blocks);
+      /// The sparsity pattern (compressed columns) in parallel over the states, as the assembly - per-thread sorted lists
+      /// of the nonzeros, merged by ranges of columns in parallel. Registers the pairs of elements of the scatter maps.
+      void build_sparsity_pattern(bool** blocks, std::vector<int>& Ap, std::vector<int>& Ai);
+      /// The structure by pre_add_ij() in the traversal of the union mesh.
+      void create_sparse_structure_by_traversal(bool** blocks, bool is_DG);
+
+      /// Scatter maps (see set_use_scatter_maps()) - calculation of the positions after the matrix has been allocated.
+      void init_scatter_maps();
+      /// Scatter maps - deallocation.
+      void free_scatter_maps();
+      /// Scatter maps - the positions for the block (i, j) of this state, NULL if not available.
+      int* get_scatter_positions(unsigned int i, unsigned int j, Traverse::State* current_state);
+
+      /// Insert a local matrix into current_mat (at scatter_positions if not NULL), or multiply it by
+      /// current_apply_x in the matrix-free application (see apply()).
+      void add_local_matrix(unsigned int m, unsigned int n, Scalar** local_matrix, int* rows, int* cols, int* scatter_positions);
+
+      /// Matrix forms are to be evaluated - there is a matrix to assemble, or apply() is in progress,
+      /// or their Dirichlet lift is to be assembled into the right-hand side only (see dirichlet_lift_only).
+      inline bool matrix_forms_to_be_assembled() const { return this->current_mat != NULL || this->current_apply_x != NULL || (this->dirichlet_lift_only && this->current_rhs != NULL); }
+
+      /// The matrix forms contribute only their Dirichlet lift to current_rhs, there is no matrix
+      /// (the kept matrix of DiscreteProblemLinear::set_constant_matrix()).
+      bool dirichlet_lift_only;
+
+      /// Make sure there is an arena (and an integration order cache) for each of the threads and reset the arenas.
+      void init_arenas(unsigned int num_threads);
+
+      /// The arena of the calling thread (for the per-state temporaries).
+      inline Arena* current_arena() const { return this->arenas[omp_get_thread_num()]; }
+
+      /// The profile of the calling thread, NULL outside of the assembling. The phase times are measured
+      /// only if current_phase_profile() is not NULL.
+      inline AssemblyProfile* current_profile() { return (unsigned int) omp_get_thread_num() < this->thread_profiles.size() ? &this->thread_profiles[omp_get_thread_num()] : NULL; }
+      inline AssemblyProfile* current_phase_profile() { return this->profiling ? this->current_profile() : NULL; }
+      /// The profile of the form in the profile of the calling thread, NULL if set_form_profiling() is off or outside of the assembling.
+      FormProfile* current_form_profile(Form<Scalar>* form);
+      /// Counts an element (edge) where the form is not assembled.
+      void count_skipped_form(Form<Scalar>* form);
+
+      /// Node-blocked matrices (BSRMatrix) - groups the DOFs into nodes. The leading spaces with the same mesh, type and number
+      /// of DOFs as the first one are the components of the nodes (their DOFs correspond one to one), any other DOF is a node of its own.
+      void set_node_blocks(BSRMatrix<Scalar>* mat);
+
+      /// Node-blocked matrices - the volumetric local matrices of all the forms of a state are gathered (see add_local_matrix())
+      /// and added in end_state_local_matrix() at once, so that the matrix adds all the components of a pair of nodes as one block.
+      /// \param[in] gather_rhs Gather also the vector (static condensation).
+      void begin_state_local_matrix(AsmList<Scalar>** current_als, Traverse::State* current_state, bool gather_rhs = false);
+      void end_state_local_matrix();
+
+      /// The gathered volumetric local matrix of a state (see begin_state_local_matrix()).
+      struct StateLocalMatrix
+      {
+        /// Local DOFs - the assembly lists of all the spaces one after another.
+        unsigned int count;
+        int* dofs;
+        Scalar** matrix;
+        /// The dof array of the assembly list of every space (NULL if the space has no element here), and where it starts in dofs.
+        int** space_dofs;
+        unsigned int* offsets;
+        /// The local vector, NULL if not gathered.
+        Scalar* rhs;
+      };
+      /// Per thread, NULL if not gathering.
+      std::vector<StateLocalMatrix*> state_local_matrices;
+
+      /// The matrix is node-blocked with more than one component per node - state local matrices are gathered.
+      bool node_blocked_assembly;
+
+      /// The position of the DOF in the gathered local matrix of the state, -1 if it is not there (or negative).
+      int find_state_local_position(StateLocalMatrix* state_matrix, int dof) const;
+
+      /// Insert a local vector into current_rhs, or into the gathered local vector of the state (static condensation).
+      void add_local_vector(unsigned int count, unsigned int* dofs, Scalar* values);
+      void add_local_vector(int dof, Scalar value);
+
+      /// The matrix and the vector the forms of the calling thread are assembled into - current_mat / current_rhs, or the entries
+      /// of current_mats / current_rhss of the assembly target of the form being assembled (see set_thread_assembly_target()).
+      SparseMatrix<Scalar>* get_target_matrix() const;
+      Vector<Scalar>* get_target_rhs() const;
+      /// Sets the assembly target of the calling thread to the one of the form (assembling of several operators only).
+      void set_thread_assembly_target(Form<Scalar>* form);
+
+      /// The sparse structures of the matrices (the one of current_mat) and the vectors of the targets other than the first one.
+      /// @param[in] structure_created - the structure of current_mat was created for this assembling.
+      void create_target_structures(bool structure_created);
+
+      /// See set_static_condensation().
+      bool static_condensation;
+
+      /// The conditions of set_static_condensation() but the DOF counts are met by the current assembling.
+      bool static_condensation_to_be_used() const;
+
+      /// The value of static_condensation_to_be_used() the sparse structure was created with.
+      bool static_condensation_structure;
+
+      /// Static condensation - the position of every DOF in the condensed system, -1 for the bubble DOFs. Empty if not condensing.
+      std::vector<int> condensed_dofs;
+      int condensed_ndof;
+
+      /// The DOF in the assembled system - negative for the bubble DOFs if condensing (and for the Dirichlet ones).
+      inline int system_dof(int dof) const { return (dof < 0 || this->condensed_dofs.empty()) ? dof : this->condensed_dofs[dof]; }
+
+      /// The number of unknowns of the assembled system.
+      inline int get_system_num_dofs() const { return this->condensed_dofs.empty() ? this->ndof : this->condensed_ndof; }
+
+      /// Static condensation - the recovery of the bubble DOFs of an element, x_B = rhs - matrix * x_I,
+      /// matrix = A_BB^{-1} A_BI (row-wise, bubble_count x interface_count) and rhs = A_BB^{-1} b_B.
+      struct CondensedElement
+      {
+        unsigned int bubble_count;
+        unsigned int interface_count;
+        int* bubble_dofs;
+        int* interface_dofs;
+        Scalar* matrix;
+        Scalar* rhs;
+      };
+      /// Per element id (all the spaces share the mesh).
+      std::vector<CondensedElement> condensed_elements;
+
+      /// Static condensation - the condensed numbering, called when the sparse structure is created.
+      void init_static_condensation();
+      void free_static_condensation();
+
+      /// Static condensation - eliminates the bubble DOFs from the gathered local system of the state (see begin_state_local_matrix()),
+      /// adds the Schur complement to the matrix and the vector and keeps what the recovery needs.
+      void condense_state_local_matrix(Traverse::State* current_state);
+
+      /// The order the states are assembled in - colour by colour if coloured assembly is used (see set_coloured_assembly()).
+      /// \param[out] ordered_states The indices of the states (empty if the states are not stored).
+      /// \param[out] colour_starts The colour i consists of the states ordered_states[colour_starts[i]], ..., ordered_states[colour_starts[i + 1] - 1].
+      /// \return If the states were coloured.
+      bool get_assembly_schedule(Traverse::State** states, int num_states, std::vector<int>& ordered_states, std::vector<int>& colour_starts);
+
+      /// The batches of the states (see set_state_batching()) - sorts ordered_states by the type of the states within every colour,
+      /// one state per batch if batching is not used.
+      /// \param[out] batch_starts The batch i consists of the states ordered_states[batch_starts[i]], ..., ordered_states[batch_starts[i + 1] - 1].
+      /// \param[out] colour_batch_starts The colour i consists of the batches colour_batch_starts[i], ..., colour_batch_starts[i + 1] - 1.
+      void get_state_batches(Traverse::State** states, std::vector<int>& ordered_states, const std::vector<int>& colour_starts,
+        std::vector<int>& batch_starts, std::vector<int>& colour_batch_starts);
+
+      /// State batching - the type of the state (the batches consist of the states of the same key).
+      void get_state_batch_key(Traverse::State* state, std::vector<int>& key);
+
       /// Set the special handling of external functions of Runge-Kutta methods, including information how many spaces were there in the original problem.
       inline void set_RK(int original_spaces_count) { this->RungeKutta = true; RK_original_spaces_count = original_spaces_count; }
 
@@ -178,22 +504,119 @@ namespace Hermes
       bool state_needs_recalculation(AsmList<Scalar>** current_als, Traverse::State* current_state);
 
       /// Calculate cache records for this set of parameters.
+      /// \param[in] surface_edges The edges with surface forms (see get_surface_edges()).
+      /// \param[out] records The (acquired) records of the state, per space.
       void calculate_cache_records(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, AsmList<Scalar>** current_als, 
-        Traverse::State* current_state, AsmList<Scalar>** current_alsSurface, WeakForm<Scalar>* current_wf);
+        Traverse::State* current_state, AsmList<Scalar>** current_alsSurface, WeakForm<Scalar>* current_wf, unsigned int surface_edges, CacheRecordPerSubIdx** records);
+
+      /// Cache - marks the records of this state as being used (they are not evicted until released) and recently used.
+      /// \param[out] records The records of the state, per space.
+      /// \return false if any of the records is not in the cache (nothing is marked then).
+      bool acquire_cache_records(Traverse::State* current_state, CacheRecordPerSubIdx** records);
+
+      /// Cache - releases the records acquired by acquire_cache_records() / calculate_cache_records().
+      /// The released (and the not acquired) records are NULL, a second release does nothing.
+      void release_cache_records(Traverse::State* current_state, CacheRecordPerSubIdx** records);
+
+      /// Cache - releases the records of a state on every exit of assemble_one_state(), the early returns and the exceptions included.
+      /// Records pinned for good could never be evicted.
+      class CacheRecordsGuard
+      {
+      public:
+        CacheRecordsGuard(DiscreteProblem<Scalar>* dp, Traverse::State* current_state, CacheRecordPerSubIdx** records) : dp(dp), current_state(current_state), records(records) {};
+        ~CacheRecordsGuard() { dp->release_cache_records(current_state, records); };
+      private:
+        DiscreteProblem<Scalar>* dp;
+        Traverse::State* current_state;
+        CacheRecordPerSubIdx** records;
+      };
+      friend class CacheRecordsGuard;
+
+      /// Cache - evicts records not in use and not recently used (clock algorithm) until the budget is met.
+      /// Has to be called inside the critical section cache_records_clock.
+      void evict_cache_records();
+
+      /// Cache - the lock guarding the records of this element.
+      inline omp_lock_t* get_cache_lock(int element_id) { return &this->cache_locks[element_id % H2D_CACHE_LOCKS]; }
       
       /// Assemble one state.
       void assemble_one_state(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, 
         AsmList<Scalar>** current_als, Traverse::State* current_state, WeakForm<Scalar>* current_wf);
 
+      /// The volumetric u_ext[space_i] on the current state as the sum of the (cached) shape functions of record weighted by
+      /// the coefficients from u_ext_coeff_vec, NULL if the Solution has to be evaluated instead.
+      Func<Scalar>* init_u_ext_fn(unsigned int space_i, AsmList<Scalar>* al, CacheRecordPerSubIdx* record, int order, Arena* arena);
+
       /// Adjusts order to refmaps.
       void adjust_order_to_refmaps(Form<Scalar> *form, int& order, Hermes::Ord* o, RefMap** current_refmaps);
 
+      /// Limits the order to the quadrature of the form (see Form::set_quad_2d()).
+      void limit_form_order(Form<Scalar> *form, int& order, RefMap** current_refmaps);
+
+      /// Forms with their own quadrature (see Form::has_own_quadrature()) - evaluates the functions on the points of the form and assembles it.
+      /// \param[in] current_alsSurface Surface assembly lists (surface forms, the edge current_state->isurf).
+      void assemble_form_own_quadrature(Form<Scalar>* form, PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext,
+        AsmList<Scalar>** current_als, AsmList<Scalar>** current_alsSurface, Traverse::State* current_state, WeakForm<Scalar>* current_wf);
+
+      /// Forms with their own quadrature - switches the external functions (previous iterations, ext of the weak form and of the form) to the quadrature.
+      void set_ext_quad_2d(Form<Scalar>* form, Quad2D* quad, Solution<Scalar>** current_u_ext, WeakForm<Scalar>* current_wf);
+
       /// Matrix volumetric forms - calculate the integration order.
       int calc_order_matrix_form(MatrixForm<Scalar>* mfv, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, Traverse::State* current_state);
 
       /// Matrix volumetric forms - assemble the form.
+      /// \param[in] current_refmap Reference mapping of the element (volumetric forms, for the sum factorization), NULL for surface forms.
+      /// \param[in] record_i Cache record of the test functions (volumetric forms, for the incremental reassembly), NULL for surface forms.
       virtual void assemble_matrix_form(MatrixForm<Scalar>* form, int order, Func<double>** base_fns, Func<double>** test_fns, Func<Scalar>** ext, Func<Scalar>** u_ext,
-      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights);
+      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+      RefMap* current_refmap, CacheRecordPerSubIdx* record_i);
+
+      /// Matrix volumetric forms - the raw local matrix (result[test][basis]) by sum factorization (see TensorProductQuad).
+      /// \return false if not possible for this form / element / spaces, result is untouched then.
+      bool assemble_matrix_form_tensor_product(MatrixForm<Scalar>* form, int order, Func<Scalar>** ext, Func<Scalar>** u_ext,
+        AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+        RefMap* current_refmap, Scalar** result);
+
+      /// Matrix volumetric forms - the raw local matrix (result[test][basis]) of an affine element from the reference element
+      /// matrices (see ReferenceMatrices, MatrixFormVol::set_reference_matrices()).
+      /// \return false if not possible for this form / element / spaces, result is untouched then.
+      bool assemble_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+        Traverse::State* current_state, RefMap* current_refmap, Scalar** result);
+
+      /// The reference element matrices the form can be assembled from on the state, and the coefficients of the form, NULL if not possible.
+      const ReferenceMatrices* get_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+        Traverse::State* current_state, RefMap* current_refmap, Scalar& mass, Scalar& diffusion);
+
+      /// State batching - the form from the reference element matrices on one element of a batch.
+      struct BatchedMatrixForm
+      {
+        MatrixForm<Scalar>* form;
+        const ReferenceMatrices* reference;
+        /// The assembly lists of the elements have the same counts and shape function indices.
+        unsigned int cnt_i, cnt_j;
+        std::vector<int> idx_i, idx_j;
+        /// The elements so far.
+        unsigned int count;
+        /// Per element - the coefficients (see ReferenceMatrices::get_coefficients(), scaled by the form and block scaling).
+        Scalar c_mass[H2D_STATE_BATCH_SIZE], c_xx[H2D_STATE_BATCH_SIZE], c_xy[H2D_STATE_BATCH_SIZE], c_yy[H2D_STATE_BATCH_SIZE];
+        /// Per element - the DOFs and coefficients of the lists (cnt_i of the test functions followed by cnt_j),
+        /// the scatter positions of the block and of the transposed one.
+        std::vector<int> dofs[H2D_STATE_BATCH_SIZE];
+        std::vector<Scalar> coefs[H2D_STATE_BATCH_SIZE];
+        int* scatter_positions[H2D_STATE_BATCH_SIZE];
+        int* transposed_scatter_positions[H2D_STATE_BATCH_SIZE];
+      };
+      /// Per thread, empty if the batches are not used by the current assembling.
+      std::vector<std::vector<BatchedMatrixForm> > state_batches;
+
+      /// State batching - defers the form (from the reference element matrices) on the state to the end of the batch.
+      /// \return false if the form has to be assembled now.
+      bool batch_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+        Traverse::State* current_state, RefMap* current_refmap);
+
+      /// State batching - evaluates and adds the deferred forms of the calling thread.
+      void assemble_state_batch();
+      void assemble_batched_matrix_form(BatchedMatrixForm& batched_form);
 
       /// Vector volumetric forms - calculate the integration order.
       int calc_order_vector_form(VectorForm<Scalar>* mfv, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, Traverse::State* current_state);
@@ -206,6 +629,26 @@ namespace Hermes
       /// Calculates orders for external functions.
       void init_ext_orders(Form<Scalar> *form, Func<Hermes::Ord>** oi, Func<Hermes::Ord>** oext, Solution<Scalar>** current_u_ext, Traverse::State* current_state);
       /// \ingroup Helper methods inside {calc_order_*, assemble_*}
+      /// Integration order cache (see Form::set_order_caching()) - the orders of the functions given to the form, a key.
+      struct OrderKey
+      {
+        OrderKey();
+        /// Appends the order, false if it does not fit (the order is not cached then).
+        bool push_back(int order);
+        bool operator<(const OrderKey& other) const;
+        uint64_t words[H2D_ORDER_KEY_WORDS];
+        unsigned int size;
+      };
+      /// \ingroup Helper methods inside {calc_order_*, assemble_*}
+      /// Integration order cache - appends the orders of the functions given to the form to key, false if they do not fit.
+      bool get_order_key(Form<Scalar> *form, Solution<Scalar>** current_u_ext, Traverse::State* current_state, OrderKey& key);
+      /// \ingroup Helper methods inside {calc_order_*, assemble_*}
+      /// Integration order cache - the order of the form (without the reference mapping increase), false if not cached yet.
+      bool get_cached_order(Form<Scalar> *form, const OrderKey& key, int& order);
+      /// \ingroup Helper methods inside {calc_order_*, assemble_*}
+      /// Integration order cache - store the order.
+      void set_cached_order(Form<Scalar> *form, const OrderKey& key, int order);
+      /// \ingroup Helper methods inside {calc_order_*, assemble_*}
       /// Cleans up after init_ext_orders.
       void deinit_ext_orders(Form<Scalar> *form, Func<Hermes::Ord>** oi, Func<Hermes::Ord>** oext);
 
@@ -259,12 +702,32 @@ namespace Hermes
       /// Number of spaces in the original problem in a Runge-Kutta method.
       int RK_original_spaces_count;
 
+      /// The coefficient vector of the current assembling, u_ext is evaluated from it directly (see init_u_ext_fn()).
+      /// NULL for linear problems and without a coefficient vector.
+      Scalar* u_ext_coeff_vec;
+
       /// Storing assembling info.
       SparseMatrix<Scalar>* current_mat;
       Vector<Scalar>* current_rhs;
+      /// The right-hand sides of the load cases 1, 2, ... (see VectorForm::load_case), current_rhs is the one of the load case 0.
+      /// Empty unless assembling by DiscreteProblemLinear::assemble() with several right-hand sides.
+      Hermes::vector<Vector<Scalar>*> current_load_case_rhs;
+      /// The matrices and the vectors of the assembly targets (current_mat / current_rhs are the first ones), empty unless
+      /// assembling several operators by assemble() with the vectors of the matrices and the right-hand sides.
+      Hermes::vector<SparseMatrix<Scalar>*> current_mats;
+      Hermes::vector<Vector<Scalar>*> current_rhss;
+      /// The assembly target of the form being assembled by every thread (see set_thread_assembly_target()).
+      std::vector<unsigned int> thread_assembly_targets;
       bool current_force_diagonal_blocks;
       Table* current_block_weights;
 
+      /// Matrix-free application (see apply()) - the vector multiplied, NULL when assembling.
+      const Scalar* current_apply_x;
+      /// Matrix-free application - thread-private results.
+      Scalar** current_apply_y;
+      /// See set_linearization_point().
+      Scalar* linearization_point;
+
       /// Caching.
       class CacheRecordPerElement
       {
@@ -292,41 +755,229 @@ namespace Hermes
         int* n_quadrature_pointsSurface;
         int* orderSurface;
         int* asmlistSurfaceCnt;
+        /// The edges the surface data were calculated on (see get_surface_edges()).
+        unsigned int surface_edges;
+
+        /// Incremental reassembly (see DiscreteProblemLinear::set_incremental_reassembly()) - the raw values (no coefficients, no scaling)
+        /// of a volumetric matrix form with the test functions of this record.
+        struct MatrixFormValues
+        {
+          /// Shape function indices the values belong to - test functions followed by basis functions.
+          unsigned int cnt_i, cnt_j;
+          int* idx;
+          /// values[test function * cnt_j + basis function].
+          Scalar* values;
+        };
+        /// By Form::position.
+        std::map<int, MatrixFormValues> matrix_form_values;
+        void clear_matrix_form_values();
+
+        /// Approximate memory taken by the record - calculated once the record is filled.
+        size_t calculate_bytes() const;
+        size_t bytes;
+        /// Number of states being assembled with this record at the moment, such a record is not evicted.
+        int in_use;
+        /// Used since the clock hand passed the record the last time.
+        bool referenced;
+        /// Where the record is stored in cache_records_sub_idx.
+        unsigned int space_i;
+        int element_id;
+        uint64_t sub_idx;
+        /// Position in cache_clock.
+        typename std::list<CacheRecordPerSubIdx*>::iterator clock_position;
+      };
+
+      /// Cache records of one element, sorted by sub_idx.
+      /// Typically one or a few records - a binary search in a contiguous array instead of a tree walk.
+      class CacheRecordSubIdxTable
+      {
+      public:
+        /// NULL if not present.
+        CacheRecordPerSubIdx* find(uint64_t sub_idx) const;
+        void insert(CacheRecordPerSubIdx* record);
+        void erase(uint64_t sub_idx);
+        std::vector<uint64_t> sub_idxs;
+        std::vector<CacheRecordPerSubIdx*> records;
       };
 
-      std::map<uint64_t, CacheRecordPerSubIdx*>*** cache_records_sub_idx;
+      /// Guarded by get_cache_lock(element id), only the records in use are safe to be read without the lock.
+      CacheRecordSubIdxTable*** cache_records_sub_idx;
+      /// Striped locks of cache_records_sub_idx.
+      omp_lock_t cache_locks[H2D_CACHE_LOCKS];
       CacheRecordPerElement*** cache_records_element;
       bool** cache_element_stored;
       int cache_size;
       bool do_not_use_cache;
 
+      /// See set_cache_budget().
+      size_t cache_budget;
+      /// Memory taken by the cache records.
+      size_t cache_bytes;
+      /// All cache records and the clock hand (for the eviction), guarded by the critical section cache_records_clock.
+      std::list<CacheRecordPerSubIdx*> cache_clock;
+      typename std::list<CacheRecordPerSubIdx*>::iterator cache_clock_hand;
+      /// Cache statistics of the last assembly.
+      unsigned int cache_hits;
+      unsigned int cache_misses;
+      unsigned int cache_evictions;
+
+      /// Cache - frees all the records of one element (and the table itself).
+      void free_cache_records(CacheRecordSubIdxTable* records);
+
+      /// Cache - removes the record from cache_clock (keeping the clock hand valid).
+      void remove_from_clock(CacheRecordPerSubIdx* record);
+
+      /// Cache - the raw values of a matrix form kept in the record (see CacheRecordPerSubIdx::matrix_form_values),
+      /// NULL if there are none for exactly these shape functions.
+      Scalar* find_matrix_form_values(CacheRecordPerSubIdx* record, int position, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j);
+
+      /// Cache - keeps the raw values of a matrix form in the record, takes the ownership of values.
+      void store_matrix_form_values(CacheRecordPerSubIdx* record, int position, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Scalar* values);
+
+      /// Congruent elements (see MatrixFormVol::set_constant_coefficients()) - the key of the local matrix of the form on the
+      /// current state: the quantized affine reference mapping, the element mode and marker, the integration order and the
+      /// shape function indices. false if the matrix cannot be reused (a curved element, a sub-element, a surface form...).
+      bool get_congruence_key(MatrixForm<Scalar>* form, int order, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+        Traverse::State* current_state, RefMap* current_refmap, std::vector<int>& key);
+
+      /// Congruent elements - the raw values (as in CacheRecordPerSubIdx::MatrixFormValues) for the key, NULL if not stored yet.
+      Scalar* find_congruent_matrix_form_values(MatrixForm<Scalar>* form, const std::vector<int>& key);
+
+      /// Congruent elements - keeps a copy of the raw values (cnt_i * cnt_j) for the key.
+      void store_congruent_matrix_form_values(MatrixForm<Scalar>* form, const std::vector<int>& key, unsigned int cnt_i, unsigned int cnt_j, Scalar* values);
+
+      /// Congruent elements - frees all the kept values.
+      void free_congruent_matrix_form_values();
+
+      /// The local matrices of the congruent elements (indexed by Form::position), never freed during an assembly.
+      /// Guarded by the critical section congruent_matrix_form_values.
+      std::vector<std::map<std::vector<int>, Scalar*> > congruent_matrix_form_values;
+      size_t congruent_matrix_form_bytes;
+
+      /// See set_do_not_store_states().
+      bool do_not_store_states;
+
+      /// The form areas resolved to the internal markers (see init_form_markers()), a row of form_markers_count entries per marker:
+      /// the form at the position p (Form::position) is assembled on the elements with the internal marker m if form_areas_any[p] == 1
+      /// or element_marker_forms[m * form_markers_count + p] (the edges with the boundary marker m - boundary_marker_forms).
+      /// form_areas_any[p] == 2 - the form was not resolved.
+      std::vector<char> form_areas_any;
+      std::vector<char> element_marker_forms;
+      std::vector<char> boundary_marker_forms;
+      int form_markers_count;
+      /// The boundary markers with at least one surface form (the boundary edge index of get_surface_edges()),
+      /// surface_forms_any - a surface form on any boundary marker (HERMES_ANY or not resolved).
+      std::vector<char> surface_marker_forms;
+      bool surface_forms_any;
+
+      /// See set_subdomain(), subdomain == -1 - all the states.
+      std::vector<int> subdomain_base_element_parts;
+      int subdomain;
+
+      /// The state belongs to the subdomain (see set_subdomain()).
+      bool is_in_subdomain(Traverse::State* state) const;
+
+      /// See set_reproducible_assembly().
+      bool reproducible_assembly;
+
+      /// See set_coloured_assembly().
+      bool coloured_assembly;
+
+      /// See set_state_batching().
+      bool state_batching;
+
+      /// See set_DG_interfaces_precalculation().
+      bool DG_interfaces_precalculation;
+
+      /// See set_use_scatter_maps().
+      bool use_scatter_maps;
+      /// For each block [i * neq + j], and each pair (element id in space i, element id in space j), the positions
+      /// of the local matrix entries (as returned by SparseMatrix::get_positions()).
+      std::map<std::pair<unsigned int, unsigned int>, int*>* scatter_maps;
+      /// Number of equations scatter_maps were created for.
+      unsigned int scatter_maps_neq;
+      /// The matrix scatter_maps belong to.
+      SparseMatrix<Scalar>* scatter_maps_matrix;
+
+      /// Integration orders of the forms per thread (omp_get_thread_num(), see init_arenas()), then by Form::position,
+      /// per combination of the orders of the functions (see get_order_key()). Each thread fills its own, there is no lock.
+      std::vector<std::vector<std::map<OrderKey, int> > > order_caches;
+
+      /// Per-thread allocators of the temporaries of one state (ext functions, local matrices), reset after each state.
+      /// The cache records live longer and are allocated from the heap.
+      std::vector<Arena*> arenas;
+
+      /// Thread contexts: the thread-private PrecalcShapesets, RefMaps and assembly lists ([thread][equation]).
+      /// They survive the assemble() calls (their set-up dominates the assembling of small problems, e.g. in
+      /// short time steps), init_thread_contexts() re-binds them to the current spaces.
+      /// The weak form clones and u_ext are per call - they copy the state of the weak form and of the solution.
+      PrecalcShapeset*** thread_pss;
+      PrecalcShapeset*** thread_spss;
+      RefMap*** thread_refmaps;
+      AsmList<Scalar>*** thread_als;
+      /// The neighbor PrecalcShapesets and RefMaps of the DG assembling, indexed the same way.
+      PrecalcShapeset*** thread_npss;
+      PrecalcShapeset*** thread_nspss;
+      RefMap*** thread_nrefmaps;
+      int thread_contexts_num_threads;
+      int thread_contexts_neq;
+
+      /// Profiles of the threads during the assembling (see current_profile()), and their sum after it.
+      std::vector<AssemblyProfile> thread_profiles;
+      AssemblyProfile assembly_profile;
+      AssemblyProfile accumulated_assembly_profile;
+      bool profiling;
+      /// See set_form_profiling().
+      bool form_profiling;
+
       /// Exception caught in a parallel region.
       Hermes::Exceptions::Exception* caughtException;
     
       
       ///* DG *///
 
+      /// The interior edges of one state - the neighbors along every edge (with the transformations of the segments),
+      /// and which segments were already assembled from the neighbor's side.
+      class DGStateInterfaces
+      {
+      public:
+        DGStateInterfaces();
+        ~DGStateInterfaces();
+        /// Per edge, NULL for the edges without DG assembly.
+        LightArray<NeighborSearch<Scalar>*>* neighbor_searches[H2D_MAX_NUMBER_VERTICES];
+        unsigned int num_neighbors[H2D_MAX_NUMBER_VERTICES];
+        /// Per edge and segment - the matrix forms of the segment were assembled with the neighbor.
+        bool* processed[H2D_MAX_NUMBER_VERTICES];
+      };
+
+      /// See set_DG_interfaces_precalculation(), per state (NULL if not precalculated).
+      DGStateInterfaces** DG_interfaces;
+      int DG_interfaces_count;
+
+      /// The minimum seq of the meshes of the spaces.
+      unsigned int get_min_dg_mesh_seq() const;
+
+      /// Find the neighbors of the state along its interior edges, marks the elements of the state as visited.
+      void init_DG_state_interfaces(Traverse::State* current_state, unsigned int min_dg_mesh_seq, DGStateInterfaces* interfaces);
+
+      /// See set_DG_interfaces_precalculation().
+      void precalculate_DG_interfaces(Traverse::State** states, int num_states);
+      void free_DG_interfaces();
+
       /// Assemble DG forms.
+      /// \param[in] npss, nspss, nrefmaps The neighbor PrecalcShapesets and RefMaps of the thread, one per space (see thread_npss).
+      /// \param[in] interfaces Precalculated interfaces of the state, if NULL, they are found here (in the critical section DG).
       void assemble_one_DG_state(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-        Traverse::State* current_state, Hermes::vector<MatrixFormDG<Scalar>*> current_mfDG, Hermes::vector<VectorFormDG<Scalar>*> current_vfDG, Transformable** fn, WeakForm<Scalar>* current_wf);
+        Traverse::State* current_state, const Hermes::vector<MatrixFormDG<Scalar>*>& current_mfDG, const Hermes::vector<VectorFormDG<Scalar>*>& current_vfDG, Transformable** fn, WeakForm<Scalar>* current_wf,
+        PrecalcShapeset** npss, PrecalcShapeset** nspss, RefMap** nrefmaps, DGStateInterfaces* interfaces = NULL);
 
       /// Assemble one DG neighbor.
       void assemble_DG_one_neighbor(bool edge_processed, unsigned int neighbor_i,
         PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-        Traverse::State* current_state, Hermes::vector<MatrixFormDG<Scalar>*> current_mfDG, Hermes::vector<VectorFormDG<Scalar>*> current_vfDG, Transformable** fn,
-        std::map<unsigned int, PrecalcShapeset *> npss, std::map<unsigned int, PrecalcShapeset *> nspss, std::map<unsigned int, RefMap *> nrefmap,
+        Traverse::State* current_state, const Hermes::vector<MatrixFormDG<Scalar>*>& current_mfDG, const Hermes::vector<VectorFormDG<Scalar>*>& current_vfDG, Transformable** fn,
+        PrecalcShapeset** npss, PrecalcShapeset** nspss, RefMap** nrefmaps,
         LightArray<NeighborSearch<Scalar>*>& neighbor_searches, unsigned int min_dg_mesh_seq, WeakForm<Scalar>* current_wf);
 
-      /// Assemble DG matrix forms.
-      void assemble_DG_matrix_forms(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-        Traverse::State* current_state, MatrixFormDG<Scalar>** current_mfDG, std::map<unsigned int, PrecalcShapeset*> npss,
-        std::map<unsigned int, PrecalcShapeset*> nspss, std::map<unsigned int, RefMap*> nrefmap, LightArray<NeighborSearch<Scalar>*>& neighbor_searches);
-
-      /// Assemble DG vector forms.
-      void assemble_DG_vector_forms(PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-        Traverse::State* current_state, VectorFormDG<Scalar>** current_vfDG, std::map<unsigned int, PrecalcShapeset*> nspss,
-        std::map<unsigned int, RefMap*> nrefmap, LightArray<NeighborSearch<Scalar>*>& neighbor_searches);
-
       DiscontinuousFunc<Hermes::Ord>* init_ext_fn_ord(NeighborSearch<Scalar>* ns, MeshFunction<Scalar>* fu);
 
       /// Calculates integration order for DG matrix forms.
@@ -383,6 +1034,26 @@ namespace Hermes
       template<typename T> friend class PicardSolver;
       template<typename T> friend class RungeKutta;
     };
+
+    /// The asynchronous assembling, see DiscreteProblem::assemble_async().
+    template<typename Scalar>
+    class HERMES_API AssemblyTask : public AsyncTask
+    {
+    public:
+      AssemblyTask(DiscreteProblem<Scalar>* dp, Scalar* coeff_vec, SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs,
+        bool force_diagonal_blocks, Table* block_weights);
+      virtual ~AssemblyTask();
+
+    protected:
+      virtual void run();
+
+      DiscreteProblem<Scalar>* dp;
+      Scalar* coeff_vec;
+      SparseMatrix<Scalar>* mat;
+      Vector<Scalar>* rhs;
+      bool force_diagonal_blocks;
+      Table* block_weights;
+    };
   }
 }
 #endif
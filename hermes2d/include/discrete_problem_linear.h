@@ -48,11 +48,59 @@ namespace Hermes
       virtual void assemble(SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs = NULL, bool force_diagonal_blocks = false,
         Table* block_weights = NULL);
 
+      /// Assembling with several right-hand sides (load cases) in one traversal: rhs_vectors[k] gets the vector forms
+      /// of VectorForm::load_case k (and the Dirichlet lift, which is the same for all of them), mat is assembled once.
+      /// Not with the static condensation.
+      void assemble(SparseMatrix<Scalar>* mat, Hermes::vector<Vector<Scalar>*> rhs_vectors);
+
+      /// Incremental reassembly - the raw values of the volumetric matrix forms are kept with the cache records and reused
+      /// for the states not changed since the last assembly (e.g. in the adaptivity loops, see Space::ElementData::changed_in_last_adaptation),
+      /// only the changed states are evaluated. The global matrix is then scattered from the kept values (the DOFs may be renumbered).
+      /// Only for forms that do not change between the assemblies (no dependence on time, or on external functions being changed).
+      /// Requires the cache (see DiscreteProblem::set_do_not_use_cache()), memory demanding - a local matrix per state and form.
+      inline void set_incremental_reassembly(bool to_set = true) { this->incremental_reassembly = to_set; }
+
+      /// Constant matrix - the matrix forms not marked MatrixForm::time_dependent are assembled into the matrix only once,
+      /// the following assemblies into the same matrix (unchanged spaces, e.g. in the time stepping after LinearSolver::set_time())
+      /// evaluate them only for their Dirichlet lift and reassemble the vector forms and the time-dependent matrix forms.
+      /// If there are no time-dependent matrix forms, the matrix is left as it is (see matrix_kept_by_last_assembly()),
+      /// otherwise a copy of the constant part is added to them (SparseMatrix::duplicate() and add_sparse_matrix() needed).
+      /// Not with the static condensation and the DG matrix forms (always assembled in full then).
+      void set_constant_matrix(bool to_set = true);
+
+      /// The last assemble() left the matrix values as they were (set_constant_matrix()) - a factorization can be reused.
+      inline bool matrix_kept_by_last_assembly() const { return this->matrix_kept; }
+
     protected:
+      /// One traversal of assemble() - what goes into the matrix according to the flags below.
+      void assemble_traversal(SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs, bool force_diagonal_blocks, Table* block_weights);
+
+      /// The constant matrix can be used with this matrix (see set_constant_matrix()).
+      bool constant_matrix_to_be_used(SparseMatrix<Scalar>* mat) const;
+
+      /// Forget the kept constant matrix.
+      void free_constant_matrix();
+
       /// Methods different to those of the parent class.
       /// Matrix forms.
       virtual void assemble_matrix_form(MatrixForm<Scalar>* form, int order, Func<double>** base_fns, Func<double>** test_fns, Func<Scalar>** ext, Func<Scalar>** u_ext,
-      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights);
+      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+      RefMap* current_refmap, typename DiscreteProblem<Scalar>::CacheRecordPerSubIdx* record_i);
+
+      /// See set_incremental_reassembly().
+      bool incremental_reassembly;
+
+      /// See set_constant_matrix().
+      bool constant_matrix;
+      /// The matrix with the kept constant part, NULL if none.
+      SparseMatrix<Scalar>* constant_matrix_target;
+      /// Copy of the constant part, if there are time-dependent matrix forms.
+      SparseMatrix<Scalar>* constant_matrix_part;
+      /// See matrix_kept_by_last_assembly().
+      bool matrix_kept;
+      /// Which matrix forms go into the matrix in assemble_traversal(), the others contribute only their Dirichlet lift.
+      bool constant_forms_into_matrix;
+      bool time_dependent_forms_into_matrix;
 
       template<typename T> friend class KellyTypeAdapt;
       template<typename T> friend class NewtonSolver;
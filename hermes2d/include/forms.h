@@ -24,8 +24,12 @@
 #include "function/solution.h"
 #include "mesh/refmap.h"
 #include "mesh/traverse.h"
+#include "arena.h"
 #include <complex>
 
+/// Alignment (bytes) of the values of shape functions in a Func block (see init_fns()), a cache line.
+#define H2D_FUNC_ALIGNMENT 64
+
 namespace Hermes
 {
   namespace Hermes2D
@@ -86,10 +90,26 @@ namespace Hermes
       /** \param[in] func A function which is added to *this. A number of integratioN points and a number of component has to match. */
       void add(Func<T>* func);
 
+      /// The memory of the arrays if they are in a block (see init_fns()) owned by this Func, NULL otherwise.
+      char* block;
+
+      /// The arrays are in a block (of this Func or another one), they are not deleted one by one.
+      bool in_block;
+
+      /// Length of an array in a block: num_gip padded to a multiple of H2D_FUNC_ALIGNMENT bytes.
+      static int get_block_stride(int num_gip);
+
+      /// Number of arrays of a shape function of space_type in a block.
+      static int get_block_array_count(SpaceType space_type);
+
+      /// Points the arrays of a shape function of space_type to data, one after another.
+      void set_block_arrays(T* data, SpaceType space_type);
+
       friend Func<Hermes::Ord>* init_fn_ord(const int order);
       friend Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order);
-      template<typename Scalar> friend Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order);
-      template<typename Scalar> friend Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order);
+      friend void init_fns(PrecalcShapeset *fu, RefMap *rm, const int order, unsigned int n, const int* idx, Func<double>** fns);
+      template<typename Scalar> friend Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order, Arena* arena);
+      template<typename Scalar> friend Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order, Arena* arena);
 
       template<typename Scalar> friend class DiscontinuousFunc;
       template<typename Scalar> friend class Adapt;
@@ -204,6 +224,7 @@ namespace Hermes
       friend Geom<Hermes::Ord>* init_geom_ord();
       friend Geom<double>* init_geom_vol(RefMap *rm, const int order);
       friend Geom<double>* init_geom_surf(RefMap *rm, int isurf, int marker, const int order, double3*& tan);
+      friend Geom<double>* copy_geom(const Geom<double>* geom, int np);
 
       template<typename Scalar> friend class DiscreteProblem;
       template<typename Scalar> friend class DiscreteProblemLinear;
@@ -252,17 +273,33 @@ namespace Hermes
     HERMES_API Geom<double>* init_geom_vol(RefMap *rm, const int order);
     /// Init element geometry for surface integrals.
     HERMES_API Geom<double>* init_geom_surf(RefMap *rm, int isurf, int marker, const int order, double3*& tan);
+    /// Copy of an element / edge geometry at np points (for the same element on another space).
+    HERMES_API Geom<double>* copy_geom(const Geom<double>* geom, int np);
 
     /// Init the function for calculation the integration order.
     HERMES_API Func<Hermes::Ord>* init_fn_ord(const int order);
     /// Init the shape function for the evaluation of the volumetric/surface integral (transformation of values).
     HERMES_API Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order);
+    /// Init the shape functions idx[0], ..., idx[n - 1] of fu (the active one if idx is NULL and n is 1) into fns, all the
+    /// values in one block. The layout: the Funcs one after another, and the arrays of each of them in the order val, dx, dy
+    /// (laplace) for H1 and L2, val0, val1, curl for Hcurl and val0, val1, div for Hdiv; every array starts at a multiple of
+    /// H2D_FUNC_ALIGNMENT bytes and is padded with zeros to the next one. The block belongs to fns[0], all the Funcs are
+    /// still deallocated by free_fn() / delete each.
+    HERMES_API void init_fns(PrecalcShapeset *fu, RefMap *rm, const int order, unsigned int n, const int* idx, Func<double>** fns);
     /// Init the mesh-function for the evaluation of the volumetric/surface integral.
     template<typename Scalar>
     HERMES_API Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order);
     /// Init the solution for the evaluation of the volumetric/surface integral.
     template<typename Scalar>
     HERMES_API Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order);
+    /// Init the mesh-function for the evaluation of the volumetric/surface integral, everything allocated from the arena.
+    /// The result must not be deallocated by free_fn() / delete, it is released by Arena::reset().
+    template<typename Scalar>
+    HERMES_API Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order, Arena* arena);
+    /// Init the solution for the evaluation of the volumetric/surface integral, everything allocated from the arena.
+    /// The result must not be deallocated by free_fn() / delete, it is released by Arena::reset().
+    template<typename Scalar>
+    HERMES_API Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order, Arena* arena);
   }
 }
 #endif
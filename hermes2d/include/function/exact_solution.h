@@ -34,6 +34,8 @@ namespace Hermes
     public:
       ExactSolution(const Mesh* mesh);
 
+      virtual ~ExactSolution();
+
       /// Dimension of result - either 1 or 2.
       virtual unsigned int get_dimension() const = 0;
 
@@ -41,9 +43,29 @@ namespace Hermes
 
       inline std::string getClassName() const { return "ExactSolution"; }
 
+      /// Keeps the values at the integration points of every element, sub-element and order this function is
+      /// evaluated on, until the mesh changes. For an exact solution compared with many solutions on one mesh
+      /// (errors of the candidates in adaptivity); the memory grows with the number of elements. Off by default.
+      void set_caching(bool enable = true);
+
     protected:
       /// For scaling of the solution.
       Scalar exact_multiplicator;
+
+      /// Evaluates the (unscaled) values and derivatives at the n points into values[component][0 - 2].
+      virtual void exact_values(int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]) const = 0;
+
+      /// exact_values() at the points of the active element, sub-element and the given order, cached if enabled.
+      void evaluate(int order, int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]);
+
+      void free_cache();
+
+      bool caching;
+      unsigned int cache_mesh_seq;
+
+      /// The cached values, by sub_idx and (element id, order, quadrature), all components and values one after another.
+      std::map<std::pair<uint64_t, uint64_t>, Scalar*> cache;
+
       template<typename T> friend class Solution;
     };
 
@@ -71,9 +93,17 @@ namespace Hermes
         return value (x, y);
       };
 
+      /// Function returning the values and derivatives at n points (all the integration points of an element).
+      /// The default calls value() and derivatives() point by point; override it if the function is cheaper at
+      /// many points at once (common subexpressions, vectorized special functions).
+      virtual void values(int n, const double* x, const double* y, Scalar* val, Scalar* dx, Scalar* dy) const;
+
       /// Function returning the integration order that
       /// should be used when integrating the function.
       virtual Hermes::Ord ord(Hermes::Ord x, Hermes::Ord y) const = 0;
+
+    protected:
+      virtual void exact_values(int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]) const;
     };
 
     /// @ingroup meshFunctions
@@ -98,9 +128,16 @@ namespace Hermes
         return value (x, y);
       };
 
+      /// Function returning the values and derivatives at n points (all the integration points of an element).
+      /// The default calls exact_function() point by point.
+      virtual void values(int n, const double* x, const double* y, Scalar2<Scalar>* val, Scalar2<Scalar>* dx, Scalar2<Scalar>* dy) const;
+
       /// Function returning the integration order that
       /// should be used when integrating the function.
       virtual Hermes::Ord ord(Hermes::Ord x, Hermes::Ord y) const = 0;
+
+    protected:
+      virtual void exact_values(int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]) const;
     };
     
     /// @ingroup meshFunctions
@@ -121,6 +121,11 @@ namespace Hermes
 
       virtual Func<Scalar>* get_pt_value(double x, double y, Element* e = NULL);
 
+      /// See MeshFunction::get_pt_values(). The inputs are evaluated in all the points at once and combined by filter_fn()
+      /// in one call, a point is found if it lies in the meshes of all the inputs.
+      virtual Func<Scalar>* get_pt_values(int n, const double* x, const double* y, bool* found = NULL);
+      using Filter<Scalar>::get_pt_values;
+
     protected:
       int item[H2D_MAX_COMPONENTS];
 
@@ -385,6 +390,104 @@ namespace Hermes
       virtual void filter_fn(int n, Hermes::vector<std::complex<double>*> values, double* result);
     };
 
+    template<typename Scalar> class ExpressionFilter;
+
+    /// @ingroup meshFunctions
+    /// An expression of the values and derivatives of MeshFunctions, e.g. (FilterExpression<double>(u) - FilterExpression<double>(v)).sqr()
+    /// for an error plot, evaluated by ExpressionFilter in one pass instead of a chain of SimpleFilters (each with its own
+    /// traversal, union mesh and tables). The expression is stored as a postfix program over its distinct MeshFunctions.
+    template<typename Scalar>
+    class HERMES_API FilterExpression
+    {
+    public:
+      /// The item (H2D_FN_VAL_0, H2D_FN_DX_0, H2D_FN_VAL_1, ...; no second derivatives) of fn.
+      explicit FilterExpression(MeshFunction<Scalar>* fn, int item = H2D_FN_VAL_0);
+
+      /// A constant.
+      FilterExpression(Scalar value);
+
+      friend FilterExpression operator+(const FilterExpression& a, const FilterExpression& b) { return FilterExpression(a, b, Add); }
+      friend FilterExpression operator-(const FilterExpression& a, const FilterExpression& b) { return FilterExpression(a, b, Subtract); }
+      friend FilterExpression operator*(const FilterExpression& a, const FilterExpression& b) { return FilterExpression(a, b, Multiply); }
+      friend FilterExpression operator/(const FilterExpression& a, const FilterExpression& b) { return FilterExpression(a, b, Divide); }
+      FilterExpression operator-() const;
+
+      /// The square as the Hermes sqr() (|z|^2 for complex numbers, as SquareFilter).
+      FilterExpression sqr() const;
+      FilterExpression sqrt() const;
+      FilterExpression abs() const;
+
+    protected:
+      enum Operation
+      {
+        Source,
+        Constant,
+        Add,
+        Subtract,
+        Multiply,
+        Divide,
+        Negate,
+        Square,
+        SquareRoot,
+        Absolute
+      };
+
+      struct Instruction
+      {
+        Operation op;
+        /// Source: the index to sources and the item.
+        int source, item;
+        /// Constant.
+        Scalar value;
+      };
+
+      /// a op b, the sources of b merged into those of a.
+      FilterExpression(const FilterExpression& a, const FilterExpression& b, Operation op);
+
+      /// op this.
+      FilterExpression unary(Operation op) const;
+
+      std::vector<Instruction> program;
+
+      Hermes::vector<MeshFunction<Scalar>*> sources;
+
+      /// The depth of the evaluation stack of the program.
+      int get_stack_size() const;
+
+      template<typename T> friend class ExpressionFilter;
+    };
+
+    /// @ingroup meshFunctions
+    /// ExpressionFilter evaluates a FilterExpression. The union mesh of all the MeshFunctions of the expression is
+    /// constructed once, and the expression is evaluated on the values of the sources within one precalculate().
+    template<typename Scalar>
+    class HERMES_API ExpressionFilter : public Filter<Scalar>
+    {
+    public:
+      ExpressionFilter(const FilterExpression<Scalar>& expression);
+
+      virtual ~ExpressionFilter();
+
+      virtual MeshFunction<Scalar>* clone() const;
+
+      virtual Func<Scalar>* get_pt_value(double x, double y, Element* e = NULL);
+
+      /// See MeshFunction::get_pt_values(), the sources are evaluated in all the points at once.
+      virtual Func<Scalar>* get_pt_values(int n, const double* x, const double* y, bool* found = NULL);
+      using Filter<Scalar>::get_pt_values;
+
+    protected:
+      FilterExpression<Scalar> expression;
+
+      /// Evaluates the program in np points, tables[k] are the values of the k-th instruction if it is a Source.
+      void evaluate(int np, Scalar** tables, Scalar* result) const;
+
+      /// The component and the derivative index (as in Function::get_values()) of item.
+      static void get_item(int item, int& a, int& b);
+
+      virtual void precalculate(int order, int mask);
+    };
+
     /// @ingroup meshFunctions
     /// VonMisesFilter is a postprocessing filter for visualizing elastic stresses in a body.
     /// It calculates the stress tensor and applies the Von Mises equivalent stress formula
@@ -17,6 +17,7 @@
 #define __H2D_FUNCTION_H
 
 #include "transformable.h"
+#include "../mixins2d.h"
 #include "../quadrature/quad.h"
 #include "exceptions.h"
 
@@ -95,7 +96,7 @@ namespace Hermes
     /// points transformed to sub-areas of the current element (see push_transform(), pop_transform()).
     ///
     template<typename Scalar>
-    class HERMES_API Function : public Transformable
+    class HERMES_API Function : public Transformable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
 
@@ -106,6 +107,10 @@ namespace Hermes
       /// Added to delete Function::sub_tables.
       virtual ~Function();
 
+      /// Memory accounting - the precalculated tables (total_mem), reported lazily as they are added and released.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemorySolutions; }
+
       /// \brief Returns the number of components of the function being represented by the class.
       int get_num_components() const;
 
@@ -179,9 +184,9 @@ namespace Hermes
 
         int size;           ///< size in bytes of this struct (for maintaining total_mem)
 
-        Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]; ///< pointers to 'data'
+        int num_points;     ///< number of points the tables are allocated for
 
-        Scalar data[1];       ///< value tables. The length may vary.
+        Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]; ///< value tables, each allocated separately (see add_tables()), NULL if not present
 
       private:
         Node(const Node& org) {}; ///< Copy constructor is disabled.
@@ -229,6 +234,21 @@ namespace Hermes
 
       Node* new_node(int mask, int num_points); ///< allocates a new Node structure
 
+      /// Allocates the tables of mask missing in node, the present ones are kept as they are (to be filled by the caller).
+      void add_tables(Node* node, int mask, int num_points);
+
+      /// Frees a Node structure including its tables.
+      static void free_node(Node* node);
+
+      /// Nodes released by release_node(), with their tables, for new_node() with the same number of points.
+      std::vector<Node*> node_pool;
+
+      /// The maximum number of nodes kept in node_pool.
+      static const unsigned int H2D_MAX_POOLED_NODES = 32;
+
+      /// Returns a (non-shared) node of this Function to node_pool, or frees it if the pool is full.
+      void release_node(Node* node);
+
       virtual void  handle_overflow_idx() = 0;
 
       void replace_cur_node(Node* node);
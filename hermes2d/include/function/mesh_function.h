@@ -62,6 +62,15 @@ namespace Hermes
       /// Return the value at the coordinates x,y.
       virtual Func<Scalar>* get_pt_value(double x, double y, Element* e = NULL) = 0;
 
+      /// Return the values at the points (x[i], y[i]), i = 0, ..., n - 1, values[i] is what get_pt_value() returns
+      /// (NULL for a point outside of the mesh), to be deleted by the caller.
+      virtual void get_pt_values(int n, const double* x, const double* y, Func<Scalar>** values);
+
+      /// Return the values at the points (x[i], y[i]), i = 0, ..., n - 1, in one Func of n points (val, dx, dy, or val0, val1
+      /// for vector-valued functions), to be deleted by the caller (free_fn()). found[i] (if not NULL) tells whether the point
+      /// lies in the mesh, the values of the other points are zero. This version evaluates get_pt_value() point by point.
+      virtual Func<Scalar>* get_pt_values(int n, const double* x, const double* y, bool* found = NULL);
+
       /// Cloning function - for parallel OpenMP blocks.
       /// Designed to return an identical clone of this instance.
       virtual MeshFunction<Scalar>* clone() const
@@ -117,6 +126,9 @@ namespace Hermes
       virtual int get_edge_fn_order(int edge);
 
     protected:
+      /// The zeroed Func of n points get_pt_values() returns.
+      Func<Scalar>* init_pt_values(int n) const;
+
       ElementMode2D mode;
       const Mesh* mesh;
       RefMap* refmap;
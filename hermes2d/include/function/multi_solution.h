@@ -0,0 +1,59 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_MULTI_SOLUTION_H
+#define __H2D_MULTI_SOLUTION_H
+
+#include "solution.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup meshFunctions
+    /// \brief The components of a vector problem (elasticity, Navier-Stokes) on one mesh, in one buffer.
+    ///
+    /// MultiSolution converts the coefficient vector of all the spaces in a single pass over the elements of their
+    /// (common) mesh, into one buffer of monomial coefficients where the blocks of all the components of an element
+    /// follow each other. The components are Solutions viewing the buffer (see get_solutions()), usable wherever
+    /// Solutions are, and owned by the MultiSolution. Copies of them (clone(), copy()) are standalone Solutions.
+    template<typename Scalar>
+    class HERMES_API MultiSolution
+    {
+    public:
+      MultiSolution(int num_components);
+      ~MultiSolution();
+
+      /// Converts coeff_vec (the DOFs of spaces one after another from start_index, as in Solution::vector_to_solutions())
+      /// into all the components at once. All the spaces have to be on the same mesh.
+      void set_coeff_vector(const Hermes::vector<const Space<Scalar>*>& spaces, const Scalar* coeff_vec, bool add_dir_lift = true, int start_index = 0);
+
+      /// The i-th component.
+      Solution<Scalar>* get_solution(int i) const;
+
+      /// All the components, for the functions taking Hermes::vector<Solution<Scalar>*>.
+      Hermes::vector<Solution<Scalar>*> get_solutions() const;
+
+      int get_num_components() const;
+
+    protected:
+      Hermes::vector<Solution<Scalar>*> solutions;
+
+      /// The coefficients of all the components.
+      Scalar* mono_coeffs;
+    };
+  }
+}
+#endif
@@ -85,6 +85,9 @@ namespace Hermes
       /// State querying helpers.
       inline std::string getClassName() const { return "Solution"; }
 
+      /// Memory accounting - the coefficient arrays and the precalculated tables.
+      virtual size_t get_memory_usage() const;
+
       void assign(Solution* sln);
       inline Solution& operator = (Solution& sln) { assign(&sln); return *this; }
 
@@ -97,10 +100,18 @@ namespace Hermes
       /// element orders) to an XML file.
       virtual void save(const char* filename) const;
 
-      /// Loads the solution from a file previously created by Solution::save(). This completely
-      /// restores the solution in the memory.
+      /// Loads the solution from a file previously created by Solution::save() (or Solution::save_binary(),
+      /// recognized by its header). This completely restores the solution in the memory.
       void load(const char* filename, Space<Scalar>* space);
 
+      /// Saves the solution into a binary file: the monomial coefficients and the element tables in flat arrays of
+      /// the native byte order, read by a few fread() calls instead of parsing the XML of save().
+      /// Only for the solutions given by element coefficients (not the exact ones).
+      void save_binary(const char* filename) const;
+
+      /// Loads a solution saved by save_binary(), on the mesh of the space it was saved with.
+      void load_binary(const char* filename, Space<Scalar>* space);
+
       /// Returns solution value or derivatives at element e, in its reference domain point (xi1, xi2).
       /// 'item' controls the returned value: 0 = value, 1 = dx, 2 = dy, 3 = dxx, 4 = dyy, 5 = dxy.
       /// NOTE: This function should be used for postprocessing only, it is not effective
@@ -123,10 +134,28 @@ namespace Hermes
       /// Returns solution value or derivatives at the physical domain point (x, y).
       /// 'item' controls the returned value: H2D_FN_VAL_0, H2D_FN_VAL_1, H2D_FN_DX_0, H2D_FN_DX_1, H2D_FN_DY_0, ....
       /// NOTE: This function should be used for postprocessing only, it is not effective
-      /// enough for calculations. Since it searches for an element sequentinally, it is extremelly
-      /// slow. Prefer Solution::get_ref_value if possible.
+      /// enough for calculations. The element is looked up in the spatial index of the mesh, if known,
+      /// it can be passed as e. Prefer Solution::get_ref_value if possible.
       virtual Func<Scalar>* get_pt_value(double x, double y, Element* e = NULL);
 
+      /// See MeshFunction::get_pt_values(). Tries the element of the previous point first, the points of a line
+      /// or a curve mostly lie in the same element as their predecessors.
+      virtual void get_pt_values(int n, const double* x, const double* y, Func<Scalar>** values);
+
+      /// See MeshFunction::get_pt_values(). The points are located first (the element of the previous point tried first),
+      /// then evaluated element by element, with one inverse reference map per affine element.
+      virtual Func<Scalar>* get_pt_values(int n, const double* x, const double* y, bool* found = NULL);
+
+      /// Transfers this function to space (e.g. on a refined or coarsened version of the mesh of this Solution) without
+      /// a global projection: every element of space is projected onto locally (in parallel over the elements), in the
+      /// L2 or H1 norm (the default for H1 spaces, L2 otherwise), and the DOFs shared by more elements are averaged.
+      /// The result is the global projection for L2 spaces, and exact for any space able to represent this function
+      /// (a refinement of its mesh and orders), a quasi-interpolant of it otherwise. coeff_vec has space->get_num_dofs() entries.
+      void transfer_to(const Space<Scalar>* space, Scalar* coeff_vec, ProjNormType proj_norm = HERMES_UNSET_NORM);
+
+      /// transfer_to() into the Solution target (which may be this one).
+      void transfer_to(const Space<Scalar>* space, Solution<Scalar>* target, ProjNormType proj_norm = HERMES_UNSET_NORM);
+
       /// Multiplies the function represented by this class by the given coefficient.
       void multiply(Scalar coef);
 
@@ -171,12 +200,31 @@ namespace Hermes
       /// Internal.
       virtual void set_active_element(Element* e);
 
+      /// The clone shares the (read-only) coefficient arrays with this Solution, only the mutable state (the active
+      /// element, the tables of values, the derivative buffer) is its own. This makes the per-thread clones of the
+      /// external functions of the assembling cheap. A Solution with a lazy conversion in progress is copied.
       virtual MeshFunction<Scalar>* clone() const;
 
       static void set_static_verbose_output(bool verbose);
 
       void set_type(SolutionType type) { sln_type = type; };
 
+      /// With lazy conversion, the coefficient vectors given to this Solution from now on are converted to the
+      /// monomial expansion of an element only on the first evaluation on it (and kept then), instead of on all
+      /// the elements at once; set_active_element() alone only selects the element and its order. For Solutions
+      /// used on a few elements only. The space of the coefficient vector (not the vector, it is copied) has to
+      /// stay unchanged while the Solution is in use.
+      void set_lazy_conversion(bool lazy = true);
+
+      /// Caps the memory (in bytes) of the precalculated tables. When it is exceeded, the tables of the sub-elements
+      /// filled the longest time ago are freed; traversal uses the tables of a sub-element in one stretch, so these are
+      /// the least recently used ones. Zero (the default) means no limit.
+      void set_table_memory_limit(int max_bytes);
+
+      /// Moves the element orders and coefficients to the new ids of Mesh::defragment() of the mesh of this Solution.
+      /// Not for a clone (see clone()), whose coefficients belong to the original.
+      void remap_element_ids(const std::vector<int>& element_ids);
+
     protected:
       static bool static_verbose_output;
 
@@ -192,6 +240,22 @@ namespace Hermes
 
       virtual void free();
 
+      /// Internal, load() by the streaming XMLStreamReader (Hermes2DApi's xmlStreaming, no validation).
+      void load_stream(const char* filename, Space<Scalar>* space);
+
+      /// Fixed part of the file of save_binary(), followed by Scalar mono_coeffs[num_coeffs], int elem_orders[num_elems]
+      /// (padded to a multiple of 8 bytes) and int elem_coeffs[num_components * num_elems].
+      struct BinaryHeader
+      {
+        char magic[8];
+        int scalar_size;
+        int space_type;
+        int num_components;
+        int num_elems;
+        int num_coeffs;
+        int padding;
+      };
+
       /// Converts a coefficient vector into a Solution.
       virtual void set_coeff_vector(const Space<Scalar>* space, const Vector<Scalar>* vec, bool add_dir_lift, int start_index);
 
@@ -215,7 +279,20 @@ namespace Hermes
       std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>* tables[H2D_MAX_QUADRATURES][H2D_SOLUTION_ELEMENT_CACHE_SIZE];
 
       Element* elems[H2D_MAX_QUADRATURES][H2D_SOLUTION_ELEMENT_CACHE_SIZE];
-      int cur_elem, oldest[H2D_SOLUTION_ELEMENT_CACHE_SIZE];
+      int cur_elem, oldest[H2D_MAX_QUADRATURES];
+
+      /// See set_table_memory_limit().
+      int table_memory_limit;
+
+      /// The last precalculation (numbered by tables_use_counter) into each sub-element table, with a memory limit.
+      std::map<LightArray<struct Function<Scalar>::Node*>*, unsigned int> tables_last_use;
+      unsigned int tables_use_counter;
+
+      /// Returns the nodes of a sub-element table to the node pool and deletes it.
+      void free_sub_table(LightArray<struct Function<Scalar>::Node*>* sub_table);
+
+      /// Frees the least recently used sub-element tables of the active quadrature until the memory limit is met.
+      void enforce_table_memory_limit();
 
       Scalar* mono_coeffs;  ///< monomial coefficient array
       int* elem_coeffs[H2D_MAX_SOLUTION_COMPONENTS];  ///< array of pointers into mono_coeffs
@@ -224,6 +301,49 @@ namespace Hermes
       int num_coeffs, num_elems;
       int num_dofs;
 
+      /// The state of the lazy conversion (see set_lazy_conversion()) of the coefficient vector coeff_vec,
+      /// indexed by the DOFs of space minus its first DOF, of the elements not yet converted.
+      struct LazyConversion
+      {
+        const Space<Scalar>* space;
+        PrecalcShapeset* pss;
+        Scalar* coeff_vec;
+        bool add_dir_lift;
+        bool* converted;
+      };
+      bool lazy_conversion;
+      /// NULL unless some elements are left by the lazy conversion.
+      LazyConversion* lazy;
+
+      /// The monomial expansion of e from coeffs, indexed by the DOFs of space minus its first DOF.
+      void calc_element_coeffs(Element* e, const Space<Scalar>* space, PrecalcShapeset* pss, AsmList<Scalar>* al,
+          const Scalar* coeffs, bool add_dir_lift);
+
+      /// Converts the elements left by the lazy conversion and drops its state.
+      void finish_lazy_conversion();
+
+      void free_lazy_conversion();
+
+      /// The expansions of the derivatives on the active element are left for the first evaluation on it.
+      bool dxdy_pending;
+
+      /// mono_coeffs belong to a MultiSolution (and the blocks of the other components are interleaved with those of this one).
+      bool mono_coeffs_shared;
+
+      /// mono_coeffs, elem_coeffs and elem_orders are those of the Solution this one is a clone of (see clone()), read-only
+      /// and not freed here. The original has to outlive the clone and must not change meanwhile.
+      bool coeffs_borrowed;
+
+      /// Frees this Solution and sets it up for the coefficient vectors of space: the mesh, the orders of the elements (and
+      /// their LU matrices) and zeroed elem_coeffs, to be filled in by the caller.
+      void init_element_orders(const Space<Scalar>* space, int num_components);
+
+      /// Sets pss to the Chebyshev points the element coefficients are calculated in.
+      static void set_quad_2d_cheb(PrecalcShapeset* pss);
+
+      /// Sets dxdy_coeffs of the active element, converting it first if the lazy conversion left it.
+      void set_dxdy_coeffs();
+
       void transform_values(int order, struct Function<Scalar>::Node* node, int newmask, int oldmask, int np);
 
       virtual void precalculate(int order, int mask);
@@ -232,7 +352,8 @@ namespace Hermes
 
       Scalar* dxdy_buffer;
 
-      double** calc_mono_matrix(int o, int*& perm);
+      /// The LU-decomposed matrix of the monomials of order o of mode at the Chebyshev points.
+      static double** calc_mono_matrix(int mode, int o, int*& perm);
 
       void init_dxdy_buffer();
 
@@ -243,11 +364,13 @@ namespace Hermes
       friend class RefMap;
       template<typename T> friend class KellyTypeAdapt;
       template<typename T> friend class CalculationContinuity;
+      template<typename T> friend class AsyncOutput;
       template<typename T> friend class OGProjection;
       template<typename T> friend class OGProjectionNOX;
       template<typename T> friend class Adapt;
       template<typename T> friend class Func;
       template<typename T> friend class DiscontinuousFunc;
+      template<typename T> friend class MultiSolution;
       template<typename T> friend class DiscreteProblem;
       template<typename T> friend class DiscreteProblemLinear;
       template<typename T> friend class NeighborSearch;
@@ -96,7 +96,9 @@ namespace Hermes
 
       static void push_transforms(std::set<Transformable *>& transformables, int son);
       static void pop_transforms(std::set<Transformable *>& transformables);
-      static const unsigned int H2D_MAX_TRN_LEVEL = 15;
+      /// The sub_idx of a transformation of depth d is d digits 1 - 8 (son + 1) in base 8 (the bijective numeration,
+      /// every transformation has its own index), so 21 levels fit into 64 bits.
+      static const unsigned int H2D_MAX_TRN_LEVEL = 21;
 
       /// The active element.
       Element* element;
@@ -106,12 +108,12 @@ namespace Hermes
       /// Sub-element transformation index.
       uint64_t sub_idx;
 
-      /// The largest sub_idx for top <= 10.
-      /// FIXME: Why it is only 0x4000?
-      static const uint64_t H2D_MAX_IDX = (1ULL << 3 * H2D_MAX_TRN_LEVEL) - 1;
+      /// The largest sub_idx, 88...8 (H2D_MAX_TRN_LEVEL digits) in base 8. Larger ones (not produced by push_transform())
+      /// are handled by handle_overflow_idx() without caching.
+      static const uint64_t H2D_MAX_IDX = 8 * (((1ULL << 3 * H2D_MAX_TRN_LEVEL) - 1) / 7);
 
       /// Transformation matrix stack.
-      Trf stack[21];
+      Trf stack[H2D_MAX_TRN_LEVEL + 1];
       /// Stack top.
       unsigned int top;
 
@@ -124,6 +126,7 @@ namespace Hermes
       template<typename T> friend class DiscreteProblemLinear;
       template<typename T> friend class NeighborSearch;
       friend class CurvMap;
+      friend class EdgeNeighborTable;
       friend class Traverse;
       friend class Views::Vectorizer;
     };
@@ -123,6 +123,11 @@ namespace Hermes
 
       static double calc_norm(MeshFunction<Scalar>* sln, int norm_type);
 
+      /// Several norms of one function, and several errors of one pair (with the norms of sln2, if norms != NULL),
+      /// in one traversal - norms[k], errors[k] in norm_types[k].
+      static void calc_norms(MeshFunction<Scalar>* sln, Hermes::vector<int> norm_types, double* norms);
+      static void calc_abs_errors(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, Hermes::vector<int> norm_types, double* errors, double* norms = NULL);
+
       /// Calculate norm of a (possibly vector-valued) solution.
       /// Take norm from spaces where these solutions belong.
       static double calc_norms(Hermes::vector<Solution<Scalar>*> slns);
@@ -145,6 +150,19 @@ namespace Hermes
       static double norm_fn_hdiv(MeshFunction<Scalar>* sln, RefMap* ru);
 
       static double get_l2_norm(Vector<Scalar>* vec);
+
+    protected:
+      /// The errors of sln1 - sln2 (if errors != NULL) and the norms of sln2 (if norms != NULL) in norm_types, one traversal
+      /// of the states processed by the threads (Hermes2DApi numThreads, each with clones of the functions), the contributions
+      /// of the states summed in the order of the states (the same result for any number of threads). sln1 may be NULL for the norms only.
+      static void calc_errors_and_norms(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, const Hermes::vector<int>& norm_types, double* errors, double* norms);
+
+      /// The (squared) error, norm contribution of the active elements in the norm norm_type.
+      static double error_fn(int norm_type, MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, RefMap* ru, RefMap* rv);
+      static double norm_fn(int norm_type, MeshFunction<Scalar>* sln, RefMap* ru);
+
+      /// The norm of the space type (calc_norms(), calc_abs_errors() with Solutions).
+      static int get_norm_type(Solution<Scalar>* sln);
     };
 
     /// Projection norms.
@@ -23,7 +23,12 @@
 #include "newton_solver.h"
 #include "picard_solver.h"
 #include "linear_solver.h"
+#include "patch_schwarz_precond.h"
+#include "p_multigrid_precond.h"
+#include "jacobian_update_policy.h"
+#include "reduced_order_model.h"
 #include "calculation_continuity.h"
+#include "async_output.h"
 
 #include "boundary_conditions/essential_boundary_conditions.h"
 
@@ -31,11 +36,15 @@
 
 #include "api2d.h"
 #include "mixins2d.h"
+#include "memory_accounting.h"
+#include "precalculated_tables.h"
+#include "xml_stream_reader.h"
 
 #include "mesh/mesh.h"
 #include "mesh/mesh_reader.h"
 #include "mesh/mesh_reader_h2d.h"
 #include "mesh/mesh_reader_h2d_xml.h"
+#include "mesh/mesh_reader_h2d_binary.h"
 #include "mesh/mesh_reader_h1d_xml.h"
 #include "mesh/mesh_reader_exodusii.h"
 
@@ -53,6 +62,10 @@
 #include "shapeset/shapeset_l2_all.h"
 
 #include "mesh/refmap.h"
+#include "mesh/element_locator.h"
+#include "mesh/edge_neighbor_table.h"
+#include "mesh/mesh_partitioner.h"
+#include "mesh/active_element_arrays.h"
 #include "mesh/traverse.h"
 
 #include "weakform/weakform.h"
@@ -67,6 +80,7 @@
 
 #include "function/exact_solution.h"
 #include "function/solution.h"
+#include "function/multi_solution.h"
 #include "function/mesh_function.h"
 #include "function/filter.h"
 
@@ -80,6 +94,8 @@
 #include "views/stream_view.h"
 #include "views/vector_base_view.h"
 #include "views/vector_view.h"
+#include "views/multi_linearizer.h"
+#include "views/image_renderer.h"
 
 #include "mesh/refinement_type.h"
 #include "mesh/element_to_refine.h"
@@ -93,18 +109,22 @@
 
 #include "adapt/adapt.h"
 #include "adapt/kelly_type_adapt.h"
+#include "adapt/goal_oriented_adapt.h"
+#include "adapt/adaptive_session.h"
 #include "neighbor.h"
 #include "projections/localprojection.h"
 #include "projections/ogprojection.h"
 #include "projections/ogprojection_nox.h"
 
 #include "runge_kutta.h"
+#include "time_step_controller.h"
 #include "spline.h"
 
 #if defined (AGROS)
 // No inclusions here.
 #else
 #include "weakform_library/weakforms_elasticity.h"
+#include "weakform_library/weakforms_expression.h"
 #include "weakform_library/weakforms_h1.h"
 #include "weakform_library/weakforms_hcurl.h"
 #include "weakform_library/weakforms_maxwell.h"
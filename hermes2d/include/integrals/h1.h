@@ -19,6 +19,8 @@
 #include "../quadrature/limit_order.h"
 #include "../forms.h"
 #include "../function/function.h"
+#include "../api2d.h"
+#include "vector_kernels.h"
 
 namespace Hermes
 {
@@ -294,21 +296,98 @@ namespace Hermes
       return result;
     }
 
+    template<typename Real, typename Scalar>
+    Scalar int_F_u_v(int n, double *wt, Real (*F)(Real x, Real y), Func<Real> *u, Func<Real> *v, Geom<Real> *e)
+    {
+      Scalar result = Scalar(0);
+      for (int i = 0; i < n; i++)
+        result += wt[i] * ((*F)(e->x[i], e->y[i]) * u->val[i] * v->val[i]);
+      return result;
+    }
+
+    //// vectorized kernels  ////////////////////////////////////////////////////////////////////////////
+
+    /// Vectorized reductions over the integration points, used by the double versions of the hot helpers above.
+    /// Compiled with AVX-512 / AVX(2) / SSE2 instructions if the compiler targets them (H2D_WITH_NATIVE_SIMD), scalar otherwise.
+    /// The arrays do not have to be aligned.
+    /// sum w[i] * v[i]
+    HERMES_API double int_v_kernel(int n, const double* w, const double* v);
+    /// sum w[i] * u[i] * v[i]
+    HERMES_API double int_u_v_kernel(int n, const double* w, const double* u, const double* v);
+    /// sum w[i] * (udx[i] * vdx[i] + udy[i] * vdy[i])
+    HERMES_API double int_grad_u_grad_v_kernel(int n, const double* w, const double* udx, const double* udy, const double* vdx, const double* vdy);
+
+    template<>
+    inline double int_v<double>(int n, double *wt, Func<double> *v)
+    {
+      return int_v_kernel(n, wt, v->val);
+    }
+
+    template<>
+    inline double int_u_v<double, double>(int n, double *wt, Func<double> *u, Func<double> *v)
+    {
+      return int_u_v_kernel(n, wt, u->val, v->val);
+    }
+
+    template<>
+    inline std::complex<double> int_u_v<double, std::complex<double> >(int n, double *wt, Func<double> *u, Func<double> *v)
+    {
+      return int_u_v_kernel(n, wt, u->val, v->val);
+    }
+
+    template<>
+    inline double int_grad_u_grad_v<double, double>(int n, double *wt, Func<double> *u, Func<double> *v)
+    {
+      return int_grad_u_grad_v_kernel(n, wt, u->dx, u->dy, v->dx, v->dy);
+    }
+
+    template<>
+    inline std::complex<double> int_grad_u_grad_v<double, std::complex<double> >(int n, double *wt, Func<double> *u, Func<double> *v)
+    {
+      return int_grad_u_grad_v_kernel(n, wt, u->dx, u->dy, v->dx, v->dy);
+    }
+
+    template<>
+    inline double int_F_u_v<double, double>(int n, double *wt, double (*F)(double x, double y), Func<double> *u, Func<double> *v, Geom<double> *e)
+    {
+      double* wt_F = new double[n];
+      for (int i = 0; i < n; i++)
+        wt_F[i] = wt[i] * (*F)(e->x[i], e->y[i]);
+      double result = int_u_v_kernel(n, wt_F, u->val, v->val);
+      delete [] wt_F;
+      return result;
+    }
+
     //// error & norm integrals  ////////////////////////////////////////////////////////////////////////
 
     // the inner integration loops for both constant and non-constant jacobian elements
     // for expression without partial derivatives - the variables e, quad, o must be already
     // defined and initialized
+    // (compensated summation if the Hermes2DApi compensatedSummation is set)
 #define h1_integrate_expression(exp) \
     {double3* pt = quad->get_points(o, ru->get_active_element()->get_mode()); \
     int np = quad->get_num_points(o, ru->get_active_element()->get_mode()); \
+    bool compensated = Hermes2DApi.get_compensated_summation(); \
+    Hermes::Algebra::VectorKernels::CompensatedSum compensated_sum; \
     if(ru->is_jacobian_const()){ \
+    if(compensated) { \
+    for (int i = 0; i < np; i++) \
+    compensated_sum.add(pt[i][2] * (exp)); \
+    result += compensated_sum.value(); \
+    } \
+    else \
     for (int i = 0; i < np; i++) \
     result += pt[i][2] * (exp); \
     result *= ru->get_const_jacobian(); \
     } \
   else { \
   double* jac = ru->get_jacobian(o); \
+  if(compensated) { \
+  for (int i = 0; i < np; i++) \
+  compensated_sum.add(pt[i][2] * jac[i] * (exp)); \
+  result += compensated_sum.value(); \
+  } \
+  else \
   for (int i = 0; i < np; i++) \
   result += pt[i][2] * jac[i] * (exp); \
     }}
@@ -0,0 +1,83 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the policy of lagging the Jacobian in the Newton's method (class JacobianUpdatePolicy).
+
+#ifndef __H2D_JACOBIAN_UPDATE_POLICY_H
+#define __H2D_JACOBIAN_UPDATE_POLICY_H
+
+#include "global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup userSolvingAPI
+    /// Decides when the Jacobian of the Newton's method is reassembled, otherwise the last one is used again
+    /// together with its factorization (HERMES_REUSE_FACTORIZATION_COMPLETELY).
+    ///
+    /// The Jacobian is reassembled
+    /// - when there is none yet (or after reset()),
+    /// - when it has been used in max_reuse Newton iterations already (counted over the solves / time steps),
+    /// - when the convergence rate ||F_k|| / ||F_k-1|| of the last iteration is above max_convergence_rate,
+    /// - when the time step differs (relatively) by more than max_time_step_change from the one of the Jacobian.
+    ///
+    /// One instance is passed to NewtonSolver::set_jacobian_update_policy() or RungeKutta::set_jacobian_update_policy()
+    /// and kept over the time steps, it is not deleted by them.
+    /// Example: every 10 iterations at least, or when the residual norm does not drop by half, or when the time step changes by 5%:<br>
+    /// JacobianUpdatePolicy policy(10, 0.5, 0.05);<br>
+    /// newton.set_jacobian_update_policy(&policy);<br>
+    class HERMES_API JacobianUpdatePolicy
+    {
+    public:
+      JacobianUpdatePolicy(int max_reuse = 5, double max_convergence_rate = 0.5, double max_time_step_change = 0.1);
+
+      /// Maximum number of the Newton iterations one Jacobian is used in, 1 means reassembling always.
+      void set_max_reuse(int max_reuse);
+      /// Maximum ratio of two consecutive residual norms for which the Jacobian is kept.
+      void set_max_convergence_rate(double max_convergence_rate);
+      /// Maximum relative change of the time step for which the Jacobian is kept.
+      void set_max_time_step_change(double max_time_step_change);
+
+      /// Asks whether the Jacobian has to be reassembled before the next linear solve. If so, the caller assembles it
+      /// and the policy takes it as the new one, otherwise the use of the kept one is counted.
+      /// \param[in] residual_norm The current residual norm.
+      /// \param[in] last_residual_norm The one of the previous Newton iteration, 0.0 in the first one.
+      /// \param[in] time_step The current time step (0.0 for stationary problems).
+      bool reassemble_jacobian(double residual_norm, double last_residual_norm, double time_step = 0.0);
+
+      /// Forget the Jacobian, the next one will be reassembled (e.g. when the spaces changed).
+      void reset();
+
+      /// Statistics.
+      int get_num_assemblies() const;
+      int get_num_reuses() const;
+
+    protected:
+      int max_reuse;
+      double max_convergence_rate;
+      double max_time_step_change;
+
+      /// Whether there is a Jacobian, the number of the iterations it has been used in, its time step.
+      bool has_jacobian;
+      int jacobian_uses;
+      double jacobian_time_step;
+
+      int num_assemblies;
+      int num_reuses;
+    };
+  }
+}
+#endif
@@ -64,7 +64,7 @@ namespace Hermes
     ///&nbsp;return -1;<br>
     /// }<br>
     template <typename Scalar>
-    class LinearSolver : public Hermes::Mixins::Loggable, public Hermes::Mixins::TimeMeasurable, public Hermes::Mixins::SettableComputationTime, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable
+    class LinearSolver : public Hermes::Mixins::Loggable, public Hermes::Mixins::TimeMeasurable, public Hermes::Mixins::SettableComputationTime, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       LinearSolver();
@@ -79,10 +79,26 @@ namespace Hermes
       virtual bool isOkay() const;
       inline std::string getClassName() const { return "LinearSolver"; }
 
+      /// Memory accounting - the matrices and the vectors, reported after their assembling.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemoryMatrices; }
+
       /// Basic solve method.
       virtual void solve();
 
       Scalar *get_sln_vector();
+
+      /// Several load cases on the same matrix: the matrix is assembled and factorized once, the right-hand sides of the
+      /// load cases 0, ..., num_load_cases - 1 (see VectorForm::load_case) are assembled in one traversal and solved
+      /// with the factorization (the direct solvers). Not with the static condensation.
+      void solve_load_cases(unsigned int num_load_cases);
+
+      /// The solution vector of one load case of the last solve_load_cases().
+      Scalar *get_sln_vector(unsigned int load_case);
+
+      /// The solutions of all the load cases of the last solve_load_cases(), load case by load case
+      /// (num_load_cases times the number of the spaces).
+      void get_load_case_solutions(Hermes::vector<Solution<Scalar>*> slns);
       
       /// set time information for time-dependent problems.
       virtual void set_time(double time);
@@ -100,12 +116,29 @@ namespace Hermes
 
       /// Get the Residual.
       Vector<Scalar>* get_residual();
+
+      /// Eliminate the bubble DOFs element by element during the assembly and solve the condensed system only,
+      /// the bubble DOFs are recovered afterwards (see DiscreteProblem::set_static_condensation()).
+      /// The jacobian and the residual are then those of the condensed system, the solution vector has all the DOFs.
+      void set_static_condensation(bool to_set = true);
+
+      /// Keep the assembled matrix (and its factorization) over the solves - only the right-hand side and the matrix forms
+      /// marked MatrixForm::time_dependent are reassembled, e.g. after set_time() (see DiscreteProblemLinear::set_constant_matrix()).
+      /// The factorization is reused completely if there are no time-dependent matrix forms.
+      void set_constant_matrix(bool to_set = true);
+
+      /// The iterative matrix solvers start the following solves from coeff_vec (see IterSolver::set_initial_guess()),
+      /// the direct ones ignore it. NULL switches back to zero.
+      void set_initial_guess(Scalar* coeff_vec);
     protected:
       DiscreteProblemLinear<Scalar>* dp; ///< FE problem being solved.
 
       /// The solution vector.
       Scalar* sln_vector;
 
+      /// The solution vector with the recovered bubble DOFs (static condensation).
+      Scalar* recovered_sln_vector;
+
       /// Jacobian.
       SparseMatrix<Scalar>* jacobian;
 
@@ -114,7 +147,16 @@ namespace Hermes
 
       /// Linear solver.
       LinearMatrixSolver<Scalar>* matrix_solver;
+
+      /// The right-hand sides of the load cases 1, 2, ... (the load case 0 uses residual), and the solution
+      /// vectors of all of them (num_load_cases times ndof).
+      Hermes::vector<Vector<Scalar>*> load_case_rhs;
+      Scalar* load_case_sln_vectors;
+      unsigned int num_load_cases;
       
+      /// The last solve factorized the jacobian (reused for the kept constant matrix, see set_constant_matrix()).
+      bool matrix_factorized;
+
       /// This instance owns its DP.
       const bool own_dp;
     };
@@ -0,0 +1,134 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the registry of the memory taken by the library (class MemoryAccounting, instance Hermes2DMemory).
+
+#ifndef __H2D_MEMORY_ACCOUNTING_H
+#define __H2D_MEMORY_ACCOUNTING_H
+
+#include "global.h"
+
+/// The lazy updates (see Mixins::MemoryAccountable::update_memory_usage()) report only the changes bigger than this (bytes).
+#define H2D_MEMORY_ACCOUNTING_GRANULARITY (64 * 1024)
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace Mixins
+    {
+      class MemoryAccountable;
+    }
+
+    /// The parts of the library the memory is accounted to.
+    enum MemoryCategory
+    {
+      /// Elements, nodes, the node hash tables and the curved maps of the meshes.
+      MemoryMeshes = 0,
+      /// The node and element tables (ndata, edata) and the assembly list caches of the spaces.
+      MemorySpaces,
+      /// The coefficients (mono_coeffs, elem_coeffs) and the precalculated tables (sub_tables) of the solutions and the other mesh functions.
+      MemorySolutions,
+      /// The cache records and the arenas of DiscreteProblem.
+      MemoryAssemblyCaches,
+      /// The tables of the PrecalcShapeset instances and those shared by them.
+      MemoryPrecalcShapesetTables,
+      /// The matrices and the vectors of the solvers (LinearSolver, NewtonSolver, PicardSolver).
+      MemoryMatrices,
+      MemoryCategoryCount
+    };
+
+    /// @ingroup inner
+    /// Current and peak memory usage of the library by the category (see MemoryCategory), for the budgets of
+    /// the simulations sharing one machine. The numbers are estimates of the big data structures (the tables, not
+    /// every small member), reported by the instances (see Mixins::MemoryAccountable) when they change, so the peak
+    /// is the highest sum of the reported usages. Thread-safe.
+    ///
+    /// Usage: Hermes2DMemory.get_peak_usage(), Hermes2DMemory.report().
+    class HERMES_API MemoryAccounting
+    {
+    public:
+      /// Current usage in bytes, in total and of one category.
+      size_t get_current_usage() const;
+      size_t get_current_usage(MemoryCategory category) const;
+
+      /// Peak usage in bytes since the start (or reset_peak_usage()), in total and of one category.
+      /// The peaks of the categories are not reached at the same time, their sum is an upper bound of the total peak.
+      size_t get_peak_usage() const;
+      size_t get_peak_usage(MemoryCategory category) const;
+
+      /// Number of the instances currently reporting their usage in the category.
+      int get_num_instances(MemoryCategory category) const;
+
+      /// The peaks start from the current usage.
+      void reset_peak_usage();
+
+      /// A warning is issued (once until the usage falls below it again) when the total usage exceeds bytes, 0 - no budget (default).
+      void set_budget(size_t bytes);
+
+      /// Prints the current and the peak usage of all the categories.
+      void report() const;
+
+      /// Accounts memory that does not belong to one instance (e.g. the tables shared by all the PrecalcShapeset instances).
+      void add(MemoryCategory category, size_t bytes);
+      void remove(MemoryCategory category, size_t bytes);
+
+      static const char* get_category_name(MemoryCategory category);
+
+    private:
+      /// The changes, called inside the critical section memory_accounting.
+      void change(MemoryCategory category, size_t old_bytes, size_t new_bytes);
+
+      // No constructor - the instance is a global object, the static zero initialization keeps the usage
+      // reported by the other global objects constructed before it.
+      size_t current[MemoryCategoryCount];
+      size_t peak[MemoryCategoryCount];
+      size_t total_current;
+      size_t total_peak;
+      int instances[MemoryCategoryCount];
+      size_t budget;
+      bool over_budget;
+
+      friend class Mixins::MemoryAccountable;
+    };
+
+    /// Global instance used inside Hermes which is also accessible to users.
+    extern HERMES_API MemoryAccounting Hermes2DMemory;
+
+    /// Bytes of the arrays of a sparse matrix (values and indices of the nonzeros, column starts), 0 if the type does not tell its nonzeros.
+    template<typename Scalar>
+    size_t get_matrix_memory_usage(SparseMatrix<Scalar>* matrix)
+    {
+      if(matrix == NULL)
+        return 0;
+      try
+      {
+        return (size_t) matrix->get_nnz() * (sizeof(Scalar) + sizeof(int)) + ((size_t) matrix->get_size() + 1) * sizeof(int);
+      }
+      catch(Hermes::Exceptions::Exception&)
+      {
+        return 0;
+      }
+    }
+
+    /// Bytes of the values of a vector.
+    template<typename Scalar>
+    size_t get_vector_memory_usage(const Vector<Scalar>* vector)
+    {
+      return vector == NULL ? 0 : (size_t) vector->length() * sizeof(Scalar);
+    }
+  }
+}
+#endif
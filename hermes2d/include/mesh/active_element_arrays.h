@@ -0,0 +1,70 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_ACTIVE_ELEMENT_ARRAYS_H
+#define __H2D_ACTIVE_ELEMENT_ARRAYS_H
+
+#include "../global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    class Mesh;
+    class Element;
+
+    /// \brief The active elements of a mesh in contiguous arrays, one entry per element.
+    ///
+    /// A loop over the active elements that needs only their vertices, markers, areas, diameters and types
+    /// goes through these arrays instead of the (large, pointer-linked) Element structures of the whole
+    /// element array. The elements are in the order of their ids, the k-th one is elements[k].
+    /// Created by Mesh::get_active_element_arrays() and rebuilt when the mesh changes (its sequence number).
+    class HERMES_API ActiveElementArrays
+    {
+    public:
+      ActiveElementArrays(const Mesh* mesh);
+      ~ActiveElementArrays();
+
+      /// Number of the active elements.
+      int get_num_elements() const;
+
+      /// Sequence number of the mesh the arrays were built for.
+      unsigned get_seq() const;
+
+      int get_nvert(int k) const;
+      bool is_triangle(int k) const;
+      bool is_curved(int k) const;
+
+      /// The elements.
+      std::vector<Element*> elements;
+      /// Ids of the vertex nodes, vertices[4 * k], ..., vertices[4 * k + 3], the last one -1 for triangles.
+      std::vector<int> vertices;
+      /// Coordinates of the vertices, x[4 * k + i], y[4 * k + i], the last ones repeat the first for triangles.
+      std::vector<double> x, y;
+      std::vector<int> markers;
+      /// See Element::get_area(), Element::get_diameter().
+      std::vector<double> areas;
+      std::vector<double> diameters;
+
+    private:
+      unsigned seq;
+
+      static const unsigned char H2D_TRIANGLE = 1;
+      static const unsigned char H2D_CURVED = 2;
+      std::vector<unsigned char> flags;
+    };
+  }
+}
+#endif
@@ -58,6 +58,40 @@ namespace Hermes
       double angle; ///< arc angle
     };
 
+    /// \brief Reference map coefficients of the refined elements of one curved base element.
+    ///
+    /// Stored by the part (the transformation from the base element) together with the vertex coordinates
+    /// and the order they were projected for, an entry whose geometry differs is recomputed. Owned by the
+    /// top-level CurvMap and shared by its copies (Mesh::copy(), the reference meshes), so refining the same
+    /// curved element in another copy of the mesh reuses the projections. Accessed in the critical section
+    /// curved_coeffs_cache.
+    class HERMES_API CurvMapCache
+    {
+    private:
+      CurvMapCache();
+      ~CurvMapCache();
+
+      struct Entry
+      {
+        int order;
+        int nv;
+        double2 vertex_coords[H2D_MAX_NUMBER_VERTICES];
+        int nc;
+        double2* coeffs;
+      };
+      std::map<uint64_t, Entry> entries;
+
+      /// Number of the CurvMaps sharing the cache, deleted when this reaches zero.
+      int ref;
+      void unref();
+
+      /// Copies the coefficients to coeffs (of length nc), false if there are none for this geometry.
+      bool find(uint64_t part, int order, int nv, const double2* vertex_coords, int nc, double2* coeffs) const;
+      void insert(uint64_t part, int order, int nv, const double2* vertex_coords, int nc, const double2* coeffs);
+
+      friend class CurvMap;
+    };
+
     /// CurvMap is a structure storing complete information on the curved edges of
     /// an element. There are two variants of this structure. The first is for
     /// top-level (master mesh) elements.
@@ -67,9 +101,13 @@ namespace Hermes
     public:
       CurvMap()
       {
-        coeffs = NULL;};
+        coeffs = NULL;
+        cache = NULL;};
         CurvMap(CurvMap* cm);
         ~CurvMap();
+
+        /// Bytes taken by the structure and its coefficients (not the shared CurvMapCache).
+        size_t get_memory_usage() const { return sizeof(CurvMap) + (coeffs == NULL ? 0 : nc * sizeof(double2)); }
     private:
       /// this structure defines a curved mapping of an element; it has two
       /// modes, depending on the value of 'toplevel'
@@ -96,12 +134,17 @@ namespace Hermes
       int nc; ///< number of coefficients
       double2* coeffs; ///< array of the coefficients
 
+      /// Top-level only: the coefficients of the refined elements (created by the first of them), NULL otherwise.
+      CurvMapCache* cache;
+
       /// this is called for every curvilinear element when it is created
       /// or when it is necessary to re-calculate coefficients for another
       /// order: 'e' is a pointer to the element to which this CurvMap
       /// belongs to. First, old "coeffs" are removed if they are not NULL,
       /// then new coefficients are projected.
-      void update_refmap_coeffs(Element* e);
+      /// If vertex_coords != NULL, they are used instead of the (current) coordinates of the vertex nodes of 'e'.
+      /// Can be called for different elements in parallel.
+      void update_refmap_coeffs(Element* e, const double2* vertex_coords = NULL);
 
       void get_mid_edge_points(Element* e, double2* pt, int n);
 
@@ -116,8 +159,6 @@ namespace Hermes
       static Quad1DStd quad1d;
       static Quad2DStd quad2d; ///<  fixme: g_quad_2d_std
 
-      static Trf ctm;
-
       /// Recursive calculation of the basis function N_i,k(int i, int k, double t, double* knot).
       static double nurbs_basis_fn(int i, int k, double t, double* knot);
 
@@ -141,13 +182,14 @@ namespace Hermes
       static double** calculate_bubble_projection_matrix(int nb, int* indices, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, ElementMode2D mode);
       static void precalculate_cholesky_projection_matrices_bubble(H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss);
 
-      static void edge_coord(Element* e, int edge, double t, double2& x, double2& v);
-      static void calc_edge_projection(Element* e, int edge, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss);
+      /// The projections work in the sub-element given by ctm (the transformation of the part) of the top-level element.
+      static void edge_coord(Element* e, int edge, double t, double2& x, double2& v, const Trf& ctm);
+      static void calc_edge_projection(Element* e, int edge, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm);
 
       static void old_projection(Element* e, int order, double2* proj, double* old[2], H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss);
-      static void calc_bubble_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss);
+      static void calc_bubble_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm);
 
-      static void ref_map_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss);
+      static void ref_map_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm, const double2* vertex_coords);
 
       static bool warning_issued;
       template<typename T> friend class Space;
@@ -163,6 +205,7 @@ namespace Hermes
       friend class Mesh;
       friend class MeshReader;
       friend class MeshReaderH2D;
+      friend class MeshReaderH2DBinary;
       friend class MeshReaderH2DXML;
       friend CurvMap* create_son_curv_map(Element* e, int son);
     };
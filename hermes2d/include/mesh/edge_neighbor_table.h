@@ -0,0 +1,135 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_EDGE_NEIGHBOR_TABLE_H
+#define __H2D_EDGE_NEIGHBOR_TABLE_H
+
+#include "../global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    class Mesh;
+    class Element;
+    struct Node;
+
+    /// \brief The neighbors of all inner edges of the active elements of a mesh.
+    ///
+    /// For every active element and its inner edge holds the same information NeighborSearch::set_active_edge()
+    /// used to find by walking the element tree and the hash tables of the nodes: the neighborhood type, the
+    /// neighbor elements with their local edges and orientations, and the transformations (pushed on the central
+    /// element when going down, on the neighbor when going up). The walk is done once for the whole mesh, a query
+    /// is then a lookup by the element id.
+    /// Created by Mesh::get_edge_neighbor_table() and rebuilt when the mesh changes (its sequence number).
+    class HERMES_API EdgeNeighborTable
+    {
+    public:
+      EdgeNeighborTable(const Mesh* mesh);
+      ~EdgeNeighborTable();
+
+      /// One neighbor across an edge.
+      struct Neighbor
+      {
+        Element* element;
+        /// Local number of the edge on the neighbor.
+        int local_num_of_edge;
+        /// True if the neighbor edge is reversed w.r.t. the edge of the central element.
+        bool orientation;
+        /// The transformations, transformations[transf_offset], ..., transformations[transf_offset + num_levels - 1].
+        unsigned int num_levels;
+        int transf_offset;
+      };
+
+      /// Neighborhood type of the edge (NeighborSearch::NeighborhoodType), H2D_DG_NOT_INITIALIZED (-1) on the boundary.
+      int get_neighborhood_type(const Element* e, int edge) const;
+
+      /// The neighbors of the edge of the active element e, the number of them in num_neighbors.
+      const Neighbor* get_neighbors(const Element* e, int edge, int& num_neighbors) const;
+
+      /// The transformation arrays of the neighbors.
+      const unsigned int* get_transformations(const Neighbor* neighbor) const;
+
+      /// Sequence number of the mesh the table was built for.
+      unsigned get_seq() const;
+
+    private:
+      unsigned seq;
+      const Mesh* mesh;
+
+      /// The neighbors of the edge i of the element id are neighbors[starts[4 * id + i]], ..., neighbors[starts[4 * id + i + 1] - 1].
+      std::vector<int> starts;
+      std::vector<char> types;
+      std::vector<Neighbor> neighbors;
+      std::vector<unsigned int> transformations;
+
+      /// Find the neighbor element to a smaller central element.
+      ///
+      /// Central element is neccessarily a descendant of one or more inactive elements in this case. We go up
+      /// through these parents and check their edge with the same local number as the active edge. For each
+      /// inactive intermediate parent, this edge will not be used on the mesh (\c peek_edge_node return NULL).
+      /// Once a used edge is found, its actual owner is the active neighbor element, but it shares it with the
+      /// parent of the central element we were looking for. Transformation of the central element to this parent
+      /// is determined from the sequence of middle vertices of the intermediate parent edges. However, we actually use
+      /// the inverse transformation on the neighbor element.
+      ///
+      /// \param[in] elem             Pointer to a parent of the element from previous step.
+      /// \param[in] orig_vertex_id   Array of oriented vertices of the active edge.
+      /// \param[in] par_mid_vertices Array of vertices between those in \c orig_vertex_id visited on the way up.
+      /// \param[in] n_parents        Number of intermediate parents visited on the way up.
+      ///
+      void find_act_elem_up(Element* central_el, int active_edge, Element* elem, int* orig_vertex_id, Node** par_mid_vertices, int n_parents);
+
+      /// Find all neighbors to a bigger central element.
+      ///
+      /// This is a recursive bisection of the active edge, until its segment is found that is also used as another
+      /// edge on the mesh - by one of the active neighbor elements. The sequence of visited middle vertices is used
+      /// to define the transformation path for the central element through those of its (virtual) sub-elements that
+      /// lead to one completely adjacent to the found neighbor. Then we go back in the recursion tree and continue
+      /// in another branch down to the next neighbor, until all of them are found.
+      ///
+      /// \param[in] vertex             Pointer to a middle vertex of the edge from previous step.
+      /// \param[in] bounding_verts_id  Array of id's of vertices bounding the edge from previous step. They are passed
+      ///                               explicitly in order to keep information about the orientation of the edge.
+      /// \param[in] sons               Array that identifies virtual sons of the central element that must be visited in
+      ///                               order to get to one matching the actual neighbor.
+      /// \param[in] n_sons             Number of sons that lead to the current neighbor's counterpart.
+      ///
+      void find_act_elem_down(Element* central_el, int active_edge, Node* vertex, int* bounding_verts_id, int* sons, unsigned int n_sons);
+
+      void add_neighbor(Element* neighbor, int local_num_of_edge, bool orientation, const unsigned int* transf, unsigned int num_levels);
+
+      /// Local number of the edge on the neighbor, throws if the neighbor does not have it.
+      static int local_edge(Element* neighbor, Node* edge);
+
+      /// Determine relative orientation of the neighbor edge w.r.t. the active edge.
+      ///
+      /// When this method is called from \c find_act_elem_up, \c bounding_vert1 and \c bounding_vert2 represent vertices
+      /// bounding the edge of the central element's first inactive parent which completely matches the neighbor. Argument
+      /// \c segment is always zero in this case.
+      ///
+      /// When this method is called from \c find_act_elem_down, \c bounding_vert1 and \c bounding_vert2 represent vertices
+      /// which bound the edge of one of the inactive parents of the active neighbor element, with a <em>middle vertex</em>
+      /// in between. Which of these vertices is the startpoint and which the endpoint of the neighbor's active edge is
+      /// determined by the argument \c segment: neighbor edge spans from \c bounding_vert1 to the <em>middle vertex</em> if
+      /// <tt>segment == 0</tt>, or from the <em>middle vertex</em> to \c bounding_vert2 if <tt>segment == 1</tt>.
+      ///
+      /// \return true if the orientation of the neighbor's edge is reversed w.r.t. the central el.'s edge.
+      ///
+      static bool edge_orientation(Element* neighbor, int local_num_of_edge, int bounding_vert1, int bounding_vert2, int segment);
+    };
+  }
+}
+#endif
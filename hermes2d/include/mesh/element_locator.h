@@ -0,0 +1,67 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_ELEMENT_LOCATOR_H
+#define __H2D_ELEMENT_LOCATOR_H
+
+#include "../global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    class Mesh;
+    class Element;
+
+    /// \brief Uniform grid over the bounding boxes of the active elements of a mesh, finds the element of a point.
+    ///
+    /// The grid has about as many cells as there are active elements, every cell lists (in the order of the ids)
+    /// the elements whose bounding boxes overlap it, so a lookup tests only a few elements. The bounding boxes
+    /// of the curved elements are inflated by half of their size on every side, which covers arcs up to 180 degrees.
+    /// Created by Mesh::get_element_locator() and rebuilt when the mesh changes (its sequence number).
+    class HERMES_API ElementLocator
+    {
+    public:
+      ElementLocator(const Mesh* mesh);
+      ~ElementLocator();
+
+      /// The active element containing the point (x, y), NULL if there is none.
+      /// \param[out] x_reference, y_reference The reference coordinates of the point in the element (optional).
+      Element* find(double x, double y, double* x_reference = NULL, double* y_reference = NULL) const;
+
+      /// Sequence number of the mesh the grid was built for.
+      unsigned get_seq() const;
+
+    private:
+      unsigned seq;
+
+      /// Active elements and their bounding boxes (x_min, y_min, x_max, y_max).
+      std::vector<Element*> elements;
+      std::vector<double> boxes;
+
+      /// The grid, cell (i, j) covers [x_min + i * cell_width, ...) x [y_min + j * cell_height, ...).
+      double x_min, y_min, cell_width, cell_height;
+      int nx, ny;
+      /// Elements of the cell c are cell_elements[cell_starts[c]], ..., cell_elements[cell_starts[c + 1] - 1].
+      std::vector<int> cell_starts;
+      std::vector<int> cell_elements;
+      /// Tolerance of the bounding box tests.
+      double tolerance;
+
+      int cell_index(double coordinate, double min, double size, int n) const;
+    };
+  }
+}
+#endif
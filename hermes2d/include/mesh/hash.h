@@ -37,6 +37,9 @@ namespace Hermes
     ///
     /// HashTable is a base class for Mesh. It serves as a container for all nodes
     /// of a mesh. Moreover, it has node searching functions based on hash tables.
+    /// The tables are open-addressing (linear probing) ones keeping the parent ids together with
+    /// the node id in the slot, so that a search does not touch the nodes. They double their size
+    /// when half full, the size passed to init() is just the initial one.
     ///
     class HERMES_API HashTable : public Hermes::Mixins::Loggable
     {
@@ -47,7 +50,7 @@ namespace Hermes
       /// Returns the maximum node id number plus one.
       int get_max_node_id() const;
 
-      static const int H2D_DEFAULT_HASH_SIZE = 0x8000; // 32K entries
+      static const int H2D_DEFAULT_HASH_SIZE = 0x8000; // 32K entries (initial, the tables grow)
 
 
     protected:
@@ -57,6 +60,9 @@ namespace Hermes
       /// Returns the total number of nodes stored.
       int get_num_nodes() const;
 
+      /// Bytes taken by the nodes and the hash tables.
+      size_t get_nodes_memory_usage() const;
+
       /// Returns a vertex node with parent id's p1 and p2 if it exists, NULL otherwise.
       Node* peek_vertex_node(int p1, int p2) const;
 
@@ -76,7 +82,7 @@ namespace Hermes
       Array<Node> nodes; ///< Array storing all nodes
 
       /// Initializes the hash table.
-      /// \param size[in] Hash table size; must be a power of two.
+      /// \param size[in] Initial hash table size; must be a power of two.
       void init(int size = H2D_DEFAULT_HASH_SIZE);
 
       /// Copies another hash table contents
@@ -88,6 +94,10 @@ namespace Hermes
       /// Frees all memory used by the instance.
       void free();
 
+      /// Makes room for the given numbers of new vertex and edge nodes, so that the tables grow
+      /// at most once while they are added (see Mesh::refine_elements_id()).
+      void reserve(int num_new_vertex_nodes, int num_new_edge_nodes);
+
       /// Removes a vertex node with parent id's p1 and p2.
       void remove_vertex_node(int id);
 
@@ -97,22 +107,52 @@ namespace Hermes
       // Internal members
     private:
 
-      Node** v_table; ///< Vertex node hash table
-      Node** e_table; ///< Edge node hash table
+      /// One slot of a table, id == -1 for an empty one.
+      struct Slot
+      {
+        int p1, p2; ///< parent id numbers (p1 <= p2)
+        int id;     ///< node id number
+      };
+
+      /// One open-addressing table.
+      struct Table
+      {
+        Slot* slots;
+        int mask;  ///< size - 1
+        int count; ///< number of the nodes stored
+      };
+
+      Table v_table; ///< Vertex node hash table
+      Table e_table; ///< Edge node hash table
+
+      inline static int hash(int p1, int p2, int mask)
+      {
+        unsigned int h = 984120265u * (unsigned int) p1 + 125965121u * (unsigned int) p2;
+        return (int) ((h ^ (h >> 16)) & (unsigned int) mask);
+      }
+
+      /// Allocates an empty table of the given size (a power of two).
+      static void init_table(Table& table, int size);
+      static void free_table(Table& table);
+
+      /// Rehashes the table into a new one of the given size (a power of two).
+      static void resize_table(Table& table, int size);
 
-      int mask;
+      /// Returns the slot of the node with the parent ids p1 <= p2, or the empty slot where it belongs.
+      static int find_slot(const Table& table, int p1, int p2);
 
-      inline int hash(int p1, int p2) const { return (984120265*p1 + 125965121*p2) & mask; }
+      /// Inserts the node id with the parent ids p1 <= p2 (not present yet), the table grows if it is half full.
+      static void insert_slot(Table& table, int p1, int p2, int id);
 
-      /// Searches a list of hash synonyms given the first list item.
-      /// Returns the node matching the parent ids p1 and p2.
-      Node* search_list(Node* node, int p1, int p2) const;
+      /// Removes the node with the parent ids p1 <= p2 (if present).
+      static void remove_slot(Table& table, int p1, int p2);
 
-      /// Creates a copy of a hash synonym list.
-      void copy_list(Node** ptr, Node* node);
+      /// Returns the node with the parent ids p1, p2 in the table, NULL if not present.
+      Node* peek_node(const Table& table, int p1, int p2) const;
 
       friend struct Node;
       friend class MeshReaderH2D;
+      friend class MeshReaderH2DBinary;
       template<typename Scalar> friend class NeighborSearch;
       template<typename Scalar> friend class Space;
       template<typename Scalar> friend class H1Space;
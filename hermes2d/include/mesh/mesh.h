@@ -33,6 +33,9 @@ namespace Hermes
 
     class Element;
     class HashTable;
+    class ElementLocator;
+    class EdgeNeighborTable;
+    class ActiveElementArrays;
 
     template<typename Scalar> class Space;
     template<typename Scalar> class KellyTypeAdapt;
@@ -87,7 +90,6 @@ namespace Hermes
       };
 
       int p1, p2; ///< parent id numbers
-      Node* next_hash; ///< next node in hash synonym list
 
       /// Returns true if the (vertex) node is constrained.
       bool is_constrained_vertex() const;
@@ -129,6 +131,8 @@ namespace Hermes
       
       /// Calculates the area of the element. For curved elements, this is only
       /// an approximation: the curvature is not accounted for.
+      /// The area, the diameter and the center are calculated once and saved in the element
+      /// (until it is refined or the mesh rescaled).
       double get_area();
 
       /// Returns the length of the longest edge for triangles, and the
@@ -178,6 +182,10 @@ namespace Hermes
       /// Increase in integration order, see RefMap::calc_inv_ref_order()
       int iro_cache;
 
+      /// Forgets the saved area, diameter and center, they are calculated again on the next call
+      /// (the nodes of the element changed, or its vertices moved).
+      void reset_cached_geometry();
+
       /// Helper functions to obtain the index of the next or previous vertex/edge
       int next_vert(int i) const;
       int prev_vert(int i) const;
@@ -194,8 +202,10 @@ namespace Hermes
       unsigned nvert:30; ///< number of vertices (3 or 4)
 
       friend class Mesh;
+      friend class EdgeNeighborTable;
       friend class MeshReader;
       friend class MeshReaderH2D;
+      friend class MeshReaderH2DBinary;
       friend class MeshReaderH1DXML;
       friend class MeshReaderH2DXML;
       friend class PrecalcShapeset;
@@ -246,12 +256,17 @@ namespace Hermes
     ///&nbsp;e.print_msg();
     ///&nbsp;return -1;
     /// }
-    class HERMES_API Mesh : public HashTable, public Hermes::Hermes2D::Mixins::StateQueryable
+    class HERMES_API Mesh : public HashTable, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       Mesh();
       virtual ~Mesh();
 
+      /// Memory accounting - the elements, the nodes, the hash tables and the curved maps.
+      /// Reported after the loading, copying and refining of the mesh, and by the spaces on it (the single element refinements).
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemoryMeshes; }
+
       /// Initializes the mesh.
       /// \param size[in] Hash table size; must be a power of two.
       void init(int size = H2D_DEFAULT_HASH_SIZE);
@@ -263,6 +278,15 @@ namespace Hermes
       /// Rescales the mesh.
       bool rescale(double x_ref, double y_ref);
 
+      /// Compacts the ids of the elements and the nodes created by the refinements (the initial elements and the top-level
+      /// vertex nodes keep theirs), fragmented by the unrefinements of e.g. a transient adaptivity. The copies of the mesh
+      /// and the traversals become cheaper, the tables of the spaces and the solutions indexed by the ids shorter.
+      /// The seq of the mesh changes, the meshes derived from it (the reference meshes) have to be created anew, and the
+      /// refinement history is cleared (its replay would not produce these ids).
+      /// @param[out] element_ids, node_ids - if not NULL, the new id of every old one, -1 for the unused ones, for
+      /// Space::remap_ids() and Solution::remap_element_ids() of the spaces and the solutions on this mesh.
+      void defragment(std::vector<int>* element_ids = NULL, std::vector<int>* node_ids = NULL);
+
       /// Creates a copy of another mesh.
       void copy(const Mesh* mesh);
 
@@ -311,7 +335,16 @@ namespace Hermes
       /// refine vertically.
       void refine_element_id(int id, int refinement = 0);
 
+      /// Refines the elements ids[i] as refine_element_id(ids[i], refinements[i]) in this order would, in one pass:
+      /// the node tables grow once for all the new nodes beforehand and the reference mapping coefficients
+      /// of the new curved elements are computed in parallel at the end. Used by Adapt::apply_refinements().
+      void refine_elements_id(const Hermes::vector<int>& ids, const Hermes::vector<int>& refinements);
+
       /// Refines all elements.
+      /// This, refine_by_criterion(), refine_towards_vertex(), refine_towards_boundary() and refine_in_areas()
+      /// create the elements and nodes in the same order as refine_element_id() for every element would (so the ids are the same),
+      /// the reference mapping coefficients of the new curved elements are computed in parallel at the end of the call,
+      /// as well as the (Hermes) criteria of refine_towards_vertex() and refine_towards_boundary() before every pass.
       /// \param refinement[in] Same meaning as in refine_element_id().
       void refine_all_elements(int refinement = 0, bool mark_as_initial = false);
 
@@ -370,6 +403,22 @@ namespace Hermes
       /// For internal use.
       void set_seq(unsigned seq);
 
+      /// The active elements sorted along the Hilbert curve through their centers (of the vertices),
+      /// the elements close in the array are close in the domain.
+      void get_active_elements_hilbert_order(Hermes::vector<Element*>& ordered_elements) const;
+
+      /// The spatial index of the active elements (see RefMap::element_on_physical_coordinates()).
+      /// Built on the first call and again after the mesh changed (its sequence number), thread-safe.
+      const ElementLocator* get_element_locator() const;
+
+      /// The neighbors of the inner edges of the active elements (see NeighborSearch::set_active_edge()).
+      /// Built on the first call and again after the mesh changed (its sequence number), thread-safe.
+      const EdgeNeighborTable* get_edge_neighbor_table() const;
+
+      /// The vertices, markers, areas, diameters and types of the active elements in contiguous arrays.
+      /// Built on the first call and again after the mesh changed (its sequence number), thread-safe.
+      const ActiveElementArrays* get_active_element_arrays() const;
+
       /// Class for creating reference mesh.
       class HERMES_API ReferenceMeshCreator
       {
@@ -379,8 +428,15 @@ namespace Hermes
         /// \param refinement[in] Ignored for triangles. If the element
         /// is a quad, 0 means refine in both directions, 1 means refine
         /// horizontally (with respect to the reference domain), 2 means
-        /// refine vertically.
-        ReferenceMeshCreator(Mesh* coarse_mesh, int refinement = 0);
+        /// refine vertically. -1 means no refinement, the reference mesh is a copy of the coarse one: with
+        /// Space::ReferenceSpaceCreator and order_increase 1 or 2 the reference space is the coarse space enriched
+        /// only by the hierarchic higher-order shape functions (p-only reference), its solution is much cheaper than
+        /// on the uniformly refined mesh (4x the elements). The candidates of the projection-based selectors are then
+        /// evaluated by the local element projections of the reference solution on the coarse elements.
+        /// \param[in] cache If true, the coarse mesh keeps a copy of the reference mesh, a next creator with the
+        /// same refinement gives a copy of it (without refining) as long as the coarse mesh does not change
+        /// (e.g. when the adaptivity changed only the orders).
+        ReferenceMeshCreator(Mesh* coarse_mesh, int refinement = 0, bool cache = false);
 
         /// Method that does the creation.
         /// THIS IS THE METHOD TO OVERLOAD FOR CUSTOM CREATING OF A REFERENCE MESH.
@@ -390,6 +446,7 @@ namespace Hermes
         /// Storage.
         Mesh* coarse_mesh;
         int refinement;
+        bool cache;
       };
 
     private:
@@ -430,6 +487,24 @@ namespace Hermes
       int nactive;
       unsigned seq;
 
+      /// See get_element_locator().
+      mutable ElementLocator* element_locator;
+      void free_element_locator();
+
+      /// See get_edge_neighbor_table().
+      mutable EdgeNeighborTable* edge_neighbor_table;
+      void free_edge_neighbor_table();
+
+      /// See get_active_element_arrays().
+      mutable ActiveElementArrays* active_element_arrays;
+      void free_active_element_arrays();
+
+      /// The reference mesh kept by ReferenceMeshCreator, with the refinement and the sequence number of this mesh it was created for.
+      Mesh* cached_ref_mesh;
+      int cached_ref_mesh_refinement;
+      unsigned cached_ref_mesh_seq;
+      void free_cached_ref_mesh();
+
       int nbase, ntopvert;
       int ninitial;
 
@@ -446,7 +521,14 @@ namespace Hermes
       int parents_size;
 
       int  get_edge_degree(Node* v1, Node* v2);
+      /// The refinement regularize(n) needs for the element e, -1 if none.
+      int  get_regularization_refinement(Element* e, int n);
+      /// Appends the not yet queued active elements on the edge (v1, v2) and on the coarser edges containing it,
+      /// the only ones whose edge degree grows when the element with the edge is refined.
+      void queue_regularization_neighbors(Node* v1, Node* v2, std::vector<char>& queued, std::vector<int>& worklist);
       void assign_parent(Element* e, int i);
+      /// Makes the parents array hold at least size entries.
+      void grow_parents(int size);
       void regularize_triangle(Element* e);
       void regularize_quad(Element* e);
       void flatten();
@@ -545,6 +627,7 @@ namespace Hermes
       BoundaryMarkersConversion boundary_markers_conversion;
 
       friend class MeshReaderH2D;
+      friend class MeshReaderH2DBinary;
       friend class MeshReaderH2DXML;
       friend class MeshReaderH1DXML;
       friend class MeshReaderExodusII;
@@ -560,6 +643,7 @@ namespace Hermes
       template<typename Scalar> friend class Filter;
       template<typename Scalar> friend class MeshFunction;
       friend class RefMap;
+      friend class EdgeNeighborTable;
       friend class Traverse;
       friend class Transformable;
       friend class Curved;
@@ -681,6 +765,26 @@ namespace Hermes
       Element* create_triangle(int marker, Node* v0, Node* v1, Node* v2, CurvMap* cm, int id = -1);
       void refine_element(Element* e, int refinement);
 
+      /// A curved element created during a batch refinement, with the coordinates of its vertices at the time
+      /// (a later refinement of a neighbor may move a shared mid-edge vertex).
+      struct PendingRefmapUpdate
+      {
+        Element* e;
+        double2 vertex_coords[H2D_MAX_NUMBER_VERTICES];
+      };
+      /// In a batch refinement the reference mapping coefficients of the new curved elements are not computed in
+      /// refine_quad() etc., but in parallel in finish_batch_refinement().
+      bool batch_refinement;
+      std::vector<PendingRefmapUpdate> pending_refmap_updates;
+      void begin_batch_refinement();
+      void finish_batch_refinement();
+      /// Computes (or in a batch refinement postpones) the reference mapping coefficients of a new curved element.
+      void update_refmap_coeffs(Element* e);
+
+      /// refine_by_criterion() evaluating the criterion in parallel before every pass, the criterion
+      /// must be thread-safe and depend only on the element and its nodes (as rtv_criterion(), rtb_criterion()).
+      void refine_by_thread_safe_criterion(int (*criterion)(Element*), int depth);
+
       /// Vector for storing refinements in order to be able to save/load meshes with identical element IDs.
       /// Refinement "-1" stands for unrefinement.
       Hermes::vector<std::pair<unsigned int, int> > refinements;
@@ -0,0 +1,59 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_MESH_PARTITIONER_H
+#define __H2D_MESH_PARTITIONER_H
+
+#include "../global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    class Mesh;
+    class Element;
+
+    /// \brief Partition of the base elements of a mesh into the subdomains of the distributed (MPI) assembling.
+    ///
+    /// The refinements stay in the subdomain of their base element, so every rank can refine its copy of the mesh
+    /// and the partition of the base elements remains valid. The base elements are weighted by the number of their
+    /// active descendants. With METIS (WITH_METIS) the dual graph of the base elements (the elements sharing an
+    /// edge) is partitioned by METIS_PartGraphKway, otherwise the base elements are cut into contiguous chunks
+    /// of their order along the Hilbert curve (Mesh::get_active_elements_hilbert_order()).
+    /// See DiscreteProblem::set_subdomain().
+    class HERMES_API MeshPartitioner
+    {
+    public:
+      /// Partitions the base elements into num_parts subdomains.
+      /// \param[out] base_element_parts The subdomain of every base element (indexed by its id).
+      static void partition(const Mesh* mesh, int num_parts, std::vector<int>& base_element_parts);
+
+      /// The base element (the root of the refinement tree) of an element.
+      static Element* get_base_element(Element* e);
+
+      /// Rank of this process and the number of the processes in MPI_COMM_WORLD, 0 and 1 without MPI (or before MPI_Init()).
+      static int get_rank();
+      static int get_num_ranks();
+
+    private:
+      /// Number of the active descendants of every base element.
+      static void get_weights(const Mesh* mesh, std::vector<int>& weights);
+
+      /// The space filling curve partition.
+      static void partition_hilbert(const Mesh* mesh, int num_parts, const std::vector<int>& weights, std::vector<int>& base_element_parts);
+    };
+  }
+}
+#endif
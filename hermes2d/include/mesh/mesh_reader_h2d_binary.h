@@ -0,0 +1,78 @@
+// This file is part of Hermes2D
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, see <http://www.gnu.prg/licenses/>.
+
+#ifndef _MESH_READER_H2D_BINARY_H_
+#define _MESH_READER_H2D_BINARY_H_
+
+#include "mesh_reader.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// Mesh reader and writer of the binary Hermes2D format.
+    ///
+    /// @ingroup mesh_readers
+    /// The file holds the same data as the Hermes2D text format (vertices, elements, boundary markers, curves,
+    /// refinements) in flat arrays of the native byte order after a fixed header. The file is mapped into the memory
+    /// (read on Windows) and the mesh is built in one pass over the arrays, without any parsing.
+    /// Typical usage:
+    /// Hermes::Hermes2D::Mesh mesh;
+    /// Hermes::Hermes2D::MeshReaderH2D mloader;
+    /// mloader.load("domain.mesh", &mesh);
+    /// Hermes::Hermes2D::MeshReaderH2DBinary bloader;
+    /// bloader.save("domain.h2db", &mesh);
+    /// ...
+    /// bloader.load("domain.h2db", &mesh);
+    class HERMES_API MeshReaderH2DBinary : public MeshReader
+    {
+    public:
+      MeshReaderH2DBinary();
+      virtual ~MeshReaderH2DBinary();
+
+      virtual bool load(const char *filename, Mesh *mesh);
+      virtual bool save(const char *filename, Mesh *mesh);
+
+    protected:
+      /// Fixed part of the file, followed by the arrays (each starting at a multiple of 8 bytes):
+      /// double vertices[2 * num_vertices] (x, y),
+      /// int elements[5 * num_elements] (4 vertices - the last one -1 for triangles, the first one -1 for unused slots -, marker),
+      /// int boundaries[3 * num_boundaries] (2 vertices, marker),
+      /// int curves[5 * num_curves] (2 vertices, degree - 0 for a circular arc -, number of the inner control points and knots),
+      /// double curve_values[num_curve_values] (the angle of an arc, the control points (x, y, weight) and knots of a NURBS),
+      /// int refinements[2 * num_refinements] (element, refinement type),
+      /// int marker_offsets[num_element_markers + num_boundary_markers + 1], char marker_chars[num_marker_chars]
+      /// (the user markers, the element ones first, the markers in elements and boundaries are indices of these).
+      struct Header
+      {
+        char magic[8];
+        int num_vertices;
+        int num_elements;
+        int num_boundaries;
+        int num_curves;
+        int num_curve_values;
+        int num_refinements;
+        int num_element_markers;
+        int num_boundary_markers;
+        int num_marker_chars;
+        int padding;
+      };
+
+      Nurbs* load_nurbs(Mesh *mesh, const int* curve, const double* values, Node** en);
+      void save_refinements(Element* e, int id, int& next_id, std::vector<int>& refinements);
+    };
+  }
+}
+#endif
@@ -73,6 +73,13 @@ namespace Hermes
       bool save(const char *filename, Hermes::vector<Mesh *> meshes);
 
     protected:
+      /// Internal method loading a single mesh by the streaming XMLStreamReader (Hermes2DApi's xmlStreaming, no validation).
+      /// Fills the mesh while reading, the result is the same as of the loading through the XSD object tree.
+      bool load_stream(const char *filename, Mesh *mesh);
+
+      /// Internal method assigning a curve to the elements sharing its edge node en, p1 is its first vertex.
+      void assign_curve(Mesh *mesh, Nurbs* nurbs, Node* en, int p1);
+
       /// Internal method loading contents of parsed_xml_mesh into mesh.
       bool load(std::auto_ptr<XMLMesh::mesh> & parsed_xml_mesh, Mesh *mesh, std::map<unsigned int, unsigned int>& vertex_is);
 
@@ -75,6 +75,7 @@ namespace Hermes
       static void untransform(Element* e, double x, double y, double& xi1, double& xi2);
 
       /// Returns the element pointer located at physical coordinates x, y.
+      /// Looks the point up in the spatial index of the mesh (see Mesh::get_element_locator()).
       /// \param[in] x Physical x-coordinate.
       /// \param[in] y Physical y-coordinate.
       /// \param[in] x_reference Optional parameter, in which the x-coordinate of x in the reference domain will be returned.
@@ -94,6 +95,11 @@ namespace Hermes
       /// variables.
       double* get_phys_y(int order);
 
+      /// Fills x, y (of the length of the number of the integration points) by the physical coordinates of the
+      /// integration points. Affine elements (is_jacobian_const()) evaluate their affine map directly, without
+      /// the tables of get_phys_x() and get_phys_y().
+      void get_phys_coordinates(int order, double* x, double* y);
+
       /// Returns true if the jacobian of the reference map is constant (which
       /// is the case for non-curvilinear triangular elements), false otherwise.
       bool is_jacobian_const() const;
@@ -173,6 +179,8 @@ namespace Hermes
         double* phys_x[H2D_MAX_TABLES];
         double* phys_y[H2D_MAX_TABLES];
         double3* tan[H2D_MAX_NUMBER_EDGES];
+        /// The edge pseudo-order tan[] was calculated for.
+        int tan_order[H2D_MAX_NUMBER_EDGES];
       };
 
       /// Table of RefMap::Nodes, indexed by a sub-element mapping.
@@ -211,6 +219,10 @@ namespace Hermes
 
       static bool is_parallelogram(Element* e);
 
+      /// The affine map of the current (sub-)element of a constant jacobian element:
+      /// x = map[0][0] * xi1 + map[0][1] * xi2 + map[0][2], y = map[1][0] * xi1 + map[1][1] * xi2 + map[1][2].
+      void calc_affine_map(double map[2][3]) const;
+
       void calc_phys_x(int order);
 
       void calc_phys_y(int order);
@@ -255,6 +267,7 @@ namespace Hermes
       friend Geom<double>* init_geom_vol(RefMap *rm, const int order);
       friend Geom<double>* init_geom_surf(RefMap *rm, SurfPos* surf_pos, const int order);
       friend Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order);
+      friend void calc_fn(PrecalcShapeset *fu, RefMap *rm, const int order, Func<double>* u);
       template<typename T> friend T int_g_h(Function<T>* fg, Function<T>* fh, RefMap* rg, RefMap* rh);
 	};
   }
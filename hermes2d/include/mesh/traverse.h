@@ -26,6 +26,7 @@ namespace Hermes
       class Orderizer;
       class Linearizer;
       class Vectorizer;
+      class MultiLinearizer;
     };
 
     /** @defgroup inner Hermes hp-FEM/hp-DG assembling core
@@ -102,6 +103,7 @@ namespace Hermes
       friend class Traverse;
       friend class Views::Linearizer;
       friend class Views::Vectorizer;
+      friend class Views::MultiLinearizer;
       template<typename Scalar> friend class DiscreteProblem;
       template<typename Scalar> friend class DiscreteProblemLinear;
       };
@@ -111,6 +113,21 @@ namespace Hermes
 
       State* get_next_state(int* top_by_ref = NULL, int* id_by_ref = NULL);
       int get_num_states(Hermes::vector<const Mesh*> meshes);
+
+      /// Materializes the whole traversal of the union mesh into a flat array of (copied) states.
+      /// If all the meshes are the same one, the states are simply its active elements (see is_single_mesh()).
+      /// The states can then be processed in any order, and by any number of threads at once.
+      /// The caller is responsible for deallocation, see free_states().
+      /// The traversals of the last few combinations of meshes are cached (as element ids and sub-element
+      /// transformations), as long as the meshes have the same sequence numbers the states are replayed from the cache.
+      /// \param[out] states_count Number of the states returned.
+      State** get_states(Hermes::vector<const Mesh*> meshes, int& states_count);
+      /// Deallocates the array returned by get_states().
+      static void free_states(State** states, int states_count);
+      /// Frees the cached traversals of get_states().
+      static void clear_states_cache();
+      /// Sets the active elements and sub-element transformations of the state to the functions of this traverse.
+      void set_active_state(State* s);
       inline Element*  get_base() const { return base; }
 
       void init_transforms(State* s, int i);
@@ -133,6 +150,16 @@ namespace Hermes
       UniData** unidata;
       int udsize;
 
+      /// All the meshes are the same one (the usual case of the systems) - there is no union mesh, the states are the active
+      /// elements of the mesh with the identity transformations, found without the rectangles of the sub-elements.
+      static bool is_single_mesh(const Hermes::vector<const Mesh*>& meshes);
+      /// See is_single_mesh(), set by begin().
+      bool single_mesh;
+      /// get_next_state() on a single mesh.
+      State* get_next_state_single_mesh(int* top_f, int* id_f);
+      /// get_states() on a single mesh, the states in the order of get_next_state().
+      State** get_single_mesh_states(const Mesh* mesh, int& states_count);
+
       State* push_state(int* top_by_ref = NULL);
       void set_boundary_info(State* s);
       void union_recurrent(Rect* cr, Element** e, Rect* er, uint64_t* idx, Element* uni);
@@ -140,6 +167,10 @@ namespace Hermes
 
       void free_state(State* state);
 
+      /// The cache of get_states(), NULL if the traversal of the meshes is not cached.
+      static State** replay_states(Hermes::vector<const Mesh*>& meshes, int& states_count);
+      static void store_states(Hermes::vector<const Mesh*>& meshes, State** states, int states_count);
+
       bool master;
 
       Mesh* unimesh;
@@ -153,6 +184,7 @@ namespace Hermes
       friend class Views::Orderizer;
       friend class Views::Vectorizer;
       friend class Views::Linearizer;
+      friend class Views::MultiLinearizer;
     };
   }
 }
@@ -1,6 +1,7 @@
 #ifndef __H2D_MIXINS_H
 #define __H2D_MIXINS_H
 #include "global.h"
+#include "memory_accounting.h"
 namespace Hermes
 {
   namespace Hermes2D
@@ -50,6 +51,35 @@ namespace Hermes
         void check() const;
       };
 
+      /// \ingroup g_mixins2d
+      /// Mixin for the classes whose memory is accounted in Hermes2DMemory (see MemoryAccounting).
+      /// The instance reports its usage by update_memory_usage() after it changes (the first call registers it),
+      /// the destructor removes the last reported usage. Copies start unregistered.
+      class HERMES_API MemoryAccountable
+      {
+      public:
+        MemoryAccountable();
+        MemoryAccountable(const MemoryAccountable& other);
+        MemoryAccountable& operator=(const MemoryAccountable& other);
+        virtual ~MemoryAccountable();
+
+        /// Bytes currently taken by the big data structures of the instance.
+        virtual size_t get_memory_usage() const = 0;
+
+        /// The category the instance is accounted to.
+        virtual MemoryCategory get_memory_category() const = 0;
+
+        /// Reports the current get_memory_usage() to Hermes2DMemory.
+        /// \param[in] lazy Only if it differs from the last reported one by more than H2D_MEMORY_ACCOUNTING_GRANULARITY
+        /// (for the frequently changing tables).
+        void update_memory_usage(bool lazy = false) const;
+
+      private:
+        mutable size_t memory_reported;
+        mutable MemoryCategory memory_reported_category;
+        mutable bool memory_registered;
+      };
+
       /// \ingroup g_mixins2d
       /// Any XML parsing class should inherit from this mixin.
       /// It serves various purposes, first of which is disabling / re-enabling of validation
@@ -83,7 +113,7 @@ namespace Hermes
         /// Sets this instance to output matrix entries even though they are zero or not.
         void set_print_zero_matrix_entries(bool to_set);
         /// Sets filename for the matrix
-        /// Default: Matrix_'iteration number' with the ".m" extension in the case of matlab format.
+        /// Default: Matrix_'iteration number' with the ".m" extension in the case of matlab format, ".bin" in the case of DF_HERMES_BIN.
         /// \param[in] name sets the main part of the name, i.e. replacement for "Matrix_" in the default name.
         void set_matrix_filename(std::string name);
         /// Sets varname for the matrix
@@ -100,7 +130,7 @@ namespace Hermes
         /// \param[in] firstIterations Only during so many first iterations. Default: -1 meaning, that during all iterations, the rhs will be saved.
         void output_rhs(int firstIterations = -1);
         /// Sets filename for the rhs
-        /// Default: Rhs_'iteration number' with the ".m" extension in the case of matlab format.
+        /// Default: Rhs_'iteration number' with the ".m" extension in the case of matlab format, ".bin" in the case of DF_HERMES_BIN.
         /// \param[in] name sets the main part of the name, i.e. replacement for "Rhs_" in the default name.
         void set_rhs_filename(std::string name);
         /// Sets varname for the rhs
@@ -114,6 +144,10 @@ namespace Hermes
         void set_rhs_number_format(char* number_format);
         
       protected:
+        /// Dumps the matrix / rhs of the iteration to its file (see set_matrix_filename(), set_rhs_filename()).
+        void dump_matrix(SparseMatrix<Scalar>* matrix, int iteration) const;
+        void dump_rhs(Vector<Scalar>* rhs, int iteration) const;
+
         bool print_matrix_zero_values;
         bool output_matrixOn;
         int output_matrixIterations;
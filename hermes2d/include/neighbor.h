@@ -87,9 +87,10 @@ namespace Hermes
       /// In particular, it fills the \c neighbors and \c neighbor_edges vectors and the \c transformations array used
       /// for transforming either the central or the neighboring elements to the same size. It also sets \c neighborhood_type,
       /// according to whether we can find a vertex in the middle of the active edge - if we can, then we go down and the
-      /// corresponding transformations will be filled for the bigger central element. This is performed by the method
-      /// \c find_act_elem_down. Otherwise, we go up and will later push the transformations from \c transfomations to
-      /// functions on the bigger neighboring element. Way up is Realized by the method \c find_act_elem_up.
+      /// corresponding transformations will be filled for the bigger central element. Otherwise, we go up and will later
+      /// push the transformations from \c transfomations to functions on the bigger neighboring element. The search itself
+      /// is done once for all edges of the mesh by EdgeNeighborTable (see Mesh::get_edge_neighbor_table()), so this is a copy
+      /// of its results.
       ///
       /// \param[in] edge Local (element dependent) number of the edge.
       /// \param[in] ignore_visited_segments   If true, it indicates that an edge-based discontinuous Galerkin formulation
@@ -350,61 +351,6 @@ namespace Hermes
       };
       NeighborhoodType neighborhood_type;
 
-      /// Find the neighbor element to a smaller central element.
-      ///
-      /// Central element is neccessarily a descendant of one or more inactive elements in this case. We go up
-      /// through these parents and check their edge with the same local number as the active edge. For each
-      /// inactive intermediate parent, this edge will not be used on the mesh (\c peek_edge_node return NULL).
-      /// Once a used edge is found, its actual owner is the active neighbor element, but it shares it with the
-      /// parent of the central element we were looking for. Transformation of the central element to this parent
-      /// is determined from the sequence of middle vertices of the intermediate parent edges. However, we actually use
-      /// the inverse transformation on the neighbor element.
-      ///
-      /// \param[in] elem             Pointer to a parent of the element from previous step.
-      /// \param[in] orig_vertex_id   Array of oriented vertices of the active edge.
-      /// \param[in] par_mid_vertices Array of vertices between those in \c orig_vertex_id visited on the way up.
-      /// \param[in] n_parents        Number of intermediate parents visited on the way up.
-      ///
-      void find_act_elem_up( Element* elem, int* orig_vertex_id, Node** par_mid_vertices, int n_parents);
-
-      /// Find all neighbors to a bigger central element.
-      ///
-      /// This is a recursive bisection of the active edge, until its segment is found that is also used as another
-      /// edge on the mesh - by one of the active neighbor elements. The sequence of visited middle vertices is used
-      /// to define the transformation path for the central element through those of its (virtual) sub-elements that
-      /// lead to one completely adjacent to the found neighbor. Then we go back in the recursion tree and continue
-      /// in another branch down to the next neighbor, until all of them are found.
-      ///
-      /// \param[in] vertex             Pointer to a middle vertex of the edge from previous step.
-      /// \param[in] bounding_verts_id  Array of id's of vertices bounding the edge from previous step. They are passed
-      ///                               explicitly in order to keep information about the orientation of the edge.
-      /// \param[in] sons               Array that identifies virtual sons of the central element that must be visited in
-      ///                               order to get to one matching the actual neighbor. This defines the row of the
-      ///                               \c transformations array corresponding to that neighbor.
-      /// \param[in] n_sons             Number of sons that lead to the current neighbor's counterpart.
-      ///
-      void find_act_elem_down( Node* vertex, int* bounding_verts_id, int* sons, unsigned int n_sons);
-
-      /// Determine relative orientation of the neighbor edge w.r.t. the active edge.
-      ///
-      /// When this method is called from \c find_act_elem_up, \c bounding_vert1 and \c bounding_vert2 represent vertices
-      /// bounding the edge of the central element's first inactive parent which completely matches the neighbor. Argument
-      /// \c segment is always zero in this case.
-      ///
-      /// When this method is called from \c find_act_elem_down, \c bounding_vert1 and \c bounding_vert2 represent vertices
-      /// which bound the edge of one of the inactive parents of the active neighbor element, with a <em>middle vertex</em>
-      /// in between. Which of these vertices is the startpoint and which the endpoint of the neighbor's active edge is
-      /// determined by the argument \c segment: neighbor edge spans from \c bounding_vert1 to the <em>middle vertex</em> if
-      /// <tt>segment == 0</tt>, or from the <em>middle vertex</em> to \c bounding_vert2 if <tt>segment == 1</tt>.
-      ///
-      /// \param[in] bounding_vert1 ID of one endpoint of the edge (see above).
-      /// \param[in] bounding_vert2 ID of the other endpoint of the edge (see above).
-      ///
-      /// \return 1 if the orientation of the neighbor's edge is reversed w.r.t. the central el.'s edge,
-      ///         0 otherwise.
-      ///
-      bool neighbor_edge_orientation(int bounding_vert1, int bounding_vert2, int segment) const;
-
       /// Cleaning of internal structures before a new edge is set as active.
       void reset_neighb_info();
 
@@ -25,6 +25,7 @@
 #include "global.h"
 #include "discrete_problem.h"
 #include "exceptions.h"
+#include "jacobian_update_policy.h"
 
 namespace Hermes
 {
@@ -68,7 +69,7 @@ namespace Hermes
     ///&nbsp;return -1;<br>
     /// }<br>
     template<typename Scalar>
-    class HERMES_API NewtonSolver : public NonlinearSolver<Scalar>, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable
+    class HERMES_API NewtonSolver : public NonlinearSolver<Scalar>, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       NewtonSolver();
@@ -83,7 +84,14 @@ namespace Hermes
       virtual bool isOkay() const;
       inline std::string getClassName() const { return "NewtonSolver"; }
 
+      /// Memory accounting - the matrices and the vectors, reported after their assembling.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemoryMatrices; }
+
       /// Solve.
+      /// The iterations run in two vectors kept by the solver between the solves (reallocated only when the number of DOFs
+      /// changes), the backup vector of the damping is swapped with the iterate, not copied, and get_sln_vector() returns
+      /// the final iterate itself. coeff_vec is read once and overwritten by the solution at the end.
       /// \param[in] coeff_vec Ceofficient vector to start from.
       void solve(Scalar* coeff_vec = NULL);
 
@@ -107,6 +115,14 @@ namespace Hermes
       /// \param[in] initial_guess Solutions to start from (which is projected to obtain the initial coefficient vector.
       void solve_keep_jacobian(Hermes::vector<Solution<Scalar>*> initial_guess);
 
+      /// Adjoint (dual) problem of the last solve(), for the goal-oriented error estimation (see GoalOrientedAdapt).
+      /// Solves J^T z = g with the Jacobian of the last Newton step, its factorization is reused (the linear solver
+      /// has to support solve_transposed()). The vector g is assembled from the vector forms of goal_wf, which are
+      /// the derivative of the goal functional, on the spaces of this solver at the solution of the last solve().
+      /// \param[in] goal_wf The weak formulation of the goal functional (vector forms only).
+      /// \param[out] adjoint_coeff_vec The coefficient vector of the adjoint solution z, allocated by the caller (ndof).
+      void solve_adjoint(const WeakForm<Scalar>* goal_wf, Scalar* adjoint_coeff_vec);
+
       /// Sets the maximum allowed norm of the residual during the calculation.
       /// Default: 1E9
       void set_max_allowed_residual_norm(double max_allowed_residual_norm_to_set);
@@ -130,6 +146,48 @@ namespace Hermes
       /// numerical integration over the entire domain. Therefore this option is off by default.
       void set_residual_as_function();
 
+      /// Assemble the jacobian together with the residual, in one traversal of the mesh(es).
+      /// Saves the second evaluation of reference mappings, previous iterations and geometry in every step,
+      /// at the price of one unnecessary jacobian assembly in the last (converged) step.
+      /// Default: off (the residual is assembled first, the jacobian only if the residual norm test requires it).
+      /// \param[in] onOff on(true)-one fused pass, off(false)-separate passes.
+      void set_jacobian_with_residual(bool onOff = true);
+
+      /// Jacobian-free Newton-Krylov in solve(): the Newton systems are solved by the built-in GMRES (KrylovSolver),
+      /// the products by the Jacobian are the finite differences of the residual, J v = (F(u + eps v) - F(u)) / eps,
+      /// one residual assembly each. No Jacobian is assembled, unless lagged_jacobian_preconditioner is set: then the
+      /// Jacobian is assembled and factorized once and kept (as in solve_keep_jacobian()) to precondition GMRES.
+      /// The damping works as with the assembled Jacobian.
+      /// Default: off.
+      void set_jacobian_free(bool to_set = true, bool lagged_jacobian_preconditioner = false);
+
+      /// Relative tolerance and maximum number of iterations of GMRES in the Jacobian-free mode.
+      /// Default: 1E-4, 100. A step not converged to the tolerance is taken as it is (inexact Newton).
+      void set_jacobian_free_linear_tolerance(double tolerance, int max_iterations = 100);
+
+      /// Inexact Newton: the relative tolerance of the iterative linear solver (AztecOO, KrylovSolver, the GMRES of
+      /// set_jacobian_free()) is set in every step by the Eisenstat-Walker forcing term (choice 2),
+      /// eta_k = 0.9 (||F_k|| / ||F_k-1||)^2, safeguarded by 0.9 eta_k-1^2 (if above 0.1), bounded by max_forcing_term
+      /// and kept above 0.5 newton_tol / ||F_k|| (no oversolving close to convergence). The first step uses initial_forcing_term.
+      /// The steps restarted by the automatic damping (norm increased) thus get max_forcing_term. Ignored by the direct solvers.
+      /// Default: off (the tolerance of the iterative solver, resp. set_jacobian_free_linear_tolerance()).
+      void set_inexact_newton(bool to_set = true, double max_forcing_term = 0.9, double initial_forcing_term = 0.5);
+
+      /// Lagged Jacobian in solve(): the policy decides in every iteration whether the Jacobian is reassembled,
+      /// otherwise the last one is used again with its factorization, also in the following calls of solve() (time steps).
+      /// The time step of the policy is the one of the weak formulation (set_time_step()).
+      /// The fused assembly (set_jacobian_with_residual()) is not done then. Not deleted by the solver, NULL switches it off.
+      /// Default: NULL (the Jacobian is assembled in every iteration).
+      void set_jacobian_update_policy(JacobianUpdatePolicy* policy);
+
+      /// Extrapolated initial guesses of time stepping: solve() and solve_keep_jacobian() start from the polynomial extrapolation
+      /// (Lagrange, of degree history_size - 1) of the last history_size converged solutions to the current time of the weak
+      /// formulation (set_time()), instead of the passed coefficient vector, once there are at least two of them.
+      /// A step repeated from an earlier time (e.g. rejected) replaces the solutions after it. The history is dropped when
+      /// the spaces change (their coefficient vectors can not be combined), the first step after that starts from coeff_vec.
+      /// Default: 0 (off), 2 - linear, 3 - quadratic extrapolation.
+      void set_initial_guess_extrapolation(int history_size = 2);
+
       /// Set the residual norm tolerance for ending the Newton's loop.
       /// Default: 1E-8.
       void set_newton_tol(double newton_tol);
@@ -191,6 +249,58 @@ namespace Hermes
 
       /// Used by method solve_keep_jacobian().
       SparseMatrix<Scalar>* kept_jacobian;
+      /// Assembles kept_jacobian and sets up the linear solver with it to be factorized once (unless it has been kept).
+      void assemble_kept_jacobian(Scalar* coeff_vec, int it);
+
+      /// See set_jacobian_free().
+      bool jacobian_free;
+      bool jacobian_free_lagged_jacobian;
+      double jacobian_free_tolerance;
+      int jacobian_free_max_iters;
+      /// GMRES of the Jacobian-free mode and its rhs (created in the first Jacobian-free solve).
+      Hermes::Solvers::KrylovSolver<Scalar>* jacobian_free_solver;
+      SimpleVector<Scalar>* jacobian_free_rhs;
+      /// Solves the Newton system at coeff_vec in the Jacobian-free mode, residual holds -F(coeff_vec), returns the step.
+      Scalar* solve_jacobian_free(Scalar* coeff_vec, int it);
+
+      /// See set_jacobian_with_residual().
+      bool jacobian_with_residual;
+
+      /// See set_jacobian_update_policy().
+      JacobianUpdatePolicy* jacobian_update_policy;
+
+      /// See set_inexact_newton().
+      bool inexact_newton;
+      double max_forcing_term;
+      double initial_forcing_term;
+      /// The current forcing term and the residual norm it was calculated for.
+      double forcing_term;
+      double forcing_term_residual_norm;
+      /// Calculates the forcing term of the step it with the residual norm and passes it to the iterative linear solver.
+      void update_forcing_term(double residual_norm, int it);
+
+      /// See set_initial_guess_extrapolation().
+      int history_size;
+      /// The last converged coefficient vectors (the oldest first), the times of the weak formulation they belong to
+      /// and the spaces (with their seq) they were calculated on.
+      std::vector<Scalar*> history_vectors;
+      std::vector<double> history_times;
+      std::vector<std::pair<const Space<Scalar>*, int> > history_spaces;
+      /// The history belongs to the current spaces.
+      bool history_valid(int ndof) const;
+      void clear_history();
+      /// Overwrites coeff_vec by the extrapolation to the current time (if possible).
+      void extrapolate_initial_guess(Scalar* coeff_vec, int ndof);
+      /// Adds the converged coefficient vector to the history.
+      void add_to_history(Scalar* sln_vector, int ndof);
+
+      /// The vector for restarting the steps, the pair of NonlinearSolver::sln_vector, both of work_vectors_size entries.
+      Scalar* coeff_vec_back;
+      int work_vectors_size;
+      /// (Re)allocates the work vectors for ndof and puts the initial guess (zero if NULL) to sln_vector.
+      void init_work_vectors(int ndof, Scalar* coeff_vec);
+      /// Stores the (possibly swapped) work vectors back, copies the solution to the caller's vector (if not NULL).
+      void finish_work_vectors(Scalar* coeff_vec, Scalar* coeff_vec_back, Scalar* caller_coeff_vec, int ndof);
 
       /// Internal setting of default values (see individual set methods).
       void init_attributes();
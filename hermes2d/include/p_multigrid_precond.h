@@ -0,0 +1,142 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the p-multigrid preconditioner for hierarchical shapesets (class PMultigridPrecond).
+
+#ifndef __H2D_P_MULTIGRID_PRECOND_H
+#define __H2D_P_MULTIGRID_PRECOND_H
+
+#include "global.h"
+#include "space/space.h"
+#include "solvers/precond.h"
+#include "solvers/linear_matrix_solver.h"
+#include "patch_schwarz_precond.h"
+#ifdef HAVE_EPETRA
+#include <Epetra_SerialComm.h>
+#include <Epetra_Map.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup userSolvingAPI
+    /// p-multigrid V-cycle preconditioner of the systems on hierarchical spaces (the H1 shapesets of Hermes are hierarchical).
+    ///
+    /// Every unknown gets the polynomial degree of its shape function (1 for the vertex functions, the edge and bubble
+    /// functions their degrees). In a hierarchical basis the space of degree p is spanned by the unknowns of
+    /// degree <= p, so the restriction is a truncation, the prolongation an injection and the Galerkin coarse matrix
+    /// the submatrix of these unknowns. The levels are the degrees present, the finer ones are smoothed by damped Jacobi (or set_schwarz_smoother()),
+    /// the coarsest one (p = 1 for H1) is solved directly (UMFPACK if available, the built-in KrylovSolver otherwise).
+    /// The V-cycle is symmetric, so it can precondition CG as well.
+    ///
+    /// Works on CSRMatrix (the matrices of SOLVER_KRYLOV), plugs into KrylovSolver::set_precond(Precond<Scalar>*).
+    /// The spaces are read in create(), so it can be created once and reused for the changing reference spaces of an adaptivity loop,
+    /// as long as the spaces passed (set_spaces()) are the ones of the system.
+    template<typename Scalar>
+    class HERMES_API PMultigridPrecond : public Hermes::Preconditioners::Precond<Scalar>, public Hermes::Mixins::Loggable
+    {
+    public:
+      PMultigridPrecond(const Space<Scalar>* space);
+      PMultigridPrecond(Hermes::vector<const Space<Scalar>*> spaces);
+      virtual ~PMultigridPrecond();
+
+      /// Spaces of the system (in the order of the DOF numbering).
+      void set_spaces(Hermes::vector<const Space<Scalar>*> spaces);
+
+      /// Jacobi sweeps before and after the coarse correction on every level (default 2).
+      void set_smoothing_steps(int steps);
+      /// Damping of the Jacobi smoother (default 0.6).
+      void set_damping(double damping);
+      /// The additive Schwarz smoother of the element or vertex patches (PatchSchwarzPrecond, the patches restricted
+      /// to the unknowns of every level) instead of the Jacobi one, more robust for high orders. Its damping should stay
+      /// below 2 / the maximum number of patches sharing an unknown (4 for the element patches of quads).
+      void set_schwarz_smoother(bool to_set = true, SchwarzPatchType patch_type = HERMES_ELEMENT_PATCHES, double damping = 0.4);
+
+      /// Builds the levels of the matrix (CSRMatrix).
+      virtual void create(Matrix<Scalar> *mat);
+      virtual void destroy();
+      /// Extracts the level matrices and factorizes the coarsest one.
+      virtual void compute();
+      /// One V-cycle with the zero initial guess.
+      virtual void apply(Scalar *r, Scalar *z);
+
+      /// Number of levels (including the finest one).
+      int get_num_levels() const;
+
+#ifdef HAVE_EPETRA
+      virtual Epetra_Operator *get_obj() { return this; }
+      virtual int ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const;
+      virtual const Epetra_Comm &Comm() const { return this->epetra_comm; }
+      virtual const Epetra_Map &OperatorDomainMap() const { return *this->epetra_map; }
+      virtual const Epetra_Map &OperatorRangeMap() const { return *this->epetra_map; }
+#endif
+
+    protected:
+      /// One level of the hierarchy.
+      struct Level
+      {
+        /// Polynomial degree of the level.
+        int degree;
+        /// Unknowns of the level, as indices of the next finer level (empty for the finest one).
+        std::vector<int> fine_indices;
+        /// The (sub)matrix, owned except for the finest level (the matrix passed to create()).
+        CSRMatrix<Scalar>* matrix;
+        /// Inverted diagonal of the matrix (the smoother).
+        Scalar* inv_diag;
+        /// The Schwarz smoother (set_schwarz_smoother()), NULL for the coarsest level.
+        PatchSchwarzPrecond<Scalar>* schwarz;
+        /// Right-hand side, solution and work vectors of the level.
+        Scalar *b, *x, *r, *w;
+      };
+
+      Hermes::vector<const Space<Scalar>*> spaces;
+      int smoothing_steps;
+      double damping;
+      bool schwarz_smoother;
+      SchwarzPatchType schwarz_patch_type;
+      double schwarz_damping;
+
+      CSRMatrix<Scalar>* matrix;
+      std::vector<Level> levels;
+
+      /// Direct solver of the coarsest level.
+      SparseMatrix<Scalar>* coarse_matrix;
+      Vector<Scalar>* coarse_rhs;
+      /// The array of coarse_rhs.
+      Scalar* coarse_rhs_values;
+      Hermes::Solvers::LinearMatrixSolver<Scalar>* coarse_solver;
+
+      /// Polynomial degree of the shape function of every unknown.
+      void calculate_dof_degrees(std::vector<int>& dof_degrees) const;
+      /// The levels (without their matrices) of the unknowns of the given degrees.
+      void create_levels(const std::vector<int>& dof_degrees);
+      /// The submatrix of the rows / columns with fine_to_coarse >= 0 (fine_to_coarse = their new indices).
+      static CSRMatrix<Scalar>* extract_submatrix(CSRMatrix<Scalar>* fine, const std::vector<int>& fine_to_coarse, int coarse_size);
+      void create_coarse_solver();
+      void free_levels();
+
+      /// x += damping * D^{-1} (b - A x), or x += B (b - A x) with the Schwarz smoother B, steps times.
+      void smooth(Level& level, int steps);
+      void v_cycle(unsigned int level_i);
+
+#ifdef HAVE_EPETRA
+      Epetra_SerialComm epetra_comm;
+      Epetra_Map* epetra_map;
+#endif
+    };
+  }
+}
+#endif
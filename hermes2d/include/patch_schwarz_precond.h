@@ -0,0 +1,115 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the additive Schwarz preconditioner of the element or vertex patches (class PatchSchwarzPrecond).
+
+#ifndef __H2D_PATCH_SCHWARZ_PRECOND_H
+#define __H2D_PATCH_SCHWARZ_PRECOND_H
+
+#include "global.h"
+#include "space/space.h"
+#include "solvers/precond.h"
+#ifdef HAVE_EPETRA
+#include <Epetra_SerialComm.h>
+#include <Epetra_Map.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// The patches of PatchSchwarzPrecond.
+    enum SchwarzPatchType
+    {
+      /// The unknowns of one element.
+      HERMES_ELEMENT_PATCHES,
+      /// The unknowns of all the elements sharing a vertex.
+      HERMES_VERTEX_PATCHES
+    };
+
+    /// @ingroup userSolvingAPI
+    /// Additive Schwarz preconditioner z = damping * sum_p R_p^T A_p^{-1} R_p r, A_p the dense submatrix of the unknowns
+    /// of the patch p (the element ones, or those of all the elements around a vertex - the assembly lists of the spaces).
+    /// For high orders the patch solves capture the coupling of the edge and bubble functions the point Jacobi or ILU(0) miss.
+    ///
+    /// The patch matrices are factorized once in compute() (in parallel), apply() solves the patches in parallel,
+    /// the patches are coloured so that no two of the same colour share an unknown and the sums need no synchronization.
+    ///
+    /// Works on CSRMatrix (the matrices of SOLVER_KRYLOV), plugs into KrylovSolver::set_precond(Precond<Scalar>*),
+    /// and is the smoother of PMultigridPrecond::set_schwarz_smoother().
+    template<typename Scalar>
+    class HERMES_API PatchSchwarzPrecond : public Hermes::Preconditioners::Precond<Scalar>, public Hermes::Mixins::Loggable
+    {
+    public:
+      PatchSchwarzPrecond(const Space<Scalar>* space, SchwarzPatchType patch_type = HERMES_ELEMENT_PATCHES);
+      PatchSchwarzPrecond(Hermes::vector<const Space<Scalar>*> spaces, SchwarzPatchType patch_type = HERMES_ELEMENT_PATCHES);
+      virtual ~PatchSchwarzPrecond();
+
+      /// Spaces of the system (in the order of the DOF numbering).
+      void set_spaces(Hermes::vector<const Space<Scalar>*> spaces);
+      void set_patch_type(SchwarzPatchType patch_type);
+      /// Damping of the sum of the patch corrections (default 1.0).
+      void set_damping(double damping);
+
+      /// Reads the patches of the spaces for the matrix (CSRMatrix).
+      virtual void create(Matrix<Scalar> *mat);
+      /// Uses the given patches (the unknowns of the matrix) instead of the ones of the spaces.
+      void create(CSRMatrix<Scalar>* mat, const std::vector<std::vector<int> >& patches);
+      virtual void destroy();
+      /// Extracts and factorizes the patch matrices.
+      virtual void compute();
+      virtual void apply(Scalar *r, Scalar *z);
+
+      int get_num_patches() const;
+      int get_num_colors() const;
+
+      /// The patches of the unknowns of the spaces (numbered one space after another).
+      static void calculate_patches(Hermes::vector<const Space<Scalar>*> spaces, SchwarzPatchType patch_type, std::vector<std::vector<int> >& patches);
+
+#ifdef HAVE_EPETRA
+      virtual Epetra_Operator *get_obj() { return this; }
+      virtual int ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const;
+      virtual const Epetra_Comm &Comm() const { return this->epetra_comm; }
+      virtual const Epetra_Map &OperatorDomainMap() const { return *this->epetra_map; }
+      virtual const Epetra_Map &OperatorRangeMap() const { return *this->epetra_map; }
+#endif
+
+    protected:
+      Hermes::vector<const Space<Scalar>*> spaces;
+      SchwarzPatchType patch_type;
+      double damping;
+
+      CSRMatrix<Scalar>* matrix;
+
+      /// The unknowns of the patches (sorted).
+      std::vector<std::vector<int> > patches;
+      /// The LU factors of the patch matrices (row-wise) and their row permutations.
+      std::vector<std::vector<Scalar> > factors;
+      std::vector<std::vector<int> > pivots;
+      /// The patches of the colours, color_offsets[c] .. color_offsets[c + 1] - 1 in color_patches.
+      std::vector<int> color_patches;
+      std::vector<int> color_offsets;
+      int max_patch_size;
+
+      void color();
+
+#ifdef HAVE_EPETRA
+      Epetra_SerialComm epetra_comm;
+      Epetra_Map* epetra_map;
+#endif
+    };
+  }
+}
+#endif
@@ -71,7 +71,7 @@ namespace Hermes
     ///&nbsp;return -1;<br>
     /// }<br>
     template<typename Scalar>
-    class HERMES_API PicardSolver : public Solvers::NonlinearSolver<Scalar>, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable
+    class HERMES_API PicardSolver : public Solvers::NonlinearSolver<Scalar>, public Hermes::Hermes2D::Mixins::SettableSpaces<Scalar>, public Hermes::Mixins::OutputAttachable, public Hermes::Hermes2D::Mixins::MatrixRhsOutput<Scalar>, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       PicardSolver();
@@ -84,6 +84,10 @@ namespace Hermes
       virtual bool isOkay() const;
       inline std::string getClassName() const { return "PicardSolver"; }
 
+      /// Memory accounting - the matrices and the vectors, reported after their assembling.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemoryMatrices; }
+
       /// Sets the attribute verbose_output for the inner Newton's loop to the paramater passed.
       void set_verbose_output_linear_solver(bool verbose_output_to_set);
 
@@ -122,12 +126,43 @@ namespace Hermes
       /// explanation of this parameter.
       void set_anderson_beta(double beta);
 
+      /// Turn on / off the reuse of the factorization of the matrix. By default it is off.
+      /// If on, every iteration solves A_old (u_{k+1} - u_k) = b(u_k) - A(u_k) u_k with the factorization of the last
+      /// factorized matrix A_old, as long as the norm of the residual b(u_k) - A(u_k) u_k decreases at least by the factor
+      /// stagnation_ratio per iteration. Otherwise (stagnation) A(u_k) is factorized, which is the plain Picard's iteration.
+      /// The matrix is still assembled in every iteration (for the residual), only the factorizations are saved.
+      void set_matrix_reuse(bool to_set, double stagnation_ratio = 0.9);
+
+      /// The number of the factorizations in the last solve() with set_matrix_reuse().
+      int get_num_factorizations() const;
+
       /// Set the weak forms.
       void set_weak_formulation(const WeakForm<Scalar>* wf);
     protected:
       void init();
-      
-      static void calculate_anderson_coeffs(Scalar** previous_vectors, Scalar* anderson_coeffs, int num_last_vectors_used, int ndof);
+
+      /// The Anderson least-squares problem min ||f_n - sum_i gamma_i (f_{i+1} - f_i)|| over the last residuals
+      /// f_i = p_{i+1} - p_i is kept as a QR factorization of the residual differences, which is updated by one column
+      /// per iteration (the oldest one deleted by Givens rotations) instead of solving the normal equations again.
+      /// Adds the newest residual.
+      void update_anderson_qr(const Scalar* residual, int ndof);
+      /// Deletes the first (oldest) column of the QR factorization.
+      void delete_anderson_qr_column(int ndof);
+      /// The Anderson coefficients of the last num_last_vectors_used - 1 residuals (summing up to one) from the QR factorization.
+      void calculate_anderson_coeffs(Scalar* anderson_coeffs, int ndof);
+      void free_anderson_qr();
+
+      /// The QR factorization, Q of num_last_vectors_used - 2 columns of length ndof, R upper triangular (row-major).
+      Scalar** anderson_Q;
+      Scalar* anderson_R;
+      int anderson_num_columns;
+      /// The newest residual and Q^H of it.
+      Scalar* anderson_last_residual;
+      bool anderson_have_last_residual;
+
+      bool matrix_reuse;
+      double matrix_reuse_stagnation_ratio;
+      int num_factorizations;
       
       bool verbose_output_linear_solver;
 
@@ -0,0 +1,52 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the on-disk cache of the precalculated tables (class PrecalculatedTables).
+
+#ifndef __H2D_PRECALCULATED_TABLES_H
+#define __H2D_PRECALCULATED_TABLES_H
+
+#include "global.h"
+
+/// Version of the format and of the contents of the tables, files of other versions are ignored (and overwritten).
+#define H2D_PRECALCULATED_TABLES_VERSION 1
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// The tables of doubles the library calculates at the start of every process (e.g. the Cholesky factors of the projection
+    /// matrices of CurvMap) stored in the directory Hermes2DApi precalculatedFormsDirPath, one file per table.
+    /// The files are mapped read-only (read on Windows) and stay mapped until the process ends, so the processes of a node
+    /// share the pages. A file is written to a temporary name first and renamed, a concurrent reader never sees a partial one.
+    /// An empty precalculatedFormsDirPath disables the cache.
+    class HERMES_API PrecalculatedTables
+    {
+    public:
+      /// The table name of count doubles calculated for key (e.g. the maximum order), NULL if it is not stored
+      /// (or it is of another version, key, or size).
+      static const double* load(const char* name, int key, size_t count);
+
+      /// Stores the table for the other processes. Failures (e.g. a read-only directory) only produce a warning, once.
+      static void store(const char* name, int key, size_t count, const double* data);
+
+    private:
+      /// precalculatedFormsDirPath with the trailing separator, empty if the cache is disabled.
+      static std::string get_directory();
+      static bool warning_issued;
+    };
+  }
+}
+#endif
@@ -33,6 +33,8 @@ namespace Hermes
       LocalProjection();
 
       // Main functionality.
+      // A Solution is projected element by element in parallel (Solution::transfer_to()), in the H1 norm
+      // for the H1 norm of a scalar space, in the L2 norm otherwise. Other MeshFunctions are interpolated in the vertices.
       static void project_local(const Space<Scalar>* space, MeshFunction<Scalar>* meshfn,
           Scalar* target_vec, ProjNormType proj_norm = HERMES_UNSET_NORM);
 
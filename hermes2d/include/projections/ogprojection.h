@@ -24,6 +24,8 @@ namespace Hermes
 {
   namespace Hermes2D
   {
+    template<typename Scalar> class LinearSolver;
+
     /** @defgroup projections Projections
     * \brief Projection classes for various kinds of projecting a MeshFunction onto a Space.
     */
@@ -35,6 +37,12 @@ namespace Hermes
     {
     public:
       OGProjection();
+      ~OGProjection();
+
+      /// The projections onto a space in a norm (project_global() with a MeshFunction or a Solution) keep the assembled and factorized
+      /// projection matrix, the following ones onto the same space (unchanged, see Space::get_seq()) and in the same norm
+      /// assemble only the right-hand side and back-substitute. On by default, false frees the kept matrices.
+      void set_cache_projection_matrices(bool to_set = true);
 
       /// Main functionality is in the protected method project_internal().
       
@@ -109,6 +117,37 @@ namespace Hermes
       /// PDE, the PDE will just be solved.
       void project_internal(const Space<Scalar>* space, WeakForm<Scalar>* proj_wf, Scalar* target_vec);
 
+      /// The L2 projection computed element by element, without a global solve, if the mass matrix of the space
+      /// is diagonal (see Space::get_diagonal_mass_matrix()) and source_meshfn is defined on the mesh of the space.
+      /// Returns false, target_vec untouched, otherwise.
+      bool project_local_l2(const Space<Scalar>* space, MeshFunction<Scalar>* source_meshfn, Scalar* target_vec);
+
+      /// The fields projected separately, each onto its own space with its own system, concurrently (the threads of
+      /// Hermes2DApi numThreads, each projection then assembled by one of them) - target_vec has all the fields' DOFs one after another.
+      void project_fields(const Hermes::vector<const Space<Scalar>*>& spaces, const Hermes::vector<MeshFunction<Scalar>*>& source_meshfns,
+          Scalar* target_vec, const Hermes::vector<ProjNormType>& proj_norms);
+
+      /// The kept projection system of one space and norm (see set_cache_projection_matrices()).
+      struct ProjectionCacheEntry
+      {
+        const Space<Scalar>* space;
+        int space_seq;
+        ProjNormType norm;
+        WeakForm<Scalar>* wf;
+        DiscreteProblemLinear<Scalar>* dp;
+        LinearSolver<Scalar>* linear_solver;
+      };
+
+      /// The kept system for this space and norm, created (or recreated if the space has changed) if necessary.
+      ProjectionCacheEntry* get_projection_cache_entry(const Space<Scalar>* space, ProjNormType norm);
+
+      static void free_projection_cache_entry(ProjectionCacheEntry* entry);
+      void free_projection_cache();
+
+      /// See set_cache_projection_matrices().
+      bool cache_projection_matrices;
+      Hermes::vector<ProjectionCacheEntry*> projection_cache;
+
       /// Jacobian matrix (same as stiffness matrix since projections are linear).
       class ProjectionMatrixFormVol : public MatrixFormVol<Scalar>
       {
@@ -31,8 +31,8 @@ namespace Hermes
     static int H2D_GIP1D_X = 0;
     static int H2D_GIP1D_W = 1;
 
-    const int g_max_quad = 24;
-    const int g_max_tri = 20;
+    const int g_max_quad = 30;
+    const int g_max_tri = 29;
 
     /// Quad1D is a base class for all 1D quadrature points.
     ///
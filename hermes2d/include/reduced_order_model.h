@@ -0,0 +1,131 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the POD-Galerkin reduced-order model of a discrete problem (class ReducedOrderModel).
+
+#ifndef __H2D_REDUCED_ORDER_MODEL_H
+#define __H2D_REDUCED_ORDER_MODEL_H
+
+#include "discrete_problem.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup userSolvingAPI
+    /// POD-Galerkin reduced-order model of a DiscreteProblem (the weak formulation in the Newton's form, as for NewtonSolver).
+    ///
+    /// Offline: the coefficient vectors of the solutions (snapshots) of some parameter variants are collected - after
+    /// NewtonSolver::solve(), or the Solutions of CalculationContinuity records (Record::load_solutions()) projected
+    /// onto the spaces. calculate_basis() computes the POD basis V, the leading left singular vectors of the snapshot matrix.
+    ///
+    /// Online: solve() runs the Newton's method for the reduced coordinates a of u = V a, with the reduced system
+    /// V^H J(u) V da = -V^H F(u), a dense system of the basis size. Without DEIM the full residual and Jacobian are
+    /// assembled in every iteration. With calculate_deim(), F is interpolated from its values in the DEIM DOFs,
+    /// F ~ U (P^T U)^-1 P^T F, U the POD basis of the residual snapshots - only the states of the base elements
+    /// with the DEIM DOFs in their elements are assembled (DiscreteProblem::set_subdomain()), neither DG forms nor
+    /// a subdomain of the DiscreteProblem itself may be used then.
+    /// Example:<br>
+    /// ReducedOrderModel<double> rom(&dp);<br>
+    /// for(each parameter) { set the parameter; newton.solve(); rom.add_snapshot(newton.get_sln_vector()); }<br>
+    /// rom.calculate_basis(1e-6);<br>
+    /// set a new parameter; rom.solve(); Solution<double>::vector_to_solution(rom.get_sln_vector(), &space, &sln);<br>
+    template<typename Scalar>
+    class HERMES_API ReducedOrderModel : public Hermes::Mixins::Loggable
+    {
+    public:
+      ReducedOrderModel(DiscreteProblem<Scalar>* dp);
+      virtual ~ReducedOrderModel();
+
+      /// Adds the coefficient vector of a solution on the spaces of the problem (copied).
+      void add_snapshot(const Scalar* coeff_vec);
+      /// Adds the projection of the solutions onto the spaces of the problem.
+      void add_snapshot(Hermes::vector<Solution<Scalar>*> slns);
+      int get_num_snapshots() const;
+
+      /// Adds a residual vector for the DEIM basis (copied).
+      void add_residual_snapshot(const Scalar* residual);
+      /// Adds the residual of the current weak formulation at coeff_vec for the DEIM basis,
+      /// e.g. at the snapshots with the weak formulations of the other parameter variants.
+      void add_residual_snapshot_at(const Scalar* coeff_vec);
+
+      /// POD basis of the snapshots: the smallest number of the leading singular vectors keeping the 1 - tolerance part
+      /// of the snapshot energy (the sum of the squared singular values), max_basis_size at most (-1 - no limit).
+      void calculate_basis(double tolerance = 1e-6, int max_basis_size = -1);
+      int get_basis_size() const;
+      /// The basis vector i (ndof entries).
+      const Scalar* get_basis_vector(int i) const;
+
+      /// DEIM of the residual: the POD basis U of the residual snapshots (as in calculate_basis()), the DEIM DOFs selected
+      /// greedily and the base elements to be assembled online. Needs calculate_basis() first.
+      void calculate_deim(double tolerance = 1e-6, int max_deim_size = -1);
+      /// Back to the assembling of the full residual.
+      void unset_deim();
+      /// The DEIM DOFs, empty without DEIM.
+      const std::vector<int>& get_deim_dofs() const;
+
+      /// Newton's method of the reduced problem.
+      void set_tolerance(double newton_tol);
+      void set_max_iter(int newton_max_iter);
+
+      /// Online solve.
+      /// \param[in] reduced_coeff_vec The reduced coordinates to start from (basis size entries), NULL - the last solution
+      /// (zero in the first solve).
+      void solve(Scalar* reduced_coeff_vec = NULL);
+
+      /// The solution of the last solve() on the spaces of the problem, V a.
+      Scalar* get_sln_vector();
+      /// The reduced coordinates a of the last solve().
+      const Scalar* get_reduced_sln_vector() const;
+      /// The number of Newton's iterations of the last solve().
+      int get_num_iters() const;
+
+    protected:
+      DiscreteProblem<Scalar>* dp;
+      int ndof;
+
+      std::vector<Scalar*> snapshots;
+      std::vector<Scalar*> residual_snapshots;
+
+      /// The POD basis V (columns).
+      std::vector<Scalar*> basis;
+
+      /// DEIM: the basis U, the DOFs P, V^H U (P^T U)^-1 [basis size x DEIM size] and the base element parts (1 - assembled).
+      std::vector<Scalar*> deim_basis;
+      std::vector<int> deim_dofs;
+      std::vector<Scalar> deim_projection;
+      std::vector<int> deim_base_element_parts;
+
+      double newton_tol;
+      int newton_max_iter;
+      int num_iters;
+
+      std::vector<Scalar> reduced_sln_vector;
+      Scalar* sln_vector;
+
+      SparseMatrix<Scalar>* jacobian;
+      Vector<Scalar>* residual;
+
+      void check_ndof() const;
+      /// The POD basis of the snapshots.
+      void calculate_pod(const std::vector<Scalar*>& snapshots, double tolerance, int max_size, std::vector<Scalar*>& pod_basis);
+      /// The base elements with the DEIM DOFs in their elements.
+      void calculate_deim_base_element_parts();
+
+      static void free_vectors(std::vector<Scalar*>& vectors);
+    };
+  }
+}
+#endif
@@ -0,0 +1,73 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the local matrices of the affine elements from the reference element matrices (class ReferenceMatrices).
+
+#ifndef __H2D_REFERENCE_MATRICES_H
+#define __H2D_REFERENCE_MATRICES_H
+
+#include "global.h"
+#include "shapeset/shapeset.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup inner
+    /// Reference element matrices of a scalar shapeset.
+    /// On an affine element with the constant inverse reference mapping M (grad u = M grad_ref u) and the jacobian |J|,
+    /// the local matrix of int mass * u * v + diffusion * grad(u) . grad(v) with constant coefficients is
+    /// |J| (mass * R + diffusion * (G_xx S_xx + G_xy S_xy + G_yy S_yy)), G = M^T M, where R, S_xx, S_xy and S_yy are the
+    /// mass and stiffness matrices of all the shape functions on the reference element - no quadrature per element.
+    class HERMES_API ReferenceMatrices
+    {
+    public:
+      /// The matrices of the shapeset on the mode, NULL for vector shapesets.
+      /// Integrated exactly (the shape functions are polynomials) once per shapeset id and mode.
+      static const ReferenceMatrices* get(Shapeset* shapeset, ElementMode2D mode);
+
+      /// True if all the indices are (non-constrained) shape functions of the tables.
+      bool has_indices(int cnt, int* idx) const;
+
+      /// Local matrix result[i][j] for the test functions test_idx[i] and the basis functions base_idx[j].
+      /// \param[in] inv_ref_map The constant inverse reference mapping of the element.
+      /// \param[in] jacobian The constant jacobian of the element.
+      template<typename Scalar>
+      void assemble(int n_test, int* test_idx, int n_base, int* base_idx, double2x2* inv_ref_map, double jacobian, Scalar mass, Scalar diffusion, Scalar** result) const;
+
+      /// The coefficients of the tables on an element: |J| mass, |J| diffusion G_xx, |J| diffusion G_xy, |J| diffusion G_yy.
+      template<typename Scalar>
+      static void get_coefficients(double2x2* inv_ref_map, double jacobian, Scalar mass, Scalar diffusion, Scalar* coefficients);
+
+      /// Local matrices of n_elements elements with the same shape function indices at once,
+      /// result[(i * n_base + j) * n_elements + element] - the elements are the innermost (vectorized) loop.
+      /// \param[in] c_mass, c_xx, c_xy, c_yy The coefficients of the elements (see get_coefficients()).
+      template<typename Scalar>
+      void assemble_batch(int n_elements, int n_test, int* test_idx, int n_base, int* base_idx,
+        const Scalar* c_mass, const Scalar* c_xx, const Scalar* c_xy, const Scalar* c_yy, Scalar* result) const;
+
+      /// Use get().
+      ReferenceMatrices();
+
+    private:
+      int num_indices;
+      /// [test index * num_indices + basis index]: int u v, int u_x v_x, int u_x v_y + u_y v_x, int u_y v_y.
+      std::vector<double> mass_matrix, stiffness_xx, stiffness_xy, stiffness_yy;
+
+      void calculate(Shapeset* shapeset, ElementMode2D mode);
+    };
+  }
+}
+#endif
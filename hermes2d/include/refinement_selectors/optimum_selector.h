@@ -358,6 +358,13 @@ namespace Hermes
         /// Destructor.
         virtual ~OptimumSelector();
       protected:
+        /// Copies the options and shares the table of numbers of shapes with a pooled clone.
+        /** Overriden function. For details, see Selector::update_clone(). */
+        virtual void update_clone(Selector<Scalar>* clone);
+
+        /// Deallocates a table of numbers of shapes (OptimumSelector::num_shapes).
+        static void delete_num_shapes(int**** num_shapes);
+
         /// Selects a refinement.
         /** Overriden function. For details, see Selector::select_refinement(). */
         virtual bool select_refinement(Element* element, int quad_order, Solution<Scalar>* rsln, ElementToRefine& refinement); ///< Selects refinement.
@@ -30,6 +30,8 @@ namespace Hermes
       *  The maximum allowed order is ::H2DRS_MAX_ORDER + 1. */
       typedef double CandElemProjError[H2DRS_MAX_ORDER + 2][H2DRS_MAX_ORDER + 2];
 
+#define H2DRS_ERR_NOT_NEEDED -1.0 ///< A marker of an entry of CandElemProjError that no candidate uses. Such an order is not projected at all. \internal \ingroup g_selectors
+
       /// A general projection-based selector. \ingroup g_selectors
       /** Calculates an error of a candidate as a combination of errors of
       *  elements of a candidate. Each element of a candidate is calculated
@@ -67,6 +69,11 @@ namespace Hermes
         double get_error_weight_p() const;
         double get_error_weight_aniso() const;
 
+        /// Precalculates shape values and LU-decomposed projection matrices of all orders the elements may need.
+        /** Overriden function. For details, see Selector::prepare_selection().
+        *  The precalculated data are shared read-only by clones returned by Selector::get_thread_selector(). */
+        virtual void prepare_selection(const Hermes::vector<Element*>& elements, const Hermes::vector<int>& quad_orders);
+
         /// Evaluated shapes for all possible transformations for all points. The first index is a transformation, the second index is an index of a shape function.
         typedef Hermes::vector<TrfShapeExp> TrfShape[H2D_TRF_NUM];
 
@@ -220,13 +227,39 @@ namespace Hermes
         /** Defines a cache of projection matrices for all possible permutations of orders. */
         typedef double** ProjMatrixCache[H2DRS_MAX_ORDER + 2][H2DRS_MAX_ORDER + 2];
 
-        /// An array of projection matrices.
+        /// A cache type of pivots of LU-decomposed projection matrices.
+        typedef int* ProjPivotCache[H2DRS_MAX_ORDER + 2][H2DRS_MAX_ORDER + 2];
+
+        /// An array of LU-decomposed projection matrices.
         /** The first index is the mode (see the enum ElementMode2D). The second and the third index
         *  is the horizontal and the vertical order respectively.
         *
-        *  All matrices are square dense matrices and they have to be created through the function new_matrix().
-        *  If record is NULL, the corresponding matrix has to be calculated. */
-        ProjMatrixCache proj_matrix_cache[H2D_NUM_MODES];
+        *  All matrices are square dense matrices decomposed by ludcmp() and they have to be created through the function new_matrix().
+        *  If record is NULL, the corresponding matrix has to be calculated. The array is owned by the original selector and shared by its clones. */
+        ProjMatrixCache* proj_matrix_cache;
+
+        /// Pivots of the matrices in ProjBasedSelector::proj_matrix_cache, indexed the same way.
+        /** A pivot array is always stored before the matrix it belongs to. */
+        ProjPivotCache* proj_pivot_cache;
+
+        /// Shares the caches and copies error weights to a pooled clone.
+        /** Overriden function. For details, see Selector::update_clone(). */
+        virtual void update_clone(Selector<Scalar>* clone);
+
+        /// Deallocates projection matrices and pivots stored in given caches.
+        static void delete_proj_caches(ProjMatrixCache* proj_matrix_cache, ProjPivotCache* proj_pivot_cache);
+
+        /// Calculates values of shape functions of the given mode if not done yet.
+        void ensure_shape_vals(ElementMode2D mode);
+
+        /// Fills shape indices used by a projection of given orders.
+        /** \param[in] max_num_shapes A size of the array  shape_inxs.
+        *  
+eturn A number of shape indices. */
+        int get_shape_inxs(ElementMode2D mode, int order_h, int order_v, int* shape_inxs, int max_num_shapes);
+
+        /// Builds, decomposes and stores a projection matrix of given orders if not done yet.
+        void build_projection_entry(ElementMode2D mode, int order_h, int order_v);
 
         /// An array of cached right-hand side values.
         /** The first index is an index of the shape function.
@@ -258,7 +291,8 @@ namespace Hermes
         *  \param[in] rsln A reference solution.
         *  \param[out] herr An error of elements of H-candidates of various permutation of orders.
         *  \param[out] perr An error of elements of P-candidates of various permutation of orders.
-        *  \param[out] anisoerr An error of elements of ANISO-candidates of various permutation of orders. */
+        *  \param[out] anisoerr An error of elements of ANISO-candidates of various permutation of orders.
+        *  Entries of \a herr, \a perr and \a anisoerr that are ::H2DRS_ERR_NOT_NEEDED on input are not used by any candidate and they are not calculated. */
         virtual void calc_projection_errors(Element* e, const typename OptimumSelector<Scalar>::CandsInfo& info_h, const typename OptimumSelector<Scalar>::CandsInfo& info_p, const typename OptimumSelector<Scalar>::CandsInfo& info_aniso, Solution<Scalar>* rsln, CandElemProjError herr[H2D_MAX_ELEMENT_SONS], CandElemProjError perr, CandElemProjError anisoerr[H2D_MAX_ELEMENT_SONS]);
 
         /// Calculate projection errors of an element of an candidate considering multiple orders.
@@ -275,7 +309,7 @@ namespace Hermes
         *  \param[in] sub_nonortho_svals
         *  \param[in] sub_ortho_svals
         *  \param[in] info Information about candidates: range of orders, etc.
-        *  \param[out] errors_squared Calculated squared errors for all orders specified through \a info. */
+        *  \param[in,out] errors_squared Calculated squared errors for all orders specified through \a info. Orders whose entry is ::H2DRS_ERR_NOT_NEEDED on input are skipped. */
         void calc_error_cand_element(const ElementMode2D mode, double3* gip_points, int num_gip_points, const int num_sub, Element** sub_domains, Trf** sub_trfs, Scalar*** sub_rvals, Hermes::vector<TrfShapeExp>** sub_nonortho_svals, Hermes::vector<TrfShapeExp>** sub_ortho_svals, const typename OptimumSelector<Scalar>::CandsInfo& info, CandElemProjError errors_squared);
 
       protected: //projection
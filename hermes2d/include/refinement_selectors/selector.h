@@ -76,9 +76,19 @@ namespace Hermes
       class HERMES_API Selector : public Hermes::Mixins::Loggable, public Hermes::Mixins::TimeMeasurable
       {
       public:
-        virtual ~Selector() {};
+        virtual ~Selector();
         /// Cloning for paralelism.
         virtual Selector<Scalar>* clone() = 0;
+
+        /// Returns the selector to be used by the thread thread_i.
+        /** The thread 0 uses this instance, other threads get a clone from a pool owned by this instance.
+        *  The clones are created on the first request and reused in subsequent adaptivity steps. */
+        Selector<Scalar>* get_thread_selector(unsigned int thread_i);
+
+        /// Precomputes data shared by all threads before the (parallel) selection of refinements.
+        /** \param[in] elements Elements that are going to be refined.
+        *  \param[in] quad_orders Encoded orders of the elements. */
+        virtual void prepare_selection(const Hermes::vector<Element*>& elements, const Hermes::vector<int>& quad_orders) {};
           /// Selects a refinement.
           /** This methods has to be implemented.
           *  \param[in] element An element which is being refined.
@@ -108,6 +118,12 @@ namespace Hermes
         /// Internal.
       protected:
         bool isAClone;
+
+        /// Copies the current settings and shared data of this instance to a pooled clone.
+        virtual void update_clone(Selector<Scalar>* clone) {};
+
+        /// Pool of clones used by other threads than the thread 0.
+        std::vector<Selector<Scalar>*> thread_selectors;
       };
 
       /// A selector that selects H-refinements only. \ingroup g_selectors
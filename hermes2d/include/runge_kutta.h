@@ -21,19 +21,16 @@
 #include "function/filter.h"
 #include "exceptions.h"
 #include "mixins2d.h"
+#include "jacobian_update_policy.h"
 namespace Hermes
 {
   namespace Hermes2D
   {
     // TODO LIST:
     //
-    // (1) With explicit and diagonally implicit methods, the matrix is treated
-    //     in the same way as with fully implicit ones. To make this more
-    //     efficient, with explicit and diagonally implicit methods one should
-    //     first only solve for the upper left block, then eliminate all blocks
-    //     under it, then solve for block at position 22, eliminate all blocks
-    //     under it, etc. Currently this is not done and everything is left to
-    //     the matrix solver.
+    // (1) Done: explicit and diagonally implicit methods solve the stages one
+    //     by one (rk_time_step_explicit(), rk_time_step_diagonally_implicit()),
+    //     only fully implicit ones assemble the num_stages x num_stages system.
     //
     // (2) In example 03-timedep-adapt-space-and-time with implicit Euler
     //     method, Newton's method takes much longer than in 01-timedep-adapt-space-only
@@ -54,9 +51,8 @@ namespace Hermes
     //     now, the sparsity structure is created expensively in each block
     //     again.
     //
-    // (5) If space does not change, the sparsity does not change. Right now
-    //     we discard everything at the end of every time step, we should not
-    //     do it.
+    // (5) Done: the stage spaces, the sparse structure and the mass matrix are
+    //     kept over the time steps until the spaces change.
     //
     // (6) If the problem does not depend explicitly on time, then all the blocks
     //     in the Jacobian matrix of the stationary residual are the same up
@@ -102,7 +98,11 @@ namespace Hermes
       // freeze_jacobian... if true then the Jacobian is not recalculated in each
       //                    iteration of the Newton's method.
       // block_diagonal_jacobian... if true then the tensor product block Jacobian is
-      //                            reduced to just the diagonal blocks.
+      //                            reduced to just the diagonal blocks (fully implicit tables only).
+      // With an explicit Butcher's table there is no Newton's method: the stages are evaluated one by one
+      // by residual assemblies and the (cached) inverse of the mass matrix, see rk_time_step_explicit().
+      // With a diagonally implicit table the stages are solved one after another by the Newton's method
+      // on systems of size ndof, see rk_time_step_diagonally_implicit().
       void rk_time_step_newton(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new, Hermes::vector<Solution<Scalar>*> error_fns);
       void rk_time_step_newton(Solution<Scalar>* slns_time_prev, Solution<Scalar>* slns_time_new, Solution<Scalar>* error_fn);
 
@@ -111,7 +111,16 @@ namespace Hermes
       void rk_time_step_newton(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new);
       void rk_time_step_newton(Solution<Scalar>* sln_time_prev, Solution<Scalar>* sln_time_new);
 
+      /// Zeroes the K vectors (the initial guess of the next time step) and forgets the kept Jacobian,
+      /// e.g. after the Newton's method failed (see TimeStepController).
+      void reset_K_vector();
+
       void set_freeze_jacobian();
+      /// Lagged Jacobian: the policy decides in every Newton iteration (of all time steps) whether the Jacobian is
+      /// reassembled, otherwise the last one is used again with its factorization. The time step of the policy is the one
+      /// of the method, whose change changes the Jacobian. Takes precedence over set_freeze_jacobian().
+      /// Not deleted by the instance, NULL switches it off.
+      void set_jacobian_update_policy(JacobianUpdatePolicy* policy);
       void set_newton_tol(double newton_tol);
       void set_newton_max_iter(int newton_max_iter);
       void set_newton_damping_coeff(double newton_damping_coeff);
@@ -160,6 +169,51 @@ namespace Hermes
       // Prepare u_ext_vec.
       void prepare_u_ext_vec();
 
+      /// The time step of an explicit method (ButcherTable::is_explicit()), no Newton's method and no stage system:
+      /// the stages one by one, K_i = M^{-1} F(t_i, Y_n + h sum_{j < i} a_ij K_j), by residual assemblies only.
+      void rk_time_step_explicit(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new);
+
+      /// Creates the spaces of the stage solutions of the coupled stage system and sets them to stage_dp_right,
+      /// unless the spaces have not changed since then (so that the sparse structure of stage_dp_right is kept).
+      void prepare_stage_spaces();
+      Hermes::vector<Space<Scalar>*> stage_spaces_vector;
+      /// The sequence numbers of the spaces stage_spaces_vector was created for.
+      Hermes::vector<unsigned int> stage_spaces_seqs;
+
+      /// Assembles the mass matrix matrix_left, unless the spaces have not changed since then.
+      void assemble_mass_matrix();
+      /// The sequence numbers of the spaces matrix_left was assembled for.
+      Hermes::vector<unsigned int> mass_matrix_seqs;
+
+      /// Prepares the inverse of the mass matrix for rk_time_step_explicit(), unless the spaces have not changed since then.
+      void prepare_explicit_mass();
+
+      /// The vector forms of wf for one stage of an explicit method, the previous time level is added to u_ext as in stage_wf_right.
+      WeakForm<Scalar> stage_wf_explicit;
+      DiscreteProblem<Scalar>* stage_dp_explicit;
+
+      /// The inverse of the mass matrix of the explicit methods: its diagonal (see Space::get_diagonal_mass_matrix()) if the matrix
+      /// is diagonal, otherwise matrix_left is factorized once by explicit_mass_solver and the factorization is reused.
+      double* explicit_mass_diag;
+      Vector<Scalar>* explicit_rhs;
+      LinearMatrixSolver<Scalar>* explicit_mass_solver;
+      /// The sequence numbers of the spaces the inverse of the mass matrix was prepared for.
+      Hermes::vector<unsigned int> explicit_mass_seqs;
+
+      /// The time step of a diagonally implicit method (ButcherTable::is_diagonally_implicit()): instead of the coupled
+      /// system of size num_stages*ndof, the stages are solved one by one, M K_i - F(t_i, Y_n + h sum_{j < i} a_ij K_j + h a_ii K_i) = 0,
+      /// by the Newton's method with the Jacobian M - h a_ii dF/dY. With set_freeze_jacobian() the factorization is reused
+      /// for the following stages of the time step as long as a_ii does not change (SDIRK), with a Jacobian update policy
+      /// also for the following time steps.
+      void rk_time_step_diagonally_implicit(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new);
+
+      /// The forms of wf for one stage of a diagonally implicit method, the matrix forms are scaled by -h a_ii.
+      WeakForm<Scalar> stage_wf_diagonally_implicit;
+      DiscreteProblem<Scalar>* stage_dp_diagonally_implicit;
+
+      /// The h a_ii the Jacobian in matrix_right (and its factorization) belongs to, negative if there is none.
+      double diagonally_implicit_jacobian_coeff;
+
       /// Matrix for the time derivative part of the equation (left-hand side).
       SparseMatrix<Scalar>* matrix_left;
 
@@ -203,6 +257,7 @@ namespace Hermes
 
       bool do_global_projections;
       bool freeze_jacobian;
+      JacobianUpdatePolicy* jacobian_update_policy;
       double newton_tol;
       int newton_max_iter;
       double newton_damping_coeff;
@@ -36,6 +36,9 @@ namespace Hermes
       /// Returns type of space
       SpaceType get_space_type() const;
 
+      /// Memory accounting - the private tables (the shared ones are accounted as a whole).
+      virtual MemoryCategory get_memory_category() const { return MemoryPrecalcShapesetTables; }
+
       /// \brief Constructs a standard (master) precalculated shapeset class.
       /// \param shapeset[in] Pointer to the shapeset to be precalculated.
       PrecalcShapeset(Shapeset* shapeset);
@@ -114,6 +117,30 @@ namespace Hermes
 
       virtual void precalculate(int order, int mask);
 
+      /// The values of the active shape function at the points of the order of g_quad_2d_std into node,
+      /// the tables of oldmask copied from cur_node.
+      void calculate_node(Node* node, int order, int mask, int oldmask);
+
+      /// The standard quadrature points of order mapped by the current transformation, x followed by y,
+      /// computed once per (order, mode, sub_idx) and shared by all the instances. Only for sub_idx <= H2D_MAX_IDX.
+      const double* get_transformed_points(int order);
+
+      /// The node of the active shape function and transformation shared by all the instances (and threads)
+      /// for the same shapeset, NULL if there is none containing the tables of mask.
+      Node* find_shared_node(int order, int mask);
+
+      /// Makes the freshly calculated node shared and returns it, or returns another one calculated
+      /// meanwhile by another thread (node is freed then), or returns node itself, private, if the shared
+      /// nodes would exceed the budget of the Api2D parameter precalcSharedCacheSize.
+      Node* share_node(int order, Node* node);
+
+      /// The shared nodes, they are marked by H2D_SHARED_NODE in their masks, never freed by the instances,
+      /// and kept until the last instance is destroyed (num_instances).
+      class SharedNodes;
+      static SharedNodes* shared_nodes;
+      static int num_instances;
+      static const int H2D_SHARED_NODE = 0x1000;
+
       void update_max_index();
 
       /// Forces a transform without using push_transform() etc.
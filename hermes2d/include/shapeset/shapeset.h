@@ -88,8 +88,21 @@ namespace Hermes
     public:
       ~Shapeset();
 
-      /// Shape-function function type. Internal.
-      typedef double (*shape_fn_t)(double, double);
+      /// The shape functions of one element mode as polynomials. Internal.
+      ///
+      /// The component c of the shape function index is the sum of coefs[k] * B_{i,j}(x, y),
+      /// k = start[c * num_indices + index], ..., start[c * num_indices + index + 1] - 1, with the degrees
+      /// i = degrees[k] >> 4, j = degrees[k] & 15. The basis B_{i,j} is P_i(x) P_j(y) (Legendre polynomials)
+      /// on quads and the orthogonal Dubiner basis L_i(x + (1 + y) / 2, (1 - y) / 2) P_j^{(2i+1,0)}(y)
+      /// (L_i the scaled Legendre polynomials, P_j^{(2i+1,0)} the Jacobi polynomials) on triangles.
+      /// The derivatives are those of the polynomials.
+      struct PolynomialTable
+      {
+        int num_indices;
+        const int* start;
+        const unsigned char* degrees;
+        const double* coefs;
+      };
 
       /// Returns the polynomial degree of the specified shape function.
       /// If on quads, it returns encoded orders. The orders has to be decoded through macros
@@ -118,6 +131,13 @@ namespace Hermes
       /// Returns space type.
       virtual SpaceType get_space_type() const = 0;
 
+      /// True if the shape functions of mode are L2-orthogonal on the reference element, i.e. each of them
+      /// is a single term of the orthogonal basis of PolynomialTable and no two of them share one.
+      bool is_orthogonal(ElementMode2D mode) const;
+
+      /// The squared L2 norm of the shape function index on the reference element, for is_orthogonal(mode).
+      double get_norm_squared(int index, ElementMode2D mode) const;
+
     protected:
       /// Returns a complete set of indices of bubble functions for an element of the given order.
       int* get_bubble_indices(int order, ElementMode2D mode) const;
@@ -133,6 +153,19 @@ namespace Hermes
       /// domain, component is 0 for Scalar shapesets and 0 or 1 for vector shapesets.
       double get_value(int n, int index, double x, double y, int component, ElementMode2D mode);
 
+      /// The values of the given shape function expansion at np points (x[i], y[i]) into out[i], the function
+      /// is looked up once for all the points.
+      void get_values(int n, int index, const double* x, const double* y, int np, double* out, int component, ElementMode2D mode);
+
+      /// The values of the shape functions indices[0], ..., indices[num_indices - 1] at np points,
+      /// the values of the function indices[j] go to out[j * np], ..., out[j * np + np - 1].
+      void get_values(int n, int num_indices, const int* indices, const double* x, const double* y, int np, double* out, int component, ElementMode2D mode);
+
+      /// The values get_value(n, index, x, y, component, mode) at all points of the order of g_quad_2d_std,
+      /// tabulated on the first call (for all shapesets with the same get_id()) and kept until exit, thread-safe.
+      /// NULL for the constrained functions (index < 0).
+      const double* get_tabulated_values(int n, int index, int order, int component, ElementMode2D mode);
+
       double get_fn_value (int index, double x, double y, int component, ElementMode2D mode);
       double get_dx_value (int index, double x, double y, int component, ElementMode2D mode);
       double get_dy_value (int index, double x, double y, int component, ElementMode2D mode);
@@ -146,7 +179,8 @@ namespace Hermes
       /// Returns shapeset identifier. Internal.
       virtual int get_id() const = 0;
 
-      shape_fn_t*** shape_table[6];
+      /// The shape functions on triangles and quads, NULL if the shapeset is not defined on the mode.
+      const PolynomialTable* polynomial_table[H2D_NUM_MODES];
 
       int**  vertex_indices;
       int*** edge_indices;
@@ -210,6 +244,8 @@ namespace Hermes
       template<typename Scalar> friend class RefinementSelectors::HcurlProjBasedSelector;
       template<typename Scalar> friend class RefinementSelectors::OptimumSelector;
       friend class PrecalcShapeset;
+      friend class TensorProductQuad;
+      friend class ReferenceMatrices;
       friend void check_leg_tri(Shapeset* shapeset);
       friend void check_gradleg_tri(Shapeset* shapeset);
       template<typename Scalar> friend class Form;
@@ -16,12 +16,7 @@
 #ifndef __H2D_SHAPESET_H1_QUAD_H
 #define __H2D_SHAPESET_H1_QUAD_H
 
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table[1];
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table_dx[1];
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table_dy[1];
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table_dxx[1];
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table_dxy[1];
-extern Shapeset::shape_fn_t* simple_quad_shape_fn_table_dyy[1];
+extern const Shapeset::PolynomialTable simple_quad_polynomials;
 
 extern int simple_quad_vertex_indices[H2D_MAX_NUMBER_VERTICES];
 extern int* simple_quad_edge_indices[H2D_MAX_NUMBER_EDGES];
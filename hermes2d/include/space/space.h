@@ -45,6 +45,13 @@ namespace Hermes
     template<typename Scalar> class HcurlSpace;
     template<typename Scalar> class HdivSpace;
 
+    /// Numbering of the DOFs of a Space, see Space::set_dof_ordering().
+    enum DofOrdering
+    {
+      HERMES_DOF_ORDERING_BY_TYPE, ///< The vertex functions, then the edge functions, then the bubble functions (default).
+      HERMES_DOF_ORDERING_HILBERT  ///< Element by element along the Hilbert curve (Mesh::get_active_elements_hilbert_order()).
+    };
+
     /** @defgroup spaces FEM Spaces
       * \brief Collection of classes that represent and specify FE spaces.
     */
@@ -102,7 +109,7 @@ namespace Hermes
     /// The handling of irregular meshes is desribed in H1Space and HcurlSpace.<br>
     ///
     template<typename Scalar>
-    class HERMES_API Space : public Hermes::Mixins::Loggable, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::XMLParsing
+    class HERMES_API Space : public Hermes::Mixins::Loggable, public Hermes::Hermes2D::Mixins::StateQueryable, public Hermes::Hermes2D::Mixins::XMLParsing, public Hermes::Hermes2D::Mixins::MemoryAccountable
     {
     public:
       Space();
@@ -115,6 +122,11 @@ namespace Hermes
       virtual bool isOkay() const;
       inline std::string getClassName() const { return "Space"; }
 
+      /// Memory accounting - the node and element tables and the assembly list cache.
+      /// Reported by assign_dofs() (together with the mesh), free() and when the assembly list cache is built.
+      virtual size_t get_memory_usage() const;
+      virtual MemoryCategory get_memory_category() const { return MemorySpaces; }
+
       /// Destructor.
       virtual ~Space();
 
@@ -186,8 +198,27 @@ namespace Hermes
       /// Loads a space from a file.
       static Space<Scalar>* load(const char *filename, Mesh* mesh, bool validate, EssentialBCs<Scalar>* essential_bcs = NULL, Shapeset* shapeset = NULL);
 
+      /// Saves this space into a binary snapshot: the element orders and the DOF numbering in flat arrays, see load_binary().
+      bool save_binary(const char *filename) const;
+
+      /// Loads a space saved by save_binary() on the same mesh (the same elements with the same ids, as after saving and
+      /// loading the mesh with the space). The DOF numbering is taken from the file, only the constraints and the Dirichlet
+      /// lifts are computed. If the node ids of the mesh differ, the DOFs of the loaded orders are assigned anew.
+      /// The essential BCs have to prescribe the same boundary markers as for the saved space.
+      static Space<Scalar>* load_binary(const char *filename, Mesh* mesh, EssentialBCs<Scalar>* essential_bcs = NULL, Shapeset* shapeset = NULL);
+
       /// Obtains an assembly list for the given element.
-      virtual void get_element_assembly_list(Element* e, AsmList<Scalar>* al, unsigned int first_dof = 0) const;
+      /// The lists of the active elements are taken from a cache in the space, built at the first call after assign_dofs().
+      void get_element_assembly_list(Element* e, AsmList<Scalar>* al, unsigned int first_dof = 0) const;
+
+      /// Obtains the cached assembly list of the given active element as three arrays (without a first_dof shift),
+      /// returns their length. The arrays are shared by all users of the space and valid until the next assign_dofs().
+      unsigned int get_element_assembly_list(Element* e, const int*& idx, const int*& dof, const Scalar*& coef) const;
+
+      /// If the L2 mass matrix of the space is diagonal (an L2 space of a shapeset orthogonal on the reference
+      /// element, see Shapeset::is_orthogonal(), on elements with constant jacobians), stores its diagonal
+      /// into diag[first_dof], ..., diag[first_dof + get_num_dofs() - 1] and returns true, otherwise returns false.
+      bool get_diagonal_mass_matrix(double* diag, unsigned int first_dof = 0) const;
 
       /// Copy from Space instance 'space'
       virtual void copy(const Space<Scalar>* space, Mesh* new_mesh);
@@ -198,7 +229,7 @@ namespace Hermes
       public:
         /// Constructor.
         /// \param[in] coarse_space The coarse (original) space.
-        /// \param[in] ref_mesh The refined mesh.
+        /// \param[in] ref_mesh The refined mesh, or a copy of the coarse mesh for a p-only reference (Mesh::ReferenceMeshCreator with refinement -1).
         /// \param[in] order_increase Increase of the polynomial order.
         ReferenceSpaceCreator(const Space<Scalar>* coarse_space, const Mesh* ref_mesh, unsigned int order_increase = 1);
 
@@ -209,6 +240,11 @@ namespace Hermes
         /// Methods that user calls to get the reference space pointer (has to be properly casted if necessary).
         virtual Space<Scalar>* create_ref_space(bool assign_dofs = true);
 
+        /// The created reference space keeps the DOF numbers of the reference space of the previous adaptivity step
+        /// where the two coincide (see Space::set_dof_numbering_template()), so that its matrices only change locally.
+        /// The previous reference space has to exist until the DOFs of the new one are assigned.
+        void set_previous_ref_space(const Space<Scalar>* previous_ref_space);
+
         /// Construction initialization.
       private:
         L2Space<Scalar>* init_construction_l2();
@@ -223,6 +259,7 @@ namespace Hermes
         const Space<Scalar>* coarse_space;
         const Mesh* ref_mesh;
         unsigned int order_increase;
+        const Space<Scalar>* previous_ref_space;
       };
 
       /// Sets element polynomial order. This version does not call assign_dofs() and is
@@ -240,6 +277,33 @@ namespace Hermes
       /// \brief Assings the degrees of freedom to all Spaces in the Hermes::vector.
       static int assign_dofs(Hermes::vector<Space<Scalar>*> spaces);
 
+      /// Sets the numbering of the DOFs done by assign_dofs() (and inherited by the copies and the reference spaces).
+      /// With HERMES_DOF_ORDERING_HILBERT the DOFs of neighboring elements are close to each other, that narrows
+      /// the band of the matrix (less fill-in of the direct solvers) and makes the assembly access the vectors locally.
+      /// The DOFs are then not grouped by their type, get_vertex_functions_count() etc. are still valid.
+      void set_dof_ordering(DofOrdering ordering);
+
+      /// The next assign_dofs() gives the basis functions this space shares with 'space' (a vertex, an edge or an element
+      /// with the same coordinates and the same number of DOFs) the DOF numbers they have in 'space', where possible.
+      /// Meant for the reference spaces of successive adaptivity steps, see ReferenceSpaceCreator::set_previous_ref_space().
+      void set_dof_numbering_template(const Space<Scalar>* space);
+
+      /// Transfers the coefficient vector coeff_vec of 'space' (e.g. the reference space of the previous adaptivity step) to this space:
+      /// the DOF blocks with the same geometry and the same number of DOFs (as matched by set_dof_numbering_template()) take over
+      /// the coefficients, the other DOFs are zero. Nothing is projected, meant for the initial guesses of the iterative solvers.
+      /// new_coeff_vec is written at the DOFs of this space (first_dof + i * stride, i < get_num_dofs()).
+      void transfer_coefficients(const Space<Scalar>* space, const Scalar* coeff_vec, Scalar* new_coeff_vec) const;
+
+      /// Releases the memory the space does not need for the current mesh: the spare capacity of the node and element
+      /// tables and the caches (the assembly lists and the BC points), which are rebuilt when needed. The tables stay as
+      /// long as the id ranges of the mesh, whose ids of the removed elements and nodes are reused by the later refinements.
+      /// Meant for long adaptive runs, e.g. after unrefining the mesh of a time step.
+      virtual void shrink_to_fit();
+
+      /// Moves the element and node data to the new ids of Mesh::defragment() of the mesh of this space (the element orders
+      /// are kept), assign_dofs() is needed then.
+      virtual void remap_ids(const std::vector<int>& element_ids, const std::vector<int>& node_ids);
+
       virtual Scalar* get_bc_projection(SurfPos* surf_pos, int order, EssentialBoundaryCondition<Scalar> *bc) = 0;
 
       static void update_essential_bc_values(Hermes::vector<Space<Scalar>*> spaces, double time);
@@ -300,6 +364,7 @@ namespace Hermes
 
       int default_tri_order, default_quad_order;
       int vertex_functions_count, edge_functions_count, bubble_functions_count;
+      DofOrdering dof_ordering;
       int first_dof, next_dof;
       int stride;
       int seq, mesh_seq;
@@ -364,6 +429,17 @@ namespace Hermes
       void update_orders_recurrent(Element* e, int order);
 
       virtual void reset_dof_assignment(); ///< Resets assignment of DOF to an unassigned state.
+      /// Renumbers the assigned DOFs element by element along the Hilbert curve (before the constraints are set up).
+      void reorder_dofs_hilbert();
+      /// Renumbers the assigned DOFs to match dof_numbering_template (before the constraints are set up).
+      void reorder_dofs_as_template();
+      /// The DOF blocks (vertex, edge, bubble) of the active elements by their geometry (the sorted coordinates of their vertices),
+      /// with their positions ((dof - first_dof) / stride) and numbers of DOFs.
+      void get_dof_blocks(std::map<std::vector<std::pair<double, double> >, std::pair<int, int> >& blocks) const;
+      /// Moves the DOF blocks (vertex, edge, bubble) to the positions new_positions[(dof - first_dof) / stride].
+      void apply_dof_positions(const std::vector<int>& new_positions);
+      /// See set_dof_numbering_template(), used by the next assign_dofs() only.
+      const Space<Scalar>* dof_numbering_template;
       virtual void assign_vertex_dofs() = 0;
       virtual void assign_edge_dofs() = 0;
       virtual void assign_bubble_dofs() = 0;
@@ -371,6 +447,21 @@ namespace Hermes
       virtual void get_vertex_assembly_list(Element* e, int iv, AsmList<Scalar>* al) const = 0;
       virtual void get_boundary_assembly_list_internal(Element* e, int surf_num, AsmList<Scalar>* al) const = 0;
       virtual void get_bubble_assembly_list(Element* e, AsmList<Scalar>* al) const;
+      /// Fills the assembly list of the element from the node and element tables (no cache, no first_dof shift).
+      virtual void get_element_assembly_list_internal(Element* e, AsmList<Scalar>* al) const;
+
+      /// Assembly lists of the active elements, flattened. The list of the element id is the range of
+      /// asmlist_cache_cnt[id] triples from asmlist_cache_start[id], asmlist_cache_cnt[id] is -1 for elements not cached.
+      mutable std::vector<int> asmlist_cache_start, asmlist_cache_cnt;
+      mutable std::vector<int> asmlist_cache_idx, asmlist_cache_dof;
+      mutable std::vector<Scalar> asmlist_cache_coef;
+      /// The seq the cache was built for, -1 if there is none.
+      mutable int asmlist_cache_seq;
+
+      /// Builds the assembly list cache if it is not up to date. Thread-safe.
+      void update_assembly_list_cache() const;
+      /// Drops the cache (the DOFs or the Dirichlet lifts change).
+      void invalidate_assembly_list_cache();
 
       double** proj_mat;
       double*  chol_p;
@@ -378,9 +469,24 @@ namespace Hermes
       /// Used for bc projection.
       Hermes::vector<void*> bc_data;
 
+      /// The Cholesky decomposed matrix of the edge functions from the vertex nv on, for the BC projections.
+      /// It only depends on the shapeset, one is shared by all spaces with the same shapeset id (kept until exit).
       void precalculate_projection_matrix(int nv, double**& mat, double*& p);
       void update_edge_bc(Element* e, SurfPos* surf_pos);
 
+      /// The points of a part of a boundary edge where the BC projections evaluate the essential BCs: its ends
+      /// (t = lo, hi) and the points of the highest order of Quad1DStd, in the reference edge coordinates of the base element.
+      struct BCEdgePoints
+      {
+        std::vector<double> x, y, n_x, n_y, t_x, t_y;
+      };
+      /// The points by the base element, edge and (lo, hi), kept as long as the mesh does not change, e.g. over time steps.
+      std::map<std::pair<std::pair<int, int>, std::pair<double, double> >, BCEdgePoints> bc_edge_points;
+      int bc_edge_points_mesh_seq;
+
+      /// The values of bc at the BCEdgePoints of surf_pos, the ends first. values has 2 + Quad1DStd::get_num_points(max order) items.
+      void get_bc_values(SurfPos* surf_pos, EssentialBoundaryCondition<Scalar>* bc, Scalar* values);
+
       /// Called by Space to update constraining relationships between shape functions due
       /// to hanging nodes in the mesh. As this is space-specific, this function is reimplemented
       /// in H1Space and HcurlSpace.
@@ -392,6 +498,30 @@ namespace Hermes
 
       void free_bc_data();
 
+      /// Fixed part of the file of save_binary(), followed by the arrays (each starting at a multiple of 8 bytes):
+      /// int element_vertices[4 * num_elements] (the vertex node ids, -1 for unused slots and the 4th one of triangles),
+      /// int element_data[4 * num_elements] (order, bdof, n, changed_in_last_adaptation),
+      /// int node_info[3 * num_nodes] (used + 2 * type, p1, p2), int node_data[2 * num_nodes] (dof, n),
+      /// int marker_offsets[num_essential_markers + 1], char marker_chars[num_marker_chars] (the boundary markers with essential BCs).
+      struct BinaryHeader
+      {
+        char magic[8];
+        int space_type;
+        int num_elements;
+        int num_nodes;
+        int first_dof, stride, next_dof, ndof;
+        int vertex_functions_count, edge_functions_count, bubble_functions_count;
+        int dof_ordering;
+        int num_essential_markers;
+        int num_marker_chars;
+      };
+
+      /// The user boundary markers of the mesh with an essential BC in this space, sorted.
+      void get_essential_markers(std::vector<std::string>& markers) const;
+
+      /// A space of the type, without element orders, for loading.
+      static Space<Scalar>* create_empty(SpaceType type, Mesh* mesh, Shapeset* shapeset);
+
       /// Internal. Used by DiscreteProblem to detect changes in the space.
       int get_seq() const;
       template<typename T> friend class OGProjection;
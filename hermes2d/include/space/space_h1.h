@@ -88,7 +88,7 @@ namespace Hermes
 			typename Space<Scalar>::BaseComponent* merge_baselists(typename Space<Scalar>::BaseComponent* l1, int n1, typename Space<Scalar>::BaseComponent* l2, int n2,
 				Node* edge, typename Space<Scalar>::BaseComponent*& edge_dofs, int& ncomponents);
 
-			void update_constrained_nodes(Element* e, EdgeInfo* ei0, EdgeInfo* ei1, EdgeInfo* ei2, EdgeInfo* ei3);
+			void update_constrained_nodes(Element* e, EdgeInfo* ei0, EdgeInfo* ei1, EdgeInfo* ei2, EdgeInfo* ei3, Hermes::vector<void*>& baselists);
 
 			virtual void update_constraints();
 
@@ -51,6 +51,10 @@ namespace Hermes
       /// One-dimensional function derivative integration order.
       Hermes::Ord derivative(Hermes::Ord x) const {return Hermes::Ord(2);};
 
+      /// Values and derivatives in n points at once (see Hermes1DFunction::values()), the intervals are found in the lookup table.
+      virtual void values(int n, const double* x, double* out) const;
+      virtual void derivatives(int n, const double* x, double* out) const;
+
       /// Plots the spline in format for Pylab (just pairs
       /// x-coordinate and value per line). The interval of definition
       /// of the spline will be extended by "extension" both to the left
@@ -60,17 +64,21 @@ namespace Hermes
       void plot(const char* filename, double extension, bool plot_derivative = false, int subdiv = 50) const;
 
     protected:
-      /// Uses a bisection method to locale interval where a given point lies.
-      /// Returns false if point lies outside.
+      /// Locates the interval where a given point lies - in the lookup table of uniform bins, or by bisection
+      /// before calculate_coeffs(). Returns false if point lies outside.
       bool find_interval(double x_in, int& m) const;
 
+      /// Value and derivative of the spline, including the extrapolation.
+      double evaluate_value(double x) const;
+      double evaluate_derivative(double x) const;
+
       /// Extrapolate the value of the spline outside of its interval of definition.
       double extrapolate_value(double point_end, double value_end, double derivative_end, double x_in) const;
       /// Grid points, ordered.
       Hermes::vector<double> points;
 
       /// Values at the grid points.
-      Hermes::vector<double> values;
+      Hermes::vector<double> point_values;
 
       /// Boundary conditions.
       double bc_left, bc_right;
@@ -94,6 +102,13 @@ namespace Hermes
       /// A set of four coefficients a, b, c, d for an elementary cubic spline.
       Hermes::vector<SplineCoeff> coeffs;
 
+      /// The lookup table of the intervals - the interval of the bin start for each of the uniform bins of the interval
+      /// of definition, the interval of a point is then searched for among the few intervals of its bin only.
+      /// Built by calculate_coeffs().
+      Hermes::vector<int> bin_intervals;
+      /// The number of the bins over the length of the interval of definition.
+      double bin_scale;
+
       /// Gets derivative at a point that lies in interval 'm'.
       double get_derivative_from_interval(double x_in, int m) const;
 
@@ -0,0 +1,65 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the sum-factorized evaluation of local matrices on quadrilaterals (class TensorProductQuad).
+
+#ifndef __H2D_TENSOR_PRODUCT_QUAD_H
+#define __H2D_TENSOR_PRODUCT_QUAD_H
+
+#include "global.h"
+#include "shapeset/shapeset.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// @ingroup inner
+    /// Sum factorization on quadrilaterals.
+    /// The quad functions of H1ShapesetJacobi and H1ShapesetOrtho are (signed) products l_a(x) * l_b(y) of the 1D Lobatto
+    /// functions and the quad rules of Quad2DStd are products of the 1D Gauss rules. Local matrices of mass and diffusion
+    /// type forms are then evaluated by 1D contractions - O(p^5) operations for the whole local matrix instead of O(p^6).
+    class HERMES_API TensorProductQuad
+    {
+    public:
+      /// The tensor-product structure of the quad functions of the shapeset, NULL if the shapeset does not have it.
+      /// The structure is detected numerically, once per shapeset id.
+      static const TensorProductQuad* get(Shapeset* shapeset);
+
+      /// True if all the indices are (non-constrained) shape functions with the tensor-product structure.
+      bool has_indices(int cnt, int* idx) const;
+
+      /// Local matrix result[i][j] = int mass * u_j * v_i + grad(u_j)^T diffusion grad(v_i) over the reference quad,
+      /// v_i = shape function test_idx[i], u_j = shape function base_idx[j], gradients in reference coordinates.
+      /// \param[in] order Order of the quadrature (the tensor-product rules of Quad2DStd).
+      /// \param[in] mass The coefficient in the 2D points (weights and jacobians included).
+      /// \param[in] diffusion The symmetric tensor (xx, xy, yy) in the 2D points - diffusion[3 * point + 0, 1, 2] (weights and jacobians included).
+      template<typename Scalar>
+      void assemble(int order, int n_test, int* test_idx, int n_base, int* base_idx, Scalar* mass, Scalar* diffusion, Scalar** result) const;
+
+      /// Use get().
+      TensorProductQuad();
+
+    private:
+      /// Shape function index = sign[index] * l_{x_index[index]}(x) * l_{y_index[index]}(y).
+      std::vector<int> x_index;
+      std::vector<int> y_index;
+      std::vector<double> sign;
+      bool tensor_product;
+
+      void detect(Shapeset* shapeset);
+    };
+  }
+}
+#endif
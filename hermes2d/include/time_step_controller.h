@@ -0,0 +1,115 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the step-size control of the Runge-Kutta methods with embedded Butcher's tables (class TimeStepController).
+
+#ifndef __H2D_TIME_STEP_CONTROLLER_H
+#define __H2D_TIME_STEP_CONTROLLER_H
+
+#include "runge_kutta.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// The step-size controllers of TimeStepController.
+    enum TimeStepControllerType
+    {
+      HERMES_I_CONTROLLER,    ///< Elementary (integrating) controller, h_{n+1} = h_n (tol / e_n)^(1/k).
+      HERMES_PI_CONTROLLER,   ///< PI.3.4 controller, also uses the error of the previous step.
+      HERMES_PID_CONTROLLER   ///< PID controller, also uses the errors of the previous two steps.
+    };
+
+    /// @ingroup userSolvingAPI
+    /// Adaptive time stepping of RungeKutta with an embedded Butcher's table (ButcherTable::is_embedded()).
+    ///
+    /// Every step is done by RungeKutta::rk_time_step_newton() with the temporal error estimate (the B2 row), the relative
+    /// error e_n = ||error|| / ||Y_{n+1}|| is compared to the tolerance. A rejected step (e_n > tol, or a failure of the
+    /// Newton's method) is repeated from the same previous solutions with a shorter step, nothing is reallocated:
+    /// the stage structures of RungeKutta, its mass matrix and the error functions are kept as long as the spaces do not change.
+    /// The next step is h_{n+1} = h_n * safety * (tol / e_n)^(beta1 / k) * (tol / e_{n-1})^(beta2 / k) * (tol / e_{n-2})^(beta3 / k),
+    /// limited by the factor and time step limits, where k = error_order + 1 and error_order is the order of the embedded (lower order) solution.
+    /// Example:<br>
+    /// TimeStepController<double> controller(&runge_kutta, 1e-3, 2);<br>
+    /// controller.set_time_step(1e-2);<br>
+    /// while(controller.get_time() < T) { controller.step(&sln_prev, &sln_new); sln_prev.copy(&sln_new); }<br>
+    template<typename Scalar>
+    class HERMES_API TimeStepController : public Hermes::Mixins::Loggable
+    {
+    public:
+      TimeStepController(RungeKutta<Scalar>* runge_kutta, double tolerance, int error_order, TimeStepControllerType type = HERMES_PI_CONTROLLER);
+      virtual ~TimeStepController();
+
+      /// The current time and the proposed length of the next step.
+      void set_time(double time);
+      void set_time_step(double time_step);
+
+      void set_tolerance(double tolerance);
+      /// Sets the exponents of the controller (instead of the ones of the type).
+      void set_betas(double beta1, double beta2, double beta3 = 0.0);
+      /// The safety factor (default 0.9) multiplying the step change.
+      void set_safety_factor(double safety_factor);
+      /// The minimum and maximum change of the time step in one step (default 0.2 and 5.0).
+      void set_factor_limits(double min_factor, double max_factor);
+      /// The minimum (default 0.0) and maximum (default none) time step.
+      void set_time_step_limits(double min_time_step, double max_time_step);
+      /// The number of rejections of one step after which the step fails (default 20).
+      void set_max_rejections(int max_rejections);
+
+      /// Performs one accepted time step from slns_time_prev (these are not changed) to slns_time_new,
+      /// repeating it with shorter steps while rejected. Returns the length of the accepted step,
+      /// get_time() is the time of slns_time_new then and get_time_step() the proposed next step.
+      double step(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new);
+      double step(Solution<Scalar>* sln_time_prev, Solution<Scalar>* sln_time_new);
+
+      double get_time() const;
+      double get_time_step() const;
+      /// The relative error estimate of the last accepted step.
+      double get_last_error() const;
+      /// The temporal error functions of the last accepted step.
+      Hermes::vector<Solution<Scalar>*> get_error_fns() const;
+
+      /// Statistics.
+      int get_num_accepted() const;
+      int get_num_rejected() const;
+
+    protected:
+      /// The change of the time step after a step with the error estimate err.
+      double step_factor(double err, bool after_rejection) const;
+
+      RungeKutta<Scalar>* runge_kutta;
+      double tolerance;
+      int error_order;
+
+      double beta1, beta2, beta3;
+      double safety_factor;
+      double min_factor, max_factor;
+      double min_time_step, max_time_step;
+      int max_rejections;
+
+      double time;
+      double time_step;
+
+      /// The errors of the previous two accepted steps (0.0 if none).
+      double last_error, last_but_one_error;
+
+      Hermes::vector<Solution<Scalar>*> error_fns;
+
+      int num_accepted;
+      int num_rejected;
+    };
+  }
+}
+#endif
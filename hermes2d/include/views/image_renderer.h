@@ -0,0 +1,103 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_IMAGE_RENDERER_H
+#define __H2D_IMAGE_RENDERER_H
+
+#include "../global.h"
+#include "linearizer.h"
+#include "view.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace Views
+    {
+      /// ImageRenderer draws a MeshFunction into an image file without any window, OpenGL context or
+      /// GLUT event loop - i.e. also in a Hermes built without GLUT (NOGLUT), on cluster nodes and in batch jobs.
+      /// The function is linearized by a Linearizer exactly as in ScalarView (2D mode), its triangles are
+      /// rasterized in software with the ScalarView palette (Gouraud shading of the values, no lighting),
+      /// optionally with the mesh edges. The image is saved as PNG or BMP, depending on the file name extension.
+      class HERMES_API ImageRenderer : public Hermes::Mixins::Loggable
+      {
+      public:
+        ImageRenderer(int width = 600, int height = 600);
+        ~ImageRenderer();
+
+        /// Set the size of the image in pixels.
+        void set_size(int width, int height);
+
+        void set_palette(ViewPaletteType type);
+        void set_num_palette_steps(int num);
+
+        /// Set the range of values mapped to the palette, the values outside it are clamped.
+        void set_min_max_range(double min, double max);
+
+        /// Map the range of the values of the function rendered into the palette (default).
+        void auto_min_max_range();
+
+        /// Draw the edges of the mesh (the element boundaries), off by default; the domain boundary is always drawn, as in ScalarView.
+        void show_mesh(bool show = true);
+
+        /// Set the background color, RGB in [0, 1]; white by default.
+        void set_background_color(float r, float g, float b);
+
+        /// Linearize and rasterize the function; the parameters as in ScalarView::show().
+        void render(MeshFunction<double>* sln, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL);
+
+        /// Save the image last rendered: PNG for a ".png" file name, BMP otherwise.
+        void save_image(const char* filename) const;
+
+        /// Render and save in one go.
+        void save_image(MeshFunction<double>* sln, const char* filename, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL);
+
+        /// The RGB pixels of the image last rendered, rows top to bottom, 3 bytes per pixel.
+        const unsigned char* get_pixels() const;
+
+        /// Get the Linearizer, e.g. for set_curvature_epsilon() or set_max_level().
+        Linearizer* get_linearizer();
+
+        /// Write RGB pixels (rows top to bottom) as a PNG file: zlib compressed when Hermes is built WITH_ZLIB,
+        /// stored (uncompressed) deflate blocks otherwise. Used by View::save_screenshot() as well.
+        static void save_png(const char* filename, const unsigned char* rgb, int width, int height);
+
+        /// Write RGB pixels (rows top to bottom) as a 24 bit BMP file.
+        static void save_bmp(const char* filename, const unsigned char* rgb, int width, int height);
+
+        /// True if the file name ends with ".png" (in any case).
+        static bool is_png_file_name(const char* filename);
+
+      protected:
+        /// Fills color with the palette color of x in [0, 1], see View::get_palette_color().
+        void get_palette_color(double x, unsigned char* color) const;
+
+        /// Rasterizes the triangles and edges of the linearizer into the rows [row_from, row_to) of the image.
+        void rasterize_rows(int row_from, int row_to, double scale, double offset_x, double offset_y, double min, double range);
+
+        Linearizer lin;
+        unsigned char* pixels;
+        int width, height;
+        ViewPaletteType pal_type;
+        int pal_steps;
+        bool range_auto;
+        double range_min, range_max;
+        bool show_edges;
+        unsigned char bg_color[3];
+      };
+    }
+  }
+}
+#endif
@@ -47,11 +47,45 @@ namespace Hermes
         /// \param[in] eps - tolerance parameter controlling how fine the resulting linearized approximation of the solution is.
         void process_solution(MeshFunction<double>* sln, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL);
 
+        /// Update the linearization for new values of a function on the same mesh, e.g. in the time steps of a transient problem.
+        /// If the mesh of sln is the one of the last process_solution() and unchanged (Mesh::get_seq()), the item is the same
+        /// and no displacement is set, the tessellation is kept: the values are re-evaluated in its vertices, and only the triangles
+        /// in which the new values violate eps (in the midpoints of their edges) are split, once per call; nothing is coarsened.
+        /// Otherwise (also for the second derivatives) this is process_solution().
+        void update_solution(MeshFunction<double>* sln, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL);
+
         /// Save a MeshFunction (Solution, Filter) in VTK format.
         void save_solution_vtk(MeshFunction<double>* sln, const char* filename, const char* quantity_name,
           bool mode_3D = true, int item = H2D_FN_VAL_0,
           double eps = HERMES_EPS_NORMAL);
 
+        /// Save MeshFunctions in the binary VTU (XML VTK) format, all of them in one file: the arrays are appended raw
+        /// (or zlib compressed, needs Hermes built WITH_ZLIB) after the XML header. The linearization is done for slns[0]
+        /// only, the other functions are evaluated (their item) in its vertices; without a displacement.
+        void save_solution_vtu(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<const char*> quantity_names,
+          const char* filename, bool mode_3D = true, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL, bool compress = false);
+
+        /// Save a MeshFunction in the binary VTU format, see above.
+        void save_solution_vtu(MeshFunction<double>* sln, const char* filename, const char* quantity_name,
+          bool mode_3D = true, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL, bool compress = false);
+
+        /// Save a MeshFunction in the binary VTU format piece by piece, for linearizations too large to be held at once.
+        /// The traversal states are linearized in batches of states_per_piece (each regularized on its own), each batch
+        /// written to a VTU piece file as soon as it is done and dropped: the pieces are "name_0.vtu", "name_1.vtu", ...
+        /// of the filename without its extension, filename itself is the parallel VTU (.pvtu) file referencing them.
+        /// The vertices on the boundaries of the pieces are duplicated. The instance is empty afterwards.
+        /// See also set_max_level() for a coarse level of detail.
+        void save_solution_vtu_pieces(MeshFunction<double>* sln, const char* filename, const char* quantity_name,
+          int states_per_piece = 100000, bool mode_3D = true, int item = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL,
+          bool compress = false);
+
+        /// Set the maximum level of the adaptive subdivision of an element, LIN_MAX_LEVEL by default. The lower, the coarser
+        /// and smaller the output may be; 0 gives one linear triangle per triangle and two per quad, e.g. for overviews.
+        void set_max_level(int max_level);
+
+        /// Get the maximum level of the adaptive subdivision of an element.
+        int get_max_level() const;
+
         /// Set the displacement, i.e. set two functions that will deform the domain for visualization, in the x-direction, and the y-direction.
         void set_displacement(MeshFunction<double>* xdisp, MeshFunction<double>* ydisp, double dmult = 1.0);
 
@@ -86,6 +120,9 @@ namespace Hermes
         /// The 'curvature' epsilon.
         double curvature_epsilon;
 
+        /// The maximum level of the subdivision of an element.
+        int max_level;
+
         /// Information if user-supplied displacement functions have been provided.
         bool user_xdisp, user_ydisp;
 
@@ -100,15 +137,76 @@ namespace Hermes
         /// What kind of information do we want to get out of the solution.
         int item, component, value_type;
 
-        int add_vertex();
-        int get_vertex(int p1, int p2, double x, double y, double value);
-
-        void process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+        /// The mesh, its seq and the item of the last process_solution(), for update_solution(); update_mesh is NULL
+        /// if the linearization can not be updated.
+        const Mesh* update_mesh;
+        unsigned int update_mesh_seq;
+        int update_item;
+
+        /// Adds a vertex with the parents p1, p2 to the vertices and the hash table of this instance (used by update_solution()).
+        int add_vertex(int p1, int p2, double x, double y, double value);
+
+        /// The vertices, triangles and edges one thread of process_solution() produces, without any locking;
+        /// merged into the arrays of this instance in the end (merge_thread_data()).
+        struct ThreadData
+        {
+          ThreadData();
+          ~ThreadData();
+
+          /// Allocates the arrays, the vertex_size rounded up to a power of two.
+          void init(int vertex_size, int triangle_size, int edges_size);
+
+          double3* verts;
+          int4* info;
+          int* hash_table;
+          /// Keys of the vertices the same in all the threads (from the ids of the mesh vertices and the keys of the parents).
+          uint64_t* keys;
+          int vertex_count, vertex_size;
+
+          int3* tris;
+          int* tri_markers;
+          int triangle_count, triangle_size;
+
+          int2* edges;
+          int* edge_markers;
+          int edges_count, edges_size;
+
+          /// The maximum absolute value the thread refines by.
+          double max;
+        };
+
+        int add_vertex(ThreadData* td);
+        int get_vertex(ThreadData* td, int p1, int p2, double x, double y, double value);
+
+        using LinearizerBase::peek_vertex;
+        using LinearizerBase::process_edge;
+        using LinearizerBase::add_edge;
+        using LinearizerBase::add_triangle;
+        int peek_vertex(ThreadData* td, int p1, int p2);
+        void process_edge(ThreadData* td, int iv1, int iv2, int marker);
+        void add_edge(ThreadData* td, int iv1, int iv2, int marker);
+        void add_triangle(ThreadData* td, int iv0, int iv1, int iv2, int marker);
+
+        /// Merges the vertices, triangles and edges of the threads into the arrays of this instance. The vertices
+        /// more threads created (on the edges between their elements) are found by their keys, coordinates and values
+        /// in parallel, and the hash table of the merged vertices is built for the regularization.
+        void merge_thread_data(ThreadData* thread_data, int num_threads);
+
+        void process_triangle(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
           double* val, double* phx, double* phy, int* indices, bool curved);
 
-        void process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+        void process_quad(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
           double* val, double* phx, double* phy, int* indices, bool curved);
 
+        /// Linearizes the (sub-)element of the traversal state the functions are set to, e is the element of the solution.
+        void process_state(ThreadData* td, MeshFunction<double>** fns, Element* e);
+
+        /// Removes the hanging vertices of the linearized mesh.
+        void regularize();
+
+        /// Saves the linearization of td as a VTU piece of save_solution_vtu_pieces(), td is empty afterwards.
+        void save_vtu_piece(ThreadData* td, const char* piece_file, const char* quantity_name, bool mode_3D, bool compress);
+
         void find_min_max();
 
         /// Internal.
@@ -134,10 +134,36 @@ namespace Hermes
 
         int hash(int p1, int p2);
 
+        /// The hash of a vertex with the parents p1, p2 in a hash table of vertex_size (a power of two) entries.
+        static int vertex_hash(int p1, int p2, int vertex_size);
+
+        /// The key of a vertex, the same in all the threads of a parallel linearization (from the id of the mesh vertex,
+        /// p1 == p2 == -id, or the keys of the parents), by which the vertices more threads created are merged.
+        static uint64_t vertex_key(const uint64_t* keys, int p1, int p2);
+
         mutable pthread_mutex_t data_mutex;
 
         Hermes::Exceptions::Exception* caughtException;
 
+        /// Point or cell data of a VTU file, num_components values per point (cell).
+        struct VtuField
+        {
+          std::string name;
+          int num_components;
+          bool cell_data;
+          std::vector<float> values;
+        };
+
+        /// Writes a binary VTU (XML VTK) file of an unstructured grid: the points (x, y, z triples), the cells
+        /// (cell_size point indices in connectivity each, all of the VTK type cell_type) and the fields. The arrays follow
+        /// the XML header in the appended section, raw or zlib compressed (needs Hermes built WITH_ZLIB), each written by one fwrite().
+        static void save_vtu(const char* filename, const std::vector<float>& points, int cell_size, int cell_type,
+          const std::vector<int>& connectivity, const std::vector<VtuField>& fields, bool compress);
+
+        /// Writes a parallel VTU (.pvtu) file of the pieces piece_files (VTU files written by save_vtu(), the names relative
+        /// to the directory of filename) with the fields (their values are not used).
+        static void save_pvtu(const char* filename, const std::vector<std::string>& piece_files, const std::vector<VtuField>& fields);
+
         /// Calculates AABB from an array of X-axis and Y-axis coordinates. The distance between values in the array is stride bytes.
         static void calc_aabb(double* x, double* y, int stride, int num, double* min_x, double* max_x, double* min_y, double* max_y);
         friend class MeshView;
@@ -0,0 +1,123 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_MULTI_LINEARIZER_H
+#define __H2D_MULTI_LINEARIZER_H
+
+#include "../global.h"
+#include "../function/solution.h"
+#include "linearizer_base.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace Views
+    {
+      /// MultiLinearizer is a Linearizer for several MeshFunctions at once (e.g. temperature, velocity magnitude
+      /// and pressure), sharing one adaptive tessellation. The union mesh of the functions is traversed once,
+      /// a (sub-)element is split if the linearization error of any of the functions (each relative to its own
+      /// maximum) is too large - or of one chosen master function only - and all the functions are evaluated
+      /// in the same vertices. Displacement is not supported.
+      class HERMES_API MultiLinearizer : public LinearizerBase
+      {
+      public:
+        MultiLinearizer();
+        ~MultiLinearizer();
+
+        /// The value of master in process_solutions(): all the functions drive the refinement.
+        static const int ALL_FIELDS = -1;
+
+        /// Main method - processes the functions and stores the data obtained by the process.
+        /// \param[in] slns the functions.
+        /// \param[in] items what item (function value, derivative wrt. x, ..) to use in each of the functions,
+        /// empty for H2D_FN_VAL_0 of all of them.
+        /// \param[in] eps - tolerance parameter controlling how fine the resulting linearized approximation is.
+        /// \param[in] master index of the function whose error drives the refinement, ALL_FIELDS for all the functions.
+        void process_solutions(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<int> items = Hermes::vector<int>(),
+          double eps = HERMES_EPS_NORMAL, int master = ALL_FIELDS);
+
+        /// Save the functions in the binary VTU (XML VTK) format, one point field each, see Linearizer::save_solution_vtu().
+        void save_solutions_vtu(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<const char*> quantity_names,
+          const char* filename, Hermes::vector<int> items = Hermes::vector<int>(), double eps = HERMES_EPS_NORMAL,
+          int master = ALL_FIELDS, bool compress = false);
+
+        /// Get the number of the functions processed.
+        int get_num_fields() const;
+
+        /// Get the number of vertices of this instance.
+        int get_num_vertices();
+
+        /// Get the vertices of this instance, (x, y) pairs.
+        double2* get_vertices();
+
+        /// Get the values in the vertices, get_num_fields() per vertex: the value of the function field in the vertex i
+        /// is get_values()[i * get_num_fields() + field].
+        double* get_values();
+
+        using LinearizerBase::get_min_value;
+        using LinearizerBase::get_max_value;
+
+        /// Get the minimum and the maximum of one of the functions in the vertices.
+        double get_min_value(int field) const;
+        double get_max_value(int field) const;
+
+        /// Set the threshold for how fine the output for curved elements, see Linearizer::set_curvature_epsilon().
+        void set_curvature_epsilon(double curvature_epsilon);
+
+        /// Get the 'curvature' epsilon determining the tolerance of catching the shape of curved elements.
+        double get_curvature_epsilon();
+
+        /// Free the instance.
+        void free();
+
+      protected:
+        /// The 'curvature' epsilon.
+        double curvature_epsilon;
+
+        double2* verts;  ///< vertices: (x, y) pairs
+        double* values;  ///< values in the vertices, num_fields per vertex
+
+        int num_fields;
+        /// The function the refinement is driven by, ALL_FIELDS for all of them.
+        int master;
+
+        /// What kind of information do we want to get out of the functions.
+        std::vector<int> items, components, value_types;
+
+        /// The maxima of the absolute values the errors are relative to, and the ranges in the vertices.
+        std::vector<double> field_max, field_min_val, field_max_val;
+
+        int add_vertex();
+        int get_vertex(int p1, int p2, double x, double y, const double* value);
+
+        /// Whether the error of the function field drives the refinement.
+        bool drives_refinement(int field) const;
+
+        void process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+          double** val, double* phx, double* phy, int* indices, bool curved);
+
+        void process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+          double** val, double* phx, double* phy, int* indices, bool curved);
+
+        void find_min_max();
+
+        void push_transforms(MeshFunction<double>** fns, int transform);
+        void pop_transforms(MeshFunction<double>** fns);
+      };
+    }
+  }
+}
+#endif
@@ -44,6 +44,21 @@ namespace Hermes
         template<typename Scalar>
         void save_mesh_vtk(const Space<Scalar>* space, const char* file_name);
 
+        /// Saves the element orders in the binary VTU (XML VTK) format, the arrays appended raw or zlib compressed
+        /// (needs Hermes built WITH_ZLIB).
+        template<typename Scalar>
+        void save_orders_vtu(const Space<Scalar>* space, const char* file_name, bool compress = false);
+
+        /// Saves the edges of the mesh in the binary VTU format.
+        template<typename Scalar>
+        void save_mesh_vtu(const Space<Scalar>* space, const char* file_name, bool compress = false);
+
+        /// Saves the orders of the active elements in a compact binary file, without the tessellation:
+        /// the number n of the elements, the element ids (n ints) and the horizontal and vertical orders
+        /// (2n ints, the pairs of the elements; both are the order for triangles), in the native byte order.
+        template<typename Scalar>
+        static void save_orders_binary(const Space<Scalar>* space, const char* file_name);
+
         int get_labels(int*& lvert, char**& ltext, double2*& lbox) const;
 
         void calc_vertices_aabb(double* min_x, double* max_x,
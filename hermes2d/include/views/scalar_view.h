@@ -56,6 +56,10 @@ namespace Hermes
 
         void show_linearizer_data(double eps = HERMES_EPS_NORMAL, int item = H2D_FN_VAL_0);
 
+        /// If enabled, show() of a function on the unchanged mesh of the previous show() keeps the tessellation and only
+        /// re-evaluates (and locally refines) it, see Linearizer::update_solution(); for time-dependent display. Off by default.
+        inline void set_incremental_linearization(bool enable = true) { incremental_linearization = enable; }
+
         inline void show_mesh(bool show = true) { show_edges = show; refresh(); }
         inline void show_bounding_box(bool show = true) { show_aabb = show; refresh(); }
         void show_contours(double step, double orig = 0.0);
@@ -119,7 +123,6 @@ namespace Hermes
         void draw_element_infos_2d(); ///< Draws elements infos in 2D mode.
 
       protected: //values
-#define H2DV_GL_MAX_EDGE_BUFFER 128 ///< A maximum number of pairs per a buffer.
 #pragma pack(push)
 #pragma pack(1)
         struct GLVertex2 ///< OpenGL vertex. Used to cache vertices prior rendering
@@ -136,16 +139,26 @@ namespace Hermes
 
         unsigned int gl_coord_buffer; ///< Vertex coordinate buffer. (x, y, t)
         unsigned int gl_index_buffer; ///< Index data buffer.
-        unsigned int gl_edge_inx_buffer; ///< A buffer for edge indices. The side of the buffer is H2DV_GL_MAX_EDGE_BUFFER pairs of indids.
+        unsigned int gl_edge_inx_buffer; ///< Edge index buffer, pairs of indices: the edges with a nonzero marker first, then the rest.
+        int gl_edge_cnt; ///< A number of edges in the edge index buffer.
+        int gl_marked_edge_cnt; ///< A number of edges with a nonzero marker, i.e. the ones drawn if show_edges is false.
+        unsigned int gl_contour_buffer; ///< Buffer of the contour lines, pairs of (x, y) endpoints.
+        int gl_contour_vert_cnt; ///< A number of endpoints in the contour buffer (or contour_lines).
+        bool gl_contours_valid; ///< true if the contour lines are up to date with lin, cont_step and cont_orig.
+        double gl_cont_orig, gl_cont_step; ///< The contour settings the contour lines were calculated for.
+        std::vector<float> contour_lines; ///< The contour lines in the host memory, used if the contour buffer can not be allocated.
         int max_gl_verts; ///< A maximum allocated number of vertices
         int max_gl_tris; ///< A maximum allocated number of triangles
         int gl_tri_cnt; ///< A number of OpenGL triangles
 
         bool show_values; ///< true to show values
+        bool incremental_linearization; ///< true to update the linearization in show() if possible, see set_incremental_linearization()
 
         void prepare_gl_geometry(); ///< prepares geometry in a form compatible with GL arrays; Data are updated if lin is updated. In a case of a failure (out of memory), gl_verts is NULL and an old OpenGL rendering method has to be used.
         void draw_values_2d(); ///< draws values
         void draw_edges_2d(); ///< draws edges
+        void prepare_gl_contours(); ///< Calculates the contour lines and uploads them if lin or the contour settings changed since the last call.
+        void draw_contours_2d(); ///< draws contours
 
         void draw_normals_3d(); ////< Draws normals of the 3d mesh. Used for debugging purposses only.
 
@@ -198,7 +211,7 @@ namespace Hermes
         double calculate_ztrans_to_fit_view(); ///< Calculates the z-coordinate (in eye coordinates) of the closest viewpoint from which we can still see the whole model. Assumes a model/view matrix to be the current matrix on the OpenGL stack.
         virtual void update_layout(); ///< Updates layout, i.e., centers 2d and 3d mesh.
 
-        void draw_tri_contours(double3* vert, int3* tri);
+        void calc_tri_contours(double3* vert, int3* tri, std::vector<float>& lines); ///< Appends the contour line endpoints of the triangle to lines.
         void calculate_normals(double3* verts, int num_verts, int3* tris, int num_tris); ///< Initializes normals.
         void init_lighting();
         void update_mesh_info(); ///< Updates mesh info. Assumes that data lock is locked.
@@ -225,6 +238,8 @@ class HERMES_API ScalarView : public View
 
         void show_linearizer_data(double eps = HERMES_EPS_NORMAL, int item = H2D_FN_VAL_0) { throw Hermes::Exceptions::Exception("GLUT disabled."); }
 
+        inline void set_incremental_linearization(bool enable = true) { throw Hermes::Exceptions::Exception("GLUT disabled."); }
+
         inline void show_mesh(bool show = true) { throw Hermes::Exceptions::Exception("GLUT disabled."); }
         inline void show_bounding_box(bool show = true) { throw Hermes::Exceptions::Exception("GLUT disabled."); }
         void show_contours(double step, double orig = 0.0) { throw Hermes::Exceptions::Exception("GLUT disabled."); }
@@ -55,15 +55,6 @@ namespace Hermes
 
       protected:
 
-        struct Node
-        {
-          bool leaf;
-          int level;
-          Node* sons[2];
-          int elements[100];
-          int num_elem;
-        };
-
         Vectorizer* vec;
         double max_mag;
         bool lines, pmode;
@@ -74,34 +65,42 @@ namespace Hermes
         int num_stream;
         double2** streamlines;
         int* streamlength;
-        Node* root;
         double root_x_min;
         double root_x_max;
         double root_y_min;
         double root_y_max;
 
-        /// Recurent function that finds linearized triangle which contain point (x, y).
+        /// The mesh of the x-component the linearized triangles are located by (its spatial index,
+        /// see Mesh::get_element_locator()), and its sequence number when the triangles were assigned.
+        const Mesh* mesh;
+        unsigned mesh_seq;
+        /// The linearized triangles of the mesh element e are element_triangles[element_triangle_starts[e->id]], ...,
+        /// element_triangles[element_triangle_starts[e->id + 1] - 1]; triangle_elements[i] is the element id of the triangle i.
+        std::vector<int> triangle_elements;
+        std::vector<int> element_triangle_starts;
+        std::vector<int> element_triangles;
+        /// The triangles not assigned to an element (their centers are outside of the curved elements).
+        std::vector<int> unassigned_triangles;
+
+        /// Assigns the linearized triangles to the elements of the mesh.
+        void build_triangle_index(const Mesh* mesh);
+
+        /// Finds the linearized triangle which contains point (x, y), -1 if there is none.
+        /// The triangle hint (of the previous point, -1 if none) and the triangles of its element are tried first,
+        /// then the element of the point is looked up in the spatial index of the mesh; hint is updated.
         /// As side effect it returns bacycentric coordinates of point (x, y) in that triangle.
-        int find_triangle_in_tree(double x, double y, Node* father, double x_min, double x_max, double y_min, double y_max, double3& bar);
-
-        /// Adds triangle to the kD-tree.
-        /// If father Node has more than 100 elements
-        /// it splits computation domain into 2 parts (vertically or horizontally).
-        void add_element_to_tree(Node* father, int e_idx, double x_min, double x_max, double y_min, double y_max);
-
-        /// Builds kD-tree.
-        void build_tree();
-        void delete_tree(Node* father);
+        int find_triangle(double x, double y, int& hint, double3& bar);
 
         /// Tests whether given point (x, y) lies in given triangle
         /// using barycentric coordinates (returned as side efect).
         bool is_in_triangle(int idx, double x, double y, double3& bar);
 
-        /// Gets values of velocities at given point using built kD-tree.
-        bool get_solution_values(double x, double y, double& xval, double& yval);
+        /// Gets values of velocities at given point, see find_triangle().
+        bool get_solution_values(double x, double y, int& hint, double& xval, double& yval);
 
         /// Starts from initial point (x_start, y_start)
         /// and using adaptive RK method finds streamline with "idx".
+        /// The streamlines are independent, more of them can be created at once by more threads.
         int create_streamline(double x_start, double y_start, int idx);
 
         /// Finds initial points for all steamlines along boundary with given marker
@@ -46,7 +46,7 @@ namespace Hermes
         void show(MeshFunction<double>* vsln, double eps = HERMES_EPS_NORMAL);
         void show(MeshFunction<double>* xsln, MeshFunction<double>* ysln, double eps = HERMES_EPS_NORMAL, int xitem = H2D_FN_VAL_0, int yitem = H2D_FN_VAL_0, MeshFunction<double>* xdisp = NULL, MeshFunction<double>* ydisp = NULL, double dmult = 1.0);
 
-        inline void set_grid_type(bool hexa) { this->hexa = hexa; refresh(); };
+        inline void set_grid_type(bool hexa) { this->hexa = hexa; arrows_valid = false; refresh(); };
         void set_mode(int mode);
       
         /// Returns the internal vectorizer for the purpose of parameter settings.
@@ -62,6 +62,16 @@ namespace Hermes
         bool lines, pmode;
         double length_coef; ///< for extending or shortening arrows
 
+        /// The arrows of the grid (x, y, xval, yval per arrow, in screen coordinates), sampled once and redrawn
+        /// every frame until the linearization, the grid or the view transformation change.
+        std::vector<double> arrows;
+        bool arrows_valid;
+        /// The grid and view parameters the arrows were sampled with.
+        double arrows_key[11];
+
+        /// Samples the vectors at the grid points, using the linearized triangles to locate the points.
+        void calculate_arrows(double4* vert, double2* tvert, int3* xtris, int num_triangles);
+
         void plot_arrow(double x, double y, double xval, double yval, double max, double min, double gs);
 
         virtual void on_display();
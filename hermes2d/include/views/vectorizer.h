@@ -44,6 +44,11 @@ namespace Hermes
         /// \param[in] eps - tolerance parameter controlling how fine the resulting linearized approximation of the solution is.
         void process_solution(MeshFunction<double>* xsln, MeshFunction<double>* ysln, int xitem = H2D_FN_VAL_0, int yitem = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL);
 
+        /// Saves the vector field (xsln, ysln) in the binary VTU (XML VTK) format, as a 3-component point field (the last
+        /// one zero); the arrays appended raw or zlib compressed (needs Hermes built WITH_ZLIB).
+        void save_solution_vtu(MeshFunction<double>* xsln, MeshFunction<double>* ysln, const char* filename, const char* quantity_name,
+          int xitem = H2D_FN_VAL_0, int yitem = H2D_FN_VAL_0, double eps = HERMES_EPS_NORMAL, bool compress = false);
+
         /// Set the displacement, i.e. set two functions that will deform the domain for visualization, in the x-direction, and the y-direction.
         void set_displacement(MeshFunction<double>* xdisp, MeshFunction<double>* ydisp, double dmult = 1.0);
 
@@ -93,17 +98,57 @@ namespace Hermes
         int dashes_count; ///< Real numbers of vertices, triangles and edges, dashes
         int dashes_size; ///< Size of arrays of vertices, triangles and edges, dashes
 
-        int get_vertex(int p1, int p2, double x, double y, double xvalue, double yvalue);
-        void process_dash(int iv1, int iv2);
+        /// The vertices, triangles and edges one thread of process_solution() produces, without any locking;
+        /// merged into the arrays of this instance in the end (merge_thread_data()), see Linearizer.
+        struct ThreadData
+        {
+          ThreadData();
+          ~ThreadData();
+
+          /// Allocates the arrays, the vertex_size rounded up to a power of two.
+          void init(int vertex_size, int triangle_size, int edges_size);
+
+          double4* verts;
+          int4* info;
+          int* hash_table;
+          /// Keys of the vertices the same in all the threads, see LinearizerBase::vertex_key().
+          uint64_t* keys;
+          int vertex_count, vertex_size;
+
+          int3* tris;
+          int* tri_markers;
+          int triangle_count, triangle_size;
+
+          int2* edges;
+          int* edge_markers;
+          int edges_count, edges_size;
+
+          /// The maximum magnitude the thread refines by.
+          double max;
+        };
+
+        int get_vertex(ThreadData* td, int p1, int p2, double x, double y, double xvalue, double yvalue);
+        int add_vertex(ThreadData* td);
+
+        using LinearizerBase::peek_vertex;
+        using LinearizerBase::process_edge;
+        using LinearizerBase::add_triangle;
+        int peek_vertex(ThreadData* td, int p1, int p2);
+        void process_edge(ThreadData* td, int iv1, int iv2, int marker);
+        void add_triangle(ThreadData* td, int iv0, int iv1, int iv2, int marker);
+
+        /// Merges the vertices, triangles and edges of the threads into the arrays of this instance; the vertices more threads
+        /// created are found by their keys and coordinates, the hash table of the merged vertices is built for the regularization.
+        void merge_thread_data(ThreadData* thread_data, int num_threads);
 
-        int add_vertex();
+        void process_dash(int iv1, int iv2);
 
         void add_dash(int iv1, int iv2);
 
-        void process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+        void process_triangle(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
           double* xval, double* yval, double* phx, double* phy, int* indices, bool curved);
 
-        void process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+        void process_quad(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
           double* xval, double* yval, double* phx, double* phy, int* indices, bool curved);
 
         void find_min_max();
@@ -107,7 +107,8 @@ namespace Hermes
         void set_scale_format(const char* fmt);
         void fix_scale_width(int width = 80);
 
-        /// Saves the current content of the window to a .BMP file.
+        /// Saves the current content of the window to a .BMP file, or a PNG file if the name ends with ".png".
+        /// Without a window (batch jobs, NOGLUT builds) see ImageRenderer.
         /// If 'high_quality' is true, an anti-aliased frame is rendered and saved.
         void save_screenshot(const char* bmpname, bool high_quality = false);
         /// Like save_screenshot(), but forms the file name in printf-style using the 'number'
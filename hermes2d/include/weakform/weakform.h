@@ -17,6 +17,7 @@
 #define __H2D_WEAKFORM_H
 
 #include "../function/solution.h"
+#include "../assembly_profile.h"
 #include <string>
 
 namespace Hermes
@@ -104,6 +105,16 @@ namespace Hermes
       /// Adds DG vector form.
       void add_vector_form_DG(VectorFormDG<Scalar>* vfDG);
 
+      /// Adds the clones of all the forms of other (with the same equations and spaces), assembled into the matrix and the vector
+      /// assembly_target (see Form::set_assembly_target()). Several operators are then assembled in one traversal of the meshes
+      /// by DiscreteProblem::assemble() with the vectors of the matrices and the right-hand sides.
+      /// The external functions of other have to be the ones of the forms (Form::set_ext()), not of the whole WeakForm.
+      void add_forms(const WeakForm<Scalar>* other, unsigned int assembly_target);
+
+      /// Logs the per-form counters and times of profile (DiscreteProblem::get_assembly_profile() or
+      /// get_accumulated_assembly_profile() with DiscreteProblem::set_form_profiling() on), the most expensive forms first.
+      void print_form_profile(const AssemblyProfile& profile) const;
+
       /// Provides possibility of setup element-wise parameters.
       /// For parameters that only depend on element and that do
       /// not have to be calculated for every form.
@@ -249,6 +260,38 @@ namespace Hermes
       /// scaling factor
       void setScalingFactor(double scalingFactor);
 
+      /// The integration order returned by ord() depends on the orders of the (shape, previous iteration, external) functions only,
+      /// which holds for forms doing just arithmetic on their Ord arguments. The order is then evaluated once per combination of
+      /// these orders and cached in DiscreteProblem, not once per element. Must not be turned on for forms whose ord() depends on
+      /// anything else (geometry, element marker, coefficients, time), their order would be a stale one.
+      /// Default: false, the forms of the weak form library turn it on.
+      void set_order_caching(bool to_set = true);
+
+      /// Fixed integration order of this form - ord() is not called and the order is not increased due to the reference mapping then.
+      /// Takes precedence over the global integration order of the WeakForm.
+      /// Default: -1 (the order is calculated).
+      void set_integration_order(int order);
+
+      /// Increase (decrease if negative, e.g. for a deliberate under-integration) of the integration order calculated for this form.
+      /// Default: 0.
+      void set_integration_order_increase(int increase);
+
+      /// Custom quadrature of this form (e.g. a lumped / nodal one, with edge tables for surface forms), used with the order given by
+      /// set_integration_order() or calculated as usual.
+      /// Default: NULL (the standard quadrature).
+      void set_quad_2d(Quad2D* quad);
+
+      /// The form is integrated on its own points (fixed order, decreased order or custom quadrature), not on the ones shared
+      /// by all forms on the element (the highest order of them). Such forms are evaluated separately and their values are not cached.
+      bool has_own_quadrature() const;
+
+      /// The index of the matrix and the vector this form is assembled into by DiscreteProblem::assemble() with the vectors
+      /// of the matrices and the right-hand sides (several operators sharing the spaces assembled in one traversal).
+      /// Ignored by the assembling into one matrix and one vector.
+      /// Default: 0.
+      void set_assembly_target(unsigned int target);
+      unsigned int get_assembly_target() const;
+
     protected:
       /// Set pointer to a WeakForm.
       inline void set_weakform(WeakForm<Scalar>* wf) { this->wf = wf; }
@@ -277,6 +320,20 @@ namespace Hermes
       WeakForm<Scalar>* wf;
       double stage_time;
       void set_uExtOffset(int u_ext_offset);
+
+      /// Position in WeakForm::forms, -1 if not added to a WeakForm.
+      int position;
+
+      /// See set_order_caching().
+      bool order_caching;
+
+      /// See set_integration_order(), set_integration_order_increase(), set_quad_2d().
+      int integration_order;
+      int integration_order_increase;
+      Quad2D* quad_2d;
+
+      /// See set_assembly_target().
+      unsigned int assembly_target;
       friend class WeakForm<Scalar>;
       friend class RungeKutta<Scalar>;
       friend class DiscreteProblem<Scalar>;
@@ -301,12 +358,25 @@ namespace Hermes
 
       SymFlag sym;
 
+      /// The form changes in time (or otherwise between the assemblies), false by default - only used by
+      /// DiscreteProblemLinear::set_constant_matrix(), the other forms are assembled into the matrix only once there.
+      bool time_dependent;
+
       virtual Scalar value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *u, Func<double> *v,
         Geom<double> *e, Func<Scalar> **ext) const;
 
       virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
         Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+      /// Element-batched evaluation of the form.
+      /// Fills result[i][j] with the value of the form for the basis function u[j] and the test function v[i]
+      /// for all i < n_test, j < n_base. Pairs where u[j] or v[i] is NULL are skipped (left untouched),
+      /// if symmetric is true, only the entries with j >= i have to be filled.
+      /// The default implementation forwards to value() for every pair, forms may override it to evaluate
+      /// the whole local block at once (e.g. precalculating the coefficients in the quadrature points).
+      virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
     protected:
       friend class DiscreteProblem<Scalar>;
     };
@@ -325,6 +395,36 @@ namespace Hermes
       virtual ~MatrixFormVol();
 
       virtual MatrixFormVol* clone() const;
+
+      /// Sum factorization on quadrilaterals (see TensorProductQuad) - off by default.
+      /// Used only if the form implements get_tensor_product_coefficients().
+      void set_sum_factorization(bool to_set = true);
+      bool sum_factorization;
+
+      /// For forms  int mass * u * v + diffusion * grad(u) . grad(v).
+      /// Fills the coefficients mass[i], diffusion[i] in the integration points (multiplied by wt[i]),
+      /// the local matrix is then evaluated by sum factorization (if set_sum_factorization() was called
+      /// and the element and the shapesets allow that).
+      /// \return false if the form is not of this type (default), value_block() is used then.
+      virtual bool get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+        Scalar* mass, Scalar* diffusion) const;
+
+      /// Reference element matrices on the affine elements (see ReferenceMatrices) - off by default.
+      /// Used only if the form implements get_reference_coefficients().
+      void set_reference_matrices(bool to_set = true);
+      bool reference_matrices;
+
+      /// For forms  int mass * u * v + diffusion * grad(u) . grad(v)  with constant coefficients in planar geometry.
+      /// Fills the coefficients, the local matrices of the affine elements are then combined from the reference element
+      /// matrices (if set_reference_matrices() was called), no quadrature at all.
+      /// \return false if the form is not of this type (default).
+      virtual bool get_reference_coefficients(Scalar& mass, Scalar& diffusion) const;
+
+      /// The values of the form depend only on the shape functions and the reference mapping (constant coefficients,
+      /// no coordinates, ext or u_ext) - off by default. The local matrix of an affine element is then reused on all
+      /// the congruent elements (translates of one another, as on structured meshes) instead of integrating it again.
+      void set_constant_coefficients(bool to_set = true);
+      bool constant_coefficients;
     };
 
     /// \brief Abstract, base class for matrix Surface form - i.e. MatrixForm, where the integration is with respect to 1D-Lebesgue measure (element domain-boundary edges).
@@ -380,8 +480,20 @@ namespace Hermes
 
       virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v, Geom<Hermes::Ord> *e,
         Func<Ord> **ext) const;
+
+      /// Element-batched evaluation of the form.
+      /// Fills result[i] with the value of the form for the test function v[i] for all i < n_test,
+      /// entries where v[i] is NULL are skipped (left untouched).
+      /// The default implementation forwards to value() for every test function, forms may override it to evaluate
+      /// the part of the integrand that does not depend on the test function only once per element.
+      virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+        unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const;
       unsigned int i;
 
+      /// The right-hand side (load case) the form is assembled into by DiscreteProblemLinear::assemble() with several
+      /// right-hand sides, 0 by default. The forms of the load cases above 0 are left out of the single right-hand side assemblies.
+      unsigned int load_case;
+
     protected:
       friend class DiscreteProblem<Scalar>;
     };
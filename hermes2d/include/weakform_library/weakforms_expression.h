@@ -0,0 +1,685 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the weak forms built from expressions (expression templates).
+/// Typical usage:
+/// using namespace WeakFormsExpression;
+/// Trial u; Test v;
+/// add_matrix_form(create_matrix_form_vol<double>(0, 0, grad(u) * grad(v) * lambda + u * v / tau));
+/// add_vector_form(create_vector_form_vol<double>(0, grad(solution(0)) * grad(v) * lambda + (solution(0) - ext_function(0)) * v / tau));
+/// The expression is written once, the integration order is derived from it by the Ord arithmetics,
+/// and the local matrix (vector) of an element is evaluated in one kernel - the part of the integrand
+/// not depending on the basis and test functions is evaluated once per integration point.
+
+#ifndef __H2D_EXPRESSION_WEAK_FORMS_H
+#define __H2D_EXPRESSION_WEAK_FORMS_H
+
+#include "../weakform/weakform.h"
+#include "../forms.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace WeakFormsExpression
+    {
+      /// Which part of a function an expression leaf uses.
+      enum FunctionComponent
+      {
+        ValueComponent = 0,
+        DxComponent = 1,
+        DyComponent = 2
+      };
+
+      /// The array of the component of the function.
+      template<typename T>
+      inline T* function_component(Func<T>* fn, int component)
+      {
+        return component == ValueComponent ? fn->val : (component == DxComponent ? fn->dx : fn->dy);
+      }
+
+      /// Constants in the Ord arithmetics are of order zero, whatever their type.
+      template<typename T>
+      struct ConstantCast
+      {
+        template<typename V>
+        static T cast(const V& value) { return T(value); }
+      };
+
+      template<>
+      struct ConstantCast<Hermes::Ord>
+      {
+        template<typename V>
+        static Hermes::Ord cast(const V& value) { return Hermes::Ord(0); }
+      };
+
+      /// Compile-time check (C++98), the array has a negative size if the condition does not hold.
+#define H2D_EXPRESSION_CHECK(condition, name) typedef char name[(condition) ? 1 : -1]
+
+      /// Base of all the expressions (CRTP).
+      /// Every expression is a function of the basis function u and the test function v, (at most) linear in each of them,
+      /// trial_degree and test_degree tell whether it depends on u, resp. v.
+      /// An expression provides:
+      /// - value<Real, T>(i, u, v, u_ext, ext, e) - the value in the i-th integration point, for Real = double, T = Scalar
+      ///   and for Real = T = Hermes::Ord (the integration order),
+      /// - coefficients<Scalar>(i, u_ext, ext, e, c) - the table c[a * (test_degree ? 3 : 1) + b] of coefficients
+      ///   at u_a v_b in the i-th integration point, u_a, v_b running over (val, dx, dy) of u, v if the expression depends on them.
+      template<typename Derived>
+      class Expression
+      {
+      public:
+        const Derived& derived() const { return static_cast<const Derived&>(*this); }
+      };
+
+      /// Basis (Side = 0) or test (Side = 1) function, its value or a derivative.
+      template<int Side, int Component>
+      class Basis : public Expression<Basis<Side, Component> >
+      {
+      public:
+        enum { trial_degree = (Side == 0), test_degree = (Side == 1), table_size = 3 };
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return T(function_component(Side == 0 ? u : v, Component)[i]);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          c[0] = c[1] = c[2] = 0.0;
+          c[Component] = 1.0;
+        }
+      };
+
+      /// The basis function u.
+      typedef Basis<0, ValueComponent> Trial;
+      /// The test function v.
+      typedef Basis<1, ValueComponent> Test;
+
+      /// Constant (double or std::complex<double>).
+      template<typename ValueType>
+      class Constant : public Expression<Constant<ValueType> >
+      {
+      public:
+        enum { trial_degree = 0, test_degree = 0, table_size = 1 };
+
+        Constant(ValueType constant) : constant(constant) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return ConstantCast<T>::cast(constant);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          c[0] = constant;
+        }
+
+      private:
+        ValueType constant;
+      };
+
+      /// Physical coordinate x (Coordinate = 0) or y (Coordinate = 1).
+      template<int Coordinate>
+      class Coordinates : public Expression<Coordinates<Coordinate> >
+      {
+      public:
+        enum { trial_degree = 0, test_degree = 0, table_size = 1 };
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return T(Coordinate == 0 ? e->x[i] : e->y[i]);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          c[0] = Coordinate == 0 ? e->x[i] : e->y[i];
+        }
+      };
+
+      /// A function of the form arguments - u_ext[index] (the previous Newton iterate), or ext[index] (external function),
+      /// its value or a derivative.
+      template<int Component>
+      class Field : public Expression<Field<Component> >
+      {
+      public:
+        enum { trial_degree = 0, test_degree = 0, table_size = 1 };
+
+        Field(int index, bool external) : index(index), external(external) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return function_component(external ? ext[index] : u_ext[index], Component)[i];
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          c[0] = function_component(external ? ext[index] : u_ext[index], Component)[i];
+        }
+
+        int index;
+        bool external;
+      };
+
+      /// Coefficient function of the coordinates.
+      template<typename FunctionScalar>
+      class Function2D : public Expression<Function2D<FunctionScalar> >
+      {
+      public:
+        enum { trial_degree = 0, test_degree = 0, table_size = 1 };
+
+        Function2D(Hermes2DFunction<FunctionScalar>* function) : function(function) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return T(value_at(e->x[i], e->y[i]));
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          c[0] = value_at(e->x[i], e->y[i]);
+        }
+
+      private:
+        FunctionScalar value_at(double x, double y) const { return function->value(FunctionScalar(x), FunctionScalar(y)); }
+        Hermes::Ord value_at(Hermes::Ord x, Hermes::Ord y) const { return function->value(x, y); }
+
+        Hermes2DFunction<FunctionScalar>* function;
+      };
+
+      /// Function (or its derivative) of an expression not depending on u, v - typically a nonlinear coefficient of the solution.
+      template<typename FunctionScalar, typename A>
+      class Function1D : public Expression<Function1D<FunctionScalar, A> >
+      {
+      public:
+        enum { trial_degree = 0, test_degree = 0, table_size = 1 };
+        H2D_EXPRESSION_CHECK(A::trial_degree == 0 && A::test_degree == 0, argument_must_not_depend_on_basis_or_test_functions);
+
+        Function1D(Hermes1DFunction<FunctionScalar>* function, const A& a, bool derivative) : function(function), a(a), derivative(derivative) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          T arg = a.template value<Real, T>(i, u, v, u_ext, ext, e);
+          return derivative ? function->derivative(arg) : function->value(arg);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          a.coefficients(i, u_ext, ext, e, c);
+          c[0] = derivative ? function->derivative(c[0]) : function->value(c[0]);
+        }
+
+      private:
+        Hermes1DFunction<FunctionScalar>* function;
+        A a;
+        bool derivative;
+      };
+
+      /// Sum (Sign = 1) or difference (Sign = -1), both the operands with the same dependence on u, v.
+      template<typename A, typename B, int Sign>
+      class Sum : public Expression<Sum<A, B, Sign> >
+      {
+      public:
+        enum { trial_degree = A::trial_degree, test_degree = A::test_degree, table_size = A::table_size };
+        H2D_EXPRESSION_CHECK(A::trial_degree == B::trial_degree && A::test_degree == B::test_degree, operands_must_be_of_the_same_degree);
+
+        Sum(const A& a, const B& b) : a(a), b(b) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          T value_a = a.template value<Real, T>(i, u, v, u_ext, ext, e);
+          T value_b = b.template value<Real, T>(i, u, v, u_ext, ext, e);
+          return Sign > 0 ? value_a + value_b : value_a - value_b;
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          Scalar c_b[table_size];
+          a.coefficients(i, u_ext, ext, e, c);
+          b.coefficients(i, u_ext, ext, e, c_b);
+          for(int k = 0; k < table_size; k++)
+            c[k] = Sign > 0 ? c[k] + c_b[k] : c[k] - c_b[k];
+        }
+
+      private:
+        A a;
+        B b;
+      };
+
+      /// Product, at most one of the operands depends on u and at most one on v.
+      template<typename A, typename B>
+      class Product : public Expression<Product<A, B> >
+      {
+      public:
+        enum { trial_degree = A::trial_degree + B::trial_degree, test_degree = A::test_degree + B::test_degree,
+          table_size = (trial_degree ? 3 : 1) * (test_degree ? 3 : 1) };
+        H2D_EXPRESSION_CHECK(trial_degree <= 1 && test_degree <= 1, product_must_be_linear_in_basis_and_test_functions);
+
+        Product(const A& a, const B& b) : a(a), b(b) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          T value_a = a.template value<Real, T>(i, u, v, u_ext, ext, e);
+          return value_a * b.template value<Real, T>(i, u, v, u_ext, ext, e);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          Scalar c_a[A::table_size], c_b[B::table_size];
+          a.coefficients(i, u_ext, ext, e, c_a);
+          b.coefficients(i, u_ext, ext, e, c_b);
+          int n_test = test_degree ? 3 : 1;
+          for(int a_i = 0; a_i < (trial_degree ? 3 : 1); a_i++)
+            for(int b_i = 0; b_i < n_test; b_i++)
+              c[a_i * n_test + b_i] = c_a[(A::trial_degree ? a_i : 0) * (A::test_degree ? 3 : 1) + (A::test_degree ? b_i : 0)]
+                * c_b[(B::trial_degree ? a_i : 0) * (B::test_degree ? 3 : 1) + (B::test_degree ? b_i : 0)];
+        }
+
+      private:
+        A a;
+        B b;
+      };
+
+      /// Division in the value of Quotient - in the Ord arithmetics, a division is of the maximum order,
+      /// unless it is a division by a constant.
+      template<typename T, typename B>
+      struct Division
+      {
+        static T divide(T a, T b) { return a / b; }
+      };
+
+      template<typename ValueType>
+      struct Division<Hermes::Ord, Constant<ValueType> >
+      {
+        static Hermes::Ord divide(Hermes::Ord a, Hermes::Ord b) { return a; }
+      };
+
+      /// Quotient, the divisor does not depend on u, v.
+      template<typename A, typename B>
+      class Quotient : public Expression<Quotient<A, B> >
+      {
+      public:
+        enum { trial_degree = A::trial_degree, test_degree = A::test_degree, table_size = A::table_size };
+        H2D_EXPRESSION_CHECK(B::trial_degree == 0 && B::test_degree == 0, divisor_must_not_depend_on_basis_or_test_functions);
+
+        Quotient(const A& a, const B& b) : a(a), b(b) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return Division<T, B>::divide(a.template value<Real, T>(i, u, v, u_ext, ext, e), b.template value<Real, T>(i, u, v, u_ext, ext, e));
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          Scalar c_b[1];
+          a.coefficients(i, u_ext, ext, e, c);
+          b.coefficients(i, u_ext, ext, e, c_b);
+          for(int k = 0; k < table_size; k++)
+            c[k] /= c_b[0];
+        }
+
+      private:
+        A a;
+        B b;
+      };
+
+      /// Unary minus.
+      template<typename A>
+      class Negation : public Expression<Negation<A> >
+      {
+      public:
+        enum { trial_degree = A::trial_degree, test_degree = A::test_degree, table_size = A::table_size };
+
+        Negation(const A& a) : a(a) {}
+
+        template<typename Real, typename T>
+        T value(int i, Func<Real>* u, Func<Real>* v, Func<T>** u_ext, Func<T>** ext, Geom<Real>* e) const
+        {
+          return -a.template value<Real, T>(i, u, v, u_ext, ext, e);
+        }
+
+        template<typename Scalar>
+        void coefficients(int i, Func<Scalar>** u_ext, Func<Scalar>** ext, Geom<double>* e, Scalar* c) const
+        {
+          a.coefficients(i, u_ext, ext, e, c);
+          for(int k = 0; k < table_size; k++)
+            c[k] = -c[k];
+        }
+
+      private:
+        A a;
+      };
+
+      /// Gradient, only to be multiplied by another gradient (dot product).
+      template<typename A, typename B>
+      class Gradient
+      {
+      public:
+        Gradient(const A& x_part, const B& y_part) : x_part(x_part), y_part(y_part) {}
+        A x_part;
+        B y_part;
+      };
+
+      /// The previous Newton iterate of the index-th equation (u_ext[index]).
+      inline Field<ValueComponent> solution(int index) { return Field<ValueComponent>(index, false); }
+      /// The index-th external function of the form (ext[index]).
+      inline Field<ValueComponent> ext_function(int index) { return Field<ValueComponent>(index, true); }
+      /// Physical coordinates.
+      inline Coordinates<0> coord_x() { return Coordinates<0>(); }
+      inline Coordinates<1> coord_y() { return Coordinates<1>(); }
+
+      /// Coefficient functions.
+      template<typename FunctionScalar>
+      inline Function2D<FunctionScalar> coefficient(Hermes2DFunction<FunctionScalar>* function) { return Function2D<FunctionScalar>(function); }
+      template<typename FunctionScalar, typename A>
+      inline Function1D<FunctionScalar, A> coefficient(Hermes1DFunction<FunctionScalar>* function, const Expression<A>& a) { return Function1D<FunctionScalar, A>(function, a.derived(), false); }
+      template<typename FunctionScalar, typename A>
+      inline Function1D<FunctionScalar, A> coefficient_derivative(Hermes1DFunction<FunctionScalar>* function, const Expression<A>& a) { return Function1D<FunctionScalar, A>(function, a.derived(), true); }
+
+      /// Derivatives.
+      template<int Side>
+      inline Basis<Side, DxComponent> dx(const Basis<Side, ValueComponent>&) { return Basis<Side, DxComponent>(); }
+      template<int Side>
+      inline Basis<Side, DyComponent> dy(const Basis<Side, ValueComponent>&) { return Basis<Side, DyComponent>(); }
+      template<int Side>
+      inline Gradient<Basis<Side, DxComponent>, Basis<Side, DyComponent> > grad(const Basis<Side, ValueComponent>&)
+      {
+        return Gradient<Basis<Side, DxComponent>, Basis<Side, DyComponent> >(Basis<Side, DxComponent>(), Basis<Side, DyComponent>());
+      }
+      inline Field<DxComponent> dx(const Field<ValueComponent>& f) { return Field<DxComponent>(f.index, f.external); }
+      inline Field<DyComponent> dy(const Field<ValueComponent>& f) { return Field<DyComponent>(f.index, f.external); }
+      inline Gradient<Field<DxComponent>, Field<DyComponent> > grad(const Field<ValueComponent>& f)
+      {
+        return Gradient<Field<DxComponent>, Field<DyComponent> >(dx(f), dy(f));
+      }
+
+      /// Operators.
+      template<typename A, typename B, typename C, typename D>
+      inline Sum<Product<A, C>, Product<B, D>, 1> operator*(const Gradient<A, B>& a, const Gradient<C, D>& b)
+      {
+        return Sum<Product<A, C>, Product<B, D>, 1>(Product<A, C>(a.x_part, b.x_part), Product<B, D>(a.y_part, b.y_part));
+      }
+
+      template<typename S, typename A, typename B>
+      inline Gradient<Product<S, A>, Product<S, B> > operator*(const Expression<S>& s, const Gradient<A, B>& a)
+      {
+        return Gradient<Product<S, A>, Product<S, B> >(Product<S, A>(s.derived(), a.x_part), Product<S, B>(s.derived(), a.y_part));
+      }
+      template<typename S, typename A, typename B>
+      inline Gradient<Product<S, A>, Product<S, B> > operator*(const Gradient<A, B>& a, const Expression<S>& s)
+      {
+        return s * a;
+      }
+
+      template<typename A, typename B>
+      inline Sum<A, B, 1> operator+(const Expression<A>& a, const Expression<B>& b) { return Sum<A, B, 1>(a.derived(), b.derived()); }
+      template<typename A, typename B>
+      inline Sum<A, B, -1> operator-(const Expression<A>& a, const Expression<B>& b) { return Sum<A, B, -1>(a.derived(), b.derived()); }
+      template<typename A, typename B>
+      inline Product<A, B> operator*(const Expression<A>& a, const Expression<B>& b) { return Product<A, B>(a.derived(), b.derived()); }
+      template<typename A, typename B>
+      inline Quotient<A, B> operator/(const Expression<A>& a, const Expression<B>& b) { return Quotient<A, B>(a.derived(), b.derived()); }
+      template<typename A>
+      inline Negation<A> operator-(const Expression<A>& a) { return Negation<A>(a.derived()); }
+
+      // Constants on either side.
+#define H2D_EXPRESSION_CONSTANT_OPERATORS(ValueType) \
+      template<typename A> \
+      inline Sum<A, Constant<ValueType>, 1> operator+(const Expression<A>& a, ValueType b) { return Sum<A, Constant<ValueType>, 1>(a.derived(), Constant<ValueType>(b)); } \
+      template<typename A> \
+      inline Sum<Constant<ValueType>, A, 1> operator+(ValueType a, const Expression<A>& b) { return Sum<Constant<ValueType>, A, 1>(Constant<ValueType>(a), b.derived()); } \
+      template<typename A> \
+      inline Sum<A, Constant<ValueType>, -1> operator-(const Expression<A>& a, ValueType b) { return Sum<A, Constant<ValueType>, -1>(a.derived(), Constant<ValueType>(b)); } \
+      template<typename A> \
+      inline Sum<Constant<ValueType>, A, -1> operator-(ValueType a, const Expression<A>& b) { return Sum<Constant<ValueType>, A, -1>(Constant<ValueType>(a), b.derived()); } \
+      template<typename A> \
+      inline Product<A, Constant<ValueType> > operator*(const Expression<A>& a, ValueType b) { return Product<A, Constant<ValueType> >(a.derived(), Constant<ValueType>(b)); } \
+      template<typename A> \
+      inline Product<Constant<ValueType>, A> operator*(ValueType a, const Expression<A>& b) { return Product<Constant<ValueType>, A>(Constant<ValueType>(a), b.derived()); } \
+      template<typename A> \
+      inline Quotient<A, Constant<ValueType> > operator/(const Expression<A>& a, ValueType b) { return Quotient<A, Constant<ValueType> >(a.derived(), Constant<ValueType>(b)); } \
+      template<typename A> \
+      inline Quotient<Constant<ValueType>, A> operator/(ValueType a, const Expression<A>& b) { return Quotient<Constant<ValueType>, A>(Constant<ValueType>(a), b.derived()); } \
+      template<typename A, typename B> \
+      inline Gradient<Product<Constant<ValueType>, A>, Product<Constant<ValueType>, B> > operator*(ValueType s, const Gradient<A, B>& a) { return Constant<ValueType>(s) * a; } \
+      template<typename A, typename B> \
+      inline Gradient<Product<Constant<ValueType>, A>, Product<Constant<ValueType>, B> > operator*(const Gradient<A, B>& a, ValueType s) { return Constant<ValueType>(s) * a; }
+
+      H2D_EXPRESSION_CONSTANT_OPERATORS(double)
+      H2D_EXPRESSION_CONSTANT_OPERATORS(std::complex<double>)
+#undef H2D_EXPRESSION_CONSTANT_OPERATORS
+
+      /// Volumetric matrix form of an expression linear in both u and v.
+      template<typename Scalar, typename E>
+      class ExpressionMatrixFormVol : public MatrixFormVol<Scalar>
+      {
+      public:
+        H2D_EXPRESSION_CHECK(E::trial_degree == 1 && E::test_degree == 1, matrix_form_expression_must_be_bilinear);
+
+        ExpressionMatrixFormVol(unsigned int i, unsigned int j, const E& expression, std::string area = HERMES_ANY, SymFlag sym = HERMES_NONSYM)
+          : MatrixFormVol<Scalar>(i, j), expression(expression)
+        {
+          this->set_area(area);
+          this->setSymFlag(sym);
+        }
+
+        virtual Scalar value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *u, Func<double> *v,
+          Geom<double> *e, Func<Scalar> **ext) const
+        {
+          Scalar result = 0;
+          for (int i = 0; i < n; i++)
+            result += wt[i] * expression.template value<double, Scalar>(i, u, v, u_ext, ext, e);
+          return result;
+        }
+
+        virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
+          Geom<Hermes::Ord> *e, Func<Ord> **ext) const
+        {
+          Hermes::Ord result = Hermes::Ord(0);
+          for (int i = 0; i < n; i++)
+            result += wt[i] * expression.template value<Hermes::Ord, Hermes::Ord>(i, u, v, u_ext, ext, e);
+          return result;
+        }
+
+        /// The coefficients at u_a v_b (a, b over val, dx, dy) once per point, then for every test function
+        /// w_a = sum_b coef_ab v_b and for every basis function sum_a w_a u_a - reductions over the points only.
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+        {
+          // [a * 3 + b][point], weights included, components zero in all the points are left out.
+          Scalar* coefficients = new Scalar[9 * n];
+          bool used[9];
+          memset(used, 0, sizeof(used));
+          for (int i = 0; i < n; i++)
+          {
+            Scalar point_coefficients[9];
+            expression.coefficients(i, u_ext, ext, e, point_coefficients);
+            for (int k = 0; k < 9; k++)
+            {
+              coefficients[k * n + i] = wt[i] * point_coefficients[k];
+              if(point_coefficients[k] != Scalar(0))
+                used[k] = true;
+            }
+          }
+
+          Scalar* w = new Scalar[3 * n];
+          for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          {
+            if(v[test_i] == NULL)
+              continue;
+
+            bool used_w[3];
+            for (int a = 0; a < 3; a++)
+            {
+              used_w[a] = false;
+              Scalar* w_a = w + a * n;
+              for (int i = 0; i < n; i++)
+                w_a[i] = 0;
+              for (int b = 0; b < 3; b++)
+              {
+                if(!used[a * 3 + b])
+                  continue;
+                used_w[a] = true;
+                Scalar* coefficients_ab = coefficients + (a * 3 + b) * n;
+                double* v_b = function_component(v[test_i], b);
+                for (int i = 0; i < n; i++)
+                  w_a[i] += coefficients_ab[i] * v_b[i];
+              }
+            }
+
+            for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+            {
+              if(u[base_i] == NULL)
+                continue;
+              Scalar value = 0;
+              for (int a = 0; a < 3; a++)
+              {
+                if(!used_w[a])
+                  continue;
+                Scalar* w_a = w + a * n;
+                double* u_a = function_component(u[base_i], a);
+                for (int i = 0; i < n; i++)
+                  value += w_a[i] * u_a[i];
+              }
+              result[test_i][base_i] = value;
+            }
+          }
+
+          delete [] w;
+          delete [] coefficients;
+        }
+
+        virtual MatrixFormVol<Scalar>* clone() const
+        {
+          return new ExpressionMatrixFormVol<Scalar, E>(*this);
+        }
+
+      private:
+        E expression;
+      };
+
+      /// Volumetric vector form of an expression linear in v, not depending on u.
+      template<typename Scalar, typename E>
+      class ExpressionVectorFormVol : public VectorFormVol<Scalar>
+      {
+      public:
+        H2D_EXPRESSION_CHECK(E::trial_degree == 0 && E::test_degree == 1, vector_form_expression_must_be_linear);
+
+        ExpressionVectorFormVol(unsigned int i, const E& expression, std::string area = HERMES_ANY)
+          : VectorFormVol<Scalar>(i), expression(expression)
+        {
+          this->set_area(area);
+        }
+
+        virtual Scalar value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *v,
+          Geom<double> *e, Func<Scalar> **ext) const
+        {
+          Scalar result = 0;
+          for (int i = 0; i < n; i++)
+            result += wt[i] * expression.template value<double, Scalar>(i, NULL, v, u_ext, ext, e);
+          return result;
+        }
+
+        virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v,
+          Geom<Hermes::Ord> *e, Func<Ord> **ext) const
+        {
+          Hermes::Ord result = Hermes::Ord(0);
+          for (int i = 0; i < n; i++)
+            result += wt[i] * expression.template value<Hermes::Ord, Hermes::Ord>(i, NULL, v, u_ext, ext, e);
+          return result;
+        }
+
+        /// The coefficients at v_b (b over val, dx, dy) once per point, then one reduction per test function.
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+          unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+        {
+          Scalar* coefficients = new Scalar[3 * n];
+          bool used[3] = { false, false, false };
+          for (int i = 0; i < n; i++)
+          {
+            Scalar point_coefficients[3];
+            expression.coefficients(i, u_ext, ext, e, point_coefficients);
+            for (int b = 0; b < 3; b++)
+            {
+              coefficients[b * n + i] = wt[i] * point_coefficients[b];
+              if(point_coefficients[b] != Scalar(0))
+                used[b] = true;
+            }
+          }
+
+          for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          {
+            if(v[test_i] == NULL)
+              continue;
+            Scalar value = 0;
+            for (int b = 0; b < 3; b++)
+            {
+              if(!used[b])
+                continue;
+              Scalar* coefficients_b = coefficients + b * n;
+              double* v_b = function_component(v[test_i], b);
+              for (int i = 0; i < n; i++)
+                value += coefficients_b[i] * v_b[i];
+            }
+            result[test_i] = value;
+          }
+
+          delete [] coefficients;
+        }
+
+        virtual VectorFormVol<Scalar>* clone() const
+        {
+          return new ExpressionVectorFormVol<Scalar, E>(*this);
+        }
+
+      private:
+        E expression;
+      };
+
+      /// Factories - the type of the expression is deduced.
+      template<typename Scalar, typename E>
+      inline ExpressionMatrixFormVol<Scalar, E>* create_matrix_form_vol(unsigned int i, unsigned int j, const Expression<E>& expression,
+        std::string area = HERMES_ANY, SymFlag sym = HERMES_NONSYM)
+      {
+        return new ExpressionMatrixFormVol<Scalar, E>(i, j, expression.derived(), area, sym);
+      }
+
+      template<typename Scalar, typename E>
+      inline ExpressionVectorFormVol<Scalar, E>* create_vector_form_vol(unsigned int i, const Expression<E>& expression, std::string area = HERMES_ANY)
+      {
+        return new ExpressionVectorFormVol<Scalar, E>(i, expression.derived(), area);
+      }
+    }
+  }
+}
+#undef H2D_EXPRESSION_CHECK
+#endif
@@ -51,6 +51,14 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u,
           Func<Hermes::Ord> *v, Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
+        virtual bool get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+          Scalar* mass, Scalar* diffusion) const;
+
+        virtual bool get_reference_coefficients(Scalar& mass, Scalar& diffusion) const;
+
         virtual MatrixFormVol<Scalar>* clone() const;
 
       private:
@@ -83,6 +91,14 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
+        virtual bool get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+          Scalar* mass, Scalar* diffusion) const;
+
+        virtual bool get_reference_coefficients(Scalar& mass, Scalar& diffusion) const;
+
         virtual MatrixFormVol<Scalar>* clone() const;
 
       private:
@@ -110,6 +126,12 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
+        virtual bool get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+          Scalar* mass, Scalar* diffusion) const;
+
         virtual MatrixFormVol<Scalar>* clone() const;
 
       private:
@@ -177,6 +199,9 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+          unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const;
+
         virtual VectorFormVol<Scalar>* clone() const;
 
       private:
@@ -207,6 +232,9 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+          unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const;
+
         virtual VectorFormVol<Scalar>* clone() const;
 
       private:
@@ -240,6 +268,9 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+          unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const;
+
         virtual VectorFormVol<Scalar>* clone() const;
 
       private:
@@ -272,6 +303,9 @@ namespace Hermes
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+          unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const;
+
         virtual VectorFormVol<Scalar>* clone() const;
 
       private:
@@ -48,6 +48,10 @@ namespace Hermes
         virtual Scalar value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *u,
           Func<double> *v, Geom<double> *e, Func<Scalar> **ext) const;
 
+        /// The local matrix as dense products of the (Piola transformed) values / curls of the basis and test functions.
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
@@ -81,6 +85,10 @@ namespace Hermes
         virtual Scalar value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *u,
           Func<double> *v, Geom<double> *e, Func<Scalar> **ext) const;
 
+        /// The local matrix as dense products of the (Piola transformed) values / curls of the basis and test functions.
+        virtual void value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+          unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const;
+
         virtual Hermes::Ord ord(int n, double *wt, Func<Hermes::Ord> *u_ext[], Func<Hermes::Ord> *u, Func<Hermes::Ord> *v,
           Geom<Hermes::Ord> *e, Func<Ord> **ext) const;
 
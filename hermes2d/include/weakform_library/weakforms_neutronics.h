@@ -833,6 +833,8 @@ namespace Hermes
                 unsigned int gto, gfrom;
               };
 
+              /// The fission source of the iterates, which are the external functions of the weak form the form is added to
+              /// (WeakForm::set_ext()), iterates are passed to the constructors for the check of the group index only.
               template<typename Scalar>
               class HERMES_API OuterIterationForm : public VectorFormVol<Scalar>, protected GenericForm
               {
@@ -847,7 +849,6 @@ namespace Hermes
                   GenericForm(matprop, geom_type),
                   g(g), keff(keff)
                 {
-                  this->wf->set_ext(iterates);
                   if(g >= iterates.size())
                     throw Hermes::Exceptions::Exception(E_INVALID_GROUP_INDEX);
                 }
@@ -862,7 +863,6 @@ namespace Hermes
                   g(g), keff(keff)
                 {
                   this->set_area(area);
-                  this->wf->set_ext(iterates);
                   if(g >= iterates.size())
                     throw Hermes::Exceptions::Exception(E_INVALID_GROUP_INDEX);
                 }
@@ -876,7 +876,6 @@ namespace Hermes
                   GenericForm(matprop, mesh, geom_type),
                   g(g), keff(keff)
                 {
-                  this->wf->set_ext(iterates);
                   if(g >= iterates.size())
                     throw Hermes::Exceptions::Exception(E_INVALID_GROUP_INDEX);
                 }
@@ -891,7 +890,6 @@ namespace Hermes
                   g(g), keff(keff)
                 {
                   this->set_area(area);
-                  this->wf->set_ext(iterates);
                   if(g >= iterates.size())
                     throw Hermes::Exceptions::Exception(E_INVALID_GROUP_INDEX);
                 }
@@ -1221,6 +1219,28 @@ namespace Hermes
               /// get over it.
               double get_keff() { return 0.0; };
             };
+
+            /// The loss operator (diffusion, removal and scattering) shifted by the fission operator, L - fission_shift F.
+            /// The matrix of the outer iterations, see SupportClasses::KeffEigenvalueIteration.
+            template<typename Scalar>
+            class HERMES_API DefaultWeakFormShiftedLoss : public WeakForm<Scalar>
+            {
+            public:
+              DefaultWeakFormShiftedLoss( const MaterialPropertyMaps& matprop, Mesh *mesh,
+                double fission_shift = 0.0,
+                GeomType geom_type = HERMES_PLANAR );
+            };
+
+            /// The fission source F phi of the iterates (one per group), the right-hand side of the outer iterations.
+            /// The iterates are the external functions of the weak form and may be replaced by set_ext().
+            template<typename Scalar>
+            class HERMES_API DefaultWeakFormFissionSource : public WeakForm<Scalar>
+            {
+            public:
+              DefaultWeakFormFissionSource( const MaterialPropertyMaps& matprop, Mesh *mesh,
+                Hermes::vector<MeshFunction<Scalar>*>& iterates,
+                GeomType geom_type = HERMES_PLANAR );
+            };
           }
         }
 
@@ -1253,6 +1273,53 @@ namespace Hermes
 
             void filter_fn(int n, Hermes::vector<double*> values, double* result);
           };
+
+          /// \brief Outer (power) iterations of the k-eigenvalue problem L phi = 1/keff F phi, accelerated by the Wielandt shift.
+          ///
+          /// The loss operator shifted by the fission operator, L - F / keff_shift (CompleteWeakForms::Diffusion::DefaultWeakFormShiftedLoss),
+          /// is assembled and factorized once, every outer iteration assembles only the fission source F phi of the previous iterate
+          /// (DefaultWeakFormFissionSource) and solves with the kept factorization (HERMES_REUSE_FACTORIZATION_COMPLETELY).
+          /// The error of the iterations decreases by the dominance ratio (1/keff - 1/keff_shift) / (1/keff_1 - 1/keff_shift), keff_1 being the
+          /// second eigenvalue, instead of keff_1 / keff of the plain power iterations (no shift) - the closer the shift is to keff (from above),
+          /// the fewer iterations, but the worse conditioned the matrix.
+          class HERMES_API KeffEigenvalueIteration : public Hermes::Mixins::Loggable
+          {
+          public:
+            KeffEigenvalueIteration(const MaterialProperties::Diffusion::MaterialPropertyMaps& matprop, Hermes::vector<const Space<double>*> spaces,
+              GeomType geom_type = HERMES_PLANAR);
+
+            /// The Wielandt shift - an estimate of keff from above, 0.0 for the plain power iterations (default).
+            /// Must be set before solve().
+            void set_wielandt_shift(double keff_shift);
+
+            /// The iterations stop when the relative change of keff and the change of the fission source vector (normalized
+            /// to the unit Euclidean norm) are below the tolerances. Defaults 1e-6 and 1e-5.
+            void set_tolerance(double keff_tolerance, double source_tolerance);
+
+            /// Default 1000.
+            void set_max_iterations(int max_iterations);
+
+            /// Runs the outer iterations from the initial guess (one function per group, e.g. ConstantSolution), stores the
+            /// fluxes to solutions. The fluxes are normalized so that their fission source vector has the unit Euclidean norm.
+            /// \return keff
+            double solve(Hermes::vector<MeshFunction<double>*> initial_guess, Hermes::vector<Solution<double>*> solutions);
+
+            double get_keff() const { return keff; }
+            int get_num_iterations() const { return num_iterations; }
+
+          private:
+            const MaterialProperties::Diffusion::MaterialPropertyMaps& matprop;
+            Hermes::vector<const Space<double>*> spaces;
+            GeomType geom_type;
+
+            double keff_shift;
+            double keff_tolerance;
+            double source_tolerance;
+            int max_iterations;
+
+            double keff;
+            int num_iterations;
+          };
         }
       }
     }
@@ -0,0 +1,66 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef __H2D_XML_STREAM_READER_H
+#define __H2D_XML_STREAM_READER_H
+
+#include "global.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    /// \brief Non-validating streaming reader of the Hermes2D XML files (meshes, spaces, solutions).
+    ///
+    /// Goes through the start tags of the file in the document order and gives their attributes, nothing else
+    /// (end tags, text, comments and processing instructions are skipped), so the loaders fill their structures
+    /// while reading, without the object tree of the XSD parser and without the validation against the schema.
+    /// Selected by Hermes2DApi.set_integral_param_value(xmlStreaming, 1), used only when the validation is off.
+    /// Malformed input throws Hermes::Exceptions::Exception.
+    class HERMES_API XMLStreamReader
+    {
+    public:
+      /// Reads the whole file into the buffer.
+      XMLStreamReader(const char* filename);
+      ~XMLStreamReader();
+
+      /// Moves to the next start tag, false at the end of the file.
+      bool next();
+
+      /// Name of the current element, without the namespace prefix.
+      const std::string& name() const;
+
+      bool has_attribute(const char* attribute_name) const;
+      /// Value of an attribute of the current element (the entities replaced), throws if it is missing.
+      const std::string& attribute(const char* attribute_name) const;
+      int int_attribute(const char* attribute_name) const;
+      double double_attribute(const char* attribute_name) const;
+
+    private:
+      std::string filename;
+      std::string buffer;
+      size_t position;
+
+      std::string element_name;
+      std::vector<std::pair<std::string, std::string> > attributes;
+
+      /// Skips after the first occurrence of the terminator.
+      void skip_past(const char* terminator);
+      void skip_spaces();
+      void decode_entities(std::string& value) const;
+    };
+  }
+}
+#endif
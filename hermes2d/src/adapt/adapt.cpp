@@ -37,7 +37,11 @@ namespace Hermes
       num_act_elems(-1),
       have_errors(false),
       have_coarse_solutions(false),
-      have_reference_solutions(false)
+      have_reference_solutions(false),
+      have_dual_solutions(false),
+      rsln_thread_copies(NULL),
+      rsln_thread_copies_num_threads(0),
+      regular_queue_sorted(0)
     {
       // sanity check
       if(proj_norms.size() > 0 && spaces.size() != proj_norms.size())
@@ -52,6 +56,8 @@ namespace Hermes
       memset(errors, 0, sizeof(errors));
       memset(sln, 0, sizeof(sln));
       memset(rsln, 0, sizeof(rsln));
+      memset(dual_sln, 0, sizeof(dual_sln));
+      memset(dual_rsln, 0, sizeof(dual_rsln));
       own_forms = new bool*[H2D_MAX_COMPONENTS];
       for(int i = 0; i < H2D_MAX_COMPONENTS; i++)
       {
@@ -98,7 +104,11 @@ namespace Hermes
       num_act_elems(-1),
       have_errors(false),
       have_coarse_solutions(false),
-      have_reference_solutions(false)
+      have_reference_solutions(false),
+      have_dual_solutions(false),
+      rsln_thread_copies(NULL),
+      rsln_thread_copies_num_threads(0),
+      regular_queue_sorted(0)
     {
       if(space == NULL) throw Exceptions::NullException(1);
       spaces.push_back(space);
@@ -109,6 +119,8 @@ namespace Hermes
       memset(errors, 0, sizeof(errors));
       memset(sln, 0, sizeof(sln));
       memset(rsln, 0, sizeof(rsln));
+      memset(dual_sln, 0, sizeof(dual_sln));
+      memset(dual_rsln, 0, sizeof(dual_rsln));
       own_forms = new bool*[H2D_MAX_COMPONENTS];
       for(int i = 0; i < H2D_MAX_COMPONENTS; i++)
       {
@@ -152,6 +164,25 @@ namespace Hermes
 
       for(int i = 0; i < H2D_MAX_COMPONENTS; i++)
         delete [] own_forms[i];
+
+      free_rsln_thread_copies();
+    }
+
+    template<typename Scalar>
+    void Adapt<Scalar>::free_rsln_thread_copies()
+    {
+      if(rsln_thread_copies == NULL)
+        return;
+
+      for(int thread_i = 0; thread_i < rsln_thread_copies_num_threads; thread_i++)
+      {
+        for (int i = 0; i < this->num; i++)
+          delete rsln_thread_copies[thread_i][i];
+        delete [] rsln_thread_copies[thread_i];
+      }
+      delete [] rsln_thread_copies;
+      rsln_thread_copies = NULL;
+      rsln_thread_copies_num_threads = 0;
     }
 
     template<typename Scalar>
@@ -214,6 +245,15 @@ namespace Hermes
       bool first_regular_element = true; // true if first regular element was not processed yet
       bool error_level_reached = false;
 
+      // Strategies 1 and 2 stop at a known error, the number of elements they process is counted in advance.
+      // Otherwise, the queue is sorted in growing chunks as the loop proceeds.
+      if((strat == 1 || strat == 2) && !regular_queue.empty())
+      {
+        sort_regular_queue(1);
+        double threshold = (strat == 1) ? thr * errors[regular_queue[0].comp][regular_queue[0].id] : thr;
+        sort_regular_queue(count_regular_queue_errors_above(threshold) + 1);
+      }
+
       for(int inx_regular_element = 0; inx_regular_element < num_act_elems || !priority_queue.empty();)
       {
         int id, comp;
@@ -221,6 +261,8 @@ namespace Hermes
         // Process the queuse(s) to see what elements to really refine.
         if(priority_queue.empty())
         {
+          if(inx_regular_element >= regular_queue_sorted)
+            sort_regular_queue(std::max(2 * regular_queue_sorted, std::max(inx_regular_element + 1, H2D_REGULAR_QUEUE_MIN_SORTED)));
           id = regular_queue[inx_regular_element].id;
           comp = regular_queue[inx_regular_element].comp;
           inx_regular_element++;
@@ -287,49 +329,64 @@ namespace Hermes
         return true;
       }
 
-      // RefinementSelectors cloning.
-      RefinementSelectors::Selector<Scalar>*** global_refinement_selectors = new RefinementSelectors::Selector<Scalar>**[Hermes::Hermes2D::Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      // Precompute the data shared by all threads (projection matrices, shape values) so that the parallel selection only reads them.
+      for (unsigned int j = 0; j < refinement_selectors.size(); j++)
       {
-        global_refinement_selectors[i] = new RefinementSelectors::Selector<Scalar>*[refinement_selectors.size()];
-        for (unsigned int j = 0; j < refinement_selectors.size(); j++)
+        Hermes::vector<Element*> selector_elements;
+        Hermes::vector<int> selector_orders;
+        for(unsigned int inx = 0; inx < ids.size(); inx++)
         {
-          if(i == 0)
-            global_refinement_selectors[i][j] = refinement_selectors[j];
-          else
-          {
-            global_refinement_selectors[i][j] = refinement_selectors[j]->clone();
-            if(dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(global_refinement_selectors[i][j]) != NULL)
-            {
-              dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(global_refinement_selectors[i][j])->cached_shape_vals_valid = dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(refinement_selectors[j])->cached_shape_vals_valid;
-              dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(global_refinement_selectors[i][j])->cached_shape_ortho_vals = dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(refinement_selectors[j])->cached_shape_ortho_vals;
-              dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(global_refinement_selectors[i][j])->cached_shape_vals = dynamic_cast<RefinementSelectors::ProjBasedSelector<Scalar>*>(refinement_selectors[j])->cached_shape_vals;
-            }
-            if(dynamic_cast<RefinementSelectors::OptimumSelector<Scalar>*>(global_refinement_selectors[i][j]) != NULL)
-              dynamic_cast<RefinementSelectors::OptimumSelector<Scalar>*>(global_refinement_selectors[i][j])->num_shapes = dynamic_cast<RefinementSelectors::OptimumSelector<Scalar>*>(refinement_selectors[j])->num_shapes;
-          }
+          if(components[inx] != (int)j)
+            continue;
+          selector_elements.push_back(meshes[components[inx]]->get_element(ids[inx]));
+          selector_orders.push_back(current_orders[inx]);
         }
+        if(!selector_elements.empty())
+          refinement_selectors[j]->prepare_selection(selector_elements, selector_orders);
       }
 
-      // Solution cloning.
-      Solution<Scalar>*** rslns = new Solution<Scalar>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+      // RefinementSelectors for threads, the clones are pooled in the selectors and reused in subsequent steps.
+      RefinementSelectors::Selector<Scalar>*** global_refinement_selectors = new RefinementSelectors::Selector<Scalar>**[Hermes::Hermes2D::Hermes2DApi.get_num_threads()];
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
-        rslns[i] = new Solution<Scalar>*[this->num];
-        for (int j = 0; j < this->num; j++)
+        global_refinement_selectors[i] = new RefinementSelectors::Selector<Scalar>*[refinement_selectors.size()];
+        for (unsigned int j = 0; j < refinement_selectors.size(); j++)
+          global_refinement_selectors[i][j] = refinement_selectors[j]->get_thread_selector(i);
+      }
+
+      // Solution cloning, the copies made during the error calculation are taken over if available.
+      Solution<Scalar>*** rslns;
+      if(rsln_thread_copies != NULL && rsln_thread_copies_num_threads == Hermes2DApi.get_num_threads())
+      {
+        rslns = rsln_thread_copies;
+        rsln_thread_copies = NULL;
+        rsln_thread_copies_num_threads = 0;
+      }
+      else
+      {
+        free_rsln_thread_copies();
+        rslns = new Solution<Scalar>**[Hermes2DApi.get_num_threads()];
+
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
-          if(rsln[j] != NULL)
-            rslns[i][j] = dynamic_cast<Solution<Scalar>*>(rsln[j]->clone());
+          rslns[i] = new Solution<Scalar>*[this->num];
+          for (int j = 0; j < this->num; j++)
+          {
+            if(rsln[j] != NULL)
+              rslns[i][j] = dynamic_cast<Solution<Scalar>*>(rsln[j]->clone());
+          }
         }
       }
 
       this->tick();
       this->info("Adaptivity: data preparation duration: %f s.", this->last());
 
-      // For statistics.
-      Hermes::vector<int> numberOfCandidates;
+      // For statistics, per thread in order not to synchronize the threads.
+      int* numberOfCandidates = new int[Hermes2DApi.get_num_threads()];
+      int* numberOfCandidateElements = new int[Hermes2DApi.get_num_threads()];
+      memset(numberOfCandidates, 0, Hermes2DApi.get_num_threads() * sizeof(int));
+      memset(numberOfCandidateElements, 0, Hermes2DApi.get_num_threads() * sizeof(int));
 
 
       // The loop
@@ -337,7 +394,7 @@ namespace Hermes
       Solution<Scalar>** current_rslns;
       int id_to_refine;
 #define CHUNKSIZE 1
-      int num_threads_used = Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads);
+      int num_threads_used = Hermes2DApi.get_num_threads();
 #pragma omp parallel shared(ids, components, elem_inx_to_proc, meshes, current_orders) private(current_refinement_selectors, current_rslns, id_to_refine) num_threads(num_threads_used)
       {
 #pragma omp for schedule(static, CHUNKSIZE)
@@ -354,11 +411,12 @@ namespace Hermes
             // rsln[comp] may be unset if refinement_selectors[comp] == HOnlySelector or POnlySelector
             bool refined = current_refinement_selectors[components[id_to_refine]]->select_refinement(meshes[components[id_to_refine]]->get_element(ids[id_to_refine]), current_orders[id_to_refine], current_rslns[components[id_to_refine]], elem_ref);
             
-#pragma omp critical (number_of_candidates)
-						{
-							if(dynamic_cast<Hermes::Hermes2D::RefinementSelectors::OptimumSelector<Scalar>*>(current_refinement_selectors[components[id_to_refine]]) != NULL)
-								numberOfCandidates.push_back(dynamic_cast<Hermes::Hermes2D::RefinementSelectors::OptimumSelector<Scalar>*>(current_refinement_selectors[components[id_to_refine]])->get_candidates().size());
-						}
+            RefinementSelectors::OptimumSelector<Scalar>* optimum_selector = dynamic_cast<RefinementSelectors::OptimumSelector<Scalar>*>(current_refinement_selectors[components[id_to_refine]]);
+            if(optimum_selector != NULL)
+            {
+              numberOfCandidates[omp_get_thread_num()] += optimum_selector->get_candidates().size();
+              numberOfCandidateElements[omp_get_thread_num()]++;
+            }
 
             //add to a list of elements that are going to be refined
   #pragma omp critical (elem_inx_to_proc)
@@ -382,10 +440,13 @@ namespace Hermes
 
       if(this->caughtException == NULL)
       {
-        int averageNumberOfCandidates = 0;
-        for(int i = 0; i < numberOfCandidates.size(); i++)
-          averageNumberOfCandidates += numberOfCandidates[i];
-        averageNumberOfCandidates = averageNumberOfCandidates / numberOfCandidates.size();
+        int totalNumberOfCandidates = 0, totalNumberOfCandidateElements = 0;
+        for(int i = 0; i < num_threads_used; i++)
+        {
+          totalNumberOfCandidates += numberOfCandidates[i];
+          totalNumberOfCandidateElements += numberOfCandidateElements[i];
+        }
+        int averageNumberOfCandidates = totalNumberOfCandidateElements == 0 ? 0 : totalNumberOfCandidates / totalNumberOfCandidateElements;
 
         this->info("Adaptivity: total number of refined Elements: %i.", ids.size());
         this->info("Adaptivity: average number of candidates per refined Element: %i.", averageNumberOfCandidates);
@@ -397,16 +458,13 @@ namespace Hermes
       if(this->caughtException == NULL)
         fix_shared_mesh_refinements(meshes, elem_inx_to_proc, idx, global_refinement_selectors);
 
-      for(unsigned int i = 0; i < Hermes::Hermes2D::Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        if(i > 0)
-          for (unsigned int j = 0; j < refinement_selectors.size(); j++)
-            delete global_refinement_selectors[i][j];
+      for(unsigned int i = 0; i < Hermes::Hermes2D::Hermes2DApi.get_num_threads(); i++)
         delete [] global_refinement_selectors[i];
-      }
+      delete [] numberOfCandidates;
+      delete [] numberOfCandidateElements;
       delete [] global_refinement_selectors;
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         if(rslns[i] != NULL)
         {
@@ -695,6 +753,128 @@ namespace Hermes
       return adapt(refinement_selectors, thr, strat, regularize, to_be_processed);
     }
 
+    template<typename Scalar>
+    int Adapt<Scalar>::coarsen(double thr, bool p_coarsening, double p_decay)
+    {
+      if(!have_errors)
+        throw Exceptions::Exception("element errors have to be calculated first, call Adapt<Scalar>::calc_err_est().");
+      if(thr < 0.0 || p_decay < 1.0)
+        throw Exceptions::ValueException("thr", thr, 0.0);
+
+      double max_error = 0.0;
+      Element* e;
+      for (int i = 0; i < this->num; i++)
+        for_all_active_elements(e, this->spaces[i]->get_mesh())
+          max_error = std::max(max_error, errors[i][e->id]);
+      double threshold = thr * max_error;
+
+      int num_changed = 0;
+      std::vector<bool> merged_parent;
+      for (int i = 0; i < this->num; i++)
+      {
+        Mesh* mesh = this->spaces[i]->get_mesh();
+        bool mesh_done = false;
+        for (int j = 0; j < i; j++)
+          if(this->spaces[j]->get_mesh() == mesh)
+            mesh_done = true;
+        if(mesh_done)
+          continue;
+
+        // Components sharing this mesh.
+        Hermes::vector<int> comps;
+        for (int j = i; j < this->num; j++)
+          if(this->spaces[j]->get_mesh() == mesh)
+            comps.push_back(j);
+
+        // The parents of active sons only, one level per call.
+        Hermes::vector<int> list;
+        for_all_inactive_elements(e, mesh)
+        {
+          bool found = true;
+          double family_error = 0.0;
+          for (unsigned int son_i = 0; son_i < 4; son_i++)
+          {
+            Element* son = e->sons[son_i];
+            if(son == NULL)
+              continue;
+            if(!son->active || son->id < mesh->ninitial)
+            {
+              found = false;
+              break;
+            }
+            for (unsigned int comp_i = 0; comp_i < comps.size(); comp_i++)
+              family_error += errors[comps[comp_i]][son->id];
+          }
+          if(found && family_error < threshold)
+            list.push_back(e->id);
+        }
+
+        merged_parent.assign(mesh->get_max_element_id(), false);
+        for (unsigned int list_i = 0; list_i < list.size(); list_i++)
+        {
+          e = mesh->get_element_fast(list[list_i]);
+          for (unsigned int comp_i = 0; comp_i < comps.size(); comp_i++)
+          {
+            Space<Scalar>* space = this->spaces[comps[comp_i]];
+            int order = 0, h_order = 0, v_order = 0;
+            for (unsigned int son_i = 0; son_i < 4; son_i++)
+            {
+              if(e->sons[son_i] == NULL)
+                continue;
+              int son_order = space->get_element_order(e->sons[son_i]->id);
+              order = std::max(order, H2D_GET_H_ORDER(son_order));
+              h_order = std::max(h_order, H2D_GET_H_ORDER(son_order));
+              v_order = std::max(v_order, H2D_GET_V_ORDER(son_order));
+            }
+            space->edata[e->id].order = e->is_triangle() ? order : H2D_MAKE_QUAD_ORDER(h_order, v_order);
+          }
+          mesh->unrefine_element_id(e->id);
+          merged_parent[e->id] = true;
+          for (unsigned int comp_i = 0; comp_i < comps.size(); comp_i++)
+            this->spaces[comps[comp_i]]->edata[e->id].changed_in_last_adaptation = true;
+          num_changed++;
+        }
+
+        if(!p_coarsening)
+          continue;
+
+        // The merged elements have no error of their own.
+        for (unsigned int comp_i = 0; comp_i < comps.size(); comp_i++)
+        {
+          Space<Scalar>* space = this->spaces[comps[comp_i]];
+          int min_order = (space->get_type() == HERMES_H1_SPACE) ? 1 : 0;
+          for_all_active_elements(e, mesh)
+          {
+            if(merged_parent[e->id] || errors[comps[comp_i]][e->id] * p_decay >= threshold)
+              continue;
+            int order = space->get_element_order(e->id);
+            int new_order;
+            if(e->is_triangle())
+              new_order = std::max(min_order, order - 1);
+            else
+              new_order = H2D_MAKE_QUAD_ORDER(std::max(min_order, H2D_GET_H_ORDER(order) - 1), std::max(min_order, H2D_GET_V_ORDER(order) - 1));
+            if(new_order == order)
+              continue;
+            space->set_element_order_internal(e->id, new_order);
+            space->edata[e->id].changed_in_last_adaptation = true;
+            num_changed++;
+          }
+        }
+      }
+
+      for (int i = 0; i < this->num; i++)
+        this->spaces[i]->get_mesh()->update_memory_usage();
+
+      // The errors belong to the old meshes.
+      have_errors = false;
+
+      for(unsigned int i = 0; i < this->spaces.size(); i++)
+        this->spaces[i]->assign_dofs();
+
+      this->info("Adapt::coarsen: %d elements merged or lowered.", num_changed);
+      return num_changed;
+    }
+
     template<typename Scalar>
     void Adapt<Scalar>::fix_shared_mesh_refinements(Mesh** meshes, std::vector<ElementToRefine>& elems_to_refine,
       int** idx, RefinementSelectors::Selector<Scalar> *** refinement_selectors)
@@ -819,6 +999,34 @@ namespace Hermes
     template<typename Scalar>
     void Adapt<Scalar>::apply_refinements(std::vector<ElementToRefine>& elems_to_refine)
     {
+      // Refine each mesh in one batch first (an element of a mesh shared by more components only once,
+      // as the first refinement of it does), apply_refinement() then only sets the orders.
+      for (int i = 0; i < this->num; i++)
+      {
+        Mesh* mesh = this->spaces[i]->get_mesh();
+        bool mesh_refined = false;
+        for (int j = 0; j < i; j++)
+          if(this->spaces[j]->get_mesh() == mesh)
+            mesh_refined = true;
+        if(mesh_refined)
+          continue;
+
+        std::vector<bool> refined(mesh->get_max_element_id(), false);
+        Hermes::vector<int> ids, refinements;
+        for (std::vector<ElementToRefine>::const_iterator elem_ref = elems_to_refine.begin();
+          elem_ref != elems_to_refine.end(); elem_ref++)
+        {
+          if(elem_ref->split == H2D_REFINEMENT_P || this->spaces[elem_ref->comp]->get_mesh() != mesh || refined[elem_ref->id])
+            continue;
+          if(!mesh->get_element(elem_ref->id)->active)
+            continue;
+          refined[elem_ref->id] = true;
+          ids.push_back(elem_ref->id);
+          refinements.push_back(elem_ref->split);
+        }
+        mesh->refine_elements_id(ids, refinements);
+      }
+
       for (std::vector<ElementToRefine>::const_iterator elem_ref = elems_to_refine.begin();
         elem_ref != elems_to_refine.end(); elem_ref++)
         apply_refinement(*elem_ref);
@@ -1084,16 +1292,19 @@ namespace Hermes
       have_reference_solutions = true;
 
       // Prepare multi-mesh traversal and error arrays.
-      const Mesh **meshes = new const Mesh *[2 * num];
-      Transformable **tr = new Transformable *[2 * num];
-      Traverse trav(true);
+      // The adjoint solutions (if any) follow the solutions and the reference solutions.
+      int num_meshes = (have_dual_solutions ? 4 : 2) * num;
+      const Mesh **meshes = new const Mesh *[num_meshes];
       num_act_elems = 0;
       for (i = 0; i < num; i++)
       {
         meshes[i] = sln[i]->get_mesh();
         meshes[i + num] = rsln[i]->get_mesh();
-        tr[i] = sln[i];
-        tr[i + num] = rsln[i];
+        if(have_dual_solutions)
+        {
+          meshes[i + 2 * num] = dual_sln[i]->get_mesh();
+          meshes[i + 3 * num] = dual_rsln[i]->get_mesh();
+        }
 
         num_act_elems += sln[i]->get_mesh()->get_num_active_elements();
 
@@ -1114,10 +1325,146 @@ namespace Hermes
       if(solutions_for_adapt) this->errors_squared_sum = 0.0;
       double total_error = 0.0;
 
-      // Calculate error.
-      Traverse::State * ee;
-      trav.begin(2 * num, meshes, tr);
-      while ((ee = trav.get_next_state()) != NULL)
+      // Materialize the states of the union mesh, they are evaluated in parallel.
+      Hermes::vector<const Mesh*> meshes_vector;
+      for (i = 0; i < num_meshes; i++)
+        meshes_vector.push_back(meshes[i]);
+      Traverse trav_master(true);
+      int num_states;
+      Traverse::State** states = trav_master.get_states(meshes_vector, num_states);
+
+      // Per-thread copies of the solutions, the thread 0 uses the original ones.
+      // If the errors are used for adaptivity, all threads use copies of the reference solutions, which are then kept for adapt().
+      free_rsln_thread_copies();
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      Solution<Scalar>*** thread_slns = new Solution<Scalar>**[num_threads_used];
+      Traverse* trav = new Traverse[num_threads_used];
+      Transformable*** trfs = new Transformable**[num_threads_used];
+      for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
+      {
+        thread_slns[thread_i] = new Solution<Scalar>*[num_meshes];
+        trfs[thread_i] = new Transformable*[num_meshes];
+        for (i = 0; i < num; i++)
+        {
+          thread_slns[thread_i][i] = thread_i == 0 ? sln[i] : dynamic_cast<Solution<Scalar>*>(sln[i]->clone());
+          thread_slns[thread_i][i + num] = (thread_i == 0 && !solutions_for_adapt) ? rsln[i] : dynamic_cast<Solution<Scalar>*>(rsln[i]->clone());
+          if(have_dual_solutions)
+          {
+            thread_slns[thread_i][i + 2 * num] = thread_i == 0 ? dual_sln[i] : dynamic_cast<Solution<Scalar>*>(dual_sln[i]->clone());
+            thread_slns[thread_i][i + 3 * num] = thread_i == 0 ? dual_rsln[i] : dynamic_cast<Solution<Scalar>*>(dual_rsln[i]->clone());
+          }
+        }
+        for (i = 0; i < num_meshes; i++)
+        {
+          thread_slns[thread_i][i]->set_quad_2d(&g_quad_2d_std);
+          trfs[thread_i][i] = thread_slns[thread_i][i];
+        }
+        trav[thread_i].begin(num_meshes, meshes, trfs[thread_i]);
+      }
+
+      // Contributions of every state, the first index is the state, the second one the pair of components.
+      // They are summed up afterwards in the order of the traversal, so that the results do not depend on the number of threads.
+      double* state_errors = new double[num_states * num * num];
+      double* state_norms = new double[num_states * num * num];
+
+      // The second argument of the error forms, the error of the solution itself, or the one of the adjoint solution.
+      int weight_offset = have_dual_solutions ? 2 * num : 0;
+
+      // Important, sets the current caughtException to NULL.
+      this->caughtException = NULL;
+
+      int state_i;
+#pragma omp parallel private(state_i, i, j) num_threads(num_threads_used)
+      {
+#pragma omp for schedule(dynamic, 1)
+        for(state_i = 0; state_i < num_states; state_i++)
+        {
+          if(this->caughtException != NULL)
+            continue;
+          try
+          {
+            Solution<Scalar>** current_slns = thread_slns[omp_get_thread_num()];
+            trav[omp_get_thread_num()].set_active_state(states[state_i]);
+            for (i = 0; i < num; i++)
+            {
+              for (j = 0; j < num; j++)
+              {
+                if(error_form[i][j] != NULL)
+                {
+                  state_errors[(state_i * num + i) * num + j] = eval_error(error_form[i][j], current_slns[i], current_slns[j + weight_offset], current_slns[i + num], current_slns[j + num + weight_offset]);
+                  state_norms[(state_i * num + i) * num + j] = eval_error_norm(norm_form[i][j], current_slns[i + num], current_slns[j + num]);
+                }
+              }
+            }
+          }
+          catch(Hermes::Exceptions::Exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = exception.clone();
+          }
+          catch(std::exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(exception.what());
+          }
+        }
+      }
+
+      if(solutions_for_adapt && this->caughtException == NULL)
+      {
+        rsln_thread_copies = new Solution<Scalar>**[num_threads_used];
+        rsln_thread_copies_num_threads = num_threads_used;
+      }
+      for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
+      {
+        trav[thread_i].finish();
+        if(thread_i > 0)
+          for (i = 0; i < num; i++)
+          {
+            delete thread_slns[thread_i][i];
+            if(have_dual_solutions)
+            {
+              delete thread_slns[thread_i][i + 2 * num];
+              delete thread_slns[thread_i][i + 3 * num];
+            }
+          }
+        if(rsln_thread_copies != NULL)
+        {
+          rsln_thread_copies[thread_i] = new Solution<Scalar>*[num];
+          for (i = 0; i < num; i++)
+            rsln_thread_copies[thread_i][i] = thread_slns[thread_i][i + num];
+        }
+        else if(thread_i > 0 || solutions_for_adapt)
+          for (i = 0; i < num; i++)
+            delete thread_slns[thread_i][i + num];
+        delete [] thread_slns[thread_i];
+        delete [] trfs[thread_i];
+      }
+      delete [] thread_slns;
+      delete [] trfs;
+      delete [] trav;
+
+      if(this->caughtException != NULL)
+      {
+        Traverse::free_states(states, num_states);
+        delete [] state_errors;
+        delete [] state_norms;
+        delete [] meshes;
+        delete [] norms;
+        delete [] errors_components;
+        for (i = 0; i < this->num; i++)
+        {
+          this->sln[i] = slns_original[i];
+          this->rsln[i] = rslns_original[i];
+        }
+        throw *(this->caughtException);
+      }
+
+      // Sum up the contributions in the serial order (compensated if the Hermes2DApi compensatedSummation is set).
+      bool compensated = Hermes2DApi.get_compensated_summation();
+      Hermes::Algebra::VectorKernels::CompensatedSum compensated_total_norm, compensated_total_error;
+      std::vector<Hermes::Algebra::VectorKernels::CompensatedSum> compensated_norms(compensated ? num : 0), compensated_errors_components(compensated ? num : 0);
+      for(state_i = 0; state_i < num_states; state_i++)
       {
         for (i = 0; i < num; i++)
         {
@@ -1125,21 +1472,43 @@ namespace Hermes
           {
             if(error_form[i][j] != NULL)
             {
-              double err, nrm;
-              err = eval_error(error_form[i][j], sln[i], sln[j], rsln[i], rsln[j]);
-              nrm = eval_error_norm(norm_form[i][j], rsln[i], rsln[j]);
-
-              norms[i] += nrm;
-              total_norm  += nrm;
-              total_error += err;
-              errors_components[i] += err;
+              double err = state_errors[(state_i * num + i) * num + j];
+              double nrm = state_norms[(state_i * num + i) * num + j];
+
+              if(compensated)
+              {
+                compensated_norms[i].add(nrm);
+                compensated_total_norm.add(nrm);
+                compensated_total_error.add(err);
+                compensated_errors_components[i].add(err);
+              }
+              else
+              {
+                norms[i] += nrm;
+                total_norm  += nrm;
+                total_error += err;
+                errors_components[i] += err;
+              }
               if(solutions_for_adapt)
-                this->errors[i][ee->e[i]->id] += err;
+                this->errors[i][states[state_i]->e[i]->id] += err;
             }
           }
         }
       }
-      trav.finish();
+      if(compensated)
+      {
+        for (i = 0; i < num; i++)
+        {
+          norms[i] = compensated_norms[i].value();
+          errors_components[i] = compensated_errors_components[i].value();
+        }
+        total_norm = compensated_total_norm.value();
+        total_error = compensated_total_error.value();
+      }
+
+      Traverse::free_states(states, num_states);
+      delete [] state_errors;
+      delete [] state_norms;
 
       // Store the calculation for each solution component separately.
       if(component_errors != NULL)
@@ -1148,7 +1517,7 @@ namespace Hermes
         for (int i = 0; i < num; i++)
         {
           if((error_flags & HERMES_TOTAL_ERROR_MASK) == HERMES_TOTAL_ERROR_ABS)
-            component_errors->push_back(sqrt(errors_components[i]));
+            component_errors->push_back(have_dual_solutions ? errors_components[i] : sqrt(errors_components[i]));
           else if((error_flags & HERMES_TOTAL_ERROR_MASK) == HERMES_TOTAL_ERROR_REL)
             component_errors->push_back(sqrt(errors_components[i]/norms[i]));
           else
@@ -1186,6 +1555,7 @@ namespace Hermes
       // Prepare an ordered list of elements according to an error.
       if(solutions_for_adapt)
       {
+        regular_queue_sorted = num_act_elems;
         fill_regular_queue(meshes);
         have_errors = true;
       }
@@ -1199,13 +1569,12 @@ namespace Hermes
       }
 
       delete [] meshes;
-      delete [] tr;
       delete [] norms;
       delete [] errors_components;
 
-      // Return error value.
+      // Return error value (the goal-oriented one is not squared).
       if((error_flags & HERMES_TOTAL_ERROR_MASK) == HERMES_TOTAL_ERROR_ABS)
-        return sqrt(total_error);
+        return have_dual_solutions ? total_error : sqrt(total_error);
       else if((error_flags & HERMES_TOTAL_ERROR_MASK) == HERMES_TOTAL_ERROR_REL)
         return sqrt(total_error / total_norm);
       else
@@ -1260,8 +1629,35 @@ namespace Hermes
           regular_queue.push_back(ElementReference(e->id, i));
         }
       }
-      //sort
-      std::sort(regular_queue.begin(), regular_queue.end(), CompareElements(errors));
+      //the queue is sorted lazily, strategies usually process only its beginning
+      regular_queue_sorted = 0;
+    }
+
+    template<typename Scalar>
+    void Adapt<Scalar>::sort_regular_queue(int count)
+    {
+      count = std::min(count, (int)regular_queue.size());
+      if(count <= regular_queue_sorted)
+        return;
+
+      typename Hermes::vector<ElementReference>::iterator sorted_end = regular_queue.begin() + regular_queue_sorted;
+      if(count < (int)regular_queue.size())
+        std::nth_element(sorted_end, regular_queue.begin() + count, regular_queue.end(), CompareElements(errors));
+      std::sort(sorted_end, regular_queue.begin() + count, CompareElements(errors));
+      regular_queue_sorted = count;
+    }
+
+    template<typename Scalar>
+    int Adapt<Scalar>::count_regular_queue_errors_above(double threshold) const
+    {
+      int count = 0;
+      int num_elems = (int)regular_queue.size();
+      int elem_i;
+#pragma omp parallel for reduction(+:count) num_threads(Hermes2DApi.get_num_threads())
+      for(elem_i = 0; elem_i < num_elems; elem_i++)
+        if(errors[regular_queue[elem_i].comp][regular_queue[elem_i].id] >= threshold)
+          count++;
+      return count;
     }
 
     template HERMES_API class Adapt<double>;
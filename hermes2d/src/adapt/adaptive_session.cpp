@@ -0,0 +1,157 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+#include "adaptive_session.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    AdaptiveSession<Scalar>::AdaptiveSession(const WeakForm<Scalar>* wf, Hermes::vector<Space<Scalar>*> spaces, unsigned int order_increase, int refinement)
+      : wf(wf), spaces(spaces), order_increase(order_increase), refinement(refinement), use_initial_guess(true)
+    {
+      if(wf == NULL)
+        throw Exceptions::NullException(1);
+      if(spaces.empty())
+        throw Exceptions::LengthException(2, 0, 1);
+      this->dp = new DiscreteProblemLinear<Scalar>();
+      this->dp->set_weak_formulation(wf);
+      this->linear_solver = new LinearSolver<Scalar>(this->dp);
+    }
+
+    template<typename Scalar>
+    AdaptiveSession<Scalar>::AdaptiveSession(const WeakForm<Scalar>* wf, Space<Scalar>* space, unsigned int order_increase, int refinement)
+      : wf(wf), order_increase(order_increase), refinement(refinement), use_initial_guess(true)
+    {
+      if(wf == NULL)
+        throw Exceptions::NullException(1);
+      if(space == NULL)
+        throw Exceptions::NullException(2);
+      this->spaces.push_back(space);
+      this->dp = new DiscreteProblemLinear<Scalar>();
+      this->dp->set_weak_formulation(wf);
+      this->linear_solver = new LinearSolver<Scalar>(this->dp);
+    }
+
+    template<typename Scalar>
+    AdaptiveSession<Scalar>::~AdaptiveSession()
+    {
+      delete this->linear_solver;
+      delete this->dp;
+      for(unsigned int i = 0; i < this->ref_spaces.size(); i++)
+        delete this->ref_spaces[i];
+      for(unsigned int i = 0; i < this->ref_meshes.size(); i++)
+        delete this->ref_meshes[i];
+    }
+
+    template<typename Scalar>
+    void AdaptiveSession<Scalar>::set_incremental_reassembly(bool to_set)
+    {
+      this->dp->set_incremental_reassembly(to_set);
+    }
+
+    template<typename Scalar>
+    void AdaptiveSession<Scalar>::set_use_initial_guess(bool to_set)
+    {
+      this->use_initial_guess = to_set;
+    }
+
+    template<typename Scalar>
+    void AdaptiveSession<Scalar>::solve()
+    {
+      this->tick();
+
+      // The reference meshes, one per coarse mesh, cached by the coarse meshes.
+      Hermes::vector<Mesh*> new_ref_meshes;
+      Hermes::vector<const Mesh*> coarse_meshes;
+      Hermes::vector<Mesh*> space_ref_meshes;
+      for(unsigned int i = 0; i < this->spaces.size(); i++)
+      {
+        Mesh* coarse_mesh = this->spaces[i]->get_mesh();
+        unsigned int j = 0;
+        while(j < coarse_meshes.size() && coarse_meshes[j] != coarse_mesh)
+          j++;
+        if(j == coarse_meshes.size())
+        {
+          Mesh::ReferenceMeshCreator ref_mesh_creator(coarse_mesh, this->refinement, true);
+          coarse_meshes.push_back(coarse_mesh);
+          new_ref_meshes.push_back(ref_mesh_creator.create_ref_mesh());
+        }
+        space_ref_meshes.push_back(new_ref_meshes[j]);
+      }
+
+      // The reference spaces, numbered as the previous ones where possible, the DOFs of all of them at once.
+      Hermes::vector<Space<Scalar>*> new_ref_spaces;
+      for(unsigned int i = 0; i < this->spaces.size(); i++)
+      {
+        typename Space<Scalar>::ReferenceSpaceCreator ref_space_creator(this->spaces[i], space_ref_meshes[i], this->order_increase);
+        if(!this->ref_spaces.empty())
+          ref_space_creator.set_previous_ref_space(this->ref_spaces[i]);
+        new_ref_spaces.push_back(ref_space_creator.create_ref_space(false));
+      }
+      Space<Scalar>::assign_dofs(new_ref_spaces);
+
+      // The previous solution on the new reference spaces, the initial guess.
+      Scalar* initial_guess = NULL;
+      if(this->use_initial_guess && this->linear_solver->get_sln_vector() != NULL && !this->ref_spaces.empty())
+      {
+        initial_guess = new Scalar[Space<Scalar>::get_num_dofs(new_ref_spaces)];
+        for(unsigned int i = 0; i < this->spaces.size(); i++)
+          new_ref_spaces[i]->transfer_coefficients(this->ref_spaces[i], this->linear_solver->get_sln_vector(), initial_guess);
+      }
+
+      // The previous reference spaces are not needed any more.
+      for(unsigned int i = 0; i < this->ref_spaces.size(); i++)
+        delete this->ref_spaces[i];
+      for(unsigned int i = 0; i < this->ref_meshes.size(); i++)
+        delete this->ref_meshes[i];
+      this->ref_spaces = new_ref_spaces;
+      this->ref_meshes = new_ref_meshes;
+
+      Hermes::vector<const Space<Scalar>*> const_ref_spaces;
+      for(unsigned int i = 0; i < this->ref_spaces.size(); i++)
+        const_ref_spaces.push_back(this->ref_spaces[i]);
+      this->linear_solver->set_spaces(const_ref_spaces);
+      this->linear_solver->set_initial_guess(initial_guess);
+      delete [] initial_guess;
+
+      this->linear_solver->solve();
+
+      this->tick();
+      this->info("Adaptive session: reference problem with %d DOFs, duration: %f s.", Space<Scalar>::get_num_dofs(const_ref_spaces), this->last());
+    }
+
+    template<typename Scalar>
+    Hermes::vector<Space<Scalar>*> AdaptiveSession<Scalar>::get_ref_spaces() const
+    {
+      return this->ref_spaces;
+    }
+
+    template<typename Scalar>
+    Scalar* AdaptiveSession<Scalar>::get_sln_vector()
+    {
+      return this->linear_solver->get_sln_vector();
+    }
+
+    template<typename Scalar>
+    LinearSolver<Scalar>* AdaptiveSession<Scalar>::get_linear_solver()
+    {
+      return this->linear_solver;
+    }
+
+    template class HERMES_API AdaptiveSession<double>;
+    template class HERMES_API AdaptiveSession<std::complex<double> >;
+  }
+}
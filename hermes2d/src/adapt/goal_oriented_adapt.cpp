@@ -0,0 +1,90 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+#include "goal_oriented_adapt.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    GoalOrientedAdapt<Scalar>::GoalOrientedAdapt(Hermes::vector<Space<Scalar>*> spaces, Hermes::vector<ProjNormType> proj_norms)
+      : Adapt<Scalar>(spaces, proj_norms)
+    {
+    }
+
+    template<typename Scalar>
+    GoalOrientedAdapt<Scalar>::GoalOrientedAdapt(Space<Scalar>* space, ProjNormType proj_norm)
+      : Adapt<Scalar>(space, proj_norm)
+    {
+    }
+
+    template<typename Scalar>
+    double GoalOrientedAdapt<Scalar>::calc_err_est(Solution<Scalar>* sln, Solution<Scalar>* rsln, Solution<Scalar>* dual_sln, Solution<Scalar>* dual_rsln,
+      bool solutions_for_adapt)
+    {
+      if(this->num != 1)
+        throw Exceptions::LengthException(1, 1, this->num);
+      Hermes::vector<Solution<Scalar>*> slns, rslns, dual_slns, dual_rslns;
+      slns.push_back(sln);
+      rslns.push_back(rsln);
+      dual_slns.push_back(dual_sln);
+      dual_rslns.push_back(dual_rsln);
+      return this->calc_err_est(slns, rslns, dual_slns, dual_rslns, NULL, solutions_for_adapt);
+    }
+
+    template<typename Scalar>
+    double GoalOrientedAdapt<Scalar>::calc_err_est(Hermes::vector<Solution<Scalar>*> slns, Hermes::vector<Solution<Scalar>*> rslns,
+      Hermes::vector<Solution<Scalar>*> dual_slns, Hermes::vector<Solution<Scalar>*> dual_rslns,
+      Hermes::vector<double>* component_errors, bool solutions_for_adapt)
+    {
+      this->tick();
+      if(slns.size() != (unsigned int)this->num)
+        throw Exceptions::LengthException(1, slns.size(), this->num);
+      if(rslns.size() != (unsigned int)this->num)
+        throw Exceptions::LengthException(2, rslns.size(), this->num);
+      if(dual_slns.size() != (unsigned int)this->num)
+        throw Exceptions::LengthException(3, dual_slns.size(), this->num);
+      if(dual_rslns.size() != (unsigned int)this->num)
+        throw Exceptions::LengthException(4, dual_rslns.size(), this->num);
+
+      for (int i = 0; i < this->num; i++)
+      {
+        this->dual_sln[i] = dual_slns[i];
+        this->dual_rsln[i] = dual_rslns[i];
+      }
+
+      // Adapt::calc_err_internal() weights the errors by the adjoint solutions.
+      this->have_dual_solutions = true;
+      double result;
+      try
+      {
+        result = this->calc_err_internal(slns, rslns, component_errors, solutions_for_adapt, HERMES_TOTAL_ERROR_ABS | HERMES_ELEMENT_ERROR_ABS);
+      }
+      catch(...)
+      {
+        this->have_dual_solutions = false;
+        throw;
+      }
+      this->have_dual_solutions = false;
+
+      this->tick();
+      this->info("Adaptivity: goal-oriented error estimate calculation duration: %f s.", this->last());
+      return result;
+    }
+
+    template HERMES_API class GoalOrientedAdapt<double>;
+    template HERMES_API class GoalOrientedAdapt<std::complex<double> >;
+  }
+}
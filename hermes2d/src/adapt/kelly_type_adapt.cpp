@@ -13,6 +13,8 @@
 // You should have received a copy of the GNU General Public License
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 #include "kelly_type_adapt.h"
+#include "edge_neighbor_table.h"
+#include "api2d.h"
 
 namespace Hermes
 {
@@ -127,13 +129,11 @@ namespace Hermes
       this->have_coarse_solutions = true;
 
       const Mesh** meshes = new const Mesh*[this->num];
-      Transformable** fns = new Transformable*[this->num];
 
       this->num_act_elems = 0;
       for (int i = 0; i < this->num; i++)
       {
         meshes[i] = (this->sln[i]->get_mesh());
-        fns[i] = (this->sln[i]);
 
         this->num_act_elems += meshes[i]->get_num_active_elements();
         int max = meshes[i]->get_max_element_id();
@@ -161,263 +161,286 @@ namespace Hermes
       this->errors_squared_sum = 0.0;
       double total_error = 0.0;
 
-      bool bnd[H2D_MAX_NUMBER_EDGES];
-      SurfPos surf_pos[H2D_MAX_NUMBER_EDGES];
-      Traverse::State *ee;
-      Traverse trav(true);
+      // Materialize the states of the union mesh, the element estimators are evaluated on them in parallel.
+      Hermes::vector<const Mesh*> meshes_vector;
+      for (int i = 0; i < this->num; i++)
+        meshes_vector.push_back(meshes[i]);
+      Traverse trav_master(true);
+      int num_states;
+      Traverse::State** states = trav_master.get_states(meshes_vector, num_states);
 
-      // Reset the e->visited status of each element of each mesh (most likely it will be set to true from
-      // the latest assembling procedure).
-      if(ignore_visited_segments)
+      // The interface estimators are evaluated in parallel on the segments of the inner edges of each mesh.
+      Hermes::vector<InterfaceSegment> segments;
+      for (int i = 0; i < this->num; i++)
       {
-        for (int i = 0; i < this->num; i++)
+        for (unsigned int iest = 0; iest < error_estimators_surf.size(); iest++)
         {
-          Element* e;
-          for_all_active_elements(e, meshes[i])
-            e->visited = false;
+          if(error_estimators_surf[iest]->i == i && error_estimators_surf[iest]->area == H2D_DG_INNER_EDGE)
+          {
+            get_interface_segments(i, meshes[i], segments);
+            break;
+          }
         }
       }
-
-      // Begin the multimesh traversal.
-      trav.begin(this->num, meshes, fns);
-      while ((ee = trav.get_next_state()) != NULL)
+      int num_segments = segments.size();
+
+      // External functions of the estimators are not copied for the threads.
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      for (unsigned int iest = 0; iest < error_estimators_vol.size(); iest++)
+        if(error_estimators_vol[iest]->ext.size() > 0)
+          num_threads_used = 1;
+      for (unsigned int iest = 0; iest < error_estimators_surf.size(); iest++)
+        if(error_estimators_surf[iest]->ext.size() > 0)
+          num_threads_used = 1;
+
+      // Per-thread copies of the solutions, the thread 0 uses the original ones.
+      Solution<Scalar>*** thread_slns = new Solution<Scalar>**[num_threads_used];
+      Traverse* trav = new Traverse[num_threads_used];
+      Transformable*** trfs = new Transformable**[num_threads_used];
+      for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
       {
-        bnd[0] = ee->bnd[0];
-        bnd[1] = ee->bnd[1];
-        bnd[2] = ee->bnd[2];
-        bnd[3] = ee->bnd[3];
-
-        surf_pos[0].marker = ee->rep->en[0]->marker;
-        surf_pos[1].marker = ee->rep->en[1]->marker;
-        surf_pos[2].marker = ee->rep->en[2]->marker;
-        surf_pos[3].marker = ee->rep->en[3]->marker;
-
-        surf_pos[0].surf_num = 0;
-        surf_pos[1].surf_num = 1;
-        surf_pos[2].surf_num = 2;
-        surf_pos[3].surf_num = 3;
-
-        // Go through all solution components.
+        thread_slns[thread_i] = new Solution<Scalar>*[this->num];
+        trfs[thread_i] = new Transformable*[this->num];
         for (int i = 0; i < this->num; i++)
         {
-          if(ee->e[i] == NULL)
-            continue;
-
-          // Set maximum integration order for use in integrals, see limit_order()
-          update_limit_table(ee->e[i]->get_mode());
+          thread_slns[thread_i][i] = thread_i == 0 ? this->sln[i] : dynamic_cast<Solution<Scalar>*>(this->sln[i]->clone());
+          thread_slns[thread_i][i]->set_quad_2d(&g_quad_2d_std);
+          trfs[thread_i][i] = thread_slns[thread_i][i];
+        }
+        trav[thread_i].begin(this->num, meshes, trfs[thread_i]);
+      }
 
-          RefMap *rm = this->sln[i]->get_refmap();
+      // Contributions of every state and component and of both sides of every segment. They are summed up afterwards
+      // in the order of the states and segments, so that the results do not depend on the number of threads.
+      double* state_errors = new double[num_states * this->num];
+      double* state_norms = new double[num_states * this->num];
+      double* segment_errors = new double[2 * num_segments];
+      memset(state_norms, 0, num_states * this->num * sizeof(double));
 
-          double err = 0.0;
+      // Important, sets the current caughtException to NULL.
+      this->caughtException = NULL;
 
-          // Go through all volumetric error estimators.
-          for (unsigned int iest = 0; iest < error_estimators_vol.size(); iest++)
+      int state_i, segment_i;
+#pragma omp parallel private(state_i, segment_i) num_threads(num_threads_used)
+      {
+#pragma omp for schedule(dynamic, 1)
+        for(state_i = 0; state_i < num_states; state_i++)
+        {
+          if(this->caughtException != NULL)
+            continue;
+          try
           {
-            // Skip current error estimator if it is assigned to a different component or geometric area
-            // different from that of the current active element.
+            Solution<Scalar>** current_slns = thread_slns[omp_get_thread_num()];
+            Traverse::State* ee = states[state_i];
+            trav[omp_get_thread_num()].set_active_state(ee);
 
-            if(error_estimators_vol[iest]->i != i)
-              continue;
+            SurfPos surf_pos[H2D_MAX_NUMBER_EDGES];
+            for (int isurf = 0; isurf < ee->rep->get_nvert(); isurf++)
+            {
+              surf_pos[isurf].marker = ee->rep->en[isurf]->marker;
+              surf_pos[isurf].surf_num = isurf;
+            }
 
-            if(error_estimators_vol[iest]->area != HERMES_ANY)
-              if(!element_markers_conversion.get_internal_marker(error_estimators_vol[iest]->area).valid || element_markers_conversion.get_internal_marker(error_estimators_vol[iest]->area).marker != ee->e[i]->marker)
+            // Go through all solution components.
+            for (int i = 0; i < this->num; i++)
+            {
+              if(ee->e[i] == NULL)
                 continue;
 
-            err += eval_volumetric_estimator(error_estimators_vol[iest], rm);
-          }
+              RefMap *rm = current_slns[i]->get_refmap();
 
-          // Go through all surface error estimators (includes both interface and boundary est's).
-          for (unsigned int iest = 0; iest < error_estimators_surf.size(); iest++)
-          {
-            if(error_estimators_surf[iest]->i != i)
-              continue;
+              double err = 0.0;
 
-            for (int isurf = 0; isurf < ee->e[i]->get_nvert(); isurf++)
-            {
-              if(bnd[isurf])   // Boundary
+              // Go through all volumetric error estimators.
+              for (unsigned int iest = 0; iest < error_estimators_vol.size(); iest++)
               {
-                if(error_estimators_surf[iest]->area != HERMES_ANY)
-                {
-                  if(!boundary_markers_conversion.get_internal_marker(error_estimators_surf[iest]->area).valid)
-                    continue;
-                  int imarker = boundary_markers_conversion.get_internal_marker(error_estimators_surf[iest]->area).marker;
+                // Skip current error estimator if it is assigned to a different component or geometric area
+                // different from that of the current active element.
 
-                  if(imarker == H2D_DG_INNER_EDGE_INT)
-                    continue;
-                  if(imarker != surf_pos[isurf].marker)
+                if(error_estimators_vol[iest]->i != i)
+                  continue;
+
+                if(error_estimators_vol[iest]->area != HERMES_ANY)
+                  if(!element_markers_conversion.get_internal_marker(error_estimators_vol[iest]->area).valid || element_markers_conversion.get_internal_marker(error_estimators_vol[iest]->area).marker != ee->e[i]->marker)
                     continue;
-                }
 
-                err += eval_boundary_estimator(error_estimators_surf[iest], rm, &surf_pos[isurf]);
+                err += eval_volumetric_estimator(error_estimators_vol[iest], current_slns, rm);
               }
-              else              // Interface
+
+              // Go through all boundary error estimators, the interface ones are evaluated on the segments below.
+              for (unsigned int iest = 0; iest < error_estimators_surf.size(); iest++)
               {
-                if(error_estimators_surf[iest]->area != H2D_DG_INNER_EDGE)
+                if(error_estimators_surf[iest]->i != i)
                   continue;
 
-                // BEGIN COPY FROM DISCRETE_PROBLEM.CPP
-
-                // 5 is for bits per page in the array.
-                LightArray<NeighborSearch<Scalar>*> neighbor_searches(5);
-                unsigned int num_neighbors = 0;
-                NeighborNode* root;
-                int ns_index;
-
-                // Determine the minimum mesh seq in this stage.
-                unsigned int min_dg_mesh_seq = 0;
-                for(unsigned int j = 0; j < this->spaces.size(); j++)
-                  if(this->spaces[j]->get_mesh()->get_seq() < min_dg_mesh_seq || j == 0)
-                    min_dg_mesh_seq = this->spaces[j]->get_mesh()->get_seq();
-
-                ns_index = meshes[i]->get_seq() - min_dg_mesh_seq; // = 0 for single mesh
-
-                // Initialize the NeighborSearches.
-                this->dp.init_neighbors(neighbor_searches, ee, min_dg_mesh_seq);
-
-                // Create a multimesh tree;
-                root = new NeighborNode(NULL, 0);
-                this->dp.build_multimesh_tree(root, neighbor_searches);
-
-                // Update all NeighborSearches according to the multimesh tree.
-                // After this, all NeighborSearches in neighbor_searches should have the same count
-                // of neighbors and proper set of transformations
-                // for the central and the neighbor element(s) alike.
-                // Also check that every NeighborSearch has the same number of neighbor elements.
-                for(unsigned int j = 0; j < neighbor_searches.get_size(); j++)
+                for (int isurf = 0; isurf < ee->e[i]->get_nvert(); isurf++)
                 {
-                  if(neighbor_searches.present(j))
-                  {
-                    NeighborSearch<Scalar>* ns = neighbor_searches.get(j);
-                    this->dp.update_neighbor_search(ns, root);
-                    if(num_neighbors == 0)
-                      num_neighbors = ns->n_neighbors;
-                    if(ns->n_neighbors != num_neighbors)
-                      throw Hermes::Exceptions::Exception("Num_neighbors of different NeighborSearches not matching in KellyTypeAdapt<Scalar>::calc_err_internal.");
-                  }
-                }
-
-                // Go through all segments of the currently processed interface (segmentation is caused
-                // by hanging nodes on the other side of the interface).
-                for (unsigned int neighbor = 0; neighbor < num_neighbors; neighbor++)
-                {
-                  if(ignore_visited_segments)
-                  {
-                    bool processed = true;
-                    for(unsigned int j = 0; j < neighbor_searches.get_size(); j++)
-                      if(neighbor_searches.present(j))
-                        if(!neighbor_searches.get(j)->neighbors.at(neighbor)->visited)
-                        {
-                          processed = false;
-                          break;
-                        }
-
-                    if(processed) continue;
-                  }
-
-                  // We do not use cache_e and cache_jwt here.
+                  if(!ee->bnd[isurf])
+                    continue;
 
-                  // Set the active segment in all NeighborSearches
-                  for(unsigned int j = 0; j < neighbor_searches.get_size(); j++)
+                  if(error_estimators_surf[iest]->area != HERMES_ANY)
                   {
-                    if(neighbor_searches.present(j))
-                    {
-                      neighbor_searches.get(j)->active_segment = neighbor;
-                      neighbor_searches.get(j)->neighb_el = neighbor_searches.get(j)->neighbors[neighbor];
-                      neighbor_searches.get(j)->neighbor_edge = neighbor_searches.get(j)->neighbor_edges[neighbor];
-                    }
+                    if(!boundary_markers_conversion.get_internal_marker(error_estimators_surf[iest]->area).valid)
+                      continue;
+                    int imarker = boundary_markers_conversion.get_internal_marker(error_estimators_surf[iest]->area).marker;
+
+                    if(imarker == H2D_DG_INNER_EDGE_INT)
+                      continue;
+                    if(imarker != surf_pos[isurf].marker)
+                      continue;
                   }
 
-                  // Push all the necessary transformations to all functions of this stage.
-                  // The important thing is that the transformations to the current subelement are already there.
-                  // Also store the current neighbor element and neighbor edge in neighb_el, neighbor_edge.
-                  for(unsigned int fns_i = 0; fns_i < this->num; fns_i++)
-                  {
-                    NeighborSearch<Scalar> *ns = neighbor_searches.get(meshes[fns_i]->get_seq() - min_dg_mesh_seq);
-                    if(ns->central_transformations.present(neighbor))
-                      ns->central_transformations.get(neighbor)->apply_on(fns[fns_i]);
-                  }
+                  err += eval_boundary_estimator(error_estimators_surf[iest], current_slns, rm, &surf_pos[isurf]);
+                }
+              }
 
-                  // END COPY FROM DISCRETE_PROBLEM.CPP
-                  rm->force_transform(this->sln[i]->get_transform(), this->sln[i]->get_ctm());
-
-                  // The estimate is multiplied by 0.5 in order to distribute the error equally onto
-                  // the two neighboring elements.
-                  double central_err = 0.5 * eval_interface_estimator(error_estimators_surf[iest],
-                                                                      rm, &surf_pos[isurf], neighbor_searches,
-                                                                      ns_index);
-                  double neighb_err = central_err;
-
-                  // Scale the error estimate by the scaling function dependent on the element diameter
-                  // (use the central element's diameter).
-                  if(use_aposteriori_interface_scaling && interface_scaling_fns[i])
-                    if(!element_markers_conversion.get_user_marker(ee->e[i]->marker).valid)
-                      throw Hermes::Exceptions::Exception("Marker not valid.");
-                    else
-                      central_err *= interface_scaling_fns[i]->value(ee->e[i]->get_diameter(), element_markers_conversion.get_user_marker(ee->e[i]->marker).marker);
-
-                  // In the case this edge will be ignored when calculating the error for the element on
-                  // the other side, add the now computed error to that element as well.
-                  if(ignore_visited_segments)
-                  {
-                    Element *neighb = neighbor_searches.get(ns_index)->neighb_el;
-
-                    // Scale the error estimate by the scaling function dependent on the element diameter
-                    // (use the diameter of the element on the other side).
-                    if(use_aposteriori_interface_scaling && interface_scaling_fns[i])
-                      if(!element_markers_conversion.get_user_marker(neighb->marker).valid)
-                      throw Hermes::Exceptions::Exception("Marker not valid.");
-                    else
-                      neighb_err *= interface_scaling_fns[i]->value(neighb->get_diameter(), element_markers_conversion.get_user_marker(neighb->marker).marker);
-
-                    errors_components[i] += central_err + neighb_err;
-                    total_error += central_err + neighb_err;
-                    this->errors[i][ee->e[i]->id] += central_err;
-                    this->errors[i][neighb->id] += neighb_err;
-                  }
-                  else
-                    err += central_err;
+              state_errors[state_i * this->num + i] = err;
 
-                  // BEGIN COPY FROM DISCRETE_PROBLEM.CPP
+              if(calc_norm)
+                state_norms[state_i * this->num + i] = eval_solution_norm(this->norm_form[i][i], rm, current_slns[i]);
+            }
+          }
+          catch(Hermes::Exceptions::Exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = exception.clone();
+          }
+          catch(std::exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(exception.what());
+          }
+        }
 
-                  // Clear the transformations from the RefMaps and all functions.
-                  for(unsigned int fns_i = 0; fns_i < this->num; fns_i++)
-                    fns[fns_i]->set_transform(neighbor_searches.get(meshes[fns_i]->get_seq() - min_dg_mesh_seq)->original_central_el_transform);
+#pragma omp for schedule(dynamic, 1)
+        for(segment_i = 0; segment_i < num_segments; segment_i++)
+        {
+          if(this->caughtException != NULL)
+            continue;
+          try
+          {
+            const InterfaceSegment& segment = segments[segment_i];
+            int i = segment.component;
+            Solution<Scalar>* current_sln = thread_slns[omp_get_thread_num()][i];
+
+            NeighborSearch<Scalar> ns(segment.e, meshes[i]);
+            ns.set_active_edge(segment.edge);
+            ns.set_active_segment(segment.neighbor);
+
+            double err = 0.0;
+            for (unsigned int iest = 0; iest < error_estimators_surf.size(); iest++)
+              if(error_estimators_surf[iest]->i == i && error_estimators_surf[iest]->area == H2D_DG_INNER_EDGE)
+                err += eval_interface_estimator(error_estimators_surf[iest], current_sln, &ns);
+
+            // The estimate is multiplied by 0.5 in order to distribute the error equally onto
+            // the two neighboring elements.
+            double central_err = 0.5 * err;
+            double neighb_err = central_err;
+
+            // Scale the error estimate by the scaling function dependent on the element diameter
+            // (use the central element's diameter).
+            if(use_aposteriori_interface_scaling && interface_scaling_fns[i])
+            {
+              if(!element_markers_conversion.get_user_marker(segment.e->marker).valid)
+                throw Hermes::Exceptions::Exception("Marker not valid.");
+              central_err *= interface_scaling_fns[i]->value(segment.e->get_diameter(), element_markers_conversion.get_user_marker(segment.e->marker).marker);
+            }
 
-                  rm->set_transform(neighbor_searches.get(ns_index)->original_central_el_transform);
+            // The segment is not listed from the other side in this case, the error is added to that element as well.
+            if(ignore_visited_segments)
+            {
+              // Scale the error estimate by the scaling function dependent on the element diameter
+              // (use the diameter of the element on the other side).
+              if(use_aposteriori_interface_scaling && interface_scaling_fns[i])
+              {
+                if(!element_markers_conversion.get_user_marker(segment.neighb->marker).valid)
+                  throw Hermes::Exceptions::Exception("Marker not valid.");
+                neighb_err *= interface_scaling_fns[i]->value(segment.neighb->get_diameter(), element_markers_conversion.get_user_marker(segment.neighb->marker).marker);
+              }
+            }
+            else
+              neighb_err = 0.0;
 
-                  // END COPY FROM DISCRETE_PROBLEM.CPP
-                }
+            segment_errors[2 * segment_i] = central_err;
+            segment_errors[2 * segment_i + 1] = neighb_err;
+          }
+          catch(Hermes::Exceptions::Exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = exception.clone();
+          }
+          catch(std::exception& exception)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(exception.what());
+          }
+        }
+      }
 
-                // BEGIN COPY FROM DISCRETE_PROBLEM.CPP
+      for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
+      {
+        trav[thread_i].finish();
+        if(thread_i > 0)
+          for (int i = 0; i < this->num; i++)
+            delete thread_slns[thread_i][i];
+        delete [] thread_slns[thread_i];
+        delete [] trfs[thread_i];
+      }
+      delete [] thread_slns;
+      delete [] trfs;
+      delete [] trav;
 
-                // Delete the multimesh tree;
-                delete root;
+      if(this->caughtException != NULL)
+      {
+        Traverse::free_states(states, num_states);
+        delete [] state_errors;
+        delete [] state_norms;
+        delete [] segment_errors;
+        delete [] meshes;
+        if(calc_norm)
+          delete [] norms;
+        delete [] errors_components;
+        throw *(this->caughtException);
+      }
 
-                // Delete the neighbor_searches array.
-                for(unsigned int j = 0; j < neighbor_searches.get_size(); j++)
-                  if(neighbor_searches.present(j))
-                    delete neighbor_searches.get(j);
+      // Sum up the contributions in the serial order.
+      for(state_i = 0; state_i < num_states; state_i++)
+      {
+        for (int i = 0; i < this->num; i++)
+        {
+          if(states[state_i]->e[i] == NULL)
+            continue;
 
-                // END COPY FROM DISCRETE_PROBLEM.CPP
-              }
-            }
-          }
+          double err = state_errors[state_i * this->num + i];
+          errors_components[i] += err;
+          total_error += err;
+          this->errors[i][states[state_i]->e[i]->id] += err;
 
           if(calc_norm)
           {
-            double nrm = eval_solution_norm(this->norm_form[i][i], rm, this->sln[i]);
+            double nrm = state_norms[state_i * this->num + i];
             norms[i] += nrm;
             total_norm += nrm;
           }
-
-          errors_components[i] += err;
-          total_error += err;
-          this->errors[i][ee->e[i]->id] += err;
-
-          ee->e[i]->visited = true;
         }
       }
-      trav.finish();
+      for(segment_i = 0; segment_i < num_segments; segment_i++)
+      {
+        int i = segments[segment_i].component;
+        double central_err = segment_errors[2 * segment_i];
+        double neighb_err = segment_errors[2 * segment_i + 1];
+
+        errors_components[i] += central_err + neighb_err;
+        total_error += central_err + neighb_err;
+        this->errors[i][segments[segment_i].e->id] += central_err;
+        if(ignore_visited_segments)
+          this->errors[i][segments[segment_i].neighb->id] += neighb_err;
+      }
+
+      Traverse::free_states(states, num_states);
+      delete [] state_errors;
+      delete [] state_norms;
+      delete [] segment_errors;
 
       // Store the calculation for each solution component separately.
       if(component_errors != NULL)
@@ -460,12 +483,14 @@ namespace Hermes
         this->errors_squared_sum /= total_norm;
 
       // Prepare an ordered list of elements according to an error.
+      this->regular_queue_sorted = this->num_act_elems;
       this->fill_regular_queue(meshes);
       this->have_errors = true;
 
       if(calc_norm)
         delete [] norms;
       delete [] errors_components;
+      delete [] meshes;
 
       // Return error value.
       if((error_flags & this->HERMES_TOTAL_ERROR_MASK) == HERMES_TOTAL_ERROR_ABS)
@@ -527,14 +552,14 @@ namespace Hermes
 
     template<typename Scalar>
     double KellyTypeAdapt<Scalar>::eval_volumetric_estimator(typename KellyTypeAdapt<Scalar>::ErrorEstimatorForm* err_est_form,
-                                                             RefMap *rm)
+                                                             Solution<Scalar>** slns, RefMap *rm)
     {
       // Determine the integration order.
-      int inc = (this->sln[err_est_form->i]->get_num_components() == 2) ? 1 : 0;
+      int inc = (slns[err_est_form->i]->get_num_components() == 2) ? 1 : 0;
 
       Func<Hermes::Ord>** oi = new Func<Hermes::Ord>*[this->num];
       for (int i = 0; i < this->num; i++)
-        oi[i] = init_fn_ord(this->sln[i]->get_fn_order() + inc);
+        oi[i] = init_fn_ord(slns[i]->get_fn_order() + inc);
 
       // Polynomial order of additional external functions.
       Func<Hermes::Ord>** fake_ext_fn = new Func<Hermes::Ord>*[err_est_form->ext.size()];
@@ -568,7 +593,7 @@ namespace Hermes
       delete [] fake_ext_fn;
 
       // eval the form
-      Quad2D* quad = this->sln[err_est_form->i]->get_quad_2d();
+      Quad2D* quad = slns[err_est_form->i]->get_quad_2d();
       double3* pt = quad->get_points(order, rm->get_active_element()->get_mode());
       int np = quad->get_num_points(order, rm->get_active_element()->get_mode());
 
@@ -583,7 +608,7 @@ namespace Hermes
       Func<Scalar>** ui = new Func<Scalar>*[this->num];
 
       for (int i = 0; i < this->num; i++)
-        ui[i] = init_fn(this->sln[i], order);
+        ui[i] = init_fn(slns[i], order);
 
       Func<Scalar>** ext_fn = new Func<Scalar>*[err_est_form->ext.size()];
       for (unsigned i = 0; i < err_est_form->ext.size(); i++)
@@ -622,13 +647,13 @@ namespace Hermes
 
     template<typename Scalar>
     double KellyTypeAdapt<Scalar>::eval_boundary_estimator(typename KellyTypeAdapt<Scalar>::ErrorEstimatorForm* err_est_form,
-                                                           RefMap *rm, SurfPos* surf_pos)
+                                                           Solution<Scalar>** slns, RefMap *rm, SurfPos* surf_pos)
     {
       // Determine the integration order.
-      int inc = (this->sln[err_est_form->i]->get_num_components() == 2) ? 1 : 0;
+      int inc = (slns[err_est_form->i]->get_num_components() == 2) ? 1 : 0;
       Func<Hermes::Ord>** oi = new Func<Hermes::Ord>*[this->num];
       for (int i = 0; i < this->num; i++)
-        oi[i] = init_fn_ord(this->sln[i]->get_edge_fn_order(surf_pos->surf_num) + inc);
+        oi[i] = init_fn_ord(slns[i]->get_edge_fn_order(surf_pos->surf_num) + inc);
 
       // Polynomial order of additional external functions.
       Func<Hermes::Ord>** fake_ext_fn = new Func<Hermes::Ord>*[err_est_form->ext.size()];
@@ -659,7 +684,7 @@ namespace Hermes
       delete [] fake_ext_fn;
 
       // Evaluate the form.
-      Quad2D* quad = this->sln[err_est_form->i]->get_quad_2d();
+      Quad2D* quad = slns[err_est_form->i]->get_quad_2d();
       int eo = quad->get_edge_points(surf_pos->surf_num, order, rm->get_active_element()->get_mode());
       double3* pt = quad->get_points(eo, rm->get_active_element()->get_mode());
       int np = quad->get_num_points(eo, rm->get_active_element()->get_mode());
@@ -674,7 +699,7 @@ namespace Hermes
       // Function values
       Func<Scalar>** ui = new Func<Scalar>*[this->num];
       for (int i = 0; i < this->num; i++)
-        ui[i] = init_fn(this->sln[i], eo);
+        ui[i] = init_fn(slns[i], eo);
 
       Func<Scalar>** ext_fn = new Func<Scalar>*[err_est_form->ext.size()];
       for (unsigned i = 0; i < err_est_form->ext.size(); i++)
@@ -714,78 +739,69 @@ namespace Hermes
 
     template<typename Scalar>
     double KellyTypeAdapt<Scalar>::eval_interface_estimator(typename KellyTypeAdapt<Scalar>::ErrorEstimatorForm* err_est_form,
-                                                            RefMap *rm, SurfPos* surf_pos,
-                                                            LightArray<NeighborSearch<Scalar>*>& neighbor_searches,
-                                                            int neighbor_index)
+                                                            Solution<Scalar>* sln, NeighborSearch<Scalar>* nbs)
     {
-      NeighborSearch<Scalar>* nbs = neighbor_searches.get(neighbor_index);
-      Hermes::vector<MeshFunction<Scalar>*> slns;
-      for (int i = 0; i < this->num; i++)
-        slns.push_back(this->sln[i]);
+      Element* central_el = nbs->central_el;
+      Element* neighb_el = nbs->neighb_el;
+      int inc = (sln->get_num_components() == 2) ? 1 : 0;
+
+      // Polynomial orders from both sides of the segment.
+      sln->set_active_element(neighb_el);
+      int neighbor_order = sln->get_edge_fn_order(nbs->neighbor_edge.local_num_of_edge) + inc;
+      sln->set_active_element(central_el);
+      int central_order = sln->get_edge_fn_order(nbs->active_edge) + inc;
+
+      // Go down to the part of a bigger central element matching the neighbor.
+      if(nbs->central_transformations.present(nbs->active_segment))
+        nbs->central_transformations.get(nbs->active_segment)->apply_on(sln);
+
+      RefMap* rm = sln->get_refmap();
+      rm->force_transform(sln->get_transform(), sln->get_ctm());
 
       // Determine integration order.
-      Func<Hermes::Ord>** fake_ext_fns = new Func<Hermes::Ord>*[err_est_form->ext.size()];
-      for (unsigned int j = 0; j < err_est_form->ext.size(); j++)
-      {
-        int inc = (err_est_form->ext[j]->get_num_components() == 2) ? 1 : 0;
-        int central_order = err_est_form->ext[j]->get_edge_fn_order(neighbor_searches.get(err_est_form->ext[j]->get_mesh()->get_seq())->active_edge) + inc;
-        int neighbor_order = err_est_form->ext[j]->get_edge_fn_order(neighbor_searches.get(err_est_form->ext[j]->get_mesh()->get_seq())->neighbor_edge.local_num_of_edge) + inc;
-        fake_ext_fns[j] = new DiscontinuousFunc<Hermes::Ord>(init_fn_ord(central_order), init_fn_ord(neighbor_order));
-      }
+      DiscontinuousFunc<Hermes::Ord> ou(init_fn_ord(central_order), init_fn_ord(neighbor_order), false);
 
       // Polynomial order of geometric attributes (eg. for multiplication of a solution with coordinates, normals, etc.).
-      Geom<Hermes::Ord>* fake_e = new InterfaceGeom<Hermes::Ord>(init_geom_ord(), nbs->neighb_el->marker, nbs->neighb_el->id, Hermes::Ord(nbs->neighb_el->get_diameter()));
+      Geom<Hermes::Ord>* fake_e = new InterfaceGeom<Hermes::Ord>(init_geom_ord(), neighb_el->marker, neighb_el->id, Hermes::Ord(neighb_el->get_diameter()));
       double fake_wt = 1.0;
-      DiscontinuousFunc<Hermes::Ord> fake_ext_fns_i(fake_ext_fns[err_est_form->i], false, false);
-      
-      Hermes::Ord o = err_est_form->ord(1, &fake_wt, fake_ext_fns, &fake_ext_fns_i, fake_e, NULL);
+
+      Hermes::Ord o = err_est_form->ord(1, &fake_wt, NULL, &ou, fake_e, NULL);
 
       int order = rm->get_inv_ref_order();
       order += o.get_order();
 
-      limit_order(order, rm->get_active_element()->get_mode());
+      limit_order(order, central_el->get_mode());
 
       // Clean up.
-      for (int i = 0; i < this->num; i++)
-      {
-        fake_ext_fns[i]->free_ord();
-        delete fake_ext_fns[i];
-      }
-      delete [] fake_ext_fns;
-
+      ou.free_ord();
       fake_e->free_ord();
       delete fake_e;
 
-      //delete fake_ext;
-
-      Quad2D* quad = this->sln[err_est_form->i]->get_quad_2d();
-      int eo = quad->get_edge_points(surf_pos->surf_num, order, rm->get_active_element()->get_mode());
-      int np = quad->get_num_points(eo, rm->get_active_element()->get_mode());
-      double3* pt = quad->get_points(eo, rm->get_active_element()->get_mode());
+      Quad2D* quad = sln->get_quad_2d();
+      int eo = quad->get_edge_points(nbs->active_edge, order, central_el->get_mode());
+      int np = quad->get_num_points(eo, central_el->get_mode());
+      double3* pt = quad->get_points(eo, central_el->get_mode());
 
       // Initialize geometry and jacobian*weights (do not use the NeighborSearch caching mechanism).
       double3* tan;
-      Geom<double>* e = new InterfaceGeom<double>(init_geom_surf(rm, surf_pos->surf_num, surf_pos->marker, eo, tan),
-                                                  nbs->neighb_el->marker,
-                                                  nbs->neighb_el->id,
-                                                  nbs->neighb_el->get_diameter());
+      Geom<double>* e = new InterfaceGeom<double>(init_geom_surf(rm, nbs->active_edge, central_el->en[nbs->active_edge]->marker, eo, tan),
+                                                  neighb_el->marker,
+                                                  neighb_el->id,
+                                                  neighb_el->get_diameter());
 
       double* jwt = new double[np];
       for(int i = 0; i < np; i++)
         jwt[i] = pt[i][2] * tan[i][2];
 
       // Function values.
-      DiscontinuousFunc<Scalar>** ui = this->dp.init_ext_fns(slns, neighbor_searches, order, 0);
+      nbs->set_quad_order(order);
+      DiscontinuousFunc<Scalar>* ui = nbs->init_ext_fn(sln);
 
       Scalar res = interface_scaling_const *
-        err_est_form->value(np, jwt, NULL, ui[err_est_form->i], e, NULL);
+        err_est_form->value(np, jwt, NULL, ui, e, NULL);
 
-      if(ui != NULL)
-      {
-        for(unsigned int i = 0; i < slns.size(); i++)
-          ui[i]->free_fn();
-        delete [] ui;
-      }
+      ui->free_fn();
+      delete ui;
 
       e->free();
       delete e;
@@ -797,6 +813,44 @@ namespace Hermes
                                   // the weights.
     }
 
+    template<typename Scalar>
+    void KellyTypeAdapt<Scalar>::get_interface_segments(int component, const Mesh* mesh, Hermes::vector<InterfaceSegment>& segments) const
+    {
+      const EdgeNeighborTable* table = mesh->get_edge_neighbor_table();
+
+      Element* e;
+      for_all_active_elements(e, mesh)
+      {
+        for (int edge = 0; edge < e->get_nvert(); edge++)
+        {
+          if(e->en[edge]->bnd)
+            continue;
+
+          // With ignore_visited_segments, a go-up segment is listed from the bigger neighbor
+          // and a segment between elements of the same size from the one with the lower id.
+          int neighborhood_type = table->get_neighborhood_type(e, edge);
+          if(ignore_visited_segments && neighborhood_type == NeighborSearch<Scalar>::H2D_DG_GO_UP)
+            continue;
+
+          int num_neighbors;
+          const EdgeNeighborTable::Neighbor* neighbors = table->get_neighbors(e, edge, num_neighbors);
+          for (int neighbor = 0; neighbor < num_neighbors; neighbor++)
+          {
+            if(ignore_visited_segments && neighborhood_type == NeighborSearch<Scalar>::H2D_DG_NO_TRANSF && neighbors[neighbor].element->id < e->id)
+              continue;
+
+            InterfaceSegment segment;
+            segment.component = component;
+            segment.e = e;
+            segment.edge = edge;
+            segment.neighbor = neighbor;
+            segment.neighb = neighbors[neighbor].element;
+            segments.push_back(segment);
+          }
+        }
+      }
+    }
+
     // #endif
     template HERMES_API class KellyTypeAdapt<double>;
     template HERMES_API class KellyTypeAdapt<std::complex<double> >;
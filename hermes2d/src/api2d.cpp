@@ -49,6 +49,9 @@ namespace Hermes
       XMLPlatformUtils::Initialize();   
 
       this->integral_parameters.insert(std::pair<Hermes2DApiParam, Parameter<int>*> (Hermes::Hermes2D::numThreads,new Parameter<int>(NUM_THREADS)));
+      this->integral_parameters.insert(std::pair<Hermes2DApiParam, Parameter<int>*> (Hermes::Hermes2D::xmlStreaming,new Parameter<int>(0)));
+      this->integral_parameters.insert(std::pair<Hermes2DApiParam, Parameter<int>*> (Hermes::Hermes2D::precalcSharedCacheSize,new Parameter<int>(256)));
+      this->integral_parameters.insert(std::pair<Hermes2DApiParam, Parameter<int>*> (Hermes::Hermes2D::compensatedSummation,new Parameter<int>(0)));
       this->text_parameters.insert(std::pair<Hermes2DApiParam, Parameter<std::string>*> (Hermes::Hermes2D::xmlSchemasDirPath,new Parameter<std::string>(*(new std::string(H2D_XML_SCHEMAS_DIRECTORY)))));
       std::stringstream ss;
       ss << H2D_PRECALCULATED_FORMS_DIRECTORY;
@@ -61,6 +64,11 @@ namespace Hermes
       }
 
       XMLPlatformUtils::Terminate();
+
+      this->num_threads = this->get_integral_param_value(Hermes::Hermes2D::numThreads);
+      this->xml_streaming = this->get_integral_param_value(Hermes::Hermes2D::xmlStreaming) != 0;
+      this->precalc_shared_cache_size = this->get_integral_param_value(Hermes::Hermes2D::precalcSharedCacheSize);
+      this->compensated_summation = this->get_integral_param_value(Hermes::Hermes2D::compensatedSummation) != 0;
     }
 
     Api2D::~Api2D()
@@ -88,6 +96,51 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Wrong Hermes::Api parameter name:%i", param);
       this->integral_parameters.find(param)->second->user_set = true;
       this->integral_parameters.find(param)->second->user_val = value;
+
+      switch(param)
+      {
+      case Hermes::Hermes2D::numThreads:
+        this->num_threads = value;
+        // The direct solvers (SuperLU_MT) run on the threads of the assembly.
+        Hermes::HermesCommonApi.set_integral_param_value(Hermes::matrixSolverNumThreads, value);
+        break;
+      case Hermes::Hermes2D::xmlStreaming:
+        this->xml_streaming = value != 0;
+        break;
+      case Hermes::Hermes2D::precalcSharedCacheSize:
+        this->precalc_shared_cache_size = value;
+        break;
+      case Hermes::Hermes2D::compensatedSummation:
+        this->compensated_summation = value != 0;
+        break;
+      default:
+        break;
+      }
+
+      this->param_changed(param, value);
+    }
+
+    void Api2D::param_changed(Hermes2DApiParam param, int value)
+    {
+      for(unsigned int i = 0; i < this->param_changed_callbacks.size(); i++)
+        this->param_changed_callbacks[i].first(param, value, this->param_changed_callbacks[i].second);
+    }
+
+    void Api2D::add_param_changed_callback(ParamChangedCallback callback, void* data)
+    {
+      this->param_changed_callbacks.push_back(std::pair<ParamChangedCallback, void*>(callback, data));
+    }
+
+    void Api2D::remove_param_changed_callback(ParamChangedCallback callback, void* data)
+    {
+      for(unsigned int i = 0; i < this->param_changed_callbacks.size(); i++)
+      {
+        if(this->param_changed_callbacks[i].first == callback && this->param_changed_callbacks[i].second == data)
+        {
+          this->param_changed_callbacks.erase(this->param_changed_callbacks.begin() + i);
+          return;
+        }
+      }
     }
 
     std::string Api2D::get_text_param_value(Hermes2DApiParam param)
@@ -106,6 +159,8 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Wrong Hermes::Api parameter name:%i", param);
       this->text_parameters.find(param)->second->user_set = true;
       this->text_parameters.find(param)->second->user_val = value;
+
+      this->param_changed(param, 0);
     }
 
     Hermes::Hermes2D::Api2D HERMES_API Hermes2DApi;
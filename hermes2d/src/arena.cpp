@@ -0,0 +1,97 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "arena.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    Arena::Arena(size_t block_size) : current_block(0), offset(0), used(0)
+    {
+      this->add_block(block_size);
+    }
+
+    Arena::~Arena()
+    {
+      for(unsigned int i = 0; i < this->blocks.size(); i++)
+        delete [] this->blocks[i].data;
+    }
+
+    void Arena::add_block(size_t min_size)
+    {
+      Block block;
+      // Room for aligning the start of the block.
+      block.size = min_size + H2D_ARENA_ALIGNMENT;
+      block.data = new char[block.size];
+      this->blocks.push_back(block);
+    }
+
+    void* Arena::allocate(size_t bytes)
+    {
+      while(true)
+      {
+        Block& block = this->blocks[this->current_block];
+        size_t address = (size_t)(block.data + this->offset);
+        size_t padding = (H2D_ARENA_ALIGNMENT - address % H2D_ARENA_ALIGNMENT) % H2D_ARENA_ALIGNMENT;
+        if(this->offset + padding + bytes <= block.size)
+        {
+          this->offset += padding + bytes;
+          this->used += bytes;
+          return (void*)(address + padding);
+        }
+
+        // Next block, a new one at least twice the size of the last one.
+        this->current_block++;
+        this->offset = 0;
+        if(this->current_block == this->blocks.size())
+          this->add_block(std::max(bytes, 2 * this->blocks.back().size));
+      }
+    }
+
+    void Arena::reset()
+    {
+      if(this->current_block > 0)
+      {
+        // The state needed more than one block, replace all of them by one large enough.
+        size_t size = 0;
+        for(unsigned int i = 0; i < this->blocks.size(); i++)
+        {
+          size += this->blocks[i].size;
+          delete [] this->blocks[i].data;
+        }
+        this->blocks.clear();
+        this->add_block(std::max(size, this->used + this->used / 4));
+      }
+
+      this->current_block = 0;
+      this->offset = 0;
+      this->used = 0;
+    }
+
+    size_t Arena::get_reserved_size() const
+    {
+      size_t size = 0;
+      for(unsigned int i = 0; i < this->blocks.size(); i++)
+        size += this->blocks[i].size;
+      return size;
+    }
+
+    size_t Arena::get_used_size() const
+    {
+      return this->used;
+    }
+  }
+}
@@ -0,0 +1,176 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "assembly_profile.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    AssemblyProfile::AssemblyProfile()
+    {
+      this->reset();
+    }
+
+    void AssemblyProfile::reset()
+    {
+      for(int i = 0; i < NumPhases; i++)
+        this->times[i] = 0.0;
+      this->states = this->forms_evaluated = this->cache_hits = this->cache_misses = this->scatter_operations = this->bytes_allocated = 0;
+      this->forms.clear();
+      this->active_phase = -1;
+      this->phase_start = 0.0;
+    }
+
+    void AssemblyProfile::add(const AssemblyProfile& other)
+    {
+      for(int i = 0; i < NumPhases; i++)
+        this->times[i] += other.times[i];
+      this->states += other.states;
+      this->forms_evaluated += other.forms_evaluated;
+      this->cache_hits += other.cache_hits;
+      this->cache_misses += other.cache_misses;
+      this->scatter_operations += other.scatter_operations;
+      this->bytes_allocated += other.bytes_allocated;
+      if(this->forms.size() < other.forms.size())
+        this->forms.resize(other.forms.size());
+      for(unsigned int i = 0; i < other.forms.size(); i++)
+        this->forms[i].add(other.forms[i]);
+    }
+
+    double AssemblyProfile::get_time(Phase phase) const
+    {
+      return this->times[phase];
+    }
+
+    double AssemblyProfile::get_total_time() const
+    {
+      double total = 0.0;
+      for(int i = 0; i < NumPhases; i++)
+        total += this->times[i];
+      return total;
+    }
+
+    const char* AssemblyProfile::get_phase_name(Phase phase)
+    {
+      static const char* names[NumPhases] = { "traversal", "geometry", "shape precalculation", "order estimation", "form evaluation", "scatter" };
+      return names[phase];
+    }
+
+    FormProfile::FormProfile()
+    {
+      this->reset();
+    }
+
+    void FormProfile::reset()
+    {
+      this->evaluations = this->sampled_evaluations = this->order_sum = this->points_sum = this->ord_calls = this->skipped = 0;
+      this->sampled_time = this->ord_time = 0.0;
+    }
+
+    void FormProfile::add(const FormProfile& other)
+    {
+      this->evaluations += other.evaluations;
+      this->sampled_evaluations += other.sampled_evaluations;
+      this->sampled_time += other.sampled_time;
+      this->order_sum += other.order_sum;
+      this->points_sum += other.points_sum;
+      this->ord_calls += other.ord_calls;
+      this->ord_time += other.ord_time;
+      this->skipped += other.skipped;
+    }
+
+    double FormProfile::get_evaluation_time() const
+    {
+      if(this->sampled_evaluations == 0)
+        return 0.0;
+      return this->sampled_time * (double)this->evaluations / (double)this->sampled_evaluations;
+    }
+
+    double FormProfile::get_average_order() const
+    {
+      return this->evaluations == 0 ? 0.0 : (double)this->order_sum / (double)this->evaluations;
+    }
+
+    double FormProfile::get_average_points() const
+    {
+      return this->evaluations == 0 ? 0.0 : (double)this->points_sum / (double)this->evaluations;
+    }
+
+    FormProfile::Evaluation::Evaluation(FormProfile* profile, int order, int n_quadrature_points) : profile(NULL), start(0.0)
+    {
+      if(profile == NULL)
+        return;
+      profile->order_sum += order;
+      profile->points_sum += n_quadrature_points;
+      // The first evaluation and then every H2D_FORM_PROFILE_SAMPLING-th one.
+      if(profile->evaluations++ % H2D_FORM_PROFILE_SAMPLING == 0)
+      {
+        this->profile = profile;
+        this->start = omp_get_wtime();
+      }
+    }
+
+    FormProfile::Evaluation::~Evaluation()
+    {
+      if(this->profile == NULL)
+        return;
+      this->profile->sampled_time += omp_get_wtime() - this->start;
+      this->profile->sampled_evaluations++;
+    }
+
+    FormProfile::OrdCall::OrdCall(FormProfile* profile) : profile(profile), start(0.0)
+    {
+      if(profile != NULL)
+        this->start = omp_get_wtime();
+    }
+
+    FormProfile::OrdCall::~OrdCall()
+    {
+      if(this->profile == NULL)
+        return;
+      this->profile->ord_time += omp_get_wtime() - this->start;
+      this->profile->ord_calls++;
+    }
+
+    AssemblyProfile::Timer::Timer(AssemblyProfile* profile, Phase phase) : profile(profile), phase(phase), enclosing_phase(-1)
+    {
+      if(profile == NULL)
+        return;
+      double now = omp_get_wtime();
+      if(profile->active_phase >= 0)
+        profile->times[profile->active_phase] += now - profile->phase_start;
+      this->enclosing_phase = profile->active_phase;
+      profile->active_phase = phase;
+      profile->phase_start = now;
+    }
+
+    AssemblyProfile::Timer::~Timer()
+    {
+      this->stop();
+    }
+
+    void AssemblyProfile::Timer::stop()
+    {
+      if(this->profile == NULL)
+        return;
+      double now = omp_get_wtime();
+      this->profile->times[this->phase] += now - this->profile->phase_start;
+      this->profile->active_phase = this->enclosing_phase;
+      this->profile->phase_start = now;
+      this->profile = NULL;
+    }
+  }
+}
@@ -0,0 +1,397 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "async_output.h"
+#include "views/linearizer.h"
+#include <memory>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    AsyncOutput<Scalar>::AsyncOutput(int max_queued_jobs) : max_queued_jobs(max_queued_jobs), writing(false), should_quit(false), caughtException(NULL)
+    {
+      if(max_queued_jobs < 1)
+        throw Exceptions::ValueException("max_queued_jobs", max_queued_jobs, 1);
+
+      pthread_mutex_init(&this->mutex, NULL);
+      pthread_cond_init(&this->cond_job_queued, NULL);
+      pthread_cond_init(&this->cond_job_written, NULL);
+      if(pthread_create(&this->thread, NULL, thread_func, this) != 0)
+      {
+        pthread_cond_destroy(&this->cond_job_written);
+        pthread_cond_destroy(&this->cond_job_queued);
+        pthread_mutex_destroy(&this->mutex);
+        throw Hermes::Exceptions::Exception("Could not create the output thread of AsyncOutput.");
+      }
+    }
+
+    template<typename Scalar>
+    AsyncOutput<Scalar>::~AsyncOutput()
+    {
+      // The thread writes the queued jobs before quitting.
+      pthread_mutex_lock(&this->mutex);
+      this->should_quit = true;
+      pthread_cond_broadcast(&this->cond_job_queued);
+      pthread_mutex_unlock(&this->mutex);
+      pthread_join(this->thread, NULL);
+
+      for(typename std::map<Mesh*, MeshSnapshot*>::iterator it = this->snapshots.begin(); it != this->snapshots.end(); it++)
+        this->release(it->second);
+
+      if(this->caughtException != NULL)
+        delete this->caughtException;
+
+      pthread_cond_destroy(&this->cond_job_written);
+      pthread_cond_destroy(&this->cond_job_queued);
+      pthread_mutex_destroy(&this->mutex);
+    }
+
+    template<typename Scalar>
+    void* AsyncOutput<Scalar>::thread_func(void* param)
+    {
+      AsyncOutput<Scalar>* output = (AsyncOutput<Scalar>*)param;
+      pthread_mutex_lock(&output->mutex);
+      while(true)
+      {
+        while(output->jobs.empty() && !output->should_quit)
+          pthread_cond_wait(&output->cond_job_queued, &output->mutex);
+        if(output->jobs.empty())
+          break;
+
+        Job* job = output->jobs.front();
+        output->jobs.pop_front();
+        output->writing = true;
+        pthread_mutex_unlock(&output->mutex);
+
+        // A failed job does not stop the writing of the other ones.
+        Hermes::Exceptions::Exception* exception = NULL;
+        try
+        {
+          output->write(job);
+        }
+        catch(Hermes::Exceptions::Exception& e)
+        {
+          exception = e.clone();
+        }
+        catch(std::exception& e)
+        {
+          exception = new Hermes::Exceptions::Exception(e.what());
+        }
+        output->free_job(job);
+
+        pthread_mutex_lock(&output->mutex);
+        if(exception != NULL)
+        {
+          if(output->caughtException == NULL)
+            output->caughtException = exception;
+          else
+            delete exception;
+        }
+        output->writing = false;
+        pthread_cond_broadcast(&output->cond_job_written);
+      }
+      pthread_mutex_unlock(&output->mutex);
+      return NULL;
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::rethrow_caught_exception()
+    {
+      pthread_mutex_lock(&this->mutex);
+      std::auto_ptr<Hermes::Exceptions::Exception> exception(this->caughtException);
+      this->caughtException = NULL;
+      pthread_mutex_unlock(&this->mutex);
+      if(exception.get() != NULL)
+        throw *exception;
+    }
+
+    template<typename Scalar>
+    typename AsyncOutput<Scalar>::MeshSnapshot* AsyncOutput<Scalar>::snapshot(Mesh* mesh)
+    {
+      // Only this thread changes the map, the background one releases the snapshots of the written jobs.
+      typename std::map<Mesh*, MeshSnapshot*>::iterator it = this->snapshots.find(mesh);
+      if(it != this->snapshots.end() && it->second->seq == mesh->get_seq())
+      {
+        pthread_mutex_lock(&this->mutex);
+        it->second->references++;
+        pthread_mutex_unlock(&this->mutex);
+        return it->second;
+      }
+
+      MeshSnapshot* new_snapshot = new MeshSnapshot;
+      new_snapshot->mesh = new Mesh;
+      new_snapshot->mesh->copy(mesh);
+      new_snapshot->seq = mesh->get_seq();
+      // The current snapshot of the mesh and the job.
+      new_snapshot->references = 2;
+
+      if(it != this->snapshots.end())
+      {
+        this->release(it->second);
+        it->second = new_snapshot;
+      }
+      else
+        this->snapshots.insert(std::pair<Mesh*, MeshSnapshot*>(mesh, new_snapshot));
+      return new_snapshot;
+    }
+
+    template<typename Scalar>
+    Solution<Scalar>* AsyncOutput<Scalar>::snapshot(Solution<Scalar>* sln, Job* job)
+    {
+      if(sln->get_type() != HERMES_SLN)
+        throw Hermes::Exceptions::Exception("Only the solutions given by element coefficients can be written by AsyncOutput.");
+
+      // The copy of a lazily converted Solution would still need its space.
+      sln->finish_lazy_conversion();
+      Solution<Scalar>* copy = new Solution<Scalar>();
+      copy->copy(sln);
+      job->slns.push_back(copy);
+      if(sln->get_mesh() != NULL)
+      {
+        MeshSnapshot* mesh_snapshot = this->snapshot(const_cast<Mesh*>(sln->get_mesh()));
+        job->meshes.push_back(mesh_snapshot);
+        copy->mesh = mesh_snapshot->mesh;
+      }
+      return copy;
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::release(MeshSnapshot* snapshot)
+    {
+      pthread_mutex_lock(&this->mutex);
+      bool unused = (--snapshot->references == 0);
+      pthread_mutex_unlock(&this->mutex);
+      if(unused)
+      {
+        delete snapshot->mesh;
+        delete snapshot;
+      }
+    }
+
+    template<typename Scalar>
+    typename AsyncOutput<Scalar>::Job* AsyncOutput<Scalar>::new_job(JobType type)
+    {
+      this->rethrow_caught_exception();
+      Job* job = new Job;
+      job->type = type;
+      job->mode_3D = true;
+      job->item = H2D_FN_VAL_0;
+      job->eps = Views::HERMES_EPS_NORMAL;
+      job->record = NULL;
+      return job;
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::free_job(Job* job)
+    {
+      for(unsigned int i = 0; i < job->slns.size(); i++)
+        delete job->slns[i];
+      for(unsigned int i = 0; i < job->meshes.size(); i++)
+        this->release(job->meshes[i]);
+      delete job;
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::enqueue(Job* job)
+    {
+      pthread_mutex_lock(&this->mutex);
+      while((int)this->jobs.size() >= this->max_queued_jobs)
+        pthread_cond_wait(&this->cond_job_written, &this->mutex);
+      this->jobs.push_back(job);
+      pthread_cond_signal(&this->cond_job_queued);
+      pthread_mutex_unlock(&this->mutex);
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::wait()
+    {
+      pthread_mutex_lock(&this->mutex);
+      while(!this->jobs.empty() || this->writing)
+        pthread_cond_wait(&this->cond_job_written, &this->mutex);
+      pthread_mutex_unlock(&this->mutex);
+      this->rethrow_caught_exception();
+    }
+
+    static void save_vtk(Solution<double>* sln, const char* filename, const char* quantity_name, bool mode_3D, int item, double eps)
+    {
+      Views::Linearizer linearizer;
+      linearizer.save_solution_vtk(sln, filename, quantity_name, mode_3D, item, eps);
+    }
+
+    static void save_vtk(Solution<std::complex<double> >* sln, const char* filename, const char* quantity_name, bool mode_3D, int item, double eps)
+    {
+      throw Hermes::Exceptions::Exception("Linearizer::save_solution_vtk() is available for real solutions only.");
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::write(Job* job)
+    {
+      switch(job->type)
+      {
+      case saveSolution:
+        job->slns[0]->save(job->filename.c_str());
+        break;
+      case saveSolutionBinary:
+        job->slns[0]->save_binary(job->filename.c_str());
+        break;
+      case saveSolutionVtk:
+        save_vtk(job->slns[0], job->filename.c_str(), job->quantity_name.c_str(), job->mode_3D, job->item, job->eps);
+        break;
+      case saveRecord:
+        job->record->save_meshes(job->record_meshes);
+        if(!job->slns.empty())
+          job->record->save_solutions(job->slns);
+        break;
+      }
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::save_solution(Solution<Scalar>* sln, const char* filename)
+    {
+      Job* job = this->new_job(saveSolution);
+      job->filename = filename;
+      try
+      {
+        this->snapshot(sln, job);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      this->enqueue(job);
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::save_solution_binary(Solution<Scalar>* sln, const char* filename)
+    {
+      Job* job = this->new_job(saveSolutionBinary);
+      job->filename = filename;
+      try
+      {
+        this->snapshot(sln, job);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      this->enqueue(job);
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::save_solution_vtk(Solution<Scalar>* sln, const char* filename, const char* quantity_name, bool mode_3D, int item, double eps)
+    {
+      if(sizeof(Scalar) != sizeof(double))
+        throw Hermes::Exceptions::Exception("Linearizer::save_solution_vtk() is available for real solutions only.");
+
+      Job* job = this->new_job(saveSolutionVtk);
+      job->filename = filename;
+      job->quantity_name = quantity_name;
+      job->mode_3D = mode_3D;
+      job->item = item;
+      job->eps = eps;
+      try
+      {
+        this->snapshot(sln, job);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      this->enqueue(job);
+    }
+
+    template<typename Scalar>
+    typename AsyncOutput<Scalar>::Job* AsyncOutput<Scalar>::new_record_job(Hermes::vector<Mesh*> meshes, Hermes::vector<Solution<Scalar>*> slns)
+    {
+      Job* job = this->new_job(saveRecord);
+      try
+      {
+        for(unsigned int i = 0; i < meshes.size(); i++)
+        {
+          MeshSnapshot* mesh_snapshot = this->snapshot(meshes[i]);
+          job->meshes.push_back(mesh_snapshot);
+          job->record_meshes.push_back(mesh_snapshot->mesh);
+        }
+        for(unsigned int i = 0; i < slns.size(); i++)
+          this->snapshot(slns[i], job);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      return job;
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::add_record(CalculationContinuity<Scalar>* continuity, double time, unsigned int number, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces, Hermes::vector<Solution<Scalar>*> slns, double time_step, double time_step_n_minus_one, double error)
+    {
+      Job* job = this->new_record_job(meshes, slns);
+      try
+      {
+        continuity->add_record(time, number, Hermes::vector<Mesh*>(), spaces, Hermes::vector<Solution<Scalar>*>(), time_step, time_step_n_minus_one, error);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      job->record = continuity->get_last_record();
+      this->enqueue(job);
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::add_record(CalculationContinuity<Scalar>* continuity, double time, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces, Hermes::vector<Solution<Scalar>*> slns, double time_step, double time_step_n_minus_one, double error)
+    {
+      Job* job = this->new_record_job(meshes, slns);
+      try
+      {
+        continuity->add_record(time, Hermes::vector<Mesh*>(), spaces, Hermes::vector<Solution<Scalar>*>(), time_step, time_step_n_minus_one, error);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      job->record = continuity->get_last_record();
+      this->enqueue(job);
+    }
+
+    template<typename Scalar>
+    void AsyncOutput<Scalar>::add_record(CalculationContinuity<Scalar>* continuity, unsigned int number, Hermes::vector<Mesh*> meshes, Hermes::vector<Space<Scalar>*> spaces, Hermes::vector<Solution<Scalar>*> slns, double time_step, double time_step_n_minus_one, double error)
+    {
+      Job* job = this->new_record_job(meshes, slns);
+      try
+      {
+        continuity->add_record(number, Hermes::vector<Mesh*>(), spaces, Hermes::vector<Solution<Scalar>*>(), time_step, time_step_n_minus_one, error);
+      }
+      catch(std::exception&)
+      {
+        this->free_job(job);
+        throw;
+      }
+      job->record = continuity->get_last_record();
+      this->enqueue(job);
+    }
+
+    template class HERMES_API AsyncOutput<double>;
+    template class HERMES_API AsyncOutput<std::complex<double> >;
+  }
+}
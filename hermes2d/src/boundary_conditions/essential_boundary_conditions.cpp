@@ -43,6 +43,13 @@ namespace Hermes
     {
     }
 
+    template<typename Scalar>
+    void EssentialBoundaryCondition<Scalar>::values(int n, const double* x, const double* y, const double* n_x, const double* n_y, const double* t_x, const double* t_y, Scalar* result) const
+    {
+      for (int i = 0; i < n; i++)
+        result[i] = this->value(x[i], y[i], n_x[i], n_y[i], t_x[i], t_y[i]);
+    }
+
     template<typename Scalar>
     void EssentialBoundaryCondition<Scalar>::set_current_time(double time)
     {
@@ -19,7 +19,12 @@
 #include "space_hdiv.h"
 #include "space_hcurl.h"
 #include "space_l2.h"
+#include "mesh_reader_h2d_binary.h"
 #include <fstream>
+#include <cstdio>
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
 
 namespace Hermes
 {
@@ -100,7 +105,7 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    CalculationContinuity<Scalar>::CalculationContinuity(IdentificationMethod identification_method) : last_record(NULL), record_available(false), identification_method(identification_method), num(0)
+    CalculationContinuity<Scalar>::CalculationContinuity(IdentificationMethod identification_method) : last_record(NULL), record_available(false), identification_method(identification_method), num(0), record_format(xmlRecords), compression(false)
     {
       double last_time;
       unsigned int last_number;
@@ -146,16 +151,19 @@ namespace Hermes
         {
         case timeAndNumber:
           record = new CalculationContinuity<Scalar>::Record(last_time, last_number);
+          record->continuity = this;
           this->records.insert(std::pair<std::pair<double, unsigned int>, CalculationContinuity<Scalar>::Record*>(std::pair<double, unsigned int>(last_time, last_number), record));
           this->last_record = record;
           break;
         case onlyTime:
           record = new CalculationContinuity<Scalar>::Record(last_time);
+          record->continuity = this;
           this->time_records.insert(std::pair<double, CalculationContinuity<Scalar>::Record*>(last_time, record));
           this->last_record = record;
           break;
         case onlyNumber:
           record = new CalculationContinuity<Scalar>::Record(last_number);
+          record->continuity = this;
           this->numbered_records.insert(std::pair<unsigned int, CalculationContinuity<Scalar>::Record*>(last_number, record));
           this->last_record = record;
           break;
@@ -176,6 +184,7 @@ namespace Hermes
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "timeAndNumber.h2d");
 
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(time, number);
+      record->continuity = this;
       record->save_mesh(mesh);
       if(space != NULL)
         record->save_space(space);
@@ -205,6 +214,7 @@ namespace Hermes
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "timeAndNumber.h2d");
 
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(time, number);
+      record->continuity = this;
       record->save_meshes(meshes);
       if(spaces != Hermes::vector<Space<Scalar>*>())
         record->save_spaces(spaces);
@@ -234,6 +244,7 @@ namespace Hermes
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "onlyTime.h2d");
 
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(time);
+      record->continuity = this;
       record->save_mesh(mesh);
       if(space != NULL)
         record->save_space(space);
@@ -262,6 +273,7 @@ namespace Hermes
       else
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "onlyTime.h2d");
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(time);
+      record->continuity = this;
       record->save_meshes(meshes);
       if(spaces != Hermes::vector<Space<Scalar>*>())
         record->save_spaces(spaces);
@@ -290,6 +302,7 @@ namespace Hermes
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "onlyNumber.h2d");
 
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(number);
+      record->continuity = this;
       record->save_mesh(mesh);
       if(space != NULL)
         record->save_space(space);
@@ -319,6 +332,7 @@ namespace Hermes
         throw IOCalculationContinuityException(CalculationContinuityException::general, IOCalculationContinuityException::output, "onlyNumber.h2d");
 
       CalculationContinuity<Scalar>::Record* record = new CalculationContinuity<Scalar>::Record(number);
+      record->continuity = this;
       record->save_meshes(meshes);
       if(spaces != Hermes::vector<Space<Scalar>*>())
         record->save_spaces(spaces);
@@ -335,17 +349,17 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    CalculationContinuity<Scalar>::Record::Record(double time, unsigned int number) : time(time), number(number)
+    CalculationContinuity<Scalar>::Record::Record(double time, unsigned int number) : continuity(NULL), time(time), number(number)
     {
     }
 
     template<typename Scalar>
-    CalculationContinuity<Scalar>::Record::Record(double time) : time(time), number(0)
+    CalculationContinuity<Scalar>::Record::Record(double time) : continuity(NULL), time(time), number(0)
     {
     }
 
     template<typename Scalar>
-    CalculationContinuity<Scalar>::Record::Record(unsigned int number) : time(0.0), number(number)
+    CalculationContinuity<Scalar>::Record::Record(unsigned int number) : continuity(NULL), time(0.0), number(number)
     {
     }
 
@@ -371,105 +385,292 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::save_meshes(Hermes::vector<Mesh*> meshes)
+    void CalculationContinuity<Scalar>::set_record_format(RecordFormat record_format)
     {
-      MeshReaderH2DXML reader;
-      for(unsigned int i = 0; i < meshes.size(); i++)
+      this->record_format = record_format;
+    }
+
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::set_compression(bool compression)
+    {
+#ifndef WITH_ZLIB
+      if(compression)
+        throw CalculationContinuityException(CalculationContinuityException::general, "compression of the records needs Hermes built WITH_ZLIB");
+#endif
+      this->compression = compression;
+    }
+
+    static bool file_exists(const std::string& filename)
+    {
+      FILE* f = fopen(filename.c_str(), "rb");
+      if(f == NULL)
+        return false;
+      fclose(f);
+      return true;
+    }
+
+    static bool has_suffix(const std::string& filename, const std::string& suffix)
+    {
+      return filename.size() >= suffix.size() && filename.compare(filename.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    // The binary meshes and solutions are saved next to the name of the XML file, the compressed files with ".gz" appended.
+    static std::string binary_file_name(const std::string& filename)
+    {
+      return filename + "b";
+    }
+
+    // A record with a mesh unchanged since the previous one holds the name of the file of the mesh in this file.
+    static std::string mesh_reference_file_name(const std::string& filename)
+    {
+      return filename + "r";
+    }
+
+    // Compresses the file into the file with ".gz" appended, removes the original one.
+    static std::string compress_file(const std::string& filename, CalculationContinuityException::exceptionEntityType type)
+    {
+      std::string compressed_filename = filename + ".gz";
+#ifdef WITH_ZLIB
+      FILE* in = fopen(filename.c_str(), "rb");
+      if(in == NULL)
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::input, filename.c_str());
+      gzFile out = gzopen(compressed_filename.c_str(), "wb1");
+      if(out == NULL)
       {
-        std::stringstream filename;
-        filename << CalculationContinuity<Scalar>::mesh_file_name << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-        try
-        {
-          reader.save(filename.str().c_str(), meshes[i]);
-        }
-        catch(std::exception& e)
-        {
-          throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
-        }
+        fclose(in);
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::output, compressed_filename.c_str());
+      }
+      char buffer[65536];
+      size_t read;
+      bool ok = true;
+      while(ok && (read = fread(buffer, 1, sizeof(buffer), in)) > 0)
+        ok = gzwrite(out, buffer, (unsigned) read) == (int) read;
+      fclose(in);
+      ok = (gzclose(out) == Z_OK) && ok;
+      if(!ok)
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::output, compressed_filename.c_str(), "compression failed");
+      remove(filename.c_str());
+#else
+      throw IOCalculationContinuityException(type, IOCalculationContinuityException::output, compressed_filename.c_str(), "Hermes built without zlib");
+#endif
+      return compressed_filename;
+    }
+
+    // Decompresses the ".gz" file into the file without the suffix, which the caller removes after loading it.
+    static std::string decompress_file(const std::string& filename, CalculationContinuityException::exceptionEntityType type)
+    {
+      std::string decompressed_filename = filename.substr(0, filename.size() - 3);
+#ifdef WITH_ZLIB
+      gzFile in = gzopen(filename.c_str(), "rb");
+      if(in == NULL)
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::input, filename.c_str());
+      FILE* out = fopen(decompressed_filename.c_str(), "wb");
+      if(out == NULL)
+      {
+        gzclose(in);
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::output, decompressed_filename.c_str());
       }
+      char buffer[65536];
+      int read;
+      bool ok = true;
+      while(ok && (read = gzread(in, buffer, sizeof(buffer))) > 0)
+        ok = fwrite(buffer, 1, read, out) == (size_t) read;
+      ok = ok && read == 0;
+      gzclose(in);
+      fclose(out);
+      if(!ok)
+      {
+        remove(decompressed_filename.c_str());
+        throw IOCalculationContinuityException(type, IOCalculationContinuityException::input, filename.c_str(), "decompression failed");
+      }
+#else
+      throw IOCalculationContinuityException(type, IOCalculationContinuityException::input, filename.c_str(), "Hermes built without zlib");
+#endif
+      return decompressed_filename;
     }
+
+    // The file the entity of a record was saved into: compressed binary, binary, or the XML one of filename.
+    static std::string find_record_file(const std::string& filename)
+    {
+      if(file_exists(binary_file_name(filename) + ".gz"))
+        return binary_file_name(filename) + ".gz";
+      if(file_exists(binary_file_name(filename)))
+        return binary_file_name(filename);
+      return filename;
+    }
+
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::save_mesh(Mesh* mesh)
+    std::string CalculationContinuity<Scalar>::Record::file_name(const std::string& prefix, unsigned int i) const
     {
-      MeshReaderH2DXML reader;
       std::stringstream filename;
-      filename << CalculationContinuity<Scalar>::mesh_file_name << 0 << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
+      filename << prefix << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
+      return filename.str();
+    }
+
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_mesh_file(unsigned int i, Mesh* mesh)
+    {
+      std::string filename = this->file_name(CalculationContinuity<Scalar>::mesh_file_name, i);
+      if(this->meshFiles.size() <= i)
+        this->meshFiles.resize(i + 1);
       try
       {
-        reader.save(filename.str().c_str(), mesh);
+        // An unchanged mesh is only referred to, in a file for loading the record after a restart.
+        if(this->continuity != NULL)
+        {
+          std::map<Mesh*, std::pair<unsigned, std::string> >::iterator saved = this->continuity->saved_meshes.find(mesh);
+          if(saved != this->continuity->saved_meshes.end() && saved->second.first == mesh->get_seq())
+          {
+            std::ofstream out(mesh_reference_file_name(filename).c_str());
+            out << saved->second.second;
+            out.close();
+            if(!out)
+              throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::output, mesh_reference_file_name(filename).c_str());
+            this->meshFiles[i] = saved->second.second;
+            return;
+          }
+        }
+
+        if(this->continuity != NULL && this->continuity->record_format == binaryRecords)
+        {
+          MeshReaderH2DBinary writer;
+          writer.save(binary_file_name(filename).c_str(), mesh);
+          this->meshFiles[i] = binary_file_name(filename);
+          if(this->continuity->compression)
+            this->meshFiles[i] = compress_file(this->meshFiles[i], CalculationContinuityException::meshes);
+        }
+        else
+        {
+          MeshReaderH2DXML writer;
+          writer.save(filename.c_str(), mesh);
+          this->meshFiles[i] = filename;
+        }
+      }
+      catch(IOCalculationContinuityException&)
+      {
+        throw;
       }
       catch(std::exception& e)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
+        throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::output, filename.c_str(), e.what());
       }
+
+      if(this->continuity != NULL)
+        this->continuity->saved_meshes[mesh] = std::pair<unsigned, std::string>(mesh->get_seq(), this->meshFiles[i]);
     }
 
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::save_spaces(Hermes::vector<Space<Scalar>*> spaces)
+    void CalculationContinuity<Scalar>::Record::save_meshes(Hermes::vector<Mesh*> meshes)
     {
-      for(unsigned int i = 0; i < spaces.size(); i++)
+      for(unsigned int i = 0; i < meshes.size(); i++)
+        this->save_mesh_file(i, meshes[i]);
+    }
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_mesh(Mesh* mesh)
+    {
+      this->save_mesh_file(0, mesh);
+    }
+
+    // The spaces are saved in the binary format (Space::save_binary()), next to the name of the XML file.
+    static std::string binary_space_file_name(const std::string& filename)
+    {
+      return filename + "s";
+    }
+
+    // The binary file (compressed or not) if there is one, the XML file of the older records otherwise.
+    template<typename Scalar>
+    static Space<Scalar>* load_space_file(const std::string& filename, Mesh* mesh, EssentialBCs<Scalar>* essential_bcs, Shapeset* shapeset)
+    {
+      if(file_exists(binary_space_file_name(filename) + ".gz"))
       {
-        std::stringstream filename;
-        filename << CalculationContinuity<Scalar>::space_file_name << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
+        std::string decompressed_filename = decompress_file(binary_space_file_name(filename) + ".gz", CalculationContinuityException::spaces);
         try
         {
-          spaces[i]->save(filename.str().c_str());
+          Space<Scalar>* space = Space<Scalar>::load_binary(decompressed_filename.c_str(), mesh, essential_bcs, shapeset);
+          remove(decompressed_filename.c_str());
+          return space;
         }
-        catch(std::exception& e)
+        catch(std::exception&)
         {
-          throw IOCalculationContinuityException(CalculationContinuityException::spaces, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
+          remove(decompressed_filename.c_str());
+          throw;
         }
       }
+      if(file_exists(binary_space_file_name(filename)))
+        return Space<Scalar>::load_binary(binary_space_file_name(filename).c_str(), mesh, essential_bcs, shapeset);
+      return Space<Scalar>::load(filename.c_str(), mesh, false, essential_bcs, shapeset);
+    }
+
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_spaces(Hermes::vector<Space<Scalar>*> spaces)
+    {
+      for(unsigned int i = 0; i < spaces.size(); i++)
+        this->save_space_file(i, spaces[i]);
     }
 
     template<typename Scalar>
     void CalculationContinuity<Scalar>::Record::save_space(Space<Scalar>* space)
     {
-      std::stringstream filename;
-      filename << CalculationContinuity<Scalar>::space_file_name << 0 << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
+      this->save_space_file(0, space);
+    }
+
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_space_file(unsigned int i, Space<Scalar>* space)
+    {
+      std::string filename = this->file_name(CalculationContinuity<Scalar>::space_file_name, i);
       try
       {
-        space->save(filename.str().c_str());
+        space->save_binary(binary_space_file_name(filename).c_str());
+        if(this->continuity != NULL && this->continuity->compression)
+          compress_file(binary_space_file_name(filename), CalculationContinuityException::spaces);
+      }
+      catch(IOCalculationContinuityException&)
+      {
+        throw;
       }
       catch(std::exception& e)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::spaces, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
+        throw IOCalculationContinuityException(CalculationContinuityException::spaces, IOCalculationContinuityException::output, filename.c_str(), e.what());
       }
     }
 
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::save_solutions(Hermes::vector<Solution<Scalar>*> solutions)
+    void CalculationContinuity<Scalar>::Record::save_solution_file(unsigned int i, Solution<Scalar>* solution)
     {
-      for(unsigned int i = 0; i < solutions.size(); i++)
+      std::string filename = this->file_name(CalculationContinuity<Scalar>::solution_file_name, i);
+      try
       {
-        std::stringstream filename;
-        filename << CalculationContinuity<Scalar>::solution_file_name << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-
-        try
-        {
-          solutions[i]->save(filename.str().c_str());
-        }
-        catch(Hermes::Exceptions::SolutionSaveFailureException& e)
+        if(this->continuity != NULL && this->continuity->record_format == binaryRecords && solution->get_type() == HERMES_SLN)
         {
-          throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
+          solution->save_binary(binary_file_name(filename).c_str());
+          if(this->continuity->compression)
+            compress_file(binary_file_name(filename), CalculationContinuityException::solutions);
         }
+        else
+          solution->save(filename.c_str());
       }
-    }
-    template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::save_solution(Solution<Scalar>* solution)
-    {
-      std::stringstream filename;
-      filename << CalculationContinuity<Scalar>::solution_file_name << 0 << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-      try
+      catch(IOCalculationContinuityException&)
       {
-        solution->save(filename.str().c_str());
+        throw;
       }
-      catch(Hermes::Exceptions::SolutionSaveFailureException& e)
+      catch(std::exception& e)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::output, filename.str().c_str(), e.what());
+        throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::output, filename.c_str(), e.what());
       }
     }
 
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_solutions(Hermes::vector<Solution<Scalar>*> solutions)
+    {
+      for(unsigned int i = 0; i < solutions.size(); i++)
+        this->save_solution_file(i, solutions[i]);
+    }
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::save_solution(Solution<Scalar>* solution)
+    {
+      this->save_solution_file(0, solution);
+    }
+
     template<typename Scalar>
     void CalculationContinuity<Scalar>::Record::save_time_step_length(double time_step_length_to_save)
     {
@@ -522,38 +723,77 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::load_meshes(Hermes::vector<Mesh*> meshes)
+    void CalculationContinuity<Scalar>::Record::load_mesh_file(unsigned int i, Mesh* mesh)
     {
-      MeshReaderH2DXML reader;
-      for(unsigned int i = 0; i < meshes.size(); i++)
+      // The records restored after a restart know the files of their meshes from the disk only.
+      std::string filename;
+      if(this->meshFiles.size() > i && !this->meshFiles[i].empty())
+        filename = this->meshFiles[i];
+      else
       {
-        std::stringstream filename;
-        filename << CalculationContinuity<Scalar>::mesh_file_name << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-        try
-        {
-          reader.load(filename.str().c_str(), meshes[i]);
-        }
-        catch(Hermes::Exceptions::MeshLoadFailureException& e)
+        filename = this->file_name(CalculationContinuity<Scalar>::mesh_file_name, i);
+        if(file_exists(mesh_reference_file_name(filename)))
         {
-          throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
+          std::ifstream in(mesh_reference_file_name(filename).c_str());
+          std::getline(in, filename);
+          in.close();
         }
+        else
+          filename = find_record_file(filename);
       }
-    }
-    template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::load_mesh(Mesh* mesh)
-    {
-      MeshReaderH2DXML reader;
-      std::stringstream filename;
-      filename << CalculationContinuity<Scalar>::mesh_file_name << 0 << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
 
       try
       {
-        reader.load(filename.str().c_str(), mesh);
+        if(has_suffix(filename, ".gz"))
+        {
+          std::string decompressed_filename = decompress_file(filename, CalculationContinuityException::meshes);
+          MeshReaderH2DBinary reader;
+          try
+          {
+            reader.load(decompressed_filename.c_str(), mesh);
+          }
+          catch(std::exception&)
+          {
+            remove(decompressed_filename.c_str());
+            throw;
+          }
+          remove(decompressed_filename.c_str());
+        }
+        else if(has_suffix(filename, "b"))
+        {
+          MeshReaderH2DBinary reader;
+          reader.load(filename.c_str(), mesh);
+        }
+        else
+        {
+          MeshReaderH2DXML reader;
+          reader.load(filename.c_str(), mesh);
+        }
       }
-      catch(Hermes::Exceptions::MeshLoadFailureException& e)
+      catch(IOCalculationContinuityException&)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
+        throw;
       }
+      catch(std::exception& e)
+      {
+        throw IOCalculationContinuityException(CalculationContinuityException::meshes, IOCalculationContinuityException::input, filename.c_str(), e.what());
+      }
+
+      // The loaded mesh is saved in this file.
+      if(this->continuity != NULL)
+        this->continuity->saved_meshes[mesh] = std::pair<unsigned, std::string>(mesh->get_seq(), filename);
+    }
+
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::load_meshes(Hermes::vector<Mesh*> meshes)
+    {
+      for(unsigned int i = 0; i < meshes.size(); i++)
+        this->load_mesh_file(i, meshes[i]);
+    }
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::load_mesh(Mesh* mesh)
+    {
+      this->load_mesh_file(0, mesh);
     }
 
     template<typename Scalar>
@@ -572,7 +812,7 @@ namespace Hermes
 
         try
         {
-          spaces.push_back(Space<Scalar>::load(filename.str().c_str(), meshes[i], false, essential_bcs[i], shapesets[i]));
+          spaces.push_back(load_space_file(filename.str(), meshes[i], essential_bcs[i], shapesets[i]));
         }
         catch(Hermes::Exceptions::SpaceLoadFailureException& e)
         {
@@ -603,7 +843,7 @@ namespace Hermes
 
         try
         {
-          spaces.push_back(Space<Scalar>::load(filename.str().c_str(), meshes[i], false, NULL, shapesets[i]));
+          spaces.push_back(load_space_file<Scalar>(filename.str(), meshes[i], NULL, shapesets[i]));
         }
         catch(Hermes::Exceptions::SpaceLoadFailureException& e)
         {
@@ -626,7 +866,7 @@ namespace Hermes
 
       try
       {
-        return Space<Scalar>::load(filename.str().c_str(), mesh, false, essential_bcs, shapeset);
+        return load_space_file(filename.str(), mesh, essential_bcs, shapeset);
       }
       catch(Hermes::Exceptions::SpaceLoadFailureException& e)
       {
@@ -639,49 +879,55 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::load_solutions(Hermes::vector<Solution<Scalar>*> solutions, Hermes::vector<Space<Scalar>*> spaces)
+    void CalculationContinuity<Scalar>::Record::load_solution_file(unsigned int i, Solution<Scalar>* solution, Space<Scalar>* space)
     {
-      if(solutions.size() != spaces.size())
-        throw Exceptions::LengthException(1, 2, solutions.size(), spaces.size());
-      for(unsigned int i = 0; i < solutions.size(); i++)
+      std::string filename = find_record_file(this->file_name(CalculationContinuity<Scalar>::solution_file_name, i));
+      try
       {
-        std::stringstream filename;
-        filename << CalculationContinuity<Scalar>::solution_file_name << i << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-        try
+        if(has_suffix(filename, ".gz"))
         {
-          solutions[i]->load(filename.str().c_str(), spaces[i]);
-          solutions[i]->space_type = spaces[i]->get_type();
-        }
-        catch(Hermes::Exceptions::SolutionLoadFailureException& e)
-        {
-          throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
-        }
-        catch(std::exception& e)
-        {
-          throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
+          std::string decompressed_filename = decompress_file(filename, CalculationContinuityException::solutions);
+          try
+          {
+            solution->load_binary(decompressed_filename.c_str(), space);
+          }
+          catch(std::exception&)
+          {
+            remove(decompressed_filename.c_str());
+            throw;
+          }
+          remove(decompressed_filename.c_str());
         }
-      }
-    }
-    template<typename Scalar>
-    void CalculationContinuity<Scalar>::Record::load_solution(Solution<Scalar>* solution, Space<Scalar>* space)
-    {
-      std::stringstream filename;
-      filename << CalculationContinuity<Scalar>::solution_file_name << 0 << '_' << (std::string)"t = " << this->time << (std::string)"n = " << this->number << (std::string)".h2d";
-      try
-      {
-        solution->load(filename.str().c_str(), space);
+        else if(has_suffix(filename, "b"))
+          solution->load_binary(filename.c_str(), space);
+        else
+          solution->load(filename.c_str(), space);
         solution->space_type = space->get_type();
       }
-      catch(Hermes::Exceptions::SolutionLoadFailureException& e)
+      catch(IOCalculationContinuityException&)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
+        throw;
       }
       catch(std::exception& e)
       {
-        throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::input, filename.str().c_str(), e.what());
+        throw IOCalculationContinuityException(CalculationContinuityException::solutions, IOCalculationContinuityException::input, filename.c_str(), e.what());
       }
     }
 
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::load_solutions(Hermes::vector<Solution<Scalar>*> solutions, Hermes::vector<Space<Scalar>*> spaces)
+    {
+      if(solutions.size() != spaces.size())
+        throw Exceptions::LengthException(1, 2, solutions.size(), spaces.size());
+      for(unsigned int i = 0; i < solutions.size(); i++)
+        this->load_solution_file(i, solutions[i], spaces[i]);
+    }
+    template<typename Scalar>
+    void CalculationContinuity<Scalar>::Record::load_solution(Solution<Scalar>* solution, Space<Scalar>* space)
+    {
+      this->load_solution_file(0, solution, space);
+    }
+
     template<typename Scalar>
     void CalculationContinuity<Scalar>::Record::load_time_step_length(double & time_step_length)
     {
@@ -19,6 +19,7 @@
 #include "discrete_problem.h"
 #include "function/exact_solution.h"
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <string>
 #include <utility>
@@ -27,12 +28,19 @@
 #include "integrals/h1.h"
 #include "quadrature/limit_order.h"
 #include "mesh/traverse.h"
+#include "mesh/mesh_partitioner.h"
 #include "space/space.h"
 #include "shapeset/precalc.h"
 #include "mesh/refmap.h"
 #include "function/solution.h"
 #include "neighbor.h"
 #include "api2d.h"
+#include "tensor_product_quad.h"
+#include "reference_matrices.h"
+#include "quadrature/quad_all.h"
+
+// States per chunk of the parallel loops.
+#define CHUNKSIZE 1
 
 using namespace Hermes::Algebra::DenseMatrixOperations;
 
@@ -78,6 +86,7 @@ namespace Hermes
       // Initialize special variable for Runge-Kutta time integration.
       RungeKutta = false;
       RK_original_spaces_count = 0;
+      u_ext_coeff_vec = NULL;
 
       this->ndof = 0;
 
@@ -101,11 +110,50 @@ namespace Hermes
       current_mat = NULL;
       current_rhs = NULL;
       current_block_weights = NULL;
+      dirichlet_lift_only = false;
 
 
       cache_element_stored = NULL;
 
       this->do_not_use_cache = false;
+      this->cache_budget = 0;
+      this->cache_clock_hand = this->cache_clock.end();
+      for(int i = 0; i < H2D_CACHE_LOCKS; i++)
+        omp_init_lock(&this->cache_locks[i]);
+      this->cache_bytes = 0;
+      this->cache_hits = this->cache_misses = this->cache_evictions = 0;
+      this->congruent_matrix_form_bytes = 0;
+      this->do_not_store_states = false;
+      this->subdomain = -1;
+      this->form_markers_count = 0;
+      this->reproducible_assembly = false;
+      this->coloured_assembly = false;
+      this->state_batching = false;
+      this->DG_interfaces_precalculation = false;
+      this->DG_interfaces = NULL;
+      this->DG_interfaces_count = 0;
+      this->node_blocked_assembly = false;
+      this->use_scatter_maps = false;
+      this->scatter_maps = NULL;
+      this->scatter_maps_neq = 0;
+      this->scatter_maps_matrix = NULL;
+      this->current_apply_x = NULL;
+      this->current_apply_y = NULL;
+      this->linearization_point = NULL;
+      this->thread_pss = NULL;
+      this->thread_spss = NULL;
+      this->thread_refmaps = NULL;
+      this->thread_als = NULL;
+      this->thread_npss = NULL;
+      this->thread_nspss = NULL;
+      this->thread_nrefmaps = NULL;
+      this->thread_contexts_num_threads = 0;
+      this->thread_contexts_neq = 0;
+      this->static_condensation = false;
+      this->static_condensation_structure = false;
+      this->condensed_ndof = 0;
+      this->profiling = true;
+      this->form_profiling = false;
 
       this->spaces_size = 0;
 
@@ -138,6 +186,7 @@ namespace Hermes
       // Initialize special variable for Runge-Kutta time integration.
       RungeKutta = false;
       RK_original_spaces_count = 0;
+      u_ext_coeff_vec = NULL;
 
       this->ndof = Space<Scalar>::get_num_dofs(spaces);
 
@@ -181,8 +230,9 @@ namespace Hermes
       current_mat = NULL;
       current_rhs = NULL;
       current_block_weights = NULL;
+      dirichlet_lift_only = false;
 
-      cache_records_sub_idx = new std::map<uint64_t, CacheRecordPerSubIdx*>**[spaces.size()];
+      cache_records_sub_idx = new CacheRecordSubIdxTable**[spaces.size()];
       cache_records_element = new CacheRecordPerElement**[spaces.size()];
 
       this->cache_size = spaces[0]->get_mesh()->get_max_element_id() + 1;
@@ -195,8 +245,8 @@ namespace Hermes
 
       for(unsigned int i = 0; i < spaces.size(); i++)
       {
-        cache_records_sub_idx[i] = (std::map<uint64_t, CacheRecordPerSubIdx*>**)malloc(this->cache_size * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
-        memset(cache_records_sub_idx[i], NULL, this->cache_size * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
+        cache_records_sub_idx[i] = (CacheRecordSubIdxTable**)malloc(this->cache_size * sizeof(CacheRecordSubIdxTable*));
+        memset(cache_records_sub_idx[i], NULL, this->cache_size * sizeof(CacheRecordSubIdxTable*));
 
         cache_records_element[i] = (CacheRecordPerElement**)malloc(this->cache_size * sizeof(CacheRecordPerElement*));
         memset(cache_records_element[i], NULL, this->cache_size * sizeof(CacheRecordPerElement*));
@@ -204,6 +254,44 @@ namespace Hermes
       cache_element_stored = NULL;
 
       this->do_not_use_cache = false;
+      this->cache_budget = 0;
+      this->cache_clock_hand = this->cache_clock.end();
+      for(int i = 0; i < H2D_CACHE_LOCKS; i++)
+        omp_init_lock(&this->cache_locks[i]);
+      this->cache_bytes = 0;
+      this->cache_hits = this->cache_misses = this->cache_evictions = 0;
+      this->congruent_matrix_form_bytes = 0;
+      this->do_not_store_states = false;
+      this->subdomain = -1;
+      this->form_markers_count = 0;
+      this->reproducible_assembly = false;
+      this->coloured_assembly = false;
+      this->state_batching = false;
+      this->DG_interfaces_precalculation = false;
+      this->DG_interfaces = NULL;
+      this->DG_interfaces_count = 0;
+      this->node_blocked_assembly = false;
+      this->use_scatter_maps = false;
+      this->scatter_maps = NULL;
+      this->scatter_maps_neq = 0;
+      this->scatter_maps_matrix = NULL;
+      this->current_apply_x = NULL;
+      this->current_apply_y = NULL;
+      this->linearization_point = NULL;
+      this->thread_pss = NULL;
+      this->thread_spss = NULL;
+      this->thread_refmaps = NULL;
+      this->thread_als = NULL;
+      this->thread_npss = NULL;
+      this->thread_nspss = NULL;
+      this->thread_nrefmaps = NULL;
+      this->thread_contexts_num_threads = 0;
+      this->thread_contexts_neq = 0;
+      this->static_condensation = false;
+      this->static_condensation_structure = false;
+      this->condensed_ndof = 0;
+      this->profiling = true;
+      this->form_profiling = false;
     }
 
     template<typename Scalar>
@@ -232,6 +320,19 @@ namespace Hermes
       if(sp_seq != NULL) delete [] sp_seq;
 
       this->delete_cache();
+      this->free_scatter_maps();
+      this->free_static_condensation();
+
+      delete [] this->linearization_point;
+
+      for(unsigned int i = 0; i < this->arenas.size(); i++)
+        delete this->arenas[i];
+
+      this->free_DG_interfaces();
+      this->free_thread_contexts();
+
+      for(int i = 0; i < H2D_CACHE_LOCKS; i++)
+        omp_destroy_lock(&this->cache_locks[i]);
     }
 
     template<typename Scalar>
@@ -260,6 +361,18 @@ namespace Hermes
 
       this->wf = wf;
       this->have_matrix = false;
+      this->order_caches.clear();
+      this->free_congruent_matrix_form_values();
+
+      // The matrix form values kept for the incremental reassembly belong to the previous forms.
+      for(typename std::list<CacheRecordPerSubIdx*>::iterator it = this->cache_clock.begin(); it != this->cache_clock.end(); it++)
+      {
+        (*it)->clear_matrix_form_values();
+        size_t bytes = (*it)->calculate_bytes();
+        this->cache_bytes += bytes;
+        this->cache_bytes -= (*it)->bytes;
+        (*it)->bytes = bytes;
+      }
 
       if(!this->wf->mfDG.empty())
         this->DG_matrix_forms_present = true;
@@ -295,9 +408,11 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void DiscreteProblem<Scalar>::set_fvm()
+    void DiscreteProblem<Scalar>::set_fvm(bool to_set)
     {
-      this->is_fvm = true;
+      this->is_fvm = to_set;
+      if(to_set)
+        this->DG_interfaces_precalculation = true;
     }
 
     template<typename Scalar>
@@ -309,14 +424,7 @@ namespace Hermes
         {
           if(this->cache_records_sub_idx[i][j] != NULL)
           {
-            for(typename std::map<uint64_t, CacheRecordPerSubIdx*>::iterator it = this->cache_records_sub_idx[i][j]->begin(); it != this->cache_records_sub_idx[i][j]->end(); it++)
-            {
-              it->second->clear();
-              delete it->second;
-            }
-
-            this->cache_records_sub_idx[i][j]->clear();
-            delete this->cache_records_sub_idx[i][j];
+            this->free_cache_records(this->cache_records_sub_idx[i][j]);
             this->cache_records_sub_idx[i][j] = NULL;
           }
           if(this->cache_records_element[i][j] != NULL)
@@ -331,6 +439,275 @@ namespace Hermes
       }
       delete [] this->cache_records_sub_idx;
       delete [] this->cache_records_element;
+      this->free_congruent_matrix_form_values();
+      this->update_memory_usage();
+    }
+
+    template<typename Scalar>
+    size_t DiscreteProblem<Scalar>::get_memory_usage() const
+    {
+      size_t usage = this->cache_bytes + this->congruent_matrix_form_bytes;
+      for(unsigned int i = 0; i < this->arenas.size(); i++)
+        if(this->arenas[i] != NULL)
+          usage += this->arenas[i]->get_reserved_size();
+      return usage;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_cache_budget(size_t bytes)
+    {
+      this->cache_budget = bytes;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_subdomain(const std::vector<int>& base_element_parts, int part)
+    {
+      if(part < 0)
+        throw Hermes::Exceptions::ValueException("part", part, 0);
+      this->subdomain_base_element_parts = base_element_parts;
+      this->subdomain = part;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::unset_subdomain()
+    {
+      this->subdomain_base_element_parts.clear();
+      this->subdomain = -1;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::is_in_subdomain(Traverse::State* state) const
+    {
+      if(this->subdomain == -1)
+        return true;
+      // All the meshes share the base mesh, the element of any of them tells the base element.
+      for(int i = 0; i < state->num; i++)
+        if(state->e[i] != NULL)
+        {
+          int id = MeshPartitioner::get_base_element(state->e[i])->id;
+          return id < (int)this->subdomain_base_element_parts.size() && this->subdomain_base_element_parts[id] == this->subdomain;
+        }
+      return false;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_profiling(bool to_set)
+    {
+      this->profiling = to_set;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_form_profiling(bool to_set)
+    {
+      this->form_profiling = to_set;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::count_skipped_form(Form<Scalar>* form)
+    {
+      FormProfile* form_profile = this->current_form_profile(form);
+      if(form_profile != NULL)
+        form_profile->skipped++;
+    }
+
+    template<typename Scalar>
+    FormProfile* DiscreteProblem<Scalar>::current_form_profile(Form<Scalar>* form)
+    {
+      if(!this->form_profiling || form->position < 0)
+        return NULL;
+      AssemblyProfile* profile = this->current_profile();
+      if(profile == NULL)
+        return NULL;
+      // The profile of the thread is its own, resized on its first form.
+      if(profile->forms.size() <= (unsigned int)form->position)
+        profile->forms.resize(std::max((unsigned int)this->wf->get_forms().size(), (unsigned int)form->position + 1));
+      return &profile->forms[form->position];
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_cache_records(CacheRecordSubIdxTable* records)
+    {
+      for(unsigned int i = 0; i < records->records.size(); i++)
+      {
+        this->remove_from_clock(records->records[i]);
+        this->cache_bytes -= records->records[i]->bytes;
+        records->records[i]->clear();
+        delete records->records[i];
+      }
+      delete records;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::remove_from_clock(CacheRecordPerSubIdx* record)
+    {
+      if(this->cache_clock_hand == record->clock_position)
+        this->cache_clock_hand++;
+      this->cache_clock.erase(record->clock_position);
+    }
+
+    template<typename Scalar>
+    Scalar* DiscreteProblem<Scalar>::find_matrix_form_values(CacheRecordPerSubIdx* record, int position, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j)
+    {
+      Scalar* values = NULL;
+      omp_lock_t* lock = this->get_cache_lock(record->element_id);
+      omp_set_lock(lock);
+      typename std::map<int, typename CacheRecordPerSubIdx::MatrixFormValues>::iterator it = record->matrix_form_values.find(position);
+      if(it != record->matrix_form_values.end() && it->second.cnt_i == current_als_i->cnt && it->second.cnt_j == current_als_j->cnt)
+      {
+        // The same shape functions (the coefficients and DOFs may differ, they are applied afterwards).
+        values = it->second.values;
+        for(unsigned int i = 0; i < current_als_i->cnt && values != NULL; i++)
+          if(it->second.idx[i] != current_als_i->idx[i])
+            values = NULL;
+        for(unsigned int j = 0; j < current_als_j->cnt && values != NULL; j++)
+          if(it->second.idx[current_als_i->cnt + j] != current_als_j->idx[j])
+            values = NULL;
+      }
+      omp_unset_lock(lock);
+      return values;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::store_matrix_form_values(CacheRecordPerSubIdx* record, int position, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Scalar* values)
+    {
+      typename CacheRecordPerSubIdx::MatrixFormValues new_values;
+      new_values.cnt_i = current_als_i->cnt;
+      new_values.cnt_j = current_als_j->cnt;
+      new_values.idx = new int[new_values.cnt_i + new_values.cnt_j];
+      memcpy(new_values.idx, current_als_i->idx, new_values.cnt_i * sizeof(int));
+      memcpy(new_values.idx + new_values.cnt_i, current_als_j->idx, new_values.cnt_j * sizeof(int));
+      new_values.values = values;
+
+      omp_lock_t* lock = this->get_cache_lock(record->element_id);
+      omp_set_lock(lock);
+      typename std::map<int, typename CacheRecordPerSubIdx::MatrixFormValues>::iterator it = record->matrix_form_values.find(position);
+      if(it != record->matrix_form_values.end())
+      {
+        delete [] it->second.idx;
+        delete [] it->second.values;
+      }
+      record->matrix_form_values[position] = new_values;
+      size_t bytes = record->calculate_bytes();
+      omp_unset_lock(lock);
+
+#pragma omp critical (cache_records_clock)
+      {
+        this->cache_bytes += bytes;
+        this->cache_bytes -= record->bytes;
+        record->bytes = bytes;
+      }
+    }
+
+    /// Appends the entries of a matrix quantized relative to its largest entry (rounding errors of the translated
+    /// coordinates do not matter, the relative error of the reused matrices is about 1e-9).
+    static void append_quantized_matrix(std::vector<int>& key, const double* values, int count)
+    {
+      double scale = 0.0;
+      for(int i = 0; i < count; i++)
+        scale = std::max(scale, std::abs(values[i]));
+      int exponent = 0;
+      frexp(scale, &exponent);
+      key.push_back(exponent);
+      for(int i = 0; i < count; i++)
+        key.push_back((int)floor(ldexp(values[i], 30 - exponent) + 0.5));
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::get_congruence_key(MatrixForm<Scalar>* form, int order, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+      Traverse::State* current_state, RefMap* current_refmap, std::vector<int>& key)
+    {
+      MatrixFormVol<Scalar>* form_vol = dynamic_cast<MatrixFormVol<Scalar>*>(form);
+      if(form_vol == NULL || !form_vol->constant_coefficients || form->position < 0 || current_refmap == NULL)
+        return false;
+      // The affine elements only, no sub-element transformations (multi-mesh).
+      if(!current_refmap->is_jacobian_const() || current_refmap->get_transform() != 0 || current_state->sub_idx[form->i] != 0 || current_state->sub_idx[form->j] != 0)
+        return false;
+
+      Element* e = current_state->e[form->i];
+      key.clear();
+      key.push_back(e->get_mode());
+      key.push_back(e->marker);
+      key.push_back(order);
+      double2x2* m = current_refmap->get_const_inv_ref_map();
+      double m_values[4] = { (*m)[0][0], (*m)[0][1], (*m)[1][0], (*m)[1][1] };
+      append_quantized_matrix(key, m_values, 4);
+      // The shape functions (their orders and the orientations of the edge functions).
+      key.push_back(current_als_i->cnt);
+      key.insert(key.end(), current_als_i->idx, current_als_i->idx + current_als_i->cnt);
+      key.push_back(current_als_j->cnt);
+      key.insert(key.end(), current_als_j->idx, current_als_j->idx + current_als_j->cnt);
+      return true;
+    }
+
+    template<typename Scalar>
+    Scalar* DiscreteProblem<Scalar>::find_congruent_matrix_form_values(MatrixForm<Scalar>* form, const std::vector<int>& key)
+    {
+      Scalar* values = NULL;
+#pragma omp critical (congruent_matrix_form_values)
+      {
+        if((unsigned int)form->position < this->congruent_matrix_form_values.size())
+        {
+          typename std::map<std::vector<int>, Scalar*>::const_iterator it = this->congruent_matrix_form_values[form->position].find(key);
+          if(it != this->congruent_matrix_form_values[form->position].end())
+            values = it->second;
+        }
+      }
+      return values;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::store_congruent_matrix_form_values(MatrixForm<Scalar>* form, const std::vector<int>& key, unsigned int cnt_i, unsigned int cnt_j, Scalar* values)
+    {
+#pragma omp critical (congruent_matrix_form_values)
+      {
+        if((unsigned int)form->position >= this->congruent_matrix_form_values.size())
+          this->congruent_matrix_form_values.resize(form->position + 1);
+        std::map<std::vector<int>, Scalar*>& form_values = this->congruent_matrix_form_values[form->position];
+        // Another thread may have stored the same matrix meanwhile.
+        if(form_values.size() < H2D_MAX_CONGRUENT_MATRICES && form_values.find(key) == form_values.end())
+        {
+          Scalar* copy = new Scalar[cnt_i * cnt_j];
+          memcpy(copy, values, cnt_i * cnt_j * sizeof(Scalar));
+          form_values[key] = copy;
+          this->congruent_matrix_form_bytes += cnt_i * cnt_j * sizeof(Scalar) + key.size() * sizeof(int);
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_congruent_matrix_form_values()
+    {
+      for(unsigned int i = 0; i < this->congruent_matrix_form_values.size(); i++)
+        for(typename std::map<std::vector<int>, Scalar*>::iterator it = this->congruent_matrix_form_values[i].begin(); it != this->congruent_matrix_form_values[i].end(); it++)
+          delete [] it->second;
+      this->congruent_matrix_form_values.clear();
+      this->congruent_matrix_form_bytes = 0;
+    }
+    template<typename Scalar>
+    typename DiscreteProblem<Scalar>::CacheRecordPerSubIdx* DiscreteProblem<Scalar>::CacheRecordSubIdxTable::find(uint64_t sub_idx) const
+    {
+      std::vector<uint64_t>::const_iterator it = std::lower_bound(this->sub_idxs.begin(), this->sub_idxs.end(), sub_idx);
+      if(it == this->sub_idxs.end() || *it != sub_idx)
+        return NULL;
+      return this->records[it - this->sub_idxs.begin()];
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::CacheRecordSubIdxTable::insert(CacheRecordPerSubIdx* record)
+    {
+      int position = std::lower_bound(this->sub_idxs.begin(), this->sub_idxs.end(), record->sub_idx) - this->sub_idxs.begin();
+      this->sub_idxs.insert(this->sub_idxs.begin() + position, record->sub_idx);
+      this->records.insert(this->records.begin() + position, record);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::CacheRecordSubIdxTable::erase(uint64_t sub_idx)
+    {
+      std::vector<uint64_t>::iterator it = std::lower_bound(this->sub_idxs.begin(), this->sub_idxs.end(), sub_idx);
+      if(it == this->sub_idxs.end() || *it != sub_idx)
+        return;
+      this->records.erase(this->records.begin() + (it - this->sub_idxs.begin()));
+      this->sub_idxs.erase(it);
     }
 
     template<typename Scalar>
@@ -348,6 +725,10 @@ namespace Hermes
 
       this->ndof = Space<Scalar>::get_num_dofs(spaces);
 
+      // The linearization point of apply() belongs to the previous spaces.
+      delete [] this->linearization_point;
+      this->linearization_point = NULL;
+
       /// \todo TEMPORARY There is something wrong with caching vector shapesets.
       for(unsigned int i = 0; i < spacesToSet.size(); i++)
         if(spacesToSet[i]->get_shapeset()->get_num_components() > 1)
@@ -372,7 +753,7 @@ namespace Hermes
         // Matrix<Scalar> related settings.
         have_matrix = false;
 
-        cache_records_sub_idx = new std::map<uint64_t, CacheRecordPerSubIdx*>**[spaces.size()];
+        cache_records_sub_idx = new CacheRecordSubIdxTable**[spaces.size()];
         cache_records_element = new CacheRecordPerElement**[spaces.size()];
 
         this->cache_size = spaces[0]->get_mesh()->get_max_element_id() + 1;
@@ -385,8 +766,8 @@ namespace Hermes
 
         for(unsigned int i = 0; i < spaces.size(); i++)
         {
-          cache_records_sub_idx[i] = (std::map<uint64_t, CacheRecordPerSubIdx*>**)malloc(this->cache_size * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
-          memset(cache_records_sub_idx[i], NULL, this->cache_size * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
+          cache_records_sub_idx[i] = (CacheRecordSubIdxTable**)malloc(this->cache_size * sizeof(CacheRecordSubIdxTable*));
+          memset(cache_records_sub_idx[i], NULL, this->cache_size * sizeof(CacheRecordSubIdxTable*));
 
           cache_records_element[i] = (CacheRecordPerElement**)malloc(this->cache_size * sizeof(CacheRecordPerElement*));
           memset(cache_records_element[i], NULL, this->cache_size * sizeof(CacheRecordPerElement*));
@@ -408,8 +789,8 @@ namespace Hermes
         {
           for(unsigned int i = 0; i < this->spaces_size; i++)
           {
-            this->cache_records_sub_idx[i] = (std::map<uint64_t, CacheRecordPerSubIdx*>**)realloc(this->cache_records_sub_idx[i], max_size * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
-            memset(this->cache_records_sub_idx[i] + this->cache_size, NULL, (max_size - this->cache_size) * sizeof(std::map<uint64_t, CacheRecordPerSubIdx*>*));
+            this->cache_records_sub_idx[i] = (CacheRecordSubIdxTable**)realloc(this->cache_records_sub_idx[i], max_size * sizeof(CacheRecordSubIdxTable*));
+            memset(this->cache_records_sub_idx[i] + this->cache_size, NULL, (max_size - this->cache_size) * sizeof(CacheRecordSubIdxTable*));
 
             this->cache_records_element[i] = (CacheRecordPerElement**)realloc(this->cache_records_element[i], max_size * sizeof(CacheRecordPerElement*));
             memset(this->cache_records_element[i] + this->cache_size, NULL, (max_size - this->cache_size) * sizeof(CacheRecordPerElement*));
@@ -428,11 +809,7 @@ namespace Hermes
               {
                 if(this->cache_records_sub_idx[i][j] != NULL)
                 {
-                  for(typename std::map<uint64_t, CacheRecordPerSubIdx*>::iterator it = this->cache_records_sub_idx[i][j]->begin(); it != this->cache_records_sub_idx[i][j]->end(); it++)
-                    it->second->clear();
-
-                  this->cache_records_sub_idx[i][j]->clear();
-                  delete this->cache_records_sub_idx[i][j];
+                  this->free_cache_records(this->cache_records_sub_idx[i][j]);
                   this->cache_records_sub_idx[i][j] = NULL;
                 }
                 if(this->cache_records_element[i][j] != NULL)
@@ -447,11 +824,7 @@ namespace Hermes
             {
               if(this->cache_records_sub_idx[i][j] != NULL)
               {
-                for(typename std::map<uint64_t, CacheRecordPerSubIdx*>::iterator it = this->cache_records_sub_idx[i][j]->begin(); it != this->cache_records_sub_idx[i][j]->end(); it++)
-                  it->second->clear();
-
-                this->cache_records_sub_idx[i][j]->clear();
-                delete this->cache_records_sub_idx[i][j];
+                this->free_cache_records(this->cache_records_sub_idx[i][j]);
                 this->cache_records_sub_idx[i][j] = NULL;
               }
               if(this->cache_records_element[i][j] != NULL)
@@ -517,34 +890,7 @@ namespace Hermes
 
       // Assemble this form only if one of its areas is HERMES_ANY
       // of if the element marker coincides with one of the form's areas.
-      bool assemble_this_form = false;
-      for (unsigned int ss = 0; ss < form->areas.size(); ss++)
-      {
-        if(form->areas[ss] == HERMES_ANY)
-        {
-          assemble_this_form = true;
-          break;
-        }
-        else
-        {
-          bool marker_on_space_m = this->spaces[form->i]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_m)
-            marker_on_space_m = (this->spaces[form->i]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->marker);
-
-          bool marker_on_space_n = this->spaces[form->j]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_n)
-            marker_on_space_n = (this->spaces[form->j]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->marker);
-
-          if(marker_on_space_m && marker_on_space_n)
-          {
-            assemble_this_form = true;
-            break;
-          }
-        }
-      }
-      if(!assemble_this_form)
-        return false;
-      return true;
+      return form_area_has_marker(form, form->i, form->j, current_state->rep->marker, false);
     }
 
     template<typename Scalar>
@@ -558,34 +904,7 @@ namespace Hermes
       if(!form_to_be_assembled((MatrixForm<Scalar>*)form, current_state))
         return false;
 
-      bool assemble_this_form = false;
-      for (unsigned int ss = 0; ss < form->areas.size(); ss++)
-      {
-        if(form->areas[ss] == HERMES_ANY)
-        {
-          assemble_this_form = true;
-          break;
-        }
-        else
-        {
-          bool marker_on_space_m = this->spaces[form->i]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_m)
-            marker_on_space_m = (this->spaces[form->i]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->en[current_state->isurf]->marker);
-
-          bool marker_on_space_n = this->spaces[form->j]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_n)
-            marker_on_space_n = (this->spaces[form->j]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->en[current_state->isurf]->marker);
-
-          if(marker_on_space_m && marker_on_space_n)
-          {
-            assemble_this_form = true;
-            break;
-          }
-        }
-      }
-      if(assemble_this_form == false)
-        return false;
-      return true;
+      return form_area_has_marker(form, form->i, form->j, current_state->rep->en[current_state->isurf]->marker, true);
     }
 
     template<typename Scalar>
@@ -604,33 +923,12 @@ namespace Hermes
     {
       if(!form_to_be_assembled((VectorForm<Scalar>*)form, current_state))
         return false;
+      if(form->load_case > this->current_load_case_rhs.size())
+        return false;
 
       // Assemble this form only if one of its areas is HERMES_ANY
       // of if the element marker coincides with one of the form's areas.
-      bool assemble_this_form = false;
-      for (unsigned int ss = 0; ss < form->areas.size(); ss++)
-      {
-        if(form->areas[ss] == HERMES_ANY)
-        {
-          assemble_this_form = true;
-          break;
-        }
-        else
-        {
-          bool marker_on_space_m = this->spaces[form->i]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_m)
-            marker_on_space_m = (this->spaces[form->i]->get_mesh()->get_element_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->marker);
-
-          if(marker_on_space_m)
-          {
-            assemble_this_form = true;
-            break;
-          }
-        }
-      }
-      if(!assemble_this_form)
-        return false;
-      return true;
+      return form_area_has_marker(form, form->i, form->i, current_state->rep->marker, false);
     }
 
     template<typename Scalar>
@@ -644,31 +942,136 @@ namespace Hermes
 
       if(!form_to_be_assembled((VectorForm<Scalar>*)form, current_state))
         return false;
+      if(form->load_case > this->current_load_case_rhs.size())
+        return false;
 
-      bool assemble_this_form = false;
-      for (unsigned int ss = 0; ss < form->areas.size(); ss++)
+      return form_area_has_marker(form, form->i, form->i, current_state->rep->en[current_state->isurf]->marker, true);
+    }
+
+    template<typename Scalar>
+    Mesh::MarkersConversion::IntValid DiscreteProblem<Scalar>::get_internal_marker(const Mesh* mesh, const std::string& area, bool boundary)
+    {
+      if(boundary)
+        return mesh->get_boundary_markers_conversion().get_internal_marker(area);
+      return mesh->get_element_markers_conversion().get_internal_marker(area);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_form_markers()
+    {
+      // The internal markers of the areas of every form, valid on the meshes of both its spaces.
+      unsigned int forms_count = this->wf->get_forms().size();
+      std::vector<std::vector<std::pair<int, bool> > > markers(forms_count);
+      // Not resolved (e.g. forms whose position does not match), form_area_has_marker() looks them up by the strings.
+      this->form_areas_any.assign(forms_count, 2);
+      int markers_size = 0;
+      for(unsigned int form_i = 0; form_i < forms_count; form_i++)
       {
-        if(form->areas[ss] == HERMES_ANY)
+        Form<Scalar>* form = this->wf->get_forms()[form_i];
+        if(form->position != (int)form_i)
+          continue;
+        unsigned int i, j;
+        if(dynamic_cast<MatrixForm<Scalar>*>(form) != NULL)
         {
-          assemble_this_form = true;
-          break;
+          i = dynamic_cast<MatrixForm<Scalar>*>(form)->i;
+          j = dynamic_cast<MatrixForm<Scalar>*>(form)->j;
         }
+        else if(dynamic_cast<VectorForm<Scalar>*>(form) != NULL)
+          i = j = dynamic_cast<VectorForm<Scalar>*>(form)->i;
         else
-        {
-          bool marker_on_space_m = this->spaces[form->i]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).valid;
-          if(marker_on_space_m)
-            marker_on_space_m = (this->spaces[form->i]->get_mesh()->get_boundary_markers_conversion().get_internal_marker(form->areas[ss]).marker == current_state->rep->en[current_state->isurf]->marker);
+          continue;
+        if(i >= this->spaces_size || j >= this->spaces_size)
+          continue;
+        bool boundary = dynamic_cast<MatrixFormSurf<Scalar>*>(form) != NULL || dynamic_cast<VectorFormSurf<Scalar>*>(form) != NULL;
+        this->form_areas_any[form_i] = 0;
 
-          if(marker_on_space_m)
+        for (unsigned int ss = 0; ss < form->areas.size(); ss++)
+        {
+          if(form->areas[ss] == HERMES_ANY)
           {
-            assemble_this_form = true;
+            this->form_areas_any[form_i] = 1;
             break;
           }
+          Mesh::MarkersConversion::IntValid marker_i = this->get_internal_marker(this->spaces[i]->get_mesh(), form->areas[ss], boundary);
+          Mesh::MarkersConversion::IntValid marker_j = this->get_internal_marker(this->spaces[j]->get_mesh(), form->areas[ss], boundary);
+          if(marker_i.valid && marker_j.valid && marker_i.marker == marker_j.marker && marker_i.marker >= 0)
+          {
+            markers[form_i].push_back(std::make_pair(marker_i.marker, boundary));
+            markers_size = std::max(markers_size, marker_i.marker + 1);
+          }
         }
       }
-      if(assemble_this_form == false)
-        return false;
-      return true;
+
+      this->form_markers_count = forms_count;
+      this->element_marker_forms.assign(markers_size * forms_count, 0);
+      this->boundary_marker_forms.assign(markers_size * forms_count, 0);
+      for(unsigned int form_i = 0; form_i < forms_count; form_i++)
+        for(unsigned int k = 0; k < markers[form_i].size(); k++)
+          (markers[form_i][k].second ? this->boundary_marker_forms : this->element_marker_forms)[markers[form_i][k].first * forms_count + form_i] = 1;
+
+      // The boundary markers of the surface forms.
+      this->surface_forms_any = false;
+      this->surface_marker_forms.assign(markers_size, 0);
+      std::vector<Form<Scalar>*> surface_forms(this->wf->mfsurf.begin(), this->wf->mfsurf.end());
+      surface_forms.insert(surface_forms.end(), this->wf->vfsurf.begin(), this->wf->vfsurf.end());
+      for(unsigned int surface_form_i = 0; surface_form_i < surface_forms.size(); surface_form_i++)
+      {
+        int position = surface_forms[surface_form_i]->position;
+        if(position < 0 || position >= (int)forms_count || this->form_areas_any[position] != 0)
+        {
+          this->surface_forms_any = true;
+          break;
+        }
+        for(int marker = 0; marker < markers_size; marker++)
+          if(this->boundary_marker_forms[marker * forms_count + position])
+            this->surface_marker_forms[marker] = 1;
+      }
+    }
+
+    template<typename Scalar>
+    unsigned int DiscreteProblem<Scalar>::get_surface_edges(Traverse::State* current_state, WeakForm<Scalar>* current_wf) const
+    {
+      unsigned int surface_edges = 0;
+      if(!current_state->isBnd || (current_wf->mfsurf.empty() && current_wf->vfsurf.empty()))
+        return surface_edges;
+
+      for(int isurf = 0; isurf < current_state->rep->nvert; isurf++)
+      {
+        if(!current_state->bnd[isurf])
+          continue;
+        int marker = current_state->rep->en[isurf]->marker;
+        if(marker == 0)
+          continue;
+        if(this->surface_forms_any || (marker > 0 && marker < (int)this->surface_marker_forms.size() && this->surface_marker_forms[marker]))
+          surface_edges |= 1 << isurf;
+      }
+      return surface_edges;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::form_area_has_marker(Form<Scalar>* form, unsigned int i, unsigned int j, int marker, bool boundary) const
+    {
+      int position = form->position;
+      if(position >= 0 && position < this->form_markers_count && this->form_areas_any[position] != 2)
+      {
+        if(this->form_areas_any[position] == 1)
+          return true;
+        const std::vector<char>& table = boundary ? this->boundary_marker_forms : this->element_marker_forms;
+        unsigned int index = marker * this->form_markers_count + position;
+        return marker >= 0 && index < table.size() && table[index];
+      }
+
+      // A form not known at init_form_markers() - the markers are resolved right here.
+      for (unsigned int ss = 0; ss < form->areas.size(); ss++)
+      {
+        if(form->areas[ss] == HERMES_ANY)
+          return true;
+        Mesh::MarkersConversion::IntValid marker_i = this->get_internal_marker(this->spaces[i]->get_mesh(), form->areas[ss], boundary);
+        Mesh::MarkersConversion::IntValid marker_j = this->get_internal_marker(this->spaces[j]->get_mesh(), form->areas[ss], boundary);
+        if(marker_i.valid && marker_i.marker == marker && marker_j.valid && marker_j.marker == marker)
+          return true;
+      }
+      return false;
     }
 
     template<typename Scalar>
@@ -683,7 +1086,21 @@ namespace Hermes
     template<typename Scalar>
     void DiscreteProblem<Scalar>::create_sparse_structure()
     {
-      if(is_up_to_date())
+      // Residual only - no matrix bookkeeping, the matrix structure (and the space seqs it belongs to)
+      // is left for the next assembling with a matrix.
+      if(current_mat == NULL)
+      {
+        if(current_rhs != NULL)
+        {
+          if(current_rhs->length() != this->ndof)
+            current_rhs->alloc(this->ndof);
+          else
+            current_rhs->zero();
+        }
+        return;
+      }
+
+      if(is_up_to_date() && this->static_condensation_to_be_used() == this->static_condensation_structure)
       {
         if(current_mat != NULL)
           current_mat->zero();
@@ -692,7 +1109,7 @@ namespace Hermes
           // If we use e.g. a new NewtonSolver (providing a new Vector) for this instance of DiscreteProblem that already assembled a system,
           // we end up with everything up_to_date, but unallocated Vector.
           if(current_rhs->length() == 0)
-            current_rhs->alloc(this->ndof);
+            current_rhs->alloc(this->get_system_num_dofs());
           else
             current_rhs->zero();
         }
@@ -724,155 +1141,940 @@ namespace Hermes
         // Spaces have changed: create the matrix from scratch.
         have_matrix = true;
         current_mat->free();
-        current_mat->prealloc(this->ndof);
-
-        AsmList<Scalar>* al = new AsmList<Scalar>[wf->get_neq()];
-        const Mesh** meshes = new const Mesh*[wf->get_neq()];
-        bool **blocks = wf->get_blocks(current_force_diagonal_blocks);
 
-        // Init multi-mesh traversal.
-        for (unsigned int i = 0; i < wf->get_neq(); i++)
-          meshes[i] = spaces[i]->get_mesh();
+        // The condensed numbering, if the system is to be condensed.
+        this->init_static_condensation();
 
-        Traverse trav(true);
-        trav.begin(wf->get_neq(), meshes);
+        // Node-blocked matrices need the nodes before the structure.
+        BSRMatrix<Scalar>* bsr_mat = dynamic_cast<BSRMatrix<Scalar>*>(current_mat);
+        if(bsr_mat != NULL)
+          this->set_node_blocks(bsr_mat);
+        this->node_blocked_assembly = (bsr_mat != NULL && bsr_mat->get_block_size() > 1);
 
-        if(is_DG)
+        this->free_scatter_maps();
+        // The scatter maps are those of current_mat, the other assembly targets are added to by the DOFs.
+        if(this->use_scatter_maps && !is_DG && !this->is_system_condensed() && this->current_mats.empty())
         {
-          Hermes::vector<Space<Scalar>*> mutable_spaces;
-          for(unsigned int i = 0; i < this->spaces_size; i++)
-          {
-            mutable_spaces.push_back(const_cast<Space<Scalar>*>(spaces.at(i)));
-            spaces_first_dofs[i] = 0;
-          }
-          Space<Scalar>::assign_dofs(mutable_spaces);
+          this->scatter_maps_neq = wf->get_neq();
+          this->scatter_maps = new std::map<std::pair<unsigned int, unsigned int>, int*>[this->scatter_maps_neq * this->scatter_maps_neq];
         }
 
-        Traverse::State* current_state;
-        // Loop through all elements.
-        while ((current_state = trav.get_next_state()) != NULL)
-        {
-          // Obtain assembly lists for the element at all spaces.
-          /// \todo do not get the assembly list again if the element was not changed.
-          for (unsigned int i = 0; i < wf->get_neq(); i++)
-            if(current_state->e[i] != NULL)
-              if(is_DG)
-                spaces[i]->get_element_assembly_list(current_state->e[i], &(al[i]));
-              else
-                spaces[i]->get_element_assembly_list(current_state->e[i], &(al[i]), spaces_first_dofs[i]);
-
-          if(is_DG)
-          {
-            // Number of edges ( =  number of vertices).
-            int num_edges = current_state->e[0]->nvert;
+        bool **blocks = wf->get_blocks(current_force_diagonal_blocks);
 
-            // Allocation an array of arrays of neighboring elements for every mesh x edge.
-            Element **** neighbor_elems_arrays = new Element ***[wf->get_neq()];
-            for(unsigned int i = 0; i < wf->get_neq(); i++)
-              neighbor_elems_arrays[i] = new Element **[num_edges];
+        // DG needs the neighbors - found in the traversal.
+        if(!is_DG)
+          this->create_sparsity_pattern(blocks);
+        else
+          this->create_sparse_structure_by_traversal(blocks, is_DG);
 
-            // The same, only for number of elements
-            int ** neighbor_elems_counts = new int *[wf->get_neq()];
-            for(unsigned int i = 0; i < wf->get_neq(); i++)
-              neighbor_elems_counts[i] = new int[num_edges];
+        delete [] blocks;
 
-            // Get the neighbors.
-            for(unsigned int el = 0; el < wf->get_neq(); el++)
-            {
-              NeighborSearch<Scalar> ns(current_state->e[el], meshes[el]);
+        if(this->scatter_maps != NULL)
+          this->init_scatter_maps();
+      }
 
-              // Ignoring errors (and doing nothing) in case the edge is a boundary one.
-              ns.set_ignore_errors(true);
+      // WARNING: unlike Matrix<Scalar>::alloc(), Vector<Scalar>::alloc(ndof) frees the memory occupied
+      // by previous vector before allocating
+      if(current_rhs != NULL)
+        current_rhs->alloc(this->get_system_num_dofs());
 
-              for(int ed = 0; ed < num_edges; ed++)
-              {
-                ns.set_active_edge(ed);
-                const Hermes::vector<Element *> *neighbors = ns.get_neighbors();
+      // save space seq numbers and weakform seq number, so we can detect their changes
+      for (unsigned int i = 0; i < wf->get_neq(); i++)
+        sp_seq[i] = spaces[i]->get_seq();
+    }
 
-                neighbor_elems_counts[el][ed] = ns.get_num_neighbors();
-                neighbor_elems_arrays[el][ed] = new Element *[neighbor_elems_counts[el][ed]];
-                for(int neigh = 0; neigh < neighbor_elems_counts[el][ed]; neigh++)
-                  neighbor_elems_arrays[el][ed][neigh] = (*neighbors)[neigh];
-              }
+    // The recently created sparsity patterns, shared by all the instances (see DiscreteProblem::create_sparsity_pattern()).
+    struct SparsityPattern
+    {
+      /// Spaces, meshes, DOF numbering and the blocks of the weak formulation the pattern belongs to.
+      std::vector<int> key;
+      /// Column starts and (sorted) row indices of the nonzeros.
+      std::vector<int> Ap;
+      std::vector<int> Ai;
+    };
+    static std::list<SparsityPattern> sparsity_patterns;
+    static const unsigned int max_sparsity_patterns = 4;
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::create_sparsity_pattern(bool** blocks)
+    {
+      // The space and mesh seqs identify the DOF numbering.
+      unsigned int neq = wf->get_neq();
+      std::vector<int> key;
+      key.push_back(neq);
+      key.push_back(this->ndof);
+      key.push_back(this->get_system_num_dofs());
+      for(unsigned int i = 0; i < neq; i++)
+      {
+        key.push_back(spaces[i]->get_seq());
+        key.push_back(spaces[i]->get_mesh()->get_seq());
+        key.push_back(spaces_first_dofs[i]);
+      }
+      for(unsigned int m = 0; m < neq; m++)
+        for(unsigned int n = 0; n < neq; n++)
+          key.push_back(blocks[m][n] ? 1 : 0);
+
+      // The scatter maps need the pairs of elements from the build.
+      SparsityPattern pattern;
+      bool found = false;
+      if(this->scatter_maps == NULL)
+      {
+#pragma omp critical (sparsity_patterns)
+        for(std::list<SparsityPattern>::iterator it = sparsity_patterns.begin(); it != sparsity_patterns.end(); it++)
+          if(it->key == key)
+          {
+            // Most recently used first.
+            sparsity_patterns.splice(sparsity_patterns.begin(), sparsity_patterns, it);
+            pattern = sparsity_patterns.front();
+            found = true;
+            break;
+          }
+      }
+
+      if(!found)
+      {
+        pattern.key = key;
+        this->build_sparsity_pattern(blocks, pattern.Ap, pattern.Ai);
+#pragma omp critical (sparsity_patterns)
+        {
+          sparsity_patterns.push_front(pattern);
+          if(sparsity_patterns.size() > max_sparsity_patterns)
+            sparsity_patterns.pop_back();
+        }
+      }
+
+      current_mat->create_structure(this->get_system_num_dofs(), &pattern.Ap.front(), pattern.Ai.empty() ? NULL : &pattern.Ai.front());
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::build_sparsity_pattern(bool** blocks, std::vector<int>& Ap, std::vector<int>& Ai)
+    {
+      unsigned int neq = wf->get_neq();
+      Hermes::vector<const Mesh*> meshes;
+      for(unsigned int i = 0; i < neq; i++)
+        meshes.push_back(spaces[i]->get_mesh());
+
+      Traverse trav(true);
+      int num_states;
+      Traverse::State** states = trav.get_states(meshes, num_states);
+
+      // Per-thread lists of the nonzeros (column << 32 | row) of a part of the states, sorted and without duplicities.
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      std::vector<uint64_t>* thread_entries = new std::vector<uint64_t>[num_threads_used];
+      // Scatter maps - per-thread pairs of elements (block, element of the row, element of the column).
+      std::vector<std::pair<unsigned int, std::pair<unsigned int, unsigned int> > >* thread_element_pairs = NULL;
+      if(this->scatter_maps != NULL)
+        thread_element_pairs = new std::vector<std::pair<unsigned int, std::pair<unsigned int, unsigned int> > >[num_threads_used];
+      this->caughtException = NULL;
+
+#pragma omp parallel num_threads(num_threads_used)
+      {
+        std::vector<uint64_t>& entries = thread_entries[omp_get_thread_num()];
+        AsmList<Scalar>* al = new AsmList<Scalar>[neq];
+        size_t compacted_size = 0;
+
+        // The same partitioning of the states as in the assembly.
+#pragma omp for schedule(dynamic, CHUNKSIZE)
+        for(int state_i = 0; state_i < num_states; state_i++)
+        {
+          if(this->caughtException != NULL)
+            continue;
+          try
+          {
+            Traverse::State* current_state = states[state_i];
+            for(unsigned int i = 0; i < neq; i++)
+              if(current_state->e[i] != NULL)
+                spaces[i]->get_element_assembly_list(current_state->e[i], &(al[i]), spaces_first_dofs[i]);
+
+            for(unsigned int m = 0; m < neq; m++)
+              for(unsigned int n = 0; n < neq; n++)
+                if(blocks[m][n] && current_state->e[m] != NULL && current_state->e[n] != NULL)
+                {
+                  // In the numbering of the assembled system (without the bubble DOFs if condensing).
+                  for(unsigned int i = 0; i < al[m].cnt; i++)
+                  {
+                    int row = this->system_dof(al[m].dof[i]);
+                    if(row >= 0)
+                      for(unsigned int j = 0; j < al[n].cnt; j++)
+                      {
+                        int col = this->system_dof(al[n].dof[j]);
+                        if(col >= 0)
+                          entries.push_back(((uint64_t)col << 32) | (uint64_t)row);
+                      }
+                  }
+
+                  if(thread_element_pairs != NULL)
+                    thread_element_pairs[omp_get_thread_num()].push_back(std::pair<unsigned int, std::pair<unsigned int, unsigned int> >(m * neq + n,
+                    std::pair<unsigned int, unsigned int>(current_state->e[m]->id, current_state->e[n]->id)));
+                }
+
+            // Neighboring elements share most of the entries, keep the list compact.
+            if(entries.size() > 2 * compacted_size + 4096)
+            {
+              std::sort(entries.begin(), entries.end());
+              entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+              compacted_size = entries.size();
             }
+          }
+          catch(Hermes::Exceptions::Exception& e)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = e.clone();
+          }
+          catch(std::exception& e)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(e.what());
+          }
+        }
 
-            // Pre-add into the stiffness matrix.
-            for (unsigned int m = 0; m < wf->get_neq(); m++)
-              for(unsigned int el = 0; el < wf->get_neq(); el++)
-                for(int ed = 0; ed < num_edges; ed++)
-                  for(int neigh = 0; neigh < neighbor_elems_counts[el][ed]; neigh++)
-                    if((blocks[m][el] || blocks[el][m]) && current_state->e[m] != NULL)
-                    {
-                      AsmList<Scalar>*am = &(al[m]);
-                      AsmList<Scalar>*an = new AsmList<Scalar>;
-                      spaces[el]->get_element_assembly_list(neighbor_elems_arrays[el][ed][neigh], an);
-
-                      // pretend assembling of the element stiffness matrix
-                      // register nonzero elements
-                      for (unsigned int i = 0; i < am->cnt; i++)
-                        if(am->dof[i] >= 0)
-                          for (unsigned int j = 0; j < an->cnt; j++)
-                            if(an->dof[j] >= 0)
-                            {
-                              if(blocks[m][el]) current_mat->pre_add_ij(am->dof[i], an->dof[j]);
-                              if(blocks[el][m]) current_mat->pre_add_ij(an->dof[j], am->dof[i]);
-                            }
-                            delete an;
-                    }
+        std::sort(entries.begin(), entries.end());
+        entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+        delete [] al;
+      }
 
-                    // Deallocation an array of arrays of neighboring elements
-                    // for every mesh x edge.
-                    for(unsigned int el = 0; el < wf->get_neq(); el++)
-                    {
-                      for(int ed = 0; ed < num_edges; ed++)
-                        delete [] neighbor_elems_arrays[el][ed];
-                      delete [] neighbor_elems_arrays[el];
-                    }
-                    delete [] neighbor_elems_arrays;
+      Traverse::free_states(states, num_states);
+
+      if(thread_element_pairs != NULL)
+      {
+        for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
+          for(unsigned int pair_i = 0; pair_i < thread_element_pairs[thread_i].size(); pair_i++)
+            this->scatter_maps[thread_element_pairs[thread_i][pair_i].first].insert(std::pair<std::pair<unsigned int, unsigned int>, int*>(thread_element_pairs[thread_i][pair_i].second, (int*)NULL));
+        delete [] thread_element_pairs;
+      }
+
+      if(this->caughtException != NULL)
+      {
+        delete [] thread_entries;
+        throw *(this->caughtException);
+      }
+
+      // Parallel merge - every thread merges one range of the columns from all the lists (the lists are sorted by columns first).
+      int system_ndof = this->get_system_num_dofs();
+      std::vector<int> range_starts(num_threads_used + 1);
+      for(int range_i = 0; range_i <= num_threads_used; range_i++)
+        range_starts[range_i] = (int)(((long long)system_ndof * range_i) / num_threads_used);
+      std::vector<std::vector<uint64_t> > range_entries(num_threads_used);
+      Ap.assign(system_ndof + 1, 0);
+
+#pragma omp parallel for num_threads(num_threads_used) schedule(static, 1)
+      for(int range_i = 0; range_i < num_threads_used; range_i++)
+      {
+        uint64_t range_begin = (uint64_t)range_starts[range_i] << 32;
+        uint64_t range_end = (uint64_t)range_starts[range_i + 1] << 32;
+        std::vector<uint64_t>& merged = range_entries[range_i];
+        for(int thread_i = 0; thread_i < num_threads_used; thread_i++)
+        {
+          std::vector<uint64_t>::iterator begin = std::lower_bound(thread_entries[thread_i].begin(), thread_entries[thread_i].end(), range_begin);
+          std::vector<uint64_t>::iterator end = std::lower_bound(begin, thread_entries[thread_i].end(), range_end);
+          size_t merged_size = merged.size();
+          merged.insert(merged.end(), begin, end);
+          std::inplace_merge(merged.begin(), merged.begin() + merged_size, merged.end());
+        }
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+
+        // Column counts of the range.
+        for(unsigned int entry_i = 0; entry_i < merged.size(); entry_i++)
+          Ap[(merged[entry_i] >> 32) + 1]++;
+      }
+      delete [] thread_entries;
+
+      // Compressed columns.
+      for(int col = 0; col < system_ndof; col++)
+        Ap[col + 1] += Ap[col];
+      Ai.resize(Ap[system_ndof]);
+
+#pragma omp parallel for num_threads(num_threads_used) schedule(static, 1)
+      for(int range_i = 0; range_i < num_threads_used; range_i++)
+      {
+        int* rows = Ai.empty() ? NULL : &Ai.front() + Ap[range_starts[range_i]];
+        for(unsigned int entry_i = 0; entry_i < range_entries[range_i].size(); entry_i++)
+          rows[entry_i] = (int)(range_entries[range_i][entry_i] & 0xffffffff);
+        std::vector<uint64_t>().swap(range_entries[range_i]);
+      }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::create_sparse_structure_by_traversal(bool** blocks, bool is_DG)
+    {
+      current_mat->prealloc(this->ndof);
+
+      AsmList<Scalar>* al = new AsmList<Scalar>[wf->get_neq()];
+      const Mesh** meshes = new const Mesh*[wf->get_neq()];
+
+      // Init multi-mesh traversal.
+      for (unsigned int i = 0; i < wf->get_neq(); i++)
+        meshes[i] = spaces[i]->get_mesh();
+
+      Traverse trav(true);
+      trav.begin(wf->get_neq(), meshes);
+
+      if(is_DG)
+      {
+        Hermes::vector<Space<Scalar>*> mutable_spaces;
+        for(unsigned int i = 0; i < this->spaces_size; i++)
+        {
+          mutable_spaces.push_back(const_cast<Space<Scalar>*>(spaces.at(i)));
+          spaces_first_dofs[i] = 0;
+        }
+        Space<Scalar>::assign_dofs(mutable_spaces);
+      }
 
-                    // The same, only for number of elements.
-                    for(unsigned int el = 0; el < wf->get_neq(); el++)
-                      delete [] neighbor_elems_counts[el];
-                    delete [] neighbor_elems_counts;
+      Traverse::State* current_state;
+      // Loop through all elements.
+      while ((current_state = trav.get_next_state()) != NULL)
+      {
+        // Obtain assembly lists for the element at all spaces.
+        /// \todo do not get the assembly list again if the element was not changed.
+        for (unsigned int i = 0; i < wf->get_neq(); i++)
+          if(current_state->e[i] != NULL)
+            if(is_DG)
+              spaces[i]->get_element_assembly_list(current_state->e[i], &(al[i]));
+            else
+              spaces[i]->get_element_assembly_list(current_state->e[i], &(al[i]), spaces_first_dofs[i]);
+
+        if(is_DG)
+        {
+          // Number of edges ( =  number of vertices).
+          int num_edges = current_state->e[0]->nvert;
+
+          // Allocation an array of arrays of neighboring elements for every mesh x edge.
+          Element **** neighbor_elems_arrays = new Element ***[wf->get_neq()];
+          for(unsigned int i = 0; i < wf->get_neq(); i++)
+            neighbor_elems_arrays[i] = new Element **[num_edges];
+
+          // The same, only for number of elements
+          int ** neighbor_elems_counts = new int *[wf->get_neq()];
+          for(unsigned int i = 0; i < wf->get_neq(); i++)
+            neighbor_elems_counts[i] = new int[num_edges];
+
+          // Get the neighbors.
+          for(unsigned int el = 0; el < wf->get_neq(); el++)
+          {
+            NeighborSearch<Scalar> ns(current_state->e[el], meshes[el]);
+
+            // Ignoring errors (and doing nothing) in case the edge is a boundary one.
+            ns.set_ignore_errors(true);
+
+            for(int ed = 0; ed < num_edges; ed++)
+            {
+              ns.set_active_edge(ed);
+              const Hermes::vector<Element *> *neighbors = ns.get_neighbors();
+
+              neighbor_elems_counts[el][ed] = ns.get_num_neighbors();
+              neighbor_elems_arrays[el][ed] = new Element *[neighbor_elems_counts[el][ed]];
+              for(int neigh = 0; neigh < neighbor_elems_counts[el][ed]; neigh++)
+                neighbor_elems_arrays[el][ed][neigh] = (*neighbors)[neigh];
+            }
           }
 
-          // Go through all equation-blocks of the local stiffness matrix.
+          // Pre-add into the stiffness matrix.
           for (unsigned int m = 0; m < wf->get_neq(); m++)
+            for(unsigned int el = 0; el < wf->get_neq(); el++)
+              for(int ed = 0; ed < num_edges; ed++)
+                for(int neigh = 0; neigh < neighbor_elems_counts[el][ed]; neigh++)
+                  if((blocks[m][el] || blocks[el][m]) && current_state->e[m] != NULL)
+                  {
+                    AsmList<Scalar>*am = &(al[m]);
+                    AsmList<Scalar>*an = new AsmList<Scalar>;
+                    spaces[el]->get_element_assembly_list(neighbor_elems_arrays[el][ed][neigh], an);
+
+                    // pretend assembling of the element stiffness matrix
+                    // register nonzero elements
+                    for (unsigned int i = 0; i < am->cnt; i++)
+                      if(am->dof[i] >= 0)
+                        for (unsigned int j = 0; j < an->cnt; j++)
+                          if(an->dof[j] >= 0)
+                          {
+                            if(blocks[m][el]) current_mat->pre_add_ij(am->dof[i], an->dof[j]);
+                            if(blocks[el][m]) current_mat->pre_add_ij(an->dof[j], am->dof[i]);
+                          }
+                          delete an;
+                  }
+
+                  // Deallocation an array of arrays of neighboring elements
+                  // for every mesh x edge.
+                  for(unsigned int el = 0; el < wf->get_neq(); el++)
+                  {
+                    for(int ed = 0; ed < num_edges; ed++)
+                      delete [] neighbor_elems_arrays[el][ed];
+                    delete [] neighbor_elems_arrays[el];
+                  }
+                  delete [] neighbor_elems_arrays;
+
+                  // The same, only for number of elements.
+                  for(unsigned int el = 0; el < wf->get_neq(); el++)
+                    delete [] neighbor_elems_counts[el];
+                  delete [] neighbor_elems_counts;
+        }
+
+        // Go through all equation-blocks of the local stiffness matrix.
+        for (unsigned int m = 0; m < wf->get_neq(); m++)
+        {
+          for (unsigned int n = 0; n < wf->get_neq(); n++)
           {
-            for (unsigned int n = 0; n < wf->get_neq(); n++)
+            if(blocks[m][n] && current_state->e[m] != NULL && current_state->e[n] != NULL)
             {
-              if(blocks[m][n] && current_state->e[m] != NULL && current_state->e[n] != NULL)
-              {
-                AsmList<Scalar>*am = &(al[m]);
-                AsmList<Scalar>*an = &(al[n]);
-
-                // Pretend assembling of the element stiffness matrix.
-                for (unsigned int i = 0; i < am->cnt; i++)
-                  if(am->dof[i] >= 0)
-                    for (unsigned int j = 0; j < an->cnt; j++)
-                      if(an->dof[j] >= 0)
-                        current_mat->pre_add_ij(am->dof[i], an->dof[j]);
-              }
+              AsmList<Scalar>*am = &(al[m]);
+              AsmList<Scalar>*an = &(al[n]);
+
+              // Pretend assembling of the element stiffness matrix.
+              for (unsigned int i = 0; i < am->cnt; i++)
+                if(am->dof[i] >= 0)
+                  for (unsigned int j = 0; j < an->cnt; j++)
+                    if(an->dof[j] >= 0)
+                      current_mat->pre_add_ij(am->dof[i], an->dof[j]);
+
+              // Register the pair of elements, the positions are calculated once the matrix is allocated.
+              if(this->scatter_maps != NULL)
+                this->scatter_maps[m * wf->get_neq() + n].insert(std::pair<std::pair<unsigned int, unsigned int>, int*>(std::pair<unsigned int, unsigned int>(current_state->e[m]->id, current_state->e[n]->id), (int*)NULL));
             }
           }
         }
+      }
 
-        trav.finish();
-        delete [] al;
-        delete [] meshes;
-        delete [] blocks;
+      trav.finish();
+      delete [] al;
+      delete [] meshes;
 
-        current_mat->alloc();
+      current_mat->alloc();
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_scatter_maps()
+    {
+      AsmList<Scalar> al_i, al_j;
+      for (unsigned int i = 0; i < wf->get_neq(); i++)
+      {
+        for (unsigned int j = 0; j < wf->get_neq(); j++)
+        {
+          std::map<std::pair<unsigned int, unsigned int>, int*>& block_map = this->scatter_maps[i * wf->get_neq() + j];
+          for(typename std::map<std::pair<unsigned int, unsigned int>, int*>::iterator it = block_map.begin(); it != block_map.end(); it++)
+          {
+            spaces[i]->get_element_assembly_list(spaces[i]->get_mesh()->get_element(it->first.first), &al_i, spaces_first_dofs[i]);
+            spaces[j]->get_element_assembly_list(spaces[j]->get_mesh()->get_element(it->first.second), &al_j, spaces_first_dofs[j]);
+
+            it->second = new int[al_i.cnt * al_j.cnt];
+            if(!current_mat->get_positions(al_i.cnt, al_j.cnt, al_i.dof, al_j.dof, it->second))
+            {
+              // The matrix type does not support this.
+              this->free_scatter_maps();
+              return;
+            }
+          }
+        }
       }
+      this->scatter_maps_matrix = current_mat;
+    }
 
-      // WARNING: unlike Matrix<Scalar>::alloc(), Vector<Scalar>::alloc(ndof) frees the memory occupied
-      // by previous vector before allocating
-      if(current_rhs != NULL)
-        current_rhs->alloc(this->ndof);
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_scatter_maps()
+    {
+      if(this->scatter_maps == NULL)
+        return;
 
-      // save space seq numbers and weakform seq number, so we can detect their changes
-      for (unsigned int i = 0; i < wf->get_neq(); i++)
-        sp_seq[i] = spaces[i]->get_seq();
+      for (unsigned int i = 0; i < this->scatter_maps_neq * this->scatter_maps_neq; i++)
+        for(typename std::map<std::pair<unsigned int, unsigned int>, int*>::iterator it = this->scatter_maps[i].begin(); it != this->scatter_maps[i].end(); it++)
+          if(it->second != NULL)
+            delete [] it->second;
+      delete [] this->scatter_maps;
+      this->scatter_maps = NULL;
+      this->scatter_maps_matrix = NULL;
+      this->scatter_maps_neq = 0;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_arenas(unsigned int num_threads)
+    {
+      while(this->arenas.size() < num_threads)
+        this->arenas.push_back(new Arena());
+      for(unsigned int i = 0; i < this->arenas.size(); i++)
+        this->arenas[i]->reset();
+      this->state_local_matrices.assign(this->arenas.size(), (StateLocalMatrix*)NULL);
+      if(this->order_caches.size() < num_threads)
+        this->order_caches.resize(num_threads);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_node_blocks(BSRMatrix<Scalar>* mat)
+    {
+      int* dof_block = new int[this->ndof];
+      int* dof_component = new int[this->ndof];
+
+      // The components - the leading spaces like the first one (DG spaces are numbered differently, see create_sparse_structure()).
+      unsigned int block_size = 1;
+      if(!this->DG_matrix_forms_present && !this->DG_vector_forms_present)
+        while(block_size < this->spaces_size && spaces[block_size]->get_mesh() == spaces[0]->get_mesh() && spaces[block_size]->get_type() == spaces[0]->get_type()
+          && spaces[block_size]->get_num_dofs() == spaces[0]->get_num_dofs())
+          block_size++;
+
+      int num_blocks = spaces[0]->get_num_dofs();
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+      {
+        for(int dof_i = 0; dof_i < spaces[space_i]->get_num_dofs(); dof_i++)
+        {
+          int dof = this->spaces_first_dofs[space_i] + dof_i;
+          if(space_i < block_size)
+          {
+            dof_block[dof] = dof_i;
+            dof_component[dof] = space_i;
+          }
+          else
+          {
+            dof_block[dof] = num_blocks++;
+            dof_component[dof] = 0;
+          }
+        }
+      }
+
+      mat->set_blocks(this->ndof, block_size, num_blocks, dof_block, dof_component);
+      delete [] dof_block;
+      delete [] dof_component;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::begin_state_local_matrix(AsmList<Scalar>** current_als, Traverse::State* current_state, bool gather_rhs)
+    {
+      Arena* arena = this->current_arena();
+      StateLocalMatrix* state_matrix = arena->allocate_array<StateLocalMatrix>(1);
+      state_matrix->space_dofs = arena->allocate_array<int*>(this->spaces_size);
+      state_matrix->offsets = arena->allocate_array<unsigned int>(this->spaces_size);
+      state_matrix->count = 0;
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+      {
+        state_matrix->offsets[space_i] = state_matrix->count;
+        state_matrix->space_dofs[space_i] = current_state->e[space_i] == NULL ? NULL : current_als[space_i]->dof;
+        if(current_state->e[space_i] != NULL)
+          state_matrix->count += current_als[space_i]->cnt;
+      }
+
+      state_matrix->dofs = arena->allocate_array<int>(state_matrix->count);
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+        if(current_state->e[space_i] != NULL)
+          memcpy(state_matrix->dofs + state_matrix->offsets[space_i], current_als[space_i]->dof, current_als[space_i]->cnt * sizeof(int));
+      state_matrix->matrix = arena->allocate_matrix<Scalar>(state_matrix->count);
+      state_matrix->rhs = NULL;
+      if(gather_rhs)
+      {
+        state_matrix->rhs = arena->allocate_array<Scalar>(state_matrix->count);
+        memset(state_matrix->rhs, 0, state_matrix->count * sizeof(Scalar));
+      }
+
+      this->state_local_matrices[omp_get_thread_num()] = state_matrix;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::end_state_local_matrix()
+    {
+      StateLocalMatrix* state_matrix = this->state_local_matrices[omp_get_thread_num()];
+      this->state_local_matrices[omp_get_thread_num()] = NULL;
+      current_mat->add(state_matrix->count, state_matrix->count, state_matrix->matrix, state_matrix->dofs, state_matrix->dofs);
+    }
+
+    // LU decomposition of the dense n x n matrix a in place, with partial pivoting (rows swapped as in perm). False if a is singular.
+    template<typename Scalar>
+    static bool dense_lu_decompose(Scalar** a, int n, int* perm)
+    {
+      for(int i = 0; i < n; i++)
+        perm[i] = i;
+      for(int k = 0; k < n; k++)
+      {
+        int pivot = k;
+        for(int i = k + 1; i < n; i++)
+          if(std::abs(a[i][k]) > std::abs(a[pivot][k]))
+            pivot = i;
+        if(std::abs(a[pivot][k]) == 0.0)
+          return false;
+        if(pivot != k)
+        {
+          std::swap(a[pivot], a[k]);
+          std::swap(perm[pivot], perm[k]);
+        }
+        for(int i = k + 1; i < n; i++)
+        {
+          Scalar factor = a[i][k] / a[k][k];
+          a[i][k] = factor;
+          for(int j = k + 1; j < n; j++)
+            a[i][j] -= factor * a[k][j];
+        }
+      }
+      return true;
+    }
+
+    // Solves a x = b by the decomposition from dense_lu_decompose(), x overwrites b (tmp - n temporaries).
+    template<typename Scalar>
+    static void dense_lu_solve(Scalar** a, int n, const int* perm, Scalar* b, Scalar* tmp)
+    {
+      for(int i = 0; i < n; i++)
+      {
+        Scalar sum = b[perm[i]];
+        for(int j = 0; j < i; j++)
+          sum -= a[i][j] * tmp[j];
+        tmp[i] = sum;
+      }
+      for(int i = n - 1; i >= 0; i--)
+      {
+        Scalar sum = tmp[i];
+        for(int j = i + 1; j < n; j++)
+          sum -= a[i][j] * b[j];
+        b[i] = sum / a[i][i];
+      }
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::static_condensation_to_be_used() const
+    {
+      if(!this->static_condensation || !this->is_linear)
+        return false;
+      if(this->current_mat == NULL || this->current_rhs == NULL || this->current_apply_x != NULL)
+        return false;
+      if(dynamic_cast<BSRMatrix<Scalar>*>(this->current_mat) != NULL)
+        return false;
+      if(!this->wf->mfDG.empty() || !this->wf->vfDG.empty())
+        return false;
+
+      // One mesh for everything - then every state is a whole element and holds all the couplings of its bubble functions.
+      const Mesh* mesh = this->spaces[0]->get_mesh();
+      for(unsigned int space_i = 1; space_i < this->spaces_size; space_i++)
+        if(this->spaces[space_i]->get_mesh() != mesh)
+          return false;
+      for(unsigned int ext_i = 0; ext_i < this->wf->ext.size(); ext_i++)
+        if(this->wf->ext[ext_i] != NULL && this->wf->ext[ext_i]->get_mesh() != mesh)
+          return false;
+      for(unsigned int form_i = 0; form_i < this->wf->get_forms().size(); form_i++)
+        for(unsigned int ext_i = 0; ext_i < this->wf->get_forms()[form_i]->ext.size(); ext_i++)
+          if(this->wf->get_forms()[form_i]->ext[ext_i] != NULL && this->wf->get_forms()[form_i]->ext[ext_i]->get_mesh() != mesh)
+            return false;
+      return true;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_static_condensation()
+    {
+      this->free_static_condensation();
+      this->static_condensation_structure = this->static_condensation_to_be_used();
+      if(!this->static_condensation_structure)
+        return;
+
+      // The bubble DOFs of the elements (see Space::get_bubble_assembly_list()).
+      std::vector<int> dofs(this->ndof, 0);
+      int bubble_count = 0;
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+      {
+        const Space<Scalar>* space = this->spaces[space_i];
+        Element* e;
+        for_all_active_elements(e, space->get_mesh())
+        {
+          typename Space<Scalar>::ElementData* ed = &space->edata[e->id];
+          for(int i = 0, dof = ed->bdof; i < ed->n; i++, dof += space->stride)
+          {
+            dofs[this->spaces_first_dofs[space_i] + dof] = -1;
+            bubble_count++;
+          }
+        }
+      }
+
+      // Nothing to condense, or nothing left.
+      if(bubble_count == 0 || bubble_count == this->ndof)
+        return;
+
+      this->condensed_ndof = 0;
+      for(int dof = 0; dof < this->ndof; dof++)
+        if(dofs[dof] == 0)
+          dofs[dof] = this->condensed_ndof++;
+      this->condensed_dofs.swap(dofs);
+
+      this->condensed_elements.assign(this->spaces[0]->get_mesh()->get_max_element_id(), CondensedElement());
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_static_condensation()
+    {
+      for(unsigned int i = 0; i < this->condensed_elements.size(); i++)
+      {
+        delete [] this->condensed_elements[i].bubble_dofs;
+        delete [] this->condensed_elements[i].interface_dofs;
+        delete [] this->condensed_elements[i].matrix;
+        delete [] this->condensed_elements[i].rhs;
+      }
+      std::vector<CondensedElement>().swap(this->condensed_elements);
+      std::vector<int>().swap(this->condensed_dofs);
+      this->condensed_ndof = 0;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::condense_state_local_matrix(Traverse::State* current_state)
+    {
+      StateLocalMatrix* state_matrix = this->state_local_matrices[omp_get_thread_num()];
+      this->state_local_matrices[omp_get_thread_num()] = NULL;
+      Arena* arena = this->current_arena();
+
+      // The local positions of the bubble DOFs (B) and of the other ones (I), the Dirichlet ones are left out.
+      unsigned int count = state_matrix->count;
+      unsigned int* bubble = arena->allocate_array<unsigned int>(count);
+      unsigned int* interface = arena->allocate_array<unsigned int>(count);
+      unsigned int bubble_count = 0, interface_count = 0;
+      for(unsigned int k = 0; k < count; k++)
+      {
+        int dof = state_matrix->dofs[k];
+        if(dof < 0)
+          continue;
+        if(this->condensed_dofs[dof] < 0)
+          bubble[bubble_count++] = k;
+        else
+          interface[interface_count++] = k;
+      }
+
+      // The records of the previous assembly.
+      CondensedElement& record = this->condensed_elements[current_state->rep->id];
+      delete [] record.bubble_dofs;
+      delete [] record.interface_dofs;
+      delete [] record.matrix;
+      delete [] record.rhs;
+      record = CondensedElement();
+
+      Scalar** local_matrix = state_matrix->matrix;
+      Scalar* local_rhs = state_matrix->rhs;
+
+      if(bubble_count > 0)
+      {
+        // X = A_BB^{-1} [A_BI | b_B].
+        Scalar** bubble_matrix = arena->allocate_matrix<Scalar>(bubble_count);
+        for(unsigned int i = 0; i < bubble_count; i++)
+          for(unsigned int j = 0; j < bubble_count; j++)
+            bubble_matrix[i][j] = local_matrix[bubble[i]][bubble[j]];
+        int* perm = arena->allocate_array<int>(bubble_count);
+        if(!dense_lu_decompose(bubble_matrix, bubble_count, perm))
+          throw Hermes::Exceptions::Exception("Singular block of the bubble functions of the element %d in the static condensation.", current_state->rep->id);
+
+        record.bubble_count = bubble_count;
+        record.interface_count = interface_count;
+        record.bubble_dofs = new int[bubble_count];
+        record.interface_dofs = new int[interface_count];
+        record.matrix = new Scalar[bubble_count * interface_count];
+        record.rhs = new Scalar[bubble_count];
+        for(unsigned int i = 0; i < bubble_count; i++)
+          record.bubble_dofs[i] = state_matrix->dofs[bubble[i]];
+        for(unsigned int j = 0; j < interface_count; j++)
+          record.interface_dofs[j] = state_matrix->dofs[interface[j]];
+
+        Scalar* column = arena->allocate_array<Scalar>(bubble_count);
+        Scalar* tmp = arena->allocate_array<Scalar>(bubble_count);
+        for(unsigned int j = 0; j < interface_count; j++)
+        {
+          for(unsigned int i = 0; i < bubble_count; i++)
+            column[i] = local_matrix[bubble[i]][interface[j]];
+          dense_lu_solve(bubble_matrix, bubble_count, perm, column, tmp);
+          for(unsigned int i = 0; i < bubble_count; i++)
+            record.matrix[i * interface_count + j] = column[i];
+        }
+        for(unsigned int i = 0; i < bubble_count; i++)
+          record.rhs[i] = local_rhs[bubble[i]];
+        dense_lu_solve(bubble_matrix, bubble_count, perm, record.rhs, tmp);
+      }
+
+      // The Schur complement S = A_II - A_IB X, g = b_I - A_IB A_BB^{-1} b_B in the condensed numbering.
+      Scalar** schur_matrix = arena->allocate_matrix<Scalar>(interface_count);
+      Scalar* schur_rhs = arena->allocate_array<Scalar>(interface_count);
+      int* schur_dofs = arena->allocate_array<int>(interface_count);
+      unsigned int* schur_rhs_dofs = arena->allocate_array<unsigned int>(interface_count);
+      for(unsigned int i = 0; i < interface_count; i++)
+      {
+        Scalar* row = local_matrix[interface[i]];
+        for(unsigned int j = 0; j < interface_count; j++)
+        {
+          Scalar value = row[interface[j]];
+          for(unsigned int k = 0; k < bubble_count; k++)
+            value -= row[bubble[k]] * record.matrix[k * interface_count + j];
+          schur_matrix[i][j] = value;
+        }
+        Scalar value = local_rhs[interface[i]];
+        for(unsigned int k = 0; k < bubble_count; k++)
+          value -= row[bubble[k]] * record.rhs[k];
+        schur_rhs[i] = value;
+        schur_dofs[i] = this->condensed_dofs[state_matrix->dofs[interface[i]]];
+        schur_rhs_dofs[i] = schur_dofs[i];
+      }
+
+      current_mat->add(interface_count, interface_count, schur_matrix, schur_dofs, schur_dofs);
+      current_rhs->add(interface_count, schur_rhs_dofs, schur_rhs);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::recover_condensed_solution(const Scalar* condensed_sln, Scalar* sln) const
+    {
+      if(!this->is_system_condensed())
+        throw Hermes::Exceptions::Exception("DiscreteProblem::recover_condensed_solution() called, but the system was not condensed.");
+
+      for(int dof = 0; dof < this->ndof; dof++)
+        if(this->condensed_dofs[dof] >= 0)
+          sln[dof] = condensed_sln[this->condensed_dofs[dof]];
+
+      // Every bubble DOF belongs to exactly one element, the interface values are only read.
+      int num_elements = (int)this->condensed_elements.size();
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel for num_threads(num_threads_used) schedule(dynamic, 64)
+      for(int element_i = 0; element_i < num_elements; element_i++)
+      {
+        const CondensedElement& record = this->condensed_elements[element_i];
+        for(unsigned int i = 0; i < record.bubble_count; i++)
+        {
+          Scalar value = record.rhs[i];
+          const Scalar* row = record.matrix + i * record.interface_count;
+          for(unsigned int j = 0; j < record.interface_count; j++)
+            value -= row[j] * sln[record.interface_dofs[j]];
+          sln[record.bubble_dofs[i]] = value;
+        }
+      }
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::get_assembly_schedule(Traverse::State** states, int num_states, std::vector<int>& ordered_states, std::vector<int>& colour_starts)
+    {
+      ordered_states.clear();
+      colour_starts.clear();
+      colour_starts.push_back(0);
+
+      if(this->do_not_store_states)
+      {
+        colour_starts.push_back(num_states);
+        return false;
+      }
+
+      // The states of the subdomain (see set_subdomain()).
+      std::vector<int> subdomain_states;
+      for(int state_i = 0; state_i < num_states; state_i++)
+        if(this->is_in_subdomain(states[state_i]))
+          subdomain_states.push_back(state_i);
+      int num_subdomain_states = subdomain_states.size();
+
+      if(!this->coloured_assembly || this->DG_matrix_forms_present || this->DG_vector_forms_present)
+      {
+        ordered_states.swap(subdomain_states);
+        colour_starts.push_back(num_subdomain_states);
+        return false;
+      }
+
+      // Greedy colouring - every state gets the first colour not used by any state sharing a DOF with it.
+      // The states are indexed within the subdomain (subdomain_states).
+      std::vector<std::vector<int> > dof_colours(this->ndof);
+      std::vector<int> state_colours(num_subdomain_states);
+      // forbidden[colour] == k : the colour is used by a state sharing a DOF with the state subdomain_states[k].
+      std::vector<int> forbidden;
+      std::vector<int> dofs;
+      AsmList<Scalar> al;
+      for(int k = 0; k < num_subdomain_states; k++)
+      {
+        Traverse::State* state = states[subdomain_states[k]];
+        dofs.clear();
+        for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+        {
+          if(state->e[space_i] == NULL)
+            continue;
+          this->spaces[space_i]->get_element_assembly_list(state->e[space_i], &al, this->spaces_first_dofs[space_i]);
+          for(unsigned int j = 0; j < al.cnt; j++)
+            if(al.dof[j] >= 0)
+              dofs.push_back(al.dof[j]);
+        }
+
+        for(unsigned int dof_i = 0; dof_i < dofs.size(); dof_i++)
+          for(unsigned int colour_i = 0; colour_i < dof_colours[dofs[dof_i]].size(); colour_i++)
+            forbidden[dof_colours[dofs[dof_i]][colour_i]] = k;
+
+        int colour = 0;
+        while(colour < (int)forbidden.size() && forbidden[colour] == k)
+          colour++;
+        if(colour == (int)forbidden.size())
+          forbidden.push_back(-1);
+        state_colours[k] = colour;
+
+        for(unsigned int dof_i = 0; dof_i < dofs.size(); dof_i++)
+          if(dof_colours[dofs[dof_i]].empty() || dof_colours[dofs[dof_i]].back() != colour)
+            dof_colours[dofs[dof_i]].push_back(colour);
+      }
+
+      // Group the states by colours, keeping the traversal order within a colour.
+      int num_colours = forbidden.size();
+      colour_starts.resize(num_colours + 1, 0);
+      for(int k = 0; k < num_subdomain_states; k++)
+        colour_starts[state_colours[k] + 1]++;
+      for(int colour_i = 0; colour_i < num_colours; colour_i++)
+        colour_starts[colour_i + 1] += colour_starts[colour_i];
+      std::vector<int> positions(colour_starts.begin(), colour_starts.end() - 1);
+      ordered_states.resize(num_subdomain_states);
+      for(int k = 0; k < num_subdomain_states; k++)
+        ordered_states[positions[state_colours[k]]++] = subdomain_states[k];
+
+      return true;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::get_state_batch_key(Traverse::State* state, std::vector<int>& key)
+    {
+      key.clear();
+      key.push_back(state->rep->get_mode());
+      key.push_back(state->rep->marker);
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+      {
+        if(state->e[space_i] == NULL)
+          key.push_back(-1);
+        else
+          key.push_back(this->spaces[space_i]->get_element_order(state->e[space_i]->id));
+      }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::get_state_batches(Traverse::State** states, std::vector<int>& ordered_states, const std::vector<int>& colour_starts,
+      std::vector<int>& batch_starts, std::vector<int>& colour_batch_starts)
+    {
+      batch_starts.clear();
+      colour_batch_starts.clear();
+
+      // One state per batch.
+      if(!this->state_batching || this->do_not_store_states)
+      {
+        for(int state_i = 0; state_i <= colour_starts.back(); state_i++)
+          batch_starts.push_back(state_i);
+        colour_batch_starts = colour_starts;
+        return;
+      }
+
+      // Sorted by the key within every colour, the traversal order kept among the states of the same key.
+      std::vector<std::pair<std::vector<int>, int> > keyed_states;
+      colour_batch_starts.push_back(0);
+      for(unsigned int colour_i = 0; colour_i + 1 < colour_starts.size(); colour_i++)
+      {
+        keyed_states.resize(colour_starts[colour_i + 1] - colour_starts[colour_i]);
+        for(int state_i = colour_starts[colour_i]; state_i < colour_starts[colour_i + 1]; state_i++)
+        {
+          std::pair<std::vector<int>, int>& keyed_state = keyed_states[state_i - colour_starts[colour_i]];
+          this->get_state_batch_key(states[ordered_states[state_i]], keyed_state.first);
+          keyed_state.second = ordered_states[state_i];
+        }
+        std::sort(keyed_states.begin(), keyed_states.end());
+
+        for(unsigned int k = 0; k < keyed_states.size(); k++)
+        {
+          ordered_states[colour_starts[colour_i] + k] = keyed_states[k].second;
+          if(k == 0 || keyed_states[k].first != keyed_states[k - 1].first || colour_starts[colour_i] + (int)k - batch_starts.back() == H2D_STATE_BATCH_SIZE)
+            batch_starts.push_back(colour_starts[colour_i] + k);
+        }
+        colour_batch_starts.push_back(batch_starts.size());
+      }
+      batch_starts.push_back(colour_starts.back());
+    }
+
+    template<typename Scalar>
+    int* DiscreteProblem<Scalar>::get_scatter_positions(unsigned int i, unsigned int j, Traverse::State* current_state)
+    {
+      if(this->scatter_maps == NULL || this->scatter_maps_matrix != current_mat)
+        return NULL;
+
+      std::map<std::pair<unsigned int, unsigned int>, int*>& block_map = this->scatter_maps[i * wf->get_neq() + j];
+      typename std::map<std::pair<unsigned int, unsigned int>, int*>::iterator it = block_map.find(std::pair<unsigned int, unsigned int>(current_state->e[i]->id, current_state->e[j]->id));
+      if(it == block_map.end())
+        return NULL;
+      return it->second;
     }
 
     template<typename Scalar>
@@ -891,33 +2093,159 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void DiscreteProblem<Scalar>::init_assembling(Scalar* coeff_vec, PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms)
+    AssemblyTask<Scalar>* DiscreteProblem<Scalar>::assemble_async(Scalar* coeff_vec, SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs,
+      bool force_diagonal_blocks, Table* block_weights, AsyncTask* dependency)
+    {
+      AssemblyTask<Scalar>* task = new AssemblyTask<Scalar>(this, coeff_vec, mat, rhs, force_diagonal_blocks, block_weights);
+      if(dependency != NULL)
+        task->depends_on(dependency);
+      task->start();
+      return task;
+    }
+
+    template<typename Scalar>
+    AssemblyTask<Scalar>::AssemblyTask(DiscreteProblem<Scalar>* dp, Scalar* coeff_vec, SparseMatrix<Scalar>* mat, Vector<Scalar>* rhs,
+      bool force_diagonal_blocks, Table* block_weights) : dp(dp), coeff_vec(coeff_vec), mat(mat), rhs(rhs),
+      force_diagonal_blocks(force_diagonal_blocks), block_weights(block_weights)
     {
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+    }
+
+    template<typename Scalar>
+    AssemblyTask<Scalar>::~AssemblyTask()
+    {
+      this->join();
+    }
+
+    template<typename Scalar>
+    void AssemblyTask<Scalar>::run()
+    {
+      // The virtual assemble() - DiscreteProblemLinear assembles its own way.
+      if(this->coeff_vec == NULL)
+        this->dp->assemble(this->mat, this->rhs, this->force_diagonal_blocks, this->block_weights);
+      else
+        this->dp->assemble(this->coeff_vec, this->mat, this->rhs, this->force_diagonal_blocks, this->block_weights);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_thread_contexts()
+    {
+      int num_threads = Hermes2DApi.get_num_threads();
+      if(this->thread_pss != NULL && (this->thread_contexts_num_threads != num_threads || this->thread_contexts_neq != wf->get_neq()))
+        this->free_thread_contexts();
+
+      if(this->thread_pss == NULL)
       {
-        pss[i] = new PrecalcShapeset*[wf->get_neq()];
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
-          pss[i][j] = new PrecalcShapeset(spaces[j]->shapeset);
+        this->thread_contexts_num_threads = num_threads;
+        this->thread_contexts_neq = wf->get_neq();
+        this->thread_pss = new PrecalcShapeset**[num_threads];
+        this->thread_spss = new PrecalcShapeset**[num_threads];
+        this->thread_refmaps = new RefMap**[num_threads];
+        this->thread_als = new AsmList<Scalar>**[num_threads];
+        this->thread_npss = new PrecalcShapeset**[num_threads];
+        this->thread_nspss = new PrecalcShapeset**[num_threads];
+        this->thread_nrefmaps = new RefMap**[num_threads];
+        for(int i = 0; i < num_threads; i++)
+        {
+          this->thread_pss[i] = new PrecalcShapeset*[wf->get_neq()];
+          this->thread_spss[i] = new PrecalcShapeset*[wf->get_neq()];
+          this->thread_refmaps[i] = new RefMap*[wf->get_neq()];
+          this->thread_als[i] = new AsmList<Scalar>*[wf->get_neq()];
+          this->thread_npss[i] = new PrecalcShapeset*[wf->get_neq()];
+          this->thread_nspss[i] = new PrecalcShapeset*[wf->get_neq()];
+          this->thread_nrefmaps[i] = new RefMap*[wf->get_neq()];
+          for (unsigned int j = 0; j < wf->get_neq(); j++)
+          {
+            this->thread_pss[i][j] = new PrecalcShapeset(spaces[j]->shapeset);
+            this->thread_spss[i][j] = new PrecalcShapeset(this->thread_pss[i][j]);
+            this->thread_refmaps[i][j] = new RefMap();
+            this->thread_refmaps[i][j]->set_quad_2d(&g_quad_2d_std);
+            this->thread_als[i][j] = new AsmList<Scalar>();
+            this->thread_npss[i][j] = new PrecalcShapeset(spaces[j]->shapeset);
+            this->thread_nspss[i][j] = new PrecalcShapeset(this->thread_npss[i][j]);
+            this->thread_nrefmaps[i][j] = new RefMap();
+            this->thread_nrefmaps[i][j]->set_quad_2d(&g_quad_2d_std);
+          }
+        }
+        return;
       }
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        spss[i] = new PrecalcShapeset*[wf->get_neq()];
+
+      // Re-binding: only a space with another shapeset needs new PrecalcShapesets.
+      for(int i = 0; i < num_threads; i++)
         for (unsigned int j = 0; j < wf->get_neq(); j++)
-          spss[i][j] = new PrecalcShapeset(pss[i][j]);
-      }
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+          if(this->thread_pss[i][j]->get_shapeset() != spaces[j]->shapeset)
+          {
+            delete this->thread_spss[i][j];
+            delete this->thread_pss[i][j];
+            this->thread_pss[i][j] = new PrecalcShapeset(spaces[j]->shapeset);
+            this->thread_spss[i][j] = new PrecalcShapeset(this->thread_pss[i][j]);
+            delete this->thread_nspss[i][j];
+            delete this->thread_npss[i][j];
+            this->thread_npss[i][j] = new PrecalcShapeset(spaces[j]->shapeset);
+            this->thread_nspss[i][j] = new PrecalcShapeset(this->thread_npss[i][j]);
+          }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_thread_contexts()
+    {
+      if(this->thread_pss == NULL)
+        return;
+
+      for(int i = 0; i < this->thread_contexts_num_threads; i++)
       {
-        refmaps[i] = new RefMap*[wf->get_neq()];
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
+        for (int j = 0; j < this->thread_contexts_neq; j++)
         {
-          refmaps[i][j] = new RefMap();
-          refmaps[i][j]->set_quad_2d(&g_quad_2d_std);
+          delete this->thread_spss[i][j];
+          delete this->thread_pss[i][j];
+          delete this->thread_refmaps[i][j];
+          delete this->thread_als[i][j];
+          delete this->thread_nspss[i][j];
+          delete this->thread_npss[i][j];
+          delete this->thread_nrefmaps[i][j];
         }
+        delete [] this->thread_pss[i];
+        delete [] this->thread_spss[i];
+        delete [] this->thread_refmaps[i];
+        delete [] this->thread_als[i];
+        delete [] this->thread_npss[i];
+        delete [] this->thread_nspss[i];
+        delete [] this->thread_nrefmaps[i];
+      }
+      delete [] this->thread_pss;
+      delete [] this->thread_spss;
+      delete [] this->thread_refmaps;
+      delete [] this->thread_als;
+      delete [] this->thread_npss;
+      delete [] this->thread_nspss;
+      delete [] this->thread_nrefmaps;
+      this->thread_pss = NULL;
+      this->thread_spss = NULL;
+      this->thread_refmaps = NULL;
+      this->thread_als = NULL;
+      this->thread_npss = NULL;
+      this->thread_nspss = NULL;
+      this->thread_nrefmaps = NULL;
+      this->thread_contexts_num_threads = 0;
+      this->thread_contexts_neq = 0;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_assembling(Scalar* coeff_vec, PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms)
+    {
+      // The PrecalcShapesets, RefMaps and assembly lists are those of the thread contexts.
+      this->init_thread_contexts();
+      this->init_form_markers();
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
+      {
+        pss[i] = this->thread_pss[i];
+        spss[i] = this->thread_spss[i];
+        refmaps[i] = this->thread_refmaps[i];
+        als[i] = this->thread_als[i];
       }
 
       // U_ext functions
       if(!is_linear)
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           if(coeff_vec != NULL)
           {
@@ -928,6 +2256,7 @@ namespace Hermes
               for (int j = 0; j < wf->get_neq(); j++)
               {
                 u_ext[i][j] = new Solution<Scalar>(spaces[j]->get_mesh());
+                u_ext[i][j]->set_lazy_conversion(this->u_ext_coeff_vec != NULL);
                 Solution<Scalar>::vector_to_solution(coeff_vec, spaces[j], u_ext[i][j], !RungeKutta, first_dof);
                 first_dof += spaces[j]->get_num_dofs();
               }
@@ -954,21 +2283,16 @@ namespace Hermes
           }
         }
 
-        // Assembly lists
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-        {
-          als[i] = new AsmList<Scalar>*[wf->get_neq()];
-          for (unsigned int j = 0; j < wf->get_neq(); j++)
-            als[i][j] = new AsmList<Scalar>();
-        }
-
-        // Weakforms.
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        // Weakforms. The clones of the forms share their coefficient functions and material data, the clones of the
+        // external Solutions share the coefficient arrays (Solution::clone()), only the mutable state is per thread.
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           weakforms[i] = this->wf->clone();
           weakforms[i]->cloneMembers(this->wf);
         }
 
+        this->cache_hits = this->cache_misses = this->cache_evictions = 0;
+
         assert(cache_element_stored == NULL);
         cache_element_stored = new bool*[this->spaces_size];
         for(unsigned int i = 0; i < this->spaces_size; i++)
@@ -979,35 +2303,11 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void DiscreteProblem<Scalar>::deinit_assembling(PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms)
-    {
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
-          delete pss[i][j];
-        delete [] pss[i];
-      }
-      delete [] pss;
-
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
-          delete spss[i][j];
-        delete [] spss[i];
-      }
-      delete [] spss;
-
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
-          delete refmaps[i][j];
-        delete [] refmaps[i];
-      }
-      delete [] refmaps;
-
+    void DiscreteProblem<Scalar>::deinit_assembling(PrecalcShapeset*** pss , PrecalcShapeset*** spss, RefMap*** refmaps, Solution<Scalar>*** u_ext, AsmList<Scalar>*** als, WeakForm<Scalar>** weakforms)
+    {
       if(u_ext != NULL)
       {
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           if(u_ext[i] != NULL)
           {
@@ -1019,15 +2319,13 @@ namespace Hermes
         delete [] u_ext;
       }
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
-      {
-        for (unsigned int j = 0; j < wf->get_neq(); j++)
-          delete als[i][j];
-        delete [] als[i];
-      }
+      // The inner arrays belong to the thread contexts.
+      delete [] pss;
+      delete [] spss;
+      delete [] refmaps;
       delete [] als;
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         weakforms[i]->free_ext();
         delete weakforms[i];
@@ -1061,8 +2359,14 @@ namespace Hermes
         if(block_weights->get_size() != wf->get_neq())
           throw Exceptions::LengthException(6, block_weights->get_size(), wf->get_neq());
 
-      // Creating matrix sparse structure.
-      create_sparse_structure();
+      // Creating matrix sparse structure (there is none in the matrix-free application).
+      if(this->current_apply_x == NULL)
+      {
+        bool structure_created = !is_up_to_date();
+        create_sparse_structure();
+        if(!this->current_mats.empty() || !this->current_rhss.empty())
+          this->create_target_structures(structure_created);
+      }
 
       // Initial check of meshes and spaces.
       for(unsigned int ext_i = 0; ext_i < this->wf->ext.size(); ext_i++)
@@ -1072,12 +2376,16 @@ namespace Hermes
       }
 
       // Structures that cloning will be done into.
-      PrecalcShapeset*** pss = new PrecalcShapeset**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      PrecalcShapeset*** spss = new PrecalcShapeset**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      RefMap*** refmaps = new RefMap**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      Solution<Scalar>*** u_ext = new Solution<Scalar>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      AsmList<Scalar>*** als = new AsmList<Scalar>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      WeakForm<Scalar>** weakforms = new WeakForm<Scalar>*[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+      PrecalcShapeset*** pss = new PrecalcShapeset**[Hermes2DApi.get_num_threads()];
+      PrecalcShapeset*** spss = new PrecalcShapeset**[Hermes2DApi.get_num_threads()];
+      RefMap*** refmaps = new RefMap**[Hermes2DApi.get_num_threads()];
+      Solution<Scalar>*** u_ext = new Solution<Scalar>**[Hermes2DApi.get_num_threads()];
+      AsmList<Scalar>*** als = new AsmList<Scalar>**[Hermes2DApi.get_num_threads()];
+      WeakForm<Scalar>** weakforms = new WeakForm<Scalar>*[Hermes2DApi.get_num_threads()];
+
+      // The volumetric u_ext is summed from the coefficients and the cached shape functions, the u_ext Solutions are
+      // only asked for orders then and converted on demand (surface, DG and own-quadrature forms).
+      this->u_ext_coeff_vec = this->is_linear ? NULL : coeff_vec;
 
       // Fill these structures.
       init_assembling(coeff_vec, pss, spss, refmaps, u_ext, als, weakforms);
@@ -1095,14 +2403,24 @@ namespace Hermes
       for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
         meshes.push_back(spaces[space_i]->get_mesh());
 
+      this->assembly_profile.reset();
       Traverse trav_master(true);
-      unsigned int num_states = trav_master.get_num_states(meshes);
-
-      trav_master.begin(meshes.size(), &(meshes.front()));
+      int num_states;
+      Traverse::State** states = NULL;
+      {
+        AssemblyProfile::Timer timer(this->profiling ? &this->assembly_profile : NULL, AssemblyProfile::Traversal);
+        if(this->do_not_store_states)
+        {
+          num_states = trav_master.get_num_states(meshes);
+          trav_master.begin(meshes.size(), &(meshes.front()));
+        }
+        else
+          states = trav_master.get_states(meshes, num_states);
+      }
 
-      Traverse* trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      Hermes::vector<Transformable *>* fns = new Hermes::vector<Transformable *>[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      Traverse* trav = new Traverse[Hermes2DApi.get_num_threads()];
+      Hermes::vector<Transformable *>* fns = new Hermes::vector<Transformable *>[Hermes2DApi.get_num_threads()];
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         for (unsigned j = 0; j < spaces.size(); j++)
           fns[i].push_back(pss[i][j]);
@@ -1126,7 +2444,8 @@ namespace Hermes
           u_ext[i][j]->set_quad_2d(&g_quad_2d_std);
         }
         trav[i].begin(meshes.size(), &(meshes.front()), &(fns[i].front()));
-        trav[i].stack = trav_master.stack;
+        if(this->do_not_store_states)
+          trav[i].stack = trav_master.stack;
       }
 
       int state_i;
@@ -1138,23 +2457,121 @@ namespace Hermes
       AsmList<Scalar>** current_als;
       WeakForm<Scalar>* current_weakform;
 
-#define CHUNKSIZE 1
-      int num_threads_used = Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads);
-#pragma omp parallel shared(trav_master, mat, rhs ) private(state_i, current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_weakform) num_threads(num_threads_used)
+      int num_threads_used = Hermes2DApi.get_num_threads();
+
+      bool use_assembly_keys = this->reproducible_assembly && !this->do_not_store_states && this->current_mat != NULL && this->current_mats.empty();
+      if(use_assembly_keys)
+        this->current_mat->begin_thread_private_assembly(num_threads_used);
+
+      this->init_arenas(num_threads_used);
+      this->thread_profiles.assign(num_threads_used, AssemblyProfile());
+
+      std::vector<int> ordered_states;
+      std::vector<int> colour_starts;
+      bool conflict_free = this->get_assembly_schedule(states, num_states, ordered_states, colour_starts);
+      std::vector<int> batch_starts;
+      std::vector<int> colour_batch_starts;
+      this->get_state_batches(states, ordered_states, colour_starts, batch_starts, colour_batch_starts);
+      int batch_i;
+
+      // The forms are deferred to the end of the batches only if they are added to the matrix one by one.
+      if(this->state_batching && !this->do_not_store_states && !use_assembly_keys && !this->node_blocked_assembly && !this->is_system_condensed()
+        && this->thread_assembly_targets.empty() && !this->form_profiling)
+        this->state_batches.assign(num_threads_used, std::vector<BatchedMatrixForm>());
+
+      // DG - the neighbors of all the states up-front.
+      if((this->DG_matrix_forms_present || this->DG_vector_forms_present) && this->DG_interfaces_precalculation && !this->do_not_store_states)
+        this->precalculate_DG_interfaces(states, num_states);
+      if(conflict_free)
+      {
+        if(this->current_mat != NULL)
+          this->current_mat->set_conflict_free_assembly();
+        if(this->current_rhs != NULL)
+          this->current_rhs->set_conflict_free_assembly();
+        for(unsigned int i = 1; i < this->current_mats.size(); i++)
+          this->current_mats[i]->set_conflict_free_assembly();
+        for(unsigned int i = 1; i < this->current_rhss.size(); i++)
+          this->current_rhss[i]->set_conflict_free_assembly();
+      }
+
+#pragma omp parallel shared(trav_master, mat, rhs ) private(state_i, batch_i, current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_weakform) num_threads(num_threads_used)
       {
-#pragma omp for schedule(static, CHUNKSIZE)
-        for(state_i = 0; state_i < num_states; state_i++)
+        // Colour by colour, the barrier at the end of the omp for separates the colours.
+        // A batch (see set_state_batching()) is assembled by one thread.
+        for(unsigned int colour_i = 0; colour_i + 1 < colour_starts.size(); colour_i++)
         {
-          if(this->caughtException != NULL)
-            continue;
-          try
+#pragma omp for schedule(dynamic, CHUNKSIZE)
+          for(batch_i = colour_batch_starts[colour_i]; batch_i < colour_batch_starts[colour_i + 1]; batch_i++)
           {
-            Traverse::State current_state;
-#pragma omp critical (get_next_state)
+            for(state_i = batch_starts[batch_i]; state_i < batch_starts[batch_i + 1]; state_i++)
             {
+              if(this->caughtException != NULL)
+                continue;
               try
               {
-                current_state = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
+                Traverse::State* current_state;
+                Traverse::State current_state_copy;
+                {
+                  AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Traversal);
+                  if(this->do_not_store_states)
+                  {
+#pragma omp critical (get_next_state)
+                    {
+                      try
+                      {
+                        current_state_copy = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
+                      }
+                      catch(Hermes::Exceptions::Exception& e)
+                      {
+                        if(this->caughtException == NULL)
+                          this->caughtException = e.clone();
+                      }
+                      catch(std::exception& e)
+                      {
+                        if(this->caughtException == NULL)
+                          this->caughtException = new Hermes::Exceptions::Exception(e.what());
+                      }
+                    }
+                    current_state = &current_state_copy;
+                  }
+                  else
+                  {
+                    // The states are stored, each one is claimed by exactly one thread.
+                    current_state = states[ordered_states[state_i]];
+                    trav[omp_get_thread_num()].set_active_state(current_state);
+                    if(use_assembly_keys)
+                      this->current_mat->set_assembly_key(ordered_states[state_i]);
+                  }
+                }
+                // The stored states are those of the subdomain already (see get_assembly_schedule()).
+                if(this->do_not_store_states && !this->is_in_subdomain(current_state))
+                  continue;
+
+                current_pss = pss[omp_get_thread_num()];
+                current_spss = spss[omp_get_thread_num()];
+                current_refmaps = refmaps[omp_get_thread_num()];
+                current_u_ext = u_ext[omp_get_thread_num()];
+                current_als = als[omp_get_thread_num()];
+                current_weakform = weakforms[omp_get_thread_num()];
+
+                // One state is a collection of (virtual) elements sharing
+                // the same physical location on (possibly) different meshes.
+                // This is then the same element of the virtual union mesh.
+                // The proper sub-element mappings to all the functions of
+                // this stage is supplied by the function Traverse::get_next_state()
+                // called in the while loop.
+                assemble_one_state(current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_state, current_weakform);
+                this->current_profile()->bytes_allocated += this->current_arena()->get_used_size();
+                this->current_arena()->reset();
+
+                if(DG_matrix_forms_present || DG_vector_forms_present)
+                  assemble_one_DG_state(current_pss, current_spss, current_refmaps, current_als, current_state, current_weakform->mfDG, current_weakform->vfDG, trav[omp_get_thread_num()].fn, current_weakform,
+                    this->thread_npss[omp_get_thread_num()], this->thread_nspss[omp_get_thread_num()], this->thread_nrefmaps[omp_get_thread_num()],
+                    this->DG_interfaces == NULL ? NULL : this->DG_interfaces[ordered_states[state_i]]);
+
+                // The forms deferred by the states of the batch (see set_state_batching()).
+                if(state_i + 1 == batch_starts[batch_i + 1] && !this->state_batches.empty())
+                  this->assemble_state_batch();
               }
               catch(Hermes::Exceptions::Exception& e)
               {
@@ -1167,45 +2584,43 @@ namespace Hermes
                   this->caughtException = new Hermes::Exceptions::Exception(e.what());
               }
             }
-
-            current_pss = pss[omp_get_thread_num()];
-            current_spss = spss[omp_get_thread_num()];
-            current_refmaps = refmaps[omp_get_thread_num()];
-            current_u_ext = u_ext[omp_get_thread_num()];
-            current_als = als[omp_get_thread_num()];
-            current_weakform = weakforms[omp_get_thread_num()];
-
-            // One state is a collection of (virtual) elements sharing
-            // the same physical location on (possibly) different meshes.
-            // This is then the same element of the virtual union mesh.
-            // The proper sub-element mappings to all the functions of
-            // this stage is supplied by the function Traverse::get_next_state()
-            // called in the while loop.
-            assemble_one_state(current_pss, current_spss, current_refmaps, current_u_ext, current_als, &current_state, current_weakform);
-
-            if(DG_matrix_forms_present || DG_vector_forms_present)
-              assemble_one_DG_state(current_pss, current_spss, current_refmaps, current_als, &current_state, current_weakform->mfDG, current_weakform->vfDG, trav[omp_get_thread_num()].fn, current_weakform);
-          }
-          catch(Hermes::Exceptions::Exception& e)
-          {
-            if(this->caughtException == NULL)
-              this->caughtException = e.clone();
-          }
-          catch(std::exception& e)
-          {
-            if(this->caughtException == NULL)
-              this->caughtException = new Hermes::Exceptions::Exception(e.what());
           }
         }
       }
 
+      this->free_DG_interfaces();
+      this->state_batches.clear();
+
+      // The profiles of the threads summed, current_profile() is NULL from now on.
+      for(unsigned int i = 0; i < this->thread_profiles.size(); i++)
+        this->assembly_profile.add(this->thread_profiles[i]);
+      this->thread_profiles.clear();
+      this->accumulated_assembly_profile.add(this->assembly_profile);
+      this->update_memory_usage();
+
+      if(conflict_free)
+      {
+        if(this->current_mat != NULL)
+          this->current_mat->set_conflict_free_assembly(false);
+        if(this->current_rhs != NULL)
+          this->current_rhs->set_conflict_free_assembly(false);
+        for(unsigned int i = 1; i < this->current_mats.size(); i++)
+          this->current_mats[i]->set_conflict_free_assembly(false);
+        for(unsigned int i = 1; i < this->current_rhss.size(); i++)
+          this->current_rhss[i]->set_conflict_free_assembly(false);
+      }
+
       deinit_assembling(pss, spss, refmaps, u_ext, als, weakforms);
+      this->u_ext_coeff_vec = NULL;
 
-      trav_master.finish();
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      if(this->do_not_store_states)
+        trav_master.finish();
+      else
+        Traverse::free_states(states, num_states);
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         trav[i].finish();
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         fns[i].clear();
       }
@@ -1217,6 +2632,10 @@ namespace Hermes
         current_mat->finish();
       if(current_rhs != NULL)
         current_rhs->finish();
+      for(unsigned int i = 1; i < this->current_mats.size(); i++)
+        this->current_mats[i]->finish();
+      for(unsigned int i = 1; i < this->current_rhss.size(); i++)
+        this->current_rhss[i]->finish();
 
       if(DG_matrix_forms_present || DG_vector_forms_present)
       {
@@ -1230,6 +2649,65 @@ namespace Hermes
         throw *(this->caughtException);
     }
 
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::assemble(Scalar* coeff_vec, Hermes::vector<SparseMatrix<Scalar>*> mats, Hermes::vector<Vector<Scalar>*> rhss,
+      bool force_diagonal_blocks, Table* block_weights)
+    {
+      unsigned int num_targets = std::max(mats.size(), rhss.size());
+      if(num_targets == 0)
+        throw Exceptions::Exception("No matrices and no right-hand sides in DiscreteProblem::assemble().");
+      if(!mats.empty() && mats.size() != num_targets)
+        throw Exceptions::LengthException(2, mats.size(), num_targets);
+      if(!rhss.empty() && rhss.size() != num_targets)
+        throw Exceptions::LengthException(3, rhss.size(), num_targets);
+      for(unsigned int i = 0; i < mats.size(); i++)
+      {
+        if(mats[i] == NULL)
+          throw Exceptions::NullException(2, i);
+        if(dynamic_cast<BSRMatrix<Scalar>*>(mats[i]) != NULL)
+          throw Exceptions::Exception("Node-blocked (BSR) matrices are not supported by the assembling of several operators.");
+      }
+      for(unsigned int i = 0; i < rhss.size(); i++)
+        if(rhss[i] == NULL)
+          throw Exceptions::NullException(3, i);
+      if(!this->wf->mfDG.empty() || !this->wf->vfDG.empty())
+        throw Exceptions::Exception("DG forms are not supported by the assembling of several operators.");
+      if(this->wf->is_matrix_free())
+        throw Exceptions::Exception("Matrix-free weak forms are not supported by the assembling of several operators.");
+      for(unsigned int i = 0; i < this->wf->get_forms().size(); i++)
+      {
+        if(this->wf->get_forms()[i]->assembly_target >= num_targets)
+          throw Exceptions::Exception("A form of the weak formulation is assembled into the target %u, only %u targets passed to DiscreteProblem::assemble().",
+            this->wf->get_forms()[i]->assembly_target, num_targets);
+        VectorForm<Scalar>* vector_form = dynamic_cast<VectorForm<Scalar>*>(this->wf->get_forms()[i]);
+        if(vector_form != NULL && vector_form->load_case > 0)
+          throw Exceptions::Exception("Load cases are not supported by the assembling of several operators.");
+      }
+
+      // The structure and the numbering of the condensed system are those of one matrix.
+      bool static_condensation = this->static_condensation;
+      this->static_condensation = false;
+      this->current_mats = mats;
+      this->current_rhss = rhss;
+      this->thread_assembly_targets.assign(Hermes2DApi.get_num_threads(), 0);
+      try
+      {
+        this->assemble(coeff_vec, mats.empty() ? NULL : mats[0], rhss.empty() ? NULL : rhss[0], force_diagonal_blocks, block_weights);
+      }
+      catch(...)
+      {
+        this->static_condensation = static_condensation;
+        this->current_mats.clear();
+        this->current_rhss.clear();
+        this->thread_assembly_targets.clear();
+        throw;
+      }
+      this->static_condensation = static_condensation;
+      this->current_mats.clear();
+      this->current_rhss.clear();
+      this->thread_assembly_targets.clear();
+    }
+
     template<typename Scalar>
     void DiscreteProblem<Scalar>::assemble(Scalar* coeff_vec, Vector<Scalar>* rhs,
       bool force_diagonal_blocks, Table* block_weights)
@@ -1238,8 +2716,366 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    DiscreteProblem<Scalar>::CacheRecordPerSubIdx::CacheRecordPerSubIdx() : fnsSurface(NULL)
+    void DiscreteProblem<Scalar>::set_linearization_point(Scalar* coeff_vec)
+    {
+      delete [] this->linearization_point;
+      this->linearization_point = NULL;
+      if(coeff_vec != NULL)
+      {
+        this->linearization_point = new Scalar[this->ndof];
+        memcpy(this->linearization_point, coeff_vec, this->ndof * sizeof(Scalar));
+      }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::apply(const Scalar* x, Scalar* y)
+    {
+      if(x == NULL || y == NULL)
+        throw Exceptions::NullException(x == NULL ? 1 : 2);
+
+      // Thread-private results, summed up in a fixed order afterwards.
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      this->current_apply_y = new Scalar*[num_threads_used];
+      for(int i = 0; i < num_threads_used; i++)
+      {
+        this->current_apply_y[i] = new Scalar[this->ndof];
+        memset(this->current_apply_y[i], 0, this->ndof * sizeof(Scalar));
+      }
+      this->current_apply_x = x;
+
+      try
+      {
+        DiscreteProblem<Scalar>::assemble(this->linearization_point, (SparseMatrix<Scalar>*)NULL, (Vector<Scalar>*)NULL);
+      }
+      catch(...)
+      {
+        this->current_apply_x = NULL;
+        for(int i = 0; i < num_threads_used; i++)
+          delete [] this->current_apply_y[i];
+        delete [] this->current_apply_y;
+        this->current_apply_y = NULL;
+        throw;
+      }
+
+      memcpy(y, this->current_apply_y[0], this->ndof * sizeof(Scalar));
+      for(int i = 1; i < num_threads_used; i++)
+        for(int dof_i = 0; dof_i < this->ndof; dof_i++)
+          y[dof_i] += this->current_apply_y[i][dof_i];
+
+      this->current_apply_x = NULL;
+      for(int i = 0; i < num_threads_used; i++)
+        delete [] this->current_apply_y[i];
+      delete [] this->current_apply_y;
+      this->current_apply_y = NULL;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::add_local_matrix(unsigned int m, unsigned int n, Scalar** local_matrix, int* rows, int* cols, int* scatter_positions)
+    {
+      AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Scatter);
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->scatter_operations++;
+
+      if(this->current_apply_x != NULL)
+      {
+        // Matrix-free application - y += local_matrix * x, Dirichlet (negative) dofs skipped as in SparseMatrix::add().
+        Scalar* y = this->current_apply_y[omp_get_thread_num()];
+        for(unsigned int i = 0; i < m; i++)
+        {
+          if(rows[i] < 0)
+            continue;
+          Scalar y_i = 0;
+          for(unsigned int j = 0; j < n; j++)
+            if(cols[j] >= 0)
+              y_i += local_matrix[i][j] * this->current_apply_x[cols[j]];
+          y[rows[i]] += y_i;
+        }
+      }
+      else if(scatter_positions != NULL && this->current_mats.empty())
+        current_mat->add_at_positions(m, n, local_matrix, scatter_positions);
+      else
+      {
+        // Gathering the local matrix of the state (see begin_state_local_matrix()) - if these are the volumetric assembly lists.
+        StateLocalMatrix* state_matrix = (this->node_blocked_assembly || this->is_system_condensed()) ? this->state_local_matrices[omp_get_thread_num()] : NULL;
+        if(state_matrix != NULL)
+        {
+          int row_offset = -1, col_offset = -1;
+          for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+          {
+            if(state_matrix->space_dofs[space_i] == rows)
+              row_offset = state_matrix->offsets[space_i];
+            if(state_matrix->space_dofs[space_i] == cols)
+              col_offset = state_matrix->offsets[space_i];
+          }
+          if(row_offset >= 0 && col_offset >= 0)
+          {
+            for(unsigned int i = 0; i < m; i++)
+              for(unsigned int j = 0; j < n; j++)
+                state_matrix->matrix[row_offset + i][col_offset + j] += local_matrix[i][j];
+            return;
+          }
+
+          // Static condensation gathers also the surface forms - their (boundary) assembly lists are found DOF by DOF.
+          if(state_matrix->rhs != NULL)
+          {
+            Arena* arena = this->current_arena();
+            int* col_positions = arena->allocate_array<int>(n);
+            for(unsigned int j = 0; j < n; j++)
+              col_positions[j] = this->find_state_local_position(state_matrix, cols[j]);
+            for(unsigned int i = 0; i < m; i++)
+            {
+              int row_position = this->find_state_local_position(state_matrix, rows[i]);
+              if(row_position < 0)
+                continue;
+              for(unsigned int j = 0; j < n; j++)
+                if(col_positions[j] >= 0)
+                  state_matrix->matrix[row_position][col_positions[j]] += local_matrix[i][j];
+            }
+            return;
+          }
+        }
+
+        this->get_target_matrix()->add(m, n, local_matrix, rows, cols);
+      }
+    }
+
+    template<typename Scalar>
+    int DiscreteProblem<Scalar>::find_state_local_position(StateLocalMatrix* state_matrix, int dof) const
+    {
+      if(dof < 0)
+        return -1;
+      for(unsigned int k = 0; k < state_matrix->count; k++)
+        if(state_matrix->dofs[k] == dof)
+          return k;
+      return -1;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::add_local_vector(unsigned int count, unsigned int* dofs, Scalar* values)
     {
+      AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Scatter);
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->scatter_operations++;
+
+      StateLocalMatrix* state_matrix = this->is_system_condensed() ? this->state_local_matrices[omp_get_thread_num()] : NULL;
+      if(state_matrix != NULL && state_matrix->rhs != NULL)
+      {
+        for(unsigned int i = 0; i < count; i++)
+        {
+          int position = this->find_state_local_position(state_matrix, (int)dofs[i]);
+          if(position >= 0)
+            state_matrix->rhs[position] += values[i];
+        }
+      }
+      else
+        this->get_target_rhs()->add(count, dofs, values);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::add_local_vector(int dof, Scalar value)
+    {
+      StateLocalMatrix* state_matrix = this->is_system_condensed() ? this->state_local_matrices[omp_get_thread_num()] : NULL;
+      if(state_matrix != NULL && state_matrix->rhs != NULL)
+      {
+        int position = this->find_state_local_position(state_matrix, dof);
+        if(position >= 0)
+          state_matrix->rhs[position] += value;
+      }
+      else
+      {
+        this->get_target_rhs()->add(dof, value);
+        // The Dirichlet lift is the same for all the load cases.
+        for(unsigned int i = 0; i < current_load_case_rhs.size(); i++)
+          current_load_case_rhs[i]->add(dof, value);
+      }
+    }
+
+    template<typename Scalar>
+    SparseMatrix<Scalar>* DiscreteProblem<Scalar>::get_target_matrix() const
+    {
+      if(this->current_mats.empty())
+        return this->current_mat;
+      return this->current_mats[this->thread_assembly_targets[omp_get_thread_num()]];
+    }
+
+    template<typename Scalar>
+    Vector<Scalar>* DiscreteProblem<Scalar>::get_target_rhs() const
+    {
+      if(this->current_rhss.empty())
+        return this->current_rhs;
+      return this->current_rhss[this->thread_assembly_targets[omp_get_thread_num()]];
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_thread_assembly_target(Form<Scalar>* form)
+    {
+      if(!this->thread_assembly_targets.empty())
+        this->thread_assembly_targets[omp_get_thread_num()] = form->assembly_target;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::create_target_structures(bool structure_created)
+    {
+      int system_ndof = this->get_system_num_dofs();
+      if(this->current_mats.size() > 1)
+      {
+        // The same pattern as current_mat, found among the recent ones by create_sparsity_pattern().
+        bool **blocks = wf->get_blocks(current_force_diagonal_blocks);
+        SparseMatrix<Scalar>* first_mat = this->current_mat;
+        try
+        {
+          for(unsigned int i = 1; i < this->current_mats.size(); i++)
+          {
+            if(structure_created || this->current_mats[i]->get_size() != (unsigned int)system_ndof)
+            {
+              this->current_mats[i]->free();
+              this->current_mat = this->current_mats[i];
+              this->create_sparsity_pattern(blocks);
+            }
+            else
+              this->current_mats[i]->zero();
+          }
+        }
+        catch(...)
+        {
+          this->current_mat = first_mat;
+          delete [] blocks;
+          throw;
+        }
+        this->current_mat = first_mat;
+        delete [] blocks;
+      }
+
+      for(unsigned int i = 1; i < this->current_rhss.size(); i++)
+      {
+        if(this->current_rhss[i]->length() != system_ndof)
+          this->current_rhss[i]->alloc(system_ndof);
+        else
+          this->current_rhss[i]->zero();
+      }
+    }
+
+    template<typename Scalar>
+    DiscreteProblem<Scalar>::CacheRecordPerSubIdx::CacheRecordPerSubIdx() : fnsSurface(NULL), surface_edges(0), bytes(0), in_use(0), referenced(false)
+    {
+    }
+
+    template<typename Scalar>
+    size_t DiscreteProblem<Scalar>::CacheRecordPerSubIdx::calculate_bytes() const
+    {
+#ifdef H2D_USE_SECOND_DERIVATIVES
+      const int fn_arrays = 4;
+#else
+      const int fn_arrays = 3;
+#endif
+      size_t bytes = sizeof(CacheRecordPerSubIdx);
+
+      // Volumetric: functions (values, derivatives), geometry (x, y), jacobian x weights.
+      bytes += this->asmlistCnt * (sizeof(Func<double>*) + sizeof(Func<double>) + fn_arrays * this->n_quadrature_points * sizeof(double));
+      bytes += sizeof(Geom<double>) + 3 * this->n_quadrature_points * sizeof(double);
+
+      // Surface: the same + normals and tangents.
+      if(this->fnsSurface != NULL)
+      {
+        for(unsigned int edge_i = 0; edge_i < this->nvert; edge_i++)
+        {
+          if(this->fnsSurface[edge_i] == NULL)
+            continue;
+          int np = this->n_quadrature_pointsSurface[edge_i];
+          bytes += this->asmlistSurfaceCnt[edge_i] * (sizeof(Func<double>*) + sizeof(Func<double>) + fn_arrays * np * sizeof(double));
+          bytes += sizeof(Geom<double>) + 7 * np * sizeof(double);
+        }
+      }
+
+      // Incremental reassembly: the kept matrix form values.
+      for(typename std::map<int, MatrixFormValues>::const_iterator it = this->matrix_form_values.begin(); it != this->matrix_form_values.end(); it++)
+        bytes += (it->second.cnt_i + it->second.cnt_j) * sizeof(int) + it->second.cnt_i * it->second.cnt_j * sizeof(Scalar);
+
+      return bytes;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::acquire_cache_records(Traverse::State* current_state, CacheRecordPerSubIdx** records)
+    {
+      for(unsigned int i = 0; i < this->spaces_size; i++)
+      {
+        if(current_state->e[i] == NULL)
+          continue;
+
+        CacheRecordPerSubIdx* record = NULL;
+        omp_lock_t* lock = this->get_cache_lock(current_state->e[i]->id);
+        omp_set_lock(lock);
+        if(this->cache_records_sub_idx[i][current_state->e[i]->id] != NULL)
+          record = this->cache_records_sub_idx[i][current_state->e[i]->id]->find(current_state->sub_idx[i]);
+        if(record != NULL)
+        {
+          record->in_use++;
+          record->referenced = true;
+        }
+        omp_unset_lock(lock);
+
+        // Not all in the cache - release what was acquired.
+        if(record == NULL)
+        {
+          this->release_cache_records(current_state, records);
+          return false;
+        }
+
+        records[i] = record;
+      }
+
+#pragma omp atomic
+      this->cache_hits++;
+
+      return true;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::release_cache_records(Traverse::State* current_state, CacheRecordPerSubIdx** records)
+    {
+      for(unsigned int i = 0; i < this->spaces_size; i++)
+      {
+        if(current_state->e[i] == NULL || records[i] == NULL)
+          continue;
+        omp_set_lock(this->get_cache_lock(current_state->e[i]->id));
+        records[i]->in_use--;
+        omp_unset_lock(this->get_cache_lock(current_state->e[i]->id));
+        records[i] = NULL;
+      }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::evict_cache_records()
+    {
+      // At most two rounds - the first one may only clear the referenced flags.
+      size_t steps = 2 * this->cache_clock.size();
+      while(this->cache_bytes > this->cache_budget && steps-- > 0 && !this->cache_clock.empty())
+      {
+        if(this->cache_clock_hand == this->cache_clock.end())
+          this->cache_clock_hand = this->cache_clock.begin();
+        CacheRecordPerSubIdx* record = *this->cache_clock_hand;
+        this->cache_clock_hand++;
+
+        omp_lock_t* lock = this->get_cache_lock(record->element_id);
+        omp_set_lock(lock);
+        bool evict = (record->in_use == 0 && !record->referenced);
+        if(evict)
+          this->cache_records_sub_idx[record->space_i][record->element_id]->erase(record->sub_idx);
+        else
+          record->referenced = false;
+        omp_unset_lock(lock);
+
+        if(evict)
+        {
+          this->remove_from_clock(record);
+          this->cache_bytes -= record->bytes;
+          record->clear();
+          delete record;
+          this->cache_evictions++;
+        }
+      }
     }
 
     template<typename Scalar>
@@ -1256,6 +3092,8 @@ namespace Hermes
       this->geometry->free();
       delete this->geometry;
 
+      this->clear_matrix_form_values();
+
       if(this->fnsSurface != NULL)
       {
         for(unsigned int edge_i = 0; edge_i < nvert; edge_i++)
@@ -1286,6 +3124,17 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::CacheRecordPerSubIdx::clear_matrix_form_values()
+    {
+      for(typename std::map<int, MatrixFormValues>::iterator it = this->matrix_form_values.begin(); it != this->matrix_form_values.end(); it++)
+      {
+        delete [] it->second.idx;
+        delete [] it->second.values;
+      }
+      this->matrix_form_values.clear();
+    }
+
     template<typename Scalar>
     void DiscreteProblem<Scalar>::CacheRecordPerElement::clear()
     {
@@ -1324,63 +3173,99 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void DiscreteProblem<Scalar>::calculate_cache_records(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, AsmList<Scalar>** current_als, Traverse::State* current_state,
-      AsmList<Scalar>** current_alsSurface, WeakForm<Scalar>* current_wf)
-    {
-      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
-      {
-        bool new_cache = false;
-        if(current_state->e[space_i] == NULL)
-          continue;
-
-        // No sub_idx map for this element.
-#pragma omp critical (cache_records_sub_idx_map)
-        {
-          try
-          {
-            if(this->cache_records_sub_idx[space_i][current_state->e[space_i]->id] == NULL)
-            {
-              this->cache_records_sub_idx[space_i][current_state->e[space_i]->id] = new std::map<uint64_t, CacheRecordPerSubIdx*>;
-              new_cache = true;
-            }
-            else
-            {
-              // If the sub_idx map exists AND contains a record for this sub_idx, we need to delete the record.
-              typename std::map<uint64_t, CacheRecordPerSubIdx*>::iterator it = this->cache_records_sub_idx[space_i][current_state->e[space_i]->id]->find(current_state->sub_idx[space_i]);
-              if(it != this->cache_records_sub_idx[space_i][current_state->e[space_i]->id]->end())
-                (*it).second->clear();
-              else new_cache = true;
-            }
+    void DiscreteProblem<Scalar>::calculate_cache_records(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext, AsmList<Scalar>** current_als, Traverse::State* current_state,
+      AsmList<Scalar>** current_alsSurface, WeakForm<Scalar>* current_wf, unsigned int surface_edges, CacheRecordPerSubIdx** records)
+    {
+      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
+      {
+        if(current_state->e[space_i] == NULL)
+          continue;
 
-            // Insert the new record.
-            if(new_cache)
-              this->cache_records_sub_idx[space_i][current_state->e[space_i]->id]->insert(std::pair<uint64_t, CacheRecordPerSubIdx*>(current_state->sub_idx[space_i], new CacheRecordPerSubIdx));
-          }
-          catch(Hermes::Exceptions::Exception& e)
+        omp_lock_t* lock = this->get_cache_lock(current_state->e[space_i]->id);
+        bool locked = false;
+        try
+        {
+          // If the sub_idx table exists AND contains a record for this sub_idx, we need to delete the record.
+          CacheRecordPerSubIdx* record = NULL;
+          omp_set_lock(lock);
+          locked = true;
+          if(this->cache_records_sub_idx[space_i][current_state->e[space_i]->id] == NULL)
+            this->cache_records_sub_idx[space_i][current_state->e[space_i]->id] = new CacheRecordSubIdxTable;
+          else
+            record = this->cache_records_sub_idx[space_i][current_state->e[space_i]->id]->find(current_state->sub_idx[space_i]);
+          if(record != NULL)
           {
-            if(this->caughtException == NULL)
-              this->caughtException = e.clone();
+            record->in_use++;
+            record->referenced = true;
+            records[space_i] = record;
+            record->clear();
           }
-          catch(std::exception& e)
+          omp_unset_lock(lock);
+          locked = false;
+
+          // Insert the new record - first to the clock (in use, so not evicted before it is filled), then to the table.
+          if(record == NULL)
           {
-            if(this->caughtException == NULL)
-              this->caughtException = new Hermes::Exceptions::Exception(e.what());
+            record = new CacheRecordPerSubIdx;
+            record->space_i = space_i;
+            record->element_id = current_state->e[space_i]->id;
+            record->sub_idx = current_state->sub_idx[space_i];
+            record->in_use = 1;
+            record->referenced = true;
+            records[space_i] = record;
+#pragma omp critical (cache_records_clock)
+            record->clock_position = this->cache_clock.insert(this->cache_clock_hand, record);
+
+            omp_set_lock(lock);
+            locked = true;
+            this->cache_records_sub_idx[space_i][current_state->e[space_i]->id]->insert(record);
+            omp_unset_lock(lock);
+            locked = false;
           }
         }
+        catch(Hermes::Exceptions::Exception& e)
+        {
+          if(this->caughtException == NULL)
+            this->caughtException = e.clone();
+        }
+        catch(std::exception& e)
+        {
+          if(this->caughtException == NULL)
+            this->caughtException = new Hermes::Exceptions::Exception(e.what());
+        }
+        if(locked)
+          omp_unset_lock(lock);
         if(this->caughtException != NULL)
           return;
       }
 
+#pragma omp atomic
+      this->cache_misses++;
+
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->cache_misses++;
+
       // Order calculation.
       int order = this->wf->global_integration_order_set ? this->wf->global_integration_order : 0;
-      if(order == 0)
+      if(order == 0 && this->is_fvm)
+      {
+        // Piecewise constant functions - the midpoint rule.
+        for(unsigned int i = 0; i < this->spaces_size; i++)
+          if(current_state->e[i] != NULL && (this->spaces[i]->get_type() != HERMES_L2_SPACE || this->spaces[i]->get_element_order(current_state->e[i]->id) != 0))
+            throw Hermes::Exceptions::Exception("The finite volume mode (set_fvm()) needs L2 spaces of order 0, the space %i is not one.", i);
+        order = 1;
+        limit_order(order, current_state->rep->get_mode());
+      }
+      else if(order == 0)
       {
+        AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::OrderEstimation);
         Hermes::vector<MatrixFormVol<Scalar>*> current_mfvol = current_wf->mfvol;
         Hermes::vector<VectorFormVol<Scalar>*> current_vfvol = current_wf->vfvol;
 
         for(int current_mfvol_i = 0; current_mfvol_i < current_mfvol.size(); current_mfvol_i++)
         {
-          if(!form_to_be_assembled(current_mfvol[current_mfvol_i], current_state))
+          if(!form_to_be_assembled(current_mfvol[current_mfvol_i], current_state) || current_mfvol[current_mfvol_i]->has_own_quadrature())
             continue;
           current_mfvol[current_mfvol_i]->wf = current_wf;
           int orderTemp = calc_order_matrix_form(current_mfvol[current_mfvol_i], current_refmaps, current_u_ext, current_state);
@@ -1390,7 +3275,7 @@ namespace Hermes
 
         for(int current_vfvol_i = 0; current_vfvol_i < current_vfvol.size(); current_vfvol_i++)
         {
-          if(!form_to_be_assembled(current_vfvol[current_vfvol_i], current_state))
+          if(!form_to_be_assembled(current_vfvol[current_vfvol_i], current_state) || current_vfvol[current_vfvol_i]->has_own_quadrature())
             continue;
           current_vfvol[current_vfvol_i]->wf = current_wf;
           int orderTemp = calc_order_vector_form(current_vfvol[current_vfvol_i], current_refmaps, current_u_ext, current_state);
@@ -1402,7 +3287,7 @@ namespace Hermes
         {
           for(int current_mfvol_i = 0; current_mfvol_i < current_mfvol.size(); current_mfvol_i++)
           {
-            if(!form_to_be_assembled(current_mfvol[current_mfvol_i], current_state))
+            if(!form_to_be_assembled(current_mfvol[current_mfvol_i], current_state) || current_mfvol[current_mfvol_i]->has_own_quadrature())
               continue;
             current_mfvol[current_mfvol_i]->wf = current_wf;
             int orderTemp = calc_order_matrix_form(current_mfvol[current_mfvol_i], current_refmaps, current_u_ext, current_state);
@@ -1411,7 +3296,7 @@ namespace Hermes
           }
           for(int current_vfvol_i = 0; current_vfvol_i < current_vfvol.size(); current_vfvol_i++)
           {
-            if(!form_to_be_assembled(current_vfvol[current_vfvol_i], current_state))
+            if(!form_to_be_assembled(current_vfvol[current_vfvol_i], current_state) || current_vfvol[current_vfvol_i]->has_own_quadrature())
               continue;
             current_vfvol[current_vfvol_i]->wf = current_wf;
             int orderTemp = calc_order_vector_form(current_vfvol[current_vfvol_i], current_refmaps, current_u_ext, current_state);
@@ -1421,18 +3306,18 @@ namespace Hermes
         }
 
         // Surface forms.
-        if(current_state->isBnd && (current_wf->mfsurf.size() > 0 || current_wf->vfsurf.size() > 0))
+        if(surface_edges != 0)
         {
           Hermes::vector<MatrixFormSurf<Scalar>*> current_mfsurf = current_wf->mfsurf;
           Hermes::vector<VectorFormSurf<Scalar>*> current_vfsurf = current_wf->vfsurf;
 
           for (current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
           {
-            if(!current_state->bnd[current_state->isurf])
+            if(!(surface_edges & (1 << current_state->isurf)))
               continue;
             for(int current_mfsurf_i = 0; current_mfsurf_i < current_mfsurf.size(); current_mfsurf_i++)
             {
-              if(!form_to_be_assembled(current_mfsurf[current_mfsurf_i], current_state))
+              if(!form_to_be_assembled(current_mfsurf[current_mfsurf_i], current_state) || current_mfsurf[current_mfsurf_i]->has_own_quadrature())
                 continue;
               current_mfsurf[current_mfsurf_i]->wf = current_wf;
               int orderTemp = calc_order_matrix_form(current_mfsurf[current_mfsurf_i], current_refmaps, current_u_ext, current_state);
@@ -1442,7 +3327,7 @@ namespace Hermes
 
             for(int current_vfsurf_i = 0; current_vfsurf_i < current_vfsurf.size(); current_vfsurf_i++)
             {
-              if(!form_to_be_assembled(current_vfsurf[current_vfsurf_i], current_state))
+              if(!form_to_be_assembled(current_vfsurf[current_vfsurf_i], current_state) || current_vfsurf[current_vfsurf_i]->has_own_quadrature())
                 continue;
               current_vfsurf[current_vfsurf_i]->wf = current_wf;
               int orderTemp = calc_order_vector_form(current_vfsurf[current_vfsurf_i], current_refmaps, current_u_ext, current_state);
@@ -1485,10 +3370,7 @@ namespace Hermes
           this->cache_element_stored[i][current_state->e[i]->id] = true;
         }
 
-        CacheRecordPerSubIdx* newRecord;
-
-#pragma omp critical (cache_records_sub_idx_map)
-        newRecord = (*this->cache_records_sub_idx[i][current_state->e[i]->id]->find(current_state->sub_idx[i])).second;
+        CacheRecordPerSubIdx* newRecord = records[i];
 
         newRecord->nvert = current_state->rep->nvert;
         newRecord->order = order;
@@ -1501,15 +3383,27 @@ namespace Hermes
         current_refmaps[i]->force_transform(current_pss[i]->get_transform(), current_pss[i]->get_ctm());
         newRecord->fns = new Func<double>*[current_als[i]->cnt];
         newRecord->asmlistCnt = current_als[i]->cnt;
-        for (unsigned int j = 0; j < current_als[i]->cnt; j++)
         {
-          current_spss[i]->set_active_shape(current_als[i]->idx[j]);
-          newRecord->fns[j] = init_fn(current_spss[i], current_refmaps[i], newRecord->order);
+          AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::ShapePrecalculation);
+          init_fns(current_spss[i], current_refmaps[i], newRecord->order, current_als[i]->cnt, current_als[i]->idx, newRecord->fns);
         }
 
-        newRecord->n_quadrature_points = init_geometry_points(current_refmaps[i], newRecord->order, newRecord->geometry, newRecord->jacobian_x_weights);
+        // The same (sub-)element on a space before this one (e.g. all spaces on one mesh) - its geometry is copied, not recalculated.
+        CacheRecordPerSubIdx* same_geometry = NULL;
+        for(unsigned int k = 0; k < i && same_geometry == NULL; k++)
+          if(current_state->e[k] == current_state->e[i] && current_state->sub_idx[k] == current_state->sub_idx[i])
+            same_geometry = records[k];
+
+        {
+          AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Geometry);
+          if(same_geometry != NULL)
+            newRecord->n_quadrature_points = copy_geometry_points(same_geometry->n_quadrature_points, same_geometry->geometry, same_geometry->jacobian_x_weights, newRecord->geometry, newRecord->jacobian_x_weights);
+          else
+            newRecord->n_quadrature_points = init_geometry_points(current_refmaps[i], newRecord->order, newRecord->geometry, newRecord->jacobian_x_weights);
+        }
 
-        if(current_state->isBnd && (current_wf->mfsurf.size() > 0 || current_wf->vfsurf.size() > 0))
+        newRecord->surface_edges = surface_edges;
+        if(surface_edges != 0)
         {
           newRecord->fnsSurface = new Func<double>**[newRecord->nvert];
           memset(newRecord->fnsSurface, NULL, sizeof(Func<double>**) * newRecord->nvert);
@@ -1521,31 +3415,101 @@ namespace Hermes
           newRecord->orderSurface = new int[newRecord->nvert];
           newRecord->asmlistSurfaceCnt = new int[newRecord->nvert];
 
+          AssemblyProfile::Timer geometry_timer(this->current_phase_profile(), AssemblyProfile::Geometry);
           int order = newRecord->order;
           for (current_state->isurf = 0; current_state->isurf < newRecord->nvert; current_state->isurf++)
           {
-            if(!current_state->bnd[current_state->isurf])
+            if(!(surface_edges & (1 << current_state->isurf)))
               continue;
-            newRecord->n_quadrature_pointsSurface[current_state->isurf] = init_surface_geometry_points(current_refmaps[i], order, current_state, newRecord->geometrySurface[current_state->isurf], newRecord->jacobian_x_weightsSurface[current_state->isurf]);
+            if(same_geometry != NULL)
+            {
+              int isurf = current_state->isurf;
+              newRecord->n_quadrature_pointsSurface[isurf] = copy_geometry_points(same_geometry->n_quadrature_pointsSurface[isurf], same_geometry->geometrySurface[isurf], same_geometry->jacobian_x_weightsSurface[isurf], newRecord->geometrySurface[isurf], newRecord->jacobian_x_weightsSurface[isurf]);
+              order = same_geometry->orderSurface[isurf];
+            }
+            else
+              newRecord->n_quadrature_pointsSurface[current_state->isurf] = init_surface_geometry_points(current_refmaps[i], order, current_state, newRecord->geometrySurface[current_state->isurf], newRecord->jacobian_x_weightsSurface[current_state->isurf]);
             newRecord->orderSurface[current_state->isurf] = order;
             order = newRecord->order;
           }
+          geometry_timer.stop();
 
+          AssemblyProfile::Timer shape_timer(this->current_phase_profile(), AssemblyProfile::ShapePrecalculation);
           for (current_state->isurf = 0; current_state->isurf < newRecord->nvert; current_state->isurf++)
           {
-            if(!current_state->bnd[current_state->isurf])
+            if(!(surface_edges & (1 << current_state->isurf)))
               continue;
             newRecord->asmlistSurfaceCnt[current_state->isurf] = current_alsSurface[i][current_state->isurf].cnt;
 
             newRecord->fnsSurface[current_state->isurf] = new Func<double>*[current_alsSurface[i][current_state->isurf].cnt];
-            for (unsigned int j = 0; j < current_alsSurface[i][current_state->isurf].cnt; j++)
-            {
-              current_spss[i]->set_active_shape(current_alsSurface[i][current_state->isurf].idx[j]);
-              newRecord->fnsSurface[current_state->isurf][j] = init_fn(current_spss[i], current_refmaps[i], newRecord->orderSurface[current_state->isurf]);
-            }
+            init_fns(current_spss[i], current_refmaps[i], newRecord->orderSurface[current_state->isurf], current_alsSurface[i][current_state->isurf].cnt,
+              current_alsSurface[i][current_state->isurf].idx, newRecord->fnsSurface[current_state->isurf]);
           }
         }
+
+        // Account for the record (replacing the previous size if it was recalculated), evict if over the budget.
+        size_t bytes = newRecord->calculate_bytes();
+        if(profile != NULL)
+          profile->bytes_allocated += bytes;
+#pragma omp critical (cache_records_clock)
+        {
+          this->cache_bytes += bytes;
+          this->cache_bytes -= newRecord->bytes;
+          newRecord->bytes = bytes;
+          if(this->cache_budget > 0 && this->cache_bytes > this->cache_budget)
+            this->evict_cache_records();
+        }
+      }
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* DiscreteProblem<Scalar>::init_u_ext_fn(unsigned int space_i, AsmList<Scalar>* al, CacheRecordPerSubIdx* record, int order, Arena* arena)
+    {
+      // Vector-valued spaces (their curl, div are not in the shape functions of all spaces) and records of other orders are left to the Solution.
+      if(this->u_ext_coeff_vec == NULL || record == NULL || record->order != order || al->cnt == 0 || record->asmlistCnt != al->cnt
+        || space_i >= this->spaces_size || spaces[space_i]->get_shapeset()->get_num_components() > 1)
+        return NULL;
+
+      int np = record->fns[0]->get_num_gip();
+      Func<Scalar>* u = new (arena->allocate(sizeof(Func<Scalar>))) Func<Scalar>(np, 1);
+      u->val = arena->allocate_array<Scalar>(np);
+      u->dx = arena->allocate_array<Scalar>(np);
+      u->dy = arena->allocate_array<Scalar>(np);
+      memset(u->val, 0, np * sizeof(Scalar));
+      memset(u->dx, 0, np * sizeof(Scalar));
+      memset(u->dy, 0, np * sizeof(Scalar));
+#ifdef H2D_USE_SECOND_DERIVATIVES
+      // As in init_fn(Solution), only H1 has the laplacian.
+      bool laplace = spaces[space_i]->get_type() == HERMES_H1_SPACE;
+      if(laplace)
+      {
+        u->laplace = arena->allocate_array<Scalar>(np);
+        memset(u->laplace, 0, np * sizeof(Scalar));
+      }
+#endif
+
+      // The Dirichlet lift is not a part of the Runge-Kutta stages (see init_assembling()).
+      double dir_lift_coeff = this->RungeKutta ? 0.0 : 1.0;
+      for(unsigned int k = 0; k < al->cnt; k++)
+      {
+        int dof = al->dof[k];
+        Scalar coef = al->coef[k] * (dof >= 0 ? this->u_ext_coeff_vec[dof] : dir_lift_coeff);
+        if(coef == 0.0)
+          continue;
+        Func<double>* fn = record->fns[k];
+        for(int i = 0; i < np; i++)
+        {
+          u->val[i] += coef * fn->val[i];
+          u->dx[i] += coef * fn->dx[i];
+          u->dy[i] += coef * fn->dy[i];
+        }
+#ifdef H2D_USE_SECOND_DERIVATIVES
+        if(laplace)
+          for(int i = 0; i < np; i++)
+            u->laplace[i] += coef * fn->laplace[i];
+#endif
       }
+      return u;
     }
 
     template<typename Scalar>
@@ -1555,14 +3519,21 @@ namespace Hermes
       // Representing space.
       int rep_space_i = -1;
 
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->states++;
+
       // Get necessary (volumetric) assembly lists.
-      for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
       {
-        if(current_state->e[space_i] != NULL)
+        AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Traversal);
+        for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
         {
-          rep_space_i = space_i;
-          current_refmaps[space_i]->set_active_element(current_state->e[space_i]);
-          spaces[space_i]->get_element_assembly_list(current_state->e[space_i], current_als[space_i], spaces_first_dofs[space_i]);
+          if(current_state->e[space_i] != NULL)
+          {
+            rep_space_i = space_i;
+            current_refmaps[space_i]->set_active_element(current_state->e[space_i]);
+            spaces[space_i]->get_element_assembly_list(current_state->e[space_i], current_als[space_i], spaces_first_dofs[space_i]);
+          }
         }
       }
 
@@ -1575,10 +3546,12 @@ namespace Hermes
         // Do we have to recalculate the data for this state even if the cache contains the data?
         bool changedInLastAdaptation = this->do_not_use_cache ? true : this->state_needs_recalculation(current_als, current_state);
 
-        // Assembly lists for surface forms.
+        // Assembly lists for surface forms - only the edges with some.
+        unsigned int surface_edges = this->get_surface_edges(current_state, current_wf);
         AsmList<Scalar>** current_alsSurface = NULL;
-        if(current_state->isBnd && (current_wf->mfsurf.size() > 0 || current_wf->vfsurf.size() > 0 || current_wf->mfDG.size() > 0 || current_wf->vfDG.size() > 0))
+        if(surface_edges != 0)
         {
+          AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::Traversal);
           current_alsSurface = new AsmList<Scalar>*[this->spaces_size];
           for(unsigned int space_i = 0; space_i < this->spaces_size; space_i++)
           {
@@ -1586,33 +3559,43 @@ namespace Hermes
               return;
             current_alsSurface[space_i] = new AsmList<Scalar>[current_state->rep->nvert];
             for (current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
-              if(current_state->bnd[current_state->isurf])
+              if(surface_edges & (1 << current_state->isurf))
                 spaces[space_i]->get_boundary_assembly_list(current_state->e[space_i], current_state->isurf, &current_alsSurface[space_i][current_state->isurf], spaces_first_dofs[space_i]);
           }
         }
 
-        // Calculate the cache entries.
-        CacheRecordPerSubIdx** cacheRecordPerSubIdx = new CacheRecordPerSubIdx*[this->spaces_size];
-
-        if(changedInLastAdaptation)
-          this->calculate_cache_records(current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_state, current_alsSurface, current_wf);
+        // Temporaries of this state, released all at once after the state.
+        Arena* arena = this->current_arena();
 
-        if(this->caughtException != NULL)
-          return;
+        // Calculate the cache entries.
+        CacheRecordPerSubIdx** cacheRecordPerSubIdx = arena->allocate_array<CacheRecordPerSubIdx*>(this->spaces_size);
+        memset(cacheRecordPerSubIdx, 0, this->spaces_size * sizeof(CacheRecordPerSubIdx*));
+        CacheRecordsGuard cache_records_guard(this, current_state, cacheRecordPerSubIdx);
 
-        // Store the cache entries.
-        for(int temp_i = 0; temp_i < this->spaces_size; temp_i++)
+        // The records may have been evicted.
+        if(!changedInLastAdaptation)
         {
-          if(current_state->e[temp_i] == NULL)
-            continue;
-#pragma omp critical (cache_records_sub_idx_map)
+          changedInLastAdaptation = !this->acquire_cache_records(current_state, cacheRecordPerSubIdx);
+
+          // The records calculated for other surface forms (another weak formulation) lack some of the edges.
+          if(!changedInLastAdaptation)
           {
-            typename std::map<uint64_t, CacheRecordPerSubIdx*>::iterator it = this->cache_records_sub_idx[temp_i][current_state->e[temp_i]->id]->find(current_state->sub_idx[temp_i]);
-            if(it != this->cache_records_sub_idx[temp_i][current_state->e[temp_i]->id]->end())
-              cacheRecordPerSubIdx[temp_i] = it->second;
+            for(unsigned int i = 0; i < this->spaces_size; i++)
+              if(current_state->e[i] != NULL && (surface_edges & ~cacheRecordPerSubIdx[i]->surface_edges) != 0)
+                changedInLastAdaptation = true;
+            if(changedInLastAdaptation)
+              this->release_cache_records(current_state, cacheRecordPerSubIdx);
           }
+          if(!changedInLastAdaptation && profile != NULL)
+            profile->cache_hits++;
         }
 
+        if(changedInLastAdaptation)
+          this->calculate_cache_records(current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_state, current_alsSurface, current_wf, surface_edges, cacheRecordPerSubIdx);
+
+        if(this->caughtException != NULL)
+          return;
+
         // Ext functions.
         // - order
         int order = cacheRecordPerSubIdx[rep_space_i]->order;
@@ -1620,14 +3603,19 @@ namespace Hermes
         // - u_ext
         Func<Scalar>** u_ext = NULL;
         int prevNewtonSize = this->wf->get_neq();
+        AssemblyProfile::Timer ext_timer(this->current_phase_profile(), AssemblyProfile::ShapePrecalculation);
 
         if(!this->is_linear)
         {
-          u_ext = new Func<Scalar>*[prevNewtonSize];
+          u_ext = arena->allocate_array<Func<Scalar>*>(prevNewtonSize);
           if(current_u_ext != NULL)
             for(int u_ext_i = 0; u_ext_i < prevNewtonSize; u_ext_i++)
               if(current_u_ext[u_ext_i] != NULL)
-                u_ext[u_ext_i] = init_fn(current_u_ext[u_ext_i], order);
+              {
+                u_ext[u_ext_i] = this->init_u_ext_fn(u_ext_i, current_als[u_ext_i], current_state->e[u_ext_i] == NULL ? NULL : cacheRecordPerSubIdx[u_ext_i], order, arena);
+                if(u_ext[u_ext_i] == NULL)
+                  u_ext[u_ext_i] = init_fn(current_u_ext[u_ext_i], order, arena);
+              }
               else
                 u_ext[u_ext_i] = NULL;
           else
@@ -1640,10 +3628,10 @@ namespace Hermes
         Func<Scalar>** ext = NULL;
         if(current_extCount > 0)
         {
-          ext = new Func<Scalar>*[current_extCount];
+          ext = arena->allocate_array<Func<Scalar>*>(current_extCount);
           for(int ext_i = 0; ext_i < current_extCount; ext_i++)
             if(current_wf->ext[ext_i] != NULL)
-              ext[ext_i] = init_fn(current_wf->ext[ext_i], order);
+              ext[ext_i] = init_fn(current_wf->ext[ext_i], order, arena);
             else
               ext[ext_i] = NULL;
         }
@@ -1651,15 +3639,34 @@ namespace Hermes
         if(RungeKutta)
           for(int ext_i = 0; ext_i < this->RK_original_spaces_count; ext_i++)
             u_ext[ext_i]->add(ext[current_extCount - this->RK_original_spaces_count + ext_i]);
+        ext_timer.stop();
 
-        if(current_mat != NULL)
+        // Static condensation - the whole local system of the state (volumetric and surface forms) is gathered and condensed at the end.
+        bool condense_state = this->is_system_condensed() && this->current_mat != NULL && this->current_apply_x == NULL;
+        if(condense_state)
+          this->begin_state_local_matrix(current_als, current_state, true);
+
+        if(this->matrix_forms_to_be_assembled())
         {
+          bool gather_state_local_matrix = this->node_blocked_assembly && this->current_mat != NULL && this->current_apply_x == NULL;
+          if(gather_state_local_matrix)
+            this->begin_state_local_matrix(current_als, current_state);
+
           for(int current_mfvol_i = 0; current_mfvol_i < wf->mfvol.size(); current_mfvol_i++)
           {
             MatrixFormVol<Scalar>* mfv = current_wf->mfvol[current_mfvol_i];
 
             if(!form_to_be_assembled(mfv, current_state))
+            {
+              this->count_skipped_form(mfv);
+              continue;
+            }
+
+            if(mfv->has_own_quadrature())
+            {
+              this->assemble_form_own_quadrature(mfv, current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_alsSurface, current_state, current_wf);
               continue;
+            }
 
             int form_i = mfv->i;
             int form_j = mfv->j;
@@ -1677,8 +3684,13 @@ namespace Hermes
               current_state, 
               CacheRecordPerSubIdxI->n_quadrature_points, 
               CacheRecordPerSubIdxI->geometry, 
-              CacheRecordPerSubIdxI->jacobian_x_weights);
+              CacheRecordPerSubIdxI->jacobian_x_weights,
+              current_refmaps[form_i],
+              CacheRecordPerSubIdxI);
           }
+
+          if(gather_state_local_matrix)
+            this->end_state_local_matrix();
         }
         if(current_rhs != NULL)
         {
@@ -1687,7 +3699,16 @@ namespace Hermes
             VectorFormVol<Scalar>* vfv = current_wf->vfvol[current_vfvol_i];
 
             if(!form_to_be_assembled(vfv, current_state))
+            {
+              this->count_skipped_form(vfv);
+              continue;
+            }
+
+            if(vfv->has_own_quadrature())
+            {
+              this->assemble_form_own_quadrature(vfv, current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_alsSurface, current_state, current_wf);
               continue;
+            }
 
             int form_i = vfv->i;
             CacheRecordPerSubIdx* CacheRecordPerSubIdxI = cacheRecordPerSubIdx[form_i];
@@ -1705,35 +3726,14 @@ namespace Hermes
           }
         }
 
-        // Cleanup - u_ext
-        if(current_u_ext != NULL)
-        {
-          for(int u_ext_i = 0; u_ext_i < prevNewtonSize; u_ext_i++)
-            if(current_u_ext[u_ext_i] != NULL && current_state->e[u_ext_i] != NULL)
-            {
-              u_ext[u_ext_i]->free_fn();
-              delete u_ext[u_ext_i];
-            }
-            delete [] u_ext;
-        }
-
-        // Cleanup - ext
-        for(int ext_i = 0; ext_i < current_extCount; ext_i++)
-        {
-          if(current_wf->ext[ext_i] != NULL)
-          {
-            ext[ext_i]->free_fn();
-            delete ext[ext_i];
-          }
-        }
-          delete [] ext;
+        // u_ext, ext - released with the arena.
 
-          // Assemble surface integrals now: loop through surfaces of the element.
-          if(current_state->isBnd && (current_wf->mfsurf.size() > 0 || current_wf->vfsurf.size() > 0))
+          // Assemble surface integrals now: loop through the edges of the element with surface forms.
+          if(surface_edges != 0)
           {
             for (current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
             {
-              if(!current_state->bnd[current_state->isurf])
+              if(!(surface_edges & (1 << current_state->isurf)))
                 continue;
 
               // Edge-wise parameters for WeakForm.
@@ -1744,14 +3744,15 @@ namespace Hermes
               int orderSurf = cacheRecordPerSubIdx[rep_space_i]->orderSurface[current_state->isurf];
               // - u_ext
               int prevNewtonSize = this->wf->get_neq();
+              AssemblyProfile::Timer ext_surf_timer(this->current_phase_profile(), AssemblyProfile::ShapePrecalculation);
               Func<Scalar>** u_extSurf = NULL;
               if(!this->is_linear)
               {
-                u_extSurf = new Func<Scalar>*[prevNewtonSize];
+                u_extSurf = arena->allocate_array<Func<Scalar>*>(prevNewtonSize);
                 if(current_u_ext != NULL)
                   for(int u_ext_surf_i = 0; u_ext_surf_i < prevNewtonSize; u_ext_surf_i++)
                     if(current_u_ext[u_ext_surf_i] != NULL)
-                      u_extSurf[u_ext_surf_i] = current_state->e[u_ext_surf_i] == NULL ? NULL : init_fn(current_u_ext[u_ext_surf_i], orderSurf);
+                      u_extSurf[u_ext_surf_i] = current_state->e[u_ext_surf_i] == NULL ? NULL : init_fn(current_u_ext[u_ext_surf_i], orderSurf, arena);
                     else
                       u_extSurf[u_ext_surf_i] = NULL;
                 else
@@ -1760,23 +3761,33 @@ namespace Hermes
               }
               // - ext
               int current_extCount = this->wf->ext.size();
-              Func<Scalar>** extSurf = new Func<Scalar>*[current_extCount];
+              Func<Scalar>** extSurf = arena->allocate_array<Func<Scalar>*>(current_extCount);
               for(int ext_surf_i = 0; ext_surf_i < current_extCount; ext_surf_i++)
                 if(current_wf->ext[ext_surf_i] != NULL)
-                  extSurf[ext_surf_i] = current_state->e[ext_surf_i] == NULL ? NULL : init_fn(current_wf->ext[ext_surf_i], orderSurf);
+                  extSurf[ext_surf_i] = current_state->e[ext_surf_i] == NULL ? NULL : init_fn(current_wf->ext[ext_surf_i], orderSurf, arena);
                 else
                   extSurf[ext_surf_i] = NULL;
 
               if(RungeKutta)
                 for(int ext_surf_i = 0; ext_surf_i < this->RK_original_spaces_count; ext_surf_i++)
                   u_extSurf[ext_surf_i]->add(extSurf[current_extCount - this->RK_original_spaces_count + ext_surf_i]);
+              ext_surf_timer.stop();
 
-              if(current_mat != NULL)
+              if(this->matrix_forms_to_be_assembled())
               {
                 for(int current_mfsurf_i = 0; current_mfsurf_i < wf->mfsurf.size(); current_mfsurf_i++)
                 {
                   if(!form_to_be_assembled(current_wf->mfsurf[current_mfsurf_i], current_state))
+                  {
+                    this->count_skipped_form(current_wf->mfsurf[current_mfsurf_i]);
+                    continue;
+                  }
+
+                  if(current_wf->mfsurf[current_mfsurf_i]->has_own_quadrature())
+                  {
+                    this->assemble_form_own_quadrature(current_wf->mfsurf[current_mfsurf_i], current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_alsSurface, current_state, current_wf);
                     continue;
+                  }
 
                   int form_i = current_wf->mfsurf[current_mfsurf_i]->i;
                   int form_j = current_wf->mfsurf[current_mfsurf_i]->j;
@@ -1794,7 +3805,9 @@ namespace Hermes
                     current_state, 
                     CacheRecordPerSubIdxI->n_quadrature_pointsSurface[current_state->isurf], 
                     CacheRecordPerSubIdxI->geometrySurface[current_state->isurf], 
-                    CacheRecordPerSubIdxI->jacobian_x_weightsSurface[current_state->isurf]);
+                    CacheRecordPerSubIdxI->jacobian_x_weightsSurface[current_state->isurf],
+                    NULL,
+                    NULL);
                 }
               }
 
@@ -1803,7 +3816,16 @@ namespace Hermes
                 for(int current_vfsurf_i = 0; current_vfsurf_i < wf->vfsurf.size(); current_vfsurf_i++)
                 {
                   if(!form_to_be_assembled(current_wf->vfsurf[current_vfsurf_i], current_state))
+                  {
+                    this->count_skipped_form(current_wf->vfsurf[current_vfsurf_i]);
+                    continue;
+                  }
+
+                  if(current_wf->vfsurf[current_vfsurf_i]->has_own_quadrature())
+                  {
+                    this->assemble_form_own_quadrature(current_wf->vfsurf[current_vfsurf_i], current_pss, current_spss, current_refmaps, current_u_ext, current_als, current_alsSurface, current_state, current_wf);
                     continue;
+                  }
 
                   int form_i = current_wf->vfsurf[current_vfsurf_i]->i;
                   CacheRecordPerSubIdx* CacheRecordPerSubIdxI = cacheRecordPerSubIdx[form_i];
@@ -1820,25 +3842,6 @@ namespace Hermes
                     CacheRecordPerSubIdxI->jacobian_x_weightsSurface[current_state->isurf]);
                 }
               }
-
-              if(current_u_ext != NULL)
-              {
-                for(int u_ext_surf_i = 0; u_ext_surf_i < prevNewtonSize; u_ext_surf_i++)
-                  if(current_u_ext[u_ext_surf_i] != NULL)
-                  {
-                    u_extSurf[u_ext_surf_i]->free_fn();
-                    delete u_extSurf[u_ext_surf_i];
-                  }
-                  delete [] u_extSurf;
-              }
-
-              for(int ext_surf_i = 0; ext_surf_i < current_extCount; ext_surf_i++)
-                if(current_wf->ext[ext_surf_i] != NULL)
-                {
-                  extSurf[ext_surf_i]->free_fn();
-                  delete extSurf[ext_surf_i];
-                }
-                delete [] extSurf;
             }
 
             for(unsigned int i = 0; i < this->spaces_size; i++)
@@ -1846,8 +3849,9 @@ namespace Hermes
                 delete [] current_alsSurface[i];
           }
 
-          if(cacheRecordPerSubIdx != NULL)
-            delete [] cacheRecordPerSubIdx;
+          if(condense_state)
+            this->condense_state_local_matrix(current_state);
+
           if(current_alsSurface != NULL)
             delete [] current_alsSurface;
     }
@@ -1857,13 +3861,13 @@ namespace Hermes
     {
       int order;
 
-      // order of solutions from the previous Newton iteration etc..
-      Func<Hermes::Ord>** u_ext_ord = new Func<Hermes::Ord>*[RungeKutta ? RK_original_spaces_count : this->wf->get_neq() - form->u_ext_offset];
-      Func<Hermes::Ord>** ext_ord = NULL;
-      int ext_size = std::max(form->ext.size(), form->wf->ext.size());
-      if(ext_size > 0)
-        ext_ord = new Func<Hermes::Ord>*[ext_size];
-      init_ext_orders(form, u_ext_ord, ext_ord, current_u_ext, current_state);
+      // Fixed order of the form.
+      if(form->integration_order >= 0)
+      {
+        order = form->integration_order;
+        limit_form_order(form, order, current_refmaps);
+        return order;
+      }
 
       // Order of shape functions.
       int max_order_j = this->spaces[form->j]->get_element_order(current_state->e[form->j]->id);
@@ -1887,11 +3891,44 @@ namespace Hermes
           max_order_j = eo;
       }
 
-      Func<Hermes::Ord>* ou = init_fn_ord(max_order_j + (spaces[form->j]->get_shapeset()->get_num_components() > 1 ? 1 : 0));
-      Func<Hermes::Ord>* ov = init_fn_ord(max_order_i + (spaces[form->i]->get_shapeset()->get_num_components() > 1 ? 1 : 0));
+      max_order_j += (spaces[form->j]->get_shapeset()->get_num_components() > 1 ? 1 : 0);
+      max_order_i += (spaces[form->i]->get_shapeset()->get_num_components() > 1 ? 1 : 0);
+
+      // The order may have been evaluated for the same orders of the functions already.
+      OrderKey order_key;
+      bool order_cached = false;
+      if(form->order_caching && form->position >= 0)
+      {
+        order_cached = order_key.push_back(max_order_j) && order_key.push_back(max_order_i) && this->get_order_key(form, current_u_ext, current_state, order_key);
+        int cached_order;
+        if(order_cached && this->get_cached_order(form, order_key, cached_order))
+        {
+          Hermes::Ord o(cached_order);
+          adjust_order_to_refmaps(form, order, &o, current_refmaps);
+          return order;
+        }
+      }
+
+      // order of solutions from the previous Newton iteration etc..
+      Func<Hermes::Ord>** u_ext_ord = new Func<Hermes::Ord>*[RungeKutta ? RK_original_spaces_count : this->wf->get_neq() - form->u_ext_offset];
+      Func<Hermes::Ord>** ext_ord = NULL;
+      int ext_size = std::max(form->ext.size(), form->wf->ext.size());
+      if(ext_size > 0)
+        ext_ord = new Func<Hermes::Ord>*[ext_size];
+      init_ext_orders(form, u_ext_ord, ext_ord, current_u_ext, current_state);
+
+      Func<Hermes::Ord>* ou = init_fn_ord(max_order_j);
+      Func<Hermes::Ord>* ov = init_fn_ord(max_order_i);
 
       // Total order of the vector form.
-      Hermes::Ord o = form->ord(1, &fake_wt, u_ext_ord, ou, ov, &geom_ord, ext_ord);
+      Hermes::Ord o;
+      {
+        FormProfile::OrdCall ord_call(this->current_form_profile(form));
+        o = form->ord(1, &fake_wt, u_ext_ord, ou, ov, &geom_ord, ext_ord);
+      }
+
+      if(order_cached)
+        this->set_cached_order(form, order_key, o.get_order());
 
       adjust_order_to_refmaps(form, order, &o, current_refmaps);
 
@@ -1908,27 +3945,42 @@ namespace Hermes
 
     template<typename Scalar>
     void DiscreteProblem<Scalar>::assemble_matrix_form(MatrixForm<Scalar>* form, int order, Func<double>** base_fns, Func<double>** test_fns, Func<Scalar>** ext, Func<Scalar>** u_ext,
-      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights)
+      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+      RefMap* current_refmap, CacheRecordPerSubIdx* record_i)
     {
+      AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::FormEvaluation);
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->forms_evaluated++;
+
       bool surface_form = (dynamic_cast<MatrixFormVol<Scalar>*>(form) == NULL);
+      this->set_thread_assembly_target(form);
+      FormProfile::Evaluation form_evaluation(this->current_form_profile(form), order, n_quadrature_points);
 
       double block_scaling_coefficient = this->block_scaling_coeff(form);
 
       bool tra = (form->i != form->j) && (form->sym != 0);
       bool sym = (form->i == form->j) && (form->sym == 1);
 
+      // Deferred to the end of the batch of states (see set_state_batching()).
+      if(!surface_form && this->batch_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap))
+        return;
+
+      // Temporaries, released with the arena after the state.
+      Arena* arena = this->current_arena();
+
       // Assemble the local stiffness matrix for the form form.
-      Scalar **local_stiffness_matrix = new_matrix<Scalar>(std::max(current_als_i->cnt, current_als_j->cnt));
+      Scalar **local_stiffness_matrix = arena->allocate_matrix<Scalar>(std::max(current_als_i->cnt, current_als_j->cnt));
 
       Func<Scalar>** local_ext = ext;
       // If the user supplied custom ext functions for this form.
       if(form->ext.size() > 0)
       {
         int local_ext_count = form->ext.size();
-        local_ext = new Func<Scalar>*[local_ext_count];
+        local_ext = arena->allocate_array<Func<Scalar>*>(local_ext_count);
         for(int ext_i = 0; ext_i < local_ext_count; ext_i++)
           if(form->ext[ext_i] != NULL)
-            local_ext[ext_i] = current_state->e[ext_i] == NULL ? NULL : init_fn(form->ext[ext_i], order);
+            local_ext[ext_i] = current_state->e[ext_i] == NULL ? NULL : init_fn(form->ext[ext_i], order, arena);
           else
             local_ext[ext_i] = NULL;
       }
@@ -1937,90 +3989,311 @@ namespace Hermes
       if(RungeKutta)
         u_ext += form->u_ext_offset;
 
-      // Actual form-specific calculation.
+      // Functions to be used in the form evaluation, NULL for those that do not contribute.
+      Func<double>** block_base_fns = arena->allocate_array<Func<double>*>(current_als_j->cnt);
+      Func<double>** block_test_fns = arena->allocate_array<Func<double>*>(current_als_i->cnt);
+      for (unsigned int j = 0; j < current_als_j->cnt; j++)
+      {
+        // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
+        if(current_als_j->dof[j] >= 0 && std::abs(current_als_j->coef[j]) >= 1e-12)
+          block_base_fns[j] = base_fns[j];
+        else
+          block_base_fns[j] = NULL;
+      }
       for (unsigned int i = 0; i < current_als_i->cnt; i++)
       {
-        if(current_als_i->dof[i] < 0)
-          continue;
+        if(current_als_i->dof[i] >= 0 && std::abs(current_als_i->coef[i]) >= 1e-12)
+          block_test_fns[i] = test_fns[i];
+        else
+          block_test_fns[i] = NULL;
+      }
 
-        if((!tra || surface_form) && current_als_i->dof[i] < 0)
-          continue;
-        if(std::abs(current_als_i->coef[i]) < 1e-12)
-          continue;
-        if(!sym)
-        {
+      // The local matrix of a congruent element evaluated already (all pairs, raw values).
+      std::vector<int> congruence_key;
+      Scalar* congruent_values = NULL;
+      bool congruent = !surface_form && this->get_congruence_key(form, order, current_als_i, current_als_j, current_state, current_refmap, congruence_key);
+      if(congruent)
+        congruent_values = this->find_congruent_matrix_form_values(form, congruence_key);
+
+      if(congruent_values != NULL)
+      {
+        for (unsigned int i = 0; i < current_als_i->cnt; i++)
           for (unsigned int j = 0; j < current_als_j->cnt; j++)
-          {
-            if(current_als_j->dof[j] >= 0)
-            {
-              // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
-              if(std::abs(current_als_j->coef[j]) < 1e-12)
-                continue;
+            local_stiffness_matrix[i][j] = congruent_values[i * current_als_j->cnt + j];
+      }
+      // Actual form-specific calculation - the whole local block at once (by sum factorization if possible).
+      // The block to be kept for the congruent elements needs all the pairs, not only those contributing here.
+      else
+      {
+        Func<double>** value_base_fns = congruent ? base_fns : block_base_fns;
+        Func<double>** value_test_fns = congruent ? test_fns : block_test_fns;
+        if(!this->assemble_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap, local_stiffness_matrix)
+          && !this->assemble_matrix_form_tensor_product(form, order, local_ext, u_ext, current_als_i, current_als_j, current_state, n_quadrature_points, geometry, jacobian_x_weights, current_refmap, local_stiffness_matrix))
+          form->value_block(n_quadrature_points, jacobian_x_weights, u_ext, value_base_fns, value_test_fns, current_als_j->cnt, current_als_i->cnt, geometry, local_ext, local_stiffness_matrix, sym);
 
-              Func<double>* u = base_fns[j];
-              Func<double>* v = test_fns[i];
+        if(congruent)
+        {
+          Scalar* values = arena->allocate_array<Scalar>(current_als_i->cnt * current_als_j->cnt);
+          for (unsigned int i = 0; i < current_als_i->cnt; i++)
+            for (unsigned int j = 0; j < current_als_j->cnt; j++)
+              values[i * current_als_j->cnt + j] = (sym && j < i) ? local_stiffness_matrix[j][i] : local_stiffness_matrix[i][j];
+          this->store_congruent_matrix_form_values(form, congruence_key, current_als_i->cnt, current_als_j->cnt, values);
+        }
+      }
 
-              if(surface_form)
-                local_stiffness_matrix[i][j] = 0.5 * block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
-              else
-                local_stiffness_matrix[i][j] = block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
-            }
+      // Scaling. The blocks evaluated for all the pairs (congruent, reference) are zeroed in the pairs not contributing here.
+      if(surface_form)
+        block_scaling_coefficient *= 0.5;
+      for (unsigned int i = 0; i < current_als_i->cnt; i++)
+      {
+        if(block_test_fns[i] == NULL)
+        {
+          for (unsigned int j = 0; j < current_als_j->cnt; j++)
+          {
+            local_stiffness_matrix[i][j] = 0.0;
+            if(sym)
+              local_stiffness_matrix[j][i] = 0.0;
           }
+          continue;
         }
-        // Symmetric block.
-        else
+        for (unsigned int j = sym ? i : 0; j < current_als_j->cnt; j++)
         {
-          for (unsigned int j = 0; j < current_als_j->cnt; j++)
+          if(block_base_fns[j] == NULL)
           {
-            if(j < i && current_als_j->dof[j] >= 0)
-              continue;
-            if(current_als_j->dof[j] >= 0)
-            {
-              // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
-              if(std::abs(current_als_j->coef[j]) < 1e-12)
-                continue;
+            local_stiffness_matrix[i][j] = 0.0;
+            if(sym)
+              local_stiffness_matrix[j][i] = 0.0;
+            continue;
+          }
+          local_stiffness_matrix[i][j] = block_scaling_coefficient * local_stiffness_matrix[i][j] * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
+          // Symmetric block.
+          if(sym)
+            local_stiffness_matrix[j][i] = local_stiffness_matrix[i][j];
+        }
+      }
 
-              Func<double>* u = base_fns[j];
-              Func<double>* v = test_fns[i];
+      // Insert the local stiffness matrix into the global one.
+      // Precalculated positions are only available for volumetric forms (surface forms use the boundary assembly lists).
+      int* scatter_positions = surface_form ? NULL : this->get_scatter_positions(form->i, form->j, current_state);
+      this->add_local_matrix(current_als_i->cnt, current_als_j->cnt, local_stiffness_matrix, current_als_i->dof, current_als_j->dof, scatter_positions);
 
-              Scalar val = block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
+      // Insert also the off-diagonal (anti-)symmetric block, if required.
+      if(tra)
+      {
+        if(form->sym < 0)
+          chsgn(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
+        transpose(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
 
-              local_stiffness_matrix[i][j] = local_stiffness_matrix[j][i] = val;
-            }
+        scatter_positions = surface_form ? NULL : this->get_scatter_positions(form->j, form->i, current_state);
+        this->add_local_matrix(current_als_j->cnt, current_als_i->cnt, local_stiffness_matrix, current_als_j->dof, current_als_i->dof, scatter_positions);
+      }
+
+      if(RungeKutta)
+        u_ext -= form->u_ext_offset;
+    }
+
+    template<typename Scalar>
+    const ReferenceMatrices* DiscreteProblem<Scalar>::get_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+      Traverse::State* current_state, RefMap* current_refmap, Scalar& mass, Scalar& diffusion)
+    {
+      MatrixFormVol<Scalar>* form_vol = dynamic_cast<MatrixFormVol<Scalar>*>(form);
+      if(form_vol == NULL || !form_vol->reference_matrices || current_refmap == NULL)
+        return NULL;
+
+      // Affine elements without sub-element transformations (multi-mesh).
+      if(!current_refmap->is_jacobian_const() || current_state->sub_idx[form->i] != 0 || current_state->sub_idx[form->j] != 0 || current_refmap->get_transform() != 0)
+        return NULL;
+
+      if(this->spaces[form->i]->get_shapeset()->get_id() != this->spaces[form->j]->get_shapeset()->get_id())
+        return NULL;
+      const ReferenceMatrices* reference = ReferenceMatrices::get(this->spaces[form->i]->get_shapeset(), current_state->e[form->i]->get_mode());
+      if(reference == NULL || !reference->has_indices(current_als_i->cnt, current_als_i->idx) || !reference->has_indices(current_als_j->cnt, current_als_j->idx))
+        return NULL;
+
+      if(!form_vol->get_reference_coefficients(mass, diffusion))
+        return NULL;
+      return reference;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::assemble_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+      Traverse::State* current_state, RefMap* current_refmap, Scalar** result)
+    {
+      Scalar mass, diffusion;
+      const ReferenceMatrices* reference = this->get_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap, mass, diffusion);
+      if(reference == NULL)
+        return false;
+
+      reference->assemble(current_als_i->cnt, current_als_i->idx, current_als_j->cnt, current_als_j->idx, current_refmap->get_const_inv_ref_map(), current_refmap->get_const_jacobian(), mass, diffusion, result);
+      return true;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::batch_matrix_form_reference(MatrixForm<Scalar>* form, AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j,
+      Traverse::State* current_state, RefMap* current_refmap)
+    {
+      if(this->state_batches.empty() || (this->current_mat == NULL && this->current_apply_x == NULL))
+        return false;
+
+      Scalar mass, diffusion;
+      const ReferenceMatrices* reference = this->get_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap, mass, diffusion);
+      if(reference == NULL)
+        return false;
+
+      // The batch of the form, the elements so far have to have the same shape function indices.
+      std::vector<BatchedMatrixForm>& batched_forms = this->state_batches[omp_get_thread_num()];
+      BatchedMatrixForm* batched_form = NULL;
+      for(unsigned int k = 0; k < batched_forms.size(); k++)
+        if(batched_forms[k].form == form)
+          batched_form = &batched_forms[k];
+      if(batched_form == NULL)
+      {
+        batched_forms.push_back(BatchedMatrixForm());
+        batched_form = &batched_forms.back();
+        batched_form->form = form;
+        batched_form->count = 0;
+      }
+      if(batched_form->count > 0 && (batched_form->reference != reference || batched_form->cnt_i != current_als_i->cnt || batched_form->cnt_j != current_als_j->cnt
+        || !std::equal(current_als_i->idx, current_als_i->idx + current_als_i->cnt, batched_form->idx_i.begin())
+        || !std::equal(current_als_j->idx, current_als_j->idx + current_als_j->cnt, batched_form->idx_j.begin())))
+        this->assemble_batched_matrix_form(*batched_form);
+      if(batched_form->count == 0)
+      {
+        batched_form->reference = reference;
+        batched_form->cnt_i = current_als_i->cnt;
+        batched_form->cnt_j = current_als_j->cnt;
+        batched_form->idx_i.assign(current_als_i->idx, current_als_i->idx + current_als_i->cnt);
+        batched_form->idx_j.assign(current_als_j->idx, current_als_j->idx + current_als_j->cnt);
+      }
+
+      unsigned int element = batched_form->count++;
+      Scalar coefficients[4];
+      double scaling = this->block_scaling_coeff(form) * form->scaling_factor;
+      ReferenceMatrices::get_coefficients(current_refmap->get_const_inv_ref_map(), current_refmap->get_const_jacobian(), mass, diffusion, coefficients);
+      batched_form->c_mass[element] = scaling * coefficients[0];
+      batched_form->c_xx[element] = scaling * coefficients[1];
+      batched_form->c_xy[element] = scaling * coefficients[2];
+      batched_form->c_yy[element] = scaling * coefficients[3];
+
+      std::vector<int>& dofs = batched_form->dofs[element];
+      dofs.assign(current_als_i->dof, current_als_i->dof + current_als_i->cnt);
+      dofs.insert(dofs.end(), current_als_j->dof, current_als_j->dof + current_als_j->cnt);
+      std::vector<Scalar>& coefs = batched_form->coefs[element];
+      coefs.assign(current_als_i->coef, current_als_i->coef + current_als_i->cnt);
+      coefs.insert(coefs.end(), current_als_j->coef, current_als_j->coef + current_als_j->cnt);
+      batched_form->scatter_positions[element] = this->get_scatter_positions(form->i, form->j, current_state);
+      bool tra = (form->i != form->j) && (form->sym != 0);
+      batched_form->transposed_scatter_positions[element] = tra ? this->get_scatter_positions(form->j, form->i, current_state) : NULL;
+
+      if(batched_form->count == H2D_STATE_BATCH_SIZE)
+        this->assemble_batched_matrix_form(*batched_form);
+      return true;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::assemble_state_batch()
+    {
+      std::vector<BatchedMatrixForm>& batched_forms = this->state_batches[omp_get_thread_num()];
+      for(unsigned int k = 0; k < batched_forms.size(); k++)
+        if(batched_forms[k].count > 0)
+          this->assemble_batched_matrix_form(batched_forms[k]);
+
+      if(this->current_profile() != NULL)
+        this->current_profile()->bytes_allocated += this->current_arena()->get_used_size();
+      this->current_arena()->reset();
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::assemble_batched_matrix_form(BatchedMatrixForm& batched_form)
+    {
+      AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::FormEvaluation);
+      MatrixForm<Scalar>* form = batched_form.form;
+      unsigned int count = batched_form.count, cnt_i = batched_form.cnt_i, cnt_j = batched_form.cnt_j;
+      batched_form.count = 0;
+
+      bool tra = (form->i != form->j) && (form->sym != 0);
+      Arena* arena = this->current_arena();
+
+      Scalar* values = arena->allocate_array<Scalar>(cnt_i * cnt_j * count);
+      batched_form.reference->assemble_batch(count, cnt_i, &batched_form.idx_i[0], cnt_j, &batched_form.idx_j[0],
+        batched_form.c_mass, batched_form.c_xx, batched_form.c_xy, batched_form.c_yy, values);
+
+      Scalar **local_stiffness_matrix = arena->allocate_matrix<Scalar>(std::max(cnt_i, cnt_j));
+      for(unsigned int element = 0; element < count; element++)
+      {
+        int* dofs_i = &batched_form.dofs[element][0];
+        int* dofs_j = dofs_i + cnt_i;
+        Scalar* coefs_i = &batched_form.coefs[element][0];
+        Scalar* coefs_j = coefs_i + cnt_i;
+
+        // Scaling, the pairs not contributing zeroed (as in assemble_matrix_form()).
+        for (unsigned int i = 0; i < cnt_i; i++)
+        {
+          bool contributing_i = dofs_i[i] >= 0 && std::abs(coefs_i[i]) >= 1e-12;
+          for (unsigned int j = 0; j < cnt_j; j++)
+          {
+            if(contributing_i && dofs_j[j] >= 0 && std::abs(coefs_j[j]) >= 1e-12)
+              local_stiffness_matrix[i][j] = values[(i * cnt_j + j) * count + element] * coefs_j[j] * coefs_i[i];
+            else
+              local_stiffness_matrix[i][j] = 0.0;
           }
         }
+
+        this->add_local_matrix(cnt_i, cnt_j, local_stiffness_matrix, dofs_i, dofs_j, batched_form.scatter_positions[element]);
+
+        // Insert also the off-diagonal (anti-)symmetric block, if required.
+        if(tra)
+        {
+          if(form->sym < 0)
+            chsgn(local_stiffness_matrix, cnt_i, cnt_j);
+          transpose(local_stiffness_matrix, cnt_i, cnt_j);
+          this->add_local_matrix(cnt_j, cnt_i, local_stiffness_matrix, dofs_j, dofs_i, batched_form.transposed_scatter_positions[element]);
+        }
       }
+    }
 
-      // Insert the local stiffness matrix into the global one.
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::assemble_matrix_form_tensor_product(MatrixForm<Scalar>* form, int order, Func<Scalar>** ext, Func<Scalar>** u_ext,
+      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+      RefMap* current_refmap, Scalar** result)
+    {
+      MatrixFormVol<Scalar>* form_vol = dynamic_cast<MatrixFormVol<Scalar>*>(form);
+      if(form_vol == NULL || !form_vol->sum_factorization || current_refmap == NULL)
+        return false;
 
-      current_mat->add(current_als_i->cnt, current_als_j->cnt, local_stiffness_matrix, current_als_i->dof, current_als_j->dof);
+      // Quadrilaterals without sub-element transformations (multi-mesh), the tensor-product quadrature.
+      if(!current_state->e[form->i]->is_quad() || current_state->sub_idx[form->i] != 0 || current_state->sub_idx[form->j] != 0 || current_refmap->get_transform() != 0)
+        return false;
+      if(order > g_quad_1d_std.get_max_order() || n_quadrature_points != sqr(g_quad_1d_std.get_num_points(order)))
+        return false;
 
-      // Insert also the off-diagonal (anti-)symmetric block, if required.
-      if(tra)
-      {
-        if(form->sym < 0)
-          chsgn(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
-        transpose(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
+      // Tensor-product shapesets.
+      if(this->spaces[form->i]->get_shapeset()->get_id() != this->spaces[form->j]->get_shapeset()->get_id())
+        return false;
+      const TensorProductQuad* tensor_product = TensorProductQuad::get(this->spaces[form->i]->get_shapeset());
+      if(tensor_product == NULL || !tensor_product->has_indices(current_als_i->cnt, current_als_i->idx) || !tensor_product->has_indices(current_als_j->cnt, current_als_j->idx))
+        return false;
 
-        current_mat->add(current_als_j->cnt, current_als_i->cnt, local_stiffness_matrix, current_als_j->dof, current_als_i->dof);
-      }
+      Arena* arena = this->current_arena();
+      Scalar* mass = arena->allocate_array<Scalar>(n_quadrature_points);
+      Scalar* diffusion = arena->allocate_array<Scalar>(n_quadrature_points);
+      if(!form_vol->get_tensor_product_coefficients(n_quadrature_points, jacobian_x_weights, u_ext, geometry, ext, mass, diffusion))
+        return false;
 
-      if(form->ext.size() > 0)
+      // The diffusion tensor in the reference coordinates: grad u = M^T grad_ref u, M - the inverse reference mapping.
+      bool const_jacobian = current_refmap->is_jacobian_const();
+      double2x2* m = const_jacobian ? current_refmap->get_const_inv_ref_map() : current_refmap->get_inv_ref_map(order);
+      Scalar* diffusion_tensor = arena->allocate_array<Scalar>(3 * n_quadrature_points);
+      for(int i = 0; i < n_quadrature_points; i++)
       {
-        for(int ext_i = 0; ext_i < form->ext.size(); ext_i++)
-          if(form->ext[ext_i] != NULL)
-          {
-            local_ext[ext_i]->free_fn();
-            delete local_ext[ext_i];
-          }
-          delete [] local_ext;
+        double2x2& m_i = const_jacobian ? m[0] : m[i];
+        diffusion_tensor[3 * i] = diffusion[i] * (m_i[0][0] * m_i[0][0] + m_i[1][0] * m_i[1][0]);
+        diffusion_tensor[3 * i + 1] = diffusion[i] * (m_i[0][0] * m_i[0][1] + m_i[1][0] * m_i[1][1]);
+        diffusion_tensor[3 * i + 2] = diffusion[i] * (m_i[0][1] * m_i[0][1] + m_i[1][1] * m_i[1][1]);
       }
 
-      if(RungeKutta)
-        u_ext -= form->u_ext_offset;
-
-      // Cleanup.
-      delete [] local_stiffness_matrix;
+      tensor_product->assemble(order, current_als_i->cnt, current_als_i->idx, current_als_j->cnt, current_als_j->idx, mass, diffusion_tensor, result);
+      return true;
     }
 
     template<typename Scalar>
@@ -2028,13 +4301,13 @@ namespace Hermes
     {
       int order;
 
-      // order of solutions from the previous Newton iteration etc..
-      Func<Hermes::Ord>** u_ext_ord = new Func<Hermes::Ord>*[RungeKutta ? RK_original_spaces_count : this->wf->get_neq() - form->u_ext_offset];
-      Func<Hermes::Ord>** ext_ord = NULL;
-      int ext_size = std::max(form->ext.size(), form->wf->ext.size());
-      if(ext_size > 0)
-        ext_ord = new Func<Hermes::Ord>*[ext_size];
-      init_ext_orders(form, u_ext_ord, ext_ord, current_u_ext, current_state);
+      // Fixed order of the form.
+      if(form->integration_order >= 0)
+      {
+        order = form->integration_order;
+        limit_form_order(form, order, current_refmaps);
+        return order;
+      }
 
       // Order of shape functions.
       int max_order_i = this->spaces[form->i]->get_element_order(current_state->e[form->i]->id);
@@ -2049,10 +4322,42 @@ namespace Hermes
         if(eo > max_order_i)
           max_order_i = eo;
       }
-      Func<Hermes::Ord>* ov = init_fn_ord(max_order_i + (spaces[form->i]->get_shapeset()->get_num_components() > 1 ? 1 : 0));
+      max_order_i += (spaces[form->i]->get_shapeset()->get_num_components() > 1 ? 1 : 0);
+
+      // The order may have been evaluated for the same orders of the functions already.
+      OrderKey order_key;
+      bool order_cached = false;
+      if(form->order_caching && form->position >= 0)
+      {
+        order_cached = order_key.push_back(max_order_i) && this->get_order_key(form, current_u_ext, current_state, order_key);
+        int cached_order;
+        if(order_cached && this->get_cached_order(form, order_key, cached_order))
+        {
+          Hermes::Ord o(cached_order);
+          adjust_order_to_refmaps(form, order, &o, current_refmaps);
+          return order;
+        }
+      }
+
+      // order of solutions from the previous Newton iteration etc..
+      Func<Hermes::Ord>** u_ext_ord = new Func<Hermes::Ord>*[RungeKutta ? RK_original_spaces_count : this->wf->get_neq() - form->u_ext_offset];
+      Func<Hermes::Ord>** ext_ord = NULL;
+      int ext_size = std::max(form->ext.size(), form->wf->ext.size());
+      if(ext_size > 0)
+        ext_ord = new Func<Hermes::Ord>*[ext_size];
+      init_ext_orders(form, u_ext_ord, ext_ord, current_u_ext, current_state);
+
+      Func<Hermes::Ord>* ov = init_fn_ord(max_order_i);
 
       // Total order of the vector form.
-      Hermes::Ord o = form->ord(1, &fake_wt, u_ext_ord, ov, &geom_ord, ext_ord);
+      Hermes::Ord o;
+      {
+        FormProfile::OrdCall ord_call(this->current_form_profile(form));
+        o = form->ord(1, &fake_wt, u_ext_ord, ov, &geom_ord, ext_ord);
+      }
+
+      if(order_cached)
+        this->set_cached_order(form, order_key, o.get_order());
 
       adjust_order_to_refmaps(form, order, &o, current_refmaps);
 
@@ -2069,18 +4374,26 @@ namespace Hermes
     void DiscreteProblem<Scalar>::assemble_vector_form(VectorForm<Scalar>* form, int order, Func<double>** test_fns, Func<Scalar>** ext, Func<Scalar>** u_ext, 
       AsmList<Scalar>* current_als_i, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights)
     {
+      AssemblyProfile::Timer timer(this->current_phase_profile(), AssemblyProfile::FormEvaluation);
+      AssemblyProfile* profile = this->current_profile();
+      if(profile != NULL)
+        profile->forms_evaluated++;
+
       bool surface_form = (dynamic_cast<VectorFormVol<Scalar>*>(form) == NULL);
+      this->set_thread_assembly_target(form);
+      FormProfile::Evaluation form_evaluation(this->current_form_profile(form), order, n_quadrature_points);
 
       Func<Scalar>** local_ext = ext;
 
-      // If the user supplied custom ext functions for this form.
+      // If the user supplied custom ext functions for this form (released with the arena after the state).
+      Arena* arena = this->current_arena();
       if(form->ext.size() > 0)
       {
         int local_ext_count = form->ext.size();
-        local_ext = new Func<Scalar>*[local_ext_count];
+        local_ext = arena->allocate_array<Func<Scalar>*>(local_ext_count);
         for(int ext_i = 0; ext_i < local_ext_count; ext_i++)
           if(form->ext[ext_i] != NULL)
-            local_ext[ext_i] = init_fn(form->ext[ext_i], order);
+            local_ext[ext_i] = init_fn(form->ext[ext_i], order, arena);
           else
             local_ext[ext_i] = NULL;
       }
@@ -2089,37 +4402,41 @@ namespace Hermes
       if(RungeKutta)
         u_ext += form->u_ext_offset;
 
-      // Actual form-specific calculation.
+      // Test functions to be used in the form evaluation, NULL for those that do not contribute.
+      Func<double>** block_test_fns = arena->allocate_array<Func<double>*>(current_als_i->cnt);
       for (unsigned int i = 0; i < current_als_i->cnt; i++)
       {
-        if(current_als_i->dof[i] < 0)
-          continue;
-
         // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
-        if(std::abs(current_als_i->coef[i]) < 1e-12)
-          continue;
-
-        Func<double>* v = test_fns[i];
-
-        Scalar val;
-        if(surface_form)
-          val = 0.5 * form->value(n_quadrature_points, jacobian_x_weights, u_ext, v, geometry, local_ext) * form->scaling_factor * current_als_i->coef[i];
+        if(current_als_i->dof[i] >= 0 && std::abs(current_als_i->coef[i]) >= 1e-12)
+          block_test_fns[i] = test_fns[i];
         else
-          val = form->value(n_quadrature_points, jacobian_x_weights, u_ext, v, geometry, local_ext) * form->scaling_factor * current_als_i->coef[i];
-
-        current_rhs->add(current_als_i->dof[i], val);
+          block_test_fns[i] = NULL;
       }
 
-      if(form->ext.size() > 0)
+      // Actual form-specific calculation - all the test functions at once.
+      Scalar* local_rhs = arena->allocate_array<Scalar>(current_als_i->cnt);
+      form->value_block(n_quadrature_points, jacobian_x_weights, u_ext, block_test_fns, current_als_i->cnt, geometry, local_ext, local_rhs);
+
+      // Scaling, the whole block goes to the vector at once.
+      double block_scaling_coefficient = surface_form ? 0.5 : 1.0;
+      unsigned int* rhs_indices = arena->allocate_array<unsigned int>(current_als_i->cnt);
+      unsigned int rhs_count = 0;
+      for (unsigned int i = 0; i < current_als_i->cnt; i++)
       {
-        for(int ext_i = 0; ext_i < form->ext.size(); ext_i++)
-          if(form->ext[ext_i] != NULL)
-          {
-            local_ext[ext_i]->free_fn();
-            delete local_ext[ext_i];
-          }
-          delete [] local_ext;
+        if(block_test_fns[i] == NULL)
+          continue;
+        rhs_indices[rhs_count] = current_als_i->dof[i];
+        local_rhs[rhs_count++] = block_scaling_coefficient * local_rhs[i] * form->scaling_factor * current_als_i->coef[i];
+      }
+      if(form->load_case > 0)
+      {
+        AssemblyProfile::Timer scatter_timer(this->current_phase_profile(), AssemblyProfile::Scatter);
+        if(profile != NULL)
+          profile->scatter_operations++;
+        this->current_load_case_rhs[form->load_case - 1]->add(rhs_count, rhs_indices, local_rhs);
       }
+      else
+        this->add_local_vector(rhs_count, rhs_indices, local_rhs);
 
       if(RungeKutta)
         u_ext -= form->u_ext_offset;
@@ -2147,6 +4464,15 @@ namespace Hermes
       return np;
     }
 
+    template<typename Scalar>
+    int DiscreteProblem<Scalar>::copy_geometry_points(int np, const Geom<double>* from_geometry, const double* from_jacobian_x_weights, Geom<double>*& geometry, double*& jacobian_x_weights)
+    {
+      geometry = copy_geom(from_geometry, np);
+      jacobian_x_weights = new double[np];
+      memcpy(jacobian_x_weights, from_jacobian_x_weights, np * sizeof(double));
+      return np;
+    }
+
     template<typename Scalar>
     int DiscreteProblem<Scalar>::init_surface_geometry_points(RefMap* reference_mapping, int& order, Traverse::State* current_state, Geom<double>*& geometry, double*& jacobian_x_weights)
     {
@@ -2202,6 +4528,89 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    DiscreteProblem<Scalar>::OrderKey::OrderKey() : size(0)
+    {
+      memset(this->words, 0, sizeof(this->words));
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::OrderKey::push_back(int order)
+    {
+      if(order < 0 || order > 63 || this->size == 10 * H2D_ORDER_KEY_WORDS)
+        return false;
+      this->words[this->size / 10] |= ((uint64_t)order) << (6 * (this->size % 10));
+      this->size++;
+      return true;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::OrderKey::operator<(const OrderKey& other) const
+    {
+      if(this->size != other.size)
+        return this->size < other.size;
+      for(int i = 0; i < H2D_ORDER_KEY_WORDS; i++)
+        if(this->words[i] != other.words[i])
+          return this->words[i] < other.words[i];
+      return false;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::get_order_key(Form<Scalar> *form, Solution<Scalar>** current_u_ext, Traverse::State* current_state, OrderKey& key)
+    {
+      // The same orders init_ext_orders() creates the functions with.
+      unsigned int prev_size = RungeKutta ? RK_original_spaces_count : this->wf->get_neq() - form->u_ext_offset;
+      bool surface_form = (current_state->isurf > -1);
+
+      // Surface and volumetric evaluations of the same form are distinguished.
+      if(!key.push_back(surface_form ? 1 : 0))
+        return false;
+
+      for(unsigned int i = 0; i < prev_size; i++)
+      {
+        MeshFunction<Scalar>* fn = current_u_ext == NULL ? NULL : current_u_ext[i + form->u_ext_offset];
+        int fn_order = 0;
+        if(fn != NULL)
+          fn_order = (surface_form ? fn->get_edge_fn_order(current_state->isurf) : fn->get_fn_order()) + (fn->get_num_components() > 1 ? 1 : 0);
+        if(!key.push_back(fn_order))
+          return false;
+      }
+
+      const Hermes::vector<MeshFunction<Scalar>*>& ext = form->ext.size() > 0 ? form->ext : form->wf->ext;
+      for (unsigned int i = 0; i < ext.size(); i++)
+        if(!key.push_back((surface_form ? ext[i]->get_edge_fn_order(current_state->isurf) : ext[i]->get_fn_order()) + (ext[i]->get_num_components() > 1 ? 1 : 0)))
+          return false;
+
+      return true;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblem<Scalar>::get_cached_order(Form<Scalar> *form, const OrderKey& key, int& order)
+    {
+      // Outside of the assembling threads (no cache of the thread) the order is just not cached.
+      unsigned int thread = omp_get_thread_num();
+      if(thread >= this->order_caches.size() || (unsigned int)form->position >= this->order_caches[thread].size())
+        return false;
+
+      const std::map<OrderKey, int>& cache = this->order_caches[thread][form->position];
+      typename std::map<OrderKey, int>::const_iterator it = cache.find(key);
+      if(it == cache.end())
+        return false;
+      order = it->second;
+      return true;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_cached_order(Form<Scalar> *form, const OrderKey& key, int order)
+    {
+      unsigned int thread = omp_get_thread_num();
+      if(thread >= this->order_caches.size())
+        return;
+      if((unsigned int)form->position >= this->order_caches[thread].size())
+        this->order_caches[thread].resize(form->position + 1);
+      this->order_caches[thread][form->position][key] = order;
+    }
+
     template<typename Scalar>
     void DiscreteProblem<Scalar>::deinit_ext_orders(Form<Scalar> *form, Func<Hermes::Ord>** oi, Func<Hermes::Ord>** oext)
     {
@@ -2238,223 +4647,390 @@ namespace Hermes
       int coordinate = (dynamic_cast<VectorForm<Scalar>*>(form) == NULL) ? (static_cast<MatrixForm<Scalar>*>(form)->i) : (static_cast<VectorForm<Scalar>*>(form)->i);
       order = current_refmaps[coordinate]->get_inv_ref_order();
       order += o->get_order();
-      limit_order(order, current_refmaps[coordinate]->get_active_element()->get_mode());
+      order += form->integration_order_increase;
+      limit_form_order(form, order, current_refmaps);
     }
 
     template<typename Scalar>
-    void DiscreteProblem<Scalar>::assemble_one_DG_state(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-      Traverse::State* current_state, Hermes::vector<MatrixFormDG<Scalar>*> current_mfDG, Hermes::vector<VectorFormDG<Scalar>*> current_vfDG, Transformable** fn, WeakForm<Scalar>* current_wf)
+    void DiscreteProblem<Scalar>::limit_form_order(Form<Scalar> *form, int& order, RefMap** current_refmaps)
     {
-      // Determine the minimum mesh seq.
-      unsigned int min_dg_mesh_seq = 0;
-      for(unsigned int i = 0; i < spaces.size(); i++)
-        if(spaces[i]->get_mesh()->get_seq() < min_dg_mesh_seq || i == 0)
-          min_dg_mesh_seq = spaces[i]->get_mesh()->get_seq();
-
-      // Create neighbor psss, refmaps.
-      std::map<unsigned int, PrecalcShapeset *> npss;
-      std::map<unsigned int, PrecalcShapeset *> nspss;
-      std::map<unsigned int, RefMap *> nrefmap;
+      int coordinate = (dynamic_cast<VectorForm<Scalar>*>(form) == NULL) ? (static_cast<MatrixForm<Scalar>*>(form)->i) : (static_cast<VectorForm<Scalar>*>(form)->i);
+      ElementMode2D mode = current_refmaps[coordinate]->get_active_element()->get_mode();
+      if(order < 0)
+        order = 0;
+      // A custom quadrature has its own tables.
+      if(form->quad_2d != NULL)
+      {
+        if(order > form->quad_2d->get_max_order(mode))
+          order = form->quad_2d->get_max_order(mode);
+      }
+      else
+        limit_order(order, mode);
+    }
 
-      // Initialize neighbor precalc shapesets and refmaps.
-      // This is only needed when there are matrix DG forms present.
-      if(DG_matrix_forms_present)
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::assemble_form_own_quadrature(Form<Scalar>* form, PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, Solution<Scalar>** current_u_ext,
+      AsmList<Scalar>** current_als, AsmList<Scalar>** current_alsSurface, Traverse::State* current_state, WeakForm<Scalar>* current_wf)
+    {
+      MatrixForm<Scalar>* mf = dynamic_cast<MatrixForm<Scalar>*>(form);
+      VectorForm<Scalar>* vf = dynamic_cast<VectorForm<Scalar>*>(form);
+      bool surface_form = (mf != NULL) ? (dynamic_cast<MatrixFormVol<Scalar>*>(form) == NULL) : (dynamic_cast<VectorFormVol<Scalar>*>(form) == NULL);
+
+      // Test functions (k = 0) and basis functions (k = 1, matrix forms only).
+      int form_spaces[2] = { (mf != NULL) ? mf->i : vf->i, (mf != NULL) ? mf->j : -1 };
+      int num_form_spaces = (mf != NULL) ? 2 : 1;
+
+      form->wf = current_wf;
+      int order = (mf != NULL) ? calc_order_matrix_form(mf, current_refmaps, current_u_ext, current_state) : calc_order_vector_form(vf, current_refmaps, current_u_ext, current_state);
+
+      // A custom quadrature - own reference mappings, the other functions are switched to it for this form.
+      Quad2D* quad = form->quad_2d;
+      RefMap* refmaps[2] = { NULL, NULL };
+      AsmList<Scalar>* als[2] = { NULL, NULL };
+      for(int k = 0; k < num_form_spaces; k++)
       {
-        for (unsigned int i = 0; i < spaces.size(); i++)
+        int space_k = form_spaces[k];
+        als[k] = surface_form ? &current_alsSurface[space_k][current_state->isurf] : current_als[space_k];
+        if(quad != NULL)
         {
-          PrecalcShapeset* new_ps = new PrecalcShapeset(spaces[i]->shapeset);
-          npss.insert(std::pair<unsigned int, PrecalcShapeset*>(i, new_ps));
-          PrecalcShapeset* new_pss = new PrecalcShapeset(npss[i]);
-          nspss.insert(std::pair<unsigned int, PrecalcShapeset*>(i, new_pss));
-          RefMap* new_rm = new RefMap();
-          new_rm->set_quad_2d(&g_quad_2d_std);
-          nrefmap.insert(std::pair<unsigned int, RefMap*>(i, new_rm));
+          refmaps[k] = new RefMap;
+          refmaps[k]->set_quad_2d(quad);
+          refmaps[k]->set_active_element(current_state->e[space_k]);
+          current_spss[space_k]->set_quad_2d(quad);
         }
+        else
+          refmaps[k] = current_refmaps[space_k];
+        refmaps[k]->force_transform(current_pss[space_k]->get_transform(), current_pss[space_k]->get_ctm());
+        current_spss[space_k]->set_active_element(current_state->e[space_k]);
+        current_spss[space_k]->set_master_transform();
       }
+      if(quad != NULL)
+        this->set_ext_quad_2d(form, quad, current_u_ext, current_wf);
 
-      bool** processed = new bool*[current_state->rep->nvert];
-      LightArray<NeighborSearch<Scalar>*>** neighbor_searches = new LightArray<NeighborSearch<Scalar>*>*[current_state->rep->nvert];
-      (5);
-      unsigned int* num_neighbors = new unsigned int[current_state->rep->nvert];
+      // Integration points - for surface forms, order becomes the edge table.
+      Geom<double>* geometry;
+      double* jacobian_x_weights;
+      int n_quadrature_points;
+      if(surface_form)
+        n_quadrature_points = init_surface_geometry_points(refmaps[0], order, current_state, geometry, jacobian_x_weights);
+      else
+        n_quadrature_points = init_geometry_points(refmaps[0], order, geometry, jacobian_x_weights);
 
-      bool intra_edge_passed_DG[H2D_MAX_NUMBER_VERTICES];
-      for(int a = 0; a < H2D_MAX_NUMBER_VERTICES; a++)
-        intra_edge_passed_DG[a] = false;
+      // Temporaries, released with the arena after the state.
+      Arena* arena = this->current_arena();
 
-#pragma omp critical (DG)
+      Func<double>** fns[2] = { NULL, NULL };
+      for(int k = 0; k < num_form_spaces; k++)
+      {
+        int space_k = form_spaces[k];
+        fns[k] = arena->allocate_array<Func<double>*>(als[k]->cnt);
+        init_fns(current_spss[space_k], refmaps[k], order, als[k]->cnt, als[k]->idx, fns[k]);
+      }
+
+      // - u_ext
+      Func<Scalar>** u_ext = NULL;
+      int prevNewtonSize = this->wf->get_neq();
+      if(!this->is_linear)
+      {
+        u_ext = arena->allocate_array<Func<Scalar>*>(prevNewtonSize);
+        for(int u_ext_i = 0; u_ext_i < prevNewtonSize; u_ext_i++)
+          u_ext[u_ext_i] = (current_u_ext != NULL && current_u_ext[u_ext_i] != NULL) ? init_fn(current_u_ext[u_ext_i], order, arena) : NULL;
+      }
+
+      // - ext
+      int current_extCount = this->wf->ext.size();
+      Func<Scalar>** ext = NULL;
+      if(current_extCount > 0)
       {
-        for(unsigned int i = 0; i < current_state->num; i++)
-          current_state->e[i]->visited = true;
+        ext = arena->allocate_array<Func<Scalar>*>(current_extCount);
+        for(int ext_i = 0; ext_i < current_extCount; ext_i++)
+          ext[ext_i] = (current_wf->ext[ext_i] != NULL) ? init_fn(current_wf->ext[ext_i], order, arena) : NULL;
+      }
+
+      if(RungeKutta)
+        for(int ext_i = 0; ext_i < this->RK_original_spaces_count; ext_i++)
+          u_ext[ext_i]->add(ext[current_extCount - this->RK_original_spaces_count + ext_i]);
 
-        for(current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
+      // Neither the sum factorization nor the kept values of the incremental reassembly - both assume the shared points.
+      if(mf != NULL)
+        assemble_matrix_form(mf, order, fns[1], fns[0], ext, u_ext, als[0], als[1], current_state, n_quadrature_points, geometry, jacobian_x_weights, NULL, NULL);
+      else
+        assemble_vector_form(vf, order, fns[0], ext, u_ext, als[0], current_state, n_quadrature_points, geometry, jacobian_x_weights);
+
+      // Cleanup.
+      for(int k = 0; k < num_form_spaces; k++)
+      {
+        for (unsigned int j = 0; j < als[k]->cnt; j++)
         {
-          bool inner_edge_for_dg = false;
-          for(int i = 0; i < this->spaces_size; i++)
-            if(current_state->e[i]->en[current_state->isurf]->marker == 0)
-              inner_edge_for_dg = true;
-          if(inner_edge_for_dg)
-          {
-            neighbor_searches[current_state->isurf] = new LightArray<NeighborSearch<Scalar>*>(5);
+          fns[k][j]->free_fn();
+          delete fns[k][j];
+        }
+        if(quad != NULL)
+        {
+          delete refmaps[k];
+          current_spss[form_spaces[k]]->set_quad_2d(&g_quad_2d_std);
+        }
+      }
+      if(quad != NULL)
+        this->set_ext_quad_2d(form, &g_quad_2d_std, current_u_ext, current_wf);
+      delete [] jacobian_x_weights;
+      geometry->free();
+      delete geometry;
+    }
 
-            if(!init_neighbors((*neighbor_searches[current_state->isurf]), current_state, min_dg_mesh_seq))
-            {
-              intra_edge_passed_DG[current_state->isurf] = true;
-              continue;
-            }
-            // Create a multimesh tree;
-            NeighborNode* root = new NeighborNode(NULL, 0);
-            build_multimesh_tree(root, (*neighbor_searches[current_state->isurf]));
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::set_ext_quad_2d(Form<Scalar>* form, Quad2D* quad, Solution<Scalar>** current_u_ext, WeakForm<Scalar>* current_wf)
+    {
+      if(!this->is_linear && current_u_ext != NULL)
+        for(int u_ext_i = 0; u_ext_i < this->wf->get_neq(); u_ext_i++)
+          if(current_u_ext[u_ext_i] != NULL)
+            current_u_ext[u_ext_i]->set_quad_2d(quad);
+      for(unsigned int ext_i = 0; ext_i < current_wf->ext.size(); ext_i++)
+        if(current_wf->ext[ext_i] != NULL)
+          current_wf->ext[ext_i]->set_quad_2d(quad);
+      for(unsigned int ext_i = 0; ext_i < form->ext.size(); ext_i++)
+        if(form->ext[ext_i] != NULL)
+          form->ext[ext_i]->set_quad_2d(quad);
+    }
+
+    template<typename Scalar>
+    DiscreteProblem<Scalar>::DGStateInterfaces::DGStateInterfaces()
+    {
+      for(int i = 0; i < H2D_MAX_NUMBER_VERTICES; i++)
+      {
+        this->neighbor_searches[i] = NULL;
+        this->num_neighbors[i] = 0;
+        this->processed[i] = NULL;
+      }
+    }
+
+    template<typename Scalar>
+    DiscreteProblem<Scalar>::DGStateInterfaces::~DGStateInterfaces()
+    {
+      for(int i = 0; i < H2D_MAX_NUMBER_VERTICES; i++)
+      {
+        if(this->neighbor_searches[i] != NULL)
+        {
+          for(unsigned int j = 0; j < this->neighbor_searches[i]->get_size(); j++)
+            if(this->neighbor_searches[i]->present(j))
+              delete this->neighbor_searches[i]->get(j);
+          delete this->neighbor_searches[i];
+        }
+        delete [] this->processed[i];
+      }
+    }
+
+    template<typename Scalar>
+    unsigned int DiscreteProblem<Scalar>::get_min_dg_mesh_seq() const
+    {
+      unsigned int min_dg_mesh_seq = 0;
+      for(unsigned int i = 0; i < spaces.size(); i++)
+        if(spaces[i]->get_mesh()->get_seq() < min_dg_mesh_seq || i == 0)
+          min_dg_mesh_seq = spaces[i]->get_mesh()->get_seq();
+      return min_dg_mesh_seq;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::init_DG_state_interfaces(Traverse::State* current_state, unsigned int min_dg_mesh_seq, DGStateInterfaces* interfaces)
+    {
+      for(unsigned int i = 0; i < current_state->num; i++)
+        current_state->e[i]->visited = true;
+
+      for(current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
+      {
+        bool inner_edge_for_dg = false;
+        for(int i = 0; i < this->spaces_size; i++)
+          if(current_state->e[i]->en[current_state->isurf]->marker == 0)
+            inner_edge_for_dg = true;
+        if(!inner_edge_for_dg)
+          continue;
+
+        LightArray<NeighborSearch<Scalar>*>* neighbor_searches = new LightArray<NeighborSearch<Scalar>*>(5);
+        interfaces->neighbor_searches[current_state->isurf] = neighbor_searches;
+
+        if(!init_neighbors(*neighbor_searches, current_state, min_dg_mesh_seq))
+        {
+          // Intra-element edge on all the meshes, nothing to assemble.
+          for(unsigned int i = 0; i < neighbor_searches->get_size(); i++)
+            if(neighbor_searches->present(i))
+              delete neighbor_searches->get(i);
+          delete neighbor_searches;
+          interfaces->neighbor_searches[current_state->isurf] = NULL;
+          continue;
+        }
+        // Create a multimesh tree;
+        NeighborNode* root = new NeighborNode(NULL, 0);
+        build_multimesh_tree(root, *neighbor_searches);
 
 #ifdef DEBUG_DG_ASSEMBLING
 #pragma omp critical (debug_DG)
+          {
+            int id = 0;
+            bool pass = true;
+            if(DEBUG_DG_ASSEMBLING_ELEMENT != -1)
             {
-              int id = 0;
-              bool pass = true;
-              if(DEBUG_DG_ASSEMBLING_ELEMENT != -1)
-              {
-                for(unsigned int i = 0; i < (*neighbor_searches[current_state->isurf]).get_size(); i++)
-                  if((*neighbor_searches[current_state->isurf]).present(i))
-                    if((*neighbor_searches[current_state->isurf]).get(i)->central_el->id == DEBUG_DG_ASSEMBLING_ELEMENT)
-                      pass = false;
-              }
-              else
-                pass = false;
+              for(unsigned int i = 0; i < (*interfaces->neighbor_searches[current_state->isurf]).get_size(); i++)
+                if((*interfaces->neighbor_searches[current_state->isurf]).present(i))
+                  if((*interfaces->neighbor_searches[current_state->isurf]).get(i)->central_el->id == DEBUG_DG_ASSEMBLING_ELEMENT)
+                    pass = false;
+            }
+            else
+              pass = false;
 
-              if(!pass)
-                if(DEBUG_DG_ASSEMBLING_ISURF != -1)
-                  if(current_state->isurf != DEBUG_DG_ASSEMBLING_ISURF)
-                    pass = true;
+            if(!pass)
+              if(DEBUG_DG_ASSEMBLING_ISURF != -1)
+                if(current_state->isurf != DEBUG_DG_ASSEMBLING_ISURF)
+                  pass = true;
 
-              if(!pass)
+            if(!pass)
+            {
+              for(unsigned int i = 0; i < (*interfaces->neighbor_searches[current_state->isurf]).get_size(); i++)
               {
-                for(unsigned int i = 0; i < (*neighbor_searches[current_state->isurf]).get_size(); i++)
+                if((*interfaces->neighbor_searches[current_state->isurf]).present(i))
                 {
-                  if((*neighbor_searches[current_state->isurf]).present(i))
+                  NeighborSearch<Scalar>* ns = (*interfaces->neighbor_searches[current_state->isurf]).get(i);
+                  std::cout << (std::string)"The " << ++id << (std::string)"-th Neighbor search:: " << (std::string)"Central element: " << ns->central_el->id << (std::string)", Isurf: " << current_state->isurf << (std::string)", Original sub_idx: " << ns->original_central_el_transform << std::endl;
+                  for(int j = 0; j < ns->n_neighbors; j++)
                   {
-                    NeighborSearch<Scalar>* ns = (*neighbor_searches[current_state->isurf]).get(i);
-                    std::cout << (std::string)"The " << ++id << (std::string)"-th Neighbor search:: " << (std::string)"Central element: " << ns->central_el->id << (std::string)", Isurf: " << current_state->isurf << (std::string)", Original sub_idx: " << ns->original_central_el_transform << std::endl;
-                    for(int j = 0; j < ns->n_neighbors; j++)
+                    std::cout << '\t' << (std::string)"The " << j << (std::string)"-th neighbor element: " << ns->neighbors[j]->id << std::endl;
+                    if(ns->central_transformations.present(j))
                     {
-                      std::cout << '\t' << (std::string)"The " << j << (std::string)"-th neighbor element: " << ns->neighbors[j]->id << std::endl;
-                      if(ns->central_transformations.present(j))
-                      {
-                        std::cout << '\t' << (std::string)"Central transformations: " << std::endl;
-                        for(int k = 0; k < ns->central_transformations.get(j)->num_levels; k++)
-                          std::cout << '\t' << '\t' << ns->central_transformations.get(j)->transf[k] << std::endl;
-                      }
-                      if(ns->neighbor_transformations.present(j))
-                      {
-                        std::cout << '\t' << (std::string)"Neighbor transformations: " << std::endl;
-                        for(int k = 0; k < ns->neighbor_transformations.get(j)->num_levels; k++)
-                          std::cout << '\t' << '\t' << ns->neighbor_transformations.get(j)->transf[k] << std::endl;
-                      }
+                      std::cout << '\t' << (std::string)"Central transformations: " << std::endl;
+                      for(int k = 0; k < ns->central_transformations.get(j)->num_levels; k++)
+                        std::cout << '\t' << '\t' << ns->central_transformations.get(j)->transf[k] << std::endl;
+                    }
+                    if(ns->neighbor_transformations.present(j))
+                    {
+                      std::cout << '\t' << (std::string)"Neighbor transformations: " << std::endl;
+                      for(int k = 0; k < ns->neighbor_transformations.get(j)->num_levels; k++)
+                        std::cout << '\t' << '\t' << ns->neighbor_transformations.get(j)->transf[k] << std::endl;
                     }
                   }
                 }
               }
             }
+          }
 #endif
 
-            // Update all NeighborSearches according to the multimesh tree.
-            // After this, all NeighborSearches in neighbor_searches should have the same count
-            // of neighbors and proper set of transformations
-            // for the central and the neighbor element(s) alike.
-            // Also check that every NeighborSearch has the same number of neighbor elements.
-            num_neighbors[current_state->isurf] = 0;
-            for(unsigned int i = 0; i < (*neighbor_searches[current_state->isurf]).get_size(); i++)
+        // Update all NeighborSearches according to the multimesh tree.
+        // After this, all NeighborSearches in neighbor_searches should have the same count
+        // of neighbors and proper set of transformations
+        // for the central and the neighbor element(s) alike.
+        // Also check that every NeighborSearch has the same number of neighbor elements.
+        unsigned int num_neighbors = 0;
+        for(unsigned int i = 0; i < neighbor_searches->get_size(); i++)
+        {
+          if(neighbor_searches->present(i))
+          {
+            NeighborSearch<Scalar>* ns = neighbor_searches->get(i);
+            update_neighbor_search(ns, root);
+            if(num_neighbors == 0)
+              num_neighbors = ns->n_neighbors;
+            if(ns->n_neighbors != num_neighbors)
             {
-              if((*neighbor_searches[current_state->isurf]).present(i))
-              {
-                NeighborSearch<Scalar>* ns = (*neighbor_searches[current_state->isurf]).get(i);
-                update_neighbor_search(ns, root);
-                if(num_neighbors[current_state->isurf] == 0)
-                  num_neighbors[current_state->isurf] = ns->n_neighbors;
-                if(ns->n_neighbors != num_neighbors[current_state->isurf])
-                  throw Hermes::Exceptions::Exception("Num_neighbors of different NeighborSearches not matching in DiscreteProblem<Scalar>::assemble_surface_integrals().");
-              }
+              delete root;
+              throw Hermes::Exceptions::Exception("Num_neighbors of different NeighborSearches not matching in DiscreteProblem<Scalar>::assemble_surface_integrals().");
             }
+          }
+        }
+        interfaces->num_neighbors[current_state->isurf] = num_neighbors;
 
-            // Delete the multimesh tree;
-            delete root;
+        // Delete the multimesh tree;
+        delete root;
 
-            processed[current_state->isurf] = new bool[num_neighbors[current_state->isurf]];
+        interfaces->processed[current_state->isurf] = new bool[num_neighbors];
 
-            for(unsigned int neighbor_i = 0; neighbor_i < num_neighbors[current_state->isurf]; neighbor_i++)
+        for(unsigned int neighbor_i = 0; neighbor_i < num_neighbors; neighbor_i++)
+        {
+          // If the active segment has already been processed (when the neighbor element was assembled), it is skipped.
+          // We test all neighbor searches, because in the case of intra-element edge, the neighboring (the same as central) element
+          // will be marked as visited, even though the edge was not calculated.
+          interfaces->processed[current_state->isurf][neighbor_i] = true;
+          for(unsigned int i = 0; i < neighbor_searches->get_size(); i++)
+          {
+            if(neighbor_searches->present(i))
             {
-              // If the active segment has already been processed (when the neighbor element was assembled), it is skipped.
-              // We test all neighbor searches, because in the case of intra-element edge, the neighboring (the same as central) element
-              // will be marked as visited, even though the edge was not calculated.
-              processed[current_state->isurf][neighbor_i] = true;
-              for(unsigned int i = 0; i < (*neighbor_searches[current_state->isurf]).get_size(); i++)
+              if(!neighbor_searches->get(i)->neighbors.at(neighbor_i)->visited)
               {
-                if((*neighbor_searches[current_state->isurf]).present(i))
-                {
-                  if(!(*neighbor_searches[current_state->isurf]).get(i)->neighbors.at(neighbor_i)->visited)
-                  {
-                    processed[current_state->isurf][neighbor_i] = false;
-                    break;
-                  }
-                }
+                interfaces->processed[current_state->isurf][neighbor_i] = false;
+                break;
               }
             }
           }
         }
       }
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::precalculate_DG_interfaces(Traverse::State** states, int num_states)
+    {
+      this->free_DG_interfaces();
+
+      unsigned int min_dg_mesh_seq = this->get_min_dg_mesh_seq();
+      this->DG_interfaces = new DGStateInterfaces*[num_states];
+      this->DG_interfaces_count = num_states;
+      for(int state_i = 0; state_i < num_states; state_i++)
+        this->DG_interfaces[state_i] = new DGStateInterfaces();
+
+      // In the order of the states - the same segments are then skipped as in a serial assembly.
+      for(int state_i = 0; state_i < num_states; state_i++)
+        this->init_DG_state_interfaces(states[state_i], min_dg_mesh_seq, this->DG_interfaces[state_i]);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::free_DG_interfaces()
+    {
+      if(this->DG_interfaces == NULL)
+        return;
+      for(int state_i = 0; state_i < this->DG_interfaces_count; state_i++)
+        delete this->DG_interfaces[state_i];
+      delete [] this->DG_interfaces;
+      this->DG_interfaces = NULL;
+      this->DG_interfaces_count = 0;
+    }
+
+    template<typename Scalar>
+    void DiscreteProblem<Scalar>::assemble_one_DG_state(PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
+      Traverse::State* current_state, const Hermes::vector<MatrixFormDG<Scalar>*>& current_mfDG, const Hermes::vector<VectorFormDG<Scalar>*>& current_vfDG, Transformable** fn, WeakForm<Scalar>* current_wf,
+      PrecalcShapeset** npss, PrecalcShapeset** nspss, RefMap** nrefmaps, DGStateInterfaces* interfaces)
+    {
+      // Determine the minimum mesh seq.
+      unsigned int min_dg_mesh_seq = this->get_min_dg_mesh_seq();
+
+      // Find the neighbors, unless precalculated.
+      DGStateInterfaces local_interfaces;
+      if(interfaces == NULL)
+      {
+        interfaces = &local_interfaces;
+#pragma omp critical (DG)
+        this->init_DG_state_interfaces(current_state, min_dg_mesh_seq, interfaces);
+      }
 
       for(current_state->isurf = 0; current_state->isurf < current_state->rep->nvert; current_state->isurf++)
       {
-        if(intra_edge_passed_DG[current_state->isurf])
-          continue;
-        
-        bool inner_edge_for_dg = false;
-          for(int i = 0; i < this->spaces_size; i++)
-            if(current_state->e[i]->en[current_state->isurf]->marker == 0)
-              inner_edge_for_dg = true;
-        if(!inner_edge_for_dg)
+        if(interfaces->neighbor_searches[current_state->isurf] == NULL)
           continue;
 
-        for(unsigned int neighbor_i = 0; neighbor_i < num_neighbors[current_state->isurf]; neighbor_i++)
+        for(unsigned int neighbor_i = 0; neighbor_i < interfaces->num_neighbors[current_state->isurf]; neighbor_i++)
         {
-          if(!DG_vector_forms_present && processed[current_state->isurf][neighbor_i])
+          if(!DG_vector_forms_present && interfaces->processed[current_state->isurf][neighbor_i])
             continue;
 
           // DG-inner-edge-wise parameters for WeakForm.
           (const_cast<WeakForm<Scalar>*>(current_wf))->set_active_DG_state(current_state->e, current_state->isurf);
 
-          assemble_DG_one_neighbor(processed[current_state->isurf][neighbor_i], neighbor_i, current_pss, current_spss, current_refmaps, current_als,
+          assemble_DG_one_neighbor(interfaces->processed[current_state->isurf][neighbor_i], neighbor_i, current_pss, current_spss, current_refmaps, current_als,
             current_state, current_mfDG, current_vfDG, fn,
-            npss, nspss, nrefmap, (*neighbor_searches[current_state->isurf]), min_dg_mesh_seq, current_wf);
+            npss, nspss, nrefmaps, *interfaces->neighbor_searches[current_state->isurf], min_dg_mesh_seq, current_wf);
         }
-
-        // Delete the neighbor_searches array.
-        for(unsigned int i = 0; i < (*neighbor_searches[current_state->isurf]).get_size(); i++)
-          if((*neighbor_searches[current_state->isurf]).present(i))
-            delete (*neighbor_searches[current_state->isurf]).get(i);
-        delete neighbor_searches[current_state->isurf];
-        delete [] processed[current_state->isurf];
-      }
-
-      delete [] processed;
-      delete [] neighbor_searches;
-      delete [] num_neighbors;
-
-      // Deinitialize neighbor pss's, refmaps.
-      if(DG_matrix_forms_present)
-      {
-        for(std::map<unsigned int, PrecalcShapeset *>::iterator it = nspss.begin(); it != nspss.end(); it++)
-          delete it->second;
-        for(std::map<unsigned int, PrecalcShapeset *>::iterator it = npss.begin(); it != npss.end(); it++)
-          delete it->second;
-        for(std::map<unsigned int, RefMap *>::iterator it = nrefmap.begin(); it != nrefmap.end(); it++)
-          delete it->second;
       }
     }
 
     template<typename Scalar>
     void DiscreteProblem<Scalar>::assemble_DG_one_neighbor(bool edge_processed, unsigned int neighbor_i,
       PrecalcShapeset** current_pss, PrecalcShapeset** current_spss, RefMap** current_refmaps, AsmList<Scalar>** current_als,
-      Traverse::State* current_state, Hermes::vector<MatrixFormDG<Scalar>*> current_mfDG, Hermes::vector<VectorFormDG<Scalar>*> current_vfDG, Transformable** fn,
-      std::map<unsigned int, PrecalcShapeset *> npss, std::map<unsigned int, PrecalcShapeset *> nspss, std::map<unsigned int, RefMap *> nrefmap,
+      Traverse::State* current_state, const Hermes::vector<MatrixFormDG<Scalar>*>& current_mfDG, const Hermes::vector<VectorFormDG<Scalar>*>& current_vfDG, Transformable** fn,
+      PrecalcShapeset** npss, PrecalcShapeset** nspss, RefMap** nrefmaps,
       LightArray<NeighborSearch<Scalar>*>& neighbor_searches, unsigned int min_dg_mesh_seq, WeakForm<Scalar>* current_wf)
     {
       // Set the active segment in all NeighborSearches
@@ -2484,7 +5060,7 @@ namespace Hermes
       }
 
       // For neighbor psss.
-      if(current_mat != NULL && DG_matrix_forms_present && !edge_processed)
+      if(this->matrix_forms_to_be_assembled() && DG_matrix_forms_present && !edge_processed)
       {
         for(unsigned int idx_i = 0; idx_i < spaces.size(); idx_i++)
         {
@@ -2502,12 +5078,12 @@ namespace Hermes
         current_refmaps[i]->force_transform(current_pss[i]->get_transform(), current_pss[i]->get_ctm());
 
         // Neighbor.
-        if(current_mat != NULL && DG_matrix_forms_present && !edge_processed)
+        if(this->matrix_forms_to_be_assembled() && DG_matrix_forms_present && !edge_processed)
         {
           nspss[i]->set_active_element(npss[i]->get_active_element());
           nspss[i]->set_master_transform();
-          nrefmap[i]->set_active_element(npss[i]->get_active_element());
-          nrefmap[i]->force_transform(npss[i]->get_transform(), npss[i]->get_ctm());
+          nrefmaps[i]->set_active_element(npss[i]->get_active_element());
+          nrefmaps[i]->force_transform(npss[i]->get_transform(), npss[i]->get_ctm());
         }
       }
 
@@ -2522,8 +5098,9 @@ namespace Hermes
       DiscontinuousFunc<double>*** testFunctions = new DiscontinuousFunc<double>**[this->spaces_size];
 
       // Create the extended shapeset on the union of the central element and its current neighbor.
-      int order = 20;
-      int order_base = 20;
+      // The one-point rule in the finite volume mode, the neighbors are constant as well.
+      int order = this->is_fvm ? 1 : 20;
+      int order_base = order;
       for (unsigned int i = 0; i < this->spaces_size; i++)
       {
         if(this->spaces[i]->get_type() != HERMES_L2_SPACE)
@@ -2554,7 +5131,7 @@ namespace Hermes
           {
             npss[i]->set_active_shape(ext_asmlist[i]->neighbor_al->idx[func_i - ext_asmlist[i]->central_al->cnt]);
             PrecalcShapeset* func = npss[i];
-            RefMap* refmap = nrefmap[i];
+            RefMap* refmap = nrefmaps[i];
             testFunctions[i][func_i] = new DiscontinuousFunc<double>(init_fn(func, refmap, nbs[i]->get_quad_eo(true)), true, nbs[i]->neighbor_edge.orientation);
           }
         }
@@ -2562,14 +5139,18 @@ namespace Hermes
 
       DiscontinuousFunc<Scalar>** ext = init_ext_fns(current_wf->ext, neighbor_searches, order, min_dg_mesh_seq);
 
-      if(current_mat != NULL && DG_matrix_forms_present && !edge_processed)
+      if(this->matrix_forms_to_be_assembled() && DG_matrix_forms_present && !edge_processed)
       {
         for(int current_mfsurf_i = 0; current_mfsurf_i < wf->mfDG.size(); current_mfsurf_i++)
         {
           if(!form_to_be_assembled((MatrixForm<Scalar>*)current_mfDG[current_mfsurf_i], current_state))
+          {
+            this->count_skipped_form(current_mfDG[current_mfsurf_i]);
             continue;
+          }
 
           MatrixFormDG<Scalar>* mfs = current_mfDG[current_mfsurf_i];
+          FormProfile::Evaluation form_evaluation(this->current_form_profile(mfs), order, n_quadrature_points);
 
           double block_scaling_coefficient = block_scaling_coeff(mfs);
 
@@ -2609,7 +5190,7 @@ namespace Hermes
             }
           }
 
-          current_mat->add(ext_asmlist_v->cnt, ext_asmlist_u->cnt, local_stiffness_matrix, ext_asmlist_v->dof, ext_asmlist_u->dof);
+          this->add_local_matrix(ext_asmlist_v->cnt, ext_asmlist_u->cnt, local_stiffness_matrix, ext_asmlist_v->dof, ext_asmlist_u->dof, NULL);
 
           delete [] local_stiffness_matrix;
         }
@@ -2643,9 +5224,13 @@ namespace Hermes
           int n = vfs->i;
 
           if(!form_to_be_assembled((VectorForm<Scalar>*)vfs, current_state))
+          {
+            this->count_skipped_form(vfs);
             continue;
+          }
 
           NeighborSearch<Scalar>* nbs_v = nbs[n];
+          FormProfile::Evaluation form_evaluation(this->current_form_profile(vfs), order, n_quadrature_points);
 
           // Here we use the standard pss, possibly just transformed by NeighborSearch.
           for (unsigned int dof_i = 0; dof_i < current_als[n]->cnt; dof_i++)
@@ -3128,5 +5713,7 @@ namespace Hermes
 
     template class HERMES_API DiscreteProblem<double>;
     template class HERMES_API DiscreteProblem<std::complex<double> >;
+    template class HERMES_API AssemblyTask<double>;
+    template class HERMES_API AssemblyTask<std::complex<double> >;
   }
 }
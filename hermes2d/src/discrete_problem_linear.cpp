@@ -37,23 +37,66 @@ namespace Hermes
     DiscreteProblemLinear<Scalar>::DiscreteProblemLinear(const WeakForm<Scalar>* wf, Hermes::vector<const Space<Scalar> *> spaces) : DiscreteProblem<Scalar>(wf, spaces)
     {
       this->is_linear = true;
+      this->incremental_reassembly = false;
+      this->constant_matrix = false;
+      this->constant_matrix_target = NULL;
+      this->constant_matrix_part = NULL;
+      this->matrix_kept = false;
+      this->constant_forms_into_matrix = true;
+      this->time_dependent_forms_into_matrix = true;
     }
 
     template<typename Scalar>
     DiscreteProblemLinear<Scalar>::DiscreteProblemLinear(const WeakForm<Scalar>* wf, const Space<Scalar>* space) : DiscreteProblem<Scalar>(wf, space)
     {
       this->is_linear = true;
+      this->incremental_reassembly = false;
+      this->constant_matrix = false;
+      this->constant_matrix_target = NULL;
+      this->constant_matrix_part = NULL;
+      this->matrix_kept = false;
+      this->constant_forms_into_matrix = true;
+      this->time_dependent_forms_into_matrix = true;
     }
 
     template<typename Scalar>
     DiscreteProblemLinear<Scalar>::DiscreteProblemLinear() : DiscreteProblem<Scalar>()
     {
       this->is_linear = true;
+      this->incremental_reassembly = false;
+      this->constant_matrix = false;
+      this->constant_matrix_target = NULL;
+      this->constant_matrix_part = NULL;
+      this->matrix_kept = false;
+      this->constant_forms_into_matrix = true;
+      this->time_dependent_forms_into_matrix = true;
     }
 
     template<typename Scalar>
     DiscreteProblemLinear<Scalar>::~DiscreteProblemLinear()
     {
+      this->free_constant_matrix();
+    }
+
+    template<typename Scalar>
+    void DiscreteProblemLinear<Scalar>::set_constant_matrix(bool to_set)
+    {
+      this->constant_matrix = to_set;
+      this->free_constant_matrix();
+    }
+
+    template<typename Scalar>
+    void DiscreteProblemLinear<Scalar>::free_constant_matrix()
+    {
+      delete this->constant_matrix_part;
+      this->constant_matrix_part = NULL;
+      this->constant_matrix_target = NULL;
+    }
+
+    template<typename Scalar>
+    bool DiscreteProblemLinear<Scalar>::constant_matrix_to_be_used(SparseMatrix<Scalar>* mat) const
+    {
+      return this->constant_matrix && mat != NULL && !this->static_condensation_to_be_used() && this->wf->mfDG.empty();
     }
 
     template<typename Scalar>
@@ -61,6 +104,92 @@ namespace Hermes
       Vector<Scalar>* rhs,
       bool force_diagonal_blocks,
       Table* block_weights)
+    {
+      this->matrix_kept = false;
+      // The profile of all the traversals of this assembling.
+      this->assembly_profile.reset();
+      if(!this->constant_matrix_to_be_used(mat))
+      {
+        this->free_constant_matrix();
+        this->assemble_traversal(mat, rhs, force_diagonal_blocks, block_weights);
+        return;
+      }
+
+      bool time_dependent_forms_present = false;
+      for(unsigned int i = 0; i < this->wf->mfvol.size() && !time_dependent_forms_present; i++)
+        time_dependent_forms_present = this->wf->mfvol[i]->time_dependent;
+      for(unsigned int i = 0; i < this->wf->mfsurf.size() && !time_dependent_forms_present; i++)
+        time_dependent_forms_present = this->wf->mfsurf[i]->time_dependent;
+
+      // The constant part is (re)assembled if there is none for this matrix, or the spaces have changed.
+      if(this->constant_matrix_target != mat || !this->is_up_to_date() || (time_dependent_forms_present != (this->constant_matrix_part != NULL)))
+      {
+        this->free_constant_matrix();
+        if(!time_dependent_forms_present)
+        {
+          // Everything at once, the matrix is the constant part.
+          this->assemble_traversal(mat, rhs, force_diagonal_blocks, block_weights);
+          this->constant_matrix_target = mat;
+          return;
+        }
+
+        // The constant part alone (no right-hand side), kept as a copy.
+        this->time_dependent_forms_into_matrix = false;
+        try
+        {
+          this->assemble_traversal(mat, NULL, force_diagonal_blocks, block_weights);
+        }
+        catch(...)
+        {
+          this->time_dependent_forms_into_matrix = true;
+          throw;
+        }
+        this->time_dependent_forms_into_matrix = true;
+
+        this->constant_matrix_part = mat->duplicate();
+        if(this->constant_matrix_part == NULL)
+          throw Exceptions::Exception("DiscreteProblemLinear::assemble(): the matrix can not be duplicated for the time-dependent matrix forms with set_constant_matrix().");
+        this->constant_matrix_target = mat;
+      }
+
+      if(!time_dependent_forms_present)
+      {
+        // No matrix at all - the vector forms and the Dirichlet lift of the matrix forms.
+        this->dirichlet_lift_only = true;
+        try
+        {
+          this->assemble_traversal(NULL, rhs, force_diagonal_blocks, block_weights);
+        }
+        catch(...)
+        {
+          this->dirichlet_lift_only = false;
+          throw;
+        }
+        this->dirichlet_lift_only = false;
+        this->matrix_kept = true;
+        return;
+      }
+
+      // The time-dependent matrix forms into the (zeroed) matrix, then the constant part added.
+      this->constant_forms_into_matrix = false;
+      try
+      {
+        this->assemble_traversal(mat, rhs, force_diagonal_blocks, block_weights);
+      }
+      catch(...)
+      {
+        this->constant_forms_into_matrix = true;
+        throw;
+      }
+      this->constant_forms_into_matrix = true;
+      mat->add_sparse_matrix(this->constant_matrix_part);
+    }
+
+    template<typename Scalar>
+    void DiscreteProblemLinear<Scalar>::assemble_traversal(SparseMatrix<Scalar>* mat,
+      Vector<Scalar>* rhs,
+      bool force_diagonal_blocks,
+      Table* block_weights)
     {
       // Check.
       this->check();
@@ -91,11 +220,11 @@ namespace Hermes
       }
 
       // Structures that cloning will be done into.
-      PrecalcShapeset*** pss = new PrecalcShapeset**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      PrecalcShapeset*** spss = new PrecalcShapeset**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      RefMap*** refmaps = new RefMap**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      AsmList<Scalar>*** als = new AsmList<Scalar>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      WeakForm<Scalar>** weakforms = new WeakForm<Scalar>*[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+      PrecalcShapeset*** pss = new PrecalcShapeset**[Hermes2DApi.get_num_threads()];
+      PrecalcShapeset*** spss = new PrecalcShapeset**[Hermes2DApi.get_num_threads()];
+      RefMap*** refmaps = new RefMap**[Hermes2DApi.get_num_threads()];
+      AsmList<Scalar>*** als = new AsmList<Scalar>**[Hermes2DApi.get_num_threads()];
+      WeakForm<Scalar>** weakforms = new WeakForm<Scalar>*[Hermes2DApi.get_num_threads()];
 
       // Fill these structures.
       this->init_assembling(NULL, pss, spss, refmaps, NULL, als, weakforms);
@@ -112,13 +241,19 @@ namespace Hermes
             meshes.push_back(this->wf->get_forms()[form_i]->ext[ext_i]->get_mesh());
 
       Traverse trav_master(true);
-      unsigned int num_states = trav_master.get_num_states(meshes);
-
-      trav_master.begin(meshes.size(), &(meshes.front()));
+      int num_states;
+      Traverse::State** states = NULL;
+      if(this->do_not_store_states)
+      {
+        num_states = trav_master.get_num_states(meshes);
+        trav_master.begin(meshes.size(), &(meshes.front()));
+      }
+      else
+        states = trav_master.get_states(meshes, num_states);
 
-      Traverse* trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      Hermes::vector<Transformable *>* fns = new Hermes::vector<Transformable *>[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      Traverse* trav = new Traverse[Hermes2DApi.get_num_threads()];
+      Hermes::vector<Transformable *>* fns = new Hermes::vector<Transformable *>[Hermes2DApi.get_num_threads()];
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         for (unsigned j = 0; j < this->spaces.size(); j++)
           fns[i].push_back(pss[i][j]);
@@ -137,7 +272,8 @@ namespace Hermes
             }
         }
         trav[i].begin(meshes.size(), &(meshes.front()), &(fns[i].front()));
-        trav[i].stack = trav_master.stack;
+        if(this->do_not_store_states)
+          trav[i].stack = trav_master.stack;
       }
 
       int state_i;
@@ -149,24 +285,114 @@ namespace Hermes
       WeakForm<Scalar>* current_weakform;
 
 #define CHUNKSIZE 1
-      int num_threads_used = Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads);
-#pragma omp parallel shared(trav_master, mat, rhs ) private(state_i, current_pss, current_spss, current_refmaps, current_als, current_weakform) num_threads(num_threads_used)
+      int num_threads_used = Hermes2DApi.get_num_threads();
+
+      bool use_assembly_keys = this->reproducible_assembly && !this->do_not_store_states && this->current_mat != NULL;
+      if(use_assembly_keys)
+        this->current_mat->begin_thread_private_assembly(num_threads_used);
+
+      this->init_arenas(num_threads_used);
+      this->thread_profiles.assign(num_threads_used, AssemblyProfile());
+
+      std::vector<int> ordered_states;
+      std::vector<int> colour_starts;
+      bool conflict_free = this->get_assembly_schedule(states, num_states, ordered_states, colour_starts);
+      std::vector<int> batch_starts;
+      std::vector<int> colour_batch_starts;
+      this->get_state_batches(states, ordered_states, colour_starts, batch_starts, colour_batch_starts);
+      int batch_i;
+
+      // The forms are deferred to the end of the batches only if they are added to the matrix one by one.
+      if(this->state_batching && !this->do_not_store_states && !use_assembly_keys && !this->node_blocked_assembly && !this->is_system_condensed() && !this->form_profiling)
+        this->state_batches.assign(num_threads_used, std::vector<typename DiscreteProblem<Scalar>::BatchedMatrixForm>());
+
+      // DG - the neighbors of all the states up-front.
+      if((this->DG_matrix_forms_present || this->DG_vector_forms_present) && this->DG_interfaces_precalculation && !this->do_not_store_states)
+        this->precalculate_DG_interfaces(states, num_states);
+      if(conflict_free)
       {
-#pragma omp for schedule(static, CHUNKSIZE)
-        for(state_i = 0; state_i < num_states; state_i++)
-        {
-          if(this->caughtException != NULL)
-            continue;
+        if(this->current_mat != NULL)
+          this->current_mat->set_conflict_free_assembly();
+        if(this->current_rhs != NULL)
+          this->current_rhs->set_conflict_free_assembly();
+        for(unsigned int i = 0; i < this->current_load_case_rhs.size(); i++)
+          this->current_load_case_rhs[i]->set_conflict_free_assembly();
+      }
 
-          try
+#pragma omp parallel shared(trav_master, mat, rhs ) private(state_i, batch_i, current_pss, current_spss, current_refmaps, current_als, current_weakform) num_threads(num_threads_used)
+      {
+        // Colour by colour, the barrier at the end of the omp for separates the colours.
+        // A batch (see set_state_batching()) is assembled by one thread.
+        for(unsigned int colour_i = 0; colour_i + 1 < colour_starts.size(); colour_i++)
+        {
+#pragma omp for schedule(dynamic, CHUNKSIZE)
+          for(batch_i = colour_batch_starts[colour_i]; batch_i < colour_batch_starts[colour_i + 1]; batch_i++)
           {
-            Traverse::State current_state;
-
-#pragma omp critical (get_next_state)
+            for(state_i = batch_starts[batch_i]; state_i < batch_starts[batch_i + 1]; state_i++)
             {
+              if(this->caughtException != NULL)
+                continue;
+
               try
               {
-                current_state = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
+                Traverse::State* current_state;
+                Traverse::State current_state_copy;
+                if(this->do_not_store_states)
+                {
+#pragma omp critical (get_next_state)
+                  {
+                    try
+                    {
+                      current_state_copy = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
+                    }
+                    catch(Hermes::Exceptions::Exception& e)
+                    {
+                      if(this->caughtException == NULL)
+                        this->caughtException = e.clone();
+                    }
+                    catch(std::exception& e)
+                    {
+                      if(this->caughtException == NULL)
+                        this->caughtException = new Hermes::Exceptions::Exception(e.what());
+                    }
+                  }
+                  current_state = &current_state_copy;
+                }
+                else
+                {
+                  // The states are stored, each one is claimed by exactly one thread.
+                  current_state = states[ordered_states[state_i]];
+                  trav[omp_get_thread_num()].set_active_state(current_state);
+                  if(use_assembly_keys)
+                    this->current_mat->set_assembly_key(ordered_states[state_i]);
+                }
+                // The stored states are those of the subdomain already (see get_assembly_schedule()).
+                if(this->do_not_store_states && !this->is_in_subdomain(current_state))
+                  continue;
+
+                current_pss = pss[omp_get_thread_num()];
+                current_spss = spss[omp_get_thread_num()];
+                current_refmaps = refmaps[omp_get_thread_num()];
+                current_als = als[omp_get_thread_num()];
+                current_weakform = weakforms[omp_get_thread_num()];
+
+                // One state is a collection of (virtual) elements sharing
+                // the same physical location on (possibly) different meshes.
+                // This is then the same element of the virtual union mesh.
+                // The proper sub-element mappings to all the functions of
+                // this stage is supplied by the function Traverse::get_next_state()
+                // called in the while loop. 
+                this->assemble_one_state(current_pss, current_spss, current_refmaps, NULL, current_als, current_state, current_weakform);
+                this->current_arena()->reset();
+
+                if(this->DG_matrix_forms_present || this->DG_vector_forms_present)
+                  this->assemble_one_DG_state(current_pss, current_spss, current_refmaps, current_als, current_state, current_weakform->mfDG, current_weakform->vfDG, trav[omp_get_thread_num()].fn, current_weakform,
+                    this->thread_npss[omp_get_thread_num()], this->thread_nspss[omp_get_thread_num()], this->thread_nrefmaps[omp_get_thread_num()],
+                    this->DG_interfaces == NULL ? NULL : this->DG_interfaces[ordered_states[state_i]]);
+
+                // The forms deferred by the states of the batch (see set_state_batching()).
+                if(state_i + 1 == batch_starts[batch_i + 1] && !this->state_batches.empty())
+                  this->assemble_state_batch();
               }
               catch(Hermes::Exceptions::Exception& e)
               {
@@ -179,44 +405,41 @@ namespace Hermes
                   this->caughtException = new Hermes::Exceptions::Exception(e.what());
               }
             }
-
-            current_pss = pss[omp_get_thread_num()];
-            current_spss = spss[omp_get_thread_num()];
-            current_refmaps = refmaps[omp_get_thread_num()];
-            current_als = als[omp_get_thread_num()];
-            current_weakform = weakforms[omp_get_thread_num()];
-
-            // One state is a collection of (virtual) elements sharing
-            // the same physical location on (possibly) different meshes.
-            // This is then the same element of the virtual union mesh.
-            // The proper sub-element mappings to all the functions of
-            // this stage is supplied by the function Traverse::get_next_state()
-            // called in the while loop. 
-            this->assemble_one_state(current_pss, current_spss, current_refmaps, NULL, current_als, &current_state, current_weakform);
-
-            if(this->DG_matrix_forms_present || this->DG_vector_forms_present)
-              this->assemble_one_DG_state(current_pss, current_spss, current_refmaps, current_als, &current_state, current_weakform->mfDG, current_weakform->vfDG, trav[omp_get_thread_num()].fn, current_weakform);
-          }
-          catch(Hermes::Exceptions::Exception& e)
-          {
-            if(this->caughtException == NULL)
-              this->caughtException = e.clone();
-          }
-          catch(std::exception& e)
-          {
-            if(this->caughtException == NULL)
-              this->caughtException = new Hermes::Exceptions::Exception(e.what());
           }
         }
       }
 
+      this->free_DG_interfaces();
+      this->state_batches.clear();
+
+      // The profiles of the threads summed, current_profile() is NULL from now on.
+      AssemblyProfile traversal_profile;
+      for(unsigned int i = 0; i < this->thread_profiles.size(); i++)
+        traversal_profile.add(this->thread_profiles[i]);
+      this->thread_profiles.clear();
+      this->assembly_profile.add(traversal_profile);
+      this->accumulated_assembly_profile.add(traversal_profile);
+
+      if(conflict_free)
+      {
+        if(this->current_mat != NULL)
+          this->current_mat->set_conflict_free_assembly(false);
+        if(this->current_rhs != NULL)
+          this->current_rhs->set_conflict_free_assembly(false);
+        for(unsigned int i = 0; i < this->current_load_case_rhs.size(); i++)
+          this->current_load_case_rhs[i]->set_conflict_free_assembly(false);
+      }
+
       this->deinit_assembling(pss, spss, refmaps, NULL, als, weakforms);
 
-      trav_master.finish();
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      if(this->do_not_store_states)
+        trav_master.finish();
+      else
+        Traverse::free_states(states, num_states);
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         trav[i].finish();
 
-      for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+      for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
       {
         fns[i].clear();
       }
@@ -228,6 +451,8 @@ namespace Hermes
         this->current_mat->finish();
       if(this->current_rhs != NULL)
         this->current_rhs->finish();
+      for(unsigned int i = 0; i < this->current_load_case_rhs.size(); i++)
+        this->current_load_case_rhs[i]->finish();
 
       if(this->DG_matrix_forms_present || this->DG_vector_forms_present)
       {
@@ -241,33 +466,148 @@ namespace Hermes
         throw *(this->caughtException);
     }
 
+    template<typename Scalar>
+    void DiscreteProblemLinear<Scalar>::assemble(SparseMatrix<Scalar>* mat, Hermes::vector<Vector<Scalar>*> rhs_vectors)
+    {
+      if(rhs_vectors.empty())
+        throw Exceptions::LengthException(2, 0, 1);
+      if(this->static_condensation_to_be_used())
+        throw Exceptions::Exception("DiscreteProblemLinear::assemble(): several right-hand sides are not available with the static condensation.");
+
+      // rhs_vectors[0] is the usual current_rhs, allocated with the sparse structure.
+      this->current_load_case_rhs.clear();
+      for(unsigned int i = 1; i < rhs_vectors.size(); i++)
+      {
+        if(rhs_vectors[i]->length() != this->ndof)
+          rhs_vectors[i]->alloc(this->ndof);
+        else
+          rhs_vectors[i]->zero();
+        this->current_load_case_rhs.push_back(rhs_vectors[i]);
+      }
+
+      try
+      {
+        this->assemble(mat, rhs_vectors[0]);
+      }
+      catch(...)
+      {
+        this->current_load_case_rhs.clear();
+        throw;
+      }
+      this->current_load_case_rhs.clear();
+    }
+
     template<typename Scalar>
     void DiscreteProblemLinear<Scalar>::assemble_matrix_form(MatrixForm<Scalar>* form, int order, Func<double>** base_fns, Func<double>** test_fns, Func<Scalar>** ext, Func<Scalar>** u_ext,
-      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights)
+      AsmList<Scalar>* current_als_i, AsmList<Scalar>* current_als_j, Traverse::State* current_state, int n_quadrature_points, Geom<double>* geometry, double* jacobian_x_weights,
+      RefMap* current_refmap, typename DiscreteProblem<Scalar>::CacheRecordPerSubIdx* record_i)
     {
       bool surface_form = (dynamic_cast<MatrixFormVol<Scalar>*>(form) == NULL);
+      this->set_thread_assembly_target(form);
+
+      // Into the matrix, or only the Dirichlet lift into the right-hand side (see set_constant_matrix()).
+      bool into_matrix = (this->current_mat != NULL || this->current_apply_x != NULL) && (form->time_dependent ? this->time_dependent_forms_into_matrix : this->constant_forms_into_matrix);
+      if(!into_matrix && this->current_rhs == NULL)
+        return;
+      FormProfile::Evaluation form_evaluation(this->current_form_profile(form), order, n_quadrature_points);
 
       double block_scaling_coefficient = this->block_scaling_coeff(form);
 
       bool tra = (form->i != form->j) && (form->sym != 0);
       bool sym = (form->i == form->j) && (form->sym == 1);
+      // Lift only - the pairs of two free DOFs are not needed (the transposed block needs them for its lift).
+      bool lift_only = !into_matrix && !tra;
+
+      // Deferred to the end of the batch of states (see set_state_batching()) - if there is no Dirichlet lift.
+      if(!surface_form && into_matrix && !this->incremental_reassembly && !this->state_batches.empty())
+      {
+        bool lift = false;
+        for (unsigned int j = 0; j < current_als_j->cnt; j++)
+          lift = lift || current_als_j->dof[j] < 0;
+        for (unsigned int i = 0; tra && i < current_als_i->cnt; i++)
+          lift = lift || current_als_i->dof[i] < 0;
+        if(!lift && this->batch_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap))
+          return;
+      }
+
+      // Temporaries, released with the arena after the state.
+      Arena* arena = this->current_arena();
 
       // Assemble the local stiffness matrix for the form form.
-      Scalar **local_stiffness_matrix = new_matrix<Scalar>(std::max(current_als_i->cnt, current_als_j->cnt));
+      Scalar **local_stiffness_matrix = arena->allocate_matrix<Scalar>(std::max(current_als_i->cnt, current_als_j->cnt));
 
       Func<Scalar>** local_ext = ext;
       // If the user supplied custom ext functions for this form.
       if(form->ext.size() > 0)
       {
         int local_ext_count = form->ext.size();
-        local_ext = new Func<Scalar>*[local_ext_count];
+        local_ext = arena->allocate_array<Func<Scalar>*>(local_ext_count);
         for(int ext_i = 0; ext_i < local_ext_count; ext_i++)
           if(form->ext[ext_i] != NULL)
-            local_ext[ext_i] = current_state->e[ext_i] == NULL ? NULL : init_fn(form->ext[ext_i], order);
+            local_ext[ext_i] = current_state->e[ext_i] == NULL ? NULL : init_fn(form->ext[ext_i], order, arena);
           else
             local_ext[ext_i] = NULL;
       }
 
+      // Incremental reassembly - the raw values kept from the previous assembly, or evaluated (all pairs) and kept now.
+      Scalar* kept_values = NULL;
+      bool keep_values = false;
+      if(!surface_form && this->incremental_reassembly && record_i != NULL && form->position >= 0)
+      {
+        kept_values = this->find_matrix_form_values(record_i, form->position, current_als_i, current_als_j);
+        keep_values = (kept_values == NULL);
+      }
+
+      // The local matrix of a congruent element evaluated already, or evaluated (all pairs) and kept now.
+      std::vector<int> congruence_key;
+      bool keep_congruent_values = false;
+      if(!surface_form && kept_values == NULL && this->get_congruence_key(form, order, current_als_i, current_als_j, current_state, current_refmap, congruence_key))
+      {
+        Scalar* congruent_values = this->find_congruent_matrix_form_values(form, congruence_key);
+        keep_congruent_values = (congruent_values == NULL);
+        if(congruent_values != NULL && keep_values)
+        {
+          // The record takes the ownership of its values.
+          kept_values = new Scalar[current_als_i->cnt * current_als_j->cnt];
+          memcpy(kept_values, congruent_values, current_als_i->cnt * current_als_j->cnt * sizeof(Scalar));
+          this->store_matrix_form_values(record_i, form->position, current_als_i, current_als_j, kept_values);
+          keep_values = false;
+        }
+        else
+          kept_values = congruent_values;
+      }
+
+      // Values of the form from the reference element matrices or by sum factorization if possible, otherwise pair by pair below.
+      Scalar **tensor_product_matrix = NULL;
+      if(!surface_form && kept_values == NULL && !lift_only)
+      {
+        tensor_product_matrix = arena->allocate_matrix<Scalar>(std::max(current_als_i->cnt, current_als_j->cnt));
+        if(!this->assemble_matrix_form_reference(form, current_als_i, current_als_j, current_state, current_refmap, tensor_product_matrix)
+          && !this->assemble_matrix_form_tensor_product(form, order, local_ext, u_ext, current_als_i, current_als_j, current_state, n_quadrature_points, geometry, jacobian_x_weights, current_refmap, tensor_product_matrix))
+          tensor_product_matrix = NULL;
+      }
+
+      if(keep_values || keep_congruent_values)
+      {
+        kept_values = keep_values ? new Scalar[current_als_i->cnt * current_als_j->cnt] : arena->allocate_array<Scalar>(current_als_i->cnt * current_als_j->cnt);
+        for (unsigned int i = 0; i < current_als_i->cnt; i++)
+        {
+          for (unsigned int j = 0; j < current_als_j->cnt; j++)
+          {
+            if(sym && j < i)
+              kept_values[i * current_als_j->cnt + j] = kept_values[j * current_als_j->cnt + i];
+            else if(tensor_product_matrix != NULL)
+              kept_values[i * current_als_j->cnt + j] = tensor_product_matrix[i][j];
+            else
+              kept_values[i * current_als_j->cnt + j] = form->value(n_quadrature_points, jacobian_x_weights, u_ext, base_fns[j], test_fns[i], geometry, local_ext);
+          }
+        }
+        if(keep_congruent_values)
+          this->store_congruent_matrix_form_values(form, congruence_key, current_als_i->cnt, current_als_j->cnt, kept_values);
+        if(keep_values)
+          this->store_matrix_form_values(record_i, form->position, current_als_i, current_als_j, kept_values);
+      }
+
       // Actual form-specific calculation.
       for (unsigned int i = 0; i < current_als_i->cnt; i++)
       {
@@ -285,24 +625,27 @@ namespace Hermes
             // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
             if(std::abs(current_als_j->coef[j]) < 1e-12)
               continue;
+            if(lift_only && current_als_j->dof[j] >= 0)
+              continue;
 
             Func<double>* u = base_fns[j];
             Func<double>* v = test_fns[i];
+            Scalar form_value = kept_values != NULL ? kept_values[i * current_als_j->cnt + j] : (tensor_product_matrix != NULL ? tensor_product_matrix[i][j] : form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext));
 
             if(current_als_j->dof[j] >= 0)
             {
               if(surface_form)
-                local_stiffness_matrix[i][j] = 0.5 * block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
+                local_stiffness_matrix[i][j] = 0.5 * block_scaling_coefficient * form_value * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
               else
-                local_stiffness_matrix[i][j] = block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
+                local_stiffness_matrix[i][j] = block_scaling_coefficient * form_value * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
             }
-            else
+            else if(this->current_rhs != NULL)
             {
               {
                 if(surface_form)
-                  this->current_rhs->add(current_als_i->dof[i], -0.5 * block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i]);
+                  this->add_local_vector(current_als_i->dof[i], -0.5 * block_scaling_coefficient * form_value * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i]);
                 else
-                  this->current_rhs->add(current_als_i->dof[i], -block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i]);
+                  this->add_local_vector(current_als_i->dof[i], -block_scaling_coefficient * form_value * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i]);
               }
             }
           }
@@ -317,24 +660,32 @@ namespace Hermes
             // Is this necessary, i.e. is there a coefficient smaller than 1e-12?
             if(std::abs(current_als_j->coef[j]) < 1e-12)
               continue;
+            if(lift_only && current_als_j->dof[j] >= 0)
+              continue;
 
             Func<double>* u = base_fns[j];
             Func<double>* v = test_fns[i];
+            Scalar form_value = kept_values != NULL ? kept_values[i * current_als_j->cnt + j] : (tensor_product_matrix != NULL ? tensor_product_matrix[i][j] : form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext));
 
-            Scalar val = block_scaling_coefficient * form->value(n_quadrature_points, jacobian_x_weights, u_ext, u, v, geometry, local_ext) * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
+            Scalar val = block_scaling_coefficient * form_value * form->scaling_factor * current_als_j->coef[j] * current_als_i->coef[i];
 
             if(current_als_j->dof[j] >= 0)
               local_stiffness_matrix[i][j] = local_stiffness_matrix[j][i] = val;
-            else
+            else if(this->current_rhs != NULL)
             {
-              this->current_rhs->add(current_als_i->dof[i], -val);
+              this->add_local_vector(current_als_i->dof[i], -val);
             }
           }
         }
       }
 
       // Insert the local stiffness matrix into the global one.
-      this->current_mat->add(current_als_i->cnt, current_als_j->cnt, local_stiffness_matrix, current_als_i->dof, current_als_j->dof);
+      // Precalculated positions are only available for volumetric forms (surface forms use the boundary assembly lists).
+      if(into_matrix)
+      {
+        int* scatter_positions = surface_form ? NULL : this->get_scatter_positions(form->i, form->j, current_state);
+        this->add_local_matrix(current_als_i->cnt, current_als_j->cnt, local_stiffness_matrix, current_als_i->dof, current_als_j->dof, scatter_positions);
+      }
 
       // Insert also the off-diagonal (anti-)symmetric block, if required.
       if(tra)
@@ -343,29 +694,20 @@ namespace Hermes
           chsgn(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
         transpose(local_stiffness_matrix, current_als_i->cnt, current_als_j->cnt);
 
-        this->current_mat->add(current_als_j->cnt, current_als_i->cnt, local_stiffness_matrix, current_als_j->dof, current_als_i->dof);
-
-        // Linear problems only: Subtracting Dirichlet lift contribution from the RHS:
-        for (unsigned int j = 0; j < current_als_i->cnt; j++)
-          if(current_als_i->dof[j] < 0)
-            for (unsigned int i = 0; i < current_als_j->cnt; i++)
-              if(current_als_j->dof[i] >= 0)
-                this->current_rhs->add(current_als_j->dof[i], -local_stiffness_matrix[i][j]);
-      }
+        if(into_matrix)
+        {
+          int* scatter_positions = surface_form ? NULL : this->get_scatter_positions(form->j, form->i, current_state);
+          this->add_local_matrix(current_als_j->cnt, current_als_i->cnt, local_stiffness_matrix, current_als_j->dof, current_als_i->dof, scatter_positions);
+        }
 
-      if(form->ext.size() > 0)
-      {
-        for(int ext_i = 0; ext_i < form->ext.size(); ext_i++)
-          if(form->ext[ext_i] != NULL)
-          {
-            local_ext[ext_i]->free_fn();
-            delete local_ext[ext_i];
-          }
-          delete [] local_ext;
+        // Linear problems only: Subtracting Dirichlet lift contribution from the RHS (not in the matrix-free application):
+        if(this->current_rhs != NULL)
+          for (unsigned int j = 0; j < current_als_i->cnt; j++)
+            if(current_als_i->dof[j] < 0)
+              for (unsigned int i = 0; i < current_als_j->cnt; i++)
+                if(current_als_j->dof[i] >= 0)
+                  this->add_local_vector(current_als_j->dof[i], -local_stiffness_matrix[i][j]);
       }
-
-      // Cleanup.
-      delete [] local_stiffness_matrix;
     }
 
     template class HERMES_API DiscreteProblemLinear<double>;
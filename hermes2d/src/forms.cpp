@@ -18,6 +18,7 @@
 #include "forms.h"
 #include "api2d.h"
 #include <complex>
+#include <new>
 
 namespace Hermes
 {
@@ -30,6 +31,8 @@ namespace Hermes
       dx = NULL;
       dy = NULL;
       laplace = NULL;
+      block = NULL;
+      in_block = false;
 
       if(this->nc > 1)
       {
@@ -148,9 +151,76 @@ namespace Hermes
       laplace = NULL;
     }
 
+    template<typename T>
+    int Func<T>::get_block_stride(int num_gip)
+    {
+      const int per_line = H2D_FUNC_ALIGNMENT / sizeof(T) > 0 ? H2D_FUNC_ALIGNMENT / sizeof(T) : 1;
+      return (num_gip + per_line - 1) / per_line * per_line;
+    }
+
+    template<typename T>
+    int Func<T>::get_block_array_count(SpaceType space_type)
+    {
+      switch(space_type)
+      {
+      case HERMES_H1_SPACE:
+      case HERMES_L2_SPACE:
+#ifdef H2D_USE_SECOND_DERIVATIVES
+        return 4;
+#else
+        return 3;
+#endif
+      case HERMES_HCURL_SPACE:
+      case HERMES_HDIV_SPACE:
+        return 3;
+      default:
+        throw Hermes::Exceptions::Exception("Wrong space type - space has to be either H1, Hcurl, Hdiv or L2");
+      }
+      return 0;
+    }
+
+    template<typename T>
+    void Func<T>::set_block_arrays(T* data, SpaceType space_type)
+    {
+      int stride = get_block_stride(this->num_gip);
+      if(space_type == HERMES_H1_SPACE || space_type == HERMES_L2_SPACE)
+      {
+        this->val = data;
+        this->dx = data + stride;
+        this->dy = data + 2 * stride;
+#ifdef H2D_USE_SECOND_DERIVATIVES
+        this->laplace = data + 3 * stride;
+#endif
+      }
+      else
+      {
+        this->val0 = data;
+        this->val1 = data + stride;
+        if(space_type == HERMES_HCURL_SPACE)
+          this->curl = data + 2 * stride;
+        else
+          this->div = data + 2 * stride;
+      }
+      this->in_block = true;
+    }
+
     template<typename T>
     void Func<T>::free_fn()
     {
+      if(this->in_block)
+      {
+        delete [] this->block;
+        this->block = NULL;
+        this->in_block = false;
+        val = dx = dy = laplace = NULL;
+        if(this->nc > 1)
+        {
+          val0 = val1 = NULL;
+          curl = div = NULL;
+        }
+        return;
+      }
+
       delete [] val; val = NULL;
       delete [] dx; dx = NULL;
       delete [] dy; dy = NULL;
@@ -397,13 +467,7 @@ namespace Hermes
       int np = quad->get_num_points(order, rm->get_active_element()->get_mode());
       e->x = new double[np];
       e->y = new double[np];
-      double* x = rm->get_phys_x(order);
-      double* y = rm->get_phys_y(order);
-      for (int i = 0; i < np; i++)
-      {
-        e->x[i] = x[i];
-        e->y[i] = y[i];
-      }
+      rm->get_phys_coordinates(order, e->x, e->y);
       return e;
     }
 
@@ -418,21 +482,18 @@ namespace Hermes
       e->isurf = isurf;
       
       tan = rm->get_tangent(isurf, order);
-      double* x = rm->get_phys_x(order);
-      double* y = rm->get_phys_y(order);
       
       Quad2D* quad = rm->get_quad_2d();
       int np = quad->get_num_points(order, rm->get_active_element()->get_mode());
       e->x = new double[np];
       e->y = new double[np];
+      rm->get_phys_coordinates(order, e->x, e->y);
       e->tx = new double[np];
       e->ty = new double[np];
       e->nx = new double[np];
       e->ny = new double[np];
       for (int i = 0; i < np; i++)
       {
-        e->x[i] = x[i];
-        e->y[i] = y[i];
         e->tx[i] = tan[i][0];  e->ty[i] =   tan[i][1];
         e->nx[i] = tan[i][1];  e->ny[i] = - tan[i][0];
       }
@@ -440,6 +501,29 @@ namespace Hermes
       return e;
     }
 
+    Geom<double>* copy_geom(const Geom<double>* geom, int np)
+    {
+      Geom<double>* e = new Geom<double>;
+      e->edge_marker = geom->edge_marker;
+      e->elem_marker = geom->elem_marker;
+      e->diam = geom->diam;
+      e->area = geom->area;
+      e->id = geom->id;
+      e->isurf = geom->isurf;
+      e->orientation = geom->orientation;
+
+      double* const from[6] = { geom->x, geom->y, geom->tx, geom->ty, geom->nx, geom->ny };
+      double** to[6] = { &e->x, &e->y, &e->tx, &e->ty, &e->nx, &e->ny };
+      for (int i = 0; i < 6; i++)
+      {
+        if(from[i] == NULL)
+          continue;
+        *to[i] = new double[np];
+        memcpy(*to[i], from[i], np * sizeof(double));
+      }
+      return e;
+    }
+
     Func<Hermes::Ord>* init_fn_ord(const int order)
     {
       Hermes::Ord *d = new Hermes::Ord(order);
@@ -460,11 +544,13 @@ namespace Hermes
       return f;
     }
 
-    Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order)
+    // The values of the active shape function of fu into the arrays of u.
+    // On affine elements (RefMap::is_jacobian_const()) the inverse reference map, and with it the covariant (Hcurl) and
+    // contravariant (Hdiv) Piola transforms and the curl / div factor, are the same in all the points, they are taken
+    // once per element instead of per point.
+    void calc_fn(PrecalcShapeset *fu, RefMap *rm, const int order, Func<double>* u)
     {
-      int nc = fu->get_num_components();
       SpaceType space_type = fu->get_space_type();
-      Quad2D* quad = fu->get_quad_2d();
 
 #ifdef H2D_USE_SECOND_DERIVATIVES
       if(space_type == HERMES_H1_SPACE || space_type == HERMES_L2_SPACE)
@@ -475,178 +561,166 @@ namespace Hermes
         fu->set_quad_order(order);
 #endif
 
-      double3* pt = quad->get_points(order, rm->get_active_element()->get_mode());
-      int np = quad->get_num_points(order, rm->get_active_element()->get_mode());
-      Func<double>* u = new Func<double>(np, nc);
+      int np = u->get_num_gip();
+      bool jacobian_const = rm->is_jacobian_const();
+      double2x2 const_m;
+      double2x2 *m = NULL;
+      if(jacobian_const)
+      {
+        double2x2* const_inv_ref_map = rm->get_const_inv_ref_map();
+        const_m[0][0] = (*const_inv_ref_map)[0][0];
+        const_m[0][1] = (*const_inv_ref_map)[0][1];
+        const_m[1][0] = (*const_inv_ref_map)[1][0];
+        const_m[1][1] = (*const_inv_ref_map)[1][1];
+      }
+      else
+        m = rm->get_inv_ref_map(order);
 
       // H1 & L2 space.
       if(space_type == HERMES_H1_SPACE || space_type == HERMES_L2_SPACE)
       {
-        u->val = new double[np];
-        u->dx  = new double[np];
-        u->dy  = new double[np];
-
-#ifdef H2D_USE_SECOND_DERIVATIVES
-        u->laplace = new double[np];
-#endif
-
         double *fn = fu->get_fn_values();
         double *dx = fu->get_dx_values();
         double *dy = fu->get_dy_values();
 
-        double *dxx;
-        double *dxy;
-        double *dyy;
-
 #ifdef H2D_USE_SECOND_DERIVATIVES
-        dxx = fu->get_dxx_values();
-        dxy = fu->get_dxy_values();
-        dyy = fu->get_dyy_values();
-#endif
-
-        double2x2 *m;
-        if(rm->is_jacobian_const())
-        {
-          m = new double2x2[np];
-          double2x2 const_inv_ref_map;
-
-          const_inv_ref_map[0][0] = rm->get_const_inv_ref_map()[0][0][0];
-          const_inv_ref_map[0][1] = rm->get_const_inv_ref_map()[0][0][1];
-          const_inv_ref_map[1][0] = rm->get_const_inv_ref_map()[0][1][0];
-          const_inv_ref_map[1][1] = rm->get_const_inv_ref_map()[0][1][1];
-
-          for(int i = 0; i < np; i++)
-          {
-            m[i][0][0] = const_inv_ref_map[0][0];
-            m[i][0][1] = const_inv_ref_map[0][1];
-            m[i][1][0] = const_inv_ref_map[1][0];
-            m[i][1][1] = const_inv_ref_map[1][1];
-          }
-        }
-        else
-          m = rm->get_inv_ref_map(order);
-
-#ifdef H2D_USE_SECOND_DERIVATIVES
-        double3x2 *mm;
-        mm = rm->get_second_ref_map(order);
-        for (int i = 0; i < np; i++, m++, mm++)
+        double *dxx = fu->get_dxx_values();
+        double *dxy = fu->get_dxy_values();
+        double *dyy = fu->get_dyy_values();
+        double3x2 *mm = rm->get_second_ref_map(order);
+        for (int i = 0; i < np; i++, mm++)
         {
+          const double2x2& mi = jacobian_const ? const_m : m[i];
           u->val[i] = fn[i];
-          u->dx[i] = (dx[i] * (*m)[0][0] + dy[i] * (*m)[0][1]);
-          u->dy[i] = (dx[i] * (*m)[1][0] + dy[i] * (*m)[1][1]);
-      
-          double axx = (Hermes::sqr((*m)[0][0]) + Hermes::sqr((*m)[1][0]));
-          double ayy = (Hermes::sqr((*m)[0][1]) + Hermes::sqr((*m)[1][1]));
-          double axy = 2.0 * ((*m)[0][0]*(*m)[0][1] + (*m)[1][0]*(*m)[1][1]);
+          u->dx[i] = (dx[i] * mi[0][0] + dy[i] * mi[0][1]);
+          u->dy[i] = (dx[i] * mi[1][0] + dy[i] * mi[1][1]);
+
+          double axx = (Hermes::sqr(mi[0][0]) + Hermes::sqr(mi[1][0]));
+          double ayy = (Hermes::sqr(mi[0][1]) + Hermes::sqr(mi[1][1]));
+          double axy = 2.0 * (mi[0][0]*mi[0][1] + mi[1][0]*mi[1][1]);
           double ax = (*mm)[0][0] + (*mm)[2][0];
           double ay = (*mm)[0][1] + (*mm)[2][1];
           u->laplace[i] = ( dx[i] * ax + dy[i] * ay + dxx[i] * axx + dxy[i] * axy + dyy[i] * ayy );
         }
 #else
-        for (int i = 0; i < np; i++, m++)
+        memcpy(u->val, fn, np * sizeof(double));
+        if(jacobian_const)
         {
-          u->val[i] = fn[i];
-          u->dx[i] = (dx[i] * (*m)[0][0] + dy[i] * (*m)[0][1]);
-          u->dy[i] = (dx[i] * (*m)[1][0] + dy[i] * (*m)[1][1]);
+          double m00 = const_m[0][0], m01 = const_m[0][1], m10 = const_m[1][0], m11 = const_m[1][1];
+          for (int i = 0; i < np; i++)
+          {
+            u->dx[i] = dx[i] * m00 + dy[i] * m01;
+            u->dy[i] = dx[i] * m10 + dy[i] * m11;
+          }
         }
+        else
+          for (int i = 0; i < np; i++, m++)
+          {
+            u->dx[i] = (dx[i] * (*m)[0][0] + dy[i] * (*m)[0][1]);
+            u->dy[i] = (dx[i] * (*m)[1][0] + dy[i] * (*m)[1][1]);
+          }
 #endif
-        
-        m -= np;
-        if(rm->is_jacobian_const())
-          delete [] m;
       }
       // Hcurl space.
       else if(space_type == HERMES_HCURL_SPACE)
       {
-        u->val0 = new double[np];
-        u->val1 = new double[np];
-        u->curl = new double[np];
-
         double *fn0 = fu->get_fn_values(0);
         double *fn1 = fu->get_fn_values(1);
         double *dx1 = fu->get_dx_values(1);
         double *dy0 = fu->get_dy_values(0);
-        double2x2 *m;
-        if(rm->is_jacobian_const())
+        if(jacobian_const)
         {
-          m = new double2x2[np];
-          double2x2 const_inv_ref_map;
-
-          const_inv_ref_map[0][0] = rm->get_const_inv_ref_map()[0][0][0];
-          const_inv_ref_map[0][1] = rm->get_const_inv_ref_map()[0][0][1];
-          const_inv_ref_map[1][0] = rm->get_const_inv_ref_map()[0][1][0];
-          const_inv_ref_map[1][1] = rm->get_const_inv_ref_map()[0][1][1];
-
-          for(int i = 0; i < np; i++)
+          double m00 = const_m[0][0], m01 = const_m[0][1], m10 = const_m[1][0], m11 = const_m[1][1];
+          double det = m00 * m11 - m10 * m01;
+          for (int i = 0; i < np; i++)
           {
-            m[i][0][0] = const_inv_ref_map[0][0];
-            m[i][0][1] = const_inv_ref_map[0][1];
-            m[i][1][0] = const_inv_ref_map[1][0];
-            m[i][1][1] = const_inv_ref_map[1][1];
+            u->val0[i] = fn0[i] * m00 + fn1[i] * m01;
+            u->val1[i] = fn0[i] * m10 + fn1[i] * m11;
+            u->curl[i] = det * (dx1[i] - dy0[i]);
           }
         }
         else
-          m = rm->get_inv_ref_map(order);
-        for (int i = 0; i < np; i++, m++)
-        {
-          u->val0[i] = (fn0[i] * (*m)[0][0] + fn1[i] * (*m)[0][1]);
-          u->val1[i] = (fn0[i] * (*m)[1][0] + fn1[i] * (*m)[1][1]);
-          u->curl[i] = ((*m)[0][0] * (*m)[1][1] - (*m)[1][0] * (*m)[0][1]) * (dx1[i] - dy0[i]);
-        }
-
-        m -= np;
-        if(rm->is_jacobian_const())
-          delete [] m;
+          for (int i = 0; i < np; i++, m++)
+          {
+            u->val0[i] = (fn0[i] * (*m)[0][0] + fn1[i] * (*m)[0][1]);
+            u->val1[i] = (fn0[i] * (*m)[1][0] + fn1[i] * (*m)[1][1]);
+            u->curl[i] = ((*m)[0][0] * (*m)[1][1] - (*m)[1][0] * (*m)[0][1]) * (dx1[i] - dy0[i]);
+          }
       }
       // Hdiv space.
       else if(space_type == HERMES_HDIV_SPACE)
       {
-        u->val0 = new double[np];
-        u->val1 = new double[np];
-
         double *fn0 = fu->get_fn_values(0);
         double *fn1 = fu->get_fn_values(1);
         double *dx0 = fu->get_dx_values(0);
         double *dy1 = fu->get_dy_values(1);
-        double2x2 *m;
-        if(rm->is_jacobian_const())
+        if(jacobian_const)
         {
-          m = new double2x2[np];
-          double2x2 const_inv_ref_map;
-
-          const_inv_ref_map[0][0] = rm->get_const_inv_ref_map()[0][0][0];
-          const_inv_ref_map[0][1] = rm->get_const_inv_ref_map()[0][0][1];
-          const_inv_ref_map[1][0] = rm->get_const_inv_ref_map()[0][1][0];
-          const_inv_ref_map[1][1] = rm->get_const_inv_ref_map()[0][1][1];
-
-          for(int i = 0; i < np; i++)
+          double m00 = const_m[0][0], m01 = const_m[0][1], m10 = const_m[1][0], m11 = const_m[1][1];
+          double det = m00 * m11 - m10 * m01;
+          for (int i = 0; i < np; i++)
           {
-            m[i][0][0] = const_inv_ref_map[0][0];
-            m[i][0][1] = const_inv_ref_map[0][1];
-            m[i][1][0] = const_inv_ref_map[1][0];
-            m[i][1][1] = const_inv_ref_map[1][1];
+            u->val0[i] = fn0[i] * m11 - fn1[i] * m10;
+            u->val1[i] = - fn0[i] * m01 + fn1[i] * m00;
+            u->div[i] = det * (dx0[i] + dy1[i]);
           }
         }
         else
-          m = rm->get_inv_ref_map(order);
-        for (int i = 0; i < np; i++, m++)
-        {
-          u->val0[i] = (  fn0[i] * (*m)[1][1] - fn1[i] * (*m)[1][0]);
-          u->val1[i] = (- fn0[i] * (*m)[0][1] + fn1[i] * (*m)[0][0]);
-          u->div[i] = ((*m)[0][0] * (*m)[1][1] - (*m)[1][0] * (*m)[0][1]) * (dx0[i] + dy1[i]);
-        }
-        m -= np;
-        if(rm->is_jacobian_const())
-          delete [] m;
+          for (int i = 0; i < np; i++, m++)
+          {
+            u->val0[i] = (  fn0[i] * (*m)[1][1] - fn1[i] * (*m)[1][0]);
+            u->val1[i] = (- fn0[i] * (*m)[0][1] + fn1[i] * (*m)[0][0]);
+            u->div[i] = ((*m)[0][0] * (*m)[1][1] - (*m)[1][0] * (*m)[0][1]) * (dx0[i] + dy1[i]);
+          }
       }
       else
         throw Hermes::Exceptions::Exception("Wrong space type - space has to be either H1, Hcurl, Hdiv or L2");
+    }
 
+    Func<double>* init_fn(PrecalcShapeset *fu, RefMap *rm, const int order)
+    {
+      Func<double>* u;
+      init_fns(fu, rm, order, 1, NULL, &u);
       return u;
     }
 
+    void init_fns(PrecalcShapeset *fu, RefMap *rm, const int order, unsigned int n, const int* idx, Func<double>** fns)
+    {
+      if(n == 0)
+        return;
+
+      int nc = fu->get_num_components();
+      SpaceType space_type = fu->get_space_type();
+      int np = fu->get_quad_2d()->get_num_points(order, rm->get_active_element()->get_mode());
+      int stride = Func<double>::get_block_stride(np);
+      int count = Func<double>::get_block_array_count(space_type);
+
+      // One allocation for all the functions, the arrays aligned.
+      char* block = new char[(size_t)n * count * stride * sizeof(double) + H2D_FUNC_ALIGNMENT];
+      double* data = (double*)(block + (H2D_FUNC_ALIGNMENT - (size_t)block % H2D_FUNC_ALIGNMENT) % H2D_FUNC_ALIGNMENT);
+
+      for (unsigned int j = 0; j < n; j++, data += count * stride)
+      {
+        fns[j] = new Func<double>(np, nc);
+        fns[j]->set_block_arrays(data, space_type);
+        for (int k = 0; k < count; k++)
+          memset(data + k * stride + np, 0, (stride - np) * sizeof(double));
+        if(idx != NULL)
+          fu->set_active_shape(idx[j]);
+        calc_fn(fu, rm, order, fns[j]);
+      }
+      fns[0]->block = block;
+    }
+
+    // Values of a function in the integration points, from the heap if arena == NULL.
     template<typename Scalar>
-    Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order)
+    static Scalar* new_fn_values(int np, Arena* arena)
+    {
+      return arena == NULL ? new Scalar[np] : arena->allocate_array<Scalar>(np);
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order, Arena* arena)
     {
       // Sanity checks.
       if(fu == NULL) throw Hermes::Exceptions::Exception("NULL MeshFunction in Func<Scalar>*::init_fn().");
@@ -657,23 +731,23 @@ namespace Hermes
       fu->set_quad_order(order);
       double3* pt = quad->get_points(order, fu->get_active_element()->get_mode());
       int np = quad->get_num_points(order, fu->get_active_element()->get_mode());
-      Func<Scalar>* u = new Func<Scalar>(np, nc);
+      Func<Scalar>* u = arena == NULL ? new Func<Scalar>(np, nc) : new (arena->allocate(sizeof(Func<Scalar>))) Func<Scalar>(np, nc);
 
       if(u->nc == 1)
       {
-        u->val = new Scalar[np];
-        u->dx  = new Scalar[np];
-        u->dy  = new Scalar[np];
+        u->val = new_fn_values<Scalar>(np, arena);
+        u->dx  = new_fn_values<Scalar>(np, arena);
+        u->dy  = new_fn_values<Scalar>(np, arena);
         memcpy(u->val, fu->get_fn_values(), np * sizeof(Scalar));
         memcpy(u->dx, fu->get_dx_values(), np * sizeof(Scalar));
         memcpy(u->dy, fu->get_dy_values(), np * sizeof(Scalar));
       }
       else if(u->nc == 2)
       {
-        u->val0 = new Scalar[np];
-        u->val1 = new Scalar[np];
-        u->curl = new Scalar[np];
-        u->div = new Scalar[np];
+        u->val0 = new_fn_values<Scalar>(np, arena);
+        u->val1 = new_fn_values<Scalar>(np, arena);
+        u->curl = new_fn_values<Scalar>(np, arena);
+        u->div = new_fn_values<Scalar>(np, arena);
 
         memcpy(u->val0, fu->get_fn_values(0), np * sizeof(Scalar));
         memcpy(u->val1, fu->get_fn_values(1), np * sizeof(Scalar));
@@ -690,7 +764,7 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order)
+    Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order, Arena* arena)
     {
       // Sanity checks.
       if(fu == NULL) throw Hermes::Exceptions::Exception("NULL MeshFunction in Func<Scalar>*::init_fn().");
@@ -711,17 +785,17 @@ namespace Hermes
 #endif
       double3* pt = quad->get_points(order, fu->get_active_element()->get_mode());
       int np = quad->get_num_points(order, fu->get_active_element()->get_mode());
-      Func<Scalar>* u = new Func<Scalar>(np, nc);
+      Func<Scalar>* u = arena == NULL ? new Func<Scalar>(np, nc) : new (arena->allocate(sizeof(Func<Scalar>))) Func<Scalar>(np, nc);
 
       if(u->nc == 1)
       {
-        u->val = new Scalar[np];
-        u->dx  = new Scalar[np];
-        u->dy  = new Scalar[np];
+        u->val = new_fn_values<Scalar>(np, arena);
+        u->dx  = new_fn_values<Scalar>(np, arena);
+        u->dy  = new_fn_values<Scalar>(np, arena);
         
 #ifdef H2D_USE_SECOND_DERIVATIVES
         if(space_type == HERMES_H1_SPACE && sln_type != HERMES_EXACT)
-          u->laplace = new Scalar[np];
+          u->laplace = new_fn_values<Scalar>(np, arena);
 #endif
 
         memcpy(u->val, fu->get_fn_values(), np * sizeof(Scalar));
@@ -740,10 +814,10 @@ namespace Hermes
       }
       else if(u->nc == 2)
       {
-        u->val0 = new Scalar[np];
-        u->val1 = new Scalar[np];
-        u->curl = new Scalar[np];
-        u->div = new Scalar[np];
+        u->val0 = new_fn_values<Scalar>(np, arena);
+        u->val1 = new_fn_values<Scalar>(np, arena);
+        u->curl = new_fn_values<Scalar>(np, arena);
+        u->div = new_fn_values<Scalar>(np, arena);
 
         memcpy(u->val0, fu->get_fn_values(0), np * sizeof(Scalar));
         memcpy(u->val1, fu->get_fn_values(1), np * sizeof(Scalar));
@@ -761,6 +835,24 @@ namespace Hermes
       return u;
     }
 
+    template<typename Scalar>
+    Func<Scalar>* init_fn(MeshFunction<Scalar>*fu, const int order)
+    {
+      return init_fn(fu, order, (Arena*)NULL);
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* init_fn(Solution<Scalar>*fu, const int order)
+    {
+      return init_fn(fu, order, (Arena*)NULL);
+    }
+
+    template HERMES_API Func<double>* init_fn(MeshFunction<double>*fu, const int order, Arena* arena);
+    template HERMES_API Func<std::complex<double> >* init_fn(MeshFunction<std::complex<double> >*fu, const int order, Arena* arena);
+
+    template HERMES_API Func<double>* init_fn(Solution<double>*fu, const int order, Arena* arena);
+    template HERMES_API Func<std::complex<double> >* init_fn(Solution<std::complex<double> >*fu, const int order, Arena* arena);
+
     template Func<double>* init_fn(MeshFunction<double>*fu, const int order);
     template Func<std::complex<double> >* init_fn(MeshFunction<std::complex<double> >*fu, const int order);
 
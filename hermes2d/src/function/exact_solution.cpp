@@ -26,6 +26,63 @@ namespace Hermes
       this->sln_type = HERMES_EXACT;
       this->num_dofs = -1;
       this->exact_multiplicator = 1.0;
+      this->caching = false;
+      this->cache_mesh_seq = 0;
+    }
+
+    template<typename Scalar>
+    ExactSolution<Scalar>::~ExactSolution()
+    {
+      free_cache();
+    }
+
+    template<typename Scalar>
+    void ExactSolution<Scalar>::set_caching(bool enable)
+    {
+      if(!enable)
+        free_cache();
+      this->caching = enable;
+    }
+
+    template<typename Scalar>
+    void ExactSolution<Scalar>::free_cache()
+    {
+      for(typename std::map<std::pair<uint64_t, uint64_t>, Scalar*>::iterator it = cache.begin(); it != cache.end(); it++)
+        delete [] it->second;
+      cache.clear();
+    }
+
+    template<typename Scalar>
+    void ExactSolution<Scalar>::evaluate(int order, int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6])
+    {
+      if(!this->caching)
+      {
+        this->exact_values(n, x, y, values);
+        return;
+      }
+
+      if(this->mesh->get_seq() != this->cache_mesh_seq)
+      {
+        free_cache();
+        this->cache_mesh_seq = this->mesh->get_seq();
+      }
+
+      std::pair<uint64_t, uint64_t> key(this->sub_idx, ((uint64_t)this->element->id << 16) | (order << 4) | this->cur_quad);
+      typename std::map<std::pair<uint64_t, uint64_t>, Scalar*>::iterator it = cache.find(key);
+      if(it != cache.end())
+      {
+        for (int j = 0; j < this->num_components; j++)
+          for (int k = 0; k < 3; k++)
+            memcpy(values[j][k], it->second + (3 * j + k) * n, n * sizeof(Scalar));
+        return;
+      }
+
+      this->exact_values(n, x, y, values);
+      Scalar* cached = new Scalar[3 * this->num_components * n];
+      for (int j = 0; j < this->num_components; j++)
+        for (int k = 0; k < 3; k++)
+          memcpy(cached + (3 * j + k) * n, values[j][k], n * sizeof(Scalar));
+      cache.insert(std::pair<std::pair<uint64_t, uint64_t>, Scalar*>(key, cached));
     }
 
     template<typename Scalar>
@@ -47,6 +104,23 @@ namespace Hermes
       return 1;
     }
 
+    template<typename Scalar>
+    void ExactSolutionScalar<Scalar>::values(int n, const double* x, const double* y, Scalar* val, Scalar* dx, Scalar* dy) const
+    {
+      for (int i = 0; i < n; i++)
+      {
+        dx[i] = dy[i] = 0.0;
+        this->derivatives(x[i], y[i], dx[i], dy[i]);
+        val[i] = this->value(x[i], y[i]);
+      }
+    }
+
+    template<typename Scalar>
+    void ExactSolutionScalar<Scalar>::exact_values(int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]) const
+    {
+      this->values(n, x, y, values[0][0], values[0][1], values[0][2]);
+    }
+
     template<typename Scalar>
     ExactSolutionVector<Scalar>::ExactSolutionVector(const Mesh* mesh) : ExactSolution<Scalar>(mesh)
     {
@@ -59,6 +133,34 @@ namespace Hermes
       return 2;
     }
 
+    template<typename Scalar>
+    void ExactSolutionVector<Scalar>::values(int n, const double* x, const double* y, Scalar2<Scalar>* val, Scalar2<Scalar>* dx, Scalar2<Scalar>* dy) const
+    {
+      for (int i = 0; i < n; i++)
+      {
+        dx[i] = Scalar2<Scalar>(0.0, 0.0);
+        dy[i] = Scalar2<Scalar>(0.0, 0.0);
+        val[i] = this->exact_function(x[i], y[i], dx[i], dy[i]);
+      }
+    }
+
+    template<typename Scalar>
+    void ExactSolutionVector<Scalar>::exact_values(int n, const double* x, const double* y, Scalar* values[H2D_MAX_SOLUTION_COMPONENTS][6]) const
+    {
+      Scalar2<Scalar>* val = new Scalar2<Scalar>[3 * n];
+      Scalar2<Scalar>* dx = val + n;
+      Scalar2<Scalar>* dy = val + 2 * n;
+      this->values(n, x, y, val, dx, dy);
+      for (int j = 0; j < 2; j++)
+        for (int i = 0; i < n; i++)
+        {
+          values[j][0][i] = val[i][j];
+          values[j][1][i] = dx[i][j];
+          values[j][2][i] = dy[i][j];
+        }
+      delete [] val;
+    }
+
     template<>
     void ConstantSolution<double>::save(const char* filename) const
     {
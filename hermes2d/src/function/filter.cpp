@@ -165,7 +165,7 @@ namespace Hermes
       {
         for(unsigned int l = 0; l < it->second->get_size(); l++)
           if(it->second->present(l))
-            ::free(it->second->get(l));
+            this->free_node(it->second->get(l));
         delete it->second;
       }
       tables[this->cur_quad].clear();
@@ -185,7 +185,7 @@ namespace Hermes
         {
           for(unsigned int l = 0; l < it->second->get_size(); l++)
             if(it->second->present(l))
-              ::free(it->second->get(l));
+              this->free_node(it->second->get(l));
           delete it->second;
         }
         tables[i].clear();
@@ -348,7 +348,7 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == this->cur_node);
-        ::free(this->nodes->get(order));
+        this->free_node(this->nodes->get(order));
       }
       this->nodes->add(node, order);
       this->cur_node = node;
@@ -376,6 +376,60 @@ namespace Hermes
       return toReturn;
     }
 
+    template<typename Scalar>
+    Func<Scalar>* SimpleFilter<Scalar>::get_pt_values(int n, const double* x, const double* y, bool* found)
+    {
+      Func<Scalar>* sln_values[H2D_MAX_COMPONENTS];
+      Hermes::vector<Scalar*> values;
+      bool* sln_found = new bool[n];
+      if(found != NULL)
+        for (int j = 0; j < n; j++)
+          found[j] = true;
+
+      for (int i = 0; i < this->num; i++)
+      {
+        sln_values[i] = this->sln[i]->get_pt_values(n, x, y, sln_found);
+        if(found != NULL)
+          for (int j = 0; j < n; j++)
+            found[j] = found[j] && sln_found[j];
+
+        // The item as in precalculate(), of the values get_pt_values() provides.
+        int a = 0, b = 0, mask = item[i];
+        if(mask >= 0x40) { a = 1; mask >>= 6; }
+        while (!(mask & 1)) { mask >>= 1; b++; }
+        Scalar* tab = NULL;
+        if(this->sln[i]->get_num_components() > 1)
+          tab = (b == 0) ? (a == 0 ? sln_values[i]->val0 : sln_values[i]->val1) : NULL;
+        else
+          tab = (b == 0) ? sln_values[i]->val : (b == 1) ? sln_values[i]->dx : (b == 2) ? sln_values[i]->dy : NULL;
+        if(tab == NULL)
+        {
+          for (int k = 0; k <= i; k++)
+          {
+            sln_values[k]->free_fn();
+            delete sln_values[k];
+          }
+          delete [] sln_found;
+          throw Hermes::Exceptions::Exception("Value of 'item%d' is not available at points in filter definition.", i + 1);
+        }
+        values.push_back(tab);
+      }
+
+      Func<Scalar>* toReturn = new Func<Scalar>(n, 1);
+      toReturn->val = new Scalar[n];
+
+      // apply the filter
+      filter_fn(n, values, toReturn->val);
+
+      for (int i = 0; i < this->num; i++)
+      {
+        sln_values[i]->free_fn();
+        delete sln_values[i];
+      }
+      delete [] sln_found;
+      return toReturn;
+    }
+
     template<typename Scalar>
     DXFilter<Scalar>::DXFilter(const Hermes::vector<MeshFunction<Scalar>*>& solutions) : DXDYFilter<Scalar>(solutions)
     {
@@ -445,7 +499,7 @@ namespace Hermes
         {
           for(unsigned int l = 0; l < it->second->get_size(); l++)
             if(it->second->present(l))
-              ::free(it->second->get(l));
+              this->free_node(it->second->get(l));
           delete it->second;
         }
         tables[i].clear();
@@ -473,7 +527,7 @@ namespace Hermes
       {
         for(unsigned int l = 0; l < it->second->get_size(); l++)
           if(it->second->present(l))
-            ::free(it->second->get(l));
+            this->free_node(it->second->get(l));
         delete it->second;
       }
       tables[this->cur_quad].clear();
@@ -516,7 +570,7 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == this->cur_node);
-        ::free(this->nodes->get(order));
+        this->free_node(this->nodes->get(order));
       }
 
       this->cur_node = node;
@@ -624,7 +678,7 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == this->cur_node);
-        ::free(this->nodes->get(order));
+        this->free_node(this->nodes->get(order));
       }
       this->nodes->add(node, order);
       this->cur_node = node;
@@ -1089,7 +1143,7 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == cur_node);
-        ::free(this->nodes->get(order));
+        this->free_node(this->nodes->get(order));
       }
       this->nodes->add(node, order);
       cur_node = node;
@@ -1176,7 +1230,7 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == this->cur_node);
-        ::free(this->nodes->get(order));
+        this->free_node(this->nodes->get(order));
       }
       this->nodes->add(node, order);
       this->cur_node = node;
@@ -1230,6 +1284,331 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    FilterExpression<Scalar>::FilterExpression(MeshFunction<Scalar>* fn, int item)
+    {
+      if(fn == NULL)
+        throw Exceptions::NullException(1);
+      if(item & (H2D_FN_DXX | H2D_FN_DYY | H2D_FN_DXY))
+        throw Hermes::Exceptions::Exception("FilterExpression not defined for second derivatives.");
+      // One item of a scalar function, as in SimpleFilter.
+      if(fn->get_num_components() == 1)
+        item &= H2D_FN_COMPONENT_0;
+      if(item == 0)
+        throw Hermes::Exceptions::Exception("Value of 'item' is incorrect in FilterExpression.");
+      Instruction instruction;
+      instruction.op = Source;
+      instruction.source = 0;
+      instruction.item = item;
+      instruction.value = 0.0;
+      this->program.push_back(instruction);
+      this->sources.push_back(fn);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar>::FilterExpression(Scalar value)
+    {
+      Instruction instruction;
+      instruction.op = Constant;
+      instruction.source = instruction.item = 0;
+      instruction.value = value;
+      this->program.push_back(instruction);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar>::FilterExpression(const FilterExpression& a, const FilterExpression& b, Operation op) : program(a.program), sources(a.sources)
+    {
+      // The sources of b, those already in a are shared.
+      std::vector<int> b_sources(b.sources.size());
+      for(unsigned int i = 0; i < b.sources.size(); i++)
+      {
+        b_sources[i] = std::find(this->sources.begin(), this->sources.end(), b.sources[i]) - this->sources.begin();
+        if(b_sources[i] == (int)this->sources.size())
+          this->sources.push_back(b.sources[i]);
+      }
+      if(this->sources.size() > H2D_MAX_COMPONENTS)
+        throw Hermes::Exceptions::Exception("Attempt to create a FilterExpression of more than %d MeshFunctions.", H2D_MAX_COMPONENTS);
+
+      for(unsigned int i = 0; i < b.program.size(); i++)
+      {
+        this->program.push_back(b.program[i]);
+        if(b.program[i].op == Source)
+          this->program.back().source = b_sources[b.program[i].source];
+      }
+
+      Instruction instruction;
+      instruction.op = op;
+      instruction.source = instruction.item = 0;
+      instruction.value = 0.0;
+      this->program.push_back(instruction);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar> FilterExpression<Scalar>::unary(Operation op) const
+    {
+      FilterExpression<Scalar> result(*this);
+      Instruction instruction;
+      instruction.op = op;
+      instruction.source = instruction.item = 0;
+      instruction.value = 0.0;
+      result.program.push_back(instruction);
+      return result;
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar> FilterExpression<Scalar>::operator-() const
+    {
+      return unary(Negate);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar> FilterExpression<Scalar>::sqr() const
+    {
+      return unary(Square);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar> FilterExpression<Scalar>::sqrt() const
+    {
+      return unary(SquareRoot);
+    }
+
+    template<typename Scalar>
+    FilterExpression<Scalar> FilterExpression<Scalar>::abs() const
+    {
+      return unary(Absolute);
+    }
+
+    template<typename Scalar>
+    int FilterExpression<Scalar>::get_stack_size() const
+    {
+      int size = 0, max_size = 0;
+      for(unsigned int i = 0; i < this->program.size(); i++)
+      {
+        if(this->program[i].op == Source || this->program[i].op == Constant)
+          size++;
+        else if(this->program[i].op == Add || this->program[i].op == Subtract || this->program[i].op == Multiply || this->program[i].op == Divide)
+          size--;
+        max_size = std::max(max_size, size);
+      }
+      return max_size;
+    }
+
+    template<typename Scalar>
+    ExpressionFilter<Scalar>::ExpressionFilter(const FilterExpression<Scalar>& expression) : Filter<Scalar>(expression.sources), expression(expression)
+    {
+      if(expression.sources.empty())
+        throw Hermes::Exceptions::Exception("ExpressionFilter needs at least one MeshFunction in the expression.");
+    }
+
+    template<typename Scalar>
+    ExpressionFilter<Scalar>::~ExpressionFilter()
+    {
+    }
+
+    template<typename Scalar>
+    MeshFunction<Scalar>* ExpressionFilter<Scalar>::clone() const
+    {
+      FilterExpression<Scalar> expression(this->expression);
+      for(int i = 0; i < this->num; i++)
+        expression.sources[i] = this->sln[i]->clone();
+      ExpressionFilter* filter = new ExpressionFilter<Scalar>(expression);
+      filter->setDeleteSolutions();
+      return filter;
+    }
+
+    template<typename Scalar>
+    void ExpressionFilter<Scalar>::get_item(int item, int& a, int& b)
+    {
+      // As in SimpleFilter::precalculate().
+      a = 0;
+      b = 0;
+      if(item >= 0x40) { a = 1; item >>= 6; }
+      while (!(item & 1)) { item >>= 1; b++; }
+    }
+
+    template<typename Scalar>
+    void ExpressionFilter<Scalar>::evaluate(int np, Scalar** tables, Scalar* result) const
+    {
+      // The stack of the operands, the results of the operations in the slots of the stack.
+      int stack_size = this->expression.get_stack_size();
+      Scalar* slots = new Scalar[stack_size * np];
+      Scalar** stack = new Scalar*[stack_size];
+      int top = 0;
+
+      for(unsigned int k = 0; k < this->expression.program.size(); k++)
+      {
+        const typename FilterExpression<Scalar>::Instruction& instruction = this->expression.program[k];
+        switch(instruction.op)
+        {
+        case FilterExpression<Scalar>::Source:
+          stack[top++] = tables[k];
+          break;
+        case FilterExpression<Scalar>::Constant:
+          {
+            Scalar* out = slots + top * np;
+            for (int i = 0; i < np; i++)
+              out[i] = instruction.value;
+            stack[top++] = out;
+          }
+          break;
+        case FilterExpression<Scalar>::Add:
+        case FilterExpression<Scalar>::Subtract:
+        case FilterExpression<Scalar>::Multiply:
+        case FilterExpression<Scalar>::Divide:
+          {
+            Scalar* a = stack[top - 2];
+            Scalar* b = stack[top - 1];
+            Scalar* out = slots + (top - 2) * np;
+            if(instruction.op == FilterExpression<Scalar>::Add)
+              for (int i = 0; i < np; i++)
+                out[i] = a[i] + b[i];
+            else if(instruction.op == FilterExpression<Scalar>::Subtract)
+              for (int i = 0; i < np; i++)
+                out[i] = a[i] - b[i];
+            else if(instruction.op == FilterExpression<Scalar>::Multiply)
+              for (int i = 0; i < np; i++)
+                out[i] = a[i] * b[i];
+            else
+              for (int i = 0; i < np; i++)
+                out[i] = a[i] / b[i];
+            stack[--top - 1] = out;
+          }
+          break;
+        default:
+          {
+            Scalar* a = stack[top - 1];
+            Scalar* out = slots + (top - 1) * np;
+            if(instruction.op == FilterExpression<Scalar>::Negate)
+              for (int i = 0; i < np; i++)
+                out[i] = -a[i];
+            else if(instruction.op == FilterExpression<Scalar>::Square)
+              for (int i = 0; i < np; i++)
+                out[i] = Hermes::sqr(a[i]);
+            else if(instruction.op == FilterExpression<Scalar>::SquareRoot)
+              for (int i = 0; i < np; i++)
+                out[i] = std::sqrt(a[i]);
+            else
+              for (int i = 0; i < np; i++)
+                out[i] = std::abs(a[i]);
+            stack[top - 1] = out;
+          }
+        }
+      }
+
+      memcpy(result, stack[0], np * sizeof(Scalar));
+      delete [] stack;
+      delete [] slots;
+    }
+
+    template<typename Scalar>
+    void ExpressionFilter<Scalar>::precalculate(int order, int mask)
+    {
+      if(mask & (H2D_FN_DX | H2D_FN_DY | H2D_FN_DXX | H2D_FN_DYY | H2D_FN_DXY))
+        throw Hermes::Exceptions::Exception("Filter not defined for derivatives.");
+
+      Quad2D* quad = this->quads[this->cur_quad];
+      int np = quad->get_num_points(order, this->element->get_mode());
+      struct Function<Scalar>::Node* node = this->new_node(H2D_FN_VAL, np);
+
+      // All the items of a source at once.
+      int items[H2D_MAX_COMPONENTS];
+      memset(items, 0, sizeof(items));
+      for(unsigned int k = 0; k < this->expression.program.size(); k++)
+        if(this->expression.program[k].op == FilterExpression<Scalar>::Source)
+          items[this->expression.program[k].source] |= this->expression.program[k].item;
+      for (int i = 0; i < this->num; i++)
+        this->sln[i]->set_quad_order(order, items[i]);
+
+      Scalar** tables = new Scalar*[this->expression.program.size()];
+      for(unsigned int k = 0; k < this->expression.program.size(); k++)
+      {
+        tables[k] = NULL;
+        if(this->expression.program[k].op != FilterExpression<Scalar>::Source)
+          continue;
+        int a, b;
+        get_item(this->expression.program[k].item, a, b);
+        tables[k] = this->sln[this->expression.program[k].source]->get_values(a, b);
+        if(tables[k] == NULL)
+        {
+          delete [] tables;
+          throw Hermes::Exceptions::Exception("Value of 'item' is incorrect in the expression of ExpressionFilter.");
+        }
+      }
+
+      evaluate(np, tables, node->values[0][0]);
+      delete [] tables;
+
+      if(this->nodes->present(order))
+      {
+        assert(this->nodes->get(order) == this->cur_node);
+        this->free_node(this->nodes->get(order));
+      }
+      this->nodes->add(node, order);
+      this->cur_node = node;
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* ExpressionFilter<Scalar>::get_pt_value(double x, double y, Element* e)
+    {
+      return this->get_pt_values(1, &x, &y);
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* ExpressionFilter<Scalar>::get_pt_values(int n, const double* x, const double* y, bool* found)
+    {
+      Func<Scalar>* sln_values[H2D_MAX_COMPONENTS];
+      bool* sln_found = new bool[n];
+      if(found != NULL)
+        for (int j = 0; j < n; j++)
+          found[j] = true;
+      for (int i = 0; i < this->num; i++)
+      {
+        sln_values[i] = this->sln[i]->get_pt_values(n, x, y, sln_found);
+        if(found != NULL)
+          for (int j = 0; j < n; j++)
+            found[j] = found[j] && sln_found[j];
+      }
+      delete [] sln_found;
+
+      // The values get_pt_values() provides: val, dx, dy of scalar functions, val0, val1 of vector-valued ones.
+      Scalar** tables = new Scalar*[this->expression.program.size()];
+      for(unsigned int k = 0; k < this->expression.program.size(); k++)
+      {
+        tables[k] = NULL;
+        if(this->expression.program[k].op != FilterExpression<Scalar>::Source)
+          continue;
+        int source = this->expression.program[k].source, a, b;
+        get_item(this->expression.program[k].item, a, b);
+        if(this->sln[source]->get_num_components() > 1)
+          tables[k] = (b == 0) ? (a == 0 ? sln_values[source]->val0 : sln_values[source]->val1) : NULL;
+        else
+          tables[k] = (b == 0) ? sln_values[source]->val : (b == 1) ? sln_values[source]->dx : (b == 2) ? sln_values[source]->dy : NULL;
+        if(tables[k] == NULL)
+        {
+          delete [] tables;
+          for (int i = 0; i < this->num; i++)
+          {
+            sln_values[i]->free_fn();
+            delete sln_values[i];
+          }
+          throw Hermes::Exceptions::Exception("Value of 'item' is not available at points in the expression of ExpressionFilter.");
+        }
+      }
+
+      Func<Scalar>* toReturn = new Func<Scalar>(n, 1);
+      toReturn->val = new Scalar[n];
+      evaluate(n, tables, toReturn->val);
+
+      delete [] tables;
+      for (int i = 0; i < this->num; i++)
+      {
+        sln_values[i]->free_fn();
+        delete sln_values[i];
+      }
+      return toReturn;
+    }
+
     template class HERMES_API Filter<double>;
     template class HERMES_API Filter<std::complex<double> >;
     template class HERMES_API SimpleFilter<double>;
@@ -1246,5 +1625,9 @@ namespace Hermes
     template class HERMES_API SumFilter<std::complex<double> >;
     template class HERMES_API SquareFilter<double>;
     template class HERMES_API SquareFilter<std::complex<double> >;
+    template class HERMES_API FilterExpression<double>;
+    template class HERMES_API FilterExpression<std::complex<double> >;
+    template class HERMES_API ExpressionFilter<double>;
+    template class HERMES_API ExpressionFilter<std::complex<double> >;
   }
 }
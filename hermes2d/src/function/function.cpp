@@ -32,7 +32,7 @@ namespace Hermes
     template<typename Scalar>
     void Function<Scalar>::check_table(int component, typename Function<Scalar>::Node* cur_node, int n, const char* msg)
     {
-      if(cur_node->values[component][n] == NULL)
+      if(cur_node->values[component][n] == NULL || !(cur_node->mask & idx2mask[n][component]))
         throw Hermes::Exceptions::Exception("%s not precalculated for component %d. Did you call set_quad_order() with correct mask?", msg, component);
     }
 
@@ -52,6 +52,14 @@ namespace Hermes
     template<typename Scalar>
     Function<Scalar>::~Function()
     {
+      for(unsigned int i = 0; i < node_pool.size(); i++)
+        free_node(node_pool[i]);
+    }
+
+    template<typename Scalar>
+    size_t Function<Scalar>::get_memory_usage() const
+    {
+      return this->total_mem > 0 ? (size_t) this->total_mem : 0;
     }
 
     template<typename Scalar>
@@ -188,29 +196,67 @@ namespace Hermes
     template<typename Scalar>
     typename Function<Scalar>::Node* Function<Scalar>::new_node(int mask, int num_points)
     {
-      // get the number of tables
-      int nt = 0, m = mask;
-      if(num_components < 2) m &= H2D_FN_VAL_0 | H2D_FN_DX_0 | H2D_FN_DY_0 | H2D_FN_DXX_0 | H2D_FN_DYY_0 | H2D_FN_DXY_0;
-      while (m) { nt += m & 1; m >>= 1; }
-
-      // allocate a node including its data part, init table pointers
-      int size = (sizeof(Node) - sizeof(Scalar)) + sizeof(Scalar) * num_points * nt; //Due to impl. reasons, the structure Node has non-zero length of data even though they can be zero.
-      Node* node = (Node*) malloc(size);
+      Node* node = NULL;
+      // A pooled node keeps its tables, those not in mask are not valid, but they are there for later add_tables().
+      for(int i = (int)node_pool.size() - 1; i >= 0; i--)
+        if(node_pool[i]->num_points == num_points)
+        {
+          node = node_pool[i];
+          node_pool[i] = node_pool.back();
+          node_pool.pop_back();
+          break;
+        }
+      if(node == NULL)
+      {
+        node = (Node*) malloc(sizeof(Node));
+        node->size = sizeof(Node);
+        node->num_points = num_points;
+        memset(node->values, 0, sizeof(node->values));
+      }
+      node->mask = 0;
+      total_mem += node->size;
+      add_tables(node, mask, num_points);
+      // Flags other than the tables (e.g. H2D_SHARED_NODE of PrecalcShapeset).
       node->mask = mask;
-      node->size = size;
-      memset(node->values, 0, sizeof(node->values));
-      Scalar* data = node->data;
-      for (int j = 0; j < num_components; j++) {
+      return node;
+    }
+
+    template<typename Scalar>
+    void Function<Scalar>::add_tables(Node* node, int mask, int num_points)
+    {
+      for (int j = 0; j < num_components; j++)
+      {
         for (int i = 0; i < 6; i++)
-          if(mask & idx2mask[i][j]) {
-            node->values[j][i] = data;
-            data += num_points;
+          if((mask & idx2mask[i][j]) && node->values[j][i] == NULL)
+          {
+            node->values[j][i] = (Scalar*) malloc(sizeof(Scalar) * num_points);
+            node->size += sizeof(Scalar) * num_points;
+            total_mem += sizeof(Scalar) * num_points;
           }
       }
-
-      total_mem += size;
+      node->mask |= mask;
       if(max_mem < total_mem) max_mem = total_mem;
-      return node;
+      this->update_memory_usage(true);
+    }
+
+    template<typename Scalar>
+    void Function<Scalar>::free_node(Node* node)
+    {
+      for (int j = 0; j < H2D_MAX_SOLUTION_COMPONENTS; j++)
+        for (int i = 0; i < 6; i++)
+          ::free(node->values[j][i]);
+      ::free(node);
+    }
+
+    template<typename Scalar>
+    void Function<Scalar>::release_node(Node* node)
+    {
+      total_mem -= node->size;
+      if(node_pool.size() < H2D_MAX_POOLED_NODES)
+        node_pool.push_back(node);
+      else
+        free_node(node);
+      this->update_memory_usage(true);
     }
 
     template<typename Scalar>
@@ -239,9 +285,10 @@ namespace Hermes
       if(node == NULL) throw Exceptions::NullException(1);
       if(cur_node != NULL) {
         total_mem -= cur_node->size;
-        ::free(cur_node);
+        free_node(cur_node);
       }
       cur_node = node;
+      this->update_memory_usage(true);
     }
 
     template class HERMES_API Function<double>;
@@ -15,6 +15,7 @@
 
 #include "mesh_function.h"
 #include "../views/linearizer_base.h"
+#include "forms.h"
 #include <limits>
 
 namespace Hermes
@@ -46,7 +47,7 @@ namespace Hermes
       {
         for(unsigned int i = 0; i < this->overflow_nodes->get_size(); i++)
           if(this->overflow_nodes->present(i))
-            ::free(this->overflow_nodes->get(i));
+            this->free_node(this->overflow_nodes->get(i));
         delete this->overflow_nodes;
       }
     }
@@ -200,6 +201,61 @@ namespace Hermes
       return mesh;
     }
 
+    template<typename Scalar>
+    void MeshFunction<Scalar>::get_pt_values(int n, const double* x, const double* y, Func<Scalar>** values)
+    {
+      for (int i = 0; i < n; i++)
+        values[i] = this->get_pt_value(x[i], y[i]);
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* MeshFunction<Scalar>::init_pt_values(int n) const
+    {
+      Func<Scalar>* values = new Func<Scalar>(n, this->num_components);
+      Scalar** tables[3] = { &values->val, &values->dx, &values->dy };
+      if(this->num_components > 1)
+      {
+        tables[0] = &values->val0;
+        tables[1] = &values->val1;
+      }
+      for (int i = 0; i < (this->num_components > 1 ? 2 : 3); i++)
+      {
+        *tables[i] = new Scalar[n];
+        memset(*tables[i], 0, n * sizeof(Scalar));
+      }
+      return values;
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* MeshFunction<Scalar>::get_pt_values(int n, const double* x, const double* y, bool* found)
+    {
+      Func<Scalar>* values = this->init_pt_values(n);
+      for (int i = 0; i < n; i++)
+      {
+        Func<Scalar>* value = this->get_pt_value(x[i], y[i]);
+        if(found != NULL)
+          found[i] = (value != NULL);
+        if(value == NULL)
+          continue;
+        if(this->num_components == 1)
+        {
+          values->val[i] = value->val[0];
+          if(value->dx != NULL)
+            values->dx[i] = value->dx[0];
+          if(value->dy != NULL)
+            values->dy[i] = value->dy[0];
+        }
+        else
+        {
+          values->val0[i] = value->val0[0];
+          values->val1[i] = value->val1[0];
+        }
+        value->free_fn();
+        delete value;
+      }
+      return values;
+    }
+
     template<typename Scalar>
     RefMap* MeshFunction<Scalar>::get_refmap(bool update)
     {
@@ -239,7 +295,7 @@ namespace Hermes
       if(this->overflow_nodes != NULL) {
         for(unsigned int i = 0; i < this->overflow_nodes->get_size(); i++)
           if(this->overflow_nodes->present(i))
-            ::free(this->overflow_nodes->get(i));
+            this->free_node(this->overflow_nodes->get(i));
         delete this->overflow_nodes;
       }
       this->nodes = new LightArray<typename Function<Scalar>::Node *>;
@@ -0,0 +1,148 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "multi_solution.h"
+#include "api2d.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    MultiSolution<Scalar>::MultiSolution(int num_components) : mono_coeffs(NULL)
+    {
+      if(num_components < 1)
+        throw Exceptions::ValueException("num_components", num_components, 1);
+      for(int i = 0; i < num_components; i++)
+        this->solutions.push_back(new Solution<Scalar>());
+    }
+
+    template<typename Scalar>
+    MultiSolution<Scalar>::~MultiSolution()
+    {
+      for(unsigned int i = 0; i < this->solutions.size(); i++)
+        delete this->solutions[i];
+      delete [] this->mono_coeffs;
+    }
+
+    template<typename Scalar>
+    void MultiSolution<Scalar>::set_coeff_vector(const Hermes::vector<const Space<Scalar>*>& spaces, const Scalar* coeff_vec, bool add_dir_lift, int start_index)
+    {
+      // Sanity checks.
+      if(coeff_vec == NULL)
+        throw Exceptions::NullException(2);
+      if(spaces.size() != this->solutions.size())
+        throw Exceptions::LengthException(1, spaces.size(), this->solutions.size());
+      for(unsigned int i = 0; i < spaces.size(); i++)
+      {
+        if(spaces[i] == NULL)
+          throw Exceptions::NullException(1, i);
+        if(!spaces[i]->is_up_to_date())
+          throw Exceptions::Exception("Provided 'space' is not up to date.");
+        if(spaces[i]->get_mesh() != spaces[0]->get_mesh())
+          throw Exceptions::Exception("All the spaces of a MultiSolution have to be on the same mesh.");
+      }
+
+      // The orders of all the components, the offsets of the elements in the shared buffer.
+      std::vector<int> coeff_offsets(spaces.size());
+      for(unsigned int i = 0, offset = start_index; i < spaces.size(); i++)
+      {
+        this->solutions[i]->init_element_orders(spaces[i], spaces[i]->get_shapeset()->get_num_components());
+        coeff_offsets[i] = offset;
+        offset += spaces[i]->get_num_dofs();
+      }
+
+      const Mesh* mesh = spaces[0]->get_mesh();
+      Element* e;
+      std::vector<Element*> elements;
+      int num_coeffs = 0;
+      for_all_active_elements(e, mesh)
+      {
+        for(unsigned int i = 0; i < spaces.size(); i++)
+        {
+          Solution<Scalar>* sln = this->solutions[i];
+          int o = sln->elem_orders[e->id];
+          int np = e->get_mode() ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+          for (int l = 0; l < sln->num_components; l++)
+          {
+            sln->elem_coeffs[l][e->id] = num_coeffs;
+            num_coeffs += np;
+          }
+        }
+        elements.push_back(e);
+      }
+
+      delete [] this->mono_coeffs;
+      this->mono_coeffs = new Scalar[num_coeffs];
+      for(unsigned int i = 0; i < spaces.size(); i++)
+      {
+        this->solutions[i]->mono_coeffs = this->mono_coeffs;
+        this->solutions[i]->mono_coeffs_shared = true;
+        this->solutions[i]->num_coeffs = num_coeffs;
+      }
+
+      // All the components of an element together, the elements are independent.
+      int num_elements = (int)elements.size();
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel num_threads(num_threads_used)
+      {
+        std::vector<PrecalcShapeset*> pss(spaces.size());
+        for(unsigned int i = 0; i < spaces.size(); i++)
+        {
+          pss[i] = new PrecalcShapeset(spaces[i]->get_shapeset());
+          Solution<Scalar>::set_quad_2d_cheb(pss[i]);
+        }
+        AsmList<Scalar> al;
+
+#pragma omp for schedule(dynamic, 16)
+        for (int j = 0; j < num_elements; j++)
+          for(unsigned int i = 0; i < spaces.size(); i++)
+            this->solutions[i]->calc_element_coeffs(elements[j], spaces[i], pss[i], &al, coeff_vec + coeff_offsets[i], add_dir_lift);
+
+        for(unsigned int i = 0; i < spaces.size(); i++)
+          delete pss[i];
+      }
+
+      for(unsigned int i = 0; i < spaces.size(); i++)
+      {
+        this->solutions[i]->init_dxdy_buffer();
+        this->solutions[i]->element = NULL;
+      }
+    }
+
+    template<typename Scalar>
+    Solution<Scalar>* MultiSolution<Scalar>::get_solution(int i) const
+    {
+      if(i < 0 || i >= (int)this->solutions.size())
+        throw Exceptions::ValueException("i", i, 0, this->solutions.size() - 1);
+      return this->solutions[i];
+    }
+
+    template<typename Scalar>
+    Hermes::vector<Solution<Scalar>*> MultiSolution<Scalar>::get_solutions() const
+    {
+      return this->solutions;
+    }
+
+    template<typename Scalar>
+    int MultiSolution<Scalar>::get_num_components() const
+    {
+      return (int)this->solutions.size();
+    }
+
+    template class HERMES_API MultiSolution<double>;
+    template class HERMES_API MultiSolution<std::complex<double> >;
+  }
+}
@@ -19,6 +19,8 @@
 #include "solution_h2d_xml.h"
 #include "ogprojection.h"
 #include "api2d.h"
+#include "xml_stream_reader.h"
+#include "quadrature/limit_order.h"
 
 #include <iostream>
 #include <algorithm>
@@ -98,8 +100,8 @@ namespace Hermes
       this->num_components = 0;
       e_last = NULL;
 
-      for(int i = 0; i < 4; i++)
-        for(int j = 0; j < 4; j++)
+      for(int i = 0; i < H2D_MAX_QUADRATURES; i++)
+        for(int j = 0; j < H2D_SOLUTION_ELEMENT_CACHE_SIZE; j++)
           tables[i][j] = new std::map<uint64_t, LightArray<struct Function<double>::Node*>*>;
 
       mono_coeffs = NULL;
@@ -108,6 +110,13 @@ namespace Hermes
       dxdy_buffer = NULL;
       num_coeffs = num_elems = 0;
       num_dofs = -1;
+      lazy_conversion = false;
+      lazy = NULL;
+      dxdy_pending = false;
+      mono_coeffs_shared = false;
+      coeffs_borrowed = false;
+      table_memory_limit = 0;
+      tables_use_counter = 0;
 
       this->set_quad_2d(&g_quad_2d_std);
     }
@@ -123,8 +132,8 @@ namespace Hermes
 			this->num_components = 0;
 			e_last = NULL;
 
-			for(int i = 0; i < 4; i++)
-				for(int j = 0; j < 4; j++)
+			for(int i = 0; i < H2D_MAX_QUADRATURES; i++)
+				for(int j = 0; j < H2D_SOLUTION_ELEMENT_CACHE_SIZE; j++)
 					tables[i][j] = new std::map<uint64_t, LightArray<struct Function<std::complex<double> >::Node*>*>;
 
 			mono_coeffs = NULL;
@@ -133,6 +142,13 @@ namespace Hermes
 			dxdy_buffer = NULL;
 			num_coeffs = num_elems = 0;
 			num_dofs = -1;
+			lazy_conversion = false;
+			lazy = NULL;
+			dxdy_pending = false;
+			mono_coeffs_shared = false;
+			coeffs_borrowed = false;
+			table_memory_limit = 0;
+			tables_use_counter = 0;
 
 			this->set_quad_2d(&g_quad_2d_std);
 		}
@@ -218,17 +234,24 @@ namespace Hermes
       space_type = sln->get_space_type();
 
       mono_coeffs = sln->mono_coeffs;        sln->mono_coeffs = NULL;
+      mono_coeffs_shared = sln->mono_coeffs_shared; sln->mono_coeffs_shared = false;
+      coeffs_borrowed = sln->coeffs_borrowed; sln->coeffs_borrowed = false;
       elem_coeffs[0] = sln->elem_coeffs[0];  sln->elem_coeffs[0] = NULL;
       elem_coeffs[1] = sln->elem_coeffs[1];  sln->elem_coeffs[1] = NULL;
       elem_orders = sln->elem_orders;      sln->elem_orders = NULL;
       dxdy_buffer = sln->dxdy_buffer;      sln->dxdy_buffer = NULL;
       num_coeffs = sln->num_coeffs;          sln->num_coeffs = 0;
       num_elems = sln->num_elems;          sln->num_elems = 0;
+      lazy = sln->lazy;                    sln->lazy = NULL;
 
       sln_type = sln->sln_type;
       this->num_components = sln->num_components;
 
       memset(sln->tables, 0, sizeof(sln->tables));
+      sln->tables_last_use.clear();
+
+      this->update_memory_usage();
+      sln->update_memory_usage();
     }
 
     template<typename Scalar>
@@ -261,6 +284,19 @@ namespace Hermes
         elem_orders = new int[num_elems];
         memcpy(elem_orders, sln->elem_orders, sizeof(int) * num_elems);
 
+        // The copy converts its elements itself, too.
+        if(sln->lazy != NULL)
+        {
+          int size = sln->lazy->space->get_max_dof() - sln->lazy->space->first_dof + 1;
+          lazy = new LazyConversion(*sln->lazy);
+          lazy->pss = new PrecalcShapeset(sln->lazy->space->shapeset);
+          lazy->pss->set_quad_2d(&g_quad_2d_cheb);
+          lazy->coeff_vec = new Scalar[size];
+          memcpy(lazy->coeff_vec, sln->lazy->coeff_vec, sizeof(Scalar) * size);
+          lazy->converted = new bool[num_elems];
+          memcpy(lazy->converted, sln->lazy->converted, sizeof(bool) * num_elems);
+        }
+
         init_dxdy_buffer();
       }
       else // Const, exact handled differently.
@@ -273,24 +309,40 @@ namespace Hermes
     MeshFunction<Scalar>* Solution<Scalar>::clone() const
     {
       Solution<Scalar>* sln = new Solution<Scalar>();
-      sln->copy(this);
+      if(this->sln_type != HERMES_SLN || this->lazy != NULL)
+      {
+        sln->copy(this);
+        return sln;
+      }
+
+      sln->mesh = this->mesh;
+      sln->sln_type = this->sln_type;
+      sln->space_type = this->space_type;
+      sln->num_components = this->num_components;
+      sln->num_dofs = this->num_dofs;
+      sln->num_coeffs = this->num_coeffs;
+      sln->num_elems = this->num_elems;
+
+      sln->mono_coeffs = this->mono_coeffs;
+      for (int l = 0; l < this->num_components; l++)
+        sln->elem_coeffs[l] = this->elem_coeffs[l];
+      sln->elem_orders = this->elem_orders;
+      sln->coeffs_borrowed = true;
+
+      sln->init_dxdy_buffer();
+      sln->element = NULL;
       return sln;
     }
 
     template<typename Scalar>
     void Solution<Scalar>::free_tables()
     {
-      for (int i = 0; i < 4; i++)
-        for (int j = 0; j < 4; j++)
+      for (int i = 0; i < H2D_MAX_QUADRATURES; i++)
+        for (int j = 0; j < H2D_SOLUTION_ELEMENT_CACHE_SIZE; j++)
           if(tables[i][j] != NULL)
           {
             for(typename std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>::iterator it = tables[i][j]->begin(); it != tables[i][j]->end(); it++)
-            {
-              for(unsigned int l = 0; l < it->second->get_size(); l++)
-                if(it->second->present(l))
-                  ::free(it->second->get(l));
-              delete it->second;
-            }
+              free_sub_table(it->second);
             tables[i][j]->clear();
             delete tables[i][j];
             tables[i][j] = NULL;
@@ -301,7 +353,18 @@ namespace Hermes
     template<>
     void Solution<double>::free()
     {
-      if(mono_coeffs  != NULL) { delete [] mono_coeffs;   mono_coeffs = NULL;  }
+      // The shared coefficients belong to the MultiSolution.
+      // The borrowed coefficients belong to the original of the clone.
+      if(coeffs_borrowed)
+      {
+        mono_coeffs = NULL;
+        elem_orders = NULL;
+        for (int i = 0; i < H2D_MAX_SOLUTION_COMPONENTS; i++)
+          elem_coeffs[i] = NULL;
+        coeffs_borrowed = false;
+      }
+      if(mono_coeffs  != NULL) { if(!mono_coeffs_shared) delete [] mono_coeffs;   mono_coeffs = NULL;  }
+      mono_coeffs_shared = false;
       if(elem_orders != NULL) { delete [] elem_orders;  elem_orders = NULL; }
       if(dxdy_buffer != NULL) { delete [] dxdy_buffer;  dxdy_buffer = NULL; }
 
@@ -311,13 +374,26 @@ namespace Hermes
 
         e_last = NULL;
 
+        free_lazy_conversion();
         free_tables();
+        this->update_memory_usage();
     }
 
 		template<>
 		void Solution<std::complex<double> >::free()
 		{
-			if(mono_coeffs  != NULL) { delete [] mono_coeffs;   mono_coeffs = NULL;  }
+			// The shared coefficients belong to the MultiSolution.
+			// The borrowed coefficients belong to the original of the clone.
+			if(coeffs_borrowed)
+			{
+			  mono_coeffs = NULL;
+			  elem_orders = NULL;
+			  for (int i = 0; i < H2D_MAX_SOLUTION_COMPONENTS; i++)
+			    elem_coeffs[i] = NULL;
+			  coeffs_borrowed = false;
+			}
+			if(mono_coeffs  != NULL) { if(!mono_coeffs_shared) delete [] mono_coeffs;   mono_coeffs = NULL;  }
+			mono_coeffs_shared = false;
 			if(elem_orders != NULL) { delete [] elem_orders;  elem_orders = NULL; }
 			if(dxdy_buffer != NULL) { delete [] dxdy_buffer;  dxdy_buffer = NULL; }
 
@@ -327,7 +403,9 @@ namespace Hermes
 
 				e_last = NULL;
 
+				free_lazy_conversion();
 				free_tables();
+				this->update_memory_usage();
 		}
 
 		template<>
@@ -348,7 +426,7 @@ namespace Hermes
     {
     public:
 
-      // this is a set of LU-decomposed matrices shared by all Solutions
+      // this is a set of LU-decomposed matrices shared by all Solutions, filled in the critical section mono_lu
       double** mat[2][11];
       int* perm[2][11];
 
@@ -370,24 +448,24 @@ namespace Hermes
     mono_lu;
 
     template<typename Scalar>
-    double** Solution<Scalar>::calc_mono_matrix(int o, int*& perm)
+    double** Solution<Scalar>::calc_mono_matrix(int mode, int o, int*& perm)
     {
       int i, j, k, l, m, row;
       double x, y, xn, yn;
-      int n = this->mode ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+      int n = mode ? sqr(o + 1) : (o + 1)*(o + 2)/2;
 
       // loop through all chebyshev points
       double** mat = new_matrix<double>(n, n);
       for (k = o, row = 0; k >= 0; k--)
       {
         y = o ? cos(k * M_PI / o) : 1.0;
-        for (l = o; l >= (this->mode ? 0 : o-k); l--, row++)
+        for (l = o; l >= (mode ? 0 : o-k); l--, row++)
         {
           x = o ? cos(l * M_PI / o) : 1.0;
 
           // each row of the matrix contains all the monomials x^i*y^j
           for (i = 0, yn = 1.0, m = n-1;  i <= o;  i++, yn *= y)
-            for (j = (this->mode ? 0 : i), xn = 1.0;  j <= o;  j++, xn *= x, m--)
+            for (j = (mode ? 0 : i), xn = 1.0;  j <= o;  j++, xn *= x, m--)
               mat[row][m] = xn * yn;
         }
       }
@@ -433,7 +511,6 @@ namespace Hermes
     void Solution<Scalar>::set_coeff_vector(const Space<Scalar>* space, PrecalcShapeset* pss,
         const Scalar* coeff_vec, bool add_dir_lift, int start_index)
     {
-      int o;
       if(Solution<Scalar>::static_verbose_output)
         Hermes::Mixins::Loggable::Static::info("Solution: set_coeff_vector called.");
       // Sanity checks.
@@ -450,11 +527,89 @@ namespace Hermes
       if(Solution<Scalar>::static_verbose_output)
         Hermes::Mixins::Loggable::Static::info("Solution: set_coeff_vector - solution being freed.");
 
+      init_element_orders(space, pss->get_num_components());
+
+      // The offsets of the coefficients of the elements, allocate mono_coeffs.
+      Element* e;
+      std::vector<Element*> elements;
+      num_coeffs = 0;
+      for_all_active_elements(e, this->mesh)
+      {
+        int o = elem_orders[e->id];
+        int np = e->get_mode() ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+        for (int l = 0; l < this->num_components; l++)
+        {
+          elem_coeffs[l][e->id] = num_coeffs;
+          num_coeffs += np;
+        }
+        elements.push_back(e);
+      }
+
+      if(mono_coeffs != NULL)
+        delete [] mono_coeffs;
+      mono_coeffs = new Scalar[num_coeffs];
+
+      // Express the solution on elements as a linear combination of monomials, the elements are independent.
+      if(lazy_conversion)
+      {
+        int size = space->get_max_dof() - space->first_dof + 1;
+        lazy = new LazyConversion;
+        lazy->space = space;
+        lazy->pss = new PrecalcShapeset(space->shapeset);
+        lazy->pss->set_quad_2d(&g_quad_2d_cheb);
+        lazy->coeff_vec = new Scalar[size];
+        memcpy(lazy->coeff_vec, coeff_vec + start_index, sizeof(Scalar) * size);
+        lazy->add_dir_lift = add_dir_lift;
+        lazy->converted = new bool[num_elems];
+        memset(lazy->converted, 0, sizeof(bool) * num_elems);
+        memset(mono_coeffs, 0, sizeof(Scalar) * num_coeffs);
+      }
+      else
+      {
+        pss->set_quad_2d(&g_quad_2d_cheb);
+        int num_elements = (int)elements.size();
+        int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel num_threads(num_threads_used)
+        {
+          PrecalcShapeset* current_pss = pss;
+          if(omp_get_thread_num() > 0)
+          {
+            current_pss = new PrecalcShapeset(pss->shapeset);
+            current_pss->set_quad_2d(&g_quad_2d_cheb);
+          }
+          AsmList<Scalar> al;
+
+#pragma omp for schedule(dynamic, 16)
+          for (int i = 0; i < num_elements; i++)
+            calc_element_coeffs(elements[i], space, current_pss, &al, coeff_vec + start_index, add_dir_lift);
+
+          if(current_pss != pss)
+            delete current_pss;
+        }
+      }
+
+      if(this->mesh == NULL) throw Hermes::Exceptions::Exception("mesh == NULL.\n");
+      init_dxdy_buffer();
+      this->element = NULL;
+      if(Solution<Scalar>::static_verbose_output)
+        Hermes::Mixins::Loggable::Static::info("Solution: set_coeff_vector - done.");
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::set_quad_2d_cheb(PrecalcShapeset* pss)
+    {
+      pss->set_quad_2d(&g_quad_2d_cheb);
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::init_element_orders(const Space<Scalar>* space, int num_components)
+    {
+      int o;
       free();
 
       this->space_type = space->get_type();
 
-      this->num_components = pss->get_num_components();
+      this->num_components = num_components;
       sln_type = HERMES_SLN;
 
       // Copy the mesh.
@@ -462,24 +617,21 @@ namespace Hermes
 
       // Allocate the coefficient arrays.
       num_elems = this->mesh->get_max_element_id();
-      if(elem_orders != NULL)
-        delete [] elem_orders;
       elem_orders = new int[num_elems];
       memset(elem_orders, 0, sizeof(int) * num_elems);
       for (int l = 0; l < this->num_components; l++)
       {
-        if(elem_coeffs[l] != NULL)
-          delete [] elem_coeffs[l];
         elem_coeffs[l] = new int[num_elems];
         memset(elem_coeffs[l], 0, sizeof(int) * num_elems);
       }
 
-      // Obtain element orders, allocate mono_coeffs.
+      // Obtain element orders.
       Element* e;
-      num_coeffs = 0;
+      bool used_orders[H2D_NUM_MODES][11];
+      memset(used_orders, 0, sizeof(used_orders));
       for_all_active_elements(e, this->mesh)
       {
-        this->mode = e->get_mode();
+        int mode = e->get_mode();
         o = space->get_element_order(e->id);
         o = std::max(H2D_GET_H_ORDER(o), H2D_GET_V_ORDER(o));
         for (unsigned int k = 0; k < e->get_nvert(); k++)
@@ -491,62 +643,82 @@ namespace Hermes
         // Hcurl and Hdiv: actual order of functions is one higher than element order
         if((space->shapeset)->get_num_components() == 2) o++;
 
-        num_coeffs += this->mode ? sqr(o + 1) : (o + 1)*(o + 2)/2;
         elem_orders[e->id] = o;
+        used_orders[mode][o] = true;
       }
-      num_coeffs *= this->num_components;
-      if(mono_coeffs != NULL)
-        delete [] mono_coeffs;
-      mono_coeffs = new Scalar[num_coeffs];
 
-      // Express the solution on elements as a linear combination of monomials.
-      Quad2D* quad = &g_quad_2d_cheb;
-      pss->set_quad_2d(quad);
-      Scalar* mono = mono_coeffs;
-      for_all_active_elements(e, this->mesh)
-      {
-        this->mode = e->get_mode();
-        o = elem_orders[e->id];
-        int np = quad->get_num_points(o, e->get_mode());
+      // The matrices are shared by all Solutions, possibly set up in other threads.
+#pragma omp critical (mono_lu)
+      for (int mode = 0; mode < H2D_NUM_MODES; mode++)
+        for (o = 0; o <= 10; o++)
+          if(used_orders[mode][o] && mono_lu.mat[mode][o] == NULL)
+            mono_lu.mat[mode][o] = calc_mono_matrix(mode, o, mono_lu.perm[mode][o]);
+    }
 
-        AsmList<Scalar> al;
-        space->get_element_assembly_list(e, &al);
-        pss->set_active_element(e);
+    template<typename Scalar>
+    void Solution<Scalar>::calc_element_coeffs(Element* e, const Space<Scalar>* space, PrecalcShapeset* pss, AsmList<Scalar>* al,
+        const Scalar* coeffs, bool add_dir_lift)
+    {
+      ElementMode2D mode = e->get_mode();
+      int o = elem_orders[e->id];
+      int np = pss->get_quad_2d()->get_num_points(o, mode);
 
-        for (int l = 0; l < this->num_components; l++)
-        {
-          // Obtain solution values for the current element.
-          Scalar* val = mono;
-          elem_coeffs[l][e->id] = (int) (mono - mono_coeffs);
-          memset(val, 0, sizeof(Scalar)*np);
-          for (unsigned int k = 0; k < al.cnt; k++)
-          {
-            pss->set_active_shape(al.idx[k]);
-            pss->set_quad_order(o, H2D_FN_VAL);
-            int dof = al.dof[k];
-            double dir_lift_coeff = add_dir_lift ? 1.0 : 0.0;
-            // By subtracting space->first_dof we make sure that it does not matter where the
-            // enumeration of dofs in the space starts. This ca be either zero or there can be some
-            // offset. By adding start_index we move to the desired section of coeff_vec.
-            Scalar coef = al.coef[k] * (dof >= 0 ? coeff_vec[dof  - space->first_dof + start_index] : dir_lift_coeff);
-            double* shape = pss->get_fn_values(l);
-            for (int i = 0; i < np; i++)
-              val[i] += shape[i] * coef;
-          }
-          mono += np;
+      space->get_element_assembly_list(e, al);
+      pss->set_active_element(e);
 
-          // solve for the monomial coefficients
-          if(mono_lu.mat[this->mode][o] == NULL)
-            mono_lu.mat[this->mode][o] = calc_mono_matrix(o, mono_lu.perm[this->mode][o]);
-          lubksb(mono_lu.mat[this->mode][o], np, mono_lu.perm[this->mode][o], val);
+      for (int l = 0; l < this->num_components; l++)
+      {
+        // Obtain solution values for the current element.
+        Scalar* val = mono_coeffs + elem_coeffs[l][e->id];
+        memset(val, 0, sizeof(Scalar)*np);
+        for (unsigned int k = 0; k < al->cnt; k++)
+        {
+          pss->set_active_shape(al->idx[k]);
+          pss->set_quad_order(o, H2D_FN_VAL);
+          int dof = al->dof[k];
+          double dir_lift_coeff = add_dir_lift ? 1.0 : 0.0;
+          // By subtracting space->first_dof we make sure that it does not matter where the
+          // enumeration of dofs in the space starts.
+          Scalar coef = al->coef[k] * (dof >= 0 ? coeffs[dof - space->first_dof] : dir_lift_coeff);
+          double* shape = pss->get_fn_values(l);
+          for (int i = 0; i < np; i++)
+            val[i] += shape[i] * coef;
         }
+
+        // solve for the monomial coefficients
+        lubksb(mono_lu.mat[mode][o], np, mono_lu.perm[mode][o], val);
       }
+    }
 
-      if(this->mesh == NULL) throw Hermes::Exceptions::Exception("mesh == NULL.\n");
-      init_dxdy_buffer();
-      this->element = NULL;
-      if(Solution<Scalar>::static_verbose_output)
-        Hermes::Mixins::Loggable::Static::info("Solution: set_coeff_vector - done.");
+    template<typename Scalar>
+    void Solution<Scalar>::set_lazy_conversion(bool lazy)
+    {
+      lazy_conversion = lazy;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::finish_lazy_conversion()
+    {
+      if(lazy == NULL)
+        return;
+      AsmList<Scalar> al;
+      Element* e;
+      for_all_active_elements(e, this->mesh)
+        if(!lazy->converted[e->id])
+          calc_element_coeffs(e, lazy->space, lazy->pss, &al, lazy->coeff_vec, lazy->add_dir_lift);
+      free_lazy_conversion();
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::free_lazy_conversion()
+    {
+      if(lazy == NULL)
+        return;
+      delete lazy->pss;
+      delete [] lazy->coeff_vec;
+      delete [] lazy->converted;
+      delete lazy;
+      lazy = NULL;
     }
 
     template<typename Scalar>
@@ -809,8 +981,25 @@ namespace Hermes
     {
       if(sln_type == HERMES_SLN)
       {
-        for (int i = 0; i < num_coeffs; i++)
-          mono_coeffs[i] *= coef;
+        if(coeffs_borrowed)
+          throw Hermes::Exceptions::Exception("The coefficients of a cloned Solution are read-only, multiply the original.");
+        finish_lazy_conversion();
+        if(mono_coeffs_shared)
+        {
+          // Only the coefficients of this component of the MultiSolution.
+          Element* e;
+          for_all_active_elements(e, this->mesh)
+          {
+            int o = elem_orders[e->id];
+            int np = e->get_mode() ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+            for (int l = 0; l < this->num_components; l++)
+              for (int i = 0; i < np; i++)
+                mono_coeffs[elem_coeffs[l][e->id] + i] *= coef;
+          }
+        }
+        else
+          for (int i = 0; i < num_coeffs; i++)
+            mono_coeffs[i] *= coef;
       }
       else if(sln_type == HERMES_EXACT)
         dynamic_cast<ExactSolution<Scalar>*>(this)->exact_multiplicator *= coef;
@@ -860,6 +1049,27 @@ namespace Hermes
         dxdy_buffer = NULL;
       }
       dxdy_buffer = new Scalar[this->num_components * 5 * 121];
+      // Called whenever the coefficients are set (computed, copied, loaded).
+      this->update_memory_usage();
+    }
+
+    template<typename Scalar>
+    size_t Solution<Scalar>::get_memory_usage() const
+    {
+      size_t usage = Function<Scalar>::get_memory_usage();
+      if(!this->coeffs_borrowed)
+      {
+        if(this->mono_coeffs != NULL && !this->mono_coeffs_shared)
+          usage += (size_t) this->num_coeffs * sizeof(Scalar);
+        for(int i = 0; i < this->num_components; i++)
+          if(this->elem_coeffs[i] != NULL)
+            usage += (size_t) this->num_elems * sizeof(int);
+        if(this->elem_orders != NULL)
+          usage += (size_t) this->num_elems * sizeof(int);
+      }
+      if(this->dxdy_buffer != NULL)
+        usage += (size_t) this->num_components * 5 * 121 * sizeof(Scalar);
+      return usage;
     }
 
     template<typename Scalar>
@@ -874,22 +1084,17 @@ namespace Hermes
       MeshFunction<Scalar>::set_active_element(e);
 
       // try finding an existing table for e
-      for (cur_elem = 0; cur_elem < 4; cur_elem++)
+      for (cur_elem = 0; cur_elem < H2D_SOLUTION_ELEMENT_CACHE_SIZE; cur_elem++)
         if(elems[this->cur_quad][cur_elem] == e)
           break;
 
       // if not found, free the oldest one and use its slot
-      if(cur_elem >= 4)
+      if(cur_elem >= H2D_SOLUTION_ELEMENT_CACHE_SIZE)
       {
         if(tables[this->cur_quad][oldest[this->cur_quad]] != NULL)
         {
           for(typename std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>::iterator it = tables[this->cur_quad][oldest[this->cur_quad]]->begin(); it != tables[this->cur_quad][oldest[this->cur_quad]]->end(); it++)
-          {
-            for(unsigned int l = 0; l < it->second->get_size(); l++)
-              if(it->second->present(l))
-                ::free(it->second->get(l));
-            delete it->second;
-          }
+            free_sub_table(it->second);
           delete tables[this->cur_quad][oldest[this->cur_quad]];
           tables[this->cur_quad][oldest[this->cur_quad]] = NULL;
           elems[this->cur_quad][oldest[this->cur_quad]] = NULL;
@@ -898,7 +1103,7 @@ namespace Hermes
         tables[this->cur_quad][oldest[this->cur_quad]] = new std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>;
 
         cur_elem = oldest[this->cur_quad];
-        if(++oldest[this->cur_quad] >= 4)
+        if(++oldest[this->cur_quad] >= H2D_SOLUTION_ELEMENT_CACHE_SIZE)
           oldest[this->cur_quad] = 0;
 
         elems[this->cur_quad][cur_elem] = e;
@@ -906,20 +1111,13 @@ namespace Hermes
 
       if(sln_type == HERMES_SLN)
       {
-        int o = this->order = elem_orders[this->element->id];
-        int n = this->mode ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+        this->order = elem_orders[this->element->id];
 
-        for (int i = 0, m = 0; i < this->num_components; i++)
-        {
-          Scalar* mono = mono_coeffs + elem_coeffs[i][e->id];
-          dxdy_coeffs[i][0] = mono;
-
-          make_dx_coeffs(this->mode, o, mono, dxdy_coeffs[i][1] = dxdy_buffer + m);  m += n;
-          make_dy_coeffs(this->mode, o, mono, dxdy_coeffs[i][2] = dxdy_buffer + m);  m += n;
-          make_dx_coeffs(this->mode, o, dxdy_coeffs[i][1], dxdy_coeffs[i][3] = dxdy_buffer + m);  m += n;
-          make_dy_coeffs(this->mode, o, dxdy_coeffs[i][2], dxdy_coeffs[i][4] = dxdy_buffer + m);  m += n;
-          make_dx_coeffs(this->mode, o, dxdy_coeffs[i][2], dxdy_coeffs[i][5] = dxdy_buffer + m);  m += n;
-        }
+        // A lazily converted Solution may only be asked for the order here (e.g. u_ext in assembling).
+        if(lazy != NULL)
+          dxdy_pending = true;
+        else
+          set_dxdy_coeffs();
       }
       else if(sln_type == HERMES_EXACT)
       {
@@ -933,6 +1131,34 @@ namespace Hermes
       this->update_nodes_ptr();
     }
 
+    template<typename Scalar>
+    void Solution<Scalar>::set_dxdy_coeffs()
+    {
+      Element* e = this->element;
+      if(lazy != NULL && !lazy->converted[e->id])
+      {
+        AsmList<Scalar> al;
+        calc_element_coeffs(e, lazy->space, lazy->pss, &al, lazy->coeff_vec, lazy->add_dir_lift);
+        lazy->converted[e->id] = true;
+      }
+
+      int o = elem_orders[e->id];
+      int n = this->mode ? sqr(o + 1) : (o + 1)*(o + 2)/2;
+
+      for (int i = 0, m = 0; i < this->num_components; i++)
+      {
+        Scalar* mono = mono_coeffs + elem_coeffs[i][e->id];
+        dxdy_coeffs[i][0] = mono;
+
+        make_dx_coeffs(this->mode, o, mono, dxdy_coeffs[i][1] = dxdy_buffer + m);  m += n;
+        make_dy_coeffs(this->mode, o, mono, dxdy_coeffs[i][2] = dxdy_buffer + m);  m += n;
+        make_dx_coeffs(this->mode, o, dxdy_coeffs[i][1], dxdy_coeffs[i][3] = dxdy_buffer + m);  m += n;
+        make_dy_coeffs(this->mode, o, dxdy_coeffs[i][2], dxdy_coeffs[i][4] = dxdy_buffer + m);  m += n;
+        make_dx_coeffs(this->mode, o, dxdy_coeffs[i][2], dxdy_coeffs[i][5] = dxdy_buffer + m);  m += n;
+      }
+      dxdy_pending = false;
+    }
+
     template<typename Scalar>
     static inline void set_vec_num(int n, Scalar* y, Scalar num)
     {
@@ -1067,6 +1293,9 @@ namespace Hermes
 
       if(sln_type == HERMES_SLN)
       {
+        if(dxdy_pending)
+          set_dxdy_coeffs();
+
         // if we are required to transform vectors, we must precalculate both their components
         const int H2D_GRAD = H2D_FN_DX_0 | H2D_FN_DY_0;
         const int H2D_SECOND = H2D_FN_DXX_0 | H2D_FN_DXY_0 | H2D_FN_DYY_0;
@@ -1087,7 +1316,15 @@ namespace Hermes
 
         int oldmask = (this->cur_node != NULL) ? this->cur_node->mask : 0;
         int newmask = mask | oldmask;
-        node = this->new_node(newmask, np);
+
+        // The present tables are kept in the node, only the missing ones are added.
+        if(this->cur_node != NULL)
+        {
+          node = this->cur_node;
+          this->add_tables(node, newmask, np);
+        }
+        else
+          node = this->new_node(newmask, np);
 
         // transform integration points by the current matrix
         Scalar* x = new Scalar[np];
@@ -1109,12 +1346,7 @@ namespace Hermes
             if(newmask & this->idx2mask[k][l])
             {
               Scalar* result = node->values[l][k];
-              if(oldmask & this->idx2mask[k][l])
-              {
-                // copy the old table if we have it already
-                memcpy(result, this->cur_node->values[l][k], np * sizeof(Scalar));
-              }
-              else
+              if(!(oldmask & this->idx2mask[k][l]))
               {
                 // calculate the solution values using Horner's scheme
                 Scalar* mono = dxdy_coeffs[l][k];
@@ -1152,7 +1384,11 @@ namespace Hermes
         double* x = this->refmap->get_phys_x(order);
         double* y = this->refmap->get_phys_y(order);
 
-        // evaluate the exact solution
+        // evaluate the exact solution at all the points at once
+        ExactSolution<Scalar>* exact = static_cast<ExactSolution<Scalar>*>(this);
+        exact->evaluate(order, np, x, y, node->values);
+        Scalar multiplicator = exact->exact_multiplicator;
+
         if(this->num_components == 1)
         {
           // untransform values
@@ -1166,38 +1402,25 @@ namespace Hermes
             for (i = 0, m = mat; i < np; i++, m += mstep)
             {
               double jac = (*m)[0][0] *  (*m)[1][1] - (*m)[1][0] *  (*m)[0][1];
-              Scalar val, dx = 0.0, dy = 0.0;
-              val = (static_cast<ExactSolutionScalar<Scalar>*>(this))->exact_function(x[i], y[i], dx, dy);
-              node->values[0][0][i] = val * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[0][1][i] = (  (*m)[1][1]*dx - (*m)[0][1]*dy) / jac * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[0][2][i] = (- (*m)[1][0]*dx + (*m)[0][0]*dy) / jac * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
+              Scalar dx = node->values[0][1][i], dy = node->values[0][2][i];
+              node->values[0][0][i] *= multiplicator;
+              node->values[0][1][i] = (  (*m)[1][1]*dx - (*m)[0][1]*dy) / jac * multiplicator;
+              node->values[0][2][i] = (- (*m)[1][0]*dx + (*m)[0][0]*dy) / jac * multiplicator;
             }
           }
           else
           {
-            for (i = 0; i < np; i++)
-            {
-              Scalar val, dx = 0.0, dy = 0.0;
-              val = (static_cast<ExactSolutionScalar<Scalar>*>(this))->exact_function(x[i], y[i], dx, dy);
-              node->values[0][0][i] = val * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[0][1][i] = dx * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[0][2][i] = dy * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-            }
+            for (k = 0; k < 3; k++)
+              for (i = 0; i < np; i++)
+                node->values[0][k][i] *= multiplicator;
           }
         }
         else
         {
-          for (i = 0; i < np; i++)
-          {
-            Scalar2<Scalar> dx (0.0, 0.0 ), dy ( 0.0, 0.0 );
-            Scalar2<Scalar> val = (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_function(x[i], y[i], dx, dy);
-            for (j = 0; j < 2; j++)
-            {
-              node->values[j][0][i] = val[j] * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[j][1][i] = dx[j] * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-              node->values[j][2][i] = dy[j] * (static_cast<ExactSolutionVector<Scalar>*>(this))->exact_multiplicator;
-            }
-          }
+          for (j = 0; j < 2; j++)
+            for (k = 0; k < 3; k++)
+              for (i = 0; i < np; i++)
+                node->values[j][k][i] *= multiplicator;
         }
       }
       else
@@ -1210,10 +1433,117 @@ namespace Hermes
       if(this->nodes->present(order))
       {
         assert(this->nodes->get(order) == this->cur_node);
-        ::free(this->nodes->get(order));
+        if(this->cur_node != node)
+          this->release_node(this->nodes->get(order));
       }
       this->nodes->add(node, order);
       this->cur_node = node;
+
+      if(table_memory_limit > 0)
+      {
+        tables_last_use[this->nodes] = ++tables_use_counter;
+        if(this->total_mem > table_memory_limit)
+          enforce_table_memory_limit();
+      }
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::set_table_memory_limit(int max_bytes)
+    {
+      table_memory_limit = max_bytes;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::remap_element_ids(const std::vector<int>& element_ids)
+    {
+      if(sln_type != HERMES_SLN || elem_orders == NULL)
+        return;
+      if(coeffs_borrowed)
+        throw Hermes::Exceptions::Exception("Solution::remap_element_ids() can not be called for a clone.");
+      this->finish_lazy_conversion();
+
+      // The new ids are never greater than the old ones, the data move to the front in place.
+      int count = std::min(num_elems, (int)element_ids.size());
+      for (int id = 0; id < count; id++)
+      {
+        int new_id = element_ids[id];
+        if(new_id < 0 || new_id == id)
+          continue;
+        elem_orders[new_id] = elem_orders[id];
+        for (int l = 0; l < this->num_components; l++)
+          elem_coeffs[l][new_id] = elem_coeffs[l][id];
+      }
+
+      // The element pointers of the tables are not valid any more.
+      this->free_tables();
+      this->element = NULL;
+      this->e_last = NULL;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::free_sub_table(LightArray<struct Function<Scalar>::Node*>* sub_table)
+    {
+      for(unsigned int l = 0; l < sub_table->get_size(); l++)
+        if(sub_table->present(l))
+          this->release_node(sub_table->get(l));
+      tables_last_use.erase(sub_table);
+      delete sub_table;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::enforce_table_memory_limit()
+    {
+      while(this->total_mem > table_memory_limit)
+      {
+        // The least recently used sub-element table of the active quadrature, other than the current one.
+        std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>* lru_map = NULL;
+        typename std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>::iterator lru_it;
+        unsigned int lru_use = 0;
+        for(int j = 0; j < H2D_SOLUTION_ELEMENT_CACHE_SIZE; j++)
+        {
+          std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>* map = tables[this->cur_quad][j];
+          if(map == NULL)
+            continue;
+          for(typename std::map<uint64_t, LightArray<struct Function<Scalar>::Node*>*>::iterator it = map->begin(); it != map->end(); it++)
+          {
+            if(it->second == this->nodes)
+              continue;
+            typename std::map<LightArray<struct Function<Scalar>::Node*>*, unsigned int>::iterator use = tables_last_use.find(it->second);
+            // Tables filled before the limit was set count as the oldest ones.
+            unsigned int last_use = (use == tables_last_use.end()) ? 0 : use->second;
+            if(lru_map == NULL || last_use < lru_use)
+            {
+              lru_map = map;
+              lru_it = it;
+              lru_use = last_use;
+            }
+          }
+        }
+        if(lru_map == NULL)
+          break;
+        free_sub_table(lru_it->second);
+        lru_map->erase(lru_it);
+      }
+    }
+
+    static const char binary_solution_magic[8] = { 'H', '2', 'D', 'S', 'L', 'N', 'B', 1 };
+
+    // The arrays of the binary file start at multiples of 8 bytes.
+    static size_t aligned(size_t bytes)
+    {
+      return (bytes + 7) & ~((size_t) 7);
+    }
+
+    // Solution::load() reads the files of Solution::save_binary(), too.
+    static bool is_binary_solution_file(const char* filename)
+    {
+      char magic[8];
+      FILE* f = fopen(filename, "rb");
+      if(f == NULL)
+        return false;
+      bool binary = fread(magic, 1, 8, f) == 8 && memcmp(magic, binary_solution_magic, 7) == 0;
+      fclose(f);
+      return binary;
     }
 
     template<>
@@ -1222,6 +1552,9 @@ namespace Hermes
       if(sln_type == HERMES_UNDEF)
         throw Exceptions::Exception("Cannot save -- uninitialized solution.");
 
+      // All the coefficients are saved, the lazily converted Solution is the same one afterwards.
+      const_cast<Solution<double>*>(this)->finish_lazy_conversion();
+
       try
       {
         XMLSolution::solution xmlsolution(this->num_components, this->num_elems, this->num_coeffs, 0, 0);
@@ -1282,6 +1615,9 @@ namespace Hermes
       if(sln_type == HERMES_UNDEF)
         throw Exceptions::Exception("Cannot save -- uninitialized solution.");
 
+      // All the coefficients are saved, the lazily converted Solution is the same one afterwards.
+      const_cast<Solution<std::complex<double> >*>(this)->finish_lazy_conversion();
+
       try
       {
         XMLSolution::solution xmlsolution(this->num_components, this->num_elems, this->num_coeffs, 0, 1);
@@ -1340,13 +1676,134 @@ namespace Hermes
       return;
     }
 
+    static void stream_scalar(double& value, double re, double im)
+    {
+      value = re;
+    }
+
+    static void stream_scalar(std::complex<double>& value, double re, double im)
+    {
+      value = std::complex<double>(re, im);
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::load_stream(const char* filename, Space<Scalar>* space)
+    {
+      XMLStreamReader reader(filename);
+      if(!reader.next() || reader.name() != "solution")
+        throw Hermes::Exceptions::SolutionLoadFailureException("The file %s is not a solution file.", filename);
+
+      bool is_complex = (sizeof(Scalar) == sizeof(std::complex<double>));
+      sln_type = reader.int_attribute("exact") == 0 ? HERMES_SLN : HERMES_EXACT;
+
+      if(sln_type == HERMES_EXACT)
+      {
+        if(reader.int_attribute("exactC") != (is_complex ? 1 : 0))
+          throw Hermes::Exceptions::SolutionLoadFailureException("Mismatched real - complex exact solutions.");
+
+        Scalar x_value, y_value;
+        stream_scalar(x_value, reader.double_attribute("exactCXR"), is_complex ? reader.double_attribute("exactCXC") : 0.0);
+        int ncmp = reader.int_attribute("ncmp");
+        if(ncmp == 2)
+          stream_scalar(y_value, reader.double_attribute("exactCYR"), is_complex ? reader.double_attribute("exactCYC") : 0.0);
+        if(ncmp == 1 || ncmp == 2)
+        {
+          Scalar* coeff_vec = new Scalar[space->get_num_dofs()];
+          OGProjection<Scalar> ogProj;
+          if(ncmp == 1)
+          {
+            ConstantSolution<Scalar> sln(mesh, x_value);
+            ogProj.project_global(space, &sln, coeff_vec);
+          }
+          else
+          {
+            ConstantSolutionVector<Scalar> sln(mesh, x_value, y_value);
+            ogProj.project_global(space, &sln, coeff_vec);
+          }
+          this->set_coeff_vector(space, coeff_vec, true, 0);
+          delete [] coeff_vec;
+          sln_type = HERMES_SLN;
+        }
+        return;
+      }
+
+      if(reader.has_attribute("space"))
+      {
+        const std::string& space_name = reader.attribute("space");
+        if((space_name == "h1" && this->space_type != HERMES_H1_SPACE) || (space_name == "l2" && this->space_type != HERMES_L2_SPACE)
+          || (space_name == "hcurl" && this->space_type != HERMES_HCURL_SPACE) || (space_name == "hdiv" && this->space_type != HERMES_HDIV_SPACE))
+          throw Exceptions::Exception("Space types not compliant in Solution::load().");
+      }
+
+      this->num_coeffs = reader.int_attribute("nc");
+      this->num_elems = reader.int_attribute("nel");
+      this->num_components = reader.int_attribute("ncmp");
+      if(this->num_coeffs < 0 || this->num_elems < 0 || this->num_components < 0 || this->num_components > H2D_MAX_SOLUTION_COMPONENTS)
+        throw Hermes::Exceptions::SolutionLoadFailureException("Invalid sizes in the file %s.", filename);
+
+      this->mono_coeffs = new Scalar[num_coeffs];
+      memset(this->mono_coeffs, 0, this->num_coeffs*sizeof(Scalar));
+
+      for(unsigned int component_i = 0; component_i < num_components; component_i++)
+        elem_coeffs[component_i] = new int[num_elems];
+
+      this->elem_orders = new int[num_elems];
+
+      // The coefficients go directly to their places, the elem_coeffs to the last component started.
+      int component_i = -1;
+      while (reader.next())
+      {
+        const std::string& name = reader.name();
+        if(name == "mono_coeffs")
+        {
+          int id = reader.int_attribute("id");
+          if(id < 0 || id >= this->num_coeffs)
+            throw Hermes::Exceptions::SolutionLoadFailureException("Coefficient %d out of range in the file %s.", id, filename);
+          stream_scalar(this->mono_coeffs[id], reader.double_attribute("re"), is_complex ? reader.double_attribute("im") : 0.0);
+        }
+        else if(name == "elem_orders")
+        {
+          int id = reader.int_attribute("id");
+          if(id < 0 || id >= this->num_elems)
+            throw Hermes::Exceptions::SolutionLoadFailureException("Element %d out of range in the file %s.", id, filename);
+          this->elem_orders[id] = reader.int_attribute("ord");
+        }
+        else if(name == "component")
+        {
+          if(++component_i >= (int)this->num_components)
+            throw Hermes::Exceptions::SolutionLoadFailureException("Too many components in the file %s.", filename);
+        }
+        else if(name == "elem_coeffs")
+        {
+          int id = reader.int_attribute("id");
+          if(component_i < 0 || id < 0 || id >= this->num_elems)
+            throw Hermes::Exceptions::SolutionLoadFailureException("Element coefficients %d out of range in the file %s.", id, filename);
+          this->elem_coeffs[component_i][id] = reader.int_attribute("c");
+        }
+      }
+
+      init_dxdy_buffer();
+    }
+
     template<>
     void Solution<double>::load(const char* filename, Space<double>* space)
     {
+      if(is_binary_solution_file(filename))
+      {
+        load_binary(filename, space);
+        return;
+      }
+
       free();
       this->mesh = space->get_mesh();
       this->space_type = space->get_type();
 
+      if(!this->validate && Hermes2DApi.get_xml_streaming())
+      {
+        load_stream(filename, space);
+        return;
+      }
+
 			try
       {
         ::xml_schema::flags parsing_flags = 0;
@@ -1441,10 +1898,22 @@ namespace Hermes
     template<>
     void Solution<std::complex<double> >::load(const char* filename, Space<std::complex<double> >* space)
     {
+      if(is_binary_solution_file(filename))
+      {
+        load_binary(filename, space);
+        return;
+      }
+
       free();
       sln_type = HERMES_SLN;
       this->mesh = space->get_mesh();
       this->space_type = space->get_type();
+
+      if(!this->validate && Hermes2DApi.get_xml_streaming())
+      {
+        load_stream(filename, space);
+        return;
+      }
       
       try
       {
@@ -1543,6 +2012,114 @@ namespace Hermes
       return;
     }
 
+    template<typename Scalar>
+    void Solution<Scalar>::save_binary(const char* filename) const
+    {
+      if(sln_type != HERMES_SLN)
+        throw Exceptions::Exception("Only solutions given by element coefficients can be saved by Solution::save_binary().");
+
+      // All the coefficients are saved, the lazily converted Solution is the same one afterwards.
+      const_cast<Solution<Scalar>*>(this)->finish_lazy_conversion();
+
+      BinaryHeader header;
+      memset(&header, 0, sizeof(BinaryHeader));
+      memcpy(header.magic, binary_solution_magic, 8);
+      header.scalar_size = sizeof(Scalar);
+      header.space_type = this->space_type;
+      header.num_components = this->num_components;
+      header.num_elems = this->num_elems;
+      header.num_coeffs = this->num_coeffs;
+
+      FILE* f = fopen(filename, "wb");
+      if(f == NULL)
+        throw Hermes::Exceptions::SolutionSaveFailureException("Could not create the solution file %s.", filename);
+
+      static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      size_t elems_bytes = this->num_elems * sizeof(int);
+      bool ok = fwrite(&header, 1, sizeof(BinaryHeader), f) == sizeof(BinaryHeader);
+      if(this->num_coeffs > 0)
+        ok = ok && fwrite(this->mono_coeffs, sizeof(Scalar), this->num_coeffs, f) == (size_t) this->num_coeffs;
+      if(this->num_elems > 0)
+      {
+        ok = ok && fwrite(this->elem_orders, 1, elems_bytes, f) == elems_bytes;
+        ok = ok && fwrite(zeros, 1, aligned(elems_bytes) - elems_bytes, f) == aligned(elems_bytes) - elems_bytes;
+        for (int component_i = 0; component_i < this->num_components; component_i++)
+          ok = ok && fwrite(this->elem_coeffs[component_i], 1, elems_bytes, f) == elems_bytes;
+      }
+      fclose(f);
+      if(!ok)
+        throw Hermes::Exceptions::SolutionSaveFailureException("Error writing the solution file %s.", filename);
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::load_binary(const char* filename, Space<Scalar>* space)
+    {
+      FILE* f = fopen(filename, "rb");
+      if(f == NULL)
+        throw Hermes::Exceptions::SolutionLoadFailureException("Solution file %s not found.", filename);
+
+      BinaryHeader header;
+      if(fread(&header, 1, sizeof(BinaryHeader), f) != sizeof(BinaryHeader) || memcmp(header.magic, binary_solution_magic, 7) != 0)
+      {
+        fclose(f);
+        throw Hermes::Exceptions::SolutionLoadFailureException("File %s: not a binary Hermes2D solution.", filename);
+      }
+      if(header.magic[7] != binary_solution_magic[7])
+      {
+        fclose(f);
+        throw Hermes::Exceptions::SolutionLoadFailureException("File %s: unsupported version of the binary solution format.", filename);
+      }
+      if(header.scalar_size != sizeof(Scalar))
+      {
+        fclose(f);
+        throw Hermes::Exceptions::SolutionLoadFailureException("Mismatched real - complex solution in the file %s.", filename);
+      }
+      if(header.num_coeffs < 0 || header.num_elems < 0 || header.num_components < 1 || header.num_components > H2D_MAX_SOLUTION_COMPONENTS)
+      {
+        fclose(f);
+        throw Hermes::Exceptions::SolutionLoadFailureException("Invalid sizes in the file %s.", filename);
+      }
+      if(header.space_type != space->get_type())
+      {
+        fclose(f);
+        throw Exceptions::Exception("Space types not compliant in Solution::load_binary().");
+      }
+
+      free();
+      this->mesh = space->get_mesh();
+      this->space_type = space->get_type();
+      this->sln_type = HERMES_SLN;
+      this->num_coeffs = header.num_coeffs;
+      this->num_elems = header.num_elems;
+      this->num_components = header.num_components;
+
+      this->mono_coeffs = new Scalar[this->num_coeffs];
+      this->elem_orders = new int[this->num_elems];
+      for (int component_i = 0; component_i < this->num_components; component_i++)
+        this->elem_coeffs[component_i] = new int[this->num_elems];
+
+      size_t elems_bytes = this->num_elems * sizeof(int);
+      bool ok = fread(this->mono_coeffs, sizeof(Scalar), this->num_coeffs, f) == (size_t) this->num_coeffs;
+      if(this->num_elems > 0)
+      {
+        ok = ok && fread(this->elem_orders, 1, elems_bytes, f) == elems_bytes;
+        ok = ok && fseek(f, aligned(elems_bytes) - elems_bytes, SEEK_CUR) == 0;
+        for (int component_i = 0; component_i < this->num_components; component_i++)
+          ok = ok && fread(this->elem_coeffs[component_i], 1, elems_bytes, f) == elems_bytes;
+      }
+      fclose(f);
+      if(!ok)
+        throw Hermes::Exceptions::SolutionLoadFailureException("Error reading the file %s.", filename);
+
+      // The element coefficients have to point into mono_coeffs.
+      for (int component_i = 0; component_i < this->num_components; component_i++)
+        for (int elems_i = 0; elems_i < this->num_elems; elems_i++)
+          if(this->elem_coeffs[component_i][elems_i] < 0 || this->elem_coeffs[component_i][elems_i] > this->num_coeffs)
+            throw Hermes::Exceptions::SolutionLoadFailureException("Element coefficients %d out of range in the file %s.", elems_i, filename);
+
+      init_dxdy_buffer();
+    }
+
     template<typename Scalar>
     Scalar Solution<Scalar>::get_ref_value(Element* e, double xi1, double xi2, int component, int item)
     {
@@ -1550,6 +2127,8 @@ namespace Hermes
         throw Exceptions::NullException(1);
 
       set_active_element(e);
+      if(dxdy_pending)
+        set_dxdy_coeffs();
 
       int o = elem_orders[e->id];
       Scalar* mono = dxdy_coeffs[component][item];
@@ -1632,6 +2211,8 @@ namespace Hermes
     Scalar** Solution<Scalar>::get_ref_values_transformed(Element* e, double x, double y)
     {
       set_active_element(e);
+      if(dxdy_pending)
+        set_dxdy_coeffs();
 
       double x_ref, y_ref;
       double x_dummy, y_dummy;
@@ -1804,6 +2385,363 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    void Solution<Scalar>::get_pt_values(int n, const double* x, const double* y, Func<Scalar>** values)
+    {
+      if(sln_type != HERMES_SLN)
+      {
+        MeshFunction<Scalar>::get_pt_values(n, x, y, values);
+        return;
+      }
+
+      Element* e = NULL;
+      for (int i = 0; i < n; i++)
+      {
+        double xi1, xi2;
+        if(e == NULL || !RefMap::is_element_on_physical_coordinates(e, x[i], y[i], &xi1, &xi2))
+          e = RefMap::element_on_physical_coordinates(this->mesh, x[i], y[i]);
+        // The point outside of the mesh has been reported by the lookup.
+        values[i] = (e == NULL) ? NULL : this->get_pt_value(x[i], y[i], e);
+      }
+    }
+
+    template<typename Scalar>
+    Func<Scalar>* Solution<Scalar>::get_pt_values(int n, const double* x, const double* y, bool* found)
+    {
+      if(sln_type != HERMES_SLN)
+        return MeshFunction<Scalar>::get_pt_values(n, x, y, found);
+
+      // Locate all the points, (element id, point) pairs sorted to visit each element once.
+      std::vector<double> xi1(n), xi2(n);
+      std::vector<std::pair<int, int> > points;
+      points.reserve(n);
+      Element* e = NULL;
+      for (int i = 0; i < n; i++)
+      {
+        if(e == NULL || !RefMap::is_element_on_physical_coordinates(e, x[i], y[i], &xi1[i], &xi2[i]))
+          e = RefMap::element_on_physical_coordinates(this->mesh, x[i], y[i], &xi1[i], &xi2[i]);
+        if(found != NULL)
+          found[i] = (e != NULL);
+        if(e != NULL)
+          points.push_back(std::pair<int, int>(e->id, i));
+      }
+      std::sort(points.begin(), points.end());
+
+      Func<Scalar>* values = this->init_pt_values(n);
+      for (unsigned int first = 0, last; first < points.size(); first = last)
+      {
+        for (last = first + 1; last < points.size() && points[last].first == points[first].first; last++);
+        e = this->mesh->get_element(points[first].first);
+        set_active_element(e);
+        if(dxdy_pending)
+          set_dxdy_coeffs();
+
+        // The inverse reference map of an affine element is the same in all its points.
+        bool const_jacobian = this->refmap->is_jacobian_const();
+        double2x2 m;
+        double xx, yy;
+        for (unsigned int k = first; k < last; k++)
+        {
+          int i = points[k].second;
+          if(!const_jacobian || k == first)
+            this->refmap->inv_ref_map_at_point(xi1[i], xi2[i], xx, yy, m);
+          if(this->num_components == 1)
+          {
+            values->val[i] = get_ref_value(e, xi1[i], xi2[i], 0, 0);
+            Scalar dx = get_ref_value(e, xi1[i], xi2[i], 0, 1);
+            Scalar dy = get_ref_value(e, xi1[i], xi2[i], 0, 2);
+            values->dx[i] = m[0][0]*dx + m[0][1]*dy;
+            values->dy[i] = m[1][0]*dx + m[1][1]*dy;
+          }
+          else
+          {
+            Scalar vx = get_ref_value(e, xi1[i], xi2[i], 0, 0);
+            Scalar vy = get_ref_value(e, xi1[i], xi2[i], 1, 0);
+            values->val0[i] = m[0][0]*vx + m[0][1]*vy;
+            values->val1[i] = m[1][0]*vx + m[1][1]*vy;
+          }
+        }
+      }
+      return values;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::transfer_to(const Space<Scalar>* space, Solution<Scalar>* target, ProjNormType proj_norm)
+    {
+      if(target == NULL)
+        throw Exceptions::NullException(2);
+      Scalar* coeff_vec = new Scalar[space->get_num_dofs()];
+      transfer_to(space, coeff_vec, proj_norm);
+      Solution<Scalar>::vector_to_solution(coeff_vec, space, target);
+      delete [] coeff_vec;
+    }
+
+    template<typename Scalar>
+    void Solution<Scalar>::transfer_to(const Space<Scalar>* space, Scalar* coeff_vec, ProjNormType proj_norm)
+    {
+      if(space == NULL)
+        throw Exceptions::NullException(1);
+      if(coeff_vec == NULL)
+        throw Exceptions::NullException(2);
+      if(!space->is_up_to_date())
+        throw Exceptions::Exception("Provided 'space' is not up to date.");
+      if(sln_type == HERMES_UNDEF)
+        throw Exceptions::Exception("Cannot transfer an uninitialized solution.");
+
+      bool vector_valued = space->get_shapeset()->get_num_components() > 1;
+      if(vector_valued != (this->num_components > 1))
+        throw Exceptions::Exception("Solution::transfer_to(): the space and the solution have different numbers of components.");
+      if(proj_norm == HERMES_UNSET_NORM)
+        proj_norm = (space->get_type() == HERMES_H1_SPACE) ? HERMES_H1_NORM : HERMES_L2_NORM;
+      if(proj_norm != HERMES_L2_NORM && !(proj_norm == HERMES_H1_NORM && !vector_valued))
+        throw Exceptions::Exception("Solution::transfer_to() projects in the L2 norm, or in the H1 norm for scalar functions.");
+      bool h1 = (proj_norm == HERMES_H1_NORM);
+
+      Element* e;
+      std::vector<Element*> elements;
+      for_all_active_elements(e, space->get_mesh())
+        elements.push_back(e);
+      int num_elements = (int)elements.size();
+      int num_threads_used = Hermes2DApi.get_num_threads();
+
+      // The integration points of all the elements, this function is evaluated in all of them at once.
+      std::vector<int> orders(num_elements), offsets(num_elements + 1);
+      std::vector<std::vector<double> > points(num_elements);
+#pragma omp parallel num_threads(num_threads_used)
+      {
+        RefMap rm;
+        rm.set_quad_2d(&g_quad_2d_std);
+#pragma omp for schedule(dynamic, 16)
+        for (int j = 0; j < num_elements; j++)
+        {
+          rm.set_active_element(elements[j]);
+          int p = space->get_element_order(elements[j]->id);
+          int o = 2 * std::max(H2D_GET_H_ORDER(p), H2D_GET_V_ORDER(p)) + rm.get_inv_ref_order();
+          limit_order_nowarn(o, elements[j]->get_mode());
+          orders[j] = o;
+          int np = g_quad_2d_std.get_num_points(o, elements[j]->get_mode());
+          double* x = rm.get_phys_x(o);
+          double* y = rm.get_phys_y(o);
+          points[j].resize(2 * np);
+          memcpy(&points[j][0], x, np * sizeof(double));
+          memcpy(&points[j][np], y, np * sizeof(double));
+        }
+      }
+      offsets[0] = 0;
+      for (int j = 0; j < num_elements; j++)
+        offsets[j + 1] = offsets[j] + (int)points[j].size() / 2;
+      std::vector<double> x(offsets[num_elements]), y(offsets[num_elements]);
+      for (int j = 0; j < num_elements; j++)
+      {
+        int np = offsets[j + 1] - offsets[j];
+        memcpy(&x[offsets[j]], &points[j][0], np * sizeof(double));
+        memcpy(&y[offsets[j]], &points[j][np], np * sizeof(double));
+        std::vector<double>().swap(points[j]);
+      }
+      bool* found = new bool[offsets[num_elements]];
+      Func<Scalar>* values = this->get_pt_values(offsets[num_elements], &x[0], &y[0], found);
+
+      // The local projections, the DOFs each element determines on its own, with their values.
+      std::vector<std::vector<std::pair<int, Scalar> > > element_dofs(num_elements);
+#pragma omp parallel num_threads(num_threads_used)
+      {
+        RefMap rm;
+        rm.set_quad_2d(&g_quad_2d_std);
+        PrecalcShapeset pss(space->get_shapeset());
+        pss.set_quad_2d(&g_quad_2d_std);
+        AsmList<Scalar> al;
+        std::vector<Scalar> rhs;
+
+        // The factorized L2 mass matrices of the reference elements, by (mode, order, shape functions and their unknowns).
+        // On an affine element the mass matrix is that of the reference element times the constant jacobian, all the elements
+        // of the same order (and edge orientations) share it.
+        std::map<std::vector<int>, std::pair<double**, int*> > mass_lu;
+
+#pragma omp for schedule(dynamic, 16)
+        for (int j = 0; j < num_elements; j++)
+        {
+          Element* e = elements[j];
+          int o = orders[j];
+          int np = offsets[j + 1] - offsets[j], first = offsets[j];
+          space->get_element_assembly_list(e, &al);
+          rm.set_active_element(e);
+          pss.set_active_element(e);
+
+          double* jac = rm.is_jacobian_const() ? NULL : rm.get_jacobian(o);
+          double3* pt = g_quad_2d_std.get_points(o, e->get_mode());
+          std::vector<double> w(np);
+          for (int i = 0; i < np; i++)
+            w[i] = found[first + i] ? pt[i][2] * (jac == NULL ? rm.get_const_jacobian() : jac[i]) : 0.0;
+
+          // The shape functions of the element, unknowns are those with a DOF (the others belong to the Dirichlet lift).
+          std::vector<int> shapes, unknown;
+          std::vector<Func<double>*> fns;
+          int n = 0;
+          for (unsigned int k = 0; k < al.cnt; k++)
+          {
+            unsigned int s = 0;
+            while(s < shapes.size() && shapes[s] != al.idx[k])
+              s++;
+            if(s == shapes.size())
+            {
+              shapes.push_back(al.idx[k]);
+              unknown.push_back(-1);
+              pss.set_active_shape(al.idx[k]);
+              fns.push_back(init_fn(&pss, &rm, o));
+            }
+            if(al.dof[k] >= 0 && unknown[s] < 0)
+              unknown[s] = n++;
+          }
+
+          // The function minus the Dirichlet lift.
+          std::vector<Scalar> f(3 * np);
+          for (int i = 0; i < np; i++)
+          {
+            f[i] = vector_valued ? values->val0[first + i] : values->val[first + i];
+            f[np + i] = vector_valued ? values->val1[first + i] : values->dx[first + i];
+            f[2 * np + i] = vector_valued ? 0.0 : values->dy[first + i];
+          }
+          for (unsigned int k = 0; k < al.cnt; k++)
+            if(al.dof[k] < 0)
+            {
+              unsigned int s = std::find(shapes.begin(), shapes.end(), al.idx[k]) - shapes.begin();
+              Func<double>* fn = fns[s];
+              for (int i = 0; i < np; i++)
+              {
+                f[i] -= al.coef[k] * (vector_valued ? fn->val0[i] : fn->val[i]);
+                f[np + i] -= al.coef[k] * (vector_valued ? fn->val1[i] : fn->dx[i]);
+                if(!vector_valued)
+                  f[2 * np + i] -= al.coef[k] * fn->dy[i];
+              }
+            }
+
+          if(n > 0)
+          {
+            bool cacheable = !h1 && !vector_valued && jac == NULL;
+            for (int i = 0; i < np && cacheable; i++)
+              cacheable = found[first + i];
+            double scale = cacheable ? rm.get_const_jacobian() : 1.0;
+
+            double** mat = NULL;
+            int* perm = NULL;
+            std::vector<int> key;
+            if(cacheable)
+            {
+              key.push_back(e->get_mode());
+              key.push_back(o);
+              for (unsigned int a = 0; a < shapes.size(); a++)
+              {
+                key.push_back(shapes[a]);
+                key.push_back(unknown[a]);
+              }
+              typename std::map<std::vector<int>, std::pair<double**, int*> >::iterator it = mass_lu.find(key);
+              if(it != mass_lu.end())
+              {
+                mat = it->second.first;
+                perm = it->second.second;
+              }
+            }
+            bool factorized = (mat != NULL);
+            if(!factorized)
+              mat = new_matrix<double>(n, n);
+
+            rhs.assign(n, Scalar(0.0));
+            for (unsigned int a = 0; a < shapes.size(); a++)
+            {
+              if(unknown[a] < 0)
+                continue;
+              Func<double>* fa = fns[a];
+              for (unsigned int b = 0; b < shapes.size() && !factorized; b++)
+              {
+                if(unknown[b] < 0)
+                  continue;
+                Func<double>* fb = fns[b];
+                double m = 0.0;
+                for (int i = 0; i < np; i++)
+                {
+                  if(vector_valued)
+                    m += w[i] * (fa->val0[i] * fb->val0[i] + fa->val1[i] * fb->val1[i]);
+                  else
+                    m += w[i] * (fa->val[i] * fb->val[i] + (h1 ? fa->dx[i] * fb->dx[i] + fa->dy[i] * fb->dy[i] : 0.0));
+                }
+                mat[unknown[a]][unknown[b]] = m / scale;
+              }
+              Scalar r = 0.0;
+              for (int i = 0; i < np; i++)
+              {
+                if(vector_valued)
+                  r += w[i] * (f[i] * fa->val0[i] + f[np + i] * fa->val1[i]);
+                else
+                  r += w[i] * (f[i] * fa->val[i] + (h1 ? f[np + i] * fa->dx[i] + f[2 * np + i] * fa->dy[i] : Scalar(0.0)));
+              }
+              rhs[unknown[a]] = r / scale;
+            }
+            if(!factorized)
+            {
+              perm = new int[n];
+              double d;
+              ludcmp(mat, n, perm, &d);
+              if(cacheable)
+                mass_lu.insert(std::make_pair(key, std::make_pair(mat, perm)));
+            }
+            lubksb(mat, n, perm, &rhs[0]);
+
+            // The DOFs the element determines alone: the only one of a shape function that has no other one.
+            for (unsigned int k = 0; k < al.cnt; k++)
+            {
+              if(al.dof[k] < 0 || al.coef[k] == 0.0)
+                continue;
+              bool single = true;
+              for (unsigned int l = 0; l < al.cnt && single; l++)
+                if(l != k && (al.idx[l] == al.idx[k] || al.dof[l] == al.dof[k]))
+                  single = false;
+              if(single)
+              {
+                unsigned int s = std::find(shapes.begin(), shapes.end(), al.idx[k]) - shapes.begin();
+                element_dofs[j].push_back(std::pair<int, Scalar>(al.dof[k] - space->first_dof, rhs[unknown[s]] / al.coef[k]));
+              }
+            }
+
+            if(!cacheable)
+            {
+              delete [] mat;
+              delete [] perm;
+            }
+          }
+
+          for (unsigned int s = 0; s < fns.size(); s++)
+          {
+            fns[s]->free_fn();
+            delete fns[s];
+          }
+        }
+
+        for (typename std::map<std::vector<int>, std::pair<double**, int*> >::iterator it = mass_lu.begin(); it != mass_lu.end(); it++)
+        {
+          delete [] it->second.first;
+          delete [] it->second.second;
+        }
+      }
+
+      values->free_fn();
+      delete values;
+      delete [] found;
+
+      // Averages of the element values of the shared DOFs.
+      int ndof = space->get_num_dofs();
+      std::vector<int> counts(ndof, 0);
+      memset(coeff_vec, 0, ndof * sizeof(Scalar));
+      for (int j = 0; j < num_elements; j++)
+        for (unsigned int k = 0; k < element_dofs[j].size(); k++)
+        {
+          coeff_vec[element_dofs[j][k].first] += element_dofs[j][k].second;
+          counts[element_dofs[j][k].first]++;
+        }
+      for (int i = 0; i < ndof; i++)
+        if(counts[i] > 1)
+          coeff_vec[i] /= (double)counts[i];
+    }
+
     template class HERMES_API Solution<double>;
     template class HERMES_API Solution<std::complex<double> >;
   }
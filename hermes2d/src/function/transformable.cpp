@@ -84,7 +84,7 @@ namespace Hermes
 
     void Transformable::set_transform(uint64_t idx)
     {
-      int son[25];
+      int son[H2D_MAX_TRN_LEVEL + 4];
       int i = 0;
       while (idx > 0)
       {
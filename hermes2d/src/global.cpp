@@ -23,6 +23,7 @@
 #include "quadrature/limit_order.h"
 #include "integrals/h1.h"
 #include "discrete_problem.h"
+#include "api2d.h"
 
 namespace Hermes
 {
@@ -33,65 +34,213 @@ namespace Hermes
     template<typename Scalar>
     double Global<Scalar>::get_l2_norm(Vector<Scalar>* vec)
     {
-      Scalar val = 0;
-      for (unsigned int i = 0; i < vec->length(); i++)
+      return Hermes::Algebra::VectorKernels::nrm2(vec);
+    }
+
+    template<typename Scalar>
+    double Global<Scalar>::error_fn(int norm_type, MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, RefMap* ru, RefMap* rv)
+    {
+      switch (norm_type)
       {
-        Scalar inc = vec->get(i);
-        val = val + inc*conj(inc);
+      case HERMES_L2_NORM:
+        return error_fn_l2(sln1, sln2, ru, rv);
+      case HERMES_H1_NORM:
+        return error_fn_h1(sln1, sln2, ru, rv);
+      case HERMES_HCURL_NORM:
+        return error_fn_hc(sln1, sln2, ru, rv);
+      case HERMES_HDIV_NORM:
+        return error_fn_hdiv(sln1, sln2, ru, rv);
+      default: throw Hermes::Exceptions::Exception("Unknown norm in calc_error().");
       }
-      return sqrt(std::abs(val));
     }
 
     template<typename Scalar>
-    double Global<Scalar>::calc_abs_error(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, int norm_type)
+    double Global<Scalar>::norm_fn(int norm_type, MeshFunction<Scalar>* sln, RefMap* ru)
     {
-      // sanity checks
-      if(sln1 == NULL) throw Hermes::Exceptions::Exception("sln1 is NULL in calc_abs_error().");
-      if(sln2 == NULL) throw Hermes::Exceptions::Exception("sln2 is NULL in calc_abs_error().");
+      switch (norm_type)
+      {
+      case HERMES_L2_NORM:
+        return norm_fn_l2(sln, ru);
+      case HERMES_H1_NORM:
+        return norm_fn_h1(sln, ru);
+      case HERMES_HCURL_NORM:
+        return norm_fn_hc(sln, ru);
+      case HERMES_HDIV_NORM:
+        return norm_fn_hdiv(sln, ru);
+      default: throw Hermes::Exceptions::Exception("Unknown norm in calc_norm().");
+      }
+    }
 
-      Quad2D* quad = &g_quad_2d_std;
-      sln1->set_quad_2d(quad);
-      sln2->set_quad_2d(quad);
+    template<typename Scalar>
+    void Global<Scalar>::calc_errors_and_norms(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, const Hermes::vector<int>& norm_types, double* errors, double* norms)
+    {
+      int num_norms = norm_types.size();
+      for (int k = 0; k < num_norms; k++)
+      {
+        // Unknown norms before any traversal.
+        if(norm_types[k] != HERMES_L2_NORM && norm_types[k] != HERMES_H1_NORM && norm_types[k] != HERMES_HCURL_NORM && norm_types[k] != HERMES_HDIV_NORM)
+          throw Hermes::Exceptions::Exception(errors != NULL ? "Unknown norm in calc_error()." : "Unknown norm in calc_norm().");
+      }
+
+      Hermes::vector<const Mesh*> meshes;
+      if(sln1 != NULL)
+        meshes.push_back(sln1->get_mesh());
+      meshes.push_back(sln2->get_mesh());
 
-      const Mesh* meshes[2] = { sln1->get_mesh(), sln2->get_mesh() };
-      Transformable* tr[2] = { sln1, sln2 };
-      Traverse trav(true);
-      trav.begin(2, meshes, tr);
+      Traverse trav_master(true);
+      int num_states;
+      Traverse::State** states = trav_master.get_states(meshes, num_states);
 
-      double error = 0.0;
-      Traverse::State* ee;
-      while ((ee = trav.get_next_state()) != NULL)
+      // The functions of the threads - the first one uses the functions themselves, the others their clones
+      // (one thread only if the functions can not be cloned).
+      int num_threads_used = std::max(1, std::min(num_states, (int)Hermes2DApi.get_num_threads()));
+      std::vector<std::vector<Transformable*> > fns(num_threads_used);
+      for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
       {
-        update_limit_table(ee->e[0]->get_mode());
+        for (int fn_i = 0; fn_i < (int)meshes.size(); fn_i++)
+        {
+          MeshFunction<Scalar>* fn = (sln1 != NULL && fn_i == 0) ? sln1 : sln2;
+          if(thread_i > 0)
+          {
+            try
+            {
+              fn = fn->clone();
+            }
+            catch(std::exception&)
+            {
+              fn = NULL;
+            }
+          }
+          if(fn == NULL)
+          {
+            for (int fn_j = 0; fn_j < fn_i; fn_j++)
+              delete fns[thread_i][fn_j];
+            fns.resize(thread_i);
+            num_threads_used = thread_i;
+            break;
+          }
+          fn->set_quad_2d(&g_quad_2d_std);
+          fns[thread_i].push_back(fn);
+        }
+      }
+
+      Traverse* trav = new Traverse[num_threads_used];
+      for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+        trav[thread_i].begin(meshes.size(), &(meshes.front()), &(fns[thread_i].front()));
+
+      // Contributions of the states, summed in their order afterwards.
+      std::vector<double> state_errors(errors != NULL ? num_states * num_norms : 0, 0.0);
+      std::vector<double> state_norms(norms != NULL ? num_states * num_norms : 0, 0.0);
+      Hermes::Exceptions::Exception* caughtException = NULL;
 
-        RefMap* ru = sln1->get_refmap();
-        RefMap* rv = sln2->get_refmap();
-        switch (norm_type)
+      int state_i;
+#pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads_used)
+      for (state_i = 0; state_i < num_states; state_i++)
+      {
+        if(caughtException != NULL)
+          continue;
+        try
+        {
+          int thread_i = omp_get_thread_num();
+          trav[thread_i].set_active_state(states[state_i]);
+          MeshFunction<Scalar>* fn1 = static_cast<MeshFunction<Scalar>*>(fns[thread_i].front());
+          MeshFunction<Scalar>* fn2 = static_cast<MeshFunction<Scalar>*>(fns[thread_i].back());
+          for (int k = 0; k < num_norms; k++)
+          {
+            if(errors != NULL)
+              state_errors[state_i * num_norms + k] = error_fn(norm_types[k], fn1, fn2, fn1->get_refmap(), fn2->get_refmap());
+            if(norms != NULL)
+              state_norms[state_i * num_norms + k] = norm_fn(norm_types[k], fn2, fn2->get_refmap());
+          }
+        }
+        catch(Hermes::Exceptions::Exception& e)
+        {
+#pragma omp critical (calc_errors_exception)
+          if(caughtException == NULL)
+            caughtException = e.clone();
+        }
+        catch(std::exception& e)
+        {
+#pragma omp critical (calc_errors_exception)
+          if(caughtException == NULL)
+            caughtException = new Hermes::Exceptions::Exception(e.what());
+        }
+      }
+
+      for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+      {
+        trav[thread_i].finish();
+        if(thread_i > 0)
+          for (unsigned int fn_i = 0; fn_i < fns[thread_i].size(); fn_i++)
+            delete fns[thread_i][fn_i];
+      }
+      delete [] trav;
+      Traverse::free_states(states, num_states);
+
+      if(caughtException != NULL)
+        throw *caughtException;
+
+      bool pairwise = Hermes2DApi.get_compensated_summation();
+      for (int k = 0; k < num_norms; k++)
+      {
+        double error = 0.0, norm = 0.0;
+        if(pairwise && num_states > 0)
+        {
+          if(errors != NULL)
+            error = Hermes::Algebra::VectorKernels::pairwise_sum(num_states, &state_errors[k], num_norms);
+          if(norms != NULL)
+            norm = Hermes::Algebra::VectorKernels::pairwise_sum(num_states, &state_norms[k], num_norms);
+        }
+        else
         {
-        case HERMES_L2_NORM:
-          error += error_fn_l2(sln1, sln2, ru, rv);
-          break;
-        case HERMES_H1_NORM:
-          error += error_fn_h1(sln1, sln2, ru, rv);
-          break;
-        case HERMES_HCURL_NORM:
-          error += error_fn_hc(sln1, sln2, ru, rv);
-          break;
-        case HERMES_HDIV_NORM:
-          error += error_fn_hdiv(sln1, sln2, ru, rv);
-          break;
-        default: throw Hermes::Exceptions::Exception("Unknown norm in calc_error().");
+          for (state_i = 0; state_i < num_states; state_i++)
+          {
+            if(errors != NULL)
+              error += state_errors[state_i * num_norms + k];
+            if(norms != NULL)
+              norm += state_norms[state_i * num_norms + k];
+          }
         }
+        if(errors != NULL)
+          errors[k] = sqrt(error);
+        if(norms != NULL)
+          norms[k] = sqrt(norm);
       }
-      trav.finish();
-      return sqrt(error);
+    }
+
+    template<typename Scalar>
+    double Global<Scalar>::calc_abs_error(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, int norm_type)
+    {
+      // sanity checks
+      if(sln1 == NULL) throw Hermes::Exceptions::Exception("sln1 is NULL in calc_abs_error().");
+      if(sln2 == NULL) throw Hermes::Exceptions::Exception("sln2 is NULL in calc_abs_error().");
+
+      Hermes::vector<int> norm_types;
+      norm_types.push_back(norm_type);
+      double error;
+      calc_errors_and_norms(sln1, sln2, norm_types, &error, NULL);
+      return error;
+    }
+
+    template<typename Scalar>
+    void Global<Scalar>::calc_abs_errors(MeshFunction<Scalar>* sln1, MeshFunction<Scalar>* sln2, Hermes::vector<int> norm_types, double* errors, double* norms)
+    {
+      // sanity checks
+      if(sln1 == NULL) throw Hermes::Exceptions::Exception("sln1 is NULL in calc_abs_errors().");
+      if(sln2 == NULL) throw Hermes::Exceptions::Exception("sln2 is NULL in calc_abs_errors().");
+      if(errors == NULL) throw Hermes::Exceptions::NullException(4);
+
+      calc_errors_and_norms(sln1, sln2, norm_types, errors, norms);
     }
 
     template<typename Scalar>
     double Global<Scalar>::calc_rel_error(MeshFunction<Scalar>* sln, MeshFunction<Scalar>* ref_sln, int norm_type)
     {
-      double error = calc_abs_error(sln, ref_sln, norm_type);
-      double norm = calc_norm(ref_sln, norm_type);
+      // The error and the norm of ref_sln in one traversal.
+      Hermes::vector<int> norm_types;
+      norm_types.push_back(norm_type);
+      double error, norm;
+      calc_abs_errors(sln, ref_sln, norm_types, &error, &norm);
 
       return error/norm;
     }
@@ -99,93 +248,84 @@ namespace Hermes
     template<typename Scalar>
     double Global<Scalar>::calc_norm(MeshFunction<Scalar>* sln, int norm_type)
     {
-      Quad2D* quad = &g_quad_2d_std;
-      sln->set_quad_2d(quad);
-
-      double norm = 0.0;
-      Element* e;
-      const Mesh* mesh = sln->get_mesh();
+      Hermes::vector<int> norm_types;
+      norm_types.push_back(norm_type);
+      double norm;
+      calc_errors_and_norms(NULL, sln, norm_types, NULL, &norm);
+      return norm;
+    }
 
-      for_all_active_elements(e, mesh)
-      {
-        // set maximum integration order for use in integrals, see limit_order()
-        update_limit_table(e->get_mode());
+    template<typename Scalar>
+    void Global<Scalar>::calc_norms(MeshFunction<Scalar>* sln, Hermes::vector<int> norm_types, double* norms)
+    {
+      if(sln == NULL) throw Hermes::Exceptions::NullException(1);
+      if(norms == NULL) throw Hermes::Exceptions::NullException(3);
 
-        sln->set_active_element(e);
-        RefMap* ru = sln->get_refmap();
+      calc_errors_and_norms(NULL, sln, norm_types, NULL, norms);
+    }
 
-        switch (norm_type)
-        {
-        case HERMES_L2_NORM:
-          norm += norm_fn_l2(sln, ru);
-          break;
-        case HERMES_H1_NORM:
-          norm += norm_fn_h1(sln, ru);
-          break;
-        case HERMES_HCURL_NORM:
-          norm += norm_fn_hc(sln, ru);
-          break;
-        case HERMES_HDIV_NORM:
-          norm += norm_fn_hdiv(sln, ru);
-          break;
-        default: throw Hermes::Exceptions::Exception("Unknown norm in calc_norm().");
-        }
+    template<typename Scalar>
+    int Global<Scalar>::get_norm_type(Solution<Scalar>* sln)
+    {
+      switch (sln->get_space_type())
+      {
+      case HERMES_H1_SPACE: return HERMES_H1_NORM;
+      case HERMES_HCURL_SPACE: return HERMES_HCURL_NORM;
+      case HERMES_HDIV_SPACE: return HERMES_HDIV_NORM;
+      case HERMES_L2_SPACE: return HERMES_L2_NORM;
+      default: throw Hermes::Exceptions::Exception("Internal in calc_norms(): unknown space type.");
       }
-      return sqrt(norm);
     }
 
     template<typename Scalar>
     double Global<Scalar>::calc_norms(Hermes::vector<Solution<Scalar>*> slns)
     {
-      // Calculate norms for all solutions.
-      Hermes::vector<double> norms;
-      int n = slns.size();
-      for (int i = 0; i<n; i++)
-      {
-        switch (slns[i]->get_space_type())
-        {
-        case HERMES_H1_SPACE: norms.push_back(calc_norm(slns[i], HERMES_H1_NORM)); break;
-        case HERMES_HCURL_SPACE: norms.push_back(calc_norm(slns[i], HERMES_HCURL_NORM)); break;
-        case HERMES_HDIV_SPACE: norms.push_back(calc_norm(slns[i], HERMES_HDIV_NORM)); break;
-        case HERMES_L2_SPACE: norms.push_back(calc_norm(slns[i], HERMES_L2_NORM)); break;
-        default: throw Hermes::Exceptions::Exception("Internal in calc_norms(): unknown space type.");
-        }
-      }
       // Calculate the resulting norm.
       double result = 0;
-      for (int i = 0; i < n; i++)
-        result += norms[i] * norms[i];
+      for (unsigned int i = 0; i < slns.size(); i++)
+      {
+        double norm = calc_norm(slns[i], get_norm_type(slns[i]));
+        result += norm * norm;
+      }
       return sqrt(result);
     }
 
     template<typename Scalar>
     double Global<Scalar>::calc_abs_errors(Hermes::vector<Solution<Scalar>*> slns1, Hermes::vector<Solution<Scalar>*> slns2)
     {
-      // Calculate errors for all solutions.
-      Hermes::vector<double> errors;
-      int n = slns1.size();
-      for (int i = 0; i < n; i++)
-      {
-        switch (slns1[i]->get_space_type())
-        {
-        case HERMES_H1_SPACE: errors.push_back(calc_abs_error(slns1[i], slns2[i], HERMES_H1_NORM)); break;
-        case HERMES_HCURL_SPACE: errors.push_back(calc_abs_error(slns1[i], slns2[i], HERMES_HCURL_NORM)); break;
-        case HERMES_HDIV_SPACE: errors.push_back(calc_abs_error(slns1[i], slns2[i], HERMES_HDIV_NORM)); break;
-        case HERMES_L2_SPACE: errors.push_back(calc_abs_error(slns1[i], slns2[i], HERMES_L2_NORM)); break;
-        default: throw Hermes::Exceptions::Exception("Internal in calc_norms(): unknown space type.");
-        }
-      }
       // Calculate the resulting error.
       double result = 0;
-      for (int i = 0; i < n; i++)
-        result += errors[i] * errors[i];
+      for (unsigned int i = 0; i < slns1.size(); i++)
+      {
+        double error = calc_abs_error(slns1[i], slns2[i], get_norm_type(slns1[i]));
+        result += error * error;
+      }
       return sqrt(result);
     }
 
     template<typename Scalar>
     double Global<Scalar>::calc_rel_errors(Hermes::vector<Solution<Scalar>*> slns1, Hermes::vector<Solution<Scalar>*> slns2)
     {
-      return calc_abs_errors(slns1, slns2) / calc_norms(slns2);
+      // The errors and the norms of slns2 in one traversal per solution pair (if the norms are the same).
+      double error_result = 0, norm_result = 0;
+      for (unsigned int i = 0; i < slns1.size(); i++)
+      {
+        double error, norm;
+        if(get_norm_type(slns1[i]) == get_norm_type(slns2[i]))
+        {
+          Hermes::vector<int> norm_types;
+          norm_types.push_back(get_norm_type(slns1[i]));
+          calc_abs_errors(slns1[i], slns2[i], norm_types, &error, &norm);
+        }
+        else
+        {
+          error = calc_abs_error(slns1[i], slns2[i], get_norm_type(slns1[i]));
+          norm = calc_norm(slns2[i], get_norm_type(slns2[i]));
+        }
+        error_result += error * error;
+        norm_result += norm * norm;
+      }
+      return sqrt(error_result) / sqrt(norm_result);
     }
 
     template<typename Scalar>
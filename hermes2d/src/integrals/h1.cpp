@@ -0,0 +1,111 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+/// \file This file contains the vectorized kernels of the H1 integrals (integrals/h1.h).
+
+#include "integrals/h1.h"
+#if defined(__AVX512F__) || defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // The widest instruction set the compiler targets, the remainder of the points is summed up by the scalar loops.
+#if defined(__AVX512F__)
+#define H2D_SIMD_WIDTH 8
+    typedef __m512d simd_double;
+    static inline simd_double simd_zero() { return _mm512_setzero_pd(); }
+    static inline simd_double simd_load(const double* p) { return _mm512_loadu_pd(p); }
+    static inline simd_double simd_mul(simd_double a, simd_double b) { return _mm512_mul_pd(a, b); }
+    static inline simd_double simd_fmadd(simd_double a, simd_double b, simd_double c) { return _mm512_fmadd_pd(a, b, c); }
+    static inline double simd_sum(simd_double a) { return _mm512_reduce_add_pd(a); }
+#elif defined(__AVX__)
+#define H2D_SIMD_WIDTH 4
+    typedef __m256d simd_double;
+    static inline simd_double simd_zero() { return _mm256_setzero_pd(); }
+    static inline simd_double simd_load(const double* p) { return _mm256_loadu_pd(p); }
+    static inline simd_double simd_mul(simd_double a, simd_double b) { return _mm256_mul_pd(a, b); }
+#ifdef __FMA__
+    static inline simd_double simd_fmadd(simd_double a, simd_double b, simd_double c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+    static inline simd_double simd_fmadd(simd_double a, simd_double b, simd_double c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif
+    static inline double simd_sum(simd_double a)
+    {
+      __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+      return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+    }
+#elif defined(__SSE2__)
+#define H2D_SIMD_WIDTH 2
+    typedef __m128d simd_double;
+    static inline simd_double simd_zero() { return _mm_setzero_pd(); }
+    static inline simd_double simd_load(const double* p) { return _mm_loadu_pd(p); }
+    static inline simd_double simd_mul(simd_double a, simd_double b) { return _mm_mul_pd(a, b); }
+    static inline simd_double simd_fmadd(simd_double a, simd_double b, simd_double c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static inline double simd_sum(simd_double a) { return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a))); }
+#endif
+
+    double int_v_kernel(int n, const double* w, const double* v)
+    {
+      double result = 0.0;
+      int i = 0;
+#ifdef H2D_SIMD_WIDTH
+      simd_double sum = simd_zero();
+      for (; i + H2D_SIMD_WIDTH <= n; i += H2D_SIMD_WIDTH)
+        sum = simd_fmadd(simd_load(w + i), simd_load(v + i), sum);
+      result = simd_sum(sum);
+#endif
+      for (; i < n; i++)
+        result += w[i] * v[i];
+      return result;
+    }
+
+    double int_u_v_kernel(int n, const double* w, const double* u, const double* v)
+    {
+      double result = 0.0;
+      int i = 0;
+#ifdef H2D_SIMD_WIDTH
+      simd_double sum = simd_zero();
+      for (; i + H2D_SIMD_WIDTH <= n; i += H2D_SIMD_WIDTH)
+        sum = simd_fmadd(simd_mul(simd_load(w + i), simd_load(u + i)), simd_load(v + i), sum);
+      result = simd_sum(sum);
+#endif
+      for (; i < n; i++)
+        result += w[i] * u[i] * v[i];
+      return result;
+    }
+
+    double int_grad_u_grad_v_kernel(int n, const double* w, const double* udx, const double* udy, const double* vdx, const double* vdy)
+    {
+      double result = 0.0;
+      int i = 0;
+#ifdef H2D_SIMD_WIDTH
+      simd_double sum = simd_zero();
+      for (; i + H2D_SIMD_WIDTH <= n; i += H2D_SIMD_WIDTH)
+      {
+        simd_double w_i = simd_load(w + i);
+        sum = simd_fmadd(simd_mul(w_i, simd_load(udx + i)), simd_load(vdx + i), sum);
+        sum = simd_fmadd(simd_mul(w_i, simd_load(udy + i)), simd_load(vdy + i), sum);
+      }
+      result = simd_sum(sum);
+#endif
+      for (; i < n; i++)
+        result += w[i] * (udx[i] * vdx[i] + udy[i] * vdy[i]);
+      return result;
+    }
+  }
+}
@@ -0,0 +1,94 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "jacobian_update_policy.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    JacobianUpdatePolicy::JacobianUpdatePolicy(int max_reuse, double max_convergence_rate, double max_time_step_change)
+      : has_jacobian(false), jacobian_uses(0), jacobian_time_step(0.0), num_assemblies(0), num_reuses(0)
+    {
+      set_max_reuse(max_reuse);
+      set_max_convergence_rate(max_convergence_rate);
+      set_max_time_step_change(max_time_step_change);
+    }
+
+    void JacobianUpdatePolicy::set_max_reuse(int max_reuse)
+    {
+      if(max_reuse < 1)
+        throw Exceptions::ValueException("max_reuse", max_reuse, 1);
+      this->max_reuse = max_reuse;
+    }
+
+    void JacobianUpdatePolicy::set_max_convergence_rate(double max_convergence_rate)
+    {
+      if(max_convergence_rate <= 0.0)
+        throw Exceptions::ValueException("max_convergence_rate", max_convergence_rate, 0.0);
+      this->max_convergence_rate = max_convergence_rate;
+    }
+
+    void JacobianUpdatePolicy::set_max_time_step_change(double max_time_step_change)
+    {
+      if(max_time_step_change < 0.0)
+        throw Exceptions::ValueException("max_time_step_change", max_time_step_change, 0.0);
+      this->max_time_step_change = max_time_step_change;
+    }
+
+    bool JacobianUpdatePolicy::reassemble_jacobian(double residual_norm, double last_residual_norm, double time_step)
+    {
+      bool reassemble = !this->has_jacobian || this->jacobian_uses >= this->max_reuse;
+
+      // The convergence degraded.
+      if(!reassemble && last_residual_norm > 0.0 && residual_norm > this->max_convergence_rate * last_residual_norm)
+        reassemble = true;
+
+      // The time step changed.
+      if(!reassemble && std::abs(time_step - this->jacobian_time_step) > this->max_time_step_change * std::abs(this->jacobian_time_step))
+        reassemble = true;
+
+      if(reassemble)
+      {
+        this->has_jacobian = true;
+        this->jacobian_uses = 1;
+        this->jacobian_time_step = time_step;
+        this->num_assemblies++;
+      }
+      else
+      {
+        this->jacobian_uses++;
+        this->num_reuses++;
+      }
+      return reassemble;
+    }
+
+    void JacobianUpdatePolicy::reset()
+    {
+      this->has_jacobian = false;
+      this->jacobian_uses = 0;
+    }
+
+    int JacobianUpdatePolicy::get_num_assemblies() const
+    {
+      return this->num_assemblies;
+    }
+
+    int JacobianUpdatePolicy::get_num_reuses() const
+    {
+      return this->num_reuses;
+    }
+  }
+}
@@ -57,6 +57,10 @@ namespace Hermes
       this->jacobian = create_matrix<Scalar>();
       this->residual = create_vector<Scalar>();
       this->matrix_solver = create_linear_solver<Scalar>(this->jacobian, this->residual);
+      this->recovered_sln_vector = NULL;
+      this->load_case_sln_vectors = NULL;
+      this->num_load_cases = 0;
+      this->matrix_factorized = false;
       this->set_verbose_output(true);
     }
 
@@ -93,6 +97,26 @@ namespace Hermes
       const_cast<WeakForm<Scalar>*>(this->dp->wf)->set_current_time_step(time_step);
     }
 
+    template<typename Scalar>
+    void LinearSolver<Scalar>::set_static_condensation(bool to_set)
+    {
+      (static_cast<DiscreteProblem<Scalar>*>(this->dp))->set_static_condensation(to_set);
+    }
+
+    template<typename Scalar>
+    void LinearSolver<Scalar>::set_constant_matrix(bool to_set)
+    {
+      this->dp->set_constant_matrix(to_set);
+    }
+
+    template<typename Scalar>
+    void LinearSolver<Scalar>::set_initial_guess(Scalar* coeff_vec)
+    {
+      IterSolver<Scalar>* iter_solver = dynamic_cast<IterSolver<Scalar>*>(this->matrix_solver);
+      if(iter_solver != NULL)
+        iter_solver->set_initial_guess(coeff_vec, this->dp->get_num_dofs());
+    }
+
     template<typename Scalar>
     SparseMatrix<Scalar>* LinearSolver<Scalar>::get_jacobian()
     {
@@ -123,12 +147,25 @@ namespace Hermes
       return static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces();
     }
     
+    template<typename Scalar>
+    size_t LinearSolver<Scalar>::get_memory_usage() const
+    {
+      size_t usage = get_matrix_memory_usage(this->jacobian) + get_vector_memory_usage(this->residual);
+      for(unsigned int i = 0; i < this->load_case_rhs.size(); i++)
+        usage += get_vector_memory_usage(this->load_case_rhs[i]);
+      return usage;
+    }
+
     template<typename Scalar>
     LinearSolver<Scalar>::~LinearSolver()
     {
       delete jacobian;
       delete residual;
       delete matrix_solver;
+      delete [] recovered_sln_vector;
+      for(unsigned int i = 0; i < load_case_rhs.size(); i++)
+        delete load_case_rhs[i];
+      delete [] load_case_sln_vectors;
       if(own_dp)
         delete this->dp;
       else
@@ -145,34 +182,32 @@ namespace Hermes
       this->on_initialization();
 
       dp->assemble(this->jacobian, this->residual);
+      this->update_memory_usage();
       if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= 1))
-      {
-        char* fileName = new char[this->RhsFilename.length() + 5];
-        if(this->RhsFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-          sprintf(fileName, "%s%i.m", this->RhsFilename.c_str(), 1);
-        else
-          sprintf(fileName, "%s%i", this->RhsFilename.c_str(), 1);
-        FILE* rhs_file = fopen(fileName, "w+");
-        residual->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
-        fclose(rhs_file);
-      }
+        this->dump_rhs(residual, 1);
       if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= 1))
-        {
-          char* fileName = new char[this->matrixFilename.length() + 5];
-          if(this->matrixFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->matrixFilename.c_str(), 1);
-          else
-            sprintf(fileName, "%s%i", this->matrixFilename.c_str(), 1);
-          FILE* matrix_file = fopen(fileName, "w+");
-
-          jacobian->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
-          fclose(matrix_file);
-        }
+        this->dump_matrix(jacobian, 1);
 
-      this->matrix_solver->solve();
+      // The kept constant matrix (set_constant_matrix()) has been factorized by the previous solve.
+      bool reuse_factorization = this->dp->matrix_kept_by_last_assembly() && this->matrix_factorized;
+      if(reuse_factorization)
+        this->matrix_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+
+      this->matrix_factorized = this->matrix_solver->solve();
+      if(reuse_factorization)
+        this->matrix_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
 
       this->sln_vector = matrix_solver->get_sln_vector();
 
+      // Static condensation - the bubble DOFs from the solution of the condensed system.
+      if(this->dp->is_system_condensed())
+      {
+        delete [] this->recovered_sln_vector;
+        this->recovered_sln_vector = new Scalar[this->dp->get_num_dofs()];
+        this->dp->recover_condensed_solution(this->sln_vector, this->recovered_sln_vector);
+        this->sln_vector = this->recovered_sln_vector;
+      }
+
       this->on_finish();
       
       this->tick();
@@ -185,6 +220,94 @@ namespace Hermes
       return sln_vector;
     }
 
+    template<typename Scalar>
+    void LinearSolver<Scalar>::solve_load_cases(unsigned int num_load_cases)
+    {
+      this->check();
+
+      if(num_load_cases == 0)
+        throw Exceptions::ValueException("num_load_cases", 0, 1);
+
+      this->tick();
+
+      this->on_initialization();
+
+      Hermes::vector<Vector<Scalar>*> rhs_vectors;
+      rhs_vectors.push_back(this->residual);
+      for(unsigned int i = 1; i < num_load_cases; i++)
+      {
+        if(this->load_case_rhs.size() < i)
+          this->load_case_rhs.push_back(create_vector<Scalar>());
+        rhs_vectors.push_back(this->load_case_rhs[i - 1]);
+      }
+
+      // One traversal for the matrix and all the right-hand sides.
+      dp->assemble(this->jacobian, rhs_vectors);
+      this->update_memory_usage();
+      if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= 1))
+        this->dump_rhs(residual, 1);
+      if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= 1))
+        this->dump_matrix(jacobian, 1);
+
+      int ndof = this->dp->get_num_dofs();
+      delete [] this->load_case_sln_vectors;
+      this->load_case_sln_vectors = new Scalar[num_load_cases * ndof];
+      this->num_load_cases = num_load_cases;
+
+      // The first load case factorizes the matrix (unless it is the kept constant one, see set_constant_matrix()),
+      // the others only use the factorization.
+      if(this->dp->matrix_kept_by_last_assembly() && this->matrix_factorized)
+        this->matrix_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+      for(unsigned int load_case = 0; load_case < num_load_cases; load_case++)
+      {
+        if(load_case > 0)
+        {
+          this->residual->zero();
+          this->residual->add_vector(this->load_case_rhs[load_case - 1]);
+          this->matrix_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+        }
+        if(!this->matrix_solver->solve())
+        {
+          this->matrix_factorized = false;
+          this->matrix_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+          throw Exceptions::LinearMatrixSolverException();
+        }
+        Hermes::Algebra::VectorKernels::copy(ndof, this->matrix_solver->get_sln_vector(), this->load_case_sln_vectors + load_case * ndof);
+      }
+      this->matrix_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+      this->matrix_factorized = true;
+
+      this->sln_vector = this->load_case_sln_vectors;
+
+      this->on_finish();
+
+      this->tick();
+      this->info("\tLinear solver solution duration (%d load cases): %f s.\n", num_load_cases, this->last());
+    }
+
+    template<typename Scalar>
+    Scalar *LinearSolver<Scalar>::get_sln_vector(unsigned int load_case)
+    {
+      if(load_case >= this->num_load_cases)
+        throw Exceptions::ValueException("load_case", load_case, this->num_load_cases);
+      return this->load_case_sln_vectors + load_case * this->dp->get_num_dofs();
+    }
+
+    template<typename Scalar>
+    void LinearSolver<Scalar>::get_load_case_solutions(Hermes::vector<Solution<Scalar>*> slns)
+    {
+      Hermes::vector<const Space<Scalar>*> spaces = this->dp->get_spaces();
+      if(slns.size() != this->num_load_cases * spaces.size())
+        throw Exceptions::LengthException(1, slns.size(), this->num_load_cases * spaces.size());
+      for(unsigned int load_case = 0; load_case < this->num_load_cases; load_case++)
+      {
+        Hermes::vector<Solution<Scalar>*> load_case_slns;
+        for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+          load_case_slns.push_back(slns[load_case * spaces.size() + space_i]);
+        Solution<Scalar>::vector_to_solutions(this->get_sln_vector(load_case), spaces, load_case_slns);
+      }
+    }
+
     template class HERMES_API LinearSolver<double>;
     template class HERMES_API LinearSolver<std::complex<double> >;
   }
@@ -0,0 +1,159 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "memory_accounting.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    MemoryAccounting Hermes2DMemory;
+
+    size_t MemoryAccounting::get_current_usage() const
+    {
+      size_t usage;
+#pragma omp critical (memory_accounting)
+      usage = this->total_current;
+      return usage;
+    }
+
+    size_t MemoryAccounting::get_current_usage(MemoryCategory category) const
+    {
+      size_t usage;
+#pragma omp critical (memory_accounting)
+      usage = this->current[category];
+      return usage;
+    }
+
+    size_t MemoryAccounting::get_peak_usage() const
+    {
+      size_t usage;
+#pragma omp critical (memory_accounting)
+      usage = this->total_peak;
+      return usage;
+    }
+
+    size_t MemoryAccounting::get_peak_usage(MemoryCategory category) const
+    {
+      size_t usage;
+#pragma omp critical (memory_accounting)
+      usage = this->peak[category];
+      return usage;
+    }
+
+    int MemoryAccounting::get_num_instances(MemoryCategory category) const
+    {
+      int count;
+#pragma omp critical (memory_accounting)
+      count = this->instances[category];
+      return count;
+    }
+
+    void MemoryAccounting::reset_peak_usage()
+    {
+#pragma omp critical (memory_accounting)
+      {
+        for(int i = 0; i < MemoryCategoryCount; i++)
+          this->peak[i] = this->current[i];
+        this->total_peak = this->total_current;
+      }
+    }
+
+    void MemoryAccounting::set_budget(size_t bytes)
+    {
+#pragma omp critical (memory_accounting)
+      {
+        this->budget = bytes;
+        this->over_budget = false;
+      }
+    }
+
+    void MemoryAccounting::report() const
+    {
+      size_t current[MemoryCategoryCount], peak[MemoryCategoryCount], total_current, total_peak;
+      int instances[MemoryCategoryCount];
+#pragma omp critical (memory_accounting)
+      {
+        for(int i = 0; i < MemoryCategoryCount; i++)
+        {
+          current[i] = this->current[i];
+          peak[i] = this->peak[i];
+          instances[i] = this->instances[i];
+        }
+        total_current = this->total_current;
+        total_peak = this->total_peak;
+      }
+
+      Hermes::Mixins::Loggable::Static::info("Memory usage (current / peak, MB):");
+      for(int i = 0; i < MemoryCategoryCount; i++)
+        Hermes::Mixins::Loggable::Static::info("\t%s (%d instances): %.2f / %.2f", get_category_name((MemoryCategory) i), instances[i], current[i] / 1048576.0, peak[i] / 1048576.0);
+      Hermes::Mixins::Loggable::Static::info("\tTotal: %.2f / %.2f", total_current / 1048576.0, total_peak / 1048576.0);
+    }
+
+    void MemoryAccounting::add(MemoryCategory category, size_t bytes)
+    {
+#pragma omp critical (memory_accounting)
+      this->change(category, 0, bytes);
+    }
+
+    void MemoryAccounting::remove(MemoryCategory category, size_t bytes)
+    {
+#pragma omp critical (memory_accounting)
+      this->change(category, bytes, 0);
+    }
+
+    void MemoryAccounting::change(MemoryCategory category, size_t old_bytes, size_t new_bytes)
+    {
+      this->current[category] += new_bytes - old_bytes;
+      this->total_current += new_bytes - old_bytes;
+      if(this->current[category] > this->peak[category])
+        this->peak[category] = this->current[category];
+      if(this->total_current > this->total_peak)
+        this->total_peak = this->total_current;
+
+      if(this->budget > 0)
+      {
+        if(!this->over_budget && this->total_current > this->budget)
+        {
+          this->over_budget = true;
+          Hermes::Mixins::Loggable::Static::warn("Memory usage %.2f MB exceeds the budget of %.2f MB (%s grew).", this->total_current / 1048576.0, this->budget / 1048576.0, get_category_name(category));
+        }
+        else if(this->total_current <= this->budget)
+          this->over_budget = false;
+      }
+    }
+
+    const char* MemoryAccounting::get_category_name(MemoryCategory category)
+    {
+      switch(category)
+      {
+      case MemoryMeshes:
+        return "Meshes";
+      case MemorySpaces:
+        return "Spaces";
+      case MemorySolutions:
+        return "Solutions";
+      case MemoryAssemblyCaches:
+        return "Assembly caches";
+      case MemoryPrecalcShapesetTables:
+        return "PrecalcShapeset tables";
+      case MemoryMatrices:
+        return "Matrices";
+      default:
+        throw Hermes::Exceptions::Exception("Unknown memory category %d.", (int) category);
+      }
+    }
+  }
+}
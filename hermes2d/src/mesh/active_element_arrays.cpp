@@ -0,0 +1,82 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "active_element_arrays.h"
+#include "mesh.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    ActiveElementArrays::ActiveElementArrays(const Mesh* mesh) : seq(mesh->get_seq())
+    {
+      int num_elements = mesh->get_num_active_elements();
+      elements.reserve(num_elements);
+      vertices.reserve(4 * num_elements);
+      x.reserve(4 * num_elements);
+      y.reserve(4 * num_elements);
+      markers.reserve(num_elements);
+      areas.reserve(num_elements);
+      diameters.reserve(num_elements);
+      flags.reserve(num_elements);
+
+      Element* e;
+      for_all_active_elements(e, mesh)
+      {
+        elements.push_back(e);
+        for (int i = 0; i < 4; i++)
+        {
+          Node* vertex = e->vn[i < e->get_nvert() ? i : 0];
+          vertices.push_back(i < e->get_nvert() ? vertex->id : -1);
+          x.push_back(vertex->x);
+          y.push_back(vertex->y);
+        }
+        markers.push_back(e->marker);
+        areas.push_back(e->get_area());
+        diameters.push_back(e->get_diameter());
+        flags.push_back((e->is_triangle() ? H2D_TRIANGLE : 0) | (e->is_curved() ? H2D_CURVED : 0));
+      }
+    }
+
+    ActiveElementArrays::~ActiveElementArrays()
+    {
+    }
+
+    int ActiveElementArrays::get_num_elements() const
+    {
+      return (int)this->elements.size();
+    }
+
+    unsigned ActiveElementArrays::get_seq() const
+    {
+      return this->seq;
+    }
+
+    int ActiveElementArrays::get_nvert(int k) const
+    {
+      return (flags[k] & H2D_TRIANGLE) ? 3 : 4;
+    }
+
+    bool ActiveElementArrays::is_triangle(int k) const
+    {
+      return (flags[k] & H2D_TRIANGLE) != 0;
+    }
+
+    bool ActiveElementArrays::is_curved(int k) const
+    {
+      return (flags[k] & H2D_CURVED) != 0;
+    }
+  }
+}
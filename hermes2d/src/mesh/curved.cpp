@@ -22,6 +22,7 @@
 #include "mesh.h"
 #include "quad_all.h"
 #include "matrix.h"
+#include "precalculated_tables.h"
 
 using namespace Hermes::Algebra::DenseMatrixOperations;
 namespace Hermes
@@ -39,8 +40,6 @@ namespace Hermes
     Quad1DStd CurvMap::quad1d;
     Quad2DStd CurvMap::quad2d;
 
-    Trf CurvMap::ctm;
-
     static double lambda_0(double x, double y)
     {
       return -0.5 * (x + y);
@@ -386,12 +385,38 @@ namespace Hermes
 
     //// projection based interpolation ////////////////////////////////////////////////////////////////
 
+    // The Cholesky factors (and their diagonals) of the projection matrices stored in the PrecalculatedTables,
+    // the rows point to the mapped table.
+    static bool load_cholesky_factor(const char* name, int key, int n, double**& matrix, double*& p)
+    {
+      const double* table = PrecalculatedTables::load(name, key, (size_t)n * (n + 1));
+      if(table == NULL)
+        return false;
+      matrix = new double*[n];
+      for (int i = 0; i < n; i++)
+        matrix[i] = const_cast<double*>(table) + i * n;
+      p = const_cast<double*>(table) + n * n;
+      return true;
+    }
+
+    static void store_cholesky_factor(const char* name, int key, int n, double** matrix, double* p)
+    {
+      std::vector<double> table((size_t)n * (n + 1));
+      for (int i = 0; i < n; i++)
+        memcpy(&table[i * n], matrix[i], n * sizeof(double));
+      memcpy(&table[n * n], p, n * sizeof(double));
+      PrecalculatedTables::store(name, key, table.size(), &table[0]);
+    }
+
     // preparation of projection matrices, Cholesky factorization
     void CurvMap::precalculate_cholesky_projection_matrix_edge(H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss)
     {
       int order = ref_map_shapeset->get_max_order();
       int n = order - 1; // number of edge basis functions
 
+      if(!edge_proj_matrix && load_cholesky_factor("curved_edge_h1_jacobi", order, n, edge_proj_matrix, edge_p))
+        return;
+
       if(!edge_proj_matrix)
         edge_proj_matrix = new_matrix<double>(n, n);
 
@@ -496,6 +521,7 @@ namespace Hermes
       if(!edge_p)
         edge_p = new double[n];
       choldc(edge_proj_matrix, n, edge_p);
+      store_cholesky_factor("curved_edge_h1_jacobi", order, n, edge_proj_matrix, edge_p);
     }
 
     // calculate the H1 seminorm products (\phi_i, \phi_j) for all 0 <= i, j < n, n is the number of bubble functions
@@ -540,12 +566,16 @@ namespace Hermes
       if(ref_map_pss->get_active_element()->get_mode() == HERMES_MODE_TRIANGLE)
       {
         int nb = ref_map_shapeset->get_num_bubbles(order, HERMES_MODE_TRIANGLE);
-        int* indices = ref_map_shapeset->get_bubble_indices(order, HERMES_MODE_TRIANGLE);
-        bubble_proj_matrix_tri = calculate_bubble_projection_matrix(nb, indices, ref_map_shapeset, ref_map_pss, HERMES_MODE_TRIANGLE);
+        if(!load_cholesky_factor("curved_bubble_tri_h1_jacobi", order, nb, bubble_proj_matrix_tri, bubble_tri_p))
+        {
+          int* indices = ref_map_shapeset->get_bubble_indices(order, HERMES_MODE_TRIANGLE);
+          bubble_proj_matrix_tri = calculate_bubble_projection_matrix(nb, indices, ref_map_shapeset, ref_map_pss, HERMES_MODE_TRIANGLE);
 
-        // cholesky factorization of the matrix
-        bubble_tri_p = new double[nb];
-        choldc(bubble_proj_matrix_tri, nb, bubble_tri_p);
+          // cholesky factorization of the matrix
+          bubble_tri_p = new double[nb];
+          choldc(bubble_proj_matrix_tri, nb, bubble_tri_p);
+          store_cholesky_factor("curved_bubble_tri_h1_jacobi", order, nb, bubble_proj_matrix_tri, bubble_tri_p);
+        }
       }
 
       // *** quads ***
@@ -555,20 +585,24 @@ namespace Hermes
       {
         order = H2D_MAKE_QUAD_ORDER(order, order);
         int nb = ref_map_shapeset->get_num_bubbles(order, HERMES_MODE_QUAD);
-        int *indices = ref_map_shapeset->get_bubble_indices(order, HERMES_MODE_QUAD);
+        if(!load_cholesky_factor("curved_bubble_quad_h1_jacobi", order, nb, bubble_proj_matrix_quad, bubble_quad_p))
+        {
+          int *indices = ref_map_shapeset->get_bubble_indices(order, HERMES_MODE_QUAD);
 
-        bubble_proj_matrix_quad = calculate_bubble_projection_matrix(nb, indices, ref_map_shapeset, ref_map_pss, HERMES_MODE_QUAD);
+          bubble_proj_matrix_quad = calculate_bubble_projection_matrix(nb, indices, ref_map_shapeset, ref_map_pss, HERMES_MODE_QUAD);
 
-        // cholesky factorization of the matrix
-        bubble_quad_p = new double[nb];
-        choldc(bubble_proj_matrix_quad, nb, bubble_quad_p);
+          // cholesky factorization of the matrix
+          bubble_quad_p = new double[nb];
+          choldc(bubble_proj_matrix_quad, nb, bubble_quad_p);
+          store_cholesky_factor("curved_bubble_quad_h1_jacobi", order, nb, bubble_proj_matrix_quad, bubble_quad_p);
+        }
       }
     }
 
     //// edge part of projection based interpolation ///////////////////////////////////////////////////
 
     // compute point (x, y) in reference element, edge vector (v1, v2)
-    void CurvMap::edge_coord(Element* e, int edge, double t, double2& x, double2& v)
+    void CurvMap::edge_coord(Element* e, int edge, double t, double2& x, double2& v, const Trf& ctm)
     {
       int mode = e->get_mode();
       double2 a, b;
@@ -586,7 +620,7 @@ namespace Hermes
       v[0] /= lenght; v[1] /= lenght;
     }
 
-    void CurvMap::calc_edge_projection(Element* e, int edge, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss)
+    void CurvMap::calc_edge_projection(Element* e, int edge, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm)
     {
       ref_map_pss->set_active_element(e);
 
@@ -596,8 +630,8 @@ namespace Hermes
       int ne = order - 1;
       int mode = e->get_mode();
 
-      assert(np <= 15 && ne <= 10);
-      double2 fn[15];
+      assert(np <= g_max_quad / 2 + 1 && ne <= 10);
+      double2 fn[g_max_quad / 2 + 1];
       double rhside[2][10];
       memset(fn, 0, sizeof(double2) * np);
       memset(rhside[0], 0, sizeof(double) * ne);
@@ -619,7 +653,7 @@ namespace Hermes
       {
         double2 x, v;
         double t = pt[j][0];
-        edge_coord(e, edge, t, x, v);
+        edge_coord(e, edge, t, x, v, ctm);
         calc_ref_map(e, nurbs, x[0], x[1], fn[j]);
 
         for (k = 0; k < 2; k++)
@@ -720,7 +754,7 @@ namespace Hermes
       }
     }
 
-    void CurvMap::calc_bubble_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss)
+    void CurvMap::calc_bubble_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm)
     {
       ref_map_pss->set_active_element(e);
 
@@ -792,13 +826,13 @@ namespace Hermes
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CurvMap::ref_map_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss)
+    void CurvMap::ref_map_projection(Element* e, Nurbs** nurbs, int order, double2* proj, H1ShapesetJacobi* ref_map_shapeset, PrecalcShapeset* ref_map_pss, const Trf& ctm, const double2* vertex_coords)
     {
       // vertex part
       for (unsigned int i = 0; i < e->get_nvert(); i++)
       {
-        proj[i][0] = e->vn[i]->x;
-        proj[i][1] = e->vn[i]->y;
+        proj[i][0] = vertex_coords != NULL ? vertex_coords[i][0] : e->vn[i]->x;
+        proj[i][1] = vertex_coords != NULL ? vertex_coords[i][1] : e->vn[i]->y;
       }
 
       if(e->cm->toplevel == false)
@@ -806,13 +840,13 @@ namespace Hermes
 
       // edge part
       for (int edge = 0; edge < (int)e->get_nvert(); edge++)
-        calc_edge_projection(e, edge, nurbs, order, proj, ref_map_shapeset, ref_map_pss);
+        calc_edge_projection(e, edge, nurbs, order, proj, ref_map_shapeset, ref_map_pss, ctm);
 
       //bubble part
-      calc_bubble_projection(e, nurbs, order, proj, ref_map_shapeset, ref_map_pss);
+      calc_bubble_projection(e, nurbs, order, proj, ref_map_shapeset, ref_map_pss, ctm);
     }
 
-    void CurvMap::update_refmap_coeffs(Element* e)
+    void CurvMap::update_refmap_coeffs(Element* e, const double2* vertex_coords)
     {
       H1ShapesetJacobi ref_map_shapeset;
       PrecalcShapeset ref_map_pss(&ref_map_shapeset);
@@ -820,13 +854,16 @@ namespace Hermes
       ref_map_pss.set_quad_2d(&quad2d);
       ref_map_pss.set_active_element(e);
 
-      // calculation of projection matrices
-      if(edge_proj_matrix == NULL)
-        precalculate_cholesky_projection_matrix_edge(&ref_map_shapeset, &ref_map_pss);
-      if(bubble_proj_matrix_tri == NULL && e->get_mode() == HERMES_MODE_TRIANGLE)
-        precalculate_cholesky_projection_matrices_bubble(&ref_map_shapeset, &ref_map_pss);
-      if(bubble_proj_matrix_quad == NULL && e->get_mode() == HERMES_MODE_QUAD)
-        precalculate_cholesky_projection_matrices_bubble(&ref_map_shapeset, &ref_map_pss);
+      // calculation of projection matrices (once, shared by all threads)
+#pragma omp critical (curved_projection_matrices)
+      {
+        if(edge_proj_matrix == NULL)
+          precalculate_cholesky_projection_matrix_edge(&ref_map_shapeset, &ref_map_pss);
+        if(bubble_proj_matrix_tri == NULL && e->get_mode() == HERMES_MODE_TRIANGLE)
+          precalculate_cholesky_projection_matrices_bubble(&ref_map_shapeset, &ref_map_pss);
+        if(bubble_proj_matrix_quad == NULL && e->get_mode() == HERMES_MODE_QUAD)
+          precalculate_cholesky_projection_matrices_bubble(&ref_map_shapeset, &ref_map_pss);
+      }
 
       // allocate projection coefficients
       int nv = e->get_nvert();
@@ -844,6 +881,28 @@ namespace Hermes
       // WARNING: do not change the format of the array 'coeffs'. If it changes,
       // RefMap::set_active_element() has to be changed too.
 
+      // refined elements: the projection may have been done in another copy of the base element
+      CurvMapCache* cache = NULL;
+      double2 coords[H2D_MAX_NUMBER_VERTICES];
+      if(toplevel == false)
+      {
+        for (int i = 0; i < nv; i++)
+        {
+          coords[i][0] = vertex_coords != NULL ? vertex_coords[i][0] : e->vn[i]->x;
+          coords[i][1] = vertex_coords != NULL ? vertex_coords[i][1] : e->vn[i]->y;
+        }
+        bool found;
+#pragma omp critical (curved_coeffs_cache)
+        {
+          if(parent->cm->cache == NULL)
+            parent->cm->cache = new CurvMapCache;
+          cache = parent->cm->cache;
+          found = cache->find(part, order, nv, coords, nc, coeffs);
+        }
+        if(found)
+          return;
+      }
+
       Nurbs** nurbs;
       if(toplevel == false)
       {
@@ -856,11 +915,17 @@ namespace Hermes
         ref_map_pss.reset_transform();
         nurbs = e->cm->nurbs;
       }
-      ctm = *(ref_map_pss.get_ctm());
+      Trf ctm = *(ref_map_pss.get_ctm());
       ref_map_pss.reset_transform(); // fixme - do we need this?
 
       // calculation of new projection coefficients
-      ref_map_projection(e, nurbs, order, coeffs, &ref_map_shapeset, &ref_map_pss);
+      ref_map_projection(e, nurbs, order, coeffs, &ref_map_shapeset, &ref_map_pss, ctm, vertex_coords);
+
+      if(cache != NULL)
+      {
+#pragma omp critical (curved_coeffs_cache)
+        cache->insert(part, order, nv, coords, nc, coeffs);
+      }
     }
 
     void CurvMap::get_mid_edge_points(Element* e, double2* pt, int n)
@@ -876,7 +941,7 @@ namespace Hermes
         nurbs = e->cm->nurbs;
       }
 
-      ctm = *(tran.get_ctm());
+      Trf ctm = *(tran.get_ctm());
       double xi_1, xi_2;
       for (int i = 0; i < n; i++)
       {
@@ -902,10 +967,23 @@ namespace Hermes
       coeffs = new double2[nc];
       memcpy(coeffs, cm->coeffs, sizeof(double2) * nc);
 
+      // The same mesh may be copied by several threads (MeshReaderH2DXML::load()).
       if(toplevel)
+      {
         for (int i = 0; i < 4; i++)
           if(nurbs[i] != NULL)
+          {
+#pragma omp atomic
             nurbs[i]->ref++;
+          }
+        if(cache != NULL)
+        {
+#pragma omp atomic
+          cache->ref++;
+        }
+      }
+      else
+        cache = NULL;
     }
 
     CurvMap::~CurvMap()
@@ -917,9 +995,63 @@ namespace Hermes
       }
 
       if(toplevel)
+      {
         for (int i = 0; i < 4; i++)
           if(nurbs[i] != NULL)
             nurbs[i]->unref();
+        if(cache != NULL)
+          cache->unref();
+      }
+    }
+
+    CurvMapCache::CurvMapCache() : ref(1)
+    {
+    }
+
+    CurvMapCache::~CurvMapCache()
+    {
+      for (std::map<uint64_t, Entry>::iterator it = entries.begin(); it != entries.end(); ++it)
+        delete [] it->second.coeffs;
+    }
+
+    void CurvMapCache::unref()
+    {
+      if(!--ref)
+        delete this;
+    }
+
+    bool CurvMapCache::find(uint64_t part, int order, int nv, const double2* vertex_coords, int nc, double2* coeffs) const
+    {
+      std::map<uint64_t, Entry>::const_iterator it = entries.find(part);
+      if(it == entries.end())
+        return false;
+      const Entry& entry = it->second;
+      if(entry.order != order || entry.nv != nv || entry.nc != nc)
+        return false;
+      for (int i = 0; i < nv; i++)
+        if(entry.vertex_coords[i][0] != vertex_coords[i][0] || entry.vertex_coords[i][1] != vertex_coords[i][1])
+          return false;
+      memcpy(coeffs, entry.coeffs, sizeof(double2) * nc);
+      return true;
+    }
+
+    void CurvMapCache::insert(uint64_t part, int order, int nv, const double2* vertex_coords, int nc, const double2* coeffs)
+    {
+      std::map<uint64_t, Entry>::iterator it = entries.find(part);
+      if(it == entries.end())
+      {
+        Entry entry;
+        entry.coeffs = NULL;
+        it = entries.insert(std::make_pair(part, entry)).first;
+      }
+      Entry& entry = it->second;
+      delete [] entry.coeffs;
+      entry.order = order;
+      entry.nv = nv;
+      memcpy(entry.vertex_coords, vertex_coords, sizeof(double2) * nv);
+      entry.nc = nc;
+      entry.coeffs = new double2[nc];
+      memcpy(entry.coeffs, coeffs, sizeof(double2) * nc);
     }
   }
 }
\ No newline at end of file
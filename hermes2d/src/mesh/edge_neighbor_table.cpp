@@ -0,0 +1,299 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "edge_neighbor_table.h"
+#include "mesh.h"
+#include "function/transformable.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // The values of NeighborSearch::NeighborhoodType.
+    static const char H2D_DG_NOT_INITIALIZED = -1;
+    static const char H2D_DG_NO_TRANSF = 0;
+    static const char H2D_DG_GO_DOWN = 1;
+    static const char H2D_DG_GO_UP = 2;
+
+    EdgeNeighborTable::EdgeNeighborTable(const Mesh* mesh) : seq(mesh->get_seq()), mesh(mesh)
+    {
+      const int max_level = Transformable::H2D_MAX_TRN_LEVEL;
+      int num_slots = 4 * mesh->get_max_element_id();
+      starts.assign(num_slots + 1, 0);
+      types.assign(num_slots, H2D_DG_NOT_INITIALIZED);
+
+      Element* central_el;
+      for_all_active_elements(central_el, mesh)
+      {
+        for (int active_edge = 0; active_edge < central_el->get_nvert(); active_edge++)
+        {
+          int slot = 4 * central_el->id + active_edge;
+          starts[slot] = (int)neighbors.size();
+          if(central_el->en[active_edge]->bnd == 0)
+          {
+            // Endpoints of the active edge.
+            int orig_vertex_id[2];
+            orig_vertex_id[0] = central_el->vn[active_edge]->id;
+            orig_vertex_id[1] = central_el->vn[(active_edge + 1) % central_el->get_nvert()]->id;
+
+            Element* neighb_el = central_el->get_neighbor(active_edge);
+
+            // The neighboring element is of the same size as the central one.
+            if(neighb_el != NULL)
+            {
+              types[slot] = H2D_DG_NO_TRANSF;
+              int local_num_of_edge = local_edge(neighb_el, central_el->en[active_edge]);
+              add_neighbor(neighb_el, local_num_of_edge, edge_orientation(neighb_el, local_num_of_edge, orig_vertex_id[0], orig_vertex_id[1], 0), NULL, 0);
+            }
+            else
+            {
+              // Peek the vertex in the middle of the active edge (if there is none, vertex will be NULL).
+              Node* vertex = mesh->peek_vertex_node(central_el->en[active_edge]->p1, central_el->en[active_edge]->p2);
+
+              if(vertex == NULL)
+              {
+                types[slot] = H2D_DG_GO_UP;
+
+                // Middle-point vertices of the intermediate parent edges that we climb up to the correct parent element.
+                Node* par_mid_vertices[max_level];
+                for (int j = 0; j < max_level; j++)
+                  par_mid_vertices[j] = NULL;
+
+                find_act_elem_up(central_el, active_edge, central_el->parent, orig_vertex_id, par_mid_vertices, 0);
+              }
+              else
+              {
+                types[slot] = H2D_DG_GO_DOWN;
+
+                // Virtual sons of the central el. visited on the way down to the neighbor.
+                int sons[max_level];
+
+                // Start the search by going down to the first son.
+                find_act_elem_down(central_el, active_edge, vertex, orig_vertex_id, sons, 1);
+              }
+            }
+          }
+          starts[slot + 1] = (int)neighbors.size();
+        }
+      }
+
+      // The slots of the unused and inactive elements are empty.
+      for (int slot = 0; slot < num_slots; slot++)
+        if(starts[slot + 1] < starts[slot])
+          starts[slot + 1] = starts[slot];
+    }
+
+    EdgeNeighborTable::~EdgeNeighborTable()
+    {
+    }
+
+    unsigned EdgeNeighborTable::get_seq() const
+    {
+      return this->seq;
+    }
+
+    int EdgeNeighborTable::get_neighborhood_type(const Element* e, int edge) const
+    {
+      return types[4 * e->id + edge];
+    }
+
+    const EdgeNeighborTable::Neighbor* EdgeNeighborTable::get_neighbors(const Element* e, int edge, int& num_neighbors) const
+    {
+      int slot = 4 * e->id + edge;
+      num_neighbors = starts[slot + 1] - starts[slot];
+      return num_neighbors > 0 ? &neighbors[starts[slot]] : NULL;
+    }
+
+    const unsigned int* EdgeNeighborTable::get_transformations(const Neighbor* neighbor) const
+    {
+      return neighbor->num_levels > 0 ? &transformations[neighbor->transf_offset] : NULL;
+    }
+
+    void EdgeNeighborTable::add_neighbor(Element* neighbor, int local_num_of_edge, bool orientation, const unsigned int* transf, unsigned int num_levels)
+    {
+      Neighbor new_neighbor;
+      new_neighbor.element = neighbor;
+      new_neighbor.local_num_of_edge = local_num_of_edge;
+      new_neighbor.orientation = orientation;
+      new_neighbor.num_levels = num_levels;
+      new_neighbor.transf_offset = (int)transformations.size();
+      transformations.insert(transformations.end(), transf, transf + num_levels);
+      neighbors.push_back(new_neighbor);
+    }
+
+    int EdgeNeighborTable::local_edge(Element* neighbor, Node* edge)
+    {
+      for (int j = 0; j < neighbor->get_nvert(); j++)
+        if(neighbor->en[j] == edge)
+          return j;
+      throw Hermes::Exceptions::Exception("Neighbor edge wasn't found");
+    }
+
+    bool EdgeNeighborTable::edge_orientation(Element* neighbor, int local_num_of_edge, int bounding_vert1, int bounding_vert2, int segment)
+    {
+      if(segment == 0)
+      {
+        // neighbor edge goes from parent1 to middle vertex
+        if(neighbor->vn[local_num_of_edge]->id != bounding_vert1)
+          return true; // orientation reversed
+      }
+      else
+      {
+        // neighbor edge goes from middle vertex to parent2
+        if(neighbor->vn[local_num_of_edge]->id == bounding_vert2)
+          return true; // orientation reversed
+      }
+      return false;
+    }
+
+    void EdgeNeighborTable::find_act_elem_up(Element* central_el, int active_edge, Element* elem, int* orig_vertex_id, Node** par_mid_vertices, int n_parents)
+    {
+      const int max_level = Transformable::H2D_MAX_TRN_LEVEL;
+      // IDs of vertices bounding the current intermediate parent edge.
+      int p1 = elem->vn[active_edge]->id;
+      int p2 = elem->vn[(active_edge + 1) % elem->get_nvert()]->id;
+
+      int id_of_par_orient_1 = p1;
+      int id_of_par_orient_2 = p2;
+
+      // Find if p1 and p2 bound a used edge (used by the neighbor element).
+      Node* edge = mesh->peek_edge_node(p1, p2);
+
+      // Add the vertex in the middle of the parent edge to the array of intermediate parent vertices. This is for
+      // consequent transformation of functions on neighbor element.
+      Node* vertex = mesh->peek_vertex_node(p1, p2);
+      if(vertex != NULL)
+      {
+        if(n_parents == 0)
+          par_mid_vertices[n_parents++] = vertex;
+        else
+          if(n_parents == max_level - 1)
+            throw Hermes::Exceptions::Exception("Maximum number of intermediate parents exceeded in EdgeNeighborTable::find_act_elem_up");
+          else
+            if(par_mid_vertices[n_parents - 1]->id != vertex->id)
+              par_mid_vertices[n_parents++] = vertex;
+      }
+
+      if((edge == NULL) || (central_el->en[active_edge]->id == edge->id))
+      {
+        // We have not yet found the parent of the central element completely adjacent to the neighbor.
+        find_act_elem_up(central_el, active_edge, elem->parent, orig_vertex_id, par_mid_vertices, n_parents);
+        return;
+      }
+
+      for (int i = 0; i < 2; i++)
+      {
+        // Get a pointer to the active neighbor element.
+        if((edge->elem[i] != NULL) && (edge->elem[i]->active == 1))
+        {
+          Element* neighb_el = edge->elem[i];
+          int local_num_of_edge = local_edge(neighb_el, edge);
+
+          // The transformation of the central el. to its parent completely adjacent to the single big neighbor,
+          // going back through the intermediate inactive parents down to the central element.
+          unsigned int transf[max_level];
+          for(int j = n_parents - 1; j > 0; j--)
+          {
+            Node* n = mesh->peek_vertex_node(par_mid_vertices[j]->id, p1);
+            if(n == NULL)
+            {
+              transf[n_parents - j - 1] = local_num_of_edge;
+              p1 = par_mid_vertices[j]->id;
+            }
+            else
+            {
+              if(n->id == par_mid_vertices[j-1]->id)
+              {
+                transf[n_parents - j - 1] = (local_num_of_edge + 1) % neighb_el->get_nvert();
+                p2 = par_mid_vertices[j]->id;
+              }
+              else
+              {
+                transf[n_parents - j - 1] = local_num_of_edge;
+                p1 = par_mid_vertices[j]->id;
+              }
+            }
+          }
+
+          // Final transformation to the central element itself.
+          if(orig_vertex_id[0] == par_mid_vertices[0]->id)
+            transf[n_parents - 1] = local_num_of_edge;
+          else
+            transf[n_parents - 1] = (local_num_of_edge + 1) % neighb_el->get_nvert();
+
+          add_neighbor(neighb_el, local_num_of_edge, edge_orientation(neighb_el, local_num_of_edge, id_of_par_orient_1, id_of_par_orient_2, 0), transf, n_parents);
+        }
+      }
+    }
+
+    void EdgeNeighborTable::find_act_elem_down(Element* central_el, int active_edge, Node* vertex, int* bounding_verts_id, int* sons, unsigned int n_sons)
+    {
+      const int max_level = Transformable::H2D_MAX_TRN_LEVEL;
+      int mid_vert = vertex->id; // ID of vertex in between vertices from par_vertex_id.
+      int bnd_verts[2];
+      bnd_verts[0] = bounding_verts_id[0];
+      bnd_verts[1] = bounding_verts_id[1];
+
+      if(n_sons >= (unsigned) max_level)
+        throw Hermes::Exceptions::Exception("Maximum number of transformations exceeded in EdgeNeighborTable::find_act_elem_down");
+
+      for (int i = 0; i < 2; i++)
+      {
+        sons[n_sons-1] = (active_edge + i) % central_el->get_nvert();
+
+        // Try to get a pointer to the edge between the middle vertex and one of the vertices bounding the previously
+        // tested segment.
+        Node* edge = mesh->peek_edge_node(mid_vert, bnd_verts[i]);
+
+        if(edge == NULL) // The edge is not used, i.e. there is no active element on either side.
+        {
+          // Get the middle vertex of this edge and try again on the segments into which this vertex splits the edge.
+          Node * n = mesh->peek_vertex_node(mid_vert, bnd_verts[i]);
+          if(n == NULL)
+            throw Hermes::Exceptions::Exception("wasn't able to find middle vertex");
+
+          // Make sure the next visited segment has the same orientation as the original central element's active edge.
+          if(i == 0)
+            bounding_verts_id[1] = mid_vert;
+          else
+            bounding_verts_id[0] = mid_vert;
+
+          find_act_elem_down(central_el, active_edge, n, bounding_verts_id, sons, n_sons + 1);
+
+          bounding_verts_id[0] = bnd_verts[0];
+          bounding_verts_id[1] = bnd_verts[1];
+        }
+        else  // We have found a used edge, the active neighbor we are looking for is on one of its sides.
+        {
+          for (int j = 0; j < 2; j++)
+          {
+            if((edge->elem[j] != NULL) && (edge->elem[j]->active == 1))
+            {
+              Element* neighb_el = mesh->get_element(edge->elem[j]->id);
+              int local_num_of_edge = local_edge(neighb_el, edge);
+
+              // The transformation path to the current neighbor.
+              unsigned int transf[max_level];
+              for(unsigned int k = 0; k < n_sons; k++)
+                transf[k] = sons[k];
+
+              add_neighbor(neighb_el, local_num_of_edge, edge_orientation(neighb_el, local_num_of_edge, bnd_verts[0], bnd_verts[1], i), transf, n_sons);
+            }
+          }
+        }
+      }
+    }
+  }
+}
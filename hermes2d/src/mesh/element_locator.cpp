@@ -0,0 +1,147 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "element_locator.h"
+#include "mesh.h"
+#include "active_element_arrays.h"
+#include "refmap.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    ElementLocator::ElementLocator(const Mesh* mesh) : seq(mesh->get_seq()), x_min(0.0), y_min(0.0), cell_width(1.0), cell_height(1.0), nx(1), ny(1), tolerance(0.0)
+    {
+      const ActiveElementArrays* arrays = mesh->get_active_element_arrays();
+      elements = arrays->elements;
+      boxes.reserve(4 * arrays->get_num_elements());
+      for (int k = 0; k < arrays->get_num_elements(); k++)
+      {
+        // The fourth vertex of a triangle repeats the first one.
+        const double* x = &arrays->x[4 * k];
+        const double* y = &arrays->y[4 * k];
+        double box[4] = { x[0], y[0], x[0], y[0] };
+        for (unsigned int i = 1; i < 4; i++)
+        {
+          box[0] = std::min(box[0], x[i]);
+          box[1] = std::min(box[1], y[i]);
+          box[2] = std::max(box[2], x[i]);
+          box[3] = std::max(box[3], y[i]);
+        }
+        if(arrays->is_curved(k))
+        {
+          double inflation = 0.5 * std::max(box[2] - box[0], box[3] - box[1]);
+          box[0] -= inflation;
+          box[1] -= inflation;
+          box[2] += inflation;
+          box[3] += inflation;
+        }
+        boxes.insert(boxes.end(), box, box + 4);
+      }
+
+      int num_elements = (int)elements.size();
+      if(num_elements == 0)
+      {
+        cell_starts.assign(2, 0);
+        return;
+      }
+
+      double x_max = boxes[2], y_max = boxes[3];
+      x_min = boxes[0];
+      y_min = boxes[1];
+      for (int k = 1; k < num_elements; k++)
+      {
+        x_min = std::min(x_min, boxes[4 * k]);
+        y_min = std::min(y_min, boxes[4 * k + 1]);
+        x_max = std::max(x_max, boxes[4 * k + 2]);
+        y_max = std::max(y_max, boxes[4 * k + 3]);
+      }
+      double size = std::max(x_max - x_min, y_max - y_min);
+      tolerance = 1e-10 * size;
+
+      // About one element per cell, the cells as square as possible.
+      double width = std::max(x_max - x_min, 1e-3 * size), height = std::max(y_max - y_min, 1e-3 * size);
+      nx = std::max(1, std::min(num_elements, (int) std::ceil(std::sqrt(num_elements * width / height))));
+      ny = std::max(1, std::min(num_elements, (int) std::ceil(num_elements / (double) nx)));
+      cell_width = width / nx;
+      cell_height = height / ny;
+
+      // The cells overlapped by the elements.
+      std::vector<int> ranges(4 * num_elements);
+      for (int k = 0; k < num_elements; k++)
+      {
+        ranges[4 * k] = cell_index(boxes[4 * k] - tolerance, x_min, cell_width, nx);
+        ranges[4 * k + 1] = cell_index(boxes[4 * k + 1] - tolerance, y_min, cell_height, ny);
+        ranges[4 * k + 2] = cell_index(boxes[4 * k + 2] + tolerance, x_min, cell_width, nx);
+        ranges[4 * k + 3] = cell_index(boxes[4 * k + 3] + tolerance, y_min, cell_height, ny);
+      }
+
+      cell_starts.assign(nx * ny + 1, 0);
+      for (int k = 0; k < num_elements; k++)
+        for (int j = ranges[4 * k + 1]; j <= ranges[4 * k + 3]; j++)
+          for (int i = ranges[4 * k]; i <= ranges[4 * k + 2]; i++)
+            cell_starts[j * nx + i + 1]++;
+      for (int c = 0; c < nx * ny; c++)
+        cell_starts[c + 1] += cell_starts[c];
+
+      cell_elements.resize(cell_starts[nx * ny]);
+      std::vector<int> cell_fill(cell_starts.begin(), cell_starts.end() - 1);
+      for (int k = 0; k < num_elements; k++)
+        for (int j = ranges[4 * k + 1]; j <= ranges[4 * k + 3]; j++)
+          for (int i = ranges[4 * k]; i <= ranges[4 * k + 2]; i++)
+            cell_elements[cell_fill[j * nx + i]++] = k;
+    }
+
+    ElementLocator::~ElementLocator()
+    {
+    }
+
+    unsigned ElementLocator::get_seq() const
+    {
+      return this->seq;
+    }
+
+    int ElementLocator::cell_index(double coordinate, double min, double size, int n) const
+    {
+      int index = (int) std::floor((coordinate - min) / size);
+      return std::max(0, std::min(n - 1, index));
+    }
+
+    Element* ElementLocator::find(double x, double y, double* x_reference, double* y_reference) const
+    {
+      if(elements.empty() || x < x_min - tolerance || y < y_min - tolerance || x > x_min + nx * cell_width + tolerance || y > y_min + ny * cell_height + tolerance)
+        return NULL;
+
+      int c = cell_index(y, y_min, cell_height, ny) * nx + cell_index(x, x_min, cell_width, nx);
+      for (int l = cell_starts[c]; l < cell_starts[c + 1]; l++)
+      {
+        int k = cell_elements[l];
+        if(x < boxes[4 * k] - tolerance || y < boxes[4 * k + 1] - tolerance || x > boxes[4 * k + 2] + tolerance || y > boxes[4 * k + 3] + tolerance)
+          continue;
+
+        double xi1, xi2;
+        if(RefMap::is_element_on_physical_coordinates(elements[k], x, y, &xi1, &xi2))
+        {
+          if(x_reference != NULL)
+            (*x_reference) = xi1;
+          if(y_reference != NULL)
+            (*y_reference) = xi2;
+          return elements[k];
+        }
+      }
+      return NULL;
+    }
+  }
+}
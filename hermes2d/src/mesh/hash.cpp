@@ -23,7 +23,9 @@ namespace Hermes
   {
     HashTable::HashTable()
     {
-      v_table = NULL; e_table = NULL;
+      v_table.slots = e_table.slots = NULL;
+      v_table.mask = e_table.mask = -1;
+      v_table.count = e_table.count = 0;
     }
 
     HashTable::~HashTable()
@@ -31,30 +33,119 @@ namespace Hermes
       free();
     }
 
+    void HashTable::init_table(Table& table, int size)
+    {
+      table.slots = new Slot[size];
+      // All ids -1.
+      memset(table.slots, 0xff, size * sizeof(Slot));
+      table.mask = size - 1;
+      table.count = 0;
+    }
+
+    void HashTable::free_table(Table& table)
+    {
+      if(table.slots != NULL)
+      {
+        delete [] table.slots;
+        table.slots = NULL;
+      }
+      table.mask = -1;
+      table.count = 0;
+    }
+
     void HashTable::init(int size)
     {
-      v_table = e_table = NULL;
+      if(size <= 0 || (size & (size - 1)))
+        throw Hermes::Exceptions::Exception("Parameter 'size' must be a power of two.");
 
-      mask = size-1;
-      if(size & mask) throw Hermes::Exceptions::Exception("Parameter 'size' must be a power of two.");
+      free_table(v_table);
+      free_table(e_table);
+      init_table(v_table, size);
+      init_table(e_table, size);
+    }
 
-      // allocate and initialize the hash tables
-      v_table = new Node*[size];
-      e_table = new Node*[size];
+    inline int HashTable::find_slot(const Table& table, int p1, int p2)
+    {
+      int i = hash(p1, p2, table.mask);
+      while (table.slots[i].id != -1 && (table.slots[i].p1 != p1 || table.slots[i].p2 != p2))
+        i = (i + 1) & table.mask;
+      return i;
+    }
 
-      memset(v_table, 0, size * sizeof(Node*));
-      memset(e_table, 0, size * sizeof(Node*));
+    void HashTable::insert_slot(Table& table, int p1, int p2, int id)
+    {
+      // Keep the load factor at most 1/2.
+      if(2 * (table.count + 1) > table.mask + 1)
+        resize_table(table, 2 * (table.mask + 1));
+
+      Slot& slot = table.slots[find_slot(table, p1, p2)];
+      slot.p1 = p1;
+      slot.p2 = p2;
+      slot.id = id;
+      table.count++;
     }
 
-    void HashTable::copy_list(Node** ptr, Node* node)
+    void HashTable::resize_table(Table& table, int size)
     {
-      while (node != NULL)
+      Table old_table = table;
+      init_table(table, size);
+      for (int i = 0; i <= old_table.mask; i++)
       {
-        *ptr = &nodes[node->id];
-        ptr = &((*ptr)->next_hash);
-        node = node->next_hash;
+        Slot& slot = old_table.slots[i];
+        if(slot.id != -1)
+          table.slots[find_slot(table, slot.p1, slot.p2)] = slot;
       }
-      *ptr = NULL;
+      table.count = old_table.count;
+      free_table(old_table);
+    }
+
+    void HashTable::reserve(int num_new_vertex_nodes, int num_new_edge_nodes)
+    {
+      Table* tables[2] = { &v_table, &e_table };
+      int num_new_nodes[2] = { num_new_vertex_nodes, num_new_edge_nodes };
+      for (int i = 0; i < 2; i++)
+      {
+        if(tables[i]->slots == NULL)
+          continue;
+        int size = tables[i]->mask + 1;
+        while (2 * (tables[i]->count + num_new_nodes[i]) > size)
+          size *= 2;
+        if(size > tables[i]->mask + 1)
+          resize_table(*tables[i], size);
+      }
+      // The pages of the nodes at once as well.
+      nodes.reserve(num_new_vertex_nodes + num_new_edge_nodes);
+    }
+
+    void HashTable::remove_slot(Table& table, int p1, int p2)
+    {
+      int i = find_slot(table, p1, p2);
+      if(table.slots[i].id == -1)
+        return;
+
+      // Backward shift: move the following entries of the cluster that may not stay behind the hole.
+      int j = i;
+      while (true)
+      {
+        j = (j + 1) & table.mask;
+        if(table.slots[j].id == -1)
+          break;
+        int home = hash(table.slots[j].p1, table.slots[j].p2, table.mask);
+        // The entry stays if its home slot is (cyclically) in (i, j].
+        if(i <= j ? (i < home && home <= j) : (i < home || home <= j))
+          continue;
+        table.slots[i] = table.slots[j];
+        i = j;
+      }
+      table.slots[i].id = -1;
+      table.count--;
+    }
+
+    Node* HashTable::peek_node(const Table& table, int p1, int p2) const
+    {
+      if(p1 > p2) std::swap(p1, p2);
+      int id = table.slots[find_slot(table, p1, p2)].id;
+      return id == -1 ? NULL : &nodes[id];
     }
 
     Node* HashTable::get_node(int id) const
@@ -68,6 +159,11 @@ namespace Hermes
       return nodes.get_num_items();
     }
 
+    size_t HashTable::get_nodes_memory_usage() const
+    {
+      return (size_t) nodes.get_size() * sizeof(Node) + (size_t) (v_table.mask + 1 + e_table.mask + 1) * sizeof(Slot);
+    }
+
     /// Returns the maximum node id number plus one.
     int HashTable::get_max_node_id() const
     {
@@ -78,76 +174,50 @@ namespace Hermes
     {
       free();
       nodes.copy(ht->nodes);
-      mask = ht->mask;
 
-      v_table = new Node*[mask + 1];
-      e_table = new Node*[mask + 1];
-      for (int i = 0; i <= mask; i++)
-      {
-        copy_list(v_table + i, ht->v_table[i]);
-        copy_list(e_table + i, ht->e_table[i]);
-      }
+      // The slots hold ids only, they are valid for the copied nodes as well.
+      init_table(v_table, ht->v_table.mask + 1);
+      init_table(e_table, ht->e_table.mask + 1);
+      memcpy(v_table.slots, ht->v_table.slots, (v_table.mask + 1) * sizeof(Slot));
+      memcpy(e_table.slots, ht->e_table.slots, (e_table.mask + 1) * sizeof(Slot));
+      v_table.count = ht->v_table.count;
+      e_table.count = ht->e_table.count;
     }
 
     void HashTable::rebuild()
     {
-      memset(v_table, 0, (mask + 1) * sizeof(Node*));
-      memset(e_table, 0, (mask + 1) * sizeof(Node*));
+      int v_size = v_table.mask + 1, e_size = e_table.mask + 1;
+      free_table(v_table);
+      free_table(e_table);
+      init_table(v_table, v_size > 0 ? v_size : H2D_DEFAULT_HASH_SIZE);
+      init_table(e_table, e_size > 0 ? e_size : H2D_DEFAULT_HASH_SIZE);
 
       Node* node;
       for_all_nodes(node, this)
       {
         int p1 = node->p1, p2 = node->p2;
+        // Top-level vertex nodes have no parents, they are never searched for.
+        if(p1 < 0 || p2 < 0)
+          continue;
         if(p1 > p2) std::swap(p1, p2);
-        int idx = hash(p1, p2);
-
-        if(node->type == HERMES_TYPE_VERTEX)
-        {
-          node->next_hash = v_table[idx];
-          v_table[idx] = node;
-        }
-        else
-        {
-          node->next_hash = e_table[idx];
-          e_table[idx] = node;
-        }
+        insert_slot(node->type == HERMES_TYPE_VERTEX ? v_table : e_table, p1, p2, node->id);
       }
     }
 
     void HashTable::free()
     {
       nodes.free();
-      if(v_table != NULL)
-      {
-        delete [] v_table;
-        v_table = NULL;
-      }
-      if(e_table != NULL)
-      {
-        delete [] e_table;
-        e_table = NULL;
-      }
-    }
-
-    inline Node* HashTable::search_list(Node* node, int p1, int p2) const
-    {
-      while (node != NULL)
-      {
-        if(node->p1 == p1 && node->p2 == p2)
-          return node;
-        node = node->next_hash;
-      }
-      return NULL;
+      free_table(v_table);
+      free_table(e_table);
     }
 
     Node* HashTable::get_vertex_node(int p1, int p2)
     {
       // search for the node in the vertex hashtable
       if(p1 > p2) std::swap(p1, p2);
-      int i = hash(p1, p2);
-      Node* node = search_list(v_table[i], p1, p2);
-      if(node != NULL) 
-        return node;
+      int id = v_table.slots[find_slot(v_table, p1, p2)].id;
+      if(id != -1)
+        return &nodes[id];
 
       // not found - create a new one
       Node* newnode = nodes.add();
@@ -163,8 +233,7 @@ namespace Hermes
       newnode->y = (nodes[p1].y + nodes[p2].y) * 0.5;
 
       // insert into hashtable
-      newnode->next_hash = v_table[i];
-      v_table[i] = newnode;
+      insert_slot(v_table, p1, p2, newnode->id);
 
       return newnode;
     }
@@ -173,9 +242,9 @@ namespace Hermes
     {
       // search for the node in the edge hashtable
       if(p1 > p2) std::swap(p1, p2);
-      int i = hash(p1, p2);
-      Node* node = search_list(e_table[i], p1, p2);
-      if(node != NULL) return node;
+      int id = e_table.slots[find_slot(e_table, p1, p2)].id;
+      if(id != -1)
+        return &nodes[id];
 
       // not found - create a new one
       Node* newnode = nodes.add();
@@ -190,40 +259,25 @@ namespace Hermes
       newnode->elem[0] = newnode->elem[1] = NULL;
 
       // insert into hashtable
-      newnode->next_hash = e_table[i];
-      e_table[i] = newnode;
+      insert_slot(e_table, p1, p2, newnode->id);
 
       return newnode;
     }
 
     Node* HashTable::peek_vertex_node(int p1, int p2) const
     {
-      if(p1 > p2) std::swap(p1, p2);
-      return search_list(v_table[hash(p1, p2)], p1, p2);
+      return peek_node(v_table, p1, p2);
     }
 
     Node* HashTable::peek_edge_node(int p1, int p2) const
     {
-      if(p1 > p2) std::swap(p1, p2);
-      return search_list(e_table[hash(p1, p2)], p1, p2);
+      return peek_node(e_table, p1, p2);
     }
 
     void HashTable::remove_vertex_node(int id)
     {
       // remove the node from the hash table
-      int i = hash(nodes[id].p1, nodes[id].p2);
-      Node** ptr = v_table + i;
-      Node* node = *ptr;
-      while (node != NULL)
-      {
-        if(node->id == id)
-        {
-          *ptr = node->next_hash;
-          break;
-        }
-        ptr = &node->next_hash;
-        node = *ptr;
-      }
+      remove_slot(v_table, nodes[id].p1, nodes[id].p2);
 
       // remove node from the array
       nodes.remove(id);
@@ -232,19 +286,7 @@ namespace Hermes
     void HashTable::remove_edge_node(int id)
     {
       // remove the node from the hash table
-      int i = hash(nodes[id].p1, nodes[id].p2);
-      Node** ptr = e_table + i;
-      Node* node = *ptr;
-      while (node != NULL)
-      {
-        if(node->id == id)
-        {
-          *ptr = node->next_hash;
-          break;
-        }
-        ptr = &node->next_hash;
-        node = *ptr;
-      }
+      remove_slot(e_table, nodes[id].p1, nodes[id].p2);
 
       // remove node from the array
       nodes.remove(id);
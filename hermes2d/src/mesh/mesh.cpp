@@ -15,7 +15,11 @@
 
 #include "mesh.h"
 #include "refmap.h"
+#include "element_locator.h"
+#include "edge_neighbor_table.h"
+#include "active_element_arrays.h"
 #include <algorithm>
+#include <limits>
 #include "global.h"
 #include "api2d.h"
 #include "mesh_reader_h2d.h"
@@ -74,8 +78,7 @@ namespace Hermes
         vn[i]->ref_element();
         en[i]->ref_element(this);
       }
-      this->areaCalculated = false;
-      this->diameterCalculated = false;
+      this->reset_cached_geometry();
     }
 
     int Element::get_edge_orientation(int ie) const
@@ -90,11 +93,17 @@ namespace Hermes
         vn[i]->unref_element(ht);
         en[i]->unref_element(ht, this);
       }
+      this->reset_cached_geometry();
+    }
+
+    void Element::reset_cached_geometry()
+    {
       this->areaCalculated = false;
       this->diameterCalculated = false;
+      this->center_set = false;
     }
 
-    Element::Element() : visited(false), area(0.0), diameter(0.0), center_set(false)
+    Element::Element() : visited(false), areaCalculated(false), area(0.0), center_set(false), diameterCalculated(false), diameter(0.0)
     {
     };
 
@@ -252,6 +261,11 @@ namespace Hermes
     {
       nbase = nactive = ntopvert = ninitial = 0;
       seq = g_mesh_seq++;
+      batch_refinement = false;
+      element_locator = NULL;
+      edge_neighbor_table = NULL;
+      active_element_arrays = NULL;
+      cached_ref_mesh = NULL;
     }
 
     Mesh::~Mesh() 
@@ -259,6 +273,16 @@ namespace Hermes
       free();
     }
 
+    size_t Mesh::get_memory_usage() const
+    {
+      size_t usage = this->get_nodes_memory_usage() + (size_t) this->elements.get_size() * sizeof(Element);
+      Element* e;
+      for_all_elements(e, this)
+        if(e->cm != NULL)
+          usage += e->cm->get_memory_usage();
+      return usage;
+    }
+
     bool Mesh::isOkay() const
     {
       bool okay = true;
@@ -272,15 +296,39 @@ namespace Hermes
       return okay;
     }
 
-    Mesh::ReferenceMeshCreator::ReferenceMeshCreator(Mesh* coarse_mesh, int refinement) : coarse_mesh(coarse_mesh), refinement(refinement)
+    Mesh::ReferenceMeshCreator::ReferenceMeshCreator(Mesh* coarse_mesh, int refinement, bool cache) : coarse_mesh(coarse_mesh), refinement(refinement), cache(cache)
     {
     }
 
     Mesh* Mesh::ReferenceMeshCreator::create_ref_mesh()
     {
       Mesh* ref_mesh = new Mesh;
+
+      // p-only reference, nothing to refine (and to cache).
+      if(this->refinement == -1)
+      {
+        ref_mesh->copy(this->coarse_mesh);
+        return ref_mesh;
+      }
+
+      Mesh* cached = this->coarse_mesh->cached_ref_mesh;
+      if(this->cache && cached != NULL && this->coarse_mesh->cached_ref_mesh_seq == this->coarse_mesh->seq && this->coarse_mesh->cached_ref_mesh_refinement == this->refinement)
+      {
+        ref_mesh->copy(cached);
+        return ref_mesh;
+      }
+
       ref_mesh->copy(this->coarse_mesh);
       ref_mesh->refine_all_elements(refinement, false);
+
+      if(this->cache)
+      {
+        this->coarse_mesh->free_cached_ref_mesh();
+        this->coarse_mesh->cached_ref_mesh = new Mesh;
+        this->coarse_mesh->cached_ref_mesh->copy(ref_mesh);
+        this->coarse_mesh->cached_ref_mesh_refinement = this->refinement;
+        this->coarse_mesh->cached_ref_mesh_seq = this->coarse_mesh->seq;
+      }
       return ref_mesh;
     }
 
@@ -340,7 +388,6 @@ namespace Hermes
         node->type = HERMES_TYPE_VERTEX;
         node->bnd = 0;
         node->p1 = node->p2 = -1;
-        node->next_hash = NULL;
         node->x = verts[i][0];
         node->y = verts[i][1];
       }
@@ -383,6 +430,7 @@ namespace Hermes
 
       nbase = nactive = ninitial = nt + nq;
       seq = g_mesh_seq++;
+      this->update_memory_usage();
     }
 
     int Mesh::get_num_elements() const
@@ -498,6 +546,156 @@ namespace Hermes
       this->seq = seq;
     }
 
+    // Index of the point (x, y) of the 2^order x 2^order grid along the Hilbert curve.
+    static uint64_t hilbert_index(unsigned int x, unsigned int y, int order)
+    {
+      uint64_t index = 0;
+      for (unsigned int s = 1u << (order - 1); s > 0; s >>= 1)
+      {
+        unsigned int rx = (x & s) ? 1 : 0;
+        unsigned int ry = (y & s) ? 1 : 0;
+        index += (uint64_t) s * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant.
+        if(ry == 0)
+        {
+          if(rx == 1)
+          {
+            x = s - 1 - (x & (s - 1));
+            y = s - 1 - (y & (s - 1));
+          }
+          std::swap(x, y);
+        }
+        x &= s - 1;
+        y &= s - 1;
+      }
+      return index;
+    }
+
+    struct HilbertKeyLess
+    {
+      bool operator()(const std::pair<uint64_t, Element*>& a, const std::pair<uint64_t, Element*>& b) const
+      {
+        return a.first < b.first;
+      }
+    };
+
+    void Mesh::get_active_elements_hilbert_order(Hermes::vector<Element*>& ordered_elements) const
+    {
+      const int order = 16;
+      const ActiveElementArrays* arrays = this->get_active_element_arrays();
+      int num_elements = arrays->get_num_elements();
+      std::vector<std::pair<uint64_t, Element*> > keys;
+      keys.reserve(num_elements);
+      double x_min = std::numeric_limits<double>::max(), y_min = x_min, x_max = -x_min, y_max = -x_min;
+      // The fourth vertex of a triangle repeats the first one.
+      for (int k = 0; k < 4 * num_elements; k++)
+      {
+        x_min = std::min(x_min, arrays->x[k]);
+        y_min = std::min(y_min, arrays->y[k]);
+        x_max = std::max(x_max, arrays->x[k]);
+        y_max = std::max(y_max, arrays->y[k]);
+      }
+      double scale = ((1u << order) - 1) / std::max(std::max(x_max - x_min, y_max - y_min), 1e-300);
+
+      for (int k = 0; k < num_elements; k++)
+      {
+        int nvert = arrays->get_nvert(k);
+        double x = 0.0, y = 0.0;
+        for (int i = 0; i < nvert; i++)
+        {
+          x += arrays->x[4 * k + i];
+          y += arrays->y[4 * k + i];
+        }
+        x /= nvert;
+        y /= nvert;
+        keys.push_back(std::make_pair(hilbert_index((unsigned int) ((x - x_min) * scale), (unsigned int) ((y - y_min) * scale), order), arrays->elements[k]));
+      }
+      // Stable with respect to the ids for the elements in the same grid cell.
+      std::stable_sort(keys.begin(), keys.end(), HilbertKeyLess());
+
+      ordered_elements.clear();
+      for (unsigned int i = 0; i < keys.size(); i++)
+        ordered_elements.push_back(keys[i].second);
+    }
+
+    const ElementLocator* Mesh::get_element_locator() const
+    {
+      ElementLocator* locator = this->element_locator;
+      if(locator == NULL || locator->get_seq() != this->seq)
+      {
+#pragma omp critical (mesh_element_locator)
+        {
+          if(this->element_locator == NULL || this->element_locator->get_seq() != this->seq)
+          {
+            delete this->element_locator;
+            this->element_locator = new ElementLocator(this);
+          }
+          locator = this->element_locator;
+        }
+      }
+      return locator;
+    }
+
+    void Mesh::free_element_locator()
+    {
+      delete this->element_locator;
+      this->element_locator = NULL;
+    }
+
+    const EdgeNeighborTable* Mesh::get_edge_neighbor_table() const
+    {
+      EdgeNeighborTable* table = this->edge_neighbor_table;
+      if(table == NULL || table->get_seq() != this->seq)
+      {
+#pragma omp critical (mesh_edge_neighbor_table)
+        {
+          if(this->edge_neighbor_table == NULL || this->edge_neighbor_table->get_seq() != this->seq)
+          {
+            delete this->edge_neighbor_table;
+            this->edge_neighbor_table = new EdgeNeighborTable(this);
+          }
+          table = this->edge_neighbor_table;
+        }
+      }
+      return table;
+    }
+
+    void Mesh::free_edge_neighbor_table()
+    {
+      delete this->edge_neighbor_table;
+      this->edge_neighbor_table = NULL;
+    }
+
+    const ActiveElementArrays* Mesh::get_active_element_arrays() const
+    {
+      ActiveElementArrays* arrays = this->active_element_arrays;
+      if(arrays == NULL || arrays->get_seq() != this->seq)
+      {
+#pragma omp critical (mesh_active_element_arrays)
+        {
+          if(this->active_element_arrays == NULL || this->active_element_arrays->get_seq() != this->seq)
+          {
+            delete this->active_element_arrays;
+            this->active_element_arrays = new ActiveElementArrays(this);
+          }
+          arrays = this->active_element_arrays;
+        }
+      }
+      return arrays;
+    }
+
+    void Mesh::free_active_element_arrays()
+    {
+      delete this->active_element_arrays;
+      this->active_element_arrays = NULL;
+    }
+
+    void Mesh::free_cached_ref_mesh()
+    {
+      delete this->cached_ref_mesh;
+      this->cached_ref_mesh = NULL;
+    }
+
     Element* Mesh::get_element_fast(int id) const
     {
       return &(elements[id]);
@@ -668,7 +866,7 @@ namespace Hermes
       // update coefficients of curved reference mapping
       for (int i = 0; i < 4; i++)
         if(sons[i]->is_curved())
-          sons[i]->cm->update_refmap_coeffs(sons[i]);
+          this->update_refmap_coeffs(sons[i]);
 
       // deactivate this element and unregister from its nodes
       e->active = 0;
@@ -873,7 +1071,7 @@ namespace Hermes
       // update coefficients of curved reference mapping
       for (i = 0; i < 4; i++)
         if(sons[i] != NULL && sons[i]->cm != NULL)
-          sons[i]->cm->update_refmap_coeffs(sons[i]);
+          this->update_refmap_coeffs(sons[i]);
 
       // optimization: iro never gets worse
       if(e->iro_cache == 0)
@@ -971,6 +1169,63 @@ namespace Hermes
       this->refine_element(e, refinement);
     }
 
+    void Mesh::refine_elements_id(const Hermes::vector<int>& ids, const Hermes::vector<int>& refinements)
+    {
+      if(ids.size() != refinements.size())
+        throw Hermes::Exceptions::LengthException(2, refinements.size(), ids.size());
+
+      // A refinement adds at most five vertex nodes and twelve edge nodes (a quad split into four), and four elements.
+      this->reserve(5 * ids.size(), 12 * ids.size());
+      this->elements.reserve(4 * ids.size());
+
+      this->begin_batch_refinement();
+      for (unsigned int i = 0; i < ids.size(); i++)
+        refine_element_id(ids[i], refinements[i]);
+      this->finish_batch_refinement();
+    }
+
+    void Mesh::update_refmap_coeffs(Element* e)
+    {
+      if(!this->batch_refinement)
+      {
+        e->cm->update_refmap_coeffs(e);
+        return;
+      }
+
+      PendingRefmapUpdate update;
+      update.e = e;
+      for (unsigned int i = 0; i < e->get_nvert(); i++)
+      {
+        update.vertex_coords[i][0] = e->vn[i]->x;
+        update.vertex_coords[i][1] = e->vn[i]->y;
+      }
+      this->pending_refmap_updates.push_back(update);
+    }
+
+    void Mesh::begin_batch_refinement()
+    {
+      this->batch_refinement = true;
+      this->pending_refmap_updates.clear();
+    }
+
+    void Mesh::finish_batch_refinement()
+    {
+      this->batch_refinement = false;
+
+      // Every element has its own CurvMap, the projections are independent.
+      int num_updates = (int)this->pending_refmap_updates.size();
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads_used)
+      for (int i = 0; i < num_updates; i++)
+      {
+        PendingRefmapUpdate& update = this->pending_refmap_updates[i];
+        update.e->cm->update_refmap_coeffs(update.e, update.vertex_coords);
+      }
+
+      this->pending_refmap_updates.clear();
+      this->update_memory_usage();
+    }
+
     void Mesh::refine_all_elements(int refinement, bool mark_as_initial)
     {
       Element* e;
@@ -981,10 +1236,12 @@ namespace Hermes
         return;
 
       elements.set_append_only(true);
+      this->begin_batch_refinement();
 
       for_all_active_elements(e, this)
         refine_element_id(e->id, refinement);
 
+      this->finish_batch_refinement();
       elements.set_append_only(false);
 
       if(mark_as_initial)
@@ -999,6 +1256,7 @@ namespace Hermes
     {
       Element* e;
       elements.set_append_only(true);
+      this->begin_batch_refinement();
       for (int r, i = 0; i < depth; i++)
       {
         for_all_active_elements(e, this)
@@ -1007,10 +1265,39 @@ namespace Hermes
             refine_element_id(e->id, r);
         }
       }
+      this->finish_batch_refinement();
       elements.set_append_only(false);
 
       if(mark_as_initial)
         ninitial = this->get_max_element_id();
+      this->update_memory_usage();
+    }
+
+    void Mesh::refine_by_thread_safe_criterion(int (*criterion)(Element*), int depth)
+    {
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      elements.set_append_only(true);
+      this->begin_batch_refinement();
+      for (int i = 0; i < depth; i++)
+      {
+        // The elements refined in this pass are the ones active now (the sons get higher ids), refining an element
+        // does not change what the criterion sees for the others, so it can be evaluated beforehand.
+        int max_id = this->get_max_element_id();
+        std::vector<int> refinements(max_id, -1);
+#pragma omp parallel for schedule(static) num_threads(num_threads_used)
+        for (int id = 0; id < max_id; id++)
+        {
+          Element* e = this->get_element_fast(id);
+          if(e->used && e->active)
+            refinements[id] = criterion(e);
+        }
+
+        for (int id = 0; id < max_id; id++)
+          if(refinements[id] >= 0)
+            refine_element_id(id, refinements[id]);
+      }
+      this->finish_batch_refinement();
+      elements.set_append_only(false);
     }
 
     static int rtv_id;
@@ -1026,7 +1313,7 @@ namespace Hermes
     void Mesh::refine_towards_vertex(int vertex_id, int depth, bool mark_as_initial)
     {
       rtv_id = vertex_id;
-      refine_by_criterion(rtv_criterion, depth);
+      refine_by_thread_safe_criterion(rtv_criterion, depth);
       if(mark_as_initial)
         ninitial = this->get_max_element_id();
     }
@@ -1092,7 +1379,7 @@ namespace Hermes
             }
           }
 
-          refine_by_criterion(rtb_criterion, 1);
+          refine_by_thread_safe_criterion(rtb_criterion, 1);
           delete [] rtb_vert;
       }
 
@@ -1133,7 +1420,7 @@ namespace Hermes
               }
             }
 
-            refine_by_criterion(rtb_criterion, 1);
+            refine_by_thread_safe_criterion(rtb_criterion, 1);
             delete [] rtb_vert;
         }
 
@@ -1154,6 +1441,7 @@ namespace Hermes
     void Mesh::refine_in_areas(Hermes::vector<std::string> markers, int depth, bool mark_as_initial)
     {
       bool refined = true;
+      this->begin_batch_refinement();
       for (int i = 0; i < depth; i++)
       {
         refined = false;
@@ -1168,6 +1456,7 @@ namespace Hermes
             }
         }
       }
+      this->finish_batch_refinement();
 
       if(mark_as_initial)
         ninitial = this->get_max_element_id();
@@ -1209,6 +1498,7 @@ namespace Hermes
       // unrefine the found elements
       for (unsigned int i = 0; i < list.size(); i++)
         unrefine_element_id(list[i]);
+      this->update_memory_usage();
     }
 
     Nurbs* Mesh::reverse_nurbs(Nurbs* nurbs)
@@ -1331,9 +1621,15 @@ namespace Hermes
         n->x /= x_ref;
         n->y /= y_ref;
       }
+      this->free_element_locator();
+      this->free_active_element_arrays();
+      this->free_cached_ref_mesh();
 
-      // If curvilinear, throw an exception.
       Element* e;
+      for_all_elements(e, this)
+        e->reset_cached_geometry();
+
+      // If curvilinear, throw an exception.
       for_all_elements(e, this)
         if(e->cm != NULL)
         {
@@ -1343,10 +1639,74 @@ namespace Hermes
         return true;
     }
 
-    void Mesh::copy(const Mesh* mesh)
+    void Mesh::defragment(std::vector<int>* element_ids_out, std::vector<int>* node_ids_out)
     {
-      unsigned int i;
+      std::vector<int> element_ids, node_ids;
+      elements.get_defragmented_ids(ninitial, element_ids);
+      nodes.get_defragmented_ids(ntopvert, node_ids);
+
+      // The pointers are redirected to the new positions first (the ids are still the old ones), the items are moved with them.
+      Element* e;
+      for_all_elements(e, this)
+      {
+        unsigned int i;
+        for (i = 0; i < e->get_nvert(); i++)
+          e->vn[i] = &nodes[node_ids[e->vn[i]->id]];
 
+        if(e->active)
+        {
+          for (i = 0; i < e->get_nvert(); i++)
+            e->en[i] = &nodes[node_ids[e->en[i]->id]];
+        }
+        else
+        {
+          for (i = 0; i < H2D_MAX_ELEMENT_SONS; i++)
+            if(e->sons[i] != NULL)
+              e->sons[i] = &elements[element_ids[e->sons[i]->id]];
+        }
+
+        if(e->cm != NULL && !e->cm->toplevel)
+          e->cm->parent = &elements[element_ids[e->cm->parent->id]];
+        if(e->parent != NULL)
+          e->parent = &elements[element_ids[e->parent->id]];
+      }
+
+      Node* node;
+      for_all_nodes(node, this)
+      {
+        if(node->type == HERMES_TYPE_EDGE)
+          for (int i = 0; i < 2; i++)
+            if(node->elem[i] != NULL)
+              node->elem[i] = &elements[element_ids[node->elem[i]->id]];
+        // The parents of the top-level vertex nodes are negative.
+        if(node->p1 >= 0)
+          node->p1 = node_ids[node->p1];
+        if(node->p2 >= 0)
+          node->p2 = node_ids[node->p2];
+      }
+
+      elements.defragment(ninitial, element_ids);
+      nodes.defragment(ntopvert, node_ids);
+
+      // The hash tables are keyed by the parent ids.
+      this->rebuild();
+
+      this->refinements.clear();
+      this->free_element_locator();
+      this->free_edge_neighbor_table();
+      this->free_active_element_arrays();
+      this->free_cached_ref_mesh();
+      this->seq = g_mesh_seq++;
+      this->update_memory_usage();
+
+      if(element_ids_out != NULL)
+        element_ids_out->swap(element_ids);
+      if(node_ids_out != NULL)
+        node_ids_out->swap(node_ids);
+    }
+
+    void Mesh::copy(const Mesh* mesh)
+    {
       free();
       // Serves as a Mesh::init() for purposes of pointer calculation.
 
@@ -1356,9 +1716,18 @@ namespace Hermes
 
       this->refinements = mesh->refinements;
 
-      Element* e;
-      for_all_elements(e, this)
+      // Every element and every node updates only its own pointers.
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      int max_element_id = this->get_max_element_id();
+#pragma omp parallel for schedule(static) num_threads(num_threads_used)
+      for (int id = 0; id < max_element_id; id++)
       {
+        Element* e = this->get_element_fast(id);
+        if(!e->used)
+          continue;
+
+        unsigned int i;
+
         // update vertex node pointers
         for (i = 0; i < e->get_nvert(); i++)
           e->vn[i] = &nodes[e->vn[i]->id];
@@ -1391,11 +1760,16 @@ namespace Hermes
       }
 
       // update element pointers in edge nodes
-      Node* node;
-      for_all_edge_nodes(node, this)
-        for (i = 0; i < 2; i++)
-          if(node->elem[i] != NULL)
-            node->elem[i] = &elements[node->elem[i]->id];
+      int max_node_id = this->get_max_node_id();
+#pragma omp parallel for schedule(static) num_threads(num_threads_used)
+      for (int id = 0; id < max_node_id; id++)
+      {
+        Node* node = this->get_node(id);
+        if(node->used && node->type)
+          for (int i = 0; i < 2; i++)
+            if(node->elem[i] != NULL)
+              node->elem[i] = &elements[node->elem[i]->id];
+      }
 
       nbase = mesh->nbase;
       nactive = mesh->nactive;
@@ -1404,6 +1778,7 @@ namespace Hermes
       seq = mesh->seq;
       boundary_markers_conversion = mesh->boundary_markers_conversion;
       element_markers_conversion = mesh->element_markers_conversion;
+      this->update_memory_usage();
     }
 
     Node* Mesh::get_base_edge_node(Element* base, int edge)
@@ -1468,6 +1843,7 @@ namespace Hermes
       nbase = nactive = ninitial = mesh->nbase;
       ntopvert = mesh->ntopvert;
       seq = g_mesh_seq++;
+      this->update_memory_usage();
     }
 
     void Mesh::free()
@@ -1488,7 +1864,12 @@ namespace Hermes
       this->element_markers_conversion.conversion_table.clear();
       this->element_markers_conversion.conversion_table_inverse.clear();
       this->refinements.clear();
+      this->free_element_locator();
+      this->free_edge_neighbor_table();
+      this->free_active_element_arrays();
+      this->free_cached_ref_mesh();
       this->seq = -1;
+      this->update_memory_usage();
     }
 
     void Mesh::copy_converted(Mesh* mesh)
@@ -1574,6 +1955,7 @@ namespace Hermes
       nbase = nactive = ninitial = mesh->nactive;
       ntopvert = mesh->ntopvert = get_num_nodes();
       seq = g_mesh_seq++;
+      this->update_memory_usage();
     }
 
     void Mesh::convert_quads_to_triangles()
@@ -1918,7 +2300,7 @@ namespace Hermes
       // update coefficients of curved reference mapping
       for (int i = 0; i < 3; i++)
         if(sons[i]->is_curved())
-          sons[i]->cm->update_refmap_coeffs(sons[i]);
+          this->update_refmap_coeffs(sons[i]);
 
       // deactivate this element and unregister from its nodes
       e->active = 0;
@@ -2115,7 +2497,7 @@ namespace Hermes
       {
         if(sons[i]->is_curved())
         {
-          sons[i]->cm->update_refmap_coeffs(sons[i]);
+          this->update_refmap_coeffs(sons[i]);
         }
       }
       nactive += 2;
@@ -2946,7 +3328,7 @@ namespace Hermes
       // update coefficients of curved reference mapping
       for (i = 0; i < 4; i++)
         if(sons[i] != NULL && sons[i]->cm != NULL)
-          sons[i]->cm->update_refmap_coeffs(sons[i]);
+          this->update_refmap_coeffs(sons[i]);
 
       //set pointers to parent element for sons
       for(int i = 0; i < 4; i++)
@@ -3208,20 +3590,79 @@ namespace Hermes
     {
       if(e->sons[i] != NULL)
       {
-        if(e->sons[i]->id >= parents_size)
+        grow_parents(e->sons[i]->id + 1);
+        parents[e->sons[i]->id] = parents[e->id];
+      }
+    }
+
+    void Mesh::grow_parents(int size)
+    {
+      if(size <= parents_size)
+        return;
+      while (parents_size < size)
+        parents_size = parents_size > 0 ? 2 * parents_size : size;
+      parents = (int*) realloc(parents, sizeof(int) * parents_size);
+    }
+
+    int Mesh::get_regularization_refinement(Element* e, int n)
+    {
+      int j;
+      if(e->is_triangle())
+      {
+        for(int i = 0; i < e->get_nvert(); i++)
         {
-          parents_size = 2 * parents_size;
-          parents = (int*) realloc(parents, sizeof(int) * parents_size);
+          j = e->next_vert(i);
+          if(get_edge_degree(e->vn[i], e->vn[j]) > n)
+            return 0;
         }
+        return -1;
+      }
 
-        parents[e->sons[i]->id] = parents[e->id];
+      if(   ((get_edge_degree(e->vn[0], e->vn[1]) > n)  || (get_edge_degree(e->vn[2], e->vn[3]) > n))
+        && (get_edge_degree(e->vn[1], e->vn[2]) <= n) && (get_edge_degree(e->vn[3], e->vn[0]) <= n) )
+        return 2;
+      if(    (get_edge_degree(e->vn[0], e->vn[1]) <= n)  && (get_edge_degree(e->vn[2], e->vn[3]) <= n)
+        && ((get_edge_degree(e->vn[1], e->vn[2]) > n) || (get_edge_degree(e->vn[3], e->vn[0]) > n)) )
+        return 1;
+      for(int i = 0; i < e->get_nvert(); i++)
+      {
+        j = e->next_vert(i);
+        if(get_edge_degree(e->vn[i], e->vn[j]) > n)
+          return 0;
+      }
+      return -1;
+    }
+
+    void Mesh::queue_regularization_neighbors(Node* v1, Node* v2, std::vector<char>& queued, std::vector<int>& worklist)
+    {
+      while (true)
+      {
+        Node* edge = peek_edge_node(v1->id, v2->id);
+        if(edge != NULL)
+        {
+          for (int k = 0; k < 2; k++)
+          {
+            Element* e = edge->elem[k];
+            if(e != NULL && e->active && !queued[e->id])
+            {
+              queued[e->id] = 1;
+              worklist.push_back(e->id);
+            }
+          }
+        }
+
+        // Continue with the coarser edge whose half (v1, v2) is.
+        if(v1->p1 >= 0 && (v1->p1 == v2->id || v1->p2 == v2->id))
+          v1 = get_node(v1->p1 == v2->id ? v1->p2 : v1->p1);
+        else if(v2->p1 >= 0 && (v2->p1 == v1->id || v2->p2 == v1->id))
+          v2 = get_node(v2->p1 == v1->id ? v2->p2 : v2->p1);
+        else
+          break;
       }
     }
 
     int* Mesh::regularize(int n)
     {
-      int j;
-      bool ok;
       bool reg = false;
       Element* e;
 
@@ -3236,49 +3677,56 @@ namespace Hermes
       for_all_active_elements(e, this)
         parents[e->id] = e->id;
 
-      do
+      // The active elements to check, at first all of them, then only the sons and the neighbors of the refined ones.
+      std::vector<int> worklist;
+      for_all_active_elements(e, this)
+        worklist.push_back(e->id);
+
+      int num_threads_used = Hermes2DApi.get_num_threads();
+      std::vector<int> refinements;
+      while (!worklist.empty())
       {
-        ok = true;
-        for_all_active_elements(e, this)
+        // The check only reads the mesh, the elements are checked in parallel.
+        int num_candidates = (int)worklist.size();
+        refinements.resize(num_candidates);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads_used)
+        for (int i = 0; i < num_candidates; i++)
+          refinements[i] = get_regularization_refinement(get_element(worklist[i]), n);
+
+        Hermes::vector<int> ids, isos;
+        for (int i = 0; i < num_candidates; i++)
         {
-          int iso = -1;
-          if(e->is_triangle())
+          if(refinements[i] >= 0)
           {
-            for(unsigned int i = 0; i < e->get_nvert(); i++)
-            {
-              j = e->next_vert(i);
-              if(get_edge_degree(e->vn[i], e->vn[j]) > n)
-              { iso = 0; ok = false; break; }
-            }
+            ids.push_back(worklist[i]);
+            isos.push_back(refinements[i]);
           }
-          else
+        }
+        if(ids.empty())
+          break;
+
+        refine_elements_id(ids, isos);
+        // A batch creates up to four sons per element, all of them get a parent below.
+        grow_parents(get_max_element_id());
+
+        std::vector<char> queued(get_max_element_id(), 0);
+        worklist.clear();
+        for (unsigned int i = 0; i < ids.size(); i++)
+        {
+          e = get_element(ids[i]);
+          for (int k = 0; k < 4; k++)
           {
-            if(   ((get_edge_degree(e->vn[0], e->vn[1]) > n)  || (get_edge_degree(e->vn[2], e->vn[3]) > n))
-              && (get_edge_degree(e->vn[1], e->vn[2]) <= n) && (get_edge_degree(e->vn[3], e->vn[0]) <= n) )
-            { iso = 2; ok = false; }
-            else if(    (get_edge_degree(e->vn[0], e->vn[1]) <= n)  && (get_edge_degree(e->vn[2], e->vn[3]) <= n)
-              && ((get_edge_degree(e->vn[1], e->vn[2]) > n) || (get_edge_degree(e->vn[3], e->vn[0]) > n)) )
-            { iso = 1; ok = false; }
-            else
+            assign_parent(e, k);
+            if(e->sons[k] != NULL && !queued[e->sons[k]->id])
             {
-              for(unsigned int i = 0; i < e->get_nvert(); i++)
-              {
-                j = e->next_vert(i);
-                if(get_edge_degree(e->vn[i], e->vn[j]) > n)
-                { iso = 0; ok = false; break; }
-              }
+              queued[e->sons[k]->id] = 1;
+              worklist.push_back(e->sons[k]->id);
             }
           }
-
-          if(iso >= 0)
-          {
-            refine_element_id(e->id, iso);
-            for (int i = 0; i < 4; i++)
-              assign_parent(e, i);
-          }
+          for (int k = 0; k < e->get_nvert(); k++)
+            queue_regularization_neighbors(e->vn[k], e->vn[e->next_vert(k)], queued, worklist);
         }
       }
-      while (!ok);
 
       if(reg)
       {
@@ -0,0 +1,161 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "mesh_partitioner.h"
+#include "mesh.h"
+#ifdef WITH_MPI
+#include <mpi.h>
+#endif
+#ifdef WITH_METIS
+#include <metis.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    Element* MeshPartitioner::get_base_element(Element* e)
+    {
+      while(e->parent != NULL)
+        e = e->parent;
+      return e;
+    }
+
+    int MeshPartitioner::get_rank()
+    {
+      int rank = 0;
+#ifdef WITH_MPI
+      int initialized = 0;
+      MPI_Initialized(&initialized);
+      if(initialized)
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+      return rank;
+    }
+
+    int MeshPartitioner::get_num_ranks()
+    {
+      int size = 1;
+#ifdef WITH_MPI
+      int initialized = 0;
+      MPI_Initialized(&initialized);
+      if(initialized)
+        MPI_Comm_size(MPI_COMM_WORLD, &size);
+#endif
+      return size;
+    }
+
+    void MeshPartitioner::get_weights(const Mesh* mesh, std::vector<int>& weights)
+    {
+      weights.assign(mesh->get_num_base_elements(), 0);
+      Element* e;
+      for_all_active_elements(e, mesh)
+        weights[get_base_element(e)->id]++;
+    }
+
+    void MeshPartitioner::partition(const Mesh* mesh, int num_parts, std::vector<int>& base_element_parts)
+    {
+      if(num_parts < 1)
+        throw Hermes::Exceptions::ValueException("num_parts", num_parts, 1);
+
+      int nbase = mesh->get_num_base_elements();
+      base_element_parts.assign(nbase, 0);
+      if(num_parts == 1 || nbase == 0)
+        return;
+
+      std::vector<int> weights;
+      get_weights(mesh, weights);
+
+#ifdef WITH_METIS
+      // Dual graph - two base elements are adjacent when they share an edge (the pair of its vertex node ids).
+      std::map<std::pair<int, int>, int> edge_owner;
+      std::vector<std::vector<idx_t> > neighbors(nbase);
+      Element* e;
+      for_all_base_elements(e, mesh)
+      {
+        for (int i = 0; i < e->get_nvert(); i++)
+        {
+          int a = e->vn[i]->id, b = e->vn[e->next_vert(i)]->id;
+          std::pair<int, int> key(std::min(a, b), std::max(a, b));
+          std::map<std::pair<int, int>, int>::iterator it = edge_owner.find(key);
+          if(it == edge_owner.end())
+            edge_owner.insert(std::make_pair(key, e->id));
+          else
+          {
+            neighbors[e->id].push_back(it->second);
+            neighbors[it->second].push_back(e->id);
+          }
+        }
+      }
+
+      std::vector<idx_t> xadj(nbase + 1, 0), adjncy, vwgt(nbase), part(nbase, 0);
+      for (int i = 0; i < nbase; i++)
+      {
+        xadj[i + 1] = xadj[i] + neighbors[i].size();
+        adjncy.insert(adjncy.end(), neighbors[i].begin(), neighbors[i].end());
+        // The unused base elements get a unit weight, METIS does not accept zero weights of all the vertices.
+        vwgt[i] = std::max(weights[i], 1);
+      }
+      // METIS does not accept an empty adjacency array.
+      if(adjncy.empty())
+        adjncy.push_back(0);
+
+      idx_t nvtxs = nbase, ncon = 1, nparts = num_parts, objval;
+      idx_t options[METIS_NOPTIONS];
+      METIS_SetDefaultOptions(options);
+      options[METIS_OPTION_NUMBERING] = 0;
+      int status = METIS_PartGraphKway(&nvtxs, &ncon, &xadj[0], &adjncy[0], &vwgt[0], NULL, NULL, &nparts, NULL, NULL, options, &objval, &part[0]);
+      if(status == METIS_OK)
+      {
+        for (int i = 0; i < nbase; i++)
+          base_element_parts[i] = part[i];
+        return;
+      }
+      Hermes::Mixins::Loggable::Static::warn("METIS_PartGraphKway failed (status %d), the Hilbert curve partition is used.", status);
+#endif
+      partition_hilbert(mesh, num_parts, weights, base_element_parts);
+    }
+
+    void MeshPartitioner::partition_hilbert(const Mesh* mesh, int num_parts, const std::vector<int>& weights, std::vector<int>& base_element_parts)
+    {
+      // The base elements in the order of their first active descendant along the Hilbert curve.
+      Hermes::vector<Element*> ordered_elements;
+      mesh->get_active_elements_hilbert_order(ordered_elements);
+      std::vector<bool> seen(weights.size(), false);
+      std::vector<int> ordered_base;
+      ordered_base.reserve(weights.size());
+      int total_weight = 0;
+      for (unsigned int i = 0; i < ordered_elements.size(); i++)
+      {
+        int id = get_base_element(ordered_elements[i])->id;
+        if(!seen[id])
+        {
+          seen[id] = true;
+          ordered_base.push_back(id);
+          total_weight += weights[id];
+        }
+      }
+
+      // Chunks of about the same number of the active elements.
+      int accumulated = 0;
+      for (unsigned int i = 0; i < ordered_base.size(); i++)
+      {
+        int id = ordered_base[i];
+        base_element_parts[id] = std::min((int) ((long long) accumulated * num_parts / std::max(total_weight, 1)), num_parts - 1);
+        accumulated += weights[id];
+      }
+    }
+  }
+}
@@ -18,7 +18,8 @@
 #include <string.h>
 #include "mesh_reader_exodusii.h"
 #include "mesh.h"
-#include <map>
+#include "api2d.h"
+#include <algorithm>
 
 #ifdef WITH_EXODUSII
 #include <exodusII.h>
@@ -27,6 +28,8 @@ namespace Hermes
 {
   namespace Hermes2D
   {
+    extern unsigned g_mesh_seq;
+
     MeshReaderExodusII::MeshReaderExodusII()
     {
 #ifdef WITH_EXODUSII
@@ -39,24 +42,17 @@ namespace Hermes
     {
     }
 
-    struct Vertex
-    {
-      double x, y;
-    };
-
-    // needed for comparison of vertices inside std::map
-    struct VCompare
+    // Orders the nodes by their coordinates, the equal ones by their numbers.
+    struct VertexLess
     {
-      bool operator()(Vertex a, Vertex b) const
+      VertexLess(const double* x, const double* y) : x(x), y(y) {}
+      bool operator()(int a, int b) const
       {
-        if(a.x < b.x) return true;
-        else if(a.x > b.x) return false;
-        else
-        {
-          if(a.y < b.y) return true;
-          return false;
-        }
+        if(x[a] != x[b]) return x[a] < x[b];
+        if(y[a] != y[b]) return y[a] < y[b];
+        return a < b;
       }
+      const double *x, *y;
     };
 
     bool MeshReaderExodusII::load(const char *file_name, Mesh *mesh)
@@ -77,78 +73,63 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("File '%s' does not contain 2D mesh", file_name);
         return false;
       }
+      if(n_nodes < 1 || n_eblocks < 1)
+        throw Hermes::Exceptions::Exception("File '%s' does not contain any elements", file_name);
+
+      int num_threads_used = Hermes2DApi.get_num_threads();
 
       // load coordinates
-      double *x = new double[n_nodes];
-      double *y = new double[n_nodes];
-      err = ex_get_coord(exoid, x, y, NULL);
-
-      // remove duplicate vertices and build renumbering map
-      std::map<Vertex, int, VCompare> vtx_list;        // map for eliminating duplicities
-      std::map<int, int> vmap;                // reindexing map
-      Hermes::vector<Vertex> vtx_arr;              // vertex array
-      int vid = 0;
+      std::vector<double> x(n_nodes), y(n_nodes);
+      err = ex_get_coord(exoid, &x[0], &y[0], NULL);
+
+      // Remove duplicate vertices: in the sorted order the nodes with the same coordinates follow each other,
+      // the first of them (by the number) gets a vertex, the vertices are numbered in the order of the nodes.
+      std::vector<int> order(n_nodes);
       for (int i = 0; i < n_nodes; i++)
+        order[i] = i;
+      std::sort(order.begin(), order.end(), VertexLess(&x[0], &y[0]));
+      std::vector<int> first(n_nodes);
+      for (int k = 0; k < n_nodes; k++)
       {
-        int k;
-        Vertex v = { x[i], y[i] };
-        if(vtx_list.count(v) == 0)
-        {
-          vtx_arr.push_back(v);
-          k = vid++;
-          vtx_list[v] = k;
-        }
-        else
-          k = vtx_list[v];
-
-        vmap[i + 1] = k;
+        int i = order[k];
+        first[i] = (k > 0 && x[order[k - 1]] == x[i] && y[order[k - 1]] == y[i]) ? first[order[k - 1]] : i;
       }
-      delete [] x;
-      delete [] y;
+      std::vector<int> vmap(n_nodes);                // reindexing map
+      int n_vtx = 0;
+      for (int i = 0; i < n_nodes; i++)
+        vmap[i] = (first[i] == i) ? n_vtx++ : vmap[first[i]];
 
-      int n_vtx = vtx_arr.size();
-      double2 *vtx = new double2[n_vtx];
-      for (int i = 0; i < n_vtx; i++)
-      {
-        vtx[i][0] = vtx_arr[i].x;
-        vtx[i][1] = vtx_arr[i].y;
-      }
+      mesh->free();
 
-      int n_tri = 0;    // number of triangles
-      int n_quad = 0;    // number of quads
+      // create a hash table large enough not to grow while the elements are created
+      int size = HashTable::H2D_DEFAULT_HASH_SIZE;
+      while (size < 8 * n_vtx) size *= 2;
+      mesh->init(size);
 
-      // get info about element blocks
-      int *eid_blocks = new int[n_eblocks];
-      err = ex_get_elem_blk_ids(exoid, eid_blocks);
-      // go over all element blocks
-      for (int i = 0; i < n_eblocks; i++)
+      // create top-level vertex nodes
+      for (int i = 0; i < n_nodes; i++)
       {
-        int id = eid_blocks[i];
-
-        // get block info
-        char elem_type[MAX_STR_LENGTH + 1];
-        int n_elems_in_blk, n_elem_nodes, n_attrs;
-        err = ex_get_elem_block(exoid, id, elem_type, &n_elems_in_blk, &n_elem_nodes, &n_attrs);
-
-        if(n_elem_nodes == 3) n_tri += n_elems_in_blk;
-        else if(n_elem_nodes == 4) n_quad += n_elems_in_blk;
-        else
-        {
-          delete [] vtx;
-          throw Hermes::Exceptions::Exception("Unknown type of element");
-          return false;
-        }
+        if(first[i] != i)
+          continue;
+        Node* node = mesh->nodes.add();
+        assert(node->id == vmap[i]);
+        node->ref = TOP_LEVEL_REF;
+        node->type = HERMES_TYPE_VERTEX;
+        node->bnd = 0;
+        node->p1 = node->p2 = -1;
+        node->x = x[i];
+        node->y = y[i];
       }
-      int3 *tri = n_tri > 0 ? new int3[n_tri] : NULL;    // triangles
-      std::string *tri_markers = n_tri > 0 ? new std::string[n_tri] : NULL;
-      int4 *quad = n_quad > 0 ? new int4[n_quad] : NULL;    // quads
-      std::string *quad_markers = n_quad > 0 ? new std::string[n_quad] : NULL;
-
-      int n_els = n_tri + n_quad;                // total number of elements
-      int **els = n_els > 0 ? new int *[n_els] : NULL;    // elements
-      int *el_nv = n_els > 0 ? new int[n_els] : NULL;    // number of vertices for each element
-
-      int it = 0, iq = 0, iel = 0;
+      mesh->ntopvert = n_vtx;
+
+      // Read the element blocks, one marker per block. The connectivity is renumbered to the vertices in parallel,
+      // the file is read serially (the ExodusII library is not thread-safe).
+      std::vector<int> eid_blocks(n_eblocks);
+      err = ex_get_elem_blk_ids(exoid, &eid_blocks[0]);
+      std::vector<std::vector<int> > connectivity(n_eblocks);
+      std::vector<int> block_nodes(n_eblocks), block_markers(n_eblocks);
+      // The elements of the block i are block_starts[i], ..., block_starts[i + 1] - 1 in the numbering of the file.
+      std::vector<int> block_starts(n_eblocks + 1, 0);
       for (int i = 0; i < n_eblocks; i++)
       {
         int id = eid_blocks[i];
@@ -157,10 +138,10 @@ namespace Hermes
         char elem_type[MAX_STR_LENGTH + 1];
         int n_elems_in_blk, n_elem_nodes, n_attrs;
         err = ex_get_elem_block(exoid, id, elem_type, &n_elems_in_blk, &n_elem_nodes, &n_attrs);
-
-        // read connectivity array
-        int *connect = new int[n_elem_nodes * n_elems_in_blk];
-        err = ex_get_elem_conn(exoid, id, connect);
+        if(n_elem_nodes != 3 && n_elem_nodes != 4)
+          throw Hermes::Exceptions::Exception("Unknown type of element");
+        block_nodes[i] = n_elem_nodes;
+        block_starts[i + 1] = block_starts[i] + n_elems_in_blk;
 
         // Update the mesh' internal array element_markers_conversion.
         std::ostringstream string_stream;
@@ -170,69 +151,64 @@ namespace Hermes
         // This functions check if the user-supplied marker on this element has been
         // already used, and if not, inserts it in the appropriate structure.
         mesh->element_markers_conversion.insert_marker(mesh->element_markers_conversion.min_marker_unused, el_marker);
+        block_markers[i] = mesh->element_markers_conversion.get_internal_marker(el_marker).marker;
+
+        if(n_elems_in_blk == 0)
+          continue;
 
-        int ic = 0;
-        for (int j = 0; j < n_elems_in_blk; j++)
+        // read connectivity array
+        connectivity[i].resize(n_elem_nodes * n_elems_in_blk);
+        int* connect = &connectivity[i][0];
+        err = ex_get_elem_conn(exoid, id, connect);
+
+        int n_connect = n_elem_nodes * n_elems_in_blk, n_invalid = 0;
+#pragma omp parallel for schedule(static) reduction(+:n_invalid) num_threads(num_threads_used)
+        for (int j = 0; j < n_connect; j++)
         {
-          el_nv[iel] = n_elem_nodes;
-          if(n_elem_nodes == 3)
+          if(connect[j] < 1 || connect[j] > n_nodes)
           {
-            tri[it][0] = vmap[connect[ic++]];
-            tri[it][1] = vmap[connect[ic++]];
-            tri[it][2] = vmap[connect[ic++]];
-            tri_markers[it] = el_marker;
-            els[iel] = tri[it];
-            it++;
+            n_invalid++;
+            continue;
           }
-          else if(n_elem_nodes == 4)
-          {
-            quad[iq][0] = vmap[connect[ic++]];
-            quad[iq][1] = vmap[connect[ic++]];
-            quad[iq][2] = vmap[connect[ic++]];
-            quad[iq][3] = vmap[connect[ic++]];
-            quad_markers[iq] = el_marker;
-            els[iel] = quad[iq];
-            iq++;
-          }
-          else
+          connect[j] = vmap[connect[j] - 1];
+        }
+        if(n_invalid > 0)
+          throw Hermes::Exceptions::Exception("File '%s': element block %d refers to nonexistent nodes", file_name, id);
+      }
+
+      // Create the elements directly, the triangles first.
+      for (int pass = 3; pass <= 4; pass++)
+        for (int i = 0; i < n_eblocks; i++)
+        {
+          if(block_nodes[i] != pass)
+            continue;
+          const int* connect = connectivity[i].empty() ? NULL : &connectivity[i][0];
+          for (int j = 0; j < block_starts[i + 1] - block_starts[i]; j++, connect += pass)
           {
-            delete [] vtx;
-            throw Hermes::Exceptions::Exception("Unknown type of element");
-            return false;
+            if(pass == 3)
+              mesh->create_triangle(block_markers[i], &mesh->nodes[connect[0]], &mesh->nodes[connect[1]], &mesh->nodes[connect[2]], NULL);
+            else
+              mesh->create_quad(block_markers[i], &mesh->nodes[connect[0]], &mesh->nodes[connect[1]], &mesh->nodes[connect[2]], &mesh->nodes[connect[3]], NULL);
           }
-          iel++;
         }
-        delete [] connect;
-      }
-      delete [] eid_blocks;
+      int n_els = block_starts[n_eblocks];
 
       // query number of side sets
-      int *sid_blocks = new int[n_sidesets];
-      err = ex_get_side_set_ids(exoid, sid_blocks);
+      std::vector<int> sid_blocks(n_sidesets);
+      if(n_sidesets > 0)
+        err = ex_get_side_set_ids(exoid, &sid_blocks[0]);
 
       // go over the sidesets
-      int n_mark = 0;    // number of markers
-      for (int i = 0; i < n_sidesets; i++)
-      {
-        int sid = sid_blocks[i];
-        int n_sides_in_set, n_df_in_set;
-        err = ex_get_side_set_param(exoid, sid, &n_sides_in_set, &n_df_in_set);
-        n_mark += n_sides_in_set;
-      }
-      int2 *marks = new int2[n_mark];
-      std::string *bnd_markers = new std::string[n_mark];
-
-      int im = 0;
       for (int i = 0; i < n_sidesets; i++)
       {
         int sid = sid_blocks[i];
         int n_sides_in_set, n_df_in_set;
         err = ex_get_side_set_param(exoid, sid, &n_sides_in_set, &n_df_in_set);
-        int num_elem_in_set = n_sides_in_set;
+        if(n_sides_in_set == 0)
+          continue;
 
-        int *elem_list = new int[num_elem_in_set];
-        int *side_list = new int[n_sides_in_set];
-        err = ex_get_side_set(exoid, sid, elem_list, side_list);
+        std::vector<int> elem_list(n_sides_in_set), side_list(n_sides_in_set);
+        err = ex_get_side_set(exoid, sid, &elem_list[0], &side_list[0]);
 
         // Update the mesh' internal array boundary_markers_conversion.
         std::ostringstream string_stream;
@@ -242,37 +218,38 @@ namespace Hermes
         // This functions check if the user-supplied marker on this element has been
         // already used, and if not, inserts it in the appropriate structure.
         mesh->boundary_markers_conversion.insert_marker(mesh->boundary_markers_conversion.min_marker_unused, bnd_marker);
+        int marker = mesh->boundary_markers_conversion.get_internal_marker(bnd_marker).marker;
 
-        for (int j = 0; j < num_elem_in_set; j++)
+        for (int j = 0; j < n_sides_in_set; j++)
         {
-          int nv = el_nv[side_list[j] - 1];      // # of vertices of the element
+          int el = elem_list[j] - 1;
+          if(el < 0 || el >= n_els)
+            throw Hermes::Exceptions::Exception("Boundary data error (element does not exist)");
+          int block = (int)(std::upper_bound(block_starts.begin(), block_starts.end(), el) - block_starts.begin()) - 1;
+          int nv = block_nodes[block];      // # of vertices of the element
+          const int* element_vertices = &connectivity[block][nv * (el - block_starts[block])];
           int vt = side_list[j] - 1;
-          marks[im][0] = els[elem_list[j] - 1][vt];
-          marks[im][1] = els[elem_list[j] - 1][(vt + 1) % nv];
-          bnd_markers[im] = bnd_marker;
-          im++;
+          if(vt < 0 || vt >= nv)
+            throw Hermes::Exceptions::Exception("Boundary data error (side does not exist)");
+
+          int v1 = element_vertices[vt], v2 = element_vertices[(vt + 1) % nv];
+          Node* en = mesh->peek_edge_node(v1, v2);
+          if(en == NULL)
+            throw Hermes::Exceptions::Exception("Boundary data error (edge does not exist)");
+
+          en->marker = marker;
+          mesh->nodes[v1].bnd = 1;
+          mesh->nodes[v2].bnd = 1;
+          en->bnd = 1;
         }
-
-        delete [] elem_list;
-        delete [] side_list;
       }
-      delete [] sid_blocks;
 
       // we are done
       err = ex_close(exoid);
 
-      mesh->create(n_vtx, vtx, n_tri, tri, tri_markers, n_quad, quad, quad_markers, n_mark, marks, bnd_markers);
-
-      // clean-up
-      delete [] marks;
-      delete [] tri;
-      delete [] quad;
-      delete [] tri_markers;
-      delete [] quad_markers;
-      delete [] bnd_markers;
-      delete [] vtx;
-      delete [] el_nv;
-      delete [] els;
+      mesh->nbase = mesh->nactive = mesh->ninitial = n_els;
+      mesh->seq = g_mesh_seq++;
+      mesh->update_memory_usage();
 
       return true;
 #else
@@ -191,7 +191,6 @@ namespace Hermes
         node->type = HERMES_TYPE_VERTEX;
         node->bnd = 0;
         node->p1 = node->p2 = -1;
-        node->next_hash = NULL;
         node->x = m.x_vertex[i];
         node->y = m.y_vertex[i];
       }
@@ -384,6 +383,7 @@ namespace Hermes
 
       mesh->seq = g_mesh_seq++;
       mesh->initial_single_check();
+      mesh->update_memory_usage();
       return true;
     }
 
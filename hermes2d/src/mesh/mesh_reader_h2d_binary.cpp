@@ -0,0 +1,522 @@
+// This file is part of Hermes2D
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, see <http://www.gnu.prg/licenses/>.
+
+#include <string.h>
+#include "mesh.h"
+#include <map>
+#include "mesh_reader_h2d_binary.h"
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    extern unsigned g_mesh_seq;
+
+    // The last character is the version of the format.
+    static const char binary_mesh_magic[8] = { 'H', '2', 'D', 'M', 'E', 'S', 'H', 1 };
+
+    static size_t aligned(size_t bytes)
+    {
+      return (bytes + 7) & ~((size_t) 7);
+    }
+
+    MeshReaderH2DBinary::MeshReaderH2DBinary()
+    {
+    }
+
+    MeshReaderH2DBinary::~MeshReaderH2DBinary()
+    {
+    }
+
+    Nurbs* MeshReaderH2DBinary::load_nurbs(Mesh *mesh, const int* curve, const double* values, Node** en)
+    {
+      int p1 = curve[0], p2 = curve[1];
+      if(p1 < 0 || p1 >= mesh->ntopvert || p2 < 0 || p2 >= mesh->ntopvert || (*en = mesh->peek_edge_node(p1, p2)) == NULL)
+        throw Hermes::Exceptions::MeshLoadFailureException("Curve %d-%d: the edge does not exist.", p1, p2);
+
+      Nurbs* nurbs = new Nurbs;
+      nurbs->arc = (curve[2] == 0);
+      nurbs->degree = nurbs->arc ? 2 : curve[2];
+      int inner = nurbs->arc ? 1 : curve[3];
+      nurbs->np = inner + 2;
+
+      // edge endpoints are also control points, with weight 1.0
+      nurbs->pt = new double3[nurbs->np];
+      nurbs->pt[0][0] = mesh->nodes[p1].x;
+      nurbs->pt[0][1] = mesh->nodes[p1].y;
+      nurbs->pt[0][2] = 1.0;
+      nurbs->pt[inner + 1][0] = mesh->nodes[p2].x;
+      nurbs->pt[inner + 1][1] = mesh->nodes[p2].y;
+      nurbs->pt[inner + 1][2] = 1.0;
+
+      int inner_knots = 0;
+      if(nurbs->arc)
+      {
+        // the arc angle, one generated control point
+        nurbs->angle = values[0];
+        double a = (180.0 - nurbs->angle) / 180.0 * M_PI;
+        double x = 1.0 / tan(a * 0.5);
+        nurbs->pt[1][0] = 0.5*((nurbs->pt[2][0] + nurbs->pt[0][0]) + (nurbs->pt[2][1] - nurbs->pt[0][1]) * x);
+        nurbs->pt[1][1] = 0.5*((nurbs->pt[2][1] + nurbs->pt[0][1]) - (nurbs->pt[2][0] - nurbs->pt[0][0]) * x);
+        nurbs->pt[1][2] = cos((M_PI - a) * 0.5);
+      }
+      else
+      {
+        memcpy(nurbs->pt + 1, values, inner * sizeof(double3));
+        inner_knots = curve[4];
+      }
+
+      // knot vector is completed by 0.0 on the left and by 1.0 on the right
+      nurbs->nk = nurbs->degree + nurbs->np + 1;
+      int outer = nurbs->nk - inner_knots;
+      if((outer & 1) == 1 || outer < 0)
+      {
+        delete [] nurbs->pt;
+        delete nurbs;
+        throw Hermes::Exceptions::MeshLoadFailureException("Curve %d-%d: incorrect number of knot points.", p1, p2);
+      }
+      nurbs->kv = new double[nurbs->nk];
+      for (int i = 0; i < outer/2; i++)
+        nurbs->kv[i] = 0.0;
+      for (int i = 0; i < inner_knots; i++)
+        nurbs->kv[outer/2 + i] = values[3 * inner + i];
+      for (int i = outer/2 + inner_knots; i < nurbs->nk; i++)
+        nurbs->kv[i] = 1.0;
+
+      nurbs->ref = 0;
+      return nurbs;
+    }
+
+    bool MeshReaderH2DBinary::load(const char *filename, Mesh *mesh)
+    {
+      // Map (read on Windows) the file.
+      char* data;
+      size_t length;
+#ifdef WIN32
+      FILE* file = fopen(filename, "rb");
+      if(file == NULL)
+        throw Hermes::Exceptions::MeshLoadFailureException("Mesh file not found.");
+      fseek(file, 0, SEEK_END);
+      length = ftell(file);
+      fseek(file, 0, SEEK_SET);
+      data = new char[length];
+      size_t read = fread(data, 1, length, file);
+      fclose(file);
+      if(read != length)
+      {
+        delete [] data;
+        throw Hermes::Exceptions::MeshLoadFailureException("Error reading the file %s.", filename);
+      }
+#else
+      int fd = open(filename, O_RDONLY);
+      if(fd < 0)
+        throw Hermes::Exceptions::MeshLoadFailureException("Mesh file not found.");
+      struct stat file_stat;
+      if(fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+      {
+        close(fd);
+        throw Hermes::Exceptions::MeshLoadFailureException("Unable to read the file %s.", filename);
+      }
+      length = file_stat.st_size;
+      void* mapped = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if(mapped == MAP_FAILED)
+        throw Hermes::Exceptions::MeshLoadFailureException("Unable to map the file %s: %s.", filename, strerror(errno));
+      data = (char*)mapped;
+#endif
+
+      try
+      {
+        Header header;
+        if(length < sizeof(Header) || memcmp(data, binary_mesh_magic, 7) != 0)
+          throw Hermes::Exceptions::MeshLoadFailureException("File %s: not a binary Hermes2D mesh.", filename);
+        memcpy(&header, data, sizeof(Header));
+        if(header.magic[7] != binary_mesh_magic[7])
+          throw Hermes::Exceptions::MeshLoadFailureException("File %s: unsupported version of the binary mesh format.", filename);
+        if(header.num_vertices < 2 || header.num_elements < 1 || header.num_boundaries < 0 || header.num_curves < 0 || header.num_curve_values < 0
+          || header.num_refinements < 0 || header.num_element_markers < 0 || header.num_boundary_markers < 0 || header.num_marker_chars < 0)
+          throw Hermes::Exceptions::MeshLoadFailureException("File %s: invalid sizes in the header.", filename);
+
+        // The arrays.
+        size_t position = aligned(sizeof(Header));
+        const double* vertices = (const double*) (data + position);
+        position += aligned(2 * header.num_vertices * sizeof(double));
+        const int* elements = (const int*) (data + position);
+        position += aligned(5 * header.num_elements * sizeof(int));
+        const int* boundaries = (const int*) (data + position);
+        position += aligned(3 * header.num_boundaries * sizeof(int));
+        const int* curves = (const int*) (data + position);
+        position += aligned(5 * header.num_curves * sizeof(int));
+        const double* curve_values = (const double*) (data + position);
+        position += aligned(header.num_curve_values * sizeof(double));
+        const int* refinements = (const int*) (data + position);
+        position += aligned(2 * header.num_refinements * sizeof(int));
+        const int* marker_offsets = (const int*) (data + position);
+        int num_markers = header.num_element_markers + header.num_boundary_markers;
+        position += aligned((num_markers + 1) * sizeof(int));
+        const char* marker_chars = data + position;
+        position += header.num_marker_chars;
+        if(position > length)
+          throw Hermes::Exceptions::MeshLoadFailureException("File %s: the file is truncated.", filename);
+
+        mesh->free();
+
+        //// markers /////////////////////////////////////////////////////////////////
+        std::vector<int> markers(num_markers);
+        for (int i = 0; i < num_markers; i++)
+        {
+          if(marker_offsets[i] < 0 || marker_offsets[i] > marker_offsets[i + 1] || marker_offsets[i + 1] > header.num_marker_chars)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: invalid marker #%d.", filename, i);
+          std::string marker(marker_chars + marker_offsets[i], marker_chars + marker_offsets[i + 1]);
+          Mesh::MarkersConversion* conversion = (i < header.num_element_markers) ? (Mesh::MarkersConversion*) &mesh->element_markers_conversion : (Mesh::MarkersConversion*) &mesh->boundary_markers_conversion;
+          conversion->insert_marker(conversion->min_marker_unused, marker);
+          markers[i] = conversion->get_internal_marker(marker).marker;
+        }
+
+        //// vertices ////////////////////////////////////////////////////////////////
+
+        // create a hash table large enough
+        int size = HashTable::H2D_DEFAULT_HASH_SIZE;
+        while (size < 8 * header.num_vertices) size *= 2;
+        mesh->init(size);
+
+        // create top-level vertex nodes
+        for (int i = 0; i < header.num_vertices; i++)
+        {
+          Node* node = mesh->nodes.add();
+          assert(node->id == i);
+          node->ref = TOP_LEVEL_REF;
+          node->type = HERMES_TYPE_VERTEX;
+          node->bnd = 0;
+          node->p1 = node->p2 = -1;
+          node->x = vertices[2 * i];
+          node->y = vertices[2 * i + 1];
+        }
+        mesh->ntopvert = header.num_vertices;
+
+        //// elements ////////////////////////////////////////////////////////////////
+        mesh->nactive = 0;
+        for (int i = 0; i < header.num_elements; i++)
+        {
+          const int* element = elements + 5 * i;
+          if(element[0] == -1)
+          {
+            mesh->elements.skip_slot();
+            continue;
+          }
+          int nv = (element[3] == -1) ? 3 : 4;
+          for (int j = 0; j < nv; j++)
+            if(element[j] < 0 || element[j] >= mesh->ntopvert)
+              throw Hermes::Exceptions::MeshLoadFailureException("File %s: error creating element #%d: vertex #%d does not exist.", filename, i, element[j]);
+          if(element[4] < 0 || element[4] >= header.num_element_markers)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: element #%d: invalid marker.", filename, i);
+
+          Node *v0 = &mesh->nodes[element[0]], *v1 = &mesh->nodes[element[1]], *v2 = &mesh->nodes[element[2]];
+          if(nv == 3)
+          {
+            Mesh::check_triangle(i, v0, v1, v2);
+            mesh->create_triangle(markers[element[4]], v0, v1, v2, NULL);
+          }
+          else
+          {
+            Node *v3 = &mesh->nodes[element[3]];
+            Mesh::check_quad(i, v0, v1, v2, v3);
+            mesh->create_quad(markers[element[4]], v0, v1, v2, v3, NULL);
+          }
+          mesh->nactive++;
+        }
+        mesh->nbase = header.num_elements;
+
+        //// boundaries //////////////////////////////////////////////////////////////
+        for (int i = 0; i < header.num_boundaries; i++)
+        {
+          const int* boundary = boundaries + 3 * i;
+          int v1 = boundary[0], v2 = boundary[1];
+          Node* en = NULL;
+          if(v1 < 0 || v1 >= mesh->ntopvert || v2 < 0 || v2 >= mesh->ntopvert || (en = mesh->peek_edge_node(v1, v2)) == NULL)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: boundary data #%d: edge %d-%d does not exist", filename, i, v1, v2);
+          if(boundary[2] < 0 || boundary[2] >= header.num_boundary_markers)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: boundary data #%d: invalid marker.", filename, i);
+
+          int marker = markers[header.num_element_markers + boundary[2]];
+          en->marker = marker;
+
+          // This is extremely important, as in DG, it is assumed that negative boundary markers are reserved
+          // for the inner edges.
+          if(marker > 0)
+          {
+            mesh->nodes[v1].bnd = 1;
+            mesh->nodes[v2].bnd = 1;
+            en->bnd = 1;
+          }
+        }
+
+        //// curves //////////////////////////////////////////////////////////////////
+        int value_position = 0;
+        for (int i = 0; i < header.num_curves; i++)
+        {
+          const int* curve = curves + 5 * i;
+          int num_values = (curve[2] == 0) ? 1 : 3 * curve[3] + curve[4];
+          if(curve[2] < 0 || curve[3] < 0 || curve[4] < 0 || value_position + num_values > header.num_curve_values)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: curve #%d: invalid data.", filename, i);
+
+          Node* en;
+          Nurbs* nurbs = load_nurbs(mesh, curve, curve_values + value_position, &en);
+          value_position += num_values;
+
+          // assign the nurbs to the elements sharing the edge node
+          for (int k = 0; k < 2; k++)
+          {
+            Element* e = en->elem[k];
+            if(e == NULL) continue;
+
+            if(e->cm == NULL)
+            {
+              e->cm = new CurvMap;
+              memset(e->cm, 0, sizeof(CurvMap));
+              e->cm->toplevel = 1;
+              e->cm->order = 4;
+            }
+
+            int idx = -1;
+            for (int j = 0; j < e->get_nvert(); j++)
+              if(e->en[j] == en) { idx = j; break; }
+            assert(idx >= 0);
+
+            if(e->vn[idx]->id == curve[0])
+            {
+              e->cm->nurbs[idx] = nurbs;
+              nurbs->ref++;
+            }
+            else
+            {
+              Nurbs* nurbs_rev = mesh->reverse_nurbs(nurbs);
+              e->cm->nurbs[idx] = nurbs_rev;
+              nurbs_rev->ref++;
+            }
+          }
+          if(!nurbs->ref) delete nurbs;
+        }
+
+        // update refmap coeffs of curvilinear elements
+        Element* e;
+        for_all_elements(e, mesh)
+          if(e->cm != NULL)
+            e->cm->update_refmap_coeffs(e);
+
+        //// refinements /////////////////////////////////////////////////////////////
+        mesh->begin_batch_refinement();
+        for (int i = 0; i < header.num_refinements; i++)
+        {
+          int id = refinements[2 * i], ref = refinements[2 * i + 1];
+          if(id < 0 || id >= mesh->get_max_element_id() || !mesh->get_element_fast(id)->used || !mesh->get_element_fast(id)->active)
+            throw Hermes::Exceptions::MeshLoadFailureException("File %s: refinement #%d: invalid element #%d.", filename, i, id);
+          mesh->refine_element_id(id, ref);
+        }
+        mesh->finish_batch_refinement();
+        mesh->ninitial = mesh->elements.get_num_items();
+      }
+      catch(...)
+      {
+#ifdef WIN32
+        delete [] data;
+#else
+        munmap(data, length);
+#endif
+        throw;
+      }
+
+#ifdef WIN32
+      delete [] data;
+#else
+      munmap(data, length);
+#endif
+
+      mesh->seq = g_mesh_seq++;
+      mesh->initial_single_check();
+      mesh->update_memory_usage();
+      return true;
+    }
+
+    void MeshReaderH2DBinary::save_refinements(Element* e, int id, int& next_id, std::vector<int>& refinements)
+    {
+      // The sons get their ids in the order of the refinements when loading, see MeshReaderH2D::save_refinements().
+      if(e->active) return;
+      if(e->bsplit())
+      {
+        refinements.push_back(id);
+        refinements.push_back(0);
+        int sid = next_id; next_id += 4;
+        for (int i = 0; i < 4; i++)
+          save_refinements(e->sons[i], sid + i, next_id, refinements);
+      }
+      else if(e->hsplit())
+      {
+        refinements.push_back(id);
+        refinements.push_back(1);
+        int sid = next_id; next_id += 2;
+        save_refinements(e->sons[0], sid, next_id, refinements);
+        save_refinements(e->sons[1], sid + 1, next_id, refinements);
+      }
+      else
+      {
+        refinements.push_back(id);
+        refinements.push_back(2);
+        int sid = next_id; next_id += 2;
+        save_refinements(e->sons[2], sid, next_id, refinements);
+        save_refinements(e->sons[3], sid + 1, next_id, refinements);
+      }
+    }
+
+    bool MeshReaderH2DBinary::save(const char *filename, Mesh *mesh)
+    {
+      Element* e;
+
+      // markers
+      std::vector<std::string> marker_strings;
+      std::map<int, int> element_marker_indices, boundary_marker_indices;
+      for_all_base_elements(e, mesh)
+        if(element_marker_indices.find(e->marker) == element_marker_indices.end())
+        {
+          element_marker_indices.insert(std::make_pair(e->marker, (int) marker_strings.size()));
+          marker_strings.push_back(mesh->get_element_markers_conversion().get_user_marker(e->marker).marker);
+        }
+      int num_element_markers = marker_strings.size();
+
+      // elements
+      std::vector<int> elements(5 * mesh->get_num_base_elements(), -1);
+      for (int i = 0; i < mesh->get_num_base_elements(); i++)
+      {
+        e = mesh->get_element_fast(i);
+        if(!e->used)
+          continue;
+        for (int j = 0; j < e->get_nvert(); j++)
+          elements[5 * i + j] = e->vn[j]->id;
+        elements[5 * i + 4] = element_marker_indices[e->marker];
+      }
+
+      // boundaries
+      std::vector<int> boundaries;
+      for_all_base_elements(e, mesh)
+        for (int i = 0; i < e->get_nvert(); i++)
+        {
+          int mrk = mesh->get_base_edge_node(e, i)->marker;
+          if(mrk)
+          {
+            if(boundary_marker_indices.find(mrk) == boundary_marker_indices.end())
+            {
+              boundary_marker_indices.insert(std::make_pair(mrk, (int) marker_strings.size() - num_element_markers));
+              marker_strings.push_back(mesh->boundary_markers_conversion.get_user_marker(mrk).marker);
+            }
+            boundaries.push_back(e->vn[i]->id);
+            boundaries.push_back(e->vn[e->next_vert(i)]->id);
+            boundaries.push_back(boundary_marker_indices[mrk]);
+          }
+        }
+
+      // curves
+      std::vector<int> curves;
+      std::vector<double> curve_values;
+      for_all_base_elements(e, mesh)
+        if(e->is_curved())
+          for (int i = 0; i < e->get_nvert(); i++)
+            if(e->cm->nurbs[i] != NULL && !is_twin_nurbs(e, i))
+            {
+              Nurbs* nurbs = e->cm->nurbs[i];
+              int inner = nurbs->np - 2, inner_knots = nurbs->nk - 2 * (nurbs->degree + 1);
+              curves.push_back(e->vn[i]->id);
+              curves.push_back(e->vn[e->next_vert(i)]->id);
+              curves.push_back(nurbs->arc ? 0 : nurbs->degree);
+              curves.push_back(nurbs->arc ? 0 : inner);
+              curves.push_back(nurbs->arc ? 0 : inner_knots);
+              if(nurbs->arc)
+                curve_values.push_back(nurbs->angle);
+              else
+              {
+                for (int j = 1; j <= inner; j++)
+                  curve_values.insert(curve_values.end(), nurbs->pt[j], nurbs->pt[j] + 3);
+                curve_values.insert(curve_values.end(), nurbs->kv + nurbs->degree + 1, nurbs->kv + nurbs->degree + 1 + inner_knots);
+              }
+            }
+
+      // refinements
+      std::vector<int> refinements;
+      int next_id = mesh->nbase;
+      for_all_base_elements(e, mesh)
+        save_refinements(e, e->id, next_id, refinements);
+
+      std::vector<int> marker_offsets(1, 0);
+      std::string marker_chars;
+      for (unsigned int i = 0; i < marker_strings.size(); i++)
+      {
+        marker_chars += marker_strings[i];
+        marker_offsets.push_back(marker_chars.size());
+      }
+
+      Header header;
+      memset(&header, 0, sizeof(Header));
+      memcpy(header.magic, binary_mesh_magic, 8);
+      header.num_vertices = mesh->ntopvert;
+      header.num_elements = mesh->get_num_base_elements();
+      header.num_boundaries = boundaries.size() / 3;
+      header.num_curves = curves.size() / 5;
+      header.num_curve_values = curve_values.size();
+      header.num_refinements = refinements.size() / 2;
+      header.num_element_markers = num_element_markers;
+      header.num_boundary_markers = marker_strings.size() - num_element_markers;
+      header.num_marker_chars = marker_chars.size();
+
+      std::vector<double> vertices(2 * mesh->ntopvert);
+      for (int i = 0; i < mesh->ntopvert; i++)
+      {
+        vertices[2 * i] = mesh->nodes[i].x;
+        vertices[2 * i + 1] = mesh->nodes[i].y;
+      }
+
+      FILE* f = fopen(filename, "wb");
+      if(f == NULL)
+        throw Hermes::Exceptions::MeshLoadFailureException("Could not create mesh file.");
+
+      const void* arrays[9] = { &header, vertices.empty() ? NULL : &vertices[0], elements.empty() ? NULL : &elements[0],
+        boundaries.empty() ? NULL : &boundaries[0], curves.empty() ? NULL : &curves[0], curve_values.empty() ? NULL : &curve_values[0],
+        refinements.empty() ? NULL : &refinements[0], &marker_offsets[0], marker_chars.data() };
+      size_t bytes[9] = { sizeof(Header), vertices.size() * sizeof(double), elements.size() * sizeof(int),
+        boundaries.size() * sizeof(int), curves.size() * sizeof(int), curve_values.size() * sizeof(double),
+        refinements.size() * sizeof(int), marker_offsets.size() * sizeof(int), marker_chars.size() };
+      static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      bool ok = true;
+      for (int i = 0; i < 9; i++)
+      {
+        if(bytes[i] > 0)
+          ok = ok && fwrite(arrays[i], 1, bytes[i], f) == bytes[i];
+        // The last array is not padded.
+        if(i < 8)
+          ok = ok && fwrite(zeros, 1, aligned(bytes[i]) - bytes[i], f) == aligned(bytes[i]) - bytes[i];
+      }
+      fclose(f);
+      if(!ok)
+        throw Hermes::Exceptions::MeshLoadFailureException("Error writing the mesh file %s.", filename);
+
+      return true;
+    }
+  }
+}
@@ -16,6 +16,7 @@
 #include "mesh.h"
 #include "api2d.h"
 #include "mesh_reader_h2d_xml.h"
+#include "xml_stream_reader.h"
 #include <iostream>
 
 using namespace std;
@@ -36,6 +37,22 @@ namespace Hermes
     {
       mesh->free();
 
+      if(!this->validate && Hermes2DApi.get_xml_streaming())
+      {
+        try
+        {
+          return load_stream(filename, mesh);
+        }
+        catch (Hermes::Exceptions::MeshLoadFailureException&)
+        {
+          throw;
+        }
+        catch (const Hermes::Exceptions::Exception& e)
+        {
+          throw Hermes::Exceptions::MeshLoadFailureException(e.what());
+        }
+      }
+
       std::map<unsigned int, unsigned int> vertex_is;
 
       try
@@ -64,6 +81,7 @@ namespace Hermes
           }
         }
         mesh->initial_single_check();
+        mesh->update_memory_usage();
       }
       catch (const xml_schema::exception& e)
       {
@@ -72,6 +90,350 @@ namespace Hermes
       return true;
     }
 
+    static std::string trim_marker(const std::string& marker)
+    {
+      size_t begin = marker.find_first_not_of(" \t\n");
+      if(begin == std::string::npos)
+        return std::string();
+      return marker.substr(begin, marker.find_last_not_of(" \t\n") - begin + 1);
+    }
+
+    // The stage (the group of elements in the file) an element belongs to, -1 for the groups themselves.
+    static int stream_stage(const std::string& name)
+    {
+      if(name == "var" || name == "v")
+        return 0;
+      if(name == "t" || name == "q")
+        return 1;
+      if(name == "ed")
+        return 2;
+      if(name == "arc" || name == "NURBS" || name == "inner_point" || name == "knot")
+        return 3;
+      if(name == "ref")
+        return 4;
+      return -1;
+    }
+
+    void MeshReaderH2DXML::assign_curve(Mesh *mesh, Nurbs* nurbs, Node* en, int p1)
+    {
+      for (unsigned int node_i = 0; node_i < 2; node_i++)
+      {
+        Element* e = en->elem[node_i];
+        if(e == NULL) continue;
+
+        if(e->cm == NULL)
+        {
+          e->cm = new CurvMap;
+          memset(e->cm, 0, sizeof(CurvMap));
+          e->cm->toplevel = 1;
+          e->cm->order = 4;
+        }
+
+        int idx = -1;
+        for (unsigned j = 0; j < e->get_nvert(); j++)
+          if(e->en[j] == en) { idx = j; break; }
+        assert(idx >= 0);
+
+        if(e->vn[idx]->id == p1)
+        {
+          e->cm->nurbs[idx] = nurbs;
+          nurbs->ref++;
+        }
+        else
+        {
+          Nurbs* nurbs_rev = mesh->reverse_nurbs(nurbs);
+          e->cm->nurbs[idx] = nurbs_rev;
+          nurbs_rev->ref++;
+        }
+      }
+      if(!nurbs->ref) delete nurbs;
+    }
+
+    bool MeshReaderH2DXML::load_stream(const char *filename, Mesh *mesh)
+    {
+      XMLStreamReader reader(filename);
+
+      std::map<std::string, double> variables;
+      std::map<unsigned int, unsigned int> vertex_is;
+      std::vector<double> vertices;
+      unsigned int element_count = 0, edge_count = 0, curve_count = 0;
+
+      // The stages already finished.
+      bool vertices_created = false, elements_finished = false, edges_finished = false, curves_finished = false;
+
+      // The NURBS curve being read, its inner points and knots follow it.
+      bool nurbs_pending = false;
+      int nurbs_p1 = 0, nurbs_p2 = 0, nurbs_degree = 0;
+      std::vector<double> nurbs_points, nurbs_knots;
+
+      bool more = true;
+      while (more)
+      {
+        more = reader.next();
+        int stage = more ? stream_stage(reader.name()) : 5;
+
+        // The pending NURBS is complete.
+        if(nurbs_pending && (!more || (reader.name() != "inner_point" && reader.name() != "knot")))
+        {
+          nurbs_pending = false;
+          Node* en = mesh->peek_edge_node(nurbs_p1, nurbs_p2);
+          if(en == NULL)
+            throw Hermes::Exceptions::MeshLoadFailureException("Curve #%d: edge %d-%d does not exist.", curve_count, nurbs_p1, nurbs_p2);
+
+          Nurbs* nurbs = new Nurbs;
+          nurbs->arc = false;
+          nurbs->degree = nurbs_degree;
+          int inner = nurbs_points.size() / 3;
+          nurbs->np = inner + 2;
+
+          // edge endpoints are also control points, with weight 1.0
+          nurbs->pt = new double3[nurbs->np];
+          nurbs->pt[0][0] = mesh->nodes[nurbs_p1].x;
+          nurbs->pt[0][1] = mesh->nodes[nurbs_p1].y;
+          nurbs->pt[0][2] = 1.0;
+          nurbs->pt[inner + 1][0] = mesh->nodes[nurbs_p2].x;
+          nurbs->pt[inner + 1][1] = mesh->nodes[nurbs_p2].y;
+          nurbs->pt[inner + 1][2] = 1.0;
+          for (int i = 0; i < inner; i++)
+            for (int j = 0; j < 3; j++)
+              nurbs->pt[i + 1][j] = nurbs_points[3 * i + j];
+
+          // knot vector is completed by 0.0 on the left and by 1.0 on the right
+          inner = nurbs_knots.size();
+          nurbs->nk = nurbs->degree + nurbs->np + 1;
+          int outer = nurbs->nk - inner;
+          if((outer & 1) == 1)
+          {
+            delete [] nurbs->pt;
+            delete nurbs;
+            throw Hermes::Exceptions::MeshLoadFailureException("Curve #%d: incorrect number of knot points.", curve_count);
+          }
+          nurbs->kv = new double[nurbs->nk];
+          for (int i = 0; i < outer/2; i++)
+            nurbs->kv[i] = 0.0;
+          for (int i = 0; i < inner; i++)
+            nurbs->kv[outer/2 + i] = nurbs_knots[i];
+          for (int i = outer/2 + inner; i < nurbs->nk; i++)
+            nurbs->kv[i] = 1.0;
+          nurbs->ref = 0;
+
+          assign_curve(mesh, nurbs, en, nurbs_p1);
+          curve_count++;
+        }
+
+        // Vertices are complete, create the top-level vertex nodes.
+        if(!vertices_created && stage >= 1)
+        {
+          vertices_created = true;
+          int vertices_count = vertices.size() / 2;
+
+          // Initialize mesh.
+          int size = HashTable::H2D_DEFAULT_HASH_SIZE;
+          while (size < 8 * vertices_count)
+            size *= 2;
+          mesh->init(size);
+
+          for (int vertex_i = 0; vertex_i < vertices_count; vertex_i++)
+          {
+            Node* node = mesh->nodes.add();
+            assert(node->id == vertex_i);
+            node->ref = TOP_LEVEL_REF;
+            node->type = HERMES_TYPE_VERTEX;
+            node->bnd = 0;
+            node->p1 = node->p2 = -1;
+            node->x = vertices[2 * vertex_i];
+            node->y = vertices[2 * vertex_i + 1];
+          }
+          mesh->ntopvert = vertices_count;
+        }
+
+        if(!elements_finished && stage >= 2)
+        {
+          elements_finished = true;
+          mesh->nbase = mesh->nactive = mesh->ninitial = element_count;
+        }
+
+        // check that all boundary edges have a marker assigned
+        if(!edges_finished && stage >= 3)
+        {
+          edges_finished = true;
+          Node* en;
+          for_all_edge_nodes(en, mesh)
+            if(en->ref < 2 && en->marker == 0)
+              this->warn("Boundary edge node does not have a boundary marker.");
+        }
+
+        // update refmap coeffs of curvilinear elements
+        if(!curves_finished && stage >= 4)
+        {
+          curves_finished = true;
+          Element* e;
+          for_all_elements(e, mesh)
+            if(e->cm != NULL)
+              e->cm->update_refmap_coeffs(e);
+        }
+
+        if(!more)
+          break;
+
+        const std::string& name = reader.name();
+        if(name == "var")
+          variables[reader.attribute("name")] = reader.double_attribute("value");
+        else if(name == "v")
+        {
+          if(vertices_created)
+            throw Hermes::Exceptions::MeshLoadFailureException("A vertex after the elements.");
+          int vertex_i = vertices.size() / 2;
+          const char* coordinates[2] = { "x", "y" };
+          for (int k = 0; k < 2; k++)
+          {
+            const std::string& value = reader.attribute(coordinates[k]);
+            std::map<std::string, double>::const_iterator it = variables.find(value);
+            if(it != variables.end())
+              vertices.push_back(it->second);
+            else
+            {
+              char* end;
+              double number = std::strtod(value.c_str(), &end);
+              while (*end == ' ' || *end == '\t' || *end == '\n' || *end == '\r') end++;
+              if(end == value.c_str() || *end != '\0')
+                throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the %s coordinate of vertex no. %i.", coordinates[k], vertex_i + 1);
+              vertices.push_back(number);
+            }
+          }
+          vertex_is.insert(std::pair<unsigned int, unsigned int>(reader.int_attribute("i"), vertex_i));
+        }
+        else if(name == "t" || name == "q")
+        {
+          int nv = (name == "t") ? 3 : 4;
+          const char* vertex_names[4] = { "v1", "v2", "v3", "v4" };
+          Node* v[4];
+          for (int k = 0; k < nv; k++)
+          {
+            std::map<unsigned int, unsigned int>::const_iterator it = vertex_is.find(reader.int_attribute(vertex_names[k]));
+            if(it == vertex_is.end())
+              throw Hermes::Exceptions::MeshLoadFailureException("Element #%d: vertex %s does not exist.", element_count, reader.attribute(vertex_names[k]).c_str());
+            v[k] = &mesh->nodes[it->second];
+          }
+
+          std::string marker = trim_marker(reader.attribute("m"));
+          mesh->element_markers_conversion.insert_marker(mesh->element_markers_conversion.min_marker_unused, marker);
+          int internal_marker = mesh->element_markers_conversion.get_internal_marker(marker).marker;
+          if(nv == 3)
+            mesh->create_triangle(internal_marker, v[0], v[1], v[2], NULL);
+          else
+            mesh->create_quad(internal_marker, v[0], v[1], v[2], v[3], NULL);
+          element_count++;
+        }
+        else if(name == "ed")
+        {
+          std::map<unsigned int, unsigned int>::const_iterator it1 = vertex_is.find(reader.int_attribute("v1")), it2 = vertex_is.find(reader.int_attribute("v2"));
+          Node* en = (it1 == vertex_is.end() || it2 == vertex_is.end()) ? NULL : mesh->peek_edge_node(it1->second, it2->second);
+          if(en == NULL)
+            throw Hermes::Exceptions::MeshLoadFailureException("Boundary data #%d: edge %s-%s does not exist.", edge_count, reader.attribute("v1").c_str(), reader.attribute("v2").c_str());
+          int v1 = it1->second, v2 = it2->second;
+
+          std::string edge_marker = trim_marker(reader.attribute("m"));
+          mesh->boundary_markers_conversion.insert_marker(mesh->boundary_markers_conversion.min_marker_unused, edge_marker);
+          int marker = mesh->boundary_markers_conversion.get_internal_marker(edge_marker).marker;
+
+          en->marker = marker;
+
+          // This is extremely important, as in DG, it is assumed that negative boundary markers are reserved
+          // for the inner edges.
+          if(marker > 0)
+          {
+            mesh->nodes[v1].bnd = 1;
+            mesh->nodes[v2].bnd = 1;
+            en->bnd = 1;
+          }
+          edge_count++;
+        }
+        else if(name == "arc" || name == "NURBS")
+        {
+          std::map<unsigned int, unsigned int>::const_iterator it1 = vertex_is.find(reader.int_attribute("v1")), it2 = vertex_is.find(reader.int_attribute("v2"));
+          if(it1 == vertex_is.end() || it2 == vertex_is.end())
+            throw Hermes::Exceptions::MeshLoadFailureException("Curve #%d: edge %s-%s does not exist.", curve_count, reader.attribute("v1").c_str(), reader.attribute("v2").c_str());
+          int p1 = it1->second, p2 = it2->second;
+
+          if(name == "NURBS")
+          {
+            nurbs_pending = true;
+            nurbs_p1 = p1;
+            nurbs_p2 = p2;
+            nurbs_degree = reader.int_attribute("deg");
+            nurbs_points.clear();
+            nurbs_knots.clear();
+            continue;
+          }
+
+          Node* en = mesh->peek_edge_node(p1, p2);
+          if(en == NULL)
+            throw Hermes::Exceptions::MeshLoadFailureException("Curve #%d: edge %d-%d does not exist.", curve_count, p1, p2);
+
+          // degree 2, three control points, 6 knots: {0, 0, 0, 1, 1, 1}
+          Nurbs* nurbs = new Nurbs;
+          nurbs->arc = true;
+          nurbs->degree = 2;
+          nurbs->np = 3;
+          nurbs->nk = 6;
+          nurbs->kv = new double[nurbs->nk];
+          for (int i = 0; i < 3; i++)
+            nurbs->kv[i] = 0.0;
+          for (int i = 3; i < nurbs->nk; i++)
+            nurbs->kv[i] = 1.0;
+
+          // edge endpoints control points.
+          nurbs->pt = new double3[3];
+          nurbs->pt[0][0] = mesh->nodes[p1].x;
+          nurbs->pt[0][1] = mesh->nodes[p1].y;
+          nurbs->pt[0][2] = 1.0;
+          nurbs->pt[2][0] = mesh->nodes[p2].x;
+          nurbs->pt[2][1] = mesh->nodes[p2].y;
+          nurbs->pt[2][2] = 1.0;
+
+          // generate one inner control point
+          nurbs->angle = reader.double_attribute("angle");
+          double a = (180.0 - nurbs->angle) / 180.0 * M_PI;
+          double x = 1.0 / std::tan(a * 0.5);
+          nurbs->pt[1][0] = 0.5*((nurbs->pt[2][0] + nurbs->pt[0][0]) + (nurbs->pt[2][1] - nurbs->pt[0][1]) * x);
+          nurbs->pt[1][1] = 0.5*((nurbs->pt[2][1] + nurbs->pt[0][1]) - (nurbs->pt[2][0] - nurbs->pt[0][0]) * x);
+          nurbs->pt[1][2] = Hermes::cos((M_PI - a) * 0.5);
+          nurbs->ref = 0;
+
+          assign_curve(mesh, nurbs, en, p1);
+          curve_count++;
+        }
+        else if(name == "inner_point")
+        {
+          if(!nurbs_pending)
+            throw Hermes::Exceptions::MeshLoadFailureException("An inner point outside of a NURBS curve.");
+          nurbs_points.push_back(reader.double_attribute("x"));
+          nurbs_points.push_back(reader.double_attribute("y"));
+          nurbs_points.push_back(reader.double_attribute("weight"));
+        }
+        else if(name == "knot")
+        {
+          if(!nurbs_pending)
+            throw Hermes::Exceptions::MeshLoadFailureException("A knot outside of a NURBS curve.");
+          nurbs_knots.push_back(reader.double_attribute("value"));
+        }
+        else if(name == "ref")
+        {
+          int element_id = reader.int_attribute("element_id");
+          int refinement_type = reader.int_attribute("refinement_type");
+          if(refinement_type == -1)
+            mesh->unrefine_element_id(element_id);
+          else
+            mesh->refine_element_id(element_id, refinement_type);
+        }
+      }
+
+      mesh->initial_single_check();
+      mesh->update_memory_usage();
+      return true;
+    }
+
     bool MeshReaderH2DXML::save(const char *filename, Mesh *mesh)
     {
       // Utility pointer.
@@ -221,367 +583,388 @@ namespace Hermes
           }
         }
 
-        for(unsigned int subdomains_i = 0; subdomains_i < subdomains_count; subdomains_i++)
+        // The subdomain meshes are built concurrently, they only read the parsed domain and the global mesh.
+        // The refinements change the global mesh sequence (g_mesh_seq) and are performed below, sequentially.
+        int num_threads_used = Hermes2DApi.get_num_threads();
+        Hermes::Exceptions::Exception* caughtException = NULL;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads_used)
+        for(int subdomains_i = 0; subdomains_i < (int)subdomains_count; subdomains_i++)
         {
-          unsigned int vertex_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices()->i().size() : 0;
-          unsigned int element_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().size() : 0;
-          unsigned int boundary_edge_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().size() : 0;
-          unsigned int inner_edge_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges()->i().size() : 0;
-
-          // copy the whole mesh if the subdomain is the whole mesh.
-          if(element_number_count == 0 || element_number_count == parsed_xml_domain->elements().el().size())
+          if(caughtException != NULL)
+            continue;
+          try
           {
-            meshes[subdomains_i]->copy(&global_mesh);
-            // refinements.
-            if(parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements().present() && parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size() > 0)
+            unsigned int vertex_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices()->i().size() : 0;
+            unsigned int element_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().size() : 0;
+            unsigned int boundary_edge_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().size() : 0;
+            unsigned int inner_edge_number_count = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges().present() ? parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges()->i().size() : 0;
+
+            // copy the whole mesh if the subdomain is the whole mesh.
+            if(element_number_count == 0 || element_number_count == parsed_xml_domain->elements().el().size())
             {
-              // perform initial refinements
-              for (unsigned int i = 0; i < parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size(); i++)
-              {
-                int element_id = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).element_id();
-                int refinement_type = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).refinement_type();
-                if(refinement_type == -1)
-                  meshes[subdomains_i]->unrefine_element_id(element_id);
-                else
-                  meshes[subdomains_i]->refine_element_id(element_id, refinement_type);
-              }
+              meshes[subdomains_i]->copy(&global_mesh);
             }
-          }
-          else
-          {
-            // Variables //
-            unsigned int variables_count = parsed_xml_domain->variables().present() ? parsed_xml_domain->variables()->var().size() : 0;
+            else
+            {
+              // Variables //
+              unsigned int variables_count = parsed_xml_domain->variables().present() ? parsed_xml_domain->variables()->var().size() : 0;
 
-            std::map<std::string, double> variables;
-            for (unsigned int variables_i = 0; variables_i < variables_count; variables_i++)
+              std::map<std::string, double> variables;
+              for (unsigned int variables_i = 0; variables_i < variables_count; variables_i++)
 #ifdef _MSC_VER
-              variables.insert(std::make_pair<std::string, double>((std::string)parsed_xml_domain->variables()->var().at(variables_i).name(), (double&&)parsed_xml_domain->variables()->var().at(variables_i).value()));
+                variables.insert(std::make_pair<std::string, double>((std::string)parsed_xml_domain->variables()->var().at(variables_i).name(), (double&&)parsed_xml_domain->variables()->var().at(variables_i).value()));
 #else
-              variables.insert(std::make_pair<std::string, double>((std::string)parsed_xml_domain->variables()->var().at(variables_i).name(), parsed_xml_domain->variables()->var().at(variables_i).value()));
+                variables.insert(std::make_pair<std::string, double>((std::string)parsed_xml_domain->variables()->var().at(variables_i).name(), parsed_xml_domain->variables()->var().at(variables_i).value()));
 #endif
-            // Vertex numbers //
-            // create a mapping order-in-the-whole-domain <-> order-in-this-subdomain.
-            std::map<unsigned int, unsigned int> vertex_vertex_numbers;
-
-            // Initialize mesh.
-            int size = HashTable::H2D_DEFAULT_HASH_SIZE;
-            while (size < 8 * vertex_number_count)
-              size *= 2;
-            meshes[subdomains_i]->init(size);
-
-            // Create top-level vertex nodes.
-            if(vertex_number_count == 0)
-              vertex_number_count = parsed_xml_domain->vertices().v().size();
-            for (unsigned int vertex_numbers_i = 0; vertex_numbers_i < vertex_number_count; vertex_numbers_i++)
-            {
-              unsigned int vertex_number;
-              if(vertex_number_count == parsed_xml_domain->vertices().v().size())
-                vertex_number = vertex_is[vertex_numbers_i];
-              else
+              // Vertex numbers //
+              // create a mapping order-in-the-whole-domain <-> order-in-this-subdomain.
+              std::map<unsigned int, unsigned int> vertex_vertex_numbers;
+
+              // Initialize mesh.
+              int size = HashTable::H2D_DEFAULT_HASH_SIZE;
+              while (size < 8 * vertex_number_count)
+                size *= 2;
+              meshes[subdomains_i]->init(size);
+
+              // Create top-level vertex nodes.
+              if(vertex_number_count == 0)
+                vertex_number_count = parsed_xml_domain->vertices().v().size();
+              for (unsigned int vertex_numbers_i = 0; vertex_numbers_i < vertex_number_count; vertex_numbers_i++)
               {
-                vertex_number =  parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices()->i().at(vertex_numbers_i);
-                if(vertex_number > max_vertex_i)
-                  throw Exceptions::MeshLoadFailureException("Wrong vertex number:%u in subdomain %u.", vertex_number, subdomains_i);
-              }
-
-              vertex_vertex_numbers.insert(std::pair<unsigned int, unsigned int>(vertex_number, vertex_numbers_i));
-              Node* node = meshes[subdomains_i]->nodes.add();
-              assert(node->id == vertex_numbers_i);
-              node->ref = TOP_LEVEL_REF;
-              node->type = HERMES_TYPE_VERTEX;
-              node->bnd = 0;
-              node->p1 = node->p2 = -1;
-              node->next_hash = NULL;
-
-              // variables matching.
-              std::string x = parsed_xml_domain->vertices().v().at(vertex_number).x();
-              std::string y = parsed_xml_domain->vertices().v().at(vertex_number).y();
-              double x_value;
-              double y_value;
-
-              // variables lookup.
-              bool x_found = false;
-              bool y_found = false;
-              if(variables.find(x) != variables.end())
-              {
-                x_value = variables.find(x)->second;
-                x_found = true;
-              }
-              if(variables.find(y) != variables.end())
-              {
-                y_value = variables.find(y)->second;
-                y_found = true;
-              }
-
-              // test of value if no variable found.
-              if(!x_found)
-                if(std::strtod(x.c_str(), NULL) != 0.0)
-                  x_value = std::strtod(x.c_str(), NULL);
+                unsigned int vertex_number;
+                if(vertex_number_count == parsed_xml_domain->vertices().v().size())
+                  vertex_number = vertex_is[vertex_numbers_i];
                 else
                 {
-                  // This is a hard part, to find out if it is really zero.
-                  int dot_position = strchr(x.c_str(), '.') == NULL ? -1 : strchr(x.c_str(), '.') - x.c_str();
-                  for(int i = 0; i < dot_position; i++)
-                    if(strncmp(x.c_str() + i, "0", 1) != 0)
-                      throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the x coordinate of vertex no. %i.", vertex_number + 1);
-                  for(int i = dot_position + 1; i < x.length(); i++)
-                    if(strncmp(x.c_str() + i, "0", 1) != 0)
-                      throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the x coordinate of vertex no. %i.", vertex_number + 1);
-                  x_value = std::strtod(x.c_str(), NULL);
+                  vertex_number =  parsed_xml_domain->subdomains().subdomain().at(subdomains_i).vertices()->i().at(vertex_numbers_i);
+                  if(vertex_number > max_vertex_i)
+                    throw Exceptions::MeshLoadFailureException("Wrong vertex number:%u in subdomain %u.", vertex_number, subdomains_i);
+                }
+
+                vertex_vertex_numbers.insert(std::pair<unsigned int, unsigned int>(vertex_number, vertex_numbers_i));
+                Node* node = meshes[subdomains_i]->nodes.add();
+                assert(node->id == vertex_numbers_i);
+                node->ref = TOP_LEVEL_REF;
+                node->type = HERMES_TYPE_VERTEX;
+                node->bnd = 0;
+                node->p1 = node->p2 = -1;
+
+                // variables matching.
+                std::string x = parsed_xml_domain->vertices().v().at(vertex_number).x();
+                std::string y = parsed_xml_domain->vertices().v().at(vertex_number).y();
+                double x_value;
+                double y_value;
+
+                // variables lookup.
+                bool x_found = false;
+                bool y_found = false;
+                if(variables.find(x) != variables.end())
+                {
+                  x_value = variables.find(x)->second;
+                  x_found = true;
+                }
+                if(variables.find(y) != variables.end())
+                {
+                  y_value = variables.find(y)->second;
+                  y_found = true;
                 }
 
-                if(!y_found)
-                  if(std::strtod(y.c_str(), NULL) != 0.0)
-                    y_value = std::strtod(y.c_str(), NULL);
+                // test of value if no variable found.
+                if(!x_found)
+                  if(std::strtod(x.c_str(), NULL) != 0.0)
+                    x_value = std::strtod(x.c_str(), NULL);
                   else
                   {
                     // This is a hard part, to find out if it is really zero.
-                    int dot_position = strchr(y.c_str(), '.') == NULL ? -1 : strchr(y.c_str(), '.') - y.c_str();
+                    int dot_position = strchr(x.c_str(), '.') == NULL ? -1 : strchr(x.c_str(), '.') - x.c_str();
                     for(int i = 0; i < dot_position; i++)
-                      if(strncmp(y.c_str() + i, "0", 1) != 0)
-                        throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the y coordinate of vertex no. %i.", vertex_number + 1);
-                    for(int i = dot_position + 1; i < y.length(); i++)
-                      if(strncmp(y.c_str() + i, "0", 1) != 0)
-                        throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the y coordinate of vertex no. %i.", vertex_number + 1);
-                    y_value = std::strtod(y.c_str(), NULL);
+                      if(strncmp(x.c_str() + i, "0", 1) != 0)
+                        throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the x coordinate of vertex no. %i.", vertex_number + 1);
+                    for(int i = dot_position + 1; i < x.length(); i++)
+                      if(strncmp(x.c_str() + i, "0", 1) != 0)
+                        throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the x coordinate of vertex no. %i.", vertex_number + 1);
+                    x_value = std::strtod(x.c_str(), NULL);
                   }
 
-                  // assignment.
-                  node->x = x_value;
-                  node->y = y_value;
-            }
-            meshes[subdomains_i]->ntopvert = vertex_number_count;
-
-            // Element numbers //
-            unsigned int element_count = parsed_xml_domain->elements().el().size();
-            meshes[subdomains_i]->nbase = element_count;
-            meshes[subdomains_i]->nactive = meshes[subdomains_i]->ninitial = element_number_count;
-
-            Element* e;
-            int* elements_existing = new int[element_count];
-            for(int i = 0; i < element_count; i++)
-              elements_existing[i] = -1;
-            for (int element_number_i = 0; element_number_i < element_number_count; element_number_i++)
-            {
-              int elementI = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().at(element_number_i);
-              if(elementI > max_element_i)
-                  throw Exceptions::MeshLoadFailureException("Wrong element number:%i in subdomain %u.", elementI, subdomains_i);
-
-              elements_existing[element_is[parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().at(element_number_i)]] = elementI;
-            }
-            for (int element_i = 0; element_i < element_count; element_i++)
-            {
-              bool found = false;
-              if(element_number_count == 0)
-                found = true;
-              else
-                found = elements_existing[element_i] != -1;
-
-              if(!found)
-              {
-                meshes[subdomains_i]->elements.skip_slot();
-                continue;
+                  if(!y_found)
+                    if(std::strtod(y.c_str(), NULL) != 0.0)
+                      y_value = std::strtod(y.c_str(), NULL);
+                    else
+                    {
+                      // This is a hard part, to find out if it is really zero.
+                      int dot_position = strchr(y.c_str(), '.') == NULL ? -1 : strchr(y.c_str(), '.') - y.c_str();
+                      for(int i = 0; i < dot_position; i++)
+                        if(strncmp(y.c_str() + i, "0", 1) != 0)
+                          throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the y coordinate of vertex no. %i.", vertex_number + 1);
+                      for(int i = dot_position + 1; i < y.length(); i++)
+                        if(strncmp(y.c_str() + i, "0", 1) != 0)
+                          throw Hermes::Exceptions::MeshLoadFailureException("Wrong syntax in the y coordinate of vertex no. %i.", vertex_number + 1);
+                      y_value = std::strtod(y.c_str(), NULL);
+                    }
+
+                    // assignment.
+                    node->x = x_value;
+                    node->y = y_value;
               }
+              meshes[subdomains_i]->ntopvert = vertex_number_count;
+
+              // Element numbers //
+              unsigned int element_count = parsed_xml_domain->elements().el().size();
+              meshes[subdomains_i]->nbase = element_count;
+              meshes[subdomains_i]->nactive = meshes[subdomains_i]->ninitial = element_number_count;
+
+              Element* e;
+              int* elements_existing = new int[element_count];
+              for(int i = 0; i < element_count; i++)
+                elements_existing[i] = -1;
+              for (int element_number_i = 0; element_number_i < element_number_count; element_number_i++)
+              {
+                int elementI = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().at(element_number_i);
+                if(elementI > max_element_i)
+                    throw Exceptions::MeshLoadFailureException("Wrong element number:%i in subdomain %u.", elementI, subdomains_i);
 
-              XMLSubdomains::domain::elements_type::el_type* element = NULL;
-              for(int searched_element_i = 0; searched_element_i < element_count; searched_element_i++)
+                elements_existing[element_is[parsed_xml_domain->subdomains().subdomain().at(subdomains_i).elements()->i().at(element_number_i)]] = elementI;
+              }
+              for (int element_i = 0; element_i < element_count; element_i++)
               {
-                element = &parsed_xml_domain->elements().el().at(searched_element_i);
-                if(element->i() == elements_existing[element_i])
-                  break;
+                bool found = false;
+                if(element_number_count == 0)
+                  found = true;
                 else
-                  element = NULL;
+                  found = elements_existing[element_i] != -1;
+
+                if(!found)
+                {
+                  meshes[subdomains_i]->elements.skip_slot();
+                  continue;
+                }
+
+                XMLSubdomains::domain::elements_type::el_type* element = NULL;
+                for(int searched_element_i = 0; searched_element_i < element_count; searched_element_i++)
+                {
+                  element = &parsed_xml_domain->elements().el().at(searched_element_i);
+                  if(element->i() == elements_existing[element_i])
+                    break;
+                  else
+                    element = NULL;
+                }
+                if(element == NULL)
+                  throw Exceptions::MeshLoadFailureException("Element number wrong in the mesh file.");
+
+                XMLSubdomains::q_t* el_q = dynamic_cast<XMLSubdomains::q_t*>(element);
+                XMLSubdomains::t_t* el_t = dynamic_cast<XMLSubdomains::t_t*>(element);
+                if(el_q != NULL)
+                  e = meshes[subdomains_i]->create_quad(meshes[subdomains_i]->element_markers_conversion.get_internal_marker(element->m()).marker,
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v1())->second],
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v2())->second],
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v3())->second],
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v4())->second],
+                  NULL, element_i);
+                if(el_t != NULL)
+                  e = meshes[subdomains_i]->create_triangle(meshes[subdomains_i]->element_markers_conversion.get_internal_marker(element->m()).marker,
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v1())->second],
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v2())->second],
+                  &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v3())->second],
+                  NULL, element_i);
               }
-              if(element == NULL)
-                throw Exceptions::MeshLoadFailureException("Element number wrong in the mesh file.");
-
-              XMLSubdomains::q_t* el_q = dynamic_cast<XMLSubdomains::q_t*>(element);
-              XMLSubdomains::t_t* el_t = dynamic_cast<XMLSubdomains::t_t*>(element);
-              if(el_q != NULL)
-                e = meshes[subdomains_i]->create_quad(meshes[subdomains_i]->element_markers_conversion.get_internal_marker(element->m()).marker,
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v1())->second],
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v2())->second],
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v3())->second],
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_q->v4())->second],
-                NULL, element_i);
-              if(el_t != NULL)
-                e = meshes[subdomains_i]->create_triangle(meshes[subdomains_i]->element_markers_conversion.get_internal_marker(element->m()).marker,
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v1())->second],
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v2())->second],
-                &meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(el_t->v3())->second],
-                NULL, element_i);
-            }
 
-            // Boundary Edge numbers //
-            if(boundary_edge_number_count == 0)
-              boundary_edge_number_count = parsed_xml_domain->edges().ed().size();
+              // Boundary Edge numbers //
+              if(boundary_edge_number_count == 0)
+                boundary_edge_number_count = parsed_xml_domain->edges().ed().size();
 
-            for (int boundary_edge_number_i = 0; boundary_edge_number_i < boundary_edge_number_count; boundary_edge_number_i++)
-            {
-              XMLSubdomains::domain::edges_type::ed_type* edge = NULL;
-              for(unsigned int to_find_i = 0; to_find_i < parsed_xml_domain->edges().ed().size(); to_find_i++)
+              for (int boundary_edge_number_i = 0; boundary_edge_number_i < boundary_edge_number_count; boundary_edge_number_i++)
               {
-                if(boundary_edge_number_count != parsed_xml_domain->edges().ed().size())
+                XMLSubdomains::domain::edges_type::ed_type* edge = NULL;
+                for(unsigned int to_find_i = 0; to_find_i < parsed_xml_domain->edges().ed().size(); to_find_i++)
                 {
-                  if(parsed_xml_domain->edges().ed().at(to_find_i).i() == parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(boundary_edge_number_i))
+                  if(boundary_edge_number_count != parsed_xml_domain->edges().ed().size())
                   {
-                    edge = &parsed_xml_domain->edges().ed().at(to_find_i);
-                    break;
+                    if(parsed_xml_domain->edges().ed().at(to_find_i).i() == parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(boundary_edge_number_i))
+                    {
+                      edge = &parsed_xml_domain->edges().ed().at(to_find_i);
+                      break;
+                    }
                   }
-                }
-                else
-                {
-                  if(parsed_xml_domain->edges().ed().at(to_find_i).i() == edge_is[boundary_edge_number_i])
+                  else
                   {
-                    edge = &parsed_xml_domain->edges().ed().at(to_find_i);
-                    break;
+                    if(parsed_xml_domain->edges().ed().at(to_find_i).i() == edge_is[boundary_edge_number_i])
+                    {
+                      edge = &parsed_xml_domain->edges().ed().at(to_find_i);
+                      break;
+                    }
                   }
                 }
-              }
-
-              if(edge == NULL)
-                  throw Exceptions::MeshLoadFailureException("Wrong boundary-edge number:%i in subdomain %u.", parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(boundary_edge_number_i), subdomains_i);
 
-              Node* en = meshes[subdomains_i]->peek_edge_node(vertex_vertex_numbers.find(edge->v1())->second, vertex_vertex_numbers.find(edge->v2())->second);
-              if(en == NULL)
-                throw Hermes::Exceptions::MeshLoadFailureException("Boundary data error (edge %i does not exist).", boundary_edge_number_i);
+                if(edge == NULL)
+                    throw Exceptions::MeshLoadFailureException("Wrong boundary-edge number:%i in subdomain %u.", parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(boundary_edge_number_i), subdomains_i);
 
-              en->marker = meshes[subdomains_i]->boundary_markers_conversion.get_internal_marker(edge->m()).marker;
+                Node* en = meshes[subdomains_i]->peek_edge_node(vertex_vertex_numbers.find(edge->v1())->second, vertex_vertex_numbers.find(edge->v2())->second);
+                if(en == NULL)
+                  throw Hermes::Exceptions::MeshLoadFailureException("Boundary data error (edge %i does not exist).", boundary_edge_number_i);
 
-              meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(edge->v1())->second].bnd = 1;
-              meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(edge->v2())->second].bnd = 1;
-              en->bnd = 1;
-            }
+                en->marker = meshes[subdomains_i]->boundary_markers_conversion.get_internal_marker(edge->m()).marker;
 
-            // Inner Edge numbers //
-            for (int inner_edge_number_i = 0; inner_edge_number_i < inner_edge_number_count; inner_edge_number_i++)
-            {
-              XMLSubdomains::domain::edges_type::ed_type* edge = NULL;
+                meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(edge->v1())->second].bnd = 1;
+                meshes[subdomains_i]->nodes[vertex_vertex_numbers.find(edge->v2())->second].bnd = 1;
+                en->bnd = 1;
+              }
 
-              for(unsigned int to_find_i = 0; to_find_i < parsed_xml_domain->edges().ed().size(); to_find_i++)
+              // Inner Edge numbers //
+              for (int inner_edge_number_i = 0; inner_edge_number_i < inner_edge_number_count; inner_edge_number_i++)
               {
-                if(parsed_xml_domain->edges().ed().at(to_find_i).i() == parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges()->i().at(inner_edge_number_i))
+                XMLSubdomains::domain::edges_type::ed_type* edge = NULL;
+
+                for(unsigned int to_find_i = 0; to_find_i < parsed_xml_domain->edges().ed().size(); to_find_i++)
                 {
-                  edge = &parsed_xml_domain->edges().ed().at(to_find_i);
-                  break;
+                  if(parsed_xml_domain->edges().ed().at(to_find_i).i() == parsed_xml_domain->subdomains().subdomain().at(subdomains_i).inner_edges()->i().at(inner_edge_number_i))
+                  {
+                    edge = &parsed_xml_domain->edges().ed().at(to_find_i);
+                    break;
+                  }
                 }
-              }
 
-              if(edge == NULL)
-                  throw Exceptions::MeshLoadFailureException("Wrong inner-edge number:%i in subdomain %u.", parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(inner_edge_number_i), subdomains_i);
+                if(edge == NULL)
+                    throw Exceptions::MeshLoadFailureException("Wrong inner-edge number:%i in subdomain %u.", parsed_xml_domain->subdomains().subdomain().at(subdomains_i).boundary_edges()->i().at(inner_edge_number_i), subdomains_i);
 
-              Node* en = meshes[subdomains_i]->peek_edge_node(vertex_vertex_numbers.find(edge->v1())->second, vertex_vertex_numbers.find(edge->v2())->second);
-              if(en == NULL)
-                throw Hermes::Exceptions::MeshLoadFailureException("Inner data error (edge %i does not exist).", inner_edge_number_i);
+                Node* en = meshes[subdomains_i]->peek_edge_node(vertex_vertex_numbers.find(edge->v1())->second, vertex_vertex_numbers.find(edge->v2())->second);
+                if(en == NULL)
+                  throw Hermes::Exceptions::MeshLoadFailureException("Inner data error (edge %i does not exist).", inner_edge_number_i);
 
-              en->marker = meshes[subdomains_i]->boundary_markers_conversion.get_internal_marker(edge->m()).marker;
-              en->bnd = 0;
-            }
-
-            // Curves //
-            // Arcs & NURBSs //
-            unsigned int arc_count = parsed_xml_domain->curves().present() ? parsed_xml_domain->curves()->arc().size() : 0;
-            unsigned int nurbs_count = parsed_xml_domain->curves().present() ? parsed_xml_domain->curves()->NURBS().size() : 0;
+                en->marker = meshes[subdomains_i]->boundary_markers_conversion.get_internal_marker(edge->m()).marker;
+                en->bnd = 0;
+              }
 
-            for (unsigned int curves_i = 0; curves_i < arc_count + nurbs_count; curves_i++)
-            {
-              // load the control points, knot vector, etc.
-              Node* en;
-              int p1, p2;
+              // Curves //
+              // Arcs & NURBSs //
+              unsigned int arc_count = parsed_xml_domain->curves().present() ? parsed_xml_domain->curves()->arc().size() : 0;
+              unsigned int nurbs_count = parsed_xml_domain->curves().present() ? parsed_xml_domain->curves()->NURBS().size() : 0;
 
-              // first do arcs, then NURBSs.
-              Nurbs* nurbs;
-              if(curves_i < arc_count)
+              for (unsigned int curves_i = 0; curves_i < arc_count + nurbs_count; curves_i++)
               {
-                if(vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v1()) == vertex_vertex_numbers.end() ||
-                  vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v2()) == vertex_vertex_numbers.end())
-                  continue;
-                else
-                {
-                  // read the end point indices
-                  p1 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v1())->second;
-                  p2 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v2())->second;
+                // load the control points, knot vector, etc.
+                Node* en;
+                int p1, p2;
 
-                  nurbs = load_arc(meshes[subdomains_i], parsed_xml_domain, curves_i, &en, p1, p2, true);
-                  if(nurbs == NULL)
+                // first do arcs, then NURBSs.
+                Nurbs* nurbs;
+                if(curves_i < arc_count)
+                {
+                  if(vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v1()) == vertex_vertex_numbers.end() ||
+                    vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v2()) == vertex_vertex_numbers.end())
                     continue;
+                  else
+                  {
+                    // read the end point indices
+                    p1 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v1())->second;
+                    p2 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->arc().at(curves_i).v2())->second;
+
+                    nurbs = load_arc(meshes[subdomains_i], parsed_xml_domain, curves_i, &en, p1, p2, true);
+                    if(nurbs == NULL)
+                      continue;
+                  }
                 }
-              }
-              else
-              {
-                if(vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v1()) == vertex_vertex_numbers.end() ||
-                  vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v2()) == vertex_vertex_numbers.end())
-                  continue;
                 else
                 {
-                  // read the end point indices
-                  p1 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v1())->second;
-                  p2 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v2())->second;
-
-                  nurbs = load_nurbs(meshes[subdomains_i], parsed_xml_domain, curves_i - arc_count, &en, p1, p2, true);
-                  if(nurbs == NULL)
+                  if(vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v1()) == vertex_vertex_numbers.end() ||
+                    vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v2()) == vertex_vertex_numbers.end())
                     continue;
-                }
-              }
-
-              // assign the arc to the elements sharing the edge node
-              for (unsigned int node_i = 0; node_i < 2; node_i++)
-              {
-                Element* e = en->elem[node_i];
-                if(e == NULL) continue;
+                  else
+                  {
+                    // read the end point indices
+                    p1 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v1())->second;
+                    p2 = vertex_vertex_numbers.find(parsed_xml_domain->curves()->NURBS().at(curves_i - arc_count).v2())->second;
 
-                if(e->cm == NULL)
-                {
-                  e->cm = new CurvMap;
-                  memset(e->cm, 0, sizeof(CurvMap));
-                  e->cm->toplevel = 1;
-                  e->cm->order = 4;
+                    nurbs = load_nurbs(meshes[subdomains_i], parsed_xml_domain, curves_i - arc_count, &en, p1, p2, true);
+                    if(nurbs == NULL)
+                      continue;
+                  }
                 }
 
-                int idx = -1;
-                for (unsigned j = 0; j < e->get_nvert(); j++)
-                  if(e->en[j] == en) { idx = j; break; }
-                  assert(idx >= 0);
+                // assign the arc to the elements sharing the edge node
+                for (unsigned int node_i = 0; node_i < 2; node_i++)
+                {
+                  Element* e = en->elem[node_i];
+                  if(e == NULL) continue;
 
-                  if(e->vn[idx]->id == p1)
-                  {
-                    e->cm->nurbs[idx] = nurbs;
-                    nurbs->ref++;
-                  }
-                  else
+                  if(e->cm == NULL)
                   {
-                    Nurbs* nurbs_rev = meshes[subdomains_i]->reverse_nurbs(nurbs);
-                    e->cm->nurbs[idx] = nurbs_rev;
-                    nurbs_rev->ref++;
+                    e->cm = new CurvMap;
+                    memset(e->cm, 0, sizeof(CurvMap));
+                    e->cm->toplevel = 1;
+                    e->cm->order = 4;
                   }
+
+                  int idx = -1;
+                  for (unsigned j = 0; j < e->get_nvert(); j++)
+                    if(e->en[j] == en) { idx = j; break; }
+                    assert(idx >= 0);
+
+                    if(e->vn[idx]->id == p1)
+                    {
+                      e->cm->nurbs[idx] = nurbs;
+                      nurbs->ref++;
+                    }
+                    else
+                    {
+                      Nurbs* nurbs_rev = meshes[subdomains_i]->reverse_nurbs(nurbs);
+                      e->cm->nurbs[idx] = nurbs_rev;
+                      nurbs_rev->ref++;
+                    }
+                }
+                if(!nurbs->ref) delete nurbs;
               }
-              if(!nurbs->ref) delete nurbs;
+
+              // update refmap coeffs of curvilinear elements
+              for_all_elements(e, meshes[subdomains_i])
+                if(e->cm != NULL)
+                  e->cm->update_refmap_coeffs(e);
+
+              delete [] elements_existing;
             }
+          }
+          catch(Hermes::Exceptions::Exception& e)
+          {
+#pragma omp critical (mesh_reader_exception)
+            if(caughtException == NULL)
+              caughtException = e.clone();
+          }
+          catch(std::exception& e)
+          {
+#pragma omp critical (mesh_reader_exception)
+            if(caughtException == NULL)
+              caughtException = new Hermes::Exceptions::Exception(e.what());
+          }
+        }
 
-            // update refmap coeffs of curvilinear elements
-            for_all_elements(e, meshes[subdomains_i])
-              if(e->cm != NULL)
-                e->cm->update_refmap_coeffs(e);
+        if(caughtException != NULL)
+        {
+          std::string message = caughtException->what();
+          delete caughtException;
+          delete [] vertex_is;
+          delete [] element_is;
+          delete [] edge_is;
+          throw Hermes::Exceptions::MeshLoadFailureException("%s", message.c_str());
+        }
 
-            // refinements.
-            if(parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements().present() && parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size() > 0)
+        for(unsigned int subdomains_i = 0; subdomains_i < subdomains_count; subdomains_i++)
+        {
+          // refinements.
+          if(parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements().present() && parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size() > 0)
+          {
+            // perform initial refinements
+            for (unsigned int i = 0; i < parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size(); i++)
             {
-              // perform initial refinements
-              for (unsigned int i = 0; i < parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().size(); i++)
-              {
-                int element_id = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).element_id();
-                int refinement_type = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).refinement_type();
-                if(refinement_type == -1)
-                  meshes[subdomains_i]->unrefine_element_id(element_id);
-                else
-                  meshes[subdomains_i]->refine_element_id(element_id, refinement_type);
-              }
+              int element_id = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).element_id();
+              int refinement_type = parsed_xml_domain->subdomains().subdomain().at(subdomains_i).refinements()->ref().at(i).refinement_type();
+              if(refinement_type == -1)
+                meshes[subdomains_i]->unrefine_element_id(element_id);
+              else
+                meshes[subdomains_i]->refine_element_id(element_id, refinement_type);
             }
-
-            delete [] elements_existing;
           }
           meshes[subdomains_i]->seq = g_mesh_seq++;
           meshes[subdomains_i]->initial_single_check();
+          meshes[subdomains_i]->update_memory_usage();
         }
 
         delete [] vertex_is;
@@ -819,7 +1202,6 @@ namespace Hermes
           node->type = HERMES_TYPE_VERTEX;
           node->bnd = 0;
           node->p1 = node->p2 = -1;
-          node->next_hash = NULL;
 
           // variables matching.
           std::string x = parsed_xml_mesh->vertices().v().at(vertex_i).x();
@@ -1070,7 +1452,6 @@ namespace Hermes
           node->type = HERMES_TYPE_VERTEX;
           node->bnd = 0;
           node->p1 = node->p2 = -1;
-          node->next_hash = NULL;
 
           // variables matching.
           std::string x = parsed_xml_domain->vertices().v().at(vertex_i).x();
@@ -15,6 +15,7 @@
 
 #include "global.h"
 #include "mesh.h"
+#include "element_locator.h"
 #include "refmap.h"
 
 namespace Hermes
@@ -125,6 +126,27 @@ namespace Hermes
       return cur_node->phys_y[order];
     }
 
+    void RefMap::get_phys_coordinates(int order, double* x, double* y)
+    {
+      if(cur_node == NULL)
+        throw Hermes::Exceptions::Exception("Cur_node == NULL in RefMap - inner algorithms failed");
+      int np = quad_2d->get_num_points(order, element->get_mode());
+      if(is_const)
+      {
+        double map[2][3];
+        calc_affine_map(map);
+        double3* pt = quad_2d->get_points(order, element->get_mode());
+        for (int i = 0; i < np; i++)
+        {
+          x[i] = map[0][0] * pt[i][0] + map[0][1] * pt[i][1] + map[0][2];
+          y[i] = map[1][0] * pt[i][0] + map[1][1] * pt[i][1] + map[1][2];
+        }
+        return;
+      }
+      memcpy(x, get_phys_x(order), np * sizeof(double));
+      memcpy(y, get_phys_y(order), np * sizeof(double));
+    }
+
     /// Returns the triples[x, y, norm] of the tangent to the specified (possibly
     /// curved) edge at the 1D integration points along the edge. The maximum
     /// 1D quadrature rule is used by default, but the user may specify his own
@@ -137,13 +159,16 @@ namespace Hermes
       if(order == -1)
         order = quad_2d->get_edge_points(edge, quad_2d->get_max_order(element->get_mode()), element->get_mode());
 
-      // NOTE: Hermes::Order-based caching of geometric data is already employed in DiscreteProblem.
+      // Kept until asked for another order of the same edge.
       if(cur_node->tan[edge] != NULL)
       {
+        if(cur_node->tan_order[edge] == order)
+          return cur_node->tan[edge];
         delete [] cur_node->tan[edge];
         cur_node->tan[edge] = NULL;
       }
       calc_tangent(edge, order);
+      cur_node->tan_order[edge] = order;
 
       return cur_node->tan[edge];
     }
@@ -153,6 +178,14 @@ namespace Hermes
       free();
       this->quad_2d = quad_2d;
       ref_map_pss.set_quad_2d(quad_2d);
+
+      // The tables of the active element are recalculated for the new quadrature.
+      if(element != NULL)
+      {
+        num_tables = quad_2d->get_num_tables(element->get_mode());
+        assert(num_tables <= H2D_MAX_TABLES);
+        update_cur_node();
+      }
     }
 
     void RefMap::set_active_element(Element* e)
@@ -234,6 +267,19 @@ namespace Hermes
 
       // construct jacobi matrices of the direct reference map for all integration points
 
+      // affine elements: the constant values, no shape functions needed
+      if(is_const)
+      {
+        double2x2* irm = cur_node->inv_ref_map[order] = new double2x2[np];
+        double* jac = cur_node->jacobian[order] = new double[np];
+        for (i = 0; i < np; i++)
+        {
+          memcpy(irm[i], const_inv_ref_map, sizeof(double2x2));
+          jac[i] = const_jacobian;
+        }
+        return;
+      }
+
       double2x2* m = new double2x2[np];
       memset(m, 0, np * sizeof(double2x2));
       ref_map_pss.force_transform(sub_idx, ctm);
@@ -365,11 +411,38 @@ namespace Hermes
       const_jacobian *= get_transform_jacobian();
     }
 
+    void RefMap::calc_affine_map(double map[2][3]) const
+    {
+      // the reference vertices are (-1, -1), (1, -1) and (-1, 1) (triangles), (1, 1) (quads) - the last one
+      // is given by the others for parallelograms
+      int k = element->is_triangle() ? 2 : 3;
+      double a[2][2] = { { 0.5 * (element->vn[1]->x - element->vn[0]->x), 0.5 * (element->vn[k]->x - element->vn[0]->x) },
+      { 0.5 * (element->vn[1]->y - element->vn[0]->y), 0.5 * (element->vn[k]->y - element->vn[0]->y) } };
+      double b[2] = { element->vn[0]->x + a[0][0] + a[0][1], element->vn[0]->y + a[1][0] + a[1][1] };
+
+      // composed with the transformation to the sub-element
+      for (int c = 0; c < 2; c++)
+      {
+        map[c][0] = a[c][0] * ctm->m[0];
+        map[c][1] = a[c][1] * ctm->m[1];
+        map[c][2] = a[c][0] * ctm->t[0] + a[c][1] * ctm->t[1] + b[c];
+      }
+    }
+
     void RefMap::calc_phys_x(int order)
     {
       // transform all x coordinates of the integration points
       int i, j, np = quad_2d->get_num_points(order, element->get_mode());
       double* x = cur_node->phys_x[order] = new double[np];
+      if(is_const)
+      {
+        double map[2][3];
+        calc_affine_map(map);
+        double3* pt = quad_2d->get_points(order, element->get_mode());
+        for (j = 0; j < np; j++)
+          x[j] = map[0][0] * pt[j][0] + map[0][1] * pt[j][1] + map[0][2];
+        return;
+      }
       memset(x, 0, np * sizeof(double));
       ref_map_pss.force_transform(sub_idx, ctm);
       for (i = 0; i < nc; i++)
@@ -387,6 +460,15 @@ namespace Hermes
       // transform all y coordinates of the integration points
       int i, j, np = quad_2d->get_num_points(order, element->get_mode());
       double* y = cur_node->phys_y[order] = new double[np];
+      if(is_const)
+      {
+        double map[2][3];
+        calc_affine_map(map);
+        double3* pt = quad_2d->get_points(order, element->get_mode());
+        for (j = 0; j < np; j++)
+          y[j] = map[1][0] * pt[j][0] + map[1][1] * pt[j][1] + map[1][2];
+        return;
+      }
       memset(y, 0, np * sizeof(double));
       ref_map_pss.force_transform(sub_idx, ctm);
       for (i = 0; i < nc; i++)
@@ -423,8 +505,8 @@ namespace Hermes
       else
       {
         // construct jacobi matrices of the direct reference map at integration points along the edge
-        double2x2 m[15];
-        assert(np <= 15);
+        double2x2 m[g_max_quad / 2 + 1];
+        assert(np <= g_max_quad / 2 + 1);
         memset(m, 0, np*sizeof(double2x2));
         ref_map_pss.force_transform(sub_idx, ctm);
         for (i = 0; i < nc; i++)
@@ -784,137 +866,10 @@ namespace Hermes
 
     Element* RefMap::element_on_physical_coordinates(const Mesh* mesh, double x, double y, double* x_reference, double* y_reference)
     {
-      // go through all elements
-      double xi1, xi2;
-      Element *e;
-      // vector for curved elements that do not have the point in them when considering straight edges.
-      Hermes::vector<Element*> improbable_curved_elements;
-      for_all_active_elements(e, mesh)
-      {
-        bool is_triangle = e->is_triangle();
-        bool is_curved = e->is_curved();
-
-        // For curved elements.
-        bool is_near_straightened_element = false;
-
-        // edge vectors.
-        double2 vector[4];
-        vector[0][0] = e->vn[1]->x - e->vn[0]->x;
-        vector[0][1] = e->vn[1]->y - e->vn[0]->y;
-        vector[1][0] = e->vn[2]->x - e->vn[1]->x;
-        vector[1][1] = e->vn[2]->y - e->vn[1]->y;
-        if(is_triangle)
-        {
-          vector[2][0] = e->vn[0]->x - e->vn[2]->x;
-          vector[2][1] = e->vn[0]->y - e->vn[2]->y;
-        }
-        else
-        {
-          vector[2][0] = e->vn[3]->x - e->vn[2]->x;
-          vector[2][1] = e->vn[3]->y - e->vn[2]->y;
-          vector[3][0] = e->vn[0]->x - e->vn[3]->x;
-          vector[3][1] = e->vn[0]->y - e->vn[3]->y;
-        }
- 
-        // calculate cross products
-        // -> if all cross products of edge vectors (vector[*]) x vector (thePoint - aVertex) are positive (negative),
-        // the point is inside of the element.
-        double cross_product_0 = (x - e->vn[0]->x) * vector[0][1] - (y - e->vn[0]->y) * vector[0][0];
-        double cross_product_1 = (x - e->vn[1]->x) * vector[1][1] - (y - e->vn[1]->y) * vector[1][0];
-        double cross_product_2 = (x - e->vn[2]->x) * vector[2][1] - (y - e->vn[2]->y) * vector[2][0];
-        if(is_triangle)
-        {
-          if ((cross_product_0 * cross_product_1 >= 0) && (cross_product_0 * cross_product_2 >= 0) && (cross_product_1 * cross_product_2 >= 0))
-          {
-            if(!is_curved)
-            {
-              untransform(e, x, y, xi1, xi2);
-              if(x_reference != NULL)
-                (*x_reference) = xi1;
-              if(y_reference != NULL)
-                (*y_reference) = xi2;
-              return e;
-            }
-            else
-              is_near_straightened_element = true;
-          }
-          if(is_curved && !is_near_straightened_element)
-          {
-            double gravity_center_x = (e->vn[0]->x + e->vn[1]->x + e->vn[2]->x) / 3.;
-            double gravity_center_y = (e->vn[0]->y + e->vn[1]->y + e->vn[2]->y) / 3.;
-            double distance_x = std::abs(x - gravity_center_x);
-            double distance_y = std::abs(y - gravity_center_y);
-            if(distance_x < std::abs(e->vn[0]->x - gravity_center_x) && distance_x < std::abs(e->vn[1]->x - gravity_center_x) && distance_x < std::abs(e->vn[2]->x - gravity_center_x) &&
-              distance_y < std::abs(e->vn[0]->y - gravity_center_y) && distance_y < std::abs(e->vn[1]->y - gravity_center_y) && distance_y < std::abs(e->vn[2]->y - gravity_center_y))
-                is_near_straightened_element = true;
-          }
-        }
-        else
-        {
-          double cross_product_3 = (x - e->vn[3]->x) * vector[3][1] - (y - e->vn[3]->y) * vector[3][0];
-          if ((cross_product_0 * cross_product_1 >= 0) && (cross_product_0 * cross_product_2 >= 0) && 
-              (cross_product_1 * cross_product_2 >= 0) && (cross_product_1 * cross_product_3 >= 0) &&
-              (cross_product_2 * cross_product_3 >= 0) && (cross_product_0 * cross_product_3 >= 0))
-          {
-            if(!is_curved)
-            {
-              untransform(e, x, y, xi1, xi2);
-              if(x_reference != NULL)
-                (*x_reference) = xi1;
-              if(y_reference != NULL)
-                (*y_reference) = xi2;
-              return e;
-            }
-            else
-              is_near_straightened_element = true;
-          }
-          if(is_curved && !is_near_straightened_element)
-          {
-            double gravity_center_x = (e->vn[0]->x + e->vn[1]->x + e->vn[2]->x + e->vn[3]->x) / 4.;
-            double gravity_center_y = (e->vn[0]->y + e->vn[1]->y + e->vn[2]->y + e->vn[3]->y) / 4.;
-            double distance_x = std::abs(x - gravity_center_x);
-            double distance_y = std::abs(y - gravity_center_y);
-            if(distance_x <= std::abs(e->vn[0]->x - gravity_center_x) && distance_x <= std::abs(e->vn[1]->x - gravity_center_x) && distance_x <= std::abs(e->vn[2]->x - gravity_center_x) && distance_x <= std::abs(e->vn[3]->x - gravity_center_x) &&
-              distance_y <= std::abs(e->vn[0]->y - gravity_center_y) && distance_y <= std::abs(e->vn[1]->y - gravity_center_y) && distance_y <= std::abs(e->vn[2]->y - gravity_center_y) && distance_y <= std::abs(e->vn[3]->y - gravity_center_y))
-                is_near_straightened_element = true;
-          }
-        }
-
-        if(is_curved)
-        {
-          if(is_near_straightened_element)
-          {
-            untransform(e, x, y, xi1, xi2);
-            if(is_in_ref_domain(e, xi1, xi2))
-            {
-              if(x_reference != NULL)
-                (*x_reference) = xi1;
-              if(y_reference != NULL)
-                (*y_reference) = xi2;
-              return e;
-            }
-          }
-          else
-            improbable_curved_elements.push_back(e);
-        }
-      }
-
-      // loop through the improbable curved elements.
-      for(int i = 0; i < improbable_curved_elements.size(); i++)
-      {
-        untransform(improbable_curved_elements[i], x, y, xi1, xi2);
-        if(is_in_ref_domain(improbable_curved_elements[i], xi1, xi2))
-        {
-          if(x_reference != NULL)
-            (*x_reference) = xi1;
-          if(y_reference != NULL)
-            (*y_reference) = xi2;
-          return improbable_curved_elements[i];
-        }
-      }
-
-      Hermes::Mixins::Loggable::Static::warn("Point (%g, %g) does not lie in any element.", x, y);
-      return NULL;
+      Element* e = mesh->get_element_locator()->find(x, y, x_reference, y_reference);
+      if(e == NULL)
+        Hermes::Mixins::Loggable::Static::warn("Point (%g, %g) does not lie in any element.", x, y);
+      return e;
     }
 
     void RefMap::init_node(Node* pp)
@@ -24,6 +24,7 @@ namespace Hermes
     static const Rect H2D_UNITY = { 0, 0, ONE, ONE };
     Traverse::Traverse(bool master) : master(master)
     {
+      this->single_mesh = false;
     }
 
     static int get_split_and_sons(Element* e, Rect* cr, Rect* er, int4& sons)
@@ -249,6 +250,11 @@ namespace Hermes
       int count = 0;
 
       this->num = meshes.size();
+
+      // All the functions on one mesh - the states are its active elements.
+      if(is_single_mesh(meshes))
+        return meshes[0]->get_num_active_elements();
+
       this->begin(num, &meshes.front());
 
       while (1)
@@ -521,6 +527,9 @@ namespace Hermes
       int* top_f = (top_by_ref == NULL) ? &this->top : top_by_ref;
       int* id_f = (id_by_ref == NULL) ? &this->id : id_by_ref;
 
+      if(this->single_mesh)
+        return get_next_state_single_mesh(top_f, id_f);
+
       while (1)
       {
         int i, son;
@@ -604,15 +613,9 @@ namespace Hermes
         // if yes, set boundary flags and return the state
         if(leaf)
         {
-          if(fn != NULL)
-            for (i = 0; i < num; i++)
-              if(s->e[i] != NULL)
-              {
-                fn[i]->set_active_element(s->e[i]);
-                fn[i]->set_transform(s->sub_idx[i]);
-              }
-              set_boundary_info(s);
-              return s;
+          set_active_state(s);
+          set_boundary_info(s);
+          return s;
         }
 
         // Triangle: push son states
@@ -784,6 +787,314 @@ namespace Hermes
       }
     }
 
+    Traverse::State* Traverse::get_next_state_single_mesh(int* top_f, int* id_f)
+    {
+      while (1)
+      {
+        // The visited states are popped, as in get_next_state().
+        State* s;
+        while (*top_f > 0 && (s = stack + (*top_f)-1)->visited)
+          (*top_f)--;
+
+        // The next used base element.
+        if(*top_f <= 0)
+        {
+          while (*id_f < meshes[0]->get_num_base_elements() && !meshes[0]->get_element(*id_f)->used)
+            (*id_f)++;
+          if(*id_f >= meshes[0]->get_num_base_elements())
+            return NULL;
+          s = push_state(top_f);
+          s->rep = meshes[0]->get_element((*id_f)++);
+        }
+
+        s->visited = true;
+        Element* e = s->rep;
+
+        // A whole active element, the identity transformations (sub_idx zeroed by push_state()).
+        if(e->active)
+        {
+          for (int i = 0; i < num; i++)
+            s->e[i] = e;
+          s->cr = H2D_UNITY;
+          set_active_state(s);
+          set_boundary_info(s);
+          return s;
+        }
+
+        // The sons, in the order of get_next_state() - they are visited from the last one.
+        for (int son = 0; son < 4; son++)
+          if(e->sons[son] != NULL)
+            push_state(top_f)->rep = e->sons[son];
+      }
+    }
+
+    bool Traverse::is_single_mesh(const Hermes::vector<const Mesh*>& meshes)
+    {
+      for (unsigned int i = 1; i < meshes.size(); i++)
+        if(meshes[i] != meshes[0])
+          return false;
+      return true;
+    }
+
+    Traverse::State** Traverse::get_single_mesh_states(const Mesh* mesh, int& states_count)
+    {
+      int states_allocated = std::max(mesh->get_num_active_elements(), 1);
+      State** states = (State**)malloc(states_allocated * sizeof(State*));
+      states_count = 0;
+
+      // Depth-first through the refinement trees, in the order of get_next_state().
+      std::vector<Element*> elements;
+      for (int id = 0; id < mesh->get_num_base_elements(); id++)
+      {
+        Element* base_element = mesh->get_element(id);
+        if(!base_element->used)
+          continue;
+        elements.push_back(base_element);
+        while (!elements.empty())
+        {
+          Element* e = elements.back();
+          elements.pop_back();
+          if(!e->active)
+          {
+            for (int son = 0; son < 4; son++)
+              if(e->sons[son] != NULL)
+                elements.push_back(e->sons[son]);
+            continue;
+          }
+
+          if(states_count == states_allocated)
+          {
+            states_allocated *= 2;
+            states = (State**)realloc(states, states_allocated * sizeof(State*));
+          }
+          State* s = new State();
+          states[states_count++] = s;
+          s->num = num;
+          s->e = new Element*[num];
+          s->sub_idx = new uint64_t[num];
+          for (int i = 0; i < num; i++)
+          {
+            s->e[i] = e;
+            s->sub_idx[i] = 0;
+          }
+          s->rep = e;
+          s->visited = true;
+          set_boundary_info(s);
+        }
+      }
+      return states;
+    }
+
+    /// A traversal of get_states(), the elements are stored by their ids (a mesh copy has the same sequence number and ids).
+    struct CachedTraversal
+    {
+      std::vector<const Mesh*> meshes;
+      std::vector<unsigned> seqs;
+      int num_states;
+      /// num per state, -1 for no element.
+      std::vector<int> element_ids;
+      std::vector<uint64_t> sub_idx;
+      /// Which of the elements is the representing one.
+      std::vector<int> rep;
+      /// H2D_MAX_NUMBER_EDGES + 1 per state, the last one is isBnd.
+      std::vector<bool> bnd;
+      std::vector<int> isurf;
+      unsigned last_use;
+    };
+
+    static const unsigned int traversal_cache_size = 8;
+    static std::vector<CachedTraversal*> traversal_cache;
+    static unsigned traversal_cache_clock = 0;
+
+    static bool traversal_matches(const CachedTraversal* traversal, const Hermes::vector<const Mesh*>& meshes)
+    {
+      if(traversal->meshes.size() != meshes.size())
+        return false;
+      for (unsigned int i = 0; i < meshes.size(); i++)
+        if(traversal->meshes[i] != meshes[i] || traversal->seqs[i] != meshes[i]->get_seq())
+          return false;
+      return true;
+    }
+
+    Traverse::State** Traverse::replay_states(Hermes::vector<const Mesh*>& meshes, int& states_count)
+    {
+      State** states = NULL;
+#pragma omp critical (traversal_cache)
+      {
+        for (unsigned int c = 0; c < traversal_cache.size() && states == NULL; c++)
+        {
+          CachedTraversal* traversal = traversal_cache[c];
+          if(!traversal_matches(traversal, meshes))
+            continue;
+
+          int num = meshes.size();
+          bool valid = true;
+          states = (State**)malloc(std::max(traversal->num_states, 1) * sizeof(State*));
+          for (states_count = 0; states_count < traversal->num_states && valid; states_count++)
+          {
+            State* s = new State();
+            states[states_count] = s;
+            s->num = num;
+            s->e = new Element*[num];
+            s->sub_idx = new uint64_t[num];
+            for (int i = 0; i < num; i++)
+            {
+              int id = traversal->element_ids[states_count * num + i];
+              s->e[i] = (id < 0) ? NULL : meshes[i]->get_element_fast(id);
+              // A mesh modified without a change of its sequence number.
+              if(s->e[i] != NULL && (!s->e[i]->used || !s->e[i]->active))
+                valid = false;
+              s->sub_idx[i] = traversal->sub_idx[states_count * num + i];
+            }
+            s->rep = s->e[traversal->rep[states_count]];
+            for (int j = 0; j < H2D_MAX_NUMBER_EDGES; j++)
+              s->bnd[j] = traversal->bnd[states_count * (H2D_MAX_NUMBER_EDGES + 1) + j];
+            s->isBnd = traversal->bnd[states_count * (H2D_MAX_NUMBER_EDGES + 1) + H2D_MAX_NUMBER_EDGES];
+            s->isurf = traversal->isurf[states_count];
+            s->visited = true;
+          }
+
+          if(valid)
+            traversal->last_use = ++traversal_cache_clock;
+          else
+          {
+            free_states(states, states_count);
+            states = NULL;
+            delete traversal;
+            traversal_cache.erase(traversal_cache.begin() + c);
+          }
+        }
+      }
+      return states;
+    }
+
+    void Traverse::store_states(Hermes::vector<const Mesh*>& meshes, State** states, int states_count)
+    {
+      int num = meshes.size();
+      CachedTraversal* traversal = new CachedTraversal;
+      traversal->num_states = states_count;
+      for (int i = 0; i < num; i++)
+      {
+        traversal->meshes.push_back(meshes[i]);
+        traversal->seqs.push_back(meshes[i]->get_seq());
+      }
+      traversal->element_ids.resize(states_count * num);
+      traversal->sub_idx.resize(states_count * num);
+      traversal->rep.resize(states_count);
+      traversal->bnd.resize(states_count * (H2D_MAX_NUMBER_EDGES + 1));
+      traversal->isurf.resize(states_count);
+      for (int state_i = 0; state_i < states_count; state_i++)
+      {
+        State* s = states[state_i];
+        for (int i = 0; i < num; i++)
+        {
+          traversal->element_ids[state_i * num + i] = (s->e[i] == NULL) ? -1 : s->e[i]->id;
+          traversal->sub_idx[state_i * num + i] = s->sub_idx[i];
+          if(s->e[i] == s->rep)
+            traversal->rep[state_i] = i;
+        }
+        for (int j = 0; j < H2D_MAX_NUMBER_EDGES; j++)
+          traversal->bnd[state_i * (H2D_MAX_NUMBER_EDGES + 1) + j] = s->bnd[j];
+        traversal->bnd[state_i * (H2D_MAX_NUMBER_EDGES + 1) + H2D_MAX_NUMBER_EDGES] = s->isBnd;
+        traversal->isurf[state_i] = s->isurf;
+      }
+
+#pragma omp critical (traversal_cache)
+      {
+        traversal->last_use = ++traversal_cache_clock;
+        // Replace the least recently used traversal (and any of these meshes, it is outdated).
+        for (unsigned int c = 0; c < traversal_cache.size(); c++)
+          if(traversal_cache[c]->meshes == traversal->meshes)
+          {
+            delete traversal_cache[c];
+            traversal_cache.erase(traversal_cache.begin() + c);
+            break;
+          }
+        if(traversal_cache.size() == traversal_cache_size)
+        {
+          unsigned int oldest = 0;
+          for (unsigned int c = 1; c < traversal_cache.size(); c++)
+            if(traversal_cache[c]->last_use < traversal_cache[oldest]->last_use)
+              oldest = c;
+          delete traversal_cache[oldest];
+          traversal_cache.erase(traversal_cache.begin() + oldest);
+        }
+        traversal_cache.push_back(traversal);
+      }
+    }
+
+    void Traverse::clear_states_cache()
+    {
+#pragma omp critical (traversal_cache)
+      {
+        for (unsigned int c = 0; c < traversal_cache.size(); c++)
+          delete traversal_cache[c];
+        traversal_cache.clear();
+      }
+    }
+
+    Traverse::State** Traverse::get_states(Hermes::vector<const Mesh*> meshes, int& states_count)
+    {
+      // All the functions on one mesh - no union mesh, no need to cache.
+      if(is_single_mesh(meshes))
+      {
+        this->num = meshes.size();
+        return get_single_mesh_states(meshes[0], states_count);
+      }
+
+      State** cached_states = replay_states(meshes, states_count);
+      if(cached_states != NULL)
+      {
+        this->num = meshes.size();
+        return cached_states;
+      }
+
+      int states_allocated = 512;
+      State** states = (State**)malloc(states_allocated * sizeof(State*));
+      states_count = 0;
+
+      this->begin(meshes.size(), &(meshes.front()));
+
+      State* current_state;
+      while ((current_state = this->get_next_state()) != NULL)
+      {
+        if(states_count == states_allocated)
+        {
+          states_allocated *= 2;
+          states = (State**)realloc(states, states_allocated * sizeof(State*));
+        }
+        states[states_count] = new State();
+        *(states[states_count]) = current_state;
+        states_count++;
+      }
+
+      this->finish();
+
+      store_states(meshes, states, states_count);
+
+      return states;
+    }
+
+    void Traverse::free_states(State** states, int states_count)
+    {
+      for(int i = 0; i < states_count; i++)
+        delete states[i];
+      ::free(states);
+    }
+
+    void Traverse::set_active_state(State* s)
+    {
+      if(fn == NULL)
+        return;
+
+      for (int i = 0; i < num; i++)
+        if(s->e[i] != NULL)
+        {
+          fn[i]->set_active_element(s->e[i]);
+          fn[i]->set_transform(s->sub_idx[i]);
+        }
+    }
+
     void Traverse::begin(int n, const Mesh** meshes, Transformable** fn)
     {
       //if(stack != NULL) finish();
@@ -794,6 +1105,11 @@ namespace Hermes
       this->meshes = meshes;
       this->fn = fn;
 
+      this->single_mesh = true;
+      for (int i = 1; i < n; i++)
+        if(meshes[i] != meshes[0])
+          this->single_mesh = false;
+
       size = 256;
       if(master)
       {
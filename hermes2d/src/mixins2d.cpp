@@ -36,6 +36,55 @@ namespace Hermes
           }
       }
 
+      MemoryAccountable::MemoryAccountable() : memory_reported(0), memory_reported_category(MemoryMeshes), memory_registered(false)
+      {
+      }
+
+      MemoryAccountable::MemoryAccountable(const MemoryAccountable& other) : memory_reported(0), memory_reported_category(MemoryMeshes), memory_registered(false)
+      {
+      }
+
+      MemoryAccountable& MemoryAccountable::operator=(const MemoryAccountable& other)
+      {
+        // The reported usage belongs to this instance, the derived class updates it.
+        return *this;
+      }
+
+      MemoryAccountable::~MemoryAccountable()
+      {
+        if(this->memory_registered)
+        {
+#pragma omp critical (memory_accounting)
+          {
+            Hermes2DMemory.change(this->memory_reported_category, this->memory_reported, 0);
+            Hermes2DMemory.instances[this->memory_reported_category]--;
+          }
+        }
+      }
+
+      void MemoryAccountable::update_memory_usage(bool lazy) const
+      {
+        size_t usage = this->get_memory_usage();
+        if(lazy && this->memory_registered)
+        {
+          size_t difference = usage > this->memory_reported ? usage - this->memory_reported : this->memory_reported - usage;
+          if(difference <= H2D_MEMORY_ACCOUNTING_GRANULARITY)
+            return;
+        }
+        MemoryCategory category = this->get_memory_category();
+#pragma omp critical (memory_accounting)
+        {
+          if(!this->memory_registered)
+          {
+            Hermes2DMemory.instances[category]++;
+            this->memory_registered = true;
+            this->memory_reported_category = category;
+          }
+          Hermes2DMemory.change(this->memory_reported_category, this->memory_reported, usage);
+          this->memory_reported = usage;
+        }
+      }
+
       XMLParsing::XMLParsing() : validate(false)
       {
       }
@@ -112,6 +161,37 @@ namespace Hermes
         this->rhs_number_format = number_format;
       }
 
+      // The file name of the iteration with the extension of the format, binary files are opened in binary mode.
+      static FILE* open_dump_file(const std::string& filename, int iteration, EMatrixDumpFormat format)
+      {
+        std::stringstream name;
+        name << filename << iteration;
+        if(format == Hermes::Algebra::DF_MATLAB_SPARSE)
+          name << ".m";
+        if(format == Hermes::Algebra::DF_HERMES_BIN)
+          name << ".bin";
+        FILE* file = fopen(name.str().c_str(), format == Hermes::Algebra::DF_HERMES_BIN ? "wb" : "w+");
+        if(file == NULL)
+          throw Hermes::Exceptions::Exception("Unable to open the file %s.", name.str().c_str());
+        return file;
+      }
+
+      template<typename Scalar>
+      void MatrixRhsOutput<Scalar>::dump_matrix(SparseMatrix<Scalar>* matrix, int iteration) const
+      {
+        FILE* matrix_file = open_dump_file(this->matrixFilename, iteration, this->matrixFormat);
+        matrix->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
+        fclose(matrix_file);
+      }
+
+      template<typename Scalar>
+      void MatrixRhsOutput<Scalar>::dump_rhs(Vector<Scalar>* rhs, int iteration) const
+      {
+        FILE* rhs_file = open_dump_file(this->RhsFilename, iteration, this->RhsFormat);
+        rhs->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
+        fclose(rhs_file);
+      }
+
       template HERMES_API class SettableSpaces<double>;
       template HERMES_API class SettableSpaces<std::complex<double> >;
       template HERMES_API class MatrixRhsOutput<double>;
@@ -14,6 +14,7 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "neighbor.h"
+#include "mesh/edge_neighbor_table.h"
 #include <algorithm>
 
 namespace Hermes
@@ -157,82 +158,40 @@ namespace Hermes
       reset_neighb_info();
       active_edge = edge;
 
-      //std::cout << std::endl << "central element: " << central_el->id << std::endl;
       if(central_el->en[active_edge]->bnd == 0)
       {
-        neighb_el = central_el->get_neighbor(active_edge);
+        // The neighbors were found for all edges of the mesh at once.
+        const EdgeNeighborTable* table = mesh->get_edge_neighbor_table();
+        int num_neighbors;
+        const EdgeNeighborTable::Neighbor* edge_neighbors = table->get_neighbors(central_el, active_edge, num_neighbors);
+        neighborhood_type = (NeighborhoodType)table->get_neighborhood_type(central_el, active_edge);
 
-        // First case : The neighboring element is of the same size as the central one.
-        if(neighb_el != NULL)
-        {
-          //std::cout << "\t active neighbor el: " << neighb_el->id << std::endl;
-
-          // Get local number of the edge used by the neighbor.
-          for (unsigned int j = 0; j < neighb_el->get_nvert(); j++)
-            if(central_el->en[active_edge] == neighb_el->en[j])
-            {
-              neighbor_edge.local_num_of_edge = j;
-              break;
-            }
-
-            NeighborEdgeInfo local_edge_info;
-            local_edge_info.local_num_of_edge = neighbor_edge.local_num_of_edge;
-
-            // Query the orientation of the neighbor edge relative to the central el.
-            int p1 = central_el->vn[active_edge]->id;
-            int p2 = central_el->vn[(active_edge + 1) % central_el->get_nvert()]->id;
-            local_edge_info.orientation = neighbor_edge_orientation(p1, p2, false);
-
-            neighbor_edges.push_back(local_edge_info);
+        // Transformations are pushed on the central element when going down, on the neighbor when going up.
+        LightArray<Transformations*>& transformations = (neighborhood_type == H2D_DG_GO_DOWN) ? central_transformations : neighbor_transformations;
 
-            // There is only one neighbor in this case.
-            n_neighbors = 1;
-            neighbors.push_back(neighb_el);
-
-            // No need for transformation, since the neighboring element is of the same size.
-            neighborhood_type = H2D_DG_NO_TRANSF;
-        }
-        else
+        for (int i = 0; i < num_neighbors; i++)
         {
-          // Peek the vertex in the middle of the active edge (if there is none, vertex will be NULL).
-          Node* vertex = mesh->peek_vertex_node(central_el->en[active_edge]->p1,  central_el->en[active_edge]->p2);
-
-          // Endpoints of the active edge.
-          int orig_vertex_id[2];
-          orig_vertex_id[0] = central_el->vn[active_edge]->id;
-          orig_vertex_id[1]  = central_el->vn[(active_edge + 1) % central_el->get_nvert()]->id;
-
-          if(vertex == NULL)
-          {
-            neighborhood_type = H2D_DG_GO_UP;
+          neighb_el = edge_neighbors[i].element;
+          neighbor_edge.local_num_of_edge = edge_neighbors[i].local_num_of_edge;
 
-            Element* parent = central_el->parent;
+          NeighborEdgeInfo local_edge_info;
+          local_edge_info.local_num_of_edge = edge_neighbors[i].local_num_of_edge;
+          local_edge_info.orientation = edge_neighbors[i].orientation;
+          neighbor_edges.push_back(local_edge_info);
+          neighbors.push_back(neighb_el);
 
-            // Array of middle-point vertices of the intermediate parent edges that we climb up to the correct parent element.
-            Node** par_mid_vertices = new Node*[Transformations::max_level];
-            // Number of visited intermediate parents.
-            int n_parents = 0;
-
-            for (unsigned int j = 0; j < (unsigned) Transformations::max_level; j++)
-              par_mid_vertices[j] = NULL;
-
-            find_act_elem_up(parent, orig_vertex_id, par_mid_vertices, n_parents);
-
-            delete [] par_mid_vertices;
-          }
-          else
+          if(neighborhood_type != H2D_DG_NO_TRANSF)
           {
-            neighborhood_type = H2D_DG_GO_DOWN;
-
-            int sons[Transformations::max_level]; // array of virtual sons of the central el. visited on the way down to the neighbor
-            int n_sons = 0; // number of used transformations
-
-            // Start the search by going down to the first son.
-            find_act_elem_down( vertex, orig_vertex_id, sons, n_sons + 1);
-
-            //debug_log("number of neighbors on the way down: %d ", n_neighbors);
+            if(!transformations.present(i))
+              transformations.add(new Transformations, i);
+            Transformations* tr = transformations.get(i);
+            const unsigned int* transf = table->get_transformations(&edge_neighbors[i]);
+            for(unsigned int k = 0; k < edge_neighbors[i].num_levels; k++)
+              tr->transf[k] = transf[k];
+            tr->num_levels = edge_neighbors[i].num_levels;
           }
         }
+        n_neighbors = num_neighbors;
       }
       else
         if(!ignore_errors)
@@ -595,224 +554,6 @@ namespace Hermes
       n_neighbors--;
     }
 
-    template<typename Scalar>
-    void NeighborSearch<Scalar>::find_act_elem_up( Element* elem, int* orig_vertex_id, Node** par_mid_vertices, int n_parents)
-    {
-      Node* edge = NULL;
-      Node* vertex = NULL;
-
-      assert(n_parents <= (int)Transformations::max_level);
-
-      // IDs of vertices bounding the current intermediate parent edge.
-      int p1 = elem->vn[active_edge]->id;
-      int p2 = elem->vn[(active_edge + 1) % elem->get_nvert()]->id;
-
-      int id_of_par_orient_1 = p1;
-      int id_of_par_orient_2 = p2;
-
-      // Find if p1 and p2 bound a used edge (used by the neighbor element).
-      edge = mesh->peek_edge_node(p1, p2);
-
-      // Add the vertex in the middle of the parent edge to the array of intermediate parent vertices. This is for
-      // consequent transformation of functions on neighbor element.
-      vertex = mesh->peek_vertex_node(p1, p2);
-      if(vertex != NULL)
-      {
-        if(n_parents == 0)
-          par_mid_vertices[n_parents++] = vertex;
-        else
-          if(n_parents == Transformations::max_level - 1)
-            throw Hermes::Exceptions::Exception("Maximum number of intermediate parents exceeded in NeighborSearch<Scalar>::finding_act_elem_up");
-          else
-            if(par_mid_vertices[n_parents - 1]->id != vertex->id)
-              par_mid_vertices[n_parents++] = vertex;
-      }
-
-      if((edge == NULL) || (central_el->en[active_edge]->id == edge->id))
-      {
-        // We have not yet found the parent of the central element completely adjacent to the neighbor.
-        find_act_elem_up(elem->parent, orig_vertex_id, par_mid_vertices, n_parents);
-      }
-      else
-      {
-        for (int i = 0; i < 2; i++)
-        {
-          // Get a pointer to the active neighbor element.
-          if((edge->elem[i] != NULL) && (edge->elem[i]->active == 1))
-          {
-            neighb_el = edge->elem[i];  //debug_log("way up neighbor: %d", neighb_el->id);
-
-            // Get local number of the edge used by the neighbor.
-            neighbor_edge.local_num_of_edge = -1;
-            for(unsigned int j = 0; j < neighb_el->get_nvert(); j++)
-              if(neighb_el->en[j] == edge)
-              {
-                neighbor_edge.local_num_of_edge = j;
-                break;
-              }
-              if(neighbor_edge.local_num_of_edge == -1) throw Hermes::Exceptions::Exception("Neighbor edge wasn't found");
-
-              Node* n = NULL;
-
-              // Add to the array of neighbor_transformations one that transforms central el. to its parent completely
-              // adjacent to the single big neighbor.
-              assert(n_neighbors == 0);
-
-              neighbor_transformations.add(new Transformations, n_neighbors);
-              Transformations *neighbor_transforms = neighbor_transformations.get(n_neighbors);
-
-              neighbor_transforms->num_levels = n_parents;
-
-              // Go back through the intermediate inactive parents down to the central element and stack corresponding
-              // neighbor_transformations into the array 'neighbor_transformations'.
-              for(int j = n_parents - 1; j > 0; j-- )
-              {
-                n = mesh->peek_vertex_node(par_mid_vertices[j]->id, p1);
-                if(n == NULL)
-                {
-                  neighbor_transforms->transf[n_parents - j - 1] = neighbor_edge.local_num_of_edge;
-                  p1 = par_mid_vertices[j]->id;
-                }
-                else
-                {
-                  if(n->id == par_mid_vertices[j-1]->id)
-                  {
-                    neighbor_transforms->transf[n_parents - j - 1] = (neighbor_edge.local_num_of_edge + 1) % neighb_el->get_nvert();
-                    p2 = par_mid_vertices[j]->id;
-                  }
-                  else
-                  {
-                    neighbor_transforms->transf[n_parents - j - 1] = neighbor_edge.local_num_of_edge;
-                    p1 = par_mid_vertices[j]->id;
-                  }
-                }
-              }
-
-              // Final transformation to the central element itself.
-              if(orig_vertex_id[0] == par_mid_vertices[0]->id)
-                neighbor_transforms->transf[n_parents - 1] = neighbor_edge.local_num_of_edge;
-              else
-                neighbor_transforms->transf[n_parents - 1] = (neighbor_edge.local_num_of_edge + 1) % neighb_el->get_nvert();
-
-              NeighborEdgeInfo local_edge_info;
-              local_edge_info.local_num_of_edge = neighbor_edge.local_num_of_edge;
-
-              // Query the orientation of the neighbor edge relative to the central el.
-              local_edge_info.orientation = neighbor_edge_orientation(id_of_par_orient_1, id_of_par_orient_2, false);
-
-              neighbor_edges.push_back(local_edge_info);
-
-              // There is only one neighbor, ...
-              n_neighbors = 1;
-
-              // ...add it to the vector of neighbors.
-              neighbors.push_back(neighb_el);
-          }
-        }
-      }
-    }
-
-    template<typename Scalar>
-    void NeighborSearch<Scalar>::find_act_elem_down( Node* vertex, int* bounding_verts_id, int* sons, unsigned int n_sons)
-    {
-      int mid_vert = vertex->id; // ID of vertex in between vertices from par_vertex_id.
-      int bnd_verts[2];
-      bnd_verts[0] = bounding_verts_id[0];
-      bnd_verts[1] = bounding_verts_id[1];
-
-      assert(n_sons < (unsigned) Transformations::max_level);
-
-      for (int i = 0; i < 2; i++)
-      {
-        sons[n_sons-1] = (active_edge + i) % central_el->get_nvert();
-
-        // Try to get a pointer to the edge between the middle vertex and one of the vertices bounding the previously
-        // tested segment.
-        Node* edge = mesh->peek_edge_node(mid_vert, bnd_verts[i]);
-
-        if(edge == NULL) // The edge is not used, i.e. there is no active element on either side.
-        {
-          // Get the middle vertex of this edge and try again on the segments into which this vertex splits the edge.
-          Node * n = mesh->peek_vertex_node(mid_vert, bnd_verts[i]);
-          if(n == NULL)
-            throw Hermes::Exceptions::Exception("wasn't able to find middle vertex");
-          else
-          {
-            // Make sure the next visited segment has the same orientation as the original central element's active edge.
-            if(i == 0)
-              bounding_verts_id[1] = mid_vert;
-            else
-              bounding_verts_id[0] = mid_vert;
-
-            find_act_elem_down( n, bounding_verts_id, sons, n_sons + 1);
-
-            bounding_verts_id[0] = bnd_verts[0];
-            bounding_verts_id[1] = bnd_verts[1];
-          }
-        }
-        else  // We have found a used edge, the active neighbor we are looking for is on one of its sides.
-        {
-          for (int j = 0; j < 2; j++)
-          {
-            if((edge->elem[j] != NULL) && (edge->elem[j]->active == 1))
-            {
-              neighb_el = mesh->get_element(edge->elem[j]->id);  //debug_log("way down neighbor: %d", edge->elem[j]->id);
-
-              // Get local number of the edge used by the neighbor.
-              neighbor_edge.local_num_of_edge = -1;
-              for(unsigned int k = 0; k < neighb_el->get_nvert(); k++)
-                if(neighb_el->en[k] == edge)
-                {
-                  neighbor_edge.local_num_of_edge = k;
-                  break;
-                }
-
-                if(neighbor_edge.local_num_of_edge == -1) throw Hermes::Exceptions::Exception("Neighbor edge wasn't found");
-
-                //assert(!central_transformations.present(n_neighbors));
-
-                central_transformations.add(new Transformations, n_neighbors);
-                Transformations *tr = central_transformations.get(n_neighbors);
-
-                // Construct the transformation path to the current neighbor.
-                for(unsigned int k = 0; k < n_sons; k++)
-                  tr->transf[k] = sons[k];
-                tr->num_levels = n_sons;
-
-                NeighborEdgeInfo local_edge_info;
-                local_edge_info.local_num_of_edge = neighbor_edge.local_num_of_edge;
-                // Query the orientation of the neighbor edge relative to the central el.
-                local_edge_info.orientation = neighbor_edge_orientation(bnd_verts[0], bnd_verts[1], i);
-
-                neighbor_edges.push_back(local_edge_info);
-
-                // Append the new neighbor.
-                n_neighbors++;
-                neighbors.push_back(neighb_el);
-            }
-          }
-        }
-      }
-    }
-
-    template<typename Scalar>
-    bool NeighborSearch<Scalar>::neighbor_edge_orientation(int bounding_vert1, int bounding_vert2, int segment) const
-    {
-      if(segment == 0)
-      {
-        // neighbor edge goes from parent1 to middle vertex
-        if(neighb_el->vn[neighbor_edge.local_num_of_edge]->id != bounding_vert1)
-          return true; // orientation reversed
-      }
-      else
-      {
-        // neighbor edge goes from middle vertex to parent2
-        if(neighb_el->vn[neighbor_edge.local_num_of_edge]->id == bounding_vert2)
-          return true; // orientation reversed
-      }
-      return false;
-    }
-
     template<typename Scalar>
     NeighborSearch<Scalar>::ExtendedShapeset::ExtendedShapeset(const ExtendedShapeset & other)
     {
@@ -19,34 +19,121 @@
 #include "newton_solver.h"
 #include "projections/ogprojection.h"
 #include "hermes_common.h"
+#include <limits>
 
 namespace Hermes
 {
   namespace Hermes2D
   {
+    // J v of the Jacobian-free mode by the forward difference of the residual at u:
+    // J v = (F(u + eps v) - F(u)) / eps, eps = sqrt(machine eps * (1 + ||u||)) / ||v||.
     template<typename Scalar>
-    NewtonSolver<Scalar>::NewtonSolver() : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>()), own_dp(true), kept_jacobian(NULL)
+    class JacobianFreeOperator : public Hermes::Solvers::LinearOperator<Scalar>
+    {
+    public:
+      JacobianFreeOperator(DiscreteProblemInterface<Scalar>* dp, int ndof, Scalar* u, Scalar* minus_F)
+        : dp(dp), ndof(ndof), u(u), minus_F(minus_F), num_applications(0)
+      {
+        this->u_norm = Hermes::Algebra::VectorKernels::nrm2(ndof, u);
+        this->u_perturbed = new Scalar[ndof];
+        this->F_perturbed = new Scalar[ndof];
+        this->residual_perturbed = create_vector<Scalar>();
+      }
+
+      virtual ~JacobianFreeOperator()
+      {
+        delete [] this->u_perturbed;
+        delete [] this->F_perturbed;
+        delete this->residual_perturbed;
+      }
+
+      virtual void apply(Scalar *x, Scalar *y)
+      {
+        double x_norm = Hermes::Algebra::VectorKernels::nrm2(ndof, x);
+        if(x_norm == 0.0)
+        {
+          Hermes::Algebra::VectorKernels::zero(ndof, y);
+          return;
+        }
+        double eps = std::sqrt(std::numeric_limits<double>::epsilon() * (1.0 + this->u_norm)) / x_norm;
+
+        Hermes::Algebra::VectorKernels::copy(ndof, u, this->u_perturbed);
+        Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(eps), x, this->u_perturbed);
+        this->dp->assemble(this->u_perturbed, this->residual_perturbed);
+        this->residual_perturbed->extract(this->F_perturbed);
+        this->num_applications++;
+
+        // y = (F_perturbed + minus_F) / eps.
+        Hermes::Algebra::VectorKernels::copy(ndof, this->F_perturbed, y);
+        Hermes::Algebra::VectorKernels::axpby(ndof, Scalar(1.0 / eps), this->minus_F, Scalar(1.0 / eps), y);
+      }
+
+      /// Number of the residual assemblies.
+      int num_applications;
+
+    protected:
+      DiscreteProblemInterface<Scalar>* dp;
+      int ndof;
+      Scalar* u;
+      Scalar* minus_F;
+      double u_norm;
+      Scalar* u_perturbed;
+      Scalar* F_perturbed;
+      Vector<Scalar>* residual_perturbed;
+    };
+
+    // z = J_kept^{-1} r by the (once factorized) linear solver of the kept Jacobian.
+    template<typename Scalar>
+    class LaggedJacobianPreconditioner : public Hermes::Solvers::LinearOperator<Scalar>
+    {
+    public:
+      LaggedJacobianPreconditioner(Hermes::Solvers::LinearMatrixSolver<Scalar>* solver, Vector<Scalar>* rhs, int ndof)
+        : solver(solver), rhs(rhs), ndof(ndof)
+      {
+      }
+
+      virtual void apply(Scalar *r, Scalar *z)
+      {
+        this->rhs->zero();
+        this->rhs->add_vector(r);
+        if(!this->solver->solve())
+          throw Exceptions::LinearMatrixSolverException();
+        Hermes::Algebra::VectorKernels::copy(ndof, this->solver->get_sln_vector(), z);
+      }
+
+    protected:
+      Hermes::Solvers::LinearMatrixSolver<Scalar>* solver;
+      Vector<Scalar>* rhs;
+      int ndof;
+    };
+
+    template<typename Scalar>
+    NewtonSolver<Scalar>::NewtonSolver() : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>()), own_dp(true), kept_jacobian(NULL),
+      jacobian_free_solver(NULL), jacobian_free_rhs(NULL)
     {
       init_attributes();
       init_linear_solver();
     }
 
     template<typename Scalar>
-    NewtonSolver<Scalar>::NewtonSolver(DiscreteProblem<Scalar>* dp) : NonlinearSolver<Scalar>(dp), own_dp(false), kept_jacobian(NULL)
+    NewtonSolver<Scalar>::NewtonSolver(DiscreteProblem<Scalar>* dp) : NonlinearSolver<Scalar>(dp), own_dp(false), kept_jacobian(NULL),
+      jacobian_free_solver(NULL), jacobian_free_rhs(NULL)
     {
       init_attributes();
       init_linear_solver();
     }
 
     template<typename Scalar>
-    NewtonSolver<Scalar>::NewtonSolver(const WeakForm<Scalar>* wf, const Space<Scalar>* space) : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>(wf, space)), own_dp(true), kept_jacobian(NULL)
+    NewtonSolver<Scalar>::NewtonSolver(const WeakForm<Scalar>* wf, const Space<Scalar>* space) : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>(wf, space)), own_dp(true), kept_jacobian(NULL),
+      jacobian_free_solver(NULL), jacobian_free_rhs(NULL)
     {
       init_attributes();
       init_linear_solver();
     }
 
     template<typename Scalar>
-    NewtonSolver<Scalar>::NewtonSolver(const WeakForm<Scalar>* wf, Hermes::vector<const Space<Scalar> *> spaces) : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>(wf, spaces)), own_dp(true), kept_jacobian(NULL)
+    NewtonSolver<Scalar>::NewtonSolver(const WeakForm<Scalar>* wf, Hermes::vector<const Space<Scalar> *> spaces) : NonlinearSolver<Scalar>(new DiscreteProblem<Scalar>(wf, spaces)), own_dp(true), kept_jacobian(NULL),
+      jacobian_free_solver(NULL), jacobian_free_rhs(NULL)
     {
       init_attributes();
       init_linear_solver();
@@ -76,6 +163,48 @@ namespace Hermes
       this->initial_auto_damping_ratio = 1.0;
       this->sufficient_improvement_factor = 0.95;
       this->necessary_successful_steps_to_increase = 1;
+      this->jacobian_with_residual = false;
+      this->jacobian_free = false;
+      this->jacobian_free_lagged_jacobian = false;
+      this->jacobian_free_tolerance = 1e-4;
+      this->jacobian_free_max_iters = 100;
+      this->jacobian_update_policy = NULL;
+      this->inexact_newton = false;
+      this->max_forcing_term = 0.9;
+      this->initial_forcing_term = 0.5;
+      this->forcing_term = 0.5;
+      this->forcing_term_residual_norm = 0.0;
+      this->history_size = 0;
+      this->coeff_vec_back = NULL;
+      this->work_vectors_size = -1;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::init_work_vectors(int ndof, Scalar* coeff_vec)
+    {
+      if(this->work_vectors_size != ndof)
+      {
+        if(coeff_vec != NULL && coeff_vec == this->sln_vector)
+          throw Exceptions::Exception("The solution vector of a different number of DOFs passed as the initial guess to NewtonSolver.");
+        delete [] this->sln_vector;
+        delete [] this->coeff_vec_back;
+        this->sln_vector = new Scalar[ndof];
+        this->coeff_vec_back = new Scalar[ndof];
+        this->work_vectors_size = ndof;
+      }
+      if(coeff_vec == NULL)
+        Hermes::Algebra::VectorKernels::zero(ndof, this->sln_vector);
+      else if(coeff_vec != this->sln_vector)
+        Hermes::Algebra::VectorKernels::copy(ndof, coeff_vec, this->sln_vector);
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::finish_work_vectors(Scalar* coeff_vec, Scalar* coeff_vec_back, Scalar* caller_coeff_vec, int ndof)
+    {
+      this->sln_vector = coeff_vec;
+      this->coeff_vec_back = coeff_vec_back;
+      if(caller_coeff_vec != NULL)
+        Hermes::Algebra::VectorKernels::copy(ndof, coeff_vec, caller_coeff_vec);
     }
 
     template<typename Scalar>
@@ -84,6 +213,170 @@ namespace Hermes
       this->newton_tol = newton_tol;
     }
 
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_jacobian_with_residual(bool onOff)
+    {
+      this->jacobian_with_residual = onOff;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_jacobian_free(bool to_set, bool lagged_jacobian_preconditioner)
+    {
+      this->jacobian_free = to_set;
+      this->jacobian_free_lagged_jacobian = to_set && lagged_jacobian_preconditioner;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_jacobian_free_linear_tolerance(double tolerance, int max_iterations)
+    {
+      if(tolerance <= 0.0)
+        throw Exceptions::ValueException("tolerance", tolerance, 0.0);
+      if(max_iterations < 1)
+        throw Exceptions::ValueException("max_iterations", max_iterations, 1);
+      this->jacobian_free_tolerance = tolerance;
+      this->jacobian_free_max_iters = max_iterations;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_initial_guess_extrapolation(int history_size)
+    {
+      if(history_size < 0)
+        throw Exceptions::ValueException("history_size", history_size, 0.0);
+      this->history_size = history_size;
+      while((int)this->history_vectors.size() > history_size)
+      {
+        delete [] this->history_vectors.front();
+        this->history_vectors.erase(this->history_vectors.begin());
+        this->history_times.erase(this->history_times.begin());
+      }
+    }
+
+    template<typename Scalar>
+    bool NewtonSolver<Scalar>::history_valid(int ndof) const
+    {
+      Hermes::vector<const Space<Scalar>*> spaces = static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces();
+      if(spaces.size() != this->history_spaces.size() || Space<Scalar>::get_num_dofs(spaces) != ndof)
+        return false;
+      for(unsigned int i = 0; i < spaces.size(); i++)
+        if(spaces[i] != this->history_spaces[i].first || spaces[i]->get_seq() != this->history_spaces[i].second)
+          return false;
+      return true;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::clear_history()
+    {
+      for(unsigned int i = 0; i < this->history_vectors.size(); i++)
+        delete [] this->history_vectors[i];
+      this->history_vectors.clear();
+      this->history_times.clear();
+      this->history_spaces.clear();
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::extrapolate_initial_guess(Scalar* coeff_vec, int ndof)
+    {
+      if(this->history_size < 2 || this->history_vectors.size() < 2 || !this->history_valid(ndof))
+        return;
+      double time = static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_weak_formulation()->get_current_time();
+      if(time <= this->history_times.back())
+        return;
+
+      // The Lagrange basis polynomials of the history times at the current time.
+      int count = this->history_vectors.size();
+      Hermes::Algebra::VectorKernels::zero(ndof, coeff_vec);
+      for(int i = 0; i < count; i++)
+      {
+        double weight = 1.0;
+        for(int j = 0; j < count; j++)
+          if(j != i)
+            weight *= (time - this->history_times[j]) / (this->history_times[i] - this->history_times[j]);
+        Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(weight), this->history_vectors[i], coeff_vec);
+      }
+      this->info("\tNewton: initial guess extrapolated from %d previous solutions.", count);
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::add_to_history(Scalar* sln_vector, int ndof)
+    {
+      if(this->history_size == 0)
+        return;
+      if(!this->history_valid(ndof))
+      {
+        this->clear_history();
+        Hermes::vector<const Space<Scalar>*> spaces = static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces();
+        for(unsigned int i = 0; i < spaces.size(); i++)
+          this->history_spaces.push_back(std::make_pair(spaces[i], spaces[i]->get_seq()));
+      }
+
+      // A step repeated from an earlier time replaces the solutions after it.
+      double time = static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_weak_formulation()->get_current_time();
+      while(!this->history_times.empty() && this->history_times.back() >= time)
+      {
+        delete [] this->history_vectors.back();
+        this->history_vectors.pop_back();
+        this->history_times.pop_back();
+      }
+
+      Scalar* history_vector = new Scalar[ndof];
+      Hermes::Algebra::VectorKernels::copy(ndof, sln_vector, history_vector);
+      this->history_vectors.push_back(history_vector);
+      this->history_times.push_back(time);
+      if((int)this->history_vectors.size() > this->history_size)
+      {
+        delete [] this->history_vectors.front();
+        this->history_vectors.erase(this->history_vectors.begin());
+        this->history_times.erase(this->history_times.begin());
+      }
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_jacobian_update_policy(JacobianUpdatePolicy* policy)
+    {
+      this->jacobian_update_policy = policy;
+      if(policy == NULL)
+        linear_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::set_inexact_newton(bool to_set, double max_forcing_term, double initial_forcing_term)
+    {
+      if(max_forcing_term <= 0.0 || max_forcing_term >= 1.0)
+        throw Exceptions::ValueException("max_forcing_term", max_forcing_term, 0.0, 1.0);
+      if(initial_forcing_term <= 0.0 || initial_forcing_term > max_forcing_term)
+        throw Exceptions::ValueException("initial_forcing_term", initial_forcing_term, 0.0, max_forcing_term);
+      this->inexact_newton = to_set;
+      this->max_forcing_term = max_forcing_term;
+      this->initial_forcing_term = initial_forcing_term;
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::update_forcing_term(double residual_norm, int it)
+    {
+      const double gamma = 0.9;
+      if(it == 1 || this->forcing_term_residual_norm == 0.0)
+        this->forcing_term = this->initial_forcing_term;
+      else
+      {
+        double ratio = residual_norm / this->forcing_term_residual_norm;
+        double eta = gamma * ratio * ratio;
+        // Safeguard against a too fast decrease.
+        double eta_safeguard = gamma * this->forcing_term * this->forcing_term;
+        if(eta_safeguard > 0.1)
+          eta = std::max(eta, eta_safeguard);
+        // No oversolving close to the Newton tolerance.
+        if(residual_norm > 0.0)
+          eta = std::max(eta, 0.5 * this->newton_tol / residual_norm);
+        this->forcing_term = std::min(eta, this->max_forcing_term);
+      }
+      this->forcing_term_residual_norm = residual_norm;
+
+      Hermes::Solvers::IterSolver<Scalar>* iter_solver = dynamic_cast<Hermes::Solvers::IterSolver<Scalar>*>(linear_solver);
+      if(iter_solver != NULL)
+        iter_solver->set_tolerance(this->forcing_term);
+      this->info("\tNewton: linear tolerance (forcing term): %g.", this->forcing_term);
+    }
+
     template<typename Scalar>
     void NewtonSolver<Scalar>::set_weak_formulation(const WeakForm<Scalar>* wf)
     {
@@ -170,11 +463,24 @@ namespace Hermes
       linear_solver = create_linear_solver<Scalar>(jacobian, residual);
     }
 
+    template<typename Scalar>
+    size_t NewtonSolver<Scalar>::get_memory_usage() const
+    {
+      return get_matrix_memory_usage(this->jacobian) + get_vector_memory_usage(this->residual)
+        + get_matrix_memory_usage(this->kept_jacobian) + get_vector_memory_usage(this->jacobian_free_rhs);
+    }
+
     template<typename Scalar>
     NewtonSolver<Scalar>::~NewtonSolver()
     {
       if(kept_jacobian != NULL)
         delete kept_jacobian;
+      if(jacobian_free_solver != NULL)
+        delete jacobian_free_solver;
+      if(jacobian_free_rhs != NULL)
+        delete jacobian_free_rhs;
+      this->clear_history();
+      delete [] this->coeff_vec_back;
       delete jacobian;
       delete residual;
       delete linear_solver;
@@ -250,11 +556,12 @@ namespace Hermes
     template<typename Scalar>
     void NewtonSolver<Scalar>::solve(Hermes::vector<Solution<Scalar>*> initial_guess)
     {
+      // Projected right into the work vector.
       int ndof = this->dp->get_num_dofs();
-      Scalar* coeff_vec = new Scalar[ndof];
+      this->init_work_vectors(ndof, NULL);
       OGProjection<Scalar> ogProjection;
-      ogProjection.project_global(static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces(), initial_guess, coeff_vec);
-      this->solve(coeff_vec);
+      ogProjection.project_global(static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces(), initial_guess, this->sln_vector);
+      this->solve(this->sln_vector);
     }
 
     template<typename Scalar>
@@ -267,25 +574,12 @@ namespace Hermes
       // Obtain the number of degrees of freedom.
       int ndof = this->dp->get_num_dofs();
 
-      // If coeff_vec == NULL then create a zero vector.
-      bool delete_coeff_vec = false;
-      if(coeff_vec == NULL)
-      {
-        coeff_vec = new Scalar[ndof];
-        memset(coeff_vec, 0, ndof*sizeof(Scalar));
-        delete_coeff_vec = true;
-      }
-
-      // Vector for restarting steps.
-      Scalar* coeff_vec_back = new Scalar[ndof];
-      memset(coeff_vec_back, 0, ndof*sizeof(Scalar));
-
-      // Delete the old solution vector, if there is any.
-      if(this->sln_vector != NULL)
-      {
-        delete [] this->sln_vector;
-        this->sln_vector = NULL;
-      }
+      // The iterate and the vector for restarting steps, swapped during the iterations.
+      Scalar* caller_coeff_vec = (coeff_vec == this->sln_vector) ? NULL : coeff_vec;
+      this->init_work_vectors(ndof, coeff_vec);
+      coeff_vec = this->sln_vector;
+      Scalar* coeff_vec_back = this->coeff_vec_back;
+      this->extrapolate_initial_guess(coeff_vec, ndof);
 
       // The Newton's loop.
       double residual_norm;
@@ -299,20 +593,14 @@ namespace Hermes
       {
         this->on_step_begin();
 
-        // Assemble just the residual vector.
-        this->dp->assemble(coeff_vec, residual);
+        // Assemble the residual vector (and the jacobian in the same pass, if requested).
+        if(this->jacobian_with_residual && !this->jacobian_free && this->jacobian_update_policy == NULL)
+          this->dp->assemble(coeff_vec, jacobian, residual);
+        else
+          this->dp->assemble(coeff_vec, residual);
+        this->update_memory_usage();
         if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
-        {
-          char* fileName = new char[this->RhsFilename.length() + 5];
-          if(this->RhsFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->RhsFilename.c_str(), it);
-          else
-            sprintf(fileName, "%s%i", this->RhsFilename.c_str(), it);
-          FILE* rhs_file = fopen(fileName, "w+");
-          residual->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
-          fclose(rhs_file);
-          delete [] fileName;
-        }
+          this->dump_rhs(residual, it);
         
         Element* e;
         for(unsigned int i = 0; i < static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces().size(); i++)
@@ -374,13 +662,7 @@ namespace Hermes
               {
                 this->warn("\t Newton: results NOT improved, current damping coefficient is at the minimum possible level: %g.", min_allowed_damping_coeff);
                 this->info("\t  If you want to decrease the minimum level, use the method set_min_allowed_damping_coeff()");
-                if(delete_coeff_vec)
-                {
-                  delete [] coeff_vec;
-                  coeff_vec = NULL;
-                }
-
-                delete [] coeff_vec_back;
+                this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
 
                 throw Exceptions::Exception("Newton NOT converged because of damping coefficient could not be decreased anymore to possibly handle non-converging process.");
               }
@@ -400,13 +682,7 @@ namespace Hermes
           this->info("\tNewton: solution duration: %f s.\n", this->last());
           this->on_finish();
           
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
           
           throw Exceptions::ValueException("residual norm", residual_norm, max_allowed_residual_norm);
         }
@@ -415,18 +691,8 @@ namespace Hermes
         // This is the only correct way of ending.
         if(residual_norm < newton_tol && it > 1)
         {
-          // We want to return the solution in a different structure.
-          this->sln_vector = new Scalar[ndof];
-          for (int i = 0; i < ndof; i++)
-            this->sln_vector[i] = coeff_vec[i];
-
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
+          this->add_to_history(this->sln_vector, ndof);
 
           this->on_finish();
 
@@ -436,20 +702,33 @@ namespace Hermes
           return;
         }
 
-        // Assemble just the jacobian.
-        this->dp->assemble(coeff_vec, jacobian);
-        if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
+        // Assemble just the jacobian (unless it has been assembled together with the residual).
+        // The Jacobian-free mode assembles (once) only the one of the preconditioner.
+        if(this->jacobian_free)
         {
-          char* fileName = new char[this->matrixFilename.length() + 5];
-          if(this->matrixFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->matrixFilename.c_str(), it);
-          else
-            sprintf(fileName, "%s%i", this->matrixFilename.c_str(), it);
-          FILE* matrix_file = fopen(fileName, "w+");
-
-          jacobian->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
-          fclose(matrix_file);
-          delete [] fileName;
+          if(this->jacobian_free_lagged_jacobian)
+            this->assemble_kept_jacobian(coeff_vec, it);
+        }
+        else
+        {
+          // Or keep the last one (and its factorization) if the policy allows.
+          bool reassemble_jacobian = true;
+          if(this->jacobian_update_policy != NULL)
+          {
+            if(!static_cast<DiscreteProblem<Scalar>*>(this->dp)->is_up_to_date())
+              this->jacobian_update_policy->reset();
+            double time_step = static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_weak_formulation()->get_current_time_step();
+            reassemble_jacobian = this->jacobian_update_policy->reassemble_jacobian(residual_norm, it == 1 ? 0.0 : last_residual_norm, time_step);
+            linear_solver->set_factorization_scheme(reassemble_jacobian ? HERMES_FACTORIZE_FROM_SCRATCH : HERMES_REUSE_FACTORIZATION_COMPLETELY);
+          }
+          if(reassemble_jacobian)
+          {
+            if(!this->jacobian_with_residual || this->jacobian_update_policy != NULL)
+              this->dp->assemble(coeff_vec, jacobian);
+            this->update_memory_usage();
+            if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
+              this->dump_matrix(jacobian, it);
+          }
         }
 
         this->on_step_end();
@@ -458,40 +737,38 @@ namespace Hermes
         // equation reads J(Y^n) \deltaY^{n + 1} = -F(Y^n).
         residual->change_sign();
 
+        if(this->inexact_newton)
+          this->update_forcing_term(residual_norm, it);
+
         // Solve the linear system.
-        if(!linear_solver->solve())
-          throw Exceptions::LinearMatrixSolverException();
+        Scalar* step;
+        if(this->jacobian_free)
+          step = this->solve_jacobian_free(coeff_vec, it);
+        else
+        {
+          if(!linear_solver->solve())
+            throw Exceptions::LinearMatrixSolverException();
+          step = linear_solver->get_sln_vector();
+        }
 
         // Add \deltaY^{n + 1} to Y^n.
         // The good case.
         if(residual_norm < last_residual_norm * this->sufficient_improvement_factor || this->manual_damping || it == 1)
         {
-          memcpy(coeff_vec_back, coeff_vec, sizeof(Scalar)*ndof);
-          for (int i = 0; i < ndof; i++)
-            coeff_vec[i] += currentDampingCofficient * linear_solver->get_sln_vector()[i];
+          // The new iterate is written to the backup vector, which is then swapped with the current one.
+          Hermes::Algebra::VectorKernels::waxpy(ndof, Scalar(currentDampingCofficient), step, coeff_vec, coeff_vec_back);
+          std::swap(coeff_vec, coeff_vec_back);
         }
         else
         {
-          for (int i = 0; i < ndof; i++)
-            coeff_vec[i] = coeff_vec_back[i] + currentDampingCofficient * (coeff_vec[i] - coeff_vec_back[i]);
+          // coeff_vec = coeff_vec_back + damping * (coeff_vec - coeff_vec_back).
+          Hermes::Algebra::VectorKernels::axpby(ndof, Scalar(1.0 - currentDampingCofficient), coeff_vec_back, Scalar(currentDampingCofficient), coeff_vec);
         }
 
         // Increase the number of iterations and test if we are still under the limit.
         if(it++ >= newton_max_iter)
         {
-          // We want to return the solution in a different structure.
-          this->sln_vector = new Scalar[ndof];
-          for (int i = 0; i < ndof; i++)
-            this->sln_vector[i] = coeff_vec[i];
-
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
-          coeff_vec_back = NULL;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
 
           this->tick();
           this->info("\tNewton: solution duration: %f s.\n", this->last());
@@ -513,11 +790,12 @@ namespace Hermes
     template<typename Scalar>
     void NewtonSolver<Scalar>::solve_keep_jacobian(Hermes::vector<Solution<Scalar>*> initial_guess)
     {
+      // Projected right into the work vector.
       int ndof = this->dp->get_num_dofs();
-      Scalar* coeff_vec = new Scalar[ndof];
+      this->init_work_vectors(ndof, NULL);
       OGProjection<Scalar> ogProjection;
-      ogProjection.project_global(static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces(), initial_guess, coeff_vec);
-      this->solve_keep_jacobian(coeff_vec);
+      ogProjection.project_global(static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces(), initial_guess, this->sln_vector);
+      this->solve_keep_jacobian(this->sln_vector);
     }
 
     template<typename Scalar>
@@ -530,18 +808,12 @@ namespace Hermes
       // Obtain the number of degrees of freedom.
       int ndof = this->dp->get_num_dofs();
 
-      // If coeff_vec == NULL then create a zero vector.
-      bool delete_coeff_vec = false;
-      if(coeff_vec == NULL)
-      {
-        coeff_vec = new Scalar[ndof];
-        memset(coeff_vec, 0, ndof*sizeof(Scalar));
-        delete_coeff_vec = true;
-      }
-
-      // Vector for restarting steps.
-      Scalar* coeff_vec_back = new Scalar[ndof];
-      memset(coeff_vec_back, 0, ndof*sizeof(Scalar));
+      // The iterate and the vector for restarting steps, swapped during the iterations.
+      Scalar* caller_coeff_vec = (coeff_vec == this->sln_vector) ? NULL : coeff_vec;
+      this->init_work_vectors(ndof, coeff_vec);
+      coeff_vec = this->sln_vector;
+      Scalar* coeff_vec_back = this->coeff_vec_back;
+      this->extrapolate_initial_guess(coeff_vec, ndof);
 
       
       // The Newton's loop.
@@ -559,16 +831,7 @@ namespace Hermes
         // Assemble the residual vector.
         this->dp->assemble(coeff_vec, residual);
         if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
-        {
-          char* fileName = new char[this->RhsFilename.length() + 5];
-          if(this->RhsFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->RhsFilename.c_str(), it);
-          else
-            sprintf(fileName, "%s%i", this->RhsFilename.c_str(), it);
-          FILE* rhs_file = fopen(fileName, "w+");
-          residual->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
-          fclose(rhs_file);
-        }
+          this->dump_rhs(residual, it);
 
         Element* e;
         for(unsigned int i = 0; i < static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces().size(); i++)
@@ -630,13 +893,7 @@ namespace Hermes
                 this->warn("\t Newton: results NOT improved, current damping coefficient is at the minimum possible level: %g.", min_allowed_damping_coeff);
                 this->info("\t  If you want to decrease the minimum level, use the method set_min_allowed_damping_coeff()");
                 
-                if(delete_coeff_vec)
-                {
-                  delete [] coeff_vec;
-                  coeff_vec = NULL;
-                }
-
-                delete [] coeff_vec_back;
+                this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
           
                 throw Exceptions::Exception("Newton NOT converged because of damping coefficient could not be decreased anymore to possibly handle non-converging process.");
               }
@@ -655,13 +912,7 @@ namespace Hermes
           this->tick();
           this->info("\tNewton: solution duration: %f s.", this->last());
 
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
 
           this->on_finish();
 
@@ -672,18 +923,8 @@ namespace Hermes
         // This is the only correct way of ending.
         if(residual_norm < newton_tol && it > 1) 
         {
-          // We want to return the solution in a different structure.
-          this->sln_vector = new Scalar[ndof];
-          for (int i = 0; i < ndof; i++)
-            this->sln_vector[i] = coeff_vec[i];
-
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
+          this->add_to_history(this->sln_vector, ndof);
 
           this->tick();
           this->info("\tNewton: solution duration: %f s.", this->last());
@@ -693,39 +934,7 @@ namespace Hermes
         }
 
         // Assemble and keep the jacobian if this has not been done before.
-        // Also declare that LU-factorization in case of a direct solver will be done only once and reused afterwards.
-        if(kept_jacobian == NULL || !(static_cast<DiscreteProblem<Scalar>*>(this->dp))->have_matrix) 
-        {
-          if(kept_jacobian != NULL)
-            delete kept_jacobian;
-
-          kept_jacobian = create_matrix<Scalar>();
-
-          // Give the matrix solver the correct Jacobian. NOTE: It would be cleaner if the whole decision whether to keep
-          // Jacobian or not was made in the constructor.
-          //
-          // Delete the matrix solver created in the constructor.
-          delete linear_solver;
-          // Create new matrix solver with correct matrix.
-          linear_solver = create_linear_solver<Scalar>(kept_jacobian, residual);
-
-          this->dp->assemble(coeff_vec, kept_jacobian);
-
-          if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
-          {
-            char* fileName = new char[this->matrixFilename.length() + 5];
-            if(this->matrixFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-              sprintf(fileName, "%s%i.m", this->matrixFilename.c_str(), it);
-            else
-              sprintf(fileName, "%s%i", this->matrixFilename.c_str(), it);
-            FILE* matrix_file = fopen(fileName, "w+");
-
-            kept_jacobian->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
-            fclose(matrix_file);
-          }
-
-          linear_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
-        }
+        this->assemble_kept_jacobian(coeff_vec, it);
 
         this->on_step_end();
 
@@ -733,6 +942,9 @@ namespace Hermes
         // equation reads J(Y^n) \deltaY^{n + 1} = -F(Y^n).
         residual->change_sign();
 
+        if(this->inexact_newton)
+          this->update_forcing_term(residual_norm, it);
+
         // Solve the linear system.
         if(!linear_solver->solve()) 
         {
@@ -743,31 +955,20 @@ namespace Hermes
         // The good case.
         if(residual_norm < last_residual_norm * this->sufficient_improvement_factor || this->manual_damping || it == 1)
         {
-          memcpy(coeff_vec_back, coeff_vec, sizeof(Scalar)*ndof);
-          for (int i = 0; i < ndof; i++)
-            coeff_vec[i] += currentDampingCofficient * linear_solver->get_sln_vector()[i];
+          // The new iterate is written to the backup vector, which is then swapped with the current one.
+          Hermes::Algebra::VectorKernels::waxpy(ndof, Scalar(currentDampingCofficient), linear_solver->get_sln_vector(), coeff_vec, coeff_vec_back);
+          std::swap(coeff_vec, coeff_vec_back);
         }
         else
         {
-          for (int i = 0; i < ndof; i++)
-            coeff_vec[i] = coeff_vec_back[i] + currentDampingCofficient * (coeff_vec[i] - coeff_vec_back[i]);
+          // coeff_vec = coeff_vec_back + damping * (coeff_vec - coeff_vec_back).
+          Hermes::Algebra::VectorKernels::axpby(ndof, Scalar(1.0 - currentDampingCofficient), coeff_vec_back, Scalar(currentDampingCofficient), coeff_vec);
         }
 
         // Increase the number of iterations and test if we are still under the limit.
         if(it++ >= newton_max_iter)
         {
-          // We want to return the solution in a different structure.
-          this->sln_vector = new Scalar[ndof];
-          for (int i = 0; i < ndof; i++)
-            this->sln_vector[i] = coeff_vec[i];
-
-          if(delete_coeff_vec)
-          {
-            delete [] coeff_vec;
-            coeff_vec = NULL;
-          }
-
-          delete [] coeff_vec_back;
+          this->finish_work_vectors(coeff_vec, coeff_vec_back, caller_coeff_vec, ndof);
 
           this->tick();
           this->info("\tNewton: solution duration: %f s.\n", this->last());
@@ -778,10 +979,105 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::solve_adjoint(const WeakForm<Scalar>* goal_wf, Scalar* adjoint_coeff_vec)
+    {
+      if(this->sln_vector == NULL)
+        throw Exceptions::Exception("NewtonSolver::solve_adjoint() called before solve().");
+      if(this->jacobian_free && !this->jacobian_free_lagged_jacobian)
+        throw Exceptions::Exception("NewtonSolver::solve_adjoint() needs an assembled Jacobian, not available in the Jacobian-free mode.");
+      if(goal_wf == NULL)
+        throw Exceptions::NullException(1);
+      if(adjoint_coeff_vec == NULL)
+        throw Exceptions::NullException(2);
+
+      int ndof = this->dp->get_num_dofs();
+
+      // The derivative of the goal functional at the solution, assembled into the rhs the linear solver is set up with.
+      DiscreteProblem<Scalar> dp_goal(goal_wf, static_cast<DiscreteProblem<Scalar>*>(this->dp)->get_spaces());
+      dp_goal.assemble(this->sln_vector, residual);
+
+      if(!linear_solver->solve_transposed())
+        throw Exceptions::LinearMatrixSolverException();
+      Hermes::Algebra::VectorKernels::copy(ndof, linear_solver->get_sln_vector(), adjoint_coeff_vec);
+    }
+
+    template<typename Scalar>
+    void NewtonSolver<Scalar>::assemble_kept_jacobian(Scalar* coeff_vec, int it)
+    {
+      // Also declare that LU-factorization in case of a direct solver will be done only once and reused afterwards.
+      if(kept_jacobian == NULL || !(static_cast<DiscreteProblem<Scalar>*>(this->dp))->have_matrix)
+      {
+        if(kept_jacobian != NULL)
+          delete kept_jacobian;
+
+        kept_jacobian = create_matrix<Scalar>();
+
+        // Give the matrix solver the correct Jacobian. NOTE: It would be cleaner if the whole decision whether to keep
+        // Jacobian or not was made in the constructor.
+        //
+        // Delete the matrix solver created in the constructor.
+        delete linear_solver;
+        // Create new matrix solver with correct matrix.
+        linear_solver = create_linear_solver<Scalar>(kept_jacobian, residual);
+
+        this->dp->assemble(coeff_vec, kept_jacobian);
+        this->update_memory_usage();
+
+        if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
+          this->dump_matrix(kept_jacobian, it);
+
+        linear_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+      }
+    }
+
+    template<typename Scalar>
+    Scalar* NewtonSolver<Scalar>::solve_jacobian_free(Scalar* coeff_vec, int it)
+    {
+      int ndof = this->dp->get_num_dofs();
+
+      // The rhs -F(coeff_vec), the residual is needed again by the preconditioner (the rhs of its solver).
+      if(jacobian_free_rhs == NULL)
+        jacobian_free_rhs = new SimpleVector<Scalar>();
+      if(jacobian_free_rhs->length() != (unsigned int)ndof)
+        jacobian_free_rhs->alloc(ndof);
+      residual->extract(jacobian_free_rhs->get_c_array());
+
+      if(jacobian_free_solver == NULL)
+      {
+        jacobian_free_solver = new Hermes::Solvers::KrylovSolver<Scalar>(NULL, jacobian_free_rhs);
+        jacobian_free_solver->set_solver("gmres");
+      }
+      jacobian_free_solver->set_tolerance(this->inexact_newton ? this->forcing_term : this->jacobian_free_tolerance);
+      jacobian_free_solver->set_max_iters(this->jacobian_free_max_iters);
+
+      JacobianFreeOperator<Scalar> op(this->dp, ndof, coeff_vec, jacobian_free_rhs->get_c_array());
+      LaggedJacobianPreconditioner<Scalar>* precond = NULL;
+      if(this->jacobian_free_lagged_jacobian)
+        precond = new LaggedJacobianPreconditioner<Scalar>(linear_solver, residual, ndof);
+      jacobian_free_solver->set_operator(&op, precond);
+
+      // Not converged to the tolerance - the step is taken as it is (inexact Newton), KrylovSolver warns.
+      jacobian_free_solver->solve();
+      this->info("\tNewton: Jacobian-free step, %d GMRES iterations, %d residual assemblies.", jacobian_free_solver->get_num_iters(), op.num_applications);
+
+      jacobian_free_solver->set_operator(NULL);
+      if(precond != NULL)
+        delete precond;
+
+      return jacobian_free_solver->get_sln_vector();
+    }
+
     template<typename Scalar>
     void NewtonSolver<Scalar>::set_iterative_method(const char* iterative_method_name)
     {
       NonlinearSolver<Scalar>::set_iterative_method(iterative_method_name);
+      Hermes::Solvers::KrylovSolver<Scalar>* krylov_solver = dynamic_cast<Hermes::Solvers::KrylovSolver<Scalar>*>(linear_solver);
+      if(krylov_solver != NULL)
+      {
+        krylov_solver->set_solver(iterative_method_name);
+        return;
+      }
       // Set iterative method in case of iterative solver AztecOO.
 #ifdef HAVE_AZTECOO
       dynamic_cast<Hermes::Solvers::AztecOOSolver<Scalar>*>(linear_solver)->set_solver(iterative_method_name);
@@ -794,6 +1090,12 @@ namespace Hermes
     void NewtonSolver<Scalar>::set_preconditioner(const char* preconditioner_name)
     {
       NonlinearSolver<Scalar>::set_preconditioner(preconditioner_name);
+      Hermes::Solvers::KrylovSolver<Scalar>* krylov_solver = dynamic_cast<Hermes::Solvers::KrylovSolver<Scalar>*>(linear_solver);
+      if(krylov_solver != NULL)
+      {
+        krylov_solver->set_precond(preconditioner_name);
+        return;
+      }
       // Set preconditioner in case of iterative solver AztecOO.
 #ifdef HAVE_AZTECOO
       dynamic_cast<Hermes::Solvers::AztecOOSolver<Scalar> *>(linear_solver)->set_precond(preconditioner_name);
@@ -0,0 +1,472 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "p_multigrid_precond.h"
+#include "asmlist.h"
+#include "shapeset/shapeset.h"
+#include "solvers/krylov_solver.h"
+#include "solvers/umfpack_solver.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    PMultigridPrecond<Scalar>::PMultigridPrecond(const Space<Scalar>* space)
+      : smoothing_steps(2), damping(0.6), schwarz_smoother(false), schwarz_patch_type(HERMES_ELEMENT_PATCHES), schwarz_damping(0.4), matrix(NULL), coarse_matrix(NULL), coarse_rhs(NULL), coarse_rhs_values(NULL), coarse_solver(NULL)
+    {
+      this->spaces.push_back(space);
+#ifdef HAVE_EPETRA
+      this->epetra_map = NULL;
+#endif
+    }
+
+    template<typename Scalar>
+    PMultigridPrecond<Scalar>::PMultigridPrecond(Hermes::vector<const Space<Scalar>*> spaces)
+      : spaces(spaces), smoothing_steps(2), damping(0.6), schwarz_smoother(false), schwarz_patch_type(HERMES_ELEMENT_PATCHES), schwarz_damping(0.4), matrix(NULL), coarse_matrix(NULL), coarse_rhs(NULL), coarse_rhs_values(NULL), coarse_solver(NULL)
+    {
+#ifdef HAVE_EPETRA
+      this->epetra_map = NULL;
+#endif
+    }
+
+    template<typename Scalar>
+    PMultigridPrecond<Scalar>::~PMultigridPrecond()
+    {
+      this->destroy();
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::set_spaces(Hermes::vector<const Space<Scalar>*> spaces)
+    {
+      this->spaces = spaces;
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::set_smoothing_steps(int steps)
+    {
+      this->smoothing_steps = steps;
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::set_damping(double damping)
+    {
+      this->damping = damping;
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::set_schwarz_smoother(bool to_set, SchwarzPatchType patch_type, double damping)
+    {
+      this->schwarz_smoother = to_set;
+      this->schwarz_patch_type = patch_type;
+      this->schwarz_damping = damping;
+    }
+
+    template<typename Scalar>
+    int PMultigridPrecond<Scalar>::get_num_levels() const
+    {
+      return (int)this->levels.size();
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::calculate_dof_degrees(std::vector<int>& dof_degrees) const
+    {
+      int first_dof = 0;
+      AsmList<Scalar> al;
+      for(unsigned int space_i = 0; space_i < this->spaces.size(); space_i++)
+      {
+        const Space<Scalar>* space = this->spaces[space_i];
+        Shapeset* shapeset = space->get_shapeset();
+        Element* e;
+        for_all_active_elements(e, space->get_mesh())
+        {
+          space->get_element_assembly_list(e, &al, first_dof);
+          for(unsigned int i = 0; i < al.get_cnt(); i++)
+          {
+            int dof = al.get_dof()[i];
+            if(dof < 0)
+              continue;
+            int order = shapeset->get_order(al.get_idx()[i], e->get_mode());
+            int degree = e->is_triangle() ? order : std::max(H2D_GET_H_ORDER(order), H2D_GET_V_ORDER(order));
+            dof_degrees[dof] = std::max(dof_degrees[dof], degree);
+          }
+        }
+        first_dof += space->get_num_dofs();
+      }
+    }
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>* PMultigridPrecond<Scalar>::extract_submatrix(CSRMatrix<Scalar>* fine, const std::vector<int>& fine_to_coarse, int coarse_size)
+    {
+      int* Ap = fine->get_Ap();
+      int* Aj = fine->get_Aj();
+      Scalar* Ax = fine->get_Ax();
+
+      int* ap = new int[coarse_size + 1];
+      ap[0] = 0;
+      int row = 0;
+      for(unsigned int i = 0; i < fine_to_coarse.size(); i++)
+      {
+        if(fine_to_coarse[i] < 0)
+          continue;
+        int count = 0;
+        for(int k = Ap[i]; k < Ap[i + 1]; k++)
+          if(fine_to_coarse[Aj[k]] >= 0)
+            count++;
+        ap[row + 1] = ap[row] + count;
+        row++;
+      }
+
+      // The coarse numbering keeps the order of the fine one, so the rows stay sorted.
+      int* aj = new int[ap[coarse_size]];
+      Scalar* ax = new Scalar[ap[coarse_size]];
+      row = 0;
+      for(unsigned int i = 0; i < fine_to_coarse.size(); i++)
+      {
+        if(fine_to_coarse[i] < 0)
+          continue;
+        int position = ap[row++];
+        for(int k = Ap[i]; k < Ap[i + 1]; k++)
+          if(fine_to_coarse[Aj[k]] >= 0)
+          {
+            aj[position] = fine_to_coarse[Aj[k]];
+            ax[position++] = Ax[k];
+          }
+      }
+
+      CSRMatrix<Scalar>* coarse = new CSRMatrix<Scalar>;
+      coarse->create(coarse_size, ap[coarse_size], ap, aj, ax);
+      delete [] ap;
+      delete [] aj;
+      delete [] ax;
+      return coarse;
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::create(Matrix<Scalar> *mat)
+    {
+      this->destroy();
+      this->matrix = dynamic_cast<CSRMatrix<Scalar>*>(mat);
+      if(this->matrix == NULL)
+        throw Hermes::Exceptions::Exception("PMultigridPrecond needs a CSRMatrix (matrix solver SOLVER_KRYLOV).");
+
+      int ndof = Space<Scalar>::get_num_dofs(this->spaces);
+      if(ndof != (int)this->matrix->get_size())
+        throw Hermes::Exceptions::LengthException(1, this->matrix->get_size(), ndof);
+
+      std::vector<int> dof_degrees(ndof, 0);
+      this->calculate_dof_degrees(dof_degrees);
+      this->create_levels(dof_degrees);
+
+#ifdef HAVE_EPETRA
+      this->epetra_map = new Epetra_Map(ndof, 0, this->epetra_comm);
+#endif
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::create_levels(const std::vector<int>& dof_degrees)
+    {
+      int ndof = dof_degrees.size();
+      std::set<int> degrees(dof_degrees.begin(), dof_degrees.end());
+
+      // Levels from the highest degree down, the unknowns of every level its subset of the finer level.
+      std::vector<int> level_dofs(ndof);
+      for(int i = 0; i < ndof; i++)
+        level_dofs[i] = i;
+      for(std::set<int>::reverse_iterator it = degrees.rbegin(); it != degrees.rend(); it++)
+      {
+        Level level;
+        level.degree = *it;
+        level.matrix = NULL;
+        level.inv_diag = NULL;
+        level.schwarz = NULL;
+        level.b = level.x = level.r = level.w = NULL;
+        if(!this->levels.empty())
+        {
+          std::vector<int> coarse_dofs;
+          for(unsigned int i = 0; i < level_dofs.size(); i++)
+            if(dof_degrees[level_dofs[i]] <= level.degree)
+            {
+              level.fine_indices.push_back(i);
+              coarse_dofs.push_back(level_dofs[i]);
+            }
+          level_dofs.swap(coarse_dofs);
+        }
+        this->levels.push_back(level);
+      }
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::compute()
+    {
+      if(this->matrix == NULL)
+        throw Hermes::Exceptions::Exception("PMultigridPrecond::create() has to be called before compute().");
+
+      // The patches of the Schwarz smoother on the finest level, and the finest indices of the unknowns of the current level.
+      std::vector<std::vector<int> > patches;
+      std::vector<int> level_to_finest;
+      if(this->schwarz_smoother)
+      {
+        PatchSchwarzPrecond<Scalar>::calculate_patches(this->spaces, this->schwarz_patch_type, patches);
+        level_to_finest.resize(this->matrix->get_size());
+        for(unsigned int i = 0; i < level_to_finest.size(); i++)
+          level_to_finest[i] = i;
+      }
+
+      for(unsigned int level_i = 0; level_i < this->levels.size(); level_i++)
+      {
+        Level& level = this->levels[level_i];
+        if(level.matrix != this->matrix)
+          delete level.matrix;
+        delete [] level.inv_diag;
+        delete level.schwarz;
+        level.schwarz = NULL;
+        delete [] level.b;
+        delete [] level.x;
+        delete [] level.r;
+        delete [] level.w;
+        level.w = NULL;
+
+        if(level_i == 0)
+          level.matrix = this->matrix;
+        else
+        {
+          // Galerkin coarse matrix of the hierarchical basis - the submatrix of the coarse unknowns.
+          CSRMatrix<Scalar>* fine = this->levels[level_i - 1].matrix;
+          std::vector<int> fine_to_coarse(fine->get_size(), -1);
+          for(unsigned int i = 0; i < level.fine_indices.size(); i++)
+            fine_to_coarse[level.fine_indices[i]] = i;
+          level.matrix = extract_submatrix(fine, fine_to_coarse, level.fine_indices.size());
+        }
+
+        int size = level.matrix->get_size();
+        level.b = new Scalar[size];
+        level.x = new Scalar[size];
+        level.r = new Scalar[size];
+        level.inv_diag = new Scalar[size];
+        for(int i = 0; i < size; i++)
+        {
+          Scalar diagonal = level.matrix->get(i, i);
+          if(diagonal == Scalar(0))
+            throw Hermes::Exceptions::Exception("PMultigridPrecond: zero diagonal entry of the unknown %i on the level of degree %i.", i, level.degree);
+          level.inv_diag[i] = Scalar(1) / diagonal;
+        }
+
+        if(this->schwarz_smoother && level_i < this->levels.size() - 1)
+        {
+          if(level_i > 0)
+          {
+            std::vector<int> coarse_to_finest(level.fine_indices.size());
+            for(unsigned int i = 0; i < level.fine_indices.size(); i++)
+              coarse_to_finest[i] = level_to_finest[level.fine_indices[i]];
+            level_to_finest.swap(coarse_to_finest);
+          }
+          std::vector<int> finest_to_level(this->matrix->get_size(), -1);
+          for(unsigned int i = 0; i < level_to_finest.size(); i++)
+            finest_to_level[level_to_finest[i]] = i;
+
+          // The patches restricted to the unknowns of the level (kept sorted, the level numbering keeps the order).
+          std::vector<std::vector<int> > level_patches;
+          for(unsigned int patch_i = 0; patch_i < patches.size(); patch_i++)
+          {
+            std::vector<int> level_patch;
+            for(unsigned int i = 0; i < patches[patch_i].size(); i++)
+              if(finest_to_level[patches[patch_i][i]] >= 0)
+                level_patch.push_back(finest_to_level[patches[patch_i][i]]);
+            if(!level_patch.empty())
+              level_patches.push_back(level_patch);
+          }
+
+          level.schwarz = new PatchSchwarzPrecond<Scalar>(this->spaces);
+          level.schwarz->set_verbose_output(false);
+          level.schwarz->set_damping(this->schwarz_damping);
+          level.schwarz->create(level.matrix, level_patches);
+          level.schwarz->compute();
+          level.w = new Scalar[size];
+        }
+      }
+
+      this->create_coarse_solver();
+      this->info("PMultigridPrecond: %i levels, %i unknowns on the coarsest one.", (int)this->levels.size(), this->levels.back().matrix->get_size());
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::create_coarse_solver()
+    {
+      delete this->coarse_solver;
+      delete this->coarse_matrix;
+      delete this->coarse_rhs;
+      this->coarse_solver = NULL;
+      this->coarse_matrix = NULL;
+      this->coarse_rhs = NULL;
+      this->coarse_rhs_values = NULL;
+
+      CSRMatrix<Scalar>* coarse = this->levels.back().matrix;
+      int size = coarse->get_size();
+#ifdef WITH_UMFPACK
+      int* ap = new int[size + 1];
+      int* ai = new int[coarse->get_nnz()];
+      Scalar* ax = new Scalar[coarse->get_nnz()];
+      coarse->get_CSC(ap, ai, ax);
+      UMFPackMatrix<Scalar>* umfpack_matrix = new UMFPackMatrix<Scalar>;
+      umfpack_matrix->create(size, coarse->get_nnz(), ap, ai, ax);
+      delete [] ap;
+      delete [] ai;
+      delete [] ax;
+      UMFPackVector<Scalar>* umfpack_rhs = new UMFPackVector<Scalar>(size);
+      this->coarse_matrix = umfpack_matrix;
+      this->coarse_rhs = umfpack_rhs;
+      this->coarse_rhs_values = umfpack_rhs->get_c_array();
+      this->coarse_solver = new Hermes::Solvers::UMFPackLinearMatrixSolver<Scalar>(umfpack_matrix, umfpack_rhs);
+#else
+      // Without UMFPACK the coarse system is solved accurately by the built-in GMRES.
+      SimpleVector<Scalar>* simple_rhs = new SimpleVector<Scalar>(size);
+      this->coarse_rhs = simple_rhs;
+      this->coarse_rhs_values = simple_rhs->get_c_array();
+      Hermes::Solvers::KrylovSolver<Scalar>* krylov_solver = new Hermes::Solvers::KrylovSolver<Scalar>(coarse, simple_rhs);
+      krylov_solver->set_solver("gmres");
+      krylov_solver->set_precond("ilu");
+      krylov_solver->set_tolerance(1e-12);
+      this->coarse_solver = krylov_solver;
+#endif
+
+      // The factorization is done once (here, with the zero right-hand side), the V-cycles only solve.
+      this->coarse_solver->set_factorization_scheme(Hermes::Solvers::HERMES_REUSE_FACTORIZATION_COMPLETELY);
+      this->coarse_solver->solve();
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::smooth(Level& level, int steps)
+    {
+      int size = level.matrix->get_size();
+      for(int step = 0; step < steps; step++)
+      {
+        level.matrix->multiply_with_vector(level.x, level.r);
+        if(level.schwarz != NULL)
+        {
+          for(int i = 0; i < size; i++)
+            level.r[i] = level.b[i] - level.r[i];
+          level.schwarz->apply(level.r, level.w);
+          for(int i = 0; i < size; i++)
+            level.x[i] += level.w[i];
+          continue;
+        }
+#pragma omp parallel for schedule(static)
+        for(int i = 0; i < size; i++)
+          level.x[i] += this->damping * level.inv_diag[i] * (level.b[i] - level.r[i]);
+      }
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::v_cycle(unsigned int level_i)
+    {
+      Level& level = this->levels[level_i];
+      int size = level.matrix->get_size();
+
+      if(level_i == this->levels.size() - 1)
+      {
+        // Coarsest level (also the only one if all the unknowns have the same degree).
+        memcpy(this->coarse_rhs_values, level.b, size * sizeof(Scalar));
+        this->coarse_solver->solve();
+        memcpy(level.x, this->coarse_solver->get_sln_vector(), size * sizeof(Scalar));
+        return;
+      }
+
+      memset(level.x, 0, size * sizeof(Scalar));
+      this->smooth(level, this->smoothing_steps);
+
+      // Residual truncated to the coarse unknowns.
+      Level& coarse = this->levels[level_i + 1];
+      level.matrix->multiply_with_vector(level.x, level.r);
+      int coarse_size = coarse.fine_indices.size();
+      for(int i = 0; i < coarse_size; i++)
+        coarse.b[i] = level.b[coarse.fine_indices[i]] - level.r[coarse.fine_indices[i]];
+
+      this->v_cycle(level_i + 1);
+
+      for(int i = 0; i < coarse_size; i++)
+        level.x[coarse.fine_indices[i]] += coarse.x[i];
+      this->smooth(level, this->smoothing_steps);
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::apply(Scalar *r, Scalar *z)
+    {
+      if(this->coarse_solver == NULL)
+        throw Hermes::Exceptions::Exception("PMultigridPrecond::compute() has to be called before apply().");
+
+      Level& finest = this->levels[0];
+      memcpy(finest.b, r, finest.matrix->get_size() * sizeof(Scalar));
+      this->v_cycle(0);
+      memcpy(z, finest.x, finest.matrix->get_size() * sizeof(Scalar));
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::free_levels()
+    {
+      for(unsigned int level_i = 0; level_i < this->levels.size(); level_i++)
+      {
+        Level& level = this->levels[level_i];
+        if(level.matrix != this->matrix)
+          delete level.matrix;
+        delete [] level.inv_diag;
+        delete level.schwarz;
+        delete [] level.b;
+        delete [] level.x;
+        delete [] level.r;
+        delete [] level.w;
+      }
+      this->levels.clear();
+    }
+
+    template<typename Scalar>
+    void PMultigridPrecond<Scalar>::destroy()
+    {
+      delete this->coarse_solver;
+      delete this->coarse_matrix;
+      delete this->coarse_rhs;
+      this->coarse_solver = NULL;
+      this->coarse_matrix = NULL;
+      this->coarse_rhs = NULL;
+      this->coarse_rhs_values = NULL;
+      this->free_levels();
+      this->matrix = NULL;
+#ifdef HAVE_EPETRA
+      delete this->epetra_map;
+      this->epetra_map = NULL;
+#endif
+    }
+
+#ifdef HAVE_EPETRA
+    template<>
+    int PMultigridPrecond<double>::ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const
+    {
+      for(int i = 0; i < r.NumVectors(); i++)
+        const_cast<PMultigridPrecond<double>*>(this)->apply(r[i], z[i]);
+      return 0;
+    }
+
+    template<>
+    int PMultigridPrecond<std::complex<double> >::ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const
+    {
+      // Epetra vectors are real.
+      return -1;
+    }
+#endif
+
+    template class HERMES_API PMultigridPrecond<double>;
+    template class HERMES_API PMultigridPrecond<std::complex<double> >;
+  }
+}
@@ -0,0 +1,362 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "patch_schwarz_precond.h"
+#include "asmlist.h"
+#include "api2d.h"
+#include <algorithm>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // LU factorization with the partial pivoting of a [n x n] (row-wise, overwritten), false if singular.
+    template<typename Scalar>
+    static bool lu_factorize(int n, Scalar* a, int* pivot)
+    {
+      for(int k = 0; k < n; k++)
+      {
+        int p = k;
+        for(int i = k + 1; i < n; i++)
+          if(std::abs(a[i * n + k]) > std::abs(a[p * n + k]))
+            p = i;
+        pivot[k] = p;
+        if(a[p * n + k] == Scalar(0))
+          return false;
+        if(p != k)
+          for(int j = 0; j < n; j++)
+            std::swap(a[k * n + j], a[p * n + j]);
+        for(int i = k + 1; i < n; i++)
+        {
+          Scalar factor = (a[i * n + k] /= a[k * n + k]);
+          if(factor == Scalar(0))
+            continue;
+          for(int j = k + 1; j < n; j++)
+            a[i * n + j] -= factor * a[k * n + j];
+        }
+      }
+      return true;
+    }
+
+    // Solves with the factors of lu_factorize(), b overwritten by the solution.
+    template<typename Scalar>
+    static void lu_solve(int n, const Scalar* a, const int* pivot, Scalar* b)
+    {
+      for(int k = 0; k < n; k++)
+      {
+        if(pivot[k] != k)
+          std::swap(b[k], b[pivot[k]]);
+        for(int i = k + 1; i < n; i++)
+          b[i] -= a[i * n + k] * b[k];
+      }
+      for(int i = n - 1; i >= 0; i--)
+      {
+        Scalar sum = b[i];
+        for(int j = i + 1; j < n; j++)
+          sum -= a[i * n + j] * b[j];
+        b[i] = sum / a[i * n + i];
+      }
+    }
+
+    template<typename Scalar>
+    PatchSchwarzPrecond<Scalar>::PatchSchwarzPrecond(const Space<Scalar>* space, SchwarzPatchType patch_type)
+      : patch_type(patch_type), damping(1.0), matrix(NULL), max_patch_size(0)
+    {
+      this->spaces.push_back(space);
+#ifdef HAVE_EPETRA
+      this->epetra_map = NULL;
+#endif
+    }
+
+    template<typename Scalar>
+    PatchSchwarzPrecond<Scalar>::PatchSchwarzPrecond(Hermes::vector<const Space<Scalar>*> spaces, SchwarzPatchType patch_type)
+      : spaces(spaces), patch_type(patch_type), damping(1.0), matrix(NULL), max_patch_size(0)
+    {
+#ifdef HAVE_EPETRA
+      this->epetra_map = NULL;
+#endif
+    }
+
+    template<typename Scalar>
+    PatchSchwarzPrecond<Scalar>::~PatchSchwarzPrecond()
+    {
+      this->destroy();
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::set_spaces(Hermes::vector<const Space<Scalar>*> spaces)
+    {
+      this->spaces = spaces;
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::set_patch_type(SchwarzPatchType patch_type)
+    {
+      this->patch_type = patch_type;
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::set_damping(double damping)
+    {
+      this->damping = damping;
+    }
+
+    template<typename Scalar>
+    int PatchSchwarzPrecond<Scalar>::get_num_patches() const
+    {
+      return (int)this->patches.size();
+    }
+
+    template<typename Scalar>
+    int PatchSchwarzPrecond<Scalar>::get_num_colors() const
+    {
+      return this->color_offsets.empty() ? 0 : (int)this->color_offsets.size() - 1;
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::calculate_patches(Hermes::vector<const Space<Scalar>*> spaces, SchwarzPatchType patch_type, std::vector<std::vector<int> >& patches)
+    {
+      patches.clear();
+
+      // The spaces on the same mesh share the patches (the coupling of the components is kept).
+      std::map<std::pair<const Mesh*, int>, int> patch_indices;
+      int first_dof = 0;
+      AsmList<Scalar> al;
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+      {
+        const Space<Scalar>* space = spaces[space_i];
+        const Mesh* mesh = space->get_mesh();
+        Element* e;
+        for_all_active_elements(e, mesh)
+        {
+          space->get_element_assembly_list(e, &al, first_dof);
+          int num_keys = (patch_type == HERMES_ELEMENT_PATCHES) ? 1 : e->get_nvert();
+          for(int key_i = 0; key_i < num_keys; key_i++)
+          {
+            int id = (patch_type == HERMES_ELEMENT_PATCHES) ? e->id : e->vn[key_i]->id;
+            std::pair<std::map<std::pair<const Mesh*, int>, int>::iterator, bool> inserted =
+              patch_indices.insert(std::make_pair(std::make_pair(mesh, id), (int)patches.size()));
+            if(inserted.second)
+              patches.push_back(std::vector<int>());
+            std::vector<int>& patch = patches[inserted.first->second];
+            for(unsigned int i = 0; i < al.get_cnt(); i++)
+              if(al.get_dof()[i] >= 0)
+                patch.push_back(al.get_dof()[i]);
+          }
+        }
+        first_dof += space->get_num_dofs();
+      }
+
+      unsigned int count = 0;
+      for(unsigned int patch_i = 0; patch_i < patches.size(); patch_i++)
+      {
+        std::vector<int>& patch = patches[patch_i];
+        std::sort(patch.begin(), patch.end());
+        patch.erase(std::unique(patch.begin(), patch.end()), patch.end());
+        if(!patch.empty())
+          patches[count++].swap(patch);
+      }
+      patches.resize(count);
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::create(Matrix<Scalar> *mat)
+    {
+      CSRMatrix<Scalar>* csr_matrix = dynamic_cast<CSRMatrix<Scalar>*>(mat);
+      if(csr_matrix == NULL)
+        throw Hermes::Exceptions::Exception("PatchSchwarzPrecond needs a CSRMatrix (matrix solver SOLVER_KRYLOV).");
+
+      int ndof = Space<Scalar>::get_num_dofs(this->spaces);
+      if(ndof != (int)csr_matrix->get_size())
+        throw Hermes::Exceptions::LengthException(1, csr_matrix->get_size(), ndof);
+
+      std::vector<std::vector<int> > space_patches;
+      calculate_patches(this->spaces, this->patch_type, space_patches);
+      this->create(csr_matrix, space_patches);
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::create(CSRMatrix<Scalar>* mat, const std::vector<std::vector<int> >& patches)
+    {
+      this->destroy();
+      if(mat == NULL)
+        throw Hermes::Exceptions::NullException(1);
+      this->matrix = mat;
+      this->patches = patches;
+
+      this->max_patch_size = 0;
+      for(unsigned int patch_i = 0; patch_i < this->patches.size(); patch_i++)
+        this->max_patch_size = std::max(this->max_patch_size, (int)this->patches[patch_i].size());
+
+      this->color();
+
+#ifdef HAVE_EPETRA
+      this->epetra_map = new Epetra_Map(mat->get_size(), 0, this->epetra_comm);
+#endif
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::color()
+    {
+      // Greedy colouring, every patch gets the lowest colour none of its unknowns has yet.
+      int num_patches = this->patches.size();
+      std::vector<int> patch_colors(num_patches);
+      std::vector<std::vector<int> > dof_colors(this->matrix->get_size());
+      std::vector<bool> used;
+      int num_colors = 0;
+      for(int patch_i = 0; patch_i < num_patches; patch_i++)
+      {
+        const std::vector<int>& patch = this->patches[patch_i];
+        used.assign(num_colors + 1, false);
+        for(unsigned int i = 0; i < patch.size(); i++)
+          for(unsigned int j = 0; j < dof_colors[patch[i]].size(); j++)
+            used[dof_colors[patch[i]][j]] = true;
+        int c = 0;
+        while(used[c])
+          c++;
+        patch_colors[patch_i] = c;
+        num_colors = std::max(num_colors, c + 1);
+        for(unsigned int i = 0; i < patch.size(); i++)
+          dof_colors[patch[i]].push_back(c);
+      }
+
+      this->color_offsets.assign(num_colors + 1, 0);
+      for(int patch_i = 0; patch_i < num_patches; patch_i++)
+        this->color_offsets[patch_colors[patch_i] + 1]++;
+      for(int c = 0; c < num_colors; c++)
+        this->color_offsets[c + 1] += this->color_offsets[c];
+      this->color_patches.resize(num_patches);
+      std::vector<int> positions(this->color_offsets.begin(), this->color_offsets.end() - 1);
+      for(int patch_i = 0; patch_i < num_patches; patch_i++)
+        this->color_patches[positions[patch_colors[patch_i]]++] = patch_i;
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::compute()
+    {
+      if(this->matrix == NULL)
+        throw Hermes::Exceptions::Exception("PatchSchwarzPrecond::create() has to be called before compute().");
+
+      int* Ap = this->matrix->get_Ap();
+      int* Aj = this->matrix->get_Aj();
+      Scalar* Ax = this->matrix->get_Ax();
+      int num_patches = this->patches.size();
+      this->factors.resize(num_patches);
+      this->pivots.resize(num_patches);
+      int singular_patch = -1;
+
+#pragma omp parallel num_threads(Hermes2DApi.get_num_threads())
+      {
+        // Local indices of the unknowns in the current patch.
+        std::vector<int> local(this->matrix->get_size(), -1);
+#pragma omp for schedule(dynamic, 16)
+        for(int patch_i = 0; patch_i < num_patches; patch_i++)
+        {
+          const std::vector<int>& patch = this->patches[patch_i];
+          int n = patch.size();
+          for(int i = 0; i < n; i++)
+            local[patch[i]] = i;
+
+          std::vector<Scalar>& a = this->factors[patch_i];
+          a.assign(n * n, Scalar(0));
+          for(int i = 0; i < n; i++)
+            for(int k = Ap[patch[i]]; k < Ap[patch[i] + 1]; k++)
+              if(local[Aj[k]] >= 0)
+                a[i * n + local[Aj[k]]] = Ax[k];
+          this->pivots[patch_i].resize(n);
+          if(!lu_factorize(n, &a[0], &this->pivots[patch_i][0]))
+          {
+#pragma omp critical (schwarz_singular_patch)
+            singular_patch = patch_i;
+          }
+
+          for(int i = 0; i < n; i++)
+            local[patch[i]] = -1;
+        }
+      }
+
+      if(singular_patch >= 0)
+        throw Hermes::Exceptions::Exception("PatchSchwarzPrecond: singular matrix of the patch %i.", singular_patch);
+      this->info("PatchSchwarzPrecond: %i patches (at most %i unknowns) in %i colors.", num_patches, this->max_patch_size, this->get_num_colors());
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::apply(Scalar *r, Scalar *z)
+    {
+      if(this->factors.size() != this->patches.size())
+        throw Hermes::Exceptions::Exception("PatchSchwarzPrecond::compute() has to be called before apply().");
+
+      memset(z, 0, this->matrix->get_size() * sizeof(Scalar));
+      int num_colors = this->get_num_colors();
+
+#pragma omp parallel num_threads(Hermes2DApi.get_num_threads())
+      {
+        std::vector<Scalar> b(this->max_patch_size);
+        for(int c = 0; c < num_colors; c++)
+        {
+          // The patches of one colour have no unknown in common.
+#pragma omp for schedule(dynamic, 16)
+          for(int k = this->color_offsets[c]; k < this->color_offsets[c + 1]; k++)
+          {
+            int patch_i = this->color_patches[k];
+            const std::vector<int>& patch = this->patches[patch_i];
+            int n = patch.size();
+            for(int i = 0; i < n; i++)
+              b[i] = r[patch[i]];
+            lu_solve(n, &this->factors[patch_i][0], &this->pivots[patch_i][0], &b[0]);
+            for(int i = 0; i < n; i++)
+              z[patch[i]] += this->damping * b[i];
+          }
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void PatchSchwarzPrecond<Scalar>::destroy()
+    {
+      this->matrix = NULL;
+      this->patches.clear();
+      this->factors.clear();
+      this->pivots.clear();
+      this->color_patches.clear();
+      this->color_offsets.clear();
+      this->max_patch_size = 0;
+#ifdef HAVE_EPETRA
+      delete this->epetra_map;
+      this->epetra_map = NULL;
+#endif
+    }
+
+#ifdef HAVE_EPETRA
+    template<>
+    int PatchSchwarzPrecond<double>::ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const
+    {
+      for(int i = 0; i < r.NumVectors(); i++)
+        const_cast<PatchSchwarzPrecond<double>*>(this)->apply(r[i], z[i]);
+      return 0;
+    }
+
+    template<>
+    int PatchSchwarzPrecond<std::complex<double> >::ApplyInverse(const Epetra_MultiVector &r, Epetra_MultiVector &z) const
+    {
+      // Epetra vectors are real.
+      return -1;
+    }
+#endif
+
+    template class HERMES_API PatchSchwarzPrecond<double>;
+    template class HERMES_API PatchSchwarzPrecond<std::complex<double> >;
+  }
+}
@@ -66,6 +66,14 @@ namespace Hermes
       num_last_vectors_used = 3;
       anderson_beta = 1.0;
       anderson_is_on = false;
+      anderson_Q = NULL;
+      anderson_R = NULL;
+      anderson_num_columns = 0;
+      anderson_last_residual = NULL;
+      anderson_have_last_residual = false;
+      matrix_reuse = false;
+      matrix_reuse_stagnation_ratio = 0.9;
+      num_factorizations = 0;
 
       matrix = create_matrix<Scalar>();
       rhs = create_vector<Scalar>();
@@ -99,6 +107,12 @@ namespace Hermes
       const_cast<WeakForm<Scalar>*>(static_cast<DiscreteProblem<Scalar>*>(this->dp)->wf)->set_current_time_step(time_step);
     }
 
+    template<typename Scalar>
+    size_t PicardSolver<Scalar>::get_memory_usage() const
+    {
+      return get_matrix_memory_usage(this->matrix) + get_vector_memory_usage(this->rhs);
+    }
+
     template<typename Scalar>
     PicardSolver<Scalar>::~PicardSolver()
     {
@@ -136,75 +150,166 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void PicardSolver<Scalar>::calculate_anderson_coeffs(Scalar** previous_vectors, Scalar* anderson_coeffs, int num_last_vectors_used, int ndof)
+    void PicardSolver<Scalar>::update_anderson_qr(const Scalar* residual, int ndof)
     {
       if(num_last_vectors_used <= 1) throw Hermes::Exceptions::Exception("Picard: Anderson acceleration makes sense only if at least two last iterations are used.");
 
-      // If num_last_vectors_used is 2, then there is only one residual, and thus only one alpha coeff which is 1.0.
-      if(num_last_vectors_used == 2)
+      int max_columns = num_last_vectors_used - 2;
+      if(anderson_Q == NULL)
       {
-        anderson_coeffs[0] = 1.0;
-        return;
+        anderson_Q = new Scalar*[max_columns];
+        for (int i = 0; i < max_columns; i++)
+          anderson_Q[i] = new Scalar[ndof];
+        anderson_R = new Scalar[max_columns * max_columns];
+        anderson_last_residual = new Scalar[ndof];
+        anderson_num_columns = 0;
+        anderson_have_last_residual = false;
       }
 
-      // In the following, num_last_vectors_used is at least three.
-      // Thematrix problem will have dimension num_last_vectors_used - 2.
-      int n = num_last_vectors_used - 2;
+      if(anderson_have_last_residual && max_columns > 0)
+      {
+        if(anderson_num_columns == max_columns)
+          delete_anderson_qr_column(ndof);
+
+        // The new column f_new - f_last, orthogonalized against Q (modified Gram-Schmidt).
+        int k = anderson_num_columns;
+        Scalar* q = anderson_Q[k];
+        for (int l = 0; l < ndof; l++)
+          q[l] = residual[l] - anderson_last_residual[l];
+        for (int i = 0; i < k; i++)
+        {
+          Scalar r_ik = Hermes::Algebra::VectorKernels::dot(ndof, anderson_Q[i], q);
+          anderson_R[i * max_columns + k] = r_ik;
+          Hermes::Algebra::VectorKernels::axpy(ndof, -r_ik, anderson_Q[i], q);
+        }
+        double r_kk = Hermes::Algebra::VectorKernels::nrm2(ndof, q);
+        anderson_R[k * max_columns + k] = r_kk;
+        // Linearly dependent residual differences, the least-squares problem is restarted
+        // (so that the columns are always the newest differences).
+        if(r_kk > 1e-14 * Hermes::Algebra::VectorKernels::nrm2(ndof, residual))
+        {
+          Hermes::Algebra::VectorKernels::scale(ndof, Scalar(1.0 / r_kk), q);
+          anderson_num_columns++;
+        }
+        else
+          anderson_num_columns = 0;
+      }
 
-      // Allocate the matrix system for the Anderson coefficients.
-      double** mat = new_matrix<double>(n, n);
-      Scalar* rhs = new Scalar[n];
+      Hermes::Algebra::VectorKernels::copy(ndof, residual, anderson_last_residual);
+      anderson_have_last_residual = true;
+    }
 
-      // Set up the matrix and rhs vector.
-      for (int i = 0; i < n; i++)
+    template<typename Scalar>
+    void PicardSolver<Scalar>::delete_anderson_qr_column(int ndof)
+    {
+      int max_columns = num_last_vectors_used - 2;
+      int k = anderson_num_columns;
+
+      // R without its first column is upper Hessenberg, the subdiagonal is eliminated by Givens rotations
+      // applied to the rows of R and (conjugate transposed) to the columns of Q.
+      for (int i = 0; i < k - 1; i++)
       {
-        // Calculate i-th entry of the rhs vector.
-        rhs[i] = 0;
-        for (int k = 0; k < ndof; k++)
+        Scalar a = anderson_R[i * max_columns + i + 1];
+        Scalar b = anderson_R[(i + 1) * max_columns + i + 1];
+        double r = std::sqrt(std::abs(a) * std::abs(a) + std::abs(b) * std::abs(b));
+        for (int j = i + 1; j < k; j++)
         {
-          Scalar residual_n_k = previous_vectors[n + 1][k] - previous_vectors[n][k];
-          Scalar residual_i_k = previous_vectors[i + 1][k] - previous_vectors[i][k];
-          rhs[i] += residual_n_k * (residual_n_k - residual_i_k);
+          Scalar r_i = anderson_R[i * max_columns + j];
+          Scalar r_i1 = anderson_R[(i + 1) * max_columns + j];
+          anderson_R[i * max_columns + j] = (conj(a) * r_i + conj(b) * r_i1) / r;
+          anderson_R[(i + 1) * max_columns + j] = (-b * r_i + a * r_i1) / r;
         }
-        for (int j = 0; j < n; j++)
+        for (int l = 0; l < ndof; l++)
         {
-          Scalar val = 0;
-          for (int k = 0; k < ndof; k++)
-          {
-            Scalar residual_n_k = previous_vectors[n + 1][k] - previous_vectors[n][k];
-            Scalar residual_i_k = previous_vectors[i + 1][k] - previous_vectors[i][k];
-            Scalar residual_j_k = previous_vectors[j + 1][k] - previous_vectors[j][k];
-            val += (residual_n_k - residual_i_k) * (residual_n_k - residual_j_k);
-          }
-
-          // FIXME: This is not a nice way to cast Scalar to double. Not mentioning
-          // that this will not work for Scalar = complex.
-          double* ptr = (double*)(&val);
-          mat[i][j] = *ptr;
+          Scalar q_i = anderson_Q[i][l];
+          Scalar q_i1 = anderson_Q[i + 1][l];
+          anderson_Q[i][l] = (a * q_i + b * q_i1) / r;
+          anderson_Q[i + 1][l] = (-conj(b) * q_i + conj(a) * q_i1) / r;
         }
       }
 
-      // Solve the matrix system.
-      double d;
-      int* perm = new int[n];
-      ludcmp(mat, n, perm, &d);
-      lubksb<Scalar>(mat, n, perm, rhs);
+      // Shift R to the left by one column.
+      for (int i = 0; i < k - 1; i++)
+        for (int j = i; j < k - 1; j++)
+          anderson_R[i * max_columns + j] = anderson_R[i * max_columns + j + 1];
 
-      // Use the result to define the Anderson coefficients. Remember that
-      // n were computed and the last one is 1.0 minus the sum of the 'n' numbers.
-      Scalar sum = 0;
-      for (int i = 0; i < n; i++)
+      // The last column of Q is left out (and reused as the storage of the next one).
+      anderson_num_columns--;
+    }
+
+    template<typename Scalar>
+    void PicardSolver<Scalar>::calculate_anderson_coeffs(Scalar* anderson_coeffs, int ndof)
+    {
+      if(num_last_vectors_used <= 1) throw Hermes::Exceptions::Exception("Picard: Anderson acceleration makes sense only if at least two last iterations are used.");
+
+      // The coefficients of the residuals f_0, ..., f_n (n = num_last_vectors_used - 2).
+      int n = num_last_vectors_used - 2;
+
+      // gamma = R^{-1} Q^H f_n, the left out (dependent) columns have gamma zero.
+      int k = anderson_num_columns;
+      Scalar* gamma = new Scalar[n];
+      memset(gamma, 0, n * sizeof(Scalar));
+      for (int i = 0; i < k; i++)
+        gamma[i] = Hermes::Algebra::VectorKernels::dot(ndof, anderson_Q[i], anderson_last_residual);
+      for (int i = k - 1; i >= 0; i--)
       {
-        anderson_coeffs[i] = rhs[i];
-        sum += rhs[i];
+        for (int j = i + 1; j < k; j++)
+          gamma[i] -= anderson_R[i * n + j] * gamma[j];
+        gamma[i] /= anderson_R[i * n + i];
       }
-      anderson_coeffs[n] = 1.0 - sum;
 
-      // Clean up.
-      delete [] mat;
-      delete [] rhs;
+      // f_n - sum_i gamma_i (f_{i+1} - f_i) = sum_i c_i f_i, with the gammas of the newest columns.
+      int offset = n - k;
+      Scalar* gamma_full = new Scalar[n];
+      memset(gamma_full, 0, n * sizeof(Scalar));
+      for (int i = 0; i < k; i++)
+        gamma_full[offset + i] = gamma[i];
+
+      if(n == 0)
+        anderson_coeffs[0] = 1.0;
+      else
+      {
+        anderson_coeffs[0] = gamma_full[0];
+        for (int i = 1; i < n; i++)
+          anderson_coeffs[i] = gamma_full[i] - gamma_full[i - 1];
+        anderson_coeffs[n] = Scalar(1.0) - gamma_full[n - 1];
+      }
 
-      return;
+      delete [] gamma;
+      delete [] gamma_full;
+    }
+
+    template<typename Scalar>
+    void PicardSolver<Scalar>::free_anderson_qr()
+    {
+      if(anderson_Q != NULL)
+      {
+        for (int i = 0; i < num_last_vectors_used - 2; i++)
+          delete [] anderson_Q[i];
+        delete [] anderson_Q;
+        anderson_Q = NULL;
+      }
+      delete [] anderson_R;
+      anderson_R = NULL;
+      delete [] anderson_last_residual;
+      anderson_last_residual = NULL;
+      anderson_num_columns = 0;
+      anderson_have_last_residual = false;
+    }
+
+    template<typename Scalar>
+    void PicardSolver<Scalar>::set_matrix_reuse(bool to_set, double stagnation_ratio)
+    {
+      if(stagnation_ratio <= 0.0 || stagnation_ratio > 1.0)
+        throw Exceptions::ValueException("stagnation_ratio", stagnation_ratio, 0.0, 1.0);
+      this->matrix_reuse = to_set;
+      this->matrix_reuse_stagnation_ratio = stagnation_ratio;
+    }
+
+    template<typename Scalar>
+    int PicardSolver<Scalar>::get_num_factorizations() const
+    {
+      return this->num_factorizations;
     }
 
     template<typename Scalar>
@@ -290,13 +395,12 @@ namespace Hermes
         delete_coeff_vec = true;
       }
 
-      memcpy(this->sln_vector, coeff_vec, ndof*sizeof(Scalar));
+      Hermes::Algebra::VectorKernels::copy(ndof, coeff_vec, this->sln_vector);
 
       // Save the coefficient vector, it will be used to calculate increment error
       // after a new coefficient vector is calculated.
       Scalar* last_iter_vector = new Scalar[ndof];
-      for (int i = 0; i < ndof; i++)
-        last_iter_vector[i] = this->sln_vector[i];
+      Hermes::Algebra::VectorKernels::copy(ndof, this->sln_vector, last_iter_vector);
 
       // If Anderson is used, allocate memory for vectors and coefficients.
       Scalar** previous_vectors = NULL;      // To store num_last_vectors_used last coefficient vectors.
@@ -309,8 +413,22 @@ namespace Hermes
       }
 
       // If Anderson is used, save the initial coefficient vector in the memory.
+      Scalar* anderson_residual = NULL;
       if (anderson_is_on)
-        for (int i = 0; i < ndof; i++) previous_vectors[0][i] = this->sln_vector[i];
+      {
+        Hermes::Algebra::VectorKernels::copy(ndof, this->sln_vector, previous_vectors[0]);
+        anderson_residual = new Scalar[ndof];
+        free_anderson_qr();
+      }
+
+      // The residual b(u_k) - A(u_k) u_k when the factorization is reused.
+      Scalar* picard_residual = NULL;
+      double last_residual_norm = 0.0;
+      if(matrix_reuse)
+      {
+        picard_residual = new Scalar[ndof];
+        num_factorizations = 0;
+      }
 
       int it = 1;
       int vec_in_memory = 1;   // There is already one vector in the memory.
@@ -323,49 +441,52 @@ namespace Hermes
 
         (static_cast<DiscreteProblem<Scalar>*>(this->dp))->is_linear = false;
         this->dp->assemble(last_iter_vector, matrix, rhs);
+        this->update_memory_usage();
         if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
-        {
-          char* fileName = new char[this->matrixFilename.length() + 5];
-          if(this->matrixFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->matrixFilename.c_str(), it);
-          else
-            sprintf(fileName, "%s%i", this->matrixFilename.c_str(), it);
-          FILE* matrix_file = fopen(fileName, "w+");
-
-          matrix->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
-          fclose(matrix_file);
-          delete [] fileName;
-        }
+          this->dump_matrix(matrix, it);
         if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
-        {
-          char* fileName = new char[this->RhsFilename.length() + 5];
-          if(this->RhsFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->RhsFilename.c_str(), it);
-          else
-            sprintf(fileName, "%s%i", this->RhsFilename.c_str(), it);
-          FILE* rhs_file = fopen(fileName, "w+");
-          rhs->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
-          fclose(rhs_file);
-          delete [] fileName;
-        }
+          this->dump_rhs(rhs, it);
 
         this->on_step_end();
 
         //rhs->change_sign();
 
+        if(matrix_reuse)
+        {
+          // The correction u_{k+1} - u_k from the residual, by the kept factorization while the residual decreases.
+          matrix->multiply_with_vector(last_iter_vector, picard_residual);
+          Hermes::Algebra::VectorKernels::scale(ndof, Scalar(-1.0), picard_residual);
+          rhs->add_vector(picard_residual);
+          double residual_norm = Hermes::Algebra::VectorKernels::nrm2(rhs);
+          if(num_factorizations > 0 && residual_norm < matrix_reuse_stagnation_ratio * last_residual_norm)
+            linear_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+          else
+          {
+            linear_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+            num_factorizations++;
+          }
+          last_residual_norm = residual_norm;
+        }
+
         // Solve the linear system.
         if(!linear_solver->solve())
           throw Exceptions::LinearMatrixSolverException();
 
-        memcpy(this->sln_vector, linear_solver->get_sln_vector(), sizeof(Scalar)*ndof);
+        Hermes::Algebra::VectorKernels::copy(ndof, linear_solver->get_sln_vector(), this->sln_vector);
+        if(matrix_reuse)
+          Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(1.0), last_iter_vector, this->sln_vector);
 
-        // If Anderson is used, store the new vector in the memory.
+        // If Anderson is used, store the new vector in the memory (and its residual in the QR factorization).
         if (anderson_is_on)
         {
+          for (int i = 0; i < ndof; i++)
+            anderson_residual[i] = this->sln_vector[i] - previous_vectors[vec_in_memory - 1][i];
+          update_anderson_qr(anderson_residual, ndof);
+
           // If memory not full, just add the vector.
           if (vec_in_memory < num_last_vectors_used)
           {
-            for (int i = 0; i < ndof; i++) previous_vectors[vec_in_memory][i] = this->sln_vector[i];
+            Hermes::Algebra::VectorKernels::copy(ndof, this->sln_vector, previous_vectors[vec_in_memory]);
             vec_in_memory++;
           }
           else
@@ -375,7 +496,7 @@ namespace Hermes
             Scalar* oldest_vec = previous_vectors[0];
             for (int i = 0; i < num_last_vectors_used-1; i++) previous_vectors[i] = previous_vectors[i + 1];
             previous_vectors[num_last_vectors_used-1] = oldest_vec;
-            for (int j = 0; j < ndof; j++) previous_vectors[num_last_vectors_used-1][j] = this->sln_vector[j];
+            Hermes::Algebra::VectorKernels::copy(ndof, this->sln_vector, previous_vectors[num_last_vectors_used-1]);
           }
         }
 
@@ -383,31 +504,23 @@ namespace Hermes
         if (anderson_is_on && vec_in_memory >= num_last_vectors_used)
         {
           // Calculate Anderson coefficients.
-          calculate_anderson_coeffs(previous_vectors, anderson_coeffs, num_last_vectors_used, ndof);
+          calculate_anderson_coeffs(anderson_coeffs, ndof);
 
-          // Calculate new vector and store it in this->sln_vector[].
-          for (int i = 0; i < ndof; i++)
+          // Calculate new vector and store it in this->sln_vector[]:
+          // sum_j c_{j-1} (p_j - (1 - beta) (p_j - p_{j-1})) = sum_j c_{j-1} (beta p_j + (1 - beta) p_{j-1}).
+          Hermes::Algebra::VectorKernels::zero(ndof, this->sln_vector);
+          for (int j = 1; j < num_last_vectors_used; j++)
           {
-            this->sln_vector[i] = 0;
-            for (int j = 1; j < num_last_vectors_used; j++)
-            {
-              this->sln_vector[i] += anderson_coeffs[j-1] * previous_vectors[j][i] - (1.0 - anderson_beta) * anderson_coeffs[j-1] * (previous_vectors[j][i] - previous_vectors[j-1][i]);
-            }
+            Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(anderson_beta) * anderson_coeffs[j-1], previous_vectors[j], this->sln_vector);
+            Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(1.0 - anderson_beta) * anderson_coeffs[j-1], previous_vectors[j-1], this->sln_vector);
           }
         }
 
         // Calculate relative error between last_iter_vector[] and this->sln_vector[].
-        // FIXME: this is wrong in the complex case (complex conjugation must be used).
         // FIXME: This will crash if norm of last_iter_vector[] is zero.
-        double last_iter_vec_norm = 0;
-        for (int i = 0; i < ndof; i++)
-          last_iter_vec_norm += std::abs(last_iter_vector[i] * last_iter_vector[i]);
-
-        last_iter_vec_norm = sqrt(last_iter_vec_norm);
+        double last_iter_vec_norm = Hermes::Algebra::VectorKernels::nrm2(ndof, last_iter_vector);
 
-        double abs_error = 0;
-        for (int i = 0; i < ndof; i++) abs_error += std::abs((this->sln_vector[i] - last_iter_vector[i]) * (this->sln_vector[i] - last_iter_vector[i]));
-        abs_error = sqrt(abs_error);
+        double abs_error = Hermes::Algebra::VectorKernels::diff_nrm2(ndof, this->sln_vector, last_iter_vector);
 
         double rel_error = abs_error / last_iter_vec_norm;
 
@@ -427,7 +540,10 @@ namespace Hermes
             for (int i = 0; i < num_last_vectors_used; i++) delete [] previous_vectors[i];
             delete [] previous_vectors;
             delete [] anderson_coeffs;
+            delete [] anderson_residual;
+            free_anderson_qr();
           }
+          delete [] picard_residual;
           
           static_cast<DiscreteProblem<Scalar>*>(this->dp)->have_matrix = false;
 
@@ -447,7 +563,10 @@ namespace Hermes
             for (int i = 0; i < num_last_vectors_used; i++) delete [] previous_vectors[i];
             delete [] previous_vectors;
             delete [] anderson_coeffs;
+            delete [] anderson_residual;
+            free_anderson_qr();
           }
+          delete [] picard_residual;
           static_cast<DiscreteProblem<Scalar>*>(this->dp)->have_matrix = false;
 
           this->tick();
@@ -463,8 +582,7 @@ namespace Hermes
         it++;
 
         // Renew the last iteration vector.
-        for (int i = 0; i < ndof; i++)
-          last_iter_vector[i] = this->sln_vector[i];
+        Hermes::Algebra::VectorKernels::copy(ndof, this->sln_vector, last_iter_vector);
       }
     }
     template class HERMES_API PicardSolver<double>;
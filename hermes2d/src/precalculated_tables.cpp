@@ -0,0 +1,165 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "precalculated_tables.h"
+#include "api2d.h"
+#include <string.h>
+#include <stdio.h>
+#include <sstream>
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    static const char precalculated_tables_magic[8] = { 'H', '2', 'D', 'T', 'A', 'B', 'L', (char) H2D_PRECALCULATED_TABLES_VERSION };
+
+    /// The header of a table file, followed by the doubles.
+    struct PrecalculatedTableHeader
+    {
+      char magic[8];
+      int key;
+      int size_of_double;
+      unsigned long long count;
+    };
+
+    bool PrecalculatedTables::warning_issued = false;
+
+    std::string PrecalculatedTables::get_directory()
+    {
+      std::string dir = Hermes2DApi.get_text_param_value(precalculatedFormsDirPath);
+      if(!dir.empty() && dir[dir.length() - 1] != '/' && dir[dir.length() - 1] != '\\')
+        dir += '/';
+      return dir;
+    }
+
+    const double* PrecalculatedTables::load(const char* name, int key, size_t count)
+    {
+      std::string dir = get_directory();
+      if(dir.empty())
+        return NULL;
+      std::string file_name = dir + name + ".h2dtab";
+      size_t length = sizeof(PrecalculatedTableHeader) + count * sizeof(double);
+
+      char* data;
+#ifdef WIN32
+      FILE* file = fopen(file_name.c_str(), "rb");
+      if(file == NULL)
+        return NULL;
+      data = new char[length];
+      size_t read = fread(data, 1, length, file);
+      bool at_end = (fgetc(file) == EOF);
+      fclose(file);
+      if(read != length || !at_end)
+      {
+        delete [] data;
+        return NULL;
+      }
+#else
+      int fd = open(file_name.c_str(), O_RDONLY);
+      if(fd < 0)
+        return NULL;
+      struct stat file_stat;
+      if(fstat(fd, &file_stat) != 0 || (size_t)file_stat.st_size != length)
+      {
+        close(fd);
+        return NULL;
+      }
+      void* mapped = mmap(NULL, length, PROT_READ, MAP_SHARED, fd, 0);
+      close(fd);
+      if(mapped == MAP_FAILED)
+        return NULL;
+      data = (char*)mapped;
+#endif
+
+      PrecalculatedTableHeader header;
+      memcpy(&header, data, sizeof(PrecalculatedTableHeader));
+      if(memcmp(header.magic, precalculated_tables_magic, 8) != 0 || header.key != key
+        || header.size_of_double != (int)sizeof(double) || header.count != (unsigned long long)count)
+      {
+#ifdef WIN32
+        delete [] data;
+#else
+        munmap(data, length);
+#endif
+        return NULL;
+      }
+
+      // Stays mapped (allocated) until the end of the process.
+      return (const double*)(data + sizeof(PrecalculatedTableHeader));
+    }
+
+    void PrecalculatedTables::store(const char* name, int key, size_t count, const double* data)
+    {
+      std::string dir = get_directory();
+      if(dir.empty())
+        return;
+      std::string file_name = dir + name + ".h2dtab";
+#ifndef WIN32
+      // The first process creates the directory, it fails harmlessly if it exists.
+      mkdir(dir.c_str(), 0775);
+#endif
+
+      PrecalculatedTableHeader header;
+      memset(&header, 0, sizeof(PrecalculatedTableHeader));
+      memcpy(header.magic, precalculated_tables_magic, 8);
+      header.key = key;
+      header.size_of_double = sizeof(double);
+      header.count = count;
+
+      // A name unique to the process, renamed to the final one once complete.
+      std::stringstream ss;
+#ifdef WIN32
+      ss << file_name << ".tmp";
+#else
+      ss << file_name << "." << getpid() << ".tmp";
+#endif
+      std::string temp_name = ss.str();
+
+      bool written = false;
+      FILE* file = fopen(temp_name.c_str(), "wb");
+      if(file != NULL)
+      {
+        written = fwrite(&header, sizeof(PrecalculatedTableHeader), 1, file) == 1
+          && fwrite(data, sizeof(double), count, file) == count;
+        written = (fclose(file) == 0) && written;
+#ifdef WIN32
+        remove(file_name.c_str());
+#endif
+        if(written)
+          written = (rename(temp_name.c_str(), file_name.c_str()) == 0);
+        if(!written)
+          remove(temp_name.c_str());
+      }
+
+      if(!written)
+      {
+        bool issue = false;
+#pragma omp critical (precalculated_tables_warning)
+        {
+          issue = !warning_issued;
+          warning_issued = true;
+        }
+        if(issue)
+          Hermes::Mixins::Loggable::Static::warn("The precalculated table %s could not be stored (see Hermes2DApi precalculatedFormsDirPath).", file_name.c_str());
+      }
+    }
+  }
+}
@@ -46,51 +46,59 @@ namespace Hermes
         }
       }
 
+      // A Solution is projected element by element in parallel, see Solution::transfer_to(),
+      // in the L2 norm if the norm is neither the L2 nor the H1 one.
+      Solution<Scalar>* sln = dynamic_cast<Solution<Scalar>*>(meshfn);
+      if(sln != NULL)
+      {
+        sln->transfer_to(space, target_vec, (proj_norm == HERMES_H1_NORM && space->get_shapeset()->get_num_components() == 1) ? HERMES_H1_NORM : HERMES_L2_NORM);
+        return;
+      }
+
       // Get dimension of the space.
       int ndof = space->get_num_dofs();
 
       // Erase the target vector.
       memset(target_vec, 0, ndof*sizeof(Scalar));
 
-      // Dump into the first part of target_vec the values of active vertex dofs, then add values
-      // of active edge dofs, and finally also values of active bubble dofs.
-      // Start with active vertex dofs.
+      // Other functions: the values of the active vertex dofs, each vertex visited once
+      // and all of them evaluated at once (MeshFunction::get_pt_values()).
+      // TODO: Calculate coefficients of edge and bubble functions as well.
       Mesh* mesh = space->get_mesh();
+      std::vector<bool> visited(mesh->get_max_node_id(), false);
+      std::vector<int> dofs;
+      std::vector<double> x, y;
       Element* e;
-      // Go through all active elements in mesh to collect active vertex DOF.
       for_all_active_elements(e, mesh)
       {
-        int order = space->get_element_order(e->id);
-        if(order > 0)
+        if(space->get_element_order(e->id) <= 0)
+          continue;
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
         {
-          for (unsigned int j = 0; j < e->get_nvert(); j++)
+          Node* vn = e->vn[j];
+          if(visited[vn->id])
+            continue;
+          visited[vn->id] = true;
+          typename Space<Scalar>::NodeData* nd = space->ndata + vn->id;
+          if(!vn->is_constrained_vertex() && nd->dof >= 0)
           {
-            // FIXME - the same vertex is visited several times since it
-            // belongs to multiple elements!
-            Node* vn = e->vn[j];
-            double x = e->vn[j]->x;
-            double y = e->vn[j]->y;
-            //this->info("Probing vertex %g %g\n", x, y);
-            typename Space<Scalar>::NodeData* nd = space->ndata + vn->id;
-            if(!vn->is_constrained_vertex() && nd->dof >= 0)
-            {
-              int dof_num = nd->dof;
-              // FIXME: If this is a Solution, the it would be MUCH faster to just
-              // retrieve the value from the coefficient vector stored in the Solution.
-
-              // FIXME: Retrieving the value through get_pt_value() is slow and this
-              // should be only done if we are dealing with MeshFunction (not a Solution).
-              Scalar val = meshfn->get_pt_value(x, y)->val[0];
-              //printf("Found active vertex %g %g, val = %g, dof_num = %d\n", x, y, std::abs(val), dof_num);
-              target_vec[dof_num] = val;
-            }
+            dofs.push_back(nd->dof - space->first_dof);
+            x.push_back(vn->x);
+            y.push_back(vn->y);
           }
         }
-
-        // TODO: Calculate coefficients of edge functions and copy into target_vec_space[i] as well
-
-        // TODO: Calculate coefficients of bubble functions and copy into target_vec_space[i] as well.
       }
+      if(dofs.empty())
+        return;
+
+      bool* found = new bool[dofs.size()];
+      Func<Scalar>* values = meshfn->get_pt_values((int)dofs.size(), &x[0], &y[0], found);
+      for (unsigned int i = 0; i < dofs.size(); i++)
+        if(found[i])
+          target_vec[dofs[i]] = values->val[i];
+      values->free_fn();
+      delete values;
+      delete [] found;
     }
 
     template<typename Scalar>
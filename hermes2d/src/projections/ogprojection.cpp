@@ -16,16 +16,87 @@
 #include "projections/ogprojection.h"
 #include "space.h"
 #include "linear_solver.h"
+#include "refmap.h"
+#include "precalc.h"
+#include "quadrature/limit_order.h"
+#include "api2d.h"
 
 namespace Hermes
 {
   namespace Hermes2D
   {
     template<typename Scalar>
-    OGProjection<Scalar>::OGProjection() : Hermes::Mixins::Loggable(), ndof(0)
+    OGProjection<Scalar>::OGProjection() : Hermes::Mixins::Loggable(), cache_projection_matrices(true), ndof(0)
     {
     }
 
+    template<typename Scalar>
+    OGProjection<Scalar>::~OGProjection()
+    {
+      this->free_projection_cache();
+    }
+
+    template<typename Scalar>
+    void OGProjection<Scalar>::set_cache_projection_matrices(bool to_set)
+    {
+      this->cache_projection_matrices = to_set;
+      if(!to_set)
+        this->free_projection_cache();
+    }
+
+    template<typename Scalar>
+    void OGProjection<Scalar>::free_projection_cache_entry(ProjectionCacheEntry* entry)
+    {
+      delete entry->linear_solver;
+      delete entry->dp;
+      delete entry->wf;
+      delete entry;
+    }
+
+    template<typename Scalar>
+    void OGProjection<Scalar>::free_projection_cache()
+    {
+      for(unsigned int i = 0; i < this->projection_cache.size(); i++)
+        free_projection_cache_entry(this->projection_cache[i]);
+      this->projection_cache.clear();
+    }
+
+    template<typename Scalar>
+    typename OGProjection<Scalar>::ProjectionCacheEntry* OGProjection<Scalar>::get_projection_cache_entry(const Space<Scalar>* space, ProjNormType norm)
+    {
+      // Only the pointers are compared, the spaces of the other entries may not exist any more.
+      unsigned int entry_i = 0;
+      for(; entry_i < this->projection_cache.size(); entry_i++)
+        if(this->projection_cache[entry_i]->space == space && this->projection_cache[entry_i]->norm == norm)
+          break;
+
+      if(entry_i < this->projection_cache.size())
+      {
+        if(this->projection_cache[entry_i]->space_seq == space->get_seq())
+          return this->projection_cache[entry_i];
+        free_projection_cache_entry(this->projection_cache[entry_i]);
+      }
+      else
+        this->projection_cache.push_back(NULL);
+
+      ProjectionCacheEntry* entry = new ProjectionCacheEntry;
+      entry->space = space;
+      entry->space_seq = space->get_seq();
+      entry->norm = norm;
+      entry->wf = new WeakForm<Scalar>(1);
+      entry->wf->warned_nonOverride = true;
+      entry->wf->add_matrix_form(new ProjectionMatrixFormVol(0, 0, norm));
+      entry->wf->add_vector_form(new ProjectionVectorFormVol(0, norm));
+      entry->dp = new DiscreteProblemLinear<Scalar>(entry->wf, space);
+      entry->dp->set_do_not_use_cache();
+      entry->linear_solver = new LinearSolver<Scalar>(entry->dp);
+      // The mass matrix is assembled and factorized once, the following projections assemble only the right-hand side.
+      entry->linear_solver->set_constant_matrix();
+
+      this->projection_cache[entry_i] = entry;
+      return entry;
+    }
+
     template<typename Scalar>
     void OGProjection<Scalar>::project_internal(const Space<Scalar>* space, WeakForm<Scalar>* wf,
   Scalar* target_vec)
@@ -50,6 +121,76 @@ namespace Hermes
           target_vec[i] = linear_solver.get_sln_vector()[i];
     }
 
+    template<typename Scalar>
+    bool OGProjection<Scalar>::project_local_l2(const Space<Scalar>* space, MeshFunction<Scalar>* source_meshfn,
+  Scalar* target_vec)
+    {
+      if(source_meshfn->get_mesh() != space->get_mesh())
+        return false;
+
+      int ndof = space->get_num_dofs();
+      double* diag = new double[ndof];
+      if(!space->get_diagonal_mass_matrix(diag))
+      {
+        delete [] diag;
+        return false;
+      }
+
+      // With the diagonal mass matrix, the coefficient of each basis function is its product with
+      // source_meshfn divided by its squared norm.
+      PrecalcShapeset pss(space->get_shapeset());
+      RefMap refmap;
+      AsmList<Scalar> al;
+      source_meshfn->set_quad_2d(&g_quad_2d_std);
+
+      for (int i = 0; i < ndof; i++)
+        target_vec[i] = 0.0;
+
+      Element* e;
+      for_all_active_elements(e, space->get_mesh())
+      {
+        ElementMode2D mode = e->get_mode();
+        space->get_element_assembly_list(e, &al);
+        int* idx = al.get_idx();
+        int* dof = al.get_dof();
+        Scalar* coef = al.get_coef();
+        source_meshfn->set_active_element(e);
+        refmap.set_active_element(e);
+        pss.set_active_element(e);
+
+        int o = 0;
+        for (unsigned int k = 0; k < al.get_cnt(); k++)
+        {
+          pss.set_active_shape(idx[k]);
+          o = std::max(o, pss.get_fn_order());
+        }
+        o += source_meshfn->get_fn_order();
+        limit_order(o, mode);
+
+        source_meshfn->set_quad_order(o, H2D_FN_VAL);
+        Scalar* fn = source_meshfn->get_fn_values();
+        double3* pt = g_quad_2d_std.get_points(o, mode);
+        int np = g_quad_2d_std.get_num_points(o, mode);
+        double jac = refmap.get_const_jacobian();
+
+        for (unsigned int k = 0; k < al.get_cnt(); k++)
+        {
+          if(dof[k] < 0)
+            continue;
+          pss.set_active_shape(idx[k]);
+          pss.set_quad_order(o, H2D_FN_VAL);
+          double* v = pss.get_fn_values();
+          Scalar result = 0.0;
+          for (int i = 0; i < np; i++)
+            result += pt[i][2] * fn[i] * v[i];
+          target_vec[dof[k]] = coef[k] * jac * result / diag[dof[k]];
+        }
+      }
+
+      delete [] diag;
+      return true;
+    }
+
     template<typename Scalar>
     void OGProjection<Scalar>::project_global(const Space<Scalar>* space,
         MatrixFormVol<Scalar>* custom_projection_jacobian,
@@ -155,6 +296,35 @@ namespace Hermes
       }
       else norm = proj_norm;
 
+      // Orthogonal bases need no global solve.
+      if(norm == HERMES_L2_NORM && project_local_l2(space, source_meshfn, target_vec))
+        return;
+
+      // The kept system of this space and norm.
+      if(this->cache_projection_matrices)
+      {
+        ProjectionCacheEntry* entry;
+#pragma omp critical (projection_cache)
+        entry = this->get_projection_cache_entry(space, norm);
+        entry->wf->set_ext(source_meshfn);
+        entry->linear_solver->set_verbose_output(this->get_verbose_output());
+        try
+        {
+          entry->linear_solver->solve();
+        }
+        catch(...)
+        {
+          entry->wf->set_ext(Hermes::vector<MeshFunction<Scalar>*>());
+          throw;
+        }
+        // source_meshfn is not kept.
+        entry->wf->set_ext(Hermes::vector<MeshFunction<Scalar>*>());
+
+        for (int i = 0; i < space->get_num_dofs(); i++)
+          target_vec[i] = entry->linear_solver->get_sln_vector()[i];
+        return;
+      }
+
       // Define temporary projection weak form.
       WeakForm<Scalar>* proj_wf = new WeakForm<Scalar>(1);
       proj_wf->warned_nonOverride = true;
@@ -201,6 +371,67 @@ namespace Hermes
       delete [] target_vec;
     }
 
+    template<typename Scalar>
+    void OGProjection<Scalar>::project_fields(const Hermes::vector<const Space<Scalar>*>& spaces, const Hermes::vector<MeshFunction<Scalar>*>& source_meshfns,
+        Scalar* target_vec, const Hermes::vector<ProjNormType>& proj_norms)
+    {
+      int n = spaces.size();
+
+      // The fields start one after another in target_vec.
+      std::vector<int> start_indices(n + 1, 0);
+      for (int i = 0; i < n; i++)
+      {
+        if(i == 0)
+          this->info("Projection: %d-th space", i);
+        if(i == 1)
+          this->info("Projection: %d-st space", i);
+        if(i == 2)
+          this->info("Projection: %d-nd space", i);
+        if(i == 3)
+          this->info("Projection: %d-rd space", i);
+        if(i > 3)
+          this->info("Projection: %d-th space", i);
+        start_indices[i + 1] = start_indices[i] + spaces[i]->get_num_dofs();
+      }
+
+      // The fields are independent - one (smaller) system each, the fields distributed over the threads.
+      // The projection of one field is assembled only by its thread then (no nested parallelism).
+      int num_threads_used = std::max(1, std::min(n, (int)Hermes2DApi.get_num_threads()));
+      // A space shared by two fields (its cached assembly lists) is not to be used by two threads.
+      for (int i = 0; i < n && num_threads_used > 1; i++)
+        for (int j = 0; j < i; j++)
+          if(spaces[i] == spaces[j])
+            num_threads_used = 1;
+      Hermes::Exceptions::Exception* caughtException = NULL;
+
+      int i;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads_used)
+      for (i = 0; i < n; i++)
+      {
+        if(caughtException != NULL)
+          continue;
+        try
+        {
+          project_global(spaces[i], source_meshfns[i], target_vec + start_indices[i], proj_norms.empty() ? HERMES_UNSET_NORM : proj_norms[i]);
+        }
+        catch(Hermes::Exceptions::Exception& e)
+        {
+#pragma omp critical (projection_exception)
+          if(caughtException == NULL)
+            caughtException = e.clone();
+        }
+        catch(std::exception& e)
+        {
+#pragma omp critical (projection_exception)
+          if(caughtException == NULL)
+            caughtException = new Hermes::Exceptions::Exception(e.what());
+        }
+      }
+
+      if(caughtException != NULL)
+        throw *caughtException;
+    }
+
     template<typename Scalar>
     void OGProjection<Scalar>::project_global(Hermes::vector<const Space<Scalar>*> spaces,
         Hermes::vector<MeshFunction<Scalar>*> source_meshfns,
@@ -216,23 +447,11 @@ namespace Hermes
       if(!proj_norms.empty() && n != proj_norms.size()) 
         throw Exceptions::LengthException(1, 5, n, proj_norms.size());
 
+      project_fields(spaces, source_meshfns, target_vec, proj_norms);
+
       int start_index = 0;
       for (int i = 0; i < n; i++)
       {
-        if(i == 0)
-          this->info("Projection: %d-th space", i);
-        if(i == 1)
-          this->info("Projection: %d-st space", i);
-        if(i == 2)
-          this->info("Projection: %d-nd space", i);
-        if(i == 3)
-          this->info("Projection: %d-rd space", i);
-        if(i > 3)
-          this->info("Projection: %d-th space", i);
-        if(proj_norms.empty())
-          project_global(spaces[i], source_meshfns[i], target_vec + start_index, HERMES_UNSET_NORM);
-        else
-          project_global(spaces[i], source_meshfns[i], target_vec + start_index, proj_norms[i]);
         spaces[i]->assign_dofs(start_index);
         start_index += spaces[i]->get_num_dofs();
       }
@@ -252,25 +471,10 @@ namespace Hermes
       if(!proj_norms.empty() && n != proj_norms.size()) 
         throw Exceptions::LengthException(1, 5, n, proj_norms.size());
 
-      int start_index = 0;
+      Hermes::vector<MeshFunction<Scalar>*> source_meshfns;
       for (int i = 0; i < n; i++)
-      {
-        if(i == 0)
-          this->info("Projection: %d-th space", i);
-        if(i == 1)
-          this->info("Projection: %d-st space", i);
-        if(i == 2)
-          this->info("Projection: %d-nd space", i);
-        if(i == 3)
-          this->info("Projection: %d-rd space", i);
-        if(i > 3)
-          this->info("Projection: %d-th space", i);
-        if(proj_norms.empty())
-          project_global(spaces[i], source_slns[i], target_vec + start_index, HERMES_UNSET_NORM);
-        else
-          project_global(spaces[i], source_slns[i], target_vec + start_index, proj_norms[i]);
-        start_index += spaces[i]->get_num_dofs();
-      }
+        source_meshfns.push_back(source_slns[i]);
+      project_fields(spaces, source_meshfns, target_vec, proj_norms);
     }
 
     template<typename Scalar>
@@ -287,25 +491,34 @@ namespace Hermes
       if(!proj_norms.empty() && n != proj_norms.size()) 
         throw Exceptions::LengthException(1, 5, n, proj_norms.size());
 
+      // Calculate the coefficient vector.
+      int ndof = 0;
+      for (int i = 0; i < n; i++)
+        ndof += spaces[i]->get_num_dofs();
+      Scalar* target_vec = new Scalar[ndof];
+      Hermes::vector<MeshFunction<Scalar>*> source_meshfns;
+      for (int i = 0; i < n; i++)
+        source_meshfns.push_back(source_slns[i]);
+      try
+      {
+        project_fields(spaces, source_meshfns, target_vec, proj_norms);
+      }
+      catch(...)
+      {
+        delete [] target_vec;
+        throw;
+      }
+
+      // Translate coefficient vector into the Solutions.
       int start_index = 0;
       for (int i = 0; i < n; i++)
       {
-        if(i == 0)
-          this->info("Projection: %d-th space", i);
-        if(i == 1)
-          this->info("Projection: %d-st space", i);
-        if(i == 2)
-          this->info("Projection: %d-nd space", i);
-        if(i == 3)
-          this->info("Projection: %d-rd space", i);
-        if(i > 3)
-          this->info("Projection: %d-th space", i);
-        if(proj_norms.empty())
-          project_global(spaces[i], source_slns[i], target_slns[i], HERMES_UNSET_NORM);
-        else
-          project_global(spaces[i], source_slns[i], target_slns[i], proj_norms[i]);
+        Solution<Scalar>::vector_to_solution(target_vec + start_index, spaces[i], target_slns[i]);
         start_index += spaces[i]->get_num_dofs();
       }
+
+      // Clean up.
+      delete [] target_vec;
     }
 
     template class HERMES_API OGProjection<double>;
@@ -2294,90 +2294,951 @@ namespace Hermes
       { -0.979677761407444,  0.848688505241568,  0.007599857710604 }
     };
 
+    // Orders 20 - 29: fully symmetric rules with all points inside the triangle and positive weights. A rule of a higher
+    // order with fewer points serves the orders 24, 26 and 28 as well (see std_tables_2d_tri).
     static double3 std_pts_20_2d_tri[] =
     {
-      // This rule sucks, because it has points outside the domain
-      // and also maybe integrates incorrectly (we need to confirm this)
-      //
-      { -0.333333333333333, -0.333333333333333,  0.066114111083248 },
-      {  0.001900928704400,  0.001900928704400,  0.001734038371326 },
-      {  0.001900928704400, -1.003801857408800,  0.001734038371326 }, // BEWARE !
-      { -1.003801857408800,  0.001900928704400,  0.001734038371326 }, // BEWARE !
-      { -0.023574084130543, -0.023574084130543,  0.023320105432896 },
-      { -0.023574084130543, -0.952851831738914,  0.023320105432896 },
-      { -0.952851831738914, -0.023574084130543,  0.023320105432896 },
-      { -0.089726626099435, -0.089726626099435,  0.045753872712842 },
-      { -0.089726626099435, -0.820546727801130,  0.045753872712842 },
-      { -0.820546727801130, -0.089726626099435,  0.045753872712842 },
-      { -0.196007481363421, -0.196007481363421,  0.060897965347876 },
-      { -0.196007481363421, -0.607985037273158,  0.060897965347876 },
-      { -0.607985037273158, -0.196007481363421,  0.060897965347876 },
-      { -0.488214180481157, -0.488214180481157,  0.061249783450710 },
-      { -0.488214180481157, -0.023571639037686,  0.061249783450710 },
-      { -0.023571639037686, -0.488214180481157,  0.061249783450710 },
-      { -0.647023488009788, -0.647023488009788,  0.048736115353600 },
-      { -0.647023488009788,  0.294046976019576,  0.048736115353600 },
-      {  0.294046976019576, -0.647023488009788,  0.048736115353600 },
-      { -0.791658289326483, -0.791658289326483,  0.031994864064048 },
-      { -0.791658289326483,  0.583316578652966,  0.031994864064048 },
-      {  0.583316578652966, -0.791658289326483,  0.031994864064048 },
-      { -0.893862072318140, -0.893862072318140,  0.015396603631204 },
-      { -0.893862072318140,  0.787724144636280,  0.015396603631204 },
-      {  0.787724144636280, -0.893862072318140,  0.015396603631204 },
-      { -0.916762569607942, -0.916762569607942, -0.001264120994976 },
-      { -0.916762569607942,  0.833525139215884, -0.001264120994976 },
-      {  0.833525139215884, -0.916762569607942, -0.001264120994976 },
-      { -0.976836157186356, -0.976836157186356,  0.003502268602386 },
-      { -0.976836157186356,  0.953672314372712,  0.003502268602386 },
-      {  0.953672314372712, -0.976836157186356,  0.003502268602386 },
-      { -0.310288459541998,  0.212805292212320,  0.032931678379152 },
-      {  0.212805292212320, -0.902516832670322,  0.032931678379152 },
-      { -0.902516832670322, -0.310288459541998,  0.032931678379152 },
-      { -0.310288459541998, -0.902516832670322,  0.032931678379152 },
-      {  0.212805292212320, -0.310288459541998,  0.032931678379152 },
-      { -0.902516832670322,  0.212805292212320,  0.032931678379152 },
-      { -0.244313460810292,  0.231685228913082,  0.009678067080970 },
-      {  0.231685228913082, -0.987371768102790,  0.009678067080970 },
-      { -0.987371768102790, -0.244313460810292,  0.009678067080970 },
-      { -0.244313460810292, -0.987371768102790,  0.009678067080970 },
-      {  0.231685228913082, -0.244313460810292,  0.009678067080970 },
-      { -0.987371768102790,  0.231685228913082,  0.009678067080970 },
-      { -0.386729041875286,  0.118096000780590,  0.051609813069300 },
-      {  0.118096000780590, -0.731366958905304,  0.051609813069300 },
-      { -0.731366958905304, -0.386729041875286,  0.051609813069300 },
-      { -0.386729041875286, -0.731366958905304,  0.051609813069300 },
-      {  0.118096000780590, -0.386729041875286,  0.051609813069300 },
-      { -0.731366958905304,  0.118096000780590,  0.051609813069300 },
-      { -0.501161274450516,  0.473213486525732,  0.016942182108882 },
-      {  0.473213486525732, -0.972052212075216,  0.016942182108882 },
-      { -0.972052212075216, -0.501161274450516,  0.016942182108882 },
-      { -0.501161274450516, -0.972052212075216,  0.016942182108882 },
-      {  0.473213486525732, -0.501161274450516,  0.016942182108882 },
-      { -0.972052212075216,  0.473213486525732,  0.016942182108882 },
-      { -0.574448550394396,  0.423350284574868,  0.036709828212560 },
-      {  0.423350284574868, -0.848901734180472,  0.036709828212560 },
-      { -0.848901734180472, -0.574448550394396,  0.036709828212560 },
-      { -0.574448550394396, -0.848901734180472,  0.036709828212560 },
-      {  0.423350284574868, -0.574448550394396,  0.036709828212560 },
-      { -0.848901734180472,  0.423350284574868,  0.036709828212560 },
-      { -0.706069127893522,  0.722805434309974,  0.001408809355816 },
-      {  0.722805434309974, -1.016736306416454,  0.001408809355816 }, // BEWARE!
-      { -1.016736306416454, -0.706069127893522,  0.001408809355816 }, // BEWARE!
-      { -0.706069127893522, -1.016736306416454,  0.001408809355816 }, // BEWARE!
-      {  0.722805434309974, -0.706069127893522,  0.001408809355816 },
-      { -1.016736306416454,  0.722805434309974,  0.001408809355816 }, // BEWARE!
-      { -0.724546042342154,  0.671173915824726,  0.020225369854924 },
-      {  0.671173915824726, -0.946627873482572,  0.020225369854924 },
-      { -0.946627873482572, -0.724546042342154,  0.020225369854924 },
-      { -0.724546042342154, -0.946627873482572,  0.020225369854924 },
-      {  0.671173915824726, -0.724546042342154,  0.020225369854924 },
-      { -0.946627873482572,  0.671173915824726,  0.020225369854924 },
-      { -0.880607781701986,  0.859512343113706,  0.007147818771900 },
-      {  0.859512343113706, -0.978904561411718,  0.007147818771900 },
-      { -0.978904561411718, -0.880607781701986,  0.007147818771900 },
-      { -0.880607781701986, -0.978904561411718,  0.007147818771900 },
-      {  0.859512343113706, -0.880607781701986,  0.007147818771900 },
-      { -0.978904561411718,  0.859512343113706,  0.007147818771900 }
+      { -0.636232792606235,  0.272465585212471,  0.044870579514495 },
+      {  0.272465585212471, -0.636232792606235,  0.044870579514495 },
+      { -0.636232792606235, -0.636232792606235,  0.044870579514495 },
+      { -0.257361406322020, -0.485277187355960,  0.054912968573962 },
+      { -0.485277187355960, -0.257361406322020,  0.054912968573962 },
+      { -0.257361406322020, -0.257361406322020,  0.054912968573962 },
+      { -0.799608509700717,  0.599217019401434,  0.028589673119321 },
+      {  0.599217019401434, -0.799608509700717,  0.028589673119321 },
+      { -0.799608509700717, -0.799608509700717,  0.028589673119321 },
+      { -0.975851023422270,  0.951702046844539,  0.003827897927932 },
+      {  0.951702046844539, -0.975851023422270,  0.003827897927932 },
+      { -0.975851023422270, -0.975851023422270,  0.003827897927932 },
+      { -0.058890806003609, -0.882218387992783,  0.036152804321621 },
+      { -0.882218387992783, -0.058890806003609,  0.036152804321621 },
+      { -0.058890806003609, -0.058890806003609,  0.036152804321621 },
+      { -0.907429161734359,  0.814858323468717,  0.013303283018599 },
+      {  0.814858323468717, -0.907429161734359,  0.013303283018599 },
+      { -0.907429161734359, -0.907429161734359,  0.013303283018599 },
+      { -0.138634441118069, -0.722731117763861,  0.049099380834893 },
+      { -0.722731117763861, -0.138634441118069,  0.049099380834893 },
+      { -0.138634441118069, -0.138634441118069,  0.049099380834893 },
+      { -0.750509031013058,  0.688772526937036,  0.017485358356845 },
+      {  0.688772526937036, -0.750509031013058,  0.017485358356845 },
+      { -0.938263495923979,  0.688772526937036,  0.017485358356845 },
+      {  0.688772526937036, -0.938263495923979,  0.017485358356845 },
+      { -0.938263495923979, -0.750509031013058,  0.017485358356845 },
+      { -0.750509031013058, -0.938263495923979,  0.017485358356845 },
+      {  0.423012423024711, -0.600835744494869,  0.033666247879732 },
+      { -0.600835744494869,  0.423012423024711,  0.033666247879732 },
+      { -0.822176678529841, -0.600835744494869,  0.033666247879732 },
+      { -0.600835744494869, -0.822176678529841,  0.033666247879732 },
+      { -0.822176678529841,  0.423012423024711,  0.033666247879732 },
+      {  0.423012423024711, -0.822176678529841,  0.033666247879732 },
+      { -0.977928545847903,  0.124617756425807,  0.015177642038557 },
+      {  0.124617756425807, -0.977928545847903,  0.015177642038557 },
+      { -0.146689210577904,  0.124617756425807,  0.015177642038557 },
+      {  0.124617756425807, -0.146689210577904,  0.015177642038557 },
+      { -0.146689210577904, -0.977928545847903,  0.015177642038557 },
+      { -0.977928545847903, -0.146689210577904,  0.015177642038557 },
+      { -0.940377263831657,  0.490844915064755,  0.018386144086888 },
+      {  0.490844915064755, -0.940377263831657,  0.018386144086888 },
+      { -0.550467651233097,  0.490844915064755,  0.018386144086888 },
+      {  0.490844915064755, -0.550467651233097,  0.018386144086888 },
+      { -0.550467651233097, -0.940377263831657,  0.018386144086888 },
+      { -0.940377263831657, -0.550467651233097,  0.018386144086888 },
+      { -0.870050232658786, -0.987005398607474,  0.005433909520489 },
+      { -0.987005398607474, -0.870050232658786,  0.005433909520489 },
+      {  0.857055631266259, -0.987005398607474,  0.005433909520489 },
+      { -0.987005398607474,  0.857055631266259,  0.005433909520489 },
+      {  0.857055631266259, -0.870050232658786,  0.005433909520489 },
+      { -0.870050232658786,  0.857055631266259,  0.005433909520489 },
+      { -0.900461971910046, -0.325250107593843,  0.029543576995500 },
+      { -0.325250107593843, -0.900461971910046,  0.029543576995500 },
+      {  0.225712079503889, -0.325250107593843,  0.029543576995500 },
+      { -0.325250107593843,  0.225712079503889,  0.029543576995500 },
+      {  0.225712079503889, -0.900461971910046,  0.029543576995500 },
+      { -0.900461971910046,  0.225712079503889,  0.029543576995500 },
+      { -0.665392600618644, -0.997441028839760,  0.004476576682157 },
+      { -0.997441028839760, -0.665392600618644,  0.004476576682157 },
+      {  0.662833629458405, -0.997441028839760,  0.004476576682157 },
+      { -0.997441028839760,  0.662833629458405,  0.004476576682157 },
+      {  0.662833629458405, -0.665392600618644,  0.004476576682157 },
+      { -0.665392600618644,  0.662833629458405,  0.004476576682157 },
+      { -0.417401454343521, -0.580290848509803,  0.042996561753716 },
+      { -0.580290848509803, -0.417401454343521,  0.042996561753716 },
+      { -0.002307697146676, -0.580290848509803,  0.042996561753716 },
+      { -0.580290848509803, -0.002307697146676,  0.042996561753716 },
+      { -0.002307697146676, -0.417401454343521,  0.042996561753716 },
+      { -0.417401454343521, -0.002307697146676,  0.042996561753716 },
+      { -0.404792301757411, -0.985767317431711,  0.009525380663011 },
+      { -0.985767317431711, -0.404792301757411,  0.009525380663011 },
+      {  0.390559619189122, -0.985767317431711,  0.009525380663011 },
+      { -0.985767317431711,  0.390559619189122,  0.009525380663011 },
+      {  0.390559619189122, -0.404792301757411,  0.009525380663011 },
+      { -0.404792301757411,  0.390559619189122,  0.009525380663011 },
+      {  0.144227278393845, -0.382354890578270,  0.041263641701027 },
+      { -0.382354890578270,  0.144227278393845,  0.041263641701027 },
+      { -0.761872387815575, -0.382354890578270,  0.041263641701027 },
+      { -0.382354890578270, -0.761872387815575,  0.041263641701027 },
+      { -0.761872387815575,  0.144227278393845,  0.041263641701027 },
+      {  0.144227278393845, -0.761872387815575,  0.041263641701027 }
+    };
+
+    static double3 std_pts_21_2d_tri[] =
+    {
+      { -0.278677432953283, -0.442645134093434,  0.032873257253970 },
+      { -0.442645134093434, -0.278677432953283,  0.032873257253970 },
+      { -0.278677432953283, -0.278677432953283,  0.032873257253970 },
+      { -0.892321245850303,  0.784642491700607,  0.014303359751490 },
+      {  0.784642491700607, -0.892321245850303,  0.014303359751490 },
+      { -0.892321245850303, -0.892321245850303,  0.014303359751490 },
+      { -0.777816742050834,  0.555633484101667,  0.024495580611958 },
+      {  0.555633484101667, -0.777816742050834,  0.024495580611958 },
+      { -0.777816742050834, -0.777816742050834,  0.024495580611958 },
+      { -0.133142541474599, -0.733714917050801,  0.043354171163892 },
+      { -0.733714917050801, -0.133142541474599,  0.043354171163892 },
+      { -0.133142541474599, -0.133142541474599,  0.043354171163892 },
+      { -0.010719191660806, -0.978561616678388,  0.014962170265253 },
+      { -0.978561616678388, -0.010719191660806,  0.014962170265253 },
+      { -0.010719191660806, -0.010719191660806,  0.014962170265253 },
+      { -0.056504893332065, -0.886990213335870,  0.031864787344400 },
+      { -0.886990213335870, -0.056504893332065,  0.031864787344400 },
+      { -0.056504893332065, -0.056504893332065,  0.031864787344400 },
+      {  0.956037226227377, -0.983101354815602,  0.001576913387873 },
+      { -0.983101354815602,  0.956037226227377,  0.001576913387873 },
+      { -0.972935871411775, -0.983101354815602,  0.001576913387873 },
+      { -0.983101354815602, -0.972935871411775,  0.001576913387873 },
+      { -0.972935871411775,  0.956037226227377,  0.001576913387873 },
+      {  0.956037226227377, -0.972935871411775,  0.001576913387873 },
+      { -0.294618915231317, -0.915488563292811,  0.024537669694720 },
+      { -0.915488563292811, -0.294618915231317,  0.024537669694720 },
+      {  0.210107478524128, -0.915488563292811,  0.024537669694720 },
+      { -0.915488563292811,  0.210107478524128,  0.024537669694720 },
+      {  0.210107478524128, -0.294618915231317,  0.024537669694720 },
+      { -0.294618915231317,  0.210107478524128,  0.024537669694720 },
+      { -0.897897336231672,  0.432126563208804,  0.024528222535250 },
+      {  0.432126563208804, -0.897897336231672,  0.024528222535250 },
+      { -0.534229226977131,  0.432126563208804,  0.024528222535250 },
+      {  0.432126563208804, -0.534229226977131,  0.024528222535250 },
+      { -0.534229226977131, -0.897897336231672,  0.024528222535250 },
+      { -0.897897336231672, -0.534229226977131,  0.024528222535250 },
+      { -0.572500180573594, -0.066967181858221,  0.047471769469908 },
+      { -0.066967181858221, -0.572500180573594,  0.047471769469908 },
+      { -0.360532637568185, -0.066967181858221,  0.047471769469908 },
+      { -0.066967181858221, -0.360532637568185,  0.047471769469908 },
+      { -0.360532637568185, -0.572500180573594,  0.047471769469908 },
+      { -0.572500180573594, -0.360532637568185,  0.047471769469908 },
+      {  0.164176146644596, -0.528352428296350,  0.027860255989872 },
+      { -0.528352428296350,  0.164176146644596,  0.027860255989872 },
+      { -0.635823718348246, -0.528352428296350,  0.027860255989872 },
+      { -0.528352428296350, -0.635823718348246,  0.027860255989872 },
+      { -0.635823718348246,  0.164176146644596,  0.027860255989872 },
+      {  0.164176146644596, -0.635823718348246,  0.027860255989872 },
+      {  0.262272518829901, -0.984475146656678,  0.010558969250649 },
+      { -0.984475146656678,  0.262272518829901,  0.010558969250649 },
+      { -0.277797372173223, -0.984475146656678,  0.010558969250649 },
+      { -0.984475146656678, -0.277797372173223,  0.010558969250649 },
+      { -0.277797372173223,  0.262272518829901,  0.010558969250649 },
+      {  0.262272518829901, -0.277797372173223,  0.010558969250649 },
+      { -0.733877178172833, -0.983424250516686,  0.007838974281869 },
+      { -0.983424250516686, -0.733877178172833,  0.007838974281869 },
+      {  0.717301428689520, -0.983424250516686,  0.007838974281869 },
+      { -0.983424250516686,  0.717301428689520,  0.007838974281869 },
+      {  0.717301428689520, -0.733877178172833,  0.007838974281869 },
+      { -0.733877178172833,  0.717301428689520,  0.007838974281869 },
+      {  0.369185755759391, -0.767628394526980,  0.031208804231706 },
+      { -0.767628394526980,  0.369185755759391,  0.031208804231706 },
+      { -0.601557361232411, -0.767628394526980,  0.031208804231706 },
+      { -0.767628394526980, -0.601557361232411,  0.031208804231706 },
+      { -0.601557361232411,  0.369185755759391,  0.031208804231706 },
+      {  0.369185755759391, -0.601557361232411,  0.031208804231706 },
+      { -0.736776132569909,  0.646682600690796,  0.019029455396957 },
+      {  0.646682600690796, -0.736776132569909,  0.019029455396957 },
+      { -0.909906468120886,  0.646682600690796,  0.019029455396957 },
+      {  0.646682600690796, -0.909906468120886,  0.019029455396957 },
+      { -0.909906468120886, -0.736776132569909,  0.019029455396957 },
+      { -0.736776132569909, -0.909906468120886,  0.019029455396957 },
+      {  0.506325496994033, -0.526373089941105,  0.011767353995719 },
+      { -0.526373089941105,  0.506325496994033,  0.011767353995719 },
+      { -0.979952407052928, -0.526373089941105,  0.011767353995719 },
+      { -0.526373089941105, -0.979952407052928,  0.011767353995719 },
+      { -0.979952407052928,  0.506325496994033,  0.011767353995719 },
+      {  0.506325496994033, -0.979952407052928,  0.011767353995719 },
+      { -0.354577171292512,  0.138122419058583,  0.039397829570617 },
+      {  0.138122419058583, -0.354577171292512,  0.039397829570617 },
+      { -0.783545247766071,  0.138122419058583,  0.039397829570617 },
+      {  0.138122419058583, -0.783545247766071,  0.039397829570617 },
+      { -0.783545247766071, -0.354577171292512,  0.039397829570617 },
+      { -0.354577171292512, -0.783545247766071,  0.039397829570617 },
+      { -0.978670365806690,  0.865773415641893,  0.006630452332711 },
+      {  0.865773415641893, -0.978670365806690,  0.006630452332711 },
+      { -0.887103049835203,  0.865773415641893,  0.006630452332711 },
+      {  0.865773415641893, -0.887103049835203,  0.006630452332711 },
+      { -0.887103049835203, -0.978670365806690,  0.006630452332711 },
+      { -0.978670365806690, -0.887103049835203,  0.006630452332711 }
+    };
+
+    static double3 std_pts_22_2d_tri[] =
+    {
+      { -0.333333333333333, -0.333333333333333,  0.037373177939084 },
+      { -0.992050369750853,  0.984100739501707,  0.000722216862919 },
+      {  0.984100739501707, -0.992050369750853,  0.000722216862919 },
+      { -0.992050369750853, -0.992050369750853,  0.000722216862919 },
+      { -0.816181844875241, -0.027940054777095,  0.022400163598515 },
+      { -0.027940054777095, -0.816181844875241,  0.022400163598515 },
+      { -0.155878100347664, -0.027940054777095,  0.022400163598515 },
+      { -0.027940054777095, -0.155878100347664,  0.022400163598515 },
+      { -0.155878100347664, -0.816181844875241,  0.022400163598515 },
+      { -0.816181844875241, -0.155878100347664,  0.022400163598515 },
+      { -0.747325495603893, -0.848396301458348,  0.020336410056903 },
+      { -0.848396301458348, -0.747325495603893,  0.020336410056903 },
+      {  0.595721797062242, -0.848396301458348,  0.020336410056903 },
+      { -0.848396301458348,  0.595721797062242,  0.020336410056903 },
+      {  0.595721797062242, -0.747325495603893,  0.020336410056903 },
+      { -0.747325495603893,  0.595721797062242,  0.020336410056903 },
+      { -0.121254666984183, -0.933605300621446,  0.014338920500097 },
+      { -0.933605300621446, -0.121254666984183,  0.014338920500097 },
+      {  0.054859967605629, -0.933605300621446,  0.014338920500097 },
+      { -0.933605300621446,  0.054859967605629,  0.014338920500097 },
+      {  0.054859967605629, -0.121254666984183,  0.014338920500097 },
+      { -0.121254666984183,  0.054859967605629,  0.014338920500097 },
+      { -0.981193597853026,  0.910038715904272,  0.004583738523570 },
+      {  0.910038715904272, -0.981193597853026,  0.004583738523570 },
+      { -0.928845118051246,  0.910038715904272,  0.004583738523570 },
+      {  0.910038715904272, -0.928845118051246,  0.004583738523570 },
+      { -0.928845118051246, -0.981193597853026,  0.004583738523570 },
+      { -0.981193597853026, -0.928845118051246,  0.004583738523570 },
+      { -0.697339074447626,  0.642188730309192,  0.011677039468259 },
+      {  0.642188730309192, -0.697339074447626,  0.011677039468259 },
+      { -0.944849655861566,  0.642188730309192,  0.011677039468259 },
+      {  0.642188730309192, -0.944849655861566,  0.011677039468259 },
+      { -0.944849655861566, -0.697339074447626,  0.011677039468259 },
+      { -0.697339074447626, -0.944849655861566,  0.011677039468259 },
+      {  0.203396194563643, -0.899375595905028,  0.022148941306794 },
+      { -0.899375595905028,  0.203396194563643,  0.022148941306794 },
+      { -0.304020598658616, -0.899375595905028,  0.022148941306794 },
+      { -0.899375595905028, -0.304020598658616,  0.022148941306794 },
+      { -0.304020598658616,  0.203396194563643,  0.022148941306794 },
+      {  0.203396194563643, -0.304020598658616,  0.022148941306794 },
+      {  0.176086073602369, -0.401841280217520,  0.033414257409601 },
+      { -0.401841280217520,  0.176086073602369,  0.033414257409601 },
+      { -0.774244793384849, -0.401841280217520,  0.033414257409601 },
+      { -0.401841280217520, -0.774244793384849,  0.033414257409601 },
+      { -0.774244793384849,  0.176086073602369,  0.033414257409601 },
+      {  0.176086073602369, -0.774244793384849,  0.033414257409601 },
+      { -0.987524143151600,  0.125823413806410,  0.008402601456276 },
+      {  0.125823413806410, -0.987524143151600,  0.008402601456276 },
+      { -0.138299270654810,  0.125823413806410,  0.008402601456276 },
+      {  0.125823413806410, -0.138299270654810,  0.008402601456276 },
+      { -0.138299270654810, -0.987524143151600,  0.008402601456276 },
+      { -0.987524143151600, -0.138299270654810,  0.008402601456276 },
+      {  0.576159321277377, -0.986508915858283,  0.007294553959045 },
+      { -0.986508915858283,  0.576159321277377,  0.007294553959045 },
+      { -0.589650405419094, -0.986508915858283,  0.007294553959045 },
+      { -0.986508915858283, -0.589650405419094,  0.007294553959045 },
+      { -0.589650405419094,  0.576159321277377,  0.007294553959045 },
+      {  0.576159321277377, -0.589650405419094,  0.007294553959045 },
+      { -0.130980362896566, -0.512935926037952,  0.034915108130008 },
+      { -0.512935926037952, -0.130980362896566,  0.034915108130008 },
+      { -0.356083711065482, -0.512935926037952,  0.034915108130008 },
+      { -0.512935926037952, -0.356083711065482,  0.034915108130008 },
+      { -0.356083711065482, -0.130980362896566,  0.034915108130008 },
+      { -0.130980362896566, -0.356083711065482,  0.034915108130008 },
+      { -0.989144811518935, -0.795438693182407,  0.005014510955582 },
+      { -0.795438693182407, -0.989144811518935,  0.005014510955582 },
+      {  0.784583504701343, -0.795438693182407,  0.005014510955582 },
+      { -0.795438693182407,  0.784583504701343,  0.005014510955582 },
+      {  0.784583504701343, -0.989144811518935,  0.005014510955582 },
+      { -0.989144811518935,  0.784583504701343,  0.005014510955582 },
+      { -0.278734309004343, -0.665574032876811,  0.033899162503963 },
+      { -0.665574032876811, -0.278734309004343,  0.033899162503963 },
+      { -0.055691658118846, -0.665574032876811,  0.033899162503963 },
+      { -0.665574032876811, -0.055691658118846,  0.033899162503963 },
+      { -0.055691658118846, -0.278734309004343,  0.033899162503963 },
+      { -0.278734309004343, -0.055691658118846,  0.033899162503963 },
+      { -0.378800930722785, -0.978308636165733,  0.012459021325235 },
+      { -0.978308636165733, -0.378800930722785,  0.012459021325235 },
+      {  0.357109566888518, -0.978308636165733,  0.012459021325235 },
+      { -0.978308636165733,  0.357109566888518,  0.012459021325235 },
+      {  0.357109566888518, -0.378800930722785,  0.012459021325235 },
+      { -0.378800930722785,  0.357109566888518,  0.012459021325235 },
+      {  0.375909758492480, -0.757838630287256,  0.031990959711417 },
+      { -0.757838630287256,  0.375909758492480,  0.031990959711417 },
+      { -0.618071128205225, -0.757838630287256,  0.031990959711417 },
+      { -0.757838630287256, -0.618071128205225,  0.031990959711417 },
+      { -0.618071128205225,  0.375909758492480,  0.031990959711417 },
+      {  0.375909758492480, -0.618071128205225,  0.031990959711417 },
+      { -0.607625965124741, -0.520173618032797,  0.028409189279844 },
+      { -0.520173618032797, -0.607625965124741,  0.028409189279844 },
+      {  0.127799583157538, -0.520173618032797,  0.028409189279844 },
+      { -0.520173618032797,  0.127799583157538,  0.028409189279844 },
+      {  0.127799583157538, -0.607625965124741,  0.028409189279844 },
+      { -0.607625965124741,  0.127799583157538,  0.028409189279844 },
+      { -0.900637041026117, -0.529469754955280,  0.024325057560415 },
+      { -0.529469754955280, -0.900637041026117,  0.024325057560415 },
+      {  0.430106795981398, -0.529469754955280,  0.024325057560415 },
+      { -0.529469754955280,  0.430106795981398,  0.024325057560415 },
+      {  0.430106795981398, -0.900637041026117,  0.024325057560415 },
+      { -0.900637041026117,  0.430106795981398,  0.024325057560415 },
+      { -0.855805282487753, -0.926885915635166,  0.011133726166503 },
+      { -0.926885915635166, -0.855805282487753,  0.011133726166503 },
+      {  0.782691198122919, -0.926885915635166,  0.011133726166503 },
+      { -0.926885915635166,  0.782691198122919,  0.011133726166503 },
+      {  0.782691198122919, -0.855805282487753,  0.011133726166503 },
+      { -0.855805282487753,  0.782691198122919,  0.011133726166503 }
+    };
+
+    static double3 std_pts_23_2d_tri[] =
+    {
+      { -0.836800371355614,  0.460215808985700,  0.017556413107952 },
+      {  0.460215808985700, -0.836800371355614,  0.017556413107952 },
+      { -0.623415437630086,  0.460215808985700,  0.017556413107952 },
+      {  0.460215808985700, -0.623415437630086,  0.017556413107952 },
+      { -0.623415437630086, -0.836800371355614,  0.017556413107952 },
+      { -0.836800371355614, -0.623415437630086,  0.017556413107952 },
+      { -0.569006035120999, -0.413633142995107,  0.028103637500846 },
+      { -0.413633142995107, -0.569006035120999,  0.028103637500846 },
+      { -0.017360821883894, -0.413633142995107,  0.028103637500846 },
+      { -0.413633142995107, -0.017360821883894,  0.028103637500846 },
+      { -0.017360821883894, -0.569006035120999,  0.028103637500846 },
+      { -0.569006035120999, -0.017360821883894,  0.028103637500846 },
+      { -0.380375009305603, -0.983204977892801,  0.010119540879706 },
+      { -0.983204977892801, -0.380375009305603,  0.010119540879706 },
+      {  0.363579987198404, -0.983204977892801,  0.010119540879706 },
+      { -0.983204977892801,  0.363579987198404,  0.010119540879706 },
+      {  0.363579987198404, -0.380375009305603,  0.010119540879706 },
+      { -0.380375009305603,  0.363579987198404,  0.010119540879706 },
+      { -0.780507587017670,  0.062280309881190,  0.028037308547854 },
+      {  0.062280309881190, -0.780507587017670,  0.028037308547854 },
+      { -0.281772722863521,  0.062280309881190,  0.028037308547854 },
+      {  0.062280309881190, -0.281772722863521,  0.028037308547854 },
+      { -0.281772722863521, -0.780507587017670,  0.028037308547854 },
+      { -0.780507587017670, -0.281772722863521,  0.028037308547854 },
+      { -0.925381094176648,  0.068269285833371,  0.016591857895016 },
+      {  0.068269285833371, -0.925381094176648,  0.016591857895016 },
+      { -0.142888191656723,  0.068269285833371,  0.016591857895016 },
+      {  0.068269285833371, -0.142888191656723,  0.016591857895016 },
+      { -0.142888191656723, -0.925381094176648,  0.016591857895016 },
+      { -0.925381094176648, -0.142888191656723,  0.016591857895016 },
+      { -0.804069248349856,  0.797839376715602,  0.003152453591040 },
+      {  0.797839376715602, -0.804069248349856,  0.003152453591040 },
+      { -0.993770128365746,  0.797839376715602,  0.003152453591040 },
+      {  0.797839376715602, -0.993770128365746,  0.003152453591040 },
+      { -0.993770128365746, -0.804069248349856,  0.003152453591040 },
+      { -0.804069248349856, -0.993770128365746,  0.003152453591040 },
+      {  0.596340299145371, -0.605421526027192,  0.005527039119061 },
+      { -0.605421526027192,  0.596340299145371,  0.005527039119061 },
+      { -0.990918773118180, -0.605421526027192,  0.005527039119061 },
+      { -0.605421526027192, -0.990918773118180,  0.005527039119061 },
+      { -0.990918773118180,  0.596340299145371,  0.005527039119061 },
+      {  0.596340299145371, -0.990918773118180,  0.005527039119061 },
+      { -0.809152886980538, -0.472628451987755,  0.024084266707920 },
+      { -0.472628451987755, -0.809152886980538,  0.024084266707920 },
+      {  0.281781338968293, -0.472628451987755,  0.024084266707920 },
+      { -0.472628451987755,  0.281781338968293,  0.024084266707920 },
+      {  0.281781338968293, -0.809152886980538,  0.024084266707920 },
+      { -0.809152886980538,  0.281781338968293,  0.024084266707920 },
+      { -0.918012017789452, -0.863086129220748,  0.008359407235026 },
+      { -0.863086129220748, -0.918012017789452,  0.008359407235026 },
+      {  0.781098147010200, -0.863086129220748,  0.008359407235026 },
+      { -0.863086129220748,  0.781098147010200,  0.008359407235026 },
+      {  0.781098147010200, -0.918012017789452,  0.008359407235026 },
+      { -0.918012017789452,  0.781098147010200,  0.008359407235026 },
+      { -0.021148122440530, -0.836266744282014,  0.013537535150534 },
+      { -0.836266744282014, -0.021148122440530,  0.013537535150534 },
+      { -0.142585133277456, -0.836266744282014,  0.013537535150534 },
+      { -0.836266744282014, -0.142585133277456,  0.013537535150534 },
+      { -0.142585133277456, -0.021148122440530,  0.013537535150534 },
+      { -0.021148122440530, -0.142585133277456,  0.013537535150534 },
+      {  0.495550729016043, -0.561853911236630,  0.016707148355991 },
+      { -0.561853911236630,  0.495550729016043,  0.016707148355991 },
+      { -0.933696817779412, -0.561853911236630,  0.016707148355991 },
+      { -0.561853911236630, -0.933696817779412,  0.016707148355991 },
+      { -0.933696817779412,  0.495550729016043,  0.016707148355991 },
+      {  0.495550729016043, -0.933696817779412,  0.016707148355991 },
+      {  0.609421740887689, -0.758249240734837,  0.016891744492714 },
+      { -0.758249240734837,  0.609421740887689,  0.016891744492714 },
+      { -0.851172500152852, -0.758249240734837,  0.016891744492714 },
+      { -0.758249240734837, -0.851172500152852,  0.016891744492714 },
+      { -0.851172500152852,  0.609421740887689,  0.016891744492714 },
+      {  0.609421740887689, -0.851172500152852,  0.016891744492714 },
+      {  0.260004462691666, -0.910733870546486,  0.021058245139362 },
+      { -0.910733870546486,  0.260004462691666,  0.021058245139362 },
+      { -0.349270592145181, -0.910733870546486,  0.021058245139362 },
+      { -0.910733870546486, -0.349270592145181,  0.021058245139362 },
+      { -0.349270592145181,  0.260004462691666,  0.021058245139362 },
+      {  0.260004462691666, -0.349270592145181,  0.021058245139362 },
+      {  0.170639019848791, -0.664438747095053,  0.030958837045947 },
+      { -0.664438747095053,  0.170639019848791,  0.030958837045947 },
+      { -0.506200272753738, -0.664438747095053,  0.030958837045947 },
+      { -0.664438747095053, -0.506200272753738,  0.030958837045947 },
+      { -0.506200272753738,  0.170639019848791,  0.030958837045947 },
+      {  0.170639019848791, -0.506200272753738,  0.030958837045947 },
+      { -0.985049329793450,  0.120283232996222,  0.009632663294398 },
+      {  0.120283232996222, -0.985049329793450,  0.009632663294398 },
+      { -0.135233903202773,  0.120283232996222,  0.009632663294398 },
+      {  0.120283232996222, -0.135233903202773,  0.009632663294398 },
+      { -0.135233903202773, -0.985049329793450,  0.009632663294398 },
+      { -0.985049329793450, -0.135233903202773,  0.009632663294398 },
+      {  0.889525318419018, -0.975904692469910,  0.005137668113083 },
+      { -0.975904692469910,  0.889525318419018,  0.005137668113083 },
+      { -0.913620625949109, -0.975904692469910,  0.005137668113083 },
+      { -0.975904692469910, -0.913620625949109,  0.005137668113083 },
+      { -0.913620625949109,  0.889525318419018,  0.005137668113083 },
+      {  0.889525318419018, -0.913620625949109,  0.005137668113083 },
+      { -0.691124412048961,  0.383220292643303,  0.015201925174288 },
+      {  0.383220292643303, -0.691124412048961,  0.015201925174288 },
+      { -0.692095880594342,  0.383220292643303,  0.015201925174288 },
+      {  0.383220292643303, -0.692095880594342,  0.015201925174288 },
+      { -0.692095880594342, -0.691124412048961,  0.015201925174288 },
+      { -0.691124412048961, -0.692095880594342,  0.015201925174288 },
+      {  0.695642801017977, -0.952270352609670,  0.011130382611836 },
+      { -0.952270352609670,  0.695642801017977,  0.011130382611836 },
+      { -0.743372448408307, -0.952270352609670,  0.011130382611836 },
+      { -0.952270352609670, -0.743372448408307,  0.011130382611836 },
+      { -0.743372448408307,  0.695642801017977,  0.011130382611836 },
+      {  0.695642801017977, -0.743372448408307,  0.011130382611836 },
+      { -0.972488278077693, -0.993129789381176,  0.000976344373394 },
+      { -0.993129789381176, -0.972488278077693,  0.000976344373394 },
+      {  0.965618067458870, -0.993129789381176,  0.000976344373394 },
+      { -0.993129789381176,  0.965618067458870,  0.000976344373394 },
+      {  0.965618067458870, -0.972488278077693,  0.000976344373394 },
+      { -0.972488278077693,  0.965618067458870,  0.000976344373394 },
+      { -0.240590175094343, -0.658716831459415,  0.025352346804825 },
+      { -0.658716831459415, -0.240590175094343,  0.025352346804825 },
+      { -0.100692993446242, -0.658716831459415,  0.025352346804825 },
+      { -0.658716831459415, -0.100692993446242,  0.025352346804825 },
+      { -0.100692993446242, -0.240590175094343,  0.025352346804825 },
+      { -0.240590175094343, -0.100692993446242,  0.025352346804825 },
+      { -0.205311690200448, -0.462254106629393,  0.025216568192539 },
+      { -0.462254106629393, -0.205311690200448,  0.025216568192539 },
+      { -0.332434203170159, -0.462254106629393,  0.025216568192539 },
+      { -0.462254106629393, -0.332434203170159,  0.025216568192539 },
+      { -0.332434203170159, -0.205311690200448,  0.025216568192539 },
+      { -0.205311690200448, -0.332434203170159,  0.025216568192539 }
+    };
+
+    static double3 std_pts_25_2d_tri[] =
+    {
+      { -0.679039312073548,  0.358078624147097,  0.026261210750014 },
+      {  0.358078624147097, -0.679039312073548,  0.026261210750014 },
+      { -0.679039312073548, -0.679039312073548,  0.026261210750014 },
+      { -0.267869867241921, -0.464260265516159,  0.039262830358818 },
+      { -0.464260265516159, -0.267869867241921,  0.039262830358818 },
+      { -0.267869867241921, -0.267869867241921,  0.039262830358818 },
+      { -0.495538212640683, -0.008923574718634,  0.023065499944063 },
+      { -0.008923574718634, -0.495538212640683,  0.023065499944063 },
+      { -0.495538212640683, -0.495538212640683,  0.023065499944063 },
+      {  0.504395765147367, -0.821431250363634,  0.016530123310535 },
+      { -0.821431250363634,  0.504395765147367,  0.016530123310535 },
+      { -0.682964514783732, -0.821431250363634,  0.016530123310535 },
+      { -0.821431250363634, -0.682964514783732,  0.016530123310535 },
+      { -0.682964514783732,  0.504395765147367,  0.016530123310535 },
+      {  0.504395765147367, -0.682964514783732,  0.016530123310535 },
+      { -0.840597244494251, -0.323838198052258,  0.019783345882251 },
+      { -0.323838198052258, -0.840597244494251,  0.019783345882251 },
+      {  0.164435442546509, -0.323838198052258,  0.019783345882251 },
+      { -0.323838198052258,  0.164435442546509,  0.019783345882251 },
+      {  0.164435442546509, -0.840597244494251,  0.019783345882251 },
+      { -0.840597244494251,  0.164435442546509,  0.019783345882251 },
+      { -0.423486456997740, -0.893979646972629,  0.007290565083066 },
+      { -0.893979646972629, -0.423486456997740,  0.007290565083066 },
+      {  0.317466103970369, -0.893979646972629,  0.007290565083066 },
+      { -0.893979646972629,  0.317466103970369,  0.007290565083066 },
+      {  0.317466103970369, -0.423486456997740,  0.007290565083066 },
+      { -0.423486456997740,  0.317466103970369,  0.007290565083066 },
+      { -0.836029379539134,  0.632789418947826,  0.008769052622679 },
+      {  0.632789418947826, -0.836029379539134,  0.008769052622679 },
+      { -0.796760039408692,  0.632789418947826,  0.008769052622679 },
+      {  0.632789418947826, -0.796760039408692,  0.008769052622679 },
+      { -0.796760039408692, -0.836029379539134,  0.008769052622679 },
+      { -0.836029379539134, -0.796760039408692,  0.008769052622679 },
+      { -0.948806146417762, -0.944393787285226,  0.002600520640335 },
+      { -0.944393787285226, -0.948806146417762,  0.002600520640335 },
+      {  0.893199933702987, -0.944393787285226,  0.002600520640335 },
+      { -0.944393787285226,  0.893199933702987,  0.002600520640335 },
+      {  0.893199933702987, -0.948806146417762,  0.002600520640335 },
+      { -0.948806146417762,  0.893199933702987,  0.002600520640335 },
+      {  0.038209445065492, -0.916848331844293,  0.015359925645734 },
+      { -0.916848331844293,  0.038209445065492,  0.015359925645734 },
+      { -0.121361113221199, -0.916848331844293,  0.015359925645734 },
+      { -0.916848331844293, -0.121361113221199,  0.015359925645734 },
+      { -0.121361113221199,  0.038209445065492,  0.015359925645734 },
+      {  0.038209445065492, -0.121361113221199,  0.015359925645734 },
+      { -0.181146505465359, -0.801817959112005,  0.022021053218555 },
+      { -0.801817959112005, -0.181146505465359,  0.022021053218555 },
+      { -0.017035535422636, -0.801817959112005,  0.022021053218555 },
+      { -0.801817959112005, -0.017035535422636,  0.022021053218555 },
+      { -0.017035535422636, -0.181146505465359,  0.022021053218555 },
+      { -0.181146505465359, -0.017035535422636,  0.022021053218555 },
+      { -0.086884960161650, -0.401625453243547,  0.013103933889603 },
+      { -0.401625453243547, -0.086884960161650,  0.013103933889603 },
+      { -0.511489586594802, -0.401625453243547,  0.013103933889603 },
+      { -0.401625453243547, -0.511489586594802,  0.013103933889603 },
+      { -0.511489586594802, -0.086884960161650,  0.013103933889603 },
+      { -0.086884960161650, -0.511489586594802,  0.013103933889603 },
+      { -0.926180969399055,  0.770194988073919,  0.010609351406536 },
+      {  0.770194988073919, -0.926180969399055,  0.010609351406536 },
+      { -0.844014018674865,  0.770194988073919,  0.010609351406536 },
+      {  0.770194988073919, -0.844014018674865,  0.010609351406536 },
+      { -0.844014018674865, -0.926180969399055,  0.010609351406536 },
+      { -0.926180969399055, -0.844014018674865,  0.010609351406536 },
+      { -0.064782533057277, -0.280525908397054,  0.035007897924518 },
+      { -0.280525908397054, -0.064782533057277,  0.035007897924518 },
+      { -0.654691558545669, -0.280525908397054,  0.035007897924518 },
+      { -0.280525908397054, -0.654691558545669,  0.035007897924518 },
+      { -0.654691558545669, -0.064782533057277,  0.035007897924518 },
+      { -0.064782533057277, -0.654691558545669,  0.035007897924518 },
+      {  0.155786353345341, -0.730715473424910,  0.019297686563420 },
+      { -0.730715473424910,  0.155786353345341,  0.019297686563420 },
+      { -0.425070879920431, -0.730715473424910,  0.019297686563420 },
+      { -0.730715473424910, -0.425070879920431,  0.019297686563420 },
+      { -0.425070879920431,  0.155786353345341,  0.019297686563420 },
+      {  0.155786353345341, -0.425070879920431,  0.019297686563420 },
+      { -0.597010927765359, -0.986484247892865,  0.006258427787078 },
+      { -0.986484247892865, -0.597010927765359,  0.006258427787078 },
+      {  0.583495175658224, -0.986484247892865,  0.006258427787078 },
+      { -0.986484247892865,  0.583495175658224,  0.006258427787078 },
+      {  0.583495175658224, -0.597010927765359,  0.006258427787078 },
+      { -0.597010927765359,  0.583495175658224,  0.006258427787078 },
+      { -0.270486335895426,  0.263404683521707,  0.003017817573939 },
+      {  0.263404683521707, -0.270486335895426,  0.003017817573939 },
+      { -0.992918347626281,  0.263404683521707,  0.003017817573939 },
+      {  0.263404683521707, -0.992918347626281,  0.003017817573939 },
+      { -0.992918347626281, -0.270486335895426,  0.003017817573939 },
+      { -0.270486335895426, -0.992918347626281,  0.003017817573939 },
+      { -0.927486743396816, -0.522558539515728,  0.014061640897884 },
+      { -0.522558539515728, -0.927486743396816,  0.014061640897884 },
+      {  0.450045282912544, -0.522558539515728,  0.014061640897884 },
+      { -0.522558539515728,  0.450045282912544,  0.014061640897884 },
+      {  0.450045282912544, -0.927486743396816,  0.014061640897884 },
+      { -0.927486743396816,  0.450045282912544,  0.014061640897884 },
+      { -0.983997357642776, -0.107886601495098,  0.007938324551214 },
+      { -0.107886601495098, -0.983997357642776,  0.007938324551214 },
+      {  0.091883959137874, -0.107886601495098,  0.007938324551214 },
+      { -0.107886601495098,  0.091883959137874,  0.007938324551214 },
+      {  0.091883959137874, -0.983997357642776,  0.007938324551214 },
+      { -0.983997357642776,  0.091883959137874,  0.007938324551214 },
+      { -0.517097728656913,  0.165980651813480,  0.022697557351907 },
+      {  0.165980651813480, -0.517097728656913,  0.022697557351907 },
+      { -0.648882923156567,  0.165980651813480,  0.022697557351907 },
+      {  0.165980651813480, -0.648882923156567,  0.022697557351907 },
+      { -0.648882923156567, -0.517097728656913,  0.022697557351907 },
+      { -0.517097728656913, -0.648882923156567,  0.022697557351907 },
+      { -0.984984996185143,  0.746911144185795,  0.005607011917228 },
+      {  0.746911144185795, -0.984984996185143,  0.005607011917228 },
+      { -0.761926148000652,  0.746911144185795,  0.005607011917228 },
+      {  0.746911144185795, -0.761926148000652,  0.005607011917228 },
+      { -0.761926148000652, -0.984984996185143,  0.005607011917228 },
+      { -0.984984996185143, -0.761926148000652,  0.005607011917228 },
+      { -0.987416471031561, -0.887938918779310,  0.003415599563805 },
+      { -0.887938918779310, -0.987416471031561,  0.003415599563805 },
+      {  0.875355389810871, -0.887938918779310,  0.003415599563805 },
+      { -0.887938918779310,  0.875355389810871,  0.003415599563805 },
+      {  0.875355389810871, -0.987416471031561,  0.003415599563805 },
+      { -0.987416471031561,  0.875355389810871,  0.003415599563805 },
+      { -0.815283940546522,  0.353188661019330,  0.020685173912680 },
+      {  0.353188661019330, -0.815283940546522,  0.020685173912680 },
+      { -0.537904720472807,  0.353188661019330,  0.020685173912680 },
+      {  0.353188661019330, -0.537904720472807,  0.020685173912680 },
+      { -0.537904720472807, -0.815283940546522,  0.020685173912680 },
+      { -0.815283940546522, -0.537904720472807,  0.020685173912680 },
+      { -0.994527775547861,  0.965088183797795,  0.001010940054715 },
+      {  0.965088183797795, -0.994527775547861,  0.001010940054715 },
+      { -0.970560408249934,  0.965088183797795,  0.001010940054715 },
+      {  0.965088183797795, -0.970560408249934,  0.001010940054715 },
+      { -0.970560408249934, -0.994527775547861,  0.001010940054715 },
+      { -0.994527775547861, -0.970560408249934,  0.001010940054715 },
+      { -0.418020541699507, -0.984240852487666,  0.006672781123645 },
+      { -0.984240852487666, -0.418020541699507,  0.006672781123645 },
+      {  0.402261394187173, -0.984240852487666,  0.006672781123645 },
+      { -0.984240852487666,  0.402261394187173,  0.006672781123645 },
+      {  0.402261394187173, -0.418020541699507,  0.006672781123645 },
+      { -0.418020541699507,  0.402261394187173,  0.006672781123645 },
+      { -0.925639969372347,  0.618394027860557,  0.013580454696905 },
+      {  0.618394027860557, -0.925639969372347,  0.013580454696905 },
+      { -0.692754058488210,  0.618394027860557,  0.013580454696905 },
+      {  0.618394027860557, -0.692754058488210,  0.013580454696905 },
+      { -0.692754058488210, -0.925639969372347,  0.013580454696905 },
+      { -0.925639969372347, -0.692754058488210,  0.013580454696905 },
+      { -0.941431475675124,  0.234059710601718,  0.013719377188652 },
+      {  0.234059710601718, -0.941431475675124,  0.013719377188652 },
+      { -0.292628234926594,  0.234059710601718,  0.013719377188652 },
+      {  0.234059710601718, -0.292628234926594,  0.013719377188652 },
+      { -0.292628234926594, -0.941431475675124,  0.013719377188652 },
+      { -0.941431475675124, -0.292628234926594,  0.013719377188652 }
+    };
+
+    static double3 std_pts_27_2d_tri[] =
+    {
+      { -0.333333333333333, -0.333333333333333,  0.037772900248784 },
+      { -0.007183315798507, -0.985633368402987,  0.007336201706850 },
+      { -0.985633368402987, -0.007183315798507,  0.007336201706850 },
+      { -0.007183315798507, -0.007183315798507,  0.007336201706850 },
+      { -0.082313328893692, -0.835373342212616,  0.024158337552475 },
+      { -0.835373342212616, -0.082313328893692,  0.024158337552475 },
+      { -0.082313328893692, -0.082313328893692,  0.024158337552475 },
+      { -0.638964894199056,  0.277929788398112,  0.026863255270778 },
+      {  0.277929788398112, -0.638964894199056,  0.026863255270778 },
+      { -0.638964894199056, -0.638964894199056,  0.026863255270778 },
+      { -0.785127976360393, -0.686897104355565,  0.017835417829834 },
+      { -0.686897104355565, -0.785127976360393,  0.017835417829834 },
+      {  0.472025080715958, -0.686897104355565,  0.017835417829834 },
+      { -0.686897104355565,  0.472025080715958,  0.017835417829834 },
+      {  0.472025080715958, -0.785127976360393,  0.017835417829834 },
+      { -0.785127976360393,  0.472025080715958,  0.017835417829834 },
+      { -0.609949194513590,  0.488846627979008,  0.013528631930730 },
+      {  0.488846627979008, -0.609949194513590,  0.013528631930730 },
+      { -0.878897433465419,  0.488846627979008,  0.013528631930730 },
+      {  0.488846627979008, -0.878897433465419,  0.013528631930730 },
+      { -0.878897433465419, -0.609949194513590,  0.013528631930730 },
+      { -0.609949194513590, -0.878897433465419,  0.013528631930730 },
+      { -0.521138871991849, -0.341552043619270,  0.035661081354367 },
+      { -0.341552043619270, -0.521138871991849,  0.035661081354367 },
+      { -0.137309084388881, -0.341552043619270,  0.035661081354367 },
+      { -0.341552043619270, -0.137309084388881,  0.035661081354367 },
+      { -0.137309084388881, -0.521138871991849,  0.035661081354367 },
+      { -0.521138871991849, -0.137309084388881,  0.035661081354367 },
+      { -0.782003096962808,  0.646516499552127,  0.013163956362918 },
+      {  0.646516499552127, -0.782003096962808,  0.013163956362918 },
+      { -0.864513402589319,  0.646516499552127,  0.013163956362918 },
+      {  0.646516499552127, -0.864513402589319,  0.013163956362918 },
+      { -0.864513402589319, -0.782003096962808,  0.013163956362918 },
+      { -0.782003096962808, -0.864513402589319,  0.013163956362918 },
+      {  0.076370996989316, -0.145288892645264,  0.016624755477056 },
+      { -0.145288892645264,  0.076370996989316,  0.016624755477056 },
+      { -0.931082104344053, -0.145288892645264,  0.016624755477056 },
+      { -0.145288892645264, -0.931082104344053,  0.016624755477056 },
+      { -0.931082104344053,  0.076370996989316,  0.016624755477056 },
+      {  0.076370996989316, -0.931082104344053,  0.016624755477056 },
+      { -0.929678693164018,  0.790520854794918,  0.008495375139933 },
+      {  0.790520854794918, -0.929678693164018,  0.008495375139933 },
+      { -0.860842161630901,  0.790520854794918,  0.008495375139933 },
+      {  0.790520854794918, -0.860842161630901,  0.008495375139933 },
+      { -0.860842161630901, -0.929678693164018,  0.008495375139933 },
+      { -0.929678693164018, -0.860842161630901,  0.008495375139933 },
+      {  0.082671106064692, -0.270882831439236,  0.015610794052940 },
+      { -0.270882831439236,  0.082671106064692,  0.015610794052940 },
+      { -0.811788274625455, -0.270882831439236,  0.015610794052940 },
+      { -0.270882831439236, -0.811788274625455,  0.015610794052940 },
+      { -0.811788274625455,  0.082671106064692,  0.015610794052940 },
+      {  0.082671106064692, -0.811788274625455,  0.015610794052940 },
+      {  0.039308060047577, -0.714005547859921,  0.009335132873340 },
+      { -0.714005547859921,  0.039308060047577,  0.009335132873340 },
+      { -0.325302512187657, -0.714005547859921,  0.009335132873340 },
+      { -0.714005547859921, -0.325302512187657,  0.009335132873340 },
+      { -0.325302512187657,  0.039308060047577,  0.009335132873340 },
+      {  0.039308060047577, -0.325302512187657,  0.009335132873340 },
+      {  0.102264805338671, -0.326146185624690,  0.004614612767520 },
+      { -0.326146185624690,  0.102264805338671,  0.004614612767520 },
+      { -0.776118619713981, -0.326146185624690,  0.004614612767520 },
+      { -0.326146185624690, -0.776118619713981,  0.004614612767520 },
+      { -0.776118619713981,  0.102264805338671,  0.004614612767520 },
+      {  0.102264805338671, -0.776118619713981,  0.004614612767520 },
+      {  0.884405217186753, -0.887760537571453,  0.001194934889740 },
+      { -0.887760537571453,  0.884405217186753,  0.001194934889740 },
+      { -0.996644679615300, -0.887760537571453,  0.001194934889740 },
+      { -0.887760537571453, -0.996644679615300,  0.001194934889740 },
+      { -0.996644679615300,  0.884405217186753,  0.001194934889740 },
+      {  0.884405217186753, -0.996644679615300,  0.001194934889740 },
+      {  0.781231610635115, -0.798381017816673,  0.004839803181264 },
+      { -0.798381017816673,  0.781231610635115,  0.004839803181264 },
+      { -0.982850592818442, -0.798381017816673,  0.004839803181264 },
+      { -0.798381017816673, -0.982850592818442,  0.004839803181264 },
+      { -0.982850592818442,  0.781231610635115,  0.004839803181264 },
+      {  0.781231610635115, -0.982850592818442,  0.004839803181264 },
+      { -0.975373208524381, -0.551069393964195,  0.007425293436129 },
+      { -0.551069393964195, -0.975373208524381,  0.007425293436129 },
+      {  0.526442602488575, -0.551069393964195,  0.007425293436129 },
+      { -0.551069393964195,  0.526442602488575,  0.007425293436129 },
+      {  0.526442602488575, -0.975373208524381,  0.007425293436129 },
+      { -0.975373208524381,  0.526442602488575,  0.007425293436129 },
+      {  0.660888824367574, -0.994876770791998,  0.002719842463166 },
+      { -0.994876770791998,  0.660888824367574,  0.002719842463166 },
+      { -0.666012053575576, -0.994876770791998,  0.002719842463166 },
+      { -0.994876770791998, -0.666012053575576,  0.002719842463166 },
+      { -0.666012053575576,  0.660888824367574,  0.002719842463166 },
+      {  0.660888824367574, -0.666012053575576,  0.002719842463166 },
+      {  0.289343962813591, -0.772893350685613,  0.022684278529662 },
+      { -0.772893350685613,  0.289343962813591,  0.022684278529662 },
+      { -0.516450612127978, -0.772893350685613,  0.022684278529662 },
+      { -0.772893350685613, -0.516450612127978,  0.022684278529662 },
+      { -0.516450612127978,  0.289343962813591,  0.022684278529662 },
+      {  0.289343962813591, -0.516450612127978,  0.022684278529662 },
+      {  0.196139637828248, -0.312056365889017,  0.011629082111638 },
+      { -0.312056365889017,  0.196139637828248,  0.011629082111638 },
+      { -0.884083271939232, -0.312056365889017,  0.011629082111638 },
+      { -0.312056365889017, -0.884083271939232,  0.011629082111638 },
+      { -0.884083271939232,  0.196139637828248,  0.011629082111638 },
+      {  0.196139637828248, -0.884083271939232,  0.011629082111638 },
+      {  0.103503567443633, -0.669873908698764,  0.020807896729674 },
+      { -0.669873908698764,  0.103503567443633,  0.020807896729674 },
+      { -0.433629658744869, -0.669873908698764,  0.020807896729674 },
+      { -0.669873908698764, -0.433629658744869,  0.020807896729674 },
+      { -0.433629658744869,  0.103503567443633,  0.020807896729674 },
+      {  0.103503567443633, -0.433629658744869,  0.020807896729674 },
+      { -0.206666681062691,  0.195393351747531,  0.005897100406070 },
+      {  0.195393351747531, -0.206666681062691,  0.005897100406070 },
+      { -0.988726670684840,  0.195393351747531,  0.005897100406070 },
+      {  0.195393351747531, -0.988726670684840,  0.005897100406070 },
+      { -0.988726670684840, -0.206666681062691,  0.005897100406070 },
+      { -0.206666681062691, -0.988726670684840,  0.005897100406070 },
+      {  0.646484245131594, -0.943291884049539,  0.010595121001787 },
+      { -0.943291884049539,  0.646484245131594,  0.010595121001787 },
+      { -0.703192361082055, -0.943291884049539,  0.010595121001787 },
+      { -0.943291884049539, -0.703192361082055,  0.010595121001787 },
+      { -0.703192361082055,  0.646484245131594,  0.010595121001787 },
+      {  0.646484245131594, -0.703192361082055,  0.010595121001787 },
+      { -0.096389189600601, -0.219306783192205,  0.020908154578567 },
+      { -0.219306783192205, -0.096389189600601,  0.020908154578567 },
+      { -0.684304027207194, -0.219306783192205,  0.020908154578567 },
+      { -0.219306783192205, -0.684304027207194,  0.020908154578567 },
+      { -0.684304027207194, -0.096389189600601,  0.020908154578567 },
+      { -0.096389189600601, -0.684304027207194,  0.020908154578567 },
+      {  0.428069884466841, -0.924363901481502,  0.009280596419782 },
+      { -0.924363901481502,  0.428069884466841,  0.009280596419782 },
+      { -0.503705982985338, -0.924363901481502,  0.009280596419782 },
+      { -0.924363901481502, -0.503705982985338,  0.009280596419782 },
+      { -0.503705982985338,  0.428069884466841,  0.009280596419782 },
+      {  0.428069884466841, -0.503705982985338,  0.009280596419782 },
+      { -0.431414888213252, -0.864367964941637,  0.011434207053202 },
+      { -0.864367964941637, -0.431414888213252,  0.011434207053202 },
+      {  0.295782853154889, -0.864367964941637,  0.011434207053202 },
+      { -0.864367964941637,  0.295782853154889,  0.011434207053202 },
+      {  0.295782853154889, -0.431414888213252,  0.011434207053202 },
+      { -0.431414888213252,  0.295782853154889,  0.011434207053202 },
+      { -0.957934935000588, -0.349827073519745,  0.011083746855889 },
+      { -0.349827073519745, -0.957934935000588,  0.011083746855889 },
+      {  0.307762008520333, -0.349827073519745,  0.011083746855889 },
+      { -0.349827073519745,  0.307762008520333,  0.011083746855889 },
+      {  0.307762008520333, -0.957934935000588,  0.011083746855889 },
+      { -0.957934935000588,  0.307762008520333,  0.011083746855889 },
+      { -0.974264533133438, -0.994700629087022,  0.000802589698852 },
+      { -0.994700629087022, -0.974264533133438,  0.000802589698852 },
+      {  0.968965162220460, -0.994700629087022,  0.000802589698852 },
+      { -0.994700629087022,  0.968965162220460,  0.000802589698852 },
+      {  0.968965162220460, -0.974264533133438,  0.000802589698852 },
+      { -0.974264533133438,  0.968965162220460,  0.000802589698852 },
+      { -0.500429231844931,  0.057756946660693,  0.015151997007403 },
+      {  0.057756946660693, -0.500429231844931,  0.015151997007403 },
+      { -0.557327714815762,  0.057756946660693,  0.015151997007403 },
+      {  0.057756946660693, -0.557327714815762,  0.015151997007403 },
+      { -0.557327714815762, -0.500429231844931,  0.015151997007403 },
+      { -0.500429231844931, -0.557327714815762,  0.015151997007403 },
+      { -0.996231210798285,  0.413968079402991,  0.002943138673190 },
+      {  0.413968079402991, -0.996231210798285,  0.002943138673190 },
+      { -0.417736868604706,  0.413968079402991,  0.002943138673190 },
+      {  0.413968079402991, -0.417736868604706,  0.002943138673190 },
+      { -0.417736868604706, -0.996231210798285,  0.002943138673190 },
+      { -0.996231210798285, -0.417736868604706,  0.002943138673190 },
+      { -0.971244868943256, -0.928704912520741,  0.003591411868831 },
+      { -0.928704912520741, -0.971244868943256,  0.003591411868831 },
+      {  0.899949781463998, -0.928704912520741,  0.003591411868831 },
+      { -0.928704912520741,  0.899949781463998,  0.003591411868831 },
+      {  0.899949781463998, -0.971244868943256,  0.003591411868831 },
+      { -0.971244868943256,  0.899949781463998,  0.003591411868831 }
+    };
+
+    static double3 std_pts_29_2d_tri[] =
+    {
+      { -0.615648218680002,  0.231296437360004,  0.004621012923868 },
+      {  0.231296437360004, -0.615648218680002,  0.004621012923868 },
+      { -0.615648218680002, -0.615648218680002,  0.004621012923868 },
+      { -0.066041503226578, -0.867916993546844,  0.015139783440861 },
+      { -0.867916993546844, -0.066041503226578,  0.015139783440861 },
+      { -0.066041503226578, -0.066041503226578,  0.015139783440861 },
+      { -0.734061640753964,  0.468123281507928,  0.016894161371694 },
+      {  0.468123281507928, -0.734061640753964,  0.016894161371694 },
+      { -0.734061640753964, -0.734061640753964,  0.016894161371694 },
+      { -0.237286924866941, -0.943057992217786,  0.012780908553878 },
+      { -0.943057992217786, -0.237286924866941,  0.012780908553878 },
+      {  0.180344917084727, -0.943057992217786,  0.012780908553878 },
+      { -0.943057992217786,  0.180344917084727,  0.012780908553878 },
+      {  0.180344917084727, -0.237286924866941,  0.012780908553878 },
+      { -0.237286924866941,  0.180344917084727,  0.012780908553878 },
+      { -0.602677031951032, -0.128152299851134,  0.020520090830312 },
+      { -0.128152299851134, -0.602677031951032,  0.020520090830312 },
+      { -0.269170668197834, -0.128152299851134,  0.020520090830312 },
+      { -0.128152299851134, -0.269170668197834,  0.020520090830312 },
+      { -0.269170668197834, -0.602677031951032,  0.020520090830312 },
+      { -0.602677031951032, -0.269170668197834,  0.020520090830312 },
+      { -0.508434274548147,  0.498155216151516,  0.004813776187669 },
+      {  0.498155216151516, -0.508434274548147,  0.004813776187669 },
+      { -0.989720941603369,  0.498155216151516,  0.004813776187669 },
+      {  0.498155216151516, -0.989720941603369,  0.004813776187669 },
+      { -0.989720941603369, -0.508434274548147,  0.004813776187669 },
+      { -0.508434274548147, -0.989720941603369,  0.004813776187669 },
+      { -0.413266151993407, -0.870845610361032,  0.012570923546810 },
+      { -0.870845610361032, -0.413266151993407,  0.012570923546810 },
+      {  0.284111762354439, -0.870845610361032,  0.012570923546810 },
+      { -0.870845610361032,  0.284111762354439,  0.012570923546810 },
+      {  0.284111762354439, -0.413266151993407,  0.012570923546810 },
+      { -0.413266151993407,  0.284111762354439,  0.012570923546810 },
+      { -0.603417804204908, -0.873499863369943,  0.012548892103261 },
+      { -0.873499863369943, -0.603417804204908,  0.012548892103261 },
+      {  0.476917667574851, -0.873499863369943,  0.012548892103261 },
+      { -0.873499863369943,  0.476917667574851,  0.012548892103261 },
+      {  0.476917667574851, -0.603417804204908,  0.012548892103261 },
+      { -0.603417804204908,  0.476917667574851,  0.012548892103261 },
+      { -0.964611748048412, -0.951729936019101,  0.001676091721799 },
+      { -0.951729936019101, -0.964611748048412,  0.001676091721799 },
+      {  0.916341684067513, -0.951729936019101,  0.001676091721799 },
+      { -0.951729936019101,  0.916341684067513,  0.001676091721799 },
+      {  0.916341684067513, -0.964611748048412,  0.001676091721799 },
+      { -0.964611748048412,  0.916341684067513,  0.001676091721799 },
+      { -0.848392277042261, -0.732863593397454,  0.013121411485517 },
+      { -0.732863593397454, -0.848392277042261,  0.013121411485517 },
+      {  0.581255870439715, -0.732863593397454,  0.013121411485517 },
+      { -0.732863593397454,  0.581255870439715,  0.013121411485517 },
+      {  0.581255870439715, -0.848392277042261,  0.013121411485517 },
+      { -0.848392277042261,  0.581255870439715,  0.013121411485517 },
+      {  0.155039486793235, -0.766248850066641,  0.015554913365242 },
+      { -0.766248850066641,  0.155039486793235,  0.015554913365242 },
+      { -0.388790636726594, -0.766248850066641,  0.015554913365242 },
+      { -0.766248850066641, -0.388790636726594,  0.015554913365242 },
+      { -0.388790636726594,  0.155039486793235,  0.015554913365242 },
+      {  0.155039486793235, -0.388790636726594,  0.015554913365242 },
+      { -0.739592609477063, -0.228578058185862,  0.022665948964678 },
+      { -0.228578058185862, -0.739592609477063,  0.022665948964678 },
+      { -0.031829332337076, -0.228578058185862,  0.022665948964678 },
+      { -0.228578058185862, -0.031829332337076,  0.022665948964678 },
+      { -0.031829332337076, -0.739592609477063,  0.022665948964678 },
+      { -0.739592609477063, -0.031829332337076,  0.022665948964678 },
+      { -0.861374115766433,  0.109418753714326,  0.017272340318197 },
+      {  0.109418753714326, -0.861374115766433,  0.017272340318197 },
+      { -0.248044637947893,  0.109418753714326,  0.017272340318197 },
+      {  0.109418753714326, -0.248044637947893,  0.017272340318197 },
+      { -0.248044637947893, -0.861374115766433,  0.017272340318197 },
+      { -0.861374115766433, -0.248044637947893,  0.017272340318197 },
+      { -0.374742618514282, -0.005210791404006,  0.011710996072860 },
+      { -0.005210791404006, -0.374742618514282,  0.011710996072860 },
+      { -0.620046590081712, -0.005210791404006,  0.011710996072860 },
+      { -0.005210791404006, -0.620046590081712,  0.011710996072860 },
+      { -0.620046590081712, -0.374742618514282,  0.011710996072860 },
+      { -0.374742618514282, -0.620046590081712,  0.011710996072860 },
+      { -0.989081764212426, -0.110726583161430,  0.005857558687938 },
+      { -0.110726583161430, -0.989081764212426,  0.005857558687938 },
+      {  0.099808347373856, -0.110726583161430,  0.005857558687938 },
+      { -0.110726583161430,  0.099808347373856,  0.005857558687938 },
+      {  0.099808347373856, -0.989081764212426,  0.005857558687938 },
+      { -0.989081764212426,  0.099808347373856,  0.005857558687938 },
+      { -0.945952700082622,  0.552028376054654,  0.009664758857496 },
+      {  0.552028376054654, -0.945952700082622,  0.009664758857496 },
+      { -0.606075675972032,  0.552028376054654,  0.009664758857496 },
+      {  0.552028376054654, -0.606075675972032,  0.009664758857496 },
+      { -0.606075675972032, -0.945952700082622,  0.009664758857496 },
+      { -0.945952700082622, -0.606075675972032,  0.009664758857496 },
+      { -0.138763292291218, -0.805076184410509,  0.003737551964667 },
+      { -0.805076184410509, -0.138763292291218,  0.003737551964667 },
+      { -0.056160523298273, -0.805076184410509,  0.003737551964667 },
+      { -0.805076184410509, -0.056160523298273,  0.003737551964667 },
+      { -0.056160523298273, -0.138763292291218,  0.003737551964667 },
+      { -0.138763292291218, -0.056160523298273,  0.003737551964667 },
+      { -0.837054889123919,  0.706131014422677,  0.006243515862800 },
+      {  0.706131014422677, -0.837054889123919,  0.006243515862800 },
+      { -0.869076125298758,  0.706131014422677,  0.006243515862800 },
+      {  0.706131014422677, -0.869076125298758,  0.006243515862800 },
+      { -0.869076125298758, -0.837054889123919,  0.006243515862800 },
+      { -0.837054889123919, -0.869076125298758,  0.006243515862800 },
+      { -0.585313939021929, -0.763725457710992,  0.019148173493747 },
+      { -0.763725457710992, -0.585313939021929,  0.019148173493747 },
+      {  0.349039396732921, -0.763725457710992,  0.019148173493747 },
+      { -0.763725457710992,  0.349039396732921,  0.019148173493747 },
+      {  0.349039396732921, -0.585313939021929,  0.019148173493747 },
+      { -0.585313939021929,  0.349039396732921,  0.019148173493747 },
+      { -0.938686536820805,  0.693928541936884,  0.009430880446104 },
+      {  0.693928541936884, -0.938686536820805,  0.009430880446104 },
+      { -0.755242005116079,  0.693928541936884,  0.009430880446104 },
+      {  0.693928541936884, -0.755242005116079,  0.009430880446104 },
+      { -0.755242005116079, -0.938686536820805,  0.009430880446104 },
+      { -0.938686536820805, -0.755242005116079,  0.009430880446104 },
+      { -0.447547379440446,  0.177091173764403,  0.009807867424013 },
+      {  0.177091173764403, -0.447547379440446,  0.009807867424013 },
+      { -0.729543794323957,  0.177091173764403,  0.009807867424013 },
+      {  0.177091173764403, -0.729543794323957,  0.009807867424013 },
+      { -0.729543794323957, -0.447547379440446,  0.009807867424013 },
+      { -0.447547379440446, -0.729543794323957,  0.009807867424013 },
+      { -0.945247438874985,  0.377662066429672,  0.011442538337711 },
+      {  0.377662066429672, -0.945247438874985,  0.011442538337711 },
+      { -0.432414627554687,  0.377662066429672,  0.011442538337711 },
+      {  0.377662066429672, -0.432414627554687,  0.011442538337711 },
+      { -0.432414627554687, -0.945247438874985,  0.011442538337711 },
+      { -0.945247438874985, -0.432414627554687,  0.011442538337711 },
+      {  0.345732321958978, -0.854360470453139,  0.006451399573303 },
+      { -0.854360470453139,  0.345732321958978,  0.006451399573303 },
+      { -0.491371851505839, -0.854360470453139,  0.006451399573303 },
+      { -0.854360470453139, -0.491371851505839,  0.006451399573303 },
+      { -0.491371851505839,  0.345732321958978,  0.006451399573303 },
+      {  0.345732321958978, -0.491371851505839,  0.006451399573303 },
+      { -0.480822124385148, -0.440451276564817,  0.013125142786709 },
+      { -0.440451276564817, -0.480822124385148,  0.013125142786709 },
+      { -0.078726599050036, -0.440451276564817,  0.013125142786709 },
+      { -0.440451276564817, -0.078726599050036,  0.013125142786709 },
+      { -0.078726599050036, -0.480822124385148,  0.013125142786709 },
+      { -0.480822124385148, -0.078726599050036,  0.013125142786709 },
+      { -0.445365004104351, -0.235051545485089,  0.017059693692908 },
+      { -0.235051545485089, -0.445365004104351,  0.017059693692908 },
+      { -0.319583450410559, -0.235051545485089,  0.017059693692908 },
+      { -0.235051545485089, -0.319583450410559,  0.017059693692908 },
+      { -0.319583450410559, -0.445365004104351,  0.017059693692908 },
+      { -0.445365004104351, -0.319583450410559,  0.017059693692908 },
+      { -0.987904262300043, -0.812891953989914,  0.003630443420869 },
+      { -0.812891953989914, -0.987904262300043,  0.003630443420869 },
+      {  0.800796216289957, -0.812891953989914,  0.003630443420869 },
+      { -0.812891953989914,  0.800796216289957,  0.003630443420869 },
+      {  0.800796216289957, -0.987904262300043,  0.003630443420869 },
+      { -0.987904262300043,  0.800796216289957,  0.003630443420869 },
+      { -0.626675054834794,  0.271091134267480,  0.006383696535799 },
+      {  0.271091134267480, -0.626675054834794,  0.006383696535799 },
+      { -0.644416079432686,  0.271091134267480,  0.006383696535799 },
+      {  0.271091134267480, -0.644416079432686,  0.006383696535799 },
+      { -0.644416079432686, -0.626675054834794,  0.006383696535799 },
+      { -0.626675054834794, -0.644416079432686,  0.006383696535799 },
+      { -0.316223096031431,  0.305424259266041,  0.005535132235504 },
+      {  0.305424259266041, -0.316223096031431,  0.005535132235504 },
+      { -0.989201163234610,  0.305424259266041,  0.005535132235504 },
+      {  0.305424259266041, -0.989201163234610,  0.005535132235504 },
+      { -0.989201163234610, -0.316223096031431,  0.005535132235504 },
+      { -0.316223096031431, -0.989201163234610,  0.005535132235504 },
+      { -0.677638466249667,  0.666695415338684,  0.004289757433830 },
+      {  0.666695415338684, -0.677638466249667,  0.004289757433830 },
+      { -0.989056949089018,  0.666695415338684,  0.004289757433830 },
+      {  0.666695415338684, -0.989056949089018,  0.004289757433830 },
+      { -0.989056949089018, -0.677638466249667,  0.004289757433830 },
+      { -0.677638466249667, -0.989056949089018,  0.004289757433830 },
+      { -0.912559230726714,  0.903383957756024,  0.001958571392429 },
+      {  0.903383957756024, -0.912559230726714,  0.001958571392429 },
+      { -0.990824727029310,  0.903383957756024,  0.001958571392429 },
+      {  0.903383957756024, -0.990824727029310,  0.001958571392429 },
+      { -0.990824727029310, -0.912559230726714,  0.001958571392429 },
+      { -0.912559230726714, -0.990824727029310,  0.001958571392429 },
+      { -0.878121147729860, -0.942416621644811,  0.006593420816024 },
+      { -0.942416621644811, -0.878121147729860,  0.006593420816024 },
+      {  0.820537769374671, -0.942416621644811,  0.006593420816024 },
+      { -0.942416621644811,  0.820537769374671,  0.006593420816024 },
+      {  0.820537769374671, -0.878121147729860,  0.006593420816024 },
+      { -0.878121147729860,  0.820537769374671,  0.006593420816024 },
+      { -0.536110223834863, -0.633801819592978,  0.006623812018558 },
+      { -0.633801819592978, -0.536110223834863,  0.006623812018558 },
+      {  0.169912043427841, -0.633801819592978,  0.006623812018558 },
+      { -0.633801819592978,  0.169912043427841,  0.006623812018558 },
+      {  0.169912043427841, -0.536110223834863,  0.006623812018558 },
+      { -0.536110223834863,  0.169912043427841,  0.006623812018558 },
+      { -0.977464104546287,  0.972993178054178,  0.000606461157962 },
+      {  0.972993178054178, -0.977464104546287,  0.000606461157962 },
+      { -0.995529073507891,  0.972993178054178,  0.000606461157962 },
+      {  0.972993178054178, -0.995529073507891,  0.000606461157962 },
+      { -0.995529073507891, -0.977464104546287,  0.000606461157962 },
+      { -0.977464104546287, -0.995529073507891,  0.000606461157962 },
+      { -0.002832609008537, -0.943376171046284,  0.006823639582079 },
+      { -0.943376171046284, -0.002832609008537,  0.006823639582079 },
+      { -0.053791219945179, -0.943376171046284,  0.006823639582079 },
+      { -0.943376171046284, -0.053791219945179,  0.006823639582079 },
+      { -0.053791219945179, -0.002832609008537,  0.006823639582079 },
+      { -0.002832609008537, -0.053791219945179,  0.006823639582079 },
+      { -0.607050172482167, -0.470485178675483,  0.015355545594450 },
+      { -0.470485178675483, -0.607050172482167,  0.015355545594450 },
+      {  0.077535351157650, -0.470485178675483,  0.015355545594450 },
+      { -0.470485178675483,  0.077535351157650,  0.015355545594450 },
+      {  0.077535351157650, -0.607050172482167,  0.015355545594450 },
+      { -0.607050172482167,  0.077535351157650,  0.015355545594450 }
     };
 
     static int std_np_2d_tri[g_max_tri + 1 + 3*g_max_tri + 3] =
@@ -2402,7 +3263,16 @@ namespace Hermes
       sizeof(std_pts_17_2d_tri) / sizeof(double3),
       sizeof(std_pts_18_2d_tri) / sizeof(double3),
       sizeof(std_pts_19_2d_tri) / sizeof(double3),
-      sizeof(std_pts_20_2d_tri) / sizeof(double3)
+      sizeof(std_pts_20_2d_tri) / sizeof(double3),
+      sizeof(std_pts_21_2d_tri) / sizeof(double3),
+      sizeof(std_pts_22_2d_tri) / sizeof(double3),
+      sizeof(std_pts_23_2d_tri) / sizeof(double3),
+      sizeof(std_pts_25_2d_tri) / sizeof(double3),
+      sizeof(std_pts_25_2d_tri) / sizeof(double3),
+      sizeof(std_pts_27_2d_tri) / sizeof(double3),
+      sizeof(std_pts_27_2d_tri) / sizeof(double3),
+      sizeof(std_pts_29_2d_tri) / sizeof(double3),
+      sizeof(std_pts_29_2d_tri) / sizeof(double3)
     };
 
     static double3* std_tables_2d_tri[g_max_tri + 1 + 3*g_max_tri + 3]=
@@ -2417,7 +3287,11 @@ namespace Hermes
       std_pts_14_2d_tri, std_pts_15_2d_tri,
       std_pts_16_2d_tri, std_pts_17_2d_tri,
       std_pts_18_2d_tri, std_pts_19_2d_tri,
-      std_pts_20_2d_tri
+      std_pts_20_2d_tri, std_pts_21_2d_tri,
+      std_pts_22_2d_tri, std_pts_23_2d_tri,
+      std_pts_25_2d_tri, std_pts_25_2d_tri,
+      std_pts_27_2d_tri, std_pts_27_2d_tri,
+      std_pts_29_2d_tri, std_pts_29_2d_tri
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2497,7 +3371,7 @@ namespace Hermes
       ref_vert[1][3][0] = -1.0;
       ref_vert[1][3][1] =  1.0;
 
-      max_order[0] = g_max_tri;   safe_max_order[0] = g_max_tri - 1; // 20th rule has points outside.
+      max_order[0] = g_max_tri;   safe_max_order[0] = g_max_tri;
       max_order[1] = g_max_quad;  safe_max_order[1] = g_max_quad;
 
       num_tables[0] = max_order[0] + 1 + 3 * max_order[0] + 3;
@@ -0,0 +1,487 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "reduced_order_model.h"
+#include "projections/ogprojection.h"
+#include "mesh/mesh_partitioner.h"
+#include "vector_kernels.h"
+#include <algorithm>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // Solves the dense system a x = b with the partial pivoting, a [n x n] row-wise (overwritten),
+    // b holds nrhs right-hand sides of n entries one after another, overwritten by the solutions.
+    template<typename Scalar>
+    static void solve_dense(int n, Scalar* a, Scalar* b, int nrhs)
+    {
+      for(int k = 0; k < n; k++)
+      {
+        int pivot = k;
+        for(int i = k + 1; i < n; i++)
+          if(std::abs(a[i * n + k]) > std::abs(a[pivot * n + k]))
+            pivot = i;
+        if(a[pivot * n + k] == Scalar(0))
+          throw Exceptions::Exception("ReducedOrderModel: singular reduced system.");
+        if(pivot != k)
+        {
+          for(int j = 0; j < n; j++)
+            std::swap(a[k * n + j], a[pivot * n + j]);
+          for(int rhs = 0; rhs < nrhs; rhs++)
+            std::swap(b[rhs * n + k], b[rhs * n + pivot]);
+        }
+        for(int i = k + 1; i < n; i++)
+        {
+          Scalar factor = a[i * n + k] / a[k * n + k];
+          if(factor == Scalar(0))
+            continue;
+          for(int j = k + 1; j < n; j++)
+            a[i * n + j] -= factor * a[k * n + j];
+          for(int rhs = 0; rhs < nrhs; rhs++)
+            b[rhs * n + i] -= factor * b[rhs * n + k];
+        }
+      }
+      for(int rhs = 0; rhs < nrhs; rhs++)
+        for(int i = n - 1; i >= 0; i--)
+        {
+          Scalar sum = b[rhs * n + i];
+          for(int j = i + 1; j < n; j++)
+            sum -= a[i * n + j] * b[rhs * n + j];
+          b[rhs * n + i] = sum / a[i * n + i];
+        }
+    }
+
+    template<typename Scalar>
+    ReducedOrderModel<Scalar>::ReducedOrderModel(DiscreteProblem<Scalar>* dp) : dp(dp), ndof(-1), newton_tol(1e-8), newton_max_iter(15), num_iters(0), sln_vector(NULL)
+    {
+      if(dp == NULL)
+        throw Exceptions::NullException(0);
+      this->jacobian = create_matrix<Scalar>();
+      this->residual = create_vector<Scalar>();
+    }
+
+    template<typename Scalar>
+    ReducedOrderModel<Scalar>::~ReducedOrderModel()
+    {
+      free_vectors(this->snapshots);
+      free_vectors(this->residual_snapshots);
+      free_vectors(this->basis);
+      free_vectors(this->deim_basis);
+      if(this->sln_vector != NULL)
+        delete [] this->sln_vector;
+      delete this->jacobian;
+      delete this->residual;
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::free_vectors(std::vector<Scalar*>& vectors)
+    {
+      for(unsigned int i = 0; i < vectors.size(); i++)
+        delete [] vectors[i];
+      vectors.clear();
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::check_ndof() const
+    {
+      if(this->dp->get_num_dofs() != this->ndof)
+        throw Exceptions::Exception("ReducedOrderModel: the spaces have %i DOFs, the snapshots %i.", this->dp->get_num_dofs(), this->ndof);
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::add_snapshot(const Scalar* coeff_vec)
+    {
+      if(coeff_vec == NULL)
+        throw Exceptions::NullException(0);
+      if(this->ndof == -1)
+        this->ndof = this->dp->get_num_dofs();
+      this->check_ndof();
+
+      Scalar* snapshot = new Scalar[this->ndof];
+      Hermes::Algebra::VectorKernels::copy(this->ndof, coeff_vec, snapshot);
+      this->snapshots.push_back(snapshot);
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::add_snapshot(Hermes::vector<Solution<Scalar>*> slns)
+    {
+      int ndof = this->dp->get_num_dofs();
+      Scalar* coeff_vec = new Scalar[ndof];
+      OGProjection<Scalar> ogProjection;
+      ogProjection.project_global(this->dp->get_spaces(), slns, coeff_vec);
+      this->add_snapshot(coeff_vec);
+      delete [] coeff_vec;
+    }
+
+    template<typename Scalar>
+    int ReducedOrderModel<Scalar>::get_num_snapshots() const
+    {
+      return this->snapshots.size();
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::add_residual_snapshot(const Scalar* residual)
+    {
+      if(residual == NULL)
+        throw Exceptions::NullException(0);
+      if(this->ndof == -1)
+        this->ndof = this->dp->get_num_dofs();
+      this->check_ndof();
+
+      Scalar* snapshot = new Scalar[this->ndof];
+      Hermes::Algebra::VectorKernels::copy(this->ndof, residual, snapshot);
+      this->residual_snapshots.push_back(snapshot);
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::add_residual_snapshot_at(const Scalar* coeff_vec)
+    {
+      if(coeff_vec == NULL)
+        throw Exceptions::NullException(0);
+      int ndof = this->dp->get_num_dofs();
+      Scalar* u = new Scalar[ndof];
+      Hermes::Algebra::VectorKernels::copy(ndof, coeff_vec, u);
+      this->dp->assemble(u, this->residual);
+      this->residual->extract(u);
+      this->add_residual_snapshot(u);
+      delete [] u;
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::calculate_pod(const std::vector<Scalar*>& snapshots, double tolerance, int max_size, std::vector<Scalar*>& pod_basis)
+    {
+      free_vectors(pod_basis);
+      int count = snapshots.size();
+      if(count == 0)
+        throw Exceptions::Exception("ReducedOrderModel: no snapshots.");
+
+      // One-sided Jacobi (Hestenes): the pairs of columns are rotated until orthogonal, the columns then are
+      // the left singular vectors times the singular values.
+      std::vector<Scalar*> columns(count);
+      for(int i = 0; i < count; i++)
+      {
+        columns[i] = new Scalar[this->ndof];
+        Hermes::Algebra::VectorKernels::copy(this->ndof, snapshots[i], columns[i]);
+      }
+      for(int sweep = 0; sweep < 100; sweep++)
+      {
+        bool rotated = false;
+        for(int p = 0; p < count; p++)
+          for(int q = p + 1; q < count; q++)
+          {
+            double alpha = Hermes::Algebra::VectorKernels::nrm2(this->ndof, columns[p]);
+            double beta = Hermes::Algebra::VectorKernels::nrm2(this->ndof, columns[q]);
+            Scalar gamma = Hermes::Algebra::VectorKernels::dot(this->ndof, columns[p], columns[q]);
+            double gamma_abs = std::abs(gamma);
+            if(gamma_abs <= 1e-14 * alpha * beta)
+              continue;
+            rotated = true;
+
+            // Real rotation of the column p and the column q times the phase of gamma.
+            Scalar phase = conj(gamma / gamma_abs);
+            double zeta = (beta * beta - alpha * alpha) / (2. * gamma_abs);
+            double t = (zeta >= 0. ? 1. : -1.) / (std::abs(zeta) + std::sqrt(1. + zeta * zeta));
+            double c = 1. / std::sqrt(1. + t * t), s = c * t;
+            for(int k = 0; k < this->ndof; k++)
+            {
+              Scalar x = columns[p][k], y = phase * columns[q][k];
+              columns[p][k] = c * x - s * y;
+              columns[q][k] = s * x + c * y;
+            }
+          }
+        if(!rotated)
+          break;
+      }
+
+      // The singular values, descending.
+      std::vector<std::pair<double, int> > singular_values(count);
+      double energy = 0.0;
+      for(int i = 0; i < count; i++)
+      {
+        double norm = Hermes::Algebra::VectorKernels::nrm2(this->ndof, columns[i]);
+        singular_values[i] = std::make_pair(-norm, i);
+        energy += norm * norm;
+      }
+      std::sort(singular_values.begin(), singular_values.end());
+
+      double kept_energy = 0.0;
+      for(int i = 0; i < count; i++)
+      {
+        double norm = -singular_values[i].first;
+        if(norm == 0.0 || kept_energy >= (1. - tolerance) * energy || (max_size != -1 && (int)pod_basis.size() >= max_size))
+          break;
+        Scalar* vector = columns[singular_values[i].second];
+        columns[singular_values[i].second] = NULL;
+        Hermes::Algebra::VectorKernels::scale(this->ndof, Scalar(1. / norm), vector);
+        pod_basis.push_back(vector);
+        kept_energy += norm * norm;
+      }
+      for(int i = 0; i < count; i++)
+        if(columns[i] != NULL)
+          delete [] columns[i];
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::calculate_basis(double tolerance, int max_basis_size)
+    {
+      if(tolerance < 0.0 || tolerance >= 1.0)
+        throw Exceptions::ValueException("tolerance", tolerance, 0.0, 1.0);
+      this->check_ndof();
+      this->unset_deim();
+      this->calculate_pod(this->snapshots, tolerance, max_basis_size, this->basis);
+      this->reduced_sln_vector.clear();
+      this->info("ReducedOrderModel: %i basis vectors of %i snapshots.", (int)this->basis.size(), (int)this->snapshots.size());
+    }
+
+    template<typename Scalar>
+    int ReducedOrderModel<Scalar>::get_basis_size() const
+    {
+      return this->basis.size();
+    }
+
+    template<typename Scalar>
+    const Scalar* ReducedOrderModel<Scalar>::get_basis_vector(int i) const
+    {
+      if(i < 0 || i >= (int)this->basis.size())
+        throw Exceptions::ValueException("i", i, 0, this->basis.size());
+      return this->basis[i];
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::calculate_deim(double tolerance, int max_deim_size)
+    {
+      if(tolerance < 0.0 || tolerance >= 1.0)
+        throw Exceptions::ValueException("tolerance", tolerance, 0.0, 1.0);
+      if(this->basis.empty())
+        throw Exceptions::Exception("ReducedOrderModel: calculate_basis() has to be called before calculate_deim().");
+      this->check_ndof();
+      this->unset_deim();
+      this->calculate_pod(this->residual_snapshots, tolerance, max_deim_size, this->deim_basis);
+
+      // The greedy selection: the next DOF is the one of the largest error of the interpolation
+      // of the next basis vector in the DOFs selected so far.
+      int deim_size = this->deim_basis.size();
+      Scalar* interpolation_error = new Scalar[this->ndof];
+      std::vector<Scalar> a(deim_size * deim_size), b(deim_size);
+      for(int l = 0; l < deim_size; l++)
+      {
+        Hermes::Algebra::VectorKernels::copy(this->ndof, this->deim_basis[l], interpolation_error);
+        if(l > 0)
+        {
+          for(int i = 0; i < l; i++)
+          {
+            for(int j = 0; j < l; j++)
+              a[i * l + j] = this->deim_basis[j][this->deim_dofs[i]];
+            b[i] = this->deim_basis[l][this->deim_dofs[i]];
+          }
+          solve_dense(l, &a[0], &b[0], 1);
+          for(int j = 0; j < l; j++)
+            Hermes::Algebra::VectorKernels::axpy(this->ndof, -b[j], this->deim_basis[j], interpolation_error);
+        }
+        int dof = 0;
+        for(int i = 1; i < this->ndof; i++)
+          if(std::abs(interpolation_error[i]) > std::abs(interpolation_error[dof]))
+            dof = i;
+        this->deim_dofs.push_back(dof);
+      }
+      delete [] interpolation_error;
+
+      // V^H U (P^T U)^-1 = X, i.e. (P^T U)^T X^T = (V^H U)^T, the rows of X as the right-hand sides.
+      int basis_size = this->basis.size();
+      for(int i = 0; i < deim_size; i++)
+        for(int j = 0; j < deim_size; j++)
+          a[j * deim_size + i] = this->deim_basis[j][this->deim_dofs[i]];
+      this->deim_projection.resize(basis_size * deim_size);
+      for(int k = 0; k < basis_size; k++)
+        for(int j = 0; j < deim_size; j++)
+          this->deim_projection[k * deim_size + j] = Hermes::Algebra::VectorKernels::dot(this->ndof, this->basis[k], this->deim_basis[j]);
+      solve_dense(deim_size, &a[0], &this->deim_projection[0], basis_size);
+
+      this->calculate_deim_base_element_parts();
+
+      int base_elements_assembled = std::count(this->deim_base_element_parts.begin(), this->deim_base_element_parts.end(), 1);
+      this->info("ReducedOrderModel: %i DEIM DOFs of %i residual snapshots, %i of %i base elements assembled.", deim_size,
+        (int)this->residual_snapshots.size(), base_elements_assembled, (int)this->deim_base_element_parts.size());
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::calculate_deim_base_element_parts()
+    {
+      std::vector<char> is_deim_dof(this->ndof, 0);
+      for(unsigned int i = 0; i < this->deim_dofs.size(); i++)
+        is_deim_dof[this->deim_dofs[i]] = 1;
+
+      // All the meshes share the base mesh.
+      Hermes::vector<const Space<Scalar>*> spaces = this->dp->get_spaces();
+      this->deim_base_element_parts.assign(spaces[0]->get_mesh()->get_num_base_elements(), 0);
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+      {
+        Element* e;
+        for_all_active_elements(e, spaces[space_i]->get_mesh())
+        {
+          const int* idx;
+          const int* dof;
+          const Scalar* coef;
+          unsigned int cnt = spaces[space_i]->get_element_assembly_list(e, idx, dof, coef);
+          for(unsigned int k = 0; k < cnt; k++)
+            if(dof[k] >= 0 && is_deim_dof[dof[k]])
+            {
+              this->deim_base_element_parts[MeshPartitioner::get_base_element(e)->id] = 1;
+              break;
+            }
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::unset_deim()
+    {
+      free_vectors(this->deim_basis);
+      this->deim_dofs.clear();
+      this->deim_projection.clear();
+      this->deim_base_element_parts.clear();
+    }
+
+    template<typename Scalar>
+    const std::vector<int>& ReducedOrderModel<Scalar>::get_deim_dofs() const
+    {
+      return this->deim_dofs;
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::set_tolerance(double newton_tol)
+    {
+      if(newton_tol <= 0.0)
+        throw Exceptions::ValueException("newton_tol", newton_tol, 0.0);
+      this->newton_tol = newton_tol;
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::set_max_iter(int newton_max_iter)
+    {
+      if(newton_max_iter < 1)
+        throw Exceptions::ValueException("newton_max_iter", newton_max_iter, 1);
+      this->newton_max_iter = newton_max_iter;
+    }
+
+    template<typename Scalar>
+    void ReducedOrderModel<Scalar>::solve(Scalar* reduced_coeff_vec)
+    {
+      if(this->basis.empty())
+        throw Exceptions::Exception("ReducedOrderModel: calculate_basis() has to be called before solve().");
+      this->check_ndof();
+
+      int basis_size = this->basis.size();
+      int deim_size = this->deim_dofs.size();
+      if(reduced_coeff_vec != NULL)
+        this->reduced_sln_vector.assign(reduced_coeff_vec, reduced_coeff_vec + basis_size);
+      else if((int)this->reduced_sln_vector.size() != basis_size)
+        this->reduced_sln_vector.assign(basis_size, Scalar(0));
+
+      if(this->sln_vector == NULL)
+        this->sln_vector = new Scalar[this->ndof];
+      std::vector<Scalar> reduced_residual(basis_size), reduced_jacobian(basis_size * basis_size);
+      std::vector<Scalar> full_vector(this->ndof), jacobian_times_basis(this->ndof);
+
+      for(this->num_iters = 0; ; this->num_iters++)
+      {
+        // u = V a.
+        Hermes::Algebra::VectorKernels::zero(this->ndof, this->sln_vector);
+        for(int k = 0; k < basis_size; k++)
+          Hermes::Algebra::VectorKernels::axpy(this->ndof, this->reduced_sln_vector[k], this->basis[k], this->sln_vector);
+
+        // The full system, only the states with the DEIM DOFs with DEIM.
+        if(deim_size > 0)
+          this->dp->set_subdomain(this->deim_base_element_parts, 1);
+        try
+        {
+          this->dp->assemble(this->sln_vector, this->jacobian, this->residual);
+        }
+        catch(...)
+        {
+          if(deim_size > 0)
+            this->dp->unset_subdomain();
+          throw;
+        }
+        if(deim_size > 0)
+          this->dp->unset_subdomain();
+
+        // The reduced residual, V^H F or X P^T F.
+        this->residual->extract(&full_vector[0]);
+        for(int k = 0; k < basis_size; k++)
+        {
+          if(deim_size > 0)
+          {
+            reduced_residual[k] = Scalar(0);
+            for(int j = 0; j < deim_size; j++)
+              reduced_residual[k] -= this->deim_projection[k * deim_size + j] * full_vector[this->deim_dofs[j]];
+          }
+          else
+            reduced_residual[k] = -Hermes::Algebra::VectorKernels::dot(this->ndof, this->basis[k], &full_vector[0]);
+        }
+        double residual_norm = Hermes::Algebra::VectorKernels::nrm2(basis_size, &reduced_residual[0]);
+        this->info("\tReducedOrderModel: iteration %d, reduced residual norm: %g", this->num_iters, residual_norm);
+        if(residual_norm < this->newton_tol)
+          break;
+        if(this->num_iters >= this->newton_max_iter)
+          throw Exceptions::ValueException("iterations", this->num_iters, this->newton_max_iter);
+
+        // The reduced Jacobian, V^H J V or X P^T J V.
+        for(int l = 0; l < basis_size; l++)
+        {
+          this->jacobian->multiply_with_vector(this->basis[l], &jacobian_times_basis[0]);
+          for(int k = 0; k < basis_size; k++)
+          {
+            if(deim_size > 0)
+            {
+              Scalar value = Scalar(0);
+              for(int j = 0; j < deim_size; j++)
+                value += this->deim_projection[k * deim_size + j] * jacobian_times_basis[this->deim_dofs[j]];
+              reduced_jacobian[k * basis_size + l] = value;
+            }
+            else
+              reduced_jacobian[k * basis_size + l] = Hermes::Algebra::VectorKernels::dot(this->ndof, this->basis[k], &jacobian_times_basis[0]);
+          }
+        }
+
+        solve_dense(basis_size, &reduced_jacobian[0], &reduced_residual[0], 1);
+        for(int k = 0; k < basis_size; k++)
+          this->reduced_sln_vector[k] += reduced_residual[k];
+      }
+    }
+
+    template<typename Scalar>
+    Scalar* ReducedOrderModel<Scalar>::get_sln_vector()
+    {
+      return this->sln_vector;
+    }
+
+    template<typename Scalar>
+    const Scalar* ReducedOrderModel<Scalar>::get_reduced_sln_vector() const
+    {
+      return this->reduced_sln_vector.empty() ? NULL : &this->reduced_sln_vector[0];
+    }
+
+    template<typename Scalar>
+    int ReducedOrderModel<Scalar>::get_num_iters() const
+    {
+      return this->num_iters;
+    }
+
+    template class HERMES_API ReducedOrderModel<double>;
+    template class HERMES_API ReducedOrderModel<std::complex<double> >;
+  }
+}
@@ -0,0 +1,171 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "reference_matrices.h"
+#include "quadrature/quad_all.h"
+#include <map>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // Calculated matrices, per shapeset id and mode.
+    static std::map<std::pair<int, int>, ReferenceMatrices> reference_matrices;
+
+    ReferenceMatrices::ReferenceMatrices() : num_indices(0)
+    {
+    }
+
+    const ReferenceMatrices* ReferenceMatrices::get(Shapeset* shapeset, ElementMode2D mode)
+    {
+      if(shapeset->get_num_components() > 1)
+        return NULL;
+
+      ReferenceMatrices* result;
+#pragma omp critical (reference_matrices)
+      {
+        std::pair<int, int> key(shapeset->get_id(), (int)mode);
+        std::map<std::pair<int, int>, ReferenceMatrices>::iterator it = reference_matrices.find(key);
+        if(it == reference_matrices.end())
+        {
+          result = &reference_matrices[key];
+          result->calculate(shapeset, mode);
+        }
+        else
+          result = &it->second;
+      }
+
+      return result->num_indices > 0 ? result : NULL;
+    }
+
+    void ReferenceMatrices::calculate(Shapeset* shapeset, ElementMode2D mode)
+    {
+      // Exact for the products of two functions of the highest order.
+      int order = std::min(2 * shapeset->get_max_order(), g_quad_2d_std.get_max_order(mode));
+      int np = g_quad_2d_std.get_num_points(order, mode);
+      double3* pt = g_quad_2d_std.get_points(order, mode);
+      std::vector<double> x(np), y(np);
+      for (int k = 0; k < np; k++)
+      {
+        x[k] = pt[k][0];
+        y[k] = pt[k][1];
+      }
+
+      int n = shapeset->get_max_index(mode) + 1;
+      std::vector<int> indices(n);
+      for (int i = 0; i < n; i++)
+        indices[i] = i;
+      std::vector<double> val(n * np), dx(n * np), dy(n * np);
+      shapeset->get_values(0, n, &indices[0], &x[0], &y[0], np, &val[0], 0, mode);
+      shapeset->get_values(1, n, &indices[0], &x[0], &y[0], np, &dx[0], 0, mode);
+      shapeset->get_values(2, n, &indices[0], &x[0], &y[0], np, &dy[0], 0, mode);
+
+      this->mass_matrix.assign(n * n, 0.0);
+      this->stiffness_xx.assign(n * n, 0.0);
+      this->stiffness_xy.assign(n * n, 0.0);
+      this->stiffness_yy.assign(n * n, 0.0);
+      for (int i = 0; i < n; i++)
+      {
+        for (int j = i; j < n; j++)
+        {
+          double m = 0.0, s_xx = 0.0, s_xy = 0.0, s_yy = 0.0;
+          for (int k = 0; k < np; k++)
+          {
+            double w = pt[k][2];
+            m += w * val[i * np + k] * val[j * np + k];
+            s_xx += w * dx[i * np + k] * dx[j * np + k];
+            s_xy += w * (dx[i * np + k] * dy[j * np + k] + dy[i * np + k] * dx[j * np + k]);
+            s_yy += w * dy[i * np + k] * dy[j * np + k];
+          }
+          // All of them are symmetric.
+          this->mass_matrix[i * n + j] = this->mass_matrix[j * n + i] = m;
+          this->stiffness_xx[i * n + j] = this->stiffness_xx[j * n + i] = s_xx;
+          this->stiffness_xy[i * n + j] = this->stiffness_xy[j * n + i] = s_xy;
+          this->stiffness_yy[i * n + j] = this->stiffness_yy[j * n + i] = s_yy;
+        }
+      }
+      this->num_indices = n;
+    }
+
+    bool ReferenceMatrices::has_indices(int cnt, int* idx) const
+    {
+      for(int i = 0; i < cnt; i++)
+        if(idx[i] < 0 || idx[i] >= this->num_indices)
+          return false;
+      return true;
+    }
+
+    template<typename Scalar>
+    void ReferenceMatrices::get_coefficients(double2x2* inv_ref_map, double jacobian, Scalar mass, Scalar diffusion, Scalar* coefficients)
+    {
+      double2x2& m = *inv_ref_map;
+      coefficients[0] = jacobian * mass;
+      coefficients[1] = jacobian * diffusion * (m[0][0] * m[0][0] + m[1][0] * m[1][0]);
+      coefficients[2] = jacobian * diffusion * (m[0][0] * m[0][1] + m[1][0] * m[1][1]);
+      coefficients[3] = jacobian * diffusion * (m[0][1] * m[0][1] + m[1][1] * m[1][1]);
+    }
+
+    template<typename Scalar>
+    void ReferenceMatrices::assemble(int n_test, int* test_idx, int n_base, int* base_idx, double2x2* inv_ref_map, double jacobian, Scalar mass, Scalar diffusion, Scalar** result) const
+    {
+      Scalar c[4];
+      get_coefficients(inv_ref_map, jacobian, mass, diffusion, c);
+      bool with_mass = (mass != Scalar(0)), with_diffusion = (diffusion != Scalar(0));
+
+      for (int i = 0; i < n_test; i++)
+      {
+        int row = test_idx[i] * this->num_indices;
+        for (int j = 0; j < n_base; j++)
+        {
+          int k = row + base_idx[j];
+          Scalar value = 0.0;
+          if(with_mass)
+            value += c[0] * this->mass_matrix[k];
+          if(with_diffusion)
+            value += c[1] * this->stiffness_xx[k] + c[2] * this->stiffness_xy[k] + c[3] * this->stiffness_yy[k];
+          result[i][j] = value;
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void ReferenceMatrices::assemble_batch(int n_elements, int n_test, int* test_idx, int n_base, int* base_idx,
+      const Scalar* c_mass, const Scalar* c_xx, const Scalar* c_xy, const Scalar* c_yy, Scalar* result) const
+    {
+      for (int i = 0; i < n_test; i++)
+      {
+        int row = test_idx[i] * this->num_indices;
+        for (int j = 0; j < n_base; j++)
+        {
+          // The entries of the tables loaded once for all the elements.
+          int k = row + base_idx[j];
+          double m = this->mass_matrix[k], s_xx = this->stiffness_xx[k], s_xy = this->stiffness_xy[k], s_yy = this->stiffness_yy[k];
+          Scalar* values = result + (i * n_base + j) * n_elements;
+          for (int element = 0; element < n_elements; element++)
+            values[element] = c_mass[element] * m + c_xx[element] * s_xx + c_xy[element] * s_xy + c_yy[element] * s_yy;
+        }
+      }
+    }
+
+    template HERMES_API void ReferenceMatrices::assemble<double>(int n_test, int* test_idx, int n_base, int* base_idx, double2x2* inv_ref_map, double jacobian, double mass, double diffusion, double** result) const;
+    template HERMES_API void ReferenceMatrices::assemble<std::complex<double> >(int n_test, int* test_idx, int n_base, int* base_idx, double2x2* inv_ref_map, double jacobian, std::complex<double> mass, std::complex<double> diffusion, std::complex<double>** result) const;
+    template HERMES_API void ReferenceMatrices::get_coefficients<double>(double2x2* inv_ref_map, double jacobian, double mass, double diffusion, double* coefficients);
+    template HERMES_API void ReferenceMatrices::get_coefficients<std::complex<double> >(double2x2* inv_ref_map, double jacobian, std::complex<double> mass, std::complex<double> diffusion, std::complex<double>* coefficients);
+    template HERMES_API void ReferenceMatrices::assemble_batch<double>(int n_elements, int n_test, int* test_idx, int n_base, int* base_idx,
+      const double* c_mass, const double* c_xx, const double* c_xy, const double* c_yy, double* result) const;
+    template HERMES_API void ReferenceMatrices::assemble_batch<std::complex<double> >(int n_elements, int n_test, int* test_idx, int n_base, int* base_idx,
+      const std::complex<double>* c_mass, const std::complex<double>* c_xx, const std::complex<double>* c_xy, const std::complex<double>* c_yy, std::complex<double>* result) const;
+  }
+}
@@ -66,6 +66,14 @@ namespace Hermes
           //allocate
           trf_svals.resize(max_shape_inx + 1);
 
+          //transform coordinates
+          std::vector<double> ref_x(num_gip_points), ref_y(num_gip_points);
+          for(int k = 0; k < num_gip_points; k++)
+          {
+            ref_x[k] = gip_points[k][H2D_GIP2D_X] * trf.m[0] + trf.t[0];
+            ref_y[k] = gip_points[k][H2D_GIP2D_Y] * trf.m[1] + trf.t[1];
+          }
+
           //for all shapes
           const int num_shapes = (int)shapes.size();
           for(int i = 0; i < num_shapes; i++)
@@ -76,16 +84,8 @@ namespace Hermes
             //allocate
             shape_exp.allocate(H2D_L2FE_NUM, num_gip_points);
 
-            //for all GIP points
-            for(int k = 0; k < num_gip_points; k++)
-            {
-              //transform coordinates
-              double ref_x = gip_points[k][H2D_GIP2D_X] * trf.m[0] + trf.t[0];
-              double ref_y = gip_points[k][H2D_GIP2D_Y] * trf.m[1] + trf.t[1];
-
-              //for all expansions: retrieve values
-              shape_exp[H2D_L2FE_VALUE][k] = this->shapeset->get_fn_value(inx_shape, ref_x, ref_y, 0, mode);
-            }
+            //for all expansions: retrieve values at all GIP points
+            this->shapeset->get_values(H2D_FEI_VALUE, inx_shape, &ref_x[0], &ref_y[0], num_gip_points, shape_exp[H2D_L2FE_VALUE], 0, mode);
           }
 
           //move to the next transformation
@@ -105,23 +105,42 @@ namespace Hermes
       OptimumSelector<Scalar>::~OptimumSelector()
       {
         if(!this->isAClone)
+          delete_num_shapes(num_shapes);
+      }
+
+      template<typename Scalar>
+      void OptimumSelector<Scalar>::delete_num_shapes(int**** num_shapes)
+      {
+        for(int i = 0; i < 2; i++)
         {
-          for(int i = 0; i < 2; i++)
+          for(int j = 0; j < H2D_NUM_SHAPES_SIZE; j++)
           {
-            for(int j = 0; j < H2D_NUM_SHAPES_SIZE; j++)
+            for(int k = 0; k < H2D_NUM_SHAPES_SIZE; k++)
             {
-              for(int k = 0; k < H2D_NUM_SHAPES_SIZE; k++)
-              {
-                delete [] num_shapes[i][j][k];
-              }
-              delete [] num_shapes[i][j];
+              delete [] num_shapes[i][j][k];
             }
-            delete [] num_shapes[i];
+            delete [] num_shapes[i][j];
           }
-          delete [] num_shapes;
+          delete [] num_shapes[i];
         }
+        delete [] num_shapes;
       }
-      
+
+      template<typename Scalar>
+      void OptimumSelector<Scalar>::update_clone(Selector<Scalar>* clone)
+      {
+        OptimumSelector<Scalar>* optimum_clone = static_cast<OptimumSelector<Scalar>*>(clone);
+        optimum_clone->opt_symmetric_mesh = this->opt_symmetric_mesh;
+        optimum_clone->opt_apply_exp_dof = this->opt_apply_exp_dof;
+
+        // The table is read-only after construction, the clone uses the one of this instance.
+        if(optimum_clone->num_shapes != this->num_shapes)
+        {
+          delete_num_shapes(optimum_clone->num_shapes);
+          optimum_clone->num_shapes = this->num_shapes;
+        }
+      }
+
       template<typename Scalar>
       void OptimumSelector<Scalar>::add_bubble_shape_index(int order_h, int order_v, std::map<int, bool>& used_shape_index, Hermes::vector<ShapeInx>& indices, ElementMode2D mode)
       {
@@ -6,6 +6,7 @@
 #include "quad_all.h"
 #include "element_to_refine.h"
 #include "order_permutator.h"
+#include "api2d.h"
 
 namespace Hermes
 {
@@ -31,10 +32,15 @@ namespace Hermes
         std::fill(cached_shape_vals_valid, cached_shape_vals_valid + H2D_NUM_MODES, false);
 
         //clear matrix cache
+        proj_matrix_cache = new ProjMatrixCache[H2D_NUM_MODES];
+        proj_pivot_cache = new ProjPivotCache[H2D_NUM_MODES];
         for(int m = 0; m < H2D_NUM_MODES; m++)
           for(int i = 0; i < H2DRS_MAX_ORDER + 2; i++)
             for(int k = 0; k < H2DRS_MAX_ORDER + 2; k++)
+            {
               proj_matrix_cache[m][i][k] = NULL;
+              proj_pivot_cache[m][i][k] = NULL;
+            }
 
         //allocate caches
         int max_inx = this->max_shape_inx[0];
@@ -47,7 +53,18 @@ namespace Hermes
       template<typename Scalar>
       ProjBasedSelector<Scalar>::~ProjBasedSelector()
       {
-        //delete matrix cache
+        if(!this->isAClone)
+        {
+          delete_proj_caches(proj_matrix_cache, proj_pivot_cache);
+          delete [] cached_shape_vals_valid;
+          delete [] cached_shape_ortho_vals;
+          delete [] cached_shape_vals;
+        }
+      }
+
+      template<typename Scalar>
+      void ProjBasedSelector<Scalar>::delete_proj_caches(ProjMatrixCache* proj_matrix_cache, ProjPivotCache* proj_pivot_cache)
+      {
         for(int m = 0; m < H2D_NUM_MODES; m++)
         {
           for(int i = 0; i < H2DRS_MAX_ORDER + 2; i++)
@@ -55,17 +72,144 @@ namespace Hermes
             {
               if(proj_matrix_cache[m][i][k] != NULL)
                 delete [] proj_matrix_cache[m][i][k];
+              if(proj_pivot_cache[m][i][k] != NULL)
+                delete [] proj_pivot_cache[m][i][k];
             }
         }
+        delete [] proj_matrix_cache;
+        delete [] proj_pivot_cache;
+      }
 
-        if(!this->isAClone)
+      template<typename Scalar>
+      void ProjBasedSelector<Scalar>::update_clone(Selector<Scalar>* clone)
+      {
+        OptimumSelector<Scalar>::update_clone(clone);
+        ProjBasedSelector<Scalar>* proj_clone = static_cast<ProjBasedSelector<Scalar>*>(clone);
+        proj_clone->set_error_weights(error_weight_h, error_weight_p, error_weight_aniso);
+
+        // Shape values and projection matrices are read-only during the selection, the clone uses the ones of this instance.
+        if(proj_clone->proj_matrix_cache != proj_matrix_cache)
         {
-          delete [] cached_shape_vals_valid;
-          delete [] cached_shape_ortho_vals;
-          delete [] cached_shape_vals;
+          delete_proj_caches(proj_clone->proj_matrix_cache, proj_clone->proj_pivot_cache);
+          proj_clone->proj_matrix_cache = proj_matrix_cache;
+          proj_clone->proj_pivot_cache = proj_pivot_cache;
+        }
+        if(proj_clone->cached_shape_vals != cached_shape_vals)
+        {
+          delete [] proj_clone->cached_shape_vals_valid;
+          delete [] proj_clone->cached_shape_ortho_vals;
+          delete [] proj_clone->cached_shape_vals;
+          proj_clone->cached_shape_vals_valid = cached_shape_vals_valid;
+          proj_clone->cached_shape_ortho_vals = cached_shape_ortho_vals;
+          proj_clone->cached_shape_vals = cached_shape_vals;
         }
       }
 
+      template<typename Scalar>
+      void ProjBasedSelector<Scalar>::prepare_selection(const Hermes::vector<Element*>& elements, const Hermes::vector<int>& quad_orders)
+      {
+        // find the maximum order of projections needed for every mode
+        int max_order[H2D_NUM_MODES] = { -1, -1 };
+        for(unsigned int i = 0; i < elements.size(); i++)
+        {
+          ElementMode2D mode = elements[i]->get_mode();
+          this->set_current_order_range(elements[i]);
+          int element_max_order = std::max(this->current_max_order, std::max(H2D_GET_H_ORDER(quad_orders[i]), H2D_GET_V_ORDER(quad_orders[i])));
+          max_order[mode] = std::max(max_order[mode], std::min(element_max_order, H2DRS_MAX_ORDER + 1));
+        }
+
+        for(int mode_i = 0; mode_i < H2D_NUM_MODES; mode_i++)
+        {
+          if(max_order[mode_i] < 0)
+            continue;
+          ElementMode2D mode = (ElementMode2D)mode_i;
+          ensure_shape_vals(mode);
+
+          // triangles use the horizontal order only
+          int num_orders = max_order[mode] + 1;
+          int num_entries = mode == HERMES_MODE_TRIANGLE ? num_orders : num_orders * num_orders;
+          int entry;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(Hermes2DApi.get_num_threads())
+          for(entry = 0; entry < num_entries; entry++)
+          {
+            if(mode == HERMES_MODE_TRIANGLE)
+              build_projection_entry(mode, entry, entry);
+            else
+              build_projection_entry(mode, entry / num_orders, entry % num_orders);
+          }
+        }
+      }
+
+      template<typename Scalar>
+      void ProjBasedSelector<Scalar>::ensure_shape_vals(ElementMode2D mode)
+      {
+        if(cached_shape_vals_valid[mode])
+          return;
+
+#pragma omp critical (cached_shape_vals_valid)
+        if(!cached_shape_vals_valid[mode])
+        {
+          Quad2D* quad = &g_quad_2d_std;
+          double3* gip_points = quad->get_points(H2DRS_INTR_GIP_ORDER, mode);
+          int num_gip_points = quad->get_num_points(H2DRS_INTR_GIP_ORDER, mode);
+
+          Trf* trfs = mode == HERMES_MODE_TRIANGLE ? tri_trf : quad_trf;
+          int num_noni_trfs = mode == HERMES_MODE_TRIANGLE ? H2D_TRF_TRI_NUM : H2D_TRF_QUAD_NUM;
+
+          precalc_ortho_shapes(gip_points, num_gip_points, trfs, num_noni_trfs, this->shape_indices[mode], this->max_shape_inx[mode], cached_shape_ortho_vals[mode], mode);
+          precalc_shapes(gip_points, num_gip_points, trfs, num_noni_trfs, this->shape_indices[mode], this->max_shape_inx[mode], cached_shape_vals[mode], mode);
+#pragma omp flush
+          cached_shape_vals_valid[mode] = true;
+        }
+      }
+
+      template<typename Scalar>
+      int ProjBasedSelector<Scalar>::get_shape_inxs(ElementMode2D mode, int order_h, int order_v, int* shape_inxs, int max_num_shapes)
+      {
+        Hermes::vector<typename OptimumSelector<Scalar>::ShapeInx>& full_shape_indices = this->shape_indices[mode];
+        int num_shapes = 0;
+        for(unsigned int inx_shape = 0; inx_shape < full_shape_indices.size(); inx_shape++)
+        {
+          typename OptimumSelector<Scalar>::ShapeInx& shape = full_shape_indices[inx_shape];
+          if(order_h >= shape.order_h && order_v >= shape.order_v)
+          {
+            if(num_shapes >= max_num_shapes)
+              throw Exceptions::Exception("more shapes than predicted, possible incosistency");
+            shape_inxs[num_shapes] = shape.inx;
+            num_shapes++;
+          }
+        }
+        return num_shapes;
+      }
+
+      template<typename Scalar>
+      void ProjBasedSelector<Scalar>::build_projection_entry(ElementMode2D mode, int order_h, int order_v)
+      {
+        if(proj_matrix_cache[mode][order_h][order_v] != NULL)
+          return;
+
+        int max_num_shapes = (int)this->shape_indices[mode].size();
+        int* shape_inxs = new int[max_num_shapes];
+        int num_shapes = get_shape_inxs(mode, order_h, order_v, shape_inxs, max_num_shapes);
+        if(num_shapes > 0)
+        {
+          Quad2D* quad = &g_quad_2d_std;
+          double3* gip_points = quad->get_points(H2DRS_INTR_GIP_ORDER, mode);
+          int num_gip_points = quad->get_num_points(H2DRS_INTR_GIP_ORDER, mode);
+
+          double** proj_matrix = build_projection_matrix(gip_points, num_gip_points, shape_inxs, num_shapes, mode);
+          int* indx = new int[num_shapes];
+          double d;
+          ludcmp(proj_matrix, num_shapes, indx, &d);
+
+          // readers test the matrix, the pivots have to be visible first
+          proj_pivot_cache[mode][order_h][order_v] = indx;
+#pragma omp flush
+          proj_matrix_cache[mode][order_h][order_v] = proj_matrix;
+        }
+        delete [] shape_inxs;
+      }
+
       template<typename Scalar>
       void ProjBasedSelector<Scalar>::set_error_weights(double weight_h, double weight_p, double weight_aniso)
       {
@@ -131,8 +275,36 @@ namespace Hermes
         typename OptimumSelector<Scalar>::CandsInfo info_h, info_p, info_aniso;
         this->update_cands_info(info_h, info_p, info_aniso);
 
-        // calculate squared projection errors of elements of candidates
+        // mark the projections used by the candidates, all the other orders of the ranges are skipped
         CandElemProjError herr[4], anisoerr[4], perr;
+        for(int i = 0; i < H2DRS_MAX_ORDER + 2; i++)
+          for(int k = 0; k < H2DRS_MAX_ORDER + 2; k++)
+          {
+            perr[i][k] = H2DRS_ERR_NOT_NEEDED;
+            for(int j = 0; j < H2D_MAX_ELEMENT_SONS; j++)
+              herr[j][i][k] = anisoerr[j][i][k] = H2DRS_ERR_NOT_NEEDED;
+          }
+        for (unsigned i = 0; i < this->candidates.size(); i++)
+        {
+          typename OptimumSelector<Scalar>::Cand& c = this->candidates[i];
+          switch(c.split)
+          {
+          case H2D_REFINEMENT_H:
+            for (int j = 0; j < H2D_MAX_ELEMENT_SONS; j++)
+              herr[j][H2D_GET_H_ORDER(c.p[j])][tri ? H2D_GET_H_ORDER(c.p[j]) : H2D_GET_V_ORDER(c.p[j])] = 0.0;
+            break;
+          case H2D_REFINEMENT_ANISO_H:
+          case H2D_REFINEMENT_ANISO_V:
+            for (int j = 0; j < 2; j++)
+              anisoerr[(c.split == H2D_REFINEMENT_ANISO_H) ? j : j + 2][H2D_GET_H_ORDER(c.p[j])][H2D_GET_V_ORDER(c.p[j])] = 0.0;
+            break;
+          case H2D_REFINEMENT_P:
+            perr[H2D_GET_H_ORDER(c.p[0])][tri ? H2D_GET_H_ORDER(c.p[0]) : H2D_GET_V_ORDER(c.p[0])] = 0.0;
+            break;
+          }
+        }
+
+        // calculate squared projection errors of elements of candidates
         calc_projection_errors(e, info_h, info_p, info_aniso, rsln, herr, perr, anisoerr);
 
         //evaluate errors and dofs
@@ -246,12 +418,8 @@ namespace Hermes
         // obtain reference solution values on all four refined sons
         Scalar** rval[H2D_MAX_ELEMENT_SONS];
         Element* base_element = rsln->get_mesh()->get_element(e->id);
-        if(base_element->active)
-        {
-          this->info("Have you calculated element errors twice with solutions_for_adaptivity == true?");
-        };
 
-        // value on base element.
+        // value on base element (the reference mesh not refined - p-only reference, see Mesh::ReferenceMeshCreator).
         if(base_element->active)
         {
           for (int son = 0; son < H2D_MAX_ELEMENT_SONS; son++)
@@ -295,18 +463,7 @@ namespace Hermes
         }
 
         // precalculate values of shape functions
-        TrfShape empty_shape_vals;
-
-        if(!cached_shape_vals_valid[mode])
-        {
-#pragma omp critical (cached_shape_vals_valid)
-          if(!cached_shape_vals_valid[mode])
-          {
-            precalc_ortho_shapes(gip_points, num_gip_points, trfs, num_noni_trfs, this->shape_indices[mode], this->max_shape_inx[mode], cached_shape_ortho_vals[mode], mode);
-            precalc_shapes(gip_points, num_gip_points, trfs, num_noni_trfs, this->shape_indices[mode], this->max_shape_inx[mode], cached_shape_vals[mode], mode);
-            cached_shape_vals_valid[mode] = true;
-          }
-        }
+        ensure_shape_vals(mode);
 
         //issue a warning if ortho values are defined and the selected cand_list might benefit from that but it cannot because elements do not have uniform orders
         if(!warn_uniform_orders && mode == HERMES_MODE_QUAD && !cached_shape_ortho_vals[mode][H2D_TRF_IDENTITY].empty())
@@ -437,11 +594,8 @@ namespace Hermes
         int max_num_shapes = this->next_order_shape[mode][this->current_max_order];
         Scalar* right_side = new Scalar[max_num_shapes];
         int* shape_inxs = new int[max_num_shapes];
-        int* indx = new int[max_num_shapes]; //solver data
-        double* d = new double[max_num_shapes]; //solver data
-        double** proj_matrix = new_matrix<double>(max_num_shapes, max_num_shapes);
         ProjMatrixCache& proj_matrices = proj_matrix_cache[mode];
-        Hermes::vector<typename OptimumSelector<Scalar>::ShapeInx>& full_shape_indices = this->shape_indices[mode];
+        ProjPivotCache& proj_pivots = proj_pivot_cache[mode];
 
         //check whether ortho-svals are available
         bool ortho_svals_available = true;
@@ -463,21 +617,12 @@ namespace Hermes
           int quad_order = order_perm.get_quad_order();
           int order_h = H2D_GET_H_ORDER(quad_order), order_v = H2D_GET_V_ORDER(quad_order);
 
+          //skip orders no candidate consists of
+          if(errors_squared[order_h][order_v] == H2DRS_ERR_NOT_NEEDED)
+            continue;
+
           //build a list of shape indices from the full list
-          int num_shapes = 0;
-          unsigned int inx_shape = 0;
-          while (inx_shape < full_shape_indices.size())
-          {
-            typename OptimumSelector<Scalar>::ShapeInx& shape = full_shape_indices[inx_shape];
-            if(order_h >= shape.order_h && order_v >= shape.order_v)
-            {
-              if(num_shapes >= max_num_shapes)
-                throw Exceptions::Exception("more shapes than predicted, possible incosistency");
-              shape_inxs[num_shapes] = shape.inx;
-              num_shapes++;
-            }
-            inx_shape++;
-          }
+          int num_shapes = get_shape_inxs(mode, order_h, order_v, shape_inxs, max_num_shapes);
 
           //continue only if there are shapes to process
           if(num_shapes == 0)
@@ -489,12 +634,11 @@ namespace Hermes
           Hermes::vector< ValueCacheItem<Scalar> >& rhs_cache = use_ortho ? ortho_rhs_cache : nonortho_rhs_cache;
           Hermes::vector<TrfShapeExp>** sub_svals = use_ortho ? sub_ortho_svals : sub_nonortho_svals;
 
-          //calculate projection matrix iff no ortho is used
-          if(!use_ortho)
+          //obtain LU-decomposed projection matrix iff no ortho is used, it is usually precalculated in prepare_selection()
+          if(!use_ortho && proj_matrices[order_h][order_v] == NULL)
           {
-            if(proj_matrices[order_h][order_v] == NULL)
-              proj_matrices[order_h][order_v] = build_projection_matrix(gip_points, num_gip_points, shape_inxs, num_shapes, mode);
-            copy_matrix(proj_matrix, proj_matrices[order_h][order_v], num_shapes, num_shapes); //copy projection matrix because original matrix will be modified
+#pragma omp critical (proj_matrix_cache)
+            build_projection_entry(mode, order_h, order_v);
           }
 
           //build right side (fill cache values that are missing)
@@ -529,8 +673,8 @@ namespace Hermes
           //solve iff no ortho is used
           if(!use_ortho)
           {
-            ludcmp(proj_matrix, num_shapes, indx, d);
-            lubksb<Scalar>(proj_matrix, num_shapes, indx, right_side);
+#pragma omp flush
+            lubksb<Scalar>(proj_matrices[order_h][order_v], num_shapes, proj_pivots[order_h][order_v], right_side);
           }
 
           //calculate error
@@ -548,11 +692,8 @@ namespace Hermes
         }
         while (order_perm.next());
 
-        delete [] proj_matrix;
         delete [] right_side;
         delete [] shape_inxs;
-        delete [] indx;
-        delete [] d;
       }
 
       template class HERMES_API ProjBasedSelector<double>;
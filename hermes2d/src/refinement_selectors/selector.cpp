@@ -8,6 +8,33 @@ namespace Hermes
   {
     namespace RefinementSelectors
     {
+      template<typename Scalar>
+      Selector<Scalar>::~Selector()
+      {
+        if(!this->isAClone)
+          for(unsigned int i = 0; i < this->thread_selectors.size(); i++)
+            delete this->thread_selectors[i];
+      }
+
+      template<typename Scalar>
+      Selector<Scalar>* Selector<Scalar>::get_thread_selector(unsigned int thread_i)
+      {
+        if(thread_i == 0)
+          return this;
+
+        if(this->thread_selectors.size() < thread_i)
+          this->thread_selectors.resize(thread_i, NULL);
+
+        Selector<Scalar>*& selector = this->thread_selectors[thread_i - 1];
+        if(selector == NULL)
+        {
+          selector = this->clone();
+          selector->isAClone = true;
+        }
+        this->update_clone(selector);
+        return selector;
+      }
+
       template<typename Scalar>
       Selector<Scalar>* HOnlySelector<Scalar>::clone()
       {
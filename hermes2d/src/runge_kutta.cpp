@@ -25,8 +25,8 @@ namespace Hermes
     template<typename Scalar>
     RungeKutta<Scalar>::RungeKutta(const WeakForm<Scalar>* wf, Hermes::vector<const Space<Scalar> *> spaces, ButcherTable* bt)
       : wf(wf), bt(bt), num_stages(bt->get_size()), stage_wf_right(bt->get_size() * spaces.size()),
-      stage_wf_left(spaces.size()), start_from_zero_K_vector(false), block_diagonal_jacobian(false), residual_as_vector(true), iteration(0),
-      freeze_jacobian(false), newton_tol(1e-6), newton_max_iter(20), newton_damping_coeff(1.0), newton_max_allowed_residual_norm(1e10)
+      stage_wf_left(spaces.size()), stage_wf_explicit(spaces.size()), stage_wf_diagonally_implicit(spaces.size()), start_from_zero_K_vector(false), block_diagonal_jacobian(false), residual_as_vector(true), iteration(0),
+      freeze_jacobian(false), jacobian_update_policy(NULL), newton_tol(1e-6), newton_max_iter(20), newton_damping_coeff(1.0), newton_max_allowed_residual_norm(1e10)
     {
       for(unsigned int i = 0; i < spaces.size(); i++)
       {
@@ -59,13 +59,19 @@ namespace Hermes
 
       this->stage_dp_left = NULL;
       this->stage_dp_right = NULL;
+      this->stage_dp_explicit = NULL;
+      this->explicit_mass_diag = NULL;
+      this->explicit_rhs = NULL;
+      this->explicit_mass_solver = NULL;
+      this->stage_dp_diagonally_implicit = NULL;
+      this->diagonally_implicit_jacobian_coeff = -1.0;
     }
 
     template<typename Scalar>
     RungeKutta<Scalar>::RungeKutta(const WeakForm<Scalar>* wf, const Space<Scalar>* space, ButcherTable* bt)
       : wf(wf), bt(bt), num_stages(bt->get_size()), stage_wf_right(bt->get_size() * 1),
-      stage_wf_left(1), start_from_zero_K_vector(false), block_diagonal_jacobian(false), residual_as_vector(true), iteration(0),
-      freeze_jacobian(false), newton_tol(1e-6), newton_max_iter(20), newton_damping_coeff(1.0), newton_max_allowed_residual_norm(1e10)
+      stage_wf_left(1), stage_wf_explicit(1), stage_wf_diagonally_implicit(1), start_from_zero_K_vector(false), block_diagonal_jacobian(false), residual_as_vector(true), iteration(0),
+      freeze_jacobian(false), jacobian_update_policy(NULL), newton_tol(1e-6), newton_max_iter(20), newton_damping_coeff(1.0), newton_max_allowed_residual_norm(1e10)
     {
       this->spaces.push_back(space);
       this->spaces_seqs.push_back(space->get_seq());
@@ -93,6 +99,12 @@ namespace Hermes
 
       this->stage_dp_left = NULL;
       this->stage_dp_right = NULL;
+      this->stage_dp_explicit = NULL;
+      this->explicit_mass_diag = NULL;
+      this->explicit_rhs = NULL;
+      this->explicit_mass_solver = NULL;
+      this->stage_dp_diagonally_implicit = NULL;
+      this->diagonally_implicit_jacobian_coeff = -1.0;
     }
 
     template<typename Scalar>
@@ -118,7 +130,10 @@ namespace Hermes
         delete [] K_vector;
         K_vector = new Scalar[num_stages * Space<Scalar>::get_num_dofs(this->spaces)];
         this->info("\tRunge-Kutta: K vectors are being set to zero, as the spaces changed during computation.");
+        if(this->jacobian_update_policy != NULL)
+          this->jacobian_update_policy->reset();
         memset(K_vector, 0, num_stages * Space<Scalar>::get_num_dofs(this->spaces) * sizeof(Scalar));
+        this->diagonally_implicit_jacobian_coeff = -1.0;
       }
       delete [] u_ext_vec;
       u_ext_vec = new Scalar[num_stages * Space<Scalar>::get_num_dofs(this->spaces)];
@@ -127,6 +142,10 @@ namespace Hermes
 
       if(this->stage_dp_left != NULL)
         static_cast<DiscreteProblem<Scalar>*>(this->stage_dp_left)->set_spaces(this->spaces);
+      if(this->stage_dp_explicit != NULL)
+        this->stage_dp_explicit->set_spaces(this->spaces);
+      if(this->stage_dp_diagonally_implicit != NULL)
+        this->stage_dp_diagonally_implicit->set_spaces(this->spaces);
     }
 
     template<typename Scalar>
@@ -149,6 +168,7 @@ namespace Hermes
         K_vector = new Scalar[num_stages * Space<Scalar>::get_num_dofs(this->spaces)];
         this->info("\tRunge-Kutta: K vector is being set to zero, as the spaces changed during computation.");
         memset(K_vector, 0, num_stages * Space<Scalar>::get_num_dofs(this->spaces) * sizeof(Scalar));
+        this->diagonally_implicit_jacobian_coeff = -1.0;
       }
       delete [] u_ext_vec;
       u_ext_vec = new Scalar[num_stages * Space<Scalar>::get_num_dofs(this->spaces)];
@@ -157,6 +177,10 @@ namespace Hermes
 
       if(this->stage_dp_left != NULL)
         static_cast<DiscreteProblem<Scalar>*>(this->stage_dp_left)->set_space(space);
+      if(this->stage_dp_explicit != NULL)
+        this->stage_dp_explicit->set_space(space);
+      if(this->stage_dp_diagonally_implicit != NULL)
+        this->stage_dp_diagonally_implicit->set_space(space);
     }
 
     template<typename Scalar>
@@ -174,11 +198,15 @@ namespace Hermes
       {
         this->stage_wf_left.set_verbose_output(true);
         this->stage_wf_right.set_verbose_output(true);
+        this->stage_wf_explicit.set_verbose_output(true);
+        this->stage_wf_diagonally_implicit.set_verbose_output(true);
       }
       else
       {
         this->stage_wf_left.set_verbose_output(false);
         this->stage_wf_right.set_verbose_output(false);
+        this->stage_wf_explicit.set_verbose_output(false);
+        this->stage_wf_diagonally_implicit.set_verbose_output(false);
       }
 
       // The tensor discrete problem is created in two parts. First, matrix_left is the Jacobian
@@ -191,18 +219,31 @@ namespace Hermes
       this->stage_dp_left = new DiscreteProblem<Scalar>(&stage_wf_left, spaces);
       
       // All Spaces of the problem.
-      Hermes::vector<const Space<Scalar>*> stage_spaces_vector;
+      Hermes::vector<const Space<Scalar>*> init_stage_spaces;
 
       // Create spaces for stage solutions K_i. This is necessary
       // to define a num_stages x num_stages block weak formulation.
       for (unsigned int i = 0; i < num_stages; i++)
         for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
-          stage_spaces_vector.push_back(spaces[space_i]);
+          init_stage_spaces.push_back(spaces[space_i]);
 
-      this->stage_dp_right = new DiscreteProblem<Scalar>(&stage_wf_right, stage_spaces_vector);
+      this->stage_dp_right = new DiscreteProblem<Scalar>(&stage_wf_right, init_stage_spaces);
 
       stage_dp_right->set_RK(spaces.size());
 
+      // One stage of an explicit method.
+      if(bt->is_explicit())
+      {
+        this->stage_dp_explicit = new DiscreteProblem<Scalar>(&stage_wf_explicit, spaces);
+        this->stage_dp_explicit->set_RK(spaces.size());
+      }
+      // One stage of a diagonally implicit method.
+      else if(bt->is_diagonally_implicit())
+      {
+        this->stage_dp_diagonally_implicit = new DiscreteProblem<Scalar>(&stage_wf_diagonally_implicit, spaces);
+        this->stage_dp_diagonally_implicit->set_RK(spaces.size());
+      }
+
       // Prepare residuals of stage solutions.
       if(!residual_as_vector)
         for (unsigned int i = 0; i < num_stages; i++)
@@ -233,6 +274,12 @@ namespace Hermes
     {
       this->freeze_jacobian = true;
     }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::set_jacobian_update_policy(JacobianUpdatePolicy* policy)
+    {
+      this->jacobian_update_policy = policy;
+    }
     template<typename Scalar>
     void RungeKutta<Scalar>::set_newton_tol(double newton_tol)
     {
@@ -261,6 +308,15 @@ namespace Hermes
         delete stage_dp_left;
       if(stage_dp_right != NULL)
         delete stage_dp_right;
+      for (unsigned int i = 0; i < stage_spaces_vector.size(); i++)
+        delete stage_spaces_vector[i];
+      if(stage_dp_explicit != NULL)
+        delete stage_dp_explicit;
+      if(stage_dp_diagonally_implicit != NULL)
+        delete stage_dp_diagonally_implicit;
+      delete [] explicit_mass_diag;
+      delete explicit_mass_solver;
+      delete explicit_rhs;
       delete solver;
       delete matrix_right;
       delete matrix_left;
@@ -326,155 +382,137 @@ namespace Hermes
       for (unsigned int stage_i = 0; stage_i < num_stages; stage_i++)
         Space<Scalar>::update_essential_bc_values(spaces_mutable, this->time + bt->get_C(stage_i)*this->time_step);
 
-      // All Spaces of the problem.
-      Hermes::vector<const Space<Scalar>*> stage_spaces_vector;
-
-      // Create spaces for stage solutions K_i. This is necessary
-      // to define a num_stages x num_stages block weak formulation.
-      for (unsigned int i = 0; i < num_stages; i++)
-        for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+      if(bt->is_explicit())
+        this->rk_time_step_explicit(slns_time_prev, slns_time_new);
+      else if(bt->is_diagonally_implicit())
+        this->rk_time_step_diagonally_implicit(slns_time_prev, slns_time_new);
+      else
+      {
+        // The spaces of the stage solutions K_i, kept (with the sparse structure of stage_dp_right) until the spaces change.
+        prepare_stage_spaces();
+
+        // Zero utility vectors.
+        if(start_from_zero_K_vector || !iteration)
+          memset(K_vector, 0, num_stages * ndof * sizeof(Scalar));
+        memset(u_ext_vec, 0, num_stages * ndof * sizeof(Scalar));
+        memset(vector_left, 0, num_stages * ndof * sizeof(Scalar));
+
+        // Assemble the block-diagonal mass matrix M of size ndof times ndof.
+        // The corresponding part of the global residual vector is obtained
+        // just by multiplication with the stage vector K.
+        assemble_mass_matrix();
+
+        // The Newton's loop.
+        double residual_norm;
+        double last_residual_norm = 0.0;
+        int it = 1;
+        while (true)
         {
-          typename Space<Scalar>::ReferenceSpaceCreator ref_space_creator(spaces[space_i], spaces[space_i]->get_mesh(), 0);
-          stage_spaces_vector.push_back(ref_space_creator.create_ref_space());
-        }
+          // Prepare vector h\sum_{j = 1}^s a_{ij} K_j.
+          prepare_u_ext_vec();
 
-      this->stage_dp_right->set_spaces(stage_spaces_vector);
-
-      // Zero utility vectors.
-      if(start_from_zero_K_vector || !iteration)
-        memset(K_vector, 0, num_stages * ndof * sizeof(Scalar));
-      memset(u_ext_vec, 0, num_stages * ndof * sizeof(Scalar));
-      memset(vector_left, 0, num_stages * ndof * sizeof(Scalar));
-
-      // Assemble the block-diagonal mass matrix M of size ndof times ndof.
-      // The corresponding part of the global residual vector is obtained
-      // just by multiplication with the stage vector K.
-      // FIXME: This should not be repeated if spaces have not changed.
-      stage_dp_left->assemble(matrix_left, NULL);
-
-      // The Newton's loop.
-      double residual_norm;
-      int it = 1;
-      while (true)
-      {
-        // Prepare vector h\sum_{j = 1}^s a_{ij} K_j.
-        prepare_u_ext_vec();
+          // Reinitialize filters.
+          if(this->filters_to_reinit.size() > 0)
+          {
+            Solution<Scalar>::vector_to_solutions(u_ext_vec, spaces, slns_time_new);
 
-        // Reinitialize filters.
-        if(this->filters_to_reinit.size() > 0)
-        {
-          Solution<Scalar>::vector_to_solutions(u_ext_vec, spaces, slns_time_new);
+            for(unsigned int filters_i = 0; filters_i < this->filters_to_reinit.size(); filters_i++)
+              filters_to_reinit.at(filters_i)->reinit();
+          }
 
-          for(unsigned int filters_i = 0; filters_i < this->filters_to_reinit.size(); filters_i++)
-            filters_to_reinit.at(filters_i)->reinit();
-        }
+          // Residual corresponding to the stage derivatives k_i in the equation k_i - f(...) = 0.
+          multiply_as_diagonal_block_matrix(matrix_left, num_stages, K_vector, vector_left);
 
-        // Residual corresponding to the stage derivatives k_i in the equation k_i - f(...) = 0.
-        multiply_as_diagonal_block_matrix(matrix_left, num_stages, K_vector, vector_left);
+          // Assemble the block Jacobian matrix of the stationary residual F.
+          // Diagonal blocks are created even if empty, so that matrix_left can be added later.
+          bool force_diagonal_blocks = true;
+          stage_dp_right->assemble(u_ext_vec, NULL, vector_right, force_diagonal_blocks);
 
-        // Assemble the block Jacobian matrix of the stationary residual F.
-        // Diagonal blocks are created even if empty, so that matrix_left can be added later.
-        bool force_diagonal_blocks = true;
-        stage_dp_right->assemble(u_ext_vec, NULL, vector_right, force_diagonal_blocks);
+          // Finalizing the residual vector.
+          vector_right->add_vector(vector_left);
 
-        // Finalizing the residual vector.
-        vector_right->add_vector(vector_left);
+          // Multiply the residual vector with -1 since the matrix
+          // equation reads J(Y^n) \deltaY^{n + 1} = -F(Y^n).
+          vector_right->change_sign();
+          if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
+            this->dump_rhs(vector_right, it);
 
-        // Multiply the residual vector with -1 since the matrix
-        // equation reads J(Y^n) \deltaY^{n + 1} = -F(Y^n).
-        vector_right->change_sign();
-        if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
-        {
-          char* fileName = new char[this->RhsFilename.length() + 5];
-          if(this->RhsFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-            sprintf(fileName, "%s%i.m", this->RhsFilename.c_str(), it);
+          // Measure the residual norm.
+          if(residual_as_vector)
+            // Calculate the l2-norm of residual vector.
+            residual_norm = Global<Scalar>::get_l2_norm(vector_right);
           else
-            sprintf(fileName, "%s%i", this->RhsFilename.c_str(), it);
-          FILE* rhs_file = fopen(fileName, "w+");
-          vector_right->dump(rhs_file, this->RhsVarname.c_str(), this->RhsFormat, this->rhs_number_format);
-          fclose(rhs_file);
-        }
+          {
+            // Translate residual vector into residual functions.
+            Hermes::vector<bool> add_dir_lift_vector;
+            add_dir_lift_vector.reserve(1);
+            add_dir_lift_vector.push_back(false);
+            Solution<Scalar>::vector_to_solutions(vector_right, stage_dp_right->get_spaces(),
+              residuals_vector, false);
+            residual_norm = Global<Scalar>::calc_norms(residuals_vector);
+          }
 
-        // Measure the residual norm.
-        if(residual_as_vector)
-          // Calculate the l2-norm of residual vector.
-          residual_norm = Global<Scalar>::get_l2_norm(vector_right);
-        else
-        {
-          // Translate residual vector into residual functions.
-          Hermes::vector<bool> add_dir_lift_vector;
-          add_dir_lift_vector.reserve(1);
-          add_dir_lift_vector.push_back(false);
-          Solution<Scalar>::vector_to_solutions(vector_right, stage_dp_right->get_spaces(),
-            residuals_vector, false);
-          residual_norm = Global<Scalar>::calc_norms(residuals_vector);
-        }
+          // Info for the user.
+          if(it == 1)
+            this->info("\tRunge-Kutta: Newton initial residual norm: %g", residual_norm);
+          else
+            this->info("\tRunge-Kutta: Newton iteration %d, residual norm: %g", it-1, residual_norm);
 
-        // Info for the user.
-        if(it == 1)
-          this->info("\tRunge-Kutta: Newton initial residual norm: %g", residual_norm);
-        else
-          this->info("\tRunge-Kutta: Newton iteration %d, residual norm: %g", it-1, residual_norm);
+          // If maximum allowed residual norm is exceeded, fail.
+          if(residual_norm > newton_max_allowed_residual_norm)
+          {
+            throw Exceptions::ValueException("residual norm", residual_norm, newton_max_allowed_residual_norm);
+          }
 
-        // If maximum allowed residual norm is exceeded, fail.
-        if(residual_norm > newton_max_allowed_residual_norm)
-        {
-          throw Exceptions::ValueException("residual norm", residual_norm, newton_max_allowed_residual_norm);
-        }
+          // If residual norm is within tolerance, or the maximum number
+          // of iteration has been reached, or the problem is linear, then quit.
+          if((residual_norm < newton_tol || it > newton_max_iter) && it > 1)
+            break;
 
-        // If residual norm is within tolerance, or the maximum number
-        // of iteration has been reached, or the problem is linear, then quit.
-        if((residual_norm < newton_tol || it > newton_max_iter) && it > 1)
-          break;
+          bool rhs_only;
+          if(this->jacobian_update_policy != NULL)
+            rhs_only = !this->jacobian_update_policy->reassemble_jacobian(residual_norm, last_residual_norm, this->time_step);
+          else
+            rhs_only = (freeze_jacobian && it > 1);
+          last_residual_norm = residual_norm;
+          if(!rhs_only)
+          {
+            // Assemble the block Jacobian matrix of the stationary residual F
+            // Diagonal blocks are created even if empty, so that matrix_left
+            // can be added later.
+            stage_dp_right->assemble(u_ext_vec, matrix_right, NULL, force_diagonal_blocks);
 
-        bool rhs_only = (freeze_jacobian && it > 1);
-        if(!rhs_only)
-        {
-          // Assemble the block Jacobian matrix of the stationary residual F
-          // Diagonal blocks are created even if empty, so that matrix_left
-          // can be added later.
-          stage_dp_right->assemble(u_ext_vec, matrix_right, NULL, force_diagonal_blocks);
+            // Adding the block mass matrix M to matrix_right. This completes the
+            // resulting tensor Jacobian.
+            matrix_right->add_sparse_to_diagonal_blocks(num_stages, matrix_left);
 
-          // Adding the block mass matrix M to matrix_right. This completes the
-          // resulting tensor Jacobian.
-          matrix_right->add_sparse_to_diagonal_blocks(num_stages, matrix_left);
+            if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
+              this->dump_matrix(matrix_right, it);
 
-          if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
-          {
-            char* fileName = new char[this->matrixFilename.length() + 5];
-            if(this->matrixFormat == Hermes::Algebra::DF_MATLAB_SPARSE)
-              sprintf(fileName, "%s%i.m", this->matrixFilename.c_str(), it);
-            else
-              sprintf(fileName, "%s%i", this->matrixFilename.c_str(), it);
-            FILE* matrix_file = fopen(fileName, "w+");
-
-            matrix_right->dump(matrix_file, this->matrixVarname.c_str(), this->matrixFormat, this->matrix_number_format);
-            fclose(matrix_file);
+            matrix_right->finish();
+            solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
           }
+          else
+            solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
 
-          matrix_right->finish();
-        }
-        else
-          solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
-
-        // Solve the linear system.
-        if(!solver->solve())
-          throw Exceptions::LinearMatrixSolverException();
+          // Solve the linear system.
+          if(!solver->solve())
+            throw Exceptions::LinearMatrixSolverException();
 
-        // Add \deltaK^{n + 1} to K^n.
-        for (unsigned int i = 0; i < num_stages*ndof; i++)
-          K_vector[i] += newton_damping_coeff * solver->get_sln_vector()[i];
+          // Add \deltaK^{n + 1} to K^n.
+          Hermes::Algebra::VectorKernels::axpy(num_stages * ndof, Scalar(newton_damping_coeff), solver->get_sln_vector(), K_vector);
 
-        // Increase iteration counter.
-        it++;
-      }
+          // Increase iteration counter.
+          it++;
+        }
 
-      // If max number of iterations was exceeded, fail.
-      if(it >= newton_max_iter)
-      {
-        this->tick();
-        this->info("\tRunge-Kutta: time step duration: %f s.\n", this->last());
-        throw Exceptions::ValueException("Newton iterations", it, newton_max_iter);
+        // If max number of iterations was exceeded, fail.
+        if(it >= newton_max_iter)
+        {
+          this->tick();
+          this->info("\tRunge-Kutta: time step duration: %f s.\n", this->last());
+          throw Exceptions::ValueException("Newton iterations", it, newton_max_iter);
+        }
       }
 
       // Project previous time level solution on the stage space,
@@ -494,21 +532,9 @@ namespace Hermes
         ogProjection.project_local(spaces, slns_time_prev, coeff_vec);
       }
 
-      if(do_global_projections)
-      {
-        OGProjection<Scalar> ogProjection;
-        ogProjection.project_global(spaces, slns_time_prev, coeff_vec);
-      }
-      else
-      {
-        LocalProjection<Scalar> ogProjection;
-        ogProjection.project_local(spaces, slns_time_prev, coeff_vec);
-      }
-
       // Calculate new time level solution in the stage space (u_{n + 1} = u_n + h \sum_{j = 1}^s b_j k_j).
-      for (int i = 0; i < ndof; i++)
-        for (unsigned int j = 0; j < num_stages; j++)
-          coeff_vec[i] += this->time_step * bt->get_B(j) * K_vector[j * ndof + i];
+      for (unsigned int j = 0; j < num_stages; j++)
+        Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(this->time_step * bt->get_B(j)), K_vector + j * ndof, coeff_vec);
 
       Solution<Scalar>::vector_to_solutions(coeff_vec, spaces, slns_time_new);
 
@@ -516,20 +542,12 @@ namespace Hermes
       // table to calculate the temporal error estimate.
       if(error_fns != Hermes::vector<Solution<Scalar>*>())
       {
-        for (int i = 0; i < ndof; i++)
-        {
-          coeff_vec[i] = 0.;
-          for (unsigned int j = 0; j < num_stages; j++)
-            coeff_vec[i] += (bt->get_B(j) - bt->get_B2(j)) * K_vector[j * ndof + i];
-          coeff_vec[i] *= this->time_step;
-        }
+        Hermes::Algebra::VectorKernels::zero(ndof, coeff_vec);
+        for (unsigned int j = 0; j < num_stages; j++)
+          Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(this->time_step * (bt->get_B(j) - bt->get_B2(j))), K_vector + j * ndof, coeff_vec);
         Solution<Scalar>::vector_to_solutions_common_dir_lift(coeff_vec, spaces, error_fns);
       }
 
-      // Delete stage spaces.
-      for (unsigned int i = 0; i < num_stages * spaces.size(); i++)
-          delete stage_spaces_vector[i];
-
       // Delete all residuals.
       if(!residual_as_vector)
         for (unsigned int i = 0; i < num_stages; i++)
@@ -543,6 +561,331 @@ namespace Hermes
       this->info("\tRunge-Kutta: time step duration: %f s.\n", this->last());
     }
 
+    template<typename Scalar>
+    void RungeKutta<Scalar>::prepare_stage_spaces()
+    {
+      bool spaces_changed = this->stage_spaces_seqs.size() != spaces.size();
+      for(unsigned int space_i = 0; space_i < spaces.size() && !spaces_changed; space_i++)
+        if(this->stage_spaces_seqs[space_i] != spaces[space_i]->get_seq())
+          spaces_changed = true;
+
+      // The copies share the essential boundary conditions of spaces, whose time has just been set.
+      if(!spaces_changed)
+      {
+        Space<Scalar>::update_essential_bc_values(this->stage_spaces_vector, this->time + bt->get_C(num_stages - 1) * this->time_step);
+        return;
+      }
+
+      this->stage_spaces_seqs.clear();
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+        this->stage_spaces_seqs.push_back(spaces[space_i]->get_seq());
+
+      for (unsigned int i = 0; i < this->stage_spaces_vector.size(); i++)
+        delete this->stage_spaces_vector[i];
+      this->stage_spaces_vector.clear();
+
+      // Create spaces for stage solutions K_i. This is necessary
+      // to define a num_stages x num_stages block weak formulation.
+      Hermes::vector<const Space<Scalar>*> stage_spaces_const;
+      for (unsigned int i = 0; i < num_stages; i++)
+        for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+        {
+          typename Space<Scalar>::ReferenceSpaceCreator ref_space_creator(spaces[space_i], spaces[space_i]->get_mesh(), 0);
+          Space<Scalar>* stage_space = ref_space_creator.create_ref_space();
+          this->stage_spaces_vector.push_back(stage_space);
+          stage_spaces_const.push_back(stage_space);
+        }
+
+      this->stage_dp_right->set_spaces(stage_spaces_const);
+    }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::assemble_mass_matrix()
+    {
+      bool spaces_changed = this->mass_matrix_seqs.size() != spaces.size();
+      for(unsigned int space_i = 0; space_i < spaces.size() && !spaces_changed; space_i++)
+        if(this->mass_matrix_seqs[space_i] != spaces[space_i]->get_seq())
+          spaces_changed = true;
+      if(!spaces_changed)
+        return;
+
+      this->mass_matrix_seqs.clear();
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+        this->mass_matrix_seqs.push_back(spaces[space_i]->get_seq());
+
+      stage_dp_left->assemble(matrix_left, NULL);
+    }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::reset_K_vector()
+    {
+      memset(K_vector, 0, num_stages * Space<Scalar>::get_num_dofs(this->spaces) * sizeof(Scalar));
+      this->diagonally_implicit_jacobian_coeff = -1.0;
+      if(this->jacobian_update_policy != NULL)
+        this->jacobian_update_policy->reset();
+    }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::prepare_explicit_mass()
+    {
+      bool spaces_changed = this->explicit_mass_seqs.size() != spaces.size();
+      for(unsigned int space_i = 0; space_i < spaces.size() && !spaces_changed; space_i++)
+        if(this->explicit_mass_seqs[space_i] != spaces[space_i]->get_seq())
+          spaces_changed = true;
+      if(!spaces_changed)
+        return;
+
+      this->explicit_mass_seqs.clear();
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+        this->explicit_mass_seqs.push_back(spaces[space_i]->get_seq());
+
+      if(this->explicit_rhs == NULL)
+        this->explicit_rhs = create_vector<Scalar>();
+
+      // A diagonal mass matrix (L2 spaces of orthogonal shapesets on affine elements) is just inverted.
+      int ndof = Space<Scalar>::get_num_dofs(spaces);
+      delete [] this->explicit_mass_diag;
+      this->explicit_mass_diag = new double[ndof];
+      int first_dof = 0;
+      for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+      {
+        if(!spaces[space_i]->get_diagonal_mass_matrix(this->explicit_mass_diag, first_dof))
+        {
+          delete [] this->explicit_mass_diag;
+          this->explicit_mass_diag = NULL;
+          break;
+        }
+        first_dof += spaces[space_i]->get_num_dofs();
+      }
+
+      // Otherwise the mass matrix is factorized in the first stage, the factorization is reused until the spaces change.
+      if(this->explicit_mass_diag == NULL)
+      {
+        assemble_mass_matrix();
+        if(this->explicit_mass_solver == NULL)
+          this->explicit_mass_solver = create_linear_solver(matrix_left, this->explicit_rhs);
+        this->explicit_mass_solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+      }
+    }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::rk_time_step_explicit(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new)
+    {
+      int ndof = Space<Scalar>::get_num_dofs(spaces);
+
+      if(this->wf->global_integration_order_set)
+        this->stage_wf_explicit.set_global_integration_order(this->wf->global_integration_order);
+
+      // The previous time level is added to u_ext by the discrete problem (see DiscreteProblem::set_RK()).
+      this->stage_wf_explicit.ext.clear();
+      for(unsigned int slns_time_prev_i = 0; slns_time_prev_i < slns_time_prev.size(); slns_time_prev_i++)
+        this->stage_wf_explicit.ext.push_back(slns_time_prev[slns_time_prev_i]);
+
+      this->prepare_explicit_mass();
+
+      // A is strictly lower triangular, the stage i only needs the stages before it.
+      for (unsigned int stage_i = 0; stage_i < num_stages; stage_i++)
+      {
+        // h \sum_{j < i} a_{ij} K_j.
+        memset(u_ext_vec, 0, ndof * sizeof(Scalar));
+        for (unsigned int stage_j = 0; stage_j < stage_i; stage_j++)
+          if(bt->get_A(stage_i, stage_j) != 0.0)
+            Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(this->time_step * bt->get_A(stage_i, stage_j)), K_vector + stage_j * ndof, u_ext_vec);
+
+        // Reinitialize filters.
+        if(this->filters_to_reinit.size() > 0)
+        {
+          Solution<Scalar>::vector_to_solutions(u_ext_vec, spaces, slns_time_new);
+
+          for(unsigned int filters_i = 0; filters_i < this->filters_to_reinit.size(); filters_i++)
+            filters_to_reinit.at(filters_i)->reinit();
+        }
+
+        double stage_time = this->time + bt->get_C(stage_i) * this->time_step;
+        for (unsigned int m = 0; m < stage_wf_explicit.vfvol.size(); m++)
+          stage_wf_explicit.vfvol[m]->set_current_stage_time(stage_time);
+        for (unsigned int m = 0; m < stage_wf_explicit.vfsurf.size(); m++)
+          stage_wf_explicit.vfsurf[m]->set_current_stage_time(stage_time);
+
+        // The residual only, the vector forms are scaled by -1 as in stage_wf_right, K_i = -M^{-1} (-F(t_i, Y_i)).
+        stage_dp_explicit->assemble(u_ext_vec, explicit_rhs);
+        if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= (int)stage_i + 1))
+          this->dump_rhs(explicit_rhs, stage_i + 1);
+
+        Scalar* K_i = K_vector + stage_i * ndof;
+        if(this->explicit_mass_diag != NULL)
+        {
+          for (int i = 0; i < ndof; i++)
+            K_i[i] = -explicit_rhs->get(i) / this->explicit_mass_diag[i];
+        }
+        else
+        {
+          if(!explicit_mass_solver->solve())
+            throw Exceptions::LinearMatrixSolverException();
+          explicit_mass_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+          Scalar* mass_sln = explicit_mass_solver->get_sln_vector();
+          for (int i = 0; i < ndof; i++)
+            K_i[i] = -mass_sln[i];
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void RungeKutta<Scalar>::rk_time_step_diagonally_implicit(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new)
+    {
+      int ndof = Space<Scalar>::get_num_dofs(spaces);
+
+      if(this->wf->global_integration_order_set)
+        this->stage_wf_diagonally_implicit.set_global_integration_order(this->wf->global_integration_order);
+
+      // The previous time level is added to u_ext by the discrete problem (see DiscreteProblem::set_RK()).
+      this->stage_wf_diagonally_implicit.ext.clear();
+      for(unsigned int slns_time_prev_i = 0; slns_time_prev_i < slns_time_prev.size(); slns_time_prev_i++)
+        this->stage_wf_diagonally_implicit.ext.push_back(slns_time_prev[slns_time_prev_i]);
+
+      if(start_from_zero_K_vector || !iteration)
+        memset(K_vector, 0, num_stages * ndof * sizeof(Scalar));
+
+      // The mass matrix M, the residual part M K_i is obtained by multiplication.
+      assemble_mass_matrix();
+
+      // The residual functions of one stage.
+      Hermes::vector<Solution<Scalar>*> stage_residuals;
+      if(!residual_as_vector)
+        for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
+          stage_residuals.push_back(residuals_vector[space_i]);
+
+      // With set_freeze_jacobian() the Jacobian is assembled once per time step (and h a_ii), a Jacobian update policy
+      // is the one to decide over time steps.
+      if(this->jacobian_update_policy == NULL)
+        this->diagonally_implicit_jacobian_coeff = -1.0;
+
+      Scalar* mass_times_K_i = new Scalar[ndof];
+
+      for (unsigned int stage_i = 0; stage_i < num_stages; stage_i++)
+      {
+        double diagonal_coeff = this->time_step * bt->get_A(stage_i, stage_i);
+        double stage_time = this->time + bt->get_C(stage_i) * this->time_step;
+
+        for (unsigned int m = 0; m < stage_wf_diagonally_implicit.mfvol.size(); m++)
+        {
+          stage_wf_diagonally_implicit.mfvol[m]->scaling_factor = -diagonal_coeff;
+          stage_wf_diagonally_implicit.mfvol[m]->set_current_stage_time(stage_time);
+        }
+        for (unsigned int m = 0; m < stage_wf_diagonally_implicit.mfsurf.size(); m++)
+        {
+          stage_wf_diagonally_implicit.mfsurf[m]->scaling_factor = -diagonal_coeff;
+          stage_wf_diagonally_implicit.mfsurf[m]->set_current_stage_time(stage_time);
+        }
+        for (unsigned int m = 0; m < stage_wf_diagonally_implicit.vfvol.size(); m++)
+          stage_wf_diagonally_implicit.vfvol[m]->set_current_stage_time(stage_time);
+        for (unsigned int m = 0; m < stage_wf_diagonally_implicit.vfsurf.size(); m++)
+          stage_wf_diagonally_implicit.vfsurf[m]->set_current_stage_time(stage_time);
+
+        // vector_left holds h \sum_{j < i} a_{ij} K_j, the known part of the stage argument.
+        memset(vector_left, 0, ndof * sizeof(Scalar));
+        for (unsigned int stage_j = 0; stage_j < stage_i; stage_j++)
+          if(bt->get_A(stage_i, stage_j) != 0.0)
+            Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(this->time_step * bt->get_A(stage_i, stage_j)), K_vector + stage_j * ndof, vector_left);
+
+        Scalar* K_i = K_vector + stage_i * ndof;
+
+        // The Newton's loop of the stage.
+        double residual_norm;
+        double last_residual_norm = 0.0;
+        int it = 1;
+        while (true)
+        {
+          // h \sum_{j < i} a_{ij} K_j + h a_{ii} K_i.
+          memcpy(u_ext_vec, vector_left, ndof * sizeof(Scalar));
+          Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(diagonal_coeff), K_i, u_ext_vec);
+
+          // Reinitialize filters.
+          if(this->filters_to_reinit.size() > 0)
+          {
+            Solution<Scalar>::vector_to_solutions(u_ext_vec, spaces, slns_time_new);
+
+            for(unsigned int filters_i = 0; filters_i < this->filters_to_reinit.size(); filters_i++)
+              filters_to_reinit.at(filters_i)->reinit();
+          }
+
+          // The residual M K_i - F(t_i, Y_i), the vector forms are scaled by -1.
+          bool force_diagonal_blocks = true;
+          stage_dp_diagonally_implicit->assemble(u_ext_vec, NULL, vector_right, force_diagonal_blocks);
+          matrix_left->multiply_with_vector(K_i, mass_times_K_i);
+          vector_right->add_vector(mass_times_K_i);
+
+          vector_right->change_sign();
+          if(this->output_rhsOn && (this->output_rhsIterations == -1 || this->output_rhsIterations >= it))
+            this->dump_rhs(vector_right, it);
+
+          if(residual_as_vector)
+            residual_norm = Global<Scalar>::get_l2_norm(vector_right);
+          else
+          {
+            Solution<Scalar>::vector_to_solutions(vector_right, spaces, stage_residuals, false);
+            residual_norm = Global<Scalar>::calc_norms(stage_residuals);
+          }
+
+          if(it == 1)
+            this->info("\tRunge-Kutta: stage %d, Newton initial residual norm: %g", stage_i + 1, residual_norm);
+          else
+            this->info("\tRunge-Kutta: stage %d, Newton iteration %d, residual norm: %g", stage_i + 1, it-1, residual_norm);
+
+          if(residual_norm > newton_max_allowed_residual_norm)
+          {
+            delete [] mass_times_K_i;
+            throw Exceptions::ValueException("residual norm", residual_norm, newton_max_allowed_residual_norm);
+          }
+
+          if((residual_norm < newton_tol || it > newton_max_iter) && it > 1)
+            break;
+
+          // The Jacobian M - h a_ii dF/dY may only be reused for the same h a_ii.
+          bool rhs_only = (this->diagonally_implicit_jacobian_coeff == diagonal_coeff);
+          if(this->jacobian_update_policy != NULL)
+            rhs_only = !this->jacobian_update_policy->reassemble_jacobian(residual_norm, last_residual_norm, this->time_step) && rhs_only;
+          else
+            rhs_only = freeze_jacobian && rhs_only;
+          last_residual_norm = residual_norm;
+          if(!rhs_only)
+          {
+            stage_dp_diagonally_implicit->assemble(u_ext_vec, matrix_right, NULL, force_diagonal_blocks);
+            matrix_right->add_sparse_to_diagonal_blocks(1, matrix_left);
+
+            if(this->output_matrixOn && (this->output_matrixIterations == -1 || this->output_matrixIterations >= it))
+              this->dump_matrix(matrix_right, it);
+
+            matrix_right->finish();
+            solver->set_factorization_scheme(HERMES_FACTORIZE_FROM_SCRATCH);
+            this->diagonally_implicit_jacobian_coeff = diagonal_coeff;
+          }
+          else
+            solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+
+          if(!solver->solve())
+          {
+            delete [] mass_times_K_i;
+            throw Exceptions::LinearMatrixSolverException();
+          }
+
+          Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(newton_damping_coeff), solver->get_sln_vector(), K_i);
+
+          it++;
+        }
+
+        if(it >= newton_max_iter)
+        {
+          delete [] mass_times_K_i;
+          this->tick();
+          this->info("\tRunge-Kutta: time step duration: %f s.\n", this->last());
+          throw Exceptions::ValueException("Newton iterations", it, newton_max_iter);
+        }
+      }
+
+      delete [] mass_times_K_i;
+    }
+
     template<typename Scalar>
     void RungeKutta<Scalar>::rk_time_step_newton(Hermes::vector<Solution<Scalar>*> slns_time_prev,
                                           Hermes::vector<Solution<Scalar>*> slns_time_new)
@@ -703,6 +1046,46 @@ namespace Hermes
           stage_wf_right.add_vector_form_surf(vfs_i);
         }
       }
+
+      // The vector forms of one stage of an explicit method.
+      stage_wf_explicit.delete_all();
+      if(bt->is_explicit())
+      {
+        for (unsigned int m = 0; m < vfvol_base.size(); m++)
+        {
+          VectorFormVol<Scalar>* vfv = vfvol_base[m]->clone();
+          vfv->scaling_factor = -1.0;
+          stage_wf_explicit.add_vector_form(vfv);
+        }
+        for (unsigned int m = 0; m < vfsurf_base.size(); m++)
+        {
+          VectorFormSurf<Scalar>* vfs = vfsurf_base[m]->clone();
+          vfs->scaling_factor = -1.0;
+          stage_wf_explicit.add_vector_form_surf(vfs);
+        }
+      }
+
+      // The forms of one stage of a diagonally implicit method, the scaling of the matrix forms is set in every time step.
+      stage_wf_diagonally_implicit.delete_all();
+      if(!bt->is_explicit() && bt->is_diagonally_implicit())
+      {
+        for (unsigned int m = 0; m < mfvol_base.size(); m++)
+          stage_wf_diagonally_implicit.add_matrix_form(mfvol_base[m]->clone());
+        for (unsigned int m = 0; m < mfsurf_base.size(); m++)
+          stage_wf_diagonally_implicit.add_matrix_form_surf(mfsurf_base[m]->clone());
+        for (unsigned int m = 0; m < vfvol_base.size(); m++)
+        {
+          VectorFormVol<Scalar>* vfv = vfvol_base[m]->clone();
+          vfv->scaling_factor = -1.0;
+          stage_wf_diagonally_implicit.add_vector_form(vfv);
+        }
+        for (unsigned int m = 0; m < vfsurf_base.size(); m++)
+        {
+          VectorFormSurf<Scalar>* vfs = vfsurf_base[m]->clone();
+          vfs->scaling_factor = -1.0;
+          stage_wf_diagonally_implicit.add_vector_form_surf(vfs);
+        }
+      }
     }
 
     template<typename Scalar>
@@ -721,6 +1104,7 @@ namespace Hermes
       Hermes::vector<VectorFormVol<Scalar> *> vfvol = stage_wf_right.vfvol;
       Hermes::vector<VectorFormSurf<Scalar> *> vfsurf = stage_wf_right.vfsurf;
 
+      stage_wf_right.ext.clear();
       for(unsigned int slns_time_prev_i = 0; slns_time_prev_i < slns_time_prev.size(); slns_time_prev_i++)
           stage_wf_right.ext.push_back(slns_time_prev[slns_time_prev_i]);
 
@@ -768,22 +1152,13 @@ namespace Hermes
     template<typename Scalar>
     void RungeKutta<Scalar>::prepare_u_ext_vec()
     {
+      // The stages are contiguous blocks of ndof (all spaces), only the nonzero a_ij contribute.
       unsigned int ndof = Space<Scalar>::get_num_dofs(spaces);
+      memset(u_ext_vec, 0, num_stages * ndof * sizeof(Scalar));
       for (unsigned int stage_i = 0; stage_i < num_stages; stage_i++)
-      {
-        unsigned int running_space_ndofs = 0;
-        for(unsigned int space_i = 0; space_i < spaces.size(); space_i++)
-        {
-          for (int idx = 0; idx < spaces[space_i]->get_num_dofs(); idx++)
-          {
-            Scalar increment = 0;
-            for (unsigned int stage_j = 0; stage_j < num_stages; stage_j++)
-              increment += bt->get_A(stage_i, stage_j) * K_vector[stage_j * ndof + running_space_ndofs + idx];
-            u_ext_vec[stage_i * ndof + running_space_ndofs + idx] = this->time_step * increment;
-          }
-          running_space_ndofs += spaces[space_i]->get_num_dofs();
-        }
-      }
+        for (unsigned int stage_j = 0; stage_j < num_stages; stage_j++)
+          if(bt->get_A(stage_i, stage_j) != 0.0)
+            Hermes::Algebra::VectorKernels::axpy(ndof, Scalar(this->time_step * bt->get_A(stage_i, stage_j)), K_vector + stage_j * ndof, u_ext_vec + stage_i * ndof);
     }
     template class HERMES_API RungeKutta<double>;
     template class HERMES_API RungeKutta<std::complex<double> >;
@@ -17,6 +17,7 @@
 #include "quad_all.h"
 #include "precalc.h"
 #include "mesh.h"
+#include "api2d.h"
 namespace Hermes
 {
   namespace Hermes2D
@@ -31,6 +32,8 @@ namespace Hermes
       assert(num_components == 1 || num_components == 2);
       update_max_index();
       set_quad_2d(&g_quad_2d_std);
+#pragma omp critical (precalc_shared_nodes)
+      num_instances++;
     }
 
     PrecalcShapeset::PrecalcShapeset(PrecalcShapeset* pss) : Function<double>()
@@ -42,6 +45,8 @@ namespace Hermes
       num_components = pss->num_components;
       update_max_index();
       set_quad_2d(&g_quad_2d_std);
+#pragma omp critical (precalc_shared_nodes)
+      num_instances++;
     }
 
     void PrecalcShapeset::update_max_index()
@@ -61,7 +66,7 @@ namespace Hermes
       {
         for(unsigned int i = 0; i < overflow_nodes->get_size(); i++)
           if(overflow_nodes->present(i))
-            ::free(overflow_nodes->get(i));
+            free_node(overflow_nodes->get(i));
         delete overflow_nodes;
       }
       nodes = new LightArray<Node *>;
@@ -98,42 +103,212 @@ namespace Hermes
       Transformable::set_active_element(e);
     }
 
+    class PrecalcShapeset::SharedNodes : public std::map<std::pair<uint64_t, uint64_t>, PrecalcShapeset::Node*>
+    {
+    public:
+      SharedNodes() : size(0)
+      {
+      }
+
+      ~SharedNodes()
+      {
+        for (iterator it = begin(); it != end(); it++)
+          PrecalcShapeset::free_node(it->second);
+        for (unsigned int i = 0; i < retired.size(); i++)
+          PrecalcShapeset::free_node(retired[i]);
+        for (std::map<std::pair<uint64_t, uint64_t>, double*>::iterator it = points.begin(); it != points.end(); it++)
+          delete [] it->second;
+      }
+
+      /// Key of the node of the shape function index and the transformation sub_idx.
+      static std::pair<uint64_t, uint64_t> key(int shapeset_id, int index, int order, ElementMode2D mode, uint64_t sub_idx)
+      {
+        return std::make_pair((((((uint64_t) shapeset_id << 20) + index) << 16) + order) << 1 | mode, sub_idx);
+      }
+
+      /// The nodes replaced by ones with more tables, still used by the instances.
+      std::vector<Node*> retired;
+
+      /// The standard quadrature points of (order, mode) mapped by the transformation sub_idx,
+      /// the x coordinates followed by the y ones, common to all the shapesets and shape functions.
+      std::map<std::pair<uint64_t, uint64_t>, double*> points;
+
+      /// Total size in bytes of the nodes.
+      size_t size;
+    };
+
+    PrecalcShapeset::SharedNodes* PrecalcShapeset::shared_nodes = NULL;
+    int PrecalcShapeset::num_instances = 0;
+
     void PrecalcShapeset::precalculate(int order, int mask)
+    {
+      // initialization
+      Quad2D* quad = get_quad_2d();
+      int np = quad->get_num_points(order, this->element->get_mode());
+
+      int oldmask = (cur_node != NULL) ? (cur_node->mask & H2D_FN_ALL) : 0;
+      int newmask = mask | oldmask;
+
+      // A private node only gets the missing tables, the present ones are neither copied nor recalculated.
+      if(cur_node != NULL && !(cur_node->mask & H2D_SHARED_NODE))
+      {
+        add_tables(cur_node, newmask, np);
+        calculate_node(cur_node, order, newmask & ~oldmask, 0);
+        return;
+      }
+
+      // The standard quadrature point values of the shape functions are the same in all threads, the first one
+      // to need them shares them with the others. The overflown transformations are kept private.
+      bool shared = (quad == &g_quad_2d_std && index >= 0 && sub_idx <= H2D_MAX_IDX);
+      Node* node = shared ? find_shared_node(order, newmask) : NULL;
+      if(node == NULL)
+      {
+        node = new_node(newmask, np);
+        calculate_node(node, order, newmask, oldmask);
+        if(shared)
+          node = share_node(order, node);
+      }
+
+      if(nodes->present(order))
+      {
+        assert(nodes->get(order) == cur_node);
+        if(!(cur_node->mask & H2D_SHARED_NODE))
+          free_node(nodes->get(order));
+      }
+      nodes->add(node, order);
+      cur_node = node;
+    }
+
+    void PrecalcShapeset::calculate_node(Node* node, int order, int mask, int oldmask)
     {
       int i, j, k;
 
-      // initialization
       Quad2D* quad = get_quad_2d();
       int np = quad->get_num_points(order, this->element->get_mode());
       double3* pt = quad->get_points(order, this->element->get_mode());
 
-      int oldmask = (cur_node != NULL) ? cur_node->mask : 0;
-      int newmask = mask | oldmask;
-      Node* node = new_node(newmask, np);
+      // Without a transformation, the standard quadrature points are those of the tables of the shapeset.
+      bool tabulated = (quad == &g_quad_2d_std && ctm->m[0] == 1.0 && ctm->m[1] == 1.0 && ctm->t[0] == 0.0 && ctm->t[1] == 0.0);
+
+      // The transformed points, filled when first needed.
+      const double* x = NULL, * y = NULL;
+      std::vector<double> xy;
 
       // precalculate all required tables
       for (j = 0; j < num_components; j++)
       {
         for (k = 0; k < 6; k++)
         {
-          if(newmask & idx2mask[k][j])
+          if(mask & idx2mask[k][j])
           {
+            const double* table;
             if(oldmask & idx2mask[k][j])
               memcpy(node->values[j][k], cur_node->values[j][k], np * sizeof(double));
+            else if(tabulated && (table = shapeset->get_tabulated_values(k, index, order, j, element->get_mode())) != NULL)
+              memcpy(node->values[j][k], table, np * sizeof(double));
             else
-              for (i = 0; i < np; i++)
-                node->values[j][k][i] = shapeset->get_value(k, index, ctm->m[0] * pt[i][0] + ctm->t[0],
-                ctm->m[1] * pt[i][1] + ctm->t[1], j, element->get_mode());
+            {
+              if(x == NULL)
+              {
+                if(quad == &g_quad_2d_std && sub_idx <= H2D_MAX_IDX)
+                  x = get_transformed_points(order);
+                else
+                {
+                  xy.resize(2 * np);
+                  for (i = 0; i < np; i++)
+                  {
+                    xy[i] = ctm->m[0] * pt[i][0] + ctm->t[0];
+                    xy[np + i] = ctm->m[1] * pt[i][1] + ctm->t[1];
+                  }
+                  x = &xy[0];
+                }
+                y = x + np;
+              }
+              shapeset->get_values(k, index, x, y, np, node->values[j][k], j, element->get_mode());
+            }
           }
         }
       }
-      if(nodes->present(order))
+    }
+
+    const double* PrecalcShapeset::get_transformed_points(int order)
+    {
+      ElementMode2D mode = element->get_mode();
+      std::pair<uint64_t, uint64_t> key = std::make_pair((uint64_t) order << 1 | mode, sub_idx);
+      double* xy = NULL;
+#pragma omp critical (precalc_shared_nodes)
       {
-        assert(nodes->get(order) == cur_node);
-        ::free(nodes->get(order));
+        if(shared_nodes == NULL)
+          shared_nodes = new SharedNodes;
+        std::map<std::pair<uint64_t, uint64_t>, double*>::iterator it = shared_nodes->points.find(key);
+        if(it != shared_nodes->points.end())
+          xy = it->second;
+        else
+        {
+          int np = g_quad_2d_std.get_num_points(order, mode);
+          double3* pt = g_quad_2d_std.get_points(order, mode);
+          xy = new double[2 * np];
+          for (int i = 0; i < np; i++)
+          {
+            xy[i] = ctm->m[0] * pt[i][0] + ctm->t[0];
+            xy[np + i] = ctm->m[1] * pt[i][1] + ctm->t[1];
+          }
+          shared_nodes->points.insert(std::make_pair(key, xy));
+        }
       }
-      nodes->add(node, order);
-      cur_node = node;
+      return xy;
+    }
+
+    PrecalcShapeset::Node* PrecalcShapeset::find_shared_node(int order, int mask)
+    {
+      std::pair<uint64_t, uint64_t> key = SharedNodes::key(shapeset->get_id(), index, order, element->get_mode(), sub_idx);
+      Node* node = NULL;
+#pragma omp critical (precalc_shared_nodes)
+      {
+        if(shared_nodes != NULL)
+        {
+          SharedNodes::iterator it = shared_nodes->find(key);
+          if(it != shared_nodes->end() && (it->second->mask & mask) == mask)
+            node = it->second;
+        }
+      }
+      return node;
+    }
+
+    PrecalcShapeset::Node* PrecalcShapeset::share_node(int order, Node* node)
+    {
+      std::pair<uint64_t, uint64_t> key = SharedNodes::key(shapeset->get_id(), index, order, element->get_mode(), sub_idx);
+      size_t budget = (size_t) Hermes2DApi.get_precalc_shared_cache_size() << 20;
+      int mask = node->mask;
+      Node* result = node;
+#pragma omp critical (precalc_shared_nodes)
+      {
+        if(shared_nodes == NULL)
+          shared_nodes = new SharedNodes;
+        SharedNodes::iterator it = shared_nodes->find(key);
+        if(it != shared_nodes->end() && (it->second->mask & mask) == mask)
+          result = it->second;
+        else if(shared_nodes->size + node->size <= budget)
+        {
+          node->mask |= H2D_SHARED_NODE;
+          if(it != shared_nodes->end())
+          {
+            // The instances using the replaced node keep it.
+            shared_nodes->retired.push_back(it->second);
+            it->second = node;
+          }
+          else
+            shared_nodes->insert(std::make_pair(key, node));
+          shared_nodes->size += node->size;
+          Hermes2DMemory.add(MemoryPrecalcShapesetTables, node->size);
+        }
+      }
+      // The shared nodes are not counted in the memory of the instance.
+      if(result != node || (node->mask & H2D_SHARED_NODE))
+        total_mem -= node->size;
+      if(result != node)
+        free_node(node);
+      return result;
     }
 
     void PrecalcShapeset::free()
@@ -146,8 +321,8 @@ namespace Hermes
           for(std::map<uint64_t, LightArray<Node*>*>::iterator it = tables.get(i)->begin(); it != tables.get(i)->end(); it++)
           {
             for(unsigned int k = 0; k < it->second->get_size(); k++)
-              if(it->second->present(k))
-                ::free(it->second->get(k));
+              if(it->second->present(k) && !(it->second->get(k)->mask & H2D_SHARED_NODE))
+                free_node(it->second->get(k));
             delete it->second;
           }
           delete tables.get(i);
@@ -157,7 +332,7 @@ namespace Hermes
         {
           for(unsigned int i = 0; i < overflow_nodes->get_size(); i++)
             if(overflow_nodes->present(i))
-              ::free(overflow_nodes->get(i));
+              free_node(overflow_nodes->get(i));
           delete overflow_nodes;
         }
     }
@@ -167,6 +342,16 @@ namespace Hermes
     PrecalcShapeset::~PrecalcShapeset()
     {
       free();
+#pragma omp critical (precalc_shared_nodes)
+      {
+        if(--num_instances == 0)
+        {
+          if(shared_nodes != NULL)
+            Hermes2DMemory.remove(MemoryPrecalcShapesetTables, shared_nodes->size);
+          delete shared_nodes;
+          shared_nodes = NULL;
+        }
+      }
     }
 
     void PrecalcShapeset::push_transform(int son)
@@ -16,6 +16,8 @@
 #include "global.h"
 #include "shapeset.h"
 #include "matrix.h"
+#include "quad_all.h"
+#include <map>
 
 using namespace Hermes::Algebra::DenseMatrixOperations;
 
@@ -158,9 +160,8 @@ namespace Hermes
       double sum, *comb = get_constrained_edge_combination(order, part, ori, nc, mode);
 
       sum = 0.0;
-      shape_fn_t* table = shape_table[n][mode][component];
       for (i = 0; i < nc; i++)
-        sum += comb[i] * table[get_edge_index(edge, ori, i + ebias, mode)](x, y);
+        sum += comb[i] * get_value(n, get_edge_index(edge, ori, i + ebias, mode), x, y, component, mode);
 
       return sum;
     }
@@ -228,12 +229,171 @@ namespace Hermes
       else return ((-1 - index) >> 3) & 15;
     }
 
+    // The degrees of the polynomials in one variable are 0, ..., H2D_NUM_DEGREES - 1, see Shapeset::PolynomialTable.
+    static const int H2D_NUM_DEGREES = 16;
+
+    // Legendre polynomials P_0, ..., P_max_degree at x into p[0], their first and second derivatives into p[1], p[2].
+    static void legendre(double x, int max_degree, double p[3][H2D_NUM_DEGREES])
+    {
+      p[0][0] = 1.0;
+      p[1][0] = p[2][0] = 0.0;
+      if(max_degree == 0)
+        return;
+      p[0][1] = x;
+      p[1][1] = 1.0;
+      p[2][1] = 0.0;
+      for (int k = 1; k < max_degree; k++)
+      {
+        p[0][k + 1] = ((2 * k + 1) * x * p[0][k] - k * p[0][k - 1]) / (k + 1);
+        p[1][k + 1] = p[1][k - 1] + (2 * k + 1) * p[0][k];
+        p[2][k + 1] = p[2][k - 1] + (2 * k + 1) * p[1][k];
+      }
+    }
+
+    // The expansion n of the quad basis P_i(x) P_j(y) at (x, y) into b[16 * i + j], i <= max_i, j <= max_j.
+    static void quad_basis(int n, double x, double y, int max_i, int max_j, double* b)
+    {
+      // The orders of the x and y derivatives of the expansions (FunctionExpansionIndex).
+      static const int dx_order[6] = { 0, 1, 0, 2, 0, 1 };
+      static const int dy_order[6] = { 0, 0, 1, 0, 2, 1 };
+
+      double px[3][H2D_NUM_DEGREES], py[3][H2D_NUM_DEGREES];
+      legendre(x, max_i, px);
+      legendre(y, max_j, py);
+      const double* fx = px[dx_order[n]];
+      const double* fy = py[dy_order[n]];
+      for (int i = 0; i <= max_i; i++)
+        for (int j = 0; j <= max_j; j++)
+          b[H2D_NUM_DEGREES * i + j] = fx[i] * fy[j];
+    }
+
+    // The expansion n of the triangle basis L_i(r, t) P_j^{(2i+1,0)}(y), r = x + (1 + y) / 2, t = (1 - y) / 2,
+    // at (x, y) into b[16 * i + j], i <= max_i, j <= max_j.
+    static void triangle_basis(int n, double x, double y, int max_i, int max_j, double* b)
+    {
+      // The scaled Legendre polynomials L_{k+1} = ((2k+1) r L_k - k t^2 L_{k-1}) / (k+1), L_0 = 1, L_1 = r,
+      // and their partial derivatives with respect to r and t.
+      double r = x + (1.0 + y) / 2.0, t = (1.0 - y) / 2.0;
+      double L[H2D_NUM_DEGREES], Lr[H2D_NUM_DEGREES], Lt[H2D_NUM_DEGREES], Lrr[H2D_NUM_DEGREES], Lrt[H2D_NUM_DEGREES], Ltt[H2D_NUM_DEGREES];
+      L[0] = 1.0;
+      Lr[0] = Lt[0] = Lrr[0] = Lrt[0] = Ltt[0] = 0.0;
+      L[1] = r;
+      Lr[1] = 1.0;
+      Lt[1] = Lrr[1] = Lrt[1] = Ltt[1] = 0.0;
+      for (int k = 1; k < max_i; k++)
+      {
+        double a = 2 * k + 1, c = k, d = k + 1, t2 = t * t;
+        L[k + 1] = (a * r * L[k] - c * t2 * L[k - 1]) / d;
+        Lr[k + 1] = (a * (L[k] + r * Lr[k]) - c * t2 * Lr[k - 1]) / d;
+        Lt[k + 1] = (a * r * Lt[k] - c * (2.0 * t * L[k - 1] + t2 * Lt[k - 1])) / d;
+        Lrr[k + 1] = (a * (2.0 * Lr[k] + r * Lrr[k]) - c * t2 * Lrr[k - 1]) / d;
+        Lrt[k + 1] = (a * (Lt[k] + r * Lrt[k]) - c * (2.0 * t * Lr[k - 1] + t2 * Lrt[k - 1])) / d;
+        Ltt[k + 1] = (a * r * Ltt[k] - c * (2.0 * L[k - 1] + 4.0 * t * Lt[k - 1] + t2 * Ltt[k - 1])) / d;
+      }
+
+      for (int i = 0; i <= max_i; i++)
+      {
+        // r_x = 1, r_y = 1/2, t_x = 0, t_y = -1/2.
+        double l = L[i], lx = Lr[i], ly = (Lr[i] - Lt[i]) / 2.0;
+        double lxx = Lrr[i], lxy = (Lrr[i] - Lrt[i]) / 2.0, lyy = (Lrr[i] - 2.0 * Lrt[i] + Ltt[i]) / 4.0;
+
+        // The Jacobi polynomials P_j^{(alpha,0)}(y) and their derivatives.
+        double alpha = 2 * i + 1;
+        double J[H2D_NUM_DEGREES], Jy[H2D_NUM_DEGREES], Jyy[H2D_NUM_DEGREES];
+        J[0] = 1.0;
+        Jy[0] = Jyy[0] = 0.0;
+        if(max_j > 0)
+        {
+          J[1] = ((alpha + 2.0) * y + alpha) / 2.0;
+          Jy[1] = (alpha + 2.0) / 2.0;
+          Jyy[1] = 0.0;
+        }
+        for (int k = 2; k <= max_j; k++)
+        {
+          double c1 = 2.0 * k * (k + alpha) * (2 * k + alpha - 2);
+          double c2 = (2 * k + alpha - 1) * (2 * k + alpha) * (2 * k + alpha - 2);
+          double c3 = (2 * k + alpha - 1) * alpha * alpha;
+          double c4 = 2.0 * (k + alpha - 1) * (k - 1) * (2 * k + alpha);
+          J[k] = ((c2 * y + c3) * J[k - 1] - c4 * J[k - 2]) / c1;
+          Jy[k] = (c2 * J[k - 1] + (c2 * y + c3) * Jy[k - 1] - c4 * Jy[k - 2]) / c1;
+          Jyy[k] = (2.0 * c2 * Jy[k - 1] + (c2 * y + c3) * Jyy[k - 1] - c4 * Jyy[k - 2]) / c1;
+        }
+
+        double* row = b + H2D_NUM_DEGREES * i;
+        for (int j = 0; j <= max_j; j++)
+        {
+          switch(n)
+          {
+          case H2D_FEI_VALUE: row[j] = l * J[j]; break;
+          case H2D_FEI_DX: row[j] = lx * J[j]; break;
+          case H2D_FEI_DY: row[j] = ly * J[j] + l * Jy[j]; break;
+          case H2D_FEI_DXX: row[j] = lxx * J[j]; break;
+          case H2D_FEI_DYY: row[j] = lyy * J[j] + 2.0 * ly * Jy[j] + l * Jyy[j]; break;
+          case H2D_FEI_DXY: row[j] = lxy * J[j] + lx * Jy[j]; break;
+          }
+        }
+      }
+    }
+
+    // The expansion n of the component of the shape function index of the table at np points.
+    static void get_polynomial_values(const Shapeset::PolynomialTable* table, int n, int index, const double* x, const double* y, int np, double* out, int component, ElementMode2D mode)
+    {
+      int first = table->start[component * table->num_indices + index];
+      int last = table->start[component * table->num_indices + index + 1];
+      int max_i = 0, max_j = 0;
+      for (int k = first; k < last; k++)
+      {
+        max_i = std::max(max_i, table->degrees[k] >> 4);
+        max_j = std::max(max_j, table->degrees[k] & 15);
+      }
+
+      double b[H2D_NUM_DEGREES * H2D_NUM_DEGREES];
+      for (int i = 0; i < np; i++)
+      {
+        if(mode == HERMES_MODE_TRIANGLE)
+          triangle_basis(n, x[i], y[i], max_i, max_j, b);
+        else
+          quad_basis(n, x[i], y[i], max_i, max_j, b);
+        double sum = 0.0;
+        for (int k = first; k < last; k++)
+          sum += table->coefs[k] * b[table->degrees[k]];
+        out[i] = sum;
+      }
+    }
+
+    bool Shapeset::is_orthogonal(ElementMode2D mode) const
+    {
+      const PolynomialTable* table = polynomial_table[mode];
+      if(table == NULL || num_components != 1)
+        return false;
+      bool used[H2D_NUM_DEGREES * H2D_NUM_DEGREES];
+      memset(used, 0, sizeof(used));
+      for (int index = 0; index < table->num_indices; index++)
+      {
+        int k = table->start[index];
+        if(table->start[index + 1] != k + 1 || used[table->degrees[k]])
+          return false;
+        used[table->degrees[k]] = true;
+      }
+      return true;
+    }
+
+    double Shapeset::get_norm_squared(int index, ElementMode2D mode) const
+    {
+      const PolynomialTable* table = polynomial_table[mode];
+      int k = table->start[index];
+      int i = table->degrees[k] >> 4, j = table->degrees[k] & 15;
+      // ||P_i(x) P_j(y)||^2 = 4 / ((2i + 1)(2j + 1)) on the reference quad, the Dubiner basis has
+      // ||B_{i,j}||^2 = 2 / ((2i + 1)(i + j + 1)) on the reference triangle.
+      double norm = (mode == HERMES_MODE_TRIANGLE) ? 2.0 / ((2 * i + 1) * (i + j + 1)) : 4.0 / ((2 * i + 1) * (2 * j + 1));
+      return table->coefs[k] * table->coefs[k] * norm;
+    }
+
     double Shapeset::get_value(int n, int index, double x, double y, int component, ElementMode2D mode)
     {
       if(index >= 0)
       {
-        Shapeset::shape_fn_t** shape_expansion = shape_table[n][mode];
-        if(shape_expansion == NULL)
+        if(polynomial_table[mode] == NULL)
         { // requested exansion (f, df/dx, df/dy, ddf/dxdx, ...) is not defined.
           //just to keep the number of warnings low: warn just once about a given combinations of n, mode, and index.
           static int warned_mode = -1, warned_index = -1, warned_n = 1;
@@ -244,12 +404,98 @@ namespace Hermes
           return 0.;
         }
         else
-          return shape_expansion[component][index](x, y);
+        {
+          double value;
+          get_polynomial_values(polynomial_table[mode], n, index, &x, &y, 1, &value, component, mode);
+          return value;
+        }
       }
       else
         return get_constrained_value(n, index, x, y, component, mode);
     }
 
+    void Shapeset::get_values(int n, int index, const double* x, const double* y, int np, double* out, int component, ElementMode2D mode)
+    {
+      if(index >= 0 && polynomial_table[mode] != NULL)
+        get_polynomial_values(polynomial_table[mode], n, index, x, y, np, out, component, mode);
+      else if(index < 0 && polynomial_table[mode] != NULL)
+      {
+        // The constrained functions, combinations of the edge functions.
+        index = -1 - index;
+        int part = (unsigned) index >> 7;
+        int order = (index >> 3) & 15;
+        int edge = (index >> 1) & 3;
+        int ori = index & 1;
+
+        int nc;
+        double* comb = get_constrained_edge_combination(order, part, ori, nc, mode);
+        std::vector<double> edge_values(np);
+        memset(out, 0, np * sizeof(double));
+        for (int i = 0; i < nc; i++)
+        {
+          get_polynomial_values(polynomial_table[mode], n, get_edge_index(edge, ori, i + ebias, mode), x, y, np, &edge_values[0], component, mode);
+          for (int j = 0; j < np; j++)
+            out[j] += comb[i] * edge_values[j];
+        }
+      }
+      else
+        // The undefined expansions.
+        for (int i = 0; i < np; i++)
+          out[i] = get_value(n, index, x[i], y[i], component, mode);
+    }
+
+    void Shapeset::get_values(int n, int num_indices, const int* indices, const double* x, const double* y, int np, double* out, int component, ElementMode2D mode)
+    {
+      for (int j = 0; j < num_indices; j++)
+        get_values(n, indices[j], x, y, np, out + j * np, component, mode);
+    }
+
+    // The tables of Shapeset::get_tabulated_values(), freed at exit.
+    static class TabulatedValues : public std::map<uint64_t, double*>
+    {
+    public:
+      ~TabulatedValues()
+      {
+        for (iterator it = begin(); it != end(); it++)
+          delete [] it->second;
+      }
+    } tabulated_values;
+
+    const double* Shapeset::get_tabulated_values(int n, int index, int order, int component, ElementMode2D mode)
+    {
+      if(index < 0)
+        return NULL;
+
+      uint64_t key = ((((((uint64_t) this->get_id() << 20) + index) << 16) + order) << 5) + (mode << 4) + (component << 3) + n;
+      double* values = NULL;
+#pragma omp critical (shapeset_tabulated_values)
+      {
+        std::map<uint64_t, double*>::iterator it = tabulated_values.find(key);
+        if(it != tabulated_values.end())
+          values = it->second;
+      }
+      if(values != NULL)
+        return values;
+
+      int np = g_quad_2d_std.get_num_points(order, mode);
+      double3* pt = g_quad_2d_std.get_points(order, mode);
+      std::vector<double> x(np), y(np);
+      for (int i = 0; i < np; i++)
+      {
+        x[i] = pt[i][0];
+        y[i] = pt[i][1];
+      }
+      double* new_values = new double[np];
+      get_values(n, index, &x[0], &y[0], np, new_values, component, mode);
+
+      // Another thread may have tabulated the same values meanwhile.
+#pragma omp critical (shapeset_tabulated_values)
+      values = tabulated_values.insert(std::make_pair(key, new_values)).first->second;
+      if(values != new_values)
+        delete [] new_values;
+      return values;
+    }
+
     double Shapeset::get_fn_value (int index, double x, double y, int component, ElementMode2D mode)  { return get_value(0, index, x, y, component, mode); }
     double Shapeset::get_dx_value (int index, double x, double y, int component, ElementMode2D mode)  { return get_value(1, index, x, y, component, mode); }
     double Shapeset::get_dy_value (int index, double x, double y, int component, ElementMode2D mode)  { return get_value(2, index, x, y, component, mode); }
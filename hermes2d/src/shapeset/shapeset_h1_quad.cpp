@@ -15,4315 +15,12 @@
 
 #include "global.h"
 #include "shapeset.h"
-#include "shapeset_common.h"
 
 //// quad simple lobatto shapeset /////////////////////////////////////////////////////////////////
 namespace Hermes
 {
   namespace Hermes2D
   {
-    static double simple_quad_l0_l0(double x, double y)
-    {
-      return   l0(x) * l0(y);
-    }
-
-    static double simple_quad_l0_l0x(double x, double y)
-    {
-      return   dl0(x) * l0(y);
-    }
-
-    static double simple_quad_l0_l0y(double x, double y)
-    {
-      return   l0(x) * dl0(y);
-    }
-
-    static double simple_quad_l0_l0xx(double x, double y)
-    {
-      return   d2l0(x) * l0(y);
-    }
-
-    static double simple_quad_l0_l0xy(double x, double y)
-    {
-      return   dl0(x) * dl0(y);
-    }
-
-    static double simple_quad_l0_l0yy(double x, double y)
-    {
-      return   l0(x) * d2l0(y);
-    }
-
-    static double simple_quad_l0_l1(double x, double y)
-    {
-      return   l0(x) * l1(y);
-    }
-
-    static double simple_quad_l0_l1x(double x, double y)
-    {
-      return   dl0(x) * l1(y);
-    }
-
-    static double simple_quad_l0_l1y(double x, double y)
-    {
-      return   l0(x) * dl1(y);
-    }
-
-    static double simple_quad_l0_l1xx(double x, double y)
-    {
-      return   d2l0(x) * l1(y);
-    }
-
-    static double simple_quad_l0_l1xy(double x, double y)
-    {
-      return   dl0(x) * dl1(y);
-    }
-
-    static double simple_quad_l0_l1yy(double x, double y)
-    {
-      return   l0(x) * d2l1(y);
-    }
-
-    static double simple_quad_l0_l2(double x, double y)
-    {
-      return   l0(x) * l2(y);
-    }
-
-    static double simple_quad_l0_l2x(double x, double y)
-    {
-      return   dl0(x) * l2(y);
-    }
-
-    static double simple_quad_l0_l2y(double x, double y)
-    {
-      return   l0(x) * dl2(y);
-    }
-
-    static double simple_quad_l0_l2xx(double x, double y)
-    {
-      return   d2l0(x) * l2(y);
-    }
-
-    static double simple_quad_l0_l2xy(double x, double y)
-    {
-      return   dl0(x) * dl2(y);
-    }
-
-    static double simple_quad_l0_l2yy(double x, double y)
-    {
-      return   l0(x) * d2l2(y);
-    }
-
-    static double simple_quad_l0_l3_0(double x, double y)
-    {
-      return - l0(x) * l3(y);
-    }
-
-    static double simple_quad_l0_l3x_0(double x, double y)
-    {
-      return - dl0(x) * l3(y);
-    }
-
-    static double simple_quad_l0_l3y_0(double x, double y)
-    {
-      return - l0(x) * dl3(y);
-    }
-
-    static double simple_quad_l0_l3xx_0(double x, double y)
-    {
-      return - d2l0(x) * l3(y);
-    }
-
-    static double simple_quad_l0_l3xy_0(double x, double y)
-    {
-      return - dl0(x) * dl3(y);
-    }
-
-    static double simple_quad_l0_l3yy_0(double x, double y)
-    {
-      return - l0(x) * d2l3(y);
-    }
-
-    static double simple_quad_l0_l3_1(double x, double y)
-    {
-      return -(- l0(x) * l3(y));
-    }
-
-    static double simple_quad_l0_l3x_1(double x, double y)
-    {
-      return -(- dl0(x) * l3(y));
-    }
-
-    static double simple_quad_l0_l3y_1(double x, double y)
-    {
-      return -(- l0(x) * dl3(y));
-    }
-
-    static double simple_quad_l0_l3xx_1(double x, double y)
-    {
-      return -(- d2l0(x) * l3(y));
-    }
-
-    static double simple_quad_l0_l3xy_1(double x, double y)
-    {
-      return -(- dl0(x) * dl3(y));
-    }
-
-    static double simple_quad_l0_l3yy_1(double x, double y)
-    {
-      return -(- l0(x) * d2l3(y));
-    }
-
-    static double simple_quad_l0_l4(double x, double y)
-    {
-      return   l0(x) * l4(y);
-    }
-
-    static double simple_quad_l0_l4x(double x, double y)
-    {
-      return   dl0(x) * l4(y);
-    }
-
-    static double simple_quad_l0_l4y(double x, double y)
-    {
-      return   l0(x) * dl4(y);
-    }
-
-    static double simple_quad_l0_l4xx(double x, double y)
-    {
-      return   d2l0(x) * l4(y);
-    }
-
-    static double simple_quad_l0_l4xy(double x, double y)
-    {
-      return   dl0(x) * dl4(y);
-    }
-
-    static double simple_quad_l0_l4yy(double x, double y)
-    {
-      return   l0(x) * d2l4(y);
-    }
-
-    static double simple_quad_l0_l5_0(double x, double y)
-    {
-      return - l0(x) * l5(y);
-    }
-
-    static double simple_quad_l0_l5x_0(double x, double y)
-    {
-      return - dl0(x) * l5(y);
-    }
-
-    static double simple_quad_l0_l5y_0(double x, double y)
-    {
-      return - l0(x) * dl5(y);
-    }
-
-    static double simple_quad_l0_l5xx_0(double x, double y)
-    {
-      return - d2l0(x) * l5(y);
-    }
-
-    static double simple_quad_l0_l5xy_0(double x, double y)
-    {
-      return - dl0(x) * dl5(y);
-    }
-
-    static double simple_quad_l0_l5yy_0(double x, double y)
-    {
-      return - l0(x) * d2l5(y);
-    }
-
-    static double simple_quad_l0_l5_1(double x, double y)
-    {
-      return -(- l0(x) * l5(y));
-    }
-
-    static double simple_quad_l0_l5x_1(double x, double y)
-    {
-      return -(- dl0(x) * l5(y));
-    }
-
-    static double simple_quad_l0_l5y_1(double x, double y)
-    {
-      return -(- l0(x) * dl5(y));
-    }
-
-    static double simple_quad_l0_l5xx_1(double x, double y)
-    {
-      return -(- d2l0(x) * l5(y));
-    }
-
-    static double simple_quad_l0_l5xy_1(double x, double y)
-    {
-      return -(- dl0(x) * dl5(y));
-    }
-
-    static double simple_quad_l0_l5yy_1(double x, double y)
-    {
-      return -(- l0(x) * d2l5(y));
-    }
-
-    static double simple_quad_l0_l6(double x, double y)
-    {
-      return   l0(x) * l6(y);
-    }
-
-    static double simple_quad_l0_l6x(double x, double y)
-    {
-      return   dl0(x) * l6(y);
-    }
-
-    static double simple_quad_l0_l6y(double x, double y)
-    {
-      return   l0(x) * dl6(y);
-    }
-
-    static double simple_quad_l0_l6xx(double x, double y)
-    {
-      return   d2l0(x) * l6(y);
-    }
-
-    static double simple_quad_l0_l6xy(double x, double y)
-    {
-      return   dl0(x) * dl6(y);
-    }
-
-    static double simple_quad_l0_l6yy(double x, double y)
-    {
-      return   l0(x) * d2l6(y);
-    }
-
-    static double simple_quad_l0_l7_0(double x, double y)
-    {
-      return - l0(x) * l7(y);
-    }
-
-    static double simple_quad_l0_l7x_0(double x, double y)
-    {
-      return - dl0(x) * l7(y);
-    }
-
-    static double simple_quad_l0_l7y_0(double x, double y)
-    {
-      return - l0(x) * dl7(y);
-    }
-
-    static double simple_quad_l0_l7xx_0(double x, double y)
-    {
-      return - d2l0(x) * l7(y);
-    }
-
-    static double simple_quad_l0_l7xy_0(double x, double y)
-    {
-      return - dl0(x) * dl7(y);
-    }
-
-    static double simple_quad_l0_l7yy_0(double x, double y)
-    {
-      return - l0(x) * d2l7(y);
-    }
-
-    static double simple_quad_l0_l7_1(double x, double y)
-    {
-      return -(- l0(x) * l7(y));
-    }
-
-    static double simple_quad_l0_l7x_1(double x, double y)
-    {
-      return -(- dl0(x) * l7(y));
-    }
-
-    static double simple_quad_l0_l7y_1(double x, double y)
-    {
-      return -(- l0(x) * dl7(y));
-    }
-
-    static double simple_quad_l0_l7xx_1(double x, double y)
-    {
-      return -(- d2l0(x) * l7(y));
-    }
-
-    static double simple_quad_l0_l7xy_1(double x, double y)
-    {
-      return -(- dl0(x) * dl7(y));
-    }
-
-    static double simple_quad_l0_l7yy_1(double x, double y)
-    {
-      return -(- l0(x) * d2l7(y));
-    }
-
-    static double simple_quad_l0_l8(double x, double y)
-    {
-      return   l0(x) * l8(y);
-    }
-
-    static double simple_quad_l0_l8x(double x, double y)
-    {
-      return   dl0(x) * l8(y);
-    }
-
-    static double simple_quad_l0_l8y(double x, double y)
-    {
-      return   l0(x) * dl8(y);
-    }
-
-    static double simple_quad_l0_l8xx(double x, double y)
-    {
-      return   d2l0(x) * l8(y);
-    }
-
-    static double simple_quad_l0_l8xy(double x, double y)
-    {
-      return   dl0(x) * dl8(y);
-    }
-
-    static double simple_quad_l0_l8yy(double x, double y)
-    {
-      return   l0(x) * d2l8(y);
-    }
-
-    static double simple_quad_l0_l9_0(double x, double y)
-    {
-      return - l0(x) * l9(y);
-    }
-
-    static double simple_quad_l0_l9x_0(double x, double y)
-    {
-      return - dl0(x) * l9(y);
-    }
-
-    static double simple_quad_l0_l9y_0(double x, double y)
-    {
-      return - l0(x) * dl9(y);
-    }
-
-    static double simple_quad_l0_l9xx_0(double x, double y)
-    {
-      return - d2l0(x) * l9(y);
-    }
-
-    static double simple_quad_l0_l9xy_0(double x, double y)
-    {
-      return - dl0(x) * dl9(y);
-    }
-
-    static double simple_quad_l0_l9yy_0(double x, double y)
-    {
-      return - l0(x) * d2l9(y);
-    }
-
-    static double simple_quad_l0_l9_1(double x, double y)
-    {
-      return -(- l0(x) * l9(y));
-    }
-
-    static double simple_quad_l0_l9x_1(double x, double y)
-    {
-      return -(- dl0(x) * l9(y));
-    }
-
-    static double simple_quad_l0_l9y_1(double x, double y)
-    {
-      return -(- l0(x) * dl9(y));
-    }
-
-    static double simple_quad_l0_l9xx_1(double x, double y)
-    {
-      return -(- d2l0(x) * l9(y));
-    }
-
-    static double simple_quad_l0_l9xy_1(double x, double y)
-    {
-      return -(- dl0(x) * dl9(y));
-    }
-
-    static double simple_quad_l0_l9yy_1(double x, double y)
-    {
-      return -(- l0(x) * d2l9(y));
-    }
-
-    static double simple_quad_l0_l10(double x, double y)
-    {
-      return   l0(x) * l10(y);
-    }
-
-    static double simple_quad_l0_l10x(double x, double y)
-    {
-      return   dl0(x) * l10(y);
-    }
-
-    static double simple_quad_l0_l10y(double x, double y)
-    {
-      return   l0(x) * dl10(y);
-    }
-
-    static double simple_quad_l0_l10xx(double x, double y)
-    {
-      return   d2l0(x) * l10(y);
-    }
-
-    static double simple_quad_l0_l10xy(double x, double y)
-    {
-      return   dl0(x) * dl10(y);
-    }
-
-    static double simple_quad_l0_l10yy(double x, double y)
-    {
-      return   l0(x) * d2l10(y);
-    }
-
-    static double simple_quad_l1_l0(double x, double y)
-    {
-      return   l1(x) * l0(y);
-    }
-
-    static double simple_quad_l1_l0x(double x, double y)
-    {
-      return   dl1(x) * l0(y);
-    }
-
-    static double simple_quad_l1_l0y(double x, double y)
-    {
-      return   l1(x) * dl0(y);
-    }
-
-    static double simple_quad_l1_l0xx(double x, double y)
-    {
-      return   d2l1(x) * l0(y);
-    }
-
-    static double simple_quad_l1_l0xy(double x, double y)
-    {
-      return   dl1(x) * dl0(y);
-    }
-
-    static double simple_quad_l1_l0yy(double x, double y)
-    {
-      return   l1(x) * d2l0(y);
-    }
-
-    static double simple_quad_l1_l1(double x, double y)
-    {
-      return   l1(x) * l1(y);
-    }
-
-    static double simple_quad_l1_l1x(double x, double y)
-    {
-      return   dl1(x) * l1(y);
-    }
-
-    static double simple_quad_l1_l1y(double x, double y)
-    {
-      return   l1(x) * dl1(y);
-    }
-
-    static double simple_quad_l1_l1xx(double x, double y)
-    {
-      return   d2l1(x) * l1(y);
-    }
-
-    static double simple_quad_l1_l1xy(double x, double y)
-    {
-      return   dl1(x) * dl1(y);
-    }
-
-    static double simple_quad_l1_l1yy(double x, double y)
-    {
-      return   l1(x) * d2l1(y);
-    }
-
-    static double simple_quad_l1_l2(double x, double y)
-    {
-      return   l1(x) * l2(y);
-    }
-
-    static double simple_quad_l1_l2x(double x, double y)
-    {
-      return   dl1(x) * l2(y);
-    }
-
-    static double simple_quad_l1_l2y(double x, double y)
-    {
-      return   l1(x) * dl2(y);
-    }
-
-    static double simple_quad_l1_l2xx(double x, double y)
-    {
-      return   d2l1(x) * l2(y);
-    }
-
-    static double simple_quad_l1_l2xy(double x, double y)
-    {
-      return   dl1(x) * dl2(y);
-    }
-
-    static double simple_quad_l1_l2yy(double x, double y)
-    {
-      return   l1(x) * d2l2(y);
-    }
-
-    static double simple_quad_l1_l3_0(double x, double y)
-    {
-      return   l1(x) * l3(y);
-    }
-
-    static double simple_quad_l1_l3x_0(double x, double y)
-    {
-      return   dl1(x) * l3(y);
-    }
-
-    static double simple_quad_l1_l3y_0(double x, double y)
-    {
-      return   l1(x) * dl3(y);
-    }
-
-    static double simple_quad_l1_l3xx_0(double x, double y)
-    {
-      return   d2l1(x) * l3(y);
-    }
-
-    static double simple_quad_l1_l3xy_0(double x, double y)
-    {
-      return   dl1(x) * dl3(y);
-    }
-
-    static double simple_quad_l1_l3yy_0(double x, double y)
-    {
-      return   l1(x) * d2l3(y);
-    }
-
-    static double simple_quad_l1_l3_1(double x, double y)
-    {
-      return -(  l1(x) * l3(y));
-    }
-
-    static double simple_quad_l1_l3x_1(double x, double y)
-    {
-      return -(  dl1(x) * l3(y));
-    }
-
-    static double simple_quad_l1_l3y_1(double x, double y)
-    {
-      return -(  l1(x) * dl3(y));
-    }
-
-    static double simple_quad_l1_l3xx_1(double x, double y)
-    {
-      return -(  d2l1(x) * l3(y));
-    }
-
-    static double simple_quad_l1_l3xy_1(double x, double y)
-    {
-      return -(  dl1(x) * dl3(y));
-    }
-
-    static double simple_quad_l1_l3yy_1(double x, double y)
-    {
-      return -(  l1(x) * d2l3(y));
-    }
-
-    static double simple_quad_l1_l4(double x, double y)
-    {
-      return   l1(x) * l4(y);
-    }
-
-    static double simple_quad_l1_l4x(double x, double y)
-    {
-      return   dl1(x) * l4(y);
-    }
-
-    static double simple_quad_l1_l4y(double x, double y)
-    {
-      return   l1(x) * dl4(y);
-    }
-
-    static double simple_quad_l1_l4xx(double x, double y)
-    {
-      return   d2l1(x) * l4(y);
-    }
-
-    static double simple_quad_l1_l4xy(double x, double y)
-    {
-      return   dl1(x) * dl4(y);
-    }
-
-    static double simple_quad_l1_l4yy(double x, double y)
-    {
-      return   l1(x) * d2l4(y);
-    }
-
-    static double simple_quad_l1_l5_0(double x, double y)
-    {
-      return   l1(x) * l5(y);
-    }
-
-    static double simple_quad_l1_l5x_0(double x, double y)
-    {
-      return   dl1(x) * l5(y);
-    }
-
-    static double simple_quad_l1_l5y_0(double x, double y)
-    {
-      return   l1(x) * dl5(y);
-    }
-
-    static double simple_quad_l1_l5xx_0(double x, double y)
-    {
-      return   d2l1(x) * l5(y);
-    }
-
-    static double simple_quad_l1_l5xy_0(double x, double y)
-    {
-      return   dl1(x) * dl5(y);
-    }
-
-    static double simple_quad_l1_l5yy_0(double x, double y)
-    {
-      return   l1(x) * d2l5(y);
-    }
-
-    static double simple_quad_l1_l5_1(double x, double y)
-    {
-      return -(  l1(x) * l5(y));
-    }
-
-    static double simple_quad_l1_l5x_1(double x, double y)
-    {
-      return -(  dl1(x) * l5(y));
-    }
-
-    static double simple_quad_l1_l5y_1(double x, double y)
-    {
-      return -(  l1(x) * dl5(y));
-    }
-
-    static double simple_quad_l1_l5xx_1(double x, double y)
-    {
-      return -(  d2l1(x) * l5(y));
-    }
-
-    static double simple_quad_l1_l5xy_1(double x, double y)
-    {
-      return -(  dl1(x) * dl5(y));
-    }
-
-    static double simple_quad_l1_l5yy_1(double x, double y)
-    {
-      return -(  l1(x) * d2l5(y));
-    }
-
-    static double simple_quad_l1_l6(double x, double y)
-    {
-      return   l1(x) * l6(y);
-    }
-
-    static double simple_quad_l1_l6x(double x, double y)
-    {
-      return   dl1(x) * l6(y);
-    }
-
-    static double simple_quad_l1_l6y(double x, double y)
-    {
-      return   l1(x) * dl6(y);
-    }
-
-    static double simple_quad_l1_l6xx(double x, double y)
-    {
-      return   d2l1(x) * l6(y);
-    }
-
-    static double simple_quad_l1_l6xy(double x, double y)
-    {
-      return   dl1(x) * dl6(y);
-    }
-
-    static double simple_quad_l1_l6yy(double x, double y)
-    {
-      return   l1(x) * d2l6(y);
-    }
-
-    static double simple_quad_l1_l7_0(double x, double y)
-    {
-      return   l1(x) * l7(y);
-    }
-
-    static double simple_quad_l1_l7x_0(double x, double y)
-    {
-      return   dl1(x) * l7(y);
-    }
-
-    static double simple_quad_l1_l7y_0(double x, double y)
-    {
-      return   l1(x) * dl7(y);
-    }
-
-    static double simple_quad_l1_l7xx_0(double x, double y)
-    {
-      return   d2l1(x) * l7(y);
-    }
-
-    static double simple_quad_l1_l7xy_0(double x, double y)
-    {
-      return   dl1(x) * dl7(y);
-    }
-
-    static double simple_quad_l1_l7yy_0(double x, double y)
-    {
-      return   l1(x) * d2l7(y);
-    }
-
-    static double simple_quad_l1_l7_1(double x, double y)
-    {
-      return -(  l1(x) * l7(y));
-    }
-
-    static double simple_quad_l1_l7x_1(double x, double y)
-    {
-      return -(  dl1(x) * l7(y));
-    }
-
-    static double simple_quad_l1_l7y_1(double x, double y)
-    {
-      return -(  l1(x) * dl7(y));
-    }
-
-    static double simple_quad_l1_l7xx_1(double x, double y)
-    {
-      return -(  d2l1(x) * l7(y));
-    }
-
-    static double simple_quad_l1_l7xy_1(double x, double y)
-    {
-      return -(  dl1(x) * dl7(y));
-    }
-
-    static double simple_quad_l1_l7yy_1(double x, double y)
-    {
-      return -(  l1(x) * d2l7(y));
-    }
-
-    static double simple_quad_l1_l8(double x, double y)
-    {
-      return   l1(x) * l8(y);
-    }
-
-    static double simple_quad_l1_l8x(double x, double y)
-    {
-      return   dl1(x) * l8(y);
-    }
-
-    static double simple_quad_l1_l8y(double x, double y)
-    {
-      return   l1(x) * dl8(y);
-    }
-
-    static double simple_quad_l1_l8xx(double x, double y)
-    {
-      return   d2l1(x) * l8(y);
-    }
-
-    static double simple_quad_l1_l8xy(double x, double y)
-    {
-      return   dl1(x) * dl8(y);
-    }
-
-    static double simple_quad_l1_l8yy(double x, double y)
-    {
-      return   l1(x) * d2l8(y);
-    }
-
-    static double simple_quad_l1_l9_0(double x, double y)
-    {
-      return   l1(x) * l9(y);
-    }
-
-    static double simple_quad_l1_l9x_0(double x, double y)
-    {
-      return   dl1(x) * l9(y);
-    }
-
-    static double simple_quad_l1_l9y_0(double x, double y)
-    {
-      return   l1(x) * dl9(y);
-    }
-
-    static double simple_quad_l1_l9xx_0(double x, double y)
-    {
-      return   d2l1(x) * l9(y);
-    }
-
-    static double simple_quad_l1_l9xy_0(double x, double y)
-    {
-      return   dl1(x) * dl9(y);
-    }
-
-    static double simple_quad_l1_l9yy_0(double x, double y)
-    {
-      return   l1(x) * d2l9(y);
-    }
-
-    static double simple_quad_l1_l9_1(double x, double y)
-    {
-      return -(  l1(x) * l9(y));
-    }
-
-    static double simple_quad_l1_l9x_1(double x, double y)
-    {
-      return -(  dl1(x) * l9(y));
-    }
-
-    static double simple_quad_l1_l9y_1(double x, double y)
-    {
-      return -(  l1(x) * dl9(y));
-    }
-
-    static double simple_quad_l1_l9xx_1(double x, double y)
-    {
-      return -(  d2l1(x) * l9(y));
-    }
-
-    static double simple_quad_l1_l9xy_1(double x, double y)
-    {
-      return -(  dl1(x) * dl9(y));
-    }
-
-    static double simple_quad_l1_l9yy_1(double x, double y)
-    {
-      return -(  l1(x) * d2l9(y));
-    }
-
-    static double simple_quad_l1_l10(double x, double y)
-    {
-      return   l1(x) * l10(y);
-    }
-
-    static double simple_quad_l1_l10x(double x, double y)
-    {
-      return   dl1(x) * l10(y);
-    }
-
-    static double simple_quad_l1_l10y(double x, double y)
-    {
-      return   l1(x) * dl10(y);
-    }
-
-    static double simple_quad_l1_l10xx(double x, double y)
-    {
-      return   d2l1(x) * l10(y);
-    }
-
-    static double simple_quad_l1_l10xy(double x, double y)
-    {
-      return   dl1(x) * dl10(y);
-    }
-
-    static double simple_quad_l1_l10yy(double x, double y)
-    {
-      return   l1(x) * d2l10(y);
-    }
-
-    static double simple_quad_l2_l0(double x, double y)
-    {
-      return   l2(x) * l0(y);
-    }
-
-    static double simple_quad_l2_l0x(double x, double y)
-    {
-      return   dl2(x) * l0(y);
-    }
-
-    static double simple_quad_l2_l0y(double x, double y)
-    {
-      return   l2(x) * dl0(y);
-    }
-
-    static double simple_quad_l2_l0xx(double x, double y)
-    {
-      return   d2l2(x) * l0(y);
-    }
-
-    static double simple_quad_l2_l0xy(double x, double y)
-    {
-      return   dl2(x) * dl0(y);
-    }
-
-    static double simple_quad_l2_l0yy(double x, double y)
-    {
-      return   l2(x) * d2l0(y);
-    }
-
-    static double simple_quad_l2_l1(double x, double y)
-    {
-      return   l2(x) * l1(y);
-    }
-
-    static double simple_quad_l2_l1x(double x, double y)
-    {
-      return   dl2(x) * l1(y);
-    }
-
-    static double simple_quad_l2_l1y(double x, double y)
-    {
-      return   l2(x) * dl1(y);
-    }
-
-    static double simple_quad_l2_l1xx(double x, double y)
-    {
-      return   d2l2(x) * l1(y);
-    }
-
-    static double simple_quad_l2_l1xy(double x, double y)
-    {
-      return   dl2(x) * dl1(y);
-    }
-
-    static double simple_quad_l2_l1yy(double x, double y)
-    {
-      return   l2(x) * d2l1(y);
-    }
-
-    static double simple_quad_l2_l2(double x, double y)
-    {
-      return   l2(x) * l2(y);
-    }
-
-    static double simple_quad_l2_l2x(double x, double y)
-    {
-      return   dl2(x) * l2(y);
-    }
-
-    static double simple_quad_l2_l2y(double x, double y)
-    {
-      return   l2(x) * dl2(y);
-    }
-
-    static double simple_quad_l2_l2xx(double x, double y)
-    {
-      return   d2l2(x) * l2(y);
-    }
-
-    static double simple_quad_l2_l2xy(double x, double y)
-    {
-      return   dl2(x) * dl2(y);
-    }
-
-    static double simple_quad_l2_l2yy(double x, double y)
-    {
-      return   l2(x) * d2l2(y);
-    }
-
-    static double simple_quad_l2_l3(double x, double y)
-    {
-      return   l2(x) * l3(y);
-    }
-
-    static double simple_quad_l2_l3x(double x, double y)
-    {
-      return   dl2(x) * l3(y);
-    }
-
-    static double simple_quad_l2_l3y(double x, double y)
-    {
-      return   l2(x) * dl3(y);
-    }
-
-    static double simple_quad_l2_l3xx(double x, double y)
-    {
-      return   d2l2(x) * l3(y);
-    }
-
-    static double simple_quad_l2_l3xy(double x, double y)
-    {
-      return   dl2(x) * dl3(y);
-    }
-
-    static double simple_quad_l2_l3yy(double x, double y)
-    {
-      return   l2(x) * d2l3(y);
-    }
-
-    static double simple_quad_l2_l4(double x, double y)
-    {
-      return   l2(x) * l4(y);
-    }
-
-    static double simple_quad_l2_l4x(double x, double y)
-    {
-      return   dl2(x) * l4(y);
-    }
-
-    static double simple_quad_l2_l4y(double x, double y)
-    {
-      return   l2(x) * dl4(y);
-    }
-
-    static double simple_quad_l2_l4xx(double x, double y)
-    {
-      return   d2l2(x) * l4(y);
-    }
-
-    static double simple_quad_l2_l4xy(double x, double y)
-    {
-      return   dl2(x) * dl4(y);
-    }
-
-    static double simple_quad_l2_l4yy(double x, double y)
-    {
-      return   l2(x) * d2l4(y);
-    }
-
-    static double simple_quad_l2_l5(double x, double y)
-    {
-      return   l2(x) * l5(y);
-    }
-
-    static double simple_quad_l2_l5x(double x, double y)
-    {
-      return   dl2(x) * l5(y);
-    }
-
-    static double simple_quad_l2_l5y(double x, double y)
-    {
-      return   l2(x) * dl5(y);
-    }
-
-    static double simple_quad_l2_l5xx(double x, double y)
-    {
-      return   d2l2(x) * l5(y);
-    }
-
-    static double simple_quad_l2_l5xy(double x, double y)
-    {
-      return   dl2(x) * dl5(y);
-    }
-
-    static double simple_quad_l2_l5yy(double x, double y)
-    {
-      return   l2(x) * d2l5(y);
-    }
-
-    static double simple_quad_l2_l6(double x, double y)
-    {
-      return   l2(x) * l6(y);
-    }
-
-    static double simple_quad_l2_l6x(double x, double y)
-    {
-      return   dl2(x) * l6(y);
-    }
-
-    static double simple_quad_l2_l6y(double x, double y)
-    {
-      return   l2(x) * dl6(y);
-    }
-
-    static double simple_quad_l2_l6xx(double x, double y)
-    {
-      return   d2l2(x) * l6(y);
-    }
-
-    static double simple_quad_l2_l6xy(double x, double y)
-    {
-      return   dl2(x) * dl6(y);
-    }
-
-    static double simple_quad_l2_l6yy(double x, double y)
-    {
-      return   l2(x) * d2l6(y);
-    }
-
-    static double simple_quad_l2_l7(double x, double y)
-    {
-      return   l2(x) * l7(y);
-    }
-
-    static double simple_quad_l2_l7x(double x, double y)
-    {
-      return   dl2(x) * l7(y);
-    }
-
-    static double simple_quad_l2_l7y(double x, double y)
-    {
-      return   l2(x) * dl7(y);
-    }
-
-    static double simple_quad_l2_l7xx(double x, double y)
-    {
-      return   d2l2(x) * l7(y);
-    }
-
-    static double simple_quad_l2_l7xy(double x, double y)
-    {
-      return   dl2(x) * dl7(y);
-    }
-
-    static double simple_quad_l2_l7yy(double x, double y)
-    {
-      return   l2(x) * d2l7(y);
-    }
-
-    static double simple_quad_l2_l8(double x, double y)
-    {
-      return   l2(x) * l8(y);
-    }
-
-    static double simple_quad_l2_l8x(double x, double y)
-    {
-      return   dl2(x) * l8(y);
-    }
-
-    static double simple_quad_l2_l8y(double x, double y)
-    {
-      return   l2(x) * dl8(y);
-    }
-
-    static double simple_quad_l2_l8xx(double x, double y)
-    {
-      return   d2l2(x) * l8(y);
-    }
-
-    static double simple_quad_l2_l8xy(double x, double y)
-    {
-      return   dl2(x) * dl8(y);
-    }
-
-    static double simple_quad_l2_l8yy(double x, double y)
-    {
-      return   l2(x) * d2l8(y);
-    }
-
-    static double simple_quad_l2_l9(double x, double y)
-    {
-      return   l2(x) * l9(y);
-    }
-
-    static double simple_quad_l2_l9x(double x, double y)
-    {
-      return   dl2(x) * l9(y);
-    }
-
-    static double simple_quad_l2_l9y(double x, double y)
-    {
-      return   l2(x) * dl9(y);
-    }
-
-    static double simple_quad_l2_l9xx(double x, double y)
-    {
-      return   d2l2(x) * l9(y);
-    }
-
-    static double simple_quad_l2_l9xy(double x, double y)
-    {
-      return   dl2(x) * dl9(y);
-    }
-
-    static double simple_quad_l2_l9yy(double x, double y)
-    {
-      return   l2(x) * d2l9(y);
-    }
-
-    static double simple_quad_l2_l10(double x, double y)
-    {
-      return   l2(x) * l10(y);
-    }
-
-    static double simple_quad_l2_l10x(double x, double y)
-    {
-      return   dl2(x) * l10(y);
-    }
-
-    static double simple_quad_l2_l10y(double x, double y)
-    {
-      return   l2(x) * dl10(y);
-    }
-
-    static double simple_quad_l2_l10xx(double x, double y)
-    {
-      return   d2l2(x) * l10(y);
-    }
-
-    static double simple_quad_l2_l10xy(double x, double y)
-    {
-      return   dl2(x) * dl10(y);
-    }
-
-    static double simple_quad_l2_l10yy(double x, double y)
-    {
-      return   l2(x) * d2l10(y);
-    }
-
-    static double simple_quad_l3_l0_0(double x, double y)
-    {
-      return   l3(x) * l0(y);
-    }
-
-    static double simple_quad_l3_l0x_0(double x, double y)
-    {
-      return   dl3(x) * l0(y);
-    }
-
-    static double simple_quad_l3_l0y_0(double x, double y)
-    {
-      return   l3(x) * dl0(y);
-    }
-
-    static double simple_quad_l3_l0xx_0(double x, double y)
-    {
-      return   d2l3(x) * l0(y);
-    }
-
-    static double simple_quad_l3_l0xy_0(double x, double y)
-    {
-      return   dl3(x) * dl0(y);
-    }
-
-    static double simple_quad_l3_l0yy_0(double x, double y)
-    {
-      return   l3(x) * d2l0(y);
-    }
-
-    static double simple_quad_l3_l0_1(double x, double y)
-    {
-      return -(  l3(x) * l0(y));
-    }
-
-    static double simple_quad_l3_l0x_1(double x, double y)
-    {
-      return -(  dl3(x) * l0(y));
-    }
-
-    static double simple_quad_l3_l0y_1(double x, double y)
-    {
-      return -(  l3(x) * dl0(y));
-    }
-
-    static double simple_quad_l3_l0xx_1(double x, double y)
-    {
-      return -(  d2l3(x) * l0(y));
-    }
-
-    static double simple_quad_l3_l0xy_1(double x, double y)
-    {
-      return -(  dl3(x) * dl0(y));
-    }
-
-    static double simple_quad_l3_l0yy_1(double x, double y)
-    {
-      return -(  l3(x) * d2l0(y));
-    }
-
-    static double simple_quad_l3_l1_0(double x, double y)
-    {
-      return - l3(x) * l1(y);
-    }
-
-    static double simple_quad_l3_l1x_0(double x, double y)
-    {
-      return - dl3(x) * l1(y);
-    }
-
-    static double simple_quad_l3_l1y_0(double x, double y)
-    {
-      return - l3(x) * dl1(y);
-    }
-
-    static double simple_quad_l3_l1xx_0(double x, double y)
-    {
-      return - d2l3(x) * l1(y);
-    }
-
-    static double simple_quad_l3_l1xy_0(double x, double y)
-    {
-      return - dl3(x) * dl1(y);
-    }
-
-    static double simple_quad_l3_l1yy_0(double x, double y)
-    {
-      return - l3(x) * d2l1(y);
-    }
-
-    static double simple_quad_l3_l1_1(double x, double y)
-    {
-      return -(- l3(x) * l1(y));
-    }
-
-    static double simple_quad_l3_l1x_1(double x, double y)
-    {
-      return -(- dl3(x) * l1(y));
-    }
-
-    static double simple_quad_l3_l1y_1(double x, double y)
-    {
-      return -(- l3(x) * dl1(y));
-    }
-
-    static double simple_quad_l3_l1xx_1(double x, double y)
-    {
-      return -(- d2l3(x) * l1(y));
-    }
-
-    static double simple_quad_l3_l1xy_1(double x, double y)
-    {
-      return -(- dl3(x) * dl1(y));
-    }
-
-    static double simple_quad_l3_l1yy_1(double x, double y)
-    {
-      return -(- l3(x) * d2l1(y));
-    }
-
-    static double simple_quad_l3_l2(double x, double y)
-    {
-      return   l3(x) * l2(y);
-    }
-
-    static double simple_quad_l3_l2x(double x, double y)
-    {
-      return   dl3(x) * l2(y);
-    }
-
-    static double simple_quad_l3_l2y(double x, double y)
-    {
-      return   l3(x) * dl2(y);
-    }
-
-    static double simple_quad_l3_l2xx(double x, double y)
-    {
-      return   d2l3(x) * l2(y);
-    }
-
-    static double simple_quad_l3_l2xy(double x, double y)
-    {
-      return   dl3(x) * dl2(y);
-    }
-
-    static double simple_quad_l3_l2yy(double x, double y)
-    {
-      return   l3(x) * d2l2(y);
-    }
-
-    static double simple_quad_l3_l3(double x, double y)
-    {
-      return   l3(x) * l3(y);
-    }
-
-    static double simple_quad_l3_l3x(double x, double y)
-    {
-      return   dl3(x) * l3(y);
-    }
-
-    static double simple_quad_l3_l3y(double x, double y)
-    {
-      return   l3(x) * dl3(y);
-    }
-
-    static double simple_quad_l3_l3xx(double x, double y)
-    {
-      return   d2l3(x) * l3(y);
-    }
-
-    static double simple_quad_l3_l3xy(double x, double y)
-    {
-      return   dl3(x) * dl3(y);
-    }
-
-    static double simple_quad_l3_l3yy(double x, double y)
-    {
-      return   l3(x) * d2l3(y);
-    }
-
-    static double simple_quad_l3_l4(double x, double y)
-    {
-      return   l3(x) * l4(y);
-    }
-
-    static double simple_quad_l3_l4x(double x, double y)
-    {
-      return   dl3(x) * l4(y);
-    }
-
-    static double simple_quad_l3_l4y(double x, double y)
-    {
-      return   l3(x) * dl4(y);
-    }
-
-    static double simple_quad_l3_l4xx(double x, double y)
-    {
-      return   d2l3(x) * l4(y);
-    }
-
-    static double simple_quad_l3_l4xy(double x, double y)
-    {
-      return   dl3(x) * dl4(y);
-    }
-
-    static double simple_quad_l3_l4yy(double x, double y)
-    {
-      return   l3(x) * d2l4(y);
-    }
-
-    static double simple_quad_l3_l5(double x, double y)
-    {
-      return   l3(x) * l5(y);
-    }
-
-    static double simple_quad_l3_l5x(double x, double y)
-    {
-      return   dl3(x) * l5(y);
-    }
-
-    static double simple_quad_l3_l5y(double x, double y)
-    {
-      return   l3(x) * dl5(y);
-    }
-
-    static double simple_quad_l3_l5xx(double x, double y)
-    {
-      return   d2l3(x) * l5(y);
-    }
-
-    static double simple_quad_l3_l5xy(double x, double y)
-    {
-      return   dl3(x) * dl5(y);
-    }
-
-    static double simple_quad_l3_l5yy(double x, double y)
-    {
-      return   l3(x) * d2l5(y);
-    }
-
-    static double simple_quad_l3_l6(double x, double y)
-    {
-      return   l3(x) * l6(y);
-    }
-
-    static double simple_quad_l3_l6x(double x, double y)
-    {
-      return   dl3(x) * l6(y);
-    }
-
-    static double simple_quad_l3_l6y(double x, double y)
-    {
-      return   l3(x) * dl6(y);
-    }
-
-    static double simple_quad_l3_l6xx(double x, double y)
-    {
-      return   d2l3(x) * l6(y);
-    }
-
-    static double simple_quad_l3_l6xy(double x, double y)
-    {
-      return   dl3(x) * dl6(y);
-    }
-
-    static double simple_quad_l3_l6yy(double x, double y)
-    {
-      return   l3(x) * d2l6(y);
-    }
-
-    static double simple_quad_l3_l7(double x, double y)
-    {
-      return   l3(x) * l7(y);
-    }
-
-    static double simple_quad_l3_l7x(double x, double y)
-    {
-      return   dl3(x) * l7(y);
-    }
-
-    static double simple_quad_l3_l7y(double x, double y)
-    {
-      return   l3(x) * dl7(y);
-    }
-
-    static double simple_quad_l3_l7xx(double x, double y)
-    {
-      return   d2l3(x) * l7(y);
-    }
-
-    static double simple_quad_l3_l7xy(double x, double y)
-    {
-      return   dl3(x) * dl7(y);
-    }
-
-    static double simple_quad_l3_l7yy(double x, double y)
-    {
-      return   l3(x) * d2l7(y);
-    }
-
-    static double simple_quad_l3_l8(double x, double y)
-    {
-      return   l3(x) * l8(y);
-    }
-
-    static double simple_quad_l3_l8x(double x, double y)
-    {
-      return   dl3(x) * l8(y);
-    }
-
-    static double simple_quad_l3_l8y(double x, double y)
-    {
-      return   l3(x) * dl8(y);
-    }
-
-    static double simple_quad_l3_l8xx(double x, double y)
-    {
-      return   d2l3(x) * l8(y);
-    }
-
-    static double simple_quad_l3_l8xy(double x, double y)
-    {
-      return   dl3(x) * dl8(y);
-    }
-
-    static double simple_quad_l3_l8yy(double x, double y)
-    {
-      return   l3(x) * d2l8(y);
-    }
-
-    static double simple_quad_l3_l9(double x, double y)
-    {
-      return   l3(x) * l9(y);
-    }
-
-    static double simple_quad_l3_l9x(double x, double y)
-    {
-      return   dl3(x) * l9(y);
-    }
-
-    static double simple_quad_l3_l9y(double x, double y)
-    {
-      return   l3(x) * dl9(y);
-    }
-
-    static double simple_quad_l3_l9xx(double x, double y)
-    {
-      return   d2l3(x) * l9(y);
-    }
-
-    static double simple_quad_l3_l9xy(double x, double y)
-    {
-      return   dl3(x) * dl9(y);
-    }
-
-    static double simple_quad_l3_l9yy(double x, double y)
-    {
-      return   l3(x) * d2l9(y);
-    }
-
-    static double simple_quad_l3_l10(double x, double y)
-    {
-      return   l3(x) * l10(y);
-    }
-
-    static double simple_quad_l3_l10x(double x, double y)
-    {
-      return   dl3(x) * l10(y);
-    }
-
-    static double simple_quad_l3_l10y(double x, double y)
-    {
-      return   l3(x) * dl10(y);
-    }
-
-    static double simple_quad_l3_l10xx(double x, double y)
-    {
-      return   d2l3(x) * l10(y);
-    }
-
-    static double simple_quad_l3_l10xy(double x, double y)
-    {
-      return   dl3(x) * dl10(y);
-    }
-
-    static double simple_quad_l3_l10yy(double x, double y)
-    {
-      return   l3(x) * d2l10(y);
-    }
-
-    static double simple_quad_l4_l0(double x, double y)
-    {
-      return   l4(x) * l0(y);
-    }
-
-    static double simple_quad_l4_l0x(double x, double y)
-    {
-      return   dl4(x) * l0(y);
-    }
-
-    static double simple_quad_l4_l0y(double x, double y)
-    {
-      return   l4(x) * dl0(y);
-    }
-
-    static double simple_quad_l4_l0xx(double x, double y)
-    {
-      return   d2l4(x) * l0(y);
-    }
-
-    static double simple_quad_l4_l0xy(double x, double y)
-    {
-      return   dl4(x) * dl0(y);
-    }
-
-    static double simple_quad_l4_l0yy(double x, double y)
-    {
-      return   l4(x) * d2l0(y);
-    }
-
-    static double simple_quad_l4_l1(double x, double y)
-    {
-      return   l4(x) * l1(y);
-    }
-
-    static double simple_quad_l4_l1x(double x, double y)
-    {
-      return   dl4(x) * l1(y);
-    }
-
-    static double simple_quad_l4_l1y(double x, double y)
-    {
-      return   l4(x) * dl1(y);
-    }
-
-    static double simple_quad_l4_l1xx(double x, double y)
-    {
-      return   d2l4(x) * l1(y);
-    }
-
-    static double simple_quad_l4_l1xy(double x, double y)
-    {
-      return   dl4(x) * dl1(y);
-    }
-
-    static double simple_quad_l4_l1yy(double x, double y)
-    {
-      return   l4(x) * d2l1(y);
-    }
-
-    static double simple_quad_l4_l2(double x, double y)
-    {
-      return   l4(x) * l2(y);
-    }
-
-    static double simple_quad_l4_l2x(double x, double y)
-    {
-      return   dl4(x) * l2(y);
-    }
-
-    static double simple_quad_l4_l2y(double x, double y)
-    {
-      return   l4(x) * dl2(y);
-    }
-
-    static double simple_quad_l4_l2xx(double x, double y)
-    {
-      return   d2l4(x) * l2(y);
-    }
-
-    static double simple_quad_l4_l2xy(double x, double y)
-    {
-      return   dl4(x) * dl2(y);
-    }
-
-    static double simple_quad_l4_l2yy(double x, double y)
-    {
-      return   l4(x) * d2l2(y);
-    }
-
-    static double simple_quad_l4_l3(double x, double y)
-    {
-      return   l4(x) * l3(y);
-    }
-
-    static double simple_quad_l4_l3x(double x, double y)
-    {
-      return   dl4(x) * l3(y);
-    }
-
-    static double simple_quad_l4_l3y(double x, double y)
-    {
-      return   l4(x) * dl3(y);
-    }
-
-    static double simple_quad_l4_l3xx(double x, double y)
-    {
-      return   d2l4(x) * l3(y);
-    }
-
-    static double simple_quad_l4_l3xy(double x, double y)
-    {
-      return   dl4(x) * dl3(y);
-    }
-
-    static double simple_quad_l4_l3yy(double x, double y)
-    {
-      return   l4(x) * d2l3(y);
-    }
-
-    static double simple_quad_l4_l4(double x, double y)
-    {
-      return   l4(x) * l4(y);
-    }
-
-    static double simple_quad_l4_l4x(double x, double y)
-    {
-      return   dl4(x) * l4(y);
-    }
-
-    static double simple_quad_l4_l4y(double x, double y)
-    {
-      return   l4(x) * dl4(y);
-    }
-
-    static double simple_quad_l4_l4xx(double x, double y)
-    {
-      return   d2l4(x) * l4(y);
-    }
-
-    static double simple_quad_l4_l4xy(double x, double y)
-    {
-      return   dl4(x) * dl4(y);
-    }
-
-    static double simple_quad_l4_l4yy(double x, double y)
-    {
-      return   l4(x) * d2l4(y);
-    }
-
-    static double simple_quad_l4_l5(double x, double y)
-    {
-      return   l4(x) * l5(y);
-    }
-
-    static double simple_quad_l4_l5x(double x, double y)
-    {
-      return   dl4(x) * l5(y);
-    }
-
-    static double simple_quad_l4_l5y(double x, double y)
-    {
-      return   l4(x) * dl5(y);
-    }
-
-    static double simple_quad_l4_l5xx(double x, double y)
-    {
-      return   d2l4(x) * l5(y);
-    }
-
-    static double simple_quad_l4_l5xy(double x, double y)
-    {
-      return   dl4(x) * dl5(y);
-    }
-
-    static double simple_quad_l4_l5yy(double x, double y)
-    {
-      return   l4(x) * d2l5(y);
-    }
-
-    static double simple_quad_l4_l6(double x, double y)
-    {
-      return   l4(x) * l6(y);
-    }
-
-    static double simple_quad_l4_l6x(double x, double y)
-    {
-      return   dl4(x) * l6(y);
-    }
-
-    static double simple_quad_l4_l6y(double x, double y)
-    {
-      return   l4(x) * dl6(y);
-    }
-
-    static double simple_quad_l4_l6xx(double x, double y)
-    {
-      return   d2l4(x) * l6(y);
-    }
-
-    static double simple_quad_l4_l6xy(double x, double y)
-    {
-      return   dl4(x) * dl6(y);
-    }
-
-    static double simple_quad_l4_l6yy(double x, double y)
-    {
-      return   l4(x) * d2l6(y);
-    }
-
-    static double simple_quad_l4_l7(double x, double y)
-    {
-      return   l4(x) * l7(y);
-    }
-
-    static double simple_quad_l4_l7x(double x, double y)
-    {
-      return   dl4(x) * l7(y);
-    }
-
-    static double simple_quad_l4_l7y(double x, double y)
-    {
-      return   l4(x) * dl7(y);
-    }
-
-    static double simple_quad_l4_l7xx(double x, double y)
-    {
-      return   d2l4(x) * l7(y);
-    }
-
-    static double simple_quad_l4_l7xy(double x, double y)
-    {
-      return   dl4(x) * dl7(y);
-    }
-
-    static double simple_quad_l4_l7yy(double x, double y)
-    {
-      return   l4(x) * d2l7(y);
-    }
-
-    static double simple_quad_l4_l8(double x, double y)
-    {
-      return   l4(x) * l8(y);
-    }
-
-    static double simple_quad_l4_l8x(double x, double y)
-    {
-      return   dl4(x) * l8(y);
-    }
-
-    static double simple_quad_l4_l8y(double x, double y)
-    {
-      return   l4(x) * dl8(y);
-    }
-
-    static double simple_quad_l4_l8xx(double x, double y)
-    {
-      return   d2l4(x) * l8(y);
-    }
-
-    static double simple_quad_l4_l8xy(double x, double y)
-    {
-      return   dl4(x) * dl8(y);
-    }
-
-    static double simple_quad_l4_l8yy(double x, double y)
-    {
-      return   l4(x) * d2l8(y);
-    }
-
-    static double simple_quad_l4_l9(double x, double y)
-    {
-      return   l4(x) * l9(y);
-    }
-
-    static double simple_quad_l4_l9x(double x, double y)
-    {
-      return   dl4(x) * l9(y);
-    }
-
-    static double simple_quad_l4_l9y(double x, double y)
-    {
-      return   l4(x) * dl9(y);
-    }
-
-    static double simple_quad_l4_l9xx(double x, double y)
-    {
-      return   d2l4(x) * l9(y);
-    }
-
-    static double simple_quad_l4_l9xy(double x, double y)
-    {
-      return   dl4(x) * dl9(y);
-    }
-
-    static double simple_quad_l4_l9yy(double x, double y)
-    {
-      return   l4(x) * d2l9(y);
-    }
-
-    static double simple_quad_l4_l10(double x, double y)
-    {
-      return   l4(x) * l10(y);
-    }
-
-    static double simple_quad_l4_l10x(double x, double y)
-    {
-      return   dl4(x) * l10(y);
-    }
-
-    static double simple_quad_l4_l10y(double x, double y)
-    {
-      return   l4(x) * dl10(y);
-    }
-
-    static double simple_quad_l4_l10xx(double x, double y)
-    {
-      return   d2l4(x) * l10(y);
-    }
-
-    static double simple_quad_l4_l10xy(double x, double y)
-    {
-      return   dl4(x) * dl10(y);
-    }
-
-    static double simple_quad_l4_l10yy(double x, double y)
-    {
-      return   l4(x) * d2l10(y);
-    }
-
-    static double simple_quad_l5_l0_0(double x, double y)
-    {
-      return   l5(x) * l0(y);
-    }
-
-    static double simple_quad_l5_l0x_0(double x, double y)
-    {
-      return   dl5(x) * l0(y);
-    }
-
-    static double simple_quad_l5_l0y_0(double x, double y)
-    {
-      return   l5(x) * dl0(y);
-    }
-
-    static double simple_quad_l5_l0xx_0(double x, double y)
-    {
-      return   d2l5(x) * l0(y);
-    }
-
-    static double simple_quad_l5_l0xy_0(double x, double y)
-    {
-      return   dl5(x) * dl0(y);
-    }
-
-    static double simple_quad_l5_l0yy_0(double x, double y)
-    {
-      return   l5(x) * d2l0(y);
-    }
-
-    static double simple_quad_l5_l0_1(double x, double y)
-    {
-      return -(  l5(x) * l0(y));
-    }
-
-    static double simple_quad_l5_l0x_1(double x, double y)
-    {
-      return -(  dl5(x) * l0(y));
-    }
-
-    static double simple_quad_l5_l0y_1(double x, double y)
-    {
-      return -(  l5(x) * dl0(y));
-    }
-
-    static double simple_quad_l5_l0xx_1(double x, double y)
-    {
-      return -(  d2l5(x) * l0(y));
-    }
-
-    static double simple_quad_l5_l0xy_1(double x, double y)
-    {
-      return -(  dl5(x) * dl0(y));
-    }
-
-    static double simple_quad_l5_l0yy_1(double x, double y)
-    {
-      return -(  l5(x) * d2l0(y));
-    }
-
-    static double simple_quad_l5_l1_0(double x, double y)
-    {
-      return - l5(x) * l1(y);
-    }
-
-    static double simple_quad_l5_l1x_0(double x, double y)
-    {
-      return - dl5(x) * l1(y);
-    }
-
-    static double simple_quad_l5_l1y_0(double x, double y)
-    {
-      return - l5(x) * dl1(y);
-    }
-
-    static double simple_quad_l5_l1xx_0(double x, double y)
-    {
-      return - d2l5(x) * l1(y);
-    }
-
-    static double simple_quad_l5_l1xy_0(double x, double y)
-    {
-      return - dl5(x) * dl1(y);
-    }
-
-    static double simple_quad_l5_l1yy_0(double x, double y)
-    {
-      return - l5(x) * d2l1(y);
-    }
-
-    static double simple_quad_l5_l1_1(double x, double y)
-    {
-      return -(- l5(x) * l1(y));
-    }
-
-    static double simple_quad_l5_l1x_1(double x, double y)
-    {
-      return -(- dl5(x) * l1(y));
-    }
-
-    static double simple_quad_l5_l1y_1(double x, double y)
-    {
-      return -(- l5(x) * dl1(y));
-    }
-
-    static double simple_quad_l5_l1xx_1(double x, double y)
-    {
-      return -(- d2l5(x) * l1(y));
-    }
-
-    static double simple_quad_l5_l1xy_1(double x, double y)
-    {
-      return -(- dl5(x) * dl1(y));
-    }
-
-    static double simple_quad_l5_l1yy_1(double x, double y)
-    {
-      return -(- l5(x) * d2l1(y));
-    }
-
-    static double simple_quad_l5_l2(double x, double y)
-    {
-      return   l5(x) * l2(y);
-    }
-
-    static double simple_quad_l5_l2x(double x, double y)
-    {
-      return   dl5(x) * l2(y);
-    }
-
-    static double simple_quad_l5_l2y(double x, double y)
-    {
-      return   l5(x) * dl2(y);
-    }
-
-    static double simple_quad_l5_l2xx(double x, double y)
-    {
-      return   d2l5(x) * l2(y);
-    }
-
-    static double simple_quad_l5_l2xy(double x, double y)
-    {
-      return   dl5(x) * dl2(y);
-    }
-
-    static double simple_quad_l5_l2yy(double x, double y)
-    {
-      return   l5(x) * d2l2(y);
-    }
-
-    static double simple_quad_l5_l3(double x, double y)
-    {
-      return   l5(x) * l3(y);
-    }
-
-    static double simple_quad_l5_l3x(double x, double y)
-    {
-      return   dl5(x) * l3(y);
-    }
-
-    static double simple_quad_l5_l3y(double x, double y)
-    {
-      return   l5(x) * dl3(y);
-    }
-
-    static double simple_quad_l5_l3xx(double x, double y)
-    {
-      return   d2l5(x) * l3(y);
-    }
-
-    static double simple_quad_l5_l3xy(double x, double y)
-    {
-      return   dl5(x) * dl3(y);
-    }
-
-    static double simple_quad_l5_l3yy(double x, double y)
-    {
-      return   l5(x) * d2l3(y);
-    }
-
-    static double simple_quad_l5_l4(double x, double y)
-    {
-      return   l5(x) * l4(y);
-    }
-
-    static double simple_quad_l5_l4x(double x, double y)
-    {
-      return   dl5(x) * l4(y);
-    }
-
-    static double simple_quad_l5_l4y(double x, double y)
-    {
-      return   l5(x) * dl4(y);
-    }
-
-    static double simple_quad_l5_l4xx(double x, double y)
-    {
-      return   d2l5(x) * l4(y);
-    }
-
-    static double simple_quad_l5_l4xy(double x, double y)
-    {
-      return   dl5(x) * dl4(y);
-    }
-
-    static double simple_quad_l5_l4yy(double x, double y)
-    {
-      return   l5(x) * d2l4(y);
-    }
-
-    static double simple_quad_l5_l5(double x, double y)
-    {
-      return   l5(x) * l5(y);
-    }
-
-    static double simple_quad_l5_l5x(double x, double y)
-    {
-      return   dl5(x) * l5(y);
-    }
-
-    static double simple_quad_l5_l5y(double x, double y)
-    {
-      return   l5(x) * dl5(y);
-    }
-
-    static double simple_quad_l5_l5xx(double x, double y)
-    {
-      return   d2l5(x) * l5(y);
-    }
-
-    static double simple_quad_l5_l5xy(double x, double y)
-    {
-      return   dl5(x) * dl5(y);
-    }
-
-    static double simple_quad_l5_l5yy(double x, double y)
-    {
-      return   l5(x) * d2l5(y);
-    }
-
-    static double simple_quad_l5_l6(double x, double y)
-    {
-      return   l5(x) * l6(y);
-    }
-
-    static double simple_quad_l5_l6x(double x, double y)
-    {
-      return   dl5(x) * l6(y);
-    }
-
-    static double simple_quad_l5_l6y(double x, double y)
-    {
-      return   l5(x) * dl6(y);
-    }
-
-    static double simple_quad_l5_l6xx(double x, double y)
-    {
-      return   d2l5(x) * l6(y);
-    }
-
-    static double simple_quad_l5_l6xy(double x, double y)
-    {
-      return   dl5(x) * dl6(y);
-    }
-
-    static double simple_quad_l5_l6yy(double x, double y)
-    {
-      return   l5(x) * d2l6(y);
-    }
-
-    static double simple_quad_l5_l7(double x, double y)
-    {
-      return   l5(x) * l7(y);
-    }
-
-    static double simple_quad_l5_l7x(double x, double y)
-    {
-      return   dl5(x) * l7(y);
-    }
-
-    static double simple_quad_l5_l7y(double x, double y)
-    {
-      return   l5(x) * dl7(y);
-    }
-
-    static double simple_quad_l5_l7xx(double x, double y)
-    {
-      return   d2l5(x) * l7(y);
-    }
-
-    static double simple_quad_l5_l7xy(double x, double y)
-    {
-      return   dl5(x) * dl7(y);
-    }
-
-    static double simple_quad_l5_l7yy(double x, double y)
-    {
-      return   l5(x) * d2l7(y);
-    }
-
-    static double simple_quad_l5_l8(double x, double y)
-    {
-      return   l5(x) * l8(y);
-    }
-
-    static double simple_quad_l5_l8x(double x, double y)
-    {
-      return   dl5(x) * l8(y);
-    }
-
-    static double simple_quad_l5_l8y(double x, double y)
-    {
-      return   l5(x) * dl8(y);
-    }
-
-    static double simple_quad_l5_l8xx(double x, double y)
-    {
-      return   d2l5(x) * l8(y);
-    }
-
-    static double simple_quad_l5_l8xy(double x, double y)
-    {
-      return   dl5(x) * dl8(y);
-    }
-
-    static double simple_quad_l5_l8yy(double x, double y)
-    {
-      return   l5(x) * d2l8(y);
-    }
-
-    static double simple_quad_l5_l9(double x, double y)
-    {
-      return   l5(x) * l9(y);
-    }
-
-    static double simple_quad_l5_l9x(double x, double y)
-    {
-      return   dl5(x) * l9(y);
-    }
-
-    static double simple_quad_l5_l9y(double x, double y)
-    {
-      return   l5(x) * dl9(y);
-    }
-
-    static double simple_quad_l5_l9xx(double x, double y)
-    {
-      return   d2l5(x) * l9(y);
-    }
-
-    static double simple_quad_l5_l9xy(double x, double y)
-    {
-      return   dl5(x) * dl9(y);
-    }
-
-    static double simple_quad_l5_l9yy(double x, double y)
-    {
-      return   l5(x) * d2l9(y);
-    }
-
-    static double simple_quad_l5_l10(double x, double y)
-    {
-      return   l5(x) * l10(y);
-    }
-
-    static double simple_quad_l5_l10x(double x, double y)
-    {
-      return   dl5(x) * l10(y);
-    }
-
-    static double simple_quad_l5_l10y(double x, double y)
-    {
-      return   l5(x) * dl10(y);
-    }
-
-    static double simple_quad_l5_l10xx(double x, double y)
-    {
-      return   d2l5(x) * l10(y);
-    }
-
-    static double simple_quad_l5_l10xy(double x, double y)
-    {
-      return   dl5(x) * dl10(y);
-    }
-
-    static double simple_quad_l5_l10yy(double x, double y)
-    {
-      return   l5(x) * d2l10(y);
-    }
-
-    static double simple_quad_l6_l0(double x, double y)
-    {
-      return   l6(x) * l0(y);
-    }
-
-    static double simple_quad_l6_l0x(double x, double y)
-    {
-      return   dl6(x) * l0(y);
-    }
-
-    static double simple_quad_l6_l0y(double x, double y)
-    {
-      return   l6(x) * dl0(y);
-    }
-
-    static double simple_quad_l6_l0xx(double x, double y)
-    {
-      return   d2l6(x) * l0(y);
-    }
-
-    static double simple_quad_l6_l0xy(double x, double y)
-    {
-      return   dl6(x) * dl0(y);
-    }
-
-    static double simple_quad_l6_l0yy(double x, double y)
-    {
-      return   l6(x) * d2l0(y);
-    }
-
-    static double simple_quad_l6_l1(double x, double y)
-    {
-      return   l6(x) * l1(y);
-    }
-
-    static double simple_quad_l6_l1x(double x, double y)
-    {
-      return   dl6(x) * l1(y);
-    }
-
-    static double simple_quad_l6_l1y(double x, double y)
-    {
-      return   l6(x) * dl1(y);
-    }
-
-    static double simple_quad_l6_l1xx(double x, double y)
-    {
-      return   d2l6(x) * l1(y);
-    }
-
-    static double simple_quad_l6_l1xy(double x, double y)
-    {
-      return   dl6(x) * dl1(y);
-    }
-
-    static double simple_quad_l6_l1yy(double x, double y)
-    {
-      return   l6(x) * d2l1(y);
-    }
-
-    static double simple_quad_l6_l2(double x, double y)
-    {
-      return   l6(x) * l2(y);
-    }
-
-    static double simple_quad_l6_l2x(double x, double y)
-    {
-      return   dl6(x) * l2(y);
-    }
-
-    static double simple_quad_l6_l2y(double x, double y)
-    {
-      return   l6(x) * dl2(y);
-    }
-
-    static double simple_quad_l6_l2xx(double x, double y)
-    {
-      return   d2l6(x) * l2(y);
-    }
-
-    static double simple_quad_l6_l2xy(double x, double y)
-    {
-      return   dl6(x) * dl2(y);
-    }
-
-    static double simple_quad_l6_l2yy(double x, double y)
-    {
-      return   l6(x) * d2l2(y);
-    }
-
-    static double simple_quad_l6_l3(double x, double y)
-    {
-      return   l6(x) * l3(y);
-    }
-
-    static double simple_quad_l6_l3x(double x, double y)
-    {
-      return   dl6(x) * l3(y);
-    }
-
-    static double simple_quad_l6_l3y(double x, double y)
-    {
-      return   l6(x) * dl3(y);
-    }
-
-    static double simple_quad_l6_l3xx(double x, double y)
-    {
-      return   d2l6(x) * l3(y);
-    }
-
-    static double simple_quad_l6_l3xy(double x, double y)
-    {
-      return   dl6(x) * dl3(y);
-    }
-
-    static double simple_quad_l6_l3yy(double x, double y)
-    {
-      return   l6(x) * d2l3(y);
-    }
-
-    static double simple_quad_l6_l4(double x, double y)
-    {
-      return   l6(x) * l4(y);
-    }
-
-    static double simple_quad_l6_l4x(double x, double y)
-    {
-      return   dl6(x) * l4(y);
-    }
-
-    static double simple_quad_l6_l4y(double x, double y)
-    {
-      return   l6(x) * dl4(y);
-    }
-
-    static double simple_quad_l6_l4xx(double x, double y)
-    {
-      return   d2l6(x) * l4(y);
-    }
-
-    static double simple_quad_l6_l4xy(double x, double y)
-    {
-      return   dl6(x) * dl4(y);
-    }
-
-    static double simple_quad_l6_l4yy(double x, double y)
-    {
-      return   l6(x) * d2l4(y);
-    }
-
-    static double simple_quad_l6_l5(double x, double y)
-    {
-      return   l6(x) * l5(y);
-    }
-
-    static double simple_quad_l6_l5x(double x, double y)
-    {
-      return   dl6(x) * l5(y);
-    }
-
-    static double simple_quad_l6_l5y(double x, double y)
-    {
-      return   l6(x) * dl5(y);
-    }
-
-    static double simple_quad_l6_l5xx(double x, double y)
-    {
-      return   d2l6(x) * l5(y);
-    }
-
-    static double simple_quad_l6_l5xy(double x, double y)
-    {
-      return   dl6(x) * dl5(y);
-    }
-
-    static double simple_quad_l6_l5yy(double x, double y)
-    {
-      return   l6(x) * d2l5(y);
-    }
-
-    static double simple_quad_l6_l6(double x, double y)
-    {
-      return   l6(x) * l6(y);
-    }
-
-    static double simple_quad_l6_l6x(double x, double y)
-    {
-      return   dl6(x) * l6(y);
-    }
-
-    static double simple_quad_l6_l6y(double x, double y)
-    {
-      return   l6(x) * dl6(y);
-    }
-
-    static double simple_quad_l6_l6xx(double x, double y)
-    {
-      return   d2l6(x) * l6(y);
-    }
-
-    static double simple_quad_l6_l6xy(double x, double y)
-    {
-      return   dl6(x) * dl6(y);
-    }
-
-    static double simple_quad_l6_l6yy(double x, double y)
-    {
-      return   l6(x) * d2l6(y);
-    }
-
-    static double simple_quad_l6_l7(double x, double y)
-    {
-      return   l6(x) * l7(y);
-    }
-
-    static double simple_quad_l6_l7x(double x, double y)
-    {
-      return   dl6(x) * l7(y);
-    }
-
-    static double simple_quad_l6_l7y(double x, double y)
-    {
-      return   l6(x) * dl7(y);
-    }
-
-    static double simple_quad_l6_l7xx(double x, double y)
-    {
-      return   d2l6(x) * l7(y);
-    }
-
-    static double simple_quad_l6_l7xy(double x, double y)
-    {
-      return   dl6(x) * dl7(y);
-    }
-
-    static double simple_quad_l6_l7yy(double x, double y)
-    {
-      return   l6(x) * d2l7(y);
-    }
-
-    static double simple_quad_l6_l8(double x, double y)
-    {
-      return   l6(x) * l8(y);
-    }
-
-    static double simple_quad_l6_l8x(double x, double y)
-    {
-      return   dl6(x) * l8(y);
-    }
-
-    static double simple_quad_l6_l8y(double x, double y)
-    {
-      return   l6(x) * dl8(y);
-    }
-
-    static double simple_quad_l6_l8xx(double x, double y)
-    {
-      return   d2l6(x) * l8(y);
-    }
-
-    static double simple_quad_l6_l8xy(double x, double y)
-    {
-      return   dl6(x) * dl8(y);
-    }
-
-    static double simple_quad_l6_l8yy(double x, double y)
-    {
-      return   l6(x) * d2l8(y);
-    }
-
-    static double simple_quad_l6_l9(double x, double y)
-    {
-      return   l6(x) * l9(y);
-    }
-
-    static double simple_quad_l6_l9x(double x, double y)
-    {
-      return   dl6(x) * l9(y);
-    }
-
-    static double simple_quad_l6_l9y(double x, double y)
-    {
-      return   l6(x) * dl9(y);
-    }
-
-    static double simple_quad_l6_l9xx(double x, double y)
-    {
-      return   d2l6(x) * l9(y);
-    }
-
-    static double simple_quad_l6_l9xy(double x, double y)
-    {
-      return   dl6(x) * dl9(y);
-    }
-
-    static double simple_quad_l6_l9yy(double x, double y)
-    {
-      return   l6(x) * d2l9(y);
-    }
-
-    static double simple_quad_l6_l10(double x, double y)
-    {
-      return   l6(x) * l10(y);
-    }
-
-    static double simple_quad_l6_l10x(double x, double y)
-    {
-      return   dl6(x) * l10(y);
-    }
-
-    static double simple_quad_l6_l10y(double x, double y)
-    {
-      return   l6(x) * dl10(y);
-    }
-
-    static double simple_quad_l6_l10xx(double x, double y)
-    {
-      return   d2l6(x) * l10(y);
-    }
-
-    static double simple_quad_l6_l10xy(double x, double y)
-    {
-      return   dl6(x) * dl10(y);
-    }
-
-    static double simple_quad_l6_l10yy(double x, double y)
-    {
-      return   l6(x) * d2l10(y);
-    }
-
-    static double simple_quad_l7_l0_0(double x, double y)
-    {
-      return   l7(x) * l0(y);
-    }
-
-    static double simple_quad_l7_l0x_0(double x, double y)
-    {
-      return   dl7(x) * l0(y);
-    }
-
-    static double simple_quad_l7_l0y_0(double x, double y)
-    {
-      return   l7(x) * dl0(y);
-    }
-
-    static double simple_quad_l7_l0xx_0(double x, double y)
-    {
-      return   d2l7(x) * l0(y);
-    }
-
-    static double simple_quad_l7_l0xy_0(double x, double y)
-    {
-      return   dl7(x) * dl0(y);
-    }
-
-    static double simple_quad_l7_l0yy_0(double x, double y)
-    {
-      return   l7(x) * d2l0(y);
-    }
-
-    static double simple_quad_l7_l0_1(double x, double y)
-    {
-      return -(  l7(x) * l0(y));
-    }
-
-    static double simple_quad_l7_l0x_1(double x, double y)
-    {
-      return -(  dl7(x) * l0(y));
-    }
-
-    static double simple_quad_l7_l0y_1(double x, double y)
-    {
-      return -(  l7(x) * dl0(y));
-    }
-
-    static double simple_quad_l7_l0xx_1(double x, double y)
-    {
-      return -(  d2l7(x) * l0(y));
-    }
-
-    static double simple_quad_l7_l0xy_1(double x, double y)
-    {
-      return -(  dl7(x) * dl0(y));
-    }
-
-    static double simple_quad_l7_l0yy_1(double x, double y)
-    {
-      return -(  l7(x) * d2l0(y));
-    }
-
-    static double simple_quad_l7_l1_0(double x, double y)
-    {
-      return - l7(x) * l1(y);
-    }
-
-    static double simple_quad_l7_l1x_0(double x, double y)
-    {
-      return - dl7(x) * l1(y);
-    }
-
-    static double simple_quad_l7_l1y_0(double x, double y)
-    {
-      return - l7(x) * dl1(y);
-    }
-
-    static double simple_quad_l7_l1xx_0(double x, double y)
-    {
-      return - d2l7(x) * l1(y);
-    }
-
-    static double simple_quad_l7_l1xy_0(double x, double y)
-    {
-      return - dl7(x) * dl1(y);
-    }
-
-    static double simple_quad_l7_l1yy_0(double x, double y)
-    {
-      return - l7(x) * d2l1(y);
-    }
-
-    static double simple_quad_l7_l1_1(double x, double y)
-    {
-      return -(- l7(x) * l1(y));
-    }
-
-    static double simple_quad_l7_l1x_1(double x, double y)
-    {
-      return -(- dl7(x) * l1(y));
-    }
-
-    static double simple_quad_l7_l1y_1(double x, double y)
-    {
-      return -(- l7(x) * dl1(y));
-    }
-
-    static double simple_quad_l7_l1xx_1(double x, double y)
-    {
-      return -(- d2l7(x) * l1(y));
-    }
-
-    static double simple_quad_l7_l1xy_1(double x, double y)
-    {
-      return -(- dl7(x) * dl1(y));
-    }
-
-    static double simple_quad_l7_l1yy_1(double x, double y)
-    {
-      return -(- l7(x) * d2l1(y));
-    }
-
-    static double simple_quad_l7_l2(double x, double y)
-    {
-      return   l7(x) * l2(y);
-    }
-
-    static double simple_quad_l7_l2x(double x, double y)
-    {
-      return   dl7(x) * l2(y);
-    }
-
-    static double simple_quad_l7_l2y(double x, double y)
-    {
-      return   l7(x) * dl2(y);
-    }
-
-    static double simple_quad_l7_l2xx(double x, double y)
-    {
-      return   d2l7(x) * l2(y);
-    }
-
-    static double simple_quad_l7_l2xy(double x, double y)
-    {
-      return   dl7(x) * dl2(y);
-    }
-
-    static double simple_quad_l7_l2yy(double x, double y)
-    {
-      return   l7(x) * d2l2(y);
-    }
-
-    static double simple_quad_l7_l3(double x, double y)
-    {
-      return   l7(x) * l3(y);
-    }
-
-    static double simple_quad_l7_l3x(double x, double y)
-    {
-      return   dl7(x) * l3(y);
-    }
-
-    static double simple_quad_l7_l3y(double x, double y)
-    {
-      return   l7(x) * dl3(y);
-    }
-
-    static double simple_quad_l7_l3xx(double x, double y)
-    {
-      return   d2l7(x) * l3(y);
-    }
-
-    static double simple_quad_l7_l3xy(double x, double y)
-    {
-      return   dl7(x) * dl3(y);
-    }
-
-    static double simple_quad_l7_l3yy(double x, double y)
-    {
-      return   l7(x) * d2l3(y);
-    }
-
-    static double simple_quad_l7_l4(double x, double y)
-    {
-      return   l7(x) * l4(y);
-    }
-
-    static double simple_quad_l7_l4x(double x, double y)
-    {
-      return   dl7(x) * l4(y);
-    }
-
-    static double simple_quad_l7_l4y(double x, double y)
-    {
-      return   l7(x) * dl4(y);
-    }
-
-    static double simple_quad_l7_l4xx(double x, double y)
-    {
-      return   d2l7(x) * l4(y);
-    }
-
-    static double simple_quad_l7_l4xy(double x, double y)
-    {
-      return   dl7(x) * dl4(y);
-    }
-
-    static double simple_quad_l7_l4yy(double x, double y)
-    {
-      return   l7(x) * d2l4(y);
-    }
-
-    static double simple_quad_l7_l5(double x, double y)
-    {
-      return   l7(x) * l5(y);
-    }
-
-    static double simple_quad_l7_l5x(double x, double y)
-    {
-      return   dl7(x) * l5(y);
-    }
-
-    static double simple_quad_l7_l5y(double x, double y)
-    {
-      return   l7(x) * dl5(y);
-    }
-
-    static double simple_quad_l7_l5xx(double x, double y)
-    {
-      return   d2l7(x) * l5(y);
-    }
-
-    static double simple_quad_l7_l5xy(double x, double y)
-    {
-      return   dl7(x) * dl5(y);
-    }
-
-    static double simple_quad_l7_l5yy(double x, double y)
-    {
-      return   l7(x) * d2l5(y);
-    }
-
-    static double simple_quad_l7_l6(double x, double y)
-    {
-      return   l7(x) * l6(y);
-    }
-
-    static double simple_quad_l7_l6x(double x, double y)
-    {
-      return   dl7(x) * l6(y);
-    }
-
-    static double simple_quad_l7_l6y(double x, double y)
-    {
-      return   l7(x) * dl6(y);
-    }
-
-    static double simple_quad_l7_l6xx(double x, double y)
-    {
-      return   d2l7(x) * l6(y);
-    }
-
-    static double simple_quad_l7_l6xy(double x, double y)
-    {
-      return   dl7(x) * dl6(y);
-    }
-
-    static double simple_quad_l7_l6yy(double x, double y)
-    {
-      return   l7(x) * d2l6(y);
-    }
-
-    static double simple_quad_l7_l7(double x, double y)
-    {
-      return   l7(x) * l7(y);
-    }
-
-    static double simple_quad_l7_l7x(double x, double y)
-    {
-      return   dl7(x) * l7(y);
-    }
-
-    static double simple_quad_l7_l7y(double x, double y)
-    {
-      return   l7(x) * dl7(y);
-    }
-
-    static double simple_quad_l7_l7xx(double x, double y)
-    {
-      return   d2l7(x) * l7(y);
-    }
-
-    static double simple_quad_l7_l7xy(double x, double y)
-    {
-      return   dl7(x) * dl7(y);
-    }
-
-    static double simple_quad_l7_l7yy(double x, double y)
-    {
-      return   l7(x) * d2l7(y);
-    }
-
-    static double simple_quad_l7_l8(double x, double y)
-    {
-      return   l7(x) * l8(y);
-    }
-
-    static double simple_quad_l7_l8x(double x, double y)
-    {
-      return   dl7(x) * l8(y);
-    }
-
-    static double simple_quad_l7_l8y(double x, double y)
-    {
-      return   l7(x) * dl8(y);
-    }
-
-    static double simple_quad_l7_l8xx(double x, double y)
-    {
-      return   d2l7(x) * l8(y);
-    }
-
-    static double simple_quad_l7_l8xy(double x, double y)
-    {
-      return   dl7(x) * dl8(y);
-    }
-
-    static double simple_quad_l7_l8yy(double x, double y)
-    {
-      return   l7(x) * d2l8(y);
-    }
-
-    static double simple_quad_l7_l9(double x, double y)
-    {
-      return   l7(x) * l9(y);
-    }
-
-    static double simple_quad_l7_l9x(double x, double y)
-    {
-      return   dl7(x) * l9(y);
-    }
-
-    static double simple_quad_l7_l9y(double x, double y)
-    {
-      return   l7(x) * dl9(y);
-    }
-
-    static double simple_quad_l7_l9xx(double x, double y)
-    {
-      return   d2l7(x) * l9(y);
-    }
-
-    static double simple_quad_l7_l9xy(double x, double y)
-    {
-      return   dl7(x) * dl9(y);
-    }
-
-    static double simple_quad_l7_l9yy(double x, double y)
-    {
-      return   l7(x) * d2l9(y);
-    }
-
-    static double simple_quad_l7_l10(double x, double y)
-    {
-      return   l7(x) * l10(y);
-    }
-
-    static double simple_quad_l7_l10x(double x, double y)
-    {
-      return   dl7(x) * l10(y);
-    }
-
-    static double simple_quad_l7_l10y(double x, double y)
-    {
-      return   l7(x) * dl10(y);
-    }
-
-    static double simple_quad_l7_l10xx(double x, double y)
-    {
-      return   d2l7(x) * l10(y);
-    }
-
-    static double simple_quad_l7_l10xy(double x, double y)
-    {
-      return   dl7(x) * dl10(y);
-    }
-
-    static double simple_quad_l7_l10yy(double x, double y)
-    {
-      return   l7(x) * d2l10(y);
-    }
-
-    static double simple_quad_l8_l0(double x, double y)
-    {
-      return   l8(x) * l0(y);
-    }
-
-    static double simple_quad_l8_l0x(double x, double y)
-    {
-      return   dl8(x) * l0(y);
-    }
-
-    static double simple_quad_l8_l0y(double x, double y)
-    {
-      return   l8(x) * dl0(y);
-    }
-
-    static double simple_quad_l8_l0xx(double x, double y)
-    {
-      return   d2l8(x) * l0(y);
-    }
-
-    static double simple_quad_l8_l0xy(double x, double y)
-    {
-      return   dl8(x) * dl0(y);
-    }
-
-    static double simple_quad_l8_l0yy(double x, double y)
-    {
-      return   l8(x) * d2l0(y);
-    }
-
-    static double simple_quad_l8_l1(double x, double y)
-    {
-      return   l8(x) * l1(y);
-    }
-
-    static double simple_quad_l8_l1x(double x, double y)
-    {
-      return   dl8(x) * l1(y);
-    }
-
-    static double simple_quad_l8_l1y(double x, double y)
-    {
-      return   l8(x) * dl1(y);
-    }
-
-    static double simple_quad_l8_l1xx(double x, double y)
-    {
-      return   d2l8(x) * l1(y);
-    }
-
-    static double simple_quad_l8_l1xy(double x, double y)
-    {
-      return   dl8(x) * dl1(y);
-    }
-
-    static double simple_quad_l8_l1yy(double x, double y)
-    {
-      return   l8(x) * d2l1(y);
-    }
-
-    static double simple_quad_l8_l2(double x, double y)
-    {
-      return   l8(x) * l2(y);
-    }
-
-    static double simple_quad_l8_l2x(double x, double y)
-    {
-      return   dl8(x) * l2(y);
-    }
-
-    static double simple_quad_l8_l2y(double x, double y)
-    {
-      return   l8(x) * dl2(y);
-    }
-
-    static double simple_quad_l8_l2xx(double x, double y)
-    {
-      return   d2l8(x) * l2(y);
-    }
-
-    static double simple_quad_l8_l2xy(double x, double y)
-    {
-      return   dl8(x) * dl2(y);
-    }
-
-    static double simple_quad_l8_l2yy(double x, double y)
-    {
-      return   l8(x) * d2l2(y);
-    }
-
-    static double simple_quad_l8_l3(double x, double y)
-    {
-      return   l8(x) * l3(y);
-    }
-
-    static double simple_quad_l8_l3x(double x, double y)
-    {
-      return   dl8(x) * l3(y);
-    }
-
-    static double simple_quad_l8_l3y(double x, double y)
-    {
-      return   l8(x) * dl3(y);
-    }
-
-    static double simple_quad_l8_l3xx(double x, double y)
-    {
-      return   d2l8(x) * l3(y);
-    }
-
-    static double simple_quad_l8_l3xy(double x, double y)
-    {
-      return   dl8(x) * dl3(y);
-    }
-
-    static double simple_quad_l8_l3yy(double x, double y)
-    {
-      return   l8(x) * d2l3(y);
-    }
-
-    static double simple_quad_l8_l4(double x, double y)
-    {
-      return   l8(x) * l4(y);
-    }
-
-    static double simple_quad_l8_l4x(double x, double y)
-    {
-      return   dl8(x) * l4(y);
-    }
-
-    static double simple_quad_l8_l4y(double x, double y)
-    {
-      return   l8(x) * dl4(y);
-    }
-
-    static double simple_quad_l8_l4xx(double x, double y)
-    {
-      return   d2l8(x) * l4(y);
-    }
-
-    static double simple_quad_l8_l4xy(double x, double y)
-    {
-      return   dl8(x) * dl4(y);
-    }
-
-    static double simple_quad_l8_l4yy(double x, double y)
-    {
-      return   l8(x) * d2l4(y);
-    }
-
-    static double simple_quad_l8_l5(double x, double y)
-    {
-      return   l8(x) * l5(y);
-    }
-
-    static double simple_quad_l8_l5x(double x, double y)
-    {
-      return   dl8(x) * l5(y);
-    }
-
-    static double simple_quad_l8_l5y(double x, double y)
-    {
-      return   l8(x) * dl5(y);
-    }
-
-    static double simple_quad_l8_l5xx(double x, double y)
-    {
-      return   d2l8(x) * l5(y);
-    }
-
-    static double simple_quad_l8_l5xy(double x, double y)
-    {
-      return   dl8(x) * dl5(y);
-    }
-
-    static double simple_quad_l8_l5yy(double x, double y)
-    {
-      return   l8(x) * d2l5(y);
-    }
-
-    static double simple_quad_l8_l6(double x, double y)
-    {
-      return   l8(x) * l6(y);
-    }
-
-    static double simple_quad_l8_l6x(double x, double y)
-    {
-      return   dl8(x) * l6(y);
-    }
-
-    static double simple_quad_l8_l6y(double x, double y)
-    {
-      return   l8(x) * dl6(y);
-    }
-
-    static double simple_quad_l8_l6xx(double x, double y)
-    {
-      return   d2l8(x) * l6(y);
-    }
-
-    static double simple_quad_l8_l6xy(double x, double y)
-    {
-      return   dl8(x) * dl6(y);
-    }
-
-    static double simple_quad_l8_l6yy(double x, double y)
-    {
-      return   l8(x) * d2l6(y);
-    }
-
-    static double simple_quad_l8_l7(double x, double y)
-    {
-      return   l8(x) * l7(y);
-    }
-
-    static double simple_quad_l8_l7x(double x, double y)
-    {
-      return   dl8(x) * l7(y);
-    }
-
-    static double simple_quad_l8_l7y(double x, double y)
-    {
-      return   l8(x) * dl7(y);
-    }
-
-    static double simple_quad_l8_l7xx(double x, double y)
-    {
-      return   d2l8(x) * l7(y);
-    }
-
-    static double simple_quad_l8_l7xy(double x, double y)
-    {
-      return   dl8(x) * dl7(y);
-    }
-
-    static double simple_quad_l8_l7yy(double x, double y)
-    {
-      return   l8(x) * d2l7(y);
-    }
-
-    static double simple_quad_l8_l8(double x, double y)
-    {
-      return   l8(x) * l8(y);
-    }
-
-    static double simple_quad_l8_l8x(double x, double y)
-    {
-      return   dl8(x) * l8(y);
-    }
-
-    static double simple_quad_l8_l8y(double x, double y)
-    {
-      return   l8(x) * dl8(y);
-    }
-
-    static double simple_quad_l8_l8xx(double x, double y)
-    {
-      return   d2l8(x) * l8(y);
-    }
-
-    static double simple_quad_l8_l8xy(double x, double y)
-    {
-      return   dl8(x) * dl8(y);
-    }
-
-    static double simple_quad_l8_l8yy(double x, double y)
-    {
-      return   l8(x) * d2l8(y);
-    }
-
-    static double simple_quad_l8_l9(double x, double y)
-    {
-      return   l8(x) * l9(y);
-    }
-
-    static double simple_quad_l8_l9x(double x, double y)
-    {
-      return   dl8(x) * l9(y);
-    }
-
-    static double simple_quad_l8_l9y(double x, double y)
-    {
-      return   l8(x) * dl9(y);
-    }
-
-    static double simple_quad_l8_l9xx(double x, double y)
-    {
-      return   d2l8(x) * l9(y);
-    }
-
-    static double simple_quad_l8_l9xy(double x, double y)
-    {
-      return   dl8(x) * dl9(y);
-    }
-
-    static double simple_quad_l8_l9yy(double x, double y)
-    {
-      return   l8(x) * d2l9(y);
-    }
-
-    static double simple_quad_l8_l10(double x, double y)
-    {
-      return   l8(x) * l10(y);
-    }
-
-    static double simple_quad_l8_l10x(double x, double y)
-    {
-      return   dl8(x) * l10(y);
-    }
-
-    static double simple_quad_l8_l10y(double x, double y)
-    {
-      return   l8(x) * dl10(y);
-    }
-
-    static double simple_quad_l8_l10xx(double x, double y)
-    {
-      return   d2l8(x) * l10(y);
-    }
-
-    static double simple_quad_l8_l10xy(double x, double y)
-    {
-      return   dl8(x) * dl10(y);
-    }
-
-    static double simple_quad_l8_l10yy(double x, double y)
-    {
-      return   l8(x) * d2l10(y);
-    }
-
-    static double simple_quad_l9_l0_0(double x, double y)
-    {
-      return   l9(x) * l0(y);
-    }
-
-    static double simple_quad_l9_l0x_0(double x, double y)
-    {
-      return   dl9(x) * l0(y);
-    }
-
-    static double simple_quad_l9_l0y_0(double x, double y)
-    {
-      return   l9(x) * dl0(y);
-    }
-
-    static double simple_quad_l9_l0xx_0(double x, double y)
-    {
-      return   d2l9(x) * l0(y);
-    }
-
-    static double simple_quad_l9_l0xy_0(double x, double y)
-    {
-      return   dl9(x) * dl0(y);
-    }
-
-    static double simple_quad_l9_l0yy_0(double x, double y)
-    {
-      return   l9(x) * d2l0(y);
-    }
-
-    static double simple_quad_l9_l0_1(double x, double y)
-    {
-      return -(  l9(x) * l0(y));
-    }
-
-    static double simple_quad_l9_l0x_1(double x, double y)
-    {
-      return -(  dl9(x) * l0(y));
-    }
-
-    static double simple_quad_l9_l0y_1(double x, double y)
-    {
-      return -(  l9(x) * dl0(y));
-    }
-
-    static double simple_quad_l9_l0xx_1(double x, double y)
-    {
-      return -(  d2l9(x) * l0(y));
-    }
-
-    static double simple_quad_l9_l0xy_1(double x, double y)
-    {
-      return -(  dl9(x) * dl0(y));
-    }
-
-    static double simple_quad_l9_l0yy_1(double x, double y)
-    {
-      return -(  l9(x) * d2l0(y));
-    }
-
-    static double simple_quad_l9_l1_0(double x, double y)
-    {
-      return - l9(x) * l1(y);
-    }
-
-    static double simple_quad_l9_l1x_0(double x, double y)
-    {
-      return - dl9(x) * l1(y);
-    }
-
-    static double simple_quad_l9_l1y_0(double x, double y)
-    {
-      return - l9(x) * dl1(y);
-    }
-
-    static double simple_quad_l9_l1xx_0(double x, double y)
-    {
-      return - d2l9(x) * l1(y);
-    }
-
-    static double simple_quad_l9_l1xy_0(double x, double y)
-    {
-      return - dl9(x) * dl1(y);
-    }
-
-    static double simple_quad_l9_l1yy_0(double x, double y)
-    {
-      return - l9(x) * d2l1(y);
-    }
-
-    static double simple_quad_l9_l1_1(double x, double y)
-    {
-      return -(- l9(x) * l1(y));
-    }
-
-    static double simple_quad_l9_l1x_1(double x, double y)
-    {
-      return -(- dl9(x) * l1(y));
-    }
-
-    static double simple_quad_l9_l1y_1(double x, double y)
-    {
-      return -(- l9(x) * dl1(y));
-    }
-
-    static double simple_quad_l9_l1xx_1(double x, double y)
-    {
-      return -(- d2l9(x) * l1(y));
-    }
-
-    static double simple_quad_l9_l1xy_1(double x, double y)
-    {
-      return -(- dl9(x) * dl1(y));
-    }
-
-    static double simple_quad_l9_l1yy_1(double x, double y)
-    {
-      return -(- l9(x) * d2l1(y));
-    }
-
-    static double simple_quad_l9_l2(double x, double y)
-    {
-      return   l9(x) * l2(y);
-    }
-
-    static double simple_quad_l9_l2x(double x, double y)
-    {
-      return   dl9(x) * l2(y);
-    }
-
-    static double simple_quad_l9_l2y(double x, double y)
-    {
-      return   l9(x) * dl2(y);
-    }
-
-    static double simple_quad_l9_l2xx(double x, double y)
-    {
-      return   d2l9(x) * l2(y);
-    }
-
-    static double simple_quad_l9_l2xy(double x, double y)
-    {
-      return   dl9(x) * dl2(y);
-    }
-
-    static double simple_quad_l9_l2yy(double x, double y)
-    {
-      return   l9(x) * d2l2(y);
-    }
-
-    static double simple_quad_l9_l3(double x, double y)
-    {
-      return   l9(x) * l3(y);
-    }
-
-    static double simple_quad_l9_l3x(double x, double y)
-    {
-      return   dl9(x) * l3(y);
-    }
-
-    static double simple_quad_l9_l3y(double x, double y)
-    {
-      return   l9(x) * dl3(y);
-    }
-
-    static double simple_quad_l9_l3xx(double x, double y)
-    {
-      return   d2l9(x) * l3(y);
-    }
-
-    static double simple_quad_l9_l3xy(double x, double y)
-    {
-      return   dl9(x) * dl3(y);
-    }
-
-    static double simple_quad_l9_l3yy(double x, double y)
-    {
-      return   l9(x) * d2l3(y);
-    }
-
-    static double simple_quad_l9_l4(double x, double y)
-    {
-      return   l9(x) * l4(y);
-    }
-
-    static double simple_quad_l9_l4x(double x, double y)
-    {
-      return   dl9(x) * l4(y);
-    }
-
-    static double simple_quad_l9_l4y(double x, double y)
-    {
-      return   l9(x) * dl4(y);
-    }
-
-    static double simple_quad_l9_l4xx(double x, double y)
-    {
-      return   d2l9(x) * l4(y);
-    }
-
-    static double simple_quad_l9_l4xy(double x, double y)
-    {
-      return   dl9(x) * dl4(y);
-    }
-
-    static double simple_quad_l9_l4yy(double x, double y)
-    {
-      return   l9(x) * d2l4(y);
-    }
-
-    static double simple_quad_l9_l5(double x, double y)
-    {
-      return   l9(x) * l5(y);
-    }
-
-    static double simple_quad_l9_l5x(double x, double y)
-    {
-      return   dl9(x) * l5(y);
-    }
-
-    static double simple_quad_l9_l5y(double x, double y)
-    {
-      return   l9(x) * dl5(y);
-    }
-
-    static double simple_quad_l9_l5xx(double x, double y)
-    {
-      return   d2l9(x) * l5(y);
-    }
-
-    static double simple_quad_l9_l5xy(double x, double y)
-    {
-      return   dl9(x) * dl5(y);
-    }
-
-    static double simple_quad_l9_l5yy(double x, double y)
-    {
-      return   l9(x) * d2l5(y);
-    }
-
-    static double simple_quad_l9_l6(double x, double y)
-    {
-      return   l9(x) * l6(y);
-    }
-
-    static double simple_quad_l9_l6x(double x, double y)
-    {
-      return   dl9(x) * l6(y);
-    }
-
-    static double simple_quad_l9_l6y(double x, double y)
-    {
-      return   l9(x) * dl6(y);
-    }
-
-    static double simple_quad_l9_l6xx(double x, double y)
-    {
-      return   d2l9(x) * l6(y);
-    }
-
-    static double simple_quad_l9_l6xy(double x, double y)
-    {
-      return   dl9(x) * dl6(y);
-    }
-
-    static double simple_quad_l9_l6yy(double x, double y)
-    {
-      return   l9(x) * d2l6(y);
-    }
-
-    static double simple_quad_l9_l7(double x, double y)
-    {
-      return   l9(x) * l7(y);
-    }
-
-    static double simple_quad_l9_l7x(double x, double y)
-    {
-      return   dl9(x) * l7(y);
-    }
-
-    static double simple_quad_l9_l7y(double x, double y)
-    {
-      return   l9(x) * dl7(y);
-    }
-
-    static double simple_quad_l9_l7xx(double x, double y)
-    {
-      return   d2l9(x) * l7(y);
-    }
-
-    static double simple_quad_l9_l7xy(double x, double y)
-    {
-      return   dl9(x) * dl7(y);
-    }
-
-    static double simple_quad_l9_l7yy(double x, double y)
-    {
-      return   l9(x) * d2l7(y);
-    }
-
-    static double simple_quad_l9_l8(double x, double y)
-    {
-      return   l9(x) * l8(y);
-    }
-
-    static double simple_quad_l9_l8x(double x, double y)
-    {
-      return   dl9(x) * l8(y);
-    }
-
-    static double simple_quad_l9_l8y(double x, double y)
-    {
-      return   l9(x) * dl8(y);
-    }
-
-    static double simple_quad_l9_l8xx(double x, double y)
-    {
-      return   d2l9(x) * l8(y);
-    }
-
-    static double simple_quad_l9_l8xy(double x, double y)
-    {
-      return   dl9(x) * dl8(y);
-    }
-
-    static double simple_quad_l9_l8yy(double x, double y)
-    {
-      return   l9(x) * d2l8(y);
-    }
-
-    static double simple_quad_l9_l9(double x, double y)
-    {
-      return   l9(x) * l9(y);
-    }
-
-    static double simple_quad_l9_l9x(double x, double y)
-    {
-      return   dl9(x) * l9(y);
-    }
-
-    static double simple_quad_l9_l9y(double x, double y)
-    {
-      return   l9(x) * dl9(y);
-    }
-
-    static double simple_quad_l9_l9xx(double x, double y)
-    {
-      return   d2l9(x) * l9(y);
-    }
-
-    static double simple_quad_l9_l9xy(double x, double y)
-    {
-      return   dl9(x) * dl9(y);
-    }
-
-    static double simple_quad_l9_l9yy(double x, double y)
-    {
-      return   l9(x) * d2l9(y);
-    }
-
-    static double simple_quad_l9_l10(double x, double y)
-    {
-      return   l9(x) * l10(y);
-    }
-
-    static double simple_quad_l9_l10x(double x, double y)
-    {
-      return   dl9(x) * l10(y);
-    }
-
-    static double simple_quad_l9_l10y(double x, double y)
-    {
-      return   l9(x) * dl10(y);
-    }
-
-    static double simple_quad_l9_l10xx(double x, double y)
-    {
-      return   d2l9(x) * l10(y);
-    }
-
-    static double simple_quad_l9_l10xy(double x, double y)
-    {
-      return   dl9(x) * dl10(y);
-    }
-
-    static double simple_quad_l9_l10yy(double x, double y)
-    {
-      return   l9(x) * d2l10(y);
-    }
-
-    static double simple_quad_l10_l0(double x, double y)
-    {
-      return   l10(x) * l0(y);
-    }
-
-    static double simple_quad_l10_l0x(double x, double y)
-    {
-      return   dl10(x) * l0(y);
-    }
-
-    static double simple_quad_l10_l0y(double x, double y)
-    {
-      return   l10(x) * dl0(y);
-    }
-
-    static double simple_quad_l10_l0xx(double x, double y)
-    {
-      return   d2l10(x) * l0(y);
-    }
-
-    static double simple_quad_l10_l0xy(double x, double y)
-    {
-      return   dl10(x) * dl0(y);
-    }
-
-    static double simple_quad_l10_l0yy(double x, double y)
-    {
-      return   l10(x) * d2l0(y);
-    }
-
-    static double simple_quad_l10_l1(double x, double y)
-    {
-      return   l10(x) * l1(y);
-    }
-
-    static double simple_quad_l10_l1x(double x, double y)
-    {
-      return   dl10(x) * l1(y);
-    }
-
-    static double simple_quad_l10_l1y(double x, double y)
-    {
-      return   l10(x) * dl1(y);
-    }
-
-    static double simple_quad_l10_l1xx(double x, double y)
-    {
-      return   d2l10(x) * l1(y);
-    }
-
-    static double simple_quad_l10_l1xy(double x, double y)
-    {
-      return   dl10(x) * dl1(y);
-    }
-
-    static double simple_quad_l10_l1yy(double x, double y)
-    {
-      return   l10(x) * d2l1(y);
-    }
-
-    static double simple_quad_l10_l2(double x, double y)
-    {
-      return   l10(x) * l2(y);
-    }
-
-    static double simple_quad_l10_l2x(double x, double y)
-    {
-      return   dl10(x) * l2(y);
-    }
-
-    static double simple_quad_l10_l2y(double x, double y)
-    {
-      return   l10(x) * dl2(y);
-    }
-
-    static double simple_quad_l10_l2xx(double x, double y)
-    {
-      return   d2l10(x) * l2(y);
-    }
-
-    static double simple_quad_l10_l2xy(double x, double y)
-    {
-      return   dl10(x) * dl2(y);
-    }
-
-    static double simple_quad_l10_l2yy(double x, double y)
-    {
-      return   l10(x) * d2l2(y);
-    }
-
-    static double simple_quad_l10_l3(double x, double y)
-    {
-      return   l10(x) * l3(y);
-    }
-
-    static double simple_quad_l10_l3x(double x, double y)
-    {
-      return   dl10(x) * l3(y);
-    }
-
-    static double simple_quad_l10_l3y(double x, double y)
-    {
-      return   l10(x) * dl3(y);
-    }
-
-    static double simple_quad_l10_l3xx(double x, double y)
-    {
-      return   d2l10(x) * l3(y);
-    }
-
-    static double simple_quad_l10_l3xy(double x, double y)
-    {
-      return   dl10(x) * dl3(y);
-    }
-
-    static double simple_quad_l10_l3yy(double x, double y)
-    {
-      return   l10(x) * d2l3(y);
-    }
-
-    static double simple_quad_l10_l4(double x, double y)
-    {
-      return   l10(x) * l4(y);
-    }
-
-    static double simple_quad_l10_l4x(double x, double y)
-    {
-      return   dl10(x) * l4(y);
-    }
-
-    static double simple_quad_l10_l4y(double x, double y)
-    {
-      return   l10(x) * dl4(y);
-    }
-
-    static double simple_quad_l10_l4xx(double x, double y)
-    {
-      return   d2l10(x) * l4(y);
-    }
-
-    static double simple_quad_l10_l4xy(double x, double y)
-    {
-      return   dl10(x) * dl4(y);
-    }
-
-    static double simple_quad_l10_l4yy(double x, double y)
-    {
-      return   l10(x) * d2l4(y);
-    }
-
-    static double simple_quad_l10_l5(double x, double y)
-    {
-      return   l10(x) * l5(y);
-    }
-
-    static double simple_quad_l10_l5x(double x, double y)
-    {
-      return   dl10(x) * l5(y);
-    }
-
-    static double simple_quad_l10_l5y(double x, double y)
-    {
-      return   l10(x) * dl5(y);
-    }
-
-    static double simple_quad_l10_l5xx(double x, double y)
-    {
-      return   d2l10(x) * l5(y);
-    }
-
-    static double simple_quad_l10_l5xy(double x, double y)
-    {
-      return   dl10(x) * dl5(y);
-    }
-
-    static double simple_quad_l10_l5yy(double x, double y)
-    {
-      return   l10(x) * d2l5(y);
-    }
-
-    static double simple_quad_l10_l6(double x, double y)
-    {
-      return   l10(x) * l6(y);
-    }
-
-    static double simple_quad_l10_l6x(double x, double y)
-    {
-      return   dl10(x) * l6(y);
-    }
-
-    static double simple_quad_l10_l6y(double x, double y)
-    {
-      return   l10(x) * dl6(y);
-    }
-
-    static double simple_quad_l10_l6xx(double x, double y)
-    {
-      return   d2l10(x) * l6(y);
-    }
-
-    static double simple_quad_l10_l6xy(double x, double y)
-    {
-      return   dl10(x) * dl6(y);
-    }
-
-    static double simple_quad_l10_l6yy(double x, double y)
-    {
-      return   l10(x) * d2l6(y);
-    }
-
-    static double simple_quad_l10_l7(double x, double y)
-    {
-      return   l10(x) * l7(y);
-    }
-
-    static double simple_quad_l10_l7x(double x, double y)
-    {
-      return   dl10(x) * l7(y);
-    }
-
-    static double simple_quad_l10_l7y(double x, double y)
-    {
-      return   l10(x) * dl7(y);
-    }
-
-    static double simple_quad_l10_l7xx(double x, double y)
-    {
-      return   d2l10(x) * l7(y);
-    }
-
-    static double simple_quad_l10_l7xy(double x, double y)
-    {
-      return   dl10(x) * dl7(y);
-    }
-
-    static double simple_quad_l10_l7yy(double x, double y)
-    {
-      return   l10(x) * d2l7(y);
-    }
-
-    static double simple_quad_l10_l8(double x, double y)
-    {
-      return   l10(x) * l8(y);
-    }
-
-    static double simple_quad_l10_l8x(double x, double y)
-    {
-      return   dl10(x) * l8(y);
-    }
-
-    static double simple_quad_l10_l8y(double x, double y)
-    {
-      return   l10(x) * dl8(y);
-    }
-
-    static double simple_quad_l10_l8xx(double x, double y)
-    {
-      return   d2l10(x) * l8(y);
-    }
-
-    static double simple_quad_l10_l8xy(double x, double y)
-    {
-      return   dl10(x) * dl8(y);
-    }
-
-    static double simple_quad_l10_l8yy(double x, double y)
-    {
-      return   l10(x) * d2l8(y);
-    }
-
-    static double simple_quad_l10_l9(double x, double y)
-    {
-      return   l10(x) * l9(y);
-    }
-
-    static double simple_quad_l10_l9x(double x, double y)
-    {
-      return   dl10(x) * l9(y);
-    }
-
-    static double simple_quad_l10_l9y(double x, double y)
-    {
-      return   l10(x) * dl9(y);
-    }
-
-    static double simple_quad_l10_l9xx(double x, double y)
-    {
-      return   d2l10(x) * l9(y);
-    }
-
-    static double simple_quad_l10_l9xy(double x, double y)
-    {
-      return   dl10(x) * dl9(y);
-    }
-
-    static double simple_quad_l10_l9yy(double x, double y)
-    {
-      return   l10(x) * d2l9(y);
-    }
-
-    static double simple_quad_l10_l10(double x, double y)
-    {
-      return   l10(x) * l10(y);
-    }
-
-    static double simple_quad_l10_l10x(double x, double y)
-    {
-      return   dl10(x) * l10(y);
-    }
-
-    static double simple_quad_l10_l10y(double x, double y)
-    {
-      return   l10(x) * dl10(y);
-    }
-
-    static double simple_quad_l10_l10xx(double x, double y)
-    {
-      return   d2l10(x) * l10(y);
-    }
-
-    static double simple_quad_l10_l10xy(double x, double y)
-    {
-      return   dl10(x) * dl10(y);
-    }
-
-    static double simple_quad_l10_l10yy(double x, double y)
-    {
-      return   l10(x) * d2l10(y);
-    }
-
-    static Shapeset::shape_fn_t simple_quad_fn[] =
-    {
-      simple_quad_l0_l0,   simple_quad_l0_l1,   simple_quad_l0_l2,   simple_quad_l0_l3_0, simple_quad_l0_l3_1,
-      simple_quad_l0_l4,   simple_quad_l0_l5_0, simple_quad_l0_l5_1, simple_quad_l0_l6,   simple_quad_l0_l7_0,
-      simple_quad_l0_l7_1, simple_quad_l0_l8,   simple_quad_l0_l9_0, simple_quad_l0_l9_1, simple_quad_l0_l10,
-      simple_quad_l1_l0,   simple_quad_l1_l1,   simple_quad_l1_l2,   simple_quad_l1_l3_0, simple_quad_l1_l3_1,
-      simple_quad_l1_l4,   simple_quad_l1_l5_0, simple_quad_l1_l5_1, simple_quad_l1_l6,   simple_quad_l1_l7_0,
-      simple_quad_l1_l7_1, simple_quad_l1_l8,   simple_quad_l1_l9_0, simple_quad_l1_l9_1, simple_quad_l1_l10,
-      simple_quad_l2_l0,   simple_quad_l2_l1,   simple_quad_l2_l2,   simple_quad_l2_l3,   simple_quad_l2_l4,
-      simple_quad_l2_l5,   simple_quad_l2_l6,   simple_quad_l2_l7,   simple_quad_l2_l8,   simple_quad_l2_l9,
-      simple_quad_l2_l10,   simple_quad_l3_l0_0, simple_quad_l3_l0_1, simple_quad_l3_l1_0, simple_quad_l3_l1_1,
-      simple_quad_l3_l2,   simple_quad_l3_l3,   simple_quad_l3_l4,   simple_quad_l3_l5,   simple_quad_l3_l6,
-      simple_quad_l3_l7,   simple_quad_l3_l8,   simple_quad_l3_l9,   simple_quad_l3_l10,   simple_quad_l4_l0,
-      simple_quad_l4_l1,   simple_quad_l4_l2,   simple_quad_l4_l3,   simple_quad_l4_l4,   simple_quad_l4_l5,
-      simple_quad_l4_l6,   simple_quad_l4_l7,   simple_quad_l4_l8,   simple_quad_l4_l9,   simple_quad_l4_l10,
-      simple_quad_l5_l0_0, simple_quad_l5_l0_1, simple_quad_l5_l1_0, simple_quad_l5_l1_1, simple_quad_l5_l2,
-      simple_quad_l5_l3,   simple_quad_l5_l4,   simple_quad_l5_l5,   simple_quad_l5_l6,   simple_quad_l5_l7,
-      simple_quad_l5_l8,   simple_quad_l5_l9,   simple_quad_l5_l10,   simple_quad_l6_l0,   simple_quad_l6_l1,
-      simple_quad_l6_l2,   simple_quad_l6_l3,   simple_quad_l6_l4,   simple_quad_l6_l5,   simple_quad_l6_l6,
-      simple_quad_l6_l7,   simple_quad_l6_l8,   simple_quad_l6_l9,   simple_quad_l6_l10,   simple_quad_l7_l0_0,
-      simple_quad_l7_l0_1, simple_quad_l7_l1_0, simple_quad_l7_l1_1, simple_quad_l7_l2,   simple_quad_l7_l3,
-      simple_quad_l7_l4,   simple_quad_l7_l5,   simple_quad_l7_l6,   simple_quad_l7_l7,   simple_quad_l7_l8,
-      simple_quad_l7_l9,   simple_quad_l7_l10,   simple_quad_l8_l0,   simple_quad_l8_l1,   simple_quad_l8_l2,
-      simple_quad_l8_l3,   simple_quad_l8_l4,   simple_quad_l8_l5,   simple_quad_l8_l6,   simple_quad_l8_l7,
-      simple_quad_l8_l8,   simple_quad_l8_l9,   simple_quad_l8_l10,   simple_quad_l9_l0_0, simple_quad_l9_l0_1,
-      simple_quad_l9_l1_0, simple_quad_l9_l1_1, simple_quad_l9_l2,   simple_quad_l9_l3,   simple_quad_l9_l4,
-      simple_quad_l9_l5,   simple_quad_l9_l6,   simple_quad_l9_l7,   simple_quad_l9_l8,   simple_quad_l9_l9,
-      simple_quad_l9_l10,   simple_quad_l10_l0,   simple_quad_l10_l1,   simple_quad_l10_l2,   simple_quad_l10_l3,
-      simple_quad_l10_l4,   simple_quad_l10_l5,   simple_quad_l10_l6,   simple_quad_l10_l7,   simple_quad_l10_l8,
-      simple_quad_l10_l9,   simple_quad_l10_l10,
-    };
-    static Shapeset::shape_fn_t simple_quad_fn_dx[] =
-    {
-      simple_quad_l0_l0x,   simple_quad_l0_l1x,   simple_quad_l0_l2x,   simple_quad_l0_l3x_0, simple_quad_l0_l3x_1,
-      simple_quad_l0_l4x,   simple_quad_l0_l5x_0, simple_quad_l0_l5x_1, simple_quad_l0_l6x,   simple_quad_l0_l7x_0,
-      simple_quad_l0_l7x_1, simple_quad_l0_l8x,   simple_quad_l0_l9x_0, simple_quad_l0_l9x_1, simple_quad_l0_l10x,
-      simple_quad_l1_l0x,   simple_quad_l1_l1x,   simple_quad_l1_l2x,   simple_quad_l1_l3x_0, simple_quad_l1_l3x_1,
-      simple_quad_l1_l4x,   simple_quad_l1_l5x_0, simple_quad_l1_l5x_1, simple_quad_l1_l6x,   simple_quad_l1_l7x_0,
-      simple_quad_l1_l7x_1, simple_quad_l1_l8x,   simple_quad_l1_l9x_0, simple_quad_l1_l9x_1, simple_quad_l1_l10x,
-      simple_quad_l2_l0x,   simple_quad_l2_l1x,   simple_quad_l2_l2x,   simple_quad_l2_l3x,   simple_quad_l2_l4x,
-      simple_quad_l2_l5x,   simple_quad_l2_l6x,   simple_quad_l2_l7x,   simple_quad_l2_l8x,   simple_quad_l2_l9x,
-      simple_quad_l2_l10x,   simple_quad_l3_l0x_0, simple_quad_l3_l0x_1, simple_quad_l3_l1x_0, simple_quad_l3_l1x_1,
-      simple_quad_l3_l2x,   simple_quad_l3_l3x,   simple_quad_l3_l4x,   simple_quad_l3_l5x,   simple_quad_l3_l6x,
-      simple_quad_l3_l7x,   simple_quad_l3_l8x,   simple_quad_l3_l9x,   simple_quad_l3_l10x,   simple_quad_l4_l0x,
-      simple_quad_l4_l1x,   simple_quad_l4_l2x,   simple_quad_l4_l3x,   simple_quad_l4_l4x,   simple_quad_l4_l5x,
-      simple_quad_l4_l6x,   simple_quad_l4_l7x,   simple_quad_l4_l8x,   simple_quad_l4_l9x,   simple_quad_l4_l10x,
-      simple_quad_l5_l0x_0, simple_quad_l5_l0x_1, simple_quad_l5_l1x_0, simple_quad_l5_l1x_1, simple_quad_l5_l2x,
-      simple_quad_l5_l3x,   simple_quad_l5_l4x,   simple_quad_l5_l5x,   simple_quad_l5_l6x,   simple_quad_l5_l7x,
-      simple_quad_l5_l8x,   simple_quad_l5_l9x,   simple_quad_l5_l10x,   simple_quad_l6_l0x,   simple_quad_l6_l1x,
-      simple_quad_l6_l2x,   simple_quad_l6_l3x,   simple_quad_l6_l4x,   simple_quad_l6_l5x,   simple_quad_l6_l6x,
-      simple_quad_l6_l7x,   simple_quad_l6_l8x,   simple_quad_l6_l9x,   simple_quad_l6_l10x,   simple_quad_l7_l0x_0,
-      simple_quad_l7_l0x_1, simple_quad_l7_l1x_0, simple_quad_l7_l1x_1, simple_quad_l7_l2x,   simple_quad_l7_l3x,
-      simple_quad_l7_l4x,   simple_quad_l7_l5x,   simple_quad_l7_l6x,   simple_quad_l7_l7x,   simple_quad_l7_l8x,
-      simple_quad_l7_l9x,   simple_quad_l7_l10x,   simple_quad_l8_l0x,   simple_quad_l8_l1x,   simple_quad_l8_l2x,
-      simple_quad_l8_l3x,   simple_quad_l8_l4x,   simple_quad_l8_l5x,   simple_quad_l8_l6x,   simple_quad_l8_l7x,
-      simple_quad_l8_l8x,   simple_quad_l8_l9x,   simple_quad_l8_l10x,   simple_quad_l9_l0x_0, simple_quad_l9_l0x_1,
-      simple_quad_l9_l1x_0, simple_quad_l9_l1x_1, simple_quad_l9_l2x,   simple_quad_l9_l3x,   simple_quad_l9_l4x,
-      simple_quad_l9_l5x,   simple_quad_l9_l6x,   simple_quad_l9_l7x,   simple_quad_l9_l8x,   simple_quad_l9_l9x,
-      simple_quad_l9_l10x,   simple_quad_l10_l0x,   simple_quad_l10_l1x,   simple_quad_l10_l2x,   simple_quad_l10_l3x,
-      simple_quad_l10_l4x,   simple_quad_l10_l5x,   simple_quad_l10_l6x,   simple_quad_l10_l7x,   simple_quad_l10_l8x,
-      simple_quad_l10_l9x,   simple_quad_l10_l10x,
-    };
-    static Shapeset::shape_fn_t simple_quad_fn_dy[] =
-    {
-      simple_quad_l0_l0y,   simple_quad_l0_l1y,   simple_quad_l0_l2y,   simple_quad_l0_l3y_0, simple_quad_l0_l3y_1,
-      simple_quad_l0_l4y,   simple_quad_l0_l5y_0, simple_quad_l0_l5y_1, simple_quad_l0_l6y,   simple_quad_l0_l7y_0,
-      simple_quad_l0_l7y_1, simple_quad_l0_l8y,   simple_quad_l0_l9y_0, simple_quad_l0_l9y_1, simple_quad_l0_l10y,
-      simple_quad_l1_l0y,   simple_quad_l1_l1y,   simple_quad_l1_l2y,   simple_quad_l1_l3y_0, simple_quad_l1_l3y_1,
-      simple_quad_l1_l4y,   simple_quad_l1_l5y_0, simple_quad_l1_l5y_1, simple_quad_l1_l6y,   simple_quad_l1_l7y_0,
-      simple_quad_l1_l7y_1, simple_quad_l1_l8y,   simple_quad_l1_l9y_0, simple_quad_l1_l9y_1, simple_quad_l1_l10y,
-      simple_quad_l2_l0y,   simple_quad_l2_l1y,   simple_quad_l2_l2y,   simple_quad_l2_l3y,   simple_quad_l2_l4y,
-      simple_quad_l2_l5y,   simple_quad_l2_l6y,   simple_quad_l2_l7y,   simple_quad_l2_l8y,   simple_quad_l2_l9y,
-      simple_quad_l2_l10y,   simple_quad_l3_l0y_0, simple_quad_l3_l0y_1, simple_quad_l3_l1y_0, simple_quad_l3_l1y_1,
-      simple_quad_l3_l2y,   simple_quad_l3_l3y,   simple_quad_l3_l4y,   simple_quad_l3_l5y,   simple_quad_l3_l6y,
-      simple_quad_l3_l7y,   simple_quad_l3_l8y,   simple_quad_l3_l9y,   simple_quad_l3_l10y,   simple_quad_l4_l0y,
-      simple_quad_l4_l1y,   simple_quad_l4_l2y,   simple_quad_l4_l3y,   simple_quad_l4_l4y,   simple_quad_l4_l5y,
-      simple_quad_l4_l6y,   simple_quad_l4_l7y,   simple_quad_l4_l8y,   simple_quad_l4_l9y,   simple_quad_l4_l10y,
-      simple_quad_l5_l0y_0, simple_quad_l5_l0y_1, simple_quad_l5_l1y_0, simple_quad_l5_l1y_1, simple_quad_l5_l2y,
-      simple_quad_l5_l3y,   simple_quad_l5_l4y,   simple_quad_l5_l5y,   simple_quad_l5_l6y,   simple_quad_l5_l7y,
-      simple_quad_l5_l8y,   simple_quad_l5_l9y,   simple_quad_l5_l10y,   simple_quad_l6_l0y,   simple_quad_l6_l1y,
-      simple_quad_l6_l2y,   simple_quad_l6_l3y,   simple_quad_l6_l4y,   simple_quad_l6_l5y,   simple_quad_l6_l6y,
-      simple_quad_l6_l7y,   simple_quad_l6_l8y,   simple_quad_l6_l9y,   simple_quad_l6_l10y,   simple_quad_l7_l0y_0,
-      simple_quad_l7_l0y_1, simple_quad_l7_l1y_0, simple_quad_l7_l1y_1, simple_quad_l7_l2y,   simple_quad_l7_l3y,
-      simple_quad_l7_l4y,   simple_quad_l7_l5y,   simple_quad_l7_l6y,   simple_quad_l7_l7y,   simple_quad_l7_l8y,
-      simple_quad_l7_l9y,   simple_quad_l7_l10y,   simple_quad_l8_l0y,   simple_quad_l8_l1y,   simple_quad_l8_l2y,
-      simple_quad_l8_l3y,   simple_quad_l8_l4y,   simple_quad_l8_l5y,   simple_quad_l8_l6y,   simple_quad_l8_l7y,
-      simple_quad_l8_l8y,   simple_quad_l8_l9y,   simple_quad_l8_l10y,   simple_quad_l9_l0y_0, simple_quad_l9_l0y_1,
-      simple_quad_l9_l1y_0, simple_quad_l9_l1y_1, simple_quad_l9_l2y,   simple_quad_l9_l3y,   simple_quad_l9_l4y,
-      simple_quad_l9_l5y,   simple_quad_l9_l6y,   simple_quad_l9_l7y,   simple_quad_l9_l8y,   simple_quad_l9_l9y,
-      simple_quad_l9_l10y,   simple_quad_l10_l0y,   simple_quad_l10_l1y,   simple_quad_l10_l2y,   simple_quad_l10_l3y,
-      simple_quad_l10_l4y,   simple_quad_l10_l5y,   simple_quad_l10_l6y,   simple_quad_l10_l7y,   simple_quad_l10_l8y,
-      simple_quad_l10_l9y,   simple_quad_l10_l10y,
-    };
-    static Shapeset::shape_fn_t simple_quad_fn_dxx[] =
-    {
-      simple_quad_l0_l0xx,   simple_quad_l0_l1xx,   simple_quad_l0_l2xx,   simple_quad_l0_l3xx_0, simple_quad_l0_l3xx_1,
-      simple_quad_l0_l4xx,   simple_quad_l0_l5xx_0, simple_quad_l0_l5xx_1, simple_quad_l0_l6xx,   simple_quad_l0_l7xx_0,
-      simple_quad_l0_l7xx_1, simple_quad_l0_l8xx,   simple_quad_l0_l9xx_0, simple_quad_l0_l9xx_1, simple_quad_l0_l10xx,
-      simple_quad_l1_l0xx,   simple_quad_l1_l1xx,   simple_quad_l1_l2xx,   simple_quad_l1_l3xx_0, simple_quad_l1_l3xx_1,
-      simple_quad_l1_l4xx,   simple_quad_l1_l5xx_0, simple_quad_l1_l5xx_1, simple_quad_l1_l6xx,   simple_quad_l1_l7xx_0,
-      simple_quad_l1_l7xx_1, simple_quad_l1_l8xx,   simple_quad_l1_l9xx_0, simple_quad_l1_l9xx_1, simple_quad_l1_l10xx,
-      simple_quad_l2_l0xx,   simple_quad_l2_l1xx,   simple_quad_l2_l2xx,   simple_quad_l2_l3xx,   simple_quad_l2_l4xx,
-      simple_quad_l2_l5xx,   simple_quad_l2_l6xx,   simple_quad_l2_l7xx,   simple_quad_l2_l8xx,   simple_quad_l2_l9xx,
-      simple_quad_l2_l10xx,   simple_quad_l3_l0xx_0, simple_quad_l3_l0xx_1, simple_quad_l3_l1xx_0, simple_quad_l3_l1xx_1,
-      simple_quad_l3_l2xx,   simple_quad_l3_l3xx,   simple_quad_l3_l4xx,   simple_quad_l3_l5xx,   simple_quad_l3_l6xx,
-      simple_quad_l3_l7xx,   simple_quad_l3_l8xx,   simple_quad_l3_l9xx,   simple_quad_l3_l10xx,   simple_quad_l4_l0xx,
-      simple_quad_l4_l1xx,   simple_quad_l4_l2xx,   simple_quad_l4_l3xx,   simple_quad_l4_l4xx,   simple_quad_l4_l5xx,
-      simple_quad_l4_l6xx,   simple_quad_l4_l7xx,   simple_quad_l4_l8xx,   simple_quad_l4_l9xx,   simple_quad_l4_l10xx,
-      simple_quad_l5_l0xx_0, simple_quad_l5_l0xx_1, simple_quad_l5_l1xx_0, simple_quad_l5_l1xx_1, simple_quad_l5_l2xx,
-      simple_quad_l5_l3xx,   simple_quad_l5_l4xx,   simple_quad_l5_l5xx,   simple_quad_l5_l6xx,   simple_quad_l5_l7xx,
-      simple_quad_l5_l8xx,   simple_quad_l5_l9xx,   simple_quad_l5_l10xx,   simple_quad_l6_l0xx,   simple_quad_l6_l1xx,
-      simple_quad_l6_l2xx,   simple_quad_l6_l3xx,   simple_quad_l6_l4xx,   simple_quad_l6_l5xx,   simple_quad_l6_l6xx,
-      simple_quad_l6_l7xx,   simple_quad_l6_l8xx,   simple_quad_l6_l9xx,   simple_quad_l6_l10xx,   simple_quad_l7_l0xx_0,
-      simple_quad_l7_l0xx_1, simple_quad_l7_l1xx_0, simple_quad_l7_l1xx_1, simple_quad_l7_l2xx,   simple_quad_l7_l3xx,
-      simple_quad_l7_l4xx,   simple_quad_l7_l5xx,   simple_quad_l7_l6xx,   simple_quad_l7_l7xx,   simple_quad_l7_l8xx,
-      simple_quad_l7_l9xx,   simple_quad_l7_l10xx,   simple_quad_l8_l0xx,   simple_quad_l8_l1xx,   simple_quad_l8_l2xx,
-      simple_quad_l8_l3xx,   simple_quad_l8_l4xx,   simple_quad_l8_l5xx,   simple_quad_l8_l6xx,   simple_quad_l8_l7xx,
-      simple_quad_l8_l8xx,   simple_quad_l8_l9xx,   simple_quad_l8_l10xx,   simple_quad_l9_l0xx_0, simple_quad_l9_l0xx_1,
-      simple_quad_l9_l1xx_0, simple_quad_l9_l1xx_1, simple_quad_l9_l2xx,   simple_quad_l9_l3xx,   simple_quad_l9_l4xx,
-      simple_quad_l9_l5xx,   simple_quad_l9_l6xx,   simple_quad_l9_l7xx,   simple_quad_l9_l8xx,   simple_quad_l9_l9xx,
-      simple_quad_l9_l10xx,   simple_quad_l10_l0xx,   simple_quad_l10_l1xx,   simple_quad_l10_l2xx,   simple_quad_l10_l3xx,
-      simple_quad_l10_l4xx,   simple_quad_l10_l5xx,   simple_quad_l10_l6xx,   simple_quad_l10_l7xx,   simple_quad_l10_l8xx,
-      simple_quad_l10_l9xx,   simple_quad_l10_l10xx,
-    };
-    static Shapeset::shape_fn_t simple_quad_fn_dxy[] =
-    {
-      simple_quad_l0_l0xy,   simple_quad_l0_l1xy,   simple_quad_l0_l2xy,   simple_quad_l0_l3xy_0, simple_quad_l0_l3xy_1,
-      simple_quad_l0_l4xy,   simple_quad_l0_l5xy_0, simple_quad_l0_l5xy_1, simple_quad_l0_l6xy,   simple_quad_l0_l7xy_0,
-      simple_quad_l0_l7xy_1, simple_quad_l0_l8xy,   simple_quad_l0_l9xy_0, simple_quad_l0_l9xy_1, simple_quad_l0_l10xy,
-      simple_quad_l1_l0xy,   simple_quad_l1_l1xy,   simple_quad_l1_l2xy,   simple_quad_l1_l3xy_0, simple_quad_l1_l3xy_1,
-      simple_quad_l1_l4xy,   simple_quad_l1_l5xy_0, simple_quad_l1_l5xy_1, simple_quad_l1_l6xy,   simple_quad_l1_l7xy_0,
-      simple_quad_l1_l7xy_1, simple_quad_l1_l8xy,   simple_quad_l1_l9xy_0, simple_quad_l1_l9xy_1, simple_quad_l1_l10xy,
-      simple_quad_l2_l0xy,   simple_quad_l2_l1xy,   simple_quad_l2_l2xy,   simple_quad_l2_l3xy,   simple_quad_l2_l4xy,
-      simple_quad_l2_l5xy,   simple_quad_l2_l6xy,   simple_quad_l2_l7xy,   simple_quad_l2_l8xy,   simple_quad_l2_l9xy,
-      simple_quad_l2_l10xy,   simple_quad_l3_l0xy_0, simple_quad_l3_l0xy_1, simple_quad_l3_l1xy_0, simple_quad_l3_l1xy_1,
-      simple_quad_l3_l2xy,   simple_quad_l3_l3xy,   simple_quad_l3_l4xy,   simple_quad_l3_l5xy,   simple_quad_l3_l6xy,
-      simple_quad_l3_l7xy,   simple_quad_l3_l8xy,   simple_quad_l3_l9xy,   simple_quad_l3_l10xy,   simple_quad_l4_l0xy,
-      simple_quad_l4_l1xy,   simple_quad_l4_l2xy,   simple_quad_l4_l3xy,   simple_quad_l4_l4xy,   simple_quad_l4_l5xy,
-      simple_quad_l4_l6xy,   simple_quad_l4_l7xy,   simple_quad_l4_l8xy,   simple_quad_l4_l9xy,   simple_quad_l4_l10xy,
-      simple_quad_l5_l0xy_0, simple_quad_l5_l0xy_1, simple_quad_l5_l1xy_0, simple_quad_l5_l1xy_1, simple_quad_l5_l2xy,
-      simple_quad_l5_l3xy,   simple_quad_l5_l4xy,   simple_quad_l5_l5xy,   simple_quad_l5_l6xy,   simple_quad_l5_l7xy,
-      simple_quad_l5_l8xy,   simple_quad_l5_l9xy,   simple_quad_l5_l10xy,   simple_quad_l6_l0xy,   simple_quad_l6_l1xy,
-      simple_quad_l6_l2xy,   simple_quad_l6_l3xy,   simple_quad_l6_l4xy,   simple_quad_l6_l5xy,   simple_quad_l6_l6xy,
-      simple_quad_l6_l7xy,   simple_quad_l6_l8xy,   simple_quad_l6_l9xy,   simple_quad_l6_l10xy,   simple_quad_l7_l0xy_0,
-      simple_quad_l7_l0xy_1, simple_quad_l7_l1xy_0, simple_quad_l7_l1xy_1, simple_quad_l7_l2xy,   simple_quad_l7_l3xy,
-      simple_quad_l7_l4xy,   simple_quad_l7_l5xy,   simple_quad_l7_l6xy,   simple_quad_l7_l7xy,   simple_quad_l7_l8xy,
-      simple_quad_l7_l9xy,   simple_quad_l7_l10xy,   simple_quad_l8_l0xy,   simple_quad_l8_l1xy,   simple_quad_l8_l2xy,
-      simple_quad_l8_l3xy,   simple_quad_l8_l4xy,   simple_quad_l8_l5xy,   simple_quad_l8_l6xy,   simple_quad_l8_l7xy,
-      simple_quad_l8_l8xy,   simple_quad_l8_l9xy,   simple_quad_l8_l10xy,   simple_quad_l9_l0xy_0, simple_quad_l9_l0xy_1,
-      simple_quad_l9_l1xy_0, simple_quad_l9_l1xy_1, simple_quad_l9_l2xy,   simple_quad_l9_l3xy,   simple_quad_l9_l4xy,
-      simple_quad_l9_l5xy,   simple_quad_l9_l6xy,   simple_quad_l9_l7xy,   simple_quad_l9_l8xy,   simple_quad_l9_l9xy,
-      simple_quad_l9_l10xy,   simple_quad_l10_l0xy,   simple_quad_l10_l1xy,   simple_quad_l10_l2xy,   simple_quad_l10_l3xy,
-      simple_quad_l10_l4xy,   simple_quad_l10_l5xy,   simple_quad_l10_l6xy,   simple_quad_l10_l7xy,   simple_quad_l10_l8xy,
-      simple_quad_l10_l9xy,   simple_quad_l10_l10xy,
-    };
-    static Shapeset::shape_fn_t simple_quad_fn_dyy[] =
-    {
-      simple_quad_l0_l0yy,   simple_quad_l0_l1yy,   simple_quad_l0_l2yy,   simple_quad_l0_l3yy_0, simple_quad_l0_l3yy_1,
-      simple_quad_l0_l4yy,   simple_quad_l0_l5yy_0, simple_quad_l0_l5yy_1, simple_quad_l0_l6yy,   simple_quad_l0_l7yy_0,
-      simple_quad_l0_l7yy_1, simple_quad_l0_l8yy,   simple_quad_l0_l9yy_0, simple_quad_l0_l9yy_1, simple_quad_l0_l10yy,
-      simple_quad_l1_l0yy,   simple_quad_l1_l1yy,   simple_quad_l1_l2yy,   simple_quad_l1_l3yy_0, simple_quad_l1_l3yy_1,
-      simple_quad_l1_l4yy,   simple_quad_l1_l5yy_0, simple_quad_l1_l5yy_1, simple_quad_l1_l6yy,   simple_quad_l1_l7yy_0,
-      simple_quad_l1_l7yy_1, simple_quad_l1_l8yy,   simple_quad_l1_l9yy_0, simple_quad_l1_l9yy_1, simple_quad_l1_l10yy,
-      simple_quad_l2_l0yy,   simple_quad_l2_l1yy,   simple_quad_l2_l2yy,   simple_quad_l2_l3yy,   simple_quad_l2_l4yy,
-      simple_quad_l2_l5yy,   simple_quad_l2_l6yy,   simple_quad_l2_l7yy,   simple_quad_l2_l8yy,   simple_quad_l2_l9yy,
-      simple_quad_l2_l10yy,   simple_quad_l3_l0yy_0, simple_quad_l3_l0yy_1, simple_quad_l3_l1yy_0, simple_quad_l3_l1yy_1,
-      simple_quad_l3_l2yy,   simple_quad_l3_l3yy,   simple_quad_l3_l4yy,   simple_quad_l3_l5yy,   simple_quad_l3_l6yy,
-      simple_quad_l3_l7yy,   simple_quad_l3_l8yy,   simple_quad_l3_l9yy,   simple_quad_l3_l10yy,   simple_quad_l4_l0yy,
-      simple_quad_l4_l1yy,   simple_quad_l4_l2yy,   simple_quad_l4_l3yy,   simple_quad_l4_l4yy,   simple_quad_l4_l5yy,
-      simple_quad_l4_l6yy,   simple_quad_l4_l7yy,   simple_quad_l4_l8yy,   simple_quad_l4_l9yy,   simple_quad_l4_l10yy,
-      simple_quad_l5_l0yy_0, simple_quad_l5_l0yy_1, simple_quad_l5_l1yy_0, simple_quad_l5_l1yy_1, simple_quad_l5_l2yy,
-      simple_quad_l5_l3yy,   simple_quad_l5_l4yy,   simple_quad_l5_l5yy,   simple_quad_l5_l6yy,   simple_quad_l5_l7yy,
-      simple_quad_l5_l8yy,   simple_quad_l5_l9yy,   simple_quad_l5_l10yy,   simple_quad_l6_l0yy,   simple_quad_l6_l1yy,
-      simple_quad_l6_l2yy,   simple_quad_l6_l3yy,   simple_quad_l6_l4yy,   simple_quad_l6_l5yy,   simple_quad_l6_l6yy,
-      simple_quad_l6_l7yy,   simple_quad_l6_l8yy,   simple_quad_l6_l9yy,   simple_quad_l6_l10yy,   simple_quad_l7_l0yy_0,
-      simple_quad_l7_l0yy_1, simple_quad_l7_l1yy_0, simple_quad_l7_l1yy_1, simple_quad_l7_l2yy,   simple_quad_l7_l3yy,
-      simple_quad_l7_l4yy,   simple_quad_l7_l5yy,   simple_quad_l7_l6yy,   simple_quad_l7_l7yy,   simple_quad_l7_l8yy,
-      simple_quad_l7_l9yy,   simple_quad_l7_l10yy,   simple_quad_l8_l0yy,   simple_quad_l8_l1yy,   simple_quad_l8_l2yy,
-      simple_quad_l8_l3yy,   simple_quad_l8_l4yy,   simple_quad_l8_l5yy,   simple_quad_l8_l6yy,   simple_quad_l8_l7yy,
-      simple_quad_l8_l8yy,   simple_quad_l8_l9yy,   simple_quad_l8_l10yy,   simple_quad_l9_l0yy_0, simple_quad_l9_l0yy_1,
-      simple_quad_l9_l1yy_0, simple_quad_l9_l1yy_1, simple_quad_l9_l2yy,   simple_quad_l9_l3yy,   simple_quad_l9_l4yy,
-      simple_quad_l9_l5yy,   simple_quad_l9_l6yy,   simple_quad_l9_l7yy,   simple_quad_l9_l8yy,   simple_quad_l9_l9yy,
-      simple_quad_l9_l10yy,   simple_quad_l10_l0yy,   simple_quad_l10_l1yy,   simple_quad_l10_l2yy,   simple_quad_l10_l3yy,
-      simple_quad_l10_l4yy,   simple_quad_l10_l5yy,   simple_quad_l10_l6yy,   simple_quad_l10_l7yy,   simple_quad_l10_l8yy,
-      simple_quad_l10_l9yy,   simple_quad_l10_l10yy,
-    };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table[1]     = { simple_quad_fn };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table_dx[1]  = { simple_quad_fn_dx };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table_dy[1]  = { simple_quad_fn_dy };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table_dxx[1] = { simple_quad_fn_dxx };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table_dxy[1] = { simple_quad_fn_dxy };
-    Shapeset::shape_fn_t* simple_quad_shape_fn_table_dyy[1] = { simple_quad_fn_dyy };
 
     static int qb_2_2[] = { 32, };
     static int qb_2_3[] = { 32, 33, };
@@ -4473,5 +170,202 @@ namespace Hermes
       XX(9, 1),   XX(9, 1),   oo(9, 2),   oo(9, 3),   oo(9, 4),   oo(9, 5),   oo(9, 6),   oo(9, 7),   oo(9, 8),   oo(9, 9),   oo(9, 10),
       oo(10, 1),  oo(10, 1),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),
     };
+
+    // The shape functions, see Shapeset::PolynomialTable.
+
+    static const int simple_quad_start[] =
+    {
+      0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+      64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104, 108, 112, 116, 120, 124,
+      128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+      192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+      256, 260, 264, 268, 272, 276, 280, 284, 288, 292, 296, 300, 304, 308, 312, 316,
+      320, 324, 328, 332, 336, 340, 344, 348, 352, 356, 360, 364, 368, 372, 376, 380,
+      384, 388, 392, 396, 400, 404, 408, 412, 416, 420, 424, 428, 432, 436, 440, 444,
+      448, 452, 456, 460, 464, 468, 472, 476, 480, 484, 488, 492, 496, 500, 504, 508,
+      512, 516, 520, 524, 528, 532, 536, 540, 544, 548,
+    };
+
+    static const unsigned char simple_quad_degrees[] =
+    {
+      0x00, 0x01, 0x10, 0x11, 0x00, 0x01, 0x10, 0x11, 0x00, 0x02, 0x10, 0x12, 0x01, 0x03, 0x11, 0x13,
+      0x01, 0x03, 0x11, 0x13, 0x02, 0x04, 0x12, 0x14, 0x03, 0x05, 0x13, 0x15, 0x03, 0x05, 0x13, 0x15,
+      0x04, 0x06, 0x14, 0x16, 0x05, 0x07, 0x15, 0x17, 0x05, 0x07, 0x15, 0x17, 0x06, 0x08, 0x16, 0x18,
+      0x07, 0x09, 0x17, 0x19, 0x07, 0x09, 0x17, 0x19, 0x08, 0x0a, 0x18, 0x1a, 0x00, 0x01, 0x10, 0x11,
+      0x00, 0x01, 0x10, 0x11, 0x00, 0x02, 0x10, 0x12, 0x01, 0x03, 0x11, 0x13, 0x01, 0x03, 0x11, 0x13,
+      0x02, 0x04, 0x12, 0x14, 0x03, 0x05, 0x13, 0x15, 0x03, 0x05, 0x13, 0x15, 0x04, 0x06, 0x14, 0x16,
+      0x05, 0x07, 0x15, 0x17, 0x05, 0x07, 0x15, 0x17, 0x06, 0x08, 0x16, 0x18, 0x07, 0x09, 0x17, 0x19,
+      0x07, 0x09, 0x17, 0x19, 0x08, 0x0a, 0x18, 0x1a, 0x00, 0x01, 0x20, 0x21, 0x00, 0x01, 0x20, 0x21,
+      0x00, 0x02, 0x20, 0x22, 0x01, 0x03, 0x21, 0x23, 0x02, 0x04, 0x22, 0x24, 0x03, 0x05, 0x23, 0x25,
+      0x04, 0x06, 0x24, 0x26, 0x05, 0x07, 0x25, 0x27, 0x06, 0x08, 0x26, 0x28, 0x07, 0x09, 0x27, 0x29,
+      0x08, 0x0a, 0x28, 0x2a, 0x10, 0x11, 0x30, 0x31, 0x10, 0x11, 0x30, 0x31, 0x10, 0x11, 0x30, 0x31,
+      0x10, 0x11, 0x30, 0x31, 0x10, 0x12, 0x30, 0x32, 0x11, 0x13, 0x31, 0x33, 0x12, 0x14, 0x32, 0x34,
+      0x13, 0x15, 0x33, 0x35, 0x14, 0x16, 0x34, 0x36, 0x15, 0x17, 0x35, 0x37, 0x16, 0x18, 0x36, 0x38,
+      0x17, 0x19, 0x37, 0x39, 0x18, 0x1a, 0x38, 0x3a, 0x20, 0x21, 0x40, 0x41, 0x20, 0x21, 0x40, 0x41,
+      0x20, 0x22, 0x40, 0x42, 0x21, 0x23, 0x41, 0x43, 0x22, 0x24, 0x42, 0x44, 0x23, 0x25, 0x43, 0x45,
+      0x24, 0x26, 0x44, 0x46, 0x25, 0x27, 0x45, 0x47, 0x26, 0x28, 0x46, 0x48, 0x27, 0x29, 0x47, 0x49,
+      0x28, 0x2a, 0x48, 0x4a, 0x30, 0x31, 0x50, 0x51, 0x30, 0x31, 0x50, 0x51, 0x30, 0x31, 0x50, 0x51,
+      0x30, 0x31, 0x50, 0x51, 0x30, 0x32, 0x50, 0x52, 0x31, 0x33, 0x51, 0x53, 0x32, 0x34, 0x52, 0x54,
+      0x33, 0x35, 0x53, 0x55, 0x34, 0x36, 0x54, 0x56, 0x35, 0x37, 0x55, 0x57, 0x36, 0x38, 0x56, 0x58,
+      0x37, 0x39, 0x57, 0x59, 0x38, 0x3a, 0x58, 0x5a, 0x40, 0x41, 0x60, 0x61, 0x40, 0x41, 0x60, 0x61,
+      0x40, 0x42, 0x60, 0x62, 0x41, 0x43, 0x61, 0x63, 0x42, 0x44, 0x62, 0x64, 0x43, 0x45, 0x63, 0x65,
+      0x44, 0x46, 0x64, 0x66, 0x45, 0x47, 0x65, 0x67, 0x46, 0x48, 0x66, 0x68, 0x47, 0x49, 0x67, 0x69,
+      0x48, 0x4a, 0x68, 0x6a, 0x50, 0x51, 0x70, 0x71, 0x50, 0x51, 0x70, 0x71, 0x50, 0x51, 0x70, 0x71,
+      0x50, 0x51, 0x70, 0x71, 0x50, 0x52, 0x70, 0x72, 0x51, 0x53, 0x71, 0x73, 0x52, 0x54, 0x72, 0x74,
+      0x53, 0x55, 0x73, 0x75, 0x54, 0x56, 0x74, 0x76, 0x55, 0x57, 0x75, 0x77, 0x56, 0x58, 0x76, 0x78,
+      0x57, 0x59, 0x77, 0x79, 0x58, 0x5a, 0x78, 0x7a, 0x60, 0x61, 0x80, 0x81, 0x60, 0x61, 0x80, 0x81,
+      0x60, 0x62, 0x80, 0x82, 0x61, 0x63, 0x81, 0x83, 0x62, 0x64, 0x82, 0x84, 0x63, 0x65, 0x83, 0x85,
+      0x64, 0x66, 0x84, 0x86, 0x65, 0x67, 0x85, 0x87, 0x66, 0x68, 0x86, 0x88, 0x67, 0x69, 0x87, 0x89,
+      0x68, 0x6a, 0x88, 0x8a, 0x70, 0x71, 0x90, 0x91, 0x70, 0x71, 0x90, 0x91, 0x70, 0x71, 0x90, 0x91,
+      0x70, 0x71, 0x90, 0x91, 0x70, 0x72, 0x90, 0x92, 0x71, 0x73, 0x91, 0x93, 0x72, 0x74, 0x92, 0x94,
+      0x73, 0x75, 0x93, 0x95, 0x74, 0x76, 0x94, 0x96, 0x75, 0x77, 0x95, 0x97, 0x76, 0x78, 0x96, 0x98,
+      0x77, 0x79, 0x97, 0x99, 0x78, 0x7a, 0x98, 0x9a, 0x80, 0x81, 0xa0, 0xa1, 0x80, 0x81, 0xa0, 0xa1,
+      0x80, 0x82, 0xa0, 0xa2, 0x81, 0x83, 0xa1, 0xa3, 0x82, 0x84, 0xa2, 0xa4, 0x83, 0x85, 0xa3, 0xa5,
+      0x84, 0x86, 0xa4, 0xa6, 0x85, 0x87, 0xa5, 0xa7, 0x86, 0x88, 0xa6, 0xa8, 0x87, 0x89, 0xa7, 0xa9,
+      0x88, 0x8a, 0xa8, 0xaa,
+    };
+
+    static const double simple_quad_coefs[] =
+    {
+      0.2500000000000001, -0.25000000000000006, -0.2500000000000004, 0.2500000000000003,
+      0.25000000000000006, 0.2500000000000001, -0.25000000000000033, -0.25000000000000033,
+      -0.20412414523193143, 0.20412414523193176, 0.20412414523193162, -0.20412414523193173,
+      0.15811388300841903, -0.15811388300841903, -0.1581138830084191, 0.15811388300841894,
+      -0.15811388300841903, 0.15811388300841903, 0.1581138830084191, -0.15811388300841894,
+      -0.13363062095621212, 0.1336306209562124, 0.1336306209562123, -0.13363062095621223,
+      0.11785113019775785, -0.11785113019775799, -0.11785113019775799, 0.11785113019775796,
+      -0.11785113019775785, 0.11785113019775799, 0.11785113019775799, -0.11785113019775796,
+      -0.1066003581778053, 0.10660035817780529, 0.10660035817780533, -0.10660035817780532,
+      0.09805806756909204, -0.09805806756909193, -0.09805806756909212, 0.09805806756909204,
+      -0.09805806756909204, 0.09805806756909193, 0.09805806756909212, -0.09805806756909204,
+      -0.09128709291752778, 0.09128709291752776, 0.09128709291752778, -0.09128709291752775,
+      0.08574929257125445, -0.08574929257125458, -0.08574929257125445, 0.08574929257125459,
+      -0.08574929257125445, 0.08574929257125458, 0.08574929257125445, -0.08574929257125459,
+      -0.08111071056538124, 0.0811107105653812, 0.0811107105653814, -0.08111071056538113,
+      0.25000000000000006, -0.25000000000000044, 0.2500000000000003, -0.25,
+      0.25000000000000006, 0.2500000000000005, 0.2500000000000002, 0.24999999999999997,
+      -0.20412414523193173, 0.20412414523193165, -0.20412414523193156, 0.20412414523193148,
+      -0.15811388300841892, 0.15811388300841872, -0.1581138830084189, 0.15811388300841925,
+      0.15811388300841892, -0.15811388300841872, 0.1581138830084189, -0.15811388300841925,
+      -0.13363062095621245, 0.1336306209562124, -0.13363062095621214, 0.13363062095621242,
+      -0.11785113019775796, 0.11785113019775782, -0.11785113019775803, 0.1178511301977581,
+      0.11785113019775796, -0.11785113019775782, 0.11785113019775803, -0.1178511301977581,
+      -0.10660035817780533, 0.10660035817780537, -0.1066003581778052, 0.1066003581778051,
+      -0.09805806756909213, 0.09805806756909186, -0.09805806756909215, 0.09805806756909191,
+      0.09805806756909213, -0.09805806756909186, 0.09805806756909215, -0.09805806756909191,
+      -0.09128709291752785, 0.09128709291752767, -0.09128709291752773, 0.09128709291752772,
+      -0.08574929257125434, 0.08574929257125453, -0.08574929257125448, 0.08574929257125478,
+      0.08574929257125434, -0.08574929257125453, 0.08574929257125448, -0.08574929257125478,
+      -0.08111071056538134, 0.08111071056538113, -0.08111071056538136, 0.08111071056538087,
+      -0.2041241452319316, 0.20412414523193162, 0.2041241452319316, -0.2041241452319315,
+      -0.20412414523193156, -0.2041241452319316, 0.20412414523193176, 0.20412414523193156,
+      0.1666666666666668, -0.1666666666666667, -0.1666666666666668, 0.166666666666667,
+      0.12909944487358055, -0.12909944487358033, -0.12909944487358077, 0.12909944487358022,
+      0.10910894511799629, -0.10910894511799604, -0.1091089451179963, 0.10910894511799638,
+      0.0962250448649376, -0.0962250448649377, -0.09622504486493767, 0.09622504486493776,
+      0.08703882797784897, -0.08703882797784895, -0.08703882797784906, 0.08703882797784901,
+      0.08006407690254365, -0.08006407690254351, -0.08006407690254365, 0.08006407690254354,
+      0.07453559924999308, -0.07453559924999291, -0.07453559924999313, 0.07453559924999303,
+      0.07001400420140055, -0.07001400420140061, -0.07001400420140053, 0.07001400420140053,
+      0.0662266178532522, -0.06622661785325194, -0.06622661785325222, 0.06622661785325185,
+      -0.15811388300841883, 0.15811388300841903, 0.15811388300841883, -0.15811388300841886,
+      0.15811388300841883, -0.15811388300841903, -0.15811388300841883, 0.15811388300841886,
+      0.1581138830084189, 0.15811388300841903, -0.15811388300841883, -0.1581138830084189,
+      -0.1581138830084189, -0.15811388300841903, 0.15811388300841883, 0.1581138830084189,
+      0.1290994448735805, -0.12909944487358066, -0.12909944487358047, 0.1290994448735804,
+      0.09999999999999978, -0.09999999999999996, -0.09999999999999995, 0.09999999999999998,
+      0.0845154254728516, -0.08451542547285164, -0.0845154254728516, 0.08451542547285161,
+      0.07453559924999299, -0.07453559924999298, -0.07453559924999302, 0.07453559924999295,
+      0.06741998624632432, -0.06741998624632407, -0.06741998624632417, 0.06741998624632406,
+      0.062017367294604275, -0.06201736729460416, -0.062017367294604324, 0.062017367294604296,
+      0.05773502691896261, -0.057735026918962595, -0.05773502691896257, 0.05773502691896254,
+      0.05423261445466407, -0.05423261445466405, -0.05423261445466403, 0.054232614454664124,
+      0.05129891760425777, -0.05129891760425758, -0.051298917604257706, 0.05129891760425749,
+      -0.13363062095621225, 0.1336306209562123, 0.1336306209562124, -0.1336306209562124,
+      -0.13363062095621223, -0.13363062095621228, 0.13363062095621236, 0.13363062095621228,
+      0.10910894511799635, -0.10910894511799621, -0.10910894511799613, 0.10910894511799629,
+      0.08451542547285168, -0.08451542547285174, -0.08451542547285162, 0.08451542547285158,
+      0.07142857142857142, -0.07142857142857131, -0.07142857142857141, 0.07142857142857152,
+      0.06299407883487128, -0.06299407883487121, -0.06299407883487136, 0.06299407883487121,
+      0.05698028822981899, -0.056980288229818966, -0.05698028822981899, 0.05698028822981895,
+      0.052414241836095894, -0.05241424183609586, -0.05241424183609597, 0.05241424183609589,
+      0.048795003647426755, -0.04879500364742658, -0.04879500364742666, 0.048795003647426644,
+      0.045834924851410594, -0.045834924851410636, -0.04583492485141049, 0.045834924851410636,
+      0.04335549847620597, -0.04335549847620591, -0.04335549847620603, 0.04335549847620595,
+      -0.11785113019775795, 0.11785113019775802, 0.11785113019775789, -0.117851130197758,
+      0.11785113019775795, -0.11785113019775802, -0.11785113019775789, 0.117851130197758,
+      0.1178511301977579, 0.11785113019775799, -0.11785113019775789, -0.11785113019775796,
+      -0.1178511301977579, -0.11785113019775799, 0.11785113019775789, 0.11785113019775796,
+      0.09622504486493753, -0.09622504486493764, -0.09622504486493762, 0.0962250448649377,
+      0.07453559924999303, -0.07453559924999296, -0.07453559924999283, 0.07453559924999295,
+      0.06299407883487122, -0.06299407883487126, -0.06299407883487126, 0.06299407883487108,
+      0.05555555555555556, -0.05555555555555551, -0.05555555555555553, 0.055555555555555566,
+      0.05025189076296063, -0.05025189076296056, -0.05025189076296063, 0.05025189076296056,
+      0.046225016352102445, -0.046225016352102355, -0.04622501635210243, 0.04622501635210242,
+      0.04303314829119355, -0.043033148291193556, -0.04303314829119352, 0.043033148291193514,
+      0.040422604172722185, -0.04042260417272222, -0.04042260417272224, 0.04042260417272225,
+      0.03823595564509363, -0.038235955645093585, -0.0382359556450936, 0.03823595564509357,
+      -0.10660035817780532, 0.10660035817780535, 0.10660035817780532, -0.10660035817780518,
+      -0.1066003581778053, -0.10660035817780537, 0.10660035817780529, 0.1066003581778052,
+      0.08703882797784894, -0.08703882797784901, -0.08703882797784894, 0.08703882797784894,
+      0.06741998624632425, -0.06741998624632424, -0.06741998624632416, 0.06741998624632416,
+      0.05698028822981901, -0.05698028822981898, -0.056980288229818966, 0.05698028822981895,
+      0.05025189076296059, -0.05025189076296065, -0.05025189076296061, 0.050251890762960584,
+      0.04545454545454538, -0.045454545454545456, -0.04545454545454549, 0.045454545454545386,
+      0.04181210050035458, -0.04181210050035459, -0.04181210050035454, 0.04181210050035449,
+      0.03892494720807617, -0.03892494720807615, -0.038924947208076204, 0.03892494720807612,
+      0.03656362120635661, -0.03656362120635661, -0.03656362120635651, 0.036563621206356575,
+      0.03458572319330374, -0.034585723193303684, -0.03458572319330373, 0.03458572319330363,
+      -0.09805806756909209, 0.09805806756909209, 0.09805806756909187, -0.09805806756909201,
+      0.09805806756909209, -0.09805806756909209, -0.09805806756909187, 0.09805806756909201,
+      0.0980580675690921, 0.09805806756909213, -0.0980580675690919, -0.09805806756909202,
+      -0.0980580675690921, -0.09805806756909213, 0.0980580675690919, 0.09805806756909202,
+      0.08006407690254365, -0.08006407690254358, -0.08006407690254358, 0.08006407690254355,
+      0.06201736729460425, -0.062017367294604296, -0.06201736729460416, 0.06201736729460423,
+      0.0524142418360959, -0.05241424183609594, -0.05241424183609591, 0.052414241836095846,
+      0.046225016352102424, -0.04622501635210249, -0.04622501635210235, 0.0462250163521024,
+      0.041812100500354596, -0.04181210050035456, -0.04181210050035456, 0.0418121005003545,
+      0.03846153846153854, -0.03846153846153846, -0.038461538461538464, 0.03846153846153847,
+      0.03580574370197169, -0.035805743701971565, -0.0358057437019716, 0.035805743701971614,
+      0.033633639699815636, -0.03363363969981566, -0.03363363969981562, 0.03363363969981565,
+      0.0318142381487889, -0.03181423814878886, -0.031814238148788934, 0.031814238148788795,
+      -0.0912870929175278, 0.0912870929175278, 0.09128709291752768, -0.09128709291752775,
+      -0.0912870929175278, -0.09128709291752782, 0.09128709291752767, 0.09128709291752773,
+      0.07453559924999312, -0.07453559924999315, -0.07453559924999298, 0.07453559924999299,
+      0.057735026918962595, -0.05773502691896259, -0.0577350269189626, 0.05773502691896257,
+      0.048795003647426734, -0.048795003647426644, -0.04879500364742662, 0.048795003647426616,
+      0.04303314829119353, -0.043033148291193535, -0.04303314829119352, 0.04303314829119351,
+      0.03892494720807616, -0.03892494720807616, -0.03892494720807619, 0.03892494720807605,
+      0.03580574370197174, -0.035805743701971676, -0.03580574370197164, 0.03580574370197162,
+      0.03333333333333344, -0.03333333333333331, -0.03333333333333334, 0.0333333333333333,
+      0.03131121455425753, -0.03131121455425751, -0.03131121455425746, 0.031311214554257526,
+      0.029617443887954634, -0.02961744388795455, -0.029617443887954602, 0.02961744388795448,
+      -0.08574929257125442, 0.08574929257125448, 0.08574929257125456, -0.08574929257125463,
+      0.08574929257125442, -0.08574929257125448, -0.08574929257125456, 0.08574929257125463,
+      0.08574929257125442, 0.08574929257125444, -0.08574929257125456, -0.08574929257125466,
+      -0.08574929257125442, -0.08574929257125444, 0.08574929257125456, 0.08574929257125466,
+      0.07001400420140041, -0.07001400420140047, -0.07001400420140065, 0.0700140042014006,
+      0.05423261445466403, -0.05423261445466399, -0.05423261445466404, 0.0542326144546641,
+      0.04583492485141063, -0.04583492485141052, -0.04583492485141065, 0.045834924851410636,
+      0.040422604172722205, -0.040422604172722164, -0.040422604172722205, 0.04042260417272223,
+      0.03656362120635655, -0.03656362120635654, -0.03656362120635668, 0.03656362120635659,
+      0.03363363969981561, -0.03363363969981562, -0.03363363969981564, 0.0336336396998157,
+      0.03131121455425754, -0.03131121455425742, -0.031311214554257484, 0.031311214554257547,
+      0.02941176470588235, -0.0294117647058824, -0.029411764705882415, 0.02941176470588242,
+      0.02782074420373287, -0.02782074420373284, -0.02782074420373291, 0.027820744203732834,
+      -0.08111071056538127, 0.08111071056538141, 0.08111071056538115, -0.08111071056538104,
+      -0.08111071056538131, -0.08111071056538137, 0.08111071056538116, 0.08111071056538101,
+      0.06622661785325214, -0.06622661785325228, -0.06622661785325203, 0.0662266178532519,
+      0.05129891760425773, -0.05129891760425771, -0.05129891760425757, 0.051298917604257505,
+      0.043355498476205956, -0.04335549847620604, -0.043355498476206, 0.04335549847620593,
+      0.038235955645093626, -0.038235955645093585, -0.038235955645093495, 0.038235955645093495,
+      0.03458572319330377, -0.03458572319330376, -0.0345857231933037, 0.034585723193303664,
+      0.03181423814878889, -0.031814238148788934, -0.031814238148788816, 0.03181423814878878,
+      0.029617443887954644, -0.02961744388795461, -0.02961744388795457, 0.029617443887954488,
+      0.027820744203732872, -0.027820744203732914, -0.027820744203732827, 0.027820744203732845,
+      0.026315789473684247, -0.026315789473684143, -0.02631578947368416, 0.026315789473684067,
+    };
+
+    extern const Shapeset::PolynomialTable simple_quad_polynomials = { 137, simple_quad_start, simple_quad_degrees, simple_quad_coefs };
   }
 }
\ No newline at end of file
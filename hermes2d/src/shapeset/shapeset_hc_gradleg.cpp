@@ -14,15508 +14,85 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "global.h"
-#include "shapeset_common.h"
 #include "shapeset_hc_all.h"
 namespace Hermes
 {
   namespace Hermes2D
   {
-    // Shape functions for the curl operator for triangles,
 
-    //Shape functions
-
-    ///////////////////////////////// ORDER 0 //////////////////////////////////
-
-    /* Whitney fns - constant tangential component */
-
-    // EDGE 1
-
-    static double gradleg_tri_p0_e1_a_0(double x, double y)
-    {
-      return psi0e1_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_a_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e1_b_0(double x, double y)
-    {
-      return psi0e1_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_b_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e1_ax_0(double x, double y)
-    {
-      return psi0e1x_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_ax_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e1_bx_0(double x, double y)
-    {
-      return psi0e1x_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_bx_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e1_ay_0(double x, double y)
-    {
-      return psi0e1y_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_ay_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e1_by_0(double x, double y)
-    {
-      return psi0e1y_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e1_by_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e1_by_0(x, y));
-    }
-
-    // EDGE 2
-
-    static double gradleg_tri_p0_e2_a_0(double x, double y)
-    {
-      return psi0e2_1(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_a_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e2_b_0(double x, double y)
-    {
-      return psi0e2_2(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_b_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e2_ax_0(double x, double y)
-    {
-      return psi0e2x_1(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_ax_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e2_bx_0(double x, double y)
-    {
-      return psi0e2x_2(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_bx_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e2_ay_0(double x, double y)
-    {
-      return psi0e2y_1(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_ay_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e2_by_0(double x, double y)
-    {
-      return psi0e2y_2(x, y) / 1.4142135623731;
-    }
-
-    static double gradleg_tri_p0_e2_by_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e2_by_0(x, y));
-    }
-
-    // EDGE 3
-
-    static double gradleg_tri_p0_e3_a_0(double x, double y)
-    {
-      return psi0e3_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_a_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e3_b_0(double x, double y)
-    {
-      return psi0e3_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_b_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e3_ax_0(double x, double y)
-    {
-      return psi0e3x_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_ax_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e3_bx_0(double x, double y)
-    {
-      return psi0e3x_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_bx_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e3_ay_0(double x, double y)
-    {
-      return psi0e3y_1(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_ay_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p0_e3_by_0(double x, double y)
-    {
-      return psi0e3y_2(x, y) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p0_e3_by_1(double x, double y)
-    {
-      return -(gradleg_tri_p0_e3_by_0(x, y));
-    }
-
-    ///////////////////////////////// ORDER 1 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 1*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p1_e1_a(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi0(l3 - l2) + l3 * l2x * phi0(l3 - l2) + l3 * l2 * phi0x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e1_b(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi0(l3 - l2) + l3 * l2y * phi0(l3 - l2) + l3 * l2 * phi0x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi0(l3 - l2); kerx = phi0x(l3 - l2) * (l3x - l2x); kerxx = phi0xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e1_ay(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi0(l3 - l2); kerx = phi0x(l3 - l2) * (l3x - l2x);
-     kery = phi0x(l3 - l2) * (l3y - l2y); kerxy = phi0xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e1_bx(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi0(l3 - l2); kerx = phi0x(l3 - l2) * (l3x - l2x);
-     kery = phi0x(l3 - l2) * (l3y - l2y); kerxy = phi0xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi0(l3 - l2); kery = phi0x(l3 - l2) * (l3y - l2y); keryy = phi0xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p1_e2_a(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi0(l1 - l3) + l1 * l3x * phi0(l1 - l3) + l1 * l3 * phi0x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e2_b(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi0(l1 - l3) + l1 * l3y * phi0(l1 - l3) + l1 * l3 * phi0x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi0(l1 - l3); kerx = phi0x(l1 - l3) * (l1x - l3x); kerxx = phi0xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e2_ay(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi0(l1 - l3); kerx = phi0x(l1 - l3) * (l1x - l3x);
-     kery = phi0x(l1 - l3) * (l1y - l3y); kerxy = phi0xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e2_bx(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi0(l1 - l3); kerx = phi0x(l1 - l3) * (l1x - l3x);
-     kery = phi0x(l1 - l3) * (l1y - l3y); kerxy = phi0xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi0(l1 - l3); kery = phi0x(l1 - l3) * (l1y - l3y); keryy = phi0xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p1_e3_a(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi0(l2 - l1) + l2 * l1x * phi0(l2 - l1) + l2 * l1 * phi0x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e3_b(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi0(l2 - l1) + l2 * l1y * phi0(l2 - l1) + l2 * l1 * phi0x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi0(l2 - l1); kerx = phi0x(l2 - l1) * (l2x - l1x); kerxx = phi0xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e3_ay(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi0(l2 - l1); kerx = phi0x(l2 - l1) * (l2x - l1x);
-     kery = phi0x(l2 - l1) * (l2y - l1y); kerxy = phi0xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e3_bx(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi0(l2 - l1); kerx = phi0x(l2 - l1) * (l2x - l1x);
-     kery = phi0x(l2 - l1) * (l2y - l1y); kerxy = phi0xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p1_e3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi0(l2 - l1); kery = phi0x(l2 - l1) * (l2y - l1y); keryy = phi0xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    ///////////////////////////////// ORDER 2 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 2*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p2_e1_a_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi1(l3 - l2) + l3 * l2x * phi1(l3 - l2) + l3 * l2 * phi1x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e1_b_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi1(l3 - l2) + l3 * l2y * phi1(l3 - l2) + l3 * l2 * phi1x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e1_ax_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi1(l3 - l2); kerx = phi1x(l3 - l2) * (l3x - l2x); kerxx = phi1xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e1_ay_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi1(l3 - l2); kerx = phi1x(l3 - l2) * (l3x - l2x);
-     kery = phi1x(l3 - l2) * (l3y - l2y); kerxy = phi1xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e1_bx_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi1(l3 - l2); kerx = phi1x(l3 - l2) * (l3x - l2x);
-     kery = phi1x(l3 - l2) * (l3y - l2y); kerxy = phi1xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e1_by_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi1(l3 - l2); kery = phi1x(l3 - l2) * (l3y - l2y); keryy = phi1xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e1_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e1_by_0(x, y));
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p2_e2_a_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi1(l1 - l3) + l1 * l3x * phi1(l1 - l3) + l1 * l3 * phi1x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e2_b_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi1(l1 - l3) + l1 * l3y * phi1(l1 - l3) + l1 * l3 * phi1x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e2_ax_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi1(l1 - l3); kerx = phi1x(l1 - l3) * (l1x - l3x); kerxx = phi1xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e2_ay_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi1(l1 - l3); kerx = phi1x(l1 - l3) * (l1x - l3x);
-     kery = phi1x(l1 - l3) * (l1y - l3y); kerxy = phi1xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e2_bx_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi1(l1 - l3); kerx = phi1x(l1 - l3) * (l1x - l3x);
-     kery = phi1x(l1 - l3) * (l1y - l3y); kerxy = phi1xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e2_by_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi1(l1 - l3); kery = phi1x(l1 - l3) * (l1y - l3y); keryy = phi1xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e2_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e2_by_0(x, y));
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p2_e3_a_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi1(l2 - l1) + l2 * l1x * phi1(l2 - l1) + l2 * l1 * phi1x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e3_b_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi1(l2 - l1) + l2 * l1y * phi1(l2 - l1) + l2 * l1 * phi1x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e3_ax_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi1(l2 - l1); kerx = phi1x(l2 - l1) * (l2x - l1x); kerxx = phi1xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e3_ay_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi1(l2 - l1); kerx = phi1x(l2 - l1) * (l2x - l1x);
-     kery = phi1x(l2 - l1) * (l2y - l1y); kerxy = phi1xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e3_bx_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi1(l2 - l1); kerx = phi1x(l2 - l1) * (l2x - l1x);
-     kery = phi1x(l2 - l1) * (l2y - l1y); kerxy = phi1xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p2_e3_by_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi1(l2 - l1); kery = phi1x(l2 - l1) * (l2y - l1y); keryy = phi1xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p2_e3_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p2_e3_by_0(x, y));
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 2 */
-
-     // EDGE 1
-    static double gradleg_tri_p2_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre0(l3 - l2));
-    }
-
-    static double gradleg_tri_p2_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre0(l3 - l2));
-    }
-
-    static double gradleg_tri_p2_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre0(l3 - l2) + l3 * l2x * Legendre0(l3 - l2) + l3 * l2 * Legendre0x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p2_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre0(l3 - l2) + l3 * l2x * Legendre0(l3 - l2) + l3 * l2 * Legendre0x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p2_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre0(l3 - l2) + l3 * l2y * Legendre0(l3 - l2) + l3 * l2 * Legendre0x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p2_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre0(l3 - l2) + l3 * l2y * Legendre0(l3 - l2) + l3 * l2 * Legendre0x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p2_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre0(l1 - l3));
-    }
-
-    static double gradleg_tri_p2_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre0(l1 - l3));
-    }
-
-    static double gradleg_tri_p2_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre0(l1 - l3) + l1 * l3x * Legendre0(l1 - l3) + l1 * l3 * Legendre0x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p2_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre0(l1 - l3) + l1 * l3x * Legendre0(l1 - l3) + l1 * l3 * Legendre0x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p2_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre0(l1 - l3) + l1 * l3y * Legendre0(l1 - l3) + l1 * l3 * Legendre0x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p2_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre0(l1 - l3) + l1 * l3y * Legendre0(l1 - l3) + l1 * l3 * Legendre0x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p2_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre0(l2 - l1));
-    }
-
-    static double gradleg_tri_p2_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre0(l2 - l1));
-    }
-
-    static double gradleg_tri_p2_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre0(l2 - l1) + l2 * l1x * Legendre0(l2 - l1) + l2 * l1 * Legendre0x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p2_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre0(l2 - l1) + l2 * l1x * Legendre0(l2 - l1) + l2 * l1 * Legendre0x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p2_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre0(l2 - l1) + l2 * l1y * Legendre0(l2 - l1) + l2 * l1 * Legendre0x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p2_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre0(l2 - l1) + l2 * l1y * Legendre0(l2 - l1) + l2 * l1 * Legendre0x(l2 - l1) * (l2y - l1y));
-    }
-
-    ///////////////////////////////// ORDER 3 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 3*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p3_e1_a(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi2(l3 - l2) + l3 * l2x * phi2(l3 - l2) + l3 * l2 * phi2x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e1_b(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi2(l3 - l2) + l3 * l2y * phi2(l3 - l2) + l3 * l2 * phi2x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi2(l3 - l2); kerx = phi2x(l3 - l2) * (l3x - l2x); kerxx = phi2xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e1_ay(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi2(l3 - l2); kerx = phi2x(l3 - l2) * (l3x - l2x);
-     kery = phi2x(l3 - l2) * (l3y - l2y); kerxy = phi2xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e1_bx(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi2(l3 - l2); kerx = phi2x(l3 - l2) * (l3x - l2x);
-     kery = phi2x(l3 - l2) * (l3y - l2y); kerxy = phi2xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi2(l3 - l2); kery = phi2x(l3 - l2) * (l3y - l2y); keryy = phi2xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p3_e2_a(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi2(l1 - l3) + l1 * l3x * phi2(l1 - l3) + l1 * l3 * phi2x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e2_b(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi2(l1 - l3) + l1 * l3y * phi2(l1 - l3) + l1 * l3 * phi2x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi2(l1 - l3); kerx = phi2x(l1 - l3) * (l1x - l3x); kerxx = phi2xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e2_ay(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi2(l1 - l3); kerx = phi2x(l1 - l3) * (l1x - l3x);
-     kery = phi2x(l1 - l3) * (l1y - l3y); kerxy = phi2xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e2_bx(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi2(l1 - l3); kerx = phi2x(l1 - l3) * (l1x - l3x);
-     kery = phi2x(l1 - l3) * (l1y - l3y); kerxy = phi2xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi2(l1 - l3); kery = phi2x(l1 - l3) * (l1y - l3y); keryy = phi2xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p3_e3_a(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi2(l2 - l1) + l2 * l1x * phi2(l2 - l1) + l2 * l1 * phi2x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e3_b(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi2(l2 - l1) + l2 * l1y * phi2(l2 - l1) + l2 * l1 * phi2x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi2(l2 - l1); kerx = phi2x(l2 - l1) * (l2x - l1x); kerxx = phi2xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e3_ay(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi2(l2 - l1); kerx = phi2x(l2 - l1) * (l2x - l1x);
-     kery = phi2x(l2 - l1) * (l2y - l1y); kerxy = phi2xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e3_bx(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi2(l2 - l1); kerx = phi2x(l2 - l1) * (l2x - l1x);
-     kery = phi2x(l2 - l1) * (l2y - l1y); kerxy = phi2xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p3_e3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi2(l2 - l1); kery = phi2x(l2 - l1) * (l2y - l1y); keryy = phi2xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 3 */
-
-     // EDGE 1
-    static double gradleg_tri_p3_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre1(l3 - l2));
-    }
-
-    static double gradleg_tri_p3_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre1(l3 - l2));
-    }
-
-    static double gradleg_tri_p3_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre1(l3 - l2) + l3 * l2x * Legendre1(l3 - l2) + l3 * l2 * Legendre1x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p3_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre1(l3 - l2) + l3 * l2x * Legendre1(l3 - l2) + l3 * l2 * Legendre1x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p3_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre1(l3 - l2) + l3 * l2y * Legendre1(l3 - l2) + l3 * l2 * Legendre1x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p3_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre1(l3 - l2) + l3 * l2y * Legendre1(l3 - l2) + l3 * l2 * Legendre1x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p3_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre1(l1 - l3));
-    }
-
-    static double gradleg_tri_p3_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre1(l1 - l3));
-    }
-
-    static double gradleg_tri_p3_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre1(l1 - l3) + l1 * l3x * Legendre1(l1 - l3) + l1 * l3 * Legendre1x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p3_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre1(l1 - l3) + l1 * l3x * Legendre1(l1 - l3) + l1 * l3 * Legendre1x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p3_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre1(l1 - l3) + l1 * l3y * Legendre1(l1 - l3) + l1 * l3 * Legendre1x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p3_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre1(l1 - l3) + l1 * l3y * Legendre1(l1 - l3) + l1 * l3 * Legendre1x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p3_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre1(l2 - l1));
-    }
-
-    static double gradleg_tri_p3_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre1(l2 - l1));
-    }
-
-    static double gradleg_tri_p3_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre1(l2 - l1) + l2 * l1x * Legendre1(l2 - l1) + l2 * l1 * Legendre1x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p3_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre1(l2 - l1) + l2 * l1x * Legendre1(l2 - l1) + l2 * l1 * Legendre1x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p3_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre1(l2 - l1) + l2 * l1y * Legendre1(l2 - l1) + l2 * l1 * Legendre1x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p3_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre1(l2 - l1) + l2 * l1y * Legendre1(l2 - l1) + l2 * l1 * Legendre1x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 3 */
-
-    static double gradleg_tri_b1_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 4 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 4*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p4_e1_a_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi3(l3 - l2) + l3 * l2x * phi3(l3 - l2) + l3 * l2 * phi3x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e1_b_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi3(l3 - l2) + l3 * l2y * phi3(l3 - l2) + l3 * l2 * phi3x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e1_ax_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi3(l3 - l2); kerx = phi3x(l3 - l2) * (l3x - l2x); kerxx = phi3xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e1_ay_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi3(l3 - l2); kerx = phi3x(l3 - l2) * (l3x - l2x);
-     kery = phi3x(l3 - l2) * (l3y - l2y); kerxy = phi3xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e1_bx_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi3(l3 - l2); kerx = phi3x(l3 - l2) * (l3x - l2x);
-     kery = phi3x(l3 - l2) * (l3y - l2y); kerxy = phi3xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e1_by_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi3(l3 - l2); kery = phi3x(l3 - l2) * (l3y - l2y); keryy = phi3xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e1_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e1_by_0(x, y));
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p4_e2_a_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi3(l1 - l3) + l1 * l3x * phi3(l1 - l3) + l1 * l3 * phi3x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e2_b_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi3(l1 - l3) + l1 * l3y * phi3(l1 - l3) + l1 * l3 * phi3x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e2_ax_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi3(l1 - l3); kerx = phi3x(l1 - l3) * (l1x - l3x); kerxx = phi3xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e2_ay_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi3(l1 - l3); kerx = phi3x(l1 - l3) * (l1x - l3x);
-     kery = phi3x(l1 - l3) * (l1y - l3y); kerxy = phi3xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e2_bx_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi3(l1 - l3); kerx = phi3x(l1 - l3) * (l1x - l3x);
-     kery = phi3x(l1 - l3) * (l1y - l3y); kerxy = phi3xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e2_by_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi3(l1 - l3); kery = phi3x(l1 - l3) * (l1y - l3y); keryy = phi3xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e2_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e2_by_0(x, y));
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p4_e3_a_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi3(l2 - l1) + l2 * l1x * phi3(l2 - l1) + l2 * l1 * phi3x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e3_b_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi3(l2 - l1) + l2 * l1y * phi3(l2 - l1) + l2 * l1 * phi3x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e3_ax_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi3(l2 - l1); kerx = phi3x(l2 - l1) * (l2x - l1x); kerxx = phi3xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e3_ay_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi3(l2 - l1); kerx = phi3x(l2 - l1) * (l2x - l1x);
-     kery = phi3x(l2 - l1) * (l2y - l1y); kerxy = phi3xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e3_bx_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi3(l2 - l1); kerx = phi3x(l2 - l1) * (l2x - l1x);
-     kery = phi3x(l2 - l1) * (l2y - l1y); kerxy = phi3xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p4_e3_by_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi3(l2 - l1); kery = phi3x(l2 - l1) * (l2y - l1y); keryy = phi3xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p4_e3_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p4_e3_by_0(x, y));
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 4 */
-
-     // EDGE 1
-    static double gradleg_tri_p4_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre2(l3 - l2));
-    }
-
-    static double gradleg_tri_p4_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre2(l3 - l2));
-    }
-
-    static double gradleg_tri_p4_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre2(l3 - l2) + l3 * l2x * Legendre2(l3 - l2) + l3 * l2 * Legendre2x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p4_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre2(l3 - l2) + l3 * l2x * Legendre2(l3 - l2) + l3 * l2 * Legendre2x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p4_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre2(l3 - l2) + l3 * l2y * Legendre2(l3 - l2) + l3 * l2 * Legendre2x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p4_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre2(l3 - l2) + l3 * l2y * Legendre2(l3 - l2) + l3 * l2 * Legendre2x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p4_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre2(l1 - l3));
-    }
-
-    static double gradleg_tri_p4_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre2(l1 - l3));
-    }
-
-    static double gradleg_tri_p4_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre2(l1 - l3) + l1 * l3x * Legendre2(l1 - l3) + l1 * l3 * Legendre2x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p4_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre2(l1 - l3) + l1 * l3x * Legendre2(l1 - l3) + l1 * l3 * Legendre2x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p4_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre2(l1 - l3) + l1 * l3y * Legendre2(l1 - l3) + l1 * l3 * Legendre2x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p4_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre2(l1 - l3) + l1 * l3y * Legendre2(l1 - l3) + l1 * l3 * Legendre2x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p4_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre2(l2 - l1));
-    }
-
-    static double gradleg_tri_p4_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre2(l2 - l1));
-    }
-
-    static double gradleg_tri_p4_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre2(l2 - l1) + l2 * l1x * Legendre2(l2 - l1) + l2 * l1 * Legendre2x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p4_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre2(l2 - l1) + l2 * l1x * Legendre2(l2 - l1) + l2 * l1 * Legendre2x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p4_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre2(l2 - l1) + l2 * l1y * Legendre2(l2 - l1) + l2 * l1 * Legendre2x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p4_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre2(l2 - l1) + l2 * l1y * Legendre2(l2 - l1) + l2 * l1 * Legendre2x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 4 */
-
-    static double gradleg_tri_b1_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 5 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 5*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p5_e1_a(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi4(l3 - l2) + l3 * l2x * phi4(l3 - l2) + l3 * l2 * phi4x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e1_b(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi4(l3 - l2) + l3 * l2y * phi4(l3 - l2) + l3 * l2 * phi4x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi4(l3 - l2); kerx = phi4x(l3 - l2) * (l3x - l2x); kerxx = phi4xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e1_ay(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi4(l3 - l2); kerx = phi4x(l3 - l2) * (l3x - l2x);
-     kery = phi4x(l3 - l2) * (l3y - l2y); kerxy = phi4xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e1_bx(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi4(l3 - l2); kerx = phi4x(l3 - l2) * (l3x - l2x);
-     kery = phi4x(l3 - l2) * (l3y - l2y); kerxy = phi4xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi4(l3 - l2); kery = phi4x(l3 - l2) * (l3y - l2y); keryy = phi4xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p5_e2_a(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi4(l1 - l3) + l1 * l3x * phi4(l1 - l3) + l1 * l3 * phi4x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e2_b(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi4(l1 - l3) + l1 * l3y * phi4(l1 - l3) + l1 * l3 * phi4x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi4(l1 - l3); kerx = phi4x(l1 - l3) * (l1x - l3x); kerxx = phi4xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e2_ay(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi4(l1 - l3); kerx = phi4x(l1 - l3) * (l1x - l3x);
-     kery = phi4x(l1 - l3) * (l1y - l3y); kerxy = phi4xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e2_bx(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi4(l1 - l3); kerx = phi4x(l1 - l3) * (l1x - l3x);
-     kery = phi4x(l1 - l3) * (l1y - l3y); kerxy = phi4xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi4(l1 - l3); kery = phi4x(l1 - l3) * (l1y - l3y); keryy = phi4xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p5_e3_a(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi4(l2 - l1) + l2 * l1x * phi4(l2 - l1) + l2 * l1 * phi4x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e3_b(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi4(l2 - l1) + l2 * l1y * phi4(l2 - l1) + l2 * l1 * phi4x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi4(l2 - l1); kerx = phi4x(l2 - l1) * (l2x - l1x); kerxx = phi4xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e3_ay(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi4(l2 - l1); kerx = phi4x(l2 - l1) * (l2x - l1x);
-     kery = phi4x(l2 - l1) * (l2y - l1y); kerxy = phi4xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e3_bx(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi4(l2 - l1); kerx = phi4x(l2 - l1) * (l2x - l1x);
-     kery = phi4x(l2 - l1) * (l2y - l1y); kerxy = phi4xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p5_e3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi4(l2 - l1); kery = phi4x(l2 - l1) * (l2y - l1y); keryy = phi4xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 5 */
-
-     // EDGE 1
-    static double gradleg_tri_p5_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre3(l3 - l2));
-    }
-
-    static double gradleg_tri_p5_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre3(l3 - l2));
-    }
-
-    static double gradleg_tri_p5_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre3(l3 - l2) + l3 * l2x * Legendre3(l3 - l2) + l3 * l2 * Legendre3x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p5_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre3(l3 - l2) + l3 * l2x * Legendre3(l3 - l2) + l3 * l2 * Legendre3x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p5_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre3(l3 - l2) + l3 * l2y * Legendre3(l3 - l2) + l3 * l2 * Legendre3x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p5_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre3(l3 - l2) + l3 * l2y * Legendre3(l3 - l2) + l3 * l2 * Legendre3x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p5_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre3(l1 - l3));
-    }
-
-    static double gradleg_tri_p5_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre3(l1 - l3));
-    }
-
-    static double gradleg_tri_p5_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre3(l1 - l3) + l1 * l3x * Legendre3(l1 - l3) + l1 * l3 * Legendre3x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p5_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre3(l1 - l3) + l1 * l3x * Legendre3(l1 - l3) + l1 * l3 * Legendre3x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p5_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre3(l1 - l3) + l1 * l3y * Legendre3(l1 - l3) + l1 * l3 * Legendre3x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p5_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre3(l1 - l3) + l1 * l3y * Legendre3(l1 - l3) + l1 * l3 * Legendre3x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p5_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre3(l2 - l1));
-    }
-
-    static double gradleg_tri_p5_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre3(l2 - l1));
-    }
-
-    static double gradleg_tri_p5_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre3(l2 - l1) + l2 * l1x * Legendre3(l2 - l1) + l2 * l1 * Legendre3x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p5_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre3(l2 - l1) + l2 * l1x * Legendre3(l2 - l1) + l2 * l1 * Legendre3x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p5_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre3(l2 - l1) + l2 * l1y * Legendre3(l2 - l1) + l2 * l1 * Legendre3x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p5_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre3(l2 - l1) + l2 * l1y * Legendre3(l2 - l1) + l2 * l1 * Legendre3x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 5 */
-
-    static double gradleg_tri_b1_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 6 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 6*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p6_e1_a_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi5(l3 - l2) + l3 * l2x * phi5(l3 - l2) + l3 * l2 * phi5x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e1_b_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi5(l3 - l2) + l3 * l2y * phi5(l3 - l2) + l3 * l2 * phi5x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e1_ax_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi5(l3 - l2); kerx = phi5x(l3 - l2) * (l3x - l2x); kerxx = phi5xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e1_ay_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi5(l3 - l2); kerx = phi5x(l3 - l2) * (l3x - l2x);
-     kery = phi5x(l3 - l2) * (l3y - l2y); kerxy = phi5xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e1_bx_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi5(l3 - l2); kerx = phi5x(l3 - l2) * (l3x - l2x);
-     kery = phi5x(l3 - l2) * (l3y - l2y); kerxy = phi5xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e1_by_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi5(l3 - l2); kery = phi5x(l3 - l2) * (l3y - l2y); keryy = phi5xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e1_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e1_by_0(x, y));
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p6_e2_a_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi5(l1 - l3) + l1 * l3x * phi5(l1 - l3) + l1 * l3 * phi5x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e2_b_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi5(l1 - l3) + l1 * l3y * phi5(l1 - l3) + l1 * l3 * phi5x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e2_ax_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi5(l1 - l3); kerx = phi5x(l1 - l3) * (l1x - l3x); kerxx = phi5xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e2_ay_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi5(l1 - l3); kerx = phi5x(l1 - l3) * (l1x - l3x);
-     kery = phi5x(l1 - l3) * (l1y - l3y); kerxy = phi5xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e2_bx_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi5(l1 - l3); kerx = phi5x(l1 - l3) * (l1x - l3x);
-     kery = phi5x(l1 - l3) * (l1y - l3y); kerxy = phi5xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e2_by_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi5(l1 - l3); kery = phi5x(l1 - l3) * (l1y - l3y); keryy = phi5xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e2_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e2_by_0(x, y));
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p6_e3_a_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi5(l2 - l1) + l2 * l1x * phi5(l2 - l1) + l2 * l1 * phi5x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e3_b_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi5(l2 - l1) + l2 * l1y * phi5(l2 - l1) + l2 * l1 * phi5x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e3_ax_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi5(l2 - l1); kerx = phi5x(l2 - l1) * (l2x - l1x); kerxx = phi5xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e3_ay_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi5(l2 - l1); kerx = phi5x(l2 - l1) * (l2x - l1x);
-     kery = phi5x(l2 - l1) * (l2y - l1y); kerxy = phi5xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e3_bx_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi5(l2 - l1); kerx = phi5x(l2 - l1) * (l2x - l1x);
-     kery = phi5x(l2 - l1) * (l2y - l1y); kerxy = phi5xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p6_e3_by_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi5(l2 - l1); kery = phi5x(l2 - l1) * (l2y - l1y); keryy = phi5xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p6_e3_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p6_e3_by_0(x, y));
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 6 */
-
-     // EDGE 1
-    static double gradleg_tri_p6_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre4(l3 - l2));
-    }
-
-    static double gradleg_tri_p6_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre4(l3 - l2));
-    }
-
-    static double gradleg_tri_p6_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre4(l3 - l2) + l3 * l2x * Legendre4(l3 - l2) + l3 * l2 * Legendre4x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p6_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre4(l3 - l2) + l3 * l2x * Legendre4(l3 - l2) + l3 * l2 * Legendre4x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p6_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre4(l3 - l2) + l3 * l2y * Legendre4(l3 - l2) + l3 * l2 * Legendre4x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p6_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre4(l3 - l2) + l3 * l2y * Legendre4(l3 - l2) + l3 * l2 * Legendre4x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p6_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre4(l1 - l3));
-    }
-
-    static double gradleg_tri_p6_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre4(l1 - l3));
-    }
-
-    static double gradleg_tri_p6_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre4(l1 - l3) + l1 * l3x * Legendre4(l1 - l3) + l1 * l3 * Legendre4x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p6_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre4(l1 - l3) + l1 * l3x * Legendre4(l1 - l3) + l1 * l3 * Legendre4x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p6_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre4(l1 - l3) + l1 * l3y * Legendre4(l1 - l3) + l1 * l3 * Legendre4x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p6_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre4(l1 - l3) + l1 * l3y * Legendre4(l1 - l3) + l1 * l3 * Legendre4x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p6_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre4(l2 - l1));
-    }
-
-    static double gradleg_tri_p6_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre4(l2 - l1));
-    }
-
-    static double gradleg_tri_p6_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre4(l2 - l1) + l2 * l1x * Legendre4(l2 - l1) + l2 * l1 * Legendre4x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p6_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre4(l2 - l1) + l2 * l1x * Legendre4(l2 - l1) + l2 * l1 * Legendre4x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p6_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre4(l2 - l1) + l2 * l1y * Legendre4(l2 - l1) + l2 * l1 * Legendre4x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p6_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre4(l2 - l1) + l2 * l1y * Legendre4(l2 - l1) + l2 * l1 * Legendre4x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 6 */
-
-    static double gradleg_tri_b1_b4_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b4_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b4_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b4_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b4_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b4_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b4_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b4_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b4_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b4_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b4_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b4_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 7 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 7*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p7_e1_a(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi6(l3 - l2) + l3 * l2x * phi6(l3 - l2) + l3 * l2 * phi6x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e1_b(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi6(l3 - l2) + l3 * l2y * phi6(l3 - l2) + l3 * l2 * phi6x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi6(l3 - l2); kerx = phi6x(l3 - l2) * (l3x - l2x); kerxx = phi6xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e1_ay(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi6(l3 - l2); kerx = phi6x(l3 - l2) * (l3x - l2x);
-     kery = phi6x(l3 - l2) * (l3y - l2y); kerxy = phi6xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e1_bx(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi6(l3 - l2); kerx = phi6x(l3 - l2) * (l3x - l2x);
-     kery = phi6x(l3 - l2) * (l3y - l2y); kerxy = phi6xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi6(l3 - l2); kery = phi6x(l3 - l2) * (l3y - l2y); keryy = phi6xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p7_e2_a(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi6(l1 - l3) + l1 * l3x * phi6(l1 - l3) + l1 * l3 * phi6x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e2_b(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi6(l1 - l3) + l1 * l3y * phi6(l1 - l3) + l1 * l3 * phi6x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi6(l1 - l3); kerx = phi6x(l1 - l3) * (l1x - l3x); kerxx = phi6xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e2_ay(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi6(l1 - l3); kerx = phi6x(l1 - l3) * (l1x - l3x);
-     kery = phi6x(l1 - l3) * (l1y - l3y); kerxy = phi6xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e2_bx(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi6(l1 - l3); kerx = phi6x(l1 - l3) * (l1x - l3x);
-     kery = phi6x(l1 - l3) * (l1y - l3y); kerxy = phi6xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi6(l1 - l3); kery = phi6x(l1 - l3) * (l1y - l3y); keryy = phi6xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p7_e3_a(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi6(l2 - l1) + l2 * l1x * phi6(l2 - l1) + l2 * l1 * phi6x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e3_b(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi6(l2 - l1) + l2 * l1y * phi6(l2 - l1) + l2 * l1 * phi6x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi6(l2 - l1); kerx = phi6x(l2 - l1) * (l2x - l1x); kerxx = phi6xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e3_ay(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi6(l2 - l1); kerx = phi6x(l2 - l1) * (l2x - l1x);
-     kery = phi6x(l2 - l1) * (l2y - l1y); kerxy = phi6xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e3_bx(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi6(l2 - l1); kerx = phi6x(l2 - l1) * (l2x - l1x);
-     kery = phi6x(l2 - l1) * (l2y - l1y); kerxy = phi6xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p7_e3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi6(l2 - l1); kery = phi6x(l2 - l1) * (l2y - l1y); keryy = phi6xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 7 */
-
-     // EDGE 1
-    static double gradleg_tri_p7_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre5(l3 - l2));
-    }
-
-    static double gradleg_tri_p7_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre5(l3 - l2));
-    }
-
-    static double gradleg_tri_p7_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre5(l3 - l2) + l3 * l2x * Legendre5(l3 - l2) + l3 * l2 * Legendre5x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p7_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre5(l3 - l2) + l3 * l2x * Legendre5(l3 - l2) + l3 * l2 * Legendre5x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p7_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre5(l3 - l2) + l3 * l2y * Legendre5(l3 - l2) + l3 * l2 * Legendre5x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p7_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre5(l3 - l2) + l3 * l2y * Legendre5(l3 - l2) + l3 * l2 * Legendre5x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p7_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre5(l1 - l3));
-    }
-
-    static double gradleg_tri_p7_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre5(l1 - l3));
-    }
-
-    static double gradleg_tri_p7_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre5(l1 - l3) + l1 * l3x * Legendre5(l1 - l3) + l1 * l3 * Legendre5x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p7_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre5(l1 - l3) + l1 * l3x * Legendre5(l1 - l3) + l1 * l3 * Legendre5x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p7_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre5(l1 - l3) + l1 * l3y * Legendre5(l1 - l3) + l1 * l3 * Legendre5x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p7_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre5(l1 - l3) + l1 * l3y * Legendre5(l1 - l3) + l1 * l3 * Legendre5x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p7_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre5(l2 - l1));
-    }
-
-    static double gradleg_tri_p7_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre5(l2 - l1));
-    }
-
-    static double gradleg_tri_p7_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre5(l2 - l1) + l2 * l1x * Legendre5(l2 - l1) + l2 * l1 * Legendre5x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p7_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre5(l2 - l1) + l2 * l1x * Legendre5(l2 - l1) + l2 * l1 * Legendre5x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p7_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre5(l2 - l1) + l2 * l1y * Legendre5(l2 - l1) + l2 * l1 * Legendre5x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p7_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre5(l2 - l1) + l2 * l1y * Legendre5(l2 - l1) + l2 * l1 * Legendre5x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 7 */
-
-    static double gradleg_tri_b1_b5_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b5_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b5_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b5_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b5_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b5_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b5_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b5_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b5_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b5_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b5_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b5_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b4_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b4_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b4_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b4_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b4_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b4_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b4_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 8 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 8*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p8_e1_a_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi7(l3 - l2) + l3 * l2x * phi7(l3 - l2) + l3 * l2 * phi7x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e1_b_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi7(l3 - l2) + l3 * l2y * phi7(l3 - l2) + l3 * l2 * phi7x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e1_ax_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi7(l3 - l2); kerx = phi7x(l3 - l2) * (l3x - l2x); kerxx = phi7xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e1_ay_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi7(l3 - l2); kerx = phi7x(l3 - l2) * (l3x - l2x);
-     kery = phi7x(l3 - l2) * (l3y - l2y); kerxy = phi7xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e1_bx_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi7(l3 - l2); kerx = phi7x(l3 - l2) * (l3x - l2x);
-     kery = phi7x(l3 - l2) * (l3y - l2y); kerxy = phi7xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e1_by_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi7(l3 - l2); kery = phi7x(l3 - l2) * (l3y - l2y); keryy = phi7xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e1_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e1_by_0(x, y));
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p8_e2_a_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi7(l1 - l3) + l1 * l3x * phi7(l1 - l3) + l1 * l3 * phi7x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e2_b_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi7(l1 - l3) + l1 * l3y * phi7(l1 - l3) + l1 * l3 * phi7x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e2_ax_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi7(l1 - l3); kerx = phi7x(l1 - l3) * (l1x - l3x); kerxx = phi7xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e2_ay_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi7(l1 - l3); kerx = phi7x(l1 - l3) * (l1x - l3x);
-     kery = phi7x(l1 - l3) * (l1y - l3y); kerxy = phi7xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e2_bx_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi7(l1 - l3); kerx = phi7x(l1 - l3) * (l1x - l3x);
-     kery = phi7x(l1 - l3) * (l1y - l3y); kerxy = phi7xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e2_by_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi7(l1 - l3); kery = phi7x(l1 - l3) * (l1y - l3y); keryy = phi7xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e2_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e2_by_0(x, y));
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p8_e3_a_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi7(l2 - l1) + l2 * l1x * phi7(l2 - l1) + l2 * l1 * phi7x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e3_b_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi7(l2 - l1) + l2 * l1y * phi7(l2 - l1) + l2 * l1 * phi7x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e3_ax_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi7(l2 - l1); kerx = phi7x(l2 - l1) * (l2x - l1x); kerxx = phi7xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e3_ay_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi7(l2 - l1); kerx = phi7x(l2 - l1) * (l2x - l1x);
-     kery = phi7x(l2 - l1) * (l2y - l1y); kerxy = phi7xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e3_bx_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi7(l2 - l1); kerx = phi7x(l2 - l1) * (l2x - l1x);
-     kery = phi7x(l2 - l1) * (l2y - l1y); kerxy = phi7xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p8_e3_by_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi7(l2 - l1); kery = phi7x(l2 - l1) * (l2y - l1y); keryy = phi7xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p8_e3_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p8_e3_by_0(x, y));
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 8 */
-
-     // EDGE 1
-    static double gradleg_tri_p8_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre6(l3 - l2));
-    }
-
-    static double gradleg_tri_p8_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre6(l3 - l2));
-    }
-
-    static double gradleg_tri_p8_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre6(l3 - l2) + l3 * l2x * Legendre6(l3 - l2) + l3 * l2 * Legendre6x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p8_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre6(l3 - l2) + l3 * l2x * Legendre6(l3 - l2) + l3 * l2 * Legendre6x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p8_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre6(l3 - l2) + l3 * l2y * Legendre6(l3 - l2) + l3 * l2 * Legendre6x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p8_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre6(l3 - l2) + l3 * l2y * Legendre6(l3 - l2) + l3 * l2 * Legendre6x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p8_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre6(l1 - l3));
-    }
-
-    static double gradleg_tri_p8_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre6(l1 - l3));
-    }
-
-    static double gradleg_tri_p8_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre6(l1 - l3) + l1 * l3x * Legendre6(l1 - l3) + l1 * l3 * Legendre6x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p8_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre6(l1 - l3) + l1 * l3x * Legendre6(l1 - l3) + l1 * l3 * Legendre6x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p8_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre6(l1 - l3) + l1 * l3y * Legendre6(l1 - l3) + l1 * l3 * Legendre6x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p8_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre6(l1 - l3) + l1 * l3y * Legendre6(l1 - l3) + l1 * l3 * Legendre6x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p8_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre6(l2 - l1));
-    }
-
-    static double gradleg_tri_p8_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre6(l2 - l1));
-    }
-
-    static double gradleg_tri_p8_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre6(l2 - l1) + l2 * l1x * Legendre6(l2 - l1) + l2 * l1 * Legendre6x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p8_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre6(l2 - l1) + l2 * l1x * Legendre6(l2 - l1) + l2 * l1 * Legendre6x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p8_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre6(l2 - l1) + l2 * l1y * Legendre6(l2 - l1) + l2 * l1 * Legendre6x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p8_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre6(l2 - l1) + l2 * l1y * Legendre6(l2 - l1) + l2 * l1 * Legendre6x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 8 */
-
-    static double gradleg_tri_b1_b6_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b6_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b6_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b6_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b6_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b6_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b6_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b6_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b6_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b6_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b6_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b6_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b5_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b5_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b5_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b5_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b5_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b5_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b5_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b4_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b4_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b4_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b4_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b4_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b4_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b4_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 9 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 9*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p9_e1_a(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi8(l3 - l2) + l3 * l2x * phi8(l3 - l2) + l3 * l2 * phi8x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e1_b(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi8(l3 - l2) + l3 * l2y * phi8(l3 - l2) + l3 * l2 * phi8x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi8(l3 - l2); kerx = phi8x(l3 - l2) * (l3x - l2x); kerxx = phi8xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e1_ay(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi8(l3 - l2); kerx = phi8x(l3 - l2) * (l3x - l2x);
-     kery = phi8x(l3 - l2) * (l3y - l2y); kerxy = phi8xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e1_bx(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi8(l3 - l2); kerx = phi8x(l3 - l2) * (l3x - l2x);
-     kery = phi8x(l3 - l2) * (l3y - l2y); kerxy = phi8xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi8(l3 - l2); kery = phi8x(l3 - l2) * (l3y - l2y); keryy = phi8xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p9_e2_a(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi8(l1 - l3) + l1 * l3x * phi8(l1 - l3) + l1 * l3 * phi8x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e2_b(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi8(l1 - l3) + l1 * l3y * phi8(l1 - l3) + l1 * l3 * phi8x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi8(l1 - l3); kerx = phi8x(l1 - l3) * (l1x - l3x); kerxx = phi8xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e2_ay(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi8(l1 - l3); kerx = phi8x(l1 - l3) * (l1x - l3x);
-     kery = phi8x(l1 - l3) * (l1y - l3y); kerxy = phi8xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e2_bx(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi8(l1 - l3); kerx = phi8x(l1 - l3) * (l1x - l3x);
-     kery = phi8x(l1 - l3) * (l1y - l3y); kerxy = phi8xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi8(l1 - l3); kery = phi8x(l1 - l3) * (l1y - l3y); keryy = phi8xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p9_e3_a(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi8(l2 - l1) + l2 * l1x * phi8(l2 - l1) + l2 * l1 * phi8x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e3_b(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi8(l2 - l1) + l2 * l1y * phi8(l2 - l1) + l2 * l1 * phi8x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi8(l2 - l1); kerx = phi8x(l2 - l1) * (l2x - l1x); kerxx = phi8xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e3_ay(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi8(l2 - l1); kerx = phi8x(l2 - l1) * (l2x - l1x);
-     kery = phi8x(l2 - l1) * (l2y - l1y); kerxy = phi8xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e3_bx(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi8(l2 - l1); kerx = phi8x(l2 - l1) * (l2x - l1x);
-     kery = phi8x(l2 - l1) * (l2y - l1y); kerxy = phi8xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p9_e3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi8(l2 - l1); kery = phi8x(l2 - l1) * (l2y - l1y); keryy = phi8xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 9 */
-
-     // EDGE 1
-    static double gradleg_tri_p9_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre7(l3 - l2));
-    }
-
-    static double gradleg_tri_p9_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre7(l3 - l2));
-    }
-
-    static double gradleg_tri_p9_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre7(l3 - l2) + l3 * l2x * Legendre7(l3 - l2) + l3 * l2 * Legendre7x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p9_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre7(l3 - l2) + l3 * l2x * Legendre7(l3 - l2) + l3 * l2 * Legendre7x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p9_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre7(l3 - l2) + l3 * l2y * Legendre7(l3 - l2) + l3 * l2 * Legendre7x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p9_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre7(l3 - l2) + l3 * l2y * Legendre7(l3 - l2) + l3 * l2 * Legendre7x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p9_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre7(l1 - l3));
-    }
-
-    static double gradleg_tri_p9_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre7(l1 - l3));
-    }
-
-    static double gradleg_tri_p9_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre7(l1 - l3) + l1 * l3x * Legendre7(l1 - l3) + l1 * l3 * Legendre7x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p9_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre7(l1 - l3) + l1 * l3x * Legendre7(l1 - l3) + l1 * l3 * Legendre7x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p9_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre7(l1 - l3) + l1 * l3y * Legendre7(l1 - l3) + l1 * l3 * Legendre7x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p9_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre7(l1 - l3) + l1 * l3y * Legendre7(l1 - l3) + l1 * l3 * Legendre7x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p9_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre7(l2 - l1));
-    }
-
-    static double gradleg_tri_p9_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre7(l2 - l1));
-    }
-
-    static double gradleg_tri_p9_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre7(l2 - l1) + l2 * l1x * Legendre7(l2 - l1) + l2 * l1 * Legendre7x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p9_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre7(l2 - l1) + l2 * l1x * Legendre7(l2 - l1) + l2 * l1 * Legendre7x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p9_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre7(l2 - l1) + l2 * l1y * Legendre7(l2 - l1) + l2 * l1 * Legendre7x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p9_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre7(l2 - l1) + l2 * l1y * Legendre7(l2 - l1) + l2 * l1 * Legendre7x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 9 */
-
-    static double gradleg_tri_b1_b7_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b7_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b7_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre6x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b7_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b7_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre6x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b7_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b7_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b7_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b7_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre6x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b7_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b7_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre6x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b7_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b6_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b6_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b6_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b6_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b6_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b6_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b6_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b5_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b5_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b5_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b5_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b5_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b5_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b5_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b4_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b4_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b4_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b4_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b4_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b4_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b4_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b7_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre6x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b7_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre6x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b7_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b7_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre6x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b7_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre6x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b7_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    ///////////////////////////////// ORDER 10 //////////////////////////////////
-
-    /* EDGE FUNCTIONS - order 10*/
-
-     /* EDGE 1 */
-
-    static double gradleg_tri_p10_e1_a_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return  (l3x * l2 * phi9(l3 - l2) + l3 * l2x * phi9(l3 - l2) + l3 * l2 * phi9x(l3 - l2) * (l3x - l2x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_a_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e1_b_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return  (l3y * l2 * phi9(l3 - l2) + l3 * l2y * phi9(l3 - l2) + l3 * l2 * phi9x(l3 - l2) * (l3y - l2y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_b_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e1_ax_0(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     double ker, kerx, kerxx;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     ker = phi9(l3 - l2); kerx = phi9x(l3 - l2) * (l3x - l2x); kerxx = phi9xx(l3 - l2) * sqr(l3x - l2x);
-     return  (2.0 * l3x * l2x * ker + 2.0 * l3x * l2 * kerx + 2.0 * l3 * l2x * kerx + l3 * l2 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e1_ay_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi9(l3 - l2); kerx = phi9x(l3 - l2) * (l3x - l2x);
-     kery = phi9x(l3 - l2) * (l3y - l2y); kerxy = phi9xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e1_bx_0(double x, double y)
-    {
-     double l3, l3x, l3y, l2, l2x, l2y;
-     double ker, kerx, kery, kerxy;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-      l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-     ker = phi9(l3 - l2); kerx = phi9x(l3 - l2) * (l3x - l2x);
-     kery = phi9x(l3 - l2) * (l3y - l2y); kerxy = phi9xx(l3 - l2) * (l3x - l2x) * (l3y - l2y);
-     return  (l3x * l2y * ker + l3y * l2x * ker + l3x * l2 * kery + l3 * l2x * kery + l3y * l2 * kerx + l3 * l2y * kerx +  l3 * l2 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e1_by_0(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     double ker, kery, keryy;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     ker = phi9(l3 - l2); kery = phi9x(l3 - l2) * (l3y - l2y); keryy = phi9xx(l3 - l2) * sqr(l3y - l2y);
-     return  (2.0 * l3y * l2y * ker + 2.0 * l3y * l2 * kery + 2.0 * l3 * l2y * kery + l3 * l2 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e1_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e1_by_0(x, y));
-    }
-
-     /* EDGE 2 */
-
-    static double gradleg_tri_p10_e2_a_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return  (l1x * l3 * phi9(l1 - l3) + l1 * l3x * phi9(l1 - l3) + l1 * l3 * phi9x(l1 - l3) * (l1x - l3x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_a_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e2_b_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return  (l1y * l3 * phi9(l1 - l3) + l1 * l3y * phi9(l1 - l3) + l1 * l3 * phi9x(l1 - l3) * (l1y - l3y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_b_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e2_ax_0(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     double ker, kerx, kerxx;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     ker = phi9(l1 - l3); kerx = phi9x(l1 - l3) * (l1x - l3x); kerxx = phi9xx(l1 - l3) * sqr(l1x - l3x);
-     return  (2.0 * l1x * l3x * ker + 2.0 * l1x * l3 * kerx + 2.0 * l1 * l3x * kerx + l1 * l3 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e2_ay_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi9(l1 - l3); kerx = phi9x(l1 - l3) * (l1x - l3x);
-     kery = phi9x(l1 - l3) * (l1y - l3y); kerxy = phi9xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e2_bx_0(double x, double y)
-    {
-     double l1, l1x, l1y, l3, l3x, l3y;
-     double ker, kerx, kery, kerxy;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-      l3 = lambda3(x, y); l3x = lambda3x(x, y); l3y = lambda3y(x, y);
-     ker = phi9(l1 - l3); kerx = phi9x(l1 - l3) * (l1x - l3x);
-     kery = phi9x(l1 - l3) * (l1y - l3y); kerxy = phi9xx(l1 - l3) * (l1x - l3x) * (l1y - l3y);
-     return  (l1x * l3y * ker + l1y * l3x * ker + l1x * l3 * kery + l1 * l3x * kery + l1y * l3 * kerx + l1 * l3y * kerx +  l1 * l3 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e2_by_0(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     double ker, kery, keryy;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     ker = phi9(l1 - l3); kery = phi9x(l1 - l3) * (l1y - l3y); keryy = phi9xx(l1 - l3) * sqr(l1y - l3y);
-     return  (2.0 * l1y * l3y * ker + 2.0 * l1y * l3 * kery + 2.0 * l1 * l3y * kery + l1 * l3 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e2_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e2_by_0(x, y));
-    }
-
-     /* EDGE 3 */
-
-    static double gradleg_tri_p10_e3_a_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return  (l2x * l1 * phi9(l2 - l1) + l2 * l1x * phi9(l2 - l1) + l2 * l1 * phi9x(l2 - l1) * (l2x - l1x)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_a_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_a_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e3_b_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return  (l2y * l1 * phi9(l2 - l1) + l2 * l1y * phi9(l2 - l1) + l2 * l1 * phi9x(l2 - l1) * (l2y - l1y)) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_b_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_b_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e3_ax_0(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     double ker, kerx, kerxx;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     ker = phi9(l2 - l1); kerx = phi9x(l2 - l1) * (l2x - l1x); kerxx = phi9xx(l2 - l1) * sqr(l2x - l1x);
-     return  (2.0 * l2x * l1x * ker + 2.0 * l2x * l1 * kerx + 2.0 * l2 * l1x * kerx + l2 * l1 * kerxx) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_ax_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_ax_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e3_ay_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi9(l2 - l1); kerx = phi9x(l2 - l1) * (l2x - l1x);
-     kery = phi9x(l2 - l1) * (l2y - l1y); kerxy = phi9xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_ay_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_ay_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e3_bx_0(double x, double y)
-    {
-     double l2, l2x, l2y, l1, l1x, l1y;
-     double ker, kerx, kery, kerxy;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l2y = lambda2y(x, y);
-      l1 = lambda1(x, y); l1x = lambda1x(x, y); l1y = lambda1y(x, y);
-     ker = phi9(l2 - l1); kerx = phi9x(l2 - l1) * (l2x - l1x);
-     kery = phi9x(l2 - l1) * (l2y - l1y); kerxy = phi9xx(l2 - l1) * (l2x - l1x) * (l2y - l1y);
-     return  (l2x * l1y * ker + l2y * l1x * ker + l2x * l1 * kery + l2 * l1x * kery + l2y * l1 * kerx + l2 * l1y * kerx +  l2 * l1 * kerxy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_bx_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_bx_0(x, y));
-    }
-
-    static double gradleg_tri_p10_e3_by_0(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     double ker, kery, keryy;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     ker = phi9(l2 - l1); kery = phi9x(l2 - l1) * (l2y - l1y); keryy = phi9xx(l2 - l1) * sqr(l2y - l1y);
-     return  (2.0 * l2y * l1y * ker + 2.0 * l2y * l1 * kery + 2.0 * l2 * l1y * kery + l2 * l1 * keryy) / 1.0000000000000;
-    }
-
-    static double gradleg_tri_p10_e3_by_1(double x, double y)
-    {
-     return -(gradleg_tri_p10_e3_by_0(x, y));
-    }
-
-    /* BUBBLE */
-
-    /* Edge-based BUBBLE - order 10 */
-
-     // EDGE 1
-    static double gradleg_tri_p10_b1_a(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n11 * (l3 * l2 * Legendre8(l3 - l2));
-    }
-
-    static double gradleg_tri_p10_b1_b(double x, double y)
-    {
-     double l3, l2;
-     l3 = lambda3(x, y); l2 = lambda2(x, y);
-     return n12 * (l3 * l2 * Legendre8(l3 - l2));
-    }
-
-    static double gradleg_tri_p10_b1_ax(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n11 * (l3x * l2 * Legendre8(l3 - l2) + l3 * l2x * Legendre8(l3 - l2) + l3 * l2 * Legendre8x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p10_b1_bx(double x, double y)
-    {
-     double l3, l3x, l2, l2x;
-     l3 = lambda3(x, y); l3x = lambda3x(x, y); l2 = lambda2(x, y); l2x = lambda2x(x, y);
-     return n12 * (l3x * l2 * Legendre8(l3 - l2) + l3 * l2x * Legendre8(l3 - l2) + l3 * l2 * Legendre8x(l3 - l2) * (l3x - l2x));
-    }
-
-    static double gradleg_tri_p10_b1_ay(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n11 * (l3y * l2 * Legendre8(l3 - l2) + l3 * l2y * Legendre8(l3 - l2) + l3 * l2 * Legendre8x(l3 - l2) * (l3y - l2y));
-    }
-
-    static double gradleg_tri_p10_b1_by(double x, double y)
-    {
-     double l3, l3y, l2, l2y;
-     l3 = lambda3(x, y); l3y = lambda3y(x, y); l2 = lambda2(x, y); l2y = lambda2y(x, y);
-     return n12 * (l3y * l2 * Legendre8(l3 - l2) + l3 * l2y * Legendre8(l3 - l2) + l3 * l2 * Legendre8x(l3 - l2) * (l3y - l2y));
-    }
-
-     // EDGE 2
-    static double gradleg_tri_p10_b2_a(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n21 * (l1 * l3 * Legendre8(l1 - l3));
-    }
-
-    static double gradleg_tri_p10_b2_b(double x, double y)
-    {
-     double l1, l3;
-     l1 = lambda1(x, y); l3 = lambda3(x, y);
-     return n22 * (l1 * l3 * Legendre8(l1 - l3));
-    }
-
-    static double gradleg_tri_p10_b2_ax(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n21 * (l1x * l3 * Legendre8(l1 - l3) + l1 * l3x * Legendre8(l1 - l3) + l1 * l3 * Legendre8x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p10_b2_bx(double x, double y)
-    {
-     double l1, l1x, l3, l3x;
-     l1 = lambda1(x, y); l1x = lambda1x(x, y); l3 = lambda3(x, y); l3x = lambda3x(x, y);
-     return n22 * (l1x * l3 * Legendre8(l1 - l3) + l1 * l3x * Legendre8(l1 - l3) + l1 * l3 * Legendre8x(l1 - l3) * (l1x - l3x));
-    }
-
-    static double gradleg_tri_p10_b2_ay(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n21 * (l1y * l3 * Legendre8(l1 - l3) + l1 * l3y * Legendre8(l1 - l3) + l1 * l3 * Legendre8x(l1 - l3) * (l1y - l3y));
-    }
-
-    static double gradleg_tri_p10_b2_by(double x, double y)
-    {
-     double l1, l1y, l3, l3y;
-     l1 = lambda1(x, y); l1y = lambda1y(x, y); l3 = lambda3(x, y); l3y = lambda3y(x, y);
-     return n22 * (l1y * l3 * Legendre8(l1 - l3) + l1 * l3y * Legendre8(l1 - l3) + l1 * l3 * Legendre8x(l1 - l3) * (l1y - l3y));
-    }
-
-     // EDGE 3
-    static double gradleg_tri_p10_b3_a(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n31 * (l2 * l1 * Legendre8(l2 - l1));
-    }
-
-    static double gradleg_tri_p10_b3_b(double x, double y)
-    {
-     double l2, l1;
-     l2 = lambda2(x, y); l1 = lambda1(x, y);
-     return n32 * (l2 * l1 * Legendre8(l2 - l1));
-    }
-
-    static double gradleg_tri_p10_b3_ax(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n31 * (l2x * l1 * Legendre8(l2 - l1) + l2 * l1x * Legendre8(l2 - l1) + l2 * l1 * Legendre8x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p10_b3_bx(double x, double y)
-    {
-     double l2, l2x, l1, l1x;
-     l2 = lambda2(x, y); l2x = lambda2x(x, y); l1 = lambda1(x, y); l1x = lambda1x(x, y);
-     return n32 * (l2x * l1 * Legendre8(l2 - l1) + l2 * l1x * Legendre8(l2 - l1) + l2 * l1 * Legendre8x(l2 - l1) * (l2x - l1x));
-    }
-
-    static double gradleg_tri_p10_b3_ay(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n31 * (l2y * l1 * Legendre8(l2 - l1) + l2 * l1y * Legendre8(l2 - l1) + l2 * l1 * Legendre8x(l2 - l1) * (l2y - l1y));
-    }
-
-    static double gradleg_tri_p10_b3_by(double x, double y)
-    {
-     double l2, l2y, l1, l1y;
-     l2 = lambda2(x, y); l2y = lambda2y(x, y); l1 = lambda1(x, y); l1y = lambda1y(x, y);
-     return n32 * (l2y * l1 * Legendre8(l2 - l1) + l2 * l1y * Legendre8(l2 - l1) + l2 * l1 * Legendre8x(l2 - l1) * (l2y - l1y));
-    }
-
-    /* Genuine BUBBLE - order 10 */
-
-    static double gradleg_tri_b1_b8_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre7(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b8_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b8_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre7(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre7x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b8_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b8_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre7(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre7x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b8_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b8_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre7(l2 - l1);
-    }
-
-    static double gradleg_tri_b1_b8_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b8_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre7(l2 - l1);
-     L1x = Legendre0x(l3 - l2) * (l3x - l2x); L2x = Legendre7x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b1_b8_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b1_b8_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre0(l3 - l2); L2 = Legendre7(l2 - l1);
-     L1y = Legendre0x(l3 - l2) * (l3y - l2y); L2y = Legendre7x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b1_b8_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b7_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre6x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b7_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre6x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b7_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    static double gradleg_tri_b2_b7_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1x = Legendre1x(l3 - l2) * (l3x - l2x); L2x = Legendre6x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b2_b7_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b2_b7_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre1(l3 - l2); L2 = Legendre6(l2 - l1);
-     L1y = Legendre1x(l3 - l2) * (l3y - l2y); L2y = Legendre6x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b2_b7_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b6_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b6_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b6_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    static double gradleg_tri_b3_b6_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1x = Legendre2x(l3 - l2) * (l3x - l2x); L2x = Legendre5x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b3_b6_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b3_b6_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre2(l3 - l2); L2 = Legendre5(l2 - l1);
-     L1y = Legendre2x(l3 - l2) * (l3y - l2y); L2y = Legendre5x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b3_b6_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b5_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b5_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b5_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    static double gradleg_tri_b4_b5_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1x = Legendre3x(l3 - l2) * (l3x - l2x); L2x = Legendre4x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b4_b5_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b4_b5_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre3(l3 - l2); L2 = Legendre4(l2 - l1);
-     L1y = Legendre3x(l3 - l2) * (l3y - l2y); L2y = Legendre4x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b4_b5_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b4_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b4_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b4_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    static double gradleg_tri_b5_b4_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1x = Legendre4x(l3 - l2) * (l3x - l2x); L2x = Legendre3x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b5_b4_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b5_b4_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre4(l3 - l2); L2 = Legendre3(l2 - l1);
-     L1y = Legendre4x(l3 - l2) * (l3y - l2y); L2y = Legendre3x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b5_b4_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b3_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b3_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b3_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    static double gradleg_tri_b6_b3_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1x = Legendre5x(l3 - l2) * (l3x - l2x); L2x = Legendre2x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b6_b3_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b6_b3_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre5(l3 - l2); L2 = Legendre2(l2 - l1);
-     L1y = Legendre5x(l3 - l2) * (l3y - l2y); L2y = Legendre2x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b6_b3_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b7_b2_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre6x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b7_b2_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre6x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b7_b2_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    static double gradleg_tri_b7_b2_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1x = Legendre6x(l3 - l2) * (l3x - l2x); L2x = Legendre1x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b7_b2_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b7_b2_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre6(l3 - l2); L2 = Legendre1(l2 - l1);
-     L1y = Legendre6x(l3 - l2) * (l3y - l2y); L2y = Legendre1x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b7_b2_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_1_a(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre7(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b8_b1_1_b(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_1_ax(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre7(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre7x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b8_b1_1_bx(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_1_ay(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre7(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre7x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b8_b1_1_by(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_2_b(double x, double y)
-    {
-     double l1, l2, l3;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     return l1 * l2 * l3 * Legendre7(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    static double gradleg_tri_b8_b1_2_a(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_2_bx(double x, double y)
-    {
-     double l1, l2, l3, l1x, l2x, l3x, L1, L2, L1x, L2x;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-     L1 = Legendre7(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1x = Legendre7x(l3 - l2) * (l3x - l2x); L2x = Legendre0x(l2 - l1) * (l2x - l1x);
-     return l1x * l2 *  l3 *  L1 *  L2 +          l1 * l2x * l3 *  L1 *  L2 +          l1 * l2 *  l3x * L1 *  L2 +          l1 * l2 *  l3 *  L1x * L2 +          l1 * l2 *  l3 *  L1 *  L2x;
-    }
-
-    static double gradleg_tri_b8_b1_2_ax(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static double gradleg_tri_b8_b1_2_by(double x, double y)
-    {
-     double l1, l2, l3, l1y, l2y, l3y, L1, L2, L1y, L2y;
-     l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-     l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-     L1 = Legendre7(l3 - l2); L2 = Legendre0(l2 - l1);
-     L1y = Legendre7x(l3 - l2) * (l3y - l2y); L2y = Legendre0x(l2 - l1) * (l2y - l1y);
-     return l1y * l2 *  l3 *  L1 *  L2 +          l1 * l2y * l3 *  L1 *  L2 +          l1 * l2 *  l3y * L1 *  L2 +          l1 * l2 *  l3 *  L1y * L2 +          l1 * l2 *  l3 *  L1 *  L2y;
-    }
-
-    static double gradleg_tri_b8_b1_2_ay(double x, double y)
-    {
-     return 0.0;
-    }
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_a[] =
-    {
-     gradleg_tri_p0_e1_a_0, gradleg_tri_p0_e1_a_1, gradleg_tri_p0_e2_a_0,  gradleg_tri_p0_e2_a_1, gradleg_tri_p0_e3_a_0, gradleg_tri_p0_e3_a_1,
-     gradleg_tri_p1_e1_a,   gradleg_tri_p1_e1_a,   gradleg_tri_p1_e2_a,    gradleg_tri_p1_e2_a,   gradleg_tri_p1_e3_a,   gradleg_tri_p1_e3_a,
-     gradleg_tri_p2_e1_a_0, gradleg_tri_p2_e1_a_1, gradleg_tri_p2_e2_a_0,  gradleg_tri_p2_e2_a_1, gradleg_tri_p2_e3_a_0, gradleg_tri_p2_e3_a_1,
-     gradleg_tri_p3_e1_a,   gradleg_tri_p3_e1_a,   gradleg_tri_p3_e2_a,    gradleg_tri_p3_e2_a,   gradleg_tri_p3_e3_a,   gradleg_tri_p3_e3_a,
-     gradleg_tri_p4_e1_a_0, gradleg_tri_p4_e1_a_1, gradleg_tri_p4_e2_a_0,  gradleg_tri_p4_e2_a_1, gradleg_tri_p4_e3_a_0, gradleg_tri_p4_e3_a_1,
-     gradleg_tri_p5_e1_a,   gradleg_tri_p5_e1_a,   gradleg_tri_p5_e2_a,    gradleg_tri_p5_e2_a,   gradleg_tri_p5_e3_a,   gradleg_tri_p5_e3_a,
-     gradleg_tri_p6_e1_a_0, gradleg_tri_p6_e1_a_1, gradleg_tri_p6_e2_a_0,  gradleg_tri_p6_e2_a_1, gradleg_tri_p6_e3_a_0, gradleg_tri_p6_e3_a_1,
-     gradleg_tri_p7_e1_a,   gradleg_tri_p7_e1_a,   gradleg_tri_p7_e2_a,    gradleg_tri_p7_e2_a,   gradleg_tri_p7_e3_a,   gradleg_tri_p7_e3_a,
-     gradleg_tri_p8_e1_a_0, gradleg_tri_p8_e1_a_1, gradleg_tri_p8_e2_a_0,  gradleg_tri_p8_e2_a_1, gradleg_tri_p8_e3_a_0, gradleg_tri_p8_e3_a_1,
-     gradleg_tri_p9_e1_a,   gradleg_tri_p9_e1_a,   gradleg_tri_p9_e2_a,    gradleg_tri_p9_e2_a,   gradleg_tri_p9_e3_a,   gradleg_tri_p9_e3_a,
-     gradleg_tri_p10_e1_a_0, gradleg_tri_p10_e1_a_1, gradleg_tri_p10_e2_a_0,  gradleg_tri_p10_e2_a_1, gradleg_tri_p10_e3_a_0, gradleg_tri_p10_e3_a_1,
-
-      gradleg_tri_p2_b1_a,   gradleg_tri_p2_b2_a,   gradleg_tri_p2_b3_a,   gradleg_tri_p3_b1_a,   gradleg_tri_p3_b2_a,   gradleg_tri_p3_b3_a,   gradleg_tri_p4_b1_a,   gradleg_tri_p4_b2_a,   gradleg_tri_p4_b3_a,   gradleg_tri_p5_b1_a,   gradleg_tri_p5_b2_a,   gradleg_tri_p5_b3_a,   gradleg_tri_p6_b1_a,   gradleg_tri_p6_b2_a,   gradleg_tri_p6_b3_a,   gradleg_tri_p7_b1_a,   gradleg_tri_p7_b2_a,   gradleg_tri_p7_b3_a,   gradleg_tri_p8_b1_a,   gradleg_tri_p8_b2_a,   gradleg_tri_p8_b3_a,   gradleg_tri_p9_b1_a,   gradleg_tri_p9_b2_a,   gradleg_tri_p9_b3_a,   gradleg_tri_p10_b1_a,   gradleg_tri_p10_b2_a,   gradleg_tri_p10_b3_a,
-
-      gradleg_tri_b1_b1_1_a, gradleg_tri_b1_b1_2_a,  gradleg_tri_b1_b2_1_a, gradleg_tri_b1_b2_2_a,  gradleg_tri_b2_b1_1_a, gradleg_tri_b2_b1_2_a,  gradleg_tri_b1_b3_1_a, gradleg_tri_b1_b3_2_a,  gradleg_tri_b2_b2_1_a, gradleg_tri_b2_b2_2_a,  gradleg_tri_b3_b1_1_a, gradleg_tri_b3_b1_2_a,  gradleg_tri_b1_b4_1_a, gradleg_tri_b1_b4_2_a,  gradleg_tri_b2_b3_1_a, gradleg_tri_b2_b3_2_a,  gradleg_tri_b3_b2_1_a, gradleg_tri_b3_b2_2_a,  gradleg_tri_b4_b1_1_a, gradleg_tri_b4_b1_2_a,  gradleg_tri_b1_b5_1_a, gradleg_tri_b1_b5_2_a,  gradleg_tri_b2_b4_1_a, gradleg_tri_b2_b4_2_a,  gradleg_tri_b3_b3_1_a, gradleg_tri_b3_b3_2_a,  gradleg_tri_b4_b2_1_a, gradleg_tri_b4_b2_2_a,  gradleg_tri_b5_b1_1_a, gradleg_tri_b5_b1_2_a,  gradleg_tri_b1_b6_1_a, gradleg_tri_b1_b6_2_a,  gradleg_tri_b2_b5_1_a, gradleg_tri_b2_b5_2_a,  gradleg_tri_b3_b4_1_a, gradleg_tri_b3_b4_2_a,  gradleg_tri_b4_b3_1_a, gradleg_tri_b4_b3_2_a,  gradleg_tri_b5_b2_1_a, gradleg_tri_b5_b2_2_a,  gradleg_tri_b6_b1_1_a, gradleg_tri_b6_b1_2_a,  gradleg_tri_b1_b7_1_a, gradleg_tri_b1_b7_2_a,  gradleg_tri_b2_b6_1_a, gradleg_tri_b2_b6_2_a,  gradleg_tri_b3_b5_1_a, gradleg_tri_b3_b5_2_a,  gradleg_tri_b4_b4_1_a, gradleg_tri_b4_b4_2_a,  gradleg_tri_b5_b3_1_a, gradleg_tri_b5_b3_2_a,  gradleg_tri_b6_b2_1_a, gradleg_tri_b6_b2_2_a,  gradleg_tri_b7_b1_1_a, gradleg_tri_b7_b1_2_a,  gradleg_tri_b1_b8_1_a, gradleg_tri_b1_b8_2_a,  gradleg_tri_b2_b7_1_a, gradleg_tri_b2_b7_2_a,  gradleg_tri_b3_b6_1_a, gradleg_tri_b3_b6_2_a,  gradleg_tri_b4_b5_1_a, gradleg_tri_b4_b5_2_a,  gradleg_tri_b5_b4_1_a, gradleg_tri_b5_b4_2_a,  gradleg_tri_b6_b3_1_a, gradleg_tri_b6_b3_2_a,  gradleg_tri_b7_b2_1_a, gradleg_tri_b7_b2_2_a,  gradleg_tri_b8_b1_1_a, gradleg_tri_b8_b1_2_a,
-    };
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_b[] =
-    {
-     gradleg_tri_p0_e1_b_0, gradleg_tri_p0_e1_b_1, gradleg_tri_p0_e2_b_0,  gradleg_tri_p0_e2_b_1, gradleg_tri_p0_e3_b_0, gradleg_tri_p0_e3_b_1,
-     gradleg_tri_p1_e1_b,   gradleg_tri_p1_e1_b,   gradleg_tri_p1_e2_b,    gradleg_tri_p1_e2_b,   gradleg_tri_p1_e3_b,   gradleg_tri_p1_e3_b,
-     gradleg_tri_p2_e1_b_0, gradleg_tri_p2_e1_b_1, gradleg_tri_p2_e2_b_0,  gradleg_tri_p2_e2_b_1, gradleg_tri_p2_e3_b_0, gradleg_tri_p2_e3_b_1,
-     gradleg_tri_p3_e1_b,   gradleg_tri_p3_e1_b,   gradleg_tri_p3_e2_b,    gradleg_tri_p3_e2_b,   gradleg_tri_p3_e3_b,   gradleg_tri_p3_e3_b,
-     gradleg_tri_p4_e1_b_0, gradleg_tri_p4_e1_b_1, gradleg_tri_p4_e2_b_0,  gradleg_tri_p4_e2_b_1, gradleg_tri_p4_e3_b_0, gradleg_tri_p4_e3_b_1,
-     gradleg_tri_p5_e1_b,   gradleg_tri_p5_e1_b,   gradleg_tri_p5_e2_b,    gradleg_tri_p5_e2_b,   gradleg_tri_p5_e3_b,   gradleg_tri_p5_e3_b,
-     gradleg_tri_p6_e1_b_0, gradleg_tri_p6_e1_b_1, gradleg_tri_p6_e2_b_0,  gradleg_tri_p6_e2_b_1, gradleg_tri_p6_e3_b_0, gradleg_tri_p6_e3_b_1,
-     gradleg_tri_p7_e1_b,   gradleg_tri_p7_e1_b,   gradleg_tri_p7_e2_b,    gradleg_tri_p7_e2_b,   gradleg_tri_p7_e3_b,   gradleg_tri_p7_e3_b,
-     gradleg_tri_p8_e1_b_0, gradleg_tri_p8_e1_b_1, gradleg_tri_p8_e2_b_0,  gradleg_tri_p8_e2_b_1, gradleg_tri_p8_e3_b_0, gradleg_tri_p8_e3_b_1,
-     gradleg_tri_p9_e1_b,   gradleg_tri_p9_e1_b,   gradleg_tri_p9_e2_b,    gradleg_tri_p9_e2_b,   gradleg_tri_p9_e3_b,   gradleg_tri_p9_e3_b,
-     gradleg_tri_p10_e1_b_0, gradleg_tri_p10_e1_b_1, gradleg_tri_p10_e2_b_0,  gradleg_tri_p10_e2_b_1, gradleg_tri_p10_e3_b_0, gradleg_tri_p10_e3_b_1,
-
-      gradleg_tri_p2_b1_b,   gradleg_tri_p2_b2_b,   gradleg_tri_p2_b3_b,   gradleg_tri_p3_b1_b,   gradleg_tri_p3_b2_b,   gradleg_tri_p3_b3_b,   gradleg_tri_p4_b1_b,   gradleg_tri_p4_b2_b,   gradleg_tri_p4_b3_b,   gradleg_tri_p5_b1_b,   gradleg_tri_p5_b2_b,   gradleg_tri_p5_b3_b,   gradleg_tri_p6_b1_b,   gradleg_tri_p6_b2_b,   gradleg_tri_p6_b3_b,   gradleg_tri_p7_b1_b,   gradleg_tri_p7_b2_b,   gradleg_tri_p7_b3_b,   gradleg_tri_p8_b1_b,   gradleg_tri_p8_b2_b,   gradleg_tri_p8_b3_b,   gradleg_tri_p9_b1_b,   gradleg_tri_p9_b2_b,   gradleg_tri_p9_b3_b,   gradleg_tri_p10_b1_b,   gradleg_tri_p10_b2_b,   gradleg_tri_p10_b3_b,
-
-      gradleg_tri_b1_b1_1_b, gradleg_tri_b1_b1_2_b,  gradleg_tri_b1_b2_1_b, gradleg_tri_b1_b2_2_b,  gradleg_tri_b2_b1_1_b, gradleg_tri_b2_b1_2_b,  gradleg_tri_b1_b3_1_b, gradleg_tri_b1_b3_2_b,  gradleg_tri_b2_b2_1_b, gradleg_tri_b2_b2_2_b,  gradleg_tri_b3_b1_1_b, gradleg_tri_b3_b1_2_b,  gradleg_tri_b1_b4_1_b, gradleg_tri_b1_b4_2_b,  gradleg_tri_b2_b3_1_b, gradleg_tri_b2_b3_2_b,  gradleg_tri_b3_b2_1_b, gradleg_tri_b3_b2_2_b,  gradleg_tri_b4_b1_1_b, gradleg_tri_b4_b1_2_b,  gradleg_tri_b1_b5_1_b, gradleg_tri_b1_b5_2_b,  gradleg_tri_b2_b4_1_b, gradleg_tri_b2_b4_2_b,  gradleg_tri_b3_b3_1_b, gradleg_tri_b3_b3_2_b,  gradleg_tri_b4_b2_1_b, gradleg_tri_b4_b2_2_b,  gradleg_tri_b5_b1_1_b, gradleg_tri_b5_b1_2_b,  gradleg_tri_b1_b6_1_b, gradleg_tri_b1_b6_2_b,  gradleg_tri_b2_b5_1_b, gradleg_tri_b2_b5_2_b,  gradleg_tri_b3_b4_1_b, gradleg_tri_b3_b4_2_b,  gradleg_tri_b4_b3_1_b, gradleg_tri_b4_b3_2_b,  gradleg_tri_b5_b2_1_b, gradleg_tri_b5_b2_2_b,  gradleg_tri_b6_b1_1_b, gradleg_tri_b6_b1_2_b,  gradleg_tri_b1_b7_1_b, gradleg_tri_b1_b7_2_b,  gradleg_tri_b2_b6_1_b, gradleg_tri_b2_b6_2_b,  gradleg_tri_b3_b5_1_b, gradleg_tri_b3_b5_2_b,  gradleg_tri_b4_b4_1_b, gradleg_tri_b4_b4_2_b,  gradleg_tri_b5_b3_1_b, gradleg_tri_b5_b3_2_b,  gradleg_tri_b6_b2_1_b, gradleg_tri_b6_b2_2_b,  gradleg_tri_b7_b1_1_b, gradleg_tri_b7_b1_2_b,  gradleg_tri_b1_b8_1_b, gradleg_tri_b1_b8_2_b,  gradleg_tri_b2_b7_1_b, gradleg_tri_b2_b7_2_b,  gradleg_tri_b3_b6_1_b, gradleg_tri_b3_b6_2_b,  gradleg_tri_b4_b5_1_b, gradleg_tri_b4_b5_2_b,  gradleg_tri_b5_b4_1_b, gradleg_tri_b5_b4_2_b,  gradleg_tri_b6_b3_1_b, gradleg_tri_b6_b3_2_b,  gradleg_tri_b7_b2_1_b, gradleg_tri_b7_b2_2_b,  gradleg_tri_b8_b1_1_b, gradleg_tri_b8_b1_2_b,
-    };
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_ax[] =
-    {
-     gradleg_tri_p0_e1_ax_0, gradleg_tri_p0_e1_ax_1, gradleg_tri_p0_e2_ax_0,  gradleg_tri_p0_e2_ax_1, gradleg_tri_p0_e3_ax_0, gradleg_tri_p0_e3_ax_1,
-     gradleg_tri_p1_e1_ax,   gradleg_tri_p1_e1_ax,   gradleg_tri_p1_e2_ax,    gradleg_tri_p1_e2_ax,   gradleg_tri_p1_e3_ax,   gradleg_tri_p1_e3_ax,
-     gradleg_tri_p2_e1_ax_0, gradleg_tri_p2_e1_ax_1, gradleg_tri_p2_e2_ax_0,  gradleg_tri_p2_e2_ax_1, gradleg_tri_p2_e3_ax_0, gradleg_tri_p2_e3_ax_1,
-     gradleg_tri_p3_e1_ax,   gradleg_tri_p3_e1_ax,   gradleg_tri_p3_e2_ax,    gradleg_tri_p3_e2_ax,   gradleg_tri_p3_e3_ax,   gradleg_tri_p3_e3_ax,
-     gradleg_tri_p4_e1_ax_0, gradleg_tri_p4_e1_ax_1, gradleg_tri_p4_e2_ax_0,  gradleg_tri_p4_e2_ax_1, gradleg_tri_p4_e3_ax_0, gradleg_tri_p4_e3_ax_1,
-     gradleg_tri_p5_e1_ax,   gradleg_tri_p5_e1_ax,   gradleg_tri_p5_e2_ax,    gradleg_tri_p5_e2_ax,   gradleg_tri_p5_e3_ax,   gradleg_tri_p5_e3_ax,
-     gradleg_tri_p6_e1_ax_0, gradleg_tri_p6_e1_ax_1, gradleg_tri_p6_e2_ax_0,  gradleg_tri_p6_e2_ax_1, gradleg_tri_p6_e3_ax_0, gradleg_tri_p6_e3_ax_1,
-     gradleg_tri_p7_e1_ax,   gradleg_tri_p7_e1_ax,   gradleg_tri_p7_e2_ax,    gradleg_tri_p7_e2_ax,   gradleg_tri_p7_e3_ax,   gradleg_tri_p7_e3_ax,
-     gradleg_tri_p8_e1_ax_0, gradleg_tri_p8_e1_ax_1, gradleg_tri_p8_e2_ax_0,  gradleg_tri_p8_e2_ax_1, gradleg_tri_p8_e3_ax_0, gradleg_tri_p8_e3_ax_1,
-     gradleg_tri_p9_e1_ax,   gradleg_tri_p9_e1_ax,   gradleg_tri_p9_e2_ax,    gradleg_tri_p9_e2_ax,   gradleg_tri_p9_e3_ax,   gradleg_tri_p9_e3_ax,
-     gradleg_tri_p10_e1_ax_0, gradleg_tri_p10_e1_ax_1, gradleg_tri_p10_e2_ax_0,  gradleg_tri_p10_e2_ax_1, gradleg_tri_p10_e3_ax_0, gradleg_tri_p10_e3_ax_1,
-
-      gradleg_tri_p2_b1_ax,   gradleg_tri_p2_b2_ax,   gradleg_tri_p2_b3_ax,   gradleg_tri_p3_b1_ax,   gradleg_tri_p3_b2_ax,   gradleg_tri_p3_b3_ax,   gradleg_tri_p4_b1_ax,   gradleg_tri_p4_b2_ax,   gradleg_tri_p4_b3_ax,   gradleg_tri_p5_b1_ax,   gradleg_tri_p5_b2_ax,   gradleg_tri_p5_b3_ax,   gradleg_tri_p6_b1_ax,   gradleg_tri_p6_b2_ax,   gradleg_tri_p6_b3_ax,   gradleg_tri_p7_b1_ax,   gradleg_tri_p7_b2_ax,   gradleg_tri_p7_b3_ax,   gradleg_tri_p8_b1_ax,   gradleg_tri_p8_b2_ax,   gradleg_tri_p8_b3_ax,   gradleg_tri_p9_b1_ax,   gradleg_tri_p9_b2_ax,   gradleg_tri_p9_b3_ax,   gradleg_tri_p10_b1_ax,   gradleg_tri_p10_b2_ax,   gradleg_tri_p10_b3_ax,
-
-      gradleg_tri_b1_b1_1_ax, gradleg_tri_b1_b1_2_ax,  gradleg_tri_b1_b2_1_ax, gradleg_tri_b1_b2_2_ax,  gradleg_tri_b2_b1_1_ax, gradleg_tri_b2_b1_2_ax,  gradleg_tri_b1_b3_1_ax, gradleg_tri_b1_b3_2_ax,  gradleg_tri_b2_b2_1_ax, gradleg_tri_b2_b2_2_ax,  gradleg_tri_b3_b1_1_ax, gradleg_tri_b3_b1_2_ax,  gradleg_tri_b1_b4_1_ax, gradleg_tri_b1_b4_2_ax,  gradleg_tri_b2_b3_1_ax, gradleg_tri_b2_b3_2_ax,  gradleg_tri_b3_b2_1_ax, gradleg_tri_b3_b2_2_ax,  gradleg_tri_b4_b1_1_ax, gradleg_tri_b4_b1_2_ax,  gradleg_tri_b1_b5_1_ax, gradleg_tri_b1_b5_2_ax,  gradleg_tri_b2_b4_1_ax, gradleg_tri_b2_b4_2_ax,  gradleg_tri_b3_b3_1_ax, gradleg_tri_b3_b3_2_ax,  gradleg_tri_b4_b2_1_ax, gradleg_tri_b4_b2_2_ax,  gradleg_tri_b5_b1_1_ax, gradleg_tri_b5_b1_2_ax,  gradleg_tri_b1_b6_1_ax, gradleg_tri_b1_b6_2_ax,  gradleg_tri_b2_b5_1_ax, gradleg_tri_b2_b5_2_ax,  gradleg_tri_b3_b4_1_ax, gradleg_tri_b3_b4_2_ax,  gradleg_tri_b4_b3_1_ax, gradleg_tri_b4_b3_2_ax,  gradleg_tri_b5_b2_1_ax, gradleg_tri_b5_b2_2_ax,  gradleg_tri_b6_b1_1_ax, gradleg_tri_b6_b1_2_ax,  gradleg_tri_b1_b7_1_ax, gradleg_tri_b1_b7_2_ax,  gradleg_tri_b2_b6_1_ax, gradleg_tri_b2_b6_2_ax,  gradleg_tri_b3_b5_1_ax, gradleg_tri_b3_b5_2_ax,  gradleg_tri_b4_b4_1_ax, gradleg_tri_b4_b4_2_ax,  gradleg_tri_b5_b3_1_ax, gradleg_tri_b5_b3_2_ax,  gradleg_tri_b6_b2_1_ax, gradleg_tri_b6_b2_2_ax,  gradleg_tri_b7_b1_1_ax, gradleg_tri_b7_b1_2_ax,  gradleg_tri_b1_b8_1_ax, gradleg_tri_b1_b8_2_ax,  gradleg_tri_b2_b7_1_ax, gradleg_tri_b2_b7_2_ax,  gradleg_tri_b3_b6_1_ax, gradleg_tri_b3_b6_2_ax,  gradleg_tri_b4_b5_1_ax, gradleg_tri_b4_b5_2_ax,  gradleg_tri_b5_b4_1_ax, gradleg_tri_b5_b4_2_ax,  gradleg_tri_b6_b3_1_ax, gradleg_tri_b6_b3_2_ax,  gradleg_tri_b7_b2_1_ax, gradleg_tri_b7_b2_2_ax,  gradleg_tri_b8_b1_1_ax, gradleg_tri_b8_b1_2_ax,
-    };
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_bx[] =
-    {
-     gradleg_tri_p0_e1_bx_0, gradleg_tri_p0_e1_bx_1, gradleg_tri_p0_e2_bx_0,  gradleg_tri_p0_e2_bx_1, gradleg_tri_p0_e3_bx_0, gradleg_tri_p0_e3_bx_1,
-     gradleg_tri_p1_e1_bx,   gradleg_tri_p1_e1_bx,   gradleg_tri_p1_e2_bx,    gradleg_tri_p1_e2_bx,   gradleg_tri_p1_e3_bx,   gradleg_tri_p1_e3_bx,
-     gradleg_tri_p2_e1_bx_0, gradleg_tri_p2_e1_bx_1, gradleg_tri_p2_e2_bx_0,  gradleg_tri_p2_e2_bx_1, gradleg_tri_p2_e3_bx_0, gradleg_tri_p2_e3_bx_1,
-     gradleg_tri_p3_e1_bx,   gradleg_tri_p3_e1_bx,   gradleg_tri_p3_e2_bx,    gradleg_tri_p3_e2_bx,   gradleg_tri_p3_e3_bx,   gradleg_tri_p3_e3_bx,
-     gradleg_tri_p4_e1_bx_0, gradleg_tri_p4_e1_bx_1, gradleg_tri_p4_e2_bx_0,  gradleg_tri_p4_e2_bx_1, gradleg_tri_p4_e3_bx_0, gradleg_tri_p4_e3_bx_1,
-     gradleg_tri_p5_e1_bx,   gradleg_tri_p5_e1_bx,   gradleg_tri_p5_e2_bx,    gradleg_tri_p5_e2_bx,   gradleg_tri_p5_e3_bx,   gradleg_tri_p5_e3_bx,
-     gradleg_tri_p6_e1_bx_0, gradleg_tri_p6_e1_bx_1, gradleg_tri_p6_e2_bx_0,  gradleg_tri_p6_e2_bx_1, gradleg_tri_p6_e3_bx_0, gradleg_tri_p6_e3_bx_1,
-     gradleg_tri_p7_e1_bx,   gradleg_tri_p7_e1_bx,   gradleg_tri_p7_e2_bx,    gradleg_tri_p7_e2_bx,   gradleg_tri_p7_e3_bx,   gradleg_tri_p7_e3_bx,
-     gradleg_tri_p8_e1_bx_0, gradleg_tri_p8_e1_bx_1, gradleg_tri_p8_e2_bx_0,  gradleg_tri_p8_e2_bx_1, gradleg_tri_p8_e3_bx_0, gradleg_tri_p8_e3_bx_1,
-     gradleg_tri_p9_e1_bx,   gradleg_tri_p9_e1_bx,   gradleg_tri_p9_e2_bx,    gradleg_tri_p9_e2_bx,   gradleg_tri_p9_e3_bx,   gradleg_tri_p9_e3_bx,
-     gradleg_tri_p10_e1_bx_0, gradleg_tri_p10_e1_bx_1, gradleg_tri_p10_e2_bx_0,  gradleg_tri_p10_e2_bx_1, gradleg_tri_p10_e3_bx_0, gradleg_tri_p10_e3_bx_1,
-
-      gradleg_tri_p2_b1_bx,   gradleg_tri_p2_b2_bx,   gradleg_tri_p2_b3_bx,   gradleg_tri_p3_b1_bx,   gradleg_tri_p3_b2_bx,   gradleg_tri_p3_b3_bx,   gradleg_tri_p4_b1_bx,   gradleg_tri_p4_b2_bx,   gradleg_tri_p4_b3_bx,   gradleg_tri_p5_b1_bx,   gradleg_tri_p5_b2_bx,   gradleg_tri_p5_b3_bx,   gradleg_tri_p6_b1_bx,   gradleg_tri_p6_b2_bx,   gradleg_tri_p6_b3_bx,   gradleg_tri_p7_b1_bx,   gradleg_tri_p7_b2_bx,   gradleg_tri_p7_b3_bx,   gradleg_tri_p8_b1_bx,   gradleg_tri_p8_b2_bx,   gradleg_tri_p8_b3_bx,   gradleg_tri_p9_b1_bx,   gradleg_tri_p9_b2_bx,   gradleg_tri_p9_b3_bx,   gradleg_tri_p10_b1_bx,   gradleg_tri_p10_b2_bx,   gradleg_tri_p10_b3_bx,
-
-      gradleg_tri_b1_b1_1_bx, gradleg_tri_b1_b1_2_bx,  gradleg_tri_b1_b2_1_bx, gradleg_tri_b1_b2_2_bx,  gradleg_tri_b2_b1_1_bx, gradleg_tri_b2_b1_2_bx,  gradleg_tri_b1_b3_1_bx, gradleg_tri_b1_b3_2_bx,  gradleg_tri_b2_b2_1_bx, gradleg_tri_b2_b2_2_bx,  gradleg_tri_b3_b1_1_bx, gradleg_tri_b3_b1_2_bx,  gradleg_tri_b1_b4_1_bx, gradleg_tri_b1_b4_2_bx,  gradleg_tri_b2_b3_1_bx, gradleg_tri_b2_b3_2_bx,  gradleg_tri_b3_b2_1_bx, gradleg_tri_b3_b2_2_bx,  gradleg_tri_b4_b1_1_bx, gradleg_tri_b4_b1_2_bx,  gradleg_tri_b1_b5_1_bx, gradleg_tri_b1_b5_2_bx,  gradleg_tri_b2_b4_1_bx, gradleg_tri_b2_b4_2_bx,  gradleg_tri_b3_b3_1_bx, gradleg_tri_b3_b3_2_bx,  gradleg_tri_b4_b2_1_bx, gradleg_tri_b4_b2_2_bx,  gradleg_tri_b5_b1_1_bx, gradleg_tri_b5_b1_2_bx,  gradleg_tri_b1_b6_1_bx, gradleg_tri_b1_b6_2_bx,  gradleg_tri_b2_b5_1_bx, gradleg_tri_b2_b5_2_bx,  gradleg_tri_b3_b4_1_bx, gradleg_tri_b3_b4_2_bx,  gradleg_tri_b4_b3_1_bx, gradleg_tri_b4_b3_2_bx,  gradleg_tri_b5_b2_1_bx, gradleg_tri_b5_b2_2_bx,  gradleg_tri_b6_b1_1_bx, gradleg_tri_b6_b1_2_bx,  gradleg_tri_b1_b7_1_bx, gradleg_tri_b1_b7_2_bx,  gradleg_tri_b2_b6_1_bx, gradleg_tri_b2_b6_2_bx,  gradleg_tri_b3_b5_1_bx, gradleg_tri_b3_b5_2_bx,  gradleg_tri_b4_b4_1_bx, gradleg_tri_b4_b4_2_bx,  gradleg_tri_b5_b3_1_bx, gradleg_tri_b5_b3_2_bx,  gradleg_tri_b6_b2_1_bx, gradleg_tri_b6_b2_2_bx,  gradleg_tri_b7_b1_1_bx, gradleg_tri_b7_b1_2_bx,  gradleg_tri_b1_b8_1_bx, gradleg_tri_b1_b8_2_bx,  gradleg_tri_b2_b7_1_bx, gradleg_tri_b2_b7_2_bx,  gradleg_tri_b3_b6_1_bx, gradleg_tri_b3_b6_2_bx,  gradleg_tri_b4_b5_1_bx, gradleg_tri_b4_b5_2_bx,  gradleg_tri_b5_b4_1_bx, gradleg_tri_b5_b4_2_bx,  gradleg_tri_b6_b3_1_bx, gradleg_tri_b6_b3_2_bx,  gradleg_tri_b7_b2_1_bx, gradleg_tri_b7_b2_2_bx,  gradleg_tri_b8_b1_1_bx, gradleg_tri_b8_b1_2_bx,
-    };
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_ay[] =
-    {
-     gradleg_tri_p0_e1_ay_0, gradleg_tri_p0_e1_ay_1, gradleg_tri_p0_e2_ay_0,  gradleg_tri_p0_e2_ay_1, gradleg_tri_p0_e3_ay_0, gradleg_tri_p0_e3_ay_1,
-     gradleg_tri_p1_e1_ay,   gradleg_tri_p1_e1_ay,   gradleg_tri_p1_e2_ay,    gradleg_tri_p1_e2_ay,   gradleg_tri_p1_e3_ay,   gradleg_tri_p1_e3_ay,
-     gradleg_tri_p2_e1_ay_0, gradleg_tri_p2_e1_ay_1, gradleg_tri_p2_e2_ay_0,  gradleg_tri_p2_e2_ay_1, gradleg_tri_p2_e3_ay_0, gradleg_tri_p2_e3_ay_1,
-     gradleg_tri_p3_e1_ay,   gradleg_tri_p3_e1_ay,   gradleg_tri_p3_e2_ay,    gradleg_tri_p3_e2_ay,   gradleg_tri_p3_e3_ay,   gradleg_tri_p3_e3_ay,
-     gradleg_tri_p4_e1_ay_0, gradleg_tri_p4_e1_ay_1, gradleg_tri_p4_e2_ay_0,  gradleg_tri_p4_e2_ay_1, gradleg_tri_p4_e3_ay_0, gradleg_tri_p4_e3_ay_1,
-     gradleg_tri_p5_e1_ay,   gradleg_tri_p5_e1_ay,   gradleg_tri_p5_e2_ay,    gradleg_tri_p5_e2_ay,   gradleg_tri_p5_e3_ay,   gradleg_tri_p5_e3_ay,
-     gradleg_tri_p6_e1_ay_0, gradleg_tri_p6_e1_ay_1, gradleg_tri_p6_e2_ay_0,  gradleg_tri_p6_e2_ay_1, gradleg_tri_p6_e3_ay_0, gradleg_tri_p6_e3_ay_1,
-     gradleg_tri_p7_e1_ay,   gradleg_tri_p7_e1_ay,   gradleg_tri_p7_e2_ay,    gradleg_tri_p7_e2_ay,   gradleg_tri_p7_e3_ay,   gradleg_tri_p7_e3_ay,
-     gradleg_tri_p8_e1_ay_0, gradleg_tri_p8_e1_ay_1, gradleg_tri_p8_e2_ay_0,  gradleg_tri_p8_e2_ay_1, gradleg_tri_p8_e3_ay_0, gradleg_tri_p8_e3_ay_1,
-     gradleg_tri_p9_e1_ay,   gradleg_tri_p9_e1_ay,   gradleg_tri_p9_e2_ay,    gradleg_tri_p9_e2_ay,   gradleg_tri_p9_e3_ay,   gradleg_tri_p9_e3_ay,
-     gradleg_tri_p10_e1_ay_0, gradleg_tri_p10_e1_ay_1, gradleg_tri_p10_e2_ay_0,  gradleg_tri_p10_e2_ay_1, gradleg_tri_p10_e3_ay_0, gradleg_tri_p10_e3_ay_1,
-
-      gradleg_tri_p2_b1_ay,   gradleg_tri_p2_b2_ay,   gradleg_tri_p2_b3_ay,   gradleg_tri_p3_b1_ay,   gradleg_tri_p3_b2_ay,   gradleg_tri_p3_b3_ay,   gradleg_tri_p4_b1_ay,   gradleg_tri_p4_b2_ay,   gradleg_tri_p4_b3_ay,   gradleg_tri_p5_b1_ay,   gradleg_tri_p5_b2_ay,   gradleg_tri_p5_b3_ay,   gradleg_tri_p6_b1_ay,   gradleg_tri_p6_b2_ay,   gradleg_tri_p6_b3_ay,   gradleg_tri_p7_b1_ay,   gradleg_tri_p7_b2_ay,   gradleg_tri_p7_b3_ay,   gradleg_tri_p8_b1_ay,   gradleg_tri_p8_b2_ay,   gradleg_tri_p8_b3_ay,   gradleg_tri_p9_b1_ay,   gradleg_tri_p9_b2_ay,   gradleg_tri_p9_b3_ay,   gradleg_tri_p10_b1_ay,   gradleg_tri_p10_b2_ay,   gradleg_tri_p10_b3_ay,
-
-      gradleg_tri_b1_b1_1_ay, gradleg_tri_b1_b1_2_ay,  gradleg_tri_b1_b2_1_ay, gradleg_tri_b1_b2_2_ay,  gradleg_tri_b2_b1_1_ay, gradleg_tri_b2_b1_2_ay,  gradleg_tri_b1_b3_1_ay, gradleg_tri_b1_b3_2_ay,  gradleg_tri_b2_b2_1_ay, gradleg_tri_b2_b2_2_ay,  gradleg_tri_b3_b1_1_ay, gradleg_tri_b3_b1_2_ay,  gradleg_tri_b1_b4_1_ay, gradleg_tri_b1_b4_2_ay,  gradleg_tri_b2_b3_1_ay, gradleg_tri_b2_b3_2_ay,  gradleg_tri_b3_b2_1_ay, gradleg_tri_b3_b2_2_ay,  gradleg_tri_b4_b1_1_ay, gradleg_tri_b4_b1_2_ay,  gradleg_tri_b1_b5_1_ay, gradleg_tri_b1_b5_2_ay,  gradleg_tri_b2_b4_1_ay, gradleg_tri_b2_b4_2_ay,  gradleg_tri_b3_b3_1_ay, gradleg_tri_b3_b3_2_ay,  gradleg_tri_b4_b2_1_ay, gradleg_tri_b4_b2_2_ay,  gradleg_tri_b5_b1_1_ay, gradleg_tri_b5_b1_2_ay,  gradleg_tri_b1_b6_1_ay, gradleg_tri_b1_b6_2_ay,  gradleg_tri_b2_b5_1_ay, gradleg_tri_b2_b5_2_ay,  gradleg_tri_b3_b4_1_ay, gradleg_tri_b3_b4_2_ay,  gradleg_tri_b4_b3_1_ay, gradleg_tri_b4_b3_2_ay,  gradleg_tri_b5_b2_1_ay, gradleg_tri_b5_b2_2_ay,  gradleg_tri_b6_b1_1_ay, gradleg_tri_b6_b1_2_ay,  gradleg_tri_b1_b7_1_ay, gradleg_tri_b1_b7_2_ay,  gradleg_tri_b2_b6_1_ay, gradleg_tri_b2_b6_2_ay,  gradleg_tri_b3_b5_1_ay, gradleg_tri_b3_b5_2_ay,  gradleg_tri_b4_b4_1_ay, gradleg_tri_b4_b4_2_ay,  gradleg_tri_b5_b3_1_ay, gradleg_tri_b5_b3_2_ay,  gradleg_tri_b6_b2_1_ay, gradleg_tri_b6_b2_2_ay,  gradleg_tri_b7_b1_1_ay, gradleg_tri_b7_b1_2_ay,  gradleg_tri_b1_b8_1_ay, gradleg_tri_b1_b8_2_ay,  gradleg_tri_b2_b7_1_ay, gradleg_tri_b2_b7_2_ay,  gradleg_tri_b3_b6_1_ay, gradleg_tri_b3_b6_2_ay,  gradleg_tri_b4_b5_1_ay, gradleg_tri_b4_b5_2_ay,  gradleg_tri_b5_b4_1_ay, gradleg_tri_b5_b4_2_ay,  gradleg_tri_b6_b3_1_ay, gradleg_tri_b6_b3_2_ay,  gradleg_tri_b7_b2_1_ay, gradleg_tri_b7_b2_2_ay,  gradleg_tri_b8_b1_1_ay, gradleg_tri_b8_b1_2_ay,
-    };
-
-    static Shapeset::shape_fn_t gradleg_tri_fn_by[] =
-    {
-     gradleg_tri_p0_e1_by_0, gradleg_tri_p0_e1_by_1, gradleg_tri_p0_e2_by_0,  gradleg_tri_p0_e2_by_1, gradleg_tri_p0_e3_by_0, gradleg_tri_p0_e3_by_1,
-     gradleg_tri_p1_e1_by,   gradleg_tri_p1_e1_by,   gradleg_tri_p1_e2_by,    gradleg_tri_p1_e2_by,   gradleg_tri_p1_e3_by,   gradleg_tri_p1_e3_by,
-     gradleg_tri_p2_e1_by_0, gradleg_tri_p2_e1_by_1, gradleg_tri_p2_e2_by_0,  gradleg_tri_p2_e2_by_1, gradleg_tri_p2_e3_by_0, gradleg_tri_p2_e3_by_1,
-     gradleg_tri_p3_e1_by,   gradleg_tri_p3_e1_by,   gradleg_tri_p3_e2_by,    gradleg_tri_p3_e2_by,   gradleg_tri_p3_e3_by,   gradleg_tri_p3_e3_by,
-     gradleg_tri_p4_e1_by_0, gradleg_tri_p4_e1_by_1, gradleg_tri_p4_e2_by_0,  gradleg_tri_p4_e2_by_1, gradleg_tri_p4_e3_by_0, gradleg_tri_p4_e3_by_1,
-     gradleg_tri_p5_e1_by,   gradleg_tri_p5_e1_by,   gradleg_tri_p5_e2_by,    gradleg_tri_p5_e2_by,   gradleg_tri_p5_e3_by,   gradleg_tri_p5_e3_by,
-     gradleg_tri_p6_e1_by_0, gradleg_tri_p6_e1_by_1, gradleg_tri_p6_e2_by_0,  gradleg_tri_p6_e2_by_1, gradleg_tri_p6_e3_by_0, gradleg_tri_p6_e3_by_1,
-     gradleg_tri_p7_e1_by,   gradleg_tri_p7_e1_by,   gradleg_tri_p7_e2_by,    gradleg_tri_p7_e2_by,   gradleg_tri_p7_e3_by,   gradleg_tri_p7_e3_by,
-     gradleg_tri_p8_e1_by_0, gradleg_tri_p8_e1_by_1, gradleg_tri_p8_e2_by_0,  gradleg_tri_p8_e2_by_1, gradleg_tri_p8_e3_by_0, gradleg_tri_p8_e3_by_1,
-     gradleg_tri_p9_e1_by,   gradleg_tri_p9_e1_by,   gradleg_tri_p9_e2_by,    gradleg_tri_p9_e2_by,   gradleg_tri_p9_e3_by,   gradleg_tri_p9_e3_by,
-     gradleg_tri_p10_e1_by_0, gradleg_tri_p10_e1_by_1, gradleg_tri_p10_e2_by_0,  gradleg_tri_p10_e2_by_1, gradleg_tri_p10_e3_by_0, gradleg_tri_p10_e3_by_1,
-
-      gradleg_tri_p2_b1_by,   gradleg_tri_p2_b2_by,   gradleg_tri_p2_b3_by,   gradleg_tri_p3_b1_by,   gradleg_tri_p3_b2_by,   gradleg_tri_p3_b3_by,   gradleg_tri_p4_b1_by,   gradleg_tri_p4_b2_by,   gradleg_tri_p4_b3_by,   gradleg_tri_p5_b1_by,   gradleg_tri_p5_b2_by,   gradleg_tri_p5_b3_by,   gradleg_tri_p6_b1_by,   gradleg_tri_p6_b2_by,   gradleg_tri_p6_b3_by,   gradleg_tri_p7_b1_by,   gradleg_tri_p7_b2_by,   gradleg_tri_p7_b3_by,   gradleg_tri_p8_b1_by,   gradleg_tri_p8_b2_by,   gradleg_tri_p8_b3_by,   gradleg_tri_p9_b1_by,   gradleg_tri_p9_b2_by,   gradleg_tri_p9_b3_by,   gradleg_tri_p10_b1_by,   gradleg_tri_p10_b2_by,   gradleg_tri_p10_b3_by,
-
-      gradleg_tri_b1_b1_1_by, gradleg_tri_b1_b1_2_by,  gradleg_tri_b1_b2_1_by, gradleg_tri_b1_b2_2_by,  gradleg_tri_b2_b1_1_by, gradleg_tri_b2_b1_2_by,  gradleg_tri_b1_b3_1_by, gradleg_tri_b1_b3_2_by,  gradleg_tri_b2_b2_1_by, gradleg_tri_b2_b2_2_by,  gradleg_tri_b3_b1_1_by, gradleg_tri_b3_b1_2_by,  gradleg_tri_b1_b4_1_by, gradleg_tri_b1_b4_2_by,  gradleg_tri_b2_b3_1_by, gradleg_tri_b2_b3_2_by,  gradleg_tri_b3_b2_1_by, gradleg_tri_b3_b2_2_by,  gradleg_tri_b4_b1_1_by, gradleg_tri_b4_b1_2_by,  gradleg_tri_b1_b5_1_by, gradleg_tri_b1_b5_2_by,  gradleg_tri_b2_b4_1_by, gradleg_tri_b2_b4_2_by,  gradleg_tri_b3_b3_1_by, gradleg_tri_b3_b3_2_by,  gradleg_tri_b4_b2_1_by, gradleg_tri_b4_b2_2_by,  gradleg_tri_b5_b1_1_by, gradleg_tri_b5_b1_2_by,  gradleg_tri_b1_b6_1_by, gradleg_tri_b1_b6_2_by,  gradleg_tri_b2_b5_1_by, gradleg_tri_b2_b5_2_by,  gradleg_tri_b3_b4_1_by, gradleg_tri_b3_b4_2_by,  gradleg_tri_b4_b3_1_by, gradleg_tri_b4_b3_2_by,  gradleg_tri_b5_b2_1_by, gradleg_tri_b5_b2_2_by,  gradleg_tri_b6_b1_1_by, gradleg_tri_b6_b1_2_by,  gradleg_tri_b1_b7_1_by, gradleg_tri_b1_b7_2_by,  gradleg_tri_b2_b6_1_by, gradleg_tri_b2_b6_2_by,  gradleg_tri_b3_b5_1_by, gradleg_tri_b3_b5_2_by,  gradleg_tri_b4_b4_1_by, gradleg_tri_b4_b4_2_by,  gradleg_tri_b5_b3_1_by, gradleg_tri_b5_b3_2_by,  gradleg_tri_b6_b2_1_by, gradleg_tri_b6_b2_2_by,  gradleg_tri_b7_b1_1_by, gradleg_tri_b7_b1_2_by,  gradleg_tri_b1_b8_1_by, gradleg_tri_b1_b8_2_by,  gradleg_tri_b2_b7_1_by, gradleg_tri_b2_b7_2_by,  gradleg_tri_b3_b6_1_by, gradleg_tri_b3_b6_2_by,  gradleg_tri_b4_b5_1_by, gradleg_tri_b4_b5_2_by,  gradleg_tri_b5_b4_1_by, gradleg_tri_b5_b4_2_by,  gradleg_tri_b6_b3_1_by, gradleg_tri_b6_b3_2_by,  gradleg_tri_b7_b2_1_by, gradleg_tri_b7_b2_2_by,  gradleg_tri_b8_b1_1_by, gradleg_tri_b8_b1_2_by,
-    };
-
-    static int gradleg_tri_bubble_indices_all_orders[] =
-    {
-     66, 67, 68,
-     69, 70, 71, 93, 94,
-     72, 73, 74, 95, 96, 97, 98,
-     75, 76, 77, 99, 100, 101, 102, 103, 104,
-     78, 79, 80, 105, 106, 107, 108, 109, 110, 111, 112,
-     81, 82, 83, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
-     84, 85, 86, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
-     87, 88, 89, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
-     90, 91, 92, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
-    };
-
-    static int* gradleg_tri_bubble_indices[11] =
-    {
-      NULL, NULL,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders,
-      gradleg_tri_bubble_indices_all_orders
-    };
-
-    static int gradleg_tri_bubble_count[11] = { 0, 0, 3, 8, 15, 24, 35, 48, 63, 80, 99, };
-
-    static int gradleg_tri_edge_indices_0[22] =  {  0, 1, 6, 7, 12, 13, 18, 19, 24, 25, 30, 31, 36, 37, 42, 43, 48, 49, 54, 55, 60, 61, };
-    static int gradleg_tri_edge_indices_1[22] =  {  2, 3, 8, 9, 14, 15, 20, 21, 26, 27, 32, 33, 38, 39, 44, 45, 50, 51, 56, 57, 62, 63, };
-    static int gradleg_tri_edge_indices_2[22] =  {  4, 5, 10, 11, 16, 17, 22, 23, 28, 29, 34, 35, 40, 41, 46, 47, 52, 53, 58, 59, 64, 65, };
-
-    static int* gradleg_tri_edge_indices[3] =
-    {
-      gradleg_tri_edge_indices_0,
-      gradleg_tri_edge_indices_1,
-      gradleg_tri_edge_indices_2,
-    };
-
-    static int gradleg_tri_vertex_indices[3] = { -1, -1, -1 };
-
-    static int gradleg_tri_index_to_order[] =
-    {
-     0, 0, 0, 0, 0, 0,
-     1, 1, 1, 1, 1, 1,
-     2, 2, 2, 2, 2, 2,
-     3, 3, 3, 3, 3, 3,
-     4, 4, 4, 4, 4, 4,
-     5, 5, 5, 5, 5, 5,
-     6, 6, 6, 6, 6, 6,
-     7, 7, 7, 7, 7, 7,
-     8, 8, 8, 8, 8, 8,
-     9, 9, 9, 9, 9, 9,
-     10, 10, 10, 10, 10, 10,
-     2, 2, 2,
-     3, 3, 3,
-     4, 4, 4,
-     5, 5, 5,
-     6, 6, 6,
-     7, 7, 7,
-     8, 8, 8,
-     9, 9, 9,
-     10, 10, 10,
-     3, 3,
-     4, 4, 4, 4,
-     5, 5, 5, 5, 5, 5,
-     6, 6, 6, 6, 6, 6, 6, 6,
-     7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-     8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-     9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-    };
-
-    static Shapeset::shape_fn_t* gradleg_tri_shape_fn_table[2] =
-    {
-      gradleg_tri_fn_a,
-      gradleg_tri_fn_b
-    };
-
-    static Shapeset::shape_fn_t* gradleg_tri_shape_fn_table_x[2] =
-    {
-      gradleg_tri_fn_ax,
-      gradleg_tri_fn_bx
-    };
-
-    static Shapeset::shape_fn_t* gradleg_tri_shape_fn_table_y[2] =
-    {
-      gradleg_tri_fn_ay,
-      gradleg_tri_fn_by
-    };
-
-    ////////////////////////////////////////////////////////////////////////////////////////////////
-
-    // QUADS
-
-    /* Whitney fns - constant tangential component */
-
-    static double gradleg_quad_p0_e1_a_0(double x, double y)
-    {
-      return Legendre0(x) * l0(y);
-    }
-
-    static double gradleg_quad_p0_e1_a_1(double x, double y)
-    {
-      return -(Legendre0(x) * l0(y));
-    }
-
-    static double gradleg_quad_p0_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e1_ax_0(double x, double y)
-    {
-      return Legendre0x(x) * l0(y);
-    }
-
-    static double gradleg_quad_p0_e1_ax_1(double x, double y)
-    {
-      return -(Legendre0x(x) * l0(y));
-    }
-
-    static double gradleg_quad_p0_e1_ay_0(double x, double y)
-    {
-      return Legendre0(x) * dl0(y);
-    }
-
-    static double gradleg_quad_p0_e1_ay_1(double x, double y)
-    {
-      return -(Legendre0(x) * dl0(y));
-    }
-
-    static double gradleg_quad_p0_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p0_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre0(y));
-    }
-
-    static double gradleg_quad_p0_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p0_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre0(y));
-    }
-
-    static double gradleg_quad_p0_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p0_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre0x(y));
-    }
-
-    static double gradleg_quad_p0_e3_a_1(double x, double y)
-    {
-      return Legendre0(x) * l1(y);
-    }
-
-    static double gradleg_quad_p0_e3_a_0(double x, double y)
-    {
-      return -(Legendre0(x) * l1(y));
-    }
-
-    static double gradleg_quad_p0_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e3_ax_1(double x, double y)
-    {
-      return Legendre0x(x) * l1(y);
-    }
-
-    static double gradleg_quad_p0_e3_ax_0(double x, double y)
-    {
-      return -(Legendre0x(x) * l1(y));
-    }
-
-    static double gradleg_quad_p0_e3_ay_1(double x, double y)
-    {
-      return Legendre0(x) * dl1(y);
-    }
-
-    static double gradleg_quad_p0_e3_ay_0(double x, double y)
-    {
-      return -(Legendre0(x) * dl1(y));
-    }
-
-    static double gradleg_quad_p0_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e4_b_1(double x, double y)
-    {
-      return l0(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p0_e4_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre0(y));
-    }
-
-    static double gradleg_quad_p0_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0_e4_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p0_e4_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre0(y));
-    }
-
-    static double gradleg_quad_p0_e4_by_1(double x, double y)
-    {
-      return l0(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p0_e4_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre0x(y));
-    }
-
-    /* Edge fns - gradients of Scalar lobatto edge functions */
-
-    static double gradleg_quad_l0_l2_a(double x, double y)
-    {
-     return dl0(x) * l2(y);
-    }
-
-    static double gradleg_quad_l0_l2_b(double x, double y)
-    {
-     return l0(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l0_l2_ax(double x, double y)
-    {
-     return d2l0(x) * l2(y);
-    }
-
-    static double gradleg_quad_l0_l2_bx(double x, double y)
-    {
-     return dl0(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l0_l2_ay(double x, double y)
-    {
-     return dl0(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l0_l2_by(double x, double y)
-    {
-     return l0(x) * d2l2(y);
-    }
-
-    static double gradleg_quad_l0_l3_a_0(double x, double y)
-    {
-     return -dl0(x) * l3(y);
-    }
-
-    static double gradleg_quad_l0_l3_a_1(double x, double y)
-    {
-     return  dl0(x) * l3(y);
-    }
-
-    static double gradleg_quad_l0_l3_b_0(double x, double y)
-    {
-     return -l0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_b_1(double x, double y)
-    {
-     return  l0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_ax_0(double x, double y)
-    {
-     return -d2l0(x) * l3(y);
-    }
-
-    static double gradleg_quad_l0_l3_ax_1(double x, double y)
-    {
-     return  d2l0(x) * l3(y);
-    }
-
-    static double gradleg_quad_l0_l3_bx_0(double x, double y)
-    {
-     return -dl0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_bx_1(double x, double y)
-    {
-     return  dl0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_ay_0(double x, double y)
-    {
-     return -dl0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_ay_1(double x, double y)
-    {
-     return  dl0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l0_l3_by_0(double x, double y)
-    {
-     return -l0(x) * d2l3(y);
-    }
-
-    static double gradleg_quad_l0_l3_by_1(double x, double y)
-    {
-     return  l0(x) * d2l3(y);
-    }
-
-    static double gradleg_quad_l0_l4_a(double x, double y)
-    {
-     return dl0(x) * l4(y);
-    }
-
-    static double gradleg_quad_l0_l4_b(double x, double y)
-    {
-     return l0(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l0_l4_ax(double x, double y)
-    {
-     return d2l0(x) * l4(y);
-    }
-
-    static double gradleg_quad_l0_l4_bx(double x, double y)
-    {
-     return dl0(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l0_l4_ay(double x, double y)
-    {
-     return dl0(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l0_l4_by(double x, double y)
-    {
-     return l0(x) * d2l4(y);
-    }
-
-    static double gradleg_quad_l0_l5_a_0(double x, double y)
-    {
-     return -dl0(x) * l5(y);
-    }
-
-    static double gradleg_quad_l0_l5_a_1(double x, double y)
-    {
-     return  dl0(x) * l5(y);
-    }
-
-    static double gradleg_quad_l0_l5_b_0(double x, double y)
-    {
-     return -l0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_b_1(double x, double y)
-    {
-     return  l0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_ax_0(double x, double y)
-    {
-     return -d2l0(x) * l5(y);
-    }
-
-    static double gradleg_quad_l0_l5_ax_1(double x, double y)
-    {
-     return  d2l0(x) * l5(y);
-    }
-
-    static double gradleg_quad_l0_l5_bx_0(double x, double y)
-    {
-     return -dl0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_bx_1(double x, double y)
-    {
-     return  dl0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_ay_0(double x, double y)
-    {
-     return -dl0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_ay_1(double x, double y)
-    {
-     return  dl0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l0_l5_by_0(double x, double y)
-    {
-     return -l0(x) * d2l5(y);
-    }
-
-    static double gradleg_quad_l0_l5_by_1(double x, double y)
-    {
-     return  l0(x) * d2l5(y);
-    }
-
-    static double gradleg_quad_l0_l6_a(double x, double y)
-    {
-     return dl0(x) * l6(y);
-    }
-
-    static double gradleg_quad_l0_l6_b(double x, double y)
-    {
-     return l0(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l0_l6_ax(double x, double y)
-    {
-     return d2l0(x) * l6(y);
-    }
-
-    static double gradleg_quad_l0_l6_bx(double x, double y)
-    {
-     return dl0(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l0_l6_ay(double x, double y)
-    {
-     return dl0(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l0_l6_by(double x, double y)
-    {
-     return l0(x) * d2l6(y);
-    }
-
-    static double gradleg_quad_l0_l7_a_0(double x, double y)
-    {
-     return -dl0(x) * l7(y);
-    }
-
-    static double gradleg_quad_l0_l7_a_1(double x, double y)
-    {
-     return  dl0(x) * l7(y);
-    }
-
-    static double gradleg_quad_l0_l7_b_0(double x, double y)
-    {
-     return -l0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_b_1(double x, double y)
-    {
-     return  l0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_ax_0(double x, double y)
-    {
-     return -d2l0(x) * l7(y);
-    }
-
-    static double gradleg_quad_l0_l7_ax_1(double x, double y)
-    {
-     return  d2l0(x) * l7(y);
-    }
-
-    static double gradleg_quad_l0_l7_bx_0(double x, double y)
-    {
-     return -dl0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_bx_1(double x, double y)
-    {
-     return  dl0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_ay_0(double x, double y)
-    {
-     return -dl0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_ay_1(double x, double y)
-    {
-     return  dl0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l0_l7_by_0(double x, double y)
-    {
-     return -l0(x) * d2l7(y);
-    }
-
-    static double gradleg_quad_l0_l7_by_1(double x, double y)
-    {
-     return  l0(x) * d2l7(y);
-    }
-
-    static double gradleg_quad_l0_l8_a(double x, double y)
-    {
-     return dl0(x) * l8(y);
-    }
-
-    static double gradleg_quad_l0_l8_b(double x, double y)
-    {
-     return l0(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l0_l8_ax(double x, double y)
-    {
-     return d2l0(x) * l8(y);
-    }
-
-    static double gradleg_quad_l0_l8_bx(double x, double y)
-    {
-     return dl0(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l0_l8_ay(double x, double y)
-    {
-     return dl0(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l0_l8_by(double x, double y)
-    {
-     return l0(x) * d2l8(y);
-    }
-
-    static double gradleg_quad_l0_l9_a_0(double x, double y)
-    {
-     return -dl0(x) * l9(y);
-    }
-
-    static double gradleg_quad_l0_l9_a_1(double x, double y)
-    {
-     return  dl0(x) * l9(y);
-    }
-
-    static double gradleg_quad_l0_l9_b_0(double x, double y)
-    {
-     return -l0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_b_1(double x, double y)
-    {
-     return  l0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_ax_0(double x, double y)
-    {
-     return -d2l0(x) * l9(y);
-    }
-
-    static double gradleg_quad_l0_l9_ax_1(double x, double y)
-    {
-     return  d2l0(x) * l9(y);
-    }
-
-    static double gradleg_quad_l0_l9_bx_0(double x, double y)
-    {
-     return -dl0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_bx_1(double x, double y)
-    {
-     return  dl0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_ay_0(double x, double y)
-    {
-     return -dl0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_ay_1(double x, double y)
-    {
-     return  dl0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l0_l9_by_0(double x, double y)
-    {
-     return -l0(x) * d2l9(y);
-    }
-
-    static double gradleg_quad_l0_l9_by_1(double x, double y)
-    {
-     return  l0(x) * d2l9(y);
-    }
-
-    static double gradleg_quad_l0_l10_a(double x, double y)
-    {
-     return dl0(x) * l10(y);
-    }
-
-    static double gradleg_quad_l0_l10_b(double x, double y)
-    {
-     return l0(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l0_l10_ax(double x, double y)
-    {
-     return d2l0(x) * l10(y);
-    }
-
-    static double gradleg_quad_l0_l10_bx(double x, double y)
-    {
-     return dl0(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l0_l10_ay(double x, double y)
-    {
-     return dl0(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l0_l10_by(double x, double y)
-    {
-     return l0(x) * d2l10(y);
-    }
-
-    static double gradleg_quad_l0_l11_a_0(double x, double y)
-    {
-     return -dl0(x) * l11(y);
-    }
-
-    static double gradleg_quad_l0_l11_a_1(double x, double y)
-    {
-     return  dl0(x) * l11(y);
-    }
-
-    static double gradleg_quad_l0_l11_b_0(double x, double y)
-    {
-     return -l0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_b_1(double x, double y)
-    {
-     return  l0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_ax_0(double x, double y)
-    {
-     return -d2l0(x) * l11(y);
-    }
-
-    static double gradleg_quad_l0_l11_ax_1(double x, double y)
-    {
-     return  d2l0(x) * l11(y);
-    }
-
-    static double gradleg_quad_l0_l11_bx_0(double x, double y)
-    {
-     return -dl0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_bx_1(double x, double y)
-    {
-     return  dl0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_ay_0(double x, double y)
-    {
-     return -dl0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_ay_1(double x, double y)
-    {
-     return  dl0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l0_l11_by_0(double x, double y)
-    {
-     return -l0(x) * d2l11(y);
-    }
-
-    static double gradleg_quad_l0_l11_by_1(double x, double y)
-    {
-     return  l0(x) * d2l11(y);
-    }
-
-    static double gradleg_quad_l1_l2_a(double x, double y)
-    {
-     return dl1(x) * l2(y);
-    }
-
-    static double gradleg_quad_l1_l2_b(double x, double y)
-    {
-     return l1(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l1_l2_ax(double x, double y)
-    {
-     return d2l1(x) * l2(y);
-    }
-
-    static double gradleg_quad_l1_l2_bx(double x, double y)
-    {
-     return dl1(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l1_l2_ay(double x, double y)
-    {
-     return dl1(x) * dl2(y);
-    }
-
-    static double gradleg_quad_l1_l2_by(double x, double y)
-    {
-     return l1(x) * d2l2(y);
-    }
-
-    static double gradleg_quad_l1_l3_a_0(double x, double y)
-    {
-     return  dl1(x) * l3(y);
-    }
-
-    static double gradleg_quad_l1_l3_a_1(double x, double y)
-    {
-     return -dl1(x) * l3(y);
-    }
-
-    static double gradleg_quad_l1_l3_b_0(double x, double y)
-    {
-     return  l1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_b_1(double x, double y)
-    {
-     return -l1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_ax_0(double x, double y)
-    {
-     return  d2l1(x) * l3(y);
-    }
-
-    static double gradleg_quad_l1_l3_ax_1(double x, double y)
-    {
-     return -d2l1(x) * l3(y);
-    }
-
-    static double gradleg_quad_l1_l3_bx_0(double x, double y)
-    {
-     return  dl1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_bx_1(double x, double y)
-    {
-     return -dl1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_ay_0(double x, double y)
-    {
-     return  dl1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_ay_1(double x, double y)
-    {
-     return -dl1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_l1_l3_by_0(double x, double y)
-    {
-     return  l1(x) * d2l3(y);
-    }
-
-    static double gradleg_quad_l1_l3_by_1(double x, double y)
-    {
-     return -l1(x) * d2l3(y);
-    }
-
-    static double gradleg_quad_l1_l4_a(double x, double y)
-    {
-     return dl1(x) * l4(y);
-    }
-
-    static double gradleg_quad_l1_l4_b(double x, double y)
-    {
-     return l1(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l1_l4_ax(double x, double y)
-    {
-     return d2l1(x) * l4(y);
-    }
-
-    static double gradleg_quad_l1_l4_bx(double x, double y)
-    {
-     return dl1(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l1_l4_ay(double x, double y)
-    {
-     return dl1(x) * dl4(y);
-    }
-
-    static double gradleg_quad_l1_l4_by(double x, double y)
-    {
-     return l1(x) * d2l4(y);
-    }
-
-    static double gradleg_quad_l1_l5_a_0(double x, double y)
-    {
-     return  dl1(x) * l5(y);
-    }
-
-    static double gradleg_quad_l1_l5_a_1(double x, double y)
-    {
-     return -dl1(x) * l5(y);
-    }
-
-    static double gradleg_quad_l1_l5_b_0(double x, double y)
-    {
-     return  l1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_b_1(double x, double y)
-    {
-     return -l1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_ax_0(double x, double y)
-    {
-     return  d2l1(x) * l5(y);
-    }
-
-    static double gradleg_quad_l1_l5_ax_1(double x, double y)
-    {
-     return -d2l1(x) * l5(y);
-    }
-
-    static double gradleg_quad_l1_l5_bx_0(double x, double y)
-    {
-     return  dl1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_bx_1(double x, double y)
-    {
-     return -dl1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_ay_0(double x, double y)
-    {
-     return  dl1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_ay_1(double x, double y)
-    {
-     return -dl1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_l1_l5_by_0(double x, double y)
-    {
-     return  l1(x) * d2l5(y);
-    }
-
-    static double gradleg_quad_l1_l5_by_1(double x, double y)
-    {
-     return -l1(x) * d2l5(y);
-    }
-
-    static double gradleg_quad_l1_l6_a(double x, double y)
-    {
-     return dl1(x) * l6(y);
-    }
-
-    static double gradleg_quad_l1_l6_b(double x, double y)
-    {
-     return l1(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l1_l6_ax(double x, double y)
-    {
-     return d2l1(x) * l6(y);
-    }
-
-    static double gradleg_quad_l1_l6_bx(double x, double y)
-    {
-     return dl1(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l1_l6_ay(double x, double y)
-    {
-     return dl1(x) * dl6(y);
-    }
-
-    static double gradleg_quad_l1_l6_by(double x, double y)
-    {
-     return l1(x) * d2l6(y);
-    }
-
-    static double gradleg_quad_l1_l7_a_0(double x, double y)
-    {
-     return  dl1(x) * l7(y);
-    }
-
-    static double gradleg_quad_l1_l7_a_1(double x, double y)
-    {
-     return -dl1(x) * l7(y);
-    }
-
-    static double gradleg_quad_l1_l7_b_0(double x, double y)
-    {
-     return  l1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_b_1(double x, double y)
-    {
-     return -l1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_ax_0(double x, double y)
-    {
-     return  d2l1(x) * l7(y);
-    }
-
-    static double gradleg_quad_l1_l7_ax_1(double x, double y)
-    {
-     return -d2l1(x) * l7(y);
-    }
-
-    static double gradleg_quad_l1_l7_bx_0(double x, double y)
-    {
-     return  dl1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_bx_1(double x, double y)
-    {
-     return -dl1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_ay_0(double x, double y)
-    {
-     return  dl1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_ay_1(double x, double y)
-    {
-     return -dl1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_l1_l7_by_0(double x, double y)
-    {
-     return  l1(x) * d2l7(y);
-    }
-
-    static double gradleg_quad_l1_l7_by_1(double x, double y)
-    {
-     return -l1(x) * d2l7(y);
-    }
-
-    static double gradleg_quad_l1_l8_a(double x, double y)
-    {
-     return dl1(x) * l8(y);
-    }
-
-    static double gradleg_quad_l1_l8_b(double x, double y)
-    {
-     return l1(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l1_l8_ax(double x, double y)
-    {
-     return d2l1(x) * l8(y);
-    }
-
-    static double gradleg_quad_l1_l8_bx(double x, double y)
-    {
-     return dl1(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l1_l8_ay(double x, double y)
-    {
-     return dl1(x) * dl8(y);
-    }
-
-    static double gradleg_quad_l1_l8_by(double x, double y)
-    {
-     return l1(x) * d2l8(y);
-    }
-
-    static double gradleg_quad_l1_l9_a_0(double x, double y)
-    {
-     return  dl1(x) * l9(y);
-    }
-
-    static double gradleg_quad_l1_l9_a_1(double x, double y)
-    {
-     return -dl1(x) * l9(y);
-    }
-
-    static double gradleg_quad_l1_l9_b_0(double x, double y)
-    {
-     return  l1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_b_1(double x, double y)
-    {
-     return -l1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_ax_0(double x, double y)
-    {
-     return  d2l1(x) * l9(y);
-    }
-
-    static double gradleg_quad_l1_l9_ax_1(double x, double y)
-    {
-     return -d2l1(x) * l9(y);
-    }
-
-    static double gradleg_quad_l1_l9_bx_0(double x, double y)
-    {
-     return  dl1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_bx_1(double x, double y)
-    {
-     return -dl1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_ay_0(double x, double y)
-    {
-     return  dl1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_ay_1(double x, double y)
-    {
-     return -dl1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_l1_l9_by_0(double x, double y)
-    {
-     return  l1(x) * d2l9(y);
-    }
-
-    static double gradleg_quad_l1_l9_by_1(double x, double y)
-    {
-     return -l1(x) * d2l9(y);
-    }
-
-    static double gradleg_quad_l1_l10_a(double x, double y)
-    {
-     return dl1(x) * l10(y);
-    }
-
-    static double gradleg_quad_l1_l10_b(double x, double y)
-    {
-     return l1(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l1_l10_ax(double x, double y)
-    {
-     return d2l1(x) * l10(y);
-    }
-
-    static double gradleg_quad_l1_l10_bx(double x, double y)
-    {
-     return dl1(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l1_l10_ay(double x, double y)
-    {
-     return dl1(x) * dl10(y);
-    }
-
-    static double gradleg_quad_l1_l10_by(double x, double y)
-    {
-     return l1(x) * d2l10(y);
-    }
-
-    static double gradleg_quad_l1_l11_a_0(double x, double y)
-    {
-     return  dl1(x) * l11(y);
-    }
-
-    static double gradleg_quad_l1_l11_a_1(double x, double y)
-    {
-     return -dl1(x) * l11(y);
-    }
-
-    static double gradleg_quad_l1_l11_b_0(double x, double y)
-    {
-     return  l1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_b_1(double x, double y)
-    {
-     return -l1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_ax_0(double x, double y)
-    {
-     return  d2l1(x) * l11(y);
-    }
-
-    static double gradleg_quad_l1_l11_ax_1(double x, double y)
-    {
-     return -d2l1(x) * l11(y);
-    }
-
-    static double gradleg_quad_l1_l11_bx_0(double x, double y)
-    {
-     return  dl1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_bx_1(double x, double y)
-    {
-     return -dl1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_ay_0(double x, double y)
-    {
-     return  dl1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_ay_1(double x, double y)
-    {
-     return -dl1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_l1_l11_by_0(double x, double y)
-    {
-     return  l1(x) * d2l11(y);
-    }
-
-    static double gradleg_quad_l1_l11_by_1(double x, double y)
-    {
-     return -l1(x) * d2l11(y);
-    }
-
-    static double gradleg_quad_l2_l0_a(double x, double y)
-    {
-     return dl2(x) * l0(y);
-    }
-
-    static double gradleg_quad_l2_l0_b(double x, double y)
-    {
-     return l2(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l2_l0_ax(double x, double y)
-    {
-     return d2l2(x) * l0(y);
-    }
-
-    static double gradleg_quad_l2_l0_bx(double x, double y)
-    {
-     return dl2(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l2_l0_ay(double x, double y)
-    {
-     return dl2(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l2_l0_by(double x, double y)
-    {
-     return l2(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_a_0(double x, double y)
-    {
-     return  dl3(x) * l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_a_1(double x, double y)
-    {
-     return -dl3(x) * l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_b_0(double x, double y)
-    {
-     return  l3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_b_1(double x, double y)
-    {
-     return -l3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_ax_0(double x, double y)
-    {
-     return  d2l3(x) * l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_ax_1(double x, double y)
-    {
-     return -d2l3(x) * l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_bx_0(double x, double y)
-    {
-     return  dl3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_bx_1(double x, double y)
-    {
-     return -dl3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_ay_0(double x, double y)
-    {
-     return  dl3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_ay_1(double x, double y)
-    {
-     return -dl3(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l3_l0_by_0(double x, double y)
-    {
-     return  l3(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l3_l0_by_1(double x, double y)
-    {
-     return -l3(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l4_l0_a(double x, double y)
-    {
-     return dl4(x) * l0(y);
-    }
-
-    static double gradleg_quad_l4_l0_b(double x, double y)
-    {
-     return l4(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l4_l0_ax(double x, double y)
-    {
-     return d2l4(x) * l0(y);
-    }
-
-    static double gradleg_quad_l4_l0_bx(double x, double y)
-    {
-     return dl4(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l4_l0_ay(double x, double y)
-    {
-     return dl4(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l4_l0_by(double x, double y)
-    {
-     return l4(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_a_0(double x, double y)
-    {
-     return  dl5(x) * l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_a_1(double x, double y)
-    {
-     return -dl5(x) * l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_b_0(double x, double y)
-    {
-     return  l5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_b_1(double x, double y)
-    {
-     return -l5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_ax_0(double x, double y)
-    {
-     return  d2l5(x) * l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_ax_1(double x, double y)
-    {
-     return -d2l5(x) * l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_bx_0(double x, double y)
-    {
-     return  dl5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_bx_1(double x, double y)
-    {
-     return -dl5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_ay_0(double x, double y)
-    {
-     return  dl5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_ay_1(double x, double y)
-    {
-     return -dl5(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l5_l0_by_0(double x, double y)
-    {
-     return  l5(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l5_l0_by_1(double x, double y)
-    {
-     return -l5(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l6_l0_a(double x, double y)
-    {
-     return dl6(x) * l0(y);
-    }
-
-    static double gradleg_quad_l6_l0_b(double x, double y)
-    {
-     return l6(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l6_l0_ax(double x, double y)
-    {
-     return d2l6(x) * l0(y);
-    }
-
-    static double gradleg_quad_l6_l0_bx(double x, double y)
-    {
-     return dl6(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l6_l0_ay(double x, double y)
-    {
-     return dl6(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l6_l0_by(double x, double y)
-    {
-     return l6(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_a_0(double x, double y)
-    {
-     return  dl7(x) * l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_a_1(double x, double y)
-    {
-     return -dl7(x) * l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_b_0(double x, double y)
-    {
-     return  l7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_b_1(double x, double y)
-    {
-     return -l7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_ax_0(double x, double y)
-    {
-     return  d2l7(x) * l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_ax_1(double x, double y)
-    {
-     return -d2l7(x) * l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_bx_0(double x, double y)
-    {
-     return  dl7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_bx_1(double x, double y)
-    {
-     return -dl7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_ay_0(double x, double y)
-    {
-     return  dl7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_ay_1(double x, double y)
-    {
-     return -dl7(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l7_l0_by_0(double x, double y)
-    {
-     return  l7(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l7_l0_by_1(double x, double y)
-    {
-     return -l7(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l8_l0_a(double x, double y)
-    {
-     return dl8(x) * l0(y);
-    }
-
-    static double gradleg_quad_l8_l0_b(double x, double y)
-    {
-     return l8(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l8_l0_ax(double x, double y)
-    {
-     return d2l8(x) * l0(y);
-    }
-
-    static double gradleg_quad_l8_l0_bx(double x, double y)
-    {
-     return dl8(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l8_l0_ay(double x, double y)
-    {
-     return dl8(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l8_l0_by(double x, double y)
-    {
-     return l8(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_a_0(double x, double y)
-    {
-     return  dl9(x) * l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_a_1(double x, double y)
-    {
-     return -dl9(x) * l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_b_0(double x, double y)
-    {
-     return  l9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_b_1(double x, double y)
-    {
-     return -l9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_ax_0(double x, double y)
-    {
-     return  d2l9(x) * l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_ax_1(double x, double y)
-    {
-     return -d2l9(x) * l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_bx_0(double x, double y)
-    {
-     return  dl9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_bx_1(double x, double y)
-    {
-     return -dl9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_ay_0(double x, double y)
-    {
-     return  dl9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_ay_1(double x, double y)
-    {
-     return -dl9(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l9_l0_by_0(double x, double y)
-    {
-     return  l9(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l9_l0_by_1(double x, double y)
-    {
-     return -l9(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l10_l0_a(double x, double y)
-    {
-     return dl10(x) * l0(y);
-    }
-
-    static double gradleg_quad_l10_l0_b(double x, double y)
-    {
-     return l10(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l10_l0_ax(double x, double y)
-    {
-     return d2l10(x) * l0(y);
-    }
-
-    static double gradleg_quad_l10_l0_bx(double x, double y)
-    {
-     return dl10(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l10_l0_ay(double x, double y)
-    {
-     return dl10(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l10_l0_by(double x, double y)
-    {
-     return l10(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_a_0(double x, double y)
-    {
-     return  dl11(x) * l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_a_1(double x, double y)
-    {
-     return -dl11(x) * l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_b_0(double x, double y)
-    {
-     return  l11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_b_1(double x, double y)
-    {
-     return -l11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_ax_0(double x, double y)
-    {
-     return  d2l11(x) * l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_ax_1(double x, double y)
-    {
-     return -d2l11(x) * l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_bx_0(double x, double y)
-    {
-     return  dl11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_bx_1(double x, double y)
-    {
-     return -dl11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_ay_0(double x, double y)
-    {
-     return  dl11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_ay_1(double x, double y)
-    {
-     return -dl11(x) * dl0(y);
-    }
-
-    static double gradleg_quad_l11_l0_by_0(double x, double y)
-    {
-     return  l11(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l11_l0_by_1(double x, double y)
-    {
-     return -l11(x) * d2l0(y);
-    }
-
-    static double gradleg_quad_l2_l1_a(double x, double y)
-    {
-     return dl2(x) * l1(y);
-    }
-
-    static double gradleg_quad_l2_l1_b(double x, double y)
-    {
-     return l2(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l2_l1_ax(double x, double y)
-    {
-     return d2l2(x) * l1(y);
-    }
-
-    static double gradleg_quad_l2_l1_bx(double x, double y)
-    {
-     return dl2(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l2_l1_ay(double x, double y)
-    {
-     return dl2(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l2_l1_by(double x, double y)
-    {
-     return l2(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_a_0(double x, double y)
-    {
-     return -dl3(x) * l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_a_1(double x, double y)
-    {
-     return  dl3(x) * l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_b_0(double x, double y)
-    {
-     return -l3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_b_1(double x, double y)
-    {
-     return  l3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_ax_0(double x, double y)
-    {
-     return -d2l3(x) * l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_ax_1(double x, double y)
-    {
-     return  d2l3(x) * l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_bx_0(double x, double y)
-    {
-     return -dl3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_bx_1(double x, double y)
-    {
-     return  dl3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_ay_0(double x, double y)
-    {
-     return -dl3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_ay_1(double x, double y)
-    {
-     return  dl3(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l3_l1_by_0(double x, double y)
-    {
-     return -l3(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l3_l1_by_1(double x, double y)
-    {
-     return  l3(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l4_l1_a(double x, double y)
-    {
-     return dl4(x) * l1(y);
-    }
-
-    static double gradleg_quad_l4_l1_b(double x, double y)
-    {
-     return l4(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l4_l1_ax(double x, double y)
-    {
-     return d2l4(x) * l1(y);
-    }
-
-    static double gradleg_quad_l4_l1_bx(double x, double y)
-    {
-     return dl4(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l4_l1_ay(double x, double y)
-    {
-     return dl4(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l4_l1_by(double x, double y)
-    {
-     return l4(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_a_0(double x, double y)
-    {
-     return -dl5(x) * l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_a_1(double x, double y)
-    {
-     return  dl5(x) * l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_b_0(double x, double y)
-    {
-     return -l5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_b_1(double x, double y)
-    {
-     return  l5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_ax_0(double x, double y)
-    {
-     return -d2l5(x) * l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_ax_1(double x, double y)
-    {
-     return  d2l5(x) * l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_bx_0(double x, double y)
-    {
-     return -dl5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_bx_1(double x, double y)
-    {
-     return  dl5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_ay_0(double x, double y)
-    {
-     return -dl5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_ay_1(double x, double y)
-    {
-     return  dl5(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l5_l1_by_0(double x, double y)
-    {
-     return -l5(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l5_l1_by_1(double x, double y)
-    {
-     return  l5(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l6_l1_a(double x, double y)
-    {
-     return dl6(x) * l1(y);
-    }
-
-    static double gradleg_quad_l6_l1_b(double x, double y)
-    {
-     return l6(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l6_l1_ax(double x, double y)
-    {
-     return d2l6(x) * l1(y);
-    }
-
-    static double gradleg_quad_l6_l1_bx(double x, double y)
-    {
-     return dl6(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l6_l1_ay(double x, double y)
-    {
-     return dl6(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l6_l1_by(double x, double y)
-    {
-     return l6(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_a_0(double x, double y)
-    {
-     return -dl7(x) * l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_a_1(double x, double y)
-    {
-     return  dl7(x) * l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_b_0(double x, double y)
-    {
-     return -l7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_b_1(double x, double y)
-    {
-     return  l7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_ax_0(double x, double y)
-    {
-     return -d2l7(x) * l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_ax_1(double x, double y)
-    {
-     return  d2l7(x) * l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_bx_0(double x, double y)
-    {
-     return -dl7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_bx_1(double x, double y)
-    {
-     return  dl7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_ay_0(double x, double y)
-    {
-     return -dl7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_ay_1(double x, double y)
-    {
-     return  dl7(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l7_l1_by_0(double x, double y)
-    {
-     return -l7(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l7_l1_by_1(double x, double y)
-    {
-     return  l7(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l8_l1_a(double x, double y)
-    {
-     return dl8(x) * l1(y);
-    }
-
-    static double gradleg_quad_l8_l1_b(double x, double y)
-    {
-     return l8(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l8_l1_ax(double x, double y)
-    {
-     return d2l8(x) * l1(y);
-    }
-
-    static double gradleg_quad_l8_l1_bx(double x, double y)
-    {
-     return dl8(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l8_l1_ay(double x, double y)
-    {
-     return dl8(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l8_l1_by(double x, double y)
-    {
-     return l8(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_a_0(double x, double y)
-    {
-     return -dl9(x) * l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_a_1(double x, double y)
-    {
-     return  dl9(x) * l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_b_0(double x, double y)
-    {
-     return -l9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_b_1(double x, double y)
-    {
-     return  l9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_ax_0(double x, double y)
-    {
-     return -d2l9(x) * l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_ax_1(double x, double y)
-    {
-     return  d2l9(x) * l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_bx_0(double x, double y)
-    {
-     return -dl9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_bx_1(double x, double y)
-    {
-     return  dl9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_ay_0(double x, double y)
-    {
-     return -dl9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_ay_1(double x, double y)
-    {
-     return  dl9(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l9_l1_by_0(double x, double y)
-    {
-     return -l9(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l9_l1_by_1(double x, double y)
-    {
-     return  l9(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l10_l1_a(double x, double y)
-    {
-     return dl10(x) * l1(y);
-    }
-
-    static double gradleg_quad_l10_l1_b(double x, double y)
-    {
-     return l10(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l10_l1_ax(double x, double y)
-    {
-     return d2l10(x) * l1(y);
-    }
-
-    static double gradleg_quad_l10_l1_bx(double x, double y)
-    {
-     return dl10(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l10_l1_ay(double x, double y)
-    {
-     return dl10(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l10_l1_by(double x, double y)
-    {
-     return l10(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_a_0(double x, double y)
-    {
-     return -dl11(x) * l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_a_1(double x, double y)
-    {
-     return  dl11(x) * l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_b_0(double x, double y)
-    {
-     return -l11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_b_1(double x, double y)
-    {
-     return  l11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_ax_0(double x, double y)
-    {
-     return -d2l11(x) * l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_ax_1(double x, double y)
-    {
-     return  d2l11(x) * l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_bx_0(double x, double y)
-    {
-     return -dl11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_bx_1(double x, double y)
-    {
-     return  dl11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_ay_0(double x, double y)
-    {
-     return -dl11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_ay_1(double x, double y)
-    {
-     return  dl11(x) * dl1(y);
-    }
-
-    static double gradleg_quad_l11_l1_by_0(double x, double y)
-    {
-     return -l11(x) * d2l1(y);
-    }
-
-    static double gradleg_quad_l11_l1_by_1(double x, double y)
-    {
-     return  l11(x) * d2l1(y);
-    }
-
-    /* BUBBLE */
-
-    /* BUBBLE ( 1 , 0 ) */
-
-    static double gradleg_quad_p0p2_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l2(y);
-    }
-
-    static double gradleg_quad_p0p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p2_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p0p2_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p0p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p3_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l3(y);
-    }
-
-    static double gradleg_quad_p0p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p3_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p0p3_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p0p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p4_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l4(y);
-    }
-
-    static double gradleg_quad_p0p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p4_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p0p4_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p0p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p5_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l5(y);
-    }
-
-    static double gradleg_quad_p0p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p5_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p0p5_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p0p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p6_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l6(y);
-    }
-
-    static double gradleg_quad_p0p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p6_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p0p6_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p0p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p7_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l7(y);
-    }
-
-    static double gradleg_quad_p0p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p7_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p0p7_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p0p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p8_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l8(y);
-    }
-
-    static double gradleg_quad_p0p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p8_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p0p8_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p0p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p9_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l9(y);
-    }
-
-    static double gradleg_quad_p0p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p9_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p0p9_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p0p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p10_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l10(y);
-    }
-
-    static double gradleg_quad_p0p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p10_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p0p10_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p0p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p11_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l11(y);
-    }
-
-    static double gradleg_quad_p0p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p11_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p0p11_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p0p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p0p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p2_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l2(y);
-    }
-
-    static double gradleg_quad_p1p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p2_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p1p2_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p1p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p3_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l3(y);
-    }
-
-    static double gradleg_quad_p1p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p3_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p1p3_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p1p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p4_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l4(y);
-    }
-
-    static double gradleg_quad_p1p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p4_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p1p4_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p1p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p5_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l5(y);
-    }
-
-    static double gradleg_quad_p1p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p5_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p1p5_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p1p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p6_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l6(y);
-    }
-
-    static double gradleg_quad_p1p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p6_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p1p6_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p1p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p7_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l7(y);
-    }
-
-    static double gradleg_quad_p1p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p7_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p1p7_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p1p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p8_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l8(y);
-    }
-
-    static double gradleg_quad_p1p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p8_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p1p8_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p1p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p9_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l9(y);
-    }
-
-    static double gradleg_quad_p1p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p9_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p1p9_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p1p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p10_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l10(y);
-    }
-
-    static double gradleg_quad_p1p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p10_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p1p10_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p1p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p11_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l11(y);
-    }
-
-    static double gradleg_quad_p1p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p11_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p1p11_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p1p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p1p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l2(y);
-    }
-
-    static double gradleg_quad_p2p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p2p2_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p2p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l3(y);
-    }
-
-    static double gradleg_quad_p2p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p2p3_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p2p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l4(y);
-    }
-
-    static double gradleg_quad_p2p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p2p4_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p2p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l5(y);
-    }
-
-    static double gradleg_quad_p2p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p2p5_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p2p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l6(y);
-    }
-
-    static double gradleg_quad_p2p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p2p6_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p2p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l7(y);
-    }
-
-    static double gradleg_quad_p2p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p2p7_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p2p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l8(y);
-    }
-
-    static double gradleg_quad_p2p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p2p8_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p2p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l9(y);
-    }
-
-    static double gradleg_quad_p2p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p2p9_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p2p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l10(y);
-    }
-
-    static double gradleg_quad_p2p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p2p10_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p2p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p11_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l11(y);
-    }
-
-    static double gradleg_quad_p2p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p11_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p2p11_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p2p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l2(y);
-    }
-
-    static double gradleg_quad_p3p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p3p2_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p3p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l3(y);
-    }
-
-    static double gradleg_quad_p3p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p3p3_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p3p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l4(y);
-    }
-
-    static double gradleg_quad_p3p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p3p4_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p3p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l5(y);
-    }
-
-    static double gradleg_quad_p3p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p3p5_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p3p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l6(y);
-    }
-
-    static double gradleg_quad_p3p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p3p6_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p3p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l7(y);
-    }
-
-    static double gradleg_quad_p3p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p3p7_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p3p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l8(y);
-    }
-
-    static double gradleg_quad_p3p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p3p8_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p3p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l9(y);
-    }
-
-    static double gradleg_quad_p3p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p3p9_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p3p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l10(y);
-    }
-
-    static double gradleg_quad_p3p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p3p10_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p3p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p11_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l11(y);
-    }
-
-    static double gradleg_quad_p3p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p11_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p3p11_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p3p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l2(y);
-    }
-
-    static double gradleg_quad_p4p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p4p2_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p4p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l3(y);
-    }
-
-    static double gradleg_quad_p4p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p4p3_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p4p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l4(y);
-    }
-
-    static double gradleg_quad_p4p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p4p4_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p4p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l5(y);
-    }
-
-    static double gradleg_quad_p4p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p4p5_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p4p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l6(y);
-    }
-
-    static double gradleg_quad_p4p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p4p6_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p4p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l7(y);
-    }
-
-    static double gradleg_quad_p4p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p4p7_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p4p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l8(y);
-    }
-
-    static double gradleg_quad_p4p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p4p8_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p4p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l9(y);
-    }
-
-    static double gradleg_quad_p4p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p4p9_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p4p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l10(y);
-    }
-
-    static double gradleg_quad_p4p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p4p10_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p4p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p11_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l11(y);
-    }
-
-    static double gradleg_quad_p4p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p11_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p4p11_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p4p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l2(y);
-    }
-
-    static double gradleg_quad_p5p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p5p2_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p5p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l3(y);
-    }
-
-    static double gradleg_quad_p5p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p5p3_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p5p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l4(y);
-    }
-
-    static double gradleg_quad_p5p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p5p4_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p5p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l5(y);
-    }
-
-    static double gradleg_quad_p5p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p5p5_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p5p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l6(y);
-    }
-
-    static double gradleg_quad_p5p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p5p6_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p5p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l7(y);
-    }
-
-    static double gradleg_quad_p5p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p5p7_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p5p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l8(y);
-    }
-
-    static double gradleg_quad_p5p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p5p8_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p5p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l9(y);
-    }
-
-    static double gradleg_quad_p5p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p5p9_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p5p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l10(y);
-    }
-
-    static double gradleg_quad_p5p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p5p10_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p5p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p11_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l11(y);
-    }
-
-    static double gradleg_quad_p5p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p11_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p5p11_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p5p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l2(y);
-    }
-
-    static double gradleg_quad_p6p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p6p2_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p6p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l3(y);
-    }
-
-    static double gradleg_quad_p6p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p6p3_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p6p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l4(y);
-    }
-
-    static double gradleg_quad_p6p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p6p4_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p6p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l5(y);
-    }
-
-    static double gradleg_quad_p6p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p6p5_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p6p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l6(y);
-    }
-
-    static double gradleg_quad_p6p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p6p6_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p6p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l7(y);
-    }
-
-    static double gradleg_quad_p6p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p6p7_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p6p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l8(y);
-    }
-
-    static double gradleg_quad_p6p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p6p8_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p6p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l9(y);
-    }
-
-    static double gradleg_quad_p6p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p6p9_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p6p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l10(y);
-    }
-
-    static double gradleg_quad_p6p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p6p10_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p6p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p11_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l11(y);
-    }
-
-    static double gradleg_quad_p6p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p11_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p6p11_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p6p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l2(y);
-    }
-
-    static double gradleg_quad_p7p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p7p2_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p7p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l3(y);
-    }
-
-    static double gradleg_quad_p7p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p7p3_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p7p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l4(y);
-    }
-
-    static double gradleg_quad_p7p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p7p4_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p7p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l5(y);
-    }
-
-    static double gradleg_quad_p7p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p7p5_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p7p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l6(y);
-    }
-
-    static double gradleg_quad_p7p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p7p6_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p7p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l7(y);
-    }
-
-    static double gradleg_quad_p7p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p7p7_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p7p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l8(y);
-    }
-
-    static double gradleg_quad_p7p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p7p8_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p7p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l9(y);
-    }
-
-    static double gradleg_quad_p7p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p7p9_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p7p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l10(y);
-    }
-
-    static double gradleg_quad_p7p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p7p10_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p7p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p11_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l11(y);
-    }
-
-    static double gradleg_quad_p7p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p11_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p7p11_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p7p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l2(y);
-    }
-
-    static double gradleg_quad_p8p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p8p2_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p8p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l3(y);
-    }
-
-    static double gradleg_quad_p8p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p8p3_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p8p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l4(y);
-    }
-
-    static double gradleg_quad_p8p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p8p4_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p8p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l5(y);
-    }
-
-    static double gradleg_quad_p8p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p8p5_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p8p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l6(y);
-    }
-
-    static double gradleg_quad_p8p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p8p6_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p8p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l7(y);
-    }
-
-    static double gradleg_quad_p8p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p8p7_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p8p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l8(y);
-    }
-
-    static double gradleg_quad_p8p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p8p8_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p8p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l9(y);
-    }
-
-    static double gradleg_quad_p8p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p8p9_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p8p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l10(y);
-    }
-
-    static double gradleg_quad_p8p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p8p10_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p8p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p11_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l11(y);
-    }
-
-    static double gradleg_quad_p8p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p11_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p8p11_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p8p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l2(y);
-    }
-
-    static double gradleg_quad_p9p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p9p2_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p9p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l3(y);
-    }
-
-    static double gradleg_quad_p9p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p9p3_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p9p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l4(y);
-    }
-
-    static double gradleg_quad_p9p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p9p4_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p9p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l5(y);
-    }
-
-    static double gradleg_quad_p9p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p9p5_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p9p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l6(y);
-    }
-
-    static double gradleg_quad_p9p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p9p6_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p9p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l7(y);
-    }
-
-    static double gradleg_quad_p9p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p9p7_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p9p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l8(y);
-    }
-
-    static double gradleg_quad_p9p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p9p8_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p9p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l9(y);
-    }
-
-    static double gradleg_quad_p9p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p9p9_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p9p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l10(y);
-    }
-
-    static double gradleg_quad_p9p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p9p10_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p9p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p11_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l11(y);
-    }
-
-    static double gradleg_quad_p9p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p11_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p9p11_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p9p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l2(y);
-    }
-
-    static double gradleg_quad_p10p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l2(y);
-    }
-
-    static double gradleg_quad_p10p2_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl2(y);
-    }
-
-    static double gradleg_quad_p10p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l3(y);
-    }
-
-    static double gradleg_quad_p10p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l3(y);
-    }
-
-    static double gradleg_quad_p10p3_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl3(y);
-    }
-
-    static double gradleg_quad_p10p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l4(y);
-    }
-
-    static double gradleg_quad_p10p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l4(y);
-    }
-
-    static double gradleg_quad_p10p4_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl4(y);
-    }
-
-    static double gradleg_quad_p10p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l5(y);
-    }
-
-    static double gradleg_quad_p10p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l5(y);
-    }
-
-    static double gradleg_quad_p10p5_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl5(y);
-    }
-
-    static double gradleg_quad_p10p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l6(y);
-    }
-
-    static double gradleg_quad_p10p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l6(y);
-    }
-
-    static double gradleg_quad_p10p6_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl6(y);
-    }
-
-    static double gradleg_quad_p10p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l7(y);
-    }
-
-    static double gradleg_quad_p10p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l7(y);
-    }
-
-    static double gradleg_quad_p10p7_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl7(y);
-    }
-
-    static double gradleg_quad_p10p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l8(y);
-    }
-
-    static double gradleg_quad_p10p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l8(y);
-    }
-
-    static double gradleg_quad_p10p8_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl8(y);
-    }
-
-    static double gradleg_quad_p10p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l9(y);
-    }
-
-    static double gradleg_quad_p10p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l9(y);
-    }
-
-    static double gradleg_quad_p10p9_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl9(y);
-    }
-
-    static double gradleg_quad_p10p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l10(y);
-    }
-
-    static double gradleg_quad_p10p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l10(y);
-    }
-
-    static double gradleg_quad_p10p10_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl10(y);
-    }
-
-    static double gradleg_quad_p10p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p11_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l11(y);
-    }
-
-    static double gradleg_quad_p10p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p11_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l11(y);
-    }
-
-    static double gradleg_quad_p10p11_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl11(y);
-    }
-
-    static double gradleg_quad_p10p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* BUBBLE ( 0 , 1 ) */
-
-    static double gradleg_quad_p2p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p0_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p2p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p0_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p2p0_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p2p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p1_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p2p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p1_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p2p1_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p2p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p2p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p2_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p2p2_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p2p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p2p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p3_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p2p3_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p2p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p2p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p4_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p2p4_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p2p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p2p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p5_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p2p5_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p2p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p2p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p6_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p2p6_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p2p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p2p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p7_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p2p7_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p2p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p2p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p8_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p2p8_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p2p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p2p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p9_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p2p9_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p2p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p2p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p2p10_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p2p10_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p3p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p0_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p3p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p0_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p3p0_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p3p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p1_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p3p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p1_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p3p1_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p3p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p3p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p2_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p3p2_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p3p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p3p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p3_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p3p3_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p3p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p3p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p4_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p3p4_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p3p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p3p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p5_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p3p5_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p3p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p3p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p6_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p3p6_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p3p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p3p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p7_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p3p7_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p3p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p3p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p8_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p3p8_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p3p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p3p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p9_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p3p9_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p3p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p3p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p3p10_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p3p10_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p4p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p0_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p4p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p0_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p4p0_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p4p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p1_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p4p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p1_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p4p1_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p4p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p4p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p2_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p4p2_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p4p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p4p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p3_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p4p3_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p4p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p4p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p4_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p4p4_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p4p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p4p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p5_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p4p5_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p4p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p4p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p6_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p4p6_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p4p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p4p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p7_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p4p7_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p4p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p4p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p8_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p4p8_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p4p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p4p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p9_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p4p9_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p4p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p4p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p4p10_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p4p10_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p5p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p0_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p5p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p0_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p5p0_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p5p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p1_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p5p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p1_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p5p1_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p5p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p5p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p2_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p5p2_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p5p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p5p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p3_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p5p3_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p5p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p5p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p4_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p5p4_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p5p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p5p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p5_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p5p5_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p5p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p5p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p6_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p5p6_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p5p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p5p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p7_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p5p7_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p5p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p5p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p8_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p5p8_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p5p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p5p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p9_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p5p9_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p5p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p5p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p5p10_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p5p10_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p6p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p0_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p6p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p0_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p6p0_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p6p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p1_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p6p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p1_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p6p1_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p6p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p6p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p2_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p6p2_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p6p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p6p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p3_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p6p3_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p6p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p6p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p4_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p6p4_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p6p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p6p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p5_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p6p5_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p6p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p6p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p6_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p6p6_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p6p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p6p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p7_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p6p7_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p6p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p6p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p8_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p6p8_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p6p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p6p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p9_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p6p9_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p6p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p6p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p6p10_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p6p10_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p7p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p0_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p7p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p0_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p7p0_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p7p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p1_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p7p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p1_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p7p1_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p7p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p7p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p2_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p7p2_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p7p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p7p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p3_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p7p3_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p7p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p7p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p4_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p7p4_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p7p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p7p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p5_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p7p5_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p7p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p7p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p6_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p7p6_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p7p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p7p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p7_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p7p7_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p7p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p7p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p8_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p7p8_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p7p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p7p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p9_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p7p9_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p7p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p7p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p7p10_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p7p10_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p8p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p0_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p8p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p0_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p8p0_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p8p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p1_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p8p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p1_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p8p1_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p8p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p8p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p2_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p8p2_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p8p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p8p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p3_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p8p3_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p8p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p8p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p4_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p8p4_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p8p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p8p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p5_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p8p5_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p8p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p8p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p6_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p8p6_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p8p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p8p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p7_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p8p7_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p8p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p8p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p8_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p8p8_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p8p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p8p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p9_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p8p9_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p8p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p8p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p8p10_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p8p10_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p9p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p0_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p9p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p0_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p9p0_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p9p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p1_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p9p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p1_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p9p1_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p9p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p9p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p2_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p9p2_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p9p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p9p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p3_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p9p3_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p9p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p9p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p4_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p9p4_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p9p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p9p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p5_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p9p5_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p9p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p9p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p6_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p9p6_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p9p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p9p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p7_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p9p7_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p9p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p9p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p8_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p9p8_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p9p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p9p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p9_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p9p9_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p9p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p9p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p9p10_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p9p10_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p10p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p0_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p10p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p0_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p10p0_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p10p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p1_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p10p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p1_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p10p1_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p10p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p10p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p2_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p10p2_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p10p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p10p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p3_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p10p3_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p10p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p10p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p4_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p10p4_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p10p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p10p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p5_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p10p5_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p10p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p10p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p6_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p10p6_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p10p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p10p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p7_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p10p7_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p10p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p10p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p8_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p10p8_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p10p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p10p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p9_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p10p9_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p10p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p10p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p10p10_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p10p10_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre10x(y);
-    }
-
-    static double gradleg_quad_p11p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p0_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p11p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p0_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre0(y);
-    }
-
-    static double gradleg_quad_p11p0_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre0x(y);
-    }
-
-    static double gradleg_quad_p11p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p1_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p11p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p1_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre1(y);
-    }
-
-    static double gradleg_quad_p11p1_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre1x(y);
-    }
-
-    static double gradleg_quad_p11p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p2_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p11p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p2_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre2(y);
-    }
-
-    static double gradleg_quad_p11p2_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre2x(y);
-    }
-
-    static double gradleg_quad_p11p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p3_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p11p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p3_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre3(y);
-    }
-
-    static double gradleg_quad_p11p3_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre3x(y);
-    }
-
-    static double gradleg_quad_p11p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p4_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p11p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p4_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre4(y);
-    }
-
-    static double gradleg_quad_p11p4_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre4x(y);
-    }
-
-    static double gradleg_quad_p11p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p5_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p11p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p5_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre5(y);
-    }
-
-    static double gradleg_quad_p11p5_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre5x(y);
-    }
-
-    static double gradleg_quad_p11p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p6_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p11p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p6_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre6(y);
-    }
-
-    static double gradleg_quad_p11p6_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre6x(y);
-    }
-
-    static double gradleg_quad_p11p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p7_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p11p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p7_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre7(y);
-    }
-
-    static double gradleg_quad_p11p7_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre7x(y);
-    }
-
-    static double gradleg_quad_p11p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p8_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p11p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p8_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre8(y);
-    }
-
-    static double gradleg_quad_p11p8_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre8x(y);
-    }
-
-    static double gradleg_quad_p11p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p9_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p11p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p9_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre9(y);
-    }
-
-    static double gradleg_quad_p11p9_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre9x(y);
-    }
-
-    static double gradleg_quad_p11p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p10_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p11p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double gradleg_quad_p11p10_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre10(y);
-    }
-
-    static double gradleg_quad_p11p10_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre10x(y);
-    }
-
-    static Shapeset::shape_fn_t gradleg_quad_fn_a[] =
-    {
-      gradleg_quad_p0_e1_a_0, gradleg_quad_p0_e1_a_1, gradleg_quad_p0_e2_a, gradleg_quad_p0_e2_a, gradleg_quad_p0_e3_a_0, gradleg_quad_p0_e3_a_1, gradleg_quad_p0_e4_a, gradleg_quad_p0_e4_a,
-      gradleg_quad_l2_l0_a, gradleg_quad_l2_l0_a, gradleg_quad_l1_l2_a, gradleg_quad_l1_l2_a, gradleg_quad_l2_l1_a, gradleg_quad_l2_l1_a, gradleg_quad_l0_l2_a, gradleg_quad_l0_l2_a,
-      gradleg_quad_l3_l0_a_0, gradleg_quad_l3_l0_a_1, gradleg_quad_l1_l3_a_0, gradleg_quad_l1_l3_a_1,  gradleg_quad_l3_l1_a_0, gradleg_quad_l3_l1_a_1, gradleg_quad_l0_l3_a_0, gradleg_quad_l0_l3_a_1,
-      gradleg_quad_l4_l0_a, gradleg_quad_l4_l0_a, gradleg_quad_l1_l4_a, gradleg_quad_l1_l4_a, gradleg_quad_l4_l1_a, gradleg_quad_l4_l1_a, gradleg_quad_l0_l4_a, gradleg_quad_l0_l4_a,
-      gradleg_quad_l5_l0_a_0, gradleg_quad_l5_l0_a_1, gradleg_quad_l1_l5_a_0, gradleg_quad_l1_l5_a_1,  gradleg_quad_l5_l1_a_0, gradleg_quad_l5_l1_a_1, gradleg_quad_l0_l5_a_0, gradleg_quad_l0_l5_a_1,
-      gradleg_quad_l6_l0_a, gradleg_quad_l6_l0_a, gradleg_quad_l1_l6_a, gradleg_quad_l1_l6_a, gradleg_quad_l6_l1_a, gradleg_quad_l6_l1_a, gradleg_quad_l0_l6_a, gradleg_quad_l0_l6_a,
-      gradleg_quad_l7_l0_a_0, gradleg_quad_l7_l0_a_1, gradleg_quad_l1_l7_a_0, gradleg_quad_l1_l7_a_1,  gradleg_quad_l7_l1_a_0, gradleg_quad_l7_l1_a_1, gradleg_quad_l0_l7_a_0, gradleg_quad_l0_l7_a_1,
-      gradleg_quad_l8_l0_a, gradleg_quad_l8_l0_a, gradleg_quad_l1_l8_a, gradleg_quad_l1_l8_a, gradleg_quad_l8_l1_a, gradleg_quad_l8_l1_a, gradleg_quad_l0_l8_a, gradleg_quad_l0_l8_a,
-      gradleg_quad_l9_l0_a_0, gradleg_quad_l9_l0_a_1, gradleg_quad_l1_l9_a_0, gradleg_quad_l1_l9_a_1,  gradleg_quad_l9_l1_a_0, gradleg_quad_l9_l1_a_1, gradleg_quad_l0_l9_a_0, gradleg_quad_l0_l9_a_1,
-      gradleg_quad_l10_l0_a, gradleg_quad_l10_l0_a, gradleg_quad_l1_l10_a, gradleg_quad_l1_l10_a, gradleg_quad_l10_l1_a, gradleg_quad_l10_l1_a, gradleg_quad_l0_l10_a, gradleg_quad_l0_l10_a,
-      gradleg_quad_l11_l0_a_0, gradleg_quad_l11_l0_a_1, gradleg_quad_l1_l11_a_0, gradleg_quad_l1_l11_a_1,  gradleg_quad_l11_l1_a_0, gradleg_quad_l11_l1_a_1, gradleg_quad_l0_l11_a_0, gradleg_quad_l0_l11_a_1,
-
-      gradleg_quad_p0p2_b1_a,   gradleg_quad_p0p3_b1_a,   gradleg_quad_p0p4_b1_a,   gradleg_quad_p0p5_b1_a,   gradleg_quad_p0p6_b1_a,   gradleg_quad_p0p7_b1_a,   gradleg_quad_p0p8_b1_a,   gradleg_quad_p0p9_b1_a,   gradleg_quad_p0p10_b1_a,   gradleg_quad_p0p11_b1_a,   gradleg_quad_p1p2_b1_a,   gradleg_quad_p1p3_b1_a,   gradleg_quad_p1p4_b1_a,   gradleg_quad_p1p5_b1_a,   gradleg_quad_p1p6_b1_a,   gradleg_quad_p1p7_b1_a,   gradleg_quad_p1p8_b1_a,   gradleg_quad_p1p9_b1_a,   gradleg_quad_p1p10_b1_a,   gradleg_quad_p1p11_b1_a,   gradleg_quad_p2p2_b1_a,   gradleg_quad_p2p3_b1_a,   gradleg_quad_p2p4_b1_a,   gradleg_quad_p2p5_b1_a,   gradleg_quad_p2p6_b1_a,   gradleg_quad_p2p7_b1_a,   gradleg_quad_p2p8_b1_a,   gradleg_quad_p2p9_b1_a,   gradleg_quad_p2p10_b1_a,   gradleg_quad_p2p11_b1_a,   gradleg_quad_p3p2_b1_a,   gradleg_quad_p3p3_b1_a,   gradleg_quad_p3p4_b1_a,   gradleg_quad_p3p5_b1_a,   gradleg_quad_p3p6_b1_a,   gradleg_quad_p3p7_b1_a,   gradleg_quad_p3p8_b1_a,   gradleg_quad_p3p9_b1_a,   gradleg_quad_p3p10_b1_a,   gradleg_quad_p3p11_b1_a,   gradleg_quad_p4p2_b1_a,   gradleg_quad_p4p3_b1_a,   gradleg_quad_p4p4_b1_a,   gradleg_quad_p4p5_b1_a,   gradleg_quad_p4p6_b1_a,   gradleg_quad_p4p7_b1_a,   gradleg_quad_p4p8_b1_a,   gradleg_quad_p4p9_b1_a,   gradleg_quad_p4p10_b1_a,   gradleg_quad_p4p11_b1_a,   gradleg_quad_p5p2_b1_a,   gradleg_quad_p5p3_b1_a,   gradleg_quad_p5p4_b1_a,   gradleg_quad_p5p5_b1_a,   gradleg_quad_p5p6_b1_a,   gradleg_quad_p5p7_b1_a,   gradleg_quad_p5p8_b1_a,   gradleg_quad_p5p9_b1_a,   gradleg_quad_p5p10_b1_a,   gradleg_quad_p5p11_b1_a,   gradleg_quad_p6p2_b1_a,   gradleg_quad_p6p3_b1_a,   gradleg_quad_p6p4_b1_a,   gradleg_quad_p6p5_b1_a,   gradleg_quad_p6p6_b1_a,   gradleg_quad_p6p7_b1_a,   gradleg_quad_p6p8_b1_a,   gradleg_quad_p6p9_b1_a,   gradleg_quad_p6p10_b1_a,   gradleg_quad_p6p11_b1_a,   gradleg_quad_p7p2_b1_a,   gradleg_quad_p7p3_b1_a,   gradleg_quad_p7p4_b1_a,   gradleg_quad_p7p5_b1_a,   gradleg_quad_p7p6_b1_a,   gradleg_quad_p7p7_b1_a,   gradleg_quad_p7p8_b1_a,   gradleg_quad_p7p9_b1_a,   gradleg_quad_p7p10_b1_a,   gradleg_quad_p7p11_b1_a,   gradleg_quad_p8p2_b1_a,   gradleg_quad_p8p3_b1_a,   gradleg_quad_p8p4_b1_a,   gradleg_quad_p8p5_b1_a,   gradleg_quad_p8p6_b1_a,   gradleg_quad_p8p7_b1_a,   gradleg_quad_p8p8_b1_a,   gradleg_quad_p8p9_b1_a,   gradleg_quad_p8p10_b1_a,   gradleg_quad_p8p11_b1_a,   gradleg_quad_p9p2_b1_a,   gradleg_quad_p9p3_b1_a,   gradleg_quad_p9p4_b1_a,   gradleg_quad_p9p5_b1_a,   gradleg_quad_p9p6_b1_a,   gradleg_quad_p9p7_b1_a,   gradleg_quad_p9p8_b1_a,   gradleg_quad_p9p9_b1_a,   gradleg_quad_p9p10_b1_a,   gradleg_quad_p9p11_b1_a,   gradleg_quad_p10p2_b1_a,   gradleg_quad_p10p3_b1_a,   gradleg_quad_p10p4_b1_a,   gradleg_quad_p10p5_b1_a,   gradleg_quad_p10p6_b1_a,   gradleg_quad_p10p7_b1_a,   gradleg_quad_p10p8_b1_a,   gradleg_quad_p10p9_b1_a,   gradleg_quad_p10p10_b1_a,   gradleg_quad_p10p11_b1_a,   gradleg_quad_p2p0_b2_a,   gradleg_quad_p2p1_b2_a,   gradleg_quad_p2p2_b2_a,   gradleg_quad_p2p3_b2_a,   gradleg_quad_p2p4_b2_a,   gradleg_quad_p2p5_b2_a,   gradleg_quad_p2p6_b2_a,   gradleg_quad_p2p7_b2_a,   gradleg_quad_p2p8_b2_a,   gradleg_quad_p2p9_b2_a,   gradleg_quad_p2p10_b2_a,   gradleg_quad_p3p0_b2_a,   gradleg_quad_p3p1_b2_a,   gradleg_quad_p3p2_b2_a,   gradleg_quad_p3p3_b2_a,   gradleg_quad_p3p4_b2_a,   gradleg_quad_p3p5_b2_a,   gradleg_quad_p3p6_b2_a,   gradleg_quad_p3p7_b2_a,   gradleg_quad_p3p8_b2_a,   gradleg_quad_p3p9_b2_a,   gradleg_quad_p3p10_b2_a,   gradleg_quad_p4p0_b2_a,   gradleg_quad_p4p1_b2_a,   gradleg_quad_p4p2_b2_a,   gradleg_quad_p4p3_b2_a,   gradleg_quad_p4p4_b2_a,   gradleg_quad_p4p5_b2_a,   gradleg_quad_p4p6_b2_a,   gradleg_quad_p4p7_b2_a,   gradleg_quad_p4p8_b2_a,   gradleg_quad_p4p9_b2_a,   gradleg_quad_p4p10_b2_a,   gradleg_quad_p5p0_b2_a,   gradleg_quad_p5p1_b2_a,   gradleg_quad_p5p2_b2_a,   gradleg_quad_p5p3_b2_a,   gradleg_quad_p5p4_b2_a,   gradleg_quad_p5p5_b2_a,   gradleg_quad_p5p6_b2_a,   gradleg_quad_p5p7_b2_a,   gradleg_quad_p5p8_b2_a,   gradleg_quad_p5p9_b2_a,   gradleg_quad_p5p10_b2_a,   gradleg_quad_p6p0_b2_a,   gradleg_quad_p6p1_b2_a,   gradleg_quad_p6p2_b2_a,   gradleg_quad_p6p3_b2_a,   gradleg_quad_p6p4_b2_a,   gradleg_quad_p6p5_b2_a,   gradleg_quad_p6p6_b2_a,   gradleg_quad_p6p7_b2_a,   gradleg_quad_p6p8_b2_a,   gradleg_quad_p6p9_b2_a,   gradleg_quad_p6p10_b2_a,   gradleg_quad_p7p0_b2_a,   gradleg_quad_p7p1_b2_a,   gradleg_quad_p7p2_b2_a,   gradleg_quad_p7p3_b2_a,   gradleg_quad_p7p4_b2_a,   gradleg_quad_p7p5_b2_a,   gradleg_quad_p7p6_b2_a,   gradleg_quad_p7p7_b2_a,   gradleg_quad_p7p8_b2_a,   gradleg_quad_p7p9_b2_a,   gradleg_quad_p7p10_b2_a,   gradleg_quad_p8p0_b2_a,   gradleg_quad_p8p1_b2_a,   gradleg_quad_p8p2_b2_a,   gradleg_quad_p8p3_b2_a,   gradleg_quad_p8p4_b2_a,   gradleg_quad_p8p5_b2_a,   gradleg_quad_p8p6_b2_a,   gradleg_quad_p8p7_b2_a,   gradleg_quad_p8p8_b2_a,   gradleg_quad_p8p9_b2_a,   gradleg_quad_p8p10_b2_a,   gradleg_quad_p9p0_b2_a,   gradleg_quad_p9p1_b2_a,   gradleg_quad_p9p2_b2_a,   gradleg_quad_p9p3_b2_a,   gradleg_quad_p9p4_b2_a,   gradleg_quad_p9p5_b2_a,   gradleg_quad_p9p6_b2_a,   gradleg_quad_p9p7_b2_a,   gradleg_quad_p9p8_b2_a,   gradleg_quad_p9p9_b2_a,   gradleg_quad_p9p10_b2_a,   gradleg_quad_p10p0_b2_a,   gradleg_quad_p10p1_b2_a,   gradleg_quad_p10p2_b2_a,   gradleg_quad_p10p3_b2_a,   gradleg_quad_p10p4_b2_a,   gradleg_quad_p10p5_b2_a,   gradleg_quad_p10p6_b2_a,   gradleg_quad_p10p7_b2_a,   gradleg_quad_p10p8_b2_a,   gradleg_quad_p10p9_b2_a,   gradleg_quad_p10p10_b2_a,   gradleg_quad_p11p0_b2_a,   gradleg_quad_p11p1_b2_a,   gradleg_quad_p11p2_b2_a,   gradleg_quad_p11p3_b2_a,   gradleg_quad_p11p4_b2_a,   gradleg_quad_p11p5_b2_a,   gradleg_quad_p11p6_b2_a,   gradleg_quad_p11p7_b2_a,   gradleg_quad_p11p8_b2_a,   gradleg_quad_p11p9_b2_a,   gradleg_quad_p11p10_b2_a, };
-
-    static Shapeset::shape_fn_t gradleg_quad_fn_b[] =
+    static int gradleg_tri_bubble_indices_all_orders[] =
     {
-      gradleg_quad_p0_e1_b, gradleg_quad_p0_e1_b, gradleg_quad_p0_e2_b_0, gradleg_quad_p0_e2_b_1,  gradleg_quad_p0_e3_b, gradleg_quad_p0_e3_b, gradleg_quad_p0_e4_b_0, gradleg_quad_p0_e4_b_1,
-      gradleg_quad_l2_l0_b, gradleg_quad_l2_l0_b, gradleg_quad_l1_l2_b, gradleg_quad_l1_l2_b, gradleg_quad_l2_l1_b, gradleg_quad_l2_l1_b, gradleg_quad_l0_l2_b,  gradleg_quad_l0_l2_b,
-      gradleg_quad_l3_l0_b_0, gradleg_quad_l3_l0_b_1, gradleg_quad_l1_l3_b_0, gradleg_quad_l1_l3_b_1, gradleg_quad_l3_l1_b_0, gradleg_quad_l3_l1_b_1, gradleg_quad_l0_l3_b_0, gradleg_quad_l0_l3_b_1,
-      gradleg_quad_l4_l0_b, gradleg_quad_l4_l0_b, gradleg_quad_l1_l4_b, gradleg_quad_l1_l4_b, gradleg_quad_l4_l1_b, gradleg_quad_l4_l1_b, gradleg_quad_l0_l4_b,  gradleg_quad_l0_l4_b,
-      gradleg_quad_l5_l0_b_0, gradleg_quad_l5_l0_b_1, gradleg_quad_l1_l5_b_0, gradleg_quad_l1_l5_b_1, gradleg_quad_l5_l1_b_0, gradleg_quad_l5_l1_b_1, gradleg_quad_l0_l5_b_0, gradleg_quad_l0_l5_b_1,
-      gradleg_quad_l6_l0_b, gradleg_quad_l6_l0_b, gradleg_quad_l1_l6_b, gradleg_quad_l1_l6_b, gradleg_quad_l6_l1_b, gradleg_quad_l6_l1_b, gradleg_quad_l0_l6_b,  gradleg_quad_l0_l6_b,
-      gradleg_quad_l7_l0_b_0, gradleg_quad_l7_l0_b_1, gradleg_quad_l1_l7_b_0, gradleg_quad_l1_l7_b_1, gradleg_quad_l7_l1_b_0, gradleg_quad_l7_l1_b_1, gradleg_quad_l0_l7_b_0, gradleg_quad_l0_l7_b_1,
-      gradleg_quad_l8_l0_b, gradleg_quad_l8_l0_b, gradleg_quad_l1_l8_b, gradleg_quad_l1_l8_b, gradleg_quad_l8_l1_b, gradleg_quad_l8_l1_b, gradleg_quad_l0_l8_b,  gradleg_quad_l0_l8_b,
-      gradleg_quad_l9_l0_b_0, gradleg_quad_l9_l0_b_1, gradleg_quad_l1_l9_b_0, gradleg_quad_l1_l9_b_1, gradleg_quad_l9_l1_b_0, gradleg_quad_l9_l1_b_1, gradleg_quad_l0_l9_b_0, gradleg_quad_l0_l9_b_1,
-      gradleg_quad_l10_l0_b, gradleg_quad_l10_l0_b, gradleg_quad_l1_l10_b, gradleg_quad_l1_l10_b, gradleg_quad_l10_l1_b, gradleg_quad_l10_l1_b, gradleg_quad_l0_l10_b,  gradleg_quad_l0_l10_b,
-      gradleg_quad_l11_l0_b_0, gradleg_quad_l11_l0_b_1, gradleg_quad_l1_l11_b_0, gradleg_quad_l1_l11_b_1, gradleg_quad_l11_l1_b_0, gradleg_quad_l11_l1_b_1, gradleg_quad_l0_l11_b_0, gradleg_quad_l0_l11_b_1,
-
-      gradleg_quad_p0p2_b1_b,   gradleg_quad_p0p3_b1_b,   gradleg_quad_p0p4_b1_b,   gradleg_quad_p0p5_b1_b,   gradleg_quad_p0p6_b1_b,   gradleg_quad_p0p7_b1_b,   gradleg_quad_p0p8_b1_b,   gradleg_quad_p0p9_b1_b,   gradleg_quad_p0p10_b1_b,   gradleg_quad_p0p11_b1_b,   gradleg_quad_p1p2_b1_b,   gradleg_quad_p1p3_b1_b,   gradleg_quad_p1p4_b1_b,   gradleg_quad_p1p5_b1_b,   gradleg_quad_p1p6_b1_b,   gradleg_quad_p1p7_b1_b,   gradleg_quad_p1p8_b1_b,   gradleg_quad_p1p9_b1_b,   gradleg_quad_p1p10_b1_b,   gradleg_quad_p1p11_b1_b,   gradleg_quad_p2p2_b1_b,   gradleg_quad_p2p3_b1_b,   gradleg_quad_p2p4_b1_b,   gradleg_quad_p2p5_b1_b,   gradleg_quad_p2p6_b1_b,   gradleg_quad_p2p7_b1_b,   gradleg_quad_p2p8_b1_b,   gradleg_quad_p2p9_b1_b,   gradleg_quad_p2p10_b1_b,   gradleg_quad_p2p11_b1_b,   gradleg_quad_p3p2_b1_b,   gradleg_quad_p3p3_b1_b,   gradleg_quad_p3p4_b1_b,   gradleg_quad_p3p5_b1_b,   gradleg_quad_p3p6_b1_b,   gradleg_quad_p3p7_b1_b,   gradleg_quad_p3p8_b1_b,   gradleg_quad_p3p9_b1_b,   gradleg_quad_p3p10_b1_b,   gradleg_quad_p3p11_b1_b,   gradleg_quad_p4p2_b1_b,   gradleg_quad_p4p3_b1_b,   gradleg_quad_p4p4_b1_b,   gradleg_quad_p4p5_b1_b,   gradleg_quad_p4p6_b1_b,   gradleg_quad_p4p7_b1_b,   gradleg_quad_p4p8_b1_b,   gradleg_quad_p4p9_b1_b,   gradleg_quad_p4p10_b1_b,   gradleg_quad_p4p11_b1_b,   gradleg_quad_p5p2_b1_b,   gradleg_quad_p5p3_b1_b,   gradleg_quad_p5p4_b1_b,   gradleg_quad_p5p5_b1_b,   gradleg_quad_p5p6_b1_b,   gradleg_quad_p5p7_b1_b,   gradleg_quad_p5p8_b1_b,   gradleg_quad_p5p9_b1_b,   gradleg_quad_p5p10_b1_b,   gradleg_quad_p5p11_b1_b,   gradleg_quad_p6p2_b1_b,   gradleg_quad_p6p3_b1_b,   gradleg_quad_p6p4_b1_b,   gradleg_quad_p6p5_b1_b,   gradleg_quad_p6p6_b1_b,   gradleg_quad_p6p7_b1_b,   gradleg_quad_p6p8_b1_b,   gradleg_quad_p6p9_b1_b,   gradleg_quad_p6p10_b1_b,   gradleg_quad_p6p11_b1_b,   gradleg_quad_p7p2_b1_b,   gradleg_quad_p7p3_b1_b,   gradleg_quad_p7p4_b1_b,   gradleg_quad_p7p5_b1_b,   gradleg_quad_p7p6_b1_b,   gradleg_quad_p7p7_b1_b,   gradleg_quad_p7p8_b1_b,   gradleg_quad_p7p9_b1_b,   gradleg_quad_p7p10_b1_b,   gradleg_quad_p7p11_b1_b,   gradleg_quad_p8p2_b1_b,   gradleg_quad_p8p3_b1_b,   gradleg_quad_p8p4_b1_b,   gradleg_quad_p8p5_b1_b,   gradleg_quad_p8p6_b1_b,   gradleg_quad_p8p7_b1_b,   gradleg_quad_p8p8_b1_b,   gradleg_quad_p8p9_b1_b,   gradleg_quad_p8p10_b1_b,   gradleg_quad_p8p11_b1_b,   gradleg_quad_p9p2_b1_b,   gradleg_quad_p9p3_b1_b,   gradleg_quad_p9p4_b1_b,   gradleg_quad_p9p5_b1_b,   gradleg_quad_p9p6_b1_b,   gradleg_quad_p9p7_b1_b,   gradleg_quad_p9p8_b1_b,   gradleg_quad_p9p9_b1_b,   gradleg_quad_p9p10_b1_b,   gradleg_quad_p9p11_b1_b,   gradleg_quad_p10p2_b1_b,   gradleg_quad_p10p3_b1_b,   gradleg_quad_p10p4_b1_b,   gradleg_quad_p10p5_b1_b,   gradleg_quad_p10p6_b1_b,   gradleg_quad_p10p7_b1_b,   gradleg_quad_p10p8_b1_b,   gradleg_quad_p10p9_b1_b,   gradleg_quad_p10p10_b1_b,   gradleg_quad_p10p11_b1_b,   gradleg_quad_p2p0_b2_b,   gradleg_quad_p2p1_b2_b,   gradleg_quad_p2p2_b2_b,   gradleg_quad_p2p3_b2_b,   gradleg_quad_p2p4_b2_b,   gradleg_quad_p2p5_b2_b,   gradleg_quad_p2p6_b2_b,   gradleg_quad_p2p7_b2_b,   gradleg_quad_p2p8_b2_b,   gradleg_quad_p2p9_b2_b,   gradleg_quad_p2p10_b2_b,   gradleg_quad_p3p0_b2_b,   gradleg_quad_p3p1_b2_b,   gradleg_quad_p3p2_b2_b,   gradleg_quad_p3p3_b2_b,   gradleg_quad_p3p4_b2_b,   gradleg_quad_p3p5_b2_b,   gradleg_quad_p3p6_b2_b,   gradleg_quad_p3p7_b2_b,   gradleg_quad_p3p8_b2_b,   gradleg_quad_p3p9_b2_b,   gradleg_quad_p3p10_b2_b,   gradleg_quad_p4p0_b2_b,   gradleg_quad_p4p1_b2_b,   gradleg_quad_p4p2_b2_b,   gradleg_quad_p4p3_b2_b,   gradleg_quad_p4p4_b2_b,   gradleg_quad_p4p5_b2_b,   gradleg_quad_p4p6_b2_b,   gradleg_quad_p4p7_b2_b,   gradleg_quad_p4p8_b2_b,   gradleg_quad_p4p9_b2_b,   gradleg_quad_p4p10_b2_b,   gradleg_quad_p5p0_b2_b,   gradleg_quad_p5p1_b2_b,   gradleg_quad_p5p2_b2_b,   gradleg_quad_p5p3_b2_b,   gradleg_quad_p5p4_b2_b,   gradleg_quad_p5p5_b2_b,   gradleg_quad_p5p6_b2_b,   gradleg_quad_p5p7_b2_b,   gradleg_quad_p5p8_b2_b,   gradleg_quad_p5p9_b2_b,   gradleg_quad_p5p10_b2_b,   gradleg_quad_p6p0_b2_b,   gradleg_quad_p6p1_b2_b,   gradleg_quad_p6p2_b2_b,   gradleg_quad_p6p3_b2_b,   gradleg_quad_p6p4_b2_b,   gradleg_quad_p6p5_b2_b,   gradleg_quad_p6p6_b2_b,   gradleg_quad_p6p7_b2_b,   gradleg_quad_p6p8_b2_b,   gradleg_quad_p6p9_b2_b,   gradleg_quad_p6p10_b2_b,   gradleg_quad_p7p0_b2_b,   gradleg_quad_p7p1_b2_b,   gradleg_quad_p7p2_b2_b,   gradleg_quad_p7p3_b2_b,   gradleg_quad_p7p4_b2_b,   gradleg_quad_p7p5_b2_b,   gradleg_quad_p7p6_b2_b,   gradleg_quad_p7p7_b2_b,   gradleg_quad_p7p8_b2_b,   gradleg_quad_p7p9_b2_b,   gradleg_quad_p7p10_b2_b,   gradleg_quad_p8p0_b2_b,   gradleg_quad_p8p1_b2_b,   gradleg_quad_p8p2_b2_b,   gradleg_quad_p8p3_b2_b,   gradleg_quad_p8p4_b2_b,   gradleg_quad_p8p5_b2_b,   gradleg_quad_p8p6_b2_b,   gradleg_quad_p8p7_b2_b,   gradleg_quad_p8p8_b2_b,   gradleg_quad_p8p9_b2_b,   gradleg_quad_p8p10_b2_b,   gradleg_quad_p9p0_b2_b,   gradleg_quad_p9p1_b2_b,   gradleg_quad_p9p2_b2_b,   gradleg_quad_p9p3_b2_b,   gradleg_quad_p9p4_b2_b,   gradleg_quad_p9p5_b2_b,   gradleg_quad_p9p6_b2_b,   gradleg_quad_p9p7_b2_b,   gradleg_quad_p9p8_b2_b,   gradleg_quad_p9p9_b2_b,   gradleg_quad_p9p10_b2_b,   gradleg_quad_p10p0_b2_b,   gradleg_quad_p10p1_b2_b,   gradleg_quad_p10p2_b2_b,   gradleg_quad_p10p3_b2_b,   gradleg_quad_p10p4_b2_b,   gradleg_quad_p10p5_b2_b,   gradleg_quad_p10p6_b2_b,   gradleg_quad_p10p7_b2_b,   gradleg_quad_p10p8_b2_b,   gradleg_quad_p10p9_b2_b,   gradleg_quad_p10p10_b2_b,   gradleg_quad_p11p0_b2_b,   gradleg_quad_p11p1_b2_b,   gradleg_quad_p11p2_b2_b,   gradleg_quad_p11p3_b2_b,   gradleg_quad_p11p4_b2_b,   gradleg_quad_p11p5_b2_b,   gradleg_quad_p11p6_b2_b,   gradleg_quad_p11p7_b2_b,   gradleg_quad_p11p8_b2_b,   gradleg_quad_p11p9_b2_b,   gradleg_quad_p11p10_b2_b, };
+     66, 67, 68,
+     69, 70, 71, 93, 94,
+     72, 73, 74, 95, 96, 97, 98,
+     75, 76, 77, 99, 100, 101, 102, 103, 104,
+     78, 79, 80, 105, 106, 107, 108, 109, 110, 111, 112,
+     81, 82, 83, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122,
+     84, 85, 86, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134,
+     87, 88, 89, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148,
+     90, 91, 92, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164,
+    };
 
-    static Shapeset::shape_fn_t gradleg_quad_fn_ax[] =
+    static int* gradleg_tri_bubble_indices[11] =
     {
-      gradleg_quad_p0_e1_ax_0, gradleg_quad_p0_e1_ax_1, gradleg_quad_p0_e2_ax, gradleg_quad_p0_e2_ax, gradleg_quad_p0_e3_ax_0, gradleg_quad_p0_e3_ax_1, gradleg_quad_p0_e4_ax, gradleg_quad_p0_e4_ax,
-      gradleg_quad_l2_l0_ax, gradleg_quad_l2_l0_ax, gradleg_quad_l1_l2_ax, gradleg_quad_l1_l2_ax, gradleg_quad_l2_l1_ax, gradleg_quad_l2_l1_ax, gradleg_quad_l0_l2_ax, gradleg_quad_l0_l2_ax,
-      gradleg_quad_l3_l0_ax_0, gradleg_quad_l3_l0_ax_1, gradleg_quad_l1_l3_ax_0, gradleg_quad_l1_l3_ax_1,  gradleg_quad_l3_l1_ax_0, gradleg_quad_l3_l1_ax_1, gradleg_quad_l0_l3_ax_0, gradleg_quad_l0_l3_ax_1,
-      gradleg_quad_l4_l0_ax, gradleg_quad_l4_l0_ax, gradleg_quad_l1_l4_ax, gradleg_quad_l1_l4_ax, gradleg_quad_l4_l1_ax, gradleg_quad_l4_l1_ax, gradleg_quad_l0_l4_ax, gradleg_quad_l0_l4_ax,
-      gradleg_quad_l5_l0_ax_0, gradleg_quad_l5_l0_ax_1, gradleg_quad_l1_l5_ax_0, gradleg_quad_l1_l5_ax_1,  gradleg_quad_l5_l1_ax_0, gradleg_quad_l5_l1_ax_1, gradleg_quad_l0_l5_ax_0, gradleg_quad_l0_l5_ax_1,
-      gradleg_quad_l6_l0_ax, gradleg_quad_l6_l0_ax, gradleg_quad_l1_l6_ax, gradleg_quad_l1_l6_ax, gradleg_quad_l6_l1_ax, gradleg_quad_l6_l1_ax, gradleg_quad_l0_l6_ax, gradleg_quad_l0_l6_ax,
-      gradleg_quad_l7_l0_ax_0, gradleg_quad_l7_l0_ax_1, gradleg_quad_l1_l7_ax_0, gradleg_quad_l1_l7_ax_1,  gradleg_quad_l7_l1_ax_0, gradleg_quad_l7_l1_ax_1, gradleg_quad_l0_l7_ax_0, gradleg_quad_l0_l7_ax_1,
-      gradleg_quad_l8_l0_ax, gradleg_quad_l8_l0_ax, gradleg_quad_l1_l8_ax, gradleg_quad_l1_l8_ax, gradleg_quad_l8_l1_ax, gradleg_quad_l8_l1_ax, gradleg_quad_l0_l8_ax, gradleg_quad_l0_l8_ax,
-      gradleg_quad_l9_l0_ax_0, gradleg_quad_l9_l0_ax_1, gradleg_quad_l1_l9_ax_0, gradleg_quad_l1_l9_ax_1,  gradleg_quad_l9_l1_ax_0, gradleg_quad_l9_l1_ax_1, gradleg_quad_l0_l9_ax_0, gradleg_quad_l0_l9_ax_1,
-      gradleg_quad_l10_l0_ax, gradleg_quad_l10_l0_ax, gradleg_quad_l1_l10_ax, gradleg_quad_l1_l10_ax, gradleg_quad_l10_l1_ax, gradleg_quad_l10_l1_ax, gradleg_quad_l0_l10_ax, gradleg_quad_l0_l10_ax,
-      gradleg_quad_l11_l0_ax_0, gradleg_quad_l11_l0_ax_1, gradleg_quad_l1_l11_ax_0, gradleg_quad_l1_l11_ax_1,  gradleg_quad_l11_l1_ax_0, gradleg_quad_l11_l1_ax_1, gradleg_quad_l0_l11_ax_0, gradleg_quad_l0_l11_ax_1,
-
-      gradleg_quad_p0p2_b1_ax,   gradleg_quad_p0p3_b1_ax,   gradleg_quad_p0p4_b1_ax,   gradleg_quad_p0p5_b1_ax,   gradleg_quad_p0p6_b1_ax,   gradleg_quad_p0p7_b1_ax,   gradleg_quad_p0p8_b1_ax,   gradleg_quad_p0p9_b1_ax,   gradleg_quad_p0p10_b1_ax,   gradleg_quad_p0p11_b1_ax,   gradleg_quad_p1p2_b1_ax,   gradleg_quad_p1p3_b1_ax,   gradleg_quad_p1p4_b1_ax,   gradleg_quad_p1p5_b1_ax,   gradleg_quad_p1p6_b1_ax,   gradleg_quad_p1p7_b1_ax,   gradleg_quad_p1p8_b1_ax,   gradleg_quad_p1p9_b1_ax,   gradleg_quad_p1p10_b1_ax,   gradleg_quad_p1p11_b1_ax,   gradleg_quad_p2p2_b1_ax,   gradleg_quad_p2p3_b1_ax,   gradleg_quad_p2p4_b1_ax,   gradleg_quad_p2p5_b1_ax,   gradleg_quad_p2p6_b1_ax,   gradleg_quad_p2p7_b1_ax,   gradleg_quad_p2p8_b1_ax,   gradleg_quad_p2p9_b1_ax,   gradleg_quad_p2p10_b1_ax,   gradleg_quad_p2p11_b1_ax,   gradleg_quad_p3p2_b1_ax,   gradleg_quad_p3p3_b1_ax,   gradleg_quad_p3p4_b1_ax,   gradleg_quad_p3p5_b1_ax,   gradleg_quad_p3p6_b1_ax,   gradleg_quad_p3p7_b1_ax,   gradleg_quad_p3p8_b1_ax,   gradleg_quad_p3p9_b1_ax,   gradleg_quad_p3p10_b1_ax,   gradleg_quad_p3p11_b1_ax,   gradleg_quad_p4p2_b1_ax,   gradleg_quad_p4p3_b1_ax,   gradleg_quad_p4p4_b1_ax,   gradleg_quad_p4p5_b1_ax,   gradleg_quad_p4p6_b1_ax,   gradleg_quad_p4p7_b1_ax,   gradleg_quad_p4p8_b1_ax,   gradleg_quad_p4p9_b1_ax,   gradleg_quad_p4p10_b1_ax,   gradleg_quad_p4p11_b1_ax,   gradleg_quad_p5p2_b1_ax,   gradleg_quad_p5p3_b1_ax,   gradleg_quad_p5p4_b1_ax,   gradleg_quad_p5p5_b1_ax,   gradleg_quad_p5p6_b1_ax,   gradleg_quad_p5p7_b1_ax,   gradleg_quad_p5p8_b1_ax,   gradleg_quad_p5p9_b1_ax,   gradleg_quad_p5p10_b1_ax,   gradleg_quad_p5p11_b1_ax,   gradleg_quad_p6p2_b1_ax,   gradleg_quad_p6p3_b1_ax,   gradleg_quad_p6p4_b1_ax,   gradleg_quad_p6p5_b1_ax,   gradleg_quad_p6p6_b1_ax,   gradleg_quad_p6p7_b1_ax,   gradleg_quad_p6p8_b1_ax,   gradleg_quad_p6p9_b1_ax,   gradleg_quad_p6p10_b1_ax,   gradleg_quad_p6p11_b1_ax,   gradleg_quad_p7p2_b1_ax,   gradleg_quad_p7p3_b1_ax,   gradleg_quad_p7p4_b1_ax,   gradleg_quad_p7p5_b1_ax,   gradleg_quad_p7p6_b1_ax,   gradleg_quad_p7p7_b1_ax,   gradleg_quad_p7p8_b1_ax,   gradleg_quad_p7p9_b1_ax,   gradleg_quad_p7p10_b1_ax,   gradleg_quad_p7p11_b1_ax,   gradleg_quad_p8p2_b1_ax,   gradleg_quad_p8p3_b1_ax,   gradleg_quad_p8p4_b1_ax,   gradleg_quad_p8p5_b1_ax,   gradleg_quad_p8p6_b1_ax,   gradleg_quad_p8p7_b1_ax,   gradleg_quad_p8p8_b1_ax,   gradleg_quad_p8p9_b1_ax,   gradleg_quad_p8p10_b1_ax,   gradleg_quad_p8p11_b1_ax,   gradleg_quad_p9p2_b1_ax,   gradleg_quad_p9p3_b1_ax,   gradleg_quad_p9p4_b1_ax,   gradleg_quad_p9p5_b1_ax,   gradleg_quad_p9p6_b1_ax,   gradleg_quad_p9p7_b1_ax,   gradleg_quad_p9p8_b1_ax,   gradleg_quad_p9p9_b1_ax,   gradleg_quad_p9p10_b1_ax,   gradleg_quad_p9p11_b1_ax,   gradleg_quad_p10p2_b1_ax,   gradleg_quad_p10p3_b1_ax,   gradleg_quad_p10p4_b1_ax,   gradleg_quad_p10p5_b1_ax,   gradleg_quad_p10p6_b1_ax,   gradleg_quad_p10p7_b1_ax,   gradleg_quad_p10p8_b1_ax,   gradleg_quad_p10p9_b1_ax,   gradleg_quad_p10p10_b1_ax,   gradleg_quad_p10p11_b1_ax,   gradleg_quad_p2p0_b2_ax,   gradleg_quad_p2p1_b2_ax,   gradleg_quad_p2p2_b2_ax,   gradleg_quad_p2p3_b2_ax,   gradleg_quad_p2p4_b2_ax,   gradleg_quad_p2p5_b2_ax,   gradleg_quad_p2p6_b2_ax,   gradleg_quad_p2p7_b2_ax,   gradleg_quad_p2p8_b2_ax,   gradleg_quad_p2p9_b2_ax,   gradleg_quad_p2p10_b2_ax,   gradleg_quad_p3p0_b2_ax,   gradleg_quad_p3p1_b2_ax,   gradleg_quad_p3p2_b2_ax,   gradleg_quad_p3p3_b2_ax,   gradleg_quad_p3p4_b2_ax,   gradleg_quad_p3p5_b2_ax,   gradleg_quad_p3p6_b2_ax,   gradleg_quad_p3p7_b2_ax,   gradleg_quad_p3p8_b2_ax,   gradleg_quad_p3p9_b2_ax,   gradleg_quad_p3p10_b2_ax,   gradleg_quad_p4p0_b2_ax,   gradleg_quad_p4p1_b2_ax,   gradleg_quad_p4p2_b2_ax,   gradleg_quad_p4p3_b2_ax,   gradleg_quad_p4p4_b2_ax,   gradleg_quad_p4p5_b2_ax,   gradleg_quad_p4p6_b2_ax,   gradleg_quad_p4p7_b2_ax,   gradleg_quad_p4p8_b2_ax,   gradleg_quad_p4p9_b2_ax,   gradleg_quad_p4p10_b2_ax,   gradleg_quad_p5p0_b2_ax,   gradleg_quad_p5p1_b2_ax,   gradleg_quad_p5p2_b2_ax,   gradleg_quad_p5p3_b2_ax,   gradleg_quad_p5p4_b2_ax,   gradleg_quad_p5p5_b2_ax,   gradleg_quad_p5p6_b2_ax,   gradleg_quad_p5p7_b2_ax,   gradleg_quad_p5p8_b2_ax,   gradleg_quad_p5p9_b2_ax,   gradleg_quad_p5p10_b2_ax,   gradleg_quad_p6p0_b2_ax,   gradleg_quad_p6p1_b2_ax,   gradleg_quad_p6p2_b2_ax,   gradleg_quad_p6p3_b2_ax,   gradleg_quad_p6p4_b2_ax,   gradleg_quad_p6p5_b2_ax,   gradleg_quad_p6p6_b2_ax,   gradleg_quad_p6p7_b2_ax,   gradleg_quad_p6p8_b2_ax,   gradleg_quad_p6p9_b2_ax,   gradleg_quad_p6p10_b2_ax,   gradleg_quad_p7p0_b2_ax,   gradleg_quad_p7p1_b2_ax,   gradleg_quad_p7p2_b2_ax,   gradleg_quad_p7p3_b2_ax,   gradleg_quad_p7p4_b2_ax,   gradleg_quad_p7p5_b2_ax,   gradleg_quad_p7p6_b2_ax,   gradleg_quad_p7p7_b2_ax,   gradleg_quad_p7p8_b2_ax,   gradleg_quad_p7p9_b2_ax,   gradleg_quad_p7p10_b2_ax,   gradleg_quad_p8p0_b2_ax,   gradleg_quad_p8p1_b2_ax,   gradleg_quad_p8p2_b2_ax,   gradleg_quad_p8p3_b2_ax,   gradleg_quad_p8p4_b2_ax,   gradleg_quad_p8p5_b2_ax,   gradleg_quad_p8p6_b2_ax,   gradleg_quad_p8p7_b2_ax,   gradleg_quad_p8p8_b2_ax,   gradleg_quad_p8p9_b2_ax,   gradleg_quad_p8p10_b2_ax,   gradleg_quad_p9p0_b2_ax,   gradleg_quad_p9p1_b2_ax,   gradleg_quad_p9p2_b2_ax,   gradleg_quad_p9p3_b2_ax,   gradleg_quad_p9p4_b2_ax,   gradleg_quad_p9p5_b2_ax,   gradleg_quad_p9p6_b2_ax,   gradleg_quad_p9p7_b2_ax,   gradleg_quad_p9p8_b2_ax,   gradleg_quad_p9p9_b2_ax,   gradleg_quad_p9p10_b2_ax,   gradleg_quad_p10p0_b2_ax,   gradleg_quad_p10p1_b2_ax,   gradleg_quad_p10p2_b2_ax,   gradleg_quad_p10p3_b2_ax,   gradleg_quad_p10p4_b2_ax,   gradleg_quad_p10p5_b2_ax,   gradleg_quad_p10p6_b2_ax,   gradleg_quad_p10p7_b2_ax,   gradleg_quad_p10p8_b2_ax,   gradleg_quad_p10p9_b2_ax,   gradleg_quad_p10p10_b2_ax,   gradleg_quad_p11p0_b2_ax,   gradleg_quad_p11p1_b2_ax,   gradleg_quad_p11p2_b2_ax,   gradleg_quad_p11p3_b2_ax,   gradleg_quad_p11p4_b2_ax,   gradleg_quad_p11p5_b2_ax,   gradleg_quad_p11p6_b2_ax,   gradleg_quad_p11p7_b2_ax,   gradleg_quad_p11p8_b2_ax,   gradleg_quad_p11p9_b2_ax,   gradleg_quad_p11p10_b2_ax, };
+      NULL, NULL,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders,
+      gradleg_tri_bubble_indices_all_orders
+    };
 
-    static Shapeset::shape_fn_t gradleg_quad_fn_bx[] =
-    {
-      gradleg_quad_p0_e1_bx, gradleg_quad_p0_e1_bx, gradleg_quad_p0_e2_bx_0, gradleg_quad_p0_e2_bx_1,  gradleg_quad_p0_e3_bx, gradleg_quad_p0_e3_bx, gradleg_quad_p0_e4_bx_0, gradleg_quad_p0_e4_bx_1,
-      gradleg_quad_l2_l0_bx, gradleg_quad_l2_l0_bx, gradleg_quad_l1_l2_bx, gradleg_quad_l1_l2_bx, gradleg_quad_l2_l1_bx, gradleg_quad_l2_l1_bx, gradleg_quad_l0_l2_bx,  gradleg_quad_l0_l2_bx,
-      gradleg_quad_l3_l0_bx_0, gradleg_quad_l3_l0_bx_1, gradleg_quad_l1_l3_bx_0, gradleg_quad_l1_l3_bx_1, gradleg_quad_l3_l1_bx_0, gradleg_quad_l3_l1_bx_1, gradleg_quad_l0_l3_bx_0, gradleg_quad_l0_l3_bx_1,
-      gradleg_quad_l4_l0_bx, gradleg_quad_l4_l0_bx, gradleg_quad_l1_l4_bx, gradleg_quad_l1_l4_bx, gradleg_quad_l4_l1_bx, gradleg_quad_l4_l1_bx, gradleg_quad_l0_l4_bx,  gradleg_quad_l0_l4_bx,
-      gradleg_quad_l5_l0_bx_0, gradleg_quad_l5_l0_bx_1, gradleg_quad_l1_l5_bx_0, gradleg_quad_l1_l5_bx_1, gradleg_quad_l5_l1_bx_0, gradleg_quad_l5_l1_bx_1, gradleg_quad_l0_l5_bx_0, gradleg_quad_l0_l5_bx_1,
-      gradleg_quad_l6_l0_bx, gradleg_quad_l6_l0_bx, gradleg_quad_l1_l6_bx, gradleg_quad_l1_l6_bx, gradleg_quad_l6_l1_bx, gradleg_quad_l6_l1_bx, gradleg_quad_l0_l6_bx,  gradleg_quad_l0_l6_bx,
-      gradleg_quad_l7_l0_bx_0, gradleg_quad_l7_l0_bx_1, gradleg_quad_l1_l7_bx_0, gradleg_quad_l1_l7_bx_1, gradleg_quad_l7_l1_bx_0, gradleg_quad_l7_l1_bx_1, gradleg_quad_l0_l7_bx_0, gradleg_quad_l0_l7_bx_1,
-      gradleg_quad_l8_l0_bx, gradleg_quad_l8_l0_bx, gradleg_quad_l1_l8_bx, gradleg_quad_l1_l8_bx, gradleg_quad_l8_l1_bx, gradleg_quad_l8_l1_bx, gradleg_quad_l0_l8_bx,  gradleg_quad_l0_l8_bx,
-      gradleg_quad_l9_l0_bx_0, gradleg_quad_l9_l0_bx_1, gradleg_quad_l1_l9_bx_0, gradleg_quad_l1_l9_bx_1, gradleg_quad_l9_l1_bx_0, gradleg_quad_l9_l1_bx_1, gradleg_quad_l0_l9_bx_0, gradleg_quad_l0_l9_bx_1,
-      gradleg_quad_l10_l0_bx, gradleg_quad_l10_l0_bx, gradleg_quad_l1_l10_bx, gradleg_quad_l1_l10_bx, gradleg_quad_l10_l1_bx, gradleg_quad_l10_l1_bx, gradleg_quad_l0_l10_bx,  gradleg_quad_l0_l10_bx,
-      gradleg_quad_l11_l0_bx_0, gradleg_quad_l11_l0_bx_1, gradleg_quad_l1_l11_bx_0, gradleg_quad_l1_l11_bx_1, gradleg_quad_l11_l1_bx_0, gradleg_quad_l11_l1_bx_1, gradleg_quad_l0_l11_bx_0, gradleg_quad_l0_l11_bx_1,
+    static int gradleg_tri_bubble_count[11] = { 0, 0, 3, 8, 15, 24, 35, 48, 63, 80, 99, };
 
-      gradleg_quad_p0p2_b1_bx,   gradleg_quad_p0p3_b1_bx,   gradleg_quad_p0p4_b1_bx,   gradleg_quad_p0p5_b1_bx,   gradleg_quad_p0p6_b1_bx,   gradleg_quad_p0p7_b1_bx,   gradleg_quad_p0p8_b1_bx,   gradleg_quad_p0p9_b1_bx,   gradleg_quad_p0p10_b1_bx,   gradleg_quad_p0p11_b1_bx,   gradleg_quad_p1p2_b1_bx,   gradleg_quad_p1p3_b1_bx,   gradleg_quad_p1p4_b1_bx,   gradleg_quad_p1p5_b1_bx,   gradleg_quad_p1p6_b1_bx,   gradleg_quad_p1p7_b1_bx,   gradleg_quad_p1p8_b1_bx,   gradleg_quad_p1p9_b1_bx,   gradleg_quad_p1p10_b1_bx,   gradleg_quad_p1p11_b1_bx,   gradleg_quad_p2p2_b1_bx,   gradleg_quad_p2p3_b1_bx,   gradleg_quad_p2p4_b1_bx,   gradleg_quad_p2p5_b1_bx,   gradleg_quad_p2p6_b1_bx,   gradleg_quad_p2p7_b1_bx,   gradleg_quad_p2p8_b1_bx,   gradleg_quad_p2p9_b1_bx,   gradleg_quad_p2p10_b1_bx,   gradleg_quad_p2p11_b1_bx,   gradleg_quad_p3p2_b1_bx,   gradleg_quad_p3p3_b1_bx,   gradleg_quad_p3p4_b1_bx,   gradleg_quad_p3p5_b1_bx,   gradleg_quad_p3p6_b1_bx,   gradleg_quad_p3p7_b1_bx,   gradleg_quad_p3p8_b1_bx,   gradleg_quad_p3p9_b1_bx,   gradleg_quad_p3p10_b1_bx,   gradleg_quad_p3p11_b1_bx,   gradleg_quad_p4p2_b1_bx,   gradleg_quad_p4p3_b1_bx,   gradleg_quad_p4p4_b1_bx,   gradleg_quad_p4p5_b1_bx,   gradleg_quad_p4p6_b1_bx,   gradleg_quad_p4p7_b1_bx,   gradleg_quad_p4p8_b1_bx,   gradleg_quad_p4p9_b1_bx,   gradleg_quad_p4p10_b1_bx,   gradleg_quad_p4p11_b1_bx,   gradleg_quad_p5p2_b1_bx,   gradleg_quad_p5p3_b1_bx,   gradleg_quad_p5p4_b1_bx,   gradleg_quad_p5p5_b1_bx,   gradleg_quad_p5p6_b1_bx,   gradleg_quad_p5p7_b1_bx,   gradleg_quad_p5p8_b1_bx,   gradleg_quad_p5p9_b1_bx,   gradleg_quad_p5p10_b1_bx,   gradleg_quad_p5p11_b1_bx,   gradleg_quad_p6p2_b1_bx,   gradleg_quad_p6p3_b1_bx,   gradleg_quad_p6p4_b1_bx,   gradleg_quad_p6p5_b1_bx,   gradleg_quad_p6p6_b1_bx,   gradleg_quad_p6p7_b1_bx,   gradleg_quad_p6p8_b1_bx,   gradleg_quad_p6p9_b1_bx,   gradleg_quad_p6p10_b1_bx,   gradleg_quad_p6p11_b1_bx,   gradleg_quad_p7p2_b1_bx,   gradleg_quad_p7p3_b1_bx,   gradleg_quad_p7p4_b1_bx,   gradleg_quad_p7p5_b1_bx,   gradleg_quad_p7p6_b1_bx,   gradleg_quad_p7p7_b1_bx,   gradleg_quad_p7p8_b1_bx,   gradleg_quad_p7p9_b1_bx,   gradleg_quad_p7p10_b1_bx,   gradleg_quad_p7p11_b1_bx,   gradleg_quad_p8p2_b1_bx,   gradleg_quad_p8p3_b1_bx,   gradleg_quad_p8p4_b1_bx,   gradleg_quad_p8p5_b1_bx,   gradleg_quad_p8p6_b1_bx,   gradleg_quad_p8p7_b1_bx,   gradleg_quad_p8p8_b1_bx,   gradleg_quad_p8p9_b1_bx,   gradleg_quad_p8p10_b1_bx,   gradleg_quad_p8p11_b1_bx,   gradleg_quad_p9p2_b1_bx,   gradleg_quad_p9p3_b1_bx,   gradleg_quad_p9p4_b1_bx,   gradleg_quad_p9p5_b1_bx,   gradleg_quad_p9p6_b1_bx,   gradleg_quad_p9p7_b1_bx,   gradleg_quad_p9p8_b1_bx,   gradleg_quad_p9p9_b1_bx,   gradleg_quad_p9p10_b1_bx,   gradleg_quad_p9p11_b1_bx,   gradleg_quad_p10p2_b1_bx,   gradleg_quad_p10p3_b1_bx,   gradleg_quad_p10p4_b1_bx,   gradleg_quad_p10p5_b1_bx,   gradleg_quad_p10p6_b1_bx,   gradleg_quad_p10p7_b1_bx,   gradleg_quad_p10p8_b1_bx,   gradleg_quad_p10p9_b1_bx,   gradleg_quad_p10p10_b1_bx,   gradleg_quad_p10p11_b1_bx,   gradleg_quad_p2p0_b2_bx,   gradleg_quad_p2p1_b2_bx,   gradleg_quad_p2p2_b2_bx,   gradleg_quad_p2p3_b2_bx,   gradleg_quad_p2p4_b2_bx,   gradleg_quad_p2p5_b2_bx,   gradleg_quad_p2p6_b2_bx,   gradleg_quad_p2p7_b2_bx,   gradleg_quad_p2p8_b2_bx,   gradleg_quad_p2p9_b2_bx,   gradleg_quad_p2p10_b2_bx,   gradleg_quad_p3p0_b2_bx,   gradleg_quad_p3p1_b2_bx,   gradleg_quad_p3p2_b2_bx,   gradleg_quad_p3p3_b2_bx,   gradleg_quad_p3p4_b2_bx,   gradleg_quad_p3p5_b2_bx,   gradleg_quad_p3p6_b2_bx,   gradleg_quad_p3p7_b2_bx,   gradleg_quad_p3p8_b2_bx,   gradleg_quad_p3p9_b2_bx,   gradleg_quad_p3p10_b2_bx,   gradleg_quad_p4p0_b2_bx,   gradleg_quad_p4p1_b2_bx,   gradleg_quad_p4p2_b2_bx,   gradleg_quad_p4p3_b2_bx,   gradleg_quad_p4p4_b2_bx,   gradleg_quad_p4p5_b2_bx,   gradleg_quad_p4p6_b2_bx,   gradleg_quad_p4p7_b2_bx,   gradleg_quad_p4p8_b2_bx,   gradleg_quad_p4p9_b2_bx,   gradleg_quad_p4p10_b2_bx,   gradleg_quad_p5p0_b2_bx,   gradleg_quad_p5p1_b2_bx,   gradleg_quad_p5p2_b2_bx,   gradleg_quad_p5p3_b2_bx,   gradleg_quad_p5p4_b2_bx,   gradleg_quad_p5p5_b2_bx,   gradleg_quad_p5p6_b2_bx,   gradleg_quad_p5p7_b2_bx,   gradleg_quad_p5p8_b2_bx,   gradleg_quad_p5p9_b2_bx,   gradleg_quad_p5p10_b2_bx,   gradleg_quad_p6p0_b2_bx,   gradleg_quad_p6p1_b2_bx,   gradleg_quad_p6p2_b2_bx,   gradleg_quad_p6p3_b2_bx,   gradleg_quad_p6p4_b2_bx,   gradleg_quad_p6p5_b2_bx,   gradleg_quad_p6p6_b2_bx,   gradleg_quad_p6p7_b2_bx,   gradleg_quad_p6p8_b2_bx,   gradleg_quad_p6p9_b2_bx,   gradleg_quad_p6p10_b2_bx,   gradleg_quad_p7p0_b2_bx,   gradleg_quad_p7p1_b2_bx,   gradleg_quad_p7p2_b2_bx,   gradleg_quad_p7p3_b2_bx,   gradleg_quad_p7p4_b2_bx,   gradleg_quad_p7p5_b2_bx,   gradleg_quad_p7p6_b2_bx,   gradleg_quad_p7p7_b2_bx,   gradleg_quad_p7p8_b2_bx,   gradleg_quad_p7p9_b2_bx,   gradleg_quad_p7p10_b2_bx,   gradleg_quad_p8p0_b2_bx,   gradleg_quad_p8p1_b2_bx,   gradleg_quad_p8p2_b2_bx,   gradleg_quad_p8p3_b2_bx,   gradleg_quad_p8p4_b2_bx,   gradleg_quad_p8p5_b2_bx,   gradleg_quad_p8p6_b2_bx,   gradleg_quad_p8p7_b2_bx,   gradleg_quad_p8p8_b2_bx,   gradleg_quad_p8p9_b2_bx,   gradleg_quad_p8p10_b2_bx,   gradleg_quad_p9p0_b2_bx,   gradleg_quad_p9p1_b2_bx,   gradleg_quad_p9p2_b2_bx,   gradleg_quad_p9p3_b2_bx,   gradleg_quad_p9p4_b2_bx,   gradleg_quad_p9p5_b2_bx,   gradleg_quad_p9p6_b2_bx,   gradleg_quad_p9p7_b2_bx,   gradleg_quad_p9p8_b2_bx,   gradleg_quad_p9p9_b2_bx,   gradleg_quad_p9p10_b2_bx,   gradleg_quad_p10p0_b2_bx,   gradleg_quad_p10p1_b2_bx,   gradleg_quad_p10p2_b2_bx,   gradleg_quad_p10p3_b2_bx,   gradleg_quad_p10p4_b2_bx,   gradleg_quad_p10p5_b2_bx,   gradleg_quad_p10p6_b2_bx,   gradleg_quad_p10p7_b2_bx,   gradleg_quad_p10p8_b2_bx,   gradleg_quad_p10p9_b2_bx,   gradleg_quad_p10p10_b2_bx,   gradleg_quad_p11p0_b2_bx,   gradleg_quad_p11p1_b2_bx,   gradleg_quad_p11p2_b2_bx,   gradleg_quad_p11p3_b2_bx,   gradleg_quad_p11p4_b2_bx,   gradleg_quad_p11p5_b2_bx,   gradleg_quad_p11p6_b2_bx,   gradleg_quad_p11p7_b2_bx,   gradleg_quad_p11p8_b2_bx,   gradleg_quad_p11p9_b2_bx,   gradleg_quad_p11p10_b2_bx, };
+    static int gradleg_tri_edge_indices_0[22] =  {  0, 1, 6, 7, 12, 13, 18, 19, 24, 25, 30, 31, 36, 37, 42, 43, 48, 49, 54, 55, 60, 61, };
+    static int gradleg_tri_edge_indices_1[22] =  {  2, 3, 8, 9, 14, 15, 20, 21, 26, 27, 32, 33, 38, 39, 44, 45, 50, 51, 56, 57, 62, 63, };
+    static int gradleg_tri_edge_indices_2[22] =  {  4, 5, 10, 11, 16, 17, 22, 23, 28, 29, 34, 35, 40, 41, 46, 47, 52, 53, 58, 59, 64, 65, };
 
-    static Shapeset::shape_fn_t gradleg_quad_fn_ay[] =
+    static int* gradleg_tri_edge_indices[3] =
     {
-      gradleg_quad_p0_e1_ay_0, gradleg_quad_p0_e1_ay_1, gradleg_quad_p0_e2_ay, gradleg_quad_p0_e2_ay, gradleg_quad_p0_e3_ay_0, gradleg_quad_p0_e3_ay_1, gradleg_quad_p0_e4_ay, gradleg_quad_p0_e4_ay,
-      gradleg_quad_l2_l0_ay, gradleg_quad_l2_l0_ay, gradleg_quad_l1_l2_ay, gradleg_quad_l1_l2_ay, gradleg_quad_l2_l1_ay, gradleg_quad_l2_l1_ay, gradleg_quad_l0_l2_ay, gradleg_quad_l0_l2_ay,
-      gradleg_quad_l3_l0_ay_0, gradleg_quad_l3_l0_ay_1, gradleg_quad_l1_l3_ay_0, gradleg_quad_l1_l3_ay_1,  gradleg_quad_l3_l1_ay_0, gradleg_quad_l3_l1_ay_1, gradleg_quad_l0_l3_ay_0, gradleg_quad_l0_l3_ay_1,
-      gradleg_quad_l4_l0_ay, gradleg_quad_l4_l0_ay, gradleg_quad_l1_l4_ay, gradleg_quad_l1_l4_ay, gradleg_quad_l4_l1_ay, gradleg_quad_l4_l1_ay, gradleg_quad_l0_l4_ay, gradleg_quad_l0_l4_ay,
-      gradleg_quad_l5_l0_ay_0, gradleg_quad_l5_l0_ay_1, gradleg_quad_l1_l5_ay_0, gradleg_quad_l1_l5_ay_1,  gradleg_quad_l5_l1_ay_0, gradleg_quad_l5_l1_ay_1, gradleg_quad_l0_l5_ay_0, gradleg_quad_l0_l5_ay_1,
-      gradleg_quad_l6_l0_ay, gradleg_quad_l6_l0_ay, gradleg_quad_l1_l6_ay, gradleg_quad_l1_l6_ay, gradleg_quad_l6_l1_ay, gradleg_quad_l6_l1_ay, gradleg_quad_l0_l6_ay, gradleg_quad_l0_l6_ay,
-      gradleg_quad_l7_l0_ay_0, gradleg_quad_l7_l0_ay_1, gradleg_quad_l1_l7_ay_0, gradleg_quad_l1_l7_ay_1,  gradleg_quad_l7_l1_ay_0, gradleg_quad_l7_l1_ay_1, gradleg_quad_l0_l7_ay_0, gradleg_quad_l0_l7_ay_1,
-      gradleg_quad_l8_l0_ay, gradleg_quad_l8_l0_ay, gradleg_quad_l1_l8_ay, gradleg_quad_l1_l8_ay, gradleg_quad_l8_l1_ay, gradleg_quad_l8_l1_ay, gradleg_quad_l0_l8_ay, gradleg_quad_l0_l8_ay,
-      gradleg_quad_l9_l0_ay_0, gradleg_quad_l9_l0_ay_1, gradleg_quad_l1_l9_ay_0, gradleg_quad_l1_l9_ay_1,  gradleg_quad_l9_l1_ay_0, gradleg_quad_l9_l1_ay_1, gradleg_quad_l0_l9_ay_0, gradleg_quad_l0_l9_ay_1,
-      gradleg_quad_l10_l0_ay, gradleg_quad_l10_l0_ay, gradleg_quad_l1_l10_ay, gradleg_quad_l1_l10_ay, gradleg_quad_l10_l1_ay, gradleg_quad_l10_l1_ay, gradleg_quad_l0_l10_ay, gradleg_quad_l0_l10_ay,
-      gradleg_quad_l11_l0_ay_0, gradleg_quad_l11_l0_ay_1, gradleg_quad_l1_l11_ay_0, gradleg_quad_l1_l11_ay_1,  gradleg_quad_l11_l1_ay_0, gradleg_quad_l11_l1_ay_1, gradleg_quad_l0_l11_ay_0, gradleg_quad_l0_l11_ay_1,
+      gradleg_tri_edge_indices_0,
+      gradleg_tri_edge_indices_1,
+      gradleg_tri_edge_indices_2,
+    };
 
-      gradleg_quad_p0p2_b1_ay,   gradleg_quad_p0p3_b1_ay,   gradleg_quad_p0p4_b1_ay,   gradleg_quad_p0p5_b1_ay,   gradleg_quad_p0p6_b1_ay,   gradleg_quad_p0p7_b1_ay,   gradleg_quad_p0p8_b1_ay,   gradleg_quad_p0p9_b1_ay,   gradleg_quad_p0p10_b1_ay,   gradleg_quad_p0p11_b1_ay,   gradleg_quad_p1p2_b1_ay,   gradleg_quad_p1p3_b1_ay,   gradleg_quad_p1p4_b1_ay,   gradleg_quad_p1p5_b1_ay,   gradleg_quad_p1p6_b1_ay,   gradleg_quad_p1p7_b1_ay,   gradleg_quad_p1p8_b1_ay,   gradleg_quad_p1p9_b1_ay,   gradleg_quad_p1p10_b1_ay,   gradleg_quad_p1p11_b1_ay,   gradleg_quad_p2p2_b1_ay,   gradleg_quad_p2p3_b1_ay,   gradleg_quad_p2p4_b1_ay,   gradleg_quad_p2p5_b1_ay,   gradleg_quad_p2p6_b1_ay,   gradleg_quad_p2p7_b1_ay,   gradleg_quad_p2p8_b1_ay,   gradleg_quad_p2p9_b1_ay,   gradleg_quad_p2p10_b1_ay,   gradleg_quad_p2p11_b1_ay,   gradleg_quad_p3p2_b1_ay,   gradleg_quad_p3p3_b1_ay,   gradleg_quad_p3p4_b1_ay,   gradleg_quad_p3p5_b1_ay,   gradleg_quad_p3p6_b1_ay,   gradleg_quad_p3p7_b1_ay,   gradleg_quad_p3p8_b1_ay,   gradleg_quad_p3p9_b1_ay,   gradleg_quad_p3p10_b1_ay,   gradleg_quad_p3p11_b1_ay,   gradleg_quad_p4p2_b1_ay,   gradleg_quad_p4p3_b1_ay,   gradleg_quad_p4p4_b1_ay,   gradleg_quad_p4p5_b1_ay,   gradleg_quad_p4p6_b1_ay,   gradleg_quad_p4p7_b1_ay,   gradleg_quad_p4p8_b1_ay,   gradleg_quad_p4p9_b1_ay,   gradleg_quad_p4p10_b1_ay,   gradleg_quad_p4p11_b1_ay,   gradleg_quad_p5p2_b1_ay,   gradleg_quad_p5p3_b1_ay,   gradleg_quad_p5p4_b1_ay,   gradleg_quad_p5p5_b1_ay,   gradleg_quad_p5p6_b1_ay,   gradleg_quad_p5p7_b1_ay,   gradleg_quad_p5p8_b1_ay,   gradleg_quad_p5p9_b1_ay,   gradleg_quad_p5p10_b1_ay,   gradleg_quad_p5p11_b1_ay,   gradleg_quad_p6p2_b1_ay,   gradleg_quad_p6p3_b1_ay,   gradleg_quad_p6p4_b1_ay,   gradleg_quad_p6p5_b1_ay,   gradleg_quad_p6p6_b1_ay,   gradleg_quad_p6p7_b1_ay,   gradleg_quad_p6p8_b1_ay,   gradleg_quad_p6p9_b1_ay,   gradleg_quad_p6p10_b1_ay,   gradleg_quad_p6p11_b1_ay,   gradleg_quad_p7p2_b1_ay,   gradleg_quad_p7p3_b1_ay,   gradleg_quad_p7p4_b1_ay,   gradleg_quad_p7p5_b1_ay,   gradleg_quad_p7p6_b1_ay,   gradleg_quad_p7p7_b1_ay,   gradleg_quad_p7p8_b1_ay,   gradleg_quad_p7p9_b1_ay,   gradleg_quad_p7p10_b1_ay,   gradleg_quad_p7p11_b1_ay,   gradleg_quad_p8p2_b1_ay,   gradleg_quad_p8p3_b1_ay,   gradleg_quad_p8p4_b1_ay,   gradleg_quad_p8p5_b1_ay,   gradleg_quad_p8p6_b1_ay,   gradleg_quad_p8p7_b1_ay,   gradleg_quad_p8p8_b1_ay,   gradleg_quad_p8p9_b1_ay,   gradleg_quad_p8p10_b1_ay,   gradleg_quad_p8p11_b1_ay,   gradleg_quad_p9p2_b1_ay,   gradleg_quad_p9p3_b1_ay,   gradleg_quad_p9p4_b1_ay,   gradleg_quad_p9p5_b1_ay,   gradleg_quad_p9p6_b1_ay,   gradleg_quad_p9p7_b1_ay,   gradleg_quad_p9p8_b1_ay,   gradleg_quad_p9p9_b1_ay,   gradleg_quad_p9p10_b1_ay,   gradleg_quad_p9p11_b1_ay,   gradleg_quad_p10p2_b1_ay,   gradleg_quad_p10p3_b1_ay,   gradleg_quad_p10p4_b1_ay,   gradleg_quad_p10p5_b1_ay,   gradleg_quad_p10p6_b1_ay,   gradleg_quad_p10p7_b1_ay,   gradleg_quad_p10p8_b1_ay,   gradleg_quad_p10p9_b1_ay,   gradleg_quad_p10p10_b1_ay,   gradleg_quad_p10p11_b1_ay,   gradleg_quad_p2p0_b2_ay,   gradleg_quad_p2p1_b2_ay,   gradleg_quad_p2p2_b2_ay,   gradleg_quad_p2p3_b2_ay,   gradleg_quad_p2p4_b2_ay,   gradleg_quad_p2p5_b2_ay,   gradleg_quad_p2p6_b2_ay,   gradleg_quad_p2p7_b2_ay,   gradleg_quad_p2p8_b2_ay,   gradleg_quad_p2p9_b2_ay,   gradleg_quad_p2p10_b2_ay,   gradleg_quad_p3p0_b2_ay,   gradleg_quad_p3p1_b2_ay,   gradleg_quad_p3p2_b2_ay,   gradleg_quad_p3p3_b2_ay,   gradleg_quad_p3p4_b2_ay,   gradleg_quad_p3p5_b2_ay,   gradleg_quad_p3p6_b2_ay,   gradleg_quad_p3p7_b2_ay,   gradleg_quad_p3p8_b2_ay,   gradleg_quad_p3p9_b2_ay,   gradleg_quad_p3p10_b2_ay,   gradleg_quad_p4p0_b2_ay,   gradleg_quad_p4p1_b2_ay,   gradleg_quad_p4p2_b2_ay,   gradleg_quad_p4p3_b2_ay,   gradleg_quad_p4p4_b2_ay,   gradleg_quad_p4p5_b2_ay,   gradleg_quad_p4p6_b2_ay,   gradleg_quad_p4p7_b2_ay,   gradleg_quad_p4p8_b2_ay,   gradleg_quad_p4p9_b2_ay,   gradleg_quad_p4p10_b2_ay,   gradleg_quad_p5p0_b2_ay,   gradleg_quad_p5p1_b2_ay,   gradleg_quad_p5p2_b2_ay,   gradleg_quad_p5p3_b2_ay,   gradleg_quad_p5p4_b2_ay,   gradleg_quad_p5p5_b2_ay,   gradleg_quad_p5p6_b2_ay,   gradleg_quad_p5p7_b2_ay,   gradleg_quad_p5p8_b2_ay,   gradleg_quad_p5p9_b2_ay,   gradleg_quad_p5p10_b2_ay,   gradleg_quad_p6p0_b2_ay,   gradleg_quad_p6p1_b2_ay,   gradleg_quad_p6p2_b2_ay,   gradleg_quad_p6p3_b2_ay,   gradleg_quad_p6p4_b2_ay,   gradleg_quad_p6p5_b2_ay,   gradleg_quad_p6p6_b2_ay,   gradleg_quad_p6p7_b2_ay,   gradleg_quad_p6p8_b2_ay,   gradleg_quad_p6p9_b2_ay,   gradleg_quad_p6p10_b2_ay,   gradleg_quad_p7p0_b2_ay,   gradleg_quad_p7p1_b2_ay,   gradleg_quad_p7p2_b2_ay,   gradleg_quad_p7p3_b2_ay,   gradleg_quad_p7p4_b2_ay,   gradleg_quad_p7p5_b2_ay,   gradleg_quad_p7p6_b2_ay,   gradleg_quad_p7p7_b2_ay,   gradleg_quad_p7p8_b2_ay,   gradleg_quad_p7p9_b2_ay,   gradleg_quad_p7p10_b2_ay,   gradleg_quad_p8p0_b2_ay,   gradleg_quad_p8p1_b2_ay,   gradleg_quad_p8p2_b2_ay,   gradleg_quad_p8p3_b2_ay,   gradleg_quad_p8p4_b2_ay,   gradleg_quad_p8p5_b2_ay,   gradleg_quad_p8p6_b2_ay,   gradleg_quad_p8p7_b2_ay,   gradleg_quad_p8p8_b2_ay,   gradleg_quad_p8p9_b2_ay,   gradleg_quad_p8p10_b2_ay,   gradleg_quad_p9p0_b2_ay,   gradleg_quad_p9p1_b2_ay,   gradleg_quad_p9p2_b2_ay,   gradleg_quad_p9p3_b2_ay,   gradleg_quad_p9p4_b2_ay,   gradleg_quad_p9p5_b2_ay,   gradleg_quad_p9p6_b2_ay,   gradleg_quad_p9p7_b2_ay,   gradleg_quad_p9p8_b2_ay,   gradleg_quad_p9p9_b2_ay,   gradleg_quad_p9p10_b2_ay,   gradleg_quad_p10p0_b2_ay,   gradleg_quad_p10p1_b2_ay,   gradleg_quad_p10p2_b2_ay,   gradleg_quad_p10p3_b2_ay,   gradleg_quad_p10p4_b2_ay,   gradleg_quad_p10p5_b2_ay,   gradleg_quad_p10p6_b2_ay,   gradleg_quad_p10p7_b2_ay,   gradleg_quad_p10p8_b2_ay,   gradleg_quad_p10p9_b2_ay,   gradleg_quad_p10p10_b2_ay,   gradleg_quad_p11p0_b2_ay,   gradleg_quad_p11p1_b2_ay,   gradleg_quad_p11p2_b2_ay,   gradleg_quad_p11p3_b2_ay,   gradleg_quad_p11p4_b2_ay,   gradleg_quad_p11p5_b2_ay,   gradleg_quad_p11p6_b2_ay,   gradleg_quad_p11p7_b2_ay,   gradleg_quad_p11p8_b2_ay,   gradleg_quad_p11p9_b2_ay,   gradleg_quad_p11p10_b2_ay, };
+    static int gradleg_tri_vertex_indices[3] = { -1, -1, -1 };
 
-    static Shapeset::shape_fn_t gradleg_quad_fn_by[] =
+    static int gradleg_tri_index_to_order[] =
     {
-      gradleg_quad_p0_e1_by, gradleg_quad_p0_e1_by, gradleg_quad_p0_e2_by_0, gradleg_quad_p0_e2_by_1,  gradleg_quad_p0_e3_by, gradleg_quad_p0_e3_by, gradleg_quad_p0_e4_by_0, gradleg_quad_p0_e4_by_1,
-      gradleg_quad_l2_l0_by, gradleg_quad_l2_l0_by, gradleg_quad_l1_l2_by, gradleg_quad_l1_l2_by, gradleg_quad_l2_l1_by, gradleg_quad_l2_l1_by, gradleg_quad_l0_l2_by,  gradleg_quad_l0_l2_by,
-      gradleg_quad_l3_l0_by_0, gradleg_quad_l3_l0_by_1, gradleg_quad_l1_l3_by_0, gradleg_quad_l1_l3_by_1, gradleg_quad_l3_l1_by_0, gradleg_quad_l3_l1_by_1, gradleg_quad_l0_l3_by_0, gradleg_quad_l0_l3_by_1,
-      gradleg_quad_l4_l0_by, gradleg_quad_l4_l0_by, gradleg_quad_l1_l4_by, gradleg_quad_l1_l4_by, gradleg_quad_l4_l1_by, gradleg_quad_l4_l1_by, gradleg_quad_l0_l4_by,  gradleg_quad_l0_l4_by,
-      gradleg_quad_l5_l0_by_0, gradleg_quad_l5_l0_by_1, gradleg_quad_l1_l5_by_0, gradleg_quad_l1_l5_by_1, gradleg_quad_l5_l1_by_0, gradleg_quad_l5_l1_by_1, gradleg_quad_l0_l5_by_0, gradleg_quad_l0_l5_by_1,
-      gradleg_quad_l6_l0_by, gradleg_quad_l6_l0_by, gradleg_quad_l1_l6_by, gradleg_quad_l1_l6_by, gradleg_quad_l6_l1_by, gradleg_quad_l6_l1_by, gradleg_quad_l0_l6_by,  gradleg_quad_l0_l6_by,
-      gradleg_quad_l7_l0_by_0, gradleg_quad_l7_l0_by_1, gradleg_quad_l1_l7_by_0, gradleg_quad_l1_l7_by_1, gradleg_quad_l7_l1_by_0, gradleg_quad_l7_l1_by_1, gradleg_quad_l0_l7_by_0, gradleg_quad_l0_l7_by_1,
-      gradleg_quad_l8_l0_by, gradleg_quad_l8_l0_by, gradleg_quad_l1_l8_by, gradleg_quad_l1_l8_by, gradleg_quad_l8_l1_by, gradleg_quad_l8_l1_by, gradleg_quad_l0_l8_by,  gradleg_quad_l0_l8_by,
-      gradleg_quad_l9_l0_by_0, gradleg_quad_l9_l0_by_1, gradleg_quad_l1_l9_by_0, gradleg_quad_l1_l9_by_1, gradleg_quad_l9_l1_by_0, gradleg_quad_l9_l1_by_1, gradleg_quad_l0_l9_by_0, gradleg_quad_l0_l9_by_1,
-      gradleg_quad_l10_l0_by, gradleg_quad_l10_l0_by, gradleg_quad_l1_l10_by, gradleg_quad_l1_l10_by, gradleg_quad_l10_l1_by, gradleg_quad_l10_l1_by, gradleg_quad_l0_l10_by,  gradleg_quad_l0_l10_by,
-      gradleg_quad_l11_l0_by_0, gradleg_quad_l11_l0_by_1, gradleg_quad_l1_l11_by_0, gradleg_quad_l1_l11_by_1, gradleg_quad_l11_l1_by_0, gradleg_quad_l11_l1_by_1, gradleg_quad_l0_l11_by_0, gradleg_quad_l0_l11_by_1,
-
-      gradleg_quad_p0p2_b1_by,   gradleg_quad_p0p3_b1_by,   gradleg_quad_p0p4_b1_by,   gradleg_quad_p0p5_b1_by,   gradleg_quad_p0p6_b1_by,   gradleg_quad_p0p7_b1_by,   gradleg_quad_p0p8_b1_by,   gradleg_quad_p0p9_b1_by,   gradleg_quad_p0p10_b1_by,   gradleg_quad_p0p11_b1_by,   gradleg_quad_p1p2_b1_by,   gradleg_quad_p1p3_b1_by,   gradleg_quad_p1p4_b1_by,   gradleg_quad_p1p5_b1_by,   gradleg_quad_p1p6_b1_by,   gradleg_quad_p1p7_b1_by,   gradleg_quad_p1p8_b1_by,   gradleg_quad_p1p9_b1_by,   gradleg_quad_p1p10_b1_by,   gradleg_quad_p1p11_b1_by,   gradleg_quad_p2p2_b1_by,   gradleg_quad_p2p3_b1_by,   gradleg_quad_p2p4_b1_by,   gradleg_quad_p2p5_b1_by,   gradleg_quad_p2p6_b1_by,   gradleg_quad_p2p7_b1_by,   gradleg_quad_p2p8_b1_by,   gradleg_quad_p2p9_b1_by,   gradleg_quad_p2p10_b1_by,   gradleg_quad_p2p11_b1_by,   gradleg_quad_p3p2_b1_by,   gradleg_quad_p3p3_b1_by,   gradleg_quad_p3p4_b1_by,   gradleg_quad_p3p5_b1_by,   gradleg_quad_p3p6_b1_by,   gradleg_quad_p3p7_b1_by,   gradleg_quad_p3p8_b1_by,   gradleg_quad_p3p9_b1_by,   gradleg_quad_p3p10_b1_by,   gradleg_quad_p3p11_b1_by,   gradleg_quad_p4p2_b1_by,   gradleg_quad_p4p3_b1_by,   gradleg_quad_p4p4_b1_by,   gradleg_quad_p4p5_b1_by,   gradleg_quad_p4p6_b1_by,   gradleg_quad_p4p7_b1_by,   gradleg_quad_p4p8_b1_by,   gradleg_quad_p4p9_b1_by,   gradleg_quad_p4p10_b1_by,   gradleg_quad_p4p11_b1_by,   gradleg_quad_p5p2_b1_by,   gradleg_quad_p5p3_b1_by,   gradleg_quad_p5p4_b1_by,   gradleg_quad_p5p5_b1_by,   gradleg_quad_p5p6_b1_by,   gradleg_quad_p5p7_b1_by,   gradleg_quad_p5p8_b1_by,   gradleg_quad_p5p9_b1_by,   gradleg_quad_p5p10_b1_by,   gradleg_quad_p5p11_b1_by,   gradleg_quad_p6p2_b1_by,   gradleg_quad_p6p3_b1_by,   gradleg_quad_p6p4_b1_by,   gradleg_quad_p6p5_b1_by,   gradleg_quad_p6p6_b1_by,   gradleg_quad_p6p7_b1_by,   gradleg_quad_p6p8_b1_by,   gradleg_quad_p6p9_b1_by,   gradleg_quad_p6p10_b1_by,   gradleg_quad_p6p11_b1_by,   gradleg_quad_p7p2_b1_by,   gradleg_quad_p7p3_b1_by,   gradleg_quad_p7p4_b1_by,   gradleg_quad_p7p5_b1_by,   gradleg_quad_p7p6_b1_by,   gradleg_quad_p7p7_b1_by,   gradleg_quad_p7p8_b1_by,   gradleg_quad_p7p9_b1_by,   gradleg_quad_p7p10_b1_by,   gradleg_quad_p7p11_b1_by,   gradleg_quad_p8p2_b1_by,   gradleg_quad_p8p3_b1_by,   gradleg_quad_p8p4_b1_by,   gradleg_quad_p8p5_b1_by,   gradleg_quad_p8p6_b1_by,   gradleg_quad_p8p7_b1_by,   gradleg_quad_p8p8_b1_by,   gradleg_quad_p8p9_b1_by,   gradleg_quad_p8p10_b1_by,   gradleg_quad_p8p11_b1_by,   gradleg_quad_p9p2_b1_by,   gradleg_quad_p9p3_b1_by,   gradleg_quad_p9p4_b1_by,   gradleg_quad_p9p5_b1_by,   gradleg_quad_p9p6_b1_by,   gradleg_quad_p9p7_b1_by,   gradleg_quad_p9p8_b1_by,   gradleg_quad_p9p9_b1_by,   gradleg_quad_p9p10_b1_by,   gradleg_quad_p9p11_b1_by,   gradleg_quad_p10p2_b1_by,   gradleg_quad_p10p3_b1_by,   gradleg_quad_p10p4_b1_by,   gradleg_quad_p10p5_b1_by,   gradleg_quad_p10p6_b1_by,   gradleg_quad_p10p7_b1_by,   gradleg_quad_p10p8_b1_by,   gradleg_quad_p10p9_b1_by,   gradleg_quad_p10p10_b1_by,   gradleg_quad_p10p11_b1_by,   gradleg_quad_p2p0_b2_by,   gradleg_quad_p2p1_b2_by,   gradleg_quad_p2p2_b2_by,   gradleg_quad_p2p3_b2_by,   gradleg_quad_p2p4_b2_by,   gradleg_quad_p2p5_b2_by,   gradleg_quad_p2p6_b2_by,   gradleg_quad_p2p7_b2_by,   gradleg_quad_p2p8_b2_by,   gradleg_quad_p2p9_b2_by,   gradleg_quad_p2p10_b2_by,   gradleg_quad_p3p0_b2_by,   gradleg_quad_p3p1_b2_by,   gradleg_quad_p3p2_b2_by,   gradleg_quad_p3p3_b2_by,   gradleg_quad_p3p4_b2_by,   gradleg_quad_p3p5_b2_by,   gradleg_quad_p3p6_b2_by,   gradleg_quad_p3p7_b2_by,   gradleg_quad_p3p8_b2_by,   gradleg_quad_p3p9_b2_by,   gradleg_quad_p3p10_b2_by,   gradleg_quad_p4p0_b2_by,   gradleg_quad_p4p1_b2_by,   gradleg_quad_p4p2_b2_by,   gradleg_quad_p4p3_b2_by,   gradleg_quad_p4p4_b2_by,   gradleg_quad_p4p5_b2_by,   gradleg_quad_p4p6_b2_by,   gradleg_quad_p4p7_b2_by,   gradleg_quad_p4p8_b2_by,   gradleg_quad_p4p9_b2_by,   gradleg_quad_p4p10_b2_by,   gradleg_quad_p5p0_b2_by,   gradleg_quad_p5p1_b2_by,   gradleg_quad_p5p2_b2_by,   gradleg_quad_p5p3_b2_by,   gradleg_quad_p5p4_b2_by,   gradleg_quad_p5p5_b2_by,   gradleg_quad_p5p6_b2_by,   gradleg_quad_p5p7_b2_by,   gradleg_quad_p5p8_b2_by,   gradleg_quad_p5p9_b2_by,   gradleg_quad_p5p10_b2_by,   gradleg_quad_p6p0_b2_by,   gradleg_quad_p6p1_b2_by,   gradleg_quad_p6p2_b2_by,   gradleg_quad_p6p3_b2_by,   gradleg_quad_p6p4_b2_by,   gradleg_quad_p6p5_b2_by,   gradleg_quad_p6p6_b2_by,   gradleg_quad_p6p7_b2_by,   gradleg_quad_p6p8_b2_by,   gradleg_quad_p6p9_b2_by,   gradleg_quad_p6p10_b2_by,   gradleg_quad_p7p0_b2_by,   gradleg_quad_p7p1_b2_by,   gradleg_quad_p7p2_b2_by,   gradleg_quad_p7p3_b2_by,   gradleg_quad_p7p4_b2_by,   gradleg_quad_p7p5_b2_by,   gradleg_quad_p7p6_b2_by,   gradleg_quad_p7p7_b2_by,   gradleg_quad_p7p8_b2_by,   gradleg_quad_p7p9_b2_by,   gradleg_quad_p7p10_b2_by,   gradleg_quad_p8p0_b2_by,   gradleg_quad_p8p1_b2_by,   gradleg_quad_p8p2_b2_by,   gradleg_quad_p8p3_b2_by,   gradleg_quad_p8p4_b2_by,   gradleg_quad_p8p5_b2_by,   gradleg_quad_p8p6_b2_by,   gradleg_quad_p8p7_b2_by,   gradleg_quad_p8p8_b2_by,   gradleg_quad_p8p9_b2_by,   gradleg_quad_p8p10_b2_by,   gradleg_quad_p9p0_b2_by,   gradleg_quad_p9p1_b2_by,   gradleg_quad_p9p2_b2_by,   gradleg_quad_p9p3_b2_by,   gradleg_quad_p9p4_b2_by,   gradleg_quad_p9p5_b2_by,   gradleg_quad_p9p6_b2_by,   gradleg_quad_p9p7_b2_by,   gradleg_quad_p9p8_b2_by,   gradleg_quad_p9p9_b2_by,   gradleg_quad_p9p10_b2_by,   gradleg_quad_p10p0_b2_by,   gradleg_quad_p10p1_b2_by,   gradleg_quad_p10p2_b2_by,   gradleg_quad_p10p3_b2_by,   gradleg_quad_p10p4_b2_by,   gradleg_quad_p10p5_b2_by,   gradleg_quad_p10p6_b2_by,   gradleg_quad_p10p7_b2_by,   gradleg_quad_p10p8_b2_by,   gradleg_quad_p10p9_b2_by,   gradleg_quad_p10p10_b2_by,   gradleg_quad_p11p0_b2_by,   gradleg_quad_p11p1_b2_by,   gradleg_quad_p11p2_b2_by,   gradleg_quad_p11p3_b2_by,   gradleg_quad_p11p4_b2_by,   gradleg_quad_p11p5_b2_by,   gradleg_quad_p11p6_b2_by,   gradleg_quad_p11p7_b2_by,   gradleg_quad_p11p8_b2_by,   gradleg_quad_p11p9_b2_by,   gradleg_quad_p11p10_b2_by, };
+     0, 0, 0, 0, 0, 0,
+     1, 1, 1, 1, 1, 1,
+     2, 2, 2, 2, 2, 2,
+     3, 3, 3, 3, 3, 3,
+     4, 4, 4, 4, 4, 4,
+     5, 5, 5, 5, 5, 5,
+     6, 6, 6, 6, 6, 6,
+     7, 7, 7, 7, 7, 7,
+     8, 8, 8, 8, 8, 8,
+     9, 9, 9, 9, 9, 9,
+     10, 10, 10, 10, 10, 10,
+     2, 2, 2,
+     3, 3, 3,
+     4, 4, 4,
+     5, 5, 5,
+     6, 6, 6,
+     7, 7, 7,
+     8, 8, 8,
+     9, 9, 9,
+     10, 10, 10,
+     3, 3,
+     4, 4, 4, 4,
+     5, 5, 5, 5, 5, 5,
+     6, 6, 6, 6, 6, 6, 6, 6,
+     7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+     8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+     9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+     10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    };
 
     static int qb_0_1[] = { 88, };
       static int qb_0_2[] = { 88, 89, };
@@ -15709,46 +286,6 @@ namespace Hermes
       oo(0, 2),  oo(0, 3),  oo(0, 4),  oo(0, 5),  oo(0, 6),  oo(0, 7),  oo(0, 8),  oo(0, 9),  oo(0, 10),  oo(0, 11),  oo(1, 2),  oo(1, 3),  oo(1, 4),  oo(1, 5),  oo(1, 6),  oo(1, 7),  oo(1, 8),  oo(1, 9),  oo(1, 10),  oo(1, 11),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(2, 11),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(3, 11),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(4, 11),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(5, 11),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(6, 11),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(7, 11),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(8, 11),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(9, 11),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(10, 11),  oo(2, 0),  oo(2, 1),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(3, 0),  oo(3, 1),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(4, 0),  oo(4, 1),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(5, 0),  oo(5, 1),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(6, 0),  oo(6, 1),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(7, 0),  oo(7, 1),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(8, 0),  oo(8, 1),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(9, 0),  oo(9, 1),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(10, 0),  oo(10, 1),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(11, 0),  oo(11, 1),  oo(11, 2),  oo(11, 3),  oo(11, 4),  oo(11, 5),  oo(11, 6),  oo(11, 7),  oo(11, 8),  oo(11, 9),  oo(11, 10),
     };
 
-    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    static Shapeset::shape_fn_t* gradleg_quad_shape_fn_table[2] =
-    {
-      gradleg_quad_fn_a,
-      gradleg_quad_fn_b
-    };
-
-    static Shapeset::shape_fn_t* gradleg_quad_shape_fn_table_x[2] =
-    {
-      gradleg_quad_fn_ax,
-      gradleg_quad_fn_bx
-    };
-
-    static Shapeset::shape_fn_t* gradleg_quad_shape_fn_table_y[2] =
-    {
-      gradleg_quad_fn_ay,
-      gradleg_quad_fn_by
-    };
-
-    //// triangle tables and class constructor ///////////////////////////////////////////////
-
-    static Shapeset::shape_fn_t** gradleg_shape_fn_table[2] =
-    {
-      gradleg_tri_shape_fn_table,
-      gradleg_quad_shape_fn_table
-    };
-
-    static Shapeset::shape_fn_t** gradleg_shape_fn_table_x[2] =
-    {
-      gradleg_tri_shape_fn_table_x,
-      gradleg_quad_shape_fn_table_x
-    };
-
-    static Shapeset::shape_fn_t** gradleg_shape_fn_table_y[2] =
-    {
-      gradleg_tri_shape_fn_table_y,
-      gradleg_quad_shape_fn_table_y
-    };
-
     static int* gradleg_vertex_indices[2] =
     {
       gradleg_tri_vertex_indices,
@@ -15779,6 +316,2359 @@ namespace Hermes
       gradleg_quad_index_to_order
     };
 
+    // The shape functions, see Shapeset::PolynomialTable.
+
+    static const int gradleg_tri_start[] =
+    {
+      0, 2, 4, 6, 8, 10, 12, 13, 14, 16, 18, 20, 22, 23, 24, 28,
+      32, 36, 40, 44, 48, 55, 62, 69, 76, 80, 84, 94, 104, 114, 124, 133,
+      142, 158, 174, 190, 206, 215, 224, 245, 266, 287, 308, 324, 340, 369, 398, 427,
+      456, 472, 488, 524, 560, 596, 632, 657, 682, 727, 772, 817, 862, 890, 918, 977,
+      1036, 1095, 1154, 1154, 1159, 1164, 1164, 1172, 1180, 1180, 1194, 1208, 1208, 1227, 1246, 1246,
+      1273, 1300, 1300, 1334, 1368, 1368, 1412, 1456, 1456, 1509, 1562, 1562, 1627, 1692, 1697, 1697,
+      1710, 1710, 1716, 1716, 1736, 1736, 1756, 1756, 1768, 1768, 1794, 1794, 1821, 1821, 1848, 1848,
+      1860, 1860, 1895, 1895, 1930, 1930, 1965, 1965, 2000, 2000, 2020, 2020, 2063, 2063, 2107, 2107,
+      2151, 2151, 2195, 2195, 2239, 2239, 2259, 2259, 2313, 2313, 2367, 2367, 2421, 2421, 2475, 2475,
+      2529, 2529, 2583, 2583, 2613, 2613, 2677, 2677, 2742, 2742, 2807, 2807, 2872, 2872, 2937, 2937,
+      3002, 3002, 3067, 3067, 3097, 3097, 3100, 3103, 3106, 3109, 3112, 3115, 3118, 3121, 3124, 3127,
+      3129, 3131, 3134, 3137, 3142, 3147, 3150, 3153, 3162, 3171, 3180, 3189, 3198, 3207, 3216, 3225,
+      3236, 3247, 3259, 3271, 3290, 3309, 3329, 3349, 3368, 3387, 3406, 3425, 3448, 3471, 3495, 3519,
+      3552, 3585, 3620, 3655, 3690, 3725, 3758, 3791, 3832, 3873, 3914, 3955, 4006, 4057, 4111, 4165,
+      4219, 4273, 4327, 4381, 4447, 4513, 4579, 4645, 4649, 4654, 4654, 4658, 4666, 4666, 4675, 4689,
+      4689, 4698, 4717, 4717, 4733, 4760, 4760, 4776, 4810, 4810, 4835, 4879, 4879, 4904, 4957, 4957,
+      4991, 5056, 5056, 5056, 5061, 5061, 5074, 5074, 5080, 5080, 5100, 5100, 5120, 5120, 5132, 5132,
+      5158, 5158, 5185, 5185, 5212, 5212, 5224, 5224, 5259, 5259, 5294, 5294, 5329, 5329, 5364, 5364,
+      5384, 5384, 5427, 5427, 5471, 5471, 5515, 5515, 5559, 5559, 5603, 5603, 5623, 5623, 5677, 5677,
+      5731, 5731, 5785, 5785, 5839, 5839, 5893, 5893, 5947, 5947, 5977, 5977, 6041, 6041, 6106, 6106,
+      6171, 6171, 6236, 6236, 6301, 6301, 6366, 6366, 6431, 6431, 6461,
+    };
+
+    static const unsigned char gradleg_tri_degrees[] =
+    {
+      0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x10, 0x00, 0x01,
+      0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x20, 0x20, 0x01, 0x02, 0x10, 0x11, 0x01, 0x02, 0x10, 0x11,
+      0x01, 0x02, 0x10, 0x11, 0x01, 0x02, 0x10, 0x11, 0x10, 0x11, 0x12, 0x30, 0x10, 0x11, 0x12, 0x30,
+      0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x02, 0x03,
+      0x10, 0x11, 0x12, 0x20, 0x21, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x20, 0x21, 0x22, 0x40,
+      0x20, 0x21, 0x22, 0x40, 0x03, 0x04, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x03, 0x04,
+      0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x03, 0x04, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22,
+      0x30, 0x31, 0x03, 0x04, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x30, 0x31, 0x32, 0x50, 0x10, 0x11, 0x12, 0x13, 0x14, 0x30, 0x31, 0x32, 0x50, 0x04, 0x05,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x04, 0x05,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x04, 0x05,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x04, 0x05,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x40, 0x41, 0x42, 0x60, 0x20, 0x21, 0x22, 0x23, 0x24, 0x40, 0x41, 0x42, 0x60,
+      0x05, 0x06, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33,
+      0x40, 0x41, 0x42, 0x50, 0x51, 0x05, 0x06, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x05, 0x06, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x05,
+      0x06, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x50, 0x51, 0x52, 0x70, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x50, 0x51, 0x52, 0x70, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60,
+      0x61, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x06, 0x07,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x06, 0x07, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40,
+      0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x80, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x80, 0x07, 0x08, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x07, 0x08, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71,
+      0x07, 0x08, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60,
+      0x61, 0x62, 0x70, 0x71, 0x07, 0x08, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50,
+      0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x50, 0x51, 0x52, 0x53, 0x54, 0x70, 0x71, 0x72,
+      0x90, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x50, 0x51, 0x52, 0x53, 0x54, 0x70, 0x71, 0x72, 0x90, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60,
+      0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x62, 0x63, 0x70,
+      0x71, 0x72, 0x80, 0x81, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80,
+      0x81, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01,
+      0x02, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x46, 0x60, 0x61, 0x62, 0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00, 0x01, 0x02, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x60, 0x61, 0x62,
+      0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00, 0x01, 0x02, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90,
+      0x91, 0x00, 0x01, 0x02, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61,
+      0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x09,
+      0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71,
+      0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0x00, 0x01, 0x02, 0x10, 0x11, 0x00, 0x01, 0x02, 0x10, 0x11, 0x01, 0x02, 0x03, 0x10,
+      0x11, 0x12, 0x20, 0x21, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10,
+      0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42,
+      0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40,
+      0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60,
+      0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63,
+      0x70, 0x71, 0x72, 0x80, 0x81, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62,
+      0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61,
+      0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x02, 0x03, 0x20,
+      0x21, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x10, 0x11,
+      0x12, 0x13, 0x30, 0x31, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20,
+      0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x20, 0x21, 0x22, 0x23, 0x40, 0x41, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42,
+      0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30,
+      0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x30, 0x31,
+      0x32, 0x33, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41,
+      0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x40, 0x41,
+      0x42, 0x43, 0x60, 0x61, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61,
+      0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x50, 0x51, 0x52,
+      0x53, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63,
+      0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80,
+      0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61,
+      0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x60,
+      0x61, 0x62, 0x63, 0x80, 0x81, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73,
+      0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72,
+      0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+      0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71,
+      0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70,
+      0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64,
+      0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63,
+      0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62,
+      0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x17, 0x18, 0x19, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x55, 0x70, 0x71, 0x72, 0x73, 0x90, 0x91, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00,
+      0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01,
+      0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10, 0x01, 0x10, 0x10, 0x11, 0x20, 0x10, 0x11,
+      0x20, 0x01, 0x02, 0x10, 0x11, 0x20, 0x01, 0x02, 0x10, 0x11, 0x20, 0x02, 0x11, 0x20, 0x02, 0x11,
+      0x20, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12,
+      0x20, 0x21, 0x30, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x01, 0x02, 0x03, 0x10,
+      0x11, 0x12, 0x20, 0x21, 0x30, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x01, 0x02,
+      0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40,
+      0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x02, 0x03, 0x04, 0x12, 0x13, 0x20, 0x21,
+      0x22, 0x30, 0x31, 0x40, 0x02, 0x03, 0x04, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x02,
+      0x03, 0x04, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x02, 0x03, 0x04, 0x11, 0x12,
+      0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x50, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41,
+      0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30,
+      0x31, 0x32, 0x40, 0x41, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20,
+      0x21, 0x22, 0x23, 0x31, 0x32, 0x40, 0x41, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x31, 0x32, 0x40, 0x41, 0x50, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51,
+      0x60, 0x02, 0x03, 0x04, 0x05, 0x06, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x23, 0x24, 0x30, 0x31,
+      0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x02, 0x03, 0x04, 0x05, 0x06, 0x12, 0x13, 0x14,
+      0x15, 0x20, 0x21, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x32,
+      0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x02, 0x03, 0x04, 0x05, 0x06, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61,
+      0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51,
+      0x52, 0x60, 0x61, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42,
+      0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71,
+      0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62,
+      0x70, 0x71, 0x80, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x61, 0x62, 0x63,
+      0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70,
+      0x71, 0x72, 0x80, 0x81, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81,
+      0x90, 0x00, 0x01, 0x02, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x46, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x71, 0x72,
+      0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60,
+      0x61, 0x62, 0x63, 0x64, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91,
+      0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80,
+      0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x10, 0x11,
+      0x12, 0x30, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x00, 0x01, 0x02, 0x03, 0x04, 0x20,
+      0x21, 0x22, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30,
+      0x31, 0x10, 0x11, 0x12, 0x13, 0x14, 0x30, 0x31, 0x32, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x20, 0x21, 0x22, 0x23, 0x24, 0x40, 0x41, 0x42, 0x60, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30,
+      0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x50, 0x51, 0x52, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x40, 0x41, 0x42, 0x43, 0x44, 0x60,
+      0x61, 0x62, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x70, 0x71, 0x72, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x28, 0x40, 0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91,
+      0x00, 0x02, 0x03, 0x20, 0x21, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22,
+      0x30, 0x31, 0x10, 0x11, 0x12, 0x13, 0x30, 0x31, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x20, 0x21, 0x22, 0x23, 0x40, 0x41, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32,
+      0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50,
+      0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x30, 0x31, 0x32, 0x33, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60,
+      0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50,
+      0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x40, 0x41, 0x42, 0x43, 0x60, 0x61, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61,
+      0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61,
+      0x62, 0x70, 0x71, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x50, 0x51, 0x52, 0x53, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71,
+      0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63,
+      0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x60, 0x61, 0x62, 0x63, 0x80, 0x81, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64,
+      0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63,
+      0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62,
+      0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61,
+      0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+      0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60,
+      0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x37, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x70, 0x71, 0x72, 0x73, 0x90, 0x91,
+    };
+
+    static const double gradleg_tri_coefs[] =
+    {
+      0.666666666666667, -0.3333333333333335, -0.666666666666667, 0.3333333333333335,
+      -0.33333333333333237, -0.33333333333333226, 0.33333333333333237, 0.33333333333333226,
+      -0.33333333333333337, -0.3333333333333334, 0.33333333333333337, 0.3333333333333334,
+      1.2247448713915885, 1.2247448713915885, -0.40824829046386346, -0.40824829046386285,
+      -0.40824829046386346, -0.40824829046386285, 0.40824829046386346, 0.40824829046386285,
+      0.40824829046386346, 0.40824829046386285, 1.5811388300841904, -1.5811388300841904,
+      -0.3162277660168378, -0.3162277660168376, 0.3162277660168375, 0.3162277660168376,
+      0.3162277660168378, 0.3162277660168376, -0.3162277660168375, -0.3162277660168376,
+      -0.31622776601683744, -0.3162277660168375, -0.3162277660168376, -0.31622776601683816,
+      0.31622776601683744, 0.3162277660168375, 0.3162277660168376, 0.31622776601683816,
+      -0.15590239111557966, -0.13363062095621261, 0.022271770159368744, 1.8708286933869727,
+      -0.15590239111557966, -0.13363062095621261, 0.022271770159368744, 1.8708286933869727,
+      -0.2672612419124244, -0.26726124191242434, -0.15590239111558052, 0.23385358667337103,
+      0.3897559777889525, -0.1670382761952653, -0.16703827619526498, -0.2672612419124244,
+      -0.26726124191242434, -0.15590239111558052, 0.23385358667337103, 0.3897559777889525,
+      -0.1670382761952653, -0.16703827619526498, 0.2672612419124244, 0.267261241912424,
+      -0.15590239111558069, 0.2338535866733714, 0.3897559777889528, 0.16703827619526515,
+      0.1670382761952649, 0.2672612419124244, 0.267261241912424, -0.15590239111558069,
+      0.2338535866733714, 0.3897559777889528, 0.16703827619526515, 0.1670382761952649,
+      -0.39774756441743103, -0.35355339059327395, 0.044194173824158973, 2.12132034355964,
+      0.39774756441743103, 0.35355339059327395, -0.044194173824158973, -2.12132034355964,
+      -0.23570226039551548, -0.23570226039551562, -0.19887378220871646, 0.2121320343559644,
+      0.41100581656468066, 0.19887378220871643, -0.05892556509887898, -0.25779934730759496,
+      0.08249579113843078, 0.08249579113842992, 0.23570226039551548, 0.23570226039551562,
+      0.19887378220871646, -0.2121320343559644, -0.41100581656468066, -0.19887378220871643,
+      0.05892556509887898, 0.25779934730759496, -0.08249579113843078, -0.08249579113842992,
+      -0.23570226039551537, -0.23570226039551576, 0.19887378220871657, -0.2121320343559644,
+      -0.41100581656468044, 0.19887378220871632, -0.058925565098879085, -0.257799347307595,
+      -0.08249579113843064, -0.0824957911384299, 0.23570226039551537, 0.23570226039551576,
+      -0.19887378220871657, 0.2121320343559644, 0.41100581656468044, -0.19887378220871632,
+      0.058925565098879085, 0.257799347307595, 0.08249579113843064, 0.0824957911384299,
+      0.00977169949963253, 0.05863019699779224, 0.03126943839882333, -0.015990053726670936,
+      0.0015990053726670761, -0.6566582063752783, -0.5969620057957096, 0.05969620057957077,
+      2.3452078799117118, 0.00977169949963253, 0.05863019699779224, 0.03126943839882333,
+      -0.015990053726670936, 0.0015990053726670761, -0.6566582063752783, -0.5969620057957096,
+      0.05969620057957077, 2.3452078799117118, -0.2132007163556103, -0.2132007163556106,
+      0.009771699499631968, -0.014657549249448164, -0.22670342839146596, 0.2118682118783878,
+      0.41414239152077353, -0.07328774624724113, 0.23452078799117157, -0.006662522386112919,
+      -0.3144710566245252, -0.16416455159382012, -0.018655062681115567, 0.14550948891270377,
+      -0.03997513431667727, -0.039975134316676424, -0.2132007163556103, -0.2132007163556106,
+      0.009771699499631968, -0.014657549249448164, -0.22670342839146596, 0.2118682118783878,
+      0.41414239152077353, -0.07328774624724113, 0.23452078799117157, -0.006662522386112919,
+      -0.3144710566245252, -0.16416455159382012, -0.018655062681115567, 0.14550948891270377,
+      -0.03997513431667727, -0.039975134316676424, 0.21320071635561016, 0.2132007163556103,
+      0.009771699499631947, -0.014657549249448272, -0.2267034283914659, 0.21186821187838753,
+      0.41414239152077287, 0.07328774624724108, -0.23452078799117143, 0.00666252238611293,
+      0.3144710566245251, -0.1641645515938201, -0.018655062681115588, 0.14550948891270366,
+      0.03997513431667716, 0.03997513431667648, 0.21320071635561016, 0.2132007163556103,
+      0.009771699499631947, -0.014657549249448272, -0.2267034283914659, 0.21186821187838753,
+      0.41414239152077287, 0.07328774624724108, -0.23452078799117143, 0.00666252238611293,
+      0.3144710566245251, -0.1641645515938201, -0.018655062681115588, 0.14550948891270366,
+      0.03997513431667716, 0.03997513431667648, 0.02276347997139706, 0.1821078397711697,
+      0.11381739985698242, -0.042024886101039556, 0.003502073841753206, -0.9105391988558494,
+      -0.840497722020788, 0.07004147683506538, 2.5495097567963967, -0.02276347997139706,
+      -0.1821078397711697, -0.11381739985698242, 0.042024886101039556, -0.003502073841753206,
+      0.9105391988558494, 0.840497722020788, -0.07004147683506538, -2.5495097567963967,
+      -0.19611613513818385, -0.19611613513818427, 0.011381739985698114, -0.036421567954234006,
+      -0.2390165396996613, 0.2185294077254048, 0.409742639485134, -0.01138173998569799,
+      -0.09105391988558538, 0.2845434996424545, 0.012257258446136282, -0.3519584210962054,
+      0.12747548783981963, -0.15934435979977454, -0.09070371250140982, 0.19611613513818305,
+      0.1138173998569816, 0.03677177533840901, -0.07704562451857187, 0.019261406129643378,
+      0.019261406129642618, 0.19611613513818385, 0.19611613513818427, -0.011381739985698114,
+      0.036421567954234006, 0.2390165396996613, -0.2185294077254048, -0.409742639485134,
+      0.01138173998569799, 0.09105391988558538, -0.2845434996424545, -0.012257258446136282,
+      0.3519584210962054, -0.12747548783981963, 0.15934435979977454, 0.09070371250140982,
+      -0.19611613513818305, -0.1138173998569816, -0.03677177533840901, 0.07704562451857187,
+      -0.019261406129643378, -0.019261406129642618, -0.19611613513818393, -0.19611613513818402,
+      -0.011381739985698084, 0.03642156795423405, 0.2390165396996614, -0.21852940772540463,
+      -0.40974263948513423, -0.011381739985697928, -0.09105391988558538, 0.2845434996424549,
+      0.01225725844613656, -0.35195842109620473, -0.12747548783981966, 0.1593443597997745,
+      0.0907037125014097, -0.19611613513818313, 0.11381739985698167, 0.0367717753384093,
+      -0.07704562451857178, -0.019261406129643326, -0.019261406129642916, 0.19611613513818393,
+      0.19611613513818402, 0.011381739985698084, -0.03642156795423405, -0.2390165396996614,
+      0.21852940772540463, 0.40974263948513423, 0.011381739985697928, 0.09105391988558538,
+      -0.2845434996424549, -0.01225725844613656, 0.35195842109620473, 0.12747548783981966,
+      -0.1593443597997745, -0.0907037125014097, 0.19611613513818313, -0.11381739985698167,
+      -0.0367717753384093, 0.07704562451857178, 0.019261406129643326, 0.019261406129642916,
+      -0.0018338924916466383, -0.011003354949880797, -0.028119684871916552, -0.006112974972156287,
+      0.01021740102488928, -0.0024451899888623665, 0.0001746564277758332, 0.034232659844073886,
+      0.3423265984407275, 0.2347382389307864, -0.06846531968814588, 0.004890379977724553,
+      -1.1527324233208174, -1.0758835950994317, 0.0768488282213886, 2.7386127875258293,
+      -0.0018338924916466383, -0.011003354949880797, -0.028119684871916552, -0.006112974972156287,
+      0.01021740102488928, -0.0024451899888623665, 0.0001746564277758332, 0.034232659844073886,
+      0.3423265984407275, 0.2347382389307864, -0.06846531968814588, 0.004890379977724553,
+      -1.1527324233208174, -1.0758835950994317, 0.0768488282213886, 2.7386127875258293,
+      -0.18257418583505536, -0.18257418583505536, -0.0018338924916467703, 0.0027508387374703324,
+      0.009169462458233748, -0.059601505978519445, -0.2397159471223977, 0.22648572271837472,
+      0.40201543263313677, 0.013754193687350497, -0.02547072905064935, -0.09424169748740314,
+      0.3340304181213741, 0.011716535363298444, -0.37733065750747863, -0.028527216536727684,
+      0.1640314950861823, -0.18338924916467653, -0.13835700020312716, 0.23759096058445733,
+      -0.13754193687350688, 0.07859539249914706, 0.10453187202386484, -0.11160545734878835,
+      -0.07204577645755152, -0.03250065026862826, 0.03954512618892221, -0.009271345374436754,
+      -0.00927134537443595, -0.18257418583505536, -0.18257418583505536, -0.0018338924916467703,
+      0.0027508387374703324, 0.009169462458233748, -0.059601505978519445, -0.2397159471223977,
+      0.22648572271837472, 0.40201543263313677, 0.013754193687350497, -0.02547072905064935,
+      -0.09424169748740314, 0.3340304181213741, 0.011716535363298444, -0.37733065750747863,
+      -0.028527216536727684, 0.1640314950861823, -0.18338924916467653, -0.13835700020312716,
+      0.23759096058445733, -0.13754193687350688, 0.07859539249914706, 0.10453187202386484,
+      -0.11160545734878835, -0.07204577645755152, -0.03250065026862826, 0.03954512618892221,
+      -0.009271345374436754, -0.00927134537443595, 0.1825741858350553, 0.18257418583505555,
+      -0.0018338924916468256, 0.0027508387374703316, 0.009169462458233779, -0.059601505978519445,
+      -0.2397159471223977, 0.22648572271837475, 0.40201543263313655, -0.013754193687350418,
+      0.02547072905064931, 0.09424169748740296, -0.3340304181213742, -0.011716535363298839,
+      0.37733065750747785, -0.02852721653672766, 0.16403149508618262, -0.1833892491646762,
+      -0.13835700020312725, 0.2375909605844576, 0.13754193687350685, -0.07859539249914699,
+      -0.10453187202386491, 0.11160545734878799, -0.07204577645755128, -0.032500650268628375,
+      0.039545126188922204, 0.009271345374436558, 0.00927134537443617, 0.1825741858350553,
+      0.18257418583505555, -0.0018338924916468256, 0.0027508387374703316, 0.009169462458233779,
+      -0.059601505978519445, -0.2397159471223977, 0.22648572271837475, 0.40201543263313655,
+      -0.013754193687350418, 0.02547072905064931, 0.09424169748740296, -0.3340304181213742,
+      -0.011716535363298839, 0.37733065750747785, -0.02852721653672766, 0.16403149508618262,
+      -0.1833892491646762, -0.13835700020312725, 0.2375909605844576, 0.13754193687350685,
+      -0.07859539249914699, -0.10453187202386491, 0.11160545734878799, -0.07204577645755128,
+      -0.032500650268628375, 0.039545126188922204, 0.009271345374436558, 0.00927134537443617,
+      -0.0037961926398734523, -0.030369541118986345, -0.10032794833950619, -0.0347080469931273,
+      0.03226763743892253, -0.006380155697265644, 0.00039875973107893426, 0.04338505874140883,
+      0.5206207048968994, 0.37961926398732493, -0.09187424204062994, 0.005742140127539527,
+      -1.3818141209138581, -1.3005309373306906, 0.08128318358316895, 2.9154759474226513,
+      0.0037961926398734523, 0.030369541118986345, 0.10032794833950619, 0.0347080469931273,
+      -0.03226763743892253, 0.006380155697265644, -0.00039875973107893426, -0.04338505874140883,
+      -0.5206207048968994, -0.37961926398732493, 0.09187424204062994, -0.005742140127539527,
+      1.3818141209138581, 1.3005309373306906, -0.08128318358316895, -2.9154759474226513,
+      -0.171498585142509, -0.17149858514250907, -0.001898096319936753, 0.006073908223797305,
+      0.0018980963199363805, -0.07982850808419151, -0.23299132327222008, 0.2336413016338788,
+      0.3928780250457048, 0.0018980963199367927, 0.015184770559492666, -0.04745240799841534,
+      -0.08026235867160589, 0.3753485472674665, 0.0003190077848630577, -0.3945528159162367,
+      -0.021258678783289797, -0.030369541118986085, 0.203475925497206, -0.22587346207245745,
+      -0.16658586525561334, 0.27187438464974434, 0.07592385279746493, -0.16269397028028165,
+      0.06643337119778187, 0.1613541375838552, -0.14369705669167213, 0.11930891153887334,
+      -0.026098824399128716, -0.08491987233060928, 0.06048786360739191, 0.04318169127855817,
+      0.02322376673804776, -0.019957924540509497, 0.004466108988086228, 0.004466108988085771,
+      0.171498585142509, 0.17149858514250907, 0.001898096319936753, -0.006073908223797305,
+      -0.0018980963199363805, 0.07982850808419151, 0.23299132327222008, -0.2336413016338788,
+      -0.3928780250457048, -0.0018980963199367927, -0.015184770559492666, 0.04745240799841534,
+      0.08026235867160589, -0.3753485472674665, -0.0003190077848630577, 0.3945528159162367,
+      0.021258678783289797, 0.030369541118986085, -0.203475925497206, 0.22587346207245745,
+      0.16658586525561334, -0.27187438464974434, -0.07592385279746493, 0.16269397028028165,
+      -0.06643337119778187, -0.1613541375838552, 0.14369705669167213, -0.11930891153887334,
+      0.026098824399128716, 0.08491987233060928, -0.06048786360739191, -0.04318169127855817,
+      -0.02322376673804776, 0.019957924540509497, -0.004466108988086228, -0.004466108988085771,
+      -0.17149858514250912, -0.17149858514250918, 0.001898096319936714, -0.006073908223797383,
+      -0.0018980963199364581, 0.07982850808419144, 0.2329913232722199, -0.2336413016338791,
+      -0.3928780250457051, 0.0018980963199367615, 0.015184770559492718, -0.047452407998415304,
+      -0.08026235867160568, 0.3753485472674671, 0.0003190077848635521, -0.39455281591623687,
+      0.021258678783289842, 0.030369541118986106, -0.2034759254972056, 0.2258734620724576,
+      0.1665858652556132, -0.271874384649745, 0.07592385279746484, -0.1626939702802818,
+      0.0664333711977818, 0.1613541375838554, -0.14369705669167188, -0.11930891153887306,
+      0.02609882439912874, 0.08491987233060935, -0.060487863607391903, 0.04318169127855821,
+      0.023223766738047852, -0.019957924540509854, -0.004466108988086163, -0.0044661089880858144,
+      0.17149858514250912, 0.17149858514250918, -0.001898096319936714, 0.006073908223797383,
+      0.0018980963199364581, -0.07982850808419144, -0.2329913232722199, 0.2336413016338791,
+      0.3928780250457051, -0.0018980963199367615, -0.015184770559492718, 0.047452407998415304,
+      0.08026235867160568, -0.3753485472674671, -0.0003190077848635521, 0.39455281591623687,
+      -0.021258678783289842, -0.030369541118986106, 0.2034759254972056, -0.2258734620724576,
+      -0.1665858652556132, 0.271874384649745, -0.07592385279746484, 0.1626939702802818,
+      -0.0664333711977818, -0.1613541375838554, 0.14369705669167188, 0.11930891153887306,
+      -0.02609882439912874, -0.08491987233060935, 0.060487863607391903, -0.04318169127855821,
+      -0.023223766738047852, 0.019957924540509854, 0.004466108988086163, 0.0044661089880858144,
+      0.0005351053822021142, 0.003210632293213088, 0.009417854726758232, 0.013912739937255976,
+      -0.001811713936884019, -0.005886159204224108, 0.0026500457023346624, -0.0004224516175280766,
+      2.3469534307162278e-05, -0.0051370116691419766, -0.05137011669140778, -0.20676471968291685,
+      -0.08989770420996486, 0.05993180280664311, -0.010138838820672699, 0.0005632688233708097,
+      0.05045279317906101, 0.7063391045068602, 0.5381631272433234, -0.11152722702739967,
+      0.006195957057077573, -1.5981814081771397, -1.5140665972204475, 0.08411481095669286,
+      3.0822070014844885, 0.0005351053822021142, 0.003210632293213088, 0.009417854726758232,
+      0.013912739937255976, -0.001811713936884019, -0.005886159204224108, 0.0026500457023346624,
+      -0.0004224516175280766, 2.3469534307162278e-05, -0.0051370116691419766, -0.05137011669140778,
+      -0.20676471968291685, -0.08989770420996486, 0.05993180280664311, -0.010138838820672699,
+      0.0005632688233708097, 0.05045279317906101, 0.7063391045068602, 0.5381631272433234,
+      -0.11152722702739967, 0.006195957057077573, -1.5981814081771397, -1.5140665972204475,
+      0.08411481095669286, 3.0822070014844885, -0.16222142113076263, -0.162221421130763,
+      0.0005351053822021268, -0.0008026580733033273, -0.0008561686115237196, 0.008294133424133559,
+      -0.009196168211274594, -0.09518186985921025, -0.22209421482257588, 0.23935052520094197,
+      0.3832715769557323, -0.004013290366516301, 0.006421264586426216, 0.010893216709115298,
+      -0.06920059246264448, -0.05317609735634051, 0.40591565421335873, -0.01664911999793514,
+      -0.4060816173488166, 0.011558276255566617, -0.03371163907873623, -0.015170237585431526,
+      0.23317217029459442, -0.2771845879807222, -0.17994326648606251, 0.30031381404038215,
+      0.0011466543904328746, 0.09889894117486507, -0.20668445387558712, 0.07567918976859234,
+      0.20680515433773694, -0.1733107760908733, -0.10405888593181435, 0.12140203358711688,
+      0.008408798863176536, -0.13534293696554073, 0.0817091836902125, -0.0913023558382448,
+      0.05944950387663104, -0.03185285196161267, -0.024971584502767687, -0.014997032422244332,
+      0.00997455208052208, -0.0021545032493928244, -0.0021545032493918838, -0.16222142113076263,
+      -0.162221421130763, 0.0005351053822021268, -0.0008026580733033273, -0.0008561686115237196,
+      0.008294133424133559, -0.009196168211274594, -0.09518186985921025, -0.22209421482257588,
+      0.23935052520094197, 0.3832715769557323, -0.004013290366516301, 0.006421264586426216,
+      0.010893216709115298, -0.06920059246264448, -0.05317609735634051, 0.40591565421335873,
+      -0.01664911999793514, -0.4060816173488166, 0.011558276255566617, -0.03371163907873623,
+      -0.015170237585431526, 0.23317217029459442, -0.2771845879807222, -0.17994326648606251,
+      0.30031381404038215, 0.0011466543904328746, 0.09889894117486507, -0.20668445387558712,
+      0.07567918976859234, 0.20680515433773694, -0.1733107760908733, -0.10405888593181435,
+      0.12140203358711688, 0.008408798863176536, -0.13534293696554073, 0.0817091836902125,
+      -0.0913023558382448, 0.05944950387663104, -0.03185285196161267, -0.024971584502767687,
+      -0.014997032422244332, 0.00997455208052208, -0.0021545032493928244, -0.0021545032493918838,
+      0.16222142113076266, 0.16222142113076252, 0.0005351053822021852, -0.0008026580733032714,
+      -0.0008561686115236675, 0.008294133424133661, -0.009196168211274558, -0.09518186985921022,
+      -0.22209421482257558, 0.2393505252009419, 0.38327157695573294, 0.0040132903665162385,
+      -0.00642126458642623, -0.010893216709115265, 0.06920059246264439, 0.053176097356340525,
+      -0.4059156542133584, 0.016649119997934916, 0.4060816173488161, 0.011558276255566657,
+      -0.0337116390787363, -0.015170237585431522, 0.23317217029459436, -0.2771845879807226,
+      -0.17994326648606235, 0.3003138140403824, -0.0011466543904329043, -0.09889894117486502,
+      0.20668445387558712, -0.07567918976859227, -0.2068051543377374, 0.17331077609087264,
+      -0.10405888593181452, 0.12140203358711689, 0.008408798863176765, -0.13534293696554087,
+      0.08170918369021245, 0.09130235583824498, -0.059449503876631525, 0.031852851961613075,
+      -0.02497158450276783, -0.014997032422244571, 0.009974552080522689, 0.0021545032493930755,
+      0.0021545032493925343, 0.16222142113076266, 0.16222142113076252, 0.0005351053822021852,
+      -0.0008026580733032714, -0.0008561686115236675, 0.008294133424133661, -0.009196168211274558,
+      -0.09518186985921022, -0.22209421482257558, 0.2393505252009419, 0.38327157695573294,
+      0.0040132903665162385, -0.00642126458642623, -0.010893216709115265, 0.06920059246264439,
+      0.053176097356340525, -0.4059156542133584, 0.016649119997934916, 0.4060816173488161,
+      0.011558276255566657, -0.0337116390787363, -0.015170237585431522, 0.23317217029459436,
+      -0.2771845879807226, -0.17994326648606235, 0.3003138140403824, -0.0011466543904329043,
+      -0.09889894117486502, 0.20668445387558712, -0.07567918976859227, -0.2068051543377374,
+      0.17331077609087264, -0.10405888593181452, 0.12140203358711689, 0.008408798863176765,
+      -0.13534293696554087, 0.08170918369021245, 0.09130235583824498, -0.059449503876631525,
+      0.031852851961613075, -0.02497158450276783, -0.014997032422244571, 0.009974552080522689,
+      0.0021545032493930755, 0.0021545032493925343, 0.5316232604162703, -0.4252986083330161,
+      0.1063246520832546, -1.0622602068057918, 0.007890512213971293, 0.03008257781576155,
+      0.05720621355128833, 0.0030685325276537385, -0.02191808948324995, 0.007890512213969199,
+      -0.0010959044741619412, 5.479522370820149e-05, -0.005917884160475253, -0.07101460992573494,
+      -0.33600431177824747, -0.16833092723137338, 0.08876826240716969, -0.01315085368995126,
+      0.0006575426844980906, 0.055847292003324465, 0.8935566720532035, 0.7036758792418959,
+      -0.12765095315045788, 0.0063825476575235735, -1.8028242306480027, -1.716975457760001,
+      0.08584877288799794, 3.2403703492039346, -0.5316232604162703, 0.4252986083330161,
+      -0.1063246520832546, 1.0622602068057918, -0.007890512213971293, -0.03008257781576155,
+      -0.05720621355128833, -0.0030685325276537385, 0.02191808948324995, -0.007890512213969199,
+      0.0010959044741619412, -5.479522370820149e-05, 0.005917884160475253, 0.07101460992573494,
+      0.33600431177824747, 0.16833092723137338, -0.08876826240716969, 0.01315085368995126,
+      -0.0006575426844980906, -0.055847292003324465, -0.8935566720532035, -0.7036758792418959,
+      0.12765095315045788, -0.0063825476575235735, 1.8028242306480027, 1.716975457760001,
+      -0.08584877288799794, -3.2403703492039346, -0.2658116302081351, -0.10632465208325428,
+      0.1594869781248806, -0.15430334996209163, -0.15430334996209202, -0.31897395624976144,
+      -0.3184807992363892, -0.0015781024427942566, 0.001380839637444761, 0.007890512213970653,
+      -0.021920829244437376, -0.10546984659340691, -0.20923172606383172, 0.24355381033789175,
+      0.3736749321731134, -0.0004931570133732321, -0.003945256106985721, 0.012328925334329027,
+      -0.0012328925334331828, -0.08416089734704381, -0.018776496657318745, 0.42591505459973156,
+      -0.03599132943895613, -0.41353590031033727, 0.005523358549779039, 0.010701507190196387,
+      -0.05005543685737646, 0.015930798039409468, 0.2472214373114228, -0.3301587573130653,
+      -0.18228361769491971, 0.323932193392365, -0.02441127216197222, 0.008137090720655328,
+      0.11391927008919937, -0.2584142750075383, 0.10208350176824418, 0.2414003580461615,
+      -0.2004683259361915, 0.035260726456180516, -0.13255421241860815, 0.14546305387051287,
+      0.028479817522298733, -0.1819292752482731, 0.10286889997472748, 0.10878587088147687,
+      -0.0744630560044346, -0.04083833227743115, 0.09768527181193738, -0.044725322796540734,
+      0.0644391830807589, 0.00966587746211206, -0.03830186137198248, 0.016471444246661623,
+      0.014084564301936378, 0.009128884269771643, -0.004955680032163405, 0.001041109250453291,
+      0.0010411092504519067, 0.2658116302081351, 0.10632465208325428, -0.1594869781248806,
+      0.15430334996209163, 0.15430334996209202, 0.31897395624976144, 0.3184807992363892,
+      0.0015781024427942566, -0.001380839637444761, -0.007890512213970653, 0.021920829244437376,
+      0.10546984659340691, 0.20923172606383172, -0.24355381033789175, -0.3736749321731134,
+      0.0004931570133732321, 0.003945256106985721, -0.012328925334329027, 0.0012328925334331828,
+      0.08416089734704381, 0.018776496657318745, -0.42591505459973156, 0.03599132943895613,
+      0.41353590031033727, -0.005523358549779039, -0.010701507190196387, 0.05005543685737646,
+      -0.015930798039409468, -0.2472214373114228, 0.3301587573130653, 0.18228361769491971,
+      -0.323932193392365, 0.02441127216197222, -0.008137090720655328, -0.11391927008919937,
+      0.2584142750075383, -0.10208350176824418, -0.2414003580461615, 0.2004683259361915,
+      -0.035260726456180516, 0.13255421241860815, -0.14546305387051287, -0.028479817522298733,
+      0.1819292752482731, -0.10286889997472748, -0.10878587088147687, 0.0744630560044346,
+      0.04083833227743115, -0.09768527181193738, 0.044725322796540734, -0.0644391830807589,
+      -0.00966587746211206, 0.03830186137198248, -0.016471444246661623, -0.014084564301936378,
+      -0.009128884269771643, 0.004955680032163405, -0.001041109250453291, -0.0010411092504519067,
+      -0.2658116302081352, -0.10632465208325419, 0.15948697812488066, -0.1543033499620917,
+      -0.15430334996209208, 0.31897395624976144, 0.3184807992363886, 0.0015781024427941113,
+      -0.0013808396374448673, -0.007890512213970698, 0.02192082924443743, 0.10546984659340662,
+      0.2092317260638316, -0.24355381033789147, -0.373674932173114, -0.0004931570133731001,
+      -0.003945256106985576, 0.012328925334329211, -0.0012328925334331006, -0.08416089734704373,
+      -0.01877649665731893, 0.4259150545997321, -0.03599132943895596, -0.4135359003103372,
+      -0.00552335854977899, -0.010701507190196564, 0.0500554368573762, -0.01593079803940977,
+      -0.247221437311423, 0.33015875731306527, 0.18228361769491958, -0.3239321933923648,
+      -0.024411272161972215, 0.008137090720655429, 0.11391927008919954, -0.25841427500753783,
+      0.10208350176824406, 0.24140035804616194, -0.20046832593619096, -0.035260726456180655,
+      0.132554212418608, -0.1454630538705126, -0.028479817522298865, 0.18192927524827354,
+      -0.10286889997472758, 0.1087858708814772, -0.07446305600443404, -0.04083833227743159,
+      0.09768527181193791, -0.044725322796541116, -0.0644391830807597, -0.009665877462113696,
+      0.03830186137198216, -0.01647144424666251, 0.014084564301937028, 0.009128884269773737,
+      -0.004955680032163612, -0.0010411092504541133, -0.0010411092504542612, 0.2658116302081352,
+      0.10632465208325419, -0.15948697812488066, 0.1543033499620917, 0.15430334996209208,
+      -0.31897395624976144, -0.3184807992363886, -0.0015781024427941113, 0.0013808396374448673,
+      0.007890512213970698, -0.02192082924443743, -0.10546984659340662, -0.2092317260638316,
+      0.24355381033789147, 0.373674932173114, 0.0004931570133731001, 0.003945256106985576,
+      -0.012328925334329211, 0.0012328925334331006, 0.08416089734704373, 0.01877649665731893,
+      -0.4259150545997321, 0.03599132943895596, 0.4135359003103372, 0.00552335854977899,
+      0.010701507190196564, -0.0500554368573762, 0.01593079803940977, 0.247221437311423,
+      -0.33015875731306527, -0.18228361769491958, 0.3239321933923648, 0.024411272161972215,
+      -0.008137090720655429, -0.11391927008919954, 0.25841427500753783, -0.10208350176824406,
+      -0.24140035804616194, 0.20046832593619096, 0.035260726456180655, -0.132554212418608,
+      0.1454630538705126, 0.028479817522298865, -0.18192927524827354, 0.10286889997472758,
+      -0.1087858708814772, 0.07446305600443404, 0.04083833227743159, -0.09768527181193791,
+      0.044725322796541116, 0.0644391830807597, 0.009665877462113696, -0.03830186137198216,
+      0.01647144424666251, -0.014084564301937028, -0.009128884269773737, 0.004955680032163612,
+      0.0010411092504541133, 0.0010411092504542612, 0.05892556509887903, 0.02357022603955157,
+      -0.03535533905932738, 0.07071067811865474, 0.07071067811865471, -0.08333333333333331,
+      -0.03333333333333334, 0.049999999999999996, 0.09999999999999987, 0.09999999999999999,
+      0.02357022603955157, 0.006734350297014724, -0.016835875742536803, -0.02357022603955155,
+      0.010101525445522098, 0.03367175148507374, -0.01683587574253683, -0.016835875742536824,
+      0.03333333333333329, 0.00952380952380951, -0.02380952380952377, 0.03333333333333328,
+      -0.014285714285714282, -0.047619047619047616, -0.023809523809523805, -0.023809523809523794,
+      -0.017677669529663716, -0.005050762722761065, 0.026516504294495518, 0.0019641855032959754,
+      -0.01192541198429694, -0.015152288168283155, -0.03724937508036277, 0.002525381361380525,
+      0.02462246827346014, 0.015783633508628266, -0.0014029896452114493, -0.01718662315383969,
+      0.0058925565098878726, 0.0058925565098878275, 0.024999999999999998, 0.0071428571428571565,
+      -0.03749999999999997, -0.0027777777777777866, 0.016865079365079375, -0.021428571428571415,
+      -0.052678571428571394, 0.0035714285714285674, 0.03482142857142855, -0.022321428571428537,
+      0.001984126984127046, 0.02430555555555555, 0.008333333333333321, 0.008333333333333191,
+      -0.016414978848973416, -0.0016835875742536764, 0.023850823968593827, -0.0002550890264020681,
+      -0.009374521720276204, 0.01641497884897339, -0.0025253813613805216, -0.037880720420707954,
+      0.0011479006188093261, 0.0200882608291633, 0.004208968935634232, 0.02385082396859386,
+      0.0031886128300258687, -0.016453242202933774, -0.009820927516479784, -0.0017856231848144507,
+      0.00803530433166526, -0.0022958012376186167, -0.00229580123761858, -0.023214285714285694,
+      -0.002380952380952376, 0.03373015873015866, -0.0003607503607503586, -0.013257575757575753,
+      -0.023214285714285673, 0.003571428571428556, 0.05357142857142858, -0.001623376623376619,
+      -0.02840909090909089, 0.0059523809523809555, 0.0337301587301587, 0.004509379509379497,
+      -0.02326839826839825, 0.013888888888888852, 0.002525252525252453, -0.011363636363636319,
+      -0.0032467532467531836, -0.0032467532467531494, 0.0036828478186799406, -0.0006313453403451253,
+      -0.016941099965927683, 0.0017856231848145032, 0.02077381258761884, -0.0013907257497113026,
+      -0.007752008345613012, -0.0018940360210353859, 0.020203050891044207, 0.0009183204950474696,
+      -0.037115453341501646, 0.0012671056830702919, 0.017203792607539823, -0.013679149040811175,
+      -0.0058670476072476664, 0.02790036226272679, 0.004481227415736387, -0.015607033413426901,
+      0.002142747821777405, -0.012387760844650653, -0.005456452385904272, 0.009074056280523709,
+      0.005691673901596237, 0.002008826082916334, -0.0036828478186798426, 0.0009443199535076507,
+      0.0009443199535076447, -0.005208333333333337, 0.000892857142857133, 0.023958333333333307,
+      -0.0025252525252525155, -0.029378607503607497, 0.001966783216783215, 0.010962995337995345,
+      -0.002678571428571412, 0.02857142857142855, 0.0012987012987013043, -0.05248917748917745,
+      0.0017919580419580412, 0.024329836829836797, 0.019345238095238068, 0.008297258297258274,
+      -0.03945707070707069, -0.006337412587412559, 0.022071678321678313, 0.0030303030303030004,
+      -0.017518939393939365, -0.007716588966588853, 0.012832653457653418, -0.008049242424242375,
+      -0.0028409090909091187, 0.005208333333333185, 0.0013354700854700582, 0.0013354700854700816,
+      0.004419417382415923, -0.0023723279455392828, -0.015943064150129565, 0.004189346702834042,
+      0.017976418024046106, -0.00197792106625607, -0.006613673565293765, -0.00441941738241591,
+      -0.0035584919183089202, 0.023761542809353147, 0.0006181003332050323, -0.0356599742235498,
+      0.0017615859496343054, 0.015139043161143062, 0.00593081986384819, -0.015943064150129582,
+      -0.010645061294086502, 0.030500308108747955, 0.004481227415736403, -0.01479025797312023,
+      0.008124585490906017, 0.009855266423880073, -0.015112553146862835, -0.0072111705540585285,
+      0.009632063525778282, -0.004017652165832646, 0.005452527939344284, 0.00482118259899916,
+      -0.004648997506177693, -0.0031567267017256415, -0.0014731391274719903, 0.0016835875742536059,
+      -0.0004017652165832406, -0.0004017652165832492, 0.006250000000000002, -0.003354978354978363,
+      -0.02254689754689753, 0.00592463092463092, 0.025422494172494155, -0.0027972027972027885,
+      -0.00935314685314686, 0.006249999999999988, 0.0050324675324675255, -0.03360389610389613,
+      -0.0008741258741258872, 0.050430819180819104, -0.002491258741258719, -0.02140984015984017,
+      0.008387445887445862, -0.022546897546897527, -0.015054390054390052, 0.04313394938394935,
+      0.006337412587412583, -0.020916583416583437, -0.011489898989898974, -0.013937451437451351,
+      0.02137237762237762, 0.01019813519813508, -0.013621794871794879, -0.005681818181818167,
+      0.007711038961038923, 0.006818181818181798, -0.0065746753246751985, 0.004464285714285678,
+      0.002083333333333359, -0.002380952380952312, -0.0005681818181817942, -0.0005681818181818118,
+      -0.00036828478186799594, 0.0007365695637359849, 0.0044194173824159185, -0.004201365320424143,
+      -0.014044613126714147, 0.005578355507175334, 0.015605745704399335, -0.002268034335395197,
+      -0.005766739763141147, 0.0022097086912079493, -0.006076698900821902, -0.003476814374278267,
+      0.026211317254975552, -0.001136863112859237, -0.0338071908810029, 0.0022889839545318365,
+      0.013557587685451579, 0.0027621358640099484, 0.009417445354526528, -0.019636029682597086,
+      -0.012152294051048732, 0.032110634237257886, 0.003943527738618824, -0.014028061376574134,
+      -0.008112566873315921, 0.007301310185984355, 0.015375245788474934, -0.017879195992469055,
+      -0.007910623798766264, 0.009929940922877413, -0.003029795383299607, -0.008894022294582275,
+      0.006182934895591489, 0.006678405291365721, -0.005368756515508316, 0.003763789528980581,
+      -0.0019512011039352088, -0.003412169216880362, 0.002302821416035381, 0.0017033171161394578,
+      0.0009315438600190686, -0.000771773256120363, 0.0001749769325616924, 0.0001749769325617164,
+      0.0005208333333333389, -0.001041666666666664, -0.006249999999999994, 0.005941627816627817,
+      0.019862082362082353, -0.007888986013986013, -0.022069857226107208, 0.00320748491704374,
+      0.008155401583710418, 0.0031249999999999776, -0.008593749999999999, -0.004916958041958049,
+      0.037068400349650275, -0.0016077672327672215, -0.047810587849650296, 0.0032371121525533175,
+      0.019173324377828066, -0.003906249999999991, -0.013318278943278904, 0.027769539488289464,
+      0.017185939060939043, -0.0454112944347319, -0.005576990411549229, 0.019838674652553324,
+      -0.01147290209790208, 0.010325611888111883, 0.021743881118881037, -0.0252850014568764,
+      -0.011187311463046688, 0.014043057126696836, 0.004284777722277704, 0.012578046953046939,
+      -0.00874399038461532, -0.009444691338073633, 0.007592568277310807, 0.005322802197802186,
+      -0.002759415064102557, -0.0048255359836242295, 0.0032566812782804547, -0.002408854166666661,
+      -0.0013174019607843182, 0.001091452205882338, 0.0002474547511311991, 0.0002474547511311905,
+      -0.0003682847818679964, 0.001473139127471977, 0.0036828478186799306, -0.00540837791554396,
+      -0.011938350394049502, 0.00624251037501132, 0.013649867186790643, -0.0023921407812973732,
+      -0.005110949023911091, 0.0003682847818679911, 0.0022097086912079523, -0.008102265201095856,
+      -0.001725530096864032, 0.027209107792863618, -0.003232907134949787, -0.031773985796995065,
+      0.002743322554719477, 0.01229345243747282, -0.003682847818679925, 0.0036828478186799346,
+      0.011754943836845534, -0.02367223099037365, -0.011648464367679943, 0.03293811804220154,
+      0.003202334724248023, -0.013322768495774198, 0.0007365695637359888, -0.011795414691995841,
+      0.00875062669644738, 0.018885843587827838, -0.02045896953390656, -0.007993946147605202,
+      0.010068256021950031, 0.00717437886755829, -0.00020446979772540625, -0.01358320930771949,
+      0.007585428574440758, 0.007867872542489848, -0.005921916674386594, -0.00014468330716243174,
+      0.006195849859661522, -0.001463854637172756, -0.004966713652684128, 0.002837674151312495,
+      -0.002859623012151474, 0.00042605494372962926, 0.002164100668685633, -0.001121577287195436,
+      -0.0009026587790882047, -0.0005472962702682324, 0.0003553625088199939, -7.753363828798264e-05,
+      -7.75336382879761e-05, -0.0005208333333333383, 0.002083333333333329, 0.005208333333333329,
+      -0.0076486013986013825, -0.016883377039627025, 0.008828242835595763, 0.01930382730015083,
+      -0.0033829979360165117, -0.007227973426212588, -0.0005208333333333308, -0.0031249999999999893,
+      0.01145833333333336, 0.002440268065268076, -0.038479489260739214, 0.0045720211161387435,
+      0.044935201644760406, -0.003879643962848295, -0.017385567165462645, -0.005208333333333318,
+      0.0052083333333333304, 0.016624000999000958, -0.03347759011821509, -0.016473416289592747,
+      0.04658153325432733, 0.004528785198289845, -0.01884123989508084, -0.001041666666666668,
+      0.016681235431235394, -0.012375254953379954, -0.026708616138763065, 0.02893335218702864,
+      0.011305147058823477, -0.014238664215686297, 0.010146103896103853, -0.00028916396103894975,
+      -0.019209558823529344, 0.010727415966386484, 0.01112685205661202, -0.008374854876160924,
+      0.00020461309523810365, -0.00876225490196078, 0.00207020308123244, 0.007023993808049522,
+      -0.004013077270381711, -0.0040441176470588135, 0.0006025326797385615, 0.003060500515995917,
+      -0.0015861498108014488, 0.0012765522875816716, 0.000773993808049538, -0.0005025584795321752,
+      -0.0001096491228069798, -0.00010964912280699897, 9.207119546699987e-05, -0.00018414239093400109,
+      -0.00011837725131471698, 0.001999260244426249, 0.0025319578753424505, -0.005885474110236587,
+      -0.010009722071890645, 0.006450114585223638, 0.01204949702533504, -0.0024223153747697334,
+      -0.004587983819229565, -0.000552427172801979, 0.0010259361780608424, 0.0015783633508628227,
+      -0.009667475524034812, 0.0008739919233567322, 0.02694019843834137, -0.005161036405788296,
+      -0.029712201422608622, 0.0031007347097897044, 0.011253168735660223, 0.0007891816754314158,
+      -0.004735090052588475, 0.005918862565735602, 0.012305520604238238, -0.02721030171916085,
+      -0.0100074317514373, 0.03315296022888193, 0.002416139288386517, -0.012671564662289142,
+      0.003682847818679917, 0.001611245920672466, -0.01582291404450948, 0.011806568524601787,
+      0.02067069600769299, -0.02270210583585269, -0.0077134568090927395, 0.010101464363349133,
+      -0.0038472606677281353, 0.009289132544342688, 0.0009992432684506436, -0.017678158187047807,
+      0.009383504501660143, 0.008572272161768098, -0.006352240583319596, -0.004654743501922373,
+      -0.003327061389137782, 0.009229272014782089, -0.0015991312896899619, -0.006194953987790511,
+      0.0033057672038968615, 0.001572431593171682, -0.003671065746194995, -0.0005002629970420903,
+      0.0032883248500453406, -0.0014549094922791865, 0.0019554439656458435, 0.00012613468728838438,
+      -0.0012878158145262805, 0.0005414934638311653, 0.0004724706083174834, 0.0003080577592692724,
+      -0.00016441284904824576, 3.4816838621964786e-05, 3.4816838621962564e-05, -0.00013020833333333428,
+      0.0002604166666666707, 0.00016741071428572, -0.0028273809523809545, -0.0035807291666666644,
+      0.008323317307692297, 0.014155884709653078, -0.009121839525283797, -0.017040562113003095,
+      0.0034256712553442266, 0.006488388941102758, -0.0007812499999999912, 0.0014508928571428624,
+      0.0022321428571428453, -0.013671874999999969, 0.0012360112314156332, 0.03809919400452484,
+      -0.007298807680967089, -0.04201939821981425, 0.004385101079905616, 0.01591438384564355,
+      -0.0011160714285714218, 0.006696428571428555, -0.008370535714285698, -0.01740263413057529,
+      0.03848117772750124, 0.014152645707405799, -0.046885365988500655, -0.0034169369502186934,
+      0.01792029860189691, 0.005208333333333306, 0.002278645833333326, -0.02237697963800901,
+      0.016697009332579147, 0.029232778637770834, -0.032105625967492266, -0.01090847523219805,
+      0.01428562790247682, 0.005440848214285699, -0.013136817226890743, -0.0014131433823529375,
+      0.02500069106589998, -0.013270279328836725, -0.01212302355152576, 0.008983424784387373,
+      -0.006582801389786643, -0.004705175339366515, 0.013052161654135313, -0.0022615131578947304,
+      -0.008760987947810663, 0.004675060813799107, -0.002223754084967337, 0.005191670966632254,
+      0.0007074787151702919, -0.004650393600422627, 0.0020575527360066318, 0.002765415376676989,
+      0.000178381385448952, -0.001821246590741558, 0.000765787400486444, -0.0006681743421052517,
+      -0.0004356594611529002, 0.0002325148809523681, 4.923844537811402e-05, 4.923844537813078e-05,
+      0.016666666666666684, -0.011904761904761888, 0.004761904761904745, -0.02380952380952379,
+      -0.023809523809523784, -0.004761904761904762, 0.0011904761904761917, 0.003968253968253964,
+      -0.0019841269841269814, -0.00476190476190475, -0.0017857142857142854, 0.0023809523809523764,
+      -0.0005952380952380928, -0.0029761904761904704, 0.0039682539682539585, 0.006944444444444441,
+      0.0055555555555555506, 0.005555555555555542, 0.009523809523809507, 0.0035714285714285635,
+      -0.00476190476190475, 0.001190476190476183, -0.011111111111111089, -0.011111111111111094,
+      -0.005952380952380958, 0.0005952380952380931, 0.006547619047619046, -0.0031746031746031638,
+      -0.0019300144300144336, 0.0012445887445887433, -0.0017857142857142785, 0.002678571428571428,
+      0.0014285714285714266, -0.0023538961038961008, 0.0006818181818181801, 0.010416666666666638,
+      0.011111111111111084, -0.002660533910533902, -0.0033549783549783538, 0.0033333333333333296,
+      -0.000757575757575756, -0.004090909090909083, -0.001948051948051951, -0.0019480519480519676,
+      -0.0007936507936507934, 0.00039682539682539623, 0.0003968253968253962, -0.0005291005291005275,
+      0.00022847522847522744, -3.607503607503563e-05, 0.0011904761904761871, -0.0017857142857142844,
+      -0.0009523809523809513, 0.0015692640692640666, -0.00045454545454545324, -0.0009920634920634898,
+      -0.0005291005291005286, 0.00039081289081288866, -7.215007215007135e-05, -0.002222222222222218,
+      0.0005050505050505049, 0.002727272727272717, 0.0025974025974025844, 0.0025974025974025883,
+      -0.005952380952380957, -0.0011904761904761915, 0.004761904761904758, -0.0007936507936507892,
+      -0.0006854256854256892, 0.0001082251082251079, 0.01488095238095236, 0.013492063492063468,
+      -0.0011724386724386632, 0.0002164502164502099, -0.007792207792207774, -0.007792207792207791,
+      0.004166666666666668, -0.0017857142857142835, -0.004689754689754679, 0.003156565656565654,
+      0.001019813519813521, -0.0008741258741258745, 0.004166666666666657, 0.0026785714285714277,
+      -0.004329004329004328, -0.00018939393939393918, 0.0019855144855144826, -0.0006660006660006614,
+      0.004464285714285707, -0.004689754689754683, -0.00861291486291485, 0.0024142524142524084,
+      0.0018731268731268724, -0.005050505050505043, -0.007702020202020189, 0.0003108003108003109,
+      0.002962315462315453, -0.0024350649350649363, -0.00037462537462537663, 0.002060439560439565,
+      0.0007631257631257641, 0.0007631257631257672, -0.0002976190476190472, 0.0005952380952380946,
+      -0.0002976190476190474, -0.0003607503607503601, 0.0005321067821067814, -0.000253912753912753,
+      4.370629370629355e-05, -0.002976190476190468, -0.0017857142857142848, 0.002380952380952379,
+      5.411255411255605e-05, -0.0008616383616383591, 0.00027472527472527207, -0.000595238095238094,
+      0.00028860028860028795, 0.00045093795093794964, -0.000357975357975357, 7.492507492507456e-05,
+      0.004040404040404035, 0.005176767676767666, -5.827505827505696e-05, -0.0011946386946386906,
+      0.0019480519480519398, 0.00029970029970030127, -0.0016483516483516431, -0.0009157509157509131,
+      -0.0009157509157509147, 0.0002976190476190477, 0.001785714285714286, -0.0002976190476190481,
+      -0.0016233766233766191, 0.0004599567099567099, 0.00025391275391275467, -4.370629370629389e-05,
+      0.0005952380952380936, 0.000892857142857141, -0.00028138528138528036, -0.0003517316017316013,
+      0.00020229770229770208, -2.497502497502469e-05, 0.002083333333333328, -0.0022727272727272717,
+      -0.003923160173160165, 0.0003579753579753565, -7.49250749250729e-05, -0.00217171717171717,
+      -0.002398989898989892, -0.00019813519813519732, 2.913752913752914e-05, -0.001948051948051944,
+      -0.00029970029970029867, 0.0016483516483516488, 0.0018315018315018265, 0.0018315018315018254,
+      -0.00833333333333332, -0.005357142857142852, 0.004112554112554109, 0.0003787878787878832,
+      -0.0006743256743256716, 8.325008325007784e-05, 0.014646464646464628, 0.015404040404040375,
+      0.0006604506604506646, -9.712509712509763e-05, -0.0061050061050060885, -0.006105006105006095,
+      0.002033730158730161, -0.0007936507936507927, -0.004153138528138522, 0.003138528138528136,
+      0.002918956043956043, -0.002747252747252745, -0.0005511849261849278, 0.0006507381507381533,
+      0.0023809523809523747, -0.00357142857142857, -0.0024350649350649333, 0.004974192474192461,
+      -0.0007492507492507497, -0.001587995337995334, 0.0006181318681318655, -0.004734848484848469,
+      -0.007575757575757565, 0.004526723276723273, 0.006243756243756231, -0.0022338772338772266,
+      -0.001110001110001112, -0.005681818181818167, 0.0006191724941724988, 0.007964257964257962,
+      -0.000526903651903653, -0.002190170940170935, 0.0015557359307359262, 0.004245754245754249,
+      0.0008231351981352081, -0.0018668831168831205, 0.001526251526251521, 0.000534188034188032,
+      -0.0009920634920634944, -0.00031565656565656894, -0.0003156565656565813, 0.0006944444444444443,
+      -0.00019841269841269792, -0.0007846320346320338, 0.0007936507936507914, 6.93750693751494e-07,
+      -0.0004037629037629034, 0.00023656898656898538, -4.4400044400043655e-05, -0.0005952380952380927,
+      0.001298701298701299, 0.0009956709956709952, -0.001615051615051612, 5.030683602112164e-05,
+      0.0005744255744255729, -0.00019266447837876273, 0.0005411255411255399, 0.0007936507936507928,
+      -0.00043012543012542855, -0.0003080253080253086, 0.00030525030525030433, -6.937506937506814e-05,
+      0.0023232323232323204, -0.0003690753690753685, -0.0032750582750582726, 5.8275058275057536e-05,
+      0.0006410256410256392, -0.0017940392940392854, -0.003396603396603385, -0.0005286380286380286,
+      0.0010739260739260697, -0.0013082155939298766, -0.00045787545787545733, 0.0008503401360544199,
+      0.0003607503607503599, 0.0003607503607503581, 0.0022321428571428583, -5.952380952380879e-05,
+      -0.00258928571428571, 0.000901875901875899, 0.0010132228882228896, -0.0003642191142191146,
+      -0.00015047452547452663, 2.7472527472528272e-05, -0.00017857142857142852, -0.0004626623376623382,
+      -0.0005194805194805192, 0.00031530969030969, 0.0003045169116597685, -0.00021728271728271698,
+      2.88996717568141e-05, -0.005641233766233756, -0.006240981240981229, 0.0015938922188922155,
+      0.0019367537224680065, -0.00021228771228771088, 4.459825888397146e-05, -0.0012121212121212113,
+      0.00033508158508158554, 0.0017407592407592384, 0.00016608391608391546, -2.747252747252778e-05,
+      0.0031093906093905993, 0.004227914942200652, 0.0004570429570429627, -0.0006614813757670891,
+      0.00156985871271585, 0.0005494505494505445, -0.0010204081632653051, -0.0006493506493506515,
+      -0.0006493506493506602, 0.000694444444444445, -0.00019841269841269814, -0.0005140692640692639,
+      0.00043290043290043154, -4.786879786879741e-05, -7.07625707625708e-05, 2.8443778443778037e-05,
+      -2.7750027750023993e-06, -0.0005952380952380932, 0.0017045454545454532, 0.0012121212121212113,
+      -0.0013965201465201435, -3.5321821036107004e-05, 0.00024142524142524096, -3.211074639645975e-05,
+      -0.00013528138528138571, 0.00043290043290043333, 0.0001769064269064271, -0.0002842395699538551,
+      9.712509712509694e-05, -9.910724196437825e-06, 0.0028282828282828235, -0.0007090132090132092,
+      -0.0037523587523587486, -0.0001845376845376843, 3.0525030525031054e-05, -0.002231102231102221,
+      -0.0027543884686741737, -0.00046620046620046663, 5.70857713714847e-05, -0.001744287458573167,
+      -0.0006105006105006095, 0.0011337868480725615, 0.001443001443001439, 0.0014430014430014374,
+      0.002033730158730166, 0.0015873015873015875, -0.0017721861471861468, -0.0009199134199134174,
+      0.0006816100566100572, 0.00016650016650016664, -9.955322455322488e-05, 9.712509712509311e-06,
+      -0.010687229437229424, -0.011634199134199113, 0.00026015651015650444, 0.0008325008325008362,
+      -0.00033993783993783614, 3.4687534687531374e-05, 0.013653013653013616, 0.015484515484515458,
+      0.0016317016317016458, -0.00019980019980019674, -0.005050505050505042, -0.005050505050505043,
+      -0.0019209956709956707, 0.0016639610389610382, 0.003166971916971912, -0.0035502691752691724,
+      -0.0016462703962703956, 0.002283653846153844, 0.0002943747429041556, -0.000503265117235707,
+      -0.0019209956709956666, -0.002495941558441553, 0.004755661005661002, 0.001032821345321345,
+      -0.004776473526473516, 0.0013230259324009278, 0.001240120173943705, -0.0005615937371452078,
+      -0.004159902597402584, 0.0031669719169719127, 0.007930437617937606, -0.005109473859473856,
+      -0.004356971153846146, 0.00202646618087794, 0.0006704003716871365, 0.0015782828282828254,
+      0.007842851592851577, -0.0001699689199689209, -0.007295915889665867, 0.0007888557520910447,
+      0.0016502339572192508, 0.004495504495504481, 0.0018169330669330652, -0.005031687062937062,
+      -0.0007255612035023906, 0.0016275544308632522, 7.631257631258709e-06, -0.0020198985042735014,
+      -0.0009864522732169762, 0.0010410774886877904, -0.0008877840909090964, -0.00041778074866310203,
+      0.00047000334224599823, 0.0001349753187988457, 0.00013497531879885365, 0.0003968253968253965,
+      -0.0007936507936507928, 0.0003336940836940836, 0.0007691382691382673, -0.0010186572686572662,
+      0.0002608502608502601, 0.00027437839937839904, -0.00020767631061748668, 4.24208144796378e-05,
+      0.0008116883116883109, 0.0006764069264069257, -0.0011738261738261726, -0.00048493173493173474,
+      0.0010947385947385918, -3.486097236097211e-05, -0.00042922763510998816, 0.0001467588783765253,
+      0.0003832972582972574, -0.0001549376549376554, -0.0006908600658600652, 0.000409312909312908,
+      0.00023457445332445283, -0.00026423739659033713, 6.312621202327026e-05, -0.001217301217301215,
+      -0.0030821030821030788, -1.9425019425019683e-05, 0.0021480833980833916, -8.150890503831666e-05,
+      -0.0003842154577448692, -0.002664002664002653, -0.0009240759240759188, 0.002904387279387271,
+      0.00042677910324969077, -0.0007376814362108443, 0.000381562881562879, 0.001766318172568169,
+      0.0006875613493260554, -0.0006971939416792334, 0.0007891414141414121, 0.00037136066547831,
+      -0.0004177807486631002, -0.00014997257644316255, -0.00014997257644316545, -0.00014880952380952426,
+      -0.0017045454545454538, 0.000744047619047619, 0.0019314019314019266, -0.00109577922077922,
+      -0.0005806693306693317, 0.0002716033966033968, 0.00010504201680672325, -1.983310806840226e-05,
+      -0.0007846320346320329, -0.0006899350649350643, 0.0007509157509157506, 0.0005692224442224432,
+      -0.0005103824746681878, -0.00019459706959706958, 0.00020032488519883498, -2.8464182875947225e-05,
+      -0.002042748917748915, 0.002306027306027301, 0.0045467924932210595, -0.0011880976166690435,
+      -0.0011909965034965048, 0.00016265247357684346, -3.246490904053893e-05, 0.0018881118881118849,
+      0.003192640692640685, 0.00011266511266511353, -0.0013330419580419547, -0.00011883541295306046,
+      2.234285322520698e-05, 0.0024805551591265797, 0.0006261595547309802, -0.002556818181818179,
+      -0.00036171811381895764, 0.00034070446360362055, -0.0012319030176172999, -0.002489697802197794,
+      -0.0006534665148110499, 0.0006043282697694465, -0.0010146103896103906, -0.00047746371275782885,
+      0.0005371466768525619, 0.0002570958453311398, 0.00025709584533114356, 0.00014880952380952412,
+      -0.00045995670995670993, 0.0002029220779220775, 0.00039960039960039906, -0.00043394105894105833,
+      8.116883116883095e-05, 6.764069264069259e-05, -3.207576736988488e-05, 3.3055180114004913e-06,
+      0.0029491341991341926, 0.0021103896103896102, -0.0022311022311022276, -0.0005702630702630705,
+      0.0009570786356500617, -2.757659007658796e-05, -0.00014281936550844228, 1.974128812364044e-05,
+      -0.000324675324675324, 2.4975024975024833e-05, -0.0001783930355358926, -0.00015876980162694376,
+      0.0002596361971361966, -9.881575007625376e-05, 1.0821636346846035e-05, -0.005069930069930063,
+      -0.00701590076590075, -0.0002927627927627936, 0.001740967365967361, 7.337433808022165e-05,
+      -1.4385124679242481e-05, -0.0014949336377907754, -0.0002782931354359903, 0.0016233766233766183,
+      0.00035762556770960023, -4.911055331223357e-05, 0.0024638060352346015, 0.0034913003663003582,
+      0.000606652917577287, -0.00042084141348847065, 0.0013528138528138478, 0.0006366182836770999,
+      -0.0007161955691367446, -0.0005141916906622809, -0.0005141916906622852, -0.000396825396825397,
+      -0.0008026695526695529, -1.3528138528138039e-05, 0.0007513320013320002, 0.0001612970362970355,
+      -0.00028513153513153494, -4.613442113442097e-05, 3.7421728598199487e-05, -3.856437679966949e-06,
+      0.0007846320346320327, -0.00019615800865800824, -0.0006514319014319006, 0.0004896145521145503,
+      1.4568764568764391e-05, -0.000110566516816516, 3.2443047148929225e-05, -2.678081722199441e-06,
+      -0.0011837121212121195, 0.001675407925407926, 0.003150495337995335, -8.32500832500828e-05,
+      -0.0002467150904650916, 0.00011528504175563, -1.2625242404653742e-05, 1.6187516187517645e-06,
+      0.0009340196840196831, 0.0007381507381507371, -0.00017199235949235883, 2.0472446943034455e-05,
+      -1.7853878147992939e-06, 0.0032051282051281937, 0.0005494505494505447, -0.0031302031302031237,
+      -0.0004172298289945371, 5.729564553093681e-05, -0.002136752136752129, -0.002798127798127788,
+      -0.0005985300102947142, 6.284565108094664e-05, -0.0015782828282828274, -0.0007427213309566231,
+      0.0008355614973262031, 0.0011997806115453128, 0.0011997806115453139, 0.003841991341991333,
+      0.004991883116883117, -0.000944888444888443, -0.0020656426906426897, 0.00048701298701298463,
+      0.00033143939393939613, -0.00011679496973614591, 9.641094199917614e-06, -0.011722999222999204,
+      -0.015685703185703156, -0.0031857031857031866, 0.0006968725718725696, -7.370080899492054e-05,
+      6.427396133279146e-06, 0.01257631257631254, 0.014957264957264915, 0.0021547080370609775,
+      -0.00022624434389139928, -0.004319210201563145, -0.00431921020156315, -0.0005208333333333334,
+      0.000520833333333332, 0.001673326673326672, -0.0024399211899211884, -0.0018696581196581187,
+      0.0033453525641025644, 0.0008247420471685171, -0.0018678013163307282, -0.00014878294435182978,
+      0.00040033093196792884, -0.0015624999999999927, 0.002343750000000001, 0.002097902097902094,
+      -0.00559986888111887, 0.0005127684815184819, 0.004150892765322903, -0.0016160310277957299,
+      -0.0009571196266968311, 0.0005055147058823468, 0.0010029033466533452, 0.00520659895659895,
+      -0.0039392031579531485, -0.006970243298368287, 0.00548484527115041, 0.0029087538278714745,
+      -0.0018034051297644539, -0.00039996915601598514, 0.004895104895104882, 0.0008194930069930055,
+      -0.009206548659673646, 0.0009399531228575312, 0.0063536953242835405, -0.0009785626041914702,
+      -0.0012613680340557247, 0.0012409465534465487, -0.005056271853146848, -0.002850389500205674,
+      0.005324454956807881, 0.00047615769485932465, -0.001401468355560845, -0.0026971726190476095,
+      -0.0022709865196078355, 0.0025162949795302703, 0.0010719163044772579, -0.0010181925756132415,
+      -0.0005058628565062374, 0.0008281342840166425, 0.0007862890221878264, -0.0005477081183350568,
+      0.0004949095022624457, 0.00027350261967135867, -0.00022140688259109293, -5.904183535762862e-05,
+      -5.904183535763608e-05, -0.00032016594516594515, -7.665945165945167e-05, 0.0008824508824508817,
+      -0.0007589632589632574, -0.00040931290931290937, 0.0009776681651681633, -0.0003992841309017768,
+      -0.00017111156817039232, 0.00017783590248760534, -3.9410086817206965e-05, -0.00022997835497835494,
+      -0.00041989260739260734, -0.0002705627705627704, 0.0006842116217116204, 0.00039803946053945915,
+      -0.0008174041032496896, 1.1385673150378409e-05, 0.0003440094638333803, -0.00011795963324601029,
+      -0.0001847111222111218, -0.00040931290931290845, 0.000160429847929847, 0.0005372231934731927,
+      -0.0003412768807989386, -0.00020098365686601027, 0.00023483554951240677, -5.764923286208046e-05,
+      -0.0012140637140637112, -1.2140637140636954e-05, 0.0025586392773892714, 1.5747120526531304e-05,
+      -0.0014920128890717073, 9.58866017883039e-05, 0.000246930410920348, 8.8453213453213e-05,
+      0.0028900786713286614, 0.001299726621417795, -0.0023362666745019604, -0.00030486879606461594,
+      0.0005294990419796907, 0.001960279304029297, 0.0014405401583710397, -0.0017304998922645937,
+      -0.0006479407299356989, 0.0005628200166706346, 0.00020169526143790667, -0.0007835710041592384,
+      -0.0005856626442442976, 0.00039960362135284716, -0.00044991772932949435, -0.0002486387451557764,
+      0.00020127898417371891, 6.440927493559012e-05, 6.440927493558995e-05, -0.0008139430014430006,
+      0.00036976911976911866, 0.0017529345654345636, -0.00132228882228882, -0.0012655747030747033,
+      0.00105623543123543, 0.0003250528066704541, -0.00020122851005204028, -8.053414593662295e-05,
+      1.5448302987002995e-05, 6.764069264069307e-05, 0.0008507117882117884, 0.0005556943056943066,
+      -0.0009339618714618681, -0.00043193413729127885, 0.0005843956900942179, 0.00010594272674104626,
+      -0.00017713396317304986, 2.6668055886321215e-05, 0.00235701798201798, 0.003626928626928615,
+      -0.0020309551559551534, -0.0032830264973122115, 0.00099313472475237, 0.000809764465226651,
+      -0.00013921997764877007, 2.631097832336112e-05, 0.0017822455322455283, -0.0002974456099456125,
+      -0.0032040008602508556, -0.0001530077357283218, 0.0010666416916416894, 7.811541528646828e-05,
+      -1.722429402382913e-05, -0.0011243964368964352, -0.0033855653275296086, -0.0010383764519793957,
+      0.0017038371292572943, 0.000277989715392969, -0.00020305497521054642, -0.0023697780394208896,
+      -0.0013834460066077677, 0.0019113414596607832, 0.0005373923354767001, -0.00038761709137096064,
+      0.00019015655504626126, 0.0012055958747135274, 0.0006132948095506188, -0.00040214451011664576,
+      0.0005998903057726605, 0.0003315183268743661, -0.0002683719788982962, -0.00010734879155931849,
+      -0.0001073487915593223, -0.0006809163059163064, 0.0001533189033189031, 0.0008037101787101773,
+      -0.0006771006771006756, -0.00017447829947829998, 0.0004322066822066816, -0.00012563008886538215,
+      -5.166402225225823e-05, 3.074625752644332e-05, -3.329144196016712e-06, 0.00045995670995670874,
+      -0.0015796703296703284, -0.0010855810855810847, 0.0016629204129204101, 0.00018856143856143813,
+      -0.0006169994221464795, 1.8853695324282507e-05, 0.00010136438638760583, -1.4175710770136233e-05,
+      2.775002775002748e-05, -0.00023310023310023267, -0.00020217877360734487, 0.0003805222555222555,
+      2.030241000829281e-05, -0.0002026840262134381, 8.861736941126546e-05, -1.0246962646342737e-05,
+      -0.002533022533022527, 0.0004981129981129987, 0.004288558663558659, 0.00028937565702271523,
+      -0.001003245120892178, -2.7868158673113194e-05, 7.329486818650109e-06, 0.001665298986727551,
+      0.00345591908091907, 0.0009826570488335185, -0.0011001253648312427, -0.00025406509677849775,
+      3.8097222694746444e-05, 0.0023847680097680043, 0.0011957507361919104, -0.0018539467068878802,
+      -0.0004567236813753847, 0.00020820575193640164, -0.0008886130209659612, -0.0019275386922445704,
+      -0.0006498811645870432, 0.00038904450669156627, -0.0008569861511038, -0.0004735976098205223,
+      0.0003833885412832767, 0.00020447388868441546, 0.0002044738886844153, -0.0008139430014430025,
+      -0.0001510642135642136, 0.0010864135864135874, 8.325008325008327e-06, -0.0006379037629037642,
+      -6.555944055944017e-05, 0.00020314652667593853, 2.073090308384415e-05, -2.2856722740623692e-05,
+      2.4243687169383554e-06, 0.000588474025974025, -0.00014906968031968006, 4.870129870129856e-05,
+      0.0004518918581418567, -0.0004603432282003703, 2.1784281894576235e-05, 0.00010894217826990923,
+      -3.5731248240923464e-05, 3.1009367309680306e-06, 0.00402332042957043, 0.004957542457542447,
+      -0.0008546141358641321, -0.001852946160981876, 0.00014123692892075045, 0.00013029687399435496,
+      -6.748564580414369e-05, 7.5644062679648755e-06, -0.00037198912198912164, -0.00011412198912199034,
+      -0.0005447157009657014, -0.0006239216257598591, 0.0001572365542953777, -1.9592282072931393e-05,
+      1.8323717046627868e-06, -0.004497585747585734, -0.007059235407449684, -0.0014796171965289638,
+      0.0012945038155122155, 0.00018523948961255627, -2.723186256468098e-05, -0.001635269492412344,
+      -0.0007765926883573908, 0.0013300191871620417, 0.00042172739541160585, -4.961498769548232e-05,
+      0.0020318733554027654, 0.002960275019098549, 0.0006391312505863639, -0.0002892704131094213,
+      0.0011997806115453143, 0.0006630366537487246, -0.0005367439577965856, -0.00042939516623727064,
+      -0.0004293951662372739, -0.00032016594516594504, -7.665945165945175e-05, 0.00037254412254412214,
+      -7.90875790875788e-05, -0.00016650016650016647, 8.533133533133518e-05, 1.7425385072444258e-05,
+      -2.1138991727227232e-05, 4.803632899608137e-06, -3.382840070145178e-07, -0.0002299783549783549,
+      -0.001184752747252748, -0.001028138528138528, 0.0005749458874458873, 0.0005806693306693297,
+      -0.00021928133141368379, -0.0001050420168067236, 4.2877497889107644e-05, -3.7211240771603965e-06,
+      0.0010900557775557756, 0.0002705627705627692, -0.0007674617049617043, 0.0002627580752580743,
+      0.00010194564422505565, -8.773905832729367e-05, 1.9632553978529317e-05, -1.4095166958946655e-06,
+      -0.0018162393162393159, 0.0007041569541569545, 0.003655545843045839, 0.000896336098541978,
+      -0.0002131038895744784, 2.3510738487517574e-05, -2.198846045596377e-06, 0.0001665001665001653,
+      0.001379870129870126, 0.0011920677361853822, -4.995004995004839e-05, -2.661811872338237e-05,
+      2.0297040420877266e-06, 0.0033577533577533506, 0.001420311714429359, -0.0025030525030524955,
+      -0.0005060728744939269, 5.9537985234579104e-05, -0.0020090612002376666, -0.002733214497920372,
+      -0.0006631719673515333, 6.0981330331176256e-05, -0.001439736733854377, -0.0007956439844984725,
+      0.0006440927493559069, 0.0010305483989694495, 0.0010305483989694506, -0.0005208333333333352,
+      -0.0010416666666666656, 0.0001108266733266746, 0.0010565823065823033, 4.2492229992229647e-05,
+      -0.00045163170163170155, 1.9067941862058945e-05, 6.941587823940828e-05, -1.761332063189597e-05,
+      1.2403746923866493e-06, 0.004909153346653343, 0.008703102453102438, 0.002597229159729157,
+      -0.0016571969696969706, -9.051916221034203e-05, 0.0002928036016271328, -7.198603125460474e-05,
+      5.168227884944907e-06, -0.011988011988011938, -0.017963286713286668, -0.005730666392431103,
+      0.000349650349650343, 9.759976865240323e-05, -7.4422481543252815e-06, 0.01157531194295898,
+      0.014230540701128907, 0.002431630546955634, -0.00022359821121430303, -0.003778677462887982,
+      -0.0037786774628879765, 0.0005208333333333343, -0.0009672619047619037, -0.0010267510267510274,
+      0.0026557643745143745, 0.0007782505484711369, -0.002877331002331001, -0.000327458918790188,
+      0.0015239243470667612, 6.461466165413568e-05, -0.0003256072165708404, 0.0005208333333333318,
+      0.001450892857142855, -0.0032529970029970038, -0.0008103875291375285, 0.005582698551448543,
+      -0.0017152845622514714, -0.003391668745770909, 0.0017214571177661335, 0.0007343343038969967,
+      -0.00045347744360902385, 0.002418154761904756, -0.001026751026751028, -0.005851353507603501,
+      0.0053285792026600744, 0.005401110582636315, -0.005512225132968156, -0.0018220727688848801,
+      0.0015828288552263003, 0.00022659283011450664, 0.0011994949494949466, -0.005829023407148396,
+      -0.0008924975147401555, 0.009665982506056008, -0.0019484632584477744, -0.005365228328173366,
+      0.001087488175094598, 0.0009742915806673556, -0.0034438218031967883, -0.0037720781057178003,
+      0.006281815610859715, 0.0027141879018814014, -0.00530842271118973, -0.0002106023330384863,
+      0.0012019363666519215, -0.0023554493912949725, 0.0021199605643539435, 0.003485358380869205,
+      -0.002945595305429858, -0.0009909693043884216, 0.0009645744262617317, 0.0012650633169934654,
+      0.0018156604747161993, -0.000982448077915382, -0.0009492941913607629, 0.000583751044277357,
+      0.0005449379481887251, -0.0002682930459633271, -0.000534040370534188, 0.00027919062361786645,
+      -0.00026864035087719536, -0.00016447368421052436, 0.00010416666666667391, 2.6260504201679183e-05,
+      2.6260504201681287e-05, -0.00026041666666666607, 0.0005208333333333328, -0.00015947594072594076,
+      -0.0008436008436008406, 0.0010759639665889656, 2.6780817221992495e-06, -0.0008099054744275326,
+      0.00044906074317838915, 9.59119730888309e-05, -0.00015078526349811082, 3.610819327730986e-05,
+      -0.000350170662670662, 0.0002872127872127876, 0.00019980019980019994, 5.5933649683648176e-05,
+      -0.0002716493065757769, -0.00046571841149046974, 0.0006850304837920925, -4.549919894347851e-07,
+      -0.0002876458444376392, 9.839183649168129e-05, 0.00013528138528138547, 8.67188367188368e-05,
+      0.0002233010045510043, -4.11276835909188e-05, -0.0004748238893459478, 0.0002882018652142484,
+      0.00018357102456367146, -0.00021336659663865503, 5.309689665339738e-05, 0.00029623154623154545,
+      0.001371133207070706, 0.0001221740881667356, -0.0019735766174185233, 9.479469618788916e-06,
+      0.0010933364478014228, -0.00010327152959699332, -0.0001662794630335269, 0.0016106939935064863,
+      0.0013123595154845105, -0.0027280279463183805, -0.0011553365365284832, 0.0018762022371977786,
+      0.0002083962380498753, -0.0003934490673799861, 0.0009040515244559359, -0.0015921552916038167,
+      -0.0019078970994605643, 0.001594222582757793, 0.0005489647360293635, -0.00045694813012924315,
+      -0.0010924966577540083, -0.0012905760390280463, 0.0007816677807486618, 0.0006171218487394928,
+      -0.0003626253132832078, -0.0003467786943019141, 0.00028546095931931785, 0.00041697262575745794,
+      -0.00021526702786377498, 0.0002479757085020225, 0.00015182186234817627, -9.615384615384586e-05,
+      -2.8280542986427482e-05, -2.828054298642917e-05, -5.7494588744588396e-05, 0.000922514985014985,
+      -0.0007958187645687637, -0.001435023310023309, 0.0016500426656676657, 0.0006621595316448254,
+      -0.0009006388831756463, -0.0001811510857563492, 0.00015052792602134757, 6.547970218635897e-05,
+      -1.2638532133502157e-05, 0.000540605228105227, 0.0003519917582417581, -0.0011540542790542797,
+      -0.00039543789543789435, 0.0011224529147323243, 0.00020547390722023038, -0.0005716178171673524,
+      -4.5283542888999644e-05, 0.00015484950421095964, -2.4508676308212104e-05, 0.0013749271561771547,
+      -0.0015661421911421893, -0.0034991050616050563, 0.0020185467106422945, 0.0024236448294352687,
+      -0.0008803841282556434, -0.0005800984764074932, 0.00012469994208577742, -2.2648114269629113e-05,
+      -0.0008231351981351959, -0.0029296874999999965, -3.751099798893878e-05, 0.0029620387272041595,
+      7.568916721393444e-05, -0.0008765121858920233, -4.638719446188507e-05, 1.2816735315768634e-05,
+      -0.002139462100399595, -0.0010232644194041209, 0.003002202301375093, 0.0009843049752105463,
+      -0.001250415485250041, -0.0002154784553681644, 0.00013323738471281, -0.0001690379677512032,
+      0.002302549625619474, 0.0017255797393181257, -0.001436183342264029, -0.0004248593415098838,
+      0.0002653161467015954, 0.0016032336229946514, 0.00143144877568252, -0.0010328529587672413,
+      -0.0005588210164448592, 0.0003022470950102501, 0.00020719895429647769, -0.0004952647004698101,
+      -0.000466662787676721, 0.00023580086708956487, -0.00033814869341185227, -0.00020702981229296996,
+      0.00013111888111888275, 4.6277252159604745e-05, 4.62772521596063e-05, -0.0002457611832611833,
+      0.0007031163281163279, -0.0003245018870018871, -0.0007652070152070132, 0.0009057782495282479,
+      -5.087845161374561e-05, -0.0003712433399933394, 0.0001453579530204913, 3.6872688285227067e-05,
+      -2.8069518201096564e-05, 3.1747685578948207e-06, -0.0009018759018758998, -0.0008064851814851813,
+      0.0014638139638139646, 0.000541819291819291, -0.0012138509249853754, -5.3964621979328224e-05,
+      0.0004202262633266616, -3.741260029959429e-06, -7.958623477199403e-05, 1.109893718252928e-05,
+      0.0005263833388833378, 5.8968808968808786e-05, 7.309159094873426e-05, 0.0002835523778275873,
+      -0.00044487188329100024, 5.703652458406969e-05, 0.00015783087173650004, -7.775833772350843e-05,
+      9.365455379387032e-06, 0.0016511266511266478, 0.0038244741369741313, 0.00021028807793513745,
+      -0.0028080341499459056, -0.0002025250864260152, 0.000651977988471796, 5.888647529515101e-06,
+      -3.6396853347328703e-06, 0.001982578433471281, 0.00074908022649619, -0.002811633831854412,
+      -0.000984408301414048, 0.0008036043594839448, 0.00018070004041366317, -2.9176995605014087e-05,
+      -0.0006983963457177701, -0.0028701852001484294, -0.0015235823299180212, 0.0011148975025232733,
+      0.0003445239150541005, -0.00012216706295653575, -0.002090008983391331, -0.0015622277619181577,
+      0.001275714631945277, 0.0005137621236692431, -0.00023417128680286594, 7.210460964330836e-05,
+      0.0008809479349340041, 0.0005446998964800847, -0.0002641434288106093, 0.0005009610272768153,
+      0.0003067108330266199, -0.0001942501942501967, -8.569861511038098e-05, -8.569861511038571e-05,
+      0.00024576118326118357, 0.0008024961149961144, -0.00033612221112221114, -0.0009552947052947045,
+      0.0002809690309690314, 0.00044728555757967445, -2.060847649083329e-06, -0.00013880813029419842,
+      -1.4544601425406373e-05, 1.6551753200359956e-05, -1.7719638462673664e-06, -0.0006037365412365396,
+      -0.00018445096570096566, 0.0006271506271506268, -0.0004985465922965908, -0.00026931227036269026,
+      0.0004842609392241726, -8.000480689556241e-05, -9.029968032483503e-05, 3.3806027420577434e-05,
+      -3.0606648253696113e-06, 0.0011251769064269037, -0.0017794705294705278, -0.0033710708933923175,
+      0.0006142972923435094, 0.0011432730872069092, -8.837573797768407e-05, -9.699056978330579e-05,
+      4.8527646244363874e-05, -5.409859318526536e-06, -0.00030108780108780114, -0.0009008786352536352,
+      -0.0006393116687234349, 0.000577900279187043, 0.0004662806520391654, -0.00013190055880651875,
+      1.7540652215573885e-05, -1.6992506833835127e-06, -0.002838214612768175, -0.0008541156847354284,
+      0.003625104980803501, 0.0010912406920810282, -0.0006666847706141683, -0.00010142479424600319,
+      1.5494615678440282e-05, 0.0014213618139563473, 0.0033634580969139696, 0.0014921060641980555,
+      -0.000770937170414723, -0.0002848185776784855, 3.6128373976670903e-05, 0.0022580054749172375,
+      0.0015063840528236746, -0.0013457984868588569, -0.00045652232184740333, 0.0001376547429178976,
+      -0.0006708046568727658, -0.0015504683654838404, -0.0006101641163560677, 0.00026949959225501026,
+      -0.0007514415409152257, -0.00046006624953993567, 0.00029137529137528883, 0.00017139723022075926,
+      0.00017139723022075983, 5.7494588744588816e-05, 0.00019095487845487846, -7.570554445554453e-05,
+      -0.0002559940059940053, 0.0001326798201798198, 0.00012358964564846886, -9.405423008364166e-05,
+      -1.0328938347514414e-05, 2.1971546255601913e-05, -5.436707255592376e-06, 3.986918654098863e-07,
+      -0.0016540750915750894, -0.0016592782217782205, 0.001046869796869797, 0.0009937978687978679,
+      -0.0005158444496679779, -0.00037658420011361227, 0.00016657104505401704, 5.7305310788283334e-05,
+      -2.5975379110054785e-05, 2.305163876372404e-06, 0.0008038836163836137, -0.00012487512487512493,
+      -0.00031218781218781094, 0.0005690541076570481, -0.0002376606236900349, -8.183251217306944e-05,
+      8.589997463836486e-05, -2.0840711146439232e-05, 1.5706043182827803e-06, 0.004312354312354306,
+      0.006788133741258726, 0.0011946744023949925, -0.0018451447449609193, -0.00042861335430994987,
+      0.00011926484570640964, -1.4799925306889465e-05, 1.3615931282319757e-06, -0.00028877372627372636,
+      7.161955691367287e-06, -0.0006218964858670726, -0.0008974771358672255, 4.6233758501560324e-05,
+      2.3921511924607546e-05, -1.957214612012646e-06, -0.003951981433599066, -0.006729759211376839,
+      -0.0021327829377364937, 0.0008917053663570649, 0.0002197057972986768, -2.7004729017112896e-05,
+      -0.0016934046345811, -0.0011305000469087098, 0.0010385589642555556, 0.0004312251216275966,
+      -4.442925495557076e-05, 0.0017238952997466917, 0.002561215873909373, 0.0006278551170192092,
+      -0.00020946545714347297, 0.0010820758189179216, 0.0006624953993375021, -0.00041958041958042213,
+      -0.0003702180172768422, -0.0003702180172768491, 0.00026041666666666655, 0.0004355019980019985,
+      0.000103802447552447, -0.00031322843822843827, -0.0002965784215784211, 8.655560126148372e-05,
+      0.00015340052104757958, -1.856051585153753e-05, -2.364041402354114e-05, 6.64486442350194e-06,
+      -4.872900577231838e-07, -0.0006061646686646673, -0.0003707230269730272, 0.0005962787212787212,
+      4.032425907425973e-05, -0.00031806428865252333, 9.185820307143743e-05, 5.081240568856694e-05,
+      -3.223000876832143e-05, 5.9951443465368335e-06, -3.721124077152856e-07, 3.902347652347238e-06,
+      -0.0012435481185481163, -0.0022438499000998974, -0.0006261355066502109, 0.0004960700043420634,
+      3.946646748504373e-06, -9.44678225541234e-05, 2.5471980290091564e-05, -1.9196275001225233e-06,
+      0.0012213480963480946, 0.00048107274669774485, -0.0009944253050870682, -5.1865516019926725e-05,
+      0.00014519901323306833, -4.8619868908181304e-05, 7.959070942816901e-06, -5.064863327256116e-07,
+      -0.0023179945054944964, -0.00046662895927601313, 0.00336859831345125, 0.0014446080235553918,
+      -0.00010425429833324385, -2.923740346341007e-05, 2.3921511924612367e-06, 0.00029021223874164937,
+      0.0016936902966314693, 0.0015218098035435464, 6.102643486544407e-05, -5.3666878357280855e-05,
+      3.6384324310016345e-06, 0.003384952465834814, 0.002000656722018944, -0.001965651092973068,
+      -0.0005270529264337326, 5.430242272347219e-05, -0.0018796562914209908, -0.002627519539284237,
+      -0.0006913021618903957, 5.656108597284859e-05, -0.0013225371120107938, -0.0008097165991902816,
+      0.0005128205128205097, 0.0009049773755656089, 0.0009049773755656061, -0.0010416666666666638,
+      -0.0029017857142857087, -0.0014048451548451548, 0.0016207750582750559, 0.0007639419404125296,
+      -0.0006252785204991082, -8.862181849798287e-05, 0.00011144766611098006, -2.2267679001423987e-05,
+      1.3821318000884826e-06, 0.005511849261849256, 0.011658046814296797, 0.006424182435211848,
+      -0.0004046760021024716, -0.0004761384985843233, 0.0001750788878304337, -2.9562263501888545e-05,
+      1.8812349501180315e-06, -0.011857627666451159, -0.01911136249371539, -0.007499329016356862,
+      -3.274589187902494e-05, 0.00019933411961276036, -1.3514177600867935e-05, 0.010683760683760665,
+      0.013461538461538426, 0.002567693744164339, -0.0002100840336134367, -0.003361344537815122,
+      -0.0033613445378151384, 0.3333333333333338, -0.1666666666666669, 0.49999999999999944,
+      -0.3333333333333338, 0.1666666666666669, -0.49999999999999944, 0.3333333333333324,
+      -0.16666666666666632, 0.49999999999999745, -0.3333333333333324, 0.16666666666666632,
+      -0.49999999999999745, -0.6666666666666675, -0.16666666666666663, 0.49999999999999967,
+      0.6666666666666675, 0.16666666666666663, -0.49999999999999967, 0.40824829046386263,
+      -0.20412414523193156, 0.6123724356957938, 0.40824829046386263, -0.20412414523193156,
+      0.6123724356957938, -0.40824829046386263, 0.20412414523193156, -0.6123724356957938,
+      -0.40824829046386263, 0.20412414523193156, -0.6123724356957938, 0.6123724356957948,
+      0.6123724356957938, 0.6123724356957948, 0.6123724356957938, 0.632455532033676,
+      -0.1581138830084195, 0.7905694150420947, -0.632455532033676, 0.1581138830084195,
+      -0.7905694150420947, -0.316227766016838, 0.21081851067789215, 0.3162277660168379,
+      -0.4743416490252581, 0.2635231383473651, 0.316227766016838, -0.21081851067789215,
+      -0.3162277660168379, 0.4743416490252581, -0.2635231383473651, -0.5270462766947298,
+      -0.7905694150420953, -0.2635231383473649, 0.5270462766947298, 0.7905694150420953,
+      0.2635231383473649, -0.07795119555779052, 0.06681531047810611, -0.011135885079684455,
+      -0.07795119555778966, -0.06681531047810635, 0.011135885079684344, 0.6681531047810608,
+      -0.11135885079684418, 0.9354143466934853, -0.07795119555779052, 0.06681531047810611,
+      -0.011135885079684455, -0.07795119555778966, -0.06681531047810635, 0.011135885079684344,
+      0.6681531047810608, -0.11135885079684418, 0.9354143466934853, -0.07795119555779013,
+      -0.22271770159368715, 0.20601387397416052, -0.07795119555779081, 0.30066889715147777,
+      -0.439867460647533, -0.2783971269921091, 0.3062368396913205, -0.11692679333668621,
+      -0.07795119555779013, -0.22271770159368715, 0.20601387397416052, -0.07795119555779081,
+      0.30066889715147777, -0.439867460647533, -0.2783971269921091, 0.3062368396913205,
+      -0.11692679333668621, -0.07795119555779025, 0.04454354031873721, 0.47327511588658405,
+      -0.0779511955577898, -0.06681531047810664, 0.8296234384364851, -0.11135885079684375,
+      0.47327511588658494, 0.11692679333668576, -0.07795119555779025, 0.04454354031873721,
+      0.47327511588658405, -0.0779511955577898, -0.06681531047810664, 0.8296234384364851,
+      -0.11135885079684375, 0.47327511588658494, 0.11692679333668576, -0.19887378220871685,
+      0.10606601717798257, -0.013258252147248007, -0.19887378220871554, -0.17677669529663723,
+      0.0220970869120795, 0.6599663291074452, -0.0824957911384319, 1.0606601717798203,
+      0.19887378220871685, -0.10606601717798257, 0.013258252147248007, 0.19887378220871554,
+      0.17677669529663723, -0.0220970869120795, -0.6599663291074452, 0.0824957911384319,
+      -1.0606601717798203, -0.13258252147247734, -0.14731391274719752, 0.1974006430812445,
+      0.26516504294495574, -0.4242640687119289, 0.1325825214724783, -0.3240906080438344,
+      0.3388219993185548, 0.20623947784607669, -0.16499158227686192, 0.05303300858899142,
+      0.13258252147247734, 0.14731391274719752, -0.1974006430812445, -0.26516504294495574,
+      0.4242640687119289, -0.1325825214724783, 0.3240906080438344, -0.3388219993185548,
+      -0.20623947784607669, 0.16499158227686192, -0.05303300858899142, 0.13258252147247726,
+      -0.08838834764831828, -0.43310290347675984, 0.19887378220871615, 0.05303300858899162,
+      -0.8352698852766085, 0.06629126073623802, 0.2651650429449555, -0.5966213466261497,
+      0.12374368670764602, -0.2474873734152917, -0.053033008588990745, -0.13258252147247726,
+      0.08838834764831828, 0.43310290347675984, -0.19887378220871615, -0.05303300858899162,
+      0.8352698852766085, -0.06629126073623802, -0.2651650429449555, 0.5966213466261497,
+      -0.12374368670764602, 0.2474873734152917, 0.053033008588990745, 0.00488584974981594,
+      0.029315098498896543, -0.03908679799852857, 0.013325044772225712, -0.0013325044772226435,
+      0.004885849749816239, 0.029315098498896, 0.01563471919941173, -0.007995026863335475,
+      0.0007995026863335412, -0.2736075859897007, 0.10660035817780561, -0.010660035817780869,
+      -0.32832910318763864, -0.29848100289785484, 0.029848100289785334, 0.6396021490668314,
+      -0.06396021490668488, 1.1726039399558583, 0.00488584974981594, 0.029315098498896543,
+      -0.03908679799852857, 0.013325044772225712, -0.0013325044772226435, 0.004885849749816239,
+      0.029315098498896, 0.01563471919941173, -0.007995026863335475, 0.0007995026863335412,
+      -0.2736075859897007, 0.10660035817780561, -0.010660035817780869, -0.32832910318763864,
+      -0.29848100289785484, 0.029848100289785334, 0.6396021490668314, -0.06396021490668488,
+      1.1726039399558583, 0.004885849749816166, -0.01954339899926441, -0.1563471919941139,
+      -0.09061030445113438, 0.1878831312883815, 0.0048858497498157774, -0.04397264774834425,
+      0.08599095559676244, 0.21986323874172325, -0.41334288883443987, -0.024429248749081034,
+      0.07817359599705778, -0.3397886416917545, 0.36377372228176147, -0.16416455159382057,
+      0.27982594021673923, -0.20582752491497966, -0.13591545667670177, 0.08394778206502236,
+      -0.02442924874908077, 0.004885849749816166, -0.01954339899926441, -0.1563471919941139,
+      -0.09061030445113438, 0.1878831312883815, 0.0048858497498157774, -0.04397264774834425,
+      0.08599095559676244, 0.21986323874172325, -0.41334288883443987, -0.024429248749081034,
+      0.07817359599705778, -0.3397886416917545, 0.36377372228176147, -0.16416455159382057,
+      0.27982594021673923, -0.20582752491497966, -0.13591545667670177, 0.08394778206502236,
+      -0.02442924874908077, 0.004885849749816189, -0.01954339899926424, -0.15634719199411384,
+      0.12259041190447567, 0.4010838476439921, 0.0048858497498162, 0.029315098498896044,
+      -0.3126943839882284, -0.00799502686333587, 0.8274852803552125, 0.04885849749816002,
+      -0.15634719199411357, -0.3331261193056413, 0.6782447789062863, -0.29848100289785484,
+      0.35133701382768373, -0.09594032236002445, 0.12392291638169832, 0.024429248749080167,
+      0.004885849749816189, -0.01954339899926424, -0.15634719199411384, 0.12259041190447567,
+      0.4010838476439921, 0.0048858497498162, 0.029315098498896044, -0.3126943839882284,
+      -0.00799502686333587, 0.8274852803552125, 0.04885849749816002, -0.15634719199411357,
+      -0.3331261193056413, 0.6782447789062863, -0.29848100289785484, 0.35133701382768373,
+      -0.09594032236002445, 0.12392291638169832, 0.024429248749080167, 0.011381739985697763,
+      0.09105391988558588, -0.0796721798998874, 0.021012443050519806, -0.0017510369208767734,
+      0.011381739985698714, 0.09105391988558485, 0.05690869992849122, -0.02101244305051977,
+      0.001751036920876619, -0.3186887195995497, 0.0980580675690926, -0.008171505630757959,
+      -0.45526959942792483, -0.42024886101039466, 0.03502073841753268, 0.6163649961485781,
+      -0.051363749679050386, 1.274754878398197, -0.011381739985697763, -0.09105391988558588,
+      0.0796721798998874, -0.021012443050519806, 0.0017510369208767734, -0.011381739985698714,
+      -0.09105391988558485, -0.05690869992849122, 0.02101244305051977, -0.001751036920876619,
+      0.3186887195995497, -0.0980580675690926, 0.008171505630757959, 0.45526959942792483,
+      0.42024886101039466, -0.03502073841753268, -0.6163649961485781, 0.051363749679050386,
+      -1.274754878398197, 0.007587826657132204, -0.045526959942792794, -0.1593443597997742,
+      -0.04902903378454611, 0.17860576592941774, -0.06373774391990948, 0.15934435979977402,
+      0.1723020330142618, -0.4036140102620662, -0.007587826657131609, 0.045526959942792065,
+      -0.3344480518874389, 0.3826015672115471, 0.06373774391991067, -0.1593443597997752,
+      0.33258027917183713, -0.24105941610735213, 0.1593443597997749, -0.20487131974256756,
+      0.1138173998569822, 0.08346609322845354, -0.04173304661422715, 0.011381739985698372,
+      -0.007587826657132204, 0.045526959942792794, 0.1593443597997742, 0.04902903378454611,
+      -0.17860576592941774, 0.06373774391990948, -0.15934435979977402, -0.1723020330142618,
+      0.4036140102620662, 0.007587826657131609, -0.045526959942792065, 0.3344480518874389,
+      -0.3826015672115471, -0.06373774391991067, 0.1593443597997752, -0.33258027917183713,
+      0.24105941610735213, -0.1593443597997749, 0.20487131974256756, -0.1138173998569822,
+      -0.08346609322845354, 0.04173304661422715, -0.011381739985698372, -0.0075878266571322685,
+      0.04552695994279251, 0.15934435979977427, -0.14708710135363806, -0.3747219010676015,
+      -0.011381739985698391, -0.027316175965675465, 0.3983608994994353, -0.04622737471114304,
+      -0.8133566497472001, -0.003793913328566269, -0.1365808798283774, 0.2845434996424539,
+      0.3467053103335755, -0.7345599883077516, -0.0637377439199092, 0.4232839916732472,
+      -0.43717555124553514, -0.04552695994279303, 0.24164309508097678, -0.19086302437555402,
+      0.06420468709880998, -0.06099445274386996, -0.011381739985697942, 0.0075878266571322685,
+      -0.04552695994279251, -0.15934435979977427, 0.14708710135363806, 0.3747219010676015,
+      0.011381739985698391, 0.027316175965675465, -0.3983608994994353, 0.04622737471114304,
+      0.8133566497472001, 0.003793913328566269, 0.1365808798283774, -0.2845434996424539,
+      -0.3467053103335755, 0.7345599883077516, 0.0637377439199092, -0.4232839916732472,
+      0.43717555124553514, 0.04552695994279303, -0.24164309508097678, 0.19086302437555402,
+      -0.06420468709880998, 0.06099445274386996, 0.011381739985697942, -0.0009169462458234705,
+      -0.005501677474940141, -0.011207120782285892, 0.025470729050649576, -0.013754193687350754,
+      0.0028527216536727556, -0.0002037658324052251, -0.0009169462458233333, -0.0055016774749404,
+      -0.014059842435958234, -0.0030564874860781518, 0.005108700512444619, -0.0012225949944311674,
+      8.73282138879188e-05, 0.014263608268363032, 0.14263608268363742, -0.0943144709989766,
+      0.020376583240519722, -0.0014554702314658542, 0.017116329922036946, 0.17116329922036344,
+      0.11736911946539343, -0.034232659844072914, 0.002445189988862202, -0.345819726996247,
+      0.0880268395990454, -0.006287631399932264, -0.5763662116604085, -0.5379417975497164,
+      0.03842441411069443, 0.5933661039639312, -0.04238329314028286, 1.3693063937629153,
+      -0.0009169462458234705, -0.005501677474940141, -0.011207120782285892, 0.025470729050649576,
+      -0.013754193687350754, 0.0028527216536727556, -0.0002037658324052251, -0.0009169462458233333,
+      -0.0055016774749404, -0.014059842435958234, -0.0030564874860781518, 0.005108700512444619,
+      -0.0012225949944311674, 8.73282138879188e-05, 0.014263608268363032, 0.14263608268363742,
+      -0.0943144709989766, 0.020376583240519722, -0.0014554702314658542, 0.017116329922036946,
+      0.17116329922036344, 0.11736911946539343, -0.034232659844072914, 0.002445189988862202,
+      -0.345819726996247, 0.0880268395990454, -0.006287631399932264, -0.5763662116604085,
+      -0.5379417975497164, 0.03842441411069443, 0.5933661039639312, -0.04238329314028286,
+      1.3693063937629153, -0.0009169462458233997, 0.0036677849832934747, 0.00152824374303902,
+      -0.06724272469371463, -0.15129613056085756, -0.018746456581278187, 0.16999164568403444,
+      -0.0009169462458234335, 0.008252516212410512, -0.0217010611511535, -0.05654501849244158,
+      0.21338649063518353, 0.12684423067223452, -0.3941777254366939, 0.004584731229116698,
+      -0.023942485307610086, 0.10442998910766246, -0.08449004693658248, -0.3153276256470407,
+      0.39650647780703907, -0.0007131804134188533, -0.0071318041341810945, -0.12256514819172577,
+      0.3665747324969472, -0.2714670302218226, -0.1008640870405726, 0.19452359643538925,
+      -0.26591441128878085, 0.14245414890470467, -0.13208392350551101, 0.13560616146565838,
+      -0.060118197910690736, -0.049005682693449626, 0.020529407614823976, -0.005348853100636499,
+      -0.0009169462458233997, 0.0036677849832934747, 0.00152824374303902, -0.06724272469371463,
+      -0.15129613056085756, -0.018746456581278187, 0.16999164568403444, -0.0009169462458234335,
+      0.008252516212410512, -0.0217010611511535, -0.05654501849244158, 0.21338649063518353,
+      0.12684423067223452, -0.3941777254366939, 0.004584731229116698, -0.023942485307610086,
+      0.10442998910766246, -0.08449004693658248, -0.3153276256470407, 0.39650647780703907,
+      -0.0007131804134188533, -0.0071318041341810945, -0.12256514819172577, 0.3665747324969472,
+      -0.2714670302218226, -0.1008640870405726, 0.19452359643538925, -0.26591441128878085,
+      0.14245414890470467, -0.13208392350551101, 0.13560616146565838, -0.060118197910690736,
+      -0.049005682693449626, 0.020529407614823976, -0.005348853100636499, -0.0009169462458234299,
+      0.0036677849832935697, 0.001528243743039176, -0.06724272469371446, -0.1512961305608575,
+      0.16382772925377734, 0.35256583151909016, -0.000916946245823413, -0.005501677474940164,
+      0.030870523609387465, -0.0030564874860778894, -0.45310243775758124, 0.09964149204614044,
+      0.7961931580698298, -0.009169462458233656, 0.0015282437430392951, 0.19867168659506523,
+      -0.41852046505795687, -0.3270441610103393, 0.7738371353145165, -0.027814036123308877,
+      0.17116329922036358, -0.06082410097295049, -0.5049317327000741, 0.5090579908062808,
+      0.03667784983293442, 0.11592820393624216, -0.3704462833126457, 0.2540596062534922,
+      0.06003814704795976, -0.1681068117342865, 0.09966332409961277, -0.039734337319013255,
+      0.029800752989260007, 0.005348853100636123, -0.0009169462458234299, 0.0036677849832935697,
+      0.001528243743039176, -0.06724272469371446, -0.1512961305608575, 0.16382772925377734,
+      0.35256583151909016, -0.000916946245823413, -0.005501677474940164, 0.030870523609387465,
+      -0.0030564874860778894, -0.45310243775758124, 0.09964149204614044, 0.7961931580698298,
+      -0.009169462458233656, 0.0015282437430392951, 0.19867168659506523, -0.41852046505795687,
+      -0.3270441610103393, 0.7738371353145165, -0.027814036123308877, 0.17116329922036358,
+      -0.06082410097295049, -0.5049317327000741, 0.5090579908062808, 0.03667784983293442,
+      0.11592820393624216, -0.3704462833126457, 0.2540596062534922, 0.06003814704795976,
+      -0.1681068117342865, 0.09966332409961277, -0.039734337319013255, 0.029800752989260007,
+      0.005348853100636123, -0.0018980963199369115, -0.015184770559492633, -0.04365621535854255,
+      0.060739082237971934, -0.02562430031914437, 0.004466108988086147, -0.00027913181175545437,
+      -0.0018980963199366487, -0.015184770559493216, -0.050163974169753066, -0.017354023496563682,
+      0.01613381871946119, -0.0031900778486328107, 0.00019937986553953223, 0.015184770559492022,
+      0.18221724671391637, -0.0974356110900803, 0.017864435952344954, -0.0011165272470219684,
+      0.021692529370704504, 0.2603103524484495, 0.18980963199366274, -0.04593712102031506,
+      0.0028710700637697762, -0.36190369833458336, 0.07860351819031801, -0.004912719886895759,
+      -0.6909070604569287, -0.6502654686653455, 0.04064159179158493, 0.5716619504750302,
+      -0.035728871904691394, 1.4577379737113252, 0.0018980963199369115, 0.015184770559492633,
+      0.04365621535854255, -0.060739082237971934, 0.02562430031914437, -0.004466108988086147,
+      0.00027913181175545437, 0.0018980963199366487, 0.015184770559493216, 0.050163974169753066,
+      0.017354023496563682, -0.01613381871946119, 0.0031900778486328107, -0.00019937986553953223,
+      -0.015184770559492022, -0.18221724671391637, 0.0974356110900803, -0.017864435952344954,
+      0.0011165272470219684, -0.021692529370704504, -0.2603103524484495, -0.18980963199366274,
+      0.04593712102031506, -0.0028710700637697762, 0.36190369833458336, -0.07860351819031801,
+      0.004912719886895759, 0.6909070604569287, 0.6502654686653455, -0.04064159179158493,
+      -0.5716619504750302, 0.035728871904691394, -1.4577379737113252, -0.0012653975466244605,
+      0.007592385279746466, -0.011388577919619707, -0.08098544298396261, -0.1385610313553732,
+      0.003349581741064445, 0.16215697384242844, 0.010629339391645174, -0.045554311678478863,
+      -0.0312372422938138, 0.24865061791169676, 0.08558978867882293, -0.3848669420483261,
+      0.0012653975466244978, -0.007592385279746606, -0.013557830856689834, 0.1395552722848636,
+      -0.1641853316745173, -0.28790452583912646, 0.4064823778710211, -0.010629339391644744,
+      0.045554311678478274, -0.08807166924505855, -0.06421892549118947, 0.38475528932362285,
+      -0.2976103376935932, 0.02494640877631057, -0.0585698293009023, 0.20404535439318722,
+      -0.31725324204655003, 0.16960846401719465, 0.11930891153887371, -0.18443169242050889,
+      0.18773608139205147, -0.07921760817617937, 0.09870100863670445, -0.08418615442542479,
+      0.030965022317397894, 0.027913181175538402, -0.01004874522319434, 0.0025307950932488207,
+      0.0012653975466244605, -0.007592385279746466, 0.011388577919619707, 0.08098544298396261,
+      0.1385610313553732, -0.003349581741064445, -0.16215697384242844, -0.010629339391645174,
+      0.045554311678478863, 0.0312372422938138, -0.24865061791169676, -0.08558978867882293,
+      0.3848669420483261, -0.0012653975466244978, 0.007592385279746606, 0.013557830856689834,
+      -0.1395552722848636, 0.1641853316745173, 0.28790452583912646, -0.4064823778710211,
+      0.010629339391644744, -0.045554311678478274, 0.08807166924505855, 0.06421892549118947,
+      -0.38475528932362285, 0.2976103376935932, -0.02494640877631057, 0.0585698293009023,
+      -0.20404535439318722, 0.31725324204655003, -0.16960846401719465, -0.11930891153887371,
+      0.18443169242050889, -0.18773608139205147, 0.07921760817617937, -0.09870100863670445,
+      0.08418615442542479, -0.030965022317397894, -0.027913181175538402, 0.01004874522319434,
+      -0.0025307950932488207, 0.0012653975466244268, -0.0075923852797466496, 0.011388577919619506,
+      0.0809854429839623, 0.1385610313553729, -0.17484816688357346, -0.3336555589849377,
+      0.001898096319936677, 0.004555431167847758, -0.04745240799841542, 0.04859126579037743,
+      0.4816419411839161, -0.14805151295505578, -0.7777449670940314, 0.0006326987733122931,
+      0.022777155839239303, -0.03389457714172534, -0.21981763095646925, 0.539533878941984,
+      0.28822353362399017, -0.8010351937872581, 0.010629339391645036, 0.07592385279746454,
+      -0.29154759474226455, 0.16165453658126822, 0.5513411545792372, -0.569484722343338,
+      0.05097744402115443, -0.10412414097937978, -0.1376119831954055, 0.47860737963040517,
+      -0.3133055207088659, -0.15833286802137983, 0.27265595372266044, -0.13970547178357107,
+      -0.0555193173581462, 0.10740992116347221, -0.050922946857907554, 0.023447072187452112,
+      -0.01451485421127944, -0.0025307950932484443, -0.0012653975466244268, 0.0075923852797466496,
+      -0.011388577919619506, -0.0809854429839623, -0.1385610313553729, 0.17484816688357346,
+      0.3336555589849377, -0.001898096319936677, -0.004555431167847758, 0.04745240799841542,
+      -0.04859126579037743, -0.4816419411839161, 0.14805151295505578, 0.7777449670940314,
+      -0.0006326987733122931, -0.022777155839239303, 0.03389457714172534, 0.21981763095646925,
+      -0.539533878941984, -0.28822353362399017, 0.8010351937872581, -0.010629339391645036,
+      -0.07592385279746454, 0.29154759474226455, -0.16165453658126822, -0.5513411545792372,
+      0.569484722343338, -0.05097744402115443, 0.10412414097937978, 0.1376119831954055,
+      -0.47860737963040517, 0.3133055207088659, 0.15833286802137983, -0.27265595372266044,
+      0.13970547178357107, 0.0555193173581462, -0.10740992116347221, 0.050922946857907554,
+      -0.023447072187452112, 0.01451485421127944, 0.0025307950932484443, 0.0002675526911010356,
+      0.001605316146606555, 0.004280843057617275, 0.002675526911010942, -0.01645449050271676,
+      0.013110081863953174, -0.0042808430576173895, 0.0006336774262920833, -3.520430146073656e-05,
+      0.0002675526911011124, 0.001605316146606546, 0.004708927363379037, 0.006956369968627999,
+      -0.0009058569684419798, -0.002943079602112189, 0.0013250228511674162, -0.00021122580876406125,
+      1.1734767153551459e-05, -0.0021404215288088825, -0.021404215288086222, -0.0777431676713726,
+      0.08026580733032569, -0.028029329543923388, 0.0042245161752804804, -0.0002346953430713126,
+      -0.0025685058345710633, -0.02568505834570385, -0.1033823598414584, -0.04494885210498257,
+      0.029965901403321737, -0.005069419410336369, 0.0002816344116853626, 0.015135837953717927,
+      0.21190173135205925, -0.09540164528404434, 0.01520825823100934, -0.000844903235056278,
+      0.025226396589530384, 0.3531695522534305, 0.26908156362166186, -0.05576361351369973,
+      0.00309797852853866, -0.3710063983268371, 0.07029594915666501, -0.0039053305087041264,
+      -0.799090704088569, -0.7570332986102247, 0.04205740547834688, 0.5515528318445927,
+      -0.03064182399136793, 1.5411035007422431, 0.0002675526911010356, 0.001605316146606555,
+      0.004280843057617275, 0.002675526911010942, -0.01645449050271676, 0.013110081863953174,
+      -0.0042808430576173895, 0.0006336774262920833, -3.520430146073656e-05, 0.0002675526911011124,
+      0.001605316146606546, 0.004708927363379037, 0.006956369968627999, -0.0009058569684419798,
+      -0.002943079602112189, 0.0013250228511674162, -0.00021122580876406125, 1.1734767153551459e-05,
+      -0.0021404215288088825, -0.021404215288086222, -0.0777431676713726, 0.08026580733032569,
+      -0.028029329543923388, 0.0042245161752804804, -0.0002346953430713126, -0.0025685058345710633,
+      -0.02568505834570385, -0.1033823598414584, -0.04494885210498257, 0.029965901403321737,
+      -0.005069419410336369, 0.0002816344116853626, 0.015135837953717927, 0.21190173135205925,
+      -0.09540164528404434, 0.01520825823100934, -0.000844903235056278, 0.025226396589530384,
+      0.3531695522534305, 0.26908156362166186, -0.05576361351369973, 0.00309797852853866,
+      -0.3710063983268371, 0.07029594915666501, -0.0039053305087041264, -0.799090704088569,
+      -0.7570332986102247, 0.04205740547834688, 0.5515528318445927, -0.03064182399136793,
+      1.5411035007422431, 0.0002675526911011004, -0.0010702107644043222, 0.001070210764404266,
+      0.007491475350830344, -0.026353940073456778, -0.08722217729895343, -0.1246795540531052,
+      0.019573591612131826, 0.15508902965483082, 0.0002675526911010808, -0.0024079742199097083,
+      0.006635306739307063, 0.0013377634555055103, -0.06050895218316082, 0.0020735333560335024,
+      0.26849549582210663, 0.04926841989420632, -0.3757167338622738, -0.0013377634555054119,
+      0.007491475350830211, -0.02541750565460295, 0.01620604871812285, 0.1494950661527302,
+      -0.23328046543146858, -0.25609369097563617, 0.4133454382168684, 0.0019263793759278726,
+      -0.00802658073303255, 0.06790487300145483, -0.16200315446170566, 0.005886159204223378,
+      0.3902396816915151, -0.3199789368363126, 0.01123721302624525, -0.039215580152815684,
+      0.00923056784298691, 0.19011529793382773, -0.35834458456814855, 0.1950881569744437,
+      -0.056759392326444856, 0.11404433458183762, -0.22283316987418908, 0.23757622840732445,
+      -0.098670616133964, -0.11738874322060164, 0.1507213493202781, -0.12242295832947664,
+      0.04250097967675124, -0.06867185738261258, 0.05006051667707192, -0.015712853218612592,
+      -0.015560301245616597, 0.004907479623618121, -0.0012039871099555966, 0.0002675526911011004,
+      -0.0010702107644043222, 0.001070210764404266, 0.007491475350830344, -0.026353940073456778,
+      -0.08722217729895343, -0.1246795540531052, 0.019573591612131826, 0.15508902965483082,
+      0.0002675526911010808, -0.0024079742199097083, 0.006635306739307063, 0.0013377634555055103,
+      -0.06050895218316082, 0.0020735333560335024, 0.26849549582210663, 0.04926841989420632,
+      -0.3757167338622738, -0.0013377634555054119, 0.007491475350830211, -0.02541750565460295,
+      0.01620604871812285, 0.1494950661527302, -0.23328046543146858, -0.25609369097563617,
+      0.4133454382168684, 0.0019263793759278726, -0.00802658073303255, 0.06790487300145483,
+      -0.16200315446170566, 0.005886159204223378, 0.3902396816915151, -0.3199789368363126,
+      0.01123721302624525, -0.039215580152815684, 0.00923056784298691, 0.19011529793382773,
+      -0.35834458456814855, 0.1950881569744437, -0.056759392326444856, 0.11404433458183762,
+      -0.22283316987418908, 0.23757622840732445, -0.098670616133964, -0.11738874322060164,
+      0.1507213493202781, -0.12242295832947664, 0.04250097967675124, -0.06867185738261258,
+      0.05006051667707192, -0.015712853218612592, -0.015560301245616597, 0.004907479623618121,
+      -0.0012039871099555966, 0.00026755269110114317, -0.0010702107644042034, 0.0010702107644042992,
+      0.007491475350830602, -0.026353940073456608, -0.08722217729895333, -0.12467955405310485,
+      0.18179501274289456, 0.3173104507855935, 0.0002675526911010735, 0.0016053161466065165,
+      -0.007491475350830771, 0.006956369968628168, 0.05131278397188639, -0.09725540321524408,
+      -0.49058971064468176, 0.19008210530673572, 0.7589883108180061, 0.002675526911010873,
+      0.0010702107644039412, -0.03631072236371818, 0.08540664118076753, 0.20267116350907077,
+      -0.6391961196448263, -0.23944457097770158, 0.8194270555656837, 0.009631896879638729,
+      -0.025685058345703792, -0.08307511058688631, 0.39517532475629996, -0.2830707471849461,
+      -0.5701829481775778, 0.620292750876695, 0.010090558635812328, -0.13811452132768054,
+      0.2159150217185739, 0.11443610816523543, -0.5651497389058859, 0.3683989330653161,
+      -0.04729949360536951, 0.007357699005279381, 0.23124196873736594, -0.3729191653728651,
+      0.18037979982417598, -0.026086387382356507, 0.15072134932027736, -0.18187246220610842,
+      0.074353831638364, 0.043700272879844446, -0.06505754909931605, 0.025687405299135244,
+      -0.013405797996223138, 0.007061982873010168, 0.0012039871099547687, 0.00026755269110114317,
+      -0.0010702107644042034, 0.0010702107644042992, 0.007491475350830602, -0.026353940073456608,
+      -0.08722217729895333, -0.12467955405310485, 0.18179501274289456, 0.3173104507855935,
+      0.0002675526911010735, 0.0016053161466065165, -0.007491475350830771, 0.006956369968628168,
+      0.05131278397188639, -0.09725540321524408, -0.49058971064468176, 0.19008210530673572,
+      0.7589883108180061, 0.002675526911010873, 0.0010702107644039412, -0.03631072236371818,
+      0.08540664118076753, 0.20267116350907077, -0.6391961196448263, -0.23944457097770158,
+      0.8194270555656837, 0.009631896879638729, -0.025685058345703792, -0.08307511058688631,
+      0.39517532475629996, -0.2830707471849461, -0.5701829481775778, 0.620292750876695,
+      0.010090558635812328, -0.13811452132768054, 0.2159150217185739, 0.11443610816523543,
+      -0.5651497389058859, 0.3683989330653161, -0.04729949360536951, 0.007357699005279381,
+      0.23124196873736594, -0.3729191653728651, 0.18037979982417598, -0.026086387382356507,
+      0.15072134932027736, -0.18187246220610842, 0.074353831638364, 0.043700272879844446,
+      -0.06505754909931605, 0.025687405299135244, -0.013405797996223138, 0.007061982873010168,
+      0.0012039871099547687, 0.26581163020813514, -0.2126493041665081, 0.05316232604162732,
+      0.0004931570133728202, 0.003945256106985656, 0.014153606283809433, 0.017950915286783345,
+      -0.04487728821695781, 0.027616792748897157, -0.007594618005946905, 0.0009863140267467338,
+      -4.931570133773062e-05, -0.5311301034028961, 0.003945256106985726, 0.015041288907880737,
+      0.02860310677564417, 0.0015342662638268543, -0.010959044741625174, 0.003945256106984943,
+      -0.000547952237081316, 2.7397611854280385e-05, -0.0020712594561680627, -0.024855113474006495,
+      -0.10829362712183307, 0.09001028747788724, -0.02692637293017481, 0.003579954615598077,
+      -0.0001789977307802785, -0.0029589420802376824, -0.03550730496286756, -0.16800215588912362,
+      -0.08416546361568676, 0.04438413120358495, -0.006575426844975737, 0.0003287713422490701,
+      0.014626671715155137, 0.23402674744250634, -0.09113541607136116, 0.012858612496841617,
+      -0.0006429306248425591, 0.027923646001662455, 0.4467783360266015, 0.35183793962094806,
+      -0.06382547657522887, 0.003191273828761404, -0.37558838138500045, 0.06312409771176454,
+      -0.0031562048855885315, -0.9014121153240002, -0.8584877288799987, 0.04292438644399857,
+      0.5330479362326809, -0.026652396811632156, 1.6201851746019689, -0.26581163020813514,
+      0.2126493041665081, -0.05316232604162732, -0.0004931570133728202, -0.003945256106985656,
+      -0.014153606283809433, -0.017950915286783345, 0.04487728821695781, -0.027616792748897157,
+      0.007594618005946905, -0.0009863140267467338, 4.931570133773062e-05, 0.5311301034028961,
+      -0.003945256106985726, -0.015041288907880737, -0.02860310677564417, -0.0015342662638268543,
+      0.010959044741625174, -0.003945256106984943, 0.000547952237081316, -2.7397611854280385e-05,
+      0.0020712594561680627, 0.024855113474006495, 0.10829362712183307, -0.09001028747788724,
+      0.02692637293017481, -0.003579954615598077, 0.0001789977307802785, 0.0029589420802376824,
+      0.03550730496286756, 0.16800215588912362, 0.08416546361568676, -0.04438413120358495,
+      0.006575426844975737, -0.0003287713422490701, -0.014626671715155137, -0.23402674744250634,
+      0.09113541607136116, -0.012858612496841617, 0.0006429306248425591, -0.027923646001662455,
+      -0.4467783360266015, -0.35183793962094806, 0.06382547657522887, -0.003191273828761404,
+      0.37558838138500045, -0.06312409771176454, 0.0031562048855885315, 0.9014121153240002,
+      0.8584877288799987, -0.04292438644399857, -0.5330479362326809, 0.026652396811632156,
+      -1.6201851746019689, 0.2658116302081349, 0.10632465208325402, -0.1591582067826321,
+      -0.001972628053492896, 0.004832938731057151, 0.0023013993957412236, -0.039584069606752655,
+      -0.08791345691732265, -0.11138773075388511, 0.03158396694536553, 0.1487251961886042,
+      0.3189739562497615, 0.3189739562497618, -0.002761679274889486, 0.012772766646364522,
+      -0.01597828723329026, -0.06288573848863464, 0.03592374866304956, 0.27682382631675717,
+      0.0178632429288502, -0.36680032340669166, -0.00032877134224850986, 0.0019726280534930335,
+      0.004191834613672223, -0.03558949779843024, 0.05315593326552808, 0.1387049762798438,
+      -0.2896228946705021, -0.2225690661651362, 0.4177569590433199, 0.0027616792748899285,
+      -0.01277276664636393, 0.015074166042107427, 0.062112212580621176, -0.2190420802657884,
+      0.07995061500805703, 0.385931893113639, -0.3390242592075494, -0.00902477334472811,
+      0.033288098402689724, -0.09642863468156376, 0.08949155936011646, 0.15711982446069073,
+      -0.38947897059501074, 0.21878088969944853, 0.0009041211911850254, 0.0007735259080132812,
+      0.0810896250582053, -0.2449264306917815, 0.28351231397331883, -0.1181585938967534,
+      0.08285677102279168, -0.14028307872263868, 0.1985072048796778, -0.16217559710149335,
+      0.054930750561435586, 0.10202870654453786, -0.11184801063303229, 0.07567220394092795,
+      -0.022290697004466446, 0.04538359608402238, -0.028877082894181862, 0.007899279449765156,
+      0.008537095853728223, -0.0023945512760424276, 0.0005753498489368175, -0.2658116302081349,
+      -0.10632465208325402, 0.1591582067826321, 0.001972628053492896, -0.004832938731057151,
+      -0.0023013993957412236, 0.039584069606752655, 0.08791345691732265, 0.11138773075388511,
+      -0.03158396694536553, -0.1487251961886042, -0.3189739562497615, -0.3189739562497618,
+      0.002761679274889486, -0.012772766646364522, 0.01597828723329026, 0.06288573848863464,
+      -0.03592374866304956, -0.27682382631675717, -0.0178632429288502, 0.36680032340669166,
+      0.00032877134224850986, -0.0019726280534930335, -0.004191834613672223, 0.03558949779843024,
+      -0.05315593326552808, -0.1387049762798438, 0.2896228946705021, 0.2225690661651362,
+      -0.4177569590433199, -0.0027616792748899285, 0.01277276664636393, -0.015074166042107427,
+      -0.062112212580621176, 0.2190420802657884, -0.07995061500805703, -0.385931893113639,
+      0.3390242592075494, 0.00902477334472811, -0.033288098402689724, 0.09642863468156376,
+      -0.08949155936011646, -0.15711982446069073, 0.38947897059501074, -0.21878088969944853,
+      -0.0009041211911850254, -0.0007735259080132812, -0.0810896250582053, 0.2449264306917815,
+      -0.28351231397331883, 0.1181585938967534, -0.08285677102279168, 0.14028307872263868,
+      -0.1985072048796778, 0.16217559710149335, -0.054930750561435586, -0.10202870654453786,
+      0.11184801063303229, -0.07567220394092795, 0.022290697004466446, -0.04538359608402238,
+      0.028877082894181862, -0.007899279449765156, -0.008537095853728223, 0.0023945512760424276,
+      -0.0005753498489368175, -0.53162326041627, -0.21264930416650826, 0.31864518490751287,
+      0.001972628053492518, -0.004832938731057427, -0.0023013993957416608, 0.03958406960675289,
+      0.08791345691732247, 0.11138773075388483, -0.1858873169074572, -0.30302854615069624,
+      0.6379479124995231, 0.6374547554861508, -0.0011835768320957133, 0.01139192700892003,
+      -0.02386879944726129, -0.040964909244196705, 0.14139359525645612, 0.48605555238058884,
+      -0.2256905674090416, -0.7404752555798062, -0.00016438567112463828, -0.005917884160479037,
+      0.008137090720657297, 0.03435660526499668, -0.13731683061257155, -0.1574814729371633,
+      0.7155379492702336, 0.1865777367261806, -0.8312928593536573, -0.002761679274888965,
+      -0.02347427383656056, 0.06512960289948302, 0.0461814145412115, -0.46626351757721207,
+      0.4101093723211227, 0.5682155108085586, -0.6629564525999141, -0.015386498817244434,
+      -0.025151007682034043, 0.2103479047707631, -0.34790583436765465, -0.05503632269244611,
+      0.6308793286411724, -0.41924921563563916, -0.03435660526499518, 0.1333277383266213,
+      -0.06437342881230694, -0.2734062482140794, 0.46544158922159196, -0.2210274938714806,
+      0.025929099858685755, 0.06582002271820457, -0.2393455371571097, 0.2598608689134313,
+      -0.0996560733579768, 0.0375895234637768, -0.12151388809514703, 0.11397406531291004,
+      -0.03876214125113, -0.031299031782082695, 0.03800596716395753, -0.012854959481929952,
+      0.007495986603270815, -0.0034356605264993347, -0.0005753498489345478, 0.53162326041627,
+      0.21264930416650826, -0.31864518490751287, -0.001972628053492518, 0.004832938731057427,
+      0.0023013993957416608, -0.03958406960675289, -0.08791345691732247, -0.11138773075388483,
+      0.1858873169074572, 0.30302854615069624, -0.6379479124995231, -0.6374547554861508,
+      0.0011835768320957133, -0.01139192700892003, 0.02386879944726129, 0.040964909244196705,
+      -0.14139359525645612, -0.48605555238058884, 0.2256905674090416, 0.7404752555798062,
+      0.00016438567112463828, 0.005917884160479037, -0.008137090720657297, -0.03435660526499668,
+      0.13731683061257155, 0.1574814729371633, -0.7155379492702336, -0.1865777367261806,
+      0.8312928593536573, 0.002761679274888965, 0.02347427383656056, -0.06512960289948302,
+      -0.0461814145412115, 0.46626351757721207, -0.4101093723211227, -0.5682155108085586,
+      0.6629564525999141, 0.015386498817244434, 0.025151007682034043, -0.2103479047707631,
+      0.34790583436765465, 0.05503632269244611, -0.6308793286411724, 0.41924921563563916,
+      0.03435660526499518, -0.1333277383266213, 0.06437342881230694, 0.2734062482140794,
+      -0.46544158922159196, 0.2210274938714806, -0.025929099858685755, -0.06582002271820457,
+      0.2393455371571097, -0.2598608689134313, 0.0996560733579768, -0.0375895234637768,
+      0.12151388809514703, -0.11397406531291004, 0.03876214125113, 0.031299031782082695,
+      -0.03800596716395753, 0.012854959481929952, -0.007495986603270815, 0.0034356605264993347,
+      0.0005753498489345478, -0.0833333333333334, 0.06666666666666672, -0.01666666666666676,
+      0.16666666666666655, 0.05892556509887903, 0.02357022603955157, -0.03535533905932738,
+      0.07071067811865474, 0.07071067811865471, -0.06666666666666667, 0.02857142857142862,
+      -0.004761904761904861, 0.09999999999999985, 0.02357022603955157, 0.006734350297014724,
+      -0.016835875742536803, -0.02357022603955155, 0.010101525445522098, 0.03367175148507374,
+      -0.01683587574253683, -0.016835875742536824, 0.025, -0.014285714285714318,
+      -0.0023809523809523547, 0.003174603174603131, -0.00039682539682534657, -0.11011904761904746,
+      0.007936507936508031, -0.0009920634920636518, 0.08571428571428563, -0.017677669529663716,
+      -0.005050762722761065, 0.026516504294495518, 0.0019641855032959754, -0.01192541198429694,
+      -0.015152288168283155, -0.03724937508036277, 0.002525381361380525, 0.02462246827346014,
+      0.015783633508628266, -0.0014029896452114493, -0.01718662315383969, 0.0058925565098878726,
+      0.0058925565098878275, 0.04642857142857134, -0.007142857142857157, -0.007142857142857091,
+      0.0032467532467531906, -0.00032467532467529144, -0.12777777777777774, -0.00505050505050491,
+      0.0005050505050503398, 0.07936507936507921, -0.016414978848973416, -0.0016835875742536764,
+      0.023850823968593827, -0.0002550890264020681, -0.009374521720276204, 0.01641497884897339,
+      -0.0025253813613805216, -0.037880720420707954, 0.0011479006188093261, 0.0200882608291633,
+      0.004208968935634232, 0.02385082396859386, 0.0031886128300258687, -0.016453242202933774,
+      -0.009820927516479784, -0.0017856231848144507, 0.00803530433166526, -0.0022958012376186167,
+      -0.00229580123761858, -0.005208333333333352, -0.0017857142857142766, 0.0049107142857142795,
+      -0.0003607503607503581, -0.0013753607503607542, 0.000437062937062939, -3.642191142191218e-05,
+      0.06696428571428568, 0.010461760461760393, -0.00698953823953816, 0.0017482517482516659,
+      -0.0001456876456875908, -0.13852813852813836, -0.013986013986013785, 0.001165501165500959,
+      0.0757575757575758, 0.0036828478186799406, -0.0006313453403451253, -0.016941099965927683,
+      0.0017856231848145032, 0.02077381258761884, -0.0013907257497113026, -0.007752008345613012,
+      -0.0018940360210353859, 0.020203050891044207, 0.0009183204950474696, -0.037115453341501646,
+      0.0012671056830702919, 0.017203792607539823, -0.013679149040811175, -0.0058670476072476664,
+      0.02790036226272679, 0.004481227415736387, -0.015607033413426901, 0.002142747821777405,
+      -0.012387760844650653, -0.005456452385904272, 0.009074056280523709, 0.005691673901596237,
+      0.002008826082916334, -0.0036828478186798426, 0.0009443199535076507, 0.0009443199535076447,
+      -0.012499999999999987, -0.010064935064935058, 0.0069805194805194655, 0.0017482517482517556,
+      -0.0022352647352647296, 0.0005244755244755152, -3.746253746253361e-05, 0.0832070707070706,
+      0.027874902874902772, -0.004390054390054303, 0.0004079254079253473, -2.9137529137487928e-05,
+      -0.14590964590964547, -0.02051282051282029, 0.0014652014652012672, 0.07342657342657355,
+      0.004419417382415923, -0.0023723279455392828, -0.015943064150129565, 0.004189346702834042,
+      0.017976418024046106, -0.00197792106625607, -0.006613673565293765, -0.00441941738241591,
+      -0.0035584919183089202, 0.023761542809353147, 0.0006181003332050323, -0.0356599742235498,
+      0.0017615859496343054, 0.015139043161143062, 0.00593081986384819, -0.015943064150129582,
+      -0.010645061294086502, 0.030500308108747955, 0.004481227415736403, -0.01479025797312023,
+      0.008124585490906017, 0.009855266423880073, -0.015112553146862835, -0.0072111705540585285,
+      0.009632063525778282, -0.004017652165832646, 0.005452527939344284, 0.00482118259899916,
+      -0.004648997506177693, -0.0031567267017256415, -0.0014731391274719903, 0.0016835875742536059,
+      -0.0004017652165832406, -0.0004017652165832492, 0.0005208333333333413, 0.002083333333333326,
+      -0.0005208333333333354, -0.002253302253302247, 0.0009044774669774649, 0.0005973193473193451,
+      -0.0003969988344988313, 7.541478129713133e-05, -4.7134238310711535e-06, -0.018229166666666664,
+      -0.021513209013208946, 0.0025018384393384234, 0.0035797535797535826, -0.0018484120046619958,
+      0.0003366731307907714, -2.104207067442687e-05, 0.09590409590409561, 0.04315684315684299,
+      -0.0009178321678320517, -0.0005817711700065143, 3.636069812542802e-05, -0.15132575757575756,
+      -0.025490196078431067, 0.0015931372549017099, 0.07179487179487182, -0.00036828478186799594,
+      0.0007365695637359849, 0.0044194173824159185, -0.004201365320424143, -0.014044613126714147,
+      0.005578355507175334, 0.015605745704399335, -0.002268034335395197, -0.005766739763141147,
+      0.0022097086912079493, -0.006076698900821902, -0.003476814374278267, 0.026211317254975552,
+      -0.001136863112859237, -0.0338071908810029, 0.0022889839545318365, 0.013557587685451579,
+      0.0027621358640099484, 0.009417445354526528, -0.019636029682597086, -0.012152294051048732,
+      0.032110634237257886, 0.003943527738618824, -0.014028061376574134, -0.008112566873315921,
+      0.007301310185984355, 0.015375245788474934, -0.017879195992469055, -0.007910623798766264,
+      0.009929940922877413, -0.003029795383299607, -0.008894022294582275, 0.006182934895591489,
+      0.006678405291365721, -0.005368756515508316, 0.003763789528980581, -0.0019512011039352088,
+      -0.003412169216880362, 0.002302821416035381, 0.0017033171161394578, 0.0009315438600190686,
+      -0.000771773256120363, 0.0001749769325616924, 0.0001749769325617164, 0.0010416666666666669,
+      0.006249999999999988, 0.002083333333333332, -0.004880536130536115, 0.00036213786213785883,
+      0.0014046003016591146, -0.0006109495080083116, 9.674922600617611e-05, -5.37495700033755e-06,
+      -0.02291666666666668, -0.033362470862470774, -0.005037150349650364, 0.004190233785822017,
+      -0.0010652337858220132, 0.00014512383900930088, -8.062435500538252e-06, 0.10597527472527449,
+      0.05620286576168915, 0.002725705666882216, -0.0012770897832817714, 7.09494324045599e-05,
+      -0.15548014077425834, -0.02941176470588216, 0.0016339869281044139, 0.07058823529411755,
+      -0.0003682847818679964, 0.001473139127471977, 0.0036828478186799306, -0.00540837791554396,
+      -0.011938350394049502, 0.00624251037501132, 0.013649867186790643, -0.0023921407812973732,
+      -0.005110949023911091, 0.0003682847818679911, 0.0022097086912079523, -0.008102265201095856,
+      -0.001725530096864032, 0.027209107792863618, -0.003232907134949787, -0.031773985796995065,
+      0.002743322554719477, 0.01229345243747282, -0.003682847818679925, 0.0036828478186799346,
+      0.011754943836845534, -0.02367223099037365, -0.011648464367679943, 0.03293811804220154,
+      0.003202334724248023, -0.013322768495774198, 0.0007365695637359888, -0.011795414691995841,
+      0.00875062669644738, 0.018885843587827838, -0.02045896953390656, -0.007993946147605202,
+      0.010068256021950031, 0.00717437886755829, -0.00020446979772540625, -0.01358320930771949,
+      0.007585428574440758, 0.007867872542489848, -0.005921916674386594, -0.00014468330716243174,
+      0.006195849859661522, -0.001463854637172756, -0.004966713652684128, 0.002837674151312495,
+      -0.002859623012151474, 0.00042605494372962926, 0.002164100668685633, -0.001121577287195436,
+      -0.0009026587790882047, -0.0005472962702682324, 0.0003553625088199939, -7.753363828798264e-05,
+      -7.75336382879761e-05, -0.00013020833333334211, -0.0005208333333333276, -0.0007998511904761886,
+      0.0008928571428571402, 0.0009765624999999965, -0.0009179392911010499, -0.00015583757541478394,
+      0.0003160474716202257, -0.00010541634416924135, 1.4397206250914876e-05, -7.198603125406403e-07,
+      0.0013020833333333424, 0.010416666666666663, 0.007905505952380933, -0.0045164700495582705,
+      -0.001164608471593765, 0.0015740945501007315, -0.0004981433362818713, 6.718696250430184e-05,
+      -3.359348125220991e-06, -0.026785714285714145, -0.044505494505494375, -0.013701923076923089,
+      0.0037815126050420107, -0.00023634453781513014, 0.11411356209150324, 0.06730306157550708,
+      0.00624677502579988, -0.00175684308811245, 8.784215440561783e-05, -0.15877192982456143,
+      -0.032581453634084885, 0.0016290726817040123, 0.06965944272445834, 9.207119546699987e-05,
+      -0.00018414239093400109, -0.00011837725131471698, 0.001999260244426249, 0.0025319578753424505,
+      -0.005885474110236587, -0.010009722071890645, 0.006450114585223638, 0.01204949702533504,
+      -0.0024223153747697334, -0.004587983819229565, -0.000552427172801979, 0.0010259361780608424,
+      0.0015783633508628227, -0.009667475524034812, 0.0008739919233567322, 0.02694019843834137,
+      -0.005161036405788296, -0.029712201422608622, 0.0031007347097897044, 0.011253168735660223,
+      0.0007891816754314158, -0.004735090052588475, 0.005918862565735602, 0.012305520604238238,
+      -0.02721030171916085, -0.0100074317514373, 0.03315296022888193, 0.002416139288386517,
+      -0.012671564662289142, 0.003682847818679917, 0.001611245920672466, -0.01582291404450948,
+      0.011806568524601787, 0.02067069600769299, -0.02270210583585269, -0.0077134568090927395,
+      0.010101464363349133, -0.0038472606677281353, 0.009289132544342688, 0.0009992432684506436,
+      -0.017678158187047807, 0.009383504501660143, 0.008572272161768098, -0.006352240583319596,
+      -0.004654743501922373, -0.003327061389137782, 0.009229272014782089, -0.0015991312896899619,
+      -0.006194953987790511, 0.0033057672038968615, 0.001572431593171682, -0.003671065746194995,
+      -0.0005002629970420903, 0.0032883248500453406, -0.0014549094922791865, 0.0019554439656458435,
+      0.00012613468728838438, -0.0012878158145262805, 0.0005414934638311653, 0.0004724706083174834,
+      0.0003080577592692724, -0.00016441284904824576, 3.4816838621964786e-05, 3.4816838621962564e-05,
+      0.016666666666666684, -0.011904761904761888, 0.004761904761904745, -0.02380952380952379,
+      -0.023809523809523784, -0.004761904761904762, 0.0011904761904761917, 0.003968253968253964,
+      -0.0019841269841269814, -0.00476190476190475, -0.0017857142857142854, 0.0023809523809523764,
+      -0.0005952380952380928, -0.0029761904761904704, 0.0039682539682539585, 0.006944444444444441,
+      0.0055555555555555506, 0.005555555555555542, 0.009523809523809507, 0.0035714285714285635,
+      -0.00476190476190475, 0.001190476190476183, -0.011111111111111089, -0.011111111111111094,
+      -0.005952380952380958, 0.0005952380952380931, 0.006547619047619046, -0.0031746031746031638,
+      -0.0019300144300144336, 0.0012445887445887433, -0.0017857142857142785, 0.002678571428571428,
+      0.0014285714285714266, -0.0023538961038961008, 0.0006818181818181801, 0.010416666666666638,
+      0.011111111111111084, -0.002660533910533902, -0.0033549783549783538, 0.0033333333333333296,
+      -0.000757575757575756, -0.004090909090909083, -0.001948051948051951, -0.0019480519480519676,
+      -0.0007936507936507934, 0.00039682539682539623, 0.0003968253968253962, -0.0005291005291005275,
+      0.00022847522847522744, -3.607503607503563e-05, 0.0011904761904761871, -0.0017857142857142844,
+      -0.0009523809523809513, 0.0015692640692640666, -0.00045454545454545324, -0.0009920634920634898,
+      -0.0005291005291005286, 0.00039081289081288866, -7.215007215007135e-05, -0.002222222222222218,
+      0.0005050505050505049, 0.002727272727272717, 0.0025974025974025844, 0.0025974025974025883,
+      -0.005952380952380957, -0.0011904761904761915, 0.004761904761904758, -0.0007936507936507892,
+      -0.0006854256854256892, 0.0001082251082251079, 0.01488095238095236, 0.013492063492063468,
+      -0.0011724386724386632, 0.0002164502164502099, -0.007792207792207774, -0.007792207792207791,
+      0.004166666666666668, -0.0017857142857142835, -0.004689754689754679, 0.003156565656565654,
+      0.001019813519813521, -0.0008741258741258745, 0.004166666666666657, 0.0026785714285714277,
+      -0.004329004329004328, -0.00018939393939393918, 0.0019855144855144826, -0.0006660006660006614,
+      0.004464285714285707, -0.004689754689754683, -0.00861291486291485, 0.0024142524142524084,
+      0.0018731268731268724, -0.005050505050505043, -0.007702020202020189, 0.0003108003108003109,
+      0.002962315462315453, -0.0024350649350649363, -0.00037462537462537663, 0.002060439560439565,
+      0.0007631257631257641, 0.0007631257631257672, -0.0002976190476190472, 0.0005952380952380946,
+      -0.0002976190476190474, -0.0003607503607503601, 0.0005321067821067814, -0.000253912753912753,
+      4.370629370629355e-05, -0.002976190476190468, -0.0017857142857142848, 0.002380952380952379,
+      5.411255411255605e-05, -0.0008616383616383591, 0.00027472527472527207, -0.000595238095238094,
+      0.00028860028860028795, 0.00045093795093794964, -0.000357975357975357, 7.492507492507456e-05,
+      0.004040404040404035, 0.005176767676767666, -5.827505827505696e-05, -0.0011946386946386906,
+      0.0019480519480519398, 0.00029970029970030127, -0.0016483516483516431, -0.0009157509157509131,
+      -0.0009157509157509147, 0.0002976190476190477, 0.001785714285714286, -0.0002976190476190481,
+      -0.0016233766233766191, 0.0004599567099567099, 0.00025391275391275467, -4.370629370629389e-05,
+      0.0005952380952380936, 0.000892857142857141, -0.00028138528138528036, -0.0003517316017316013,
+      0.00020229770229770208, -2.497502497502469e-05, 0.002083333333333328, -0.0022727272727272717,
+      -0.003923160173160165, 0.0003579753579753565, -7.49250749250729e-05, -0.00217171717171717,
+      -0.002398989898989892, -0.00019813519813519732, 2.913752913752914e-05, -0.001948051948051944,
+      -0.00029970029970029867, 0.0016483516483516488, 0.0018315018315018265, 0.0018315018315018254,
+      -0.00833333333333332, -0.005357142857142852, 0.004112554112554109, 0.0003787878787878832,
+      -0.0006743256743256716, 8.325008325007784e-05, 0.014646464646464628, 0.015404040404040375,
+      0.0006604506604506646, -9.712509712509763e-05, -0.0061050061050060885, -0.006105006105006095,
+      0.002033730158730161, -0.0007936507936507927, -0.004153138528138522, 0.003138528138528136,
+      0.002918956043956043, -0.002747252747252745, -0.0005511849261849278, 0.0006507381507381533,
+      0.0023809523809523747, -0.00357142857142857, -0.0024350649350649333, 0.004974192474192461,
+      -0.0007492507492507497, -0.001587995337995334, 0.0006181318681318655, -0.004734848484848469,
+      -0.007575757575757565, 0.004526723276723273, 0.006243756243756231, -0.0022338772338772266,
+      -0.001110001110001112, -0.005681818181818167, 0.0006191724941724988, 0.007964257964257962,
+      -0.000526903651903653, -0.002190170940170935, 0.0015557359307359262, 0.004245754245754249,
+      0.0008231351981352081, -0.0018668831168831205, 0.001526251526251521, 0.000534188034188032,
+      -0.0009920634920634944, -0.00031565656565656894, -0.0003156565656565813, 0.0006944444444444443,
+      -0.00019841269841269792, -0.0007846320346320338, 0.0007936507936507914, 6.93750693751494e-07,
+      -0.0004037629037629034, 0.00023656898656898538, -4.4400044400043655e-05, -0.0005952380952380927,
+      0.001298701298701299, 0.0009956709956709952, -0.001615051615051612, 5.030683602112164e-05,
+      0.0005744255744255729, -0.00019266447837876273, 0.0005411255411255399, 0.0007936507936507928,
+      -0.00043012543012542855, -0.0003080253080253086, 0.00030525030525030433, -6.937506937506814e-05,
+      0.0023232323232323204, -0.0003690753690753685, -0.0032750582750582726, 5.8275058275057536e-05,
+      0.0006410256410256392, -0.0017940392940392854, -0.003396603396603385, -0.0005286380286380286,
+      0.0010739260739260697, -0.0013082155939298766, -0.00045787545787545733, 0.0008503401360544199,
+      0.0003607503607503599, 0.0003607503607503581, 0.0022321428571428583, -5.952380952380879e-05,
+      -0.00258928571428571, 0.000901875901875899, 0.0010132228882228896, -0.0003642191142191146,
+      -0.00015047452547452663, 2.7472527472528272e-05, -0.00017857142857142852, -0.0004626623376623382,
+      -0.0005194805194805192, 0.00031530969030969, 0.0003045169116597685, -0.00021728271728271698,
+      2.88996717568141e-05, -0.005641233766233756, -0.006240981240981229, 0.0015938922188922155,
+      0.0019367537224680065, -0.00021228771228771088, 4.459825888397146e-05, -0.0012121212121212113,
+      0.00033508158508158554, 0.0017407592407592384, 0.00016608391608391546, -2.747252747252778e-05,
+      0.0031093906093905993, 0.004227914942200652, 0.0004570429570429627, -0.0006614813757670891,
+      0.00156985871271585, 0.0005494505494505445, -0.0010204081632653051, -0.0006493506493506515,
+      -0.0006493506493506602, 0.000694444444444445, -0.00019841269841269814, -0.0005140692640692639,
+      0.00043290043290043154, -4.786879786879741e-05, -7.07625707625708e-05, 2.8443778443778037e-05,
+      -2.7750027750023993e-06, -0.0005952380952380932, 0.0017045454545454532, 0.0012121212121212113,
+      -0.0013965201465201435, -3.5321821036107004e-05, 0.00024142524142524096, -3.211074639645975e-05,
+      -0.00013528138528138571, 0.00043290043290043333, 0.0001769064269064271, -0.0002842395699538551,
+      9.712509712509694e-05, -9.910724196437825e-06, 0.0028282828282828235, -0.0007090132090132092,
+      -0.0037523587523587486, -0.0001845376845376843, 3.0525030525031054e-05, -0.002231102231102221,
+      -0.0027543884686741737, -0.00046620046620046663, 5.70857713714847e-05, -0.001744287458573167,
+      -0.0006105006105006095, 0.0011337868480725615, 0.001443001443001439, 0.0014430014430014374,
+      0.002033730158730166, 0.0015873015873015875, -0.0017721861471861468, -0.0009199134199134174,
+      0.0006816100566100572, 0.00016650016650016664, -9.955322455322488e-05, 9.712509712509311e-06,
+      -0.010687229437229424, -0.011634199134199113, 0.00026015651015650444, 0.0008325008325008362,
+      -0.00033993783993783614, 3.4687534687531374e-05, 0.013653013653013616, 0.015484515484515458,
+      0.0016317016317016458, -0.00019980019980019674, -0.005050505050505042, -0.005050505050505043,
+      -0.0019209956709956707, 0.0016639610389610382, 0.003166971916971912, -0.0035502691752691724,
+      -0.0016462703962703956, 0.002283653846153844, 0.0002943747429041556, -0.000503265117235707,
+      -0.0019209956709956666, -0.002495941558441553, 0.004755661005661002, 0.001032821345321345,
+      -0.004776473526473516, 0.0013230259324009278, 0.001240120173943705, -0.0005615937371452078,
+      -0.004159902597402584, 0.0031669719169719127, 0.007930437617937606, -0.005109473859473856,
+      -0.004356971153846146, 0.00202646618087794, 0.0006704003716871365, 0.0015782828282828254,
+      0.007842851592851577, -0.0001699689199689209, -0.007295915889665867, 0.0007888557520910447,
+      0.0016502339572192508, 0.004495504495504481, 0.0018169330669330652, -0.005031687062937062,
+      -0.0007255612035023906, 0.0016275544308632522, 7.631257631258709e-06, -0.0020198985042735014,
+      -0.0009864522732169762, 0.0010410774886877904, -0.0008877840909090964, -0.00041778074866310203,
+      0.00047000334224599823, 0.0001349753187988457, 0.00013497531879885365, 0.0003968253968253965,
+      -0.0007936507936507928, 0.0003336940836940836, 0.0007691382691382673, -0.0010186572686572662,
+      0.0002608502608502601, 0.00027437839937839904, -0.00020767631061748668, 4.24208144796378e-05,
+      0.0008116883116883109, 0.0006764069264069257, -0.0011738261738261726, -0.00048493173493173474,
+      0.0010947385947385918, -3.486097236097211e-05, -0.00042922763510998816, 0.0001467588783765253,
+      0.0003832972582972574, -0.0001549376549376554, -0.0006908600658600652, 0.000409312909312908,
+      0.00023457445332445283, -0.00026423739659033713, 6.312621202327026e-05, -0.001217301217301215,
+      -0.0030821030821030788, -1.9425019425019683e-05, 0.0021480833980833916, -8.150890503831666e-05,
+      -0.0003842154577448692, -0.002664002664002653, -0.0009240759240759188, 0.002904387279387271,
+      0.00042677910324969077, -0.0007376814362108443, 0.000381562881562879, 0.001766318172568169,
+      0.0006875613493260554, -0.0006971939416792334, 0.0007891414141414121, 0.00037136066547831,
+      -0.0004177807486631002, -0.00014997257644316255, -0.00014997257644316545, -0.00014880952380952426,
+      -0.0017045454545454538, 0.000744047619047619, 0.0019314019314019266, -0.00109577922077922,
+      -0.0005806693306693317, 0.0002716033966033968, 0.00010504201680672325, -1.983310806840226e-05,
+      -0.0007846320346320329, -0.0006899350649350643, 0.0007509157509157506, 0.0005692224442224432,
+      -0.0005103824746681878, -0.00019459706959706958, 0.00020032488519883498, -2.8464182875947225e-05,
+      -0.002042748917748915, 0.002306027306027301, 0.0045467924932210595, -0.0011880976166690435,
+      -0.0011909965034965048, 0.00016265247357684346, -3.246490904053893e-05, 0.0018881118881118849,
+      0.003192640692640685, 0.00011266511266511353, -0.0013330419580419547, -0.00011883541295306046,
+      2.234285322520698e-05, 0.0024805551591265797, 0.0006261595547309802, -0.002556818181818179,
+      -0.00036171811381895764, 0.00034070446360362055, -0.0012319030176172999, -0.002489697802197794,
+      -0.0006534665148110499, 0.0006043282697694465, -0.0010146103896103906, -0.00047746371275782885,
+      0.0005371466768525619, 0.0002570958453311398, 0.00025709584533114356, 0.00014880952380952412,
+      -0.00045995670995670993, 0.0002029220779220775, 0.00039960039960039906, -0.00043394105894105833,
+      8.116883116883095e-05, 6.764069264069259e-05, -3.207576736988488e-05, 3.3055180114004913e-06,
+      0.0029491341991341926, 0.0021103896103896102, -0.0022311022311022276, -0.0005702630702630705,
+      0.0009570786356500617, -2.757659007658796e-05, -0.00014281936550844228, 1.974128812364044e-05,
+      -0.000324675324675324, 2.4975024975024833e-05, -0.0001783930355358926, -0.00015876980162694376,
+      0.0002596361971361966, -9.881575007625376e-05, 1.0821636346846035e-05, -0.005069930069930063,
+      -0.00701590076590075, -0.0002927627927627936, 0.001740967365967361, 7.337433808022165e-05,
+      -1.4385124679242481e-05, -0.0014949336377907754, -0.0002782931354359903, 0.0016233766233766183,
+      0.00035762556770960023, -4.911055331223357e-05, 0.0024638060352346015, 0.0034913003663003582,
+      0.000606652917577287, -0.00042084141348847065, 0.0013528138528138478, 0.0006366182836770999,
+      -0.0007161955691367446, -0.0005141916906622809, -0.0005141916906622852, -0.000396825396825397,
+      -0.0008026695526695529, -1.3528138528138039e-05, 0.0007513320013320002, 0.0001612970362970355,
+      -0.00028513153513153494, -4.613442113442097e-05, 3.7421728598199487e-05, -3.856437679966949e-06,
+      0.0007846320346320327, -0.00019615800865800824, -0.0006514319014319006, 0.0004896145521145503,
+      1.4568764568764391e-05, -0.000110566516816516, 3.2443047148929225e-05, -2.678081722199441e-06,
+      -0.0011837121212121195, 0.001675407925407926, 0.003150495337995335, -8.32500832500828e-05,
+      -0.0002467150904650916, 0.00011528504175563, -1.2625242404653742e-05, 1.6187516187517645e-06,
+      0.0009340196840196831, 0.0007381507381507371, -0.00017199235949235883, 2.0472446943034455e-05,
+      -1.7853878147992939e-06, 0.0032051282051281937, 0.0005494505494505447, -0.0031302031302031237,
+      -0.0004172298289945371, 5.729564553093681e-05, -0.002136752136752129, -0.002798127798127788,
+      -0.0005985300102947142, 6.284565108094664e-05, -0.0015782828282828274, -0.0007427213309566231,
+      0.0008355614973262031, 0.0011997806115453128, 0.0011997806115453139, 0.003841991341991333,
+      0.004991883116883117, -0.000944888444888443, -0.0020656426906426897, 0.00048701298701298463,
+      0.00033143939393939613, -0.00011679496973614591, 9.641094199917614e-06, -0.011722999222999204,
+      -0.015685703185703156, -0.0031857031857031866, 0.0006968725718725696, -7.370080899492054e-05,
+      6.427396133279146e-06, 0.01257631257631254, 0.014957264957264915, 0.0021547080370609775,
+      -0.00022624434389139928, -0.004319210201563145, -0.00431921020156315, -0.0005208333333333334,
+      0.000520833333333332, 0.001673326673326672, -0.0024399211899211884, -0.0018696581196581187,
+      0.0033453525641025644, 0.0008247420471685171, -0.0018678013163307282, -0.00014878294435182978,
+      0.00040033093196792884, -0.0015624999999999927, 0.002343750000000001, 0.002097902097902094,
+      -0.00559986888111887, 0.0005127684815184819, 0.004150892765322903, -0.0016160310277957299,
+      -0.0009571196266968311, 0.0005055147058823468, 0.0010029033466533452, 0.00520659895659895,
+      -0.0039392031579531485, -0.006970243298368287, 0.00548484527115041, 0.0029087538278714745,
+      -0.0018034051297644539, -0.00039996915601598514, 0.004895104895104882, 0.0008194930069930055,
+      -0.009206548659673646, 0.0009399531228575312, 0.0063536953242835405, -0.0009785626041914702,
+      -0.0012613680340557247, 0.0012409465534465487, -0.005056271853146848, -0.002850389500205674,
+      0.005324454956807881, 0.00047615769485932465, -0.001401468355560845, -0.0026971726190476095,
+      -0.0022709865196078355, 0.0025162949795302703, 0.0010719163044772579, -0.0010181925756132415,
+      -0.0005058628565062374, 0.0008281342840166425, 0.0007862890221878264, -0.0005477081183350568,
+      0.0004949095022624457, 0.00027350261967135867, -0.00022140688259109293, -5.904183535762862e-05,
+      -5.904183535763608e-05, -0.00032016594516594515, -7.665945165945167e-05, 0.0008824508824508817,
+      -0.0007589632589632574, -0.00040931290931290937, 0.0009776681651681633, -0.0003992841309017768,
+      -0.00017111156817039232, 0.00017783590248760534, -3.9410086817206965e-05, -0.00022997835497835494,
+      -0.00041989260739260734, -0.0002705627705627704, 0.0006842116217116204, 0.00039803946053945915,
+      -0.0008174041032496896, 1.1385673150378409e-05, 0.0003440094638333803, -0.00011795963324601029,
+      -0.0001847111222111218, -0.00040931290931290845, 0.000160429847929847, 0.0005372231934731927,
+      -0.0003412768807989386, -0.00020098365686601027, 0.00023483554951240677, -5.764923286208046e-05,
+      -0.0012140637140637112, -1.2140637140636954e-05, 0.0025586392773892714, 1.5747120526531304e-05,
+      -0.0014920128890717073, 9.58866017883039e-05, 0.000246930410920348, 8.8453213453213e-05,
+      0.0028900786713286614, 0.001299726621417795, -0.0023362666745019604, -0.00030486879606461594,
+      0.0005294990419796907, 0.001960279304029297, 0.0014405401583710397, -0.0017304998922645937,
+      -0.0006479407299356989, 0.0005628200166706346, 0.00020169526143790667, -0.0007835710041592384,
+      -0.0005856626442442976, 0.00039960362135284716, -0.00044991772932949435, -0.0002486387451557764,
+      0.00020127898417371891, 6.440927493559012e-05, 6.440927493558995e-05, -0.0008139430014430006,
+      0.00036976911976911866, 0.0017529345654345636, -0.00132228882228882, -0.0012655747030747033,
+      0.00105623543123543, 0.0003250528066704541, -0.00020122851005204028, -8.053414593662295e-05,
+      1.5448302987002995e-05, 6.764069264069307e-05, 0.0008507117882117884, 0.0005556943056943066,
+      -0.0009339618714618681, -0.00043193413729127885, 0.0005843956900942179, 0.00010594272674104626,
+      -0.00017713396317304986, 2.6668055886321215e-05, 0.00235701798201798, 0.003626928626928615,
+      -0.0020309551559551534, -0.0032830264973122115, 0.00099313472475237, 0.000809764465226651,
+      -0.00013921997764877007, 2.631097832336112e-05, 0.0017822455322455283, -0.0002974456099456125,
+      -0.0032040008602508556, -0.0001530077357283218, 0.0010666416916416894, 7.811541528646828e-05,
+      -1.722429402382913e-05, -0.0011243964368964352, -0.0033855653275296086, -0.0010383764519793957,
+      0.0017038371292572943, 0.000277989715392969, -0.00020305497521054642, -0.0023697780394208896,
+      -0.0013834460066077677, 0.0019113414596607832, 0.0005373923354767001, -0.00038761709137096064,
+      0.00019015655504626126, 0.0012055958747135274, 0.0006132948095506188, -0.00040214451011664576,
+      0.0005998903057726605, 0.0003315183268743661, -0.0002683719788982962, -0.00010734879155931849,
+      -0.0001073487915593223, -0.0006809163059163064, 0.0001533189033189031, 0.0008037101787101773,
+      -0.0006771006771006756, -0.00017447829947829998, 0.0004322066822066816, -0.00012563008886538215,
+      -5.166402225225823e-05, 3.074625752644332e-05, -3.329144196016712e-06, 0.00045995670995670874,
+      -0.0015796703296703284, -0.0010855810855810847, 0.0016629204129204101, 0.00018856143856143813,
+      -0.0006169994221464795, 1.8853695324282507e-05, 0.00010136438638760583, -1.4175710770136233e-05,
+      2.775002775002748e-05, -0.00023310023310023267, -0.00020217877360734487, 0.0003805222555222555,
+      2.030241000829281e-05, -0.0002026840262134381, 8.861736941126546e-05, -1.0246962646342737e-05,
+      -0.002533022533022527, 0.0004981129981129987, 0.004288558663558659, 0.00028937565702271523,
+      -0.001003245120892178, -2.7868158673113194e-05, 7.329486818650109e-06, 0.001665298986727551,
+      0.00345591908091907, 0.0009826570488335185, -0.0011001253648312427, -0.00025406509677849775,
+      3.8097222694746444e-05, 0.0023847680097680043, 0.0011957507361919104, -0.0018539467068878802,
+      -0.0004567236813753847, 0.00020820575193640164, -0.0008886130209659612, -0.0019275386922445704,
+      -0.0006498811645870432, 0.00038904450669156627, -0.0008569861511038, -0.0004735976098205223,
+      0.0003833885412832767, 0.00020447388868441546, 0.0002044738886844153, -0.0008139430014430025,
+      -0.0001510642135642136, 0.0010864135864135874, 8.325008325008327e-06, -0.0006379037629037642,
+      -6.555944055944017e-05, 0.00020314652667593853, 2.073090308384415e-05, -2.2856722740623692e-05,
+      2.4243687169383554e-06, 0.000588474025974025, -0.00014906968031968006, 4.870129870129856e-05,
+      0.0004518918581418567, -0.0004603432282003703, 2.1784281894576235e-05, 0.00010894217826990923,
+      -3.5731248240923464e-05, 3.1009367309680306e-06, 0.00402332042957043, 0.004957542457542447,
+      -0.0008546141358641321, -0.001852946160981876, 0.00014123692892075045, 0.00013029687399435496,
+      -6.748564580414369e-05, 7.5644062679648755e-06, -0.00037198912198912164, -0.00011412198912199034,
+      -0.0005447157009657014, -0.0006239216257598591, 0.0001572365542953777, -1.9592282072931393e-05,
+      1.8323717046627868e-06, -0.004497585747585734, -0.007059235407449684, -0.0014796171965289638,
+      0.0012945038155122155, 0.00018523948961255627, -2.723186256468098e-05, -0.001635269492412344,
+      -0.0007765926883573908, 0.0013300191871620417, 0.00042172739541160585, -4.961498769548232e-05,
+      0.0020318733554027654, 0.002960275019098549, 0.0006391312505863639, -0.0002892704131094213,
+      0.0011997806115453143, 0.0006630366537487246, -0.0005367439577965856, -0.00042939516623727064,
+      -0.0004293951662372739, -0.00032016594516594504, -7.665945165945175e-05, 0.00037254412254412214,
+      -7.90875790875788e-05, -0.00016650016650016647, 8.533133533133518e-05, 1.7425385072444258e-05,
+      -2.1138991727227232e-05, 4.803632899608137e-06, -3.382840070145178e-07, -0.0002299783549783549,
+      -0.001184752747252748, -0.001028138528138528, 0.0005749458874458873, 0.0005806693306693297,
+      -0.00021928133141368379, -0.0001050420168067236, 4.2877497889107644e-05, -3.7211240771603965e-06,
+      0.0010900557775557756, 0.0002705627705627692, -0.0007674617049617043, 0.0002627580752580743,
+      0.00010194564422505565, -8.773905832729367e-05, 1.9632553978529317e-05, -1.4095166958946655e-06,
+      -0.0018162393162393159, 0.0007041569541569545, 0.003655545843045839, 0.000896336098541978,
+      -0.0002131038895744784, 2.3510738487517574e-05, -2.198846045596377e-06, 0.0001665001665001653,
+      0.001379870129870126, 0.0011920677361853822, -4.995004995004839e-05, -2.661811872338237e-05,
+      2.0297040420877266e-06, 0.0033577533577533506, 0.001420311714429359, -0.0025030525030524955,
+      -0.0005060728744939269, 5.9537985234579104e-05, -0.0020090612002376666, -0.002733214497920372,
+      -0.0006631719673515333, 6.0981330331176256e-05, -0.001439736733854377, -0.0007956439844984725,
+      0.0006440927493559069, 0.0010305483989694495, 0.0010305483989694506, -0.0005208333333333352,
+      -0.0010416666666666656, 0.0001108266733266746, 0.0010565823065823033, 4.2492229992229647e-05,
+      -0.00045163170163170155, 1.9067941862058945e-05, 6.941587823940828e-05, -1.761332063189597e-05,
+      1.2403746923866493e-06, 0.004909153346653343, 0.008703102453102438, 0.002597229159729157,
+      -0.0016571969696969706, -9.051916221034203e-05, 0.0002928036016271328, -7.198603125460474e-05,
+      5.168227884944907e-06, -0.011988011988011938, -0.017963286713286668, -0.005730666392431103,
+      0.000349650349650343, 9.759976865240323e-05, -7.4422481543252815e-06, 0.01157531194295898,
+      0.014230540701128907, 0.002431630546955634, -0.00022359821121430303, -0.003778677462887982,
+      -0.0037786774628879765, 0.0005208333333333343, -0.0009672619047619037, -0.0010267510267510274,
+      0.0026557643745143745, 0.0007782505484711369, -0.002877331002331001, -0.000327458918790188,
+      0.0015239243470667612, 6.461466165413568e-05, -0.0003256072165708404, 0.0005208333333333318,
+      0.001450892857142855, -0.0032529970029970038, -0.0008103875291375285, 0.005582698551448543,
+      -0.0017152845622514714, -0.003391668745770909, 0.0017214571177661335, 0.0007343343038969967,
+      -0.00045347744360902385, 0.002418154761904756, -0.001026751026751028, -0.005851353507603501,
+      0.0053285792026600744, 0.005401110582636315, -0.005512225132968156, -0.0018220727688848801,
+      0.0015828288552263003, 0.00022659283011450664, 0.0011994949494949466, -0.005829023407148396,
+      -0.0008924975147401555, 0.009665982506056008, -0.0019484632584477744, -0.005365228328173366,
+      0.001087488175094598, 0.0009742915806673556, -0.0034438218031967883, -0.0037720781057178003,
+      0.006281815610859715, 0.0027141879018814014, -0.00530842271118973, -0.0002106023330384863,
+      0.0012019363666519215, -0.0023554493912949725, 0.0021199605643539435, 0.003485358380869205,
+      -0.002945595305429858, -0.0009909693043884216, 0.0009645744262617317, 0.0012650633169934654,
+      0.0018156604747161993, -0.000982448077915382, -0.0009492941913607629, 0.000583751044277357,
+      0.0005449379481887251, -0.0002682930459633271, -0.000534040370534188, 0.00027919062361786645,
+      -0.00026864035087719536, -0.00016447368421052436, 0.00010416666666667391, 2.6260504201679183e-05,
+      2.6260504201681287e-05, -0.00026041666666666607, 0.0005208333333333328, -0.00015947594072594076,
+      -0.0008436008436008406, 0.0010759639665889656, 2.6780817221992495e-06, -0.0008099054744275326,
+      0.00044906074317838915, 9.59119730888309e-05, -0.00015078526349811082, 3.610819327730986e-05,
+      -0.000350170662670662, 0.0002872127872127876, 0.00019980019980019994, 5.5933649683648176e-05,
+      -0.0002716493065757769, -0.00046571841149046974, 0.0006850304837920925, -4.549919894347851e-07,
+      -0.0002876458444376392, 9.839183649168129e-05, 0.00013528138528138547, 8.67188367188368e-05,
+      0.0002233010045510043, -4.11276835909188e-05, -0.0004748238893459478, 0.0002882018652142484,
+      0.00018357102456367146, -0.00021336659663865503, 5.309689665339738e-05, 0.00029623154623154545,
+      0.001371133207070706, 0.0001221740881667356, -0.0019735766174185233, 9.479469618788916e-06,
+      0.0010933364478014228, -0.00010327152959699332, -0.0001662794630335269, 0.0016106939935064863,
+      0.0013123595154845105, -0.0027280279463183805, -0.0011553365365284832, 0.0018762022371977786,
+      0.0002083962380498753, -0.0003934490673799861, 0.0009040515244559359, -0.0015921552916038167,
+      -0.0019078970994605643, 0.001594222582757793, 0.0005489647360293635, -0.00045694813012924315,
+      -0.0010924966577540083, -0.0012905760390280463, 0.0007816677807486618, 0.0006171218487394928,
+      -0.0003626253132832078, -0.0003467786943019141, 0.00028546095931931785, 0.00041697262575745794,
+      -0.00021526702786377498, 0.0002479757085020225, 0.00015182186234817627, -9.615384615384586e-05,
+      -2.8280542986427482e-05, -2.828054298642917e-05, -5.7494588744588396e-05, 0.000922514985014985,
+      -0.0007958187645687637, -0.001435023310023309, 0.0016500426656676657, 0.0006621595316448254,
+      -0.0009006388831756463, -0.0001811510857563492, 0.00015052792602134757, 6.547970218635897e-05,
+      -1.2638532133502157e-05, 0.000540605228105227, 0.0003519917582417581, -0.0011540542790542797,
+      -0.00039543789543789435, 0.0011224529147323243, 0.00020547390722023038, -0.0005716178171673524,
+      -4.5283542888999644e-05, 0.00015484950421095964, -2.4508676308212104e-05, 0.0013749271561771547,
+      -0.0015661421911421893, -0.0034991050616050563, 0.0020185467106422945, 0.0024236448294352687,
+      -0.0008803841282556434, -0.0005800984764074932, 0.00012469994208577742, -2.2648114269629113e-05,
+      -0.0008231351981351959, -0.0029296874999999965, -3.751099798893878e-05, 0.0029620387272041595,
+      7.568916721393444e-05, -0.0008765121858920233, -4.638719446188507e-05, 1.2816735315768634e-05,
+      -0.002139462100399595, -0.0010232644194041209, 0.003002202301375093, 0.0009843049752105463,
+      -0.001250415485250041, -0.0002154784553681644, 0.00013323738471281, -0.0001690379677512032,
+      0.002302549625619474, 0.0017255797393181257, -0.001436183342264029, -0.0004248593415098838,
+      0.0002653161467015954, 0.0016032336229946514, 0.00143144877568252, -0.0010328529587672413,
+      -0.0005588210164448592, 0.0003022470950102501, 0.00020719895429647769, -0.0004952647004698101,
+      -0.000466662787676721, 0.00023580086708956487, -0.00033814869341185227, -0.00020702981229296996,
+      0.00013111888111888275, 4.6277252159604745e-05, 4.62772521596063e-05, -0.0002457611832611833,
+      0.0007031163281163279, -0.0003245018870018871, -0.0007652070152070132, 0.0009057782495282479,
+      -5.087845161374561e-05, -0.0003712433399933394, 0.0001453579530204913, 3.6872688285227067e-05,
+      -2.8069518201096564e-05, 3.1747685578948207e-06, -0.0009018759018758998, -0.0008064851814851813,
+      0.0014638139638139646, 0.000541819291819291, -0.0012138509249853754, -5.3964621979328224e-05,
+      0.0004202262633266616, -3.741260029959429e-06, -7.958623477199403e-05, 1.109893718252928e-05,
+      0.0005263833388833378, 5.8968808968808786e-05, 7.309159094873426e-05, 0.0002835523778275873,
+      -0.00044487188329100024, 5.703652458406969e-05, 0.00015783087173650004, -7.775833772350843e-05,
+      9.365455379387032e-06, 0.0016511266511266478, 0.0038244741369741313, 0.00021028807793513745,
+      -0.0028080341499459056, -0.0002025250864260152, 0.000651977988471796, 5.888647529515101e-06,
+      -3.6396853347328703e-06, 0.001982578433471281, 0.00074908022649619, -0.002811633831854412,
+      -0.000984408301414048, 0.0008036043594839448, 0.00018070004041366317, -2.9176995605014087e-05,
+      -0.0006983963457177701, -0.0028701852001484294, -0.0015235823299180212, 0.0011148975025232733,
+      0.0003445239150541005, -0.00012216706295653575, -0.002090008983391331, -0.0015622277619181577,
+      0.001275714631945277, 0.0005137621236692431, -0.00023417128680286594, 7.210460964330836e-05,
+      0.0008809479349340041, 0.0005446998964800847, -0.0002641434288106093, 0.0005009610272768153,
+      0.0003067108330266199, -0.0001942501942501967, -8.569861511038098e-05, -8.569861511038571e-05,
+      0.00024576118326118357, 0.0008024961149961144, -0.00033612221112221114, -0.0009552947052947045,
+      0.0002809690309690314, 0.00044728555757967445, -2.060847649083329e-06, -0.00013880813029419842,
+      -1.4544601425406373e-05, 1.6551753200359956e-05, -1.7719638462673664e-06, -0.0006037365412365396,
+      -0.00018445096570096566, 0.0006271506271506268, -0.0004985465922965908, -0.00026931227036269026,
+      0.0004842609392241726, -8.000480689556241e-05, -9.029968032483503e-05, 3.3806027420577434e-05,
+      -3.0606648253696113e-06, 0.0011251769064269037, -0.0017794705294705278, -0.0033710708933923175,
+      0.0006142972923435094, 0.0011432730872069092, -8.837573797768407e-05, -9.699056978330579e-05,
+      4.8527646244363874e-05, -5.409859318526536e-06, -0.00030108780108780114, -0.0009008786352536352,
+      -0.0006393116687234349, 0.000577900279187043, 0.0004662806520391654, -0.00013190055880651875,
+      1.7540652215573885e-05, -1.6992506833835127e-06, -0.002838214612768175, -0.0008541156847354284,
+      0.003625104980803501, 0.0010912406920810282, -0.0006666847706141683, -0.00010142479424600319,
+      1.5494615678440282e-05, 0.0014213618139563473, 0.0033634580969139696, 0.0014921060641980555,
+      -0.000770937170414723, -0.0002848185776784855, 3.6128373976670903e-05, 0.0022580054749172375,
+      0.0015063840528236746, -0.0013457984868588569, -0.00045652232184740333, 0.0001376547429178976,
+      -0.0006708046568727658, -0.0015504683654838404, -0.0006101641163560677, 0.00026949959225501026,
+      -0.0007514415409152257, -0.00046006624953993567, 0.00029137529137528883, 0.00017139723022075926,
+      0.00017139723022075983, 5.7494588744588816e-05, 0.00019095487845487846, -7.570554445554453e-05,
+      -0.0002559940059940053, 0.0001326798201798198, 0.00012358964564846886, -9.405423008364166e-05,
+      -1.0328938347514414e-05, 2.1971546255601913e-05, -5.436707255592376e-06, 3.986918654098863e-07,
+      -0.0016540750915750894, -0.0016592782217782205, 0.001046869796869797, 0.0009937978687978679,
+      -0.0005158444496679779, -0.00037658420011361227, 0.00016657104505401704, 5.7305310788283334e-05,
+      -2.5975379110054785e-05, 2.305163876372404e-06, 0.0008038836163836137, -0.00012487512487512493,
+      -0.00031218781218781094, 0.0005690541076570481, -0.0002376606236900349, -8.183251217306944e-05,
+      8.589997463836486e-05, -2.0840711146439232e-05, 1.5706043182827803e-06, 0.004312354312354306,
+      0.006788133741258726, 0.0011946744023949925, -0.0018451447449609193, -0.00042861335430994987,
+      0.00011926484570640964, -1.4799925306889465e-05, 1.3615931282319757e-06, -0.00028877372627372636,
+      7.161955691367287e-06, -0.0006218964858670726, -0.0008974771358672255, 4.6233758501560324e-05,
+      2.3921511924607546e-05, -1.957214612012646e-06, -0.003951981433599066, -0.006729759211376839,
+      -0.0021327829377364937, 0.0008917053663570649, 0.0002197057972986768, -2.7004729017112896e-05,
+      -0.0016934046345811, -0.0011305000469087098, 0.0010385589642555556, 0.0004312251216275966,
+      -4.442925495557076e-05, 0.0017238952997466917, 0.002561215873909373, 0.0006278551170192092,
+      -0.00020946545714347297, 0.0010820758189179216, 0.0006624953993375021, -0.00041958041958042213,
+      -0.0003702180172768422, -0.0003702180172768491, 0.00026041666666666655, 0.0004355019980019985,
+      0.000103802447552447, -0.00031322843822843827, -0.0002965784215784211, 8.655560126148372e-05,
+      0.00015340052104757958, -1.856051585153753e-05, -2.364041402354114e-05, 6.64486442350194e-06,
+      -4.872900577231838e-07, -0.0006061646686646673, -0.0003707230269730272, 0.0005962787212787212,
+      4.032425907425973e-05, -0.00031806428865252333, 9.185820307143743e-05, 5.081240568856694e-05,
+      -3.223000876832143e-05, 5.9951443465368335e-06, -3.721124077152856e-07, 3.902347652347238e-06,
+      -0.0012435481185481163, -0.0022438499000998974, -0.0006261355066502109, 0.0004960700043420634,
+      3.946646748504373e-06, -9.44678225541234e-05, 2.5471980290091564e-05, -1.9196275001225233e-06,
+      0.0012213480963480946, 0.00048107274669774485, -0.0009944253050870682, -5.1865516019926725e-05,
+      0.00014519901323306833, -4.8619868908181304e-05, 7.959070942816901e-06, -5.064863327256116e-07,
+      -0.0023179945054944964, -0.00046662895927601313, 0.00336859831345125, 0.0014446080235553918,
+      -0.00010425429833324385, -2.923740346341007e-05, 2.3921511924612367e-06, 0.00029021223874164937,
+      0.0016936902966314693, 0.0015218098035435464, 6.102643486544407e-05, -5.3666878357280855e-05,
+      3.6384324310016345e-06, 0.003384952465834814, 0.002000656722018944, -0.001965651092973068,
+      -0.0005270529264337326, 5.430242272347219e-05, -0.0018796562914209908, -0.002627519539284237,
+      -0.0006913021618903957, 5.656108597284859e-05, -0.0013225371120107938, -0.0008097165991902816,
+      0.0005128205128205097, 0.0009049773755656089, 0.0009049773755656061, -0.0010416666666666638,
+      -0.0029017857142857087, -0.0014048451548451548, 0.0016207750582750559, 0.0007639419404125296,
+      -0.0006252785204991082, -8.862181849798287e-05, 0.00011144766611098006, -2.2267679001423987e-05,
+      1.3821318000884826e-06, 0.005511849261849256, 0.011658046814296797, 0.006424182435211848,
+      -0.0004046760021024716, -0.0004761384985843233, 0.0001750788878304337, -2.9562263501888545e-05,
+      1.8812349501180315e-06, -0.011857627666451159, -0.01911136249371539, -0.007499329016356862,
+      -3.274589187902494e-05, 0.00019933411961276036, -1.3514177600867935e-05, 0.010683760683760665,
+      0.013461538461538426, 0.002567693744164339, -0.0002100840336134367, -0.003361344537815122,
+      -0.0033613445378151384,
+    };
+
+    static const Shapeset::PolynomialTable gradleg_tri_polynomials = { 165, gradleg_tri_start, gradleg_tri_degrees, gradleg_tri_coefs };
+
+    static const int gradleg_quad_start[] =
+    {
+      0, 2, 4, 4, 4, 6, 8, 8, 8, 10, 12, 14, 16, 18, 20, 22,
+      24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54,
+      56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86,
+      88, 90, 92, 94, 96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118,
+      120, 122, 124, 126, 128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150,
+      152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182,
+      184, 186, 188, 190, 192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214,
+      216, 218, 220, 222, 224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246,
+      248, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 274, 276, 278,
+      280, 282, 284, 286, 288, 290, 292, 294, 296, 298, 300, 302, 304, 306, 308, 310,
+      312, 314, 316, 318, 320, 322, 324, 326, 328, 330, 332, 334, 336, 338, 340, 342,
+      344, 346, 348, 350, 352, 354, 356, 358, 360, 362, 364, 366, 368, 370, 372, 374,
+      376, 378, 380, 382, 384, 386, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388, 388,
+      388, 388, 388, 388, 388, 388, 388, 390, 392, 392, 392, 394, 396, 398, 400, 402,
+      404, 406, 408, 410, 412, 414, 416, 418, 420, 422, 424, 426, 428, 430, 432, 434,
+      436, 438, 440, 442, 444, 446, 448, 450, 452, 454, 456, 458, 460, 462, 464, 466,
+      468, 470, 472, 474, 476, 478, 480, 482, 484, 486, 488, 490, 492, 494, 496, 498,
+      500, 502, 504, 506, 508, 510, 512, 514, 516, 518, 520, 522, 524, 526, 528, 530,
+      532, 534, 536, 538, 540, 542, 544, 546, 548, 550, 552, 554, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556,
+      556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 558, 560, 562, 564, 566,
+      568, 570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 590, 592, 594, 596, 598,
+      600, 602, 604, 606, 608, 610, 612, 614, 616, 618, 620, 622, 624, 626, 628, 630,
+      632, 634, 636, 638, 640, 642, 644, 646, 648, 650, 652, 654, 656, 658, 660, 662,
+      664, 666, 668, 670, 672, 674, 676, 678, 680, 682, 684, 686, 688, 690, 692, 694,
+      696, 698, 700, 702, 704, 706, 708, 710, 712, 714, 716, 718, 720, 722, 724, 726,
+      728, 730, 732, 734, 736, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 758,
+      760, 762, 764, 766, 768, 770, 772, 774, 776,
+    };
+
+    static const unsigned char gradleg_quad_degrees[] =
+    {
+      0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x00, 0x02, 0x00, 0x02,
+      0x10, 0x11, 0x10, 0x11, 0x00, 0x02, 0x00, 0x02, 0x20, 0x21, 0x20, 0x21, 0x01, 0x03, 0x01, 0x03,
+      0x20, 0x21, 0x20, 0x21, 0x01, 0x03, 0x01, 0x03, 0x30, 0x31, 0x30, 0x31, 0x02, 0x04, 0x02, 0x04,
+      0x30, 0x31, 0x30, 0x31, 0x02, 0x04, 0x02, 0x04, 0x40, 0x41, 0x40, 0x41, 0x03, 0x05, 0x03, 0x05,
+      0x40, 0x41, 0x40, 0x41, 0x03, 0x05, 0x03, 0x05, 0x50, 0x51, 0x50, 0x51, 0x04, 0x06, 0x04, 0x06,
+      0x50, 0x51, 0x50, 0x51, 0x04, 0x06, 0x04, 0x06, 0x60, 0x61, 0x60, 0x61, 0x05, 0x07, 0x05, 0x07,
+      0x60, 0x61, 0x60, 0x61, 0x05, 0x07, 0x05, 0x07, 0x70, 0x71, 0x70, 0x71, 0x06, 0x08, 0x06, 0x08,
+      0x70, 0x71, 0x70, 0x71, 0x06, 0x08, 0x06, 0x08, 0x80, 0x81, 0x80, 0x81, 0x07, 0x09, 0x07, 0x09,
+      0x80, 0x81, 0x80, 0x81, 0x07, 0x09, 0x07, 0x09, 0x90, 0x91, 0x90, 0x91, 0x08, 0x0a, 0x08, 0x0a,
+      0x90, 0x91, 0x90, 0x91, 0x08, 0x0a, 0x08, 0x0a, 0xa0, 0xa1, 0xa0, 0xa1, 0x09, 0x0b, 0x09, 0x0b,
+      0xa0, 0xa1, 0xa0, 0xa1, 0x09, 0x0b, 0x09, 0x0b, 0x00, 0x02, 0x01, 0x03, 0x02, 0x04, 0x03, 0x05,
+      0x04, 0x06, 0x05, 0x07, 0x06, 0x08, 0x07, 0x09, 0x08, 0x0a, 0x09, 0x0b, 0x10, 0x12, 0x11, 0x13,
+      0x12, 0x14, 0x13, 0x15, 0x14, 0x16, 0x15, 0x17, 0x16, 0x18, 0x17, 0x19, 0x18, 0x1a, 0x19, 0x1b,
+      0x20, 0x22, 0x21, 0x23, 0x22, 0x24, 0x23, 0x25, 0x24, 0x26, 0x25, 0x27, 0x26, 0x28, 0x27, 0x29,
+      0x28, 0x2a, 0x29, 0x2b, 0x30, 0x32, 0x31, 0x33, 0x32, 0x34, 0x33, 0x35, 0x34, 0x36, 0x35, 0x37,
+      0x36, 0x38, 0x37, 0x39, 0x38, 0x3a, 0x39, 0x3b, 0x40, 0x42, 0x41, 0x43, 0x42, 0x44, 0x43, 0x45,
+      0x44, 0x46, 0x45, 0x47, 0x46, 0x48, 0x47, 0x49, 0x48, 0x4a, 0x49, 0x4b, 0x50, 0x52, 0x51, 0x53,
+      0x52, 0x54, 0x53, 0x55, 0x54, 0x56, 0x55, 0x57, 0x56, 0x58, 0x57, 0x59, 0x58, 0x5a, 0x59, 0x5b,
+      0x60, 0x62, 0x61, 0x63, 0x62, 0x64, 0x63, 0x65, 0x64, 0x66, 0x65, 0x67, 0x66, 0x68, 0x67, 0x69,
+      0x68, 0x6a, 0x69, 0x6b, 0x70, 0x72, 0x71, 0x73, 0x72, 0x74, 0x73, 0x75, 0x74, 0x76, 0x75, 0x77,
+      0x76, 0x78, 0x77, 0x79, 0x78, 0x7a, 0x79, 0x7b, 0x80, 0x82, 0x81, 0x83, 0x82, 0x84, 0x83, 0x85,
+      0x84, 0x86, 0x85, 0x87, 0x86, 0x88, 0x87, 0x89, 0x88, 0x8a, 0x89, 0x8b, 0x90, 0x92, 0x91, 0x93,
+      0x92, 0x94, 0x93, 0x95, 0x94, 0x96, 0x95, 0x97, 0x96, 0x98, 0x97, 0x99, 0x98, 0x9a, 0x99, 0x9b,
+      0xa0, 0xa2, 0xa1, 0xa3, 0xa2, 0xa4, 0xa3, 0xa5, 0xa4, 0xa6, 0xa5, 0xa7, 0xa6, 0xa8, 0xa7, 0xa9,
+      0xa8, 0xaa, 0xa9, 0xab, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x20, 0x00, 0x20,
+      0x01, 0x11, 0x01, 0x11, 0x00, 0x20, 0x00, 0x20, 0x01, 0x11, 0x01, 0x11, 0x10, 0x30, 0x10, 0x30,
+      0x02, 0x12, 0x02, 0x12, 0x10, 0x30, 0x10, 0x30, 0x02, 0x12, 0x02, 0x12, 0x20, 0x40, 0x20, 0x40,
+      0x03, 0x13, 0x03, 0x13, 0x20, 0x40, 0x20, 0x40, 0x03, 0x13, 0x03, 0x13, 0x30, 0x50, 0x30, 0x50,
+      0x04, 0x14, 0x04, 0x14, 0x30, 0x50, 0x30, 0x50, 0x04, 0x14, 0x04, 0x14, 0x40, 0x60, 0x40, 0x60,
+      0x05, 0x15, 0x05, 0x15, 0x40, 0x60, 0x40, 0x60, 0x05, 0x15, 0x05, 0x15, 0x50, 0x70, 0x50, 0x70,
+      0x06, 0x16, 0x06, 0x16, 0x50, 0x70, 0x50, 0x70, 0x06, 0x16, 0x06, 0x16, 0x60, 0x80, 0x60, 0x80,
+      0x07, 0x17, 0x07, 0x17, 0x60, 0x80, 0x60, 0x80, 0x07, 0x17, 0x07, 0x17, 0x70, 0x90, 0x70, 0x90,
+      0x08, 0x18, 0x08, 0x18, 0x70, 0x90, 0x70, 0x90, 0x08, 0x18, 0x08, 0x18, 0x80, 0xa0, 0x80, 0xa0,
+      0x09, 0x19, 0x09, 0x19, 0x80, 0xa0, 0x80, 0xa0, 0x09, 0x19, 0x09, 0x19, 0x90, 0xb0, 0x90, 0xb0,
+      0x0a, 0x1a, 0x0a, 0x1a, 0x90, 0xb0, 0x90, 0xb0, 0x0a, 0x1a, 0x0a, 0x1a, 0x00, 0x20, 0x01, 0x21,
+      0x02, 0x22, 0x03, 0x23, 0x04, 0x24, 0x05, 0x25, 0x06, 0x26, 0x07, 0x27, 0x08, 0x28, 0x09, 0x29,
+      0x0a, 0x2a, 0x10, 0x30, 0x11, 0x31, 0x12, 0x32, 0x13, 0x33, 0x14, 0x34, 0x15, 0x35, 0x16, 0x36,
+      0x17, 0x37, 0x18, 0x38, 0x19, 0x39, 0x1a, 0x3a, 0x20, 0x40, 0x21, 0x41, 0x22, 0x42, 0x23, 0x43,
+      0x24, 0x44, 0x25, 0x45, 0x26, 0x46, 0x27, 0x47, 0x28, 0x48, 0x29, 0x49, 0x2a, 0x4a, 0x30, 0x50,
+      0x31, 0x51, 0x32, 0x52, 0x33, 0x53, 0x34, 0x54, 0x35, 0x55, 0x36, 0x56, 0x37, 0x57, 0x38, 0x58,
+      0x39, 0x59, 0x3a, 0x5a, 0x40, 0x60, 0x41, 0x61, 0x42, 0x62, 0x43, 0x63, 0x44, 0x64, 0x45, 0x65,
+      0x46, 0x66, 0x47, 0x67, 0x48, 0x68, 0x49, 0x69, 0x4a, 0x6a, 0x50, 0x70, 0x51, 0x71, 0x52, 0x72,
+      0x53, 0x73, 0x54, 0x74, 0x55, 0x75, 0x56, 0x76, 0x57, 0x77, 0x58, 0x78, 0x59, 0x79, 0x5a, 0x7a,
+      0x60, 0x80, 0x61, 0x81, 0x62, 0x82, 0x63, 0x83, 0x64, 0x84, 0x65, 0x85, 0x66, 0x86, 0x67, 0x87,
+      0x68, 0x88, 0x69, 0x89, 0x6a, 0x8a, 0x70, 0x90, 0x71, 0x91, 0x72, 0x92, 0x73, 0x93, 0x74, 0x94,
+      0x75, 0x95, 0x76, 0x96, 0x77, 0x97, 0x78, 0x98, 0x79, 0x99, 0x7a, 0x9a, 0x80, 0xa0, 0x81, 0xa1,
+      0x82, 0xa2, 0x83, 0xa3, 0x84, 0xa4, 0x85, 0xa5, 0x86, 0xa6, 0x87, 0xa7, 0x88, 0xa8, 0x89, 0xa9,
+      0x8a, 0xaa, 0x90, 0xb0, 0x91, 0xb1, 0x92, 0xb2, 0x93, 0xb3, 0x94, 0xb4, 0x95, 0xb5, 0x96, 0xb6,
+      0x97, 0xb7, 0x98, 0xb8, 0x99, 0xb9, 0x9a, 0xba,
+    };
+
+    static const double gradleg_quad_coefs[] =
+    {
+      0.49999999999999983, -0.5000000000000004, -0.49999999999999983, 0.5000000000000004,
+      -0.49999999999999983, -0.5000000000000004, 0.49999999999999983, 0.5000000000000004,
+      0.6123724356957951, -0.6123724356957952, 0.6123724356957951, -0.6123724356957952,
+      -0.20412414523193162, 0.20412414523193165, -0.20412414523193162, 0.20412414523193165,
+      0.6123724356957951, 0.6123724356957954, 0.6123724356957951, 0.6123724356957954,
+      0.20412414523193162, -0.20412414523193165, 0.20412414523193162, -0.20412414523193165,
+      0.7905694150420954, -0.7905694150420958, -0.7905694150420954, 0.7905694150420958,
+      -0.15811388300841883, 0.1581138830084189, 0.15811388300841883, -0.1581138830084189,
+      -0.7905694150420957, -0.7905694150420961, 0.7905694150420957, 0.7905694150420961,
+      -0.15811388300841883, 0.1581138830084189, 0.15811388300841883, -0.1581138830084189,
+      0.9354143466934866, -0.9354143466934876, 0.9354143466934866, -0.9354143466934876,
+      -0.1336306209562125, 0.13363062095621225, -0.1336306209562125, 0.13363062095621225,
+      0.9354143466934866, 0.9354143466934872, 0.9354143466934866, 0.9354143466934872,
+      0.1336306209562125, -0.13363062095621225, 0.1336306209562125, -0.13363062095621225,
+      1.0606601717798234, -1.0606601717798232, -1.0606601717798234, 1.0606601717798232,
+      -0.1178511301977578, 0.11785113019775785, 0.1178511301977578, -0.11785113019775785,
+      -1.0606601717798234, -1.0606601717798232, 1.0606601717798234, 1.0606601717798232,
+      -0.1178511301977578, 0.11785113019775785, 0.1178511301977578, -0.11785113019775785,
+      1.17260393995586, -1.1726039399558594, 1.17260393995586, -1.1726039399558594,
+      -0.10660035817780526, 0.10660035817780518, -0.10660035817780526, 0.10660035817780518,
+      1.1726039399558603, 1.1726039399558597, 1.1726039399558603, 1.1726039399558597,
+      0.10660035817780526, -0.10660035817780518, 0.10660035817780526, -0.10660035817780518,
+      1.2747548783981972, -1.274754878398199, -1.2747548783981972, 1.274754878398199,
+      -0.09805806756909204, 0.09805806756909212, 0.09805806756909204, -0.09805806756909212,
+      -1.2747548783981972, -1.274754878398199, 1.2747548783981972, 1.274754878398199,
+      -0.09805806756909204, 0.09805806756909212, 0.09805806756909204, -0.09805806756909212,
+      1.3693063937629186, -1.369306393762918, 1.3693063937629186, -1.369306393762918,
+      -0.09128709291752785, 0.09128709291752761, -0.09128709291752785, 0.09128709291752761,
+      1.3693063937629182, 1.3693063937629177, 1.3693063937629182, 1.3693063937629177,
+      0.09128709291752785, -0.09128709291752761, 0.09128709291752785, -0.09128709291752761,
+      1.4577379737113292, -1.4577379737113285, -1.4577379737113292, 1.4577379737113285,
+      -0.08574929257125438, 0.08574929257125458, 0.08574929257125438, -0.08574929257125458,
+      -1.4577379737113292, -1.457737973711329, 1.4577379737113292, 1.457737973711329,
+      -0.08574929257125438, 0.08574929257125458, 0.08574929257125438, -0.08574929257125458,
+      1.541103500742242, -1.541103500742243, 1.541103500742242, -1.541103500742243,
+      -0.08111071056538147, 0.08111071056538108, -0.08111071056538147, 0.08111071056538108,
+      1.541103500742242, 1.541103500742242, 1.541103500742242, 1.541103500742242,
+      0.08111071056538147, -0.08111071056538108, 0.08111071056538147, -0.08111071056538108,
+      1.6201851746019738, -1.6201851746019758, -1.6201851746019738, 1.6201851746019758,
+      -0.07715167498104578, 0.07715167498104572, 0.07715167498104578, -0.07715167498104572,
+      -1.620185174601974, -1.620185174601976, 1.620185174601974, 1.620185174601976,
+      -0.07715167498104578, 0.07715167498104572, 0.07715167498104578, -0.07715167498104572,
+      -0.40824829046386324, 0.4082482904638633, -0.31622776601683766, 0.3162277660168378,
+      -0.267261241912425, 0.2672612419124245, -0.2357022603955156, 0.2357022603955157,
+      -0.21320071635561053, 0.21320071635561036, -0.19611613513818407, 0.19611613513818424,
+      -0.1825741858350557, 0.18257418583505522, -0.17149858514250876, 0.17149858514250915,
+      -0.16222142113076293, 0.16222142113076216, -0.15430334996209155, 0.15430334996209144,
+      -0.40824829046386324, 0.4082482904638627, -0.3162277660168379, 0.31622776601683816,
+      -0.26726124191242456, 0.26726124191242445, -0.23570226039551578, 0.235702260395516,
+      -0.2132007163556107, 0.2132007163556104, -0.19611613513818385, 0.19611613513818432,
+      -0.18257418583505572, 0.18257418583505536, -0.1714985851425089, 0.17149858514250915,
+      -0.16222142113076252, 0.16222142113076196, -0.15430334996209158, 0.1543033499620916,
+      -0.4082482904638636, 0.4082482904638634, -0.3162277660168384, 0.31622776601683794,
+      -0.26726124191242473, 0.26726124191242473, -0.23570226039551623, 0.23570226039551612,
+      -0.21320071635561091, 0.2132007163556105, -0.1961161351381844, 0.19611613513818404,
+      -0.1825741858350558, 0.1825741858350555, -0.17149858514250912, 0.17149858514250957,
+      -0.16222142113076277, 0.1622214211307625, -0.1543033499620915, 0.1543033499620917,
+      -0.4082482904638631, 0.4082482904638637, -0.31622776601683805, 0.3162277660168381,
+      -0.26726124191242495, 0.26726124191242484, -0.23570226039551617, 0.2357022603955163,
+      -0.21320071635561091, 0.21320071635561078, -0.19611613513818454, 0.1961161351381841,
+      -0.1825741858350559, 0.18257418583505552, -0.1714985851425088, 0.17149858514250935,
+      -0.16222142113076288, 0.1622214211307624, -0.15430334996209147, 0.15430334996209172,
+      -0.4082482904638635, 0.40824829046386346, -0.31622776601683855, 0.316227766016838,
+      -0.26726124191242456, 0.2672612419124247, -0.23570226039551614, 0.2357022603955162,
+      -0.2132007163556109, 0.21320071635561044, -0.19611613513818427, 0.19611613513818424,
+      -0.18257418583505583, 0.1825741858350552, -0.17149858514250912, 0.17149858514250896,
+      -0.1622214211307631, 0.16222142113076254, -0.1543033499620916, 0.1543033499620917,
+      -0.40824829046386385, 0.4082482904638635, -0.31622776601683805, 0.3162277660168381,
+      -0.2672612419124248, 0.26726124191242456, -0.23570226039551617, 0.23570226039551576,
+      -0.21320071635561055, 0.21320071635561078, -0.1961161351381844, 0.19611613513818443,
+      -0.18257418583505564, 0.18257418583505544, -0.17149858514250918, 0.1714985851425094,
+      -0.1622214211307629, 0.1622214211307623, -0.15430334996209177, 0.15430334996209158,
+      -0.4082482904638635, 0.40824829046386407, -0.31622776601683766, 0.31622776601683833,
+      -0.2672612419124245, 0.2672612419124249, -0.23570226039551612, 0.23570226039551628,
+      -0.21320071635561055, 0.21320071635561083, -0.19611613513818438, 0.19611613513818418,
+      -0.18257418583505566, 0.1825741858350555, -0.17149858514250924, 0.17149858514250943,
+      -0.16222142113076288, 0.16222142113076227, -0.1543033499620916, 0.15430334996209158,
+      -0.4082482904638639, 0.40824829046386424, -0.3162277660168382, 0.31622776601683905,
+      -0.267261241912425, 0.2672612419124249, -0.23570226039551626, 0.23570226039551623,
+      -0.2132007163556109, 0.21320071635561091, -0.19611613513818454, 0.1961161351381842,
+      -0.18257418583505575, 0.18257418583505564, -0.17149858514250904, 0.17149858514250926,
+      -0.16222142113076296, 0.16222142113076254, -0.15430334996209175, 0.15430334996209186,
+      -0.40824829046386446, 0.408248290463864, -0.31622776601683905, 0.31622776601683833,
+      -0.2672612419124251, 0.26726124191242473, -0.23570226039551634, 0.23570226039551645,
+      -0.21320071635561097, 0.2132007163556108, -0.1961161351381845, 0.19611613513818446,
+      -0.18257418583505583, 0.1825741858350557, -0.17149858514250912, 0.1714985851425093,
+      -0.16222142113076307, 0.16222142113076266, -0.15430334996209188, 0.15430334996209208,
+      -0.4082482904638627, 0.40824829046386235, -0.31622776601683694, 0.3162277660168369,
+      -0.2672612419124238, 0.26726124191242395, -0.2357022603955153, 0.23570226039551556,
+      -0.21320071635561008, 0.21320071635561014, -0.19611613513818363, 0.19611613513818393,
+      -0.18257418583505508, 0.18257418583505483, -0.17149858514250846, 0.17149858514250876,
+      -0.16222142113076213, 0.16222142113076182, -0.15430334996209108, 0.1543033499620912,
+      -0.40824829046386507, 0.40824829046386524, -0.31622776601683944, 0.3162277660168391,
+      -0.26726124191242584, 0.26726124191242584, -0.23570226039551717, 0.23570226039551728,
+      -0.21320071635561186, 0.2132007163556116, -0.19611613513818532, 0.19611613513818513,
+      -0.18257418583505658, 0.18257418583505627, -0.17149858514250985, 0.17149858514250998,
+      -0.16222142113076365, 0.16222142113076304, -0.15430334996209233, 0.15430334996209233,
+      0.49999999999999967, 0.49999999999999983, -0.49999999999999967, -0.49999999999999983,
+      -0.5000000000000002, 0.5000000000000006, 0.5000000000000002, -0.5000000000000006,
+      0.20412414523193162, -0.2041241452319315, 0.20412414523193162, -0.2041241452319315,
+      0.6123724356957935, 0.6123724356957945, 0.6123724356957935, 0.6123724356957945,
+      -0.20412414523193162, 0.2041241452319315, -0.20412414523193162, 0.2041241452319315,
+      0.6123724356957959, -0.6123724356957957, 0.6123724356957959, -0.6123724356957957,
+      0.15811388300841883, -0.1581138830084188, -0.15811388300841883, 0.1581138830084188,
+      0.7905694150420953, 0.7905694150420968, -0.7905694150420953, -0.7905694150420968,
+      0.15811388300841883, -0.1581138830084188, -0.15811388300841883, 0.1581138830084188,
+      -0.7905694150420961, 0.7905694150420961, 0.7905694150420961, -0.7905694150420961,
+      0.13363062095621234, -0.13363062095621228, 0.13363062095621234, -0.13363062095621228,
+      0.9354143466934872, 0.9354143466934852, 0.9354143466934872, 0.9354143466934852,
+      -0.13363062095621234, 0.13363062095621228, -0.13363062095621234, 0.13363062095621228,
+      0.9354143466934854, -0.9354143466934872, 0.9354143466934854, -0.9354143466934872,
+      0.11785113019775792, -0.11785113019775782, -0.11785113019775792, 0.11785113019775782,
+      1.0606601717798239, 1.0606601717798252, -1.0606601717798239, -1.0606601717798252,
+      0.11785113019775792, -0.11785113019775782, -0.11785113019775792, 0.11785113019775782,
+      -1.060660171779823, 1.0606601717798232, 1.060660171779823, -1.0606601717798232,
+      0.10660035817780524, -0.10660035817780514, 0.10660035817780524, -0.10660035817780514,
+      1.1726039399558608, 1.17260393995586, 1.1726039399558608, 1.17260393995586,
+      -0.10660035817780524, 0.10660035817780514, -0.10660035817780524, 0.10660035817780514,
+      1.1726039399558603, -1.1726039399558603, 1.1726039399558603, -1.1726039399558603,
+      0.09805806756909222, -0.09805806756909216, -0.09805806756909222, 0.09805806756909216,
+      1.274754878398199, 1.2747548783981992, -1.274754878398199, -1.2747548783981992,
+      0.09805806756909222, -0.09805806756909216, -0.09805806756909222, 0.09805806756909216,
+      -1.2747548783982, 1.2747548783981983, 1.2747548783982, -1.2747548783981983,
+      0.09128709291752786, -0.09128709291752769, 0.09128709291752786, -0.09128709291752769,
+      1.3693063937629197, 1.3693063937629175, 1.3693063937629197, 1.3693063937629175,
+      -0.09128709291752786, 0.09128709291752769, -0.09128709291752786, 0.09128709291752769,
+      1.3693063937629182, -1.3693063937629184, 1.3693063937629182, -1.3693063937629184,
+      0.08574929257125438, -0.08574929257125467, -0.08574929257125438, 0.08574929257125467,
+      1.4577379737113279, 1.4577379737113276, -1.4577379737113279, -1.4577379737113276,
+      0.08574929257125438, -0.08574929257125467, -0.08574929257125438, 0.08574929257125467,
+      -1.4577379737113296, 1.45773797371133, 1.4577379737113296, -1.45773797371133,
+      0.08111071056538141, -0.0811107105653811, 0.08111071056538141, -0.0811107105653811,
+      1.54110350074224, 1.5411035007422405, 1.54110350074224, 1.5411035007422405,
+      -0.08111071056538141, 0.0811107105653811, -0.08111071056538141, 0.0811107105653811,
+      1.5411035007422411, -1.5411035007422424, 1.5411035007422411, -1.5411035007422424,
+      0.07715167498104576, -0.07715167498104566, -0.07715167498104576, 0.07715167498104566,
+      1.620185174601976, 1.6201851746019762, -1.620185174601976, -1.6201851746019762,
+      0.07715167498104576, -0.07715167498104566, -0.07715167498104576, 0.07715167498104566,
+      -1.620185174601976, 1.6201851746019758, 1.620185174601976, -1.6201851746019758,
+      -0.40824829046386324, 0.408248290463863, -0.4082482904638634, 0.40824829046386296,
+      -0.40824829046386363, 0.4082482904638638, -0.4082482904638634, 0.4082482904638637,
+      -0.40824829046386374, 0.4082482904638635, -0.40824829046386374, 0.40824829046386346,
+      -0.4082482904638638, 0.4082482904638639, -0.40824829046386396, 0.40824829046386424,
+      -0.4082482904638645, 0.40824829046386407, -0.4082482904638624, 0.4082482904638625,
+      -0.408248290463865, 0.4082482904638653, -0.31622776601683766, 0.3162277660168376,
+      -0.3162277660168385, 0.3162277660168376, -0.31622776601683794, 0.31622776601683833,
+      -0.31622776601683844, 0.3162277660168378, -0.3162277660168389, 0.31622776601683794,
+      -0.31622776601683844, 0.31622776601683833, -0.3162277660168381, 0.3162277660168383,
+      -0.31622776601683855, 0.31622776601683916, -0.3162277660168388, 0.3162277660168392,
+      -0.316227766016837, 0.316227766016837, -0.31622776601683955, 0.31622776601683944,
+      -0.2672612419124247, 0.26726124191242456, -0.26726124191242456, 0.2672612419124244,
+      -0.267261241912425, 0.26726124191242473, -0.26726124191242506, 0.26726124191242456,
+      -0.2672612419124244, 0.2672612419124246, -0.26726124191242456, 0.26726124191242445,
+      -0.26726124191242456, 0.2672612419124245, -0.2672612419124249, 0.26726124191242495,
+      -0.26726124191242523, 0.26726124191242445, -0.26726124191242395, 0.26726124191242423,
+      -0.2672612419124261, 0.2672612419124261, -0.23570226039551584, 0.23570226039551564,
+      -0.2357022603955157, 0.23570226039551598, -0.23570226039551628, 0.23570226039551614,
+      -0.23570226039551628, 0.23570226039551626, -0.23570226039551628, 0.23570226039551614,
+      -0.2357022603955161, 0.2357022603955159, -0.23570226039551592, 0.2357022603955163,
+      -0.23570226039551614, 0.23570226039551637, -0.23570226039551634, 0.2357022603955163,
+      -0.23570226039551528, 0.2357022603955156, -0.23570226039551717, 0.23570226039551734,
+      -0.21320071635561047, 0.21320071635561028, -0.21320071635561075, 0.21320071635561058,
+      -0.21320071635561078, 0.21320071635561041, -0.21320071635561078, 0.21320071635561066,
+      -0.2132007163556109, 0.2132007163556105, -0.2132007163556106, 0.2132007163556106,
+      -0.21320071635561058, 0.21320071635561103, -0.21320071635561091, 0.213200716355611,
+      -0.21320071635561114, 0.21320071635561083, -0.21320071635561033, 0.21320071635561016,
+      -0.21320071635561172, 0.2132007163556117, -0.19611613513818443, 0.19611613513818432,
+      -0.19611613513818424, 0.19611613513818435, -0.1961161351381845, 0.19611613513818432,
+      -0.19611613513818452, 0.19611613513818424, -0.19611613513818438, 0.19611613513818435,
+      -0.19611613513818443, 0.1961161351381845, -0.19611613513818418, 0.19611613513818418,
+      -0.19611613513818452, 0.19611613513818413, -0.19611613513818443, 0.1961161351381842,
+      -0.19611613513818363, 0.19611613513818374, -0.1961161351381853, 0.19611613513818515,
+      -0.18257418583505572, 0.18257418583505539, -0.18257418583505547, 0.18257418583505516,
+      -0.18257418583505572, 0.18257418583505564, -0.1825741858350557, 0.1825741858350554,
+      -0.18257418583505577, 0.18257418583505555, -0.18257418583505602, 0.1825741858350555,
+      -0.1825741858350558, 0.18257418583505525, -0.18257418583505594, 0.18257418583505577,
+      -0.18257418583505575, 0.18257418583505547, -0.1825741858350555, 0.18257418583505494,
+      -0.18257418583505688, 0.1825741858350562, -0.17149858514250876, 0.17149858514250935,
+      -0.171498585142509, 0.17149858514250926, -0.17149858514250915, 0.17149858514250943,
+      -0.17149858514250887, 0.1714985851425092, -0.1714985851425092, 0.17149858514250907,
+      -0.17149858514250915, 0.1714985851425094, -0.17149858514250924, 0.17149858514250946,
+      -0.17149858514250899, 0.17149858514250926, -0.17149858514250915, 0.17149858514250943,
+      -0.17149858514250862, 0.1714985851425088, -0.1714985851425099, 0.1714985851425101,
+      -0.16222142113076282, 0.1622214211307622, -0.16222142113076288, 0.16222142113076193,
+      -0.16222142113076293, 0.16222142113076224, -0.16222142113076288, 0.16222142113076238,
+      -0.1622214211307628, 0.1622214211307623, -0.1622214211307627, 0.16222142113076232,
+      -0.16222142113076302, 0.16222142113076232, -0.16222142113076285, 0.16222142113076238,
+      -0.162221421130763, 0.16222142113076243, -0.16222142113076216, 0.1622214211307619,
+      -0.16222142113076338, 0.16222142113076302, -0.15430334996209152, 0.15430334996209133,
+      -0.1543033499620914, 0.15430334996209155, -0.15430334996209144, 0.15430334996209158,
+      -0.15430334996209158, 0.15430334996209197, -0.15430334996209152, 0.15430334996209155,
+      -0.15430334996209175, 0.15430334996209177, -0.15430334996209183, 0.15430334996209155,
+      -0.1543033499620917, 0.15430334996209175, -0.1543033499620918, 0.1543033499620918,
+      -0.15430334996209136, 0.15430334996209089, -0.15430334996209255, 0.1543033499620926,
+    };
+
+    static const Shapeset::PolynomialTable gradleg_quad_polynomials = { 308, gradleg_quad_start, gradleg_quad_degrees, gradleg_quad_coefs };
+
     void check_gradleg_tri(Shapeset* shapeset)
     {
       for (int i = 1; i <= 10; i++)
@@ -15788,17 +2678,7 @@ namespace Hermes
           throw Hermes::Exceptions::Exception("Wrong bubble count");
       }
 
-      int size_a  = sizeof(gradleg_tri_fn_a)  / sizeof(Shapeset::shape_fn_t);
-      int size_b  = sizeof(gradleg_tri_fn_b)  / sizeof(Shapeset::shape_fn_t);
-      int size_ax = sizeof(gradleg_tri_fn_ax) / sizeof(Shapeset::shape_fn_t);
-      int size_bx = sizeof(gradleg_tri_fn_bx) / sizeof(Shapeset::shape_fn_t);
-      int size_ay = sizeof(gradleg_tri_fn_ay) / sizeof(Shapeset::shape_fn_t);
-      int size_by = sizeof(gradleg_tri_fn_by) / sizeof(Shapeset::shape_fn_t);
-
-      if(size_a != size_b || size_a != size_ax || size_a != size_bx || size_a != size_ay || size_a != size_by)
-        throw Hermes::Exceptions::Exception("Function tables dont have equal length.");
-
-      if(size_a != gradleg_tri_bubble_indices[10][gradleg_tri_bubble_count[10]-1] + 1)
+      if(gradleg_tri_polynomials.num_indices != gradleg_tri_bubble_indices[10][gradleg_tri_bubble_count[10]-1] + 1)
         throw Hermes::Exceptions::Exception("Bad index of last bubble");
     }
 
@@ -15806,12 +2686,8 @@ namespace Hermes
 
     HcurlShapesetGradLeg::HcurlShapesetGradLeg()
     {
-      shape_table[0] = gradleg_shape_fn_table;
-      shape_table[1] = gradleg_shape_fn_table_x;
-      shape_table[2] = gradleg_shape_fn_table_y;
-      shape_table[3] = NULL;
-      shape_table[4] = NULL;
-      shape_table[5] = NULL;
+      polynomial_table[HERMES_MODE_TRIANGLE] = &gradleg_tri_polynomials;
+      polynomial_table[HERMES_MODE_QUAD] = &gradleg_quad_polynomials;
 
       vertex_indices = gradleg_vertex_indices;
       edge_indices = gradleg_edge_indices;
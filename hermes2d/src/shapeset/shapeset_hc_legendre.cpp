@@ -14,16283 +14,68 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "global.h"
-#include "shapeset_common.h"
 #include "shapeset_hc_all.h"
 namespace Hermes
 {
   namespace Hermes2D
   {
-    // Shape functions for the curl operator for triangles, based on Legendre polynomials
 
-    //Shape functions
-
-    // ORDER 0
-
-    // Edge functions, order 0 (Whitney functions)
-
-    // number 1
-    inline double leg_tri_f1_a0(double x, double y)
-    {
-      return (psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_b0(double x, double y)
-    {
-      return (psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_a1(double x, double y)
-    {
-      return -leg_tri_f1_a0(x, y);
-    }
-
-    inline double leg_tri_f1_b1(double x, double y)
-    {
-      return -leg_tri_f1_b0(x, y);
-    }
-
-    inline double leg_tri_f1_ax0(double x, double y)
-    {
-      return (psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_ay0(double x, double y)
-    {
-      return (psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_bx0(double x, double y)
-    {
-      return (psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_by0(double x, double y)
-    {
-      return (psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f1_ax1(double x, double y)
-    {
-     return -leg_tri_f1_ax0(x, y);
-    }
-
-    inline double leg_tri_f1_ay1(double x, double y)
-    {
-     return -leg_tri_f1_ay0(x, y);
-    }
-
-    inline double leg_tri_f1_bx1(double x, double y)
-    {
-     return -leg_tri_f1_bx0(x, y);
-    }
-
-    inline double leg_tri_f1_by1(double x, double y)
-    {
-     return -leg_tri_f1_by0(x, y);
-    }
-
-    // number 2
-    inline double leg_tri_f2_a0(double x, double y)
-    {
-      return (psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_b0(double x, double y)
-    {
-      return (psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_a1(double x, double y)
-    {
-      return -leg_tri_f2_a0(x, y);
-    }
-
-    inline double leg_tri_f2_b1(double x, double y)
-    {
-      return -leg_tri_f2_b0(x, y);
-    }
-
-    inline double leg_tri_f2_ax0(double x, double y)
-    {
-      return (psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_ay0(double x, double y)
-    {
-      return (psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_bx0(double x, double y)
-    {
-      return (psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_by0(double x, double y)
-    {
-      return (psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f2_ax1(double x, double y)
-    {
-     return -leg_tri_f2_ax0(x, y);
-    }
-
-    inline double leg_tri_f2_ay1(double x, double y)
-    {
-     return -leg_tri_f2_ay0(x, y);
-    }
-
-    inline double leg_tri_f2_bx1(double x, double y)
-    {
-     return -leg_tri_f2_bx0(x, y);
-    }
-
-    inline double leg_tri_f2_by1(double x, double y)
-    {
-     return -leg_tri_f2_by0(x, y);
-    }
-
-    // number 3
-    inline double leg_tri_f3_a0(double x, double y)
-    {
-      return (psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_b0(double x, double y)
-    {
-      return (psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_a1(double x, double y)
-    {
-      return -leg_tri_f3_a0(x, y);
-    }
-
-    inline double leg_tri_f3_b1(double x, double y)
-    {
-      return -leg_tri_f3_b0(x, y);
-    }
-
-    inline double leg_tri_f3_ax0(double x, double y)
-    {
-      return (psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_ay0(double x, double y)
-    {
-      return (psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_bx0(double x, double y)
-    {
-      return (psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_by0(double x, double y)
-    {
-      return (psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f3_ax1(double x, double y)
-    {
-     return -leg_tri_f3_ax0(x, y);
-    }
-
-    inline double leg_tri_f3_ay1(double x, double y)
-    {
-     return -leg_tri_f3_ay0(x, y);
-    }
-
-    inline double leg_tri_f3_bx1(double x, double y)
-    {
-     return -leg_tri_f3_bx0(x, y);
-    }
-
-    inline double leg_tri_f3_by1(double x, double y)
-    {
-     return -leg_tri_f3_by0(x, y);
-    }
-
-    // ORDER 1
-
-    // Edge functions, order 1
-
-    // number 4
-    inline double leg_tri_f4_a(double x, double y)
-    {
-      return (psi1e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f4_b(double x, double y)
-    {
-      return (psi1e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f4_ax(double x, double y)
-    {
-      return (psi1e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f4_ay(double x, double y)
-    {
-      return (psi1e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f4_bx(double x, double y)
-    {
-      return (psi1e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f4_by(double x, double y)
-    {
-      return (psi1e1y_2(x, y)) / 1.0;
-    }
-
-    // number 5
-    inline double leg_tri_f5_a(double x, double y)
-    {
-      return (psi1e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f5_b(double x, double y)
-    {
-      return (psi1e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f5_ax(double x, double y)
-    {
-      return (psi1e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f5_ay(double x, double y)
-    {
-      return (psi1e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f5_bx(double x, double y)
-    {
-      return (psi1e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f5_by(double x, double y)
-    {
-      return (psi1e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    // number 6
-    inline double leg_tri_f6_a(double x, double y)
-    {
-      return (psi1e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f6_b(double x, double y)
-    {
-      return (psi1e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f6_ax(double x, double y)
-    {
-      return (psi1e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f6_ay(double x, double y)
-    {
-      return (psi1e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f6_bx(double x, double y)
-    {
-      return (psi1e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f6_by(double x, double y)
-    {
-      return (psi1e3y_2(x, y)) / 1.0;
-    }
-
-    // ORDER 2
-
-    // Edge functions, order 2
-
-    // number 7
-    inline double leg_tri_f7_a0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L3 - L2); q2 = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_b0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L3 - L2); q2 = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_a1(double x, double y)
-    {
-      return -leg_tri_f7_a0(x, y);
-    }
-
-    inline double leg_tri_f7_b1(double x, double y)
-    {
-      return -leg_tri_f7_b0(x, y);
-    }
-
-    inline double leg_tri_f7_ax0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L3 - L2);
-      cx = 1.0 / 2.0 * Legendre0x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_ay0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L3 - L2);
-      cy = 1.0 / 2.0 * Legendre0x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_bx0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L3 - L2);
-      cx = 1.0 / 2.0 * Legendre0x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_by0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L3 - L2);
-      cy = 1.0 / 2.0 * Legendre0x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f7_ax1(double x, double y)
-    {
-      return -leg_tri_f7_ax0(x, y);
-    }
-
-    inline double leg_tri_f7_ay1(double x, double y)
-    {
-      return -leg_tri_f7_ay0(x, y);
-    }
-
-    inline double leg_tri_f7_bx1(double x, double y)
-    {
-      return -leg_tri_f7_bx0(x, y);
-    }
-
-    inline double leg_tri_f7_by1(double x, double y)
-    {
-      return -leg_tri_f7_by0(x, y);
-    }
-
-    // number 8
-    inline double leg_tri_f8_a0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L1 - L3); q2 = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_b0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L1 - L3); q2 = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_a1(double x, double y)
-    {
-      return -leg_tri_f8_a0(x, y);
-    }
-
-    inline double leg_tri_f8_b1(double x, double y)
-    {
-      return -leg_tri_f8_b0(x, y);
-    }
-
-    inline double leg_tri_f8_ax0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L1 - L3);
-      cx = 1.0 / 2.0 * Legendre0x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_ay0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L1 - L3);
-      cy = 1.0 / 2.0 * Legendre0x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_bx0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L1 - L3);
-      cx = 1.0 / 2.0 * Legendre0x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_by0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L1 - L3);
-      cy = 1.0 / 2.0 * Legendre0x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f8_ax1(double x, double y)
-    {
-      return -leg_tri_f8_ax0(x, y);
-    }
-
-    inline double leg_tri_f8_ay1(double x, double y)
-    {
-      return -leg_tri_f8_ay0(x, y);
-    }
-
-    inline double leg_tri_f8_bx1(double x, double y)
-    {
-      return -leg_tri_f8_bx0(x, y);
-    }
-
-    inline double leg_tri_f8_by1(double x, double y)
-    {
-      return -leg_tri_f8_by0(x, y);
-    }
-
-    // number 9
-    inline double leg_tri_f9_a0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L2 - L1); q2 = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_b0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 3.0 / 2.0 * Legendre1(L2 - L1); q2 = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_a1(double x, double y)
-    {
-      return -leg_tri_f9_a0(x, y);
-    }
-
-    inline double leg_tri_f9_b1(double x, double y)
-    {
-      return -leg_tri_f9_b0(x, y);
-    }
-
-    inline double leg_tri_f9_ax0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L2 - L1);
-      cx = 1.0 / 2.0 * Legendre0x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_ay0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L2 - L1);
-      cy = 1.0 / 2.0 * Legendre0x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_bx0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 3.0 / 2.0 * Legendre1x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 3.0 / 2.0 * Legendre1(L2 - L1);
-      cx = 1.0 / 2.0 * Legendre0x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_by0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 3.0 / 2.0 * Legendre1x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 3.0 / 2.0 * Legendre1(L2 - L1);
-      cy = 1.0 / 2.0 * Legendre0x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 1.0 / 2.0 * Legendre0(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f9_ax1(double x, double y)
-    {
-      return -leg_tri_f9_ax0(x, y);
-    }
-
-    inline double leg_tri_f9_ay1(double x, double y)
-    {
-      return -leg_tri_f9_ay0(x, y);
-    }
-
-    inline double leg_tri_f9_bx1(double x, double y)
-    {
-      return -leg_tri_f9_bx0(x, y);
-    }
-
-    inline double leg_tri_f9_by1(double x, double y)
-    {
-      return -leg_tri_f9_by0(x, y);
-    }
-
-    // Edge-base bubble functions (normal functions), order 2
-
-    // number 10
-    inline double leg_tri_f10_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre0(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f10_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre0(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f10_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre0(L3 - L2);
-      Legx = Legendre0x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f10_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre0(L3 - L2);
-      Legy = Legendre0x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f10_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre0(L3 - L2);
-      Legx = Legendre0x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f10_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre0(L3 - L2);
-      Legy = Legendre0x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 11
-    inline double leg_tri_f11_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre0(L1 - L3);
-      return (k * n21) / 1.4142135623731 *2.0;
-    }
-
-    inline double leg_tri_f11_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre0(L1 - L3);
-      return (k * n22) / 1.4142135623731 *2.0;
-    }
-
-    inline double leg_tri_f11_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre0(L1 - L3);
-      Legx = Legendre0x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731 *2.0;
-    }
-
-    inline double leg_tri_f11_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre0(L1 - L3);
-      Legy = Legendre0x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731 *2.0;
-    }
-
-    inline double leg_tri_f11_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre0(L1 - L3);
-      Legx = Legendre0x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731 *2.0;
-    }
-
-    inline double leg_tri_f11_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre0(L1 - L3);
-      Legy = Legendre0x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731 *2.0;
-    }
-
-    // number 12
-    inline double leg_tri_f12_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre0(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f12_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre0(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f12_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre0(L2 - L1);
-      Legx = Legendre0x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f12_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre0(L2 - L1);
-      Legy = Legendre0x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f12_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre0(L2 - L1);
-      Legx = Legendre0x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f12_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre0(L2 - L1);
-      Legy = Legendre0x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // ORDER 3
-
-    // Edge functions, order 3
-
-    // number 13
-    inline double leg_tri_f13_a(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L3 - L2); q2 = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f13_b(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L3 - L2); q2 = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f13_ax(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L3 - L2);
-      cx = 2.0 / 3.0 * Legendre1x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f13_ay(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L3 - L2);
-      cy = 2.0 / 3.0 * Legendre1x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f13_bx(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L3 - L2);
-      cx = 2.0 / 3.0 * Legendre1x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f13_by(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L3 - L2);
-      cy = 2.0 / 3.0 * Legendre1x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    // number 14
-    inline double leg_tri_f14_a(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L1 - L3); q2 = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f14_b(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L1 - L3); q2 = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f14_ax(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L1 - L3);
-      cx = 2.0 / 3.0 * Legendre1x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f14_ay(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L1 - L3);
-      cy = 2.0 / 3.0 * Legendre1x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f14_bx(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L1 - L3);
-      cx = 2.0 / 3.0 * Legendre1x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f14_by(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L1 - L3);
-      cy = 2.0 / 3.0 * Legendre1x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    // number 15
-    inline double leg_tri_f15_a(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L2 - L1); q2 = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f15_b(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 5.0 / 3.0 * Legendre2(L2 - L1); q2 = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f15_ax(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L2 - L1);
-      cx = 2.0 / 3.0 * Legendre1x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f15_ay(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L2 - L1);
-      cy = 2.0 / 3.0 * Legendre1x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f15_bx(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 5.0 / 3.0 * Legendre2x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 5.0 / 3.0 * Legendre2(L2 - L1);
-      cx = 2.0 / 3.0 * Legendre1x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f15_by(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 5.0 / 3.0 * Legendre2x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 5.0 / 3.0 * Legendre2(L2 - L1);
-      cy = 2.0 / 3.0 * Legendre1x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 2.0 / 3.0 * Legendre1(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    // Edge-base bubble functions (normal functions), order 3
-
-    // number 16
-    inline double leg_tri_f16_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre1(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f16_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre1(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f16_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre1(L3 - L2);
-      Legx = Legendre1x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f16_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre1(L3 - L2);
-      Legy = Legendre1x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f16_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre1(L3 - L2);
-      Legx = Legendre1x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f16_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre1(L3 - L2);
-      Legy = Legendre1x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 17
-    inline double leg_tri_f17_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre1(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f17_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre1(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f17_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre1(L1 - L3);
-      Legx = Legendre1x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f17_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre1(L1 - L3);
-      Legy = Legendre1x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f17_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre1(L1 - L3);
-      Legx = Legendre1x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f17_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre1(L1 - L3);
-      Legy = Legendre1x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 18
-    inline double leg_tri_f18_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre1(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f18_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre1(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f18_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre1(L2 - L1);
-      Legx = Legendre1x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f18_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre1(L2 - L1);
-      Legy = Legendre1x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f18_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre1(L2 - L1);
-      Legx = Legendre1x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f18_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre1(L2 - L1);
-      Legy = Legendre1x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 3
-
-    // number 19
-    inline double leg_tri_f19_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f19_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f19_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f19_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f19_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f19_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 20
-    inline double leg_tri_f20_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f20_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f20_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f20_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f20_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f20_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 4
-
-    // Edge functions, order 4
-
-    // number 21
-    inline double leg_tri_f21_a0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L3 - L2); q2 = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_b0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L3 - L2); q2 = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_a1(double x, double y)
-    {
-      return -leg_tri_f21_a0(x, y);
-    }
-
-    inline double leg_tri_f21_b1(double x, double y)
-    {
-      return -leg_tri_f21_b0(x, y);
-    }
-
-    inline double leg_tri_f21_ax0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L3 - L2);
-      cx = 3.0 / 4.0 * Legendre2x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_ay0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L3 - L2);
-      cy = 3.0 / 4.0 * Legendre2x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_bx0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L3 - L2);
-      cx = 3.0 / 4.0 * Legendre2x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_by0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L3 - L2);
-      cy = 3.0 / 4.0 * Legendre2x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f21_ax1(double x, double y)
-    {
-      return -leg_tri_f21_ax0(x, y);
-    }
-
-    inline double leg_tri_f21_ay1(double x, double y)
-    {
-      return -leg_tri_f21_ay0(x, y);
-    }
-
-    inline double leg_tri_f21_bx1(double x, double y)
-    {
-      return -leg_tri_f21_bx0(x, y);
-    }
-
-    inline double leg_tri_f21_by1(double x, double y)
-    {
-      return -leg_tri_f21_by0(x, y);
-    }
-
-    // number 22
-    inline double leg_tri_f22_a0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L1 - L3); q2 = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_b0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L1 - L3); q2 = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_a1(double x, double y)
-    {
-      return -leg_tri_f22_a0(x, y);
-    }
-
-    inline double leg_tri_f22_b1(double x, double y)
-    {
-      return -leg_tri_f22_b0(x, y);
-    }
-
-    inline double leg_tri_f22_ax0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L1 - L3);
-      cx = 3.0 / 4.0 * Legendre2x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_ay0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L1 - L3);
-      cy = 3.0 / 4.0 * Legendre2x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_bx0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L1 - L3);
-      cx = 3.0 / 4.0 * Legendre2x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_by0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L1 - L3);
-      cy = 3.0 / 4.0 * Legendre2x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f22_ax1(double x, double y)
-    {
-      return -leg_tri_f22_ax0(x, y);
-    }
-
-    inline double leg_tri_f22_ay1(double x, double y)
-    {
-      return -leg_tri_f22_ay0(x, y);
-    }
-
-    inline double leg_tri_f22_bx1(double x, double y)
-    {
-      return -leg_tri_f22_bx0(x, y);
-    }
-
-    inline double leg_tri_f22_by1(double x, double y)
-    {
-      return -leg_tri_f22_by0(x, y);
-    }
-
-    // number 23
-    inline double leg_tri_f23_a0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L2 - L1); q2 = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_b0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 7.0 / 4.0 * Legendre3(L2 - L1); q2 = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_a1(double x, double y)
-    {
-      return -leg_tri_f23_a0(x, y);
-    }
-
-    inline double leg_tri_f23_b1(double x, double y)
-    {
-      return -leg_tri_f23_b0(x, y);
-    }
-
-    inline double leg_tri_f23_ax0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L2 - L1);
-      cx = 3.0 / 4.0 * Legendre2x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_ay0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L2 - L1);
-      cy = 3.0 / 4.0 * Legendre2x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_bx0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 7.0 / 4.0 * Legendre3x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 7.0 / 4.0 * Legendre3(L2 - L1);
-      cx = 3.0 / 4.0 * Legendre2x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_by0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 7.0 / 4.0 * Legendre3x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 7.0 / 4.0 * Legendre3(L2 - L1);
-      cy = 3.0 / 4.0 * Legendre2x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 3.0 / 4.0 * Legendre2(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f23_ax1(double x, double y)
-    {
-      return -leg_tri_f23_ax0(x, y);
-    }
-
-    inline double leg_tri_f23_ay1(double x, double y)
-    {
-      return -leg_tri_f23_ay0(x, y);
-    }
-
-    inline double leg_tri_f23_bx1(double x, double y)
-    {
-      return -leg_tri_f23_bx0(x, y);
-    }
-
-    inline double leg_tri_f23_by1(double x, double y)
-    {
-      return -leg_tri_f23_by0(x, y);
-    }
-
-    // Edge-base bubble functions (normal functions), order 4
-
-    // number 24
-    inline double leg_tri_f24_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre2(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f24_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre2(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f24_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre2(L3 - L2);
-      Legx = Legendre2x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f24_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre2(L3 - L2);
-      Legy = Legendre2x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f24_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre2(L3 - L2);
-      Legx = Legendre2x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f24_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre2(L3 - L2);
-      Legy = Legendre2x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 25
-    inline double leg_tri_f25_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre2(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f25_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre2(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f25_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre2(L1 - L3);
-      Legx = Legendre2x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f25_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre2(L1 - L3);
-      Legy = Legendre2x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f25_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre2(L1 - L3);
-      Legx = Legendre2x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f25_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre2(L1 - L3);
-      Legy = Legendre2x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 26
-    inline double leg_tri_f26_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre2(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f26_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre2(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f26_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre2(L2 - L1);
-      Legx = Legendre2x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f26_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre2(L2 - L1);
-      Legy = Legendre2x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f26_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre2(L2 - L1);
-      Legx = Legendre2x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f26_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre2(L2 - L1);
-      Legy = Legendre2x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 4
-
-    // number 27
-    inline double leg_tri_f27_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f27_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f27_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f27_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f27_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f27_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 28
-    inline double leg_tri_f28_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f28_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f28_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f28_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f28_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f28_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 29
-    inline double leg_tri_f29_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f29_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f29_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f29_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f29_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f29_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 30
-    inline double leg_tri_f30_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f30_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f30_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f30_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f30_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f30_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 5
-
-    // Edge functions, order 5
-
-    // number 31
-    inline double leg_tri_f31_a(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L3 - L2); q2 = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f31_b(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L3 - L2); q2 = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f31_ax(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L3 - L2);
-      cx = 4.0 / 5.0 * Legendre3x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f31_ay(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L3 - L2);
-      cy = 4.0 / 5.0 * Legendre3x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f31_bx(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L3 - L2);
-      cx = 4.0 / 5.0 * Legendre3x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f31_by(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L3 - L2);
-      cy = 4.0 / 5.0 * Legendre3x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    // number 32
-    inline double leg_tri_f32_a(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L1 - L3); q2 = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f32_b(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L1 - L3); q2 = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f32_ax(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L1 - L3);
-      cx = 4.0 / 5.0 * Legendre3x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f32_ay(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L1 - L3);
-      cy = 4.0 / 5.0 * Legendre3x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f32_bx(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L1 - L3);
-      cx = 4.0 / 5.0 * Legendre3x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f32_by(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L1 - L3);
-      cy = 4.0 / 5.0 * Legendre3x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    // number 33
-    inline double leg_tri_f33_a(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L2 - L1); q2 = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f33_b(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 9.0 / 5.0 * Legendre4(L2 - L1); q2 = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f33_ax(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L2 - L1);
-      cx = 4.0 / 5.0 * Legendre3x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f33_ay(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L2 - L1);
-      cy = 4.0 / 5.0 * Legendre3x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f33_bx(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 9.0 / 5.0 * Legendre4x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 9.0 / 5.0 * Legendre4(L2 - L1);
-      cx = 4.0 / 5.0 * Legendre3x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f33_by(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 9.0 / 5.0 * Legendre4x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 9.0 / 5.0 * Legendre4(L2 - L1);
-      cy = 4.0 / 5.0 * Legendre3x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 4.0 / 5.0 * Legendre3(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    // Edge-base bubble functions (normal functions), order 5
-
-    // number 34
-    inline double leg_tri_f34_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre3(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f34_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre3(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f34_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre3(L3 - L2);
-      Legx = Legendre3x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f34_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre3(L3 - L2);
-      Legy = Legendre3x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f34_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre3(L3 - L2);
-      Legx = Legendre3x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f34_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre3(L3 - L2);
-      Legy = Legendre3x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 35
-    inline double leg_tri_f35_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre3(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f35_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre3(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f35_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre3(L1 - L3);
-      Legx = Legendre3x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f35_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre3(L1 - L3);
-      Legy = Legendre3x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f35_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre3(L1 - L3);
-      Legx = Legendre3x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f35_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre3(L1 - L3);
-      Legy = Legendre3x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 36
-    inline double leg_tri_f36_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre3(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f36_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre3(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f36_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre3(L2 - L1);
-      Legx = Legendre3x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f36_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre3(L2 - L1);
-      Legy = Legendre3x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f36_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre3(L2 - L1);
-      Legx = Legendre3x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f36_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre3(L2 - L1);
-      Legy = Legendre3x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 5
-
-    // number 37
-    inline double leg_tri_f37_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f37_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f37_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f37_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f37_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f37_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 38
-    inline double leg_tri_f38_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f38_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f38_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f38_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f38_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f38_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 39
-    inline double leg_tri_f39_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f39_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f39_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f39_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f39_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f39_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 40
-    inline double leg_tri_f40_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f40_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f40_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f40_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f40_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f40_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 41
-    inline double leg_tri_f41_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f41_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f41_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f41_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f41_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f41_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 42
-    inline double leg_tri_f42_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f42_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f42_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f42_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f42_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f42_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 6
-
-    // Edge functions, order 6
-
-    // number 43
-    inline double leg_tri_f43_a0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L3 - L2); q2 = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_b0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L3 - L2); q2 = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_a1(double x, double y)
-    {
-      return -leg_tri_f43_a0(x, y);
-    }
-
-    inline double leg_tri_f43_b1(double x, double y)
-    {
-      return -leg_tri_f43_b0(x, y);
-    }
-
-    inline double leg_tri_f43_ax0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L3 - L2);
-      cx = 5.0 / 6.0 * Legendre4x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_ay0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L3 - L2);
-      cy = 5.0 / 6.0 * Legendre4x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_bx0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L3 - L2);
-      cx = 5.0 / 6.0 * Legendre4x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_by0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L3 - L2);
-      cy = 5.0 / 6.0 * Legendre4x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f43_ax1(double x, double y)
-    {
-      return -leg_tri_f43_ax0(x, y);
-    }
-
-    inline double leg_tri_f43_ay1(double x, double y)
-    {
-      return -leg_tri_f43_ay0(x, y);
-    }
-
-    inline double leg_tri_f43_bx1(double x, double y)
-    {
-      return -leg_tri_f43_bx0(x, y);
-    }
-
-    inline double leg_tri_f43_by1(double x, double y)
-    {
-      return -leg_tri_f43_by0(x, y);
-    }
-
-    // number 44
-    inline double leg_tri_f44_a0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L1 - L3); q2 = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_b0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L1 - L3); q2 = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_a1(double x, double y)
-    {
-      return -leg_tri_f44_a0(x, y);
-    }
-
-    inline double leg_tri_f44_b1(double x, double y)
-    {
-      return -leg_tri_f44_b0(x, y);
-    }
-
-    inline double leg_tri_f44_ax0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L1 - L3);
-      cx = 5.0 / 6.0 * Legendre4x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_ay0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L1 - L3);
-      cy = 5.0 / 6.0 * Legendre4x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_bx0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L1 - L3);
-      cx = 5.0 / 6.0 * Legendre4x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_by0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L1 - L3);
-      cy = 5.0 / 6.0 * Legendre4x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f44_ax1(double x, double y)
-    {
-      return -leg_tri_f44_ax0(x, y);
-    }
-
-    inline double leg_tri_f44_ay1(double x, double y)
-    {
-      return -leg_tri_f44_ay0(x, y);
-    }
-
-    inline double leg_tri_f44_bx1(double x, double y)
-    {
-      return -leg_tri_f44_bx0(x, y);
-    }
-
-    inline double leg_tri_f44_by1(double x, double y)
-    {
-      return -leg_tri_f44_by0(x, y);
-    }
-
-    // number 45
-    inline double leg_tri_f45_a0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L2 - L1); q2 = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_b0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 11.0 / 6.0 * Legendre5(L2 - L1); q2 = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_a1(double x, double y)
-    {
-      return -leg_tri_f45_a0(x, y);
-    }
-
-    inline double leg_tri_f45_b1(double x, double y)
-    {
-      return -leg_tri_f45_b0(x, y);
-    }
-
-    inline double leg_tri_f45_ax0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L2 - L1);
-      cx = 5.0 / 6.0 * Legendre4x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_ay0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L2 - L1);
-      cy = 5.0 / 6.0 * Legendre4x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_bx0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 11.0 / 6.0 * Legendre5x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 11.0 / 6.0 * Legendre5(L2 - L1);
-      cx = 5.0 / 6.0 * Legendre4x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_by0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 11.0 / 6.0 * Legendre5x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 11.0 / 6.0 * Legendre5(L2 - L1);
-      cy = 5.0 / 6.0 * Legendre4x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 5.0 / 6.0 * Legendre4(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f45_ax1(double x, double y)
-    {
-      return -leg_tri_f45_ax0(x, y);
-    }
-
-    inline double leg_tri_f45_ay1(double x, double y)
-    {
-      return -leg_tri_f45_ay0(x, y);
-    }
-
-    inline double leg_tri_f45_bx1(double x, double y)
-    {
-      return -leg_tri_f45_bx0(x, y);
-    }
-
-    inline double leg_tri_f45_by1(double x, double y)
-    {
-      return -leg_tri_f45_by0(x, y);
-    }
-
-    // Edge-base bubble functions (normal functions), order 6
-
-    // number 46
-    inline double leg_tri_f46_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre4(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f46_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre4(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f46_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre4(L3 - L2);
-      Legx = Legendre4x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f46_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre4(L3 - L2);
-      Legy = Legendre4x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f46_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre4(L3 - L2);
-      Legx = Legendre4x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f46_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre4(L3 - L2);
-      Legy = Legendre4x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 47
-    inline double leg_tri_f47_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre4(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f47_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre4(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f47_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre4(L1 - L3);
-      Legx = Legendre4x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f47_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre4(L1 - L3);
-      Legy = Legendre4x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f47_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre4(L1 - L3);
-      Legx = Legendre4x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f47_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre4(L1 - L3);
-      Legy = Legendre4x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 48
-    inline double leg_tri_f48_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre4(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f48_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre4(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f48_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre4(L2 - L1);
-      Legx = Legendre4x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f48_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre4(L2 - L1);
-      Legy = Legendre4x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f48_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre4(L2 - L1);
-      Legx = Legendre4x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f48_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre4(L2 - L1);
-      Legy = Legendre4x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 6
-
-    // number 49
-    inline double leg_tri_f49_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f49_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f49_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f49_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f49_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f49_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 50
-    inline double leg_tri_f50_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f50_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f50_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f50_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f50_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f50_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 51
-    inline double leg_tri_f51_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f51_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f51_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f51_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f51_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f51_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 52
-    inline double leg_tri_f52_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f52_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f52_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f52_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f52_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f52_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 53
-    inline double leg_tri_f53_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f53_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f53_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f53_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f53_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f53_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 54
-    inline double leg_tri_f54_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f54_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f54_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f54_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f54_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f54_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 55
-    inline double leg_tri_f55_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f55_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f55_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f55_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f55_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f55_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 56
-    inline double leg_tri_f56_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f56_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f56_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f56_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f56_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f56_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 7
-
-    // Edge functions, order 7
-
-    // number 57
-    inline double leg_tri_f57_a(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L3 - L2); q2 = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f57_b(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L3 - L2); q2 = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f57_ax(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L3 - L2);
-      cx = 6.0 / 7.0 * Legendre5x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f57_ay(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L3 - L2);
-      cy = 6.0 / 7.0 * Legendre5x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f57_bx(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L3 - L2);
-      cx = 6.0 / 7.0 * Legendre5x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f57_by(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L3 - L2);
-      cy = 6.0 / 7.0 * Legendre5x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    // number 58
-    inline double leg_tri_f58_a(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L1 - L3); q2 = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f58_b(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L1 - L3); q2 = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f58_ax(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L1 - L3);
-      cx = 6.0 / 7.0 * Legendre5x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f58_ay(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L1 - L3);
-      cy = 6.0 / 7.0 * Legendre5x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f58_bx(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L1 - L3);
-      cx = 6.0 / 7.0 * Legendre5x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f58_by(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L1 - L3);
-      cy = 6.0 / 7.0 * Legendre5x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    // number 59
-    inline double leg_tri_f59_a(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L2 - L1); q2 = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f59_b(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 13.0 / 7.0 * Legendre6(L2 - L1); q2 = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f59_ax(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L2 - L1);
-      cx = 6.0 / 7.0 * Legendre5x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f59_ay(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L2 - L1);
-      cy = 6.0 / 7.0 * Legendre5x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f59_bx(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 13.0 / 7.0 * Legendre6x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 13.0 / 7.0 * Legendre6(L2 - L1);
-      cx = 6.0 / 7.0 * Legendre5x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f59_by(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 13.0 / 7.0 * Legendre6x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 13.0 / 7.0 * Legendre6(L2 - L1);
-      cy = 6.0 / 7.0 * Legendre5x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 6.0 / 7.0 * Legendre5(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    // Edge-base bubble functions (normal functions), order 7
-
-    // number 60
-    inline double leg_tri_f60_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre5(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f60_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre5(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f60_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre5(L3 - L2);
-      Legx = Legendre5x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f60_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre5(L3 - L2);
-      Legy = Legendre5x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f60_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre5(L3 - L2);
-      Legx = Legendre5x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f60_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre5(L3 - L2);
-      Legy = Legendre5x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 61
-    inline double leg_tri_f61_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre5(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f61_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre5(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f61_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre5(L1 - L3);
-      Legx = Legendre5x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f61_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre5(L1 - L3);
-      Legy = Legendre5x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f61_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre5(L1 - L3);
-      Legx = Legendre5x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f61_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre5(L1 - L3);
-      Legy = Legendre5x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 62
-    inline double leg_tri_f62_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre5(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f62_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre5(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f62_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre5(L2 - L1);
-      Legx = Legendre5x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f62_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre5(L2 - L1);
-      Legy = Legendre5x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f62_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre5(L2 - L1);
-      Legx = Legendre5x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f62_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre5(L2 - L1);
-      Legy = Legendre5x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 7
-
-    // number 63
-    inline double leg_tri_f63_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f63_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f63_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f63_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f63_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f63_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 64
-    inline double leg_tri_f64_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f64_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f64_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f64_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f64_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f64_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 65
-    inline double leg_tri_f65_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f65_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f65_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f65_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f65_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f65_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 66
-    inline double leg_tri_f66_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f66_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f66_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f66_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f66_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f66_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 67
-    inline double leg_tri_f67_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f67_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f67_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f67_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f67_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f67_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 68
-    inline double leg_tri_f68_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f68_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f68_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f68_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f68_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f68_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 69
-    inline double leg_tri_f69_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f69_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f69_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f69_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f69_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f69_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 70
-    inline double leg_tri_f70_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f70_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f70_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f70_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f70_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f70_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 71
-    inline double leg_tri_f71_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f71_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f71_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f71_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f71_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f71_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 72
-    inline double leg_tri_f72_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f72_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f72_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f72_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f72_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f72_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 8
-
-    // Edge functions, order 8
-
-    // number 73
-    inline double leg_tri_f73_a0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L3 - L2); q2 = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_b0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L3 - L2); q2 = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_a1(double x, double y)
-    {
-      return -leg_tri_f73_a0(x, y);
-    }
-
-    inline double leg_tri_f73_b1(double x, double y)
-    {
-      return -leg_tri_f73_b0(x, y);
-    }
-
-    inline double leg_tri_f73_ax0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L3 - L2);
-      cx = 7.0 / 8.0 * Legendre6x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_ay0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L3 - L2);
-      cy = 7.0 / 8.0 * Legendre6x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_bx0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L3 - L2);
-      cx = 7.0 / 8.0 * Legendre6x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_by0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L3 - L2);
-      cy = 7.0 / 8.0 * Legendre6x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f73_ax1(double x, double y)
-    {
-      return -leg_tri_f73_ax0(x, y);
-    }
-
-    inline double leg_tri_f73_ay1(double x, double y)
-    {
-      return -leg_tri_f73_ay0(x, y);
-    }
-
-    inline double leg_tri_f73_bx1(double x, double y)
-    {
-      return -leg_tri_f73_bx0(x, y);
-    }
-
-    inline double leg_tri_f73_by1(double x, double y)
-    {
-      return -leg_tri_f73_by0(x, y);
-    }
-
-    // number 74
-    inline double leg_tri_f74_a0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L1 - L3); q2 = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_b0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L1 - L3); q2 = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_a1(double x, double y)
-    {
-      return -leg_tri_f74_a0(x, y);
-    }
-
-    inline double leg_tri_f74_b1(double x, double y)
-    {
-      return -leg_tri_f74_b0(x, y);
-    }
-
-    inline double leg_tri_f74_ax0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L1 - L3);
-      cx = 7.0 / 8.0 * Legendre6x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_ay0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L1 - L3);
-      cy = 7.0 / 8.0 * Legendre6x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_bx0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L1 - L3);
-      cx = 7.0 / 8.0 * Legendre6x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_by0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L1 - L3);
-      cy = 7.0 / 8.0 * Legendre6x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f74_ax1(double x, double y)
-    {
-      return -leg_tri_f74_ax0(x, y);
-    }
-
-    inline double leg_tri_f74_ay1(double x, double y)
-    {
-      return -leg_tri_f74_ay0(x, y);
-    }
-
-    inline double leg_tri_f74_bx1(double x, double y)
-    {
-      return -leg_tri_f74_bx0(x, y);
-    }
-
-    inline double leg_tri_f74_by1(double x, double y)
-    {
-      return -leg_tri_f74_by0(x, y);
-    }
-
-    // number 75
-    inline double leg_tri_f75_a0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L2 - L1); q2 = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_b0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 15.0 / 8.0 * Legendre7(L2 - L1); q2 = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_a1(double x, double y)
-    {
-      return -leg_tri_f75_a0(x, y);
-    }
-
-    inline double leg_tri_f75_b1(double x, double y)
-    {
-      return -leg_tri_f75_b0(x, y);
-    }
-
-    inline double leg_tri_f75_ax0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L2 - L1);
-      cx = 7.0 / 8.0 * Legendre6x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_ay0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L2 - L1);
-      cy = 7.0 / 8.0 * Legendre6x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_bx0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 15.0 / 8.0 * Legendre7x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 15.0 / 8.0 * Legendre7(L2 - L1);
-      cx = 7.0 / 8.0 * Legendre6x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_by0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 15.0 / 8.0 * Legendre7x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 15.0 / 8.0 * Legendre7(L2 - L1);
-      cy = 7.0 / 8.0 * Legendre6x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 7.0 / 8.0 * Legendre6(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f75_ax1(double x, double y)
-    {
-      return -leg_tri_f75_ax0(x, y);
-    }
-
-    inline double leg_tri_f75_ay1(double x, double y)
-    {
-      return -leg_tri_f75_ay0(x, y);
-    }
-
-    inline double leg_tri_f75_bx1(double x, double y)
-    {
-      return -leg_tri_f75_bx0(x, y);
-    }
-
-    inline double leg_tri_f75_by1(double x, double y)
-    {
-      return -leg_tri_f75_by0(x, y);
-    }
-
-    // Edge-base bubble functions (normal functions), order 8
-
-    // number 76
-    inline double leg_tri_f76_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre6(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f76_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre6(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f76_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre6(L3 - L2);
-      Legx = Legendre6x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f76_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre6(L3 - L2);
-      Legy = Legendre6x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f76_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre6(L3 - L2);
-      Legx = Legendre6x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f76_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre6(L3 - L2);
-      Legy = Legendre6x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 77
-    inline double leg_tri_f77_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre6(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f77_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre6(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f77_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre6(L1 - L3);
-      Legx = Legendre6x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f77_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre6(L1 - L3);
-      Legy = Legendre6x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f77_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre6(L1 - L3);
-      Legx = Legendre6x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f77_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre6(L1 - L3);
-      Legy = Legendre6x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 78
-    inline double leg_tri_f78_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre6(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f78_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre6(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f78_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre6(L2 - L1);
-      Legx = Legendre6x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f78_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre6(L2 - L1);
-      Legy = Legendre6x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f78_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre6(L2 - L1);
-      Legx = Legendre6x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f78_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre6(L2 - L1);
-      Legy = Legendre6x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 8
-
-    // number 79
-    inline double leg_tri_f79_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f79_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f79_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f79_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f79_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f79_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 80
-    inline double leg_tri_f80_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f80_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f80_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f80_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f80_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f80_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 81
-    inline double leg_tri_f81_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f81_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f81_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f81_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f81_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f81_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 82
-    inline double leg_tri_f82_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f82_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f82_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f82_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f82_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f82_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 83
-    inline double leg_tri_f83_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f83_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f83_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f83_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f83_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f83_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 84
-    inline double leg_tri_f84_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f84_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f84_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f84_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f84_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f84_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 85
-    inline double leg_tri_f85_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f85_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f85_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f85_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f85_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f85_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 86
-    inline double leg_tri_f86_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f86_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f86_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f86_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f86_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f86_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 87
-    inline double leg_tri_f87_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f87_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f87_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f87_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f87_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f87_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 88
-    inline double leg_tri_f88_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f88_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f88_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f88_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f88_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f88_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 89
-    inline double leg_tri_f89_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f89_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f89_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f89_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f89_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f89_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 90
-    inline double leg_tri_f90_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f90_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f90_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f90_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f90_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f90_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 9
-
-    // Edge functions, order 9
-
-    // number 91
-    inline double leg_tri_f91_a(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L3 - L2); q2 = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f91_b(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L3 - L2); q2 = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f91_ax(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L3 - L2);
-      cx = 8.0 / 9.0 * Legendre7x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f91_ay(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L3 - L2);
-      cy = 8.0 / 9.0 * Legendre7x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f91_bx(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L3 - L2);
-      cx = 8.0 / 9.0 * Legendre7x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f91_by(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L3 - L2);
-      cy = 8.0 / 9.0 * Legendre7x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    // number 92
-    inline double leg_tri_f92_a(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L1 - L3); q2 = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f92_b(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L1 - L3); q2 = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f92_ax(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L1 - L3);
-      cx = 8.0 / 9.0 * Legendre7x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f92_ay(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L1 - L3);
-      cy = 8.0 / 9.0 * Legendre7x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f92_bx(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L1 - L3);
-      cx = 8.0 / 9.0 * Legendre7x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f92_by(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L1 - L3);
-      cy = 8.0 / 9.0 * Legendre7x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    // number 93
-    inline double leg_tri_f93_a(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L2 - L1); q2 = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f93_b(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 17.0 / 9.0 * Legendre8(L2 - L1); q2 = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f93_ax(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L2 - L1);
-      cx = 8.0 / 9.0 * Legendre7x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f93_ay(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L2 - L1);
-      cy = 8.0 / 9.0 * Legendre7x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f93_bx(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 17.0 / 9.0 * Legendre8x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 17.0 / 9.0 * Legendre8(L2 - L1);
-      cx = 8.0 / 9.0 * Legendre7x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f93_by(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 17.0 / 9.0 * Legendre8x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 17.0 / 9.0 * Legendre8(L2 - L1);
-      cy = 8.0 / 9.0 * Legendre7x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 8.0 / 9.0 * Legendre7(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    // Edge-base bubble functions (normal functions), order 9
-
-    // number 94
-    inline double leg_tri_f94_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre7(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f94_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre7(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f94_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre7(L3 - L2);
-      Legx = Legendre7x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f94_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre7(L3 - L2);
-      Legy = Legendre7x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f94_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre7(L3 - L2);
-      Legx = Legendre7x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f94_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre7(L3 - L2);
-      Legy = Legendre7x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 95
-    inline double leg_tri_f95_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre7(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f95_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre7(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f95_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre7(L1 - L3);
-      Legx = Legendre7x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f95_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre7(L1 - L3);
-      Legy = Legendre7x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f95_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre7(L1 - L3);
-      Legx = Legendre7x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f95_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre7(L1 - L3);
-      Legy = Legendre7x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 96
-    inline double leg_tri_f96_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre7(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f96_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre7(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f96_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre7(L2 - L1);
-      Legx = Legendre7x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f96_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre7(L2 - L1);
-      Legy = Legendre7x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f96_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre7(L2 - L1);
-      Legx = Legendre7x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f96_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre7(L2 - L1);
-      Legy = Legendre7x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 9
-
-    // number 97
-    inline double leg_tri_f97_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    inline double leg_tri_f97_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f97_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre6x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f97_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre6x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f97_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f97_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 98
-    inline double leg_tri_f98_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f98_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    inline double leg_tri_f98_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f98_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f98_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre6x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f98_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre6x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 99
-    inline double leg_tri_f99_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f99_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f99_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f99_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f99_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f99_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 100
-    inline double leg_tri_f100_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f100_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f100_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f100_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f100_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f100_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 101
-    inline double leg_tri_f101_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f101_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f101_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f101_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f101_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f101_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 102
-    inline double leg_tri_f102_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f102_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f102_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f102_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f102_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f102_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 103
-    inline double leg_tri_f103_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f103_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f103_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f103_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f103_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f103_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 104
-    inline double leg_tri_f104_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f104_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f104_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f104_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f104_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f104_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 105
-    inline double leg_tri_f105_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f105_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f105_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f105_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f105_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f105_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 106
-    inline double leg_tri_f106_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f106_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f106_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f106_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f106_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f106_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 107
-    inline double leg_tri_f107_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f107_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f107_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f107_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f107_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f107_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 108
-    inline double leg_tri_f108_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f108_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f108_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f108_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f108_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f108_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 109
-    inline double leg_tri_f109_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f109_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f109_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre6x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f109_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre6x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f109_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f109_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 110
-    inline double leg_tri_f110_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f110_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f110_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f110_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f110_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre6x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f110_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre6x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // ORDER 10
-
-    // Edge functions, order 10
-
-    // number 111
-    inline double leg_tri_f111_a0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L3 - L2); q2 = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (q1 * psi1e1_1(x, y) - q2 * psi0e1_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_b0(double x, double y)
-    {
-      double L3, L2, q1, q2;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L3 - L2); q2 = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (q1 * psi1e1_2(x, y) - q2 * psi0e1_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_a1(double x, double y)
-    {
-      return -leg_tri_f111_a0(x, y);
-    }
-
-    inline double leg_tri_f111_b1(double x, double y)
-    {
-      return -leg_tri_f111_b0(x, y);
-    }
-
-    inline double leg_tri_f111_ax0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L3 - L2);
-      cx = 9.0 / 10.0 * Legendre8x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (ax * psi1e1_1(x, y) + bx * psi1e1x_1(x, y) - cx * psi0e1_1(x, y) - dx * psi0e1x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_ay0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L3 - L2);
-      cy = 9.0 / 10.0 * Legendre8x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (ay * psi1e1_1(x, y) + by * psi1e1y_1(x, y) - cy * psi0e1_1(x, y) - dy * psi0e1y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_bx0(double x, double y)
-    {
-      double L3, L2, ax, bx, cx, dx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L3 - L2);
-      cx = 9.0 / 10.0 * Legendre8x(L3 - L2) * (lambda3x(x, y) - lambda2x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (ax * psi1e1_2(x, y) + bx * psi1e1x_2(x, y) - cx * psi0e1_2(x, y) - dx * psi0e1x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_by0(double x, double y)
-    {
-      double L3, L2, ay, by, cy, dy;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L3 - L2);
-      cy = 9.0 / 10.0 * Legendre8x(L3 - L2) * (lambda3y(x, y) - lambda2y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L3 - L2);
-      return (ay * psi1e1_2(x, y) + by * psi1e1y_2(x, y) - cy * psi0e1_2(x, y) - dy * psi0e1y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f111_ax1(double x, double y)
-    {
-      return -leg_tri_f111_ax0(x, y);
-    }
-
-    inline double leg_tri_f111_ay1(double x, double y)
-    {
-      return -leg_tri_f111_ay0(x, y);
-    }
-
-    inline double leg_tri_f111_bx1(double x, double y)
-    {
-      return -leg_tri_f111_bx0(x, y);
-    }
-
-    inline double leg_tri_f111_by1(double x, double y)
-    {
-      return -leg_tri_f111_by0(x, y);
-    }
-
-    // number 112
-    inline double leg_tri_f112_a0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L1 - L3); q2 = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (q1 * psi1e2_1(x, y) - q2 * psi0e2_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_b0(double x, double y)
-    {
-      double L1, L3, q1, q2;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L1 - L3); q2 = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (q1 * psi1e2_2(x, y) - q2 * psi0e2_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_a1(double x, double y)
-    {
-      return -leg_tri_f112_a0(x, y);
-    }
-
-    inline double leg_tri_f112_b1(double x, double y)
-    {
-      return -leg_tri_f112_b0(x, y);
-    }
-
-    inline double leg_tri_f112_ax0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L1 - L3);
-      cx = 9.0 / 10.0 * Legendre8x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (ax * psi1e2_1(x, y) + bx * psi1e2x_1(x, y) - cx * psi0e2_1(x, y) - dx * psi0e2x_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_ay0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L1 - L3);
-      cy = 9.0 / 10.0 * Legendre8x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (ay * psi1e2_1(x, y) + by * psi1e2y_1(x, y) - cy * psi0e2_1(x, y) - dy * psi0e2y_1(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_bx0(double x, double y)
-    {
-      double L1, L3, ax, bx, cx, dx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L1 - L3);
-      cx = 9.0 / 10.0 * Legendre8x(L1 - L3) * (lambda1x(x, y) - lambda3x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (ax * psi1e2_2(x, y) + bx * psi1e2x_2(x, y) - cx * psi0e2_2(x, y) - dx * psi0e2x_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_by0(double x, double y)
-    {
-      double L1, L3, ay, by, cy, dy;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L1 - L3);
-      cy = 9.0 / 10.0 * Legendre8x(L1 - L3) * (lambda1y(x, y) - lambda3y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L1 - L3);
-      return (ay * psi1e2_2(x, y) + by * psi1e2y_2(x, y) - cy * psi0e2_2(x, y) - dy * psi0e2y_2(x, y)) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f112_ax1(double x, double y)
-    {
-      return -leg_tri_f112_ax0(x, y);
-    }
-
-    inline double leg_tri_f112_ay1(double x, double y)
-    {
-      return -leg_tri_f112_ay0(x, y);
-    }
-
-    inline double leg_tri_f112_bx1(double x, double y)
-    {
-      return -leg_tri_f112_bx0(x, y);
-    }
-
-    inline double leg_tri_f112_by1(double x, double y)
-    {
-      return -leg_tri_f112_by0(x, y);
-    }
-
-    // number 113
-    inline double leg_tri_f113_a0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L2 - L1); q2 = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (q1 * psi1e3_1(x, y) - q2 * psi0e3_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_b0(double x, double y)
-    {
-      double L2, L1, q1, q2;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      q1 = 19.0 / 10.0 * Legendre9(L2 - L1); q2 = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (q1 * psi1e3_2(x, y) - q2 * psi0e3_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_a1(double x, double y)
-    {
-      return -leg_tri_f113_a0(x, y);
-    }
-
-    inline double leg_tri_f113_b1(double x, double y)
-    {
-      return -leg_tri_f113_b0(x, y);
-    }
-
-    inline double leg_tri_f113_ax0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L2 - L1);
-      cx = 9.0 / 10.0 * Legendre8x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (ax * psi1e3_1(x, y) + bx * psi1e3x_1(x, y) - cx * psi0e3_1(x, y) - dx * psi0e3x_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_ay0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L2 - L1);
-      cy = 9.0 / 10.0 * Legendre8x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (ay * psi1e3_1(x, y) + by * psi1e3y_1(x, y) - cy * psi0e3_1(x, y) - dy * psi0e3y_1(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_bx0(double x, double y)
-    {
-      double L2, L1, ax, bx, cx, dx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ax = 19.0 / 10.0 * Legendre9x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      bx = 19.0 / 10.0 * Legendre9(L2 - L1);
-      cx = 9.0 / 10.0 * Legendre8x(L2 - L1) * (lambda2x(x, y) - lambda1x(x, y));
-      dx = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (ax * psi1e3_2(x, y) + bx * psi1e3x_2(x, y) - cx * psi0e3_2(x, y) - dx * psi0e3x_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_by0(double x, double y)
-    {
-      double L2, L1, ay, by, cy, dy;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      ay = 19.0 / 10.0 * Legendre9x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      by = 19.0 / 10.0 * Legendre9(L2 - L1);
-      cy = 9.0 / 10.0 * Legendre8x(L2 - L1) * (lambda2y(x, y) - lambda1y(x, y));
-      dy = 9.0 / 10.0 * Legendre8(L2 - L1);
-      return (ay * psi1e3_2(x, y) + by * psi1e3y_2(x, y) - cy * psi0e3_2(x, y) - dy * psi0e3y_2(x, y)) / 1.0;
-    }
-
-    inline double leg_tri_f113_ax1(double x, double y)
-    {
-      return -leg_tri_f113_ax0(x, y);
-    }
-
-    inline double leg_tri_f113_ay1(double x, double y)
-    {
-      return -leg_tri_f113_ay0(x, y);
-    }
-
-    inline double leg_tri_f113_bx1(double x, double y)
-    {
-      return -leg_tri_f113_bx0(x, y);
-    }
-
-    inline double leg_tri_f113_by1(double x, double y)
-    {
-      return -leg_tri_f113_by0(x, y);
-    }
-
-    // Edge-base bubble functions (normal functions), order 10
-
-    // number 114
-    inline double leg_tri_f114_a(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre8(L3 - L2);
-      return (k * n11) / 1.0;
-    }
-
-    inline double leg_tri_f114_b(double x, double y)
-    {
-      double L3, L2, k;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      k = L3 * L2 * Legendre8(L3 - L2);
-      return (k * n12) / 1.0;
-    }
-
-    inline double leg_tri_f114_ax(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre8(L3 - L2);
-      Legx = Legendre8x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n11) / 1.0;
-    }
-
-    inline double leg_tri_f114_ay(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy,  ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre8(L3 - L2);
-      Legy = Legendre8x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n11) / 1.0;
-    }
-
-    inline double leg_tri_f114_bx(double x, double y)
-    {
-      double L3, L2, L3x, L2x,
-      Leg, Legx, kx;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3x = lambda3x(x, y); L2x = lambda2x(x, y);
-      Leg = Legendre8(L3 - L2);
-      Legx = Legendre8x(L3 - L2) * (L3x - L2x);
-      kx = L3x * L2 * Leg + L3 * L2x * Leg + L3 * L2 * Legx;
-      return (kx * n12) / 1.0;
-    }
-
-    inline double leg_tri_f114_by(double x, double y)
-    {
-      double L3, L2,
-      L3y, L2y, Leg, Legy, ky;
-      L3 = lambda3(x, y); L2 = lambda2(x, y);
-      L3y = lambda3y(x, y); L2y = lambda2y(x, y);
-      Leg = Legendre8(L3 - L2);
-      Legy = Legendre8x(L3 - L2) * (L3y - L2y);
-      ky = L3y * L2 * Leg + L3 * L2y * Leg + L3 * L2 * Legy;
-      return  (ky * n12) / 1.0;
-    }
-
-    // number 115
-    inline double leg_tri_f115_a(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre8(L1 - L3);
-      return (k * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f115_b(double x, double y)
-    {
-      double L1, L3, k;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      k = L1 * L3 * Legendre8(L1 - L3);
-      return (k * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f115_ax(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre8(L1 - L3);
-      Legx = Legendre8x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f115_ay(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy,  ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre8(L1 - L3);
-      Legy = Legendre8x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n21) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f115_bx(double x, double y)
-    {
-      double L1, L3, L1x, L3x,
-      Leg, Legx, kx;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1x = lambda1x(x, y); L3x = lambda3x(x, y);
-      Leg = Legendre8(L1 - L3);
-      Legx = Legendre8x(L1 - L3) * (L1x - L3x);
-      kx = L1x * L3 * Leg + L1 * L3x * Leg + L1 * L3 * Legx;
-      return (kx * n22) / 1.4142135623731;
-    }
-
-    inline double leg_tri_f115_by(double x, double y)
-    {
-      double L1, L3,
-      L1y, L3y, Leg, Legy, ky;
-      L1 = lambda1(x, y); L3 = lambda3(x, y);
-      L1y = lambda1y(x, y); L3y = lambda3y(x, y);
-      Leg = Legendre8(L1 - L3);
-      Legy = Legendre8x(L1 - L3) * (L1y - L3y);
-      ky = L1y * L3 * Leg + L1 * L3y * Leg + L1 * L3 * Legy;
-      return  (ky * n22) / 1.4142135623731;
-    }
-
-    // number 116
-    inline double leg_tri_f116_a(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre8(L2 - L1);
-      return (k * n31) / 1.0;
-    }
-
-    inline double leg_tri_f116_b(double x, double y)
-    {
-      double L2, L1, k;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      k = L2 * L1 * Legendre8(L2 - L1);
-      return (k * n32) / 1.0;
-    }
-
-    inline double leg_tri_f116_ax(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre8(L2 - L1);
-      Legx = Legendre8x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n31) / 1.0;
-    }
-
-    inline double leg_tri_f116_ay(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy,  ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre8(L2 - L1);
-      Legy = Legendre8x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n31) / 1.0;
-    }
-
-    inline double leg_tri_f116_bx(double x, double y)
-    {
-      double L2, L1, L2x, L1x,
-      Leg, Legx, kx;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2x = lambda2x(x, y); L1x = lambda1x(x, y);
-      Leg = Legendre8(L2 - L1);
-      Legx = Legendre8x(L2 - L1) * (L2x - L1x);
-      kx = L2x * L1 * Leg + L2 * L1x * Leg + L2 * L1 * Legx;
-      return (kx * n32) / 1.0;
-    }
-
-    inline double leg_tri_f116_by(double x, double y)
-    {
-      double L2, L1,
-      L2y, L1y, Leg, Legy, ky;
-      L2 = lambda2(x, y); L1 = lambda1(x, y);
-      L2y = lambda2y(x, y); L1y = lambda1y(x, y);
-      Leg = Legendre8(L2 - L1);
-      Legy = Legendre8x(L2 - L1) * (L2y - L1y);
-      ky = L2y * L1 * Leg + L2 * L1y * Leg + L2 * L1 * Legy;
-      return  (ky * n32) / 1.0;
-    }
-
-    // Genuine bubble functions, order 10
-
-    // number 117
-    inline double leg_tri_f117_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre7(l2 - l1);
-    }
-
-    inline double leg_tri_f117_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f117_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre7(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre7x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f117_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre7(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre7x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f117_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f117_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 118
-    inline double leg_tri_f118_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f118_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre0(l3 - l2) * Legendre7(l2 - l1);
-    }
-
-    inline double leg_tri_f118_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f118_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f118_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre7(l2 - l1);
-      Leg1x = Legendre0x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre7x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f118_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre0(l3 - l2); Leg2 = Legendre7(l2 - l1);
-      Leg1y = Legendre0x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre7x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 119
-    inline double leg_tri_f119_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    inline double leg_tri_f119_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f119_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre6x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f119_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre6x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f119_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f119_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 120
-    inline double leg_tri_f120_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f120_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre1(l3 - l2) * Legendre6(l2 - l1);
-    }
-
-    inline double leg_tri_f120_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f120_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f120_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1x = Legendre1x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre6x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f120_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre1(l3 - l2); Leg2 = Legendre6(l2 - l1);
-      Leg1y = Legendre1x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre6x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 121
-    inline double leg_tri_f121_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f121_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f121_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f121_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f121_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f121_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 122
-    inline double leg_tri_f122_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f122_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre2(l3 - l2) * Legendre5(l2 - l1);
-    }
-
-    inline double leg_tri_f122_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f122_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f122_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1x = Legendre2x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre5x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f122_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre2(l3 - l2); Leg2 = Legendre5(l2 - l1);
-      Leg1y = Legendre2x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre5x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 123
-    inline double leg_tri_f123_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f123_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f123_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f123_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f123_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f123_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 124
-    inline double leg_tri_f124_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f124_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre3(l3 - l2) * Legendre4(l2 - l1);
-    }
-
-    inline double leg_tri_f124_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f124_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f124_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1x = Legendre3x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre4x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f124_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre3(l3 - l2); Leg2 = Legendre4(l2 - l1);
-      Leg1y = Legendre3x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre4x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 125
-    inline double leg_tri_f125_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f125_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f125_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f125_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f125_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f125_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 126
-    inline double leg_tri_f126_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f126_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre4(l3 - l2) * Legendre3(l2 - l1);
-    }
-
-    inline double leg_tri_f126_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f126_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f126_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1x = Legendre4x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre3x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f126_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre4(l3 - l2); Leg2 = Legendre3(l2 - l1);
-      Leg1y = Legendre4x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre3x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 127
-    inline double leg_tri_f127_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f127_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f127_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f127_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f127_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f127_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 128
-    inline double leg_tri_f128_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f128_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre5(l3 - l2) * Legendre2(l2 - l1);
-    }
-
-    inline double leg_tri_f128_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f128_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f128_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1x = Legendre5x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre2x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f128_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre5(l3 - l2); Leg2 = Legendre2(l2 - l1);
-      Leg1y = Legendre5x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre2x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 129
-    inline double leg_tri_f129_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f129_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f129_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre6x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f129_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre6x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f129_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f129_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 130
-    inline double leg_tri_f130_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f130_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre6(l3 - l2) * Legendre1(l2 - l1);
-    }
-
-    inline double leg_tri_f130_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f130_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f130_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1x = Legendre6x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre1x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f130_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre6(l3 - l2); Leg2 = Legendre1(l2 - l1);
-      Leg1y = Legendre6x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre1x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    // number 131
-    inline double leg_tri_f131_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre7(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f131_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f131_ax(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre7(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre7x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f131_ay(double x, double y)
-    {
-      double l1, l2, l3, l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre7(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre7x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    inline double leg_tri_f131_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f131_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    // number 132
-    inline double leg_tri_f132_a(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return 0.0;
-    }
-
-    inline double leg_tri_f132_b(double x, double y)
-    {
-      double l1, l2, l3;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      return l1 * l2 * l3 * Legendre7(l3 - l2) * Legendre0(l2 - l1);
-    }
-
-    inline double leg_tri_f132_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f132_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    inline double leg_tri_f132_bx(double x, double y)
-    {
-      double l1, l2, l3, l1x, l2x, l3x, Leg1, Leg2, Leg1x, Leg2x;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1x = lambda1x(x, y); l2x = lambda2x(x, y); l3x = lambda3x(x, y);
-      Leg1 = Legendre7(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1x = Legendre7x(l3 - l2) * (l3x - l2x);
-      Leg2x = Legendre0x(l2 - l1) * (l2x - l1x);
-      return l1x * l2 * l3 * Leg1 * Leg2 + l1 * l2x * l3 * Leg1 * Leg2 + l1 * l2 * l3x * Leg1 * Leg2 + l1 * l2 * l3 * Leg1x * Leg2 + l1 * l2 * l3 * Leg1 * Leg2x;
-    }
-
-    inline double leg_tri_f132_by(double x, double y)
-    {
-      double l1, l2, l3,  l1y, l2y, l3y, Leg1, Leg2, Leg1y, Leg2y;
-      l1 = lambda1(x, y); l2 = lambda2(x, y); l3 = lambda3(x, y);
-      l1y = lambda1y(x, y); l2y = lambda2y(x, y); l3y = lambda3y(x, y);
-      Leg1 = Legendre7(l3 - l2); Leg2 = Legendre0(l2 - l1);
-      Leg1y = Legendre7x(l3 - l2) * (l3y - l2y);
-      Leg2y = Legendre0x(l2 - l1) * (l2y - l1y);
-      return l1y * l2 * l3 * Leg1 * Leg2 + l1 * l2y * l3 * Leg1 * Leg2 + l1 * l2 * l3y * Leg1 * Leg2 + l1 * l2 * l3 * Leg1y * Leg2 + l1 * l2 * l3 * Leg1 * Leg2y;
-    }
-
-    ////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    static Shapeset::shape_fn_t leg_tri_fn_a[] =
-    {
-      leg_tri_f1_a0,  leg_tri_f1_a1,  leg_tri_f2_a0,  leg_tri_f2_a1,  leg_tri_f3_a0,  leg_tri_f3_a1,
-      leg_tri_f4_a,  leg_tri_f5_a,   leg_tri_f6_a,   leg_tri_f7_a0,  leg_tri_f7_a1,  leg_tri_f8_a0,
-      leg_tri_f8_a1,  leg_tri_f9_a0, leg_tri_f9_a1,  leg_tri_f10_a,  leg_tri_f11_a,  leg_tri_f12_a,
-      leg_tri_f13_a,  leg_tri_f14_a,  leg_tri_f15_a, leg_tri_f16_a,  leg_tri_f17_a,  leg_tri_f18_a,
-      leg_tri_f19_a,  leg_tri_f20_a,  leg_tri_f21_a0, leg_tri_f21_a1, leg_tri_f22_a0, leg_tri_f22_a1,
-      leg_tri_f23_a0, leg_tri_f23_a1, leg_tri_f24_a,  leg_tri_f25_a,  leg_tri_f26_a,  leg_tri_f27_a,
-      leg_tri_f28_a,  leg_tri_f29_a,  leg_tri_f30_a,  leg_tri_f31_a,  leg_tri_f32_a,  leg_tri_f33_a,
-      leg_tri_f34_a,  leg_tri_f35_a,  leg_tri_f36_a,  leg_tri_f37_a,  leg_tri_f38_a,  leg_tri_f39_a,
-      leg_tri_f40_a,  leg_tri_f41_a,  leg_tri_f42_a,  leg_tri_f43_a0, leg_tri_f43_a1, leg_tri_f44_a0,
-      leg_tri_f44_a1, leg_tri_f45_a0, leg_tri_f45_a1, leg_tri_f46_a,  leg_tri_f47_a,  leg_tri_f48_a,
-      leg_tri_f49_a,  leg_tri_f50_a,  leg_tri_f51_a,  leg_tri_f52_a,  leg_tri_f53_a,  leg_tri_f54_a,
-      leg_tri_f55_a,  leg_tri_f56_a,  leg_tri_f57_a,  leg_tri_f58_a, leg_tri_f59_a,  leg_tri_f60_a,
-      leg_tri_f61_a,  leg_tri_f62_a,  leg_tri_f63_a,  leg_tri_f64_a,  leg_tri_f65_a,  leg_tri_f66_a,
-      leg_tri_f67_a,  leg_tri_f68_a,  leg_tri_f69_a,  leg_tri_f70_a,  leg_tri_f71_a,  leg_tri_f72_a,
-      leg_tri_f73_a0, leg_tri_f73_a1, leg_tri_f74_a0, leg_tri_f74_a1, leg_tri_f75_a0, leg_tri_f75_a1,
-      leg_tri_f76_a,  leg_tri_f77_a,  leg_tri_f78_a,  leg_tri_f79_a,  leg_tri_f80_a,  leg_tri_f81_a,
-      leg_tri_f82_a,  leg_tri_f83_a,  leg_tri_f84_a,  leg_tri_f85_a,  leg_tri_f86_a,  leg_tri_f87_a,
-      leg_tri_f88_a,  leg_tri_f89_a,  leg_tri_f90_a,  leg_tri_f91_a,  leg_tri_f92_a,  leg_tri_f93_a,
-      leg_tri_f94_a,  leg_tri_f95_a,  leg_tri_f96_a,  leg_tri_f97_a,  leg_tri_f98_a,  leg_tri_f99_a,
-      leg_tri_f100_a,  leg_tri_f101_a,  leg_tri_f102_a,  leg_tri_f103_a,  leg_tri_f104_a,  leg_tri_f105_a,
-      leg_tri_f106_a,  leg_tri_f107_a,  leg_tri_f108_a,  leg_tri_f109_a,  leg_tri_f110_a,  leg_tri_f111_a0,
-      leg_tri_f111_a1, leg_tri_f112_a0, leg_tri_f112_a1, leg_tri_f113_a0, leg_tri_f113_a1, leg_tri_f114_a,
-      leg_tri_f115_a,  leg_tri_f116_a,  leg_tri_f117_a,  leg_tri_f118_a,  leg_tri_f119_a,  leg_tri_f120_a,
-      leg_tri_f121_a,  leg_tri_f122_a,  leg_tri_f123_a,  leg_tri_f124_a,  leg_tri_f125_a,  leg_tri_f126_a,
-      leg_tri_f127_a,  leg_tri_f128_a,  leg_tri_f129_a,  leg_tri_f130_a,  leg_tri_f131_a,  leg_tri_f132_a
-    };
-
-    static Shapeset::shape_fn_t leg_tri_fn_b[] =
-    {
-      leg_tri_f1_b0,  leg_tri_f1_b1,  leg_tri_f2_b0,  leg_tri_f2_b1,  leg_tri_f3_b0,
-      leg_tri_f3_b1,  leg_tri_f4_b,  leg_tri_f5_b,   leg_tri_f6_b,   leg_tri_f7_b0,
-      leg_tri_f7_b1,  leg_tri_f8_b0,  leg_tri_f8_b1,  leg_tri_f9_b0, leg_tri_f9_b1,
-      leg_tri_f10_b,  leg_tri_f11_b,  leg_tri_f12_b,  leg_tri_f13_b,  leg_tri_f14_b,
-      leg_tri_f15_b, leg_tri_f16_b,  leg_tri_f17_b,  leg_tri_f18_b,  leg_tri_f19_b,
-      leg_tri_f20_b,  leg_tri_f21_b0, leg_tri_f21_b1, leg_tri_f22_b0, leg_tri_f22_b1,
-      leg_tri_f23_b0, leg_tri_f23_b1, leg_tri_f24_b,  leg_tri_f25_b,  leg_tri_f26_b,
-      leg_tri_f27_b,  leg_tri_f28_b,  leg_tri_f29_b,  leg_tri_f30_b,  leg_tri_f31_b,
-      leg_tri_f32_b,  leg_tri_f33_b, leg_tri_f34_b,  leg_tri_f35_b,  leg_tri_f36_b,
-      leg_tri_f37_b,  leg_tri_f38_b,  leg_tri_f39_b,  leg_tri_f40_b,  leg_tri_f41_b,
-      leg_tri_f42_b,  leg_tri_f43_b0, leg_tri_f43_b1, leg_tri_f44_b0, leg_tri_f44_b1,
-      leg_tri_f45_b0, leg_tri_f45_b1, leg_tri_f46_b,  leg_tri_f47_b,  leg_tri_f48_b,
-      leg_tri_f49_b,  leg_tri_f50_b,  leg_tri_f51_b,  leg_tri_f52_b,  leg_tri_f53_b,
-      leg_tri_f54_b,  leg_tri_f55_b,  leg_tri_f56_b,  leg_tri_f57_b,  leg_tri_f58_b,
-      leg_tri_f59_b,  leg_tri_f60_b,  leg_tri_f61_b,  leg_tri_f62_b,  leg_tri_f63_b,
-      leg_tri_f64_b,  leg_tri_f65_b,  leg_tri_f66_b,  leg_tri_f67_b,  leg_tri_f68_b,
-      leg_tri_f69_b,  leg_tri_f70_b,  leg_tri_f71_b,  leg_tri_f72_b,  leg_tri_f73_b0,
-      leg_tri_f73_b1, leg_tri_f74_b0, leg_tri_f74_b1, leg_tri_f75_b0, leg_tri_f75_b1,
-      leg_tri_f76_b,  leg_tri_f77_b,  leg_tri_f78_b,  leg_tri_f79_b,  leg_tri_f80_b,
-      leg_tri_f81_b,  leg_tri_f82_b,  leg_tri_f83_b,  leg_tri_f84_b,  leg_tri_f85_b,
-      leg_tri_f86_b,  leg_tri_f87_b,  leg_tri_f88_b,  leg_tri_f89_b,  leg_tri_f90_b,
-      leg_tri_f91_b,  leg_tri_f92_b,  leg_tri_f93_b,  leg_tri_f94_b,  leg_tri_f95_b,
-      leg_tri_f96_b,  leg_tri_f97_b,  leg_tri_f98_b,  leg_tri_f99_b,  leg_tri_f100_b,
-      leg_tri_f101_b,  leg_tri_f102_b,  leg_tri_f103_b,  leg_tri_f104_b,  leg_tri_f105_b,
-      leg_tri_f106_b,  leg_tri_f107_b,  leg_tri_f108_b,  leg_tri_f109_b,  leg_tri_f110_b,
-      leg_tri_f111_b0, leg_tri_f111_b1, leg_tri_f112_b0, leg_tri_f112_b1, leg_tri_f113_b0,
-      leg_tri_f113_b1, leg_tri_f114_b,  leg_tri_f115_b,  leg_tri_f116_b,  leg_tri_f117_b,
-      leg_tri_f118_b,  leg_tri_f119_b,  leg_tri_f120_b,  leg_tri_f121_b,  leg_tri_f122_b,
-      leg_tri_f123_b,  leg_tri_f124_b,  leg_tri_f125_b,  leg_tri_f126_b,  leg_tri_f127_b,
-      leg_tri_f128_b,  leg_tri_f129_b,  leg_tri_f130_b,  leg_tri_f131_b,  leg_tri_f132_b
-    };
-
-    static Shapeset::shape_fn_t leg_tri_fn_ax[] =
-    {
-      leg_tri_f1_ax0,  leg_tri_f1_ax1,  leg_tri_f2_ax0,  leg_tri_f2_ax1,  leg_tri_f3_ax0,  leg_tri_f3_ax1,
-      leg_tri_f4_ax,  leg_tri_f5_ax,   leg_tri_f6_ax,   leg_tri_f7_ax0,  leg_tri_f7_ax1,  leg_tri_f8_ax0,
-      leg_tri_f8_ax1,  leg_tri_f9_ax0, leg_tri_f9_ax1,  leg_tri_f10_ax,  leg_tri_f11_ax,  leg_tri_f12_ax,
-      leg_tri_f13_ax,  leg_tri_f14_ax,  leg_tri_f15_ax, leg_tri_f16_ax,  leg_tri_f17_ax,  leg_tri_f18_ax,
-      leg_tri_f19_ax,  leg_tri_f20_ax,  leg_tri_f21_ax0, leg_tri_f21_ax1, leg_tri_f22_ax0, leg_tri_f22_ax1,
-      leg_tri_f23_ax0, leg_tri_f23_ax1, leg_tri_f24_ax,  leg_tri_f25_ax,  leg_tri_f26_ax,  leg_tri_f27_ax,
-      leg_tri_f28_ax,  leg_tri_f29_ax,  leg_tri_f30_ax,  leg_tri_f31_ax,  leg_tri_f32_ax,  leg_tri_f33_ax,
-      leg_tri_f34_ax,  leg_tri_f35_ax,  leg_tri_f36_ax,  leg_tri_f37_ax,  leg_tri_f38_ax,  leg_tri_f39_ax,
-      leg_tri_f40_ax,  leg_tri_f41_ax,  leg_tri_f42_ax,  leg_tri_f43_ax0, leg_tri_f43_ax1, leg_tri_f44_ax0,
-      leg_tri_f44_ax1, leg_tri_f45_ax0, leg_tri_f45_ax1, leg_tri_f46_ax,  leg_tri_f47_ax,  leg_tri_f48_ax,
-      leg_tri_f49_ax,  leg_tri_f50_ax,  leg_tri_f51_ax,  leg_tri_f52_ax,  leg_tri_f53_ax,  leg_tri_f54_ax,
-      leg_tri_f55_ax,  leg_tri_f56_ax,  leg_tri_f57_ax,  leg_tri_f58_ax, leg_tri_f59_ax,  leg_tri_f60_ax,
-      leg_tri_f61_ax,  leg_tri_f62_ax,  leg_tri_f63_ax,  leg_tri_f64_ax,  leg_tri_f65_ax,  leg_tri_f66_ax,
-      leg_tri_f67_ax,  leg_tri_f68_ax,  leg_tri_f69_ax,  leg_tri_f70_ax,  leg_tri_f71_ax,  leg_tri_f72_ax,
-      leg_tri_f73_ax0, leg_tri_f73_ax1, leg_tri_f74_ax0, leg_tri_f74_ax1, leg_tri_f75_ax0, leg_tri_f75_ax1,
-      leg_tri_f76_ax,  leg_tri_f77_ax,  leg_tri_f78_ax,  leg_tri_f79_ax,  leg_tri_f80_ax,  leg_tri_f81_ax,
-      leg_tri_f82_ax,  leg_tri_f83_ax,  leg_tri_f84_ax,  leg_tri_f85_ax,  leg_tri_f86_ax,  leg_tri_f87_ax,
-      leg_tri_f88_ax,  leg_tri_f89_ax,  leg_tri_f90_ax,  leg_tri_f91_ax,  leg_tri_f92_ax,  leg_tri_f93_ax,
-      leg_tri_f94_ax,  leg_tri_f95_ax,  leg_tri_f96_ax,  leg_tri_f97_ax,  leg_tri_f98_ax,  leg_tri_f99_ax,
-      leg_tri_f100_ax,  leg_tri_f101_ax,  leg_tri_f102_ax,  leg_tri_f103_ax,  leg_tri_f104_ax,  leg_tri_f105_ax,
-      leg_tri_f106_ax,  leg_tri_f107_ax,  leg_tri_f108_ax,  leg_tri_f109_ax,  leg_tri_f110_ax,  leg_tri_f111_ax0,
-      leg_tri_f111_ax1, leg_tri_f112_ax0, leg_tri_f112_ax1, leg_tri_f113_ax0, leg_tri_f113_ax1, leg_tri_f114_ax,
-      leg_tri_f115_ax,  leg_tri_f116_ax,  leg_tri_f117_ax,  leg_tri_f118_ax,  leg_tri_f119_ax,  leg_tri_f120_ax,
-      leg_tri_f121_ax,  leg_tri_f122_ax,  leg_tri_f123_ax,  leg_tri_f124_ax,  leg_tri_f125_ax,  leg_tri_f126_ax,
-      leg_tri_f127_ax,  leg_tri_f128_ax,  leg_tri_f129_ax,  leg_tri_f130_ax,  leg_tri_f131_ax,  leg_tri_f132_ax
-    };
-
-    static Shapeset::shape_fn_t leg_tri_fn_ay[] =
-    {
-      leg_tri_f1_ay0,  leg_tri_f1_ay1,  leg_tri_f2_ay0,  leg_tri_f2_ay1,  leg_tri_f3_ay0,  leg_tri_f3_ay1,
-      leg_tri_f4_ay,  leg_tri_f5_ay,   leg_tri_f6_ay,   leg_tri_f7_ay0,  leg_tri_f7_ay1,  leg_tri_f8_ay0,
-      leg_tri_f8_ay1,  leg_tri_f9_ay0, leg_tri_f9_ay1,  leg_tri_f10_ay,  leg_tri_f11_ay,  leg_tri_f12_ay,
-      leg_tri_f13_ay,  leg_tri_f14_ay,  leg_tri_f15_ay, leg_tri_f16_ay,  leg_tri_f17_ay,  leg_tri_f18_ay,
-      leg_tri_f19_ay,  leg_tri_f20_ay,  leg_tri_f21_ay0, leg_tri_f21_ay1, leg_tri_f22_ay0, leg_tri_f22_ay1,
-      leg_tri_f23_ay0, leg_tri_f23_ay1, leg_tri_f24_ay,  leg_tri_f25_ay,  leg_tri_f26_ay,  leg_tri_f27_ay,
-      leg_tri_f28_ay,  leg_tri_f29_ay,  leg_tri_f30_ay,  leg_tri_f31_ay,  leg_tri_f32_ay,  leg_tri_f33_ay,
-      leg_tri_f34_ay,  leg_tri_f35_ay,  leg_tri_f36_ay,  leg_tri_f37_ay,  leg_tri_f38_ay,  leg_tri_f39_ay,
-      leg_tri_f40_ay,  leg_tri_f41_ay,  leg_tri_f42_ay,  leg_tri_f43_ay0, leg_tri_f43_ay1, leg_tri_f44_ay0,
-      leg_tri_f44_ay1, leg_tri_f45_ay0, leg_tri_f45_ay1, leg_tri_f46_ay,  leg_tri_f47_ay,  leg_tri_f48_ay,
-      leg_tri_f49_ay,  leg_tri_f50_ay,  leg_tri_f51_ay,  leg_tri_f52_ay,  leg_tri_f53_ay,  leg_tri_f54_ay,
-      leg_tri_f55_ay,  leg_tri_f56_ay,  leg_tri_f57_ay,  leg_tri_f58_ay, leg_tri_f59_ay,  leg_tri_f60_ay,
-      leg_tri_f61_ay,  leg_tri_f62_ay,  leg_tri_f63_ay,  leg_tri_f64_ay,  leg_tri_f65_ay,  leg_tri_f66_ay,
-      leg_tri_f67_ay,  leg_tri_f68_ay,  leg_tri_f69_ay,  leg_tri_f70_ay,  leg_tri_f71_ay,  leg_tri_f72_ay,
-      leg_tri_f73_ay0, leg_tri_f73_ay1, leg_tri_f74_ay0, leg_tri_f74_ay1, leg_tri_f75_ay0, leg_tri_f75_ay1,
-      leg_tri_f76_ay,  leg_tri_f77_ay,  leg_tri_f78_ay,  leg_tri_f79_ay,  leg_tri_f80_ay,  leg_tri_f81_ay,
-      leg_tri_f82_ay,  leg_tri_f83_ay,  leg_tri_f84_ay,  leg_tri_f85_ay,  leg_tri_f86_ay,  leg_tri_f87_ay,
-      leg_tri_f88_ay,  leg_tri_f89_ay,  leg_tri_f90_ay,  leg_tri_f91_ay,  leg_tri_f92_ay,  leg_tri_f93_ay,
-      leg_tri_f94_ay,  leg_tri_f95_ay,  leg_tri_f96_ay,  leg_tri_f97_ay,  leg_tri_f98_ay,  leg_tri_f99_ay,
-      leg_tri_f100_ay,  leg_tri_f101_ay,  leg_tri_f102_ay,  leg_tri_f103_ay,  leg_tri_f104_ay,  leg_tri_f105_ay,
-      leg_tri_f106_ay,  leg_tri_f107_ay,  leg_tri_f108_ay,  leg_tri_f109_ay,  leg_tri_f110_ay,  leg_tri_f111_ay0,
-      leg_tri_f111_ay1, leg_tri_f112_ay0, leg_tri_f112_ay1, leg_tri_f113_ay0, leg_tri_f113_ay1, leg_tri_f114_ay,
-      leg_tri_f115_ay,  leg_tri_f116_ay,  leg_tri_f117_ay,  leg_tri_f118_ay,  leg_tri_f119_ay,  leg_tri_f120_ay,
-      leg_tri_f121_ay,  leg_tri_f122_ay,  leg_tri_f123_ay,  leg_tri_f124_ay,  leg_tri_f125_ay,  leg_tri_f126_ay,
-      leg_tri_f127_ay,  leg_tri_f128_ay,  leg_tri_f129_ay,  leg_tri_f130_ay,  leg_tri_f131_ay,  leg_tri_f132_ay
-    };
-
-    static Shapeset::shape_fn_t leg_tri_fn_bx[] =
-    {
-    leg_tri_f1_bx0,  leg_tri_f1_bx1,  leg_tri_f2_bx0,  leg_tri_f2_bx1,  leg_tri_f3_bx0,
-      leg_tri_f3_bx1,  leg_tri_f4_bx,  leg_tri_f5_bx,   leg_tri_f6_bx,   leg_tri_f7_bx0,
-      leg_tri_f7_bx1,  leg_tri_f8_bx0,  leg_tri_f8_bx1,  leg_tri_f9_bx0, leg_tri_f9_bx1,
-      leg_tri_f10_bx,  leg_tri_f11_bx,  leg_tri_f12_bx,  leg_tri_f13_bx,  leg_tri_f14_bx,
-      leg_tri_f15_bx, leg_tri_f16_bx,  leg_tri_f17_bx,  leg_tri_f18_bx,  leg_tri_f19_bx,
-      leg_tri_f20_bx,  leg_tri_f21_bx0, leg_tri_f21_bx1, leg_tri_f22_bx0, leg_tri_f22_bx1,
-     leg_tri_f23_bx0, leg_tri_f23_bx1, leg_tri_f24_bx,  leg_tri_f25_bx,  leg_tri_f26_bx,
-      leg_tri_f27_bx,  leg_tri_f28_bx,  leg_tri_f29_bx,  leg_tri_f30_bx,  leg_tri_f31_bx,
-      leg_tri_f32_bx,  leg_tri_f33_bx, leg_tri_f34_bx,  leg_tri_f35_bx,  leg_tri_f36_bx,
-      leg_tri_f37_bx,  leg_tri_f38_bx,  leg_tri_f39_bx,  leg_tri_f40_bx,  leg_tri_f41_bx,
-      leg_tri_f42_bx,  leg_tri_f43_bx0, leg_tri_f43_bx1, leg_tri_f44_bx0, leg_tri_f44_bx1,
-     leg_tri_f45_bx0, leg_tri_f45_bx1, leg_tri_f46_bx,  leg_tri_f47_bx,  leg_tri_f48_bx,
-      leg_tri_f49_bx,  leg_tri_f50_bx,  leg_tri_f51_bx,  leg_tri_f52_bx,  leg_tri_f53_bx,
-      leg_tri_f54_bx,  leg_tri_f55_bx,  leg_tri_f56_bx,  leg_tri_f57_bx,  leg_tri_f58_bx,
-     leg_tri_f59_bx,  leg_tri_f60_bx,  leg_tri_f61_bx,  leg_tri_f62_bx,  leg_tri_f63_bx,
-      leg_tri_f64_bx,  leg_tri_f65_bx,  leg_tri_f66_bx,  leg_tri_f67_bx,  leg_tri_f68_bx,
-      leg_tri_f69_bx,  leg_tri_f70_bx,  leg_tri_f71_bx,  leg_tri_f72_bx,  leg_tri_f73_bx0,
-     leg_tri_f73_bx1, leg_tri_f74_bx0, leg_tri_f74_bx1, leg_tri_f75_bx0, leg_tri_f75_bx1,
-     leg_tri_f76_bx,  leg_tri_f77_bx,  leg_tri_f78_bx,  leg_tri_f79_bx,  leg_tri_f80_bx,
-      leg_tri_f81_bx,  leg_tri_f82_bx,  leg_tri_f83_bx,  leg_tri_f84_bx,  leg_tri_f85_bx,
-      leg_tri_f86_bx,  leg_tri_f87_bx,  leg_tri_f88_bx,  leg_tri_f89_bx,  leg_tri_f90_bx,
-      leg_tri_f91_bx,  leg_tri_f92_bx,  leg_tri_f93_bx,  leg_tri_f94_bx,  leg_tri_f95_bx,
-      leg_tri_f96_bx,  leg_tri_f97_bx,  leg_tri_f98_bx,  leg_tri_f99_bx,  leg_tri_f100_bx,
-      leg_tri_f101_bx,  leg_tri_f102_bx,  leg_tri_f103_bx,  leg_tri_f104_bx,  leg_tri_f105_bx,
-      leg_tri_f106_bx,  leg_tri_f107_bx,  leg_tri_f108_bx,  leg_tri_f109_bx,  leg_tri_f110_bx,
-      leg_tri_f111_bx0, leg_tri_f111_bx1, leg_tri_f112_bx0, leg_tri_f112_bx1, leg_tri_f113_bx0,
-     leg_tri_f113_bx1, leg_tri_f114_bx,  leg_tri_f115_bx,  leg_tri_f116_bx,  leg_tri_f117_bx,
-      leg_tri_f118_bx,  leg_tri_f119_bx,  leg_tri_f120_bx,  leg_tri_f121_bx,  leg_tri_f122_bx,
-      leg_tri_f123_bx,  leg_tri_f124_bx,  leg_tri_f125_bx,  leg_tri_f126_bx,  leg_tri_f127_bx,
-      leg_tri_f128_bx,  leg_tri_f129_bx,  leg_tri_f130_bx,  leg_tri_f131_bx,  leg_tri_f132_bx
-    };
-
-    static Shapeset::shape_fn_t leg_tri_fn_by[] =
-    {
-    leg_tri_f1_by0,  leg_tri_f1_by1,  leg_tri_f2_by0,  leg_tri_f2_by1,  leg_tri_f3_by0,
-      leg_tri_f3_by1,  leg_tri_f4_by,  leg_tri_f5_by,   leg_tri_f6_by,   leg_tri_f7_by0,
-      leg_tri_f7_by1,  leg_tri_f8_by0,  leg_tri_f8_by1,  leg_tri_f9_by0, leg_tri_f9_by1,
-      leg_tri_f10_by,  leg_tri_f11_by,  leg_tri_f12_by,  leg_tri_f13_by,  leg_tri_f14_by,
-      leg_tri_f15_by, leg_tri_f16_by,  leg_tri_f17_by,  leg_tri_f18_by,  leg_tri_f19_by,
-      leg_tri_f20_by,  leg_tri_f21_by0, leg_tri_f21_by1, leg_tri_f22_by0, leg_tri_f22_by1,
-     leg_tri_f23_by0, leg_tri_f23_by1, leg_tri_f24_by,  leg_tri_f25_by,  leg_tri_f26_by,
-      leg_tri_f27_by,  leg_tri_f28_by,  leg_tri_f29_by,  leg_tri_f30_by,  leg_tri_f31_by,
-      leg_tri_f32_by,  leg_tri_f33_by, leg_tri_f34_by,  leg_tri_f35_by,  leg_tri_f36_by,
-      leg_tri_f37_by,  leg_tri_f38_by,  leg_tri_f39_by,  leg_tri_f40_by,  leg_tri_f41_by,
-      leg_tri_f42_by,  leg_tri_f43_by0, leg_tri_f43_by1, leg_tri_f44_by0, leg_tri_f44_by1,
-     leg_tri_f45_by0, leg_tri_f45_by1, leg_tri_f46_by,  leg_tri_f47_by,  leg_tri_f48_by,
-      leg_tri_f49_by,  leg_tri_f50_by,  leg_tri_f51_by,  leg_tri_f52_by,  leg_tri_f53_by,
-      leg_tri_f54_by,  leg_tri_f55_by,  leg_tri_f56_by,  leg_tri_f57_by,  leg_tri_f58_by,
-     leg_tri_f59_by,  leg_tri_f60_by,  leg_tri_f61_by,  leg_tri_f62_by,  leg_tri_f63_by,
-      leg_tri_f64_by,  leg_tri_f65_by,  leg_tri_f66_by,  leg_tri_f67_by,  leg_tri_f68_by,
-      leg_tri_f69_by,  leg_tri_f70_by,  leg_tri_f71_by,  leg_tri_f72_by,  leg_tri_f73_by0,
-     leg_tri_f73_by1, leg_tri_f74_by0, leg_tri_f74_by1, leg_tri_f75_by0, leg_tri_f75_by1,
-     leg_tri_f76_by,  leg_tri_f77_by,  leg_tri_f78_by,  leg_tri_f79_by,  leg_tri_f80_by,
-      leg_tri_f81_by,  leg_tri_f82_by,  leg_tri_f83_by,  leg_tri_f84_by,  leg_tri_f85_by,
-      leg_tri_f86_by,  leg_tri_f87_by,  leg_tri_f88_by,  leg_tri_f89_by,  leg_tri_f90_by,
-      leg_tri_f91_by,  leg_tri_f92_by,  leg_tri_f93_by,  leg_tri_f94_by,  leg_tri_f95_by,
-      leg_tri_f96_by,  leg_tri_f97_by,  leg_tri_f98_by,  leg_tri_f99_by,  leg_tri_f100_by,
-      leg_tri_f101_by,  leg_tri_f102_by,  leg_tri_f103_by,  leg_tri_f104_by,  leg_tri_f105_by,
-      leg_tri_f106_by,  leg_tri_f107_by,  leg_tri_f108_by,  leg_tri_f109_by,  leg_tri_f110_by,
-      leg_tri_f111_by0, leg_tri_f111_by1, leg_tri_f112_by0, leg_tri_f112_by1, leg_tri_f113_by0,
-     leg_tri_f113_by1, leg_tri_f114_by,  leg_tri_f115_by,  leg_tri_f116_by,  leg_tri_f117_by,
-      leg_tri_f118_by,  leg_tri_f119_by,  leg_tri_f120_by,  leg_tri_f121_by,  leg_tri_f122_by,
-      leg_tri_f123_by,  leg_tri_f124_by,  leg_tri_f125_by,  leg_tri_f126_by,  leg_tri_f127_by,
-      leg_tri_f128_by,  leg_tri_f129_by,  leg_tri_f130_by,  leg_tri_f131_by,  leg_tri_f132_by
-    };
-
-    static int leg_tri_bubble_indices_all_orders[]=
-    {
-      15, 16, 17,
-      21, 22, 23, 24, 25,
-      32, 33, 34, 35, 36, 37, 38 ,
-      42, 43, 44, 45, 46, 47, 48, 49, 50,
-      57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
-      71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
-      90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
-      108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124 ,
-      131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149
-    };
-
-    static int* leg_tri_bubble_indices[11] =
-    {
-      NULL, NULL,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders,
-      leg_tri_bubble_indices_all_orders
-    };
-
-    static int leg_tri_bubble_count[11] = {0, 0, 3, 8, 15, 24, 35, 48, 63, 80, 99};
-
-    static int leg_tri_edge_indices_0[22] =  { 0, 1, 6, 6,  9, 10, 18, 18, 26, 27, 39, 39, 51, 52, 68, 68, 84, 85, 105, 105 , 125, 126};
-    static int leg_tri_edge_indices_1[22] =  { 2, 3, 7, 7, 11, 12, 19, 19, 28, 29, 40, 40, 53, 54, 69, 69, 86, 87, 106, 106 , 127, 128};
-    static int leg_tri_edge_indices_2[22] =  { 4, 5, 8, 8, 13, 14, 20, 20, 30, 31, 41, 41, 55, 56, 70, 70, 88, 89, 107, 107 , 129, 130};
-
-    static int* leg_tri_edge_indices[3] =
-    {
-      leg_tri_edge_indices_0,
-      leg_tri_edge_indices_1,
-      leg_tri_edge_indices_2
-    };
-
-    static int leg_tri_vertex_indices[3] = { -1, -1, -1 };
-
-    static int leg_tri_index_to_order[150] =
-    {
-      /*6*/  1, 1, 1, 1, 1, 1,
-      /*3*/  1, 1, 1,
-      /*9*/  2, 2, 2, 2, 2, 2, 2, 2, 2,
-      /*8*/  3, 3, 3, 3, 3, 3, 3, 3,
-      /*13*/ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-      /*12*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
-      /*17*/ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
-      /*16*/ 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
-      /*21*/ 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
-      /*20*/ 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-      /*25*/ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10
-    };
-
-    static Shapeset::shape_fn_t* leg_tri_shape_fn_table[2] =
-    {
-      leg_tri_fn_a,
-      leg_tri_fn_b
-    };
-
-    static Shapeset::shape_fn_t* leg_tri_shape_fn_table_x[2] =
-    {
-      leg_tri_fn_ax,
-      leg_tri_fn_bx
-    };
-
-    static Shapeset::shape_fn_t* leg_tri_shape_fn_table_y[2] =
-    {
-      leg_tri_fn_ay,
-      leg_tri_fn_by
-    };
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    // QUADY
-
-    // Shapeset for the curl operator for quads, based on Legendre polynomials
-
-    /* EDGE FUNCTIONS */
-
-    /* ORDER 0 */
-
-    static double leg_quad_p0_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p0_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre0(y));
-    }
-
-    static double leg_quad_p0_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p0_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre0(y));
-    }
-
-    static double leg_quad_p0_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p0_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre0x(y));
-    }
-
-    static double leg_quad_p0_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p0_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre0(y));
-    }
-
-    static double leg_quad_p0_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p0_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre0(y));
-    }
-
-    static double leg_quad_p0_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p0_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre0x(y));
-    }
-
-    static double leg_quad_p0_e3_a_0(double x, double y)
-    {
-      return Legendre0(x) * l0(y);
-    }
-
-    static double leg_quad_p0_e3_a_1(double x, double y)
-    {
-      return -(Legendre0(x) * l0(y));
-    }
-
-    static double leg_quad_p0_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e3_ax_0(double x, double y)
-    {
-      return Legendre0x(x) * l0(y);
-    }
-
-    static double leg_quad_p0_e3_ax_1(double x, double y)
-    {
-      return -(Legendre0x(x) * l0(y));
-    }
-
-    static double leg_quad_p0_e3_ay_0(double x, double y)
-    {
-      return Legendre0(x) * dl0(y);
-    }
-
-    static double leg_quad_p0_e3_ay_1(double x, double y)
-    {
-      return -(Legendre0(x) * dl0(y));
-    }
-
-    static double leg_quad_p0_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e4_a_1(double x, double y)
-    {
-      return Legendre0(x) * l1(y);
-    }
-
-    static double leg_quad_p0_e4_a_0(double x, double y)
-    {
-      return -(Legendre0(x) * l1(y));
-    }
-
-    static double leg_quad_p0_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e4_ax_1(double x, double y)
-    {
-      return Legendre0x(x) * l1(y);
-    }
-
-    static double leg_quad_p0_e4_ax_0(double x, double y)
-    {
-      return -(Legendre0x(x) * l1(y));
-    }
-
-    static double leg_quad_p0_e4_ay_1(double x, double y)
-    {
-      return Legendre0(x) * dl1(y);
-    }
-
-    static double leg_quad_p0_e4_ay_0(double x, double y)
-    {
-      return -(Legendre0(x) * dl1(y));
-    }
-
-    static double leg_quad_p0_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 1 */
-
-    static double leg_quad_p1_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e1_b(double x, double y)
-    {
-      return l0(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p1_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e1_bx(double x, double y)
-    {
-      return dl0(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p1_e1_by(double x, double y)
-    {
-      return l0(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p1_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e2_b(double x, double y)
-    {
-      return l1(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p1_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e2_bx(double x, double y)
-    {
-      return dl1(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p1_e2_by(double x, double y)
-    {
-      return l1(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p1_e3_a(double x, double y)
-    {
-      return Legendre1(x) * l0(y);
-    }
-
-    static double leg_quad_p1_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e3_ax(double x, double y)
-    {
-      return Legendre1x(x) * l0(y);
-    }
-
-    static double leg_quad_p1_e3_ay(double x, double y)
-    {
-      return Legendre1(x) * dl0(y);
-    }
-
-    static double leg_quad_p1_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e4_a(double x, double y)
-    {
-      return Legendre1(x) * l1(y);
-    }
-
-    static double leg_quad_p1_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e4_ax(double x, double y)
-    {
-      return Legendre1x(x) * l1(y);
-    }
-
-    static double leg_quad_p1_e4_ay(double x, double y)
-    {
-      return Legendre1(x) * dl1(y);
-    }
-
-    static double leg_quad_p1_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 2 */
-
-    static double leg_quad_p2_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre2(y));
-    }
-
-    static double leg_quad_p2_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre2(y));
-    }
-
-    static double leg_quad_p2_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p2_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre2x(y));
-    }
-
-    static double leg_quad_p2_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre2(y));
-    }
-
-    static double leg_quad_p2_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre2(y));
-    }
-
-    static double leg_quad_p2_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p2_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre2x(y));
-    }
-
-    static double leg_quad_p2_e3_a_0(double x, double y)
-    {
-      return Legendre2(x) * l0(y);
-    }
-
-    static double leg_quad_p2_e3_a_1(double x, double y)
-    {
-      return -(Legendre2(x) * l0(y));
-    }
-
-    static double leg_quad_p2_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e3_ax_0(double x, double y)
-    {
-      return Legendre2x(x) * l0(y);
-    }
-
-    static double leg_quad_p2_e3_ax_1(double x, double y)
-    {
-      return -(Legendre2x(x) * l0(y));
-    }
-
-    static double leg_quad_p2_e3_ay_0(double x, double y)
-    {
-      return Legendre2(x) * dl0(y);
-    }
-
-    static double leg_quad_p2_e3_ay_1(double x, double y)
-    {
-      return -(Legendre2(x) * dl0(y));
-    }
-
-    static double leg_quad_p2_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e4_a_1(double x, double y)
-    {
-      return Legendre2(x) * l1(y);
-    }
-
-    static double leg_quad_p2_e4_a_0(double x, double y)
-    {
-      return -(Legendre2(x) * l1(y));
-    }
-
-    static double leg_quad_p2_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e4_ax_1(double x, double y)
-    {
-      return Legendre2x(x) * l1(y);
-    }
-
-    static double leg_quad_p2_e4_ax_0(double x, double y)
-    {
-      return -(Legendre2x(x) * l1(y));
-    }
-
-    static double leg_quad_p2_e4_ay_1(double x, double y)
-    {
-      return Legendre2(x) * dl1(y);
-    }
-
-    static double leg_quad_p2_e4_ay_0(double x, double y)
-    {
-      return -(Legendre2(x) * dl1(y));
-    }
-
-    static double leg_quad_p2_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 3 */
-
-    static double leg_quad_p3_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e1_b(double x, double y)
-    {
-      return l0(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e1_bx(double x, double y)
-    {
-      return dl0(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3_e1_by(double x, double y)
-    {
-      return l0(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p3_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e2_b(double x, double y)
-    {
-      return l1(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e2_bx(double x, double y)
-    {
-      return dl1(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3_e2_by(double x, double y)
-    {
-      return l1(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p3_e3_a(double x, double y)
-    {
-      return Legendre3(x) * l0(y);
-    }
-
-    static double leg_quad_p3_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e3_ax(double x, double y)
-    {
-      return Legendre3x(x) * l0(y);
-    }
-
-    static double leg_quad_p3_e3_ay(double x, double y)
-    {
-      return Legendre3(x) * dl0(y);
-    }
-
-    static double leg_quad_p3_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e4_a(double x, double y)
-    {
-      return Legendre3(x) * l1(y);
-    }
-
-    static double leg_quad_p3_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e4_ax(double x, double y)
-    {
-      return Legendre3x(x) * l1(y);
-    }
-
-    static double leg_quad_p3_e4_ay(double x, double y)
-    {
-      return Legendre3(x) * dl1(y);
-    }
-
-    static double leg_quad_p3_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 4 */
-
-    static double leg_quad_p4_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre4(y));
-    }
-
-    static double leg_quad_p4_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre4(y));
-    }
-
-    static double leg_quad_p4_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p4_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre4x(y));
-    }
-
-    static double leg_quad_p4_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre4(y));
-    }
-
-    static double leg_quad_p4_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre4(y));
-    }
-
-    static double leg_quad_p4_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p4_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre4x(y));
-    }
-
-    static double leg_quad_p4_e3_a_0(double x, double y)
-    {
-      return Legendre4(x) * l0(y);
-    }
-
-    static double leg_quad_p4_e3_a_1(double x, double y)
-    {
-      return -(Legendre4(x) * l0(y));
-    }
-
-    static double leg_quad_p4_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e3_ax_0(double x, double y)
-    {
-      return Legendre4x(x) * l0(y);
-    }
-
-    static double leg_quad_p4_e3_ax_1(double x, double y)
-    {
-      return -(Legendre4x(x) * l0(y));
-    }
-
-    static double leg_quad_p4_e3_ay_0(double x, double y)
-    {
-      return Legendre4(x) * dl0(y);
-    }
-
-    static double leg_quad_p4_e3_ay_1(double x, double y)
-    {
-      return -(Legendre4(x) * dl0(y));
-    }
-
-    static double leg_quad_p4_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e4_a_1(double x, double y)
-    {
-      return Legendre4(x) * l1(y);
-    }
-
-    static double leg_quad_p4_e4_a_0(double x, double y)
-    {
-      return -(Legendre4(x) * l1(y));
-    }
-
-    static double leg_quad_p4_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e4_ax_1(double x, double y)
-    {
-      return Legendre4x(x) * l1(y);
-    }
-
-    static double leg_quad_p4_e4_ax_0(double x, double y)
-    {
-      return -(Legendre4x(x) * l1(y));
-    }
-
-    static double leg_quad_p4_e4_ay_1(double x, double y)
-    {
-      return Legendre4(x) * dl1(y);
-    }
-
-    static double leg_quad_p4_e4_ay_0(double x, double y)
-    {
-      return -(Legendre4(x) * dl1(y));
-    }
-
-    static double leg_quad_p4_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 5 */
-
-    static double leg_quad_p5_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e1_b(double x, double y)
-    {
-      return l0(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e1_bx(double x, double y)
-    {
-      return dl0(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5_e1_by(double x, double y)
-    {
-      return l0(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p5_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e2_b(double x, double y)
-    {
-      return l1(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e2_bx(double x, double y)
-    {
-      return dl1(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5_e2_by(double x, double y)
-    {
-      return l1(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p5_e3_a(double x, double y)
-    {
-      return Legendre5(x) * l0(y);
-    }
-
-    static double leg_quad_p5_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e3_ax(double x, double y)
-    {
-      return Legendre5x(x) * l0(y);
-    }
-
-    static double leg_quad_p5_e3_ay(double x, double y)
-    {
-      return Legendre5(x) * dl0(y);
-    }
-
-    static double leg_quad_p5_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e4_a(double x, double y)
-    {
-      return Legendre5(x) * l1(y);
-    }
-
-    static double leg_quad_p5_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e4_ax(double x, double y)
-    {
-      return Legendre5x(x) * l1(y);
-    }
-
-    static double leg_quad_p5_e4_ay(double x, double y)
-    {
-      return Legendre5(x) * dl1(y);
-    }
-
-    static double leg_quad_p5_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 6 */
-
-    static double leg_quad_p6_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre6(y));
-    }
-
-    static double leg_quad_p6_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre6(y));
-    }
-
-    static double leg_quad_p6_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p6_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre6x(y));
-    }
-
-    static double leg_quad_p6_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre6(y));
-    }
-
-    static double leg_quad_p6_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre6(y));
-    }
-
-    static double leg_quad_p6_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p6_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre6x(y));
-    }
-
-    static double leg_quad_p6_e3_a_0(double x, double y)
-    {
-      return Legendre6(x) * l0(y);
-    }
-
-    static double leg_quad_p6_e3_a_1(double x, double y)
-    {
-      return -(Legendre6(x) * l0(y));
-    }
-
-    static double leg_quad_p6_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e3_ax_0(double x, double y)
-    {
-      return Legendre6x(x) * l0(y);
-    }
-
-    static double leg_quad_p6_e3_ax_1(double x, double y)
-    {
-      return -(Legendre6x(x) * l0(y));
-    }
-
-    static double leg_quad_p6_e3_ay_0(double x, double y)
-    {
-      return Legendre6(x) * dl0(y);
-    }
-
-    static double leg_quad_p6_e3_ay_1(double x, double y)
-    {
-      return -(Legendre6(x) * dl0(y));
-    }
-
-    static double leg_quad_p6_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e4_a_1(double x, double y)
-    {
-      return Legendre6(x) * l1(y);
-    }
-
-    static double leg_quad_p6_e4_a_0(double x, double y)
-    {
-      return -(Legendre6(x) * l1(y));
-    }
-
-    static double leg_quad_p6_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e4_ax_1(double x, double y)
-    {
-      return Legendre6x(x) * l1(y);
-    }
-
-    static double leg_quad_p6_e4_ax_0(double x, double y)
-    {
-      return -(Legendre6x(x) * l1(y));
-    }
-
-    static double leg_quad_p6_e4_ay_1(double x, double y)
-    {
-      return Legendre6(x) * dl1(y);
-    }
-
-    static double leg_quad_p6_e4_ay_0(double x, double y)
-    {
-      return -(Legendre6(x) * dl1(y));
-    }
-
-    static double leg_quad_p6_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 7 */
-
-    static double leg_quad_p7_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e1_b(double x, double y)
-    {
-      return l0(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e1_bx(double x, double y)
-    {
-      return dl0(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7_e1_by(double x, double y)
-    {
-      return l0(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p7_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e2_b(double x, double y)
-    {
-      return l1(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e2_bx(double x, double y)
-    {
-      return dl1(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7_e2_by(double x, double y)
-    {
-      return l1(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p7_e3_a(double x, double y)
-    {
-      return Legendre7(x) * l0(y);
-    }
-
-    static double leg_quad_p7_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e3_ax(double x, double y)
-    {
-      return Legendre7x(x) * l0(y);
-    }
-
-    static double leg_quad_p7_e3_ay(double x, double y)
-    {
-      return Legendre7(x) * dl0(y);
-    }
-
-    static double leg_quad_p7_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e4_a(double x, double y)
-    {
-      return Legendre7(x) * l1(y);
-    }
-
-    static double leg_quad_p7_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e4_ax(double x, double y)
-    {
-      return Legendre7x(x) * l1(y);
-    }
-
-    static double leg_quad_p7_e4_ay(double x, double y)
-    {
-      return Legendre7(x) * dl1(y);
-    }
-
-    static double leg_quad_p7_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 8 */
-
-    static double leg_quad_p8_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre8(y));
-    }
-
-    static double leg_quad_p8_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre8(y));
-    }
-
-    static double leg_quad_p8_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p8_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre8x(y));
-    }
-
-    static double leg_quad_p8_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre8(y));
-    }
-
-    static double leg_quad_p8_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre8(y));
-    }
-
-    static double leg_quad_p8_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p8_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre8x(y));
-    }
-
-    static double leg_quad_p8_e3_a_0(double x, double y)
-    {
-      return Legendre8(x) * l0(y);
-    }
-
-    static double leg_quad_p8_e3_a_1(double x, double y)
-    {
-      return -(Legendre8(x) * l0(y));
-    }
-
-    static double leg_quad_p8_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e3_ax_0(double x, double y)
-    {
-      return Legendre8x(x) * l0(y);
-    }
-
-    static double leg_quad_p8_e3_ax_1(double x, double y)
-    {
-      return -(Legendre8x(x) * l0(y));
-    }
-
-    static double leg_quad_p8_e3_ay_0(double x, double y)
-    {
-      return Legendre8(x) * dl0(y);
-    }
-
-    static double leg_quad_p8_e3_ay_1(double x, double y)
-    {
-      return -(Legendre8(x) * dl0(y));
-    }
-
-    static double leg_quad_p8_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e4_a_1(double x, double y)
-    {
-      return Legendre8(x) * l1(y);
-    }
-
-    static double leg_quad_p8_e4_a_0(double x, double y)
-    {
-      return -(Legendre8(x) * l1(y));
-    }
-
-    static double leg_quad_p8_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e4_ax_1(double x, double y)
-    {
-      return Legendre8x(x) * l1(y);
-    }
-
-    static double leg_quad_p8_e4_ax_0(double x, double y)
-    {
-      return -(Legendre8x(x) * l1(y));
-    }
-
-    static double leg_quad_p8_e4_ay_1(double x, double y)
-    {
-      return Legendre8(x) * dl1(y);
-    }
-
-    static double leg_quad_p8_e4_ay_0(double x, double y)
-    {
-      return -(Legendre8(x) * dl1(y));
-    }
-
-    static double leg_quad_p8_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 9 */
-
-    static double leg_quad_p9_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e1_b(double x, double y)
-    {
-      return l0(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e1_bx(double x, double y)
-    {
-      return dl0(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9_e1_by(double x, double y)
-    {
-      return l0(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p9_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e2_b(double x, double y)
-    {
-      return l1(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e2_bx(double x, double y)
-    {
-      return dl1(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9_e2_by(double x, double y)
-    {
-      return l1(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p9_e3_a(double x, double y)
-    {
-      return Legendre9(x) * l0(y);
-    }
-
-    static double leg_quad_p9_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e3_ax(double x, double y)
-    {
-      return Legendre9x(x) * l0(y);
-    }
-
-    static double leg_quad_p9_e3_ay(double x, double y)
-    {
-      return Legendre9(x) * dl0(y);
-    }
-
-    static double leg_quad_p9_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e4_a(double x, double y)
-    {
-      return Legendre9(x) * l1(y);
-    }
-
-    static double leg_quad_p9_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e4_ax(double x, double y)
-    {
-      return Legendre9x(x) * l1(y);
-    }
-
-    static double leg_quad_p9_e4_ay(double x, double y)
-    {
-      return Legendre9(x) * dl1(y);
-    }
-
-    static double leg_quad_p9_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 10 */
-
-    static double leg_quad_p10_e1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e1_b_1(double x, double y)
-    {
-      return l0(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10_e1_b_0(double x, double y)
-    {
-      return -(l0(x) * Legendre10(y));
-    }
-
-    static double leg_quad_p10_e1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e1_bx_1(double x, double y)
-    {
-      return dl0(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10_e1_bx_0(double x, double y)
-    {
-      return -(dl0(x) * Legendre10(y));
-    }
-
-    static double leg_quad_p10_e1_by_1(double x, double y)
-    {
-      return l0(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p10_e1_by_0(double x, double y)
-    {
-      return -(l0(x) * Legendre10x(y));
-    }
-
-    static double leg_quad_p10_e2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e2_b_0(double x, double y)
-    {
-      return l1(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10_e2_b_1(double x, double y)
-    {
-      return -(l1(x) * Legendre10(y));
-    }
-
-    static double leg_quad_p10_e2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e2_bx_0(double x, double y)
-    {
-      return dl1(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10_e2_bx_1(double x, double y)
-    {
-      return -(dl1(x) * Legendre10(y));
-    }
-
-    static double leg_quad_p10_e2_by_0(double x, double y)
-    {
-      return l1(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p10_e2_by_1(double x, double y)
-    {
-      return -(l1(x) * Legendre10x(y));
-    }
-
-    static double leg_quad_p10_e3_a_0(double x, double y)
-    {
-      return Legendre10(x) * l0(y);
-    }
-
-    static double leg_quad_p10_e3_a_1(double x, double y)
-    {
-      return -(Legendre10(x) * l0(y));
-    }
-
-    static double leg_quad_p10_e3_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e3_ax_0(double x, double y)
-    {
-      return Legendre10x(x) * l0(y);
-    }
-
-    static double leg_quad_p10_e3_ax_1(double x, double y)
-    {
-      return -(Legendre10x(x) * l0(y));
-    }
-
-    static double leg_quad_p10_e3_ay_0(double x, double y)
-    {
-      return Legendre10(x) * dl0(y);
-    }
-
-    static double leg_quad_p10_e3_ay_1(double x, double y)
-    {
-      return -(Legendre10(x) * dl0(y));
-    }
-
-    static double leg_quad_p10_e3_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e3_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e4_a_1(double x, double y)
-    {
-      return Legendre10(x) * l1(y);
-    }
-
-    static double leg_quad_p10_e4_a_0(double x, double y)
-    {
-      return -(Legendre10(x) * l1(y));
-    }
-
-    static double leg_quad_p10_e4_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e4_ax_1(double x, double y)
-    {
-      return Legendre10x(x) * l1(y);
-    }
-
-    static double leg_quad_p10_e4_ax_0(double x, double y)
-    {
-      return -(Legendre10x(x) * l1(y));
-    }
-
-    static double leg_quad_p10_e4_ay_1(double x, double y)
-    {
-      return Legendre10(x) * dl1(y);
-    }
-
-    static double leg_quad_p10_e4_ay_0(double x, double y)
-    {
-      return -(Legendre10(x) * dl1(y));
-    }
-
-    static double leg_quad_p10_e4_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10_e4_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* BUBBLE */
-
-    /* BUBBLE ( 1 , 0 ) */
-
-    static double leg_quad_p0p2_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l2(y);
-    }
-
-    static double leg_quad_p0p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p2_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l2(y);
-    }
-
-    static double leg_quad_p0p2_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl2(y);
-    }
-
-    static double leg_quad_p0p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p3_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l3(y);
-    }
-
-    static double leg_quad_p0p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p3_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l3(y);
-    }
-
-    static double leg_quad_p0p3_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl3(y);
-    }
-
-    static double leg_quad_p0p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p4_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l4(y);
-    }
-
-    static double leg_quad_p0p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p4_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l4(y);
-    }
-
-    static double leg_quad_p0p4_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl4(y);
-    }
-
-    static double leg_quad_p0p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p5_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l5(y);
-    }
-
-    static double leg_quad_p0p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p5_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l5(y);
-    }
-
-    static double leg_quad_p0p5_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl5(y);
-    }
-
-    static double leg_quad_p0p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p6_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l6(y);
-    }
-
-    static double leg_quad_p0p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p6_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l6(y);
-    }
-
-    static double leg_quad_p0p6_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl6(y);
-    }
-
-    static double leg_quad_p0p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p7_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l7(y);
-    }
-
-    static double leg_quad_p0p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p7_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l7(y);
-    }
-
-    static double leg_quad_p0p7_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl7(y);
-    }
-
-    static double leg_quad_p0p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p8_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l8(y);
-    }
-
-    static double leg_quad_p0p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p8_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l8(y);
-    }
-
-    static double leg_quad_p0p8_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl8(y);
-    }
-
-    static double leg_quad_p0p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p9_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l9(y);
-    }
-
-    static double leg_quad_p0p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p9_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l9(y);
-    }
-
-    static double leg_quad_p0p9_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl9(y);
-    }
-
-    static double leg_quad_p0p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p10_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l10(y);
-    }
-
-    static double leg_quad_p0p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p10_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l10(y);
-    }
-
-    static double leg_quad_p0p10_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl10(y);
-    }
-
-    static double leg_quad_p0p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p11_b1_a(double x, double y)
-    {
-      return Legendre0(x) * l11(y);
-    }
-
-    static double leg_quad_p0p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p11_b1_ax(double x, double y)
-    {
-      return Legendre0x(x) * l11(y);
-    }
-
-    static double leg_quad_p0p11_b1_ay(double x, double y)
-    {
-      return Legendre0(x) * dl11(y);
-    }
-
-    static double leg_quad_p0p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p0p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p2_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l2(y);
-    }
-
-    static double leg_quad_p1p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p2_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l2(y);
-    }
-
-    static double leg_quad_p1p2_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl2(y);
-    }
-
-    static double leg_quad_p1p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p3_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l3(y);
-    }
-
-    static double leg_quad_p1p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p3_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l3(y);
-    }
-
-    static double leg_quad_p1p3_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl3(y);
-    }
-
-    static double leg_quad_p1p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p4_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l4(y);
-    }
-
-    static double leg_quad_p1p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p4_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l4(y);
-    }
-
-    static double leg_quad_p1p4_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl4(y);
-    }
-
-    static double leg_quad_p1p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p5_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l5(y);
-    }
-
-    static double leg_quad_p1p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p5_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l5(y);
-    }
-
-    static double leg_quad_p1p5_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl5(y);
-    }
-
-    static double leg_quad_p1p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p6_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l6(y);
-    }
-
-    static double leg_quad_p1p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p6_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l6(y);
-    }
-
-    static double leg_quad_p1p6_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl6(y);
-    }
-
-    static double leg_quad_p1p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p7_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l7(y);
-    }
-
-    static double leg_quad_p1p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p7_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l7(y);
-    }
-
-    static double leg_quad_p1p7_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl7(y);
-    }
-
-    static double leg_quad_p1p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p8_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l8(y);
-    }
-
-    static double leg_quad_p1p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p8_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l8(y);
-    }
-
-    static double leg_quad_p1p8_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl8(y);
-    }
-
-    static double leg_quad_p1p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p9_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l9(y);
-    }
-
-    static double leg_quad_p1p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p9_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l9(y);
-    }
-
-    static double leg_quad_p1p9_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl9(y);
-    }
-
-    static double leg_quad_p1p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p10_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l10(y);
-    }
-
-    static double leg_quad_p1p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p10_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l10(y);
-    }
-
-    static double leg_quad_p1p10_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl10(y);
-    }
-
-    static double leg_quad_p1p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p11_b1_a(double x, double y)
-    {
-      return Legendre1(x) * l11(y);
-    }
-
-    static double leg_quad_p1p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p11_b1_ax(double x, double y)
-    {
-      return Legendre1x(x) * l11(y);
-    }
-
-    static double leg_quad_p1p11_b1_ay(double x, double y)
-    {
-      return Legendre1(x) * dl11(y);
-    }
-
-    static double leg_quad_p1p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p1p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l2(y);
-    }
-
-    static double leg_quad_p2p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l2(y);
-    }
-
-    static double leg_quad_p2p2_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl2(y);
-    }
-
-    static double leg_quad_p2p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l3(y);
-    }
-
-    static double leg_quad_p2p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l3(y);
-    }
-
-    static double leg_quad_p2p3_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl3(y);
-    }
-
-    static double leg_quad_p2p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l4(y);
-    }
-
-    static double leg_quad_p2p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l4(y);
-    }
-
-    static double leg_quad_p2p4_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl4(y);
-    }
-
-    static double leg_quad_p2p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l5(y);
-    }
-
-    static double leg_quad_p2p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l5(y);
-    }
-
-    static double leg_quad_p2p5_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl5(y);
-    }
-
-    static double leg_quad_p2p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l6(y);
-    }
-
-    static double leg_quad_p2p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l6(y);
-    }
-
-    static double leg_quad_p2p6_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl6(y);
-    }
-
-    static double leg_quad_p2p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l7(y);
-    }
-
-    static double leg_quad_p2p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l7(y);
-    }
-
-    static double leg_quad_p2p7_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl7(y);
-    }
-
-    static double leg_quad_p2p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l8(y);
-    }
-
-    static double leg_quad_p2p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l8(y);
-    }
-
-    static double leg_quad_p2p8_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl8(y);
-    }
-
-    static double leg_quad_p2p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l9(y);
-    }
-
-    static double leg_quad_p2p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l9(y);
-    }
-
-    static double leg_quad_p2p9_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl9(y);
-    }
-
-    static double leg_quad_p2p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l10(y);
-    }
-
-    static double leg_quad_p2p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l10(y);
-    }
-
-    static double leg_quad_p2p10_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl10(y);
-    }
-
-    static double leg_quad_p2p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p11_b1_a(double x, double y)
-    {
-      return Legendre2(x) * l11(y);
-    }
-
-    static double leg_quad_p2p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p11_b1_ax(double x, double y)
-    {
-      return Legendre2x(x) * l11(y);
-    }
-
-    static double leg_quad_p2p11_b1_ay(double x, double y)
-    {
-      return Legendre2(x) * dl11(y);
-    }
-
-    static double leg_quad_p2p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l2(y);
-    }
-
-    static double leg_quad_p3p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l2(y);
-    }
-
-    static double leg_quad_p3p2_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl2(y);
-    }
-
-    static double leg_quad_p3p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l3(y);
-    }
-
-    static double leg_quad_p3p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l3(y);
-    }
-
-    static double leg_quad_p3p3_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl3(y);
-    }
-
-    static double leg_quad_p3p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l4(y);
-    }
-
-    static double leg_quad_p3p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l4(y);
-    }
-
-    static double leg_quad_p3p4_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl4(y);
-    }
-
-    static double leg_quad_p3p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l5(y);
-    }
-
-    static double leg_quad_p3p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l5(y);
-    }
-
-    static double leg_quad_p3p5_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl5(y);
-    }
-
-    static double leg_quad_p3p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l6(y);
-    }
-
-    static double leg_quad_p3p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l6(y);
-    }
-
-    static double leg_quad_p3p6_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl6(y);
-    }
-
-    static double leg_quad_p3p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l7(y);
-    }
-
-    static double leg_quad_p3p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l7(y);
-    }
-
-    static double leg_quad_p3p7_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl7(y);
-    }
-
-    static double leg_quad_p3p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l8(y);
-    }
-
-    static double leg_quad_p3p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l8(y);
-    }
-
-    static double leg_quad_p3p8_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl8(y);
-    }
-
-    static double leg_quad_p3p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l9(y);
-    }
-
-    static double leg_quad_p3p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l9(y);
-    }
-
-    static double leg_quad_p3p9_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl9(y);
-    }
-
-    static double leg_quad_p3p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l10(y);
-    }
-
-    static double leg_quad_p3p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l10(y);
-    }
-
-    static double leg_quad_p3p10_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl10(y);
-    }
-
-    static double leg_quad_p3p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p11_b1_a(double x, double y)
-    {
-      return Legendre3(x) * l11(y);
-    }
-
-    static double leg_quad_p3p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p11_b1_ax(double x, double y)
-    {
-      return Legendre3x(x) * l11(y);
-    }
-
-    static double leg_quad_p3p11_b1_ay(double x, double y)
-    {
-      return Legendre3(x) * dl11(y);
-    }
-
-    static double leg_quad_p3p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l2(y);
-    }
-
-    static double leg_quad_p4p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l2(y);
-    }
-
-    static double leg_quad_p4p2_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl2(y);
-    }
-
-    static double leg_quad_p4p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l3(y);
-    }
-
-    static double leg_quad_p4p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l3(y);
-    }
-
-    static double leg_quad_p4p3_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl3(y);
-    }
-
-    static double leg_quad_p4p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l4(y);
-    }
-
-    static double leg_quad_p4p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l4(y);
-    }
-
-    static double leg_quad_p4p4_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl4(y);
-    }
-
-    static double leg_quad_p4p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l5(y);
-    }
-
-    static double leg_quad_p4p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l5(y);
-    }
-
-    static double leg_quad_p4p5_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl5(y);
-    }
-
-    static double leg_quad_p4p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l6(y);
-    }
-
-    static double leg_quad_p4p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l6(y);
-    }
-
-    static double leg_quad_p4p6_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl6(y);
-    }
-
-    static double leg_quad_p4p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l7(y);
-    }
-
-    static double leg_quad_p4p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l7(y);
-    }
-
-    static double leg_quad_p4p7_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl7(y);
-    }
-
-    static double leg_quad_p4p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l8(y);
-    }
-
-    static double leg_quad_p4p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l8(y);
-    }
-
-    static double leg_quad_p4p8_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl8(y);
-    }
-
-    static double leg_quad_p4p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l9(y);
-    }
-
-    static double leg_quad_p4p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l9(y);
-    }
-
-    static double leg_quad_p4p9_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl9(y);
-    }
-
-    static double leg_quad_p4p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l10(y);
-    }
-
-    static double leg_quad_p4p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l10(y);
-    }
-
-    static double leg_quad_p4p10_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl10(y);
-    }
-
-    static double leg_quad_p4p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p11_b1_a(double x, double y)
-    {
-      return Legendre4(x) * l11(y);
-    }
-
-    static double leg_quad_p4p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p11_b1_ax(double x, double y)
-    {
-      return Legendre4x(x) * l11(y);
-    }
-
-    static double leg_quad_p4p11_b1_ay(double x, double y)
-    {
-      return Legendre4(x) * dl11(y);
-    }
-
-    static double leg_quad_p4p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l2(y);
-    }
-
-    static double leg_quad_p5p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l2(y);
-    }
-
-    static double leg_quad_p5p2_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl2(y);
-    }
-
-    static double leg_quad_p5p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l3(y);
-    }
-
-    static double leg_quad_p5p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l3(y);
-    }
-
-    static double leg_quad_p5p3_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl3(y);
-    }
-
-    static double leg_quad_p5p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l4(y);
-    }
-
-    static double leg_quad_p5p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l4(y);
-    }
-
-    static double leg_quad_p5p4_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl4(y);
-    }
-
-    static double leg_quad_p5p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l5(y);
-    }
-
-    static double leg_quad_p5p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l5(y);
-    }
-
-    static double leg_quad_p5p5_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl5(y);
-    }
-
-    static double leg_quad_p5p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l6(y);
-    }
-
-    static double leg_quad_p5p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l6(y);
-    }
-
-    static double leg_quad_p5p6_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl6(y);
-    }
-
-    static double leg_quad_p5p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l7(y);
-    }
-
-    static double leg_quad_p5p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l7(y);
-    }
-
-    static double leg_quad_p5p7_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl7(y);
-    }
-
-    static double leg_quad_p5p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l8(y);
-    }
-
-    static double leg_quad_p5p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l8(y);
-    }
-
-    static double leg_quad_p5p8_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl8(y);
-    }
-
-    static double leg_quad_p5p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l9(y);
-    }
-
-    static double leg_quad_p5p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l9(y);
-    }
-
-    static double leg_quad_p5p9_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl9(y);
-    }
-
-    static double leg_quad_p5p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l10(y);
-    }
-
-    static double leg_quad_p5p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l10(y);
-    }
-
-    static double leg_quad_p5p10_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl10(y);
-    }
-
-    static double leg_quad_p5p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p11_b1_a(double x, double y)
-    {
-      return Legendre5(x) * l11(y);
-    }
-
-    static double leg_quad_p5p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p11_b1_ax(double x, double y)
-    {
-      return Legendre5x(x) * l11(y);
-    }
-
-    static double leg_quad_p5p11_b1_ay(double x, double y)
-    {
-      return Legendre5(x) * dl11(y);
-    }
-
-    static double leg_quad_p5p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l2(y);
-    }
-
-    static double leg_quad_p6p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l2(y);
-    }
-
-    static double leg_quad_p6p2_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl2(y);
-    }
-
-    static double leg_quad_p6p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l3(y);
-    }
-
-    static double leg_quad_p6p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l3(y);
-    }
-
-    static double leg_quad_p6p3_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl3(y);
-    }
-
-    static double leg_quad_p6p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l4(y);
-    }
-
-    static double leg_quad_p6p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l4(y);
-    }
-
-    static double leg_quad_p6p4_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl4(y);
-    }
-
-    static double leg_quad_p6p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l5(y);
-    }
-
-    static double leg_quad_p6p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l5(y);
-    }
-
-    static double leg_quad_p6p5_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl5(y);
-    }
-
-    static double leg_quad_p6p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l6(y);
-    }
-
-    static double leg_quad_p6p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l6(y);
-    }
-
-    static double leg_quad_p6p6_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl6(y);
-    }
-
-    static double leg_quad_p6p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l7(y);
-    }
-
-    static double leg_quad_p6p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l7(y);
-    }
-
-    static double leg_quad_p6p7_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl7(y);
-    }
-
-    static double leg_quad_p6p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l8(y);
-    }
-
-    static double leg_quad_p6p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l8(y);
-    }
-
-    static double leg_quad_p6p8_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl8(y);
-    }
-
-    static double leg_quad_p6p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l9(y);
-    }
-
-    static double leg_quad_p6p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l9(y);
-    }
-
-    static double leg_quad_p6p9_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl9(y);
-    }
-
-    static double leg_quad_p6p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l10(y);
-    }
-
-    static double leg_quad_p6p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l10(y);
-    }
-
-    static double leg_quad_p6p10_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl10(y);
-    }
-
-    static double leg_quad_p6p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p11_b1_a(double x, double y)
-    {
-      return Legendre6(x) * l11(y);
-    }
-
-    static double leg_quad_p6p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p11_b1_ax(double x, double y)
-    {
-      return Legendre6x(x) * l11(y);
-    }
-
-    static double leg_quad_p6p11_b1_ay(double x, double y)
-    {
-      return Legendre6(x) * dl11(y);
-    }
-
-    static double leg_quad_p6p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l2(y);
-    }
-
-    static double leg_quad_p7p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l2(y);
-    }
-
-    static double leg_quad_p7p2_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl2(y);
-    }
-
-    static double leg_quad_p7p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l3(y);
-    }
-
-    static double leg_quad_p7p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l3(y);
-    }
-
-    static double leg_quad_p7p3_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl3(y);
-    }
-
-    static double leg_quad_p7p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l4(y);
-    }
-
-    static double leg_quad_p7p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l4(y);
-    }
-
-    static double leg_quad_p7p4_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl4(y);
-    }
-
-    static double leg_quad_p7p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l5(y);
-    }
-
-    static double leg_quad_p7p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l5(y);
-    }
-
-    static double leg_quad_p7p5_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl5(y);
-    }
-
-    static double leg_quad_p7p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l6(y);
-    }
-
-    static double leg_quad_p7p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l6(y);
-    }
-
-    static double leg_quad_p7p6_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl6(y);
-    }
-
-    static double leg_quad_p7p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l7(y);
-    }
-
-    static double leg_quad_p7p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l7(y);
-    }
-
-    static double leg_quad_p7p7_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl7(y);
-    }
-
-    static double leg_quad_p7p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l8(y);
-    }
-
-    static double leg_quad_p7p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l8(y);
-    }
-
-    static double leg_quad_p7p8_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl8(y);
-    }
-
-    static double leg_quad_p7p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l9(y);
-    }
-
-    static double leg_quad_p7p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l9(y);
-    }
-
-    static double leg_quad_p7p9_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl9(y);
-    }
-
-    static double leg_quad_p7p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l10(y);
-    }
-
-    static double leg_quad_p7p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l10(y);
-    }
-
-    static double leg_quad_p7p10_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl10(y);
-    }
-
-    static double leg_quad_p7p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p11_b1_a(double x, double y)
-    {
-      return Legendre7(x) * l11(y);
-    }
-
-    static double leg_quad_p7p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p11_b1_ax(double x, double y)
-    {
-      return Legendre7x(x) * l11(y);
-    }
-
-    static double leg_quad_p7p11_b1_ay(double x, double y)
-    {
-      return Legendre7(x) * dl11(y);
-    }
-
-    static double leg_quad_p7p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l2(y);
-    }
-
-    static double leg_quad_p8p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l2(y);
-    }
-
-    static double leg_quad_p8p2_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl2(y);
-    }
-
-    static double leg_quad_p8p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l3(y);
-    }
-
-    static double leg_quad_p8p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l3(y);
-    }
-
-    static double leg_quad_p8p3_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl3(y);
-    }
-
-    static double leg_quad_p8p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l4(y);
-    }
-
-    static double leg_quad_p8p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l4(y);
-    }
-
-    static double leg_quad_p8p4_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl4(y);
-    }
-
-    static double leg_quad_p8p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l5(y);
-    }
-
-    static double leg_quad_p8p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l5(y);
-    }
-
-    static double leg_quad_p8p5_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl5(y);
-    }
-
-    static double leg_quad_p8p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l6(y);
-    }
-
-    static double leg_quad_p8p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l6(y);
-    }
-
-    static double leg_quad_p8p6_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl6(y);
-    }
-
-    static double leg_quad_p8p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l7(y);
-    }
-
-    static double leg_quad_p8p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l7(y);
-    }
-
-    static double leg_quad_p8p7_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl7(y);
-    }
-
-    static double leg_quad_p8p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l8(y);
-    }
-
-    static double leg_quad_p8p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l8(y);
-    }
-
-    static double leg_quad_p8p8_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl8(y);
-    }
-
-    static double leg_quad_p8p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l9(y);
-    }
-
-    static double leg_quad_p8p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l9(y);
-    }
-
-    static double leg_quad_p8p9_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl9(y);
-    }
-
-    static double leg_quad_p8p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l10(y);
-    }
-
-    static double leg_quad_p8p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l10(y);
-    }
-
-    static double leg_quad_p8p10_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl10(y);
-    }
-
-    static double leg_quad_p8p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p11_b1_a(double x, double y)
-    {
-      return Legendre8(x) * l11(y);
-    }
-
-    static double leg_quad_p8p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p11_b1_ax(double x, double y)
-    {
-      return Legendre8x(x) * l11(y);
-    }
-
-    static double leg_quad_p8p11_b1_ay(double x, double y)
-    {
-      return Legendre8(x) * dl11(y);
-    }
-
-    static double leg_quad_p8p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l2(y);
-    }
-
-    static double leg_quad_p9p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l2(y);
-    }
-
-    static double leg_quad_p9p2_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl2(y);
-    }
-
-    static double leg_quad_p9p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l3(y);
-    }
-
-    static double leg_quad_p9p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l3(y);
-    }
-
-    static double leg_quad_p9p3_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl3(y);
-    }
-
-    static double leg_quad_p9p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l4(y);
-    }
-
-    static double leg_quad_p9p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l4(y);
-    }
-
-    static double leg_quad_p9p4_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl4(y);
-    }
-
-    static double leg_quad_p9p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l5(y);
-    }
-
-    static double leg_quad_p9p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l5(y);
-    }
-
-    static double leg_quad_p9p5_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl5(y);
-    }
-
-    static double leg_quad_p9p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l6(y);
-    }
-
-    static double leg_quad_p9p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l6(y);
-    }
-
-    static double leg_quad_p9p6_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl6(y);
-    }
-
-    static double leg_quad_p9p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l7(y);
-    }
-
-    static double leg_quad_p9p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l7(y);
-    }
-
-    static double leg_quad_p9p7_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl7(y);
-    }
-
-    static double leg_quad_p9p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l8(y);
-    }
-
-    static double leg_quad_p9p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l8(y);
-    }
-
-    static double leg_quad_p9p8_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl8(y);
-    }
-
-    static double leg_quad_p9p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l9(y);
-    }
-
-    static double leg_quad_p9p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l9(y);
-    }
-
-    static double leg_quad_p9p9_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl9(y);
-    }
-
-    static double leg_quad_p9p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l10(y);
-    }
-
-    static double leg_quad_p9p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l10(y);
-    }
-
-    static double leg_quad_p9p10_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl10(y);
-    }
-
-    static double leg_quad_p9p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p11_b1_a(double x, double y)
-    {
-      return Legendre9(x) * l11(y);
-    }
-
-    static double leg_quad_p9p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p11_b1_ax(double x, double y)
-    {
-      return Legendre9x(x) * l11(y);
-    }
-
-    static double leg_quad_p9p11_b1_ay(double x, double y)
-    {
-      return Legendre9(x) * dl11(y);
-    }
-
-    static double leg_quad_p9p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l2(y);
-    }
-
-    static double leg_quad_p10p2_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l2(y);
-    }
-
-    static double leg_quad_p10p2_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl2(y);
-    }
-
-    static double leg_quad_p10p2_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l3(y);
-    }
-
-    static double leg_quad_p10p3_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l3(y);
-    }
-
-    static double leg_quad_p10p3_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl3(y);
-    }
-
-    static double leg_quad_p10p3_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l4(y);
-    }
-
-    static double leg_quad_p10p4_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l4(y);
-    }
-
-    static double leg_quad_p10p4_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl4(y);
-    }
-
-    static double leg_quad_p10p4_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l5(y);
-    }
-
-    static double leg_quad_p10p5_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l5(y);
-    }
-
-    static double leg_quad_p10p5_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl5(y);
-    }
-
-    static double leg_quad_p10p5_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l6(y);
-    }
-
-    static double leg_quad_p10p6_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l6(y);
-    }
-
-    static double leg_quad_p10p6_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl6(y);
-    }
-
-    static double leg_quad_p10p6_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l7(y);
-    }
-
-    static double leg_quad_p10p7_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l7(y);
-    }
-
-    static double leg_quad_p10p7_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl7(y);
-    }
-
-    static double leg_quad_p10p7_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l8(y);
-    }
-
-    static double leg_quad_p10p8_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l8(y);
-    }
-
-    static double leg_quad_p10p8_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl8(y);
-    }
-
-    static double leg_quad_p10p8_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l9(y);
-    }
-
-    static double leg_quad_p10p9_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l9(y);
-    }
-
-    static double leg_quad_p10p9_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl9(y);
-    }
-
-    static double leg_quad_p10p9_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l10(y);
-    }
-
-    static double leg_quad_p10p10_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l10(y);
-    }
-
-    static double leg_quad_p10p10_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl10(y);
-    }
-
-    static double leg_quad_p10p10_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p11_b1_a(double x, double y)
-    {
-      return Legendre10(x) * l11(y);
-    }
-
-    static double leg_quad_p10p11_b1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p11_b1_ax(double x, double y)
-    {
-      return Legendre10x(x) * l11(y);
-    }
-
-    static double leg_quad_p10p11_b1_ay(double x, double y)
-    {
-      return Legendre10(x) * dl11(y);
-    }
-
-    static double leg_quad_p10p11_b1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p11_b1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* BUBBLE ( 0 , 1 ) */
-
-    static double leg_quad_p2p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p0_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p2p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p0_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p2p0_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p2p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p1_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p2p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p1_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p2p1_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p2p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p2_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p2p2_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p2p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p2p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p3_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p2p3_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p2p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p2p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p4_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p2p4_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p2p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p2p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p5_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p2p5_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p2p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p2p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p6_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p2p6_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p2p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p2p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p7_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p2p7_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p2p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p2p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p8_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p2p8_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p2p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p2p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p9_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p2p9_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p2p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b2_b(double x, double y)
-    {
-      return l2(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p2p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p2p10_b2_bx(double x, double y)
-    {
-      return dl2(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p2p10_b2_by(double x, double y)
-    {
-      return l2(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p3p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p0_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p3p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p0_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p3p0_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p3p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p1_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p3p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p1_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p3p1_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p3p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p3p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p2_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p3p2_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p3p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p3_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p3p3_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p3p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p3p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p4_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p3p4_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p3p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p3p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p5_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p3p5_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p3p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p3p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p6_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p3p6_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p3p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p3p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p7_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p3p7_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p3p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p3p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p8_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p3p8_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p3p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p3p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p9_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p3p9_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p3p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b2_b(double x, double y)
-    {
-      return l3(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p3p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p3p10_b2_bx(double x, double y)
-    {
-      return dl3(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p3p10_b2_by(double x, double y)
-    {
-      return l3(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p4p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p0_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p4p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p0_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p4p0_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p4p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p1_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p4p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p1_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p4p1_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p4p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p4p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p2_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p4p2_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p4p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p4p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p3_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p4p3_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p4p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p4_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p4p4_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p4p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p4p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p5_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p4p5_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p4p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p4p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p6_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p4p6_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p4p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p4p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p7_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p4p7_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p4p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p4p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p8_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p4p8_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p4p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p4p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p9_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p4p9_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p4p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b2_b(double x, double y)
-    {
-      return l4(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p4p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p4p10_b2_bx(double x, double y)
-    {
-      return dl4(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p4p10_b2_by(double x, double y)
-    {
-      return l4(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p5p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p0_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p5p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p0_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p5p0_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p5p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p1_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p5p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p1_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p5p1_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p5p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p5p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p2_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p5p2_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p5p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p5p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p3_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p5p3_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p5p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p5p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p4_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p5p4_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p5p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p5_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p5p5_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p5p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p5p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p6_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p5p6_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p5p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p5p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p7_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p5p7_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p5p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p5p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p8_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p5p8_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p5p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p5p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p9_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p5p9_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p5p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b2_b(double x, double y)
-    {
-      return l5(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p5p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p5p10_b2_bx(double x, double y)
-    {
-      return dl5(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p5p10_b2_by(double x, double y)
-    {
-      return l5(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p6p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p0_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p6p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p0_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p6p0_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p6p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p1_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p6p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p1_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p6p1_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p6p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p6p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p2_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p6p2_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p6p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p6p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p3_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p6p3_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p6p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p6p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p4_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p6p4_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p6p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p6p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p5_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p6p5_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p6p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p6_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p6p6_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p6p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p6p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p7_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p6p7_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p6p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p6p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p8_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p6p8_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p6p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p6p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p9_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p6p9_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p6p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b2_b(double x, double y)
-    {
-      return l6(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p6p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p6p10_b2_bx(double x, double y)
-    {
-      return dl6(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p6p10_b2_by(double x, double y)
-    {
-      return l6(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p7p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p0_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p7p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p0_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p7p0_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p7p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p1_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p7p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p1_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p7p1_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p7p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p7p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p2_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p7p2_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p7p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p7p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p3_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p7p3_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p7p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p7p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p4_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p7p4_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p7p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p7p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p5_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p7p5_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p7p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p7p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p6_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p7p6_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p7p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p7_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p7p7_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p7p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p7p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p8_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p7p8_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p7p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p7p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p9_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p7p9_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p7p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b2_b(double x, double y)
-    {
-      return l7(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p7p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p7p10_b2_bx(double x, double y)
-    {
-      return dl7(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p7p10_b2_by(double x, double y)
-    {
-      return l7(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p8p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p0_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p8p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p0_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p8p0_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p8p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p1_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p8p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p1_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p8p1_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p8p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p8p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p2_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p8p2_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p8p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p8p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p3_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p8p3_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p8p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p8p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p4_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p8p4_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p8p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p8p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p5_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p8p5_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p8p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p8p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p6_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p8p6_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p8p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p8p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p7_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p8p7_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p8p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p8_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p8p8_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p8p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p8p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p9_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p8p9_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p8p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b2_b(double x, double y)
-    {
-      return l8(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p8p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p8p10_b2_bx(double x, double y)
-    {
-      return dl8(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p8p10_b2_by(double x, double y)
-    {
-      return l8(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p9p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p0_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p9p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p0_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p9p0_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p9p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p1_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p9p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p1_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p9p1_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p9p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p9p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p2_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p9p2_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p9p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p9p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p3_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p9p3_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p9p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p9p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p4_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p9p4_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p9p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p9p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p5_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p9p5_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p9p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p9p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p6_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p9p6_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p9p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p9p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p7_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p9p7_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p9p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p9p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p8_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p9p8_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p9p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p9_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p9p9_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p9p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b2_b(double x, double y)
-    {
-      return l9(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p9p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p9p10_b2_bx(double x, double y)
-    {
-      return dl9(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p9p10_b2_by(double x, double y)
-    {
-      return l9(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p10p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p0_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p10p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p0_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p10p0_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p10p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p1_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p10p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p1_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p10p1_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p10p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p10p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p2_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p10p2_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p10p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p10p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p3_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p10p3_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p10p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p10p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p4_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p10p4_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p10p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p10p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p5_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p10p5_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p10p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p10p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p6_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p10p6_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p10p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p10p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p7_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p10p7_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p10p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p10p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p8_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p10p8_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p10p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p10p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p9_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p10p9_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p10p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b2_b(double x, double y)
-    {
-      return l10(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p10p10_b2_bx(double x, double y)
-    {
-      return dl10(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p10p10_b2_by(double x, double y)
-    {
-      return l10(x) * Legendre10x(y);
-    }
-
-    static double leg_quad_p11p0_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p0_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p11p0_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p0_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p0_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre0(y);
-    }
-
-    static double leg_quad_p11p0_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre0x(y);
-    }
-
-    static double leg_quad_p11p1_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p1_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p11p1_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p1_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p1_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre1(y);
-    }
-
-    static double leg_quad_p11p1_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre1x(y);
-    }
-
-    static double leg_quad_p11p2_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p2_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p11p2_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p2_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p2_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre2(y);
-    }
-
-    static double leg_quad_p11p2_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre2x(y);
-    }
-
-    static double leg_quad_p11p3_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p3_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p11p3_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p3_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p3_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre3(y);
-    }
-
-    static double leg_quad_p11p3_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre3x(y);
-    }
-
-    static double leg_quad_p11p4_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p4_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p11p4_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p4_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p4_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre4(y);
-    }
-
-    static double leg_quad_p11p4_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre4x(y);
-    }
-
-    static double leg_quad_p11p5_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p5_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p11p5_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p5_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p5_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre5(y);
-    }
-
-    static double leg_quad_p11p5_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre5x(y);
-    }
-
-    static double leg_quad_p11p6_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p6_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p11p6_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p6_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p6_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre6(y);
-    }
-
-    static double leg_quad_p11p6_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre6x(y);
-    }
-
-    static double leg_quad_p11p7_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p7_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p11p7_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p7_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p7_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre7(y);
-    }
-
-    static double leg_quad_p11p7_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre7x(y);
-    }
-
-    static double leg_quad_p11p8_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p8_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p11p8_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p8_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p8_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre8(y);
-    }
-
-    static double leg_quad_p11p8_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre8x(y);
-    }
-
-    static double leg_quad_p11p9_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p9_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p11p9_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p9_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p9_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre9(y);
-    }
-
-    static double leg_quad_p11p9_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre9x(y);
-    }
-
-    static double leg_quad_p11p10_b2_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p10_b2_b(double x, double y)
-    {
-      return l11(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p11p10_b2_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p10_b2_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double leg_quad_p11p10_b2_bx(double x, double y)
-    {
-      return dl11(x) * Legendre10(y);
-    }
-
-    static double leg_quad_p11p10_b2_by(double x, double y)
-    {
-      return l11(x) * Legendre10x(y);
-    }
-
-    static Shapeset::shape_fn_t leg_quad_fn_a[] =
-    {
-      leg_quad_p0_e1_a, leg_quad_p0_e1_a, leg_quad_p0_e2_a, leg_quad_p0_e2_a, leg_quad_p0_e3_a_0, leg_quad_p0_e3_a_1, leg_quad_p0_e4_a_0, leg_quad_p0_e4_a_1,
-      leg_quad_p1_e1_a, leg_quad_p1_e1_a, leg_quad_p1_e2_a, leg_quad_p1_e2_a, leg_quad_p1_e3_a, leg_quad_p1_e3_a, leg_quad_p1_e4_a, leg_quad_p1_e4_a,
-      leg_quad_p2_e1_a, leg_quad_p2_e1_a, leg_quad_p2_e2_a, leg_quad_p2_e2_a, leg_quad_p2_e3_a_0, leg_quad_p2_e3_a_1, leg_quad_p2_e4_a_0, leg_quad_p2_e4_a_1,
-      leg_quad_p3_e1_a, leg_quad_p3_e1_a, leg_quad_p3_e2_a, leg_quad_p3_e2_a, leg_quad_p3_e3_a, leg_quad_p3_e3_a, leg_quad_p3_e4_a, leg_quad_p3_e4_a,
-      leg_quad_p4_e1_a, leg_quad_p4_e1_a, leg_quad_p4_e2_a, leg_quad_p4_e2_a, leg_quad_p4_e3_a_0, leg_quad_p4_e3_a_1, leg_quad_p4_e4_a_0, leg_quad_p4_e4_a_1,
-      leg_quad_p5_e1_a, leg_quad_p5_e1_a, leg_quad_p5_e2_a, leg_quad_p5_e2_a, leg_quad_p5_e3_a, leg_quad_p5_e3_a, leg_quad_p5_e4_a, leg_quad_p5_e4_a,
-      leg_quad_p6_e1_a, leg_quad_p6_e1_a, leg_quad_p6_e2_a, leg_quad_p6_e2_a, leg_quad_p6_e3_a_0, leg_quad_p6_e3_a_1, leg_quad_p6_e4_a_0, leg_quad_p6_e4_a_1,
-      leg_quad_p7_e1_a, leg_quad_p7_e1_a, leg_quad_p7_e2_a, leg_quad_p7_e2_a, leg_quad_p7_e3_a, leg_quad_p7_e3_a, leg_quad_p7_e4_a, leg_quad_p7_e4_a,
-      leg_quad_p8_e1_a, leg_quad_p8_e1_a, leg_quad_p8_e2_a, leg_quad_p8_e2_a, leg_quad_p8_e3_a_0, leg_quad_p8_e3_a_1, leg_quad_p8_e4_a_0, leg_quad_p8_e4_a_1,
-      leg_quad_p9_e1_a, leg_quad_p9_e1_a, leg_quad_p9_e2_a, leg_quad_p9_e2_a, leg_quad_p9_e3_a, leg_quad_p9_e3_a, leg_quad_p9_e4_a, leg_quad_p9_e4_a,
-      leg_quad_p10_e1_a, leg_quad_p10_e1_a, leg_quad_p10_e2_a, leg_quad_p10_e2_a, leg_quad_p10_e3_a_0, leg_quad_p10_e3_a_1, leg_quad_p10_e4_a_0, leg_quad_p10_e4_a_1,
-
-      leg_quad_p0p2_b1_a,   leg_quad_p0p3_b1_a,   leg_quad_p0p4_b1_a,   leg_quad_p0p5_b1_a,   leg_quad_p0p6_b1_a,   leg_quad_p0p7_b1_a,   leg_quad_p0p8_b1_a,   leg_quad_p0p9_b1_a,   leg_quad_p0p10_b1_a,   leg_quad_p0p11_b1_a,   leg_quad_p1p2_b1_a,   leg_quad_p1p3_b1_a,   leg_quad_p1p4_b1_a,   leg_quad_p1p5_b1_a,   leg_quad_p1p6_b1_a,   leg_quad_p1p7_b1_a,   leg_quad_p1p8_b1_a,   leg_quad_p1p9_b1_a,   leg_quad_p1p10_b1_a,   leg_quad_p1p11_b1_a,   leg_quad_p2p2_b1_a,   leg_quad_p2p3_b1_a,   leg_quad_p2p4_b1_a,   leg_quad_p2p5_b1_a,   leg_quad_p2p6_b1_a,   leg_quad_p2p7_b1_a,   leg_quad_p2p8_b1_a,   leg_quad_p2p9_b1_a,   leg_quad_p2p10_b1_a,   leg_quad_p2p11_b1_a,   leg_quad_p3p2_b1_a,   leg_quad_p3p3_b1_a,   leg_quad_p3p4_b1_a,   leg_quad_p3p5_b1_a,   leg_quad_p3p6_b1_a,   leg_quad_p3p7_b1_a,   leg_quad_p3p8_b1_a,   leg_quad_p3p9_b1_a,   leg_quad_p3p10_b1_a,   leg_quad_p3p11_b1_a,   leg_quad_p4p2_b1_a,   leg_quad_p4p3_b1_a,   leg_quad_p4p4_b1_a,   leg_quad_p4p5_b1_a,   leg_quad_p4p6_b1_a,   leg_quad_p4p7_b1_a,   leg_quad_p4p8_b1_a,   leg_quad_p4p9_b1_a,   leg_quad_p4p10_b1_a,   leg_quad_p4p11_b1_a,   leg_quad_p5p2_b1_a,   leg_quad_p5p3_b1_a,   leg_quad_p5p4_b1_a,   leg_quad_p5p5_b1_a,   leg_quad_p5p6_b1_a,   leg_quad_p5p7_b1_a,   leg_quad_p5p8_b1_a,   leg_quad_p5p9_b1_a,   leg_quad_p5p10_b1_a,   leg_quad_p5p11_b1_a,   leg_quad_p6p2_b1_a,   leg_quad_p6p3_b1_a,   leg_quad_p6p4_b1_a,   leg_quad_p6p5_b1_a,   leg_quad_p6p6_b1_a,   leg_quad_p6p7_b1_a,   leg_quad_p6p8_b1_a,   leg_quad_p6p9_b1_a,   leg_quad_p6p10_b1_a,   leg_quad_p6p11_b1_a,   leg_quad_p7p2_b1_a,   leg_quad_p7p3_b1_a,   leg_quad_p7p4_b1_a,   leg_quad_p7p5_b1_a,   leg_quad_p7p6_b1_a,   leg_quad_p7p7_b1_a,   leg_quad_p7p8_b1_a,   leg_quad_p7p9_b1_a,   leg_quad_p7p10_b1_a,   leg_quad_p7p11_b1_a,   leg_quad_p8p2_b1_a,   leg_quad_p8p3_b1_a,   leg_quad_p8p4_b1_a,   leg_quad_p8p5_b1_a,   leg_quad_p8p6_b1_a,   leg_quad_p8p7_b1_a,   leg_quad_p8p8_b1_a,   leg_quad_p8p9_b1_a,   leg_quad_p8p10_b1_a,   leg_quad_p8p11_b1_a,   leg_quad_p9p2_b1_a,   leg_quad_p9p3_b1_a,   leg_quad_p9p4_b1_a,   leg_quad_p9p5_b1_a,   leg_quad_p9p6_b1_a,   leg_quad_p9p7_b1_a,   leg_quad_p9p8_b1_a,   leg_quad_p9p9_b1_a,   leg_quad_p9p10_b1_a,   leg_quad_p9p11_b1_a,   leg_quad_p10p2_b1_a,   leg_quad_p10p3_b1_a,   leg_quad_p10p4_b1_a,   leg_quad_p10p5_b1_a,   leg_quad_p10p6_b1_a,   leg_quad_p10p7_b1_a,   leg_quad_p10p8_b1_a,   leg_quad_p10p9_b1_a,   leg_quad_p10p10_b1_a,   leg_quad_p10p11_b1_a,   leg_quad_p2p0_b2_a,   leg_quad_p2p1_b2_a,   leg_quad_p2p2_b2_a,   leg_quad_p2p3_b2_a,   leg_quad_p2p4_b2_a,   leg_quad_p2p5_b2_a,   leg_quad_p2p6_b2_a,   leg_quad_p2p7_b2_a,   leg_quad_p2p8_b2_a,   leg_quad_p2p9_b2_a,   leg_quad_p2p10_b2_a,   leg_quad_p3p0_b2_a,   leg_quad_p3p1_b2_a,   leg_quad_p3p2_b2_a,   leg_quad_p3p3_b2_a,   leg_quad_p3p4_b2_a,   leg_quad_p3p5_b2_a,   leg_quad_p3p6_b2_a,   leg_quad_p3p7_b2_a,   leg_quad_p3p8_b2_a,   leg_quad_p3p9_b2_a,   leg_quad_p3p10_b2_a,   leg_quad_p4p0_b2_a,   leg_quad_p4p1_b2_a,   leg_quad_p4p2_b2_a,   leg_quad_p4p3_b2_a,   leg_quad_p4p4_b2_a,   leg_quad_p4p5_b2_a,   leg_quad_p4p6_b2_a,   leg_quad_p4p7_b2_a,   leg_quad_p4p8_b2_a,   leg_quad_p4p9_b2_a,   leg_quad_p4p10_b2_a,   leg_quad_p5p0_b2_a,   leg_quad_p5p1_b2_a,   leg_quad_p5p2_b2_a,   leg_quad_p5p3_b2_a,   leg_quad_p5p4_b2_a,   leg_quad_p5p5_b2_a,   leg_quad_p5p6_b2_a,   leg_quad_p5p7_b2_a,   leg_quad_p5p8_b2_a,   leg_quad_p5p9_b2_a,   leg_quad_p5p10_b2_a,   leg_quad_p6p0_b2_a,   leg_quad_p6p1_b2_a,   leg_quad_p6p2_b2_a,   leg_quad_p6p3_b2_a,   leg_quad_p6p4_b2_a,   leg_quad_p6p5_b2_a,   leg_quad_p6p6_b2_a,   leg_quad_p6p7_b2_a,   leg_quad_p6p8_b2_a,   leg_quad_p6p9_b2_a,   leg_quad_p6p10_b2_a,   leg_quad_p7p0_b2_a,   leg_quad_p7p1_b2_a,   leg_quad_p7p2_b2_a,   leg_quad_p7p3_b2_a,   leg_quad_p7p4_b2_a,   leg_quad_p7p5_b2_a,   leg_quad_p7p6_b2_a,   leg_quad_p7p7_b2_a,   leg_quad_p7p8_b2_a,   leg_quad_p7p9_b2_a,   leg_quad_p7p10_b2_a,   leg_quad_p8p0_b2_a,   leg_quad_p8p1_b2_a,   leg_quad_p8p2_b2_a,   leg_quad_p8p3_b2_a,   leg_quad_p8p4_b2_a,   leg_quad_p8p5_b2_a,   leg_quad_p8p6_b2_a,   leg_quad_p8p7_b2_a,   leg_quad_p8p8_b2_a,   leg_quad_p8p9_b2_a,   leg_quad_p8p10_b2_a,   leg_quad_p9p0_b2_a,   leg_quad_p9p1_b2_a,   leg_quad_p9p2_b2_a,   leg_quad_p9p3_b2_a,   leg_quad_p9p4_b2_a,   leg_quad_p9p5_b2_a,   leg_quad_p9p6_b2_a,   leg_quad_p9p7_b2_a,   leg_quad_p9p8_b2_a,   leg_quad_p9p9_b2_a,   leg_quad_p9p10_b2_a,   leg_quad_p10p0_b2_a,   leg_quad_p10p1_b2_a,   leg_quad_p10p2_b2_a,   leg_quad_p10p3_b2_a,   leg_quad_p10p4_b2_a,   leg_quad_p10p5_b2_a,   leg_quad_p10p6_b2_a,   leg_quad_p10p7_b2_a,   leg_quad_p10p8_b2_a,   leg_quad_p10p9_b2_a,   leg_quad_p10p10_b2_a,   leg_quad_p11p0_b2_a,   leg_quad_p11p1_b2_a,   leg_quad_p11p2_b2_a,   leg_quad_p11p3_b2_a,   leg_quad_p11p4_b2_a,   leg_quad_p11p5_b2_a,   leg_quad_p11p6_b2_a,   leg_quad_p11p7_b2_a,   leg_quad_p11p8_b2_a,   leg_quad_p11p9_b2_a,   leg_quad_p11p10_b2_a, };
-
-    static Shapeset::shape_fn_t leg_quad_fn_b[] =
+    static int leg_tri_bubble_indices_all_orders[]=
     {
-      leg_quad_p0_e1_b_0, leg_quad_p0_e1_b_1, leg_quad_p0_e2_b_0, leg_quad_p0_e2_b_1,  leg_quad_p0_e3_b, leg_quad_p0_e3_b, leg_quad_p0_e4_b, leg_quad_p0_e4_b,
-      leg_quad_p1_e1_b, leg_quad_p1_e1_b, leg_quad_p1_e2_b, leg_quad_p1_e2_b, leg_quad_p1_e3_b, leg_quad_p1_e3_b, leg_quad_p1_e4_b, leg_quad_p1_e4_b,
-      leg_quad_p2_e1_b_0, leg_quad_p2_e1_b_1, leg_quad_p2_e2_b_0, leg_quad_p2_e2_b_1, leg_quad_p2_e3_b, leg_quad_p2_e3_b, leg_quad_p2_e4_b, leg_quad_p2_e4_b,
-      leg_quad_p3_e1_b, leg_quad_p3_e1_b, leg_quad_p3_e2_b, leg_quad_p3_e2_b, leg_quad_p3_e3_b, leg_quad_p3_e3_b, leg_quad_p3_e4_b, leg_quad_p3_e4_b,
-      leg_quad_p4_e1_b_0, leg_quad_p4_e1_b_1, leg_quad_p4_e2_b_0, leg_quad_p4_e2_b_1, leg_quad_p4_e3_b, leg_quad_p4_e3_b, leg_quad_p4_e4_b, leg_quad_p4_e4_b,
-      leg_quad_p5_e1_b, leg_quad_p5_e1_b, leg_quad_p5_e2_b, leg_quad_p5_e2_b, leg_quad_p5_e3_b, leg_quad_p5_e3_b, leg_quad_p5_e4_b, leg_quad_p5_e4_b,
-      leg_quad_p6_e1_b_0, leg_quad_p6_e1_b_1, leg_quad_p6_e2_b_0, leg_quad_p6_e2_b_1, leg_quad_p6_e3_b, leg_quad_p6_e3_b, leg_quad_p6_e4_b, leg_quad_p6_e4_b,
-      leg_quad_p7_e1_b, leg_quad_p7_e1_b, leg_quad_p7_e2_b, leg_quad_p7_e2_b, leg_quad_p7_e3_b, leg_quad_p7_e3_b, leg_quad_p7_e4_b, leg_quad_p7_e4_b,
-      leg_quad_p8_e1_b_0, leg_quad_p8_e1_b_1, leg_quad_p8_e2_b_0, leg_quad_p8_e2_b_1, leg_quad_p8_e3_b, leg_quad_p8_e3_b, leg_quad_p8_e4_b, leg_quad_p8_e4_b,
-      leg_quad_p9_e1_b, leg_quad_p9_e1_b, leg_quad_p9_e2_b, leg_quad_p9_e2_b, leg_quad_p9_e3_b, leg_quad_p9_e3_b, leg_quad_p9_e4_b, leg_quad_p9_e4_b,
-      leg_quad_p10_e1_b_0, leg_quad_p10_e1_b_1, leg_quad_p10_e2_b_0, leg_quad_p10_e2_b_1, leg_quad_p10_e3_b, leg_quad_p10_e3_b, leg_quad_p10_e4_b, leg_quad_p10_e4_b,
-
-      leg_quad_p0p2_b1_b,   leg_quad_p0p3_b1_b,   leg_quad_p0p4_b1_b,   leg_quad_p0p5_b1_b,   leg_quad_p0p6_b1_b,   leg_quad_p0p7_b1_b,   leg_quad_p0p8_b1_b,   leg_quad_p0p9_b1_b,   leg_quad_p0p10_b1_b,   leg_quad_p0p11_b1_b,   leg_quad_p1p2_b1_b,   leg_quad_p1p3_b1_b,   leg_quad_p1p4_b1_b,   leg_quad_p1p5_b1_b,   leg_quad_p1p6_b1_b,   leg_quad_p1p7_b1_b,   leg_quad_p1p8_b1_b,   leg_quad_p1p9_b1_b,   leg_quad_p1p10_b1_b,   leg_quad_p1p11_b1_b,   leg_quad_p2p2_b1_b,   leg_quad_p2p3_b1_b,   leg_quad_p2p4_b1_b,   leg_quad_p2p5_b1_b,   leg_quad_p2p6_b1_b,   leg_quad_p2p7_b1_b,   leg_quad_p2p8_b1_b,   leg_quad_p2p9_b1_b,   leg_quad_p2p10_b1_b,   leg_quad_p2p11_b1_b,   leg_quad_p3p2_b1_b,   leg_quad_p3p3_b1_b,   leg_quad_p3p4_b1_b,   leg_quad_p3p5_b1_b,   leg_quad_p3p6_b1_b,   leg_quad_p3p7_b1_b,   leg_quad_p3p8_b1_b,   leg_quad_p3p9_b1_b,   leg_quad_p3p10_b1_b,   leg_quad_p3p11_b1_b,   leg_quad_p4p2_b1_b,   leg_quad_p4p3_b1_b,   leg_quad_p4p4_b1_b,   leg_quad_p4p5_b1_b,   leg_quad_p4p6_b1_b,   leg_quad_p4p7_b1_b,   leg_quad_p4p8_b1_b,   leg_quad_p4p9_b1_b,   leg_quad_p4p10_b1_b,   leg_quad_p4p11_b1_b,   leg_quad_p5p2_b1_b,   leg_quad_p5p3_b1_b,   leg_quad_p5p4_b1_b,   leg_quad_p5p5_b1_b,   leg_quad_p5p6_b1_b,   leg_quad_p5p7_b1_b,   leg_quad_p5p8_b1_b,   leg_quad_p5p9_b1_b,   leg_quad_p5p10_b1_b,   leg_quad_p5p11_b1_b,   leg_quad_p6p2_b1_b,   leg_quad_p6p3_b1_b,   leg_quad_p6p4_b1_b,   leg_quad_p6p5_b1_b,   leg_quad_p6p6_b1_b,   leg_quad_p6p7_b1_b,   leg_quad_p6p8_b1_b,   leg_quad_p6p9_b1_b,   leg_quad_p6p10_b1_b,   leg_quad_p6p11_b1_b,   leg_quad_p7p2_b1_b,   leg_quad_p7p3_b1_b,   leg_quad_p7p4_b1_b,   leg_quad_p7p5_b1_b,   leg_quad_p7p6_b1_b,   leg_quad_p7p7_b1_b,   leg_quad_p7p8_b1_b,   leg_quad_p7p9_b1_b,   leg_quad_p7p10_b1_b,   leg_quad_p7p11_b1_b,   leg_quad_p8p2_b1_b,   leg_quad_p8p3_b1_b,   leg_quad_p8p4_b1_b,   leg_quad_p8p5_b1_b,   leg_quad_p8p6_b1_b,   leg_quad_p8p7_b1_b,   leg_quad_p8p8_b1_b,   leg_quad_p8p9_b1_b,   leg_quad_p8p10_b1_b,   leg_quad_p8p11_b1_b,   leg_quad_p9p2_b1_b,   leg_quad_p9p3_b1_b,   leg_quad_p9p4_b1_b,   leg_quad_p9p5_b1_b,   leg_quad_p9p6_b1_b,   leg_quad_p9p7_b1_b,   leg_quad_p9p8_b1_b,   leg_quad_p9p9_b1_b,   leg_quad_p9p10_b1_b,   leg_quad_p9p11_b1_b,   leg_quad_p10p2_b1_b,   leg_quad_p10p3_b1_b,   leg_quad_p10p4_b1_b,   leg_quad_p10p5_b1_b,   leg_quad_p10p6_b1_b,   leg_quad_p10p7_b1_b,   leg_quad_p10p8_b1_b,   leg_quad_p10p9_b1_b,   leg_quad_p10p10_b1_b,   leg_quad_p10p11_b1_b,   leg_quad_p2p0_b2_b,   leg_quad_p2p1_b2_b,   leg_quad_p2p2_b2_b,   leg_quad_p2p3_b2_b,   leg_quad_p2p4_b2_b,   leg_quad_p2p5_b2_b,   leg_quad_p2p6_b2_b,   leg_quad_p2p7_b2_b,   leg_quad_p2p8_b2_b,   leg_quad_p2p9_b2_b,   leg_quad_p2p10_b2_b,   leg_quad_p3p0_b2_b,   leg_quad_p3p1_b2_b,   leg_quad_p3p2_b2_b,   leg_quad_p3p3_b2_b,   leg_quad_p3p4_b2_b,   leg_quad_p3p5_b2_b,   leg_quad_p3p6_b2_b,   leg_quad_p3p7_b2_b,   leg_quad_p3p8_b2_b,   leg_quad_p3p9_b2_b,   leg_quad_p3p10_b2_b,   leg_quad_p4p0_b2_b,   leg_quad_p4p1_b2_b,   leg_quad_p4p2_b2_b,   leg_quad_p4p3_b2_b,   leg_quad_p4p4_b2_b,   leg_quad_p4p5_b2_b,   leg_quad_p4p6_b2_b,   leg_quad_p4p7_b2_b,   leg_quad_p4p8_b2_b,   leg_quad_p4p9_b2_b,   leg_quad_p4p10_b2_b,   leg_quad_p5p0_b2_b,   leg_quad_p5p1_b2_b,   leg_quad_p5p2_b2_b,   leg_quad_p5p3_b2_b,   leg_quad_p5p4_b2_b,   leg_quad_p5p5_b2_b,   leg_quad_p5p6_b2_b,   leg_quad_p5p7_b2_b,   leg_quad_p5p8_b2_b,   leg_quad_p5p9_b2_b,   leg_quad_p5p10_b2_b,   leg_quad_p6p0_b2_b,   leg_quad_p6p1_b2_b,   leg_quad_p6p2_b2_b,   leg_quad_p6p3_b2_b,   leg_quad_p6p4_b2_b,   leg_quad_p6p5_b2_b,   leg_quad_p6p6_b2_b,   leg_quad_p6p7_b2_b,   leg_quad_p6p8_b2_b,   leg_quad_p6p9_b2_b,   leg_quad_p6p10_b2_b,   leg_quad_p7p0_b2_b,   leg_quad_p7p1_b2_b,   leg_quad_p7p2_b2_b,   leg_quad_p7p3_b2_b,   leg_quad_p7p4_b2_b,   leg_quad_p7p5_b2_b,   leg_quad_p7p6_b2_b,   leg_quad_p7p7_b2_b,   leg_quad_p7p8_b2_b,   leg_quad_p7p9_b2_b,   leg_quad_p7p10_b2_b,   leg_quad_p8p0_b2_b,   leg_quad_p8p1_b2_b,   leg_quad_p8p2_b2_b,   leg_quad_p8p3_b2_b,   leg_quad_p8p4_b2_b,   leg_quad_p8p5_b2_b,   leg_quad_p8p6_b2_b,   leg_quad_p8p7_b2_b,   leg_quad_p8p8_b2_b,   leg_quad_p8p9_b2_b,   leg_quad_p8p10_b2_b,   leg_quad_p9p0_b2_b,   leg_quad_p9p1_b2_b,   leg_quad_p9p2_b2_b,   leg_quad_p9p3_b2_b,   leg_quad_p9p4_b2_b,   leg_quad_p9p5_b2_b,   leg_quad_p9p6_b2_b,   leg_quad_p9p7_b2_b,   leg_quad_p9p8_b2_b,   leg_quad_p9p9_b2_b,   leg_quad_p9p10_b2_b,   leg_quad_p10p0_b2_b,   leg_quad_p10p1_b2_b,   leg_quad_p10p2_b2_b,   leg_quad_p10p3_b2_b,   leg_quad_p10p4_b2_b,   leg_quad_p10p5_b2_b,   leg_quad_p10p6_b2_b,   leg_quad_p10p7_b2_b,   leg_quad_p10p8_b2_b,   leg_quad_p10p9_b2_b,   leg_quad_p10p10_b2_b,   leg_quad_p11p0_b2_b,   leg_quad_p11p1_b2_b,   leg_quad_p11p2_b2_b,   leg_quad_p11p3_b2_b,   leg_quad_p11p4_b2_b,   leg_quad_p11p5_b2_b,   leg_quad_p11p6_b2_b,   leg_quad_p11p7_b2_b,   leg_quad_p11p8_b2_b,   leg_quad_p11p9_b2_b,   leg_quad_p11p10_b2_b, };
+      15, 16, 17,
+      21, 22, 23, 24, 25,
+      32, 33, 34, 35, 36, 37, 38 ,
+      42, 43, 44, 45, 46, 47, 48, 49, 50,
+      57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+      71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+      90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104,
+      108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124 ,
+      131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149
+    };
 
-    static Shapeset::shape_fn_t leg_quad_fn_ax[] =
+    static int* leg_tri_bubble_indices[11] =
     {
-      leg_quad_p0_e1_ax, leg_quad_p0_e1_ax, leg_quad_p0_e2_ax, leg_quad_p0_e2_ax, leg_quad_p0_e3_ax_0, leg_quad_p0_e3_ax_1, leg_quad_p0_e4_ax_0, leg_quad_p0_e4_ax_1,
-      leg_quad_p1_e1_ax, leg_quad_p1_e1_ax, leg_quad_p1_e2_ax, leg_quad_p1_e2_ax, leg_quad_p1_e3_ax, leg_quad_p1_e3_ax, leg_quad_p1_e4_ax, leg_quad_p1_e4_ax,
-      leg_quad_p2_e1_ax, leg_quad_p2_e1_ax, leg_quad_p2_e2_ax, leg_quad_p2_e2_ax, leg_quad_p2_e3_ax_0, leg_quad_p2_e3_ax_1, leg_quad_p2_e4_ax_0, leg_quad_p2_e4_ax_1,
-      leg_quad_p3_e1_ax, leg_quad_p3_e1_ax, leg_quad_p3_e2_ax, leg_quad_p3_e2_ax, leg_quad_p3_e3_ax, leg_quad_p3_e3_ax, leg_quad_p3_e4_ax, leg_quad_p3_e4_ax,
-      leg_quad_p4_e1_ax, leg_quad_p4_e1_ax, leg_quad_p4_e2_ax, leg_quad_p4_e2_ax, leg_quad_p4_e3_ax_0, leg_quad_p4_e3_ax_1, leg_quad_p4_e4_ax_0, leg_quad_p4_e4_ax_1,
-      leg_quad_p5_e1_ax, leg_quad_p5_e1_ax, leg_quad_p5_e2_ax, leg_quad_p5_e2_ax, leg_quad_p5_e3_ax, leg_quad_p5_e3_ax, leg_quad_p5_e4_ax, leg_quad_p5_e4_ax,
-      leg_quad_p6_e1_ax, leg_quad_p6_e1_ax, leg_quad_p6_e2_ax, leg_quad_p6_e2_ax, leg_quad_p6_e3_ax_0, leg_quad_p6_e3_ax_1, leg_quad_p6_e4_ax_0, leg_quad_p6_e4_ax_1,
-      leg_quad_p7_e1_ax, leg_quad_p7_e1_ax, leg_quad_p7_e2_ax, leg_quad_p7_e2_ax, leg_quad_p7_e3_ax, leg_quad_p7_e3_ax, leg_quad_p7_e4_ax, leg_quad_p7_e4_ax,
-      leg_quad_p8_e1_ax, leg_quad_p8_e1_ax, leg_quad_p8_e2_ax, leg_quad_p8_e2_ax, leg_quad_p8_e3_ax_0, leg_quad_p8_e3_ax_1, leg_quad_p8_e4_ax_0, leg_quad_p8_e4_ax_1,
-      leg_quad_p9_e1_ax, leg_quad_p9_e1_ax, leg_quad_p9_e2_ax, leg_quad_p9_e2_ax, leg_quad_p9_e3_ax, leg_quad_p9_e3_ax, leg_quad_p9_e4_ax, leg_quad_p9_e4_ax,
-      leg_quad_p10_e1_ax, leg_quad_p10_e1_ax, leg_quad_p10_e2_ax, leg_quad_p10_e2_ax, leg_quad_p10_e3_ax_0, leg_quad_p10_e3_ax_1, leg_quad_p10_e4_ax_0, leg_quad_p10_e4_ax_1,
-
-      leg_quad_p0p2_b1_ax,   leg_quad_p0p3_b1_ax,   leg_quad_p0p4_b1_ax,   leg_quad_p0p5_b1_ax,   leg_quad_p0p6_b1_ax,   leg_quad_p0p7_b1_ax,   leg_quad_p0p8_b1_ax,   leg_quad_p0p9_b1_ax,   leg_quad_p0p10_b1_ax,   leg_quad_p0p11_b1_ax,   leg_quad_p1p2_b1_ax,   leg_quad_p1p3_b1_ax,   leg_quad_p1p4_b1_ax,   leg_quad_p1p5_b1_ax,   leg_quad_p1p6_b1_ax,   leg_quad_p1p7_b1_ax,   leg_quad_p1p8_b1_ax,   leg_quad_p1p9_b1_ax,   leg_quad_p1p10_b1_ax,   leg_quad_p1p11_b1_ax,   leg_quad_p2p2_b1_ax,   leg_quad_p2p3_b1_ax,   leg_quad_p2p4_b1_ax,   leg_quad_p2p5_b1_ax,   leg_quad_p2p6_b1_ax,   leg_quad_p2p7_b1_ax,   leg_quad_p2p8_b1_ax,   leg_quad_p2p9_b1_ax,   leg_quad_p2p10_b1_ax,   leg_quad_p2p11_b1_ax,   leg_quad_p3p2_b1_ax,   leg_quad_p3p3_b1_ax,   leg_quad_p3p4_b1_ax,   leg_quad_p3p5_b1_ax,   leg_quad_p3p6_b1_ax,   leg_quad_p3p7_b1_ax,   leg_quad_p3p8_b1_ax,   leg_quad_p3p9_b1_ax,   leg_quad_p3p10_b1_ax,   leg_quad_p3p11_b1_ax,   leg_quad_p4p2_b1_ax,   leg_quad_p4p3_b1_ax,   leg_quad_p4p4_b1_ax,   leg_quad_p4p5_b1_ax,   leg_quad_p4p6_b1_ax,   leg_quad_p4p7_b1_ax,   leg_quad_p4p8_b1_ax,   leg_quad_p4p9_b1_ax,   leg_quad_p4p10_b1_ax,   leg_quad_p4p11_b1_ax,   leg_quad_p5p2_b1_ax,   leg_quad_p5p3_b1_ax,   leg_quad_p5p4_b1_ax,   leg_quad_p5p5_b1_ax,   leg_quad_p5p6_b1_ax,   leg_quad_p5p7_b1_ax,   leg_quad_p5p8_b1_ax,   leg_quad_p5p9_b1_ax,   leg_quad_p5p10_b1_ax,   leg_quad_p5p11_b1_ax,   leg_quad_p6p2_b1_ax,   leg_quad_p6p3_b1_ax,   leg_quad_p6p4_b1_ax,   leg_quad_p6p5_b1_ax,   leg_quad_p6p6_b1_ax,   leg_quad_p6p7_b1_ax,   leg_quad_p6p8_b1_ax,   leg_quad_p6p9_b1_ax,   leg_quad_p6p10_b1_ax,   leg_quad_p6p11_b1_ax,   leg_quad_p7p2_b1_ax,   leg_quad_p7p3_b1_ax,   leg_quad_p7p4_b1_ax,   leg_quad_p7p5_b1_ax,   leg_quad_p7p6_b1_ax,   leg_quad_p7p7_b1_ax,   leg_quad_p7p8_b1_ax,   leg_quad_p7p9_b1_ax,   leg_quad_p7p10_b1_ax,   leg_quad_p7p11_b1_ax,   leg_quad_p8p2_b1_ax,   leg_quad_p8p3_b1_ax,   leg_quad_p8p4_b1_ax,   leg_quad_p8p5_b1_ax,   leg_quad_p8p6_b1_ax,   leg_quad_p8p7_b1_ax,   leg_quad_p8p8_b1_ax,   leg_quad_p8p9_b1_ax,   leg_quad_p8p10_b1_ax,   leg_quad_p8p11_b1_ax,   leg_quad_p9p2_b1_ax,   leg_quad_p9p3_b1_ax,   leg_quad_p9p4_b1_ax,   leg_quad_p9p5_b1_ax,   leg_quad_p9p6_b1_ax,   leg_quad_p9p7_b1_ax,   leg_quad_p9p8_b1_ax,   leg_quad_p9p9_b1_ax,   leg_quad_p9p10_b1_ax,   leg_quad_p9p11_b1_ax,   leg_quad_p10p2_b1_ax,   leg_quad_p10p3_b1_ax,   leg_quad_p10p4_b1_ax,   leg_quad_p10p5_b1_ax,   leg_quad_p10p6_b1_ax,   leg_quad_p10p7_b1_ax,   leg_quad_p10p8_b1_ax,   leg_quad_p10p9_b1_ax,   leg_quad_p10p10_b1_ax,   leg_quad_p10p11_b1_ax,   leg_quad_p2p0_b2_ax,   leg_quad_p2p1_b2_ax,   leg_quad_p2p2_b2_ax,   leg_quad_p2p3_b2_ax,   leg_quad_p2p4_b2_ax,   leg_quad_p2p5_b2_ax,   leg_quad_p2p6_b2_ax,   leg_quad_p2p7_b2_ax,   leg_quad_p2p8_b2_ax,   leg_quad_p2p9_b2_ax,   leg_quad_p2p10_b2_ax,   leg_quad_p3p0_b2_ax,   leg_quad_p3p1_b2_ax,   leg_quad_p3p2_b2_ax,   leg_quad_p3p3_b2_ax,   leg_quad_p3p4_b2_ax,   leg_quad_p3p5_b2_ax,   leg_quad_p3p6_b2_ax,   leg_quad_p3p7_b2_ax,   leg_quad_p3p8_b2_ax,   leg_quad_p3p9_b2_ax,   leg_quad_p3p10_b2_ax,   leg_quad_p4p0_b2_ax,   leg_quad_p4p1_b2_ax,   leg_quad_p4p2_b2_ax,   leg_quad_p4p3_b2_ax,   leg_quad_p4p4_b2_ax,   leg_quad_p4p5_b2_ax,   leg_quad_p4p6_b2_ax,   leg_quad_p4p7_b2_ax,   leg_quad_p4p8_b2_ax,   leg_quad_p4p9_b2_ax,   leg_quad_p4p10_b2_ax,   leg_quad_p5p0_b2_ax,   leg_quad_p5p1_b2_ax,   leg_quad_p5p2_b2_ax,   leg_quad_p5p3_b2_ax,   leg_quad_p5p4_b2_ax,   leg_quad_p5p5_b2_ax,   leg_quad_p5p6_b2_ax,   leg_quad_p5p7_b2_ax,   leg_quad_p5p8_b2_ax,   leg_quad_p5p9_b2_ax,   leg_quad_p5p10_b2_ax,   leg_quad_p6p0_b2_ax,   leg_quad_p6p1_b2_ax,   leg_quad_p6p2_b2_ax,   leg_quad_p6p3_b2_ax,   leg_quad_p6p4_b2_ax,   leg_quad_p6p5_b2_ax,   leg_quad_p6p6_b2_ax,   leg_quad_p6p7_b2_ax,   leg_quad_p6p8_b2_ax,   leg_quad_p6p9_b2_ax,   leg_quad_p6p10_b2_ax,   leg_quad_p7p0_b2_ax,   leg_quad_p7p1_b2_ax,   leg_quad_p7p2_b2_ax,   leg_quad_p7p3_b2_ax,   leg_quad_p7p4_b2_ax,   leg_quad_p7p5_b2_ax,   leg_quad_p7p6_b2_ax,   leg_quad_p7p7_b2_ax,   leg_quad_p7p8_b2_ax,   leg_quad_p7p9_b2_ax,   leg_quad_p7p10_b2_ax,   leg_quad_p8p0_b2_ax,   leg_quad_p8p1_b2_ax,   leg_quad_p8p2_b2_ax,   leg_quad_p8p3_b2_ax,   leg_quad_p8p4_b2_ax,   leg_quad_p8p5_b2_ax,   leg_quad_p8p6_b2_ax,   leg_quad_p8p7_b2_ax,   leg_quad_p8p8_b2_ax,   leg_quad_p8p9_b2_ax,   leg_quad_p8p10_b2_ax,   leg_quad_p9p0_b2_ax,   leg_quad_p9p1_b2_ax,   leg_quad_p9p2_b2_ax,   leg_quad_p9p3_b2_ax,   leg_quad_p9p4_b2_ax,   leg_quad_p9p5_b2_ax,   leg_quad_p9p6_b2_ax,   leg_quad_p9p7_b2_ax,   leg_quad_p9p8_b2_ax,   leg_quad_p9p9_b2_ax,   leg_quad_p9p10_b2_ax,   leg_quad_p10p0_b2_ax,   leg_quad_p10p1_b2_ax,   leg_quad_p10p2_b2_ax,   leg_quad_p10p3_b2_ax,   leg_quad_p10p4_b2_ax,   leg_quad_p10p5_b2_ax,   leg_quad_p10p6_b2_ax,   leg_quad_p10p7_b2_ax,   leg_quad_p10p8_b2_ax,   leg_quad_p10p9_b2_ax,   leg_quad_p10p10_b2_ax,   leg_quad_p11p0_b2_ax,   leg_quad_p11p1_b2_ax,   leg_quad_p11p2_b2_ax,   leg_quad_p11p3_b2_ax,   leg_quad_p11p4_b2_ax,   leg_quad_p11p5_b2_ax,   leg_quad_p11p6_b2_ax,   leg_quad_p11p7_b2_ax,   leg_quad_p11p8_b2_ax,   leg_quad_p11p9_b2_ax,   leg_quad_p11p10_b2_ax, };
+      NULL, NULL,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders,
+      leg_tri_bubble_indices_all_orders
+    };
 
-    static Shapeset::shape_fn_t leg_quad_fn_bx[] =
-    {
-      leg_quad_p0_e1_bx_0, leg_quad_p0_e1_bx_1, leg_quad_p0_e2_bx_0, leg_quad_p0_e2_bx_1,  leg_quad_p0_e3_bx, leg_quad_p0_e3_bx, leg_quad_p0_e4_bx, leg_quad_p0_e4_bx,
-      leg_quad_p1_e1_bx, leg_quad_p1_e1_bx, leg_quad_p1_e2_bx, leg_quad_p1_e2_bx, leg_quad_p1_e3_bx, leg_quad_p1_e3_bx, leg_quad_p1_e4_bx, leg_quad_p1_e4_bx,
-      leg_quad_p2_e1_bx_0, leg_quad_p2_e1_bx_1, leg_quad_p2_e2_bx_0, leg_quad_p2_e2_bx_1, leg_quad_p2_e3_bx, leg_quad_p2_e3_bx, leg_quad_p2_e4_bx, leg_quad_p2_e4_bx,
-      leg_quad_p3_e1_bx, leg_quad_p3_e1_bx, leg_quad_p3_e2_bx, leg_quad_p3_e2_bx, leg_quad_p3_e3_bx, leg_quad_p3_e3_bx, leg_quad_p3_e4_bx, leg_quad_p3_e4_bx,
-      leg_quad_p4_e1_bx_0, leg_quad_p4_e1_bx_1, leg_quad_p4_e2_bx_0, leg_quad_p4_e2_bx_1, leg_quad_p4_e3_bx, leg_quad_p4_e3_bx, leg_quad_p4_e4_bx, leg_quad_p4_e4_bx,
-      leg_quad_p5_e1_bx, leg_quad_p5_e1_bx, leg_quad_p5_e2_bx, leg_quad_p5_e2_bx, leg_quad_p5_e3_bx, leg_quad_p5_e3_bx, leg_quad_p5_e4_bx, leg_quad_p5_e4_bx,
-      leg_quad_p6_e1_bx_0, leg_quad_p6_e1_bx_1, leg_quad_p6_e2_bx_0, leg_quad_p6_e2_bx_1, leg_quad_p6_e3_bx, leg_quad_p6_e3_bx, leg_quad_p6_e4_bx, leg_quad_p6_e4_bx,
-      leg_quad_p7_e1_bx, leg_quad_p7_e1_bx, leg_quad_p7_e2_bx, leg_quad_p7_e2_bx, leg_quad_p7_e3_bx, leg_quad_p7_e3_bx, leg_quad_p7_e4_bx, leg_quad_p7_e4_bx,
-      leg_quad_p8_e1_bx_0, leg_quad_p8_e1_bx_1, leg_quad_p8_e2_bx_0, leg_quad_p8_e2_bx_1, leg_quad_p8_e3_bx, leg_quad_p8_e3_bx, leg_quad_p8_e4_bx, leg_quad_p8_e4_bx,
-      leg_quad_p9_e1_bx, leg_quad_p9_e1_bx, leg_quad_p9_e2_bx, leg_quad_p9_e2_bx, leg_quad_p9_e3_bx, leg_quad_p9_e3_bx, leg_quad_p9_e4_bx, leg_quad_p9_e4_bx,
-      leg_quad_p10_e1_bx_0, leg_quad_p10_e1_bx_1, leg_quad_p10_e2_bx_0, leg_quad_p10_e2_bx_1, leg_quad_p10_e3_bx, leg_quad_p10_e3_bx, leg_quad_p10_e4_bx, leg_quad_p10_e4_bx,
+    static int leg_tri_bubble_count[11] = {0, 0, 3, 8, 15, 24, 35, 48, 63, 80, 99};
 
-      leg_quad_p0p2_b1_bx,   leg_quad_p0p3_b1_bx,   leg_quad_p0p4_b1_bx,   leg_quad_p0p5_b1_bx,   leg_quad_p0p6_b1_bx,   leg_quad_p0p7_b1_bx,   leg_quad_p0p8_b1_bx,   leg_quad_p0p9_b1_bx,   leg_quad_p0p10_b1_bx,   leg_quad_p0p11_b1_bx,   leg_quad_p1p2_b1_bx,   leg_quad_p1p3_b1_bx,   leg_quad_p1p4_b1_bx,   leg_quad_p1p5_b1_bx,   leg_quad_p1p6_b1_bx,   leg_quad_p1p7_b1_bx,   leg_quad_p1p8_b1_bx,   leg_quad_p1p9_b1_bx,   leg_quad_p1p10_b1_bx,   leg_quad_p1p11_b1_bx,   leg_quad_p2p2_b1_bx,   leg_quad_p2p3_b1_bx,   leg_quad_p2p4_b1_bx,   leg_quad_p2p5_b1_bx,   leg_quad_p2p6_b1_bx,   leg_quad_p2p7_b1_bx,   leg_quad_p2p8_b1_bx,   leg_quad_p2p9_b1_bx,   leg_quad_p2p10_b1_bx,   leg_quad_p2p11_b1_bx,   leg_quad_p3p2_b1_bx,   leg_quad_p3p3_b1_bx,   leg_quad_p3p4_b1_bx,   leg_quad_p3p5_b1_bx,   leg_quad_p3p6_b1_bx,   leg_quad_p3p7_b1_bx,   leg_quad_p3p8_b1_bx,   leg_quad_p3p9_b1_bx,   leg_quad_p3p10_b1_bx,   leg_quad_p3p11_b1_bx,   leg_quad_p4p2_b1_bx,   leg_quad_p4p3_b1_bx,   leg_quad_p4p4_b1_bx,   leg_quad_p4p5_b1_bx,   leg_quad_p4p6_b1_bx,   leg_quad_p4p7_b1_bx,   leg_quad_p4p8_b1_bx,   leg_quad_p4p9_b1_bx,   leg_quad_p4p10_b1_bx,   leg_quad_p4p11_b1_bx,   leg_quad_p5p2_b1_bx,   leg_quad_p5p3_b1_bx,   leg_quad_p5p4_b1_bx,   leg_quad_p5p5_b1_bx,   leg_quad_p5p6_b1_bx,   leg_quad_p5p7_b1_bx,   leg_quad_p5p8_b1_bx,   leg_quad_p5p9_b1_bx,   leg_quad_p5p10_b1_bx,   leg_quad_p5p11_b1_bx,   leg_quad_p6p2_b1_bx,   leg_quad_p6p3_b1_bx,   leg_quad_p6p4_b1_bx,   leg_quad_p6p5_b1_bx,   leg_quad_p6p6_b1_bx,   leg_quad_p6p7_b1_bx,   leg_quad_p6p8_b1_bx,   leg_quad_p6p9_b1_bx,   leg_quad_p6p10_b1_bx,   leg_quad_p6p11_b1_bx,   leg_quad_p7p2_b1_bx,   leg_quad_p7p3_b1_bx,   leg_quad_p7p4_b1_bx,   leg_quad_p7p5_b1_bx,   leg_quad_p7p6_b1_bx,   leg_quad_p7p7_b1_bx,   leg_quad_p7p8_b1_bx,   leg_quad_p7p9_b1_bx,   leg_quad_p7p10_b1_bx,   leg_quad_p7p11_b1_bx,   leg_quad_p8p2_b1_bx,   leg_quad_p8p3_b1_bx,   leg_quad_p8p4_b1_bx,   leg_quad_p8p5_b1_bx,   leg_quad_p8p6_b1_bx,   leg_quad_p8p7_b1_bx,   leg_quad_p8p8_b1_bx,   leg_quad_p8p9_b1_bx,   leg_quad_p8p10_b1_bx,   leg_quad_p8p11_b1_bx,   leg_quad_p9p2_b1_bx,   leg_quad_p9p3_b1_bx,   leg_quad_p9p4_b1_bx,   leg_quad_p9p5_b1_bx,   leg_quad_p9p6_b1_bx,   leg_quad_p9p7_b1_bx,   leg_quad_p9p8_b1_bx,   leg_quad_p9p9_b1_bx,   leg_quad_p9p10_b1_bx,   leg_quad_p9p11_b1_bx,   leg_quad_p10p2_b1_bx,   leg_quad_p10p3_b1_bx,   leg_quad_p10p4_b1_bx,   leg_quad_p10p5_b1_bx,   leg_quad_p10p6_b1_bx,   leg_quad_p10p7_b1_bx,   leg_quad_p10p8_b1_bx,   leg_quad_p10p9_b1_bx,   leg_quad_p10p10_b1_bx,   leg_quad_p10p11_b1_bx,   leg_quad_p2p0_b2_bx,   leg_quad_p2p1_b2_bx,   leg_quad_p2p2_b2_bx,   leg_quad_p2p3_b2_bx,   leg_quad_p2p4_b2_bx,   leg_quad_p2p5_b2_bx,   leg_quad_p2p6_b2_bx,   leg_quad_p2p7_b2_bx,   leg_quad_p2p8_b2_bx,   leg_quad_p2p9_b2_bx,   leg_quad_p2p10_b2_bx,   leg_quad_p3p0_b2_bx,   leg_quad_p3p1_b2_bx,   leg_quad_p3p2_b2_bx,   leg_quad_p3p3_b2_bx,   leg_quad_p3p4_b2_bx,   leg_quad_p3p5_b2_bx,   leg_quad_p3p6_b2_bx,   leg_quad_p3p7_b2_bx,   leg_quad_p3p8_b2_bx,   leg_quad_p3p9_b2_bx,   leg_quad_p3p10_b2_bx,   leg_quad_p4p0_b2_bx,   leg_quad_p4p1_b2_bx,   leg_quad_p4p2_b2_bx,   leg_quad_p4p3_b2_bx,   leg_quad_p4p4_b2_bx,   leg_quad_p4p5_b2_bx,   leg_quad_p4p6_b2_bx,   leg_quad_p4p7_b2_bx,   leg_quad_p4p8_b2_bx,   leg_quad_p4p9_b2_bx,   leg_quad_p4p10_b2_bx,   leg_quad_p5p0_b2_bx,   leg_quad_p5p1_b2_bx,   leg_quad_p5p2_b2_bx,   leg_quad_p5p3_b2_bx,   leg_quad_p5p4_b2_bx,   leg_quad_p5p5_b2_bx,   leg_quad_p5p6_b2_bx,   leg_quad_p5p7_b2_bx,   leg_quad_p5p8_b2_bx,   leg_quad_p5p9_b2_bx,   leg_quad_p5p10_b2_bx,   leg_quad_p6p0_b2_bx,   leg_quad_p6p1_b2_bx,   leg_quad_p6p2_b2_bx,   leg_quad_p6p3_b2_bx,   leg_quad_p6p4_b2_bx,   leg_quad_p6p5_b2_bx,   leg_quad_p6p6_b2_bx,   leg_quad_p6p7_b2_bx,   leg_quad_p6p8_b2_bx,   leg_quad_p6p9_b2_bx,   leg_quad_p6p10_b2_bx,   leg_quad_p7p0_b2_bx,   leg_quad_p7p1_b2_bx,   leg_quad_p7p2_b2_bx,   leg_quad_p7p3_b2_bx,   leg_quad_p7p4_b2_bx,   leg_quad_p7p5_b2_bx,   leg_quad_p7p6_b2_bx,   leg_quad_p7p7_b2_bx,   leg_quad_p7p8_b2_bx,   leg_quad_p7p9_b2_bx,   leg_quad_p7p10_b2_bx,   leg_quad_p8p0_b2_bx,   leg_quad_p8p1_b2_bx,   leg_quad_p8p2_b2_bx,   leg_quad_p8p3_b2_bx,   leg_quad_p8p4_b2_bx,   leg_quad_p8p5_b2_bx,   leg_quad_p8p6_b2_bx,   leg_quad_p8p7_b2_bx,   leg_quad_p8p8_b2_bx,   leg_quad_p8p9_b2_bx,   leg_quad_p8p10_b2_bx,   leg_quad_p9p0_b2_bx,   leg_quad_p9p1_b2_bx,   leg_quad_p9p2_b2_bx,   leg_quad_p9p3_b2_bx,   leg_quad_p9p4_b2_bx,   leg_quad_p9p5_b2_bx,   leg_quad_p9p6_b2_bx,   leg_quad_p9p7_b2_bx,   leg_quad_p9p8_b2_bx,   leg_quad_p9p9_b2_bx,   leg_quad_p9p10_b2_bx,   leg_quad_p10p0_b2_bx,   leg_quad_p10p1_b2_bx,   leg_quad_p10p2_b2_bx,   leg_quad_p10p3_b2_bx,   leg_quad_p10p4_b2_bx,   leg_quad_p10p5_b2_bx,   leg_quad_p10p6_b2_bx,   leg_quad_p10p7_b2_bx,   leg_quad_p10p8_b2_bx,   leg_quad_p10p9_b2_bx,   leg_quad_p10p10_b2_bx,   leg_quad_p11p0_b2_bx,   leg_quad_p11p1_b2_bx,   leg_quad_p11p2_b2_bx,   leg_quad_p11p3_b2_bx,   leg_quad_p11p4_b2_bx,   leg_quad_p11p5_b2_bx,   leg_quad_p11p6_b2_bx,   leg_quad_p11p7_b2_bx,   leg_quad_p11p8_b2_bx,   leg_quad_p11p9_b2_bx,   leg_quad_p11p10_b2_bx, };
+    static int leg_tri_edge_indices_0[22] =  { 0, 1, 6, 6,  9, 10, 18, 18, 26, 27, 39, 39, 51, 52, 68, 68, 84, 85, 105, 105 , 125, 126};
+    static int leg_tri_edge_indices_1[22] =  { 2, 3, 7, 7, 11, 12, 19, 19, 28, 29, 40, 40, 53, 54, 69, 69, 86, 87, 106, 106 , 127, 128};
+    static int leg_tri_edge_indices_2[22] =  { 4, 5, 8, 8, 13, 14, 20, 20, 30, 31, 41, 41, 55, 56, 70, 70, 88, 89, 107, 107 , 129, 130};
 
-    static Shapeset::shape_fn_t leg_quad_fn_ay[] =
+    static int* leg_tri_edge_indices[3] =
     {
-      leg_quad_p0_e1_ay, leg_quad_p0_e1_ay, leg_quad_p0_e2_ay, leg_quad_p0_e2_ay, leg_quad_p0_e3_ay_0, leg_quad_p0_e3_ay_1, leg_quad_p0_e4_ay_0, leg_quad_p0_e4_ay_1,
-      leg_quad_p1_e1_ay, leg_quad_p1_e1_ay, leg_quad_p1_e2_ay, leg_quad_p1_e2_ay, leg_quad_p1_e3_ay, leg_quad_p1_e3_ay, leg_quad_p1_e4_ay, leg_quad_p1_e4_ay,
-      leg_quad_p2_e1_ay, leg_quad_p2_e1_ay, leg_quad_p2_e2_ay, leg_quad_p2_e2_ay, leg_quad_p2_e3_ay_0, leg_quad_p2_e3_ay_1, leg_quad_p2_e4_ay_0, leg_quad_p2_e4_ay_1,
-      leg_quad_p3_e1_ay, leg_quad_p3_e1_ay, leg_quad_p3_e2_ay, leg_quad_p3_e2_ay, leg_quad_p3_e3_ay, leg_quad_p3_e3_ay, leg_quad_p3_e4_ay, leg_quad_p3_e4_ay,
-      leg_quad_p4_e1_ay, leg_quad_p4_e1_ay, leg_quad_p4_e2_ay, leg_quad_p4_e2_ay, leg_quad_p4_e3_ay_0, leg_quad_p4_e3_ay_1, leg_quad_p4_e4_ay_0, leg_quad_p4_e4_ay_1,
-      leg_quad_p5_e1_ay, leg_quad_p5_e1_ay, leg_quad_p5_e2_ay, leg_quad_p5_e2_ay, leg_quad_p5_e3_ay, leg_quad_p5_e3_ay, leg_quad_p5_e4_ay, leg_quad_p5_e4_ay,
-      leg_quad_p6_e1_ay, leg_quad_p6_e1_ay, leg_quad_p6_e2_ay, leg_quad_p6_e2_ay, leg_quad_p6_e3_ay_0, leg_quad_p6_e3_ay_1, leg_quad_p6_e4_ay_0, leg_quad_p6_e4_ay_1,
-      leg_quad_p7_e1_ay, leg_quad_p7_e1_ay, leg_quad_p7_e2_ay, leg_quad_p7_e2_ay, leg_quad_p7_e3_ay, leg_quad_p7_e3_ay, leg_quad_p7_e4_ay, leg_quad_p7_e4_ay,
-      leg_quad_p8_e1_ay, leg_quad_p8_e1_ay, leg_quad_p8_e2_ay, leg_quad_p8_e2_ay, leg_quad_p8_e3_ay_0, leg_quad_p8_e3_ay_1, leg_quad_p8_e4_ay_0, leg_quad_p8_e4_ay_1,
-      leg_quad_p9_e1_ay, leg_quad_p9_e1_ay, leg_quad_p9_e2_ay, leg_quad_p9_e2_ay, leg_quad_p9_e3_ay, leg_quad_p9_e3_ay, leg_quad_p9_e4_ay, leg_quad_p9_e4_ay,
-      leg_quad_p10_e1_ay, leg_quad_p10_e1_ay, leg_quad_p10_e2_ay, leg_quad_p10_e2_ay, leg_quad_p10_e3_ay_0, leg_quad_p10_e3_ay_1, leg_quad_p10_e4_ay_0, leg_quad_p10_e4_ay_1,
+      leg_tri_edge_indices_0,
+      leg_tri_edge_indices_1,
+      leg_tri_edge_indices_2
+    };
 
-      leg_quad_p0p2_b1_ay,   leg_quad_p0p3_b1_ay,   leg_quad_p0p4_b1_ay,   leg_quad_p0p5_b1_ay,   leg_quad_p0p6_b1_ay,   leg_quad_p0p7_b1_ay,   leg_quad_p0p8_b1_ay,   leg_quad_p0p9_b1_ay,   leg_quad_p0p10_b1_ay,   leg_quad_p0p11_b1_ay,   leg_quad_p1p2_b1_ay,   leg_quad_p1p3_b1_ay,   leg_quad_p1p4_b1_ay,   leg_quad_p1p5_b1_ay,   leg_quad_p1p6_b1_ay,   leg_quad_p1p7_b1_ay,   leg_quad_p1p8_b1_ay,   leg_quad_p1p9_b1_ay,   leg_quad_p1p10_b1_ay,   leg_quad_p1p11_b1_ay,   leg_quad_p2p2_b1_ay,   leg_quad_p2p3_b1_ay,   leg_quad_p2p4_b1_ay,   leg_quad_p2p5_b1_ay,   leg_quad_p2p6_b1_ay,   leg_quad_p2p7_b1_ay,   leg_quad_p2p8_b1_ay,   leg_quad_p2p9_b1_ay,   leg_quad_p2p10_b1_ay,   leg_quad_p2p11_b1_ay,   leg_quad_p3p2_b1_ay,   leg_quad_p3p3_b1_ay,   leg_quad_p3p4_b1_ay,   leg_quad_p3p5_b1_ay,   leg_quad_p3p6_b1_ay,   leg_quad_p3p7_b1_ay,   leg_quad_p3p8_b1_ay,   leg_quad_p3p9_b1_ay,   leg_quad_p3p10_b1_ay,   leg_quad_p3p11_b1_ay,   leg_quad_p4p2_b1_ay,   leg_quad_p4p3_b1_ay,   leg_quad_p4p4_b1_ay,   leg_quad_p4p5_b1_ay,   leg_quad_p4p6_b1_ay,   leg_quad_p4p7_b1_ay,   leg_quad_p4p8_b1_ay,   leg_quad_p4p9_b1_ay,   leg_quad_p4p10_b1_ay,   leg_quad_p4p11_b1_ay,   leg_quad_p5p2_b1_ay,   leg_quad_p5p3_b1_ay,   leg_quad_p5p4_b1_ay,   leg_quad_p5p5_b1_ay,   leg_quad_p5p6_b1_ay,   leg_quad_p5p7_b1_ay,   leg_quad_p5p8_b1_ay,   leg_quad_p5p9_b1_ay,   leg_quad_p5p10_b1_ay,   leg_quad_p5p11_b1_ay,   leg_quad_p6p2_b1_ay,   leg_quad_p6p3_b1_ay,   leg_quad_p6p4_b1_ay,   leg_quad_p6p5_b1_ay,   leg_quad_p6p6_b1_ay,   leg_quad_p6p7_b1_ay,   leg_quad_p6p8_b1_ay,   leg_quad_p6p9_b1_ay,   leg_quad_p6p10_b1_ay,   leg_quad_p6p11_b1_ay,   leg_quad_p7p2_b1_ay,   leg_quad_p7p3_b1_ay,   leg_quad_p7p4_b1_ay,   leg_quad_p7p5_b1_ay,   leg_quad_p7p6_b1_ay,   leg_quad_p7p7_b1_ay,   leg_quad_p7p8_b1_ay,   leg_quad_p7p9_b1_ay,   leg_quad_p7p10_b1_ay,   leg_quad_p7p11_b1_ay,   leg_quad_p8p2_b1_ay,   leg_quad_p8p3_b1_ay,   leg_quad_p8p4_b1_ay,   leg_quad_p8p5_b1_ay,   leg_quad_p8p6_b1_ay,   leg_quad_p8p7_b1_ay,   leg_quad_p8p8_b1_ay,   leg_quad_p8p9_b1_ay,   leg_quad_p8p10_b1_ay,   leg_quad_p8p11_b1_ay,   leg_quad_p9p2_b1_ay,   leg_quad_p9p3_b1_ay,   leg_quad_p9p4_b1_ay,   leg_quad_p9p5_b1_ay,   leg_quad_p9p6_b1_ay,   leg_quad_p9p7_b1_ay,   leg_quad_p9p8_b1_ay,   leg_quad_p9p9_b1_ay,   leg_quad_p9p10_b1_ay,   leg_quad_p9p11_b1_ay,   leg_quad_p10p2_b1_ay,   leg_quad_p10p3_b1_ay,   leg_quad_p10p4_b1_ay,   leg_quad_p10p5_b1_ay,   leg_quad_p10p6_b1_ay,   leg_quad_p10p7_b1_ay,   leg_quad_p10p8_b1_ay,   leg_quad_p10p9_b1_ay,   leg_quad_p10p10_b1_ay,   leg_quad_p10p11_b1_ay,   leg_quad_p2p0_b2_ay,   leg_quad_p2p1_b2_ay,   leg_quad_p2p2_b2_ay,   leg_quad_p2p3_b2_ay,   leg_quad_p2p4_b2_ay,   leg_quad_p2p5_b2_ay,   leg_quad_p2p6_b2_ay,   leg_quad_p2p7_b2_ay,   leg_quad_p2p8_b2_ay,   leg_quad_p2p9_b2_ay,   leg_quad_p2p10_b2_ay,   leg_quad_p3p0_b2_ay,   leg_quad_p3p1_b2_ay,   leg_quad_p3p2_b2_ay,   leg_quad_p3p3_b2_ay,   leg_quad_p3p4_b2_ay,   leg_quad_p3p5_b2_ay,   leg_quad_p3p6_b2_ay,   leg_quad_p3p7_b2_ay,   leg_quad_p3p8_b2_ay,   leg_quad_p3p9_b2_ay,   leg_quad_p3p10_b2_ay,   leg_quad_p4p0_b2_ay,   leg_quad_p4p1_b2_ay,   leg_quad_p4p2_b2_ay,   leg_quad_p4p3_b2_ay,   leg_quad_p4p4_b2_ay,   leg_quad_p4p5_b2_ay,   leg_quad_p4p6_b2_ay,   leg_quad_p4p7_b2_ay,   leg_quad_p4p8_b2_ay,   leg_quad_p4p9_b2_ay,   leg_quad_p4p10_b2_ay,   leg_quad_p5p0_b2_ay,   leg_quad_p5p1_b2_ay,   leg_quad_p5p2_b2_ay,   leg_quad_p5p3_b2_ay,   leg_quad_p5p4_b2_ay,   leg_quad_p5p5_b2_ay,   leg_quad_p5p6_b2_ay,   leg_quad_p5p7_b2_ay,   leg_quad_p5p8_b2_ay,   leg_quad_p5p9_b2_ay,   leg_quad_p5p10_b2_ay,   leg_quad_p6p0_b2_ay,   leg_quad_p6p1_b2_ay,   leg_quad_p6p2_b2_ay,   leg_quad_p6p3_b2_ay,   leg_quad_p6p4_b2_ay,   leg_quad_p6p5_b2_ay,   leg_quad_p6p6_b2_ay,   leg_quad_p6p7_b2_ay,   leg_quad_p6p8_b2_ay,   leg_quad_p6p9_b2_ay,   leg_quad_p6p10_b2_ay,   leg_quad_p7p0_b2_ay,   leg_quad_p7p1_b2_ay,   leg_quad_p7p2_b2_ay,   leg_quad_p7p3_b2_ay,   leg_quad_p7p4_b2_ay,   leg_quad_p7p5_b2_ay,   leg_quad_p7p6_b2_ay,   leg_quad_p7p7_b2_ay,   leg_quad_p7p8_b2_ay,   leg_quad_p7p9_b2_ay,   leg_quad_p7p10_b2_ay,   leg_quad_p8p0_b2_ay,   leg_quad_p8p1_b2_ay,   leg_quad_p8p2_b2_ay,   leg_quad_p8p3_b2_ay,   leg_quad_p8p4_b2_ay,   leg_quad_p8p5_b2_ay,   leg_quad_p8p6_b2_ay,   leg_quad_p8p7_b2_ay,   leg_quad_p8p8_b2_ay,   leg_quad_p8p9_b2_ay,   leg_quad_p8p10_b2_ay,   leg_quad_p9p0_b2_ay,   leg_quad_p9p1_b2_ay,   leg_quad_p9p2_b2_ay,   leg_quad_p9p3_b2_ay,   leg_quad_p9p4_b2_ay,   leg_quad_p9p5_b2_ay,   leg_quad_p9p6_b2_ay,   leg_quad_p9p7_b2_ay,   leg_quad_p9p8_b2_ay,   leg_quad_p9p9_b2_ay,   leg_quad_p9p10_b2_ay,   leg_quad_p10p0_b2_ay,   leg_quad_p10p1_b2_ay,   leg_quad_p10p2_b2_ay,   leg_quad_p10p3_b2_ay,   leg_quad_p10p4_b2_ay,   leg_quad_p10p5_b2_ay,   leg_quad_p10p6_b2_ay,   leg_quad_p10p7_b2_ay,   leg_quad_p10p8_b2_ay,   leg_quad_p10p9_b2_ay,   leg_quad_p10p10_b2_ay,   leg_quad_p11p0_b2_ay,   leg_quad_p11p1_b2_ay,   leg_quad_p11p2_b2_ay,   leg_quad_p11p3_b2_ay,   leg_quad_p11p4_b2_ay,   leg_quad_p11p5_b2_ay,   leg_quad_p11p6_b2_ay,   leg_quad_p11p7_b2_ay,   leg_quad_p11p8_b2_ay,   leg_quad_p11p9_b2_ay,   leg_quad_p11p10_b2_ay, };
+    static int leg_tri_vertex_indices[3] = { -1, -1, -1 };
 
-    static Shapeset::shape_fn_t leg_quad_fn_by[] =
+    static int leg_tri_index_to_order[150] =
     {
-      leg_quad_p0_e1_by_0, leg_quad_p0_e1_by_1, leg_quad_p0_e2_by_0, leg_quad_p0_e2_by_1,  leg_quad_p0_e3_by, leg_quad_p0_e3_by, leg_quad_p0_e4_by, leg_quad_p0_e4_by,
-      leg_quad_p1_e1_by, leg_quad_p1_e1_by, leg_quad_p1_e2_by, leg_quad_p1_e2_by, leg_quad_p1_e3_by, leg_quad_p1_e3_by, leg_quad_p1_e4_by, leg_quad_p1_e4_b,
-      leg_quad_p2_e1_by_0, leg_quad_p2_e1_by_1, leg_quad_p2_e2_by_0, leg_quad_p2_e2_by_1, leg_quad_p2_e3_by, leg_quad_p2_e3_by, leg_quad_p2_e4_by, leg_quad_p2_e4_by,
-      leg_quad_p3_e1_by, leg_quad_p3_e1_by, leg_quad_p3_e2_by, leg_quad_p3_e2_by, leg_quad_p3_e3_by, leg_quad_p3_e3_by, leg_quad_p3_e4_by, leg_quad_p3_e4_b,
-      leg_quad_p4_e1_by_0, leg_quad_p4_e1_by_1, leg_quad_p4_e2_by_0, leg_quad_p4_e2_by_1, leg_quad_p4_e3_by, leg_quad_p4_e3_by, leg_quad_p4_e4_by, leg_quad_p4_e4_by,
-      leg_quad_p5_e1_by, leg_quad_p5_e1_by, leg_quad_p5_e2_by, leg_quad_p5_e2_by, leg_quad_p5_e3_by, leg_quad_p5_e3_by, leg_quad_p5_e4_by, leg_quad_p5_e4_b,
-      leg_quad_p6_e1_by_0, leg_quad_p6_e1_by_1, leg_quad_p6_e2_by_0, leg_quad_p6_e2_by_1, leg_quad_p6_e3_by, leg_quad_p6_e3_by, leg_quad_p6_e4_by, leg_quad_p6_e4_by,
-      leg_quad_p7_e1_by, leg_quad_p7_e1_by, leg_quad_p7_e2_by, leg_quad_p7_e2_by, leg_quad_p7_e3_by, leg_quad_p7_e3_by, leg_quad_p7_e4_by, leg_quad_p7_e4_b,
-      leg_quad_p8_e1_by_0, leg_quad_p8_e1_by_1, leg_quad_p8_e2_by_0, leg_quad_p8_e2_by_1, leg_quad_p8_e3_by, leg_quad_p8_e3_by, leg_quad_p8_e4_by, leg_quad_p8_e4_by,
-      leg_quad_p9_e1_by, leg_quad_p9_e1_by, leg_quad_p9_e2_by, leg_quad_p9_e2_by, leg_quad_p9_e3_by, leg_quad_p9_e3_by, leg_quad_p9_e4_by, leg_quad_p9_e4_b,
-      leg_quad_p10_e1_by_0, leg_quad_p10_e1_by_1, leg_quad_p10_e2_by_0, leg_quad_p10_e2_by_1, leg_quad_p10_e3_by, leg_quad_p10_e3_by, leg_quad_p10_e4_by, leg_quad_p10_e4_by,
-
-      leg_quad_p0p2_b1_by,   leg_quad_p0p3_b1_by,   leg_quad_p0p4_b1_by,   leg_quad_p0p5_b1_by,   leg_quad_p0p6_b1_by,   leg_quad_p0p7_b1_by,   leg_quad_p0p8_b1_by,   leg_quad_p0p9_b1_by,   leg_quad_p0p10_b1_by,   leg_quad_p0p11_b1_by,   leg_quad_p1p2_b1_by,   leg_quad_p1p3_b1_by,   leg_quad_p1p4_b1_by,   leg_quad_p1p5_b1_by,   leg_quad_p1p6_b1_by,   leg_quad_p1p7_b1_by,   leg_quad_p1p8_b1_by,   leg_quad_p1p9_b1_by,   leg_quad_p1p10_b1_by,   leg_quad_p1p11_b1_by,   leg_quad_p2p2_b1_by,   leg_quad_p2p3_b1_by,   leg_quad_p2p4_b1_by,   leg_quad_p2p5_b1_by,   leg_quad_p2p6_b1_by,   leg_quad_p2p7_b1_by,   leg_quad_p2p8_b1_by,   leg_quad_p2p9_b1_by,   leg_quad_p2p10_b1_by,   leg_quad_p2p11_b1_by,   leg_quad_p3p2_b1_by,   leg_quad_p3p3_b1_by,   leg_quad_p3p4_b1_by,   leg_quad_p3p5_b1_by,   leg_quad_p3p6_b1_by,   leg_quad_p3p7_b1_by,   leg_quad_p3p8_b1_by,   leg_quad_p3p9_b1_by,   leg_quad_p3p10_b1_by,   leg_quad_p3p11_b1_by,   leg_quad_p4p2_b1_by,   leg_quad_p4p3_b1_by,   leg_quad_p4p4_b1_by,   leg_quad_p4p5_b1_by,   leg_quad_p4p6_b1_by,   leg_quad_p4p7_b1_by,   leg_quad_p4p8_b1_by,   leg_quad_p4p9_b1_by,   leg_quad_p4p10_b1_by,   leg_quad_p4p11_b1_by,   leg_quad_p5p2_b1_by,   leg_quad_p5p3_b1_by,   leg_quad_p5p4_b1_by,   leg_quad_p5p5_b1_by,   leg_quad_p5p6_b1_by,   leg_quad_p5p7_b1_by,   leg_quad_p5p8_b1_by,   leg_quad_p5p9_b1_by,   leg_quad_p5p10_b1_by,   leg_quad_p5p11_b1_by,   leg_quad_p6p2_b1_by,   leg_quad_p6p3_b1_by,   leg_quad_p6p4_b1_by,   leg_quad_p6p5_b1_by,   leg_quad_p6p6_b1_by,   leg_quad_p6p7_b1_by,   leg_quad_p6p8_b1_by,   leg_quad_p6p9_b1_by,   leg_quad_p6p10_b1_by,   leg_quad_p6p11_b1_by,   leg_quad_p7p2_b1_by,   leg_quad_p7p3_b1_by,   leg_quad_p7p4_b1_by,   leg_quad_p7p5_b1_by,   leg_quad_p7p6_b1_by,   leg_quad_p7p7_b1_by,   leg_quad_p7p8_b1_by,   leg_quad_p7p9_b1_by,   leg_quad_p7p10_b1_by,   leg_quad_p7p11_b1_by,   leg_quad_p8p2_b1_by,   leg_quad_p8p3_b1_by,   leg_quad_p8p4_b1_by,   leg_quad_p8p5_b1_by,   leg_quad_p8p6_b1_by,   leg_quad_p8p7_b1_by,   leg_quad_p8p8_b1_by,   leg_quad_p8p9_b1_by,   leg_quad_p8p10_b1_by,   leg_quad_p8p11_b1_by,   leg_quad_p9p2_b1_by,   leg_quad_p9p3_b1_by,   leg_quad_p9p4_b1_by,   leg_quad_p9p5_b1_by,   leg_quad_p9p6_b1_by,   leg_quad_p9p7_b1_by,   leg_quad_p9p8_b1_by,   leg_quad_p9p9_b1_by,   leg_quad_p9p10_b1_by,   leg_quad_p9p11_b1_by,   leg_quad_p10p2_b1_by,   leg_quad_p10p3_b1_by,   leg_quad_p10p4_b1_by,   leg_quad_p10p5_b1_by,   leg_quad_p10p6_b1_by,   leg_quad_p10p7_b1_by,   leg_quad_p10p8_b1_by,   leg_quad_p10p9_b1_by,   leg_quad_p10p10_b1_by,   leg_quad_p10p11_b1_by,   leg_quad_p2p0_b2_by,   leg_quad_p2p1_b2_by,   leg_quad_p2p2_b2_by,   leg_quad_p2p3_b2_by,   leg_quad_p2p4_b2_by,   leg_quad_p2p5_b2_by,   leg_quad_p2p6_b2_by,   leg_quad_p2p7_b2_by,   leg_quad_p2p8_b2_by,   leg_quad_p2p9_b2_by,   leg_quad_p2p10_b2_by,   leg_quad_p3p0_b2_by,   leg_quad_p3p1_b2_by,   leg_quad_p3p2_b2_by,   leg_quad_p3p3_b2_by,   leg_quad_p3p4_b2_by,   leg_quad_p3p5_b2_by,   leg_quad_p3p6_b2_by,   leg_quad_p3p7_b2_by,   leg_quad_p3p8_b2_by,   leg_quad_p3p9_b2_by,   leg_quad_p3p10_b2_by,   leg_quad_p4p0_b2_by,   leg_quad_p4p1_b2_by,   leg_quad_p4p2_b2_by,   leg_quad_p4p3_b2_by,   leg_quad_p4p4_b2_by,   leg_quad_p4p5_b2_by,   leg_quad_p4p6_b2_by,   leg_quad_p4p7_b2_by,   leg_quad_p4p8_b2_by,   leg_quad_p4p9_b2_by,   leg_quad_p4p10_b2_by,   leg_quad_p5p0_b2_by,   leg_quad_p5p1_b2_by,   leg_quad_p5p2_b2_by,   leg_quad_p5p3_b2_by,   leg_quad_p5p4_b2_by,   leg_quad_p5p5_b2_by,   leg_quad_p5p6_b2_by,   leg_quad_p5p7_b2_by,   leg_quad_p5p8_b2_by,   leg_quad_p5p9_b2_by,   leg_quad_p5p10_b2_by,   leg_quad_p6p0_b2_by,   leg_quad_p6p1_b2_by,   leg_quad_p6p2_b2_by,   leg_quad_p6p3_b2_by,   leg_quad_p6p4_b2_by,   leg_quad_p6p5_b2_by,   leg_quad_p6p6_b2_by,   leg_quad_p6p7_b2_by,   leg_quad_p6p8_b2_by,   leg_quad_p6p9_b2_by,   leg_quad_p6p10_b2_by,   leg_quad_p7p0_b2_by,   leg_quad_p7p1_b2_by,   leg_quad_p7p2_b2_by,   leg_quad_p7p3_b2_by,   leg_quad_p7p4_b2_by,   leg_quad_p7p5_b2_by,   leg_quad_p7p6_b2_by,   leg_quad_p7p7_b2_by,   leg_quad_p7p8_b2_by,   leg_quad_p7p9_b2_by,   leg_quad_p7p10_b2_by,   leg_quad_p8p0_b2_by,   leg_quad_p8p1_b2_by,   leg_quad_p8p2_b2_by,   leg_quad_p8p3_b2_by,   leg_quad_p8p4_b2_by,   leg_quad_p8p5_b2_by,   leg_quad_p8p6_b2_by,   leg_quad_p8p7_b2_by,   leg_quad_p8p8_b2_by,   leg_quad_p8p9_b2_by,   leg_quad_p8p10_b2_by,   leg_quad_p9p0_b2_by,   leg_quad_p9p1_b2_by,   leg_quad_p9p2_b2_by,   leg_quad_p9p3_b2_by,   leg_quad_p9p4_b2_by,   leg_quad_p9p5_b2_by,   leg_quad_p9p6_b2_by,   leg_quad_p9p7_b2_by,   leg_quad_p9p8_b2_by,   leg_quad_p9p9_b2_by,   leg_quad_p9p10_b2_by,   leg_quad_p10p0_b2_by,   leg_quad_p10p1_b2_by,   leg_quad_p10p2_b2_by,   leg_quad_p10p3_b2_by,   leg_quad_p10p4_b2_by,   leg_quad_p10p5_b2_by,   leg_quad_p10p6_b2_by,   leg_quad_p10p7_b2_by,   leg_quad_p10p8_b2_by,   leg_quad_p10p9_b2_by,   leg_quad_p10p10_b2_by,   leg_quad_p11p0_b2_by,   leg_quad_p11p1_b2_by,   leg_quad_p11p2_b2_by,   leg_quad_p11p3_b2_by,   leg_quad_p11p4_b2_by,   leg_quad_p11p5_b2_by,   leg_quad_p11p6_b2_by,   leg_quad_p11p7_b2_by,   leg_quad_p11p8_b2_by,   leg_quad_p11p9_b2_by,   leg_quad_p11p10_b2_by, };
+      /*6*/  1, 1, 1, 1, 1, 1,
+      /*3*/  1, 1, 1,
+      /*9*/  2, 2, 2, 2, 2, 2, 2, 2, 2,
+      /*8*/  3, 3, 3, 3, 3, 3, 3, 3,
+      /*13*/ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+      /*12*/ 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+      /*17*/ 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+      /*16*/ 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+      /*21*/ 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+      /*20*/ 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+      /*25*/ 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10
+    };
 
     static int qb_0_1[] = { 88, };
       static int qb_0_2[] = { 88, 89, };
@@ -16484,44 +269,6 @@ namespace Hermes
       oo(0, 2),  oo(0, 3),  oo(0, 4),  oo(0, 5),  oo(0, 6),  oo(0, 7),  oo(0, 8),  oo(0, 9),  oo(0, 10),  oo(0, 11),  oo(1, 2),  oo(1, 3),  oo(1, 4),  oo(1, 5),  oo(1, 6),  oo(1, 7),  oo(1, 8),  oo(1, 9),  oo(1, 10),  oo(1, 11),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(2, 11),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(3, 11),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(4, 11),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(5, 11),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(6, 11),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(7, 11),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(8, 11),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(9, 11),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(10, 11),  oo(2, 0),  oo(2, 1),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(3, 0),  oo(3, 1),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(4, 0),  oo(4, 1),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(5, 0),  oo(5, 1),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(6, 0),  oo(6, 1),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(7, 0),  oo(7, 1),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(8, 0),  oo(8, 1),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(9, 0),  oo(9, 1),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(10, 0),  oo(10, 1),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(11, 0),  oo(11, 1),  oo(11, 2),  oo(11, 3),  oo(11, 4),  oo(11, 5),  oo(11, 6),  oo(11, 7),  oo(11, 8),  oo(11, 9),  oo(11, 10),
     };
 
-    static Shapeset::shape_fn_t* leg_quad_shape_fn_table[2] =
-    {
-      leg_quad_fn_a,
-      leg_quad_fn_b
-    };
-
-    static Shapeset::shape_fn_t* leg_quad_shape_fn_table_x[2] =
-    {
-      leg_quad_fn_ax,
-      leg_quad_fn_bx
-    };
-
-    static Shapeset::shape_fn_t* leg_quad_shape_fn_table_y[2] =
-    {
-      leg_quad_fn_ay,
-      leg_quad_fn_by
-    };
-
-    //// triangle tables and class constructor ///////////////////////////////////////////////
-
-    static Shapeset::shape_fn_t** leg_shape_fn_table[2] =
-    {
-      leg_tri_shape_fn_table,
-      leg_quad_shape_fn_table
-    };
-
-    static Shapeset::shape_fn_t** leg_shape_fn_table_x[2] =
-    {
-      leg_tri_shape_fn_table_x,
-      leg_quad_shape_fn_table_x
-    };
-
-    static Shapeset::shape_fn_t** leg_shape_fn_table_y[2] =
-    {
-      leg_tri_shape_fn_table_y,
-      leg_quad_shape_fn_table_y
-    };
-
     static int* leg_vertex_indices[2] =
     {
       leg_tri_vertex_indices,
@@ -16552,6 +299,2229 @@ namespace Hermes
       leg_quad_index_to_order
     };
 
+    // The shape functions, see Shapeset::PolynomialTable.
+
+    static const int leg_tri_start[] =
+    {
+      0, 2, 4, 6, 8, 10, 12, 13, 15, 17, 21, 25, 30, 35, 40, 45,
+      45, 50, 55, 59, 68, 77, 77, 85, 93, 98, 98, 107, 116, 130, 144, 158,
+      172, 172, 186, 200, 213, 213, 219, 219, 228, 248, 268, 268, 287, 306, 326, 326,
+      346, 346, 358, 358, 374, 390, 416, 442, 468, 494, 494, 521, 548, 574, 574, 601,
+      601, 628, 628, 640, 640, 656, 691, 726, 726, 760, 794, 829, 829, 864, 864, 899,
+      899, 934, 934, 954, 954, 979, 1004, 1048, 1092, 1136, 1180, 1180, 1224, 1268, 1311, 1311,
+      1355, 1355, 1399, 1399, 1443, 1443, 1487, 1487, 1507, 1507, 1532, 1586, 1640, 1640, 1693, 1746,
+      1800, 1800, 1854, 1854, 1908, 1908, 1962, 1962, 2016, 2016, 2070, 2070, 2100, 2100, 2136, 2172,
+      2237, 2302, 2367, 2432, 2432, 2497, 2562, 2626, 2626, 2691, 2691, 2756, 2756, 2821, 2821, 2886,
+      2886, 2951, 2951, 3016, 3016, 3046, 3046, 3049, 3052, 3055, 3058, 3061, 3064, 3067, 3070, 3072,
+      3078, 3084, 3090, 3096, 3102, 3108, 3112, 3117, 3117, 3127, 3137, 3146, 3150, 3158, 3158, 3158,
+      3163, 3178, 3193, 3208, 3223, 3238, 3253, 3262, 3276, 3276, 3276, 3289, 3289, 3295, 3316, 3337,
+      3357, 3366, 3385, 3385, 3385, 3405, 3405, 3425, 3425, 3437, 3465, 3493, 3521, 3549, 3577, 3605,
+      3621, 3648, 3648, 3648, 3674, 3674, 3701, 3701, 3728, 3728, 3740, 3776, 3812, 3847, 3863, 3897,
+      3897, 3897, 3932, 3932, 3967, 3967, 4002, 4002, 4037, 4037, 4057, 4102, 4147, 4192, 4237, 4282,
+      4327, 4352, 4396, 4396, 4396, 4439, 4439, 4483, 4483, 4527, 4527, 4571, 4571, 4615, 4615, 4635,
+      4690, 4745, 4799, 4824, 4877, 4877, 4877, 4931, 4931, 4985, 4985, 5039, 5039, 5093, 5093, 5147,
+      5147, 5201, 5201, 5231, 5297, 5363, 5429, 5495, 5561, 5627, 5661, 5726, 5726, 5726, 5790, 5790,
+      5855, 5855, 5920, 5920, 5985, 5985, 6050, 6050, 6115, 6115, 6180, 6180, 6210,
+    };
+
+    static const unsigned char leg_tri_degrees[] =
+    {
+      0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x00, 0x01, 0x00,
+      0x01, 0x00, 0x01, 0x02, 0x20, 0x00, 0x01, 0x02, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x00, 0x01,
+      0x02, 0x10, 0x11, 0x00, 0x01, 0x02, 0x10, 0x11, 0x00, 0x01, 0x02, 0x10, 0x11, 0x00, 0x01, 0x02,
+      0x10, 0x11, 0x00, 0x01, 0x02, 0x10, 0x11, 0x10, 0x11, 0x12, 0x30, 0x00, 0x01, 0x02, 0x03, 0x10,
+      0x11, 0x12, 0x20, 0x21, 0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x01, 0x02, 0x03,
+      0x10, 0x11, 0x12, 0x20, 0x21, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x00, 0x02, 0x03,
+      0x20, 0x21, 0x00, 0x01, 0x02, 0x03, 0x04, 0x20, 0x21, 0x22, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x20, 0x21, 0x22, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22,
+      0x30, 0x31, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10,
+      0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13,
+      0x20, 0x21, 0x22, 0x30, 0x31, 0x10, 0x11, 0x12, 0x13, 0x30, 0x31, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x30, 0x31, 0x32, 0x50, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20,
+      0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32,
+      0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22,
+      0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x20, 0x21, 0x22, 0x23, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x40, 0x41, 0x42, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x40, 0x41, 0x42, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x30, 0x31, 0x32, 0x33, 0x50, 0x51,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x30, 0x31, 0x32, 0x33, 0x34, 0x50, 0x51, 0x52, 0x70,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51,
+      0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42,
+      0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40,
+      0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51,
+      0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42,
+      0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x40, 0x41, 0x42, 0x43, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x40, 0x41, 0x42, 0x43, 0x44, 0x60,
+      0x61, 0x62, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x40, 0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x80, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50,
+      0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60,
+      0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50,
+      0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60,
+      0x61, 0x62, 0x70, 0x71, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61,
+      0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x50, 0x51, 0x52,
+      0x53, 0x70, 0x71, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x50, 0x51, 0x52, 0x53, 0x54, 0x70, 0x71, 0x72, 0x90, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72,
+      0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60,
+      0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72,
+      0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60,
+      0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+      0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70,
+      0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62,
+      0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x60, 0x61,
+      0x62, 0x63, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x60,
+      0x61, 0x62, 0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x0a, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x46, 0x60, 0x61, 0x62, 0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+      0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60,
+      0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90,
+      0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81,
+      0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80,
+      0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26,
+      0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73,
+      0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72,
+      0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+      0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43,
+      0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71,
+      0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70,
+      0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x70, 0x71, 0x72, 0x73, 0x90, 0x91, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00,
+      0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x01, 0x10,
+      0x00, 0x01, 0x02, 0x10, 0x11, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x20, 0x00, 0x01, 0x02, 0x10,
+      0x11, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x20, 0x00, 0x01,
+      0x02, 0x10, 0x11, 0x20, 0x00, 0x01, 0x02, 0x20, 0x00, 0x01, 0x02, 0x10, 0x11, 0x00, 0x01, 0x02,
+      0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x00, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21,
+      0x30, 0x01, 0x02, 0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x30, 0x10, 0x11, 0x12, 0x30, 0x01, 0x02,
+      0x03, 0x10, 0x11, 0x12, 0x20, 0x21, 0x00, 0x02, 0x03, 0x20, 0x21, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10,
+      0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11,
+      0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12,
+      0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13,
+      0x20, 0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20,
+      0x21, 0x22, 0x30, 0x31, 0x40, 0x00, 0x01, 0x02, 0x03, 0x04, 0x20, 0x21, 0x22, 0x40, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x01, 0x02, 0x03, 0x04,
+      0x10, 0x11, 0x12, 0x13, 0x20, 0x21, 0x22, 0x30, 0x31, 0x10, 0x11, 0x12, 0x13, 0x30, 0x31, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31,
+      0x32, 0x40, 0x41, 0x50, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20,
+      0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x50, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x30, 0x31, 0x32, 0x50, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40, 0x41, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x10, 0x11, 0x12, 0x13, 0x14, 0x20, 0x21, 0x22, 0x23, 0x30, 0x31, 0x32, 0x40,
+      0x41, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x20, 0x21, 0x22, 0x23, 0x40, 0x41, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30,
+      0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51,
+      0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30,
+      0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40,
+      0x41, 0x42, 0x50, 0x51, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x40, 0x41, 0x42, 0x60, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33,
+      0x40, 0x41, 0x42, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x31, 0x32, 0x33, 0x40, 0x41, 0x42, 0x50, 0x51,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x30, 0x31, 0x32, 0x33, 0x50, 0x51, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20,
+      0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51,
+      0x52, 0x60, 0x61, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42,
+      0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x70, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x50, 0x51, 0x52, 0x70, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03,
+      0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52, 0x60, 0x61, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43, 0x50, 0x51, 0x52,
+      0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x40, 0x41, 0x42, 0x43,
+      0x50, 0x51, 0x52, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x20, 0x21, 0x22,
+      0x23, 0x24, 0x25, 0x40, 0x41, 0x42, 0x43, 0x60, 0x61, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53,
+      0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62,
+      0x70, 0x71, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+      0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52,
+      0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x80, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x40, 0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x80,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41,
+      0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61,
+      0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x50, 0x51, 0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x40, 0x41, 0x42, 0x43, 0x44, 0x50, 0x51,
+      0x52, 0x53, 0x60, 0x61, 0x62, 0x70, 0x71, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x50, 0x51, 0x52, 0x53, 0x70, 0x71, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80,
+      0x81, 0x90, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60,
+      0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+      0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x90, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x70, 0x71, 0x72, 0x90, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+      0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71,
+      0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35,
+      0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63,
+      0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10,
+      0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80, 0x81, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x50, 0x51, 0x52, 0x53, 0x54, 0x60, 0x61, 0x62, 0x63, 0x70, 0x71, 0x72, 0x80,
+      0x81, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x20, 0x21, 0x22, 0x23, 0x24,
+      0x25, 0x26, 0x27, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x60, 0x61, 0x62, 0x63, 0x80, 0x81, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91,
+      0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80,
+      0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+      0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+      0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44,
+      0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72,
+      0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+      0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23,
+      0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42,
+      0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70,
+      0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+      0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21,
+      0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63,
+      0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0xa0, 0x00, 0x01, 0x02, 0x03, 0x04,
+      0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x40,
+      0x41, 0x42, 0x43, 0x44, 0x60, 0x61, 0x62, 0x63, 0x64, 0x80, 0x81, 0x82, 0xa0, 0x00, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x01, 0x02,
+      0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+      0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33, 0x34,
+      0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+      0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00, 0x01,
+      0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16,
+      0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32, 0x33,
+      0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53, 0x54,
+      0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91, 0x00,
+      0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15,
+      0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31, 0x32,
+      0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52, 0x53,
+      0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90, 0x91,
+      0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13, 0x14,
+      0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51, 0x52,
+      0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82, 0x90,
+      0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12, 0x13,
+      0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x30,
+      0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50, 0x51,
+      0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81, 0x82,
+      0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11, 0x12,
+      0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+      0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x50,
+      0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80, 0x81,
+      0x82, 0x90, 0x91, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x10, 0x11,
+      0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+      0x28, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+      0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x60, 0x61, 0x62, 0x63, 0x64, 0x70, 0x71, 0x72, 0x73, 0x80,
+      0x81, 0x82, 0x90, 0x91, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x30, 0x31,
+      0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x70, 0x71, 0x72, 0x73,
+      0x90, 0x91,
+    };
+
+    static const double leg_tri_coefs[] =
+    {
+      0.666666666666667, -0.3333333333333335, -0.666666666666667, 0.3333333333333335,
+      -0.33333333333333237, -0.33333333333333226, 0.33333333333333237, 0.33333333333333226,
+      -0.33333333333333337, -0.3333333333333334, 0.33333333333333337, 0.3333333333333334,
+      1.0, -0.33333333333333237, -0.33333333333333226, 0.33333333333333337,
+      0.3333333333333334, -0.08333333333333327, -0.033333333333333395, 0.05000000000000001,
+      0.9999999999999998, 0.08333333333333327, 0.033333333333333395, -0.05000000000000001,
+      -0.9999999999999998, 0.04166666666666657, -0.18333333333333257, -0.22499999999999912,
+      0.14999999999999936, 0.14999999999999952, -0.04166666666666657, 0.18333333333333257,
+      0.22499999999999912, -0.14999999999999936, -0.14999999999999952, 0.041666666666666664,
+      -0.1833333333333331, -0.22499999999999987, -0.14999999999999986, -0.14999999999999994,
+      -0.041666666666666664, 0.1833333333333331, 0.22499999999999987, 0.14999999999999986,
+      0.14999999999999994, 0.08333333333333316, 0.03333333333333329, -0.04999999999999981,
+      0.09999999999999944, 0.09999999999999966, -0.08333333333333331, -0.03333333333333334,
+      0.049999999999999996, 0.09999999999999987, 0.09999999999999999, -0.36666666666666525,
+      -0.2952380952380959, 0.07142857142857142, 1.0000000000000007, 0.16666666666666627,
+      0.0999999999999996, -0.23333333333333242, -0.166666666666666, -0.06666666666666635,
+      0.1119047619047616, 0.17857142857142794, -0.05952380952380917, -0.05952380952380908,
+      -0.16666666666666693, -0.10000000000000003, 0.23333333333333325, 0.16666666666666663,
+      -0.06666666666666657, 0.11190476190476194, 0.17857142857142855, 0.05952380952380924,
+      0.05952380952380922, 0.016666666666666607, 0.00476190476190474, -0.011904761904761854,
+      -0.01666666666666659, 0.0071428571428571236, 0.023809523809523774, -0.011904761904761856,
+      -0.01190476190476184, 0.03333333333333329, 0.00952380952380951, -0.02380952380952377,
+      0.03333333333333328, -0.014285714285714282, -0.047619047619047616, -0.023809523809523805,
+      -0.023809523809523794, 0.016666666666666684, -0.011904761904761888, 0.004761904761904745,
+      -0.02380952380952379, -0.023809523809523784, -0.045833333333333344, 0.04166666666666652,
+      0.035714285714285796, -0.04484126984126978, 0.006944444444444402, -0.5178571428571417,
+      -0.4484126984126982, 0.0694444444444442, 0.9999999999999986, 0.045833333333333344,
+      -0.04166666666666652, -0.035714285714285796, 0.04484126984126978, -0.006944444444444402,
+      0.5178571428571417, 0.4484126984126982, -0.0694444444444442, -0.9999999999999986,
+      0.022916666666666606, 0.1791666666666659, 0.05937499999999959, -0.2270833333333321,
+      -0.13020833333333273, -0.13749999999999937, -0.17879464285714214, 0.13839285714285685,
+      0.17968749999999936, 0.06584821428571391, -0.025297619047618954, -0.09114583333333245,
+      0.024305555555555323, 0.02430555555555498, -0.022916666666666606, -0.1791666666666659,
+      -0.05937499999999959, 0.2270833333333321, 0.13020833333333273, 0.13749999999999937,
+      0.17879464285714214, -0.13839285714285685, -0.17968749999999936, -0.06584821428571391,
+      0.025297619047618954, 0.09114583333333245, -0.024305555555555323, -0.02430555555555498,
+      0.022916666666666738, 0.17916666666666642, 0.05937499999999987, -0.227083333333333,
+      -0.13020833333333331, 0.13749999999999987, 0.1787946428571429, -0.13839285714285715,
+      -0.17968749999999972, 0.0658482142857142, -0.025297619047619048, -0.09114583333333325,
+      -0.024305555555555355, -0.02430555555555501, -0.022916666666666738, -0.17916666666666642,
+      -0.05937499999999987, 0.227083333333333, 0.13020833333333331, -0.13749999999999987,
+      -0.1787946428571429, 0.13839285714285715, 0.17968749999999972, -0.0658482142857142,
+      0.025297619047619048, 0.09114583333333325, 0.024305555555555355, 0.02430555555555501,
+      -0.012499999999999975, -0.003571428571428568, 0.018749999999999906, 0.0013888888888888885,
+      -0.008432539682539663, -0.010714285714285659, -0.02633928571428563, 0.0017857142857142837,
+      0.017410714285714227, 0.011160714285714218, -0.0009920634920635137, -0.01215277777777773,
+      0.004166666666666641, 0.004166666666666582, 0.024999999999999998, 0.0071428571428571565,
+      -0.03749999999999997, -0.0027777777777777866, 0.016865079365079375, -0.021428571428571415,
+      -0.052678571428571394, 0.0035714285714285674, 0.03482142857142855, -0.022321428571428537,
+      0.001984126984127046, 0.02430555555555555, 0.008333333333333321, 0.008333333333333191,
+      -0.004761904761904762, 0.0011904761904761917, 0.003968253968253964, -0.0019841269841269814,
+      -0.00476190476190475, -0.0017857142857142854, 0.0023809523809523764, -0.0005952380952380928,
+      -0.0029761904761904704, 0.0039682539682539585, 0.006944444444444441, 0.0055555555555555506,
+      0.005555555555555542, 0.009523809523809507, 0.0035714285714285635, -0.00476190476190475,
+      0.001190476190476183, -0.011111111111111089, -0.011111111111111094, -0.06321428571428572,
+      0.1778571428571426, 0.1428571428571431, -0.08798701298701304, 0.01022727272727265,
+      -0.6111111111111103, -0.5474747474747476, 0.06363636363636377, 0.9999999999999986,
+      -0.03333333333333327, 0.042023809523809255, 0.19142857142857037, 0.013095238095237952,
+      -0.20865800865800804, -0.10568181818181763, 0.0628571428571424, -0.1558928571428565,
+      -0.2221428571428565, 0.16842532467532392, 0.1718181818181812, 0.049107142857142655,
+      0.13452380952380882, -0.023674242424242257, -0.10909090909090854, -0.04611111111111074,
+      -0.003156565656565706, 0.042954545454544676, -0.010227272727272712, -0.01022727272727292,
+      0.0333333333333334, -0.04202380952380945, -0.19142857142857153, -0.01309523809523797,
+      0.20865800865800863, 0.10568181818181813, 0.06285714285714271, -0.15589285714285725,
+      -0.22214285714285734, 0.16842532467532448, 0.17181818181818176, -0.049107142857142724,
+      -0.13452380952380938, 0.023674242424242146, 0.10909090909090861, -0.046111111111110895,
+      -0.0031565656565656565, 0.04295454545454478, 0.01022727272727276, 0.010227272727272993,
+      -0.01160714285714281, -0.0011904761904761856, 0.016865079365079274, -0.00018037518037517764,
+      -0.0066287878787878625, 0.011607142857142792, -0.001785714285714274, -0.026785714285714222,
+      0.000811688311688303, 0.0142045454545454, 0.00297619047619047, 0.01686507936507929,
+      0.002254689754689728, -0.011634199134199117, -0.006944444444444405, -0.0012626262626262129,
+      0.005681818181818108, -0.001623376623376585, -0.001623376623376567, -0.023214285714285694,
+      -0.002380952380952376, 0.03373015873015866, -0.0003607503607503586, -0.013257575757575753,
+      -0.023214285714285673, 0.003571428571428556, 0.05357142857142858, -0.001623376623376619,
+      -0.02840909090909089, 0.0059523809523809555, 0.0337301587301587, 0.004509379509379497,
+      -0.02326839826839825, 0.013888888888888852, 0.002525252525252453, -0.011363636363636319,
+      -0.0032467532467531836, -0.0032467532467531494, -0.005952380952380958, 0.0005952380952380931,
+      0.006547619047619046, -0.0031746031746031638, -0.0019300144300144336, 0.0012445887445887433,
+      -0.0017857142857142785, 0.002678571428571428, 0.0014285714285714266, -0.0023538961038961008,
+      0.0006818181818181801, 0.010416666666666638, 0.011111111111111084, -0.002660533910533902,
+      -0.0033549783549783538, 0.0033333333333333296, -0.000757575757575756, -0.004090909090909083,
+      -0.001948051948051951, -0.0019480519480519676, -0.0007936507936507934, 0.00039682539682539623,
+      0.0003968253968253962, -0.0005291005291005275, 0.00022847522847522744, -3.607503607503563e-05,
+      0.0011904761904761871, -0.0017857142857142844, -0.0009523809523809513, 0.0015692640692640666,
+      -0.00045454545454545324, -0.0009920634920634898, -0.0005291005291005286, 0.00039081289081288866,
+      -7.215007215007135e-05, -0.002222222222222218, 0.0005050505050505049, 0.002727272727272717,
+      0.0025974025974025844, 0.0025974025974025883, -0.005952380952380957, -0.0011904761904761915,
+      0.004761904761904758, -0.0007936507936507892, -0.0006854256854256892, 0.0001082251082251079,
+      0.01488095238095236, 0.013492063492063468, -0.0011724386724386632, 0.0002164502164502099,
+      -0.007792207792207774, -0.007792207792207791, 0.01909722222222218, 0.024305555555555625,
+      -0.05233134920634904, -0.00661375661375673, 0.036879208754208824, -0.012844794094794063,
+      0.0012019230769230043, -0.06150793650793636, 0.2949735449735445, 0.24410774410774427,
+      -0.10275835275835282, 0.009615384615384418, -0.6742424242424222, -0.6165501165501155,
+      0.05769230769230824, 1.0000000000000007, -0.01909722222222218, -0.024305555555555625,
+      0.05233134920634904, 0.00661375661375673, -0.036879208754208824, 0.012844794094794063,
+      -0.0012019230769230043, 0.06150793650793636, -0.2949735449735445, -0.24410774410774427,
+      0.10275835275835282, -0.009615384615384418, 0.6742424242424222, 0.6165501165501155,
+      -0.05769230769230824, -1.0000000000000007, -0.009548611111111122, -0.032986111111111,
+      0.07378472222222189, 0.1759259259259249, -0.020807028619528555, -0.18785207847707774,
+      -0.08834134615384588, 0.05729166666666644, 0.09300595238095209, -0.2142857142857136,
+      -0.22017045454545342, 0.1908872377622368, 0.1610576923076918, -0.08829365079365034,
+      0.025132275132274926, 0.19518097643097526, -0.0372353341103341, -0.11899038461538416,
+      -0.07457386363636294, -0.017081876456876192, 0.057491987179486205, 0.02817234848484826,
+      0.008340617715617598, -0.0198317307692309, 0.004407051282051222, 0.004407051282051452,
+      0.009548611111111122, 0.032986111111111, -0.07378472222222189, -0.1759259259259249,
+      0.020807028619528555, 0.18785207847707774, 0.08834134615384588, -0.05729166666666644,
+      -0.09300595238095209, 0.2142857142857136, 0.22017045454545342, -0.1908872377622368,
+      -0.1610576923076918, 0.08829365079365034, -0.025132275132274926, -0.19518097643097526,
+      0.0372353341103341, 0.11899038461538416, 0.07457386363636294, 0.017081876456876192,
+      -0.057491987179486205, -0.02817234848484826, -0.008340617715617598, 0.0198317307692309,
+      -0.004407051282051222, -0.004407051282051452, -0.009548611111111147, -0.032986111111111126,
+      0.07378472222222208, 0.17592592592592557, -0.020807028619528753, -0.18785207847707847,
+      -0.08834134615384615, -0.05729166666666669, -0.09300595238095218, 0.2142857142857145,
+      0.22017045454545459, -0.19088723776223762, -0.16105769230769232, -0.08829365079365067,
+      0.025132275132275117, 0.19518097643097623, -0.037235334110333994, -0.11899038461538436,
+      0.07457386363636316, 0.017081876456876224, -0.05749198717948638, 0.028172348484848342,
+      0.008340617715617647, -0.019831730769230848, -0.004407051282051289, -0.004407051282051661,
+      0.009548611111111147, 0.032986111111111126, -0.07378472222222208, -0.17592592592592557,
+      0.020807028619528753, 0.18785207847707847, 0.08834134615384615, 0.05729166666666669,
+      0.09300595238095218, -0.2142857142857145, -0.22017045454545459, 0.19088723776223762,
+      0.16105769230769232, 0.08829365079365067, -0.025132275132275117, -0.19518097643097623,
+      0.037235334110333994, 0.11899038461538436, -0.07457386363636316, -0.017081876456876224,
+      0.05749198717948638, -0.028172348484848342, -0.008340617715617647, 0.019831730769230848,
+      0.004407051282051289, 0.004407051282051661, 0.002604166666666661, -0.0004464285714285653,
+      -0.011979166666666612, 0.0012626262626262517, 0.014689303751803698, -0.0009833916083916022,
+      -0.005481497668997658, -0.0013392857142857026, 0.014285714285714233, 0.0006493506493506522,
+      -0.026244588744588643, 0.000895979020979013, 0.012164918414918366, -0.009672619047618996,
+      -0.004148629148629124, 0.019728535353535272, 0.003168706293706247, -0.011035839160839136,
+      0.0015151515151515024, -0.008759469696969644, -0.0038582944832944313, 0.006416326728826668,
+      0.004024621212121179, 0.0014204545454545503, -0.0026041666666665876, 0.0006677350427350214,
+      0.0006677350427350202, -0.005208333333333337, 0.000892857142857133, 0.023958333333333307,
+      -0.0025252525252525155, -0.029378607503607497, 0.001966783216783215, 0.010962995337995345,
+      -0.002678571428571412, 0.02857142857142855, 0.0012987012987013043, -0.05248917748917745,
+      0.0017919580419580412, 0.024329836829836797, 0.019345238095238068, 0.008297258297258274,
+      -0.03945707070707069, -0.006337412587412559, 0.022071678321678313, 0.0030303030303030004,
+      -0.017518939393939365, -0.007716588966588853, 0.012832653457653418, -0.008049242424242375,
+      -0.0028409090909091187, 0.005208333333333185, 0.0013354700854700582, 0.0013354700854700816,
+      0.004166666666666668, -0.0017857142857142835, -0.004689754689754679, 0.003156565656565654,
+      0.001019813519813521, -0.0008741258741258745, 0.004166666666666657, 0.0026785714285714277,
+      -0.004329004329004328, -0.00018939393939393918, 0.0019855144855144826, -0.0006660006660006614,
+      0.004464285714285707, -0.004689754689754683, -0.00861291486291485, 0.0024142524142524084,
+      0.0018731268731268724, -0.005050505050505043, -0.007702020202020189, 0.0003108003108003109,
+      0.002962315462315453, -0.0024350649350649363, -0.00037462537462537663, 0.002060439560439565,
+      0.0007631257631257641, 0.0007631257631257672, -0.0002976190476190472, 0.0005952380952380946,
+      -0.0002976190476190474, -0.0003607503607503601, 0.0005321067821067814, -0.000253912753912753,
+      4.370629370629355e-05, -0.002976190476190468, -0.0017857142857142848, 0.002380952380952379,
+      5.411255411255605e-05, -0.0008616383616383591, 0.00027472527472527207, -0.000595238095238094,
+      0.00028860028860028795, 0.00045093795093794964, -0.000357975357975357, 7.492507492507456e-05,
+      0.004040404040404035, 0.005176767676767666, -5.827505827505696e-05, -0.0011946386946386906,
+      0.0019480519480519398, 0.00029970029970030127, -0.0016483516483516431, -0.0009157509157509131,
+      -0.0009157509157509147, 0.0002976190476190477, 0.001785714285714286, -0.0002976190476190481,
+      -0.0016233766233766191, 0.0004599567099567099, 0.00025391275391275467, -4.370629370629389e-05,
+      0.0005952380952380936, 0.000892857142857141, -0.00028138528138528036, -0.0003517316017316013,
+      0.00020229770229770208, -2.497502497502469e-05, 0.002083333333333328, -0.0022727272727272717,
+      -0.003923160173160165, 0.0003579753579753565, -7.49250749250729e-05, -0.00217171717171717,
+      -0.002398989898989892, -0.00019813519813519732, 2.913752913752914e-05, -0.001948051948051944,
+      -0.00029970029970029867, 0.0016483516483516488, 0.0018315018315018265, 0.0018315018315018254,
+      -0.00833333333333332, -0.005357142857142852, 0.004112554112554109, 0.0003787878787878832,
+      -0.0006743256743256716, 8.325008325007784e-05, 0.014646464646464628, 0.015404040404040375,
+      0.0006604506604506646, -9.712509712509763e-05, -0.0061050061050060885, -0.006105006105006095,
+      0.03482142857142846, 0.0482142857142858, -0.15503246753246755, -0.057629870129870385,
+      0.08625749250749255, -0.022752247752247688, 0.0017857142857141213, -0.056818181818182,
+      0.38636363636363613, 0.32867132867132925, -0.10617715617715642, 0.008333333333332978,
+      -0.7197802197802182, -0.6673992673992658, 0.05238095238095359, 0.9999999999999996,
+      0.004464285714285714, -0.020535714285714185, -0.020535714285714175, 0.09956709956709904,
+      0.14623917748917684, -0.041489760239760184, -0.16822136197136134, -0.07559523809523781,
+      -0.026785714285714052, 0.08705357142857119, 0.09180194805194777, -0.27090097402597274,
+      -0.19406129584700918, 0.20461101398601317, 0.14980867346938695, -0.0022321428571429143,
+      -0.13244047619047544, 0.04024621212121178, 0.2375660054231469, -0.056719322344322254,
+      -0.12383078231292495, 0.06174242424242392, 0.037878787878787734, -0.11324300699300617,
+      -0.02062937062937043, 0.06874999999999916, -0.01704545454545436, 0.03431836021121716,
+      0.02266483516483492, -0.028698979591836704, -0.016091051805337427, -0.006971153846153907,
+      0.009119897959183715, -0.0019345238095236869, -0.001934523809523908, -0.004464285714285736,
+      0.020535714285714244, 0.020535714285714272, -0.09956709956709943, -0.14623917748917725,
+      0.041489760239760344, 0.1682213619713619, 0.07559523809523812, -0.026785714285714125,
+      0.08705357142857158, 0.09180194805194813, -0.27090097402597363, -0.19406129584700982,
+      0.2046110139860136, 0.14980867346938778, 0.002232142857142877, 0.1324404761904762,
+      -0.04024621212121204, -0.23756600542314785, 0.05671932234432236, 0.12383078231292498,
+      0.06174242424242403, 0.03787878787878785, -0.11324300699300653, -0.020629370629370338,
+      0.06874999999999942, 0.017045454545454437, -0.034318360211217286, -0.022664835164835015,
+      0.02869897959183678, -0.016091051805337514, -0.006971153846153866, 0.009119897959183915,
+      0.0019345238095236968, 0.0019345238095238692, 0.0031249999999999893, -0.001677489177489171,
+      -0.01127344877344872, 0.002962315462315447, 0.012711247086247041, -0.0013986013986013884,
+      -0.0046765734265734205, -0.003124999999999983, -0.002516233766233753, 0.016801948051948002,
+      0.00043706293706294167, -0.025215409590409486, 0.001245629370629355, 0.010704920079920058,
+      0.00419372294372292, -0.011273448773448724, -0.0075271950271949785, 0.021566974691974626,
+      0.0031687062937062736, -0.010458291708291706, 0.005744949494949462, 0.006968725718725668,
+      -0.010686188811188772, -0.005099067599067513, 0.0068108974358974065, -0.0028409090909090728,
+      0.0038555194805194428, 0.0034090909090908786, -0.003287337662337577, -0.002232142857142837,
+      -0.0010416666666666732, 0.0011904761904761362, -0.00028409090909088663, -0.0002840909090909021,
+      0.006250000000000002, -0.003354978354978363, -0.02254689754689753, 0.00592463092463092,
+      0.025422494172494155, -0.0027972027972027885, -0.00935314685314686, 0.006249999999999988,
+      0.0050324675324675255, -0.03360389610389613, -0.0008741258741258872, 0.050430819180819104,
+      -0.002491258741258719, -0.02140984015984017, 0.008387445887445862, -0.022546897546897527,
+      -0.015054390054390052, 0.04313394938394935, 0.006337412587412583, -0.020916583416583437,
+      -0.011489898989898974, -0.013937451437451351, 0.02137237762237762, 0.01019813519813508,
+      -0.013621794871794879, -0.005681818181818167, 0.007711038961038923, 0.006818181818181798,
+      -0.0065746753246751985, 0.004464285714285678, 0.002083333333333359, -0.002380952380952312,
+      -0.0005681818181817942, -0.0005681818181818118, 0.002033730158730161, -0.0007936507936507927,
+      -0.004153138528138522, 0.003138528138528136, 0.002918956043956043, -0.002747252747252745,
+      -0.0005511849261849278, 0.0006507381507381533, 0.0023809523809523747, -0.00357142857142857,
+      -0.0024350649350649333, 0.004974192474192461, -0.0007492507492507497, -0.001587995337995334,
+      0.0006181318681318655, -0.004734848484848469, -0.007575757575757565, 0.004526723276723273,
+      0.006243756243756231, -0.0022338772338772266, -0.001110001110001112, -0.005681818181818167,
+      0.0006191724941724988, 0.007964257964257962, -0.000526903651903653, -0.002190170940170935,
+      0.0015557359307359262, 0.004245754245754249, 0.0008231351981352081, -0.0018668831168831205,
+      0.001526251526251521, 0.000534188034188032, -0.0009920634920634944, -0.00031565656565656894,
+      -0.0003156565656565813, 0.0006944444444444443, -0.00019841269841269792, -0.0007846320346320338,
+      0.0007936507936507914, 6.93750693751494e-07, -0.0004037629037629034, 0.00023656898656898538,
+      -4.4400044400043655e-05, -0.0005952380952380927, 0.001298701298701299, 0.0009956709956709952,
+      -0.001615051615051612, 5.030683602112164e-05, 0.0005744255744255729, -0.00019266447837876273,
+      0.0005411255411255399, 0.0007936507936507928, -0.00043012543012542855, -0.0003080253080253086,
+      0.00030525030525030433, -6.937506937506814e-05, 0.0023232323232323204, -0.0003690753690753685,
+      -0.0032750582750582726, 5.8275058275057536e-05, 0.0006410256410256392, -0.0017940392940392854,
+      -0.003396603396603385, -0.0005286380286380286, 0.0010739260739260697, -0.0013082155939298766,
+      -0.00045787545787545733, 0.0008503401360544199, 0.0003607503607503599, 0.0003607503607503581,
+      0.0022321428571428583, -5.952380952380879e-05, -0.00258928571428571, 0.000901875901875899,
+      0.0010132228882228896, -0.0003642191142191146, -0.00015047452547452663, 2.7472527472528272e-05,
+      -0.00017857142857142852, -0.0004626623376623382, -0.0005194805194805192, 0.00031530969030969,
+      0.0003045169116597685, -0.00021728271728271698, 2.88996717568141e-05, -0.005641233766233756,
+      -0.006240981240981229, 0.0015938922188922155, 0.0019367537224680065, -0.00021228771228771088,
+      4.459825888397146e-05, -0.0012121212121212113, 0.00033508158508158554, 0.0017407592407592384,
+      0.00016608391608391546, -2.747252747252778e-05, 0.0031093906093905993, 0.004227914942200652,
+      0.0004570429570429627, -0.0006614813757670891, 0.00156985871271585, 0.0005494505494505445,
+      -0.0010204081632653051, -0.0006493506493506515, -0.0006493506493506602, 0.000694444444444445,
+      -0.00019841269841269814, -0.0005140692640692639, 0.00043290043290043154, -4.786879786879741e-05,
+      -7.07625707625708e-05, 2.8443778443778037e-05, -2.7750027750023993e-06, -0.0005952380952380932,
+      0.0017045454545454532, 0.0012121212121212113, -0.0013965201465201435, -3.5321821036107004e-05,
+      0.00024142524142524096, -3.211074639645975e-05, -0.00013528138528138571, 0.00043290043290043333,
+      0.0001769064269064271, -0.0002842395699538551, 9.712509712509694e-05, -9.910724196437825e-06,
+      0.0028282828282828235, -0.0007090132090132092, -0.0037523587523587486, -0.0001845376845376843,
+      3.0525030525031054e-05, -0.002231102231102221, -0.0027543884686741737, -0.00046620046620046663,
+      5.70857713714847e-05, -0.001744287458573167, -0.0006105006105006095, 0.0011337868480725615,
+      0.001443001443001439, 0.0014430014430014374, 0.002033730158730166, 0.0015873015873015875,
+      -0.0017721861471861468, -0.0009199134199134174, 0.0006816100566100572, 0.00016650016650016664,
+      -9.955322455322488e-05, 9.712509712509311e-06, -0.010687229437229424, -0.011634199134199113,
+      0.00026015651015650444, 0.0008325008325008362, -0.00033993783993783614, 3.4687534687531374e-05,
+      0.013653013653013616, 0.015484515484515458, 0.0016317016317016458, -0.00019980019980019674,
+      -0.005050505050505042, -0.005050505050505043, -0.005859374999999972, -0.017968750000000006,
+      -0.0003906250000000531, 0.04427083333333324, -0.013817562645687533, -0.026087194055944153,
+      0.016656650641025637, -0.003396021870286458, 0.00022977941176459272, 0.03906249999999983,
+      0.05729166666666663, -0.24403981435231362, -0.12318931068931112, 0.11318108974358992,
+      -0.024257299073475333, 0.0016412815126048256, -0.051979270729270895, 0.4579795204795196,
+      0.3980769230769232, -0.10479153199741506, 0.00709033613445389, -0.7541666666666667,
+      -0.7063725490196059, 0.047794117647059535, 0.9999999999999994, 0.005859374999999972,
+      0.017968750000000006, 0.0003906250000000531, -0.04427083333333324, 0.013817562645687533,
+      0.026087194055944153, -0.016656650641025637, 0.003396021870286458, -0.00022977941176459272,
+      -0.03906249999999983, -0.05729166666666663, 0.24403981435231362, 0.12318931068931112,
+      -0.11318108974358992, 0.024257299073475333, -0.0016412815126048256, 0.051979270729270895,
+      -0.4579795204795196, -0.3980769230769232, 0.10479153199741506, -0.00709033613445389,
+      0.7541666666666667, 0.7063725490196059, -0.047794117647059535, -0.9999999999999994,
+      0.002929687500000012, -0.00039062499999999433, -0.027734374999999922, 0.0032552083333332567,
+      0.10951613490675942, 0.11452414772727217, -0.052311197916666545, -0.15090645032051217,
+      -0.06591796874999979, -0.017578124999999938, -0.02197265624999992, 0.12773437499999965,
+      0.055366996284964734, -0.30740236326173703, -0.15855806790865315, 0.21113483253878382,
+      0.13905244715073473, 0.050292968749999716, -0.003255208333333341, -0.1825949115988169,
+      0.08285659652847131, 0.26021947616185775, -0.07710340746875634, -0.125419552586659,
+      -0.03919270833333318, 0.08077697042540735, 0.06039936625874103, -0.15372971754807563,
+      -0.01682427177601783, 0.07733513327205788, -0.02852128340409563, -0.04729060002497477,
+      0.05031174879807652, 0.03235533997252703, -0.036725725446428506, 0.01865127060439548,
+      -0.013076547475961526, -0.01774717699579829, 0.013980641084558864, 0.008846028645833321,
+      0.0046453737745099696, -0.004200654871323538, 0.00086167279411755, 0.0008616727941176887,
+      -0.002929687500000012, 0.00039062499999999433, 0.027734374999999922, -0.0032552083333332567,
+      -0.10951613490675942, -0.11452414772727217, 0.052311197916666545, 0.15090645032051217,
+      0.06591796874999979, 0.017578124999999938, 0.02197265624999992, -0.12773437499999965,
+      -0.055366996284964734, 0.30740236326173703, 0.15855806790865315, -0.21113483253878382,
+      -0.13905244715073473, -0.050292968749999716, 0.003255208333333341, 0.1825949115988169,
+      -0.08285659652847131, -0.26021947616185775, 0.07710340746875634, 0.125419552586659,
+      0.03919270833333318, -0.08077697042540735, -0.06039936625874103, 0.15372971754807563,
+      0.01682427177601783, -0.07733513327205788, 0.02852128340409563, 0.04729060002497477,
+      -0.05031174879807652, -0.03235533997252703, 0.036725725446428506, -0.01865127060439548,
+      0.013076547475961526, 0.01774717699579829, -0.013980641084558864, -0.008846028645833321,
+      -0.0046453737745099696, 0.004200654871323538, -0.00086167279411755, -0.0008616727941176887,
+      0.0029296875000000147, -0.000390624999999998, -0.027734375000000016, 0.003255208333333308,
+      0.10951613490675974, 0.11452414772727257, -0.052311197916666725, -0.15090645032051286,
+      -0.06591796875000003, 0.01757812500000001, 0.02197265624999994, -0.12773437499999998,
+      -0.05536699628496499, 0.30740236326173787, 0.15855806790865368, -0.21113483253878448,
+      -0.13905244715073523, 0.0502929687499999, -0.0032552083333333487, -0.18259491159881758,
+      0.08285659652847142, 0.26021947616185864, -0.07710340746875642, -0.12541955258665935,
+      0.03919270833333338, -0.08077697042540768, -0.06039936625874112, 0.15372971754807604,
+      0.01682427177601777, -0.07733513327205835, -0.02852128340409571, -0.047290600024974795,
+      0.05031174879807675, 0.032355339972527236, -0.03672572544642844, -0.018651270604395493,
+      0.013076547475961701, 0.017747176995798378, -0.013980641084559119, 0.008846028645833424,
+      0.004645373774509994, -0.004200654871323715, -0.0008616727941174899, -0.0008616727941174938,
+      -0.0029296875000000147, 0.000390624999999998, 0.027734375000000016, -0.003255208333333308,
+      -0.10951613490675974, -0.11452414772727257, 0.052311197916666725, 0.15090645032051286,
+      0.06591796875000003, -0.01757812500000001, -0.02197265624999994, 0.12773437499999998,
+      0.05536699628496499, -0.30740236326173787, -0.15855806790865368, 0.21113483253878448,
+      0.13905244715073523, -0.0502929687499999, 0.0032552083333333487, 0.18259491159881758,
+      -0.08285659652847142, -0.26021947616185864, 0.07710340746875642, 0.12541955258665935,
+      -0.03919270833333338, 0.08077697042540768, 0.06039936625874112, -0.15372971754807604,
+      -0.01682427177601777, 0.07733513327205835, 0.02852128340409571, 0.047290600024974795,
+      -0.05031174879807675, -0.032355339972527236, 0.03672572544642844, 0.018651270604395493,
+      -0.013076547475961701, -0.017747176995798378, 0.013980641084559119, -0.008846028645833424,
+      -0.004645373774509994, 0.004200654871323715, 0.0008616727941174899, 0.0008616727941174938,
+      -0.0002604166666666673, 0.0005208333333333307, 0.0031249999999999893, -0.0029708139083138916,
+      -0.009931041181041139, 0.003944493006992988, 0.011034928613053564, -0.0016037424585218644,
+      -0.004077700791855197, 0.0015624999999999875, -0.0042968749999999865, -0.002458479020979016,
+      0.018534200174825086, -0.0008038836163836116, -0.023905293924825082, 0.0016185560762766542,
+      0.009586662188914016, 0.0019531249999999911, 0.006659139471639438, -0.013884769744144702,
+      -0.008592969530469476, 0.02270564721736589, 0.002788495205774608, -0.009919337326276634,
+      -0.005736451048951017, 0.005162805944055928, 0.010871940559440485, -0.01264250072843817,
+      -0.005593655731523299, 0.007021528563348404, -0.002142388861138843, -0.0062890234765234365,
+      0.004371995192307655, 0.004722345669036796, -0.003796284138655381, 0.0026614010989010795,
+      -0.001379707532051262, -0.0024127679918120944, 0.0016283406391402102, 0.0012044270833333145,
+      0.0006587009803921689, -0.0005457261029411347, 0.00012372737556559288, 0.0001237273755656104,
+      0.0005208333333333389, -0.001041666666666664, -0.006249999999999994, 0.005941627816627817,
+      0.019862082362082353, -0.007888986013986013, -0.022069857226107208, 0.00320748491704374,
+      0.008155401583710418, 0.0031249999999999776, -0.008593749999999999, -0.004916958041958049,
+      0.037068400349650275, -0.0016077672327672215, -0.047810587849650296, 0.0032371121525533175,
+      0.019173324377828066, -0.003906249999999991, -0.013318278943278904, 0.027769539488289464,
+      0.017185939060939043, -0.0454112944347319, -0.005576990411549229, 0.019838674652553324,
+      -0.01147290209790208, 0.010325611888111883, 0.021743881118881037, -0.0252850014568764,
+      -0.011187311463046688, 0.014043057126696836, 0.004284777722277704, 0.012578046953046939,
+      -0.00874399038461532, -0.009444691338073633, 0.007592568277310807, 0.005322802197802186,
+      -0.002759415064102557, -0.0048255359836242295, 0.0032566812782804547, -0.002408854166666661,
+      -0.0013174019607843182, 0.001091452205882338, 0.0002474547511311991, 0.0002474547511311905,
+      -0.0019209956709956707, 0.0016639610389610382, 0.003166971916971912, -0.0035502691752691724,
+      -0.0016462703962703956, 0.002283653846153844, 0.0002943747429041556, -0.000503265117235707,
+      -0.0019209956709956666, -0.002495941558441553, 0.004755661005661002, 0.001032821345321345,
+      -0.004776473526473516, 0.0013230259324009278, 0.001240120173943705, -0.0005615937371452078,
+      -0.004159902597402584, 0.0031669719169719127, 0.007930437617937606, -0.005109473859473856,
+      -0.004356971153846146, 0.00202646618087794, 0.0006704003716871365, 0.0015782828282828254,
+      0.007842851592851577, -0.0001699689199689209, -0.007295915889665867, 0.0007888557520910447,
+      0.0016502339572192508, 0.004495504495504481, 0.0018169330669330652, -0.005031687062937062,
+      -0.0007255612035023906, 0.0016275544308632522, 7.631257631258709e-06, -0.0020198985042735014,
+      -0.0009864522732169762, 0.0010410774886877904, -0.0008877840909090964, -0.00041778074866310203,
+      0.00047000334224599823, 0.0001349753187988457, 0.00013497531879885365, 0.0003968253968253965,
+      -0.0007936507936507928, 0.0003336940836940836, 0.0007691382691382673, -0.0010186572686572662,
+      0.0002608502608502601, 0.00027437839937839904, -0.00020767631061748668, 4.24208144796378e-05,
+      0.0008116883116883109, 0.0006764069264069257, -0.0011738261738261726, -0.00048493173493173474,
+      0.0010947385947385918, -3.486097236097211e-05, -0.00042922763510998816, 0.0001467588783765253,
+      0.0003832972582972574, -0.0001549376549376554, -0.0006908600658600652, 0.000409312909312908,
+      0.00023457445332445283, -0.00026423739659033713, 6.312621202327026e-05, -0.001217301217301215,
+      -0.0030821030821030788, -1.9425019425019683e-05, 0.0021480833980833916, -8.150890503831666e-05,
+      -0.0003842154577448692, -0.002664002664002653, -0.0009240759240759188, 0.002904387279387271,
+      0.00042677910324969077, -0.0007376814362108443, 0.000381562881562879, 0.001766318172568169,
+      0.0006875613493260554, -0.0006971939416792334, 0.0007891414141414121, 0.00037136066547831,
+      -0.0004177807486631002, -0.00014997257644316255, -0.00014997257644316545, -0.00014880952380952426,
+      -0.0017045454545454538, 0.000744047619047619, 0.0019314019314019266, -0.00109577922077922,
+      -0.0005806693306693317, 0.0002716033966033968, 0.00010504201680672325, -1.983310806840226e-05,
+      -0.0007846320346320329, -0.0006899350649350643, 0.0007509157509157506, 0.0005692224442224432,
+      -0.0005103824746681878, -0.00019459706959706958, 0.00020032488519883498, -2.8464182875947225e-05,
+      -0.002042748917748915, 0.002306027306027301, 0.0045467924932210595, -0.0011880976166690435,
+      -0.0011909965034965048, 0.00016265247357684346, -3.246490904053893e-05, 0.0018881118881118849,
+      0.003192640692640685, 0.00011266511266511353, -0.0013330419580419547, -0.00011883541295306046,
+      2.234285322520698e-05, 0.0024805551591265797, 0.0006261595547309802, -0.002556818181818179,
+      -0.00036171811381895764, 0.00034070446360362055, -0.0012319030176172999, -0.002489697802197794,
+      -0.0006534665148110499, 0.0006043282697694465, -0.0010146103896103906, -0.00047746371275782885,
+      0.0005371466768525619, 0.0002570958453311398, 0.00025709584533114356, 0.00014880952380952412,
+      -0.00045995670995670993, 0.0002029220779220775, 0.00039960039960039906, -0.00043394105894105833,
+      8.116883116883095e-05, 6.764069264069259e-05, -3.207576736988488e-05, 3.3055180114004913e-06,
+      0.0029491341991341926, 0.0021103896103896102, -0.0022311022311022276, -0.0005702630702630705,
+      0.0009570786356500617, -2.757659007658796e-05, -0.00014281936550844228, 1.974128812364044e-05,
+      -0.000324675324675324, 2.4975024975024833e-05, -0.0001783930355358926, -0.00015876980162694376,
+      0.0002596361971361966, -9.881575007625376e-05, 1.0821636346846035e-05, -0.005069930069930063,
+      -0.00701590076590075, -0.0002927627927627936, 0.001740967365967361, 7.337433808022165e-05,
+      -1.4385124679242481e-05, -0.0014949336377907754, -0.0002782931354359903, 0.0016233766233766183,
+      0.00035762556770960023, -4.911055331223357e-05, 0.0024638060352346015, 0.0034913003663003582,
+      0.000606652917577287, -0.00042084141348847065, 0.0013528138528138478, 0.0006366182836770999,
+      -0.0007161955691367446, -0.0005141916906622809, -0.0005141916906622852, -0.000396825396825397,
+      -0.0008026695526695529, -1.3528138528138039e-05, 0.0007513320013320002, 0.0001612970362970355,
+      -0.00028513153513153494, -4.613442113442097e-05, 3.7421728598199487e-05, -3.856437679966949e-06,
+      0.0007846320346320327, -0.00019615800865800824, -0.0006514319014319006, 0.0004896145521145503,
+      1.4568764568764391e-05, -0.000110566516816516, 3.2443047148929225e-05, -2.678081722199441e-06,
+      -0.0011837121212121195, 0.001675407925407926, 0.003150495337995335, -8.32500832500828e-05,
+      -0.0002467150904650916, 0.00011528504175563, -1.2625242404653742e-05, 1.6187516187517645e-06,
+      0.0009340196840196831, 0.0007381507381507371, -0.00017199235949235883, 2.0472446943034455e-05,
+      -1.7853878147992939e-06, 0.0032051282051281937, 0.0005494505494505447, -0.0031302031302031237,
+      -0.0004172298289945371, 5.729564553093681e-05, -0.002136752136752129, -0.002798127798127788,
+      -0.0005985300102947142, 6.284565108094664e-05, -0.0015782828282828274, -0.0007427213309566231,
+      0.0008355614973262031, 0.0011997806115453128, 0.0011997806115453139, 0.003841991341991333,
+      0.004991883116883117, -0.000944888444888443, -0.0020656426906426897, 0.00048701298701298463,
+      0.00033143939393939613, -0.00011679496973614591, 9.641094199917614e-06, -0.011722999222999204,
+      -0.015685703185703156, -0.0031857031857031866, 0.0006968725718725696, -7.370080899492054e-05,
+      6.427396133279146e-06, 0.01257631257631254, 0.014957264957264915, 0.0021547080370609775,
+      -0.00022624434389139928, -0.004319210201563145, -0.00431921020156315, -0.008854166666666632,
+      -0.03923611111111113, -0.0069444444444445395, 0.13368055555555533, -0.0019698183760680174,
+      -0.07236912393162422, 0.033741830065359774, -0.005759266425868817, 0.00034265350877206056,
+      0.03935185185185095, 0.06018518518518529, -0.31850961538461503, -0.18783831908831947,
+      0.1270969498910682, -0.023037065703474656, 0.0013706140350882587, -0.04759615384615525,
+      0.515135327635327, 0.4553376906318082, -0.10136308909528846, 0.006030701754386624,
+      -0.7810457516339869, -0.7371861025111768, 0.043859649122808424, 0.9999999999999987,
+      -0.0013888888888888477, 0.005729166666666758, -0.009027777777777617, -0.026273148148148007,
+      0.028935185185184998, 0.10513488247863198, 0.08699252136752093, -0.05677083333333325,
+      -0.13605628654970736, -0.05836531432748533, 0.008333333333333168, -0.031163194444444528,
+      0.0003472222222220375, 0.1558159722222211, 0.00019650488400458545, -0.32127236912393015,
+      -0.1222207633053216, 0.21243341772015734, 0.12915752923976542, -0.009982638888888786,
+      0.07233796296296267, -0.03275876322751301, -0.21493914072038978, 0.13722789797008533,
+      0.2661380524431983, -0.0958658614213225, -0.12491624025341079, -0.026967592592592394,
+      -0.06394675925925898, 0.12327724358974299, 0.062064859330484105, -0.19019267429193726,
+      -0.008256605822153094, 0.0837445175438587, 0.046502976190475824, -0.023569139194139013,
+      -0.07827524038461471, 0.07328869047619012, 0.03763216635338291, -0.04385964912280678,
+      0.005886561355311341, 0.03618066684472912, -0.01572177482103961, -0.027169937328001412,
+      0.018845942982455895, -0.014952256944444428, 0.003496051198257144, 0.011717070325937785,
+      -0.0067312378167637705, -0.004748774509803873, -0.0028070712934297414, 0.0019417032163742485,
+      -0.0003883406432748128, -0.0003883406432746851, 0.0013888888888888592, -0.0057291666666667435,
+      0.009027777777777695, 0.02627314814814805, -0.028935185185185033, -0.10513488247863224,
+      -0.08699252136752107, 0.05677083333333352, 0.13605628654970772, 0.05836531432748561,
+      0.008333333333333246, -0.031163194444444587, 0.0003472222222221372, 0.1558159722222218,
+      0.00019650488400465094, -0.32127236912393137, -0.12222076330532206, 0.21243341772015842,
+      0.1291575292397659, 0.009982638888888819, -0.07233796296296295, 0.03275876322751325,
+      0.21493914072039055, -0.13722789797008553, -0.2661380524431993, 0.09586586142132278,
+      0.12491624025341114, -0.02696759259259249, -0.06394675925925924, 0.12327724358974346,
+      0.0620648593304844, -0.19019267429193826, -0.008256605822152898, 0.08374451754385932,
+      -0.04650297619047603, 0.023569139194139097, 0.07827524038461504, -0.07328869047619006,
+      -0.037632166353383026, 0.043859649122807036, 0.005886561355311331, 0.0361806668447292,
+      -0.015721774821039675, -0.02716993732800122, 0.018845942982456208, 0.014952256944444534,
+      -0.003496051198257158, -0.011717070325937754, 0.006731237816763947, -0.004748774509803812,
+      -0.0028070712934297284, 0.001941703216373953, 0.00038834064327489124, 0.0003883406432749907,
+      -0.0002604166666666686, 0.0010416666666666647, 0.0026041666666666544, -0.0038243006993006834,
+      -0.008441688519813494, 0.004414121417797871, 0.009651913650075367, -0.0016914989680082493,
+      -0.0036139867131062837, 0.0002604166666666646, 0.0015624999999999892, -0.005729166666666651,
+      -0.0012201340326340347, 0.019239744630369555, -0.002286010558069358, -0.022467600822380127,
+      0.0019398219814241364, 0.008692783582731284, -0.00260416666666665, 0.00260416666666666,
+      0.008312000499500455, -0.01673879505910746, -0.008236708144796337, 0.023290766627163596,
+      0.0022643925991449104, -0.0094206199475404, 0.0005208333333333328, -0.008340617715617666,
+      0.006187627476689948, 0.013354308069381513, -0.014466676093514262, -0.005652573529411689,
+      0.007119332107843137, 0.005073051948051905, -0.00014458198051947978, -0.009604779411764646,
+      0.0053637079831932236, 0.005563426028305998, -0.004187427438080431, -0.00010230654761905003,
+      0.0043811274509803644, -0.0010351015406162155, -0.0035119969040247317, 0.002006538635190863,
+      -0.0020220588235294033, 0.00030126633986926865, 0.0015302502579979452, -0.0007930749054007113,
+      -0.0006382761437908368, -0.00038699690402477395, 0.0002512792397660805, -5.482456140349672e-05,
+      -5.4824561403492246e-05, -0.0005208333333333383, 0.002083333333333329, 0.005208333333333329,
+      -0.0076486013986013825, -0.016883377039627025, 0.008828242835595763, 0.01930382730015083,
+      -0.0033829979360165117, -0.007227973426212588, -0.0005208333333333308, -0.0031249999999999893,
+      0.01145833333333336, 0.002440268065268076, -0.038479489260739214, 0.0045720211161387435,
+      0.044935201644760406, -0.003879643962848295, -0.017385567165462645, -0.005208333333333318,
+      0.0052083333333333304, 0.016624000999000958, -0.03347759011821509, -0.016473416289592747,
+      0.04658153325432733, 0.004528785198289845, -0.01884123989508084, -0.001041666666666668,
+      0.016681235431235394, -0.012375254953379954, -0.026708616138763065, 0.02893335218702864,
+      0.011305147058823477, -0.014238664215686297, 0.010146103896103853, -0.00028916396103894975,
+      -0.019209558823529344, 0.010727415966386484, 0.01112685205661202, -0.008374854876160924,
+      0.00020461309523810365, -0.00876225490196078, 0.00207020308123244, 0.007023993808049522,
+      -0.004013077270381711, -0.0040441176470588135, 0.0006025326797385615, 0.003060500515995917,
+      -0.0015861498108014488, 0.0012765522875816716, 0.000773993808049538, -0.0005025584795321752,
+      -0.0001096491228069798, -0.00010964912280699897, -0.0005208333333333334, 0.000520833333333332,
+      0.001673326673326672, -0.0024399211899211884, -0.0018696581196581187, 0.0033453525641025644,
+      0.0008247420471685171, -0.0018678013163307282, -0.00014878294435182978, 0.00040033093196792884,
+      -0.0015624999999999927, 0.002343750000000001, 0.002097902097902094, -0.00559986888111887,
+      0.0005127684815184819, 0.004150892765322903, -0.0016160310277957299, -0.0009571196266968311,
+      0.0005055147058823468, 0.0010029033466533452, 0.00520659895659895, -0.0039392031579531485,
+      -0.006970243298368287, 0.00548484527115041, 0.0029087538278714745, -0.0018034051297644539,
+      -0.00039996915601598514, 0.004895104895104882, 0.0008194930069930055, -0.009206548659673646,
+      0.0009399531228575312, 0.0063536953242835405, -0.0009785626041914702, -0.0012613680340557247,
+      0.0012409465534465487, -0.005056271853146848, -0.002850389500205674, 0.005324454956807881,
+      0.00047615769485932465, -0.001401468355560845, -0.0026971726190476095, -0.0022709865196078355,
+      0.0025162949795302703, 0.0010719163044772579, -0.0010181925756132415, -0.0005058628565062374,
+      0.0008281342840166425, 0.0007862890221878264, -0.0005477081183350568, 0.0004949095022624457,
+      0.00027350261967135867, -0.00022140688259109293, -5.904183535762862e-05, -5.904183535763608e-05,
+      -0.00032016594516594515, -7.665945165945167e-05, 0.0008824508824508817, -0.0007589632589632574,
+      -0.00040931290931290937, 0.0009776681651681633, -0.0003992841309017768, -0.00017111156817039232,
+      0.00017783590248760534, -3.9410086817206965e-05, -0.00022997835497835494, -0.00041989260739260734,
+      -0.0002705627705627704, 0.0006842116217116204, 0.00039803946053945915, -0.0008174041032496896,
+      1.1385673150378409e-05, 0.0003440094638333803, -0.00011795963324601029, -0.0001847111222111218,
+      -0.00040931290931290845, 0.000160429847929847, 0.0005372231934731927, -0.0003412768807989386,
+      -0.00020098365686601027, 0.00023483554951240677, -5.764923286208046e-05, -0.0012140637140637112,
+      -1.2140637140636954e-05, 0.0025586392773892714, 1.5747120526531304e-05, -0.0014920128890717073,
+      9.58866017883039e-05, 0.000246930410920348, 8.8453213453213e-05, 0.0028900786713286614,
+      0.001299726621417795, -0.0023362666745019604, -0.00030486879606461594, 0.0005294990419796907,
+      0.001960279304029297, 0.0014405401583710397, -0.0017304998922645937, -0.0006479407299356989,
+      0.0005628200166706346, 0.00020169526143790667, -0.0007835710041592384, -0.0005856626442442976,
+      0.00039960362135284716, -0.00044991772932949435, -0.0002486387451557764, 0.00020127898417371891,
+      6.440927493559012e-05, 6.440927493558995e-05, -0.0008139430014430006, 0.00036976911976911866,
+      0.0017529345654345636, -0.00132228882228882, -0.0012655747030747033, 0.00105623543123543,
+      0.0003250528066704541, -0.00020122851005204028, -8.053414593662295e-05, 1.5448302987002995e-05,
+      6.764069264069307e-05, 0.0008507117882117884, 0.0005556943056943066, -0.0009339618714618681,
+      -0.00043193413729127885, 0.0005843956900942179, 0.00010594272674104626, -0.00017713396317304986,
+      2.6668055886321215e-05, 0.00235701798201798, 0.003626928626928615, -0.0020309551559551534,
+      -0.0032830264973122115, 0.00099313472475237, 0.000809764465226651, -0.00013921997764877007,
+      2.631097832336112e-05, 0.0017822455322455283, -0.0002974456099456125, -0.0032040008602508556,
+      -0.0001530077357283218, 0.0010666416916416894, 7.811541528646828e-05, -1.722429402382913e-05,
+      -0.0011243964368964352, -0.0033855653275296086, -0.0010383764519793957, 0.0017038371292572943,
+      0.000277989715392969, -0.00020305497521054642, -0.0023697780394208896, -0.0013834460066077677,
+      0.0019113414596607832, 0.0005373923354767001, -0.00038761709137096064, 0.00019015655504626126,
+      0.0012055958747135274, 0.0006132948095506188, -0.00040214451011664576, 0.0005998903057726605,
+      0.0003315183268743661, -0.0002683719788982962, -0.00010734879155931849, -0.0001073487915593223,
+      -0.0006809163059163064, 0.0001533189033189031, 0.0008037101787101773, -0.0006771006771006756,
+      -0.00017447829947829998, 0.0004322066822066816, -0.00012563008886538215, -5.166402225225823e-05,
+      3.074625752644332e-05, -3.329144196016712e-06, 0.00045995670995670874, -0.0015796703296703284,
+      -0.0010855810855810847, 0.0016629204129204101, 0.00018856143856143813, -0.0006169994221464795,
+      1.8853695324282507e-05, 0.00010136438638760583, -1.4175710770136233e-05, 2.775002775002748e-05,
+      -0.00023310023310023267, -0.00020217877360734487, 0.0003805222555222555, 2.030241000829281e-05,
+      -0.0002026840262134381, 8.861736941126546e-05, -1.0246962646342737e-05, -0.002533022533022527,
+      0.0004981129981129987, 0.004288558663558659, 0.00028937565702271523, -0.001003245120892178,
+      -2.7868158673113194e-05, 7.329486818650109e-06, 0.001665298986727551, 0.00345591908091907,
+      0.0009826570488335185, -0.0011001253648312427, -0.00025406509677849775, 3.8097222694746444e-05,
+      0.0023847680097680043, 0.0011957507361919104, -0.0018539467068878802, -0.0004567236813753847,
+      0.00020820575193640164, -0.0008886130209659612, -0.0019275386922445704, -0.0006498811645870432,
+      0.00038904450669156627, -0.0008569861511038, -0.0004735976098205223, 0.0003833885412832767,
+      0.00020447388868441546, 0.0002044738886844153, -0.0008139430014430025, -0.0001510642135642136,
+      0.0010864135864135874, 8.325008325008327e-06, -0.0006379037629037642, -6.555944055944017e-05,
+      0.00020314652667593853, 2.073090308384415e-05, -2.2856722740623692e-05, 2.4243687169383554e-06,
+      0.000588474025974025, -0.00014906968031968006, 4.870129870129856e-05, 0.0004518918581418567,
+      -0.0004603432282003703, 2.1784281894576235e-05, 0.00010894217826990923, -3.5731248240923464e-05,
+      3.1009367309680306e-06, 0.00402332042957043, 0.004957542457542447, -0.0008546141358641321,
+      -0.001852946160981876, 0.00014123692892075045, 0.00013029687399435496, -6.748564580414369e-05,
+      7.5644062679648755e-06, -0.00037198912198912164, -0.00011412198912199034, -0.0005447157009657014,
+      -0.0006239216257598591, 0.0001572365542953777, -1.9592282072931393e-05, 1.8323717046627868e-06,
+      -0.004497585747585734, -0.007059235407449684, -0.0014796171965289638, 0.0012945038155122155,
+      0.00018523948961255627, -2.723186256468098e-05, -0.001635269492412344, -0.0007765926883573908,
+      0.0013300191871620417, 0.00042172739541160585, -4.961498769548232e-05, 0.0020318733554027654,
+      0.002960275019098549, 0.0006391312505863639, -0.0002892704131094213, 0.0011997806115453143,
+      0.0006630366537487246, -0.0005367439577965856, -0.00042939516623727064, -0.0004293951662372739,
+      -0.00032016594516594504, -7.665945165945175e-05, 0.00037254412254412214, -7.90875790875788e-05,
+      -0.00016650016650016647, 8.533133533133518e-05, 1.7425385072444258e-05, -2.1138991727227232e-05,
+      4.803632899608137e-06, -3.382840070145178e-07, -0.0002299783549783549, -0.001184752747252748,
+      -0.001028138528138528, 0.0005749458874458873, 0.0005806693306693297, -0.00021928133141368379,
+      -0.0001050420168067236, 4.2877497889107644e-05, -3.7211240771603965e-06, 0.0010900557775557756,
+      0.0002705627705627692, -0.0007674617049617043, 0.0002627580752580743, 0.00010194564422505565,
+      -8.773905832729367e-05, 1.9632553978529317e-05, -1.4095166958946655e-06, -0.0018162393162393159,
+      0.0007041569541569545, 0.003655545843045839, 0.000896336098541978, -0.0002131038895744784,
+      2.3510738487517574e-05, -2.198846045596377e-06, 0.0001665001665001653, 0.001379870129870126,
+      0.0011920677361853822, -4.995004995004839e-05, -2.661811872338237e-05, 2.0297040420877266e-06,
+      0.0033577533577533506, 0.001420311714429359, -0.0025030525030524955, -0.0005060728744939269,
+      5.9537985234579104e-05, -0.0020090612002376666, -0.002733214497920372, -0.0006631719673515333,
+      6.0981330331176256e-05, -0.001439736733854377, -0.0007956439844984725, 0.0006440927493559069,
+      0.0010305483989694495, 0.0010305483989694506, -0.0005208333333333352, -0.0010416666666666656,
+      0.0001108266733266746, 0.0010565823065823033, 4.2492229992229647e-05, -0.00045163170163170155,
+      1.9067941862058945e-05, 6.941587823940828e-05, -1.761332063189597e-05, 1.2403746923866493e-06,
+      0.004909153346653343, 0.008703102453102438, 0.002597229159729157, -0.0016571969696969706,
+      -9.051916221034203e-05, 0.0002928036016271328, -7.198603125460474e-05, 5.168227884944907e-06,
+      -0.011988011988011938, -0.017963286713286668, -0.005730666392431103, 0.000349650349650343,
+      9.759976865240323e-05, -7.4422481543252815e-06, 0.01157531194295898, 0.014230540701128907,
+      0.002431630546955634, -0.00022359821121430303, -0.003778677462887982, -0.0037786774628879765,
+      0.0024739583333332022, 0.00848958333333347, 0.009587053571428484, -0.013095238095238042,
+      -0.029752604166666554, 0.025390624999999726, 0.013746170343137585, -0.017745098039215947,
+      0.006063153057275623, -0.000875638084180997, 4.650297619038181e-05, -0.008482142857143604,
+      -0.04910714285714228, -0.013950892857142894, 0.2131696428571422, 0.03487030228758295,
+      -0.10588818860877787, 0.03958943774878407, -0.005837587227873362, 0.0003100198412692999,
+      0.038169642857142784, 0.06026785714285696, -0.38071691176470507, -0.24714285714285758,
+      0.13354088345864734, -0.02101531402034496, 0.0011160714285713535, -0.04375816993463846,
+      0.5616339869281042, 0.503095975232196, -0.09713745147181742, 0.0051587301587310746,
+      -0.8026315789473657, -0.7621553884711754, 0.040476190476189555, 1.0000000000000016,
+      -0.0024739583333332022, -0.00848958333333347, -0.009587053571428484, 0.013095238095238042,
+      0.029752604166666554, -0.025390624999999726, -0.013746170343137585, 0.017745098039215947,
+      -0.006063153057275623, 0.000875638084180997, -4.650297619038181e-05, 0.008482142857143604,
+      0.04910714285714228, 0.013950892857142894, -0.2131696428571422, -0.03487030228758295,
+      0.10588818860877787, -0.03958943774878407, 0.005837587227873362, -0.0003100198412692999,
+      -0.038169642857142784, -0.06026785714285696, 0.38071691176470507, 0.24714285714285758,
+      -0.13354088345864734, 0.02101531402034496, -0.0011160714285713535, 0.04375816993463846,
+      -0.5616339869281042, -0.503095975232196, 0.09713745147181742, -0.0051587301587310746,
+      0.8026315789473657, 0.7621553884711754, -0.040476190476189555, -1.0000000000000016,
+      -0.0012369791666666944, 0.0010677083333332405, 0.0050948660714284005, -0.018824404761904803,
+      -0.01409505208333337, 0.047851562499999716, 0.09224226409313686, 0.06553615196078402,
+      -0.05749050648219803, -0.1234462247069876, -0.052329799107142735, 0.007421874999999945,
+      0.00100446428571426, -0.042276785714285496, 0.040039062500000104, 0.15765066964285665,
+      -0.05613166360294053, -0.3171214110644243, -0.08924082091718209, 0.21021432833001502,
+      0.12021763392857067, -0.02047991071428562, -0.0008184523809523052, 0.0956101190476185,
+      -0.08618861607142853, -0.2198242187499995, 0.19090292366946665, 0.25973638427410295,
+      -0.11193755874060163, -0.12308407738095256, 0.035729166666666375, -0.04085286458333316,
+      -0.07902343749999967, 0.17622153288398576, 0.044529207516339715, -0.21948474990324918,
+      0.0030452490755076, 0.08839626736111039, -0.006319754464285793, 0.07056361607142814,
+      -0.0367244944852937, -0.10279017857142785, 0.09997723801691694, 0.03906189531733762,
+      -0.050097656249998755, -0.03468191964285691, -0.009227047589869234, 0.059893061391222704,
+      -0.02395541070046446, -0.03479488972123951, 0.023598710317459724, 0.005332031249999974,
+      -0.022423406862745045, 0.0005038820626935631, 0.018804335056391303, -0.009454985119047151,
+      0.010493259803921628, 0.000160543246904068, -0.007110060307017909, 0.003222656249999644,
+      0.002509251644736903, 0.001608023966165561, -0.000901227678571345, 0.00017671130952389013,
+      0.0001767113095239293, 0.0012369791666666944, -0.0010677083333332405, -0.0050948660714284005,
+      0.018824404761904803, 0.01409505208333337, -0.047851562499999716, -0.09224226409313686,
+      -0.06553615196078402, 0.05749050648219803, 0.1234462247069876, 0.052329799107142735,
+      -0.007421874999999945, -0.00100446428571426, 0.042276785714285496, -0.040039062500000104,
+      -0.15765066964285665, 0.05613166360294053, 0.3171214110644243, 0.08924082091718209,
+      -0.21021432833001502, -0.12021763392857067, 0.02047991071428562, 0.0008184523809523052,
+      -0.0956101190476185, 0.08618861607142853, 0.2198242187499995, -0.19090292366946665,
+      -0.25973638427410295, 0.11193755874060163, 0.12308407738095256, -0.035729166666666375,
+      0.04085286458333316, 0.07902343749999967, -0.17622153288398576, -0.044529207516339715,
+      0.21948474990324918, -0.0030452490755076, -0.08839626736111039, 0.006319754464285793,
+      -0.07056361607142814, 0.0367244944852937, 0.10279017857142785, -0.09997723801691694,
+      -0.03906189531733762, 0.050097656249998755, 0.03468191964285691, 0.009227047589869234,
+      -0.059893061391222704, 0.02395541070046446, 0.03479488972123951, -0.023598710317459724,
+      -0.005332031249999974, 0.022423406862745045, -0.0005038820626935631, -0.018804335056391303,
+      0.009454985119047151, -0.010493259803921628, -0.000160543246904068, 0.007110060307017909,
+      -0.003222656249999644, -0.002509251644736903, -0.001608023966165561, 0.000901227678571345,
+      -0.00017671130952389013, -0.0001767113095239293, -0.0012369791666667074, 0.0010677083333332634,
+      0.005094866071428507, -0.018824404761904688, -0.014095052083333214, 0.0478515625,
+      0.09224226409313722, 0.06553615196078404, -0.05749050648219844, -0.12344622470698834,
+      -0.05232979910714306, -0.0074218749999999875, -0.001004464285714381, 0.04227678571428552,
+      -0.04003906250000043, -0.15765066964285762, 0.05613166360294074, 0.31712141106442476,
+      0.08924082091718248, -0.21021432833001572, -0.1202176339285711, -0.020479910714285728,
+      -0.0008184523809523197, 0.0956101190476189, -0.08618861607142894, -0.21982421875000044,
+      0.19090292366946693, 0.25973638427410367, -0.11193755874060171, -0.1230840773809527,
+      -0.03572916666666657, 0.04085286458333332, 0.07902343750000007, -0.17622153288398631,
+      -0.04452920751633957, 0.21948474990325026, -0.0030452490755076373, -0.08839626736111071,
+      -0.0063197544642857656, 0.0705636160714284, -0.03672449448529385, -0.10279017857142783,
+      0.09997723801691698, 0.039061895317337496, -0.050097656249999414, 0.03468191964285692,
+      0.00922704758986922, -0.05989306139122293, 0.02395541070046445, 0.034794889721239626,
+      -0.02359871031746016, 0.005332031250000053, -0.022423406862745188, 0.0005038820626936011,
+      0.018804335056391376, -0.009454985119047667, -0.010493259803921781, -0.00016054324690430088,
+      0.007110060307017636, -0.0032226562499997626, 0.002509251644736866, 0.001608023966165532,
+      -0.0009012276785714685, -0.0001767113095237154, -0.00017671130952395537, 0.0012369791666667074,
+      -0.0010677083333332634, -0.005094866071428507, 0.018824404761904688, 0.014095052083333214,
+      -0.0478515625, -0.09224226409313722, -0.06553615196078404, 0.05749050648219844,
+      0.12344622470698834, 0.05232979910714306, 0.0074218749999999875, 0.001004464285714381,
+      -0.04227678571428552, 0.04003906250000043, 0.15765066964285762, -0.05613166360294074,
+      -0.31712141106442476, -0.08924082091718248, 0.21021432833001572, 0.1202176339285711,
+      0.020479910714285728, 0.0008184523809523197, -0.0956101190476189, 0.08618861607142894,
+      0.21982421875000044, -0.19090292366946693, -0.25973638427410367, 0.11193755874060171,
+      0.1230840773809527, 0.03572916666666657, -0.04085286458333332, -0.07902343750000007,
+      0.17622153288398631, 0.04452920751633957, -0.21948474990325026, 0.0030452490755076373,
+      0.08839626736111071, 0.0063197544642857656, -0.0705636160714284, 0.03672449448529385,
+      0.10279017857142783, -0.09997723801691698, -0.039061895317337496, 0.050097656249999414,
+      -0.03468191964285692, -0.00922704758986922, 0.05989306139122293, -0.02395541070046445,
+      -0.034794889721239626, 0.02359871031746016, -0.005332031250000053, 0.022423406862745188,
+      -0.0005038820626936011, -0.018804335056391376, 0.009454985119047667, 0.010493259803921781,
+      0.00016054324690430088, -0.007110060307017636, 0.0032226562499997626, -0.002509251644736866,
+      -0.001608023966165532, 0.0009012276785714685, 0.0001767113095237154, 0.00017671130952395537,
+      6.510416666666761e-05, -0.00013020833333333604, -8.37053571428599e-05, 0.001413690476190474,
+      0.0017903645833333287, -0.004161658653846137, -0.0070779423548265165, 0.004560919762641874,
+      0.00852028105650151, -0.0017128356276721046, -0.0032441944705513676, -0.00039062499999999053,
+      0.0007254464285714294, 0.00111607142857142, -0.006835937499999962, 0.0006180056157078173,
+      0.01904959700226236, -0.0036494038404835337, -0.02100969910990704, 0.002192550539952791,
+      0.007957191922821755, 0.0005580357142857122, -0.0033482142857142647, 0.00418526785714284,
+      0.00870131706528762, -0.019240588863750564, -0.007076322853702843, 0.02344268299425026,
+      0.0017084684751093435, -0.008960149300948449, 0.002604166666666647, 0.001139322916666659,
+      -0.011188489819004476, 0.008348504666289535, 0.01461638931888535, -0.016052812983746088,
+      -0.005454237616099003, 0.007142813951238401, -0.002720424107142839, 0.006568408613445339,
+      0.0007065716911764584, -0.012500345532949948, 0.006635139664418356, 0.006061511775762873,
+      -0.004491712392193661, -0.0032914006948933155, -0.0023525876696832543, 0.006526080827067624,
+      -0.0011307565789473568, -0.004380493973905302, 0.0023375304068995475, 0.0011118770424836607,
+      -0.0025958354833161327, -0.0003537393575851636, 0.0023251968002112842, -0.001028776368003291,
+      0.0013827076883384851, 8.919069272446127e-05, -0.0009106232953708079, 0.00038289370024321333,
+      0.000334087171052623, 0.00021782973057643513, -0.00011625744047621137, 2.4619222689069654e-05,
+      2.4619222689067255e-05, -0.00013020833333333428, 0.0002604166666666707, 0.00016741071428572,
+      -0.0028273809523809545, -0.0035807291666666644, 0.008323317307692297, 0.014155884709653078,
+      -0.009121839525283797, -0.017040562113003095, 0.0034256712553442266, 0.006488388941102758,
+      -0.0007812499999999912, 0.0014508928571428624, 0.0022321428571428453, -0.013671874999999969,
+      0.0012360112314156332, 0.03809919400452484, -0.007298807680967089, -0.04201939821981425,
+      0.004385101079905616, 0.01591438384564355, -0.0011160714285714218, 0.006696428571428555,
+      -0.008370535714285698, -0.01740263413057529, 0.03848117772750124, 0.014152645707405799,
+      -0.046885365988500655, -0.0034169369502186934, 0.01792029860189691, 0.005208333333333306,
+      0.002278645833333326, -0.02237697963800901, 0.016697009332579147, 0.029232778637770834,
+      -0.032105625967492266, -0.01090847523219805, 0.01428562790247682, 0.005440848214285699,
+      -0.013136817226890743, -0.0014131433823529375, 0.02500069106589998, -0.013270279328836725,
+      -0.01212302355152576, 0.008983424784387373, -0.006582801389786643, -0.004705175339366515,
+      0.013052161654135313, -0.0022615131578947304, -0.008760987947810663, 0.004675060813799107,
+      -0.002223754084967337, 0.005191670966632254, 0.0007074787151702919, -0.004650393600422627,
+      0.0020575527360066318, 0.002765415376676989, 0.000178381385448952, -0.001821246590741558,
+      0.000765787400486444, -0.0006681743421052517, -0.0004356594611529002, 0.0002325148809523681,
+      4.923844537811402e-05, 4.923844537813078e-05, 0.0005208333333333343, -0.0009672619047619037,
+      -0.0010267510267510274, 0.0026557643745143745, 0.0007782505484711369, -0.002877331002331001,
+      -0.000327458918790188, 0.0015239243470667612, 6.461466165413568e-05, -0.0003256072165708404,
+      0.0005208333333333318, 0.001450892857142855, -0.0032529970029970038, -0.0008103875291375285,
+      0.005582698551448543, -0.0017152845622514714, -0.003391668745770909, 0.0017214571177661335,
+      0.0007343343038969967, -0.00045347744360902385, 0.002418154761904756, -0.001026751026751028,
+      -0.005851353507603501, 0.0053285792026600744, 0.005401110582636315, -0.005512225132968156,
+      -0.0018220727688848801, 0.0015828288552263003, 0.00022659283011450664, 0.0011994949494949466,
+      -0.005829023407148396, -0.0008924975147401555, 0.009665982506056008, -0.0019484632584477744,
+      -0.005365228328173366, 0.001087488175094598, 0.0009742915806673556, -0.0034438218031967883,
+      -0.0037720781057178003, 0.006281815610859715, 0.0027141879018814014, -0.00530842271118973,
+      -0.0002106023330384863, 0.0012019363666519215, -0.0023554493912949725, 0.0021199605643539435,
+      0.003485358380869205, -0.002945595305429858, -0.0009909693043884216, 0.0009645744262617317,
+      0.0012650633169934654, 0.0018156604747161993, -0.000982448077915382, -0.0009492941913607629,
+      0.000583751044277357, 0.0005449379481887251, -0.0002682930459633271, -0.000534040370534188,
+      0.00027919062361786645, -0.00026864035087719536, -0.00016447368421052436, 0.00010416666666667391,
+      2.6260504201679183e-05, 2.6260504201681287e-05, -0.00026041666666666607, 0.0005208333333333328,
+      -0.00015947594072594076, -0.0008436008436008406, 0.0010759639665889656, 2.6780817221992495e-06,
+      -0.0008099054744275326, 0.00044906074317838915, 9.59119730888309e-05, -0.00015078526349811082,
+      3.610819327730986e-05, -0.000350170662670662, 0.0002872127872127876, 0.00019980019980019994,
+      5.5933649683648176e-05, -0.0002716493065757769, -0.00046571841149046974, 0.0006850304837920925,
+      -4.549919894347851e-07, -0.0002876458444376392, 9.839183649168129e-05, 0.00013528138528138547,
+      8.67188367188368e-05, 0.0002233010045510043, -4.11276835909188e-05, -0.0004748238893459478,
+      0.0002882018652142484, 0.00018357102456367146, -0.00021336659663865503, 5.309689665339738e-05,
+      0.00029623154623154545, 0.001371133207070706, 0.0001221740881667356, -0.0019735766174185233,
+      9.479469618788916e-06, 0.0010933364478014228, -0.00010327152959699332, -0.0001662794630335269,
+      0.0016106939935064863, 0.0013123595154845105, -0.0027280279463183805, -0.0011553365365284832,
+      0.0018762022371977786, 0.0002083962380498753, -0.0003934490673799861, 0.0009040515244559359,
+      -0.0015921552916038167, -0.0019078970994605643, 0.001594222582757793, 0.0005489647360293635,
+      -0.00045694813012924315, -0.0010924966577540083, -0.0012905760390280463, 0.0007816677807486618,
+      0.0006171218487394928, -0.0003626253132832078, -0.0003467786943019141, 0.00028546095931931785,
+      0.00041697262575745794, -0.00021526702786377498, 0.0002479757085020225, 0.00015182186234817627,
+      -9.615384615384586e-05, -2.8280542986427482e-05, -2.828054298642917e-05, -5.7494588744588396e-05,
+      0.000922514985014985, -0.0007958187645687637, -0.001435023310023309, 0.0016500426656676657,
+      0.0006621595316448254, -0.0009006388831756463, -0.0001811510857563492, 0.00015052792602134757,
+      6.547970218635897e-05, -1.2638532133502157e-05, 0.000540605228105227, 0.0003519917582417581,
+      -0.0011540542790542797, -0.00039543789543789435, 0.0011224529147323243, 0.00020547390722023038,
+      -0.0005716178171673524, -4.5283542888999644e-05, 0.00015484950421095964, -2.4508676308212104e-05,
+      0.0013749271561771547, -0.0015661421911421893, -0.0034991050616050563, 0.0020185467106422945,
+      0.0024236448294352687, -0.0008803841282556434, -0.0005800984764074932, 0.00012469994208577742,
+      -2.2648114269629113e-05, -0.0008231351981351959, -0.0029296874999999965, -3.751099798893878e-05,
+      0.0029620387272041595, 7.568916721393444e-05, -0.0008765121858920233, -4.638719446188507e-05,
+      1.2816735315768634e-05, -0.002139462100399595, -0.0010232644194041209, 0.003002202301375093,
+      0.0009843049752105463, -0.001250415485250041, -0.0002154784553681644, 0.00013323738471281,
+      -0.0001690379677512032, 0.002302549625619474, 0.0017255797393181257, -0.001436183342264029,
+      -0.0004248593415098838, 0.0002653161467015954, 0.0016032336229946514, 0.00143144877568252,
+      -0.0010328529587672413, -0.0005588210164448592, 0.0003022470950102501, 0.00020719895429647769,
+      -0.0004952647004698101, -0.000466662787676721, 0.00023580086708956487, -0.00033814869341185227,
+      -0.00020702981229296996, 0.00013111888111888275, 4.6277252159604745e-05, 4.62772521596063e-05,
+      -0.0002457611832611833, 0.0007031163281163279, -0.0003245018870018871, -0.0007652070152070132,
+      0.0009057782495282479, -5.087845161374561e-05, -0.0003712433399933394, 0.0001453579530204913,
+      3.6872688285227067e-05, -2.8069518201096564e-05, 3.1747685578948207e-06, -0.0009018759018758998,
+      -0.0008064851814851813, 0.0014638139638139646, 0.000541819291819291, -0.0012138509249853754,
+      -5.3964621979328224e-05, 0.0004202262633266616, -3.741260029959429e-06, -7.958623477199403e-05,
+      1.109893718252928e-05, 0.0005263833388833378, 5.8968808968808786e-05, 7.309159094873426e-05,
+      0.0002835523778275873, -0.00044487188329100024, 5.703652458406969e-05, 0.00015783087173650004,
+      -7.775833772350843e-05, 9.365455379387032e-06, 0.0016511266511266478, 0.0038244741369741313,
+      0.00021028807793513745, -0.0028080341499459056, -0.0002025250864260152, 0.000651977988471796,
+      5.888647529515101e-06, -3.6396853347328703e-06, 0.001982578433471281, 0.00074908022649619,
+      -0.002811633831854412, -0.000984408301414048, 0.0008036043594839448, 0.00018070004041366317,
+      -2.9176995605014087e-05, -0.0006983963457177701, -0.0028701852001484294, -0.0015235823299180212,
+      0.0011148975025232733, 0.0003445239150541005, -0.00012216706295653575, -0.002090008983391331,
+      -0.0015622277619181577, 0.001275714631945277, 0.0005137621236692431, -0.00023417128680286594,
+      7.210460964330836e-05, 0.0008809479349340041, 0.0005446998964800847, -0.0002641434288106093,
+      0.0005009610272768153, 0.0003067108330266199, -0.0001942501942501967, -8.569861511038098e-05,
+      -8.569861511038571e-05, 0.00024576118326118357, 0.0008024961149961144, -0.00033612221112221114,
+      -0.0009552947052947045, 0.0002809690309690314, 0.00044728555757967445, -2.060847649083329e-06,
+      -0.00013880813029419842, -1.4544601425406373e-05, 1.6551753200359956e-05, -1.7719638462673664e-06,
+      -0.0006037365412365396, -0.00018445096570096566, 0.0006271506271506268, -0.0004985465922965908,
+      -0.00026931227036269026, 0.0004842609392241726, -8.000480689556241e-05, -9.029968032483503e-05,
+      3.3806027420577434e-05, -3.0606648253696113e-06, 0.0011251769064269037, -0.0017794705294705278,
+      -0.0033710708933923175, 0.0006142972923435094, 0.0011432730872069092, -8.837573797768407e-05,
+      -9.699056978330579e-05, 4.8527646244363874e-05, -5.409859318526536e-06, -0.00030108780108780114,
+      -0.0009008786352536352, -0.0006393116687234349, 0.000577900279187043, 0.0004662806520391654,
+      -0.00013190055880651875, 1.7540652215573885e-05, -1.6992506833835127e-06, -0.002838214612768175,
+      -0.0008541156847354284, 0.003625104980803501, 0.0010912406920810282, -0.0006666847706141683,
+      -0.00010142479424600319, 1.5494615678440282e-05, 0.0014213618139563473, 0.0033634580969139696,
+      0.0014921060641980555, -0.000770937170414723, -0.0002848185776784855, 3.6128373976670903e-05,
+      0.0022580054749172375, 0.0015063840528236746, -0.0013457984868588569, -0.00045652232184740333,
+      0.0001376547429178976, -0.0006708046568727658, -0.0015504683654838404, -0.0006101641163560677,
+      0.00026949959225501026, -0.0007514415409152257, -0.00046006624953993567, 0.00029137529137528883,
+      0.00017139723022075926, 0.00017139723022075983, 5.7494588744588816e-05, 0.00019095487845487846,
+      -7.570554445554453e-05, -0.0002559940059940053, 0.0001326798201798198, 0.00012358964564846886,
+      -9.405423008364166e-05, -1.0328938347514414e-05, 2.1971546255601913e-05, -5.436707255592376e-06,
+      3.986918654098863e-07, -0.0016540750915750894, -0.0016592782217782205, 0.001046869796869797,
+      0.0009937978687978679, -0.0005158444496679779, -0.00037658420011361227, 0.00016657104505401704,
+      5.7305310788283334e-05, -2.5975379110054785e-05, 2.305163876372404e-06, 0.0008038836163836137,
+      -0.00012487512487512493, -0.00031218781218781094, 0.0005690541076570481, -0.0002376606236900349,
+      -8.183251217306944e-05, 8.589997463836486e-05, -2.0840711146439232e-05, 1.5706043182827803e-06,
+      0.004312354312354306, 0.006788133741258726, 0.0011946744023949925, -0.0018451447449609193,
+      -0.00042861335430994987, 0.00011926484570640964, -1.4799925306889465e-05, 1.3615931282319757e-06,
+      -0.00028877372627372636, 7.161955691367287e-06, -0.0006218964858670726, -0.0008974771358672255,
+      4.6233758501560324e-05, 2.3921511924607546e-05, -1.957214612012646e-06, -0.003951981433599066,
+      -0.006729759211376839, -0.0021327829377364937, 0.0008917053663570649, 0.0002197057972986768,
+      -2.7004729017112896e-05, -0.0016934046345811, -0.0011305000469087098, 0.0010385589642555556,
+      0.0004312251216275966, -4.442925495557076e-05, 0.0017238952997466917, 0.002561215873909373,
+      0.0006278551170192092, -0.00020946545714347297, 0.0010820758189179216, 0.0006624953993375021,
+      -0.00041958041958042213, -0.0003702180172768422, -0.0003702180172768491, 0.00026041666666666655,
+      0.0004355019980019985, 0.000103802447552447, -0.00031322843822843827, -0.0002965784215784211,
+      8.655560126148372e-05, 0.00015340052104757958, -1.856051585153753e-05, -2.364041402354114e-05,
+      6.64486442350194e-06, -4.872900577231838e-07, -0.0006061646686646673, -0.0003707230269730272,
+      0.0005962787212787212, 4.032425907425973e-05, -0.00031806428865252333, 9.185820307143743e-05,
+      5.081240568856694e-05, -3.223000876832143e-05, 5.9951443465368335e-06, -3.721124077152856e-07,
+      3.902347652347238e-06, -0.0012435481185481163, -0.0022438499000998974, -0.0006261355066502109,
+      0.0004960700043420634, 3.946646748504373e-06, -9.44678225541234e-05, 2.5471980290091564e-05,
+      -1.9196275001225233e-06, 0.0012213480963480946, 0.00048107274669774485, -0.0009944253050870682,
+      -5.1865516019926725e-05, 0.00014519901323306833, -4.8619868908181304e-05, 7.959070942816901e-06,
+      -5.064863327256116e-07, -0.0023179945054944964, -0.00046662895927601313, 0.00336859831345125,
+      0.0014446080235553918, -0.00010425429833324385, -2.923740346341007e-05, 2.3921511924612367e-06,
+      0.00029021223874164937, 0.0016936902966314693, 0.0015218098035435464, 6.102643486544407e-05,
+      -5.3666878357280855e-05, 3.6384324310016345e-06, 0.003384952465834814, 0.002000656722018944,
+      -0.001965651092973068, -0.0005270529264337326, 5.430242272347219e-05, -0.0018796562914209908,
+      -0.002627519539284237, -0.0006913021618903957, 5.656108597284859e-05, -0.0013225371120107938,
+      -0.0008097165991902816, 0.0005128205128205097, 0.0009049773755656089, 0.0009049773755656061,
+      -0.0010416666666666638, -0.0029017857142857087, -0.0014048451548451548, 0.0016207750582750559,
+      0.0007639419404125296, -0.0006252785204991082, -8.862181849798287e-05, 0.00011144766611098006,
+      -2.2267679001423987e-05, 1.3821318000884826e-06, 0.005511849261849256, 0.011658046814296797,
+      0.006424182435211848, -0.0004046760021024716, -0.0004761384985843233, 0.0001750788878304337,
+      -2.9562263501888545e-05, 1.8812349501180315e-06, -0.011857627666451159, -0.01911136249371539,
+      -0.007499329016356862, -3.274589187902494e-05, 0.00019933411961276036, -1.3514177600867935e-05,
+      0.010683760683760665, 0.013461538461538426, 0.002567693744164339, -0.0002100840336134367,
+      -0.003361344537815122, -0.0033613445378151384, 0.3333333333333338, -0.1666666666666669,
+      0.49999999999999944, -0.3333333333333338, 0.1666666666666669, -0.49999999999999944,
+      0.3333333333333324, -0.16666666666666632, 0.49999999999999745, -0.3333333333333324,
+      0.16666666666666632, -0.49999999999999745, -0.6666666666666675, -0.16666666666666663,
+      0.49999999999999967, 0.6666666666666675, 0.16666666666666663, -0.49999999999999967,
+      0.3333333333333338, -0.1666666666666669, 0.49999999999999944, -0.3333333333333324,
+      0.16666666666666632, -0.49999999999999745, 0.5, 0.4999999999999996,
+      -0.041666666666666706, -0.01666666666666672, 0.025000000000000015, 0.3499999999999998,
+      -0.1500000000000003, 0.49999999999999895, 0.041666666666666706, 0.01666666666666672,
+      -0.025000000000000015, -0.3499999999999998, 0.1500000000000003, -0.49999999999999895,
+      -0.041666666666666484, -0.16666666666666616, 0.12499999999999967, 0.1999999999999992,
+      -0.29999999999999927, 0.24999999999999906, 0.041666666666666484, 0.16666666666666616,
+      -0.12499999999999967, -0.1999999999999992, 0.29999999999999927, -0.24999999999999906,
+      0.08333333333333329, -0.016666666666666514, -0.3499999999999998, 0.05000000000000012,
+      -0.4500000000000002, -0.24999999999999983, -0.08333333333333329, 0.016666666666666514,
+      0.3499999999999998, -0.05000000000000012, 0.4500000000000002, 0.24999999999999983,
+      -0.0833333333333334, 0.06666666666666672, -0.01666666666666676, 0.16666666666666655,
+      0.08333333333333316, 0.03333333333333329, -0.04999999999999981, 0.09999999999999944,
+      0.09999999999999966, -0.16666666666666682, 0.0166666666666666, 0.06031746031746029,
+      -0.011904761904761696, -0.1833333333333327, -0.14761904761904754, 0.035714285714285705,
+      0.49206349206349215, -0.11904761904761975, 0.5000000000000004, 0.16666666666666605,
+      -0.08333333333333293, -0.1349206349206344, 0.10119047619047555, 0.11666666666666563,
+      0.259523809523809, -0.23214285714285682, -0.3055555555555542, 0.20833333333333284,
+      -0.12499999999999949, -0.18333333333333315, 0.09841269841269851, 0.26785714285714274,
+      -0.18333333333333293, -0.14761904761904787, 0.4107142857142862, -0.24603174603174632,
+      0.267857142857143, 0.12499999999999961, -0.06666666666666667, 0.02857142857142862,
+      -0.004761904761904861, 0.09999999999999985, 0.016666666666666607, 0.00476190476190474,
+      -0.011904761904761854, -0.01666666666666659, 0.0071428571428571236, 0.023809523809523774,
+      -0.011904761904761856, -0.01190476190476184, 0.016666666666666684, -0.011904761904761888,
+      0.004761904761904745, -0.02380952380952379, -0.023809523809523784, -0.022916666666666707,
+      0.02083333333333324, 0.017857142857142884, -0.02242063492063488, 0.003472222222222222,
+      -0.3374999999999996, -0.06294642857142867, 0.10892857142857129, -0.015624999999999776,
+      -0.25892857142857095, -0.22420634920634888, 0.03472222222222213, 0.5527777777777775,
+      -0.09722222222222338, 0.49999999999999944, 0.022916666666666707, -0.02083333333333324,
+      -0.017857142857142884, 0.02242063492063488, -0.003472222222222222, 0.3374999999999996,
+      0.06294642857142867, -0.10892857142857129, 0.015624999999999776, 0.25892857142857095,
+      0.22420634920634888, -0.03472222222222213, -0.5527777777777775, 0.09722222222222338,
+      -0.49999999999999944, -0.02291666666666661, 0.15833333333333263, -0.10133928571428528,
+      -0.10376984126984064, 0.08506944444444405, -0.19999999999999873, 0.11584821428571368,
+      0.2392857142857139, -0.19531249999999958, 0.039062500000000104, -0.30555555555555425,
+      0.18663194444444445, 0.2597222222222206, -0.12152777777777797, 0.06249999999999959,
+      0.02291666666666661, -0.15833333333333263, 0.10133928571428528, 0.10376984126984064,
+      -0.08506944444444405, 0.19999999999999873, -0.11584821428571368, -0.2392857142857139,
+      0.19531249999999958, -0.039062500000000104, 0.30555555555555425, -0.18663194444444445,
+      -0.2597222222222206, 0.12152777777777797, -0.06249999999999959, 0.04583333333333336,
+      0.02083333333333322, 0.1607142857142857, -0.12331349206349186, -0.21527777777777754,
+      -0.062499999999999584, 0.29464285714285715, 0.10089285714285728, -0.3749999999999994,
+      0.026785714285713805, 0.2802579365079369, -0.277777777777778, 0.23541666666666677,
+      -0.14583333333333343, -0.06249999999999959, -0.04583333333333336, -0.02083333333333322,
+      -0.1607142857142857, 0.12331349206349186, 0.21527777777777754, 0.062499999999999584,
+      -0.29464285714285715, -0.10089285714285728, 0.3749999999999994, -0.026785714285713805,
+      -0.2802579365079369, 0.277777777777778, -0.23541666666666677, 0.14583333333333343,
+      0.06249999999999959, 0.025, -0.014285714285714318, -0.0023809523809523547,
+      0.003174603174603131, -0.00039682539682534657, -0.11011904761904746, 0.007936507936508031,
+      -0.0009920634920636518, 0.08571428571428563, -0.012499999999999975, -0.003571428571428568,
+      0.018749999999999906, 0.0013888888888888885, -0.008432539682539663, -0.010714285714285659,
+      -0.02633928571428563, 0.0017857142857142837, 0.017410714285714227, 0.011160714285714218,
+      -0.0009920634920635137, -0.01215277777777773, 0.004166666666666641, 0.004166666666666582,
+      -0.004761904761904762, 0.0011904761904761917, 0.003968253968253964, -0.0019841269841269814,
+      -0.00476190476190475, -0.0017857142857142854, 0.0023809523809523764, -0.0005952380952380928,
+      -0.0029761904761904704, 0.0039682539682539585, 0.006944444444444441, 0.0055555555555555506,
+      0.005555555555555542, 0.009523809523809507, 0.0035714285714285635, -0.00476190476190475,
+      0.001190476190476183, -0.011111111111111089, -0.011111111111111094, 0.03333333333333335,
+      0.05244047619047614, -0.02821428571428561, -0.030158730158730194, 0.015458152958152997,
+      -0.0017045454545454367, -0.031607142857142834, 0.08892857142857144, 0.07142857142857167,
+      -0.04399350649350655, 0.005113636363636339, -0.457142857142857, -0.15158730158730133,
+      0.12049062049062001, -0.013636363636363209, -0.30555555555555525, -0.2737373737373742,
+      0.03181818181818195, 0.5896103896103885, -0.08181818181818322, 0.49999999999999956,
+      -0.03333333333333322, 0.010416666666666578, 0.13214285714285637, -0.10396825396825352,
+      -0.08156565656565631, 0.07329545454545416, 0.09446428571428524, -0.24482142857142772,
+      0.131428571428571, 0.21241883116883023, -0.17079545454545358, 0.19732142857142757,
+      0.017460317460317513, -0.2925234487734474, 0.17215909090909046, -0.1655555555555551,
+      0.27058080808080726, -0.12011363636363685, -0.18620129870129765, 0.0664772727272726,
+      -0.031249999999999716, -0.03160714285714284, -0.05928571428571419, -0.1170634920634918,
+      0.12709235209235198, 0.17897727272727268, -0.03160714285714284, 0.0889285714285713,
+      -0.3535714285714292, -0.043993506493506376, 0.34261363636363606, 0.14821428571428533,
+      -0.11706349206349179, -0.26884920634920606, 0.28124999999999994, 0.11944444444444467,
+      -0.27373737373737356, 0.1630681818181822, -0.1759740259740256, 0.07670454545454566,
+      0.031249999999999865, 0.04642857142857134, -0.007142857142857157, -0.007142857142857091,
+      0.0032467532467531906, -0.00032467532467529144, -0.12777777777777774, -0.00505050505050491,
+      0.0005050505050503398, 0.07936507936507921, -0.01160714285714281, -0.0011904761904761856,
+      0.016865079365079274, -0.00018037518037517764, -0.0066287878787878625, 0.011607142857142792,
+      -0.001785714285714274, -0.026785714285714222, 0.000811688311688303, 0.0142045454545454,
+      0.00297619047619047, 0.01686507936507929, 0.002254689754689728, -0.011634199134199117,
+      -0.006944444444444405, -0.0012626262626262129, 0.005681818181818108, -0.001623376623376585,
+      -0.001623376623376567, -0.005952380952380958, 0.0005952380952380931, 0.006547619047619046,
+      -0.0031746031746031638, -0.0019300144300144336, 0.0012445887445887433, -0.0017857142857142785,
+      0.002678571428571428, 0.0014285714285714266, -0.0023538961038961008, 0.0006818181818181801,
+      0.010416666666666638, 0.011111111111111084, -0.002660533910533902, -0.0033549783549783538,
+      0.0033333333333333296, -0.000757575757575756, -0.004090909090909083, -0.001948051948051951,
+      -0.0019480519480519676, -0.0007936507936507934, 0.00039682539682539623, 0.0003968253968253962,
+      -0.0005291005291005275, 0.00022847522847522744, -3.607503607503563e-05, 0.0011904761904761871,
+      -0.0017857142857142844, -0.0009523809523809513, 0.0015692640692640666, -0.00045454545454545324,
+      -0.0009920634920634898, -0.0005291005291005286, 0.00039081289081288866, -7.215007215007135e-05,
+      -0.002222222222222218, 0.0005050505050505049, 0.002727272727272717, 0.0025974025974025844,
+      0.0025974025974025883, -0.005952380952380957, -0.0011904761904761915, 0.004761904761904758,
+      -0.0007936507936507892, -0.0006854256854256892, 0.0001082251082251079, 0.01488095238095236,
+      0.013492063492063468, -0.0011724386724386632, 0.0002164502164502099, -0.007792207792207774,
+      -0.007792207792207791, 0.009548611111111086, 0.012152777777777794, -0.026165674603174573,
+      -0.003306878306878357, 0.01843960437710436, -0.006422397047397018, 0.0006009615384614963,
+      0.07812499999999976, 0.16443452380952361, -0.017857142857142645, -0.0752840909090911,
+      0.026478729603729503, -0.002403846153846024, -0.030753968253968037, 0.1474867724867722,
+      0.12205387205387211, -0.05137917637917635, 0.004807692307692163, -0.5416666666666662,
+      -0.22537878787878735, 0.11988474488474488, -0.011217948717948368, -0.337121212121211,
+      -0.30827505827505786, 0.028846153846154018, 0.6146723646723635, -0.07051282051282197,
+      0.4999999999999994, -0.009548611111111086, -0.012152777777777794, 0.026165674603174573,
+      0.003306878306878357, -0.01843960437710436, 0.006422397047397018, -0.0006009615384614963,
+      -0.07812499999999976, -0.16443452380952361, 0.017857142857142645, 0.0752840909090911,
+      -0.026478729603729503, 0.002403846153846024, 0.030753968253968037, -0.1474867724867722,
+      -0.12205387205387211, 0.05137917637917635, -0.004807692307692163, 0.5416666666666662,
+      0.22537878787878735, -0.11988474488474488, 0.011217948717948368, 0.337121212121211,
+      0.30827505827505786, -0.028846153846154018, -0.6146723646723635, 0.07051282051282197,
+      -0.4999999999999994, 0.009548611111111051, -0.045138888888888735, 0.035838293650793544,
+      0.10383597883597823, -0.0994581228956225, -0.06582653457653435, 0.06430288461538429,
+      0.020833333333333114, 0.07142857142857124, -0.25357142857142745, 0.14488636363636315,
+      0.18703379953379864, -0.1526442307692299, -0.18576388888888817, 0.2546296296296283,
+      -0.012889309764309943, -0.2748640248640233, 0.16105769230769165, -0.09166666666666587,
+      -0.15080492424242375, 0.27363862988862875, -0.1191907051282052, 0.2104640151515141,
+      -0.20359848484848445, 0.07031250000000029, 0.12215099715099625, -0.035256410256410256,
+      0.015624999999999521, -0.009548611111111051, 0.045138888888888735, -0.035838293650793544,
+      -0.10383597883597823, 0.0994581228956225, 0.06582653457653435, -0.06430288461538429,
+      -0.020833333333333114, -0.07142857142857124, 0.25357142857142745, -0.14488636363636315,
+      -0.18703379953379864, 0.1526442307692299, 0.18576388888888817, -0.2546296296296283,
+      0.012889309764309943, 0.2748640248640233, -0.16105769230769165, 0.09166666666666587,
+      0.15080492424242375, -0.27363862988862875, 0.1191907051282052, -0.2104640151515141,
+      0.20359848484848445, -0.07031250000000029, -0.12215099715099625, 0.035256410256410256,
+      -0.015624999999999521, -0.01909722222222224, 0.01215277777777779, 0.03794642857142846,
+      0.07208994708994705, 0.07865109427609412, -0.12202554390054368, -0.1526442307692307,
+      -0.036458333333333426, -0.02157738095238106, -0.03928571428571423, 0.36505681818181784,
+      -0.003853438228438302, -0.3137019230769225, 0.09747023809523787, -0.2294973544973544,
+      0.20807028619528614, 0.23762869075369078, -0.28004807692307626, -0.0916666666666663,
+      -0.07623106060606111, 0.2907205063455059, -0.1766826923076923, -0.18229166666666638,
+      0.21193910256410262, -0.09014423076923123, 0.1177439458689455, -0.039663461538461835,
+      -0.015624999999999669, 0.01909722222222224, -0.01215277777777779, -0.03794642857142846,
+      -0.07208994708994705, -0.07865109427609412, 0.12202554390054368, 0.1526442307692307,
+      0.036458333333333426, 0.02157738095238106, 0.03928571428571423, -0.36505681818181784,
+      0.003853438228438302, 0.3137019230769225, -0.09747023809523787, 0.2294973544973544,
+      -0.20807028619528614, -0.23762869075369078, 0.28004807692307626, 0.0916666666666663,
+      0.07623106060606111, -0.2907205063455059, 0.1766826923076923, 0.18229166666666638,
+      -0.21193910256410262, 0.09014423076923123, -0.1177439458689455, 0.039663461538461835,
+      0.015624999999999669, -0.005208333333333352, -0.0017857142857142766, 0.0049107142857142795,
+      -0.0003607503607503581, -0.0013753607503607542, 0.000437062937062939, -3.642191142191218e-05,
+      0.06696428571428568, 0.010461760461760393, -0.00698953823953816, 0.0017482517482516659,
+      -0.0001456876456875908, -0.13852813852813836, -0.013986013986013785, 0.001165501165500959,
+      0.0757575757575758, 0.002604166666666661, -0.0004464285714285653, -0.011979166666666612,
+      0.0012626262626262517, 0.014689303751803698, -0.0009833916083916022, -0.005481497668997658,
+      -0.0013392857142857026, 0.014285714285714233, 0.0006493506493506522, -0.026244588744588643,
+      0.000895979020979013, 0.012164918414918366, -0.009672619047618996, -0.004148629148629124,
+      0.019728535353535272, 0.003168706293706247, -0.011035839160839136, 0.0015151515151515024,
+      -0.008759469696969644, -0.0038582944832944313, 0.006416326728826668, 0.004024621212121179,
+      0.0014204545454545503, -0.0026041666666665876, 0.0006677350427350214, 0.0006677350427350202,
+      0.004166666666666668, -0.0017857142857142835, -0.004689754689754679, 0.003156565656565654,
+      0.001019813519813521, -0.0008741258741258745, 0.004166666666666657, 0.0026785714285714277,
+      -0.004329004329004328, -0.00018939393939393918, 0.0019855144855144826, -0.0006660006660006614,
+      0.004464285714285707, -0.004689754689754683, -0.00861291486291485, 0.0024142524142524084,
+      0.0018731268731268724, -0.005050505050505043, -0.007702020202020189, 0.0003108003108003109,
+      0.002962315462315453, -0.0024350649350649363, -0.00037462537462537663, 0.002060439560439565,
+      0.0007631257631257641, 0.0007631257631257672, -0.0002976190476190472, 0.0005952380952380946,
+      -0.0002976190476190474, -0.0003607503607503601, 0.0005321067821067814, -0.000253912753912753,
+      4.370629370629355e-05, -0.002976190476190468, -0.0017857142857142848, 0.002380952380952379,
+      5.411255411255605e-05, -0.0008616383616383591, 0.00027472527472527207, -0.000595238095238094,
+      0.00028860028860028795, 0.00045093795093794964, -0.000357975357975357, 7.492507492507456e-05,
+      0.004040404040404035, 0.005176767676767666, -5.827505827505696e-05, -0.0011946386946386906,
+      0.0019480519480519398, 0.00029970029970030127, -0.0016483516483516431, -0.0009157509157509131,
+      -0.0009157509157509147, 0.0002976190476190477, 0.001785714285714286, -0.0002976190476190481,
+      -0.0016233766233766191, 0.0004599567099567099, 0.00025391275391275467, -4.370629370629389e-05,
+      0.0005952380952380936, 0.000892857142857141, -0.00028138528138528036, -0.0003517316017316013,
+      0.00020229770229770208, -2.497502497502469e-05, 0.002083333333333328, -0.0022727272727272717,
+      -0.003923160173160165, 0.0003579753579753565, -7.49250749250729e-05, -0.00217171717171717,
+      -0.002398989898989892, -0.00019813519813519732, 2.913752913752914e-05, -0.001948051948051944,
+      -0.00029970029970029867, 0.0016483516483516488, 0.0018315018315018265, 0.0018315018315018254,
+      -0.00833333333333332, -0.005357142857142852, 0.004112554112554109, 0.0003787878787878832,
+      -0.0006743256743256716, 8.325008325007784e-05, 0.014646464646464628, 0.015404040404040375,
+      0.0006604506604506646, -9.712509712509763e-05, -0.0061050061050060885, -0.006105006105006095,
+      -0.004464285714285732, -0.023660714285714268, -0.021428571428571394, 0.03016774891774881,
+      0.012716450216450284, -0.015500124875124864, 0.0038856976356975905, -0.00029761904761899723,
+      0.017410714285714234, 0.024107142857142886, -0.07751623376623384, -0.028814935064935234,
+      0.04312874625374628, -0.011376123876123792, 0.0008928571428570402, 0.10714285714285718,
+      0.262175324675324, 0.0243506493506496, -0.10104181532752972, 0.02751415251415231,
+      -0.0021258503401358586, -0.028409090909091172, 0.193181818181818, 0.1643356643356648,
+      -0.05308857808857821, 0.0041666666666663734, -0.6038961038961019, -0.2848223205366055,
+      0.11508491508491499, -0.009183673469387702, -0.3598901098901092, -0.33369963369963346,
+      0.02619047619047688, 0.6329004329004324, -0.06190476190476342, 0.4999999999999998,
+      0.004464285714285695, -0.0031249999999999963, -0.0366071428571427, 0.046604437229436996,
+      0.08049242424242384, -0.09229832667332628, -0.05446012321012295, 0.0572172619047618,
+      -0.04419642857142829, 0.0629464285714283, 0.03210227272727266, -0.24208603896103775,
+      0.1528511666904517, 0.1647945804195796, -0.13836096938775436, 0.03794642857142859,
+      -0.18540313852813783, 0.28984036796536694, -0.04288791565577288, -0.2558014901764889,
+      0.15183886054421689, 0.2273674242424234, -0.15530303030302958, -0.12589597902097804,
+      0.27135780885780714, -0.11822916666666677, -0.0365259740259742, 0.21315514842300476,
+      -0.2162337662337654, 0.07375637755102064, -0.19792484301412774, 0.13902243589743565,
+      -0.03916879251700716, -0.07587932900432846, 0.018377976190475886, -0.0078124999999997545,
+      0.01741071428571424, -0.01607142857142854, -0.05296266233766219, -0.06574675324675312,
+      -0.050808566433566175, 0.11376123876123881, 0.13281250000000006, 0.017410714285714182,
+      0.024107142857143115, 0.05969967532467535, -0.028814935064934995, -0.34691246253746205,
+      0.039816433566433336, 0.2881696428571427, 0.04017857142857172, -0.05296266233766232,
+      0.24959415584415598, -0.280453921078921, -0.19908216783216762, 0.27566964285714246,
+      -0.16562499999999974, 0.19318181818181818, 0.012652972027972003, -0.29198717948717834,
+      0.18697916666666653, -0.019480519480520132, 0.17883678821178842, -0.2388986013986012,
+      0.10245535714285749, 0.18183379120879145, -0.14599358974359006, 0.048288690476191005,
+      -0.07394480519480563, 0.02031250000000007, 0.0078124999999996435, -0.012499999999999987,
+      -0.010064935064935058, 0.0069805194805194655, 0.0017482517482517556, -0.0022352647352647296,
+      0.0005244755244755152, -3.746253746253361e-05, 0.0832070707070706, 0.027874902874902772,
+      -0.004390054390054303, 0.0004079254079253473, -2.9137529137487928e-05, -0.14590964590964547,
+      -0.02051282051282029, 0.0014652014652012672, 0.07342657342657355, 0.0031249999999999893,
+      -0.001677489177489171, -0.01127344877344872, 0.002962315462315447, 0.012711247086247041,
+      -0.0013986013986013884, -0.0046765734265734205, -0.003124999999999983, -0.002516233766233753,
+      0.016801948051948002, 0.00043706293706294167, -0.025215409590409486, 0.001245629370629355,
+      0.010704920079920058, 0.00419372294372292, -0.011273448773448724, -0.0075271950271949785,
+      0.021566974691974626, 0.0031687062937062736, -0.010458291708291706, 0.005744949494949462,
+      0.006968725718725668, -0.010686188811188772, -0.005099067599067513, 0.0068108974358974065,
+      -0.0028409090909090728, 0.0038555194805194428, 0.0034090909090908786, -0.003287337662337577,
+      -0.002232142857142837, -0.0010416666666666732, 0.0011904761904761362, -0.00028409090909088663,
+      -0.0002840909090909021, 0.002033730158730161, -0.0007936507936507927, -0.004153138528138522,
+      0.003138528138528136, 0.002918956043956043, -0.002747252747252745, -0.0005511849261849278,
+      0.0006507381507381533, 0.0023809523809523747, -0.00357142857142857, -0.0024350649350649333,
+      0.004974192474192461, -0.0007492507492507497, -0.001587995337995334, 0.0006181318681318655,
+      -0.004734848484848469, -0.007575757575757565, 0.004526723276723273, 0.006243756243756231,
+      -0.0022338772338772266, -0.001110001110001112, -0.005681818181818167, 0.0006191724941724988,
+      0.007964257964257962, -0.000526903651903653, -0.002190170940170935, 0.0015557359307359262,
+      0.004245754245754249, 0.0008231351981352081, -0.0018668831168831205, 0.001526251526251521,
+      0.000534188034188032, -0.0009920634920634944, -0.00031565656565656894, -0.0003156565656565813,
+      0.0006944444444444443, -0.00019841269841269792, -0.0007846320346320338, 0.0007936507936507914,
+      6.93750693751494e-07, -0.0004037629037629034, 0.00023656898656898538, -4.4400044400043655e-05,
+      -0.0005952380952380927, 0.001298701298701299, 0.0009956709956709952, -0.001615051615051612,
+      5.030683602112164e-05, 0.0005744255744255729, -0.00019266447837876273, 0.0005411255411255399,
+      0.0007936507936507928, -0.00043012543012542855, -0.0003080253080253086, 0.00030525030525030433,
+      -6.937506937506814e-05, 0.0023232323232323204, -0.0003690753690753685, -0.0032750582750582726,
+      5.8275058275057536e-05, 0.0006410256410256392, -0.0017940392940392854, -0.003396603396603385,
+      -0.0005286380286380286, 0.0010739260739260697, -0.0013082155939298766, -0.00045787545787545733,
+      0.0008503401360544199, 0.0003607503607503599, 0.0003607503607503581, 0.0022321428571428583,
+      -5.952380952380879e-05, -0.00258928571428571, 0.000901875901875899, 0.0010132228882228896,
+      -0.0003642191142191146, -0.00015047452547452663, 2.7472527472528272e-05, -0.00017857142857142852,
+      -0.0004626623376623382, -0.0005194805194805192, 0.00031530969030969, 0.0003045169116597685,
+      -0.00021728271728271698, 2.88996717568141e-05, -0.005641233766233756, -0.006240981240981229,
+      0.0015938922188922155, 0.0019367537224680065, -0.00021228771228771088, 4.459825888397146e-05,
+      -0.0012121212121212113, 0.00033508158508158554, 0.0017407592407592384, 0.00016608391608391546,
+      -2.747252747252778e-05, 0.0031093906093905993, 0.004227914942200652, 0.0004570429570429627,
+      -0.0006614813757670891, 0.00156985871271585, 0.0005494505494505445, -0.0010204081632653051,
+      -0.0006493506493506515, -0.0006493506493506602, 0.000694444444444445, -0.00019841269841269814,
+      -0.0005140692640692639, 0.00043290043290043154, -4.786879786879741e-05, -7.07625707625708e-05,
+      2.8443778443778037e-05, -2.7750027750023993e-06, -0.0005952380952380932, 0.0017045454545454532,
+      0.0012121212121212113, -0.0013965201465201435, -3.5321821036107004e-05, 0.00024142524142524096,
+      -3.211074639645975e-05, -0.00013528138528138571, 0.00043290043290043333, 0.0001769064269064271,
+      -0.0002842395699538551, 9.712509712509694e-05, -9.910724196437825e-06, 0.0028282828282828235,
+      -0.0007090132090132092, -0.0037523587523587486, -0.0001845376845376843, 3.0525030525031054e-05,
+      -0.002231102231102221, -0.0027543884686741737, -0.00046620046620046663, 5.70857713714847e-05,
+      -0.001744287458573167, -0.0006105006105006095, 0.0011337868480725615, 0.001443001443001439,
+      0.0014430014430014374, 0.002033730158730166, 0.0015873015873015875, -0.0017721861471861468,
+      -0.0009199134199134174, 0.0006816100566100572, 0.00016650016650016664, -9.955322455322488e-05,
+      9.712509712509311e-06, -0.010687229437229424, -0.011634199134199113, 0.00026015651015650444,
+      0.0008325008325008362, -0.00033993783993783614, 3.4687534687531374e-05, 0.013653013653013616,
+      0.015484515484515458, 0.0016317016317016458, -0.00019980019980019674, -0.005050505050505042,
+      -0.005050505050505043, -0.002929687499999971, -0.00898437499999999, -0.00019531250000000738,
+      0.022135416666666588, -0.006908781322843757, -0.013043597027972061, 0.008328325320512803,
+      -0.001698010935143208, 0.00011488970588226893, -0.00820312499999996, -0.06386718750000002,
+      -0.08984374999999997, 0.050023218968531215, 0.045440887237762434, -0.03185847355769231,
+      0.006472709276017856, -0.00043083639705864517, 0.01953124999999991, 0.028645833333333103,
+      -0.12201990717615681, -0.06159465534465561, 0.05659054487179491, -0.012128649536737623,
+      0.0008206407563023714, 0.12760416666666652, 0.34263913170163074, 0.07320804195804231,
+      -0.11449318910256437, 0.025610388386123634, -0.0017233455882354426, -0.025989635364635392,
+      0.22898976023975995, 0.1990384615384619, -0.0523957659987076, 0.003545168067226978,
+      -0.6514423076923057, -0.3329527243589731, 0.10898378582202138, -0.00758272058823578,
+      -0.37708333333333316, -0.3531862745098026, 0.02389705882353003, 0.646776018099547,
+      -0.05514705882353011, 0.49999999999999967, 0.002929687499999971, 0.00898437499999999,
+      0.00019531250000000738, -0.022135416666666588, 0.006908781322843757, 0.013043597027972061,
+      -0.008328325320512803, 0.001698010935143208, -0.00011488970588226893, 0.00820312499999996,
+      0.06386718750000002, 0.08984374999999997, -0.050023218968531215, -0.045440887237762434,
+      0.03185847355769231, -0.006472709276017856, 0.00043083639705864517, -0.01953124999999991,
+      -0.028645833333333103, 0.12201990717615681, 0.06159465534465561, -0.05659054487179491,
+      0.012128649536737623, -0.0008206407563023714, -0.12760416666666652, -0.34263913170163074,
+      -0.07320804195804231, 0.11449318910256437, -0.025610388386123634, 0.0017233455882354426,
+      0.025989635364635392, -0.22898976023975995, -0.1990384615384619, 0.0523957659987076,
+      -0.003545168067226978, 0.6514423076923057, 0.3329527243589731, -0.10898378582202138,
+      0.00758272058823578, 0.37708333333333316, 0.3531862745098026, -0.02389705882353003,
+      -0.646776018099547, 0.05514705882353011, -0.49999999999999967, -0.0029296874999999926,
+      0.00859375000000003, -0.01484375000000002, -0.022135416666666494, 0.0475488053613051,
+      0.06307364510489462, -0.08463291266025603, -0.04605427507541472, 0.05149931066176454,
+      0.009374999999999929, -0.04189453124999969, 0.08593749999999961, -0.00534377731643347,
+      -0.22116945554445455, 0.15580491286057582, 0.1458220547834514, -0.1266874425551466,
+      0.05615234374999953, -0.015624999999999828, -0.15896944852022904, 0.3056865009989994,
+      -0.06890712640224328, -0.23689836511527568, 0.14383267955619677, -0.13671874999999944,
+      0.2618621612762227, -0.210418487762237, -0.09658829126602471, 0.2654700461915521,
+      -0.11705824908088194, -0.17964164741508362, 0.013943088161837713, 0.20563025841346055,
+      -0.22471138695862838, 0.07671965270483189, 0.12714629120879128, -0.21315667568108923,
+      0.15369128420598965, -0.04288976332720633, 0.16014811197916654, -0.08916973039215705,
+      0.021189970128676464, 0.045434459841628624, -0.009478400735293845, 0.0039062499999994904,
+      0.0029296874999999926, -0.00859375000000003, 0.01484375000000002, 0.022135416666666494,
+      -0.0475488053613051, -0.06307364510489462, 0.08463291266025603, 0.04605427507541472,
+      -0.05149931066176454, -0.009374999999999929, 0.04189453124999969, -0.08593749999999961,
+      0.00534377731643347, 0.22116945554445455, -0.15580491286057582, -0.1458220547834514,
+      0.1266874425551466, -0.05615234374999953, 0.015624999999999828, 0.15896944852022904,
+      -0.3056865009989994, 0.06890712640224328, 0.23689836511527568, -0.14383267955619677,
+      0.13671874999999944, -0.2618621612762227, 0.210418487762237, 0.09658829126602471,
+      -0.2654700461915521, 0.11705824908088194, 0.17964164741508362, -0.013943088161837713,
+      -0.20563025841346055, 0.22471138695862838, -0.07671965270483189, -0.12714629120879128,
+      0.21315667568108923, -0.15369128420598965, 0.04288976332720633, -0.16014811197916654,
+      0.08916973039215705, -0.021189970128676464, -0.045434459841628624, 0.009478400735293845,
+      -0.0039062499999994904, 0.005859374999999991, -0.00898437499999999, -0.012890625000000017,
+      0.02539062499999992, 0.06196732954545444, 0.05145050262237741, 0.032321714743589705,
+      -0.10485217524509796, -0.11741727941176468, 0.026953125000000074, -0.019921875000000054,
+      -0.04179687500000009, -0.060710773601398475, 0.08623290771728265, 0.31436298076923014,
+      -0.06531277775533285, -0.26573988970588225, -0.005859374999999967, 0.012369791666666638,
+      -0.023625463078588125, -0.2228299044705293, 0.32912660256410264, 0.15979495764651971,
+      -0.26925223214285654, -0.09752604166666659, 0.18108519085081562, -0.27081785402097897,
+      0.05714142628205136, 0.2822943179675708, -0.19439338235294057, 0.15112036401098822,
+      -0.061233688186812615, -0.15531850961538446, 0.2570667269311565, -0.11344537815126081,
+      0.10849502060439627, -0.20008012820512838, 0.1714384612017887, -0.056870404411765545,
+      -0.1513020833333336, 0.09381510416666716, -0.02539062500000042, 0.04457278704751069,
+      -0.010340073529411355, -0.003906249999998983, -0.005859374999999991, 0.00898437499999999,
+      0.012890625000000017, -0.02539062499999992, -0.06196732954545444, -0.05145050262237741,
+      -0.032321714743589705, 0.10485217524509796, 0.11741727941176468, -0.026953125000000074,
+      0.019921875000000054, 0.04179687500000009, 0.060710773601398475, -0.08623290771728265,
+      -0.31436298076923014, 0.06531277775533285, 0.26573988970588225, 0.005859374999999967,
+      -0.012369791666666638, 0.023625463078588125, 0.2228299044705293, -0.32912660256410264,
+      -0.15979495764651971, 0.26925223214285654, 0.09752604166666659, -0.18108519085081562,
+      0.27081785402097897, -0.05714142628205136, -0.2822943179675708, 0.19439338235294057,
+      -0.15112036401098822, 0.061233688186812615, 0.15531850961538446, -0.2570667269311565,
+      0.11344537815126081, -0.10849502060439627, 0.20008012820512838, -0.1714384612017887,
+      0.056870404411765545, 0.1513020833333336, -0.09381510416666716, 0.02539062500000042,
+      -0.04457278704751069, 0.010340073529411355, 0.003906249999998983, 0.0005208333333333413,
+      0.002083333333333326, -0.0005208333333333354, -0.002253302253302247, 0.0009044774669774649,
+      0.0005973193473193451, -0.0003969988344988313, 7.541478129713133e-05, -4.7134238310711535e-06,
+      -0.018229166666666664, -0.021513209013208946, 0.0025018384393384234, 0.0035797535797535826,
+      -0.0018484120046619958, 0.0003366731307907714, -2.104207067442687e-05, 0.09590409590409561,
+      0.04315684315684299, -0.0009178321678320517, -0.0005817711700065143, 3.636069812542802e-05,
+      -0.15132575757575756, -0.025490196078431067, 0.0015931372549017099, 0.07179487179487182,
+      -0.0002604166666666673, 0.0005208333333333307, 0.0031249999999999893, -0.0029708139083138916,
+      -0.009931041181041139, 0.003944493006992988, 0.011034928613053564, -0.0016037424585218644,
+      -0.004077700791855197, 0.0015624999999999875, -0.0042968749999999865, -0.002458479020979016,
+      0.018534200174825086, -0.0008038836163836116, -0.023905293924825082, 0.0016185560762766542,
+      0.009586662188914016, 0.0019531249999999911, 0.006659139471639438, -0.013884769744144702,
+      -0.008592969530469476, 0.02270564721736589, 0.002788495205774608, -0.009919337326276634,
+      -0.005736451048951017, 0.005162805944055928, 0.010871940559440485, -0.01264250072843817,
+      -0.005593655731523299, 0.007021528563348404, -0.002142388861138843, -0.0062890234765234365,
+      0.004371995192307655, 0.004722345669036796, -0.003796284138655381, 0.0026614010989010795,
+      -0.001379707532051262, -0.0024127679918120944, 0.0016283406391402102, 0.0012044270833333145,
+      0.0006587009803921689, -0.0005457261029411347, 0.00012372737556559288, 0.0001237273755656104,
+      -0.0019209956709956707, 0.0016639610389610382, 0.003166971916971912, -0.0035502691752691724,
+      -0.0016462703962703956, 0.002283653846153844, 0.0002943747429041556, -0.000503265117235707,
+      -0.0019209956709956666, -0.002495941558441553, 0.004755661005661002, 0.001032821345321345,
+      -0.004776473526473516, 0.0013230259324009278, 0.001240120173943705, -0.0005615937371452078,
+      -0.004159902597402584, 0.0031669719169719127, 0.007930437617937606, -0.005109473859473856,
+      -0.004356971153846146, 0.00202646618087794, 0.0006704003716871365, 0.0015782828282828254,
+      0.007842851592851577, -0.0001699689199689209, -0.007295915889665867, 0.0007888557520910447,
+      0.0016502339572192508, 0.004495504495504481, 0.0018169330669330652, -0.005031687062937062,
+      -0.0007255612035023906, 0.0016275544308632522, 7.631257631258709e-06, -0.0020198985042735014,
+      -0.0009864522732169762, 0.0010410774886877904, -0.0008877840909090964, -0.00041778074866310203,
+      0.00047000334224599823, 0.0001349753187988457, 0.00013497531879885365, 0.0003968253968253965,
+      -0.0007936507936507928, 0.0003336940836940836, 0.0007691382691382673, -0.0010186572686572662,
+      0.0002608502608502601, 0.00027437839937839904, -0.00020767631061748668, 4.24208144796378e-05,
+      0.0008116883116883109, 0.0006764069264069257, -0.0011738261738261726, -0.00048493173493173474,
+      0.0010947385947385918, -3.486097236097211e-05, -0.00042922763510998816, 0.0001467588783765253,
+      0.0003832972582972574, -0.0001549376549376554, -0.0006908600658600652, 0.000409312909312908,
+      0.00023457445332445283, -0.00026423739659033713, 6.312621202327026e-05, -0.001217301217301215,
+      -0.0030821030821030788, -1.9425019425019683e-05, 0.0021480833980833916, -8.150890503831666e-05,
+      -0.0003842154577448692, -0.002664002664002653, -0.0009240759240759188, 0.002904387279387271,
+      0.00042677910324969077, -0.0007376814362108443, 0.000381562881562879, 0.001766318172568169,
+      0.0006875613493260554, -0.0006971939416792334, 0.0007891414141414121, 0.00037136066547831,
+      -0.0004177807486631002, -0.00014997257644316255, -0.00014997257644316545, -0.00014880952380952426,
+      -0.0017045454545454538, 0.000744047619047619, 0.0019314019314019266, -0.00109577922077922,
+      -0.0005806693306693317, 0.0002716033966033968, 0.00010504201680672325, -1.983310806840226e-05,
+      -0.0007846320346320329, -0.0006899350649350643, 0.0007509157509157506, 0.0005692224442224432,
+      -0.0005103824746681878, -0.00019459706959706958, 0.00020032488519883498, -2.8464182875947225e-05,
+      -0.002042748917748915, 0.002306027306027301, 0.0045467924932210595, -0.0011880976166690435,
+      -0.0011909965034965048, 0.00016265247357684346, -3.246490904053893e-05, 0.0018881118881118849,
+      0.003192640692640685, 0.00011266511266511353, -0.0013330419580419547, -0.00011883541295306046,
+      2.234285322520698e-05, 0.0024805551591265797, 0.0006261595547309802, -0.002556818181818179,
+      -0.00036171811381895764, 0.00034070446360362055, -0.0012319030176172999, -0.002489697802197794,
+      -0.0006534665148110499, 0.0006043282697694465, -0.0010146103896103906, -0.00047746371275782885,
+      0.0005371466768525619, 0.0002570958453311398, 0.00025709584533114356, 0.00014880952380952412,
+      -0.00045995670995670993, 0.0002029220779220775, 0.00039960039960039906, -0.00043394105894105833,
+      8.116883116883095e-05, 6.764069264069259e-05, -3.207576736988488e-05, 3.3055180114004913e-06,
+      0.0029491341991341926, 0.0021103896103896102, -0.0022311022311022276, -0.0005702630702630705,
+      0.0009570786356500617, -2.757659007658796e-05, -0.00014281936550844228, 1.974128812364044e-05,
+      -0.000324675324675324, 2.4975024975024833e-05, -0.0001783930355358926, -0.00015876980162694376,
+      0.0002596361971361966, -9.881575007625376e-05, 1.0821636346846035e-05, -0.005069930069930063,
+      -0.00701590076590075, -0.0002927627927627936, 0.001740967365967361, 7.337433808022165e-05,
+      -1.4385124679242481e-05, -0.0014949336377907754, -0.0002782931354359903, 0.0016233766233766183,
+      0.00035762556770960023, -4.911055331223357e-05, 0.0024638060352346015, 0.0034913003663003582,
+      0.000606652917577287, -0.00042084141348847065, 0.0013528138528138478, 0.0006366182836770999,
+      -0.0007161955691367446, -0.0005141916906622809, -0.0005141916906622852, -0.000396825396825397,
+      -0.0008026695526695529, -1.3528138528138039e-05, 0.0007513320013320002, 0.0001612970362970355,
+      -0.00028513153513153494, -4.613442113442097e-05, 3.7421728598199487e-05, -3.856437679966949e-06,
+      0.0007846320346320327, -0.00019615800865800824, -0.0006514319014319006, 0.0004896145521145503,
+      1.4568764568764391e-05, -0.000110566516816516, 3.2443047148929225e-05, -2.678081722199441e-06,
+      -0.0011837121212121195, 0.001675407925407926, 0.003150495337995335, -8.32500832500828e-05,
+      -0.0002467150904650916, 0.00011528504175563, -1.2625242404653742e-05, 1.6187516187517645e-06,
+      0.0009340196840196831, 0.0007381507381507371, -0.00017199235949235883, 2.0472446943034455e-05,
+      -1.7853878147992939e-06, 0.0032051282051281937, 0.0005494505494505447, -0.0031302031302031237,
+      -0.0004172298289945371, 5.729564553093681e-05, -0.002136752136752129, -0.002798127798127788,
+      -0.0005985300102947142, 6.284565108094664e-05, -0.0015782828282828274, -0.0007427213309566231,
+      0.0008355614973262031, 0.0011997806115453128, 0.0011997806115453139, 0.003841991341991333,
+      0.004991883116883117, -0.000944888444888443, -0.0020656426906426897, 0.00048701298701298463,
+      0.00033143939393939613, -0.00011679496973614591, 9.641094199917614e-06, -0.011722999222999204,
+      -0.015685703185703156, -0.0031857031857031866, 0.0006968725718725696, -7.370080899492054e-05,
+      6.427396133279146e-06, 0.01257631257631254, 0.014957264957264915, 0.0021547080370609775,
+      -0.00022624434389139928, -0.004319210201563145, -0.00431921020156315, 0.001388888888888911,
+      0.007031249999999977, 0.016724537037036986, 0.00486111111111116, -0.02690972222222217,
+      -0.0006688479344730072, 0.013147702991453049, -0.005841503267973829, 0.000973494295378859,
+      -5.7108918128546934e-05, -0.004427083333333394, -0.019618055555555517, -0.003472222222222412,
+      0.06684027777777772, -0.0009849091880340265, -0.03618456196581211, 0.01687091503267967,
+      -0.0028796332129340826, 0.00017132675438569735, -0.00925925925925969, -0.09374999999999965,
+      -0.16369047619047625, 0.03882084350834325, 0.07358440170940186, -0.037591425459072514,
+      0.006464025668746811, -0.000380726120857463, 0.01967592592592511, 0.030092592592592973,
+      -0.15925480769230752, -0.09391915954415965, 0.06354847494553421, -0.011518532851737116,
+      0.0006853070175437684, 0.1428571428571413, 0.40861950549450554, 0.12067307692307702,
+      -0.12072829131652695, 0.022990380362671658, -0.0013706140350878506, -0.0237980769230781,
+      0.25756766381766427, 0.22766884531590412, -0.05068154454764437, 0.0030153508771933,
+      -0.6888888888888889, -0.37244008714596777, 0.10270611168444004, -0.006335282651073211,
+      -0.3905228758169933, -0.36859305125558894, 0.02192982456140455, 0.6576998050682252,
+      -0.049707602339182644, 0.4999999999999991, -0.001388888888888894, 0.0013020833333333517,
+      0.004050925925925972, -0.01817129629629632, -0.009837962962962812, 0.04378895121082595,
+      0.050574252136752006, -0.07737949346405203, -0.0396845616901729, 0.04679504751461941,
+      0.012760416666666524, -0.011545138888888912, -0.021180555555555272, 0.08897569444444377,
+      -0.033728727869352465, -0.19739750267093922, 0.15506973622782402, 0.12978794450894332,
+      -0.11690195540935544, -0.042679398148147835, 0.08043981481481417, -0.06520750661375611,
+      -0.12022171983109434, 0.3069494524572637, -0.08988143868658528, -0.21893589992648987,
+      0.13669971369395634, -0.02164351851851787, -0.0940393518518517, 0.268955884971509,
+      -0.25323740206552536, -0.06654752178649162, 0.2572455764103875, -0.11564555921052602,
+      0.2146577380952368, -0.24097842261904623, 0.06757812499999971, 0.1909094887955169,
+      -0.22968007104157293, 0.07918722587719305, 0.07817094653032033, 0.10014411948005715,
+      -0.22076281901649486, 0.16605345125988966, -0.04636101973684282, -0.1666449652777784,
+      0.18006876361655802, -0.10183646603743843, 0.024004781920078776, -0.11820874183006547,
+      0.05478559296525661, -0.011250456871345177, -0.026497015107212505, 0.004854258040936047,
+      -0.0019531249999998838, -0.004427083333333443, 0.01307870370370372, 0.008101851851851673,
+      -0.03877314814814802, -0.06134593126780619, -0.03641826923076913, -0.020608660130718753,
+      0.0963717248595347, 0.10516036184210548, -0.004427083333333477, -0.019618055555555493,
+      0.021527777777777323, 0.06684027777777769, 0.03392523275335734, -0.12387486645299138,
+      -0.27729049953314605, 0.08264547321121414, 0.2460594846491222, -0.03269675925925896,
+      0.00810185185185148, -0.03244874338624309, 0.09471742088929583, 0.1697215544871792,
+      -0.35601949112978465, -0.12307003850516846, 0.2616159539473684, -0.0053240740740745545,
+      0.030092592592592865, -0.14567864138176637, 0.31530226139601064, -0.12364515250544614,
+      -0.26550218223254146, 0.19939007675438614, 0.1681547619047618, -0.21740928342490823,
+      0.145853365384615, 0.11762079831932748, -0.2673122373949565, 0.12304687500000012,
+      -0.07228438517500928, -0.06396345263532804, 0.20504104419545588, -0.1932233885878909,
+      0.06520696271929836, -0.15169270833333418, 0.17657271241830083, -0.11355353636337638,
+      0.030736019736841997, 0.11345996732026205, -0.05759266425868596, 0.013192160087719146,
+      -0.02610867446393774, 0.00524259868421061, 0.00195312499999954, 0.0010416666666666669,
+      0.006249999999999988, 0.002083333333333332, -0.004880536130536115, 0.00036213786213785883,
+      0.0014046003016591146, -0.0006109495080083116, 9.674922600617611e-05, -5.37495700033755e-06,
+      -0.02291666666666668, -0.033362470862470774, -0.005037150349650364, 0.004190233785822017,
+      -0.0010652337858220132, 0.00014512383900930088, -8.062435500538252e-06, 0.10597527472527449,
+      0.05620286576168915, 0.002725705666882216, -0.0012770897832817714, 7.09494324045599e-05,
+      -0.15548014077425834, -0.02941176470588216, 0.0016339869281044139, 0.07058823529411755,
+      -0.0002604166666666686, 0.0010416666666666647, 0.0026041666666666544, -0.0038243006993006834,
+      -0.008441688519813494, 0.004414121417797871, 0.009651913650075367, -0.0016914989680082493,
+      -0.0036139867131062837, 0.0002604166666666646, 0.0015624999999999892, -0.005729166666666651,
+      -0.0012201340326340347, 0.019239744630369555, -0.002286010558069358, -0.022467600822380127,
+      0.0019398219814241364, 0.008692783582731284, -0.00260416666666665, 0.00260416666666666,
+      0.008312000499500455, -0.01673879505910746, -0.008236708144796337, 0.023290766627163596,
+      0.0022643925991449104, -0.0094206199475404, 0.0005208333333333328, -0.008340617715617666,
+      0.006187627476689948, 0.013354308069381513, -0.014466676093514262, -0.005652573529411689,
+      0.007119332107843137, 0.005073051948051905, -0.00014458198051947978, -0.009604779411764646,
+      0.0053637079831932236, 0.005563426028305998, -0.004187427438080431, -0.00010230654761905003,
+      0.0043811274509803644, -0.0010351015406162155, -0.0035119969040247317, 0.002006538635190863,
+      -0.0020220588235294033, 0.00030126633986926865, 0.0015302502579979452, -0.0007930749054007113,
+      -0.0006382761437908368, -0.00038699690402477395, 0.0002512792397660805, -5.482456140349672e-05,
+      -5.4824561403492246e-05, -0.0005208333333333334, 0.000520833333333332, 0.001673326673326672,
+      -0.0024399211899211884, -0.0018696581196581187, 0.0033453525641025644, 0.0008247420471685171,
+      -0.0018678013163307282, -0.00014878294435182978, 0.00040033093196792884, -0.0015624999999999927,
+      0.002343750000000001, 0.002097902097902094, -0.00559986888111887, 0.0005127684815184819,
+      0.004150892765322903, -0.0016160310277957299, -0.0009571196266968311, 0.0005055147058823468,
+      0.0010029033466533452, 0.00520659895659895, -0.0039392031579531485, -0.006970243298368287,
+      0.00548484527115041, 0.0029087538278714745, -0.0018034051297644539, -0.00039996915601598514,
+      0.004895104895104882, 0.0008194930069930055, -0.009206548659673646, 0.0009399531228575312,
+      0.0063536953242835405, -0.0009785626041914702, -0.0012613680340557247, 0.0012409465534465487,
+      -0.005056271853146848, -0.002850389500205674, 0.005324454956807881, 0.00047615769485932465,
+      -0.001401468355560845, -0.0026971726190476095, -0.0022709865196078355, 0.0025162949795302703,
+      0.0010719163044772579, -0.0010181925756132415, -0.0005058628565062374, 0.0008281342840166425,
+      0.0007862890221878264, -0.0005477081183350568, 0.0004949095022624457, 0.00027350261967135867,
+      -0.00022140688259109293, -5.904183535762862e-05, -5.904183535763608e-05, -0.00032016594516594515,
+      -7.665945165945167e-05, 0.0008824508824508817, -0.0007589632589632574, -0.00040931290931290937,
+      0.0009776681651681633, -0.0003992841309017768, -0.00017111156817039232, 0.00017783590248760534,
+      -3.9410086817206965e-05, -0.00022997835497835494, -0.00041989260739260734, -0.0002705627705627704,
+      0.0006842116217116204, 0.00039803946053945915, -0.0008174041032496896, 1.1385673150378409e-05,
+      0.0003440094638333803, -0.00011795963324601029, -0.0001847111222111218, -0.00040931290931290845,
+      0.000160429847929847, 0.0005372231934731927, -0.0003412768807989386, -0.00020098365686601027,
+      0.00023483554951240677, -5.764923286208046e-05, -0.0012140637140637112, -1.2140637140636954e-05,
+      0.0025586392773892714, 1.5747120526531304e-05, -0.0014920128890717073, 9.58866017883039e-05,
+      0.000246930410920348, 8.8453213453213e-05, 0.0028900786713286614, 0.001299726621417795,
+      -0.0023362666745019604, -0.00030486879606461594, 0.0005294990419796907, 0.001960279304029297,
+      0.0014405401583710397, -0.0017304998922645937, -0.0006479407299356989, 0.0005628200166706346,
+      0.00020169526143790667, -0.0007835710041592384, -0.0005856626442442976, 0.00039960362135284716,
+      -0.00044991772932949435, -0.0002486387451557764, 0.00020127898417371891, 6.440927493559012e-05,
+      6.440927493558995e-05, -0.0008139430014430006, 0.00036976911976911866, 0.0017529345654345636,
+      -0.00132228882228882, -0.0012655747030747033, 0.00105623543123543, 0.0003250528066704541,
+      -0.00020122851005204028, -8.053414593662295e-05, 1.5448302987002995e-05, 6.764069264069307e-05,
+      0.0008507117882117884, 0.0005556943056943066, -0.0009339618714618681, -0.00043193413729127885,
+      0.0005843956900942179, 0.00010594272674104626, -0.00017713396317304986, 2.6668055886321215e-05,
+      0.00235701798201798, 0.003626928626928615, -0.0020309551559551534, -0.0032830264973122115,
+      0.00099313472475237, 0.000809764465226651, -0.00013921997764877007, 2.631097832336112e-05,
+      0.0017822455322455283, -0.0002974456099456125, -0.0032040008602508556, -0.0001530077357283218,
+      0.0010666416916416894, 7.811541528646828e-05, -1.722429402382913e-05, -0.0011243964368964352,
+      -0.0033855653275296086, -0.0010383764519793957, 0.0017038371292572943, 0.000277989715392969,
+      -0.00020305497521054642, -0.0023697780394208896, -0.0013834460066077677, 0.0019113414596607832,
+      0.0005373923354767001, -0.00038761709137096064, 0.00019015655504626126, 0.0012055958747135274,
+      0.0006132948095506188, -0.00040214451011664576, 0.0005998903057726605, 0.0003315183268743661,
+      -0.0002683719788982962, -0.00010734879155931849, -0.0001073487915593223, -0.0006809163059163064,
+      0.0001533189033189031, 0.0008037101787101773, -0.0006771006771006756, -0.00017447829947829998,
+      0.0004322066822066816, -0.00012563008886538215, -5.166402225225823e-05, 3.074625752644332e-05,
+      -3.329144196016712e-06, 0.00045995670995670874, -0.0015796703296703284, -0.0010855810855810847,
+      0.0016629204129204101, 0.00018856143856143813, -0.0006169994221464795, 1.8853695324282507e-05,
+      0.00010136438638760583, -1.4175710770136233e-05, 2.775002775002748e-05, -0.00023310023310023267,
+      -0.00020217877360734487, 0.0003805222555222555, 2.030241000829281e-05, -0.0002026840262134381,
+      8.861736941126546e-05, -1.0246962646342737e-05, -0.002533022533022527, 0.0004981129981129987,
+      0.004288558663558659, 0.00028937565702271523, -0.001003245120892178, -2.7868158673113194e-05,
+      7.329486818650109e-06, 0.001665298986727551, 0.00345591908091907, 0.0009826570488335185,
+      -0.0011001253648312427, -0.00025406509677849775, 3.8097222694746444e-05, 0.0023847680097680043,
+      0.0011957507361919104, -0.0018539467068878802, -0.0004567236813753847, 0.00020820575193640164,
+      -0.0008886130209659612, -0.0019275386922445704, -0.0006498811645870432, 0.00038904450669156627,
+      -0.0008569861511038, -0.0004735976098205223, 0.0003833885412832767, 0.00020447388868441546,
+      0.0002044738886844153, -0.0008139430014430025, -0.0001510642135642136, 0.0010864135864135874,
+      8.325008325008327e-06, -0.0006379037629037642, -6.555944055944017e-05, 0.00020314652667593853,
+      2.073090308384415e-05, -2.2856722740623692e-05, 2.4243687169383554e-06, 0.000588474025974025,
+      -0.00014906968031968006, 4.870129870129856e-05, 0.0004518918581418567, -0.0004603432282003703,
+      2.1784281894576235e-05, 0.00010894217826990923, -3.5731248240923464e-05, 3.1009367309680306e-06,
+      0.00402332042957043, 0.004957542457542447, -0.0008546141358641321, -0.001852946160981876,
+      0.00014123692892075045, 0.00013029687399435496, -6.748564580414369e-05, 7.5644062679648755e-06,
+      -0.00037198912198912164, -0.00011412198912199034, -0.0005447157009657014, -0.0006239216257598591,
+      0.0001572365542953777, -1.9592282072931393e-05, 1.8323717046627868e-06, -0.004497585747585734,
+      -0.007059235407449684, -0.0014796171965289638, 0.0012945038155122155, 0.00018523948961255627,
+      -2.723186256468098e-05, -0.001635269492412344, -0.0007765926883573908, 0.0013300191871620417,
+      0.00042172739541160585, -4.961498769548232e-05, 0.0020318733554027654, 0.002960275019098549,
+      0.0006391312505863639, -0.0002892704131094213, 0.0011997806115453143, 0.0006630366537487246,
+      -0.0005367439577965856, -0.00042939516623727064, -0.0004293951662372739, -0.00032016594516594504,
+      -7.665945165945175e-05, 0.00037254412254412214, -7.90875790875788e-05, -0.00016650016650016647,
+      8.533133533133518e-05, 1.7425385072444258e-05, -2.1138991727227232e-05, 4.803632899608137e-06,
+      -3.382840070145178e-07, -0.0002299783549783549, -0.001184752747252748, -0.001028138528138528,
+      0.0005749458874458873, 0.0005806693306693297, -0.00021928133141368379, -0.0001050420168067236,
+      4.2877497889107644e-05, -3.7211240771603965e-06, 0.0010900557775557756, 0.0002705627705627692,
+      -0.0007674617049617043, 0.0002627580752580743, 0.00010194564422505565, -8.773905832729367e-05,
+      1.9632553978529317e-05, -1.4095166958946655e-06, -0.0018162393162393159, 0.0007041569541569545,
+      0.003655545843045839, 0.000896336098541978, -0.0002131038895744784, 2.3510738487517574e-05,
+      -2.198846045596377e-06, 0.0001665001665001653, 0.001379870129870126, 0.0011920677361853822,
+      -4.995004995004839e-05, -2.661811872338237e-05, 2.0297040420877266e-06, 0.0033577533577533506,
+      0.001420311714429359, -0.0025030525030524955, -0.0005060728744939269, 5.9537985234579104e-05,
+      -0.0020090612002376666, -0.002733214497920372, -0.0006631719673515333, 6.0981330331176256e-05,
+      -0.001439736733854377, -0.0007956439844984725, 0.0006440927493559069, 0.0010305483989694495,
+      0.0010305483989694506, -0.0005208333333333352, -0.0010416666666666656, 0.0001108266733266746,
+      0.0010565823065823033, 4.2492229992229647e-05, -0.00045163170163170155, 1.9067941862058945e-05,
+      6.941587823940828e-05, -1.761332063189597e-05, 1.2403746923866493e-06, 0.004909153346653343,
+      0.008703102453102438, 0.002597229159729157, -0.0016571969696969706, -9.051916221034203e-05,
+      0.0002928036016271328, -7.198603125460474e-05, 5.168227884944907e-06, -0.011988011988011938,
+      -0.017963286713286668, -0.005730666392431103, 0.000349650349650343, 9.759976865240323e-05,
+      -7.4422481543252815e-06, 0.01157531194295898, 0.014230540701128907, 0.002431630546955634,
+      -0.00022359821121430303, -0.003778677462887982, -0.0037786774628879765, 0.0012369791666665452,
+      0.004244791666666792, 0.004793526785714195, -0.006547619047619039, -0.014876302083333202,
+      0.012695312499999736, 0.006873085171568968, -0.00887254901960818, 0.0030315765286380264,
+      -0.0004378190420906603, 2.3251488095241753e-05, 0.002109374999999505, 0.015837053571428946,
+      0.05357142857142853, 0.04277343749999973, -0.06035156249999918, -0.01876378676470688,
+      0.031764705882353896, -0.011076577012384615, 0.0015924749834147745, -8.370535714286655e-05,
+      -0.004241071428572257, -0.02455357142857087, -0.006975446428571341, 0.10658482142857074,
+      0.017435151143792155, -0.05294409430438982, 0.019794718874392915, -0.002918793613937414,
+      0.0001550099206348991, -0.009375000000000966, -0.11601562499999965, -0.23203124999999938,
+      0.013321589052286564, 0.09421160130719107, -0.03844693304953674, 0.0057498602511187,
+      -0.0003038194444444526, 0.019084821428570875, 0.030133928571428634, -0.19035845588235228,
+      -0.12357142857142954, 0.06677044172932443, -0.01050765701017308, 0.0005580357142860475,
+      0.15468749999999984, 0.46320874183006466, 0.16428104575163383, -0.12276025541795722,
+      0.020388670819205503, -0.0010912698412699135, -0.021879084967319332, 0.28081699346405165,
+      0.2515479876160989, -0.048568725735908765, 0.002579365079365112, -0.7191176470588214,
+      -0.40530185758513737, 0.09669394073418736, -0.005357142857143053, -0.40131578947368246,
+      -0.38107769423558696, 0.020238095238094167, 0.6665266106442589, -0.04523809523809502,
+      0.5000000000000016, -0.0012369791666665452, -0.004244791666666792, -0.004793526785714195,
+      0.006547619047619039, 0.014876302083333202, -0.012695312499999736, -0.006873085171568968,
+      0.00887254901960818, -0.0030315765286380264, 0.0004378190420906603, -2.3251488095241753e-05,
+      -0.002109374999999505, -0.015837053571428946, -0.05357142857142853, -0.04277343749999973,
+      0.06035156249999918, 0.01876378676470688, -0.031764705882353896, 0.011076577012384615,
+      -0.0015924749834147745, 8.370535714286655e-05, 0.004241071428572257, 0.02455357142857087,
+      0.006975446428571341, -0.10658482142857074, -0.017435151143792155, 0.05294409430438982,
+      -0.019794718874392915, 0.002918793613937414, -0.0001550099206348991, 0.009375000000000966,
+      0.11601562499999965, 0.23203124999999938, -0.013321589052286564, -0.09421160130719107,
+      0.03844693304953674, -0.0057498602511187, 0.0003038194444444526, -0.019084821428570875,
+      -0.030133928571428634, 0.19035845588235228, 0.12357142857142954, -0.06677044172932443,
+      0.01050765701017308, -0.0005580357142860475, -0.15468749999999984, -0.46320874183006466,
+      -0.16428104575163383, 0.12276025541795722, -0.020388670819205503, 0.0010912698412699135,
+      0.021879084967319332, -0.28081699346405165, -0.2515479876160989, 0.048568725735908765,
+      -0.002579365079365112, 0.7191176470588214, 0.40530185758513737, -0.09669394073418736,
+      0.005357142857143053, 0.40131578947368246, 0.38107769423558696, -0.020238095238094167,
+      -0.6665266106442589, 0.04523809523809502, -0.5000000000000016, 0.0012369791666666354,
+      -0.0031770833333333113, 0.005463169642857185, -0.003273809523809637, -0.015201822916666437,
+      -0.0019531250000001635, 0.038548177083333364, 0.041678921568627174, -0.0708618541989161,
+      -0.03474408677944846, 0.04286179315476155, -0.005312500000000084, 0.01483258928571411,
+      -0.025089285714285328, 0.002734374999999458, 0.07921875000000013, -0.05216107536764717,
+      -0.17428308823529304, 0.15190420617259998, 0.11625836189738989, -0.10854910714285643,
+      -0.005915178571428647, -0.021279761904762013, 0.07975260416666695, -0.10000000000000046,
+      -0.07917113459967197, 0.2983966503267951, -0.10593163457817235, -0.2022742210919448,
+      0.13024863591269745, 0.07583333333333261, -0.0751627604166665, -0.03742187499999893,
+      0.25490183312908227, -0.2832434640522854, -0.03794752563854521, 0.24761096598727125,
+      -0.11401258680555532, -0.06650390625000041, 0.20742187499999876, -0.2838269761029388,
+      0.11897058823529252, 0.17158263593266196, -0.23177296411985748, 0.08118024553571491,
+      -0.22343749999999915, 0.14416296466503176, 0.06414419934640546, -0.22170478183049455,
+      0.17614632475797287, -0.04955047123015983, 0.025657807393790998, -0.16141135620914981,
+      0.19557934645897737, -0.11362133120792127, 0.02677703373015935, 0.16672794117647008,
+      -0.13731708349458024, 0.0642544435537355, -0.013099888392855833, 0.08198087993420995,
+      -0.03262942512531071, 0.005897507440474105, 0.015150122549019452, -0.0024739583333310564,
+      0.0009765625000002413, -0.0012369791666666354, 0.0031770833333333113, -0.005463169642857185,
+      0.003273809523809637, 0.015201822916666437, 0.0019531250000001635, -0.038548177083333364,
+      -0.041678921568627174, 0.0708618541989161, 0.03474408677944846, -0.04286179315476155,
+      0.005312500000000084, -0.01483258928571411, 0.025089285714285328, -0.002734374999999458,
+      -0.07921875000000013, 0.05216107536764717, 0.17428308823529304, -0.15190420617259998,
+      -0.11625836189738989, 0.10854910714285643, 0.005915178571428647, 0.021279761904762013,
+      -0.07975260416666695, 0.10000000000000046, 0.07917113459967197, -0.2983966503267951,
+      0.10593163457817235, 0.2022742210919448, -0.13024863591269745, -0.07583333333333261,
+      0.0751627604166665, 0.03742187499999893, -0.25490183312908227, 0.2832434640522854,
+      0.03794752563854521, -0.24761096598727125, 0.11401258680555532, 0.06650390625000041,
+      -0.20742187499999876, 0.2838269761029388, -0.11897058823529252, -0.17158263593266196,
+      0.23177296411985748, -0.08118024553571491, 0.22343749999999915, -0.14416296466503176,
+      -0.06414419934640546, 0.22170478183049455, -0.17614632475797287, 0.04955047123015983,
+      -0.025657807393790998, 0.16141135620914981, -0.19557934645897737, 0.11362133120792127,
+      -0.02677703373015935, -0.16672794117647008, 0.13731708349458024, -0.0642544435537355,
+      0.013099888392855833, -0.08198087993420995, 0.03262942512531071, -0.005897507440474105,
+      -0.015150122549019452, 0.0024739583333310564, -0.0009765625000002413, -0.0024739583333332985,
+      0.004244791666666491, -0.0003683035714285425, -0.01555059523809521, 0.0011067708333333984,
+      0.049804687500000104, 0.05369408700980359, 0.023857230392156783, 0.013371347716717847,
+      -0.08870213792753963, -0.09519159226190484, -0.012734375000000292, 0.013828125000000099,
+      0.017187499999999727, -0.03730468750000057, -0.07843191964285716, 0.003970588235293334,
+      0.14283832282913148, 0.24114502708978283, -0.09395596643262513, -0.22876674107142816,
+      -0.014564732142856916, 0.020461309523809458, 0.015857514880952026, 0.013811383928571588,
+      -0.1406530841503278, -0.10749372665732958, 0.3656680188522766, 0.09033666235134385,
+      -0.2533327132936508, 0.040104166666666566, -0.03430989583333345, 0.04160156250000064,
+      0.07868030024509745, -0.3277726715686263, 0.1815372242647054, 0.24456571691176424,
+      -0.2024088541666665, 0.06018415178571387, -0.1368582589285707, 0.24710248161764625,
+      -0.22176076680672155, -0.07160539791574488, 0.2708348594371953, -0.13127790178571427,
+      -0.1887555803571415, 0.15339001225490054, 0.004251137955182691, -0.19774937113003027,
+      0.21094121447921263, -0.07314918154761914, -0.02032577614379294, 0.13898794934640585,
+      -0.19507546439628456, 0.13242566626431282, -0.036232018849206425, 0.1562346813725501,
+      -0.13747762674148575, 0.07136450386075381, -0.016322544642856127, -0.07947162828947311,
+      0.03423744909147696, -0.006798735119046344, 0.014973411239493823, -0.0026506696428551875,
+      -0.0009765624999978617, 0.0024739583333332985, -0.004244791666666491, 0.0003683035714285425,
+      0.01555059523809521, -0.0011067708333333984, -0.049804687500000104, -0.05369408700980359,
+      -0.023857230392156783, -0.013371347716717847, 0.08870213792753963, 0.09519159226190484,
+      0.012734375000000292, -0.013828125000000099, -0.017187499999999727, 0.03730468750000057,
+      0.07843191964285716, -0.003970588235293334, -0.14283832282913148, -0.24114502708978283,
+      0.09395596643262513, 0.22876674107142816, 0.014564732142856916, -0.020461309523809458,
+      -0.015857514880952026, -0.013811383928571588, 0.1406530841503278, 0.10749372665732958,
+      -0.3656680188522766, -0.09033666235134385, 0.2533327132936508, -0.040104166666666566,
+      0.03430989583333345, -0.04160156250000064, -0.07868030024509745, 0.3277726715686263,
+      -0.1815372242647054, -0.24456571691176424, 0.2024088541666665, -0.06018415178571387,
+      0.1368582589285707, -0.24710248161764625, 0.22176076680672155, 0.07160539791574488,
+      -0.2708348594371953, 0.13127790178571427, 0.1887555803571415, -0.15339001225490054,
+      -0.004251137955182691, 0.19774937113003027, -0.21094121447921263, 0.07314918154761914,
+      0.02032577614379294, -0.13898794934640585, 0.19507546439628456, -0.13242566626431282,
+      0.036232018849206425, -0.1562346813725501, 0.13747762674148575, -0.07136450386075381,
+      0.016322544642856127, 0.07947162828947311, -0.03423744909147696, 0.006798735119046344,
+      -0.014973411239493823, 0.0026506696428551875, 0.0009765624999978617, -0.00013020833333334211,
+      -0.0005208333333333276, -0.0007998511904761886, 0.0008928571428571402, 0.0009765624999999965,
+      -0.0009179392911010499, -0.00015583757541478394, 0.0003160474716202257, -0.00010541634416924135,
+      1.4397206250914876e-05, -7.198603125406403e-07, 0.0013020833333333424, 0.010416666666666663,
+      0.007905505952380933, -0.0045164700495582705, -0.001164608471593765, 0.0015740945501007315,
+      -0.0004981433362818713, 6.718696250430184e-05, -3.359348125220991e-06, -0.026785714285714145,
+      -0.044505494505494375, -0.013701923076923089, 0.0037815126050420107, -0.00023634453781513014,
+      0.11411356209150324, 0.06730306157550708, 0.00624677502579988, -0.00175684308811245,
+      8.784215440561783e-05, -0.15877192982456143, -0.032581453634084885, 0.0016290726817040123,
+      0.06965944272445834, 6.510416666666761e-05, -0.00013020833333333604, -8.37053571428599e-05,
+      0.001413690476190474, 0.0017903645833333287, -0.004161658653846137, -0.0070779423548265165,
+      0.004560919762641874, 0.00852028105650151, -0.0017128356276721046, -0.0032441944705513676,
+      -0.00039062499999999053, 0.0007254464285714294, 0.00111607142857142, -0.006835937499999962,
+      0.0006180056157078173, 0.01904959700226236, -0.0036494038404835337, -0.02100969910990704,
+      0.002192550539952791, 0.007957191922821755, 0.0005580357142857122, -0.0033482142857142647,
+      0.00418526785714284, 0.00870131706528762, -0.019240588863750564, -0.007076322853702843,
+      0.02344268299425026, 0.0017084684751093435, -0.008960149300948449, 0.002604166666666647,
+      0.001139322916666659, -0.011188489819004476, 0.008348504666289535, 0.01461638931888535,
+      -0.016052812983746088, -0.005454237616099003, 0.007142813951238401, -0.002720424107142839,
+      0.006568408613445339, 0.0007065716911764584, -0.012500345532949948, 0.006635139664418356,
+      0.006061511775762873, -0.004491712392193661, -0.0032914006948933155, -0.0023525876696832543,
+      0.006526080827067624, -0.0011307565789473568, -0.004380493973905302, 0.0023375304068995475,
+      0.0011118770424836607, -0.0025958354833161327, -0.0003537393575851636, 0.0023251968002112842,
+      -0.001028776368003291, 0.0013827076883384851, 8.919069272446127e-05, -0.0009106232953708079,
+      0.00038289370024321333, 0.000334087171052623, 0.00021782973057643513, -0.00011625744047621137,
+      2.4619222689069654e-05, 2.4619222689067255e-05, 0.0005208333333333343, -0.0009672619047619037,
+      -0.0010267510267510274, 0.0026557643745143745, 0.0007782505484711369, -0.002877331002331001,
+      -0.000327458918790188, 0.0015239243470667612, 6.461466165413568e-05, -0.0003256072165708404,
+      0.0005208333333333318, 0.001450892857142855, -0.0032529970029970038, -0.0008103875291375285,
+      0.005582698551448543, -0.0017152845622514714, -0.003391668745770909, 0.0017214571177661335,
+      0.0007343343038969967, -0.00045347744360902385, 0.002418154761904756, -0.001026751026751028,
+      -0.005851353507603501, 0.0053285792026600744, 0.005401110582636315, -0.005512225132968156,
+      -0.0018220727688848801, 0.0015828288552263003, 0.00022659283011450664, 0.0011994949494949466,
+      -0.005829023407148396, -0.0008924975147401555, 0.009665982506056008, -0.0019484632584477744,
+      -0.005365228328173366, 0.001087488175094598, 0.0009742915806673556, -0.0034438218031967883,
+      -0.0037720781057178003, 0.006281815610859715, 0.0027141879018814014, -0.00530842271118973,
+      -0.0002106023330384863, 0.0012019363666519215, -0.0023554493912949725, 0.0021199605643539435,
+      0.003485358380869205, -0.002945595305429858, -0.0009909693043884216, 0.0009645744262617317,
+      0.0012650633169934654, 0.0018156604747161993, -0.000982448077915382, -0.0009492941913607629,
+      0.000583751044277357, 0.0005449379481887251, -0.0002682930459633271, -0.000534040370534188,
+      0.00027919062361786645, -0.00026864035087719536, -0.00016447368421052436, 0.00010416666666667391,
+      2.6260504201679183e-05, 2.6260504201681287e-05, -0.00026041666666666607, 0.0005208333333333328,
+      -0.00015947594072594076, -0.0008436008436008406, 0.0010759639665889656, 2.6780817221992495e-06,
+      -0.0008099054744275326, 0.00044906074317838915, 9.59119730888309e-05, -0.00015078526349811082,
+      3.610819327730986e-05, -0.000350170662670662, 0.0002872127872127876, 0.00019980019980019994,
+      5.5933649683648176e-05, -0.0002716493065757769, -0.00046571841149046974, 0.0006850304837920925,
+      -4.549919894347851e-07, -0.0002876458444376392, 9.839183649168129e-05, 0.00013528138528138547,
+      8.67188367188368e-05, 0.0002233010045510043, -4.11276835909188e-05, -0.0004748238893459478,
+      0.0002882018652142484, 0.00018357102456367146, -0.00021336659663865503, 5.309689665339738e-05,
+      0.00029623154623154545, 0.001371133207070706, 0.0001221740881667356, -0.0019735766174185233,
+      9.479469618788916e-06, 0.0010933364478014228, -0.00010327152959699332, -0.0001662794630335269,
+      0.0016106939935064863, 0.0013123595154845105, -0.0027280279463183805, -0.0011553365365284832,
+      0.0018762022371977786, 0.0002083962380498753, -0.0003934490673799861, 0.0009040515244559359,
+      -0.0015921552916038167, -0.0019078970994605643, 0.001594222582757793, 0.0005489647360293635,
+      -0.00045694813012924315, -0.0010924966577540083, -0.0012905760390280463, 0.0007816677807486618,
+      0.0006171218487394928, -0.0003626253132832078, -0.0003467786943019141, 0.00028546095931931785,
+      0.00041697262575745794, -0.00021526702786377498, 0.0002479757085020225, 0.00015182186234817627,
+      -9.615384615384586e-05, -2.8280542986427482e-05, -2.828054298642917e-05, -5.7494588744588396e-05,
+      0.000922514985014985, -0.0007958187645687637, -0.001435023310023309, 0.0016500426656676657,
+      0.0006621595316448254, -0.0009006388831756463, -0.0001811510857563492, 0.00015052792602134757,
+      6.547970218635897e-05, -1.2638532133502157e-05, 0.000540605228105227, 0.0003519917582417581,
+      -0.0011540542790542797, -0.00039543789543789435, 0.0011224529147323243, 0.00020547390722023038,
+      -0.0005716178171673524, -4.5283542888999644e-05, 0.00015484950421095964, -2.4508676308212104e-05,
+      0.0013749271561771547, -0.0015661421911421893, -0.0034991050616050563, 0.0020185467106422945,
+      0.0024236448294352687, -0.0008803841282556434, -0.0005800984764074932, 0.00012469994208577742,
+      -2.2648114269629113e-05, -0.0008231351981351959, -0.0029296874999999965, -3.751099798893878e-05,
+      0.0029620387272041595, 7.568916721393444e-05, -0.0008765121858920233, -4.638719446188507e-05,
+      1.2816735315768634e-05, -0.002139462100399595, -0.0010232644194041209, 0.003002202301375093,
+      0.0009843049752105463, -0.001250415485250041, -0.0002154784553681644, 0.00013323738471281,
+      -0.0001690379677512032, 0.002302549625619474, 0.0017255797393181257, -0.001436183342264029,
+      -0.0004248593415098838, 0.0002653161467015954, 0.0016032336229946514, 0.00143144877568252,
+      -0.0010328529587672413, -0.0005588210164448592, 0.0003022470950102501, 0.00020719895429647769,
+      -0.0004952647004698101, -0.000466662787676721, 0.00023580086708956487, -0.00033814869341185227,
+      -0.00020702981229296996, 0.00013111888111888275, 4.6277252159604745e-05, 4.62772521596063e-05,
+      -0.0002457611832611833, 0.0007031163281163279, -0.0003245018870018871, -0.0007652070152070132,
+      0.0009057782495282479, -5.087845161374561e-05, -0.0003712433399933394, 0.0001453579530204913,
+      3.6872688285227067e-05, -2.8069518201096564e-05, 3.1747685578948207e-06, -0.0009018759018758998,
+      -0.0008064851814851813, 0.0014638139638139646, 0.000541819291819291, -0.0012138509249853754,
+      -5.3964621979328224e-05, 0.0004202262633266616, -3.741260029959429e-06, -7.958623477199403e-05,
+      1.109893718252928e-05, 0.0005263833388833378, 5.8968808968808786e-05, 7.309159094873426e-05,
+      0.0002835523778275873, -0.00044487188329100024, 5.703652458406969e-05, 0.00015783087173650004,
+      -7.775833772350843e-05, 9.365455379387032e-06, 0.0016511266511266478, 0.0038244741369741313,
+      0.00021028807793513745, -0.0028080341499459056, -0.0002025250864260152, 0.000651977988471796,
+      5.888647529515101e-06, -3.6396853347328703e-06, 0.001982578433471281, 0.00074908022649619,
+      -0.002811633831854412, -0.000984408301414048, 0.0008036043594839448, 0.00018070004041366317,
+      -2.9176995605014087e-05, -0.0006983963457177701, -0.0028701852001484294, -0.0015235823299180212,
+      0.0011148975025232733, 0.0003445239150541005, -0.00012216706295653575, -0.002090008983391331,
+      -0.0015622277619181577, 0.001275714631945277, 0.0005137621236692431, -0.00023417128680286594,
+      7.210460964330836e-05, 0.0008809479349340041, 0.0005446998964800847, -0.0002641434288106093,
+      0.0005009610272768153, 0.0003067108330266199, -0.0001942501942501967, -8.569861511038098e-05,
+      -8.569861511038571e-05, 0.00024576118326118357, 0.0008024961149961144, -0.00033612221112221114,
+      -0.0009552947052947045, 0.0002809690309690314, 0.00044728555757967445, -2.060847649083329e-06,
+      -0.00013880813029419842, -1.4544601425406373e-05, 1.6551753200359956e-05, -1.7719638462673664e-06,
+      -0.0006037365412365396, -0.00018445096570096566, 0.0006271506271506268, -0.0004985465922965908,
+      -0.00026931227036269026, 0.0004842609392241726, -8.000480689556241e-05, -9.029968032483503e-05,
+      3.3806027420577434e-05, -3.0606648253696113e-06, 0.0011251769064269037, -0.0017794705294705278,
+      -0.0033710708933923175, 0.0006142972923435094, 0.0011432730872069092, -8.837573797768407e-05,
+      -9.699056978330579e-05, 4.8527646244363874e-05, -5.409859318526536e-06, -0.00030108780108780114,
+      -0.0009008786352536352, -0.0006393116687234349, 0.000577900279187043, 0.0004662806520391654,
+      -0.00013190055880651875, 1.7540652215573885e-05, -1.6992506833835127e-06, -0.002838214612768175,
+      -0.0008541156847354284, 0.003625104980803501, 0.0010912406920810282, -0.0006666847706141683,
+      -0.00010142479424600319, 1.5494615678440282e-05, 0.0014213618139563473, 0.0033634580969139696,
+      0.0014921060641980555, -0.000770937170414723, -0.0002848185776784855, 3.6128373976670903e-05,
+      0.0022580054749172375, 0.0015063840528236746, -0.0013457984868588569, -0.00045652232184740333,
+      0.0001376547429178976, -0.0006708046568727658, -0.0015504683654838404, -0.0006101641163560677,
+      0.00026949959225501026, -0.0007514415409152257, -0.00046006624953993567, 0.00029137529137528883,
+      0.00017139723022075926, 0.00017139723022075983, 5.7494588744588816e-05, 0.00019095487845487846,
+      -7.570554445554453e-05, -0.0002559940059940053, 0.0001326798201798198, 0.00012358964564846886,
+      -9.405423008364166e-05, -1.0328938347514414e-05, 2.1971546255601913e-05, -5.436707255592376e-06,
+      3.986918654098863e-07, -0.0016540750915750894, -0.0016592782217782205, 0.001046869796869797,
+      0.0009937978687978679, -0.0005158444496679779, -0.00037658420011361227, 0.00016657104505401704,
+      5.7305310788283334e-05, -2.5975379110054785e-05, 2.305163876372404e-06, 0.0008038836163836137,
+      -0.00012487512487512493, -0.00031218781218781094, 0.0005690541076570481, -0.0002376606236900349,
+      -8.183251217306944e-05, 8.589997463836486e-05, -2.0840711146439232e-05, 1.5706043182827803e-06,
+      0.004312354312354306, 0.006788133741258726, 0.0011946744023949925, -0.0018451447449609193,
+      -0.00042861335430994987, 0.00011926484570640964, -1.4799925306889465e-05, 1.3615931282319757e-06,
+      -0.00028877372627372636, 7.161955691367287e-06, -0.0006218964858670726, -0.0008974771358672255,
+      4.6233758501560324e-05, 2.3921511924607546e-05, -1.957214612012646e-06, -0.003951981433599066,
+      -0.006729759211376839, -0.0021327829377364937, 0.0008917053663570649, 0.0002197057972986768,
+      -2.7004729017112896e-05, -0.0016934046345811, -0.0011305000469087098, 0.0010385589642555556,
+      0.0004312251216275966, -4.442925495557076e-05, 0.0017238952997466917, 0.002561215873909373,
+      0.0006278551170192092, -0.00020946545714347297, 0.0010820758189179216, 0.0006624953993375021,
+      -0.00041958041958042213, -0.0003702180172768422, -0.0003702180172768491, 0.00026041666666666655,
+      0.0004355019980019985, 0.000103802447552447, -0.00031322843822843827, -0.0002965784215784211,
+      8.655560126148372e-05, 0.00015340052104757958, -1.856051585153753e-05, -2.364041402354114e-05,
+      6.64486442350194e-06, -4.872900577231838e-07, -0.0006061646686646673, -0.0003707230269730272,
+      0.0005962787212787212, 4.032425907425973e-05, -0.00031806428865252333, 9.185820307143743e-05,
+      5.081240568856694e-05, -3.223000876832143e-05, 5.9951443465368335e-06, -3.721124077152856e-07,
+      3.902347652347238e-06, -0.0012435481185481163, -0.0022438499000998974, -0.0006261355066502109,
+      0.0004960700043420634, 3.946646748504373e-06, -9.44678225541234e-05, 2.5471980290091564e-05,
+      -1.9196275001225233e-06, 0.0012213480963480946, 0.00048107274669774485, -0.0009944253050870682,
+      -5.1865516019926725e-05, 0.00014519901323306833, -4.8619868908181304e-05, 7.959070942816901e-06,
+      -5.064863327256116e-07, -0.0023179945054944964, -0.00046662895927601313, 0.00336859831345125,
+      0.0014446080235553918, -0.00010425429833324385, -2.923740346341007e-05, 2.3921511924612367e-06,
+      0.00029021223874164937, 0.0016936902966314693, 0.0015218098035435464, 6.102643486544407e-05,
+      -5.3666878357280855e-05, 3.6384324310016345e-06, 0.003384952465834814, 0.002000656722018944,
+      -0.001965651092973068, -0.0005270529264337326, 5.430242272347219e-05, -0.0018796562914209908,
+      -0.002627519539284237, -0.0006913021618903957, 5.656108597284859e-05, -0.0013225371120107938,
+      -0.0008097165991902816, 0.0005128205128205097, 0.0009049773755656089, 0.0009049773755656061,
+      -0.0010416666666666638, -0.0029017857142857087, -0.0014048451548451548, 0.0016207750582750559,
+      0.0007639419404125296, -0.0006252785204991082, -8.862181849798287e-05, 0.00011144766611098006,
+      -2.2267679001423987e-05, 1.3821318000884826e-06, 0.005511849261849256, 0.011658046814296797,
+      0.006424182435211848, -0.0004046760021024716, -0.0004761384985843233, 0.0001750788878304337,
+      -2.9562263501888545e-05, 1.8812349501180315e-06, -0.011857627666451159, -0.01911136249371539,
+      -0.007499329016356862, -3.274589187902494e-05, 0.00019933411961276036, -1.3514177600867935e-05,
+      0.010683760683760665, 0.013461538461538426, 0.002567693744164339, -0.0002100840336134367,
+      -0.003361344537815122, -0.0033613445378151384,
+    };
+
+    static const Shapeset::PolynomialTable leg_tri_polynomials = { 150, leg_tri_start, leg_tri_degrees, leg_tri_coefs };
+
+    static const int leg_quad_start[] =
+    {
+      0, 0, 0, 0, 0, 2, 4, 6, 8, 8, 8, 8, 8, 10, 12, 14,
+      16, 16, 16, 16, 16, 18, 20, 22, 24, 24, 24, 24, 24, 26, 28, 30,
+      32, 32, 32, 32, 32, 34, 36, 38, 40, 40, 40, 40, 40, 42, 44, 46,
+      48, 48, 48, 48, 48, 50, 52, 54, 56, 56, 56, 56, 56, 58, 60, 62,
+      64, 64, 64, 64, 64, 66, 68, 70, 72, 72, 72, 72, 72, 74, 76, 78,
+      80, 80, 80, 80, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102,
+      104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 128, 130, 132, 134,
+      136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 166,
+      168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190, 192, 194, 196, 198,
+      200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222, 224, 226, 228, 230,
+      232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254, 256, 258, 260, 262,
+      264, 266, 268, 270, 272, 274, 276, 278, 280, 282, 284, 286, 288, 290, 292, 294,
+      296, 298, 300, 302, 304, 306, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+      308, 308, 308, 308, 308, 310, 312, 314, 316, 316, 316, 316, 316, 318, 320, 322,
+      324, 324, 324, 324, 324, 326, 328, 330, 332, 332, 332, 332, 332, 334, 336, 338,
+      340, 340, 340, 340, 340, 342, 344, 346, 348, 348, 348, 348, 348, 350, 352, 354,
+      356, 356, 356, 356, 356, 358, 360, 362, 364, 364, 364, 364, 364, 366, 368, 370,
+      372, 372, 372, 372, 372, 374, 376, 378, 380, 380, 380, 380, 380, 382, 384, 386,
+      388, 388, 388, 388, 388, 390, 392, 394, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396,
+      396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 396, 398, 400, 402, 404, 406,
+      408, 410, 412, 414, 416, 418, 420, 422, 424, 426, 428, 430, 432, 434, 436, 438,
+      440, 442, 444, 446, 448, 450, 452, 454, 456, 458, 460, 462, 464, 466, 468, 470,
+      472, 474, 476, 478, 480, 482, 484, 486, 488, 490, 492, 494, 496, 498, 500, 502,
+      504, 506, 508, 510, 512, 514, 516, 518, 520, 522, 524, 526, 528, 530, 532, 534,
+      536, 538, 540, 542, 544, 546, 548, 550, 552, 554, 556, 558, 560, 562, 564, 566,
+      568, 570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 590, 592, 594, 596, 598,
+      600, 602, 604, 606, 608, 610, 612, 614, 616,
+    };
+
+    static const unsigned char leg_quad_degrees[] =
+    {
+      0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11,
+      0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31, 0x30, 0x31,
+      0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x50, 0x51, 0x50, 0x51, 0x50, 0x51, 0x50, 0x51,
+      0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x70, 0x71, 0x70, 0x71, 0x70, 0x71, 0x70, 0x71,
+      0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x90, 0x91, 0x90, 0x91, 0x90, 0x91, 0x90, 0x91,
+      0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0x00, 0x02, 0x01, 0x03, 0x02, 0x04, 0x03, 0x05,
+      0x04, 0x06, 0x05, 0x07, 0x06, 0x08, 0x07, 0x09, 0x08, 0x0a, 0x09, 0x0b, 0x10, 0x12, 0x11, 0x13,
+      0x12, 0x14, 0x13, 0x15, 0x14, 0x16, 0x15, 0x17, 0x16, 0x18, 0x17, 0x19, 0x18, 0x1a, 0x19, 0x1b,
+      0x20, 0x22, 0x21, 0x23, 0x22, 0x24, 0x23, 0x25, 0x24, 0x26, 0x25, 0x27, 0x26, 0x28, 0x27, 0x29,
+      0x28, 0x2a, 0x29, 0x2b, 0x30, 0x32, 0x31, 0x33, 0x32, 0x34, 0x33, 0x35, 0x34, 0x36, 0x35, 0x37,
+      0x36, 0x38, 0x37, 0x39, 0x38, 0x3a, 0x39, 0x3b, 0x40, 0x42, 0x41, 0x43, 0x42, 0x44, 0x43, 0x45,
+      0x44, 0x46, 0x45, 0x47, 0x46, 0x48, 0x47, 0x49, 0x48, 0x4a, 0x49, 0x4b, 0x50, 0x52, 0x51, 0x53,
+      0x52, 0x54, 0x53, 0x55, 0x54, 0x56, 0x55, 0x57, 0x56, 0x58, 0x57, 0x59, 0x58, 0x5a, 0x59, 0x5b,
+      0x60, 0x62, 0x61, 0x63, 0x62, 0x64, 0x63, 0x65, 0x64, 0x66, 0x65, 0x67, 0x66, 0x68, 0x67, 0x69,
+      0x68, 0x6a, 0x69, 0x6b, 0x70, 0x72, 0x71, 0x73, 0x72, 0x74, 0x73, 0x75, 0x74, 0x76, 0x75, 0x77,
+      0x76, 0x78, 0x77, 0x79, 0x78, 0x7a, 0x79, 0x7b, 0x80, 0x82, 0x81, 0x83, 0x82, 0x84, 0x83, 0x85,
+      0x84, 0x86, 0x85, 0x87, 0x86, 0x88, 0x87, 0x89, 0x88, 0x8a, 0x89, 0x8b, 0x90, 0x92, 0x91, 0x93,
+      0x92, 0x94, 0x93, 0x95, 0x94, 0x96, 0x95, 0x97, 0x96, 0x98, 0x97, 0x99, 0x98, 0x9a, 0x99, 0x9b,
+      0xa0, 0xa2, 0xa1, 0xa3, 0xa2, 0xa4, 0xa3, 0xa5, 0xa4, 0xa6, 0xa5, 0xa7, 0xa6, 0xa8, 0xa7, 0xa9,
+      0xa8, 0xaa, 0xa9, 0xab, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x11, 0x01, 0x11,
+      0x01, 0x11, 0x01, 0x11, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x03, 0x13, 0x03, 0x13,
+      0x03, 0x13, 0x03, 0x13, 0x04, 0x14, 0x04, 0x14, 0x04, 0x14, 0x04, 0x14, 0x05, 0x15, 0x05, 0x15,
+      0x05, 0x15, 0x05, 0x15, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x07, 0x17, 0x07, 0x17,
+      0x07, 0x17, 0x07, 0x17, 0x08, 0x18, 0x08, 0x18, 0x08, 0x18, 0x08, 0x18, 0x09, 0x19, 0x09, 0x19,
+      0x09, 0x19, 0x09, 0x19, 0x0a, 0x1a, 0x0a, 0x1a, 0x0a, 0x1a, 0x0a, 0x1a, 0x00, 0x20, 0x01, 0x21,
+      0x02, 0x22, 0x03, 0x23, 0x04, 0x24, 0x05, 0x25, 0x06, 0x26, 0x07, 0x27, 0x08, 0x28, 0x09, 0x29,
+      0x0a, 0x2a, 0x10, 0x30, 0x11, 0x31, 0x12, 0x32, 0x13, 0x33, 0x14, 0x34, 0x15, 0x35, 0x16, 0x36,
+      0x17, 0x37, 0x18, 0x38, 0x19, 0x39, 0x1a, 0x3a, 0x20, 0x40, 0x21, 0x41, 0x22, 0x42, 0x23, 0x43,
+      0x24, 0x44, 0x25, 0x45, 0x26, 0x46, 0x27, 0x47, 0x28, 0x48, 0x29, 0x49, 0x2a, 0x4a, 0x30, 0x50,
+      0x31, 0x51, 0x32, 0x52, 0x33, 0x53, 0x34, 0x54, 0x35, 0x55, 0x36, 0x56, 0x37, 0x57, 0x38, 0x58,
+      0x39, 0x59, 0x3a, 0x5a, 0x40, 0x60, 0x41, 0x61, 0x42, 0x62, 0x43, 0x63, 0x44, 0x64, 0x45, 0x65,
+      0x46, 0x66, 0x47, 0x67, 0x48, 0x68, 0x49, 0x69, 0x4a, 0x6a, 0x50, 0x70, 0x51, 0x71, 0x52, 0x72,
+      0x53, 0x73, 0x54, 0x74, 0x55, 0x75, 0x56, 0x76, 0x57, 0x77, 0x58, 0x78, 0x59, 0x79, 0x5a, 0x7a,
+      0x60, 0x80, 0x61, 0x81, 0x62, 0x82, 0x63, 0x83, 0x64, 0x84, 0x65, 0x85, 0x66, 0x86, 0x67, 0x87,
+      0x68, 0x88, 0x69, 0x89, 0x6a, 0x8a, 0x70, 0x90, 0x71, 0x91, 0x72, 0x92, 0x73, 0x93, 0x74, 0x94,
+      0x75, 0x95, 0x76, 0x96, 0x77, 0x97, 0x78, 0x98, 0x79, 0x99, 0x7a, 0x9a, 0x80, 0xa0, 0x81, 0xa1,
+      0x82, 0xa2, 0x83, 0xa3, 0x84, 0xa4, 0x85, 0xa5, 0x86, 0xa6, 0x87, 0xa7, 0x88, 0xa8, 0x89, 0xa9,
+      0x8a, 0xaa, 0x90, 0xb0, 0x91, 0xb1, 0x92, 0xb2, 0x93, 0xb3, 0x94, 0xb4, 0x95, 0xb5, 0x96, 0xb6,
+      0x97, 0xb7, 0x98, 0xb8, 0x99, 0xb9, 0x9a, 0xba,
+    };
+
+    static const double leg_quad_coefs[] =
+    {
+      0.49999999999999983, -0.5000000000000004, -0.49999999999999983, 0.5000000000000004,
+      -0.49999999999999983, -0.5000000000000004, 0.49999999999999983, 0.5000000000000004,
+      0.5000000000000004, -0.5000000000000003, 0.5000000000000004, -0.5000000000000003,
+      0.5000000000000004, 0.5000000000000004, 0.5000000000000004, 0.5000000000000004,
+      0.5000000000000004, -0.500000000000001, -0.5000000000000004, 0.500000000000001,
+      -0.5000000000000006, -0.500000000000001, 0.5000000000000006, 0.500000000000001,
+      0.500000000000001, -0.5000000000000007, 0.500000000000001, -0.5000000000000007,
+      0.5000000000000008, 0.500000000000001, 0.5000000000000008, 0.500000000000001,
+      0.5000000000000012, -0.5000000000000004, -0.5000000000000012, 0.5000000000000004,
+      -0.5000000000000012, -0.5000000000000006, 0.5000000000000012, 0.5000000000000006,
+      0.5000000000000011, -0.5000000000000013, 0.5000000000000011, -0.5000000000000013,
+      0.5000000000000011, 0.5000000000000013, 0.5000000000000011, 0.5000000000000013,
+      0.500000000000001, -0.500000000000001, -0.500000000000001, 0.500000000000001,
+      -0.5000000000000009, -0.5000000000000011, 0.5000000000000009, 0.5000000000000011,
+      0.500000000000001, -0.500000000000001, 0.500000000000001, -0.500000000000001,
+      0.500000000000001, 0.5000000000000012, 0.500000000000001, 0.5000000000000012,
+      0.5000000000000011, -0.5000000000000018, -0.5000000000000011, 0.5000000000000018,
+      -0.500000000000001, -0.5000000000000014, 0.500000000000001, 0.5000000000000014,
+      0.49999999999999906, -0.49999999999999933, 0.49999999999999906, -0.49999999999999933,
+      0.4999999999999991, 0.49999999999999933, 0.4999999999999991, 0.49999999999999933,
+      0.500000000000003, -0.5000000000000032, -0.500000000000003, 0.5000000000000032,
+      -0.5000000000000029, -0.5000000000000033, 0.5000000000000029, 0.5000000000000033,
+      -0.40824829046386324, 0.4082482904638633, -0.31622776601683766, 0.3162277660168378,
+      -0.267261241912425, 0.2672612419124245, -0.2357022603955156, 0.2357022603955157,
+      -0.21320071635561053, 0.21320071635561036, -0.19611613513818407, 0.19611613513818424,
+      -0.1825741858350557, 0.18257418583505522, -0.17149858514250876, 0.17149858514250915,
+      -0.16222142113076293, 0.16222142113076216, -0.15430334996209155, 0.15430334996209144,
+      -0.40824829046386324, 0.4082482904638627, -0.3162277660168379, 0.31622776601683816,
+      -0.26726124191242456, 0.26726124191242445, -0.23570226039551578, 0.235702260395516,
+      -0.2132007163556107, 0.2132007163556104, -0.19611613513818385, 0.19611613513818432,
+      -0.18257418583505572, 0.18257418583505536, -0.1714985851425089, 0.17149858514250915,
+      -0.16222142113076252, 0.16222142113076196, -0.15430334996209158, 0.1543033499620916,
+      -0.4082482904638636, 0.4082482904638634, -0.3162277660168384, 0.31622776601683794,
+      -0.26726124191242473, 0.26726124191242473, -0.23570226039551623, 0.23570226039551612,
+      -0.21320071635561091, 0.2132007163556105, -0.1961161351381844, 0.19611613513818404,
+      -0.1825741858350558, 0.1825741858350555, -0.17149858514250912, 0.17149858514250957,
+      -0.16222142113076277, 0.1622214211307625, -0.1543033499620915, 0.1543033499620917,
+      -0.4082482904638631, 0.4082482904638637, -0.31622776601683805, 0.3162277660168381,
+      -0.26726124191242495, 0.26726124191242484, -0.23570226039551617, 0.2357022603955163,
+      -0.21320071635561091, 0.21320071635561078, -0.19611613513818454, 0.1961161351381841,
+      -0.1825741858350559, 0.18257418583505552, -0.1714985851425088, 0.17149858514250935,
+      -0.16222142113076288, 0.1622214211307624, -0.15430334996209147, 0.15430334996209172,
+      -0.4082482904638635, 0.40824829046386346, -0.31622776601683855, 0.316227766016838,
+      -0.26726124191242456, 0.2672612419124247, -0.23570226039551614, 0.2357022603955162,
+      -0.2132007163556109, 0.21320071635561044, -0.19611613513818427, 0.19611613513818424,
+      -0.18257418583505583, 0.1825741858350552, -0.17149858514250912, 0.17149858514250896,
+      -0.1622214211307631, 0.16222142113076254, -0.1543033499620916, 0.1543033499620917,
+      -0.40824829046386385, 0.4082482904638635, -0.31622776601683805, 0.3162277660168381,
+      -0.2672612419124248, 0.26726124191242456, -0.23570226039551617, 0.23570226039551576,
+      -0.21320071635561055, 0.21320071635561078, -0.1961161351381844, 0.19611613513818443,
+      -0.18257418583505564, 0.18257418583505544, -0.17149858514250918, 0.1714985851425094,
+      -0.1622214211307629, 0.1622214211307623, -0.15430334996209177, 0.15430334996209158,
+      -0.4082482904638635, 0.40824829046386407, -0.31622776601683766, 0.31622776601683833,
+      -0.2672612419124245, 0.2672612419124249, -0.23570226039551612, 0.23570226039551628,
+      -0.21320071635561055, 0.21320071635561083, -0.19611613513818438, 0.19611613513818418,
+      -0.18257418583505566, 0.1825741858350555, -0.17149858514250924, 0.17149858514250943,
+      -0.16222142113076288, 0.16222142113076227, -0.1543033499620916, 0.15430334996209158,
+      -0.4082482904638639, 0.40824829046386424, -0.3162277660168382, 0.31622776601683905,
+      -0.267261241912425, 0.2672612419124249, -0.23570226039551626, 0.23570226039551623,
+      -0.2132007163556109, 0.21320071635561091, -0.19611613513818454, 0.1961161351381842,
+      -0.18257418583505575, 0.18257418583505564, -0.17149858514250904, 0.17149858514250926,
+      -0.16222142113076296, 0.16222142113076254, -0.15430334996209175, 0.15430334996209186,
+      -0.40824829046386446, 0.408248290463864, -0.31622776601683905, 0.31622776601683833,
+      -0.2672612419124251, 0.26726124191242473, -0.23570226039551634, 0.23570226039551645,
+      -0.21320071635561097, 0.2132007163556108, -0.1961161351381845, 0.19611613513818446,
+      -0.18257418583505583, 0.1825741858350557, -0.17149858514250912, 0.1714985851425093,
+      -0.16222142113076307, 0.16222142113076266, -0.15430334996209188, 0.15430334996209208,
+      -0.4082482904638627, 0.40824829046386235, -0.31622776601683694, 0.3162277660168369,
+      -0.2672612419124238, 0.26726124191242395, -0.2357022603955153, 0.23570226039551556,
+      -0.21320071635561008, 0.21320071635561014, -0.19611613513818363, 0.19611613513818393,
+      -0.18257418583505508, 0.18257418583505483, -0.17149858514250846, 0.17149858514250876,
+      -0.16222142113076213, 0.16222142113076182, -0.15430334996209108, 0.1543033499620912,
+      -0.40824829046386507, 0.40824829046386524, -0.31622776601683944, 0.3162277660168391,
+      -0.26726124191242584, 0.26726124191242584, -0.23570226039551717, 0.23570226039551728,
+      -0.21320071635561186, 0.2132007163556116, -0.19611613513818532, 0.19611613513818513,
+      -0.18257418583505658, 0.18257418583505627, -0.17149858514250985, 0.17149858514250998,
+      -0.16222142113076365, 0.16222142113076304, -0.15430334996209233, 0.15430334996209233,
+      -0.5000000000000002, 0.5000000000000006, 0.5000000000000002, -0.5000000000000006,
+      0.49999999999999967, 0.49999999999999983, -0.49999999999999967, -0.49999999999999983,
+      0.5000000000000006, -0.5000000000000007, 0.5000000000000006, -0.5000000000000007,
+      0.5000000000000002, 0.5000000000000007, 0.5000000000000002, 0.5000000000000007,
+      -0.5000000000000004, 0.5000000000000011, 0.5000000000000004, -0.5000000000000011,
+      0.5000000000000004, 0.5000000000000016, -0.5000000000000004, -0.5000000000000016,
+      0.5000000000000007, -0.500000000000001, 0.5000000000000007, -0.500000000000001,
+      0.5000000000000007, 0.5000000000000016, 0.5000000000000007, 0.5000000000000016,
+      -0.500000000000001, 0.5000000000000009, 0.500000000000001, -0.5000000000000009,
+      0.5000000000000011, 0.5000000000000002, -0.5000000000000011, -0.5000000000000002,
+      0.5000000000000008, -0.5000000000000011, 0.5000000000000008, -0.5000000000000011,
+      0.5000000000000014, 0.500000000000002, 0.5000000000000014, 0.500000000000002,
+      -0.5000000000000011, 0.5000000000000009, 0.5000000000000011, -0.5000000000000009,
+      0.500000000000001, 0.5000000000000019, -0.500000000000001, -0.5000000000000019,
+      0.5000000000000013, -0.5000000000000013, 0.5000000000000013, -0.5000000000000013,
+      0.5000000000000003, 0.500000000000002, 0.5000000000000003, 0.500000000000002,
+      -0.5000000000000014, 0.5000000000000013, 0.5000000000000014, -0.5000000000000013,
+      0.5000000000000007, 0.5000000000000004, -0.5000000000000007, -0.5000000000000004,
+      0.4999999999999992, -0.4999999999999997, 0.4999999999999992, -0.4999999999999997,
+      0.4999999999999991, 0.49999999999999944, 0.4999999999999991, 0.49999999999999944,
+      -0.5000000000000031, 0.5000000000000029, 0.5000000000000031, -0.5000000000000029,
+      0.500000000000003, 0.5000000000000032, -0.500000000000003, -0.5000000000000032,
+      -0.40824829046386324, 0.408248290463863, -0.4082482904638634, 0.40824829046386296,
+      -0.40824829046386363, 0.4082482904638638, -0.4082482904638634, 0.4082482904638637,
+      -0.40824829046386374, 0.4082482904638635, -0.40824829046386374, 0.40824829046386346,
+      -0.4082482904638638, 0.4082482904638639, -0.40824829046386396, 0.40824829046386424,
+      -0.4082482904638645, 0.40824829046386407, -0.4082482904638624, 0.4082482904638625,
+      -0.408248290463865, 0.4082482904638653, -0.31622776601683766, 0.3162277660168376,
+      -0.3162277660168385, 0.3162277660168376, -0.31622776601683794, 0.31622776601683833,
+      -0.31622776601683844, 0.3162277660168378, -0.3162277660168389, 0.31622776601683794,
+      -0.31622776601683844, 0.31622776601683833, -0.3162277660168381, 0.3162277660168383,
+      -0.31622776601683855, 0.31622776601683916, -0.3162277660168388, 0.3162277660168392,
+      -0.316227766016837, 0.316227766016837, -0.31622776601683955, 0.31622776601683944,
+      -0.2672612419124247, 0.26726124191242456, -0.26726124191242456, 0.2672612419124244,
+      -0.267261241912425, 0.26726124191242473, -0.26726124191242506, 0.26726124191242456,
+      -0.2672612419124244, 0.2672612419124246, -0.26726124191242456, 0.26726124191242445,
+      -0.26726124191242456, 0.2672612419124245, -0.2672612419124249, 0.26726124191242495,
+      -0.26726124191242523, 0.26726124191242445, -0.26726124191242395, 0.26726124191242423,
+      -0.2672612419124261, 0.2672612419124261, -0.23570226039551584, 0.23570226039551564,
+      -0.2357022603955157, 0.23570226039551598, -0.23570226039551628, 0.23570226039551614,
+      -0.23570226039551628, 0.23570226039551626, -0.23570226039551628, 0.23570226039551614,
+      -0.2357022603955161, 0.2357022603955159, -0.23570226039551592, 0.2357022603955163,
+      -0.23570226039551614, 0.23570226039551637, -0.23570226039551634, 0.2357022603955163,
+      -0.23570226039551528, 0.2357022603955156, -0.23570226039551717, 0.23570226039551734,
+      -0.21320071635561047, 0.21320071635561028, -0.21320071635561075, 0.21320071635561058,
+      -0.21320071635561078, 0.21320071635561041, -0.21320071635561078, 0.21320071635561066,
+      -0.2132007163556109, 0.2132007163556105, -0.2132007163556106, 0.2132007163556106,
+      -0.21320071635561058, 0.21320071635561103, -0.21320071635561091, 0.213200716355611,
+      -0.21320071635561114, 0.21320071635561083, -0.21320071635561033, 0.21320071635561016,
+      -0.21320071635561172, 0.2132007163556117, -0.19611613513818443, 0.19611613513818432,
+      -0.19611613513818424, 0.19611613513818435, -0.1961161351381845, 0.19611613513818432,
+      -0.19611613513818452, 0.19611613513818424, -0.19611613513818438, 0.19611613513818435,
+      -0.19611613513818443, 0.1961161351381845, -0.19611613513818418, 0.19611613513818418,
+      -0.19611613513818452, 0.19611613513818413, -0.19611613513818443, 0.1961161351381842,
+      -0.19611613513818363, 0.19611613513818374, -0.1961161351381853, 0.19611613513818515,
+      -0.18257418583505572, 0.18257418583505539, -0.18257418583505547, 0.18257418583505516,
+      -0.18257418583505572, 0.18257418583505564, -0.1825741858350557, 0.1825741858350554,
+      -0.18257418583505577, 0.18257418583505555, -0.18257418583505602, 0.1825741858350555,
+      -0.1825741858350558, 0.18257418583505525, -0.18257418583505594, 0.18257418583505577,
+      -0.18257418583505575, 0.18257418583505547, -0.1825741858350555, 0.18257418583505494,
+      -0.18257418583505688, 0.1825741858350562, -0.17149858514250876, 0.17149858514250935,
+      -0.171498585142509, 0.17149858514250926, -0.17149858514250915, 0.17149858514250943,
+      -0.17149858514250887, 0.1714985851425092, -0.1714985851425092, 0.17149858514250907,
+      -0.17149858514250915, 0.1714985851425094, -0.17149858514250924, 0.17149858514250946,
+      -0.17149858514250899, 0.17149858514250926, -0.17149858514250915, 0.17149858514250943,
+      -0.17149858514250862, 0.1714985851425088, -0.1714985851425099, 0.1714985851425101,
+      -0.16222142113076282, 0.1622214211307622, -0.16222142113076288, 0.16222142113076193,
+      -0.16222142113076293, 0.16222142113076224, -0.16222142113076288, 0.16222142113076238,
+      -0.1622214211307628, 0.1622214211307623, -0.1622214211307627, 0.16222142113076232,
+      -0.16222142113076302, 0.16222142113076232, -0.16222142113076285, 0.16222142113076238,
+      -0.162221421130763, 0.16222142113076243, -0.16222142113076216, 0.1622214211307619,
+      -0.16222142113076338, 0.16222142113076302, -0.15430334996209152, 0.15430334996209133,
+      -0.1543033499620914, 0.15430334996209155, -0.15430334996209144, 0.15430334996209158,
+      -0.15430334996209158, 0.15430334996209197, -0.15430334996209152, 0.15430334996209155,
+      -0.15430334996209175, 0.15430334996209177, -0.15430334996209183, 0.15430334996209155,
+      -0.1543033499620917, 0.15430334996209175, -0.1543033499620918, 0.1543033499620918,
+      -0.15430334996209136, 0.15430334996209089, -0.15430334996209255, 0.1543033499620926,
+    };
+
+    static const Shapeset::PolynomialTable leg_quad_polynomials = { 308, leg_quad_start, leg_quad_degrees, leg_quad_coefs };
+
     void check_leg_tri(Shapeset* shapeset)
     {
       for (int i = 1; i <= 10; i++)
@@ -16561,17 +2531,7 @@ namespace Hermes
           throw Hermes::Exceptions::Exception("Wrong bubble count");
       }
 
-      int size_a  = sizeof(leg_tri_fn_a)  / sizeof(Shapeset::shape_fn_t);
-      int size_b  = sizeof(leg_tri_fn_b)  / sizeof(Shapeset::shape_fn_t);
-      int size_ax = sizeof(leg_tri_fn_ax) / sizeof(Shapeset::shape_fn_t);
-      int size_bx = sizeof(leg_tri_fn_bx) / sizeof(Shapeset::shape_fn_t);
-      int size_ay = sizeof(leg_tri_fn_ay) / sizeof(Shapeset::shape_fn_t);
-      int size_by = sizeof(leg_tri_fn_by) / sizeof(Shapeset::shape_fn_t);
-
-      if(size_a != size_b || size_a != size_ax || size_a != size_bx || size_a != size_ay || size_a != size_by)
-        throw Hermes::Exceptions::Exception("Function tables dont have equal length.");
-
-      if(size_a != leg_tri_bubble_indices[10][leg_tri_bubble_count[10]-1] + 1)
+      if(leg_tri_polynomials.num_indices != leg_tri_bubble_indices[10][leg_tri_bubble_count[10]-1] + 1)
         throw Hermes::Exceptions::Exception("Bad index of last bubble");
     }
 
@@ -16579,12 +2539,8 @@ namespace Hermes
 
     HcurlShapesetLegendre::HcurlShapesetLegendre()
     {
-      shape_table[0] = leg_shape_fn_table;
-      shape_table[1] = leg_shape_fn_table_x;
-      shape_table[2] = leg_shape_fn_table_y;
-      shape_table[3] = NULL;
-      shape_table[4] = NULL;
-      shape_table[5] = NULL;
+      polynomial_table[HERMES_MODE_TRIANGLE] = &leg_tri_polynomials;
+      polynomial_table[HERMES_MODE_QUAD] = &leg_quad_polynomials;
 
       vertex_indices = leg_vertex_indices;
       edge_indices = leg_edge_indices;
@@ -14,8417 +14,11 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "global.h"
-#include "shapeset_common.h"
 #include "shapeset_hd_all.h"
 namespace Hermes
 {
   namespace Hermes2D
   {
-    /* EDGE FUNCTIONS */
-
-    /* ORDER 0 */
-
-    static double hdiv_leg_quad_p0_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p0_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre0x(y));
-    }
-
-    static double hdiv_leg_quad_p0_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p0_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre0x(y));
-    }
-
-    static double hdiv_leg_quad_p0_e3_b_0(double x, double y)
-    {
-      return Legendre0(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e3_b_1(double x, double y)
-    {
-      return -(Legendre0(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e3_bx_0(double x, double y)
-    {
-      return Legendre0x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e3_bx_1(double x, double y)
-    {
-      return -(Legendre0x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e3_by_0(double x, double y)
-    {
-      return Legendre0(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p0_e3_by_1(double x, double y)
-    {
-      return -(Legendre0(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p0_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e4_b_1(double x, double y)
-    {
-      return Legendre0(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p0_e4_b_0(double x, double y)
-    {
-      return -(Legendre0(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p0_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e4_bx_1(double x, double y)
-    {
-      return Legendre0x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p0_e4_bx_0(double x, double y)
-    {
-      return -(Legendre0x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p0_e4_by_1(double x, double y)
-    {
-      return Legendre0(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p0_e4_by_0(double x, double y)
-    {
-      return -(Legendre0(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p0_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 1 */
-
-    static double hdiv_leg_quad_p1_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e1_a(double x, double y)
-    {
-      return -l0(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e1_ax(double x, double y)
-    {
-      return -dl0(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e1_ay(double x, double y)
-    {
-      return -l0(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p1_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e2_a(double x, double y)
-    {
-      return -l1(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e2_ax(double x, double y)
-    {
-      return -dl1(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e2_ay(double x, double y)
-    {
-      return -l1(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p1_e3_b(double x, double y)
-    {
-      return Legendre1(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p1_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e3_bx(double x, double y)
-    {
-      return Legendre1x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p1_e3_by(double x, double y)
-    {
-      return Legendre1(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p1_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e4_b(double x, double y)
-    {
-      return Legendre1(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e4_bx(double x, double y)
-    {
-      return Legendre1x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e4_by(double x, double y)
-    {
-      return Legendre1(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p1_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 2 */
-
-    static double hdiv_leg_quad_p2_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre2(y));
-    }
-
-    static double hdiv_leg_quad_p2_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre2(y));
-    }
-
-    static double hdiv_leg_quad_p2_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p2_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre2x(y));
-    }
-
-    static double hdiv_leg_quad_p2_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre2(y));
-    }
-
-    static double hdiv_leg_quad_p2_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre2(y));
-    }
-
-    static double hdiv_leg_quad_p2_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p2_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre2x(y));
-    }
-
-    static double hdiv_leg_quad_p2_e3_b_0(double x, double y)
-    {
-      return Legendre2(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p2_e3_b_1(double x, double y)
-    {
-      return -(Legendre2(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p2_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e3_bx_0(double x, double y)
-    {
-      return Legendre2x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p2_e3_bx_1(double x, double y)
-    {
-      return -(Legendre2x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p2_e3_by_0(double x, double y)
-    {
-      return Legendre2(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p2_e3_by_1(double x, double y)
-    {
-      return -(Legendre2(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p2_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e4_b_1(double x, double y)
-    {
-      return Legendre2(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p2_e4_b_0(double x, double y)
-    {
-      return -(Legendre2(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p2_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e4_bx_1(double x, double y)
-    {
-      return Legendre2x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p2_e4_bx_0(double x, double y)
-    {
-      return -(Legendre2x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p2_e4_by_1(double x, double y)
-    {
-      return Legendre2(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p2_e4_by_0(double x, double y)
-    {
-      return -(Legendre2(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p2_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 3 */
-
-    static double hdiv_leg_quad_p3_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e1_a(double x, double y)
-    {
-      return -l0(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e1_ax(double x, double y)
-    {
-      return -dl0(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3_e1_ay(double x, double y)
-    {
-      return -l0(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p3_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e2_a(double x, double y)
-    {
-      return -l1(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e2_ax(double x, double y)
-    {
-      return -dl1(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3_e2_ay(double x, double y)
-    {
-      return -l1(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p3_e3_b(double x, double y)
-    {
-      return Legendre3(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p3_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e3_bx(double x, double y)
-    {
-      return Legendre3x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p3_e3_by(double x, double y)
-    {
-      return Legendre3(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p3_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e4_b(double x, double y)
-    {
-      return Legendre3(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p3_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e4_bx(double x, double y)
-    {
-      return Legendre3x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p3_e4_by(double x, double y)
-    {
-      return Legendre3(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p3_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 4 */
-
-    static double hdiv_leg_quad_p4_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre4(y));
-    }
-
-    static double hdiv_leg_quad_p4_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre4(y));
-    }
-
-    static double hdiv_leg_quad_p4_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p4_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre4x(y));
-    }
-
-    static double hdiv_leg_quad_p4_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre4(y));
-    }
-
-    static double hdiv_leg_quad_p4_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre4(y));
-    }
-
-    static double hdiv_leg_quad_p4_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p4_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre4x(y));
-    }
-
-    static double hdiv_leg_quad_p4_e3_b_0(double x, double y)
-    {
-      return Legendre4(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p4_e3_b_1(double x, double y)
-    {
-      return -(Legendre4(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p4_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e3_bx_0(double x, double y)
-    {
-      return Legendre4x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p4_e3_bx_1(double x, double y)
-    {
-      return -(Legendre4x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p4_e3_by_0(double x, double y)
-    {
-      return Legendre4(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p4_e3_by_1(double x, double y)
-    {
-      return -(Legendre4(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p4_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e4_b_1(double x, double y)
-    {
-      return Legendre4(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p4_e4_b_0(double x, double y)
-    {
-      return -(Legendre4(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p4_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e4_bx_1(double x, double y)
-    {
-      return Legendre4x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p4_e4_bx_0(double x, double y)
-    {
-      return -(Legendre4x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p4_e4_by_1(double x, double y)
-    {
-      return Legendre4(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p4_e4_by_0(double x, double y)
-    {
-      return -(Legendre4(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p4_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 5 */
-
-    static double hdiv_leg_quad_p5_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e1_a(double x, double y)
-    {
-      return -l0(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e1_ax(double x, double y)
-    {
-      return -dl0(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5_e1_ay(double x, double y)
-    {
-      return -l0(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p5_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e2_a(double x, double y)
-    {
-      return -l1(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e2_ax(double x, double y)
-    {
-      return -dl1(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5_e2_ay(double x, double y)
-    {
-      return -l1(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p5_e3_b(double x, double y)
-    {
-      return Legendre5(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p5_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e3_bx(double x, double y)
-    {
-      return Legendre5x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p5_e3_by(double x, double y)
-    {
-      return Legendre5(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p5_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e4_b(double x, double y)
-    {
-      return Legendre5(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p5_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e4_bx(double x, double y)
-    {
-      return Legendre5x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p5_e4_by(double x, double y)
-    {
-      return Legendre5(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p5_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 6 */
-
-    static double hdiv_leg_quad_p6_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre6(y));
-    }
-
-    static double hdiv_leg_quad_p6_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre6(y));
-    }
-
-    static double hdiv_leg_quad_p6_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p6_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre6x(y));
-    }
-
-    static double hdiv_leg_quad_p6_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre6(y));
-    }
-
-    static double hdiv_leg_quad_p6_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre6(y));
-    }
-
-    static double hdiv_leg_quad_p6_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p6_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre6x(y));
-    }
-
-    static double hdiv_leg_quad_p6_e3_b_0(double x, double y)
-    {
-      return Legendre6(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p6_e3_b_1(double x, double y)
-    {
-      return -(Legendre6(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p6_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e3_bx_0(double x, double y)
-    {
-      return Legendre6x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p6_e3_bx_1(double x, double y)
-    {
-      return -(Legendre6x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p6_e3_by_0(double x, double y)
-    {
-      return Legendre6(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p6_e3_by_1(double x, double y)
-    {
-      return -(Legendre6(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p6_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e4_b_1(double x, double y)
-    {
-      return Legendre6(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p6_e4_b_0(double x, double y)
-    {
-      return -(Legendre6(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p6_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e4_bx_1(double x, double y)
-    {
-      return Legendre6x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p6_e4_bx_0(double x, double y)
-    {
-      return -(Legendre6x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p6_e4_by_1(double x, double y)
-    {
-      return Legendre6(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p6_e4_by_0(double x, double y)
-    {
-      return -(Legendre6(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p6_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 7 */
-
-    static double hdiv_leg_quad_p7_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e1_a(double x, double y)
-    {
-      return -l0(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e1_ax(double x, double y)
-    {
-      return -dl0(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7_e1_ay(double x, double y)
-    {
-      return -l0(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p7_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e2_a(double x, double y)
-    {
-      return -l1(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e2_ax(double x, double y)
-    {
-      return -dl1(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7_e2_ay(double x, double y)
-    {
-      return -l1(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p7_e3_b(double x, double y)
-    {
-      return Legendre7(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p7_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e3_bx(double x, double y)
-    {
-      return Legendre7x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p7_e3_by(double x, double y)
-    {
-      return Legendre7(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p7_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e4_b(double x, double y)
-    {
-      return Legendre7(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p7_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e4_bx(double x, double y)
-    {
-      return Legendre7x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p7_e4_by(double x, double y)
-    {
-      return Legendre7(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p7_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 8 */
-
-    static double hdiv_leg_quad_p8_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre8(y));
-    }
-
-    static double hdiv_leg_quad_p8_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre8(y));
-    }
-
-    static double hdiv_leg_quad_p8_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p8_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre8x(y));
-    }
-
-    static double hdiv_leg_quad_p8_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre8(y));
-    }
-
-    static double hdiv_leg_quad_p8_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre8(y));
-    }
-
-    static double hdiv_leg_quad_p8_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p8_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre8x(y));
-    }
-
-    static double hdiv_leg_quad_p8_e3_b_0(double x, double y)
-    {
-      return Legendre8(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p8_e3_b_1(double x, double y)
-    {
-      return -(Legendre8(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p8_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e3_bx_0(double x, double y)
-    {
-      return Legendre8x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p8_e3_bx_1(double x, double y)
-    {
-      return -(Legendre8x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p8_e3_by_0(double x, double y)
-    {
-      return Legendre8(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p8_e3_by_1(double x, double y)
-    {
-      return -(Legendre8(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p8_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e4_b_1(double x, double y)
-    {
-      return Legendre8(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p8_e4_b_0(double x, double y)
-    {
-      return -(Legendre8(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p8_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e4_bx_1(double x, double y)
-    {
-      return Legendre8x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p8_e4_bx_0(double x, double y)
-    {
-      return -(Legendre8x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p8_e4_by_1(double x, double y)
-    {
-      return Legendre8(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p8_e4_by_0(double x, double y)
-    {
-      return -(Legendre8(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p8_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 9 */
-
-    static double hdiv_leg_quad_p9_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e1_a(double x, double y)
-    {
-      return -l0(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e1_ax(double x, double y)
-    {
-      return -dl0(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9_e1_ay(double x, double y)
-    {
-      return -l0(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p9_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e2_a(double x, double y)
-    {
-      return -l1(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e2_ax(double x, double y)
-    {
-      return -dl1(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9_e2_ay(double x, double y)
-    {
-      return -l1(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p9_e3_b(double x, double y)
-    {
-      return Legendre9(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p9_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e3_bx(double x, double y)
-    {
-      return Legendre9x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p9_e3_by(double x, double y)
-    {
-      return Legendre9(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p9_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e4_b(double x, double y)
-    {
-      return Legendre9(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p9_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e4_bx(double x, double y)
-    {
-      return Legendre9x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p9_e4_by(double x, double y)
-    {
-      return Legendre9(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p9_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* ORDER 10 */
-
-    static double hdiv_leg_quad_p10_e1_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e1_a_1(double x, double y)
-    {
-      return -l0(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10_e1_a_0(double x, double y)
-    {
-      return (l0(x) * Legendre10(y));
-    }
-
-    static double hdiv_leg_quad_p10_e1_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e1_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e1_ax_1(double x, double y)
-    {
-      return -dl0(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10_e1_ax_0(double x, double y)
-    {
-      return (dl0(x) * Legendre10(y));
-    }
-
-    static double hdiv_leg_quad_p10_e1_ay_1(double x, double y)
-    {
-      return -l0(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p10_e1_ay_0(double x, double y)
-    {
-      return (l0(x) * Legendre10x(y));
-    }
-
-    static double hdiv_leg_quad_p10_e2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e2_a_0(double x, double y)
-    {
-      return -l1(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10_e2_a_1(double x, double y)
-    {
-      return (l1(x) * Legendre10(y));
-    }
-
-    static double hdiv_leg_quad_p10_e2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e2_ax_0(double x, double y)
-    {
-      return -dl1(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10_e2_ax_1(double x, double y)
-    {
-      return (dl1(x) * Legendre10(y));
-    }
-
-    static double hdiv_leg_quad_p10_e2_ay_0(double x, double y)
-    {
-      return -l1(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p10_e2_ay_1(double x, double y)
-    {
-      return (l1(x) * Legendre10x(y));
-    }
-
-    static double hdiv_leg_quad_p10_e3_b_0(double x, double y)
-    {
-      return Legendre10(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p10_e3_b_1(double x, double y)
-    {
-      return -(Legendre10(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p10_e3_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e3_bx_0(double x, double y)
-    {
-      return Legendre10x(x) * l0(y);
-    }
-
-    static double hdiv_leg_quad_p10_e3_bx_1(double x, double y)
-    {
-      return -(Legendre10x(x) * l0(y));
-    }
-
-    static double hdiv_leg_quad_p10_e3_by_0(double x, double y)
-    {
-      return Legendre10(x) * dl0(y);
-    }
-
-    static double hdiv_leg_quad_p10_e3_by_1(double x, double y)
-    {
-      return -(Legendre10(x) * dl0(y));
-    }
-
-    static double hdiv_leg_quad_p10_e3_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e3_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e4_b_1(double x, double y)
-    {
-      return Legendre10(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p10_e4_b_0(double x, double y)
-    {
-      return -(Legendre10(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p10_e4_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e4_bx_1(double x, double y)
-    {
-      return Legendre10x(x) * l1(y);
-    }
-
-    static double hdiv_leg_quad_p10_e4_bx_0(double x, double y)
-    {
-      return -(Legendre10x(x) * l1(y));
-    }
-
-    static double hdiv_leg_quad_p10_e4_by_1(double x, double y)
-    {
-      return Legendre10(x) * dl1(y);
-    }
-
-    static double hdiv_leg_quad_p10_e4_by_0(double x, double y)
-    {
-      return -(Legendre10(x) * dl1(y));
-    }
-
-    static double hdiv_leg_quad_p10_e4_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10_e4_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* BUBBLE */
-
-    /* BUBBLE ( 1 , 0 ) */
-
-    static double hdiv_leg_quad_p0p2_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p0p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p2_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p0p2_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p0p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_b(double x, double y)
-    {
-      return Legendre0(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_bx(double x, double y)
-    {
-      return Legendre0x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_by(double x, double y)
-    {
-      return Legendre0(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p0p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_b(double x, double y)
-    {
-      return Legendre1(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_bx(double x, double y)
-    {
-      return Legendre1x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_by(double x, double y)
-    {
-      return Legendre1(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p1p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_b(double x, double y)
-    {
-      return Legendre2(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_bx(double x, double y)
-    {
-      return Legendre2x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_by(double x, double y)
-    {
-      return Legendre2(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_b(double x, double y)
-    {
-      return Legendre3(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_bx(double x, double y)
-    {
-      return Legendre3x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_by(double x, double y)
-    {
-      return Legendre3(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_b(double x, double y)
-    {
-      return Legendre4(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_bx(double x, double y)
-    {
-      return Legendre4x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_by(double x, double y)
-    {
-      return Legendre4(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_b(double x, double y)
-    {
-      return Legendre5(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_bx(double x, double y)
-    {
-      return Legendre5x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_by(double x, double y)
-    {
-      return Legendre5(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_b(double x, double y)
-    {
-      return Legendre6(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_bx(double x, double y)
-    {
-      return Legendre6x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_by(double x, double y)
-    {
-      return Legendre6(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_b(double x, double y)
-    {
-      return Legendre7(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_bx(double x, double y)
-    {
-      return Legendre7x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_by(double x, double y)
-    {
-      return Legendre7(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_b(double x, double y)
-    {
-      return Legendre8(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_bx(double x, double y)
-    {
-      return Legendre8x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_by(double x, double y)
-    {
-      return Legendre8(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_b(double x, double y)
-    {
-      return Legendre9(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_bx(double x, double y)
-    {
-      return Legendre9x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_by(double x, double y)
-    {
-      return Legendre9(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l2(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl2(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l3(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl3(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l4(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl4(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l5(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl5(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l6(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl6(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l7(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl7(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l8(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl8(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l9(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl9(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l10(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl10(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_b(double x, double y)
-    {
-      return Legendre10(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_a(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_bx(double x, double y)
-    {
-      return Legendre10x(x) * l11(y);
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_by(double x, double y)
-    {
-      return Legendre10(x) * dl11(y);
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_ax(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p11_b1_ay(double x, double y)
-    {
-      return 0.0;
-    }
-
-    /* BUBBLE ( 0 , 1 ) */
-
-    static double hdiv_leg_quad_p2p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p0_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p2p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p0_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p2p0_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p2p1_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p2p2_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p2p3_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p2p4_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p2p5_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p2p6_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p2p7_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p2p8_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p2p9_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_a(double x, double y)
-    {
-      return -l2(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_ax(double x, double y)
-    {
-      return -dl2(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p2p10_b2_ay(double x, double y)
-    {
-      return -l2(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p3p0_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p3p1_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p3p2_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p3p3_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p3p4_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p3p5_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p3p6_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p3p7_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p3p8_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p3p9_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_a(double x, double y)
-    {
-      return -l3(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_ax(double x, double y)
-    {
-      return -dl3(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p3p10_b2_ay(double x, double y)
-    {
-      return -l3(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p4p0_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p4p1_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p4p2_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p4p3_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p4p4_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p4p5_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p4p6_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p4p7_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p4p8_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p4p9_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_a(double x, double y)
-    {
-      return -l4(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_ax(double x, double y)
-    {
-      return -dl4(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p4p10_b2_ay(double x, double y)
-    {
-      return -l4(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p5p0_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p5p1_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p5p2_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p5p3_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p5p4_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p5p5_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p5p6_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p5p7_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p5p8_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p5p9_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_a(double x, double y)
-    {
-      return -l5(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_ax(double x, double y)
-    {
-      return -dl5(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p5p10_b2_ay(double x, double y)
-    {
-      return -l5(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p6p0_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p6p1_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p6p2_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p6p3_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p6p4_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p6p5_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p6p6_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p6p7_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p6p8_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p6p9_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_a(double x, double y)
-    {
-      return -l6(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_ax(double x, double y)
-    {
-      return -dl6(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p6p10_b2_ay(double x, double y)
-    {
-      return -l6(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p7p0_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p7p1_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p7p2_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p7p3_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p7p4_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p7p5_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p7p6_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p7p7_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p7p8_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p7p9_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_a(double x, double y)
-    {
-      return -l7(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_ax(double x, double y)
-    {
-      return -dl7(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p7p10_b2_ay(double x, double y)
-    {
-      return -l7(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p8p0_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p8p1_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p8p2_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p8p3_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p8p4_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p8p5_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p8p6_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p8p7_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p8p8_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p8p9_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_a(double x, double y)
-    {
-      return -l8(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_ax(double x, double y)
-    {
-      return -dl8(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p8p10_b2_ay(double x, double y)
-    {
-      return -l8(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p9p0_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p9p1_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p9p2_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p9p3_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p9p4_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p9p5_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p9p6_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p9p7_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p9p8_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p9p9_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_a(double x, double y)
-    {
-      return -l9(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_ax(double x, double y)
-    {
-      return -dl9(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p9p10_b2_ay(double x, double y)
-    {
-      return -l9(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p10p0_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p10p1_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p10p2_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p10p3_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p10p4_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p10p5_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p10p6_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p10p7_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p10p8_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p10p9_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_a(double x, double y)
-    {
-      return -l10(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_ax(double x, double y)
-    {
-      return -dl10(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p10p10_b2_ay(double x, double y)
-    {
-      return -l10(x) * Legendre10x(y);
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre0(y);
-    }
-
-    static double hdiv_leg_quad_p11p0_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre0x(y);
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre1(y);
-    }
-
-    static double hdiv_leg_quad_p11p1_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre1x(y);
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre2(y);
-    }
-
-    static double hdiv_leg_quad_p11p2_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre2x(y);
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre3(y);
-    }
-
-    static double hdiv_leg_quad_p11p3_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre3x(y);
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre4(y);
-    }
-
-    static double hdiv_leg_quad_p11p4_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre4x(y);
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre5(y);
-    }
-
-    static double hdiv_leg_quad_p11p5_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre5x(y);
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre6(y);
-    }
-
-    static double hdiv_leg_quad_p11p6_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre6x(y);
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre7(y);
-    }
-
-    static double hdiv_leg_quad_p11p7_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre7x(y);
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre8(y);
-    }
-
-    static double hdiv_leg_quad_p11p8_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre8x(y);
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre9(y);
-    }
-
-    static double hdiv_leg_quad_p11p9_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre9x(y);
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_b(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_a(double x, double y)
-    {
-      return -l11(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_bx(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_by(double x, double y)
-    {
-      return 0.0;
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_ax(double x, double y)
-    {
-      return -dl11(x) * Legendre10(y);
-    }
-
-    static double hdiv_leg_quad_p11p10_b2_ay(double x, double y)
-    {
-      return -l11(x) * Legendre10x(y);
-    }
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_a[] =
-    {
-      hdiv_leg_quad_p0_e1_a_0, hdiv_leg_quad_p0_e1_a_1, hdiv_leg_quad_p0_e2_a_0, hdiv_leg_quad_p0_e2_a_1,  hdiv_leg_quad_p0_e3_a, hdiv_leg_quad_p0_e3_a, hdiv_leg_quad_p0_e4_a, hdiv_leg_quad_p0_e4_a,
-      hdiv_leg_quad_p1_e1_a, hdiv_leg_quad_p1_e1_a, hdiv_leg_quad_p1_e2_a, hdiv_leg_quad_p1_e2_a, hdiv_leg_quad_p1_e3_a, hdiv_leg_quad_p1_e3_a, hdiv_leg_quad_p1_e4_a, hdiv_leg_quad_p1_e4_a,
-      hdiv_leg_quad_p2_e1_a_0, hdiv_leg_quad_p2_e1_a_1, hdiv_leg_quad_p2_e2_a_0, hdiv_leg_quad_p2_e2_a_1, hdiv_leg_quad_p2_e3_a, hdiv_leg_quad_p2_e3_a, hdiv_leg_quad_p2_e4_a, hdiv_leg_quad_p2_e4_a,
-      hdiv_leg_quad_p3_e1_a, hdiv_leg_quad_p3_e1_a, hdiv_leg_quad_p3_e2_a, hdiv_leg_quad_p3_e2_a, hdiv_leg_quad_p3_e3_a, hdiv_leg_quad_p3_e3_a, hdiv_leg_quad_p3_e4_a, hdiv_leg_quad_p3_e4_a,
-      hdiv_leg_quad_p4_e1_a_0, hdiv_leg_quad_p4_e1_a_1, hdiv_leg_quad_p4_e2_a_0, hdiv_leg_quad_p4_e2_a_1, hdiv_leg_quad_p4_e3_a, hdiv_leg_quad_p4_e3_a, hdiv_leg_quad_p4_e4_a, hdiv_leg_quad_p4_e4_a,
-      hdiv_leg_quad_p5_e1_a, hdiv_leg_quad_p5_e1_a, hdiv_leg_quad_p5_e2_a, hdiv_leg_quad_p5_e2_a, hdiv_leg_quad_p5_e3_a, hdiv_leg_quad_p5_e3_a, hdiv_leg_quad_p5_e4_a, hdiv_leg_quad_p5_e4_a,
-      hdiv_leg_quad_p6_e1_a_0, hdiv_leg_quad_p6_e1_a_1, hdiv_leg_quad_p6_e2_a_0, hdiv_leg_quad_p6_e2_a_1, hdiv_leg_quad_p6_e3_a, hdiv_leg_quad_p6_e3_a, hdiv_leg_quad_p6_e4_a, hdiv_leg_quad_p6_e4_a,
-      hdiv_leg_quad_p7_e1_a, hdiv_leg_quad_p7_e1_a, hdiv_leg_quad_p7_e2_a, hdiv_leg_quad_p7_e2_a, hdiv_leg_quad_p7_e3_a, hdiv_leg_quad_p7_e3_a, hdiv_leg_quad_p7_e4_a, hdiv_leg_quad_p7_e4_a,
-      hdiv_leg_quad_p8_e1_a_0, hdiv_leg_quad_p8_e1_a_1, hdiv_leg_quad_p8_e2_a_0, hdiv_leg_quad_p8_e2_a_1, hdiv_leg_quad_p8_e3_a, hdiv_leg_quad_p8_e3_a, hdiv_leg_quad_p8_e4_a, hdiv_leg_quad_p8_e4_a,
-      hdiv_leg_quad_p9_e1_a, hdiv_leg_quad_p9_e1_a, hdiv_leg_quad_p9_e2_a, hdiv_leg_quad_p9_e2_a, hdiv_leg_quad_p9_e3_a, hdiv_leg_quad_p9_e3_a, hdiv_leg_quad_p9_e4_a, hdiv_leg_quad_p9_e4_a,
-      hdiv_leg_quad_p10_e1_a_0, hdiv_leg_quad_p10_e1_a_1, hdiv_leg_quad_p10_e2_a_0, hdiv_leg_quad_p10_e2_a_1, hdiv_leg_quad_p10_e3_a, hdiv_leg_quad_p10_e3_a, hdiv_leg_quad_p10_e4_a, hdiv_leg_quad_p10_e4_a,
-
-      hdiv_leg_quad_p0p2_b1_a,   hdiv_leg_quad_p0p3_b1_a,   hdiv_leg_quad_p0p4_b1_a,   hdiv_leg_quad_p0p5_b1_a,   hdiv_leg_quad_p0p6_b1_a,   hdiv_leg_quad_p0p7_b1_a,   hdiv_leg_quad_p0p8_b1_a,   hdiv_leg_quad_p0p9_b1_a,   hdiv_leg_quad_p0p10_b1_a,   hdiv_leg_quad_p0p11_b1_a,   hdiv_leg_quad_p1p2_b1_a,   hdiv_leg_quad_p1p3_b1_a,   hdiv_leg_quad_p1p4_b1_a,   hdiv_leg_quad_p1p5_b1_a,   hdiv_leg_quad_p1p6_b1_a,   hdiv_leg_quad_p1p7_b1_a,   hdiv_leg_quad_p1p8_b1_a,   hdiv_leg_quad_p1p9_b1_a,   hdiv_leg_quad_p1p10_b1_a,   hdiv_leg_quad_p1p11_b1_a,   hdiv_leg_quad_p2p2_b1_a,   hdiv_leg_quad_p2p3_b1_a,   hdiv_leg_quad_p2p4_b1_a,   hdiv_leg_quad_p2p5_b1_a,   hdiv_leg_quad_p2p6_b1_a,   hdiv_leg_quad_p2p7_b1_a,   hdiv_leg_quad_p2p8_b1_a,   hdiv_leg_quad_p2p9_b1_a,   hdiv_leg_quad_p2p10_b1_a,   hdiv_leg_quad_p2p11_b1_a,   hdiv_leg_quad_p3p2_b1_a,   hdiv_leg_quad_p3p3_b1_a,   hdiv_leg_quad_p3p4_b1_a,   hdiv_leg_quad_p3p5_b1_a,   hdiv_leg_quad_p3p6_b1_a,   hdiv_leg_quad_p3p7_b1_a,   hdiv_leg_quad_p3p8_b1_a,   hdiv_leg_quad_p3p9_b1_a,   hdiv_leg_quad_p3p10_b1_a,   hdiv_leg_quad_p3p11_b1_a,   hdiv_leg_quad_p4p2_b1_a,   hdiv_leg_quad_p4p3_b1_a,   hdiv_leg_quad_p4p4_b1_a,   hdiv_leg_quad_p4p5_b1_a,   hdiv_leg_quad_p4p6_b1_a,   hdiv_leg_quad_p4p7_b1_a,   hdiv_leg_quad_p4p8_b1_a,   hdiv_leg_quad_p4p9_b1_a,   hdiv_leg_quad_p4p10_b1_a,   hdiv_leg_quad_p4p11_b1_a,   hdiv_leg_quad_p5p2_b1_a,   hdiv_leg_quad_p5p3_b1_a,   hdiv_leg_quad_p5p4_b1_a,   hdiv_leg_quad_p5p5_b1_a,   hdiv_leg_quad_p5p6_b1_a,   hdiv_leg_quad_p5p7_b1_a,   hdiv_leg_quad_p5p8_b1_a,   hdiv_leg_quad_p5p9_b1_a,   hdiv_leg_quad_p5p10_b1_a,   hdiv_leg_quad_p5p11_b1_a,   hdiv_leg_quad_p6p2_b1_a,   hdiv_leg_quad_p6p3_b1_a,   hdiv_leg_quad_p6p4_b1_a,   hdiv_leg_quad_p6p5_b1_a,   hdiv_leg_quad_p6p6_b1_a,   hdiv_leg_quad_p6p7_b1_a,   hdiv_leg_quad_p6p8_b1_a,   hdiv_leg_quad_p6p9_b1_a,   hdiv_leg_quad_p6p10_b1_a,   hdiv_leg_quad_p6p11_b1_a,   hdiv_leg_quad_p7p2_b1_a,   hdiv_leg_quad_p7p3_b1_a,   hdiv_leg_quad_p7p4_b1_a,   hdiv_leg_quad_p7p5_b1_a,   hdiv_leg_quad_p7p6_b1_a,   hdiv_leg_quad_p7p7_b1_a,   hdiv_leg_quad_p7p8_b1_a,   hdiv_leg_quad_p7p9_b1_a,   hdiv_leg_quad_p7p10_b1_a,   hdiv_leg_quad_p7p11_b1_a,   hdiv_leg_quad_p8p2_b1_a,   hdiv_leg_quad_p8p3_b1_a,   hdiv_leg_quad_p8p4_b1_a,   hdiv_leg_quad_p8p5_b1_a,   hdiv_leg_quad_p8p6_b1_a,   hdiv_leg_quad_p8p7_b1_a,   hdiv_leg_quad_p8p8_b1_a,   hdiv_leg_quad_p8p9_b1_a,   hdiv_leg_quad_p8p10_b1_a,   hdiv_leg_quad_p8p11_b1_a,   hdiv_leg_quad_p9p2_b1_a,   hdiv_leg_quad_p9p3_b1_a,   hdiv_leg_quad_p9p4_b1_a,   hdiv_leg_quad_p9p5_b1_a,   hdiv_leg_quad_p9p6_b1_a,   hdiv_leg_quad_p9p7_b1_a,   hdiv_leg_quad_p9p8_b1_a,   hdiv_leg_quad_p9p9_b1_a,   hdiv_leg_quad_p9p10_b1_a,   hdiv_leg_quad_p9p11_b1_a,   hdiv_leg_quad_p10p2_b1_a,   hdiv_leg_quad_p10p3_b1_a,   hdiv_leg_quad_p10p4_b1_a,   hdiv_leg_quad_p10p5_b1_a,   hdiv_leg_quad_p10p6_b1_a,   hdiv_leg_quad_p10p7_b1_a,   hdiv_leg_quad_p10p8_b1_a,   hdiv_leg_quad_p10p9_b1_a,   hdiv_leg_quad_p10p10_b1_a,   hdiv_leg_quad_p10p11_b1_a,   hdiv_leg_quad_p2p0_b2_a,   hdiv_leg_quad_p2p1_b2_a,   hdiv_leg_quad_p2p2_b2_a,   hdiv_leg_quad_p2p3_b2_a,   hdiv_leg_quad_p2p4_b2_a,   hdiv_leg_quad_p2p5_b2_a,   hdiv_leg_quad_p2p6_b2_a,   hdiv_leg_quad_p2p7_b2_a,   hdiv_leg_quad_p2p8_b2_a,   hdiv_leg_quad_p2p9_b2_a,   hdiv_leg_quad_p2p10_b2_a,   hdiv_leg_quad_p3p0_b2_a,   hdiv_leg_quad_p3p1_b2_a,   hdiv_leg_quad_p3p2_b2_a,   hdiv_leg_quad_p3p3_b2_a,   hdiv_leg_quad_p3p4_b2_a,   hdiv_leg_quad_p3p5_b2_a,   hdiv_leg_quad_p3p6_b2_a,   hdiv_leg_quad_p3p7_b2_a,   hdiv_leg_quad_p3p8_b2_a,   hdiv_leg_quad_p3p9_b2_a,   hdiv_leg_quad_p3p10_b2_a,   hdiv_leg_quad_p4p0_b2_a,   hdiv_leg_quad_p4p1_b2_a,   hdiv_leg_quad_p4p2_b2_a,   hdiv_leg_quad_p4p3_b2_a,   hdiv_leg_quad_p4p4_b2_a,   hdiv_leg_quad_p4p5_b2_a,   hdiv_leg_quad_p4p6_b2_a,   hdiv_leg_quad_p4p7_b2_a,   hdiv_leg_quad_p4p8_b2_a,   hdiv_leg_quad_p4p9_b2_a,   hdiv_leg_quad_p4p10_b2_a,   hdiv_leg_quad_p5p0_b2_a,   hdiv_leg_quad_p5p1_b2_a,   hdiv_leg_quad_p5p2_b2_a,   hdiv_leg_quad_p5p3_b2_a,   hdiv_leg_quad_p5p4_b2_a,   hdiv_leg_quad_p5p5_b2_a,   hdiv_leg_quad_p5p6_b2_a,   hdiv_leg_quad_p5p7_b2_a,   hdiv_leg_quad_p5p8_b2_a,   hdiv_leg_quad_p5p9_b2_a,   hdiv_leg_quad_p5p10_b2_a,   hdiv_leg_quad_p6p0_b2_a,   hdiv_leg_quad_p6p1_b2_a,   hdiv_leg_quad_p6p2_b2_a,   hdiv_leg_quad_p6p3_b2_a,   hdiv_leg_quad_p6p4_b2_a,   hdiv_leg_quad_p6p5_b2_a,   hdiv_leg_quad_p6p6_b2_a,   hdiv_leg_quad_p6p7_b2_a,   hdiv_leg_quad_p6p8_b2_a,   hdiv_leg_quad_p6p9_b2_a,   hdiv_leg_quad_p6p10_b2_a,   hdiv_leg_quad_p7p0_b2_a,   hdiv_leg_quad_p7p1_b2_a,   hdiv_leg_quad_p7p2_b2_a,   hdiv_leg_quad_p7p3_b2_a,   hdiv_leg_quad_p7p4_b2_a,   hdiv_leg_quad_p7p5_b2_a,   hdiv_leg_quad_p7p6_b2_a,   hdiv_leg_quad_p7p7_b2_a,   hdiv_leg_quad_p7p8_b2_a,   hdiv_leg_quad_p7p9_b2_a,   hdiv_leg_quad_p7p10_b2_a,   hdiv_leg_quad_p8p0_b2_a,   hdiv_leg_quad_p8p1_b2_a,   hdiv_leg_quad_p8p2_b2_a,   hdiv_leg_quad_p8p3_b2_a,   hdiv_leg_quad_p8p4_b2_a,   hdiv_leg_quad_p8p5_b2_a,   hdiv_leg_quad_p8p6_b2_a,   hdiv_leg_quad_p8p7_b2_a,   hdiv_leg_quad_p8p8_b2_a,   hdiv_leg_quad_p8p9_b2_a,   hdiv_leg_quad_p8p10_b2_a,   hdiv_leg_quad_p9p0_b2_a,   hdiv_leg_quad_p9p1_b2_a,   hdiv_leg_quad_p9p2_b2_a,   hdiv_leg_quad_p9p3_b2_a,   hdiv_leg_quad_p9p4_b2_a,   hdiv_leg_quad_p9p5_b2_a,   hdiv_leg_quad_p9p6_b2_a,   hdiv_leg_quad_p9p7_b2_a,   hdiv_leg_quad_p9p8_b2_a,   hdiv_leg_quad_p9p9_b2_a,   hdiv_leg_quad_p9p10_b2_a,   hdiv_leg_quad_p10p0_b2_a,   hdiv_leg_quad_p10p1_b2_a,   hdiv_leg_quad_p10p2_b2_a,   hdiv_leg_quad_p10p3_b2_a,   hdiv_leg_quad_p10p4_b2_a,   hdiv_leg_quad_p10p5_b2_a,   hdiv_leg_quad_p10p6_b2_a,   hdiv_leg_quad_p10p7_b2_a,   hdiv_leg_quad_p10p8_b2_a,   hdiv_leg_quad_p10p9_b2_a,   hdiv_leg_quad_p10p10_b2_a,   hdiv_leg_quad_p11p0_b2_a,   hdiv_leg_quad_p11p1_b2_a,   hdiv_leg_quad_p11p2_b2_a,   hdiv_leg_quad_p11p3_b2_a,   hdiv_leg_quad_p11p4_b2_a,   hdiv_leg_quad_p11p5_b2_a,   hdiv_leg_quad_p11p6_b2_a,   hdiv_leg_quad_p11p7_b2_a,   hdiv_leg_quad_p11p8_b2_a,   hdiv_leg_quad_p11p9_b2_a,   hdiv_leg_quad_p11p10_b2_a, };
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_b[] =
-    {
-      hdiv_leg_quad_p0_e1_b, hdiv_leg_quad_p0_e1_b, hdiv_leg_quad_p0_e2_b, hdiv_leg_quad_p0_e2_b, hdiv_leg_quad_p0_e3_b_0, hdiv_leg_quad_p0_e3_b_1, hdiv_leg_quad_p0_e4_b_0, hdiv_leg_quad_p0_e4_b_1,
-      hdiv_leg_quad_p1_e1_b, hdiv_leg_quad_p1_e1_b, hdiv_leg_quad_p1_e2_b, hdiv_leg_quad_p1_e2_b, hdiv_leg_quad_p1_e3_b, hdiv_leg_quad_p1_e3_b, hdiv_leg_quad_p1_e4_b, hdiv_leg_quad_p1_e4_b,
-      hdiv_leg_quad_p2_e1_b, hdiv_leg_quad_p2_e1_b, hdiv_leg_quad_p2_e2_b, hdiv_leg_quad_p2_e2_b, hdiv_leg_quad_p2_e3_b_0, hdiv_leg_quad_p2_e3_b_1, hdiv_leg_quad_p2_e4_b_0, hdiv_leg_quad_p2_e4_b_1,
-      hdiv_leg_quad_p3_e1_b, hdiv_leg_quad_p3_e1_b, hdiv_leg_quad_p3_e2_b, hdiv_leg_quad_p3_e2_b, hdiv_leg_quad_p3_e3_b, hdiv_leg_quad_p3_e3_b, hdiv_leg_quad_p3_e4_b, hdiv_leg_quad_p3_e4_b,
-      hdiv_leg_quad_p4_e1_b, hdiv_leg_quad_p4_e1_b, hdiv_leg_quad_p4_e2_b, hdiv_leg_quad_p4_e2_b, hdiv_leg_quad_p4_e3_b_0, hdiv_leg_quad_p4_e3_b_1, hdiv_leg_quad_p4_e4_b_0, hdiv_leg_quad_p4_e4_b_1,
-      hdiv_leg_quad_p5_e1_b, hdiv_leg_quad_p5_e1_b, hdiv_leg_quad_p5_e2_b, hdiv_leg_quad_p5_e2_b, hdiv_leg_quad_p5_e3_b, hdiv_leg_quad_p5_e3_b, hdiv_leg_quad_p5_e4_b, hdiv_leg_quad_p5_e4_b,
-      hdiv_leg_quad_p6_e1_b, hdiv_leg_quad_p6_e1_b, hdiv_leg_quad_p6_e2_b, hdiv_leg_quad_p6_e2_b, hdiv_leg_quad_p6_e3_b_0, hdiv_leg_quad_p6_e3_b_1, hdiv_leg_quad_p6_e4_b_0, hdiv_leg_quad_p6_e4_b_1,
-      hdiv_leg_quad_p7_e1_b, hdiv_leg_quad_p7_e1_b, hdiv_leg_quad_p7_e2_b, hdiv_leg_quad_p7_e2_b, hdiv_leg_quad_p7_e3_b, hdiv_leg_quad_p7_e3_b, hdiv_leg_quad_p7_e4_b, hdiv_leg_quad_p7_e4_b,
-      hdiv_leg_quad_p8_e1_b, hdiv_leg_quad_p8_e1_b, hdiv_leg_quad_p8_e2_b, hdiv_leg_quad_p8_e2_b, hdiv_leg_quad_p8_e3_b_0, hdiv_leg_quad_p8_e3_b_1, hdiv_leg_quad_p8_e4_b_0, hdiv_leg_quad_p8_e4_b_1,
-      hdiv_leg_quad_p9_e1_b, hdiv_leg_quad_p9_e1_b, hdiv_leg_quad_p9_e2_b, hdiv_leg_quad_p9_e2_b, hdiv_leg_quad_p9_e3_b, hdiv_leg_quad_p9_e3_b, hdiv_leg_quad_p9_e4_b, hdiv_leg_quad_p9_e4_b,
-      hdiv_leg_quad_p10_e1_b, hdiv_leg_quad_p10_e1_b, hdiv_leg_quad_p10_e2_b, hdiv_leg_quad_p10_e2_b, hdiv_leg_quad_p10_e3_b_0, hdiv_leg_quad_p10_e3_b_1, hdiv_leg_quad_p10_e4_b_0, hdiv_leg_quad_p10_e4_b_1,
-
-      hdiv_leg_quad_p0p2_b1_b,   hdiv_leg_quad_p0p3_b1_b,   hdiv_leg_quad_p0p4_b1_b,   hdiv_leg_quad_p0p5_b1_b,   hdiv_leg_quad_p0p6_b1_b,   hdiv_leg_quad_p0p7_b1_b,   hdiv_leg_quad_p0p8_b1_b,   hdiv_leg_quad_p0p9_b1_b,   hdiv_leg_quad_p0p10_b1_b,   hdiv_leg_quad_p0p11_b1_b,   hdiv_leg_quad_p1p2_b1_b,   hdiv_leg_quad_p1p3_b1_b,   hdiv_leg_quad_p1p4_b1_b,   hdiv_leg_quad_p1p5_b1_b,   hdiv_leg_quad_p1p6_b1_b,   hdiv_leg_quad_p1p7_b1_b,   hdiv_leg_quad_p1p8_b1_b,   hdiv_leg_quad_p1p9_b1_b,   hdiv_leg_quad_p1p10_b1_b,   hdiv_leg_quad_p1p11_b1_b,   hdiv_leg_quad_p2p2_b1_b,   hdiv_leg_quad_p2p3_b1_b,   hdiv_leg_quad_p2p4_b1_b,   hdiv_leg_quad_p2p5_b1_b,   hdiv_leg_quad_p2p6_b1_b,   hdiv_leg_quad_p2p7_b1_b,   hdiv_leg_quad_p2p8_b1_b,   hdiv_leg_quad_p2p9_b1_b,   hdiv_leg_quad_p2p10_b1_b,   hdiv_leg_quad_p2p11_b1_b,   hdiv_leg_quad_p3p2_b1_b,   hdiv_leg_quad_p3p3_b1_b,   hdiv_leg_quad_p3p4_b1_b,   hdiv_leg_quad_p3p5_b1_b,   hdiv_leg_quad_p3p6_b1_b,   hdiv_leg_quad_p3p7_b1_b,   hdiv_leg_quad_p3p8_b1_b,   hdiv_leg_quad_p3p9_b1_b,   hdiv_leg_quad_p3p10_b1_b,   hdiv_leg_quad_p3p11_b1_b,   hdiv_leg_quad_p4p2_b1_b,   hdiv_leg_quad_p4p3_b1_b,   hdiv_leg_quad_p4p4_b1_b,   hdiv_leg_quad_p4p5_b1_b,   hdiv_leg_quad_p4p6_b1_b,   hdiv_leg_quad_p4p7_b1_b,   hdiv_leg_quad_p4p8_b1_b,   hdiv_leg_quad_p4p9_b1_b,   hdiv_leg_quad_p4p10_b1_b,   hdiv_leg_quad_p4p11_b1_b,   hdiv_leg_quad_p5p2_b1_b,   hdiv_leg_quad_p5p3_b1_b,   hdiv_leg_quad_p5p4_b1_b,   hdiv_leg_quad_p5p5_b1_b,   hdiv_leg_quad_p5p6_b1_b,   hdiv_leg_quad_p5p7_b1_b,   hdiv_leg_quad_p5p8_b1_b,   hdiv_leg_quad_p5p9_b1_b,   hdiv_leg_quad_p5p10_b1_b,   hdiv_leg_quad_p5p11_b1_b,   hdiv_leg_quad_p6p2_b1_b,   hdiv_leg_quad_p6p3_b1_b,   hdiv_leg_quad_p6p4_b1_b,   hdiv_leg_quad_p6p5_b1_b,   hdiv_leg_quad_p6p6_b1_b,   hdiv_leg_quad_p6p7_b1_b,   hdiv_leg_quad_p6p8_b1_b,   hdiv_leg_quad_p6p9_b1_b,   hdiv_leg_quad_p6p10_b1_b,   hdiv_leg_quad_p6p11_b1_b,   hdiv_leg_quad_p7p2_b1_b,   hdiv_leg_quad_p7p3_b1_b,   hdiv_leg_quad_p7p4_b1_b,   hdiv_leg_quad_p7p5_b1_b,   hdiv_leg_quad_p7p6_b1_b,   hdiv_leg_quad_p7p7_b1_b,   hdiv_leg_quad_p7p8_b1_b,   hdiv_leg_quad_p7p9_b1_b,   hdiv_leg_quad_p7p10_b1_b,   hdiv_leg_quad_p7p11_b1_b,   hdiv_leg_quad_p8p2_b1_b,   hdiv_leg_quad_p8p3_b1_b,   hdiv_leg_quad_p8p4_b1_b,   hdiv_leg_quad_p8p5_b1_b,   hdiv_leg_quad_p8p6_b1_b,   hdiv_leg_quad_p8p7_b1_b,   hdiv_leg_quad_p8p8_b1_b,   hdiv_leg_quad_p8p9_b1_b,   hdiv_leg_quad_p8p10_b1_b,   hdiv_leg_quad_p8p11_b1_b,   hdiv_leg_quad_p9p2_b1_b,   hdiv_leg_quad_p9p3_b1_b,   hdiv_leg_quad_p9p4_b1_b,   hdiv_leg_quad_p9p5_b1_b,   hdiv_leg_quad_p9p6_b1_b,   hdiv_leg_quad_p9p7_b1_b,   hdiv_leg_quad_p9p8_b1_b,   hdiv_leg_quad_p9p9_b1_b,   hdiv_leg_quad_p9p10_b1_b,   hdiv_leg_quad_p9p11_b1_b,   hdiv_leg_quad_p10p2_b1_b,   hdiv_leg_quad_p10p3_b1_b,   hdiv_leg_quad_p10p4_b1_b,   hdiv_leg_quad_p10p5_b1_b,   hdiv_leg_quad_p10p6_b1_b,   hdiv_leg_quad_p10p7_b1_b,   hdiv_leg_quad_p10p8_b1_b,   hdiv_leg_quad_p10p9_b1_b,   hdiv_leg_quad_p10p10_b1_b,   hdiv_leg_quad_p10p11_b1_b,   hdiv_leg_quad_p2p0_b2_b,   hdiv_leg_quad_p2p1_b2_b,   hdiv_leg_quad_p2p2_b2_b,   hdiv_leg_quad_p2p3_b2_b,   hdiv_leg_quad_p2p4_b2_b,   hdiv_leg_quad_p2p5_b2_b,   hdiv_leg_quad_p2p6_b2_b,   hdiv_leg_quad_p2p7_b2_b,   hdiv_leg_quad_p2p8_b2_b,   hdiv_leg_quad_p2p9_b2_b,   hdiv_leg_quad_p2p10_b2_b,   hdiv_leg_quad_p3p0_b2_b,   hdiv_leg_quad_p3p1_b2_b,   hdiv_leg_quad_p3p2_b2_b,   hdiv_leg_quad_p3p3_b2_b,   hdiv_leg_quad_p3p4_b2_b,   hdiv_leg_quad_p3p5_b2_b,   hdiv_leg_quad_p3p6_b2_b,   hdiv_leg_quad_p3p7_b2_b,   hdiv_leg_quad_p3p8_b2_b,   hdiv_leg_quad_p3p9_b2_b,   hdiv_leg_quad_p3p10_b2_b,   hdiv_leg_quad_p4p0_b2_b,   hdiv_leg_quad_p4p1_b2_b,   hdiv_leg_quad_p4p2_b2_b,   hdiv_leg_quad_p4p3_b2_b,   hdiv_leg_quad_p4p4_b2_b,   hdiv_leg_quad_p4p5_b2_b,   hdiv_leg_quad_p4p6_b2_b,   hdiv_leg_quad_p4p7_b2_b,   hdiv_leg_quad_p4p8_b2_b,   hdiv_leg_quad_p4p9_b2_b,   hdiv_leg_quad_p4p10_b2_b,   hdiv_leg_quad_p5p0_b2_b,   hdiv_leg_quad_p5p1_b2_b,   hdiv_leg_quad_p5p2_b2_b,   hdiv_leg_quad_p5p3_b2_b,   hdiv_leg_quad_p5p4_b2_b,   hdiv_leg_quad_p5p5_b2_b,   hdiv_leg_quad_p5p6_b2_b,   hdiv_leg_quad_p5p7_b2_b,   hdiv_leg_quad_p5p8_b2_b,   hdiv_leg_quad_p5p9_b2_b,   hdiv_leg_quad_p5p10_b2_b,   hdiv_leg_quad_p6p0_b2_b,   hdiv_leg_quad_p6p1_b2_b,   hdiv_leg_quad_p6p2_b2_b,   hdiv_leg_quad_p6p3_b2_b,   hdiv_leg_quad_p6p4_b2_b,   hdiv_leg_quad_p6p5_b2_b,   hdiv_leg_quad_p6p6_b2_b,   hdiv_leg_quad_p6p7_b2_b,   hdiv_leg_quad_p6p8_b2_b,   hdiv_leg_quad_p6p9_b2_b,   hdiv_leg_quad_p6p10_b2_b,   hdiv_leg_quad_p7p0_b2_b,   hdiv_leg_quad_p7p1_b2_b,   hdiv_leg_quad_p7p2_b2_b,   hdiv_leg_quad_p7p3_b2_b,   hdiv_leg_quad_p7p4_b2_b,   hdiv_leg_quad_p7p5_b2_b,   hdiv_leg_quad_p7p6_b2_b,   hdiv_leg_quad_p7p7_b2_b,   hdiv_leg_quad_p7p8_b2_b,   hdiv_leg_quad_p7p9_b2_b,   hdiv_leg_quad_p7p10_b2_b,   hdiv_leg_quad_p8p0_b2_b,   hdiv_leg_quad_p8p1_b2_b,   hdiv_leg_quad_p8p2_b2_b,   hdiv_leg_quad_p8p3_b2_b,   hdiv_leg_quad_p8p4_b2_b,   hdiv_leg_quad_p8p5_b2_b,   hdiv_leg_quad_p8p6_b2_b,   hdiv_leg_quad_p8p7_b2_b,   hdiv_leg_quad_p8p8_b2_b,   hdiv_leg_quad_p8p9_b2_b,   hdiv_leg_quad_p8p10_b2_b,   hdiv_leg_quad_p9p0_b2_b,   hdiv_leg_quad_p9p1_b2_b,   hdiv_leg_quad_p9p2_b2_b,   hdiv_leg_quad_p9p3_b2_b,   hdiv_leg_quad_p9p4_b2_b,   hdiv_leg_quad_p9p5_b2_b,   hdiv_leg_quad_p9p6_b2_b,   hdiv_leg_quad_p9p7_b2_b,   hdiv_leg_quad_p9p8_b2_b,   hdiv_leg_quad_p9p9_b2_b,   hdiv_leg_quad_p9p10_b2_b,   hdiv_leg_quad_p10p0_b2_b,   hdiv_leg_quad_p10p1_b2_b,   hdiv_leg_quad_p10p2_b2_b,   hdiv_leg_quad_p10p3_b2_b,   hdiv_leg_quad_p10p4_b2_b,   hdiv_leg_quad_p10p5_b2_b,   hdiv_leg_quad_p10p6_b2_b,   hdiv_leg_quad_p10p7_b2_b,   hdiv_leg_quad_p10p8_b2_b,   hdiv_leg_quad_p10p9_b2_b,   hdiv_leg_quad_p10p10_b2_b,   hdiv_leg_quad_p11p0_b2_b,   hdiv_leg_quad_p11p1_b2_b,   hdiv_leg_quad_p11p2_b2_b,   hdiv_leg_quad_p11p3_b2_b,   hdiv_leg_quad_p11p4_b2_b,   hdiv_leg_quad_p11p5_b2_b,   hdiv_leg_quad_p11p6_b2_b,   hdiv_leg_quad_p11p7_b2_b,   hdiv_leg_quad_p11p8_b2_b,   hdiv_leg_quad_p11p9_b2_b,   hdiv_leg_quad_p11p10_b2_b, };
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_ax[] =
-    {
-      hdiv_leg_quad_p0_e1_ax_0, hdiv_leg_quad_p0_e1_ax_1, hdiv_leg_quad_p0_e2_ax_0, hdiv_leg_quad_p0_e2_ax_1,  hdiv_leg_quad_p0_e3_ax, hdiv_leg_quad_p0_e3_ax, hdiv_leg_quad_p0_e4_ax, hdiv_leg_quad_p0_e4_ax,
-      hdiv_leg_quad_p1_e1_ax, hdiv_leg_quad_p1_e1_ax, hdiv_leg_quad_p1_e2_ax, hdiv_leg_quad_p1_e2_ax, hdiv_leg_quad_p1_e3_ax, hdiv_leg_quad_p1_e3_ax, hdiv_leg_quad_p1_e4_ax, hdiv_leg_quad_p1_e4_ax,
-      hdiv_leg_quad_p2_e1_ax_0, hdiv_leg_quad_p2_e1_ax_1, hdiv_leg_quad_p2_e2_ax_0, hdiv_leg_quad_p2_e2_ax_1, hdiv_leg_quad_p2_e3_ax, hdiv_leg_quad_p2_e3_ax, hdiv_leg_quad_p2_e4_ax, hdiv_leg_quad_p2_e4_ax,
-      hdiv_leg_quad_p3_e1_ax, hdiv_leg_quad_p3_e1_ax, hdiv_leg_quad_p3_e2_ax, hdiv_leg_quad_p3_e2_ax, hdiv_leg_quad_p3_e3_ax, hdiv_leg_quad_p3_e3_ax, hdiv_leg_quad_p3_e4_ax, hdiv_leg_quad_p3_e4_ax,
-      hdiv_leg_quad_p4_e1_ax_0, hdiv_leg_quad_p4_e1_ax_1, hdiv_leg_quad_p4_e2_ax_0, hdiv_leg_quad_p4_e2_ax_1, hdiv_leg_quad_p4_e3_ax, hdiv_leg_quad_p4_e3_ax, hdiv_leg_quad_p4_e4_ax, hdiv_leg_quad_p4_e4_ax,
-      hdiv_leg_quad_p5_e1_ax, hdiv_leg_quad_p5_e1_ax, hdiv_leg_quad_p5_e2_ax, hdiv_leg_quad_p5_e2_ax, hdiv_leg_quad_p5_e3_ax, hdiv_leg_quad_p5_e3_ax, hdiv_leg_quad_p5_e4_ax, hdiv_leg_quad_p5_e4_ax,
-      hdiv_leg_quad_p6_e1_ax_0, hdiv_leg_quad_p6_e1_ax_1, hdiv_leg_quad_p6_e2_ax_0, hdiv_leg_quad_p6_e2_ax_1, hdiv_leg_quad_p6_e3_ax, hdiv_leg_quad_p6_e3_ax, hdiv_leg_quad_p6_e4_ax, hdiv_leg_quad_p6_e4_ax,
-      hdiv_leg_quad_p7_e1_ax, hdiv_leg_quad_p7_e1_ax, hdiv_leg_quad_p7_e2_ax, hdiv_leg_quad_p7_e2_ax, hdiv_leg_quad_p7_e3_ax, hdiv_leg_quad_p7_e3_ax, hdiv_leg_quad_p7_e4_ax, hdiv_leg_quad_p7_e4_ax,
-      hdiv_leg_quad_p8_e1_ax_0, hdiv_leg_quad_p8_e1_ax_1, hdiv_leg_quad_p8_e2_ax_0, hdiv_leg_quad_p8_e2_ax_1, hdiv_leg_quad_p8_e3_ax, hdiv_leg_quad_p8_e3_ax, hdiv_leg_quad_p8_e4_ax, hdiv_leg_quad_p8_e4_ax,
-      hdiv_leg_quad_p9_e1_ax, hdiv_leg_quad_p9_e1_ax, hdiv_leg_quad_p9_e2_ax, hdiv_leg_quad_p9_e2_ax, hdiv_leg_quad_p9_e3_ax, hdiv_leg_quad_p9_e3_ax, hdiv_leg_quad_p9_e4_ax, hdiv_leg_quad_p9_e4_ax,
-      hdiv_leg_quad_p10_e1_ax_0, hdiv_leg_quad_p10_e1_ax_1, hdiv_leg_quad_p10_e2_ax_0, hdiv_leg_quad_p10_e2_ax_1, hdiv_leg_quad_p10_e3_ax, hdiv_leg_quad_p10_e3_ax, hdiv_leg_quad_p10_e4_ax, hdiv_leg_quad_p10_e4_ax,
-
-      hdiv_leg_quad_p0p2_b1_ax,   hdiv_leg_quad_p0p3_b1_ax,   hdiv_leg_quad_p0p4_b1_ax,   hdiv_leg_quad_p0p5_b1_ax,   hdiv_leg_quad_p0p6_b1_ax,   hdiv_leg_quad_p0p7_b1_ax,   hdiv_leg_quad_p0p8_b1_ax,   hdiv_leg_quad_p0p9_b1_ax,   hdiv_leg_quad_p0p10_b1_ax,   hdiv_leg_quad_p0p11_b1_ax,   hdiv_leg_quad_p1p2_b1_ax,   hdiv_leg_quad_p1p3_b1_ax,   hdiv_leg_quad_p1p4_b1_ax,   hdiv_leg_quad_p1p5_b1_ax,   hdiv_leg_quad_p1p6_b1_ax,   hdiv_leg_quad_p1p7_b1_ax,   hdiv_leg_quad_p1p8_b1_ax,   hdiv_leg_quad_p1p9_b1_ax,   hdiv_leg_quad_p1p10_b1_ax,   hdiv_leg_quad_p1p11_b1_ax,   hdiv_leg_quad_p2p2_b1_ax,   hdiv_leg_quad_p2p3_b1_ax,   hdiv_leg_quad_p2p4_b1_ax,   hdiv_leg_quad_p2p5_b1_ax,   hdiv_leg_quad_p2p6_b1_ax,   hdiv_leg_quad_p2p7_b1_ax,   hdiv_leg_quad_p2p8_b1_ax,   hdiv_leg_quad_p2p9_b1_ax,   hdiv_leg_quad_p2p10_b1_ax,   hdiv_leg_quad_p2p11_b1_ax,   hdiv_leg_quad_p3p2_b1_ax,   hdiv_leg_quad_p3p3_b1_ax,   hdiv_leg_quad_p3p4_b1_ax,   hdiv_leg_quad_p3p5_b1_ax,   hdiv_leg_quad_p3p6_b1_ax,   hdiv_leg_quad_p3p7_b1_ax,   hdiv_leg_quad_p3p8_b1_ax,   hdiv_leg_quad_p3p9_b1_ax,   hdiv_leg_quad_p3p10_b1_ax,   hdiv_leg_quad_p3p11_b1_ax,   hdiv_leg_quad_p4p2_b1_ax,   hdiv_leg_quad_p4p3_b1_ax,   hdiv_leg_quad_p4p4_b1_ax,   hdiv_leg_quad_p4p5_b1_ax,   hdiv_leg_quad_p4p6_b1_ax,   hdiv_leg_quad_p4p7_b1_ax,   hdiv_leg_quad_p4p8_b1_ax,   hdiv_leg_quad_p4p9_b1_ax,   hdiv_leg_quad_p4p10_b1_ax,   hdiv_leg_quad_p4p11_b1_ax,   hdiv_leg_quad_p5p2_b1_ax,   hdiv_leg_quad_p5p3_b1_ax,   hdiv_leg_quad_p5p4_b1_ax,   hdiv_leg_quad_p5p5_b1_ax,   hdiv_leg_quad_p5p6_b1_ax,   hdiv_leg_quad_p5p7_b1_ax,   hdiv_leg_quad_p5p8_b1_ax,   hdiv_leg_quad_p5p9_b1_ax,   hdiv_leg_quad_p5p10_b1_ax,   hdiv_leg_quad_p5p11_b1_ax,   hdiv_leg_quad_p6p2_b1_ax,   hdiv_leg_quad_p6p3_b1_ax,   hdiv_leg_quad_p6p4_b1_ax,   hdiv_leg_quad_p6p5_b1_ax,   hdiv_leg_quad_p6p6_b1_ax,   hdiv_leg_quad_p6p7_b1_ax,   hdiv_leg_quad_p6p8_b1_ax,   hdiv_leg_quad_p6p9_b1_ax,   hdiv_leg_quad_p6p10_b1_ax,   hdiv_leg_quad_p6p11_b1_ax,   hdiv_leg_quad_p7p2_b1_ax,   hdiv_leg_quad_p7p3_b1_ax,   hdiv_leg_quad_p7p4_b1_ax,   hdiv_leg_quad_p7p5_b1_ax,   hdiv_leg_quad_p7p6_b1_ax,   hdiv_leg_quad_p7p7_b1_ax,   hdiv_leg_quad_p7p8_b1_ax,   hdiv_leg_quad_p7p9_b1_ax,   hdiv_leg_quad_p7p10_b1_ax,   hdiv_leg_quad_p7p11_b1_ax,   hdiv_leg_quad_p8p2_b1_ax,   hdiv_leg_quad_p8p3_b1_ax,   hdiv_leg_quad_p8p4_b1_ax,   hdiv_leg_quad_p8p5_b1_ax,   hdiv_leg_quad_p8p6_b1_ax,   hdiv_leg_quad_p8p7_b1_ax,   hdiv_leg_quad_p8p8_b1_ax,   hdiv_leg_quad_p8p9_b1_ax,   hdiv_leg_quad_p8p10_b1_ax,   hdiv_leg_quad_p8p11_b1_ax,   hdiv_leg_quad_p9p2_b1_ax,   hdiv_leg_quad_p9p3_b1_ax,   hdiv_leg_quad_p9p4_b1_ax,   hdiv_leg_quad_p9p5_b1_ax,   hdiv_leg_quad_p9p6_b1_ax,   hdiv_leg_quad_p9p7_b1_ax,   hdiv_leg_quad_p9p8_b1_ax,   hdiv_leg_quad_p9p9_b1_ax,   hdiv_leg_quad_p9p10_b1_ax,   hdiv_leg_quad_p9p11_b1_ax,   hdiv_leg_quad_p10p2_b1_ax,   hdiv_leg_quad_p10p3_b1_ax,   hdiv_leg_quad_p10p4_b1_ax,   hdiv_leg_quad_p10p5_b1_ax,   hdiv_leg_quad_p10p6_b1_ax,   hdiv_leg_quad_p10p7_b1_ax,   hdiv_leg_quad_p10p8_b1_ax,   hdiv_leg_quad_p10p9_b1_ax,   hdiv_leg_quad_p10p10_b1_ax,   hdiv_leg_quad_p10p11_b1_ax,   hdiv_leg_quad_p2p0_b2_ax,   hdiv_leg_quad_p2p1_b2_ax,   hdiv_leg_quad_p2p2_b2_ax,   hdiv_leg_quad_p2p3_b2_ax,   hdiv_leg_quad_p2p4_b2_ax,   hdiv_leg_quad_p2p5_b2_ax,   hdiv_leg_quad_p2p6_b2_ax,   hdiv_leg_quad_p2p7_b2_ax,   hdiv_leg_quad_p2p8_b2_ax,   hdiv_leg_quad_p2p9_b2_ax,   hdiv_leg_quad_p2p10_b2_ax,   hdiv_leg_quad_p3p0_b2_ax,   hdiv_leg_quad_p3p1_b2_ax,   hdiv_leg_quad_p3p2_b2_ax,   hdiv_leg_quad_p3p3_b2_ax,   hdiv_leg_quad_p3p4_b2_ax,   hdiv_leg_quad_p3p5_b2_ax,   hdiv_leg_quad_p3p6_b2_ax,   hdiv_leg_quad_p3p7_b2_ax,   hdiv_leg_quad_p3p8_b2_ax,   hdiv_leg_quad_p3p9_b2_ax,   hdiv_leg_quad_p3p10_b2_ax,   hdiv_leg_quad_p4p0_b2_ax,   hdiv_leg_quad_p4p1_b2_ax,   hdiv_leg_quad_p4p2_b2_ax,   hdiv_leg_quad_p4p3_b2_ax,   hdiv_leg_quad_p4p4_b2_ax,   hdiv_leg_quad_p4p5_b2_ax,   hdiv_leg_quad_p4p6_b2_ax,   hdiv_leg_quad_p4p7_b2_ax,   hdiv_leg_quad_p4p8_b2_ax,   hdiv_leg_quad_p4p9_b2_ax,   hdiv_leg_quad_p4p10_b2_ax,   hdiv_leg_quad_p5p0_b2_ax,   hdiv_leg_quad_p5p1_b2_ax,   hdiv_leg_quad_p5p2_b2_ax,   hdiv_leg_quad_p5p3_b2_ax,   hdiv_leg_quad_p5p4_b2_ax,   hdiv_leg_quad_p5p5_b2_ax,   hdiv_leg_quad_p5p6_b2_ax,   hdiv_leg_quad_p5p7_b2_ax,   hdiv_leg_quad_p5p8_b2_ax,   hdiv_leg_quad_p5p9_b2_ax,   hdiv_leg_quad_p5p10_b2_ax,   hdiv_leg_quad_p6p0_b2_ax,   hdiv_leg_quad_p6p1_b2_ax,   hdiv_leg_quad_p6p2_b2_ax,   hdiv_leg_quad_p6p3_b2_ax,   hdiv_leg_quad_p6p4_b2_ax,   hdiv_leg_quad_p6p5_b2_ax,   hdiv_leg_quad_p6p6_b2_ax,   hdiv_leg_quad_p6p7_b2_ax,   hdiv_leg_quad_p6p8_b2_ax,   hdiv_leg_quad_p6p9_b2_ax,   hdiv_leg_quad_p6p10_b2_ax,   hdiv_leg_quad_p7p0_b2_ax,   hdiv_leg_quad_p7p1_b2_ax,   hdiv_leg_quad_p7p2_b2_ax,   hdiv_leg_quad_p7p3_b2_ax,   hdiv_leg_quad_p7p4_b2_ax,   hdiv_leg_quad_p7p5_b2_ax,   hdiv_leg_quad_p7p6_b2_ax,   hdiv_leg_quad_p7p7_b2_ax,   hdiv_leg_quad_p7p8_b2_ax,   hdiv_leg_quad_p7p9_b2_ax,   hdiv_leg_quad_p7p10_b2_ax,   hdiv_leg_quad_p8p0_b2_ax,   hdiv_leg_quad_p8p1_b2_ax,   hdiv_leg_quad_p8p2_b2_ax,   hdiv_leg_quad_p8p3_b2_ax,   hdiv_leg_quad_p8p4_b2_ax,   hdiv_leg_quad_p8p5_b2_ax,   hdiv_leg_quad_p8p6_b2_ax,   hdiv_leg_quad_p8p7_b2_ax,   hdiv_leg_quad_p8p8_b2_ax,   hdiv_leg_quad_p8p9_b2_ax,   hdiv_leg_quad_p8p10_b2_ax,   hdiv_leg_quad_p9p0_b2_ax,   hdiv_leg_quad_p9p1_b2_ax,   hdiv_leg_quad_p9p2_b2_ax,   hdiv_leg_quad_p9p3_b2_ax,   hdiv_leg_quad_p9p4_b2_ax,   hdiv_leg_quad_p9p5_b2_ax,   hdiv_leg_quad_p9p6_b2_ax,   hdiv_leg_quad_p9p7_b2_ax,   hdiv_leg_quad_p9p8_b2_ax,   hdiv_leg_quad_p9p9_b2_ax,   hdiv_leg_quad_p9p10_b2_ax,   hdiv_leg_quad_p10p0_b2_ax,   hdiv_leg_quad_p10p1_b2_ax,   hdiv_leg_quad_p10p2_b2_ax,   hdiv_leg_quad_p10p3_b2_ax,   hdiv_leg_quad_p10p4_b2_ax,   hdiv_leg_quad_p10p5_b2_ax,   hdiv_leg_quad_p10p6_b2_ax,   hdiv_leg_quad_p10p7_b2_ax,   hdiv_leg_quad_p10p8_b2_ax,   hdiv_leg_quad_p10p9_b2_ax,   hdiv_leg_quad_p10p10_b2_ax,   hdiv_leg_quad_p11p0_b2_ax,   hdiv_leg_quad_p11p1_b2_ax,   hdiv_leg_quad_p11p2_b2_ax,   hdiv_leg_quad_p11p3_b2_ax,   hdiv_leg_quad_p11p4_b2_ax,   hdiv_leg_quad_p11p5_b2_ax,   hdiv_leg_quad_p11p6_b2_ax,   hdiv_leg_quad_p11p7_b2_ax,   hdiv_leg_quad_p11p8_b2_ax,   hdiv_leg_quad_p11p9_b2_ax,   hdiv_leg_quad_p11p10_b2_ax, };
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_bx[] =
-    {
-      hdiv_leg_quad_p0_e1_bx, hdiv_leg_quad_p0_e1_bx, hdiv_leg_quad_p0_e2_bx, hdiv_leg_quad_p0_e2_bx, hdiv_leg_quad_p0_e3_bx_0, hdiv_leg_quad_p0_e3_bx_1, hdiv_leg_quad_p0_e4_bx_0, hdiv_leg_quad_p0_e4_bx_1,
-      hdiv_leg_quad_p1_e1_bx, hdiv_leg_quad_p1_e1_bx, hdiv_leg_quad_p1_e2_bx, hdiv_leg_quad_p1_e2_bx, hdiv_leg_quad_p1_e3_bx, hdiv_leg_quad_p1_e3_bx, hdiv_leg_quad_p1_e4_bx, hdiv_leg_quad_p1_e4_bx,
-      hdiv_leg_quad_p2_e1_bx, hdiv_leg_quad_p2_e1_bx, hdiv_leg_quad_p2_e2_bx, hdiv_leg_quad_p2_e2_bx, hdiv_leg_quad_p2_e3_bx_0, hdiv_leg_quad_p2_e3_bx_1, hdiv_leg_quad_p2_e4_bx_0, hdiv_leg_quad_p2_e4_bx_1,
-      hdiv_leg_quad_p3_e1_bx, hdiv_leg_quad_p3_e1_bx, hdiv_leg_quad_p3_e2_bx, hdiv_leg_quad_p3_e2_bx, hdiv_leg_quad_p3_e3_bx, hdiv_leg_quad_p3_e3_bx, hdiv_leg_quad_p3_e4_bx, hdiv_leg_quad_p3_e4_bx,
-      hdiv_leg_quad_p4_e1_bx, hdiv_leg_quad_p4_e1_bx, hdiv_leg_quad_p4_e2_bx, hdiv_leg_quad_p4_e2_bx, hdiv_leg_quad_p4_e3_bx_0, hdiv_leg_quad_p4_e3_bx_1, hdiv_leg_quad_p4_e4_bx_0, hdiv_leg_quad_p4_e4_bx_1,
-      hdiv_leg_quad_p5_e1_bx, hdiv_leg_quad_p5_e1_bx, hdiv_leg_quad_p5_e2_bx, hdiv_leg_quad_p5_e2_bx, hdiv_leg_quad_p5_e3_bx, hdiv_leg_quad_p5_e3_bx, hdiv_leg_quad_p5_e4_bx, hdiv_leg_quad_p5_e4_bx,
-      hdiv_leg_quad_p6_e1_bx, hdiv_leg_quad_p6_e1_bx, hdiv_leg_quad_p6_e2_bx, hdiv_leg_quad_p6_e2_bx, hdiv_leg_quad_p6_e3_bx_0, hdiv_leg_quad_p6_e3_bx_1, hdiv_leg_quad_p6_e4_bx_0, hdiv_leg_quad_p6_e4_bx_1,
-      hdiv_leg_quad_p7_e1_bx, hdiv_leg_quad_p7_e1_bx, hdiv_leg_quad_p7_e2_bx, hdiv_leg_quad_p7_e2_bx, hdiv_leg_quad_p7_e3_bx, hdiv_leg_quad_p7_e3_bx, hdiv_leg_quad_p7_e4_bx, hdiv_leg_quad_p7_e4_bx,
-      hdiv_leg_quad_p8_e1_bx, hdiv_leg_quad_p8_e1_bx, hdiv_leg_quad_p8_e2_bx, hdiv_leg_quad_p8_e2_bx, hdiv_leg_quad_p8_e3_bx_0, hdiv_leg_quad_p8_e3_bx_1, hdiv_leg_quad_p8_e4_bx_0, hdiv_leg_quad_p8_e4_bx_1,
-      hdiv_leg_quad_p9_e1_bx, hdiv_leg_quad_p9_e1_bx, hdiv_leg_quad_p9_e2_bx, hdiv_leg_quad_p9_e2_bx, hdiv_leg_quad_p9_e3_bx, hdiv_leg_quad_p9_e3_bx, hdiv_leg_quad_p9_e4_bx, hdiv_leg_quad_p9_e4_bx,
-      hdiv_leg_quad_p10_e1_bx, hdiv_leg_quad_p10_e1_bx, hdiv_leg_quad_p10_e2_bx, hdiv_leg_quad_p10_e2_bx, hdiv_leg_quad_p10_e3_bx_0, hdiv_leg_quad_p10_e3_bx_1, hdiv_leg_quad_p10_e4_bx_0, hdiv_leg_quad_p10_e4_bx_1,
-
-      hdiv_leg_quad_p0p2_b1_bx,   hdiv_leg_quad_p0p3_b1_bx,   hdiv_leg_quad_p0p4_b1_bx,   hdiv_leg_quad_p0p5_b1_bx,   hdiv_leg_quad_p0p6_b1_bx,   hdiv_leg_quad_p0p7_b1_bx,   hdiv_leg_quad_p0p8_b1_bx,   hdiv_leg_quad_p0p9_b1_bx,   hdiv_leg_quad_p0p10_b1_bx,   hdiv_leg_quad_p0p11_b1_bx,   hdiv_leg_quad_p1p2_b1_bx,   hdiv_leg_quad_p1p3_b1_bx,   hdiv_leg_quad_p1p4_b1_bx,   hdiv_leg_quad_p1p5_b1_bx,   hdiv_leg_quad_p1p6_b1_bx,   hdiv_leg_quad_p1p7_b1_bx,   hdiv_leg_quad_p1p8_b1_bx,   hdiv_leg_quad_p1p9_b1_bx,   hdiv_leg_quad_p1p10_b1_bx,   hdiv_leg_quad_p1p11_b1_bx,   hdiv_leg_quad_p2p2_b1_bx,   hdiv_leg_quad_p2p3_b1_bx,   hdiv_leg_quad_p2p4_b1_bx,   hdiv_leg_quad_p2p5_b1_bx,   hdiv_leg_quad_p2p6_b1_bx,   hdiv_leg_quad_p2p7_b1_bx,   hdiv_leg_quad_p2p8_b1_bx,   hdiv_leg_quad_p2p9_b1_bx,   hdiv_leg_quad_p2p10_b1_bx,   hdiv_leg_quad_p2p11_b1_bx,   hdiv_leg_quad_p3p2_b1_bx,   hdiv_leg_quad_p3p3_b1_bx,   hdiv_leg_quad_p3p4_b1_bx,   hdiv_leg_quad_p3p5_b1_bx,   hdiv_leg_quad_p3p6_b1_bx,   hdiv_leg_quad_p3p7_b1_bx,   hdiv_leg_quad_p3p8_b1_bx,   hdiv_leg_quad_p3p9_b1_bx,   hdiv_leg_quad_p3p10_b1_bx,   hdiv_leg_quad_p3p11_b1_bx,   hdiv_leg_quad_p4p2_b1_bx,   hdiv_leg_quad_p4p3_b1_bx,   hdiv_leg_quad_p4p4_b1_bx,   hdiv_leg_quad_p4p5_b1_bx,   hdiv_leg_quad_p4p6_b1_bx,   hdiv_leg_quad_p4p7_b1_bx,   hdiv_leg_quad_p4p8_b1_bx,   hdiv_leg_quad_p4p9_b1_bx,   hdiv_leg_quad_p4p10_b1_bx,   hdiv_leg_quad_p4p11_b1_bx,   hdiv_leg_quad_p5p2_b1_bx,   hdiv_leg_quad_p5p3_b1_bx,   hdiv_leg_quad_p5p4_b1_bx,   hdiv_leg_quad_p5p5_b1_bx,   hdiv_leg_quad_p5p6_b1_bx,   hdiv_leg_quad_p5p7_b1_bx,   hdiv_leg_quad_p5p8_b1_bx,   hdiv_leg_quad_p5p9_b1_bx,   hdiv_leg_quad_p5p10_b1_bx,   hdiv_leg_quad_p5p11_b1_bx,   hdiv_leg_quad_p6p2_b1_bx,   hdiv_leg_quad_p6p3_b1_bx,   hdiv_leg_quad_p6p4_b1_bx,   hdiv_leg_quad_p6p5_b1_bx,   hdiv_leg_quad_p6p6_b1_bx,   hdiv_leg_quad_p6p7_b1_bx,   hdiv_leg_quad_p6p8_b1_bx,   hdiv_leg_quad_p6p9_b1_bx,   hdiv_leg_quad_p6p10_b1_bx,   hdiv_leg_quad_p6p11_b1_bx,   hdiv_leg_quad_p7p2_b1_bx,   hdiv_leg_quad_p7p3_b1_bx,   hdiv_leg_quad_p7p4_b1_bx,   hdiv_leg_quad_p7p5_b1_bx,   hdiv_leg_quad_p7p6_b1_bx,   hdiv_leg_quad_p7p7_b1_bx,   hdiv_leg_quad_p7p8_b1_bx,   hdiv_leg_quad_p7p9_b1_bx,   hdiv_leg_quad_p7p10_b1_bx,   hdiv_leg_quad_p7p11_b1_bx,   hdiv_leg_quad_p8p2_b1_bx,   hdiv_leg_quad_p8p3_b1_bx,   hdiv_leg_quad_p8p4_b1_bx,   hdiv_leg_quad_p8p5_b1_bx,   hdiv_leg_quad_p8p6_b1_bx,   hdiv_leg_quad_p8p7_b1_bx,   hdiv_leg_quad_p8p8_b1_bx,   hdiv_leg_quad_p8p9_b1_bx,   hdiv_leg_quad_p8p10_b1_bx,   hdiv_leg_quad_p8p11_b1_bx,   hdiv_leg_quad_p9p2_b1_bx,   hdiv_leg_quad_p9p3_b1_bx,   hdiv_leg_quad_p9p4_b1_bx,   hdiv_leg_quad_p9p5_b1_bx,   hdiv_leg_quad_p9p6_b1_bx,   hdiv_leg_quad_p9p7_b1_bx,   hdiv_leg_quad_p9p8_b1_bx,   hdiv_leg_quad_p9p9_b1_bx,   hdiv_leg_quad_p9p10_b1_bx,   hdiv_leg_quad_p9p11_b1_bx,   hdiv_leg_quad_p10p2_b1_bx,   hdiv_leg_quad_p10p3_b1_bx,   hdiv_leg_quad_p10p4_b1_bx,   hdiv_leg_quad_p10p5_b1_bx,   hdiv_leg_quad_p10p6_b1_bx,   hdiv_leg_quad_p10p7_b1_bx,   hdiv_leg_quad_p10p8_b1_bx,   hdiv_leg_quad_p10p9_b1_bx,   hdiv_leg_quad_p10p10_b1_bx,   hdiv_leg_quad_p10p11_b1_bx,   hdiv_leg_quad_p2p0_b2_bx,   hdiv_leg_quad_p2p1_b2_bx,   hdiv_leg_quad_p2p2_b2_bx,   hdiv_leg_quad_p2p3_b2_bx,   hdiv_leg_quad_p2p4_b2_bx,   hdiv_leg_quad_p2p5_b2_bx,   hdiv_leg_quad_p2p6_b2_bx,   hdiv_leg_quad_p2p7_b2_bx,   hdiv_leg_quad_p2p8_b2_bx,   hdiv_leg_quad_p2p9_b2_bx,   hdiv_leg_quad_p2p10_b2_bx,   hdiv_leg_quad_p3p0_b2_bx,   hdiv_leg_quad_p3p1_b2_bx,   hdiv_leg_quad_p3p2_b2_bx,   hdiv_leg_quad_p3p3_b2_bx,   hdiv_leg_quad_p3p4_b2_bx,   hdiv_leg_quad_p3p5_b2_bx,   hdiv_leg_quad_p3p6_b2_bx,   hdiv_leg_quad_p3p7_b2_bx,   hdiv_leg_quad_p3p8_b2_bx,   hdiv_leg_quad_p3p9_b2_bx,   hdiv_leg_quad_p3p10_b2_bx,   hdiv_leg_quad_p4p0_b2_bx,   hdiv_leg_quad_p4p1_b2_bx,   hdiv_leg_quad_p4p2_b2_bx,   hdiv_leg_quad_p4p3_b2_bx,   hdiv_leg_quad_p4p4_b2_bx,   hdiv_leg_quad_p4p5_b2_bx,   hdiv_leg_quad_p4p6_b2_bx,   hdiv_leg_quad_p4p7_b2_bx,   hdiv_leg_quad_p4p8_b2_bx,   hdiv_leg_quad_p4p9_b2_bx,   hdiv_leg_quad_p4p10_b2_bx,   hdiv_leg_quad_p5p0_b2_bx,   hdiv_leg_quad_p5p1_b2_bx,   hdiv_leg_quad_p5p2_b2_bx,   hdiv_leg_quad_p5p3_b2_bx,   hdiv_leg_quad_p5p4_b2_bx,   hdiv_leg_quad_p5p5_b2_bx,   hdiv_leg_quad_p5p6_b2_bx,   hdiv_leg_quad_p5p7_b2_bx,   hdiv_leg_quad_p5p8_b2_bx,   hdiv_leg_quad_p5p9_b2_bx,   hdiv_leg_quad_p5p10_b2_bx,   hdiv_leg_quad_p6p0_b2_bx,   hdiv_leg_quad_p6p1_b2_bx,   hdiv_leg_quad_p6p2_b2_bx,   hdiv_leg_quad_p6p3_b2_bx,   hdiv_leg_quad_p6p4_b2_bx,   hdiv_leg_quad_p6p5_b2_bx,   hdiv_leg_quad_p6p6_b2_bx,   hdiv_leg_quad_p6p7_b2_bx,   hdiv_leg_quad_p6p8_b2_bx,   hdiv_leg_quad_p6p9_b2_bx,   hdiv_leg_quad_p6p10_b2_bx,   hdiv_leg_quad_p7p0_b2_bx,   hdiv_leg_quad_p7p1_b2_bx,   hdiv_leg_quad_p7p2_b2_bx,   hdiv_leg_quad_p7p3_b2_bx,   hdiv_leg_quad_p7p4_b2_bx,   hdiv_leg_quad_p7p5_b2_bx,   hdiv_leg_quad_p7p6_b2_bx,   hdiv_leg_quad_p7p7_b2_bx,   hdiv_leg_quad_p7p8_b2_bx,   hdiv_leg_quad_p7p9_b2_bx,   hdiv_leg_quad_p7p10_b2_bx,   hdiv_leg_quad_p8p0_b2_bx,   hdiv_leg_quad_p8p1_b2_bx,   hdiv_leg_quad_p8p2_b2_bx,   hdiv_leg_quad_p8p3_b2_bx,   hdiv_leg_quad_p8p4_b2_bx,   hdiv_leg_quad_p8p5_b2_bx,   hdiv_leg_quad_p8p6_b2_bx,   hdiv_leg_quad_p8p7_b2_bx,   hdiv_leg_quad_p8p8_b2_bx,   hdiv_leg_quad_p8p9_b2_bx,   hdiv_leg_quad_p8p10_b2_bx,   hdiv_leg_quad_p9p0_b2_bx,   hdiv_leg_quad_p9p1_b2_bx,   hdiv_leg_quad_p9p2_b2_bx,   hdiv_leg_quad_p9p3_b2_bx,   hdiv_leg_quad_p9p4_b2_bx,   hdiv_leg_quad_p9p5_b2_bx,   hdiv_leg_quad_p9p6_b2_bx,   hdiv_leg_quad_p9p7_b2_bx,   hdiv_leg_quad_p9p8_b2_bx,   hdiv_leg_quad_p9p9_b2_bx,   hdiv_leg_quad_p9p10_b2_bx,   hdiv_leg_quad_p10p0_b2_bx,   hdiv_leg_quad_p10p1_b2_bx,   hdiv_leg_quad_p10p2_b2_bx,   hdiv_leg_quad_p10p3_b2_bx,   hdiv_leg_quad_p10p4_b2_bx,   hdiv_leg_quad_p10p5_b2_bx,   hdiv_leg_quad_p10p6_b2_bx,   hdiv_leg_quad_p10p7_b2_bx,   hdiv_leg_quad_p10p8_b2_bx,   hdiv_leg_quad_p10p9_b2_bx,   hdiv_leg_quad_p10p10_b2_bx,   hdiv_leg_quad_p11p0_b2_bx,   hdiv_leg_quad_p11p1_b2_bx,   hdiv_leg_quad_p11p2_b2_bx,   hdiv_leg_quad_p11p3_b2_bx,   hdiv_leg_quad_p11p4_b2_bx,   hdiv_leg_quad_p11p5_b2_bx,   hdiv_leg_quad_p11p6_b2_bx,   hdiv_leg_quad_p11p7_b2_bx,   hdiv_leg_quad_p11p8_b2_bx,   hdiv_leg_quad_p11p9_b2_bx,   hdiv_leg_quad_p11p10_b2_bx, };
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_ay[] =
-    {
-      hdiv_leg_quad_p0_e1_ay_0, hdiv_leg_quad_p0_e1_ay_1, hdiv_leg_quad_p0_e2_ay_0, hdiv_leg_quad_p0_e2_ay_1,  hdiv_leg_quad_p0_e3_ay, hdiv_leg_quad_p0_e3_ay, hdiv_leg_quad_p0_e4_ay, hdiv_leg_quad_p0_e4_ay,
-      hdiv_leg_quad_p1_e1_ay, hdiv_leg_quad_p1_e1_ay, hdiv_leg_quad_p1_e2_ay, hdiv_leg_quad_p1_e2_ay, hdiv_leg_quad_p1_e3_ay, hdiv_leg_quad_p1_e3_ay, hdiv_leg_quad_p1_e4_ay, hdiv_leg_quad_p1_e4_ay,
-      hdiv_leg_quad_p2_e1_ay_0, hdiv_leg_quad_p2_e1_ay_1, hdiv_leg_quad_p2_e2_ay_0, hdiv_leg_quad_p2_e2_ay_1, hdiv_leg_quad_p2_e3_ay, hdiv_leg_quad_p2_e3_ay, hdiv_leg_quad_p2_e4_ay, hdiv_leg_quad_p2_e4_ay,
-      hdiv_leg_quad_p3_e1_ay, hdiv_leg_quad_p3_e1_ay, hdiv_leg_quad_p3_e2_ay, hdiv_leg_quad_p3_e2_ay, hdiv_leg_quad_p3_e3_ay, hdiv_leg_quad_p3_e3_ay, hdiv_leg_quad_p3_e4_ay, hdiv_leg_quad_p3_e4_ay,
-      hdiv_leg_quad_p4_e1_ay_0, hdiv_leg_quad_p4_e1_ay_1, hdiv_leg_quad_p4_e2_ay_0, hdiv_leg_quad_p4_e2_ay_1, hdiv_leg_quad_p4_e3_ay, hdiv_leg_quad_p4_e3_ay, hdiv_leg_quad_p4_e4_ay, hdiv_leg_quad_p4_e4_ay,
-      hdiv_leg_quad_p5_e1_ay, hdiv_leg_quad_p5_e1_ay, hdiv_leg_quad_p5_e2_ay, hdiv_leg_quad_p5_e2_ay, hdiv_leg_quad_p5_e3_ay, hdiv_leg_quad_p5_e3_ay, hdiv_leg_quad_p5_e4_ay, hdiv_leg_quad_p5_e4_ay,
-      hdiv_leg_quad_p6_e1_ay_0, hdiv_leg_quad_p6_e1_ay_1, hdiv_leg_quad_p6_e2_ay_0, hdiv_leg_quad_p6_e2_ay_1, hdiv_leg_quad_p6_e3_ay, hdiv_leg_quad_p6_e3_ay, hdiv_leg_quad_p6_e4_ay, hdiv_leg_quad_p6_e4_ay,
-      hdiv_leg_quad_p7_e1_ay, hdiv_leg_quad_p7_e1_ay, hdiv_leg_quad_p7_e2_ay, hdiv_leg_quad_p7_e2_ay, hdiv_leg_quad_p7_e3_ay, hdiv_leg_quad_p7_e3_ay, hdiv_leg_quad_p7_e4_ay, hdiv_leg_quad_p7_e4_ay,
-      hdiv_leg_quad_p8_e1_ay_0, hdiv_leg_quad_p8_e1_ay_1, hdiv_leg_quad_p8_e2_ay_0, hdiv_leg_quad_p8_e2_ay_1, hdiv_leg_quad_p8_e3_ay, hdiv_leg_quad_p8_e3_ay, hdiv_leg_quad_p8_e4_ay, hdiv_leg_quad_p8_e4_ay,
-      hdiv_leg_quad_p9_e1_ay, hdiv_leg_quad_p9_e1_ay, hdiv_leg_quad_p9_e2_ay, hdiv_leg_quad_p9_e2_ay, hdiv_leg_quad_p9_e3_ay, hdiv_leg_quad_p9_e3_ay, hdiv_leg_quad_p9_e4_ay, hdiv_leg_quad_p9_e4_ay,
-      hdiv_leg_quad_p10_e1_ay_0, hdiv_leg_quad_p10_e1_ay_1, hdiv_leg_quad_p10_e2_ay_0, hdiv_leg_quad_p10_e2_ay_1, hdiv_leg_quad_p10_e3_ay, hdiv_leg_quad_p10_e3_ay, hdiv_leg_quad_p10_e4_ay, hdiv_leg_quad_p10_e4_ay,
-
-      hdiv_leg_quad_p0p2_b1_ay,   hdiv_leg_quad_p0p3_b1_ay,   hdiv_leg_quad_p0p4_b1_ay,   hdiv_leg_quad_p0p5_b1_ay,   hdiv_leg_quad_p0p6_b1_ay,   hdiv_leg_quad_p0p7_b1_ay,   hdiv_leg_quad_p0p8_b1_ay,   hdiv_leg_quad_p0p9_b1_ay,   hdiv_leg_quad_p0p10_b1_ay,   hdiv_leg_quad_p0p11_b1_ay,   hdiv_leg_quad_p1p2_b1_ay,   hdiv_leg_quad_p1p3_b1_ay,   hdiv_leg_quad_p1p4_b1_ay,   hdiv_leg_quad_p1p5_b1_ay,   hdiv_leg_quad_p1p6_b1_ay,   hdiv_leg_quad_p1p7_b1_ay,   hdiv_leg_quad_p1p8_b1_ay,   hdiv_leg_quad_p1p9_b1_ay,   hdiv_leg_quad_p1p10_b1_ay,   hdiv_leg_quad_p1p11_b1_ay,   hdiv_leg_quad_p2p2_b1_ay,   hdiv_leg_quad_p2p3_b1_ay,   hdiv_leg_quad_p2p4_b1_ay,   hdiv_leg_quad_p2p5_b1_ay,   hdiv_leg_quad_p2p6_b1_ay,   hdiv_leg_quad_p2p7_b1_ay,   hdiv_leg_quad_p2p8_b1_ay,   hdiv_leg_quad_p2p9_b1_ay,   hdiv_leg_quad_p2p10_b1_ay,   hdiv_leg_quad_p2p11_b1_ay,   hdiv_leg_quad_p3p2_b1_ay,   hdiv_leg_quad_p3p3_b1_ay,   hdiv_leg_quad_p3p4_b1_ay,   hdiv_leg_quad_p3p5_b1_ay,   hdiv_leg_quad_p3p6_b1_ay,   hdiv_leg_quad_p3p7_b1_ay,   hdiv_leg_quad_p3p8_b1_ay,   hdiv_leg_quad_p3p9_b1_ay,   hdiv_leg_quad_p3p10_b1_ay,   hdiv_leg_quad_p3p11_b1_ay,   hdiv_leg_quad_p4p2_b1_ay,   hdiv_leg_quad_p4p3_b1_ay,   hdiv_leg_quad_p4p4_b1_ay,   hdiv_leg_quad_p4p5_b1_ay,   hdiv_leg_quad_p4p6_b1_ay,   hdiv_leg_quad_p4p7_b1_ay,   hdiv_leg_quad_p4p8_b1_ay,   hdiv_leg_quad_p4p9_b1_ay,   hdiv_leg_quad_p4p10_b1_ay,   hdiv_leg_quad_p4p11_b1_ay,   hdiv_leg_quad_p5p2_b1_ay,   hdiv_leg_quad_p5p3_b1_ay,   hdiv_leg_quad_p5p4_b1_ay,   hdiv_leg_quad_p5p5_b1_ay,   hdiv_leg_quad_p5p6_b1_ay,   hdiv_leg_quad_p5p7_b1_ay,   hdiv_leg_quad_p5p8_b1_ay,   hdiv_leg_quad_p5p9_b1_ay,   hdiv_leg_quad_p5p10_b1_ay,   hdiv_leg_quad_p5p11_b1_ay,   hdiv_leg_quad_p6p2_b1_ay,   hdiv_leg_quad_p6p3_b1_ay,   hdiv_leg_quad_p6p4_b1_ay,   hdiv_leg_quad_p6p5_b1_ay,   hdiv_leg_quad_p6p6_b1_ay,   hdiv_leg_quad_p6p7_b1_ay,   hdiv_leg_quad_p6p8_b1_ay,   hdiv_leg_quad_p6p9_b1_ay,   hdiv_leg_quad_p6p10_b1_ay,   hdiv_leg_quad_p6p11_b1_ay,   hdiv_leg_quad_p7p2_b1_ay,   hdiv_leg_quad_p7p3_b1_ay,   hdiv_leg_quad_p7p4_b1_ay,   hdiv_leg_quad_p7p5_b1_ay,   hdiv_leg_quad_p7p6_b1_ay,   hdiv_leg_quad_p7p7_b1_ay,   hdiv_leg_quad_p7p8_b1_ay,   hdiv_leg_quad_p7p9_b1_ay,   hdiv_leg_quad_p7p10_b1_ay,   hdiv_leg_quad_p7p11_b1_ay,   hdiv_leg_quad_p8p2_b1_ay,   hdiv_leg_quad_p8p3_b1_ay,   hdiv_leg_quad_p8p4_b1_ay,   hdiv_leg_quad_p8p5_b1_ay,   hdiv_leg_quad_p8p6_b1_ay,   hdiv_leg_quad_p8p7_b1_ay,   hdiv_leg_quad_p8p8_b1_ay,   hdiv_leg_quad_p8p9_b1_ay,   hdiv_leg_quad_p8p10_b1_ay,   hdiv_leg_quad_p8p11_b1_ay,   hdiv_leg_quad_p9p2_b1_ay,   hdiv_leg_quad_p9p3_b1_ay,   hdiv_leg_quad_p9p4_b1_ay,   hdiv_leg_quad_p9p5_b1_ay,   hdiv_leg_quad_p9p6_b1_ay,   hdiv_leg_quad_p9p7_b1_ay,   hdiv_leg_quad_p9p8_b1_ay,   hdiv_leg_quad_p9p9_b1_ay,   hdiv_leg_quad_p9p10_b1_ay,   hdiv_leg_quad_p9p11_b1_ay,   hdiv_leg_quad_p10p2_b1_ay,   hdiv_leg_quad_p10p3_b1_ay,   hdiv_leg_quad_p10p4_b1_ay,   hdiv_leg_quad_p10p5_b1_ay,   hdiv_leg_quad_p10p6_b1_ay,   hdiv_leg_quad_p10p7_b1_ay,   hdiv_leg_quad_p10p8_b1_ay,   hdiv_leg_quad_p10p9_b1_ay,   hdiv_leg_quad_p10p10_b1_ay,   hdiv_leg_quad_p10p11_b1_ay,   hdiv_leg_quad_p2p0_b2_ay,   hdiv_leg_quad_p2p1_b2_ay,   hdiv_leg_quad_p2p2_b2_ay,   hdiv_leg_quad_p2p3_b2_ay,   hdiv_leg_quad_p2p4_b2_ay,   hdiv_leg_quad_p2p5_b2_ay,   hdiv_leg_quad_p2p6_b2_ay,   hdiv_leg_quad_p2p7_b2_ay,   hdiv_leg_quad_p2p8_b2_ay,   hdiv_leg_quad_p2p9_b2_ay,   hdiv_leg_quad_p2p10_b2_ay,   hdiv_leg_quad_p3p0_b2_ay,   hdiv_leg_quad_p3p1_b2_ay,   hdiv_leg_quad_p3p2_b2_ay,   hdiv_leg_quad_p3p3_b2_ay,   hdiv_leg_quad_p3p4_b2_ay,   hdiv_leg_quad_p3p5_b2_ay,   hdiv_leg_quad_p3p6_b2_ay,   hdiv_leg_quad_p3p7_b2_ay,   hdiv_leg_quad_p3p8_b2_ay,   hdiv_leg_quad_p3p9_b2_ay,   hdiv_leg_quad_p3p10_b2_ay,   hdiv_leg_quad_p4p0_b2_ay,   hdiv_leg_quad_p4p1_b2_ay,   hdiv_leg_quad_p4p2_b2_ay,   hdiv_leg_quad_p4p3_b2_ay,   hdiv_leg_quad_p4p4_b2_ay,   hdiv_leg_quad_p4p5_b2_ay,   hdiv_leg_quad_p4p6_b2_ay,   hdiv_leg_quad_p4p7_b2_ay,   hdiv_leg_quad_p4p8_b2_ay,   hdiv_leg_quad_p4p9_b2_ay,   hdiv_leg_quad_p4p10_b2_ay,   hdiv_leg_quad_p5p0_b2_ay,   hdiv_leg_quad_p5p1_b2_ay,   hdiv_leg_quad_p5p2_b2_ay,   hdiv_leg_quad_p5p3_b2_ay,   hdiv_leg_quad_p5p4_b2_ay,   hdiv_leg_quad_p5p5_b2_ay,   hdiv_leg_quad_p5p6_b2_ay,   hdiv_leg_quad_p5p7_b2_ay,   hdiv_leg_quad_p5p8_b2_ay,   hdiv_leg_quad_p5p9_b2_ay,   hdiv_leg_quad_p5p10_b2_ay,   hdiv_leg_quad_p6p0_b2_ay,   hdiv_leg_quad_p6p1_b2_ay,   hdiv_leg_quad_p6p2_b2_ay,   hdiv_leg_quad_p6p3_b2_ay,   hdiv_leg_quad_p6p4_b2_ay,   hdiv_leg_quad_p6p5_b2_ay,   hdiv_leg_quad_p6p6_b2_ay,   hdiv_leg_quad_p6p7_b2_ay,   hdiv_leg_quad_p6p8_b2_ay,   hdiv_leg_quad_p6p9_b2_ay,   hdiv_leg_quad_p6p10_b2_ay,   hdiv_leg_quad_p7p0_b2_ay,   hdiv_leg_quad_p7p1_b2_ay,   hdiv_leg_quad_p7p2_b2_ay,   hdiv_leg_quad_p7p3_b2_ay,   hdiv_leg_quad_p7p4_b2_ay,   hdiv_leg_quad_p7p5_b2_ay,   hdiv_leg_quad_p7p6_b2_ay,   hdiv_leg_quad_p7p7_b2_ay,   hdiv_leg_quad_p7p8_b2_ay,   hdiv_leg_quad_p7p9_b2_ay,   hdiv_leg_quad_p7p10_b2_ay,   hdiv_leg_quad_p8p0_b2_ay,   hdiv_leg_quad_p8p1_b2_ay,   hdiv_leg_quad_p8p2_b2_ay,   hdiv_leg_quad_p8p3_b2_ay,   hdiv_leg_quad_p8p4_b2_ay,   hdiv_leg_quad_p8p5_b2_ay,   hdiv_leg_quad_p8p6_b2_ay,   hdiv_leg_quad_p8p7_b2_ay,   hdiv_leg_quad_p8p8_b2_ay,   hdiv_leg_quad_p8p9_b2_ay,   hdiv_leg_quad_p8p10_b2_ay,   hdiv_leg_quad_p9p0_b2_ay,   hdiv_leg_quad_p9p1_b2_ay,   hdiv_leg_quad_p9p2_b2_ay,   hdiv_leg_quad_p9p3_b2_ay,   hdiv_leg_quad_p9p4_b2_ay,   hdiv_leg_quad_p9p5_b2_ay,   hdiv_leg_quad_p9p6_b2_ay,   hdiv_leg_quad_p9p7_b2_ay,   hdiv_leg_quad_p9p8_b2_ay,   hdiv_leg_quad_p9p9_b2_ay,   hdiv_leg_quad_p9p10_b2_ay,   hdiv_leg_quad_p10p0_b2_ay,   hdiv_leg_quad_p10p1_b2_ay,   hdiv_leg_quad_p10p2_b2_ay,   hdiv_leg_quad_p10p3_b2_ay,   hdiv_leg_quad_p10p4_b2_ay,   hdiv_leg_quad_p10p5_b2_ay,   hdiv_leg_quad_p10p6_b2_ay,   hdiv_leg_quad_p10p7_b2_ay,   hdiv_leg_quad_p10p8_b2_ay,   hdiv_leg_quad_p10p9_b2_ay,   hdiv_leg_quad_p10p10_b2_ay,   hdiv_leg_quad_p11p0_b2_ay,   hdiv_leg_quad_p11p1_b2_ay,   hdiv_leg_quad_p11p2_b2_ay,   hdiv_leg_quad_p11p3_b2_ay,   hdiv_leg_quad_p11p4_b2_ay,   hdiv_leg_quad_p11p5_b2_ay,   hdiv_leg_quad_p11p6_b2_ay,   hdiv_leg_quad_p11p7_b2_ay,   hdiv_leg_quad_p11p8_b2_ay,   hdiv_leg_quad_p11p9_b2_ay,   hdiv_leg_quad_p11p10_b2_ay, };
-
-    static Shapeset::shape_fn_t hdiv_leg_quad_fn_by[] =
-    {
-      hdiv_leg_quad_p0_e1_by, hdiv_leg_quad_p0_e1_by, hdiv_leg_quad_p0_e2_by, hdiv_leg_quad_p0_e2_by, hdiv_leg_quad_p0_e3_by_0, hdiv_leg_quad_p0_e3_by_1, hdiv_leg_quad_p0_e4_by_0, hdiv_leg_quad_p0_e4_by_1,
-      hdiv_leg_quad_p1_e1_by, hdiv_leg_quad_p1_e1_by, hdiv_leg_quad_p1_e2_by, hdiv_leg_quad_p1_e2_by, hdiv_leg_quad_p1_e3_by, hdiv_leg_quad_p1_e3_by, hdiv_leg_quad_p1_e4_by, hdiv_leg_quad_p1_e4_by,
-      hdiv_leg_quad_p2_e1_by, hdiv_leg_quad_p2_e1_by, hdiv_leg_quad_p2_e2_by, hdiv_leg_quad_p2_e2_by, hdiv_leg_quad_p2_e3_by_0, hdiv_leg_quad_p2_e3_by_1, hdiv_leg_quad_p2_e4_by_0, hdiv_leg_quad_p2_e4_by_1,
-      hdiv_leg_quad_p3_e1_by, hdiv_leg_quad_p3_e1_by, hdiv_leg_quad_p3_e2_by, hdiv_leg_quad_p3_e2_by, hdiv_leg_quad_p3_e3_by, hdiv_leg_quad_p3_e3_by, hdiv_leg_quad_p3_e4_by, hdiv_leg_quad_p3_e4_by,
-      hdiv_leg_quad_p4_e1_by, hdiv_leg_quad_p4_e1_by, hdiv_leg_quad_p4_e2_by, hdiv_leg_quad_p4_e2_by, hdiv_leg_quad_p4_e3_by_0, hdiv_leg_quad_p4_e3_by_1, hdiv_leg_quad_p4_e4_by_0, hdiv_leg_quad_p4_e4_by_1,
-      hdiv_leg_quad_p5_e1_by, hdiv_leg_quad_p5_e1_by, hdiv_leg_quad_p5_e2_by, hdiv_leg_quad_p5_e2_by, hdiv_leg_quad_p5_e3_by, hdiv_leg_quad_p5_e3_by, hdiv_leg_quad_p5_e4_by, hdiv_leg_quad_p5_e4_by,
-      hdiv_leg_quad_p6_e1_by, hdiv_leg_quad_p6_e1_by, hdiv_leg_quad_p6_e2_by, hdiv_leg_quad_p6_e2_by, hdiv_leg_quad_p6_e3_by_0, hdiv_leg_quad_p6_e3_by_1, hdiv_leg_quad_p6_e4_by_0, hdiv_leg_quad_p6_e4_by_1,
-      hdiv_leg_quad_p7_e1_by, hdiv_leg_quad_p7_e1_by, hdiv_leg_quad_p7_e2_by, hdiv_leg_quad_p7_e2_by, hdiv_leg_quad_p7_e3_by, hdiv_leg_quad_p7_e3_by, hdiv_leg_quad_p7_e4_by, hdiv_leg_quad_p7_e4_by,
-      hdiv_leg_quad_p8_e1_by, hdiv_leg_quad_p8_e1_by, hdiv_leg_quad_p8_e2_by, hdiv_leg_quad_p8_e2_by, hdiv_leg_quad_p8_e3_by_0, hdiv_leg_quad_p8_e3_by_1, hdiv_leg_quad_p8_e4_by_0, hdiv_leg_quad_p8_e4_by_1,
-      hdiv_leg_quad_p9_e1_by, hdiv_leg_quad_p9_e1_by, hdiv_leg_quad_p9_e2_by, hdiv_leg_quad_p9_e2_by, hdiv_leg_quad_p9_e3_by, hdiv_leg_quad_p9_e3_by, hdiv_leg_quad_p9_e4_by, hdiv_leg_quad_p9_e4_by,
-      hdiv_leg_quad_p10_e1_by, hdiv_leg_quad_p10_e1_by, hdiv_leg_quad_p10_e2_by, hdiv_leg_quad_p10_e2_by, hdiv_leg_quad_p10_e3_by_0, hdiv_leg_quad_p10_e3_by_1, hdiv_leg_quad_p10_e4_by_0, hdiv_leg_quad_p10_e4_by_1,
-
-      hdiv_leg_quad_p0p2_b1_by,   hdiv_leg_quad_p0p3_b1_by,   hdiv_leg_quad_p0p4_b1_by,   hdiv_leg_quad_p0p5_b1_by,   hdiv_leg_quad_p0p6_b1_by,   hdiv_leg_quad_p0p7_b1_by,   hdiv_leg_quad_p0p8_b1_by,   hdiv_leg_quad_p0p9_b1_by,   hdiv_leg_quad_p0p10_b1_by,   hdiv_leg_quad_p0p11_b1_by,   hdiv_leg_quad_p1p2_b1_by,   hdiv_leg_quad_p1p3_b1_by,   hdiv_leg_quad_p1p4_b1_by,   hdiv_leg_quad_p1p5_b1_by,   hdiv_leg_quad_p1p6_b1_by,   hdiv_leg_quad_p1p7_b1_by,   hdiv_leg_quad_p1p8_b1_by,   hdiv_leg_quad_p1p9_b1_by,   hdiv_leg_quad_p1p10_b1_by,   hdiv_leg_quad_p1p11_b1_by,   hdiv_leg_quad_p2p2_b1_by,   hdiv_leg_quad_p2p3_b1_by,   hdiv_leg_quad_p2p4_b1_by,   hdiv_leg_quad_p2p5_b1_by,   hdiv_leg_quad_p2p6_b1_by,   hdiv_leg_quad_p2p7_b1_by,   hdiv_leg_quad_p2p8_b1_by,   hdiv_leg_quad_p2p9_b1_by,   hdiv_leg_quad_p2p10_b1_by,   hdiv_leg_quad_p2p11_b1_by,   hdiv_leg_quad_p3p2_b1_by,   hdiv_leg_quad_p3p3_b1_by,   hdiv_leg_quad_p3p4_b1_by,   hdiv_leg_quad_p3p5_b1_by,   hdiv_leg_quad_p3p6_b1_by,   hdiv_leg_quad_p3p7_b1_by,   hdiv_leg_quad_p3p8_b1_by,   hdiv_leg_quad_p3p9_b1_by,   hdiv_leg_quad_p3p10_b1_by,   hdiv_leg_quad_p3p11_b1_by,   hdiv_leg_quad_p4p2_b1_by,   hdiv_leg_quad_p4p3_b1_by,   hdiv_leg_quad_p4p4_b1_by,   hdiv_leg_quad_p4p5_b1_by,   hdiv_leg_quad_p4p6_b1_by,   hdiv_leg_quad_p4p7_b1_by,   hdiv_leg_quad_p4p8_b1_by,   hdiv_leg_quad_p4p9_b1_by,   hdiv_leg_quad_p4p10_b1_by,   hdiv_leg_quad_p4p11_b1_by,   hdiv_leg_quad_p5p2_b1_by,   hdiv_leg_quad_p5p3_b1_by,   hdiv_leg_quad_p5p4_b1_by,   hdiv_leg_quad_p5p5_b1_by,   hdiv_leg_quad_p5p6_b1_by,   hdiv_leg_quad_p5p7_b1_by,   hdiv_leg_quad_p5p8_b1_by,   hdiv_leg_quad_p5p9_b1_by,   hdiv_leg_quad_p5p10_b1_by,   hdiv_leg_quad_p5p11_b1_by,   hdiv_leg_quad_p6p2_b1_by,   hdiv_leg_quad_p6p3_b1_by,   hdiv_leg_quad_p6p4_b1_by,   hdiv_leg_quad_p6p5_b1_by,   hdiv_leg_quad_p6p6_b1_by,   hdiv_leg_quad_p6p7_b1_by,   hdiv_leg_quad_p6p8_b1_by,   hdiv_leg_quad_p6p9_b1_by,   hdiv_leg_quad_p6p10_b1_by,   hdiv_leg_quad_p6p11_b1_by,   hdiv_leg_quad_p7p2_b1_by,   hdiv_leg_quad_p7p3_b1_by,   hdiv_leg_quad_p7p4_b1_by,   hdiv_leg_quad_p7p5_b1_by,   hdiv_leg_quad_p7p6_b1_by,   hdiv_leg_quad_p7p7_b1_by,   hdiv_leg_quad_p7p8_b1_by,   hdiv_leg_quad_p7p9_b1_by,   hdiv_leg_quad_p7p10_b1_by,   hdiv_leg_quad_p7p11_b1_by,   hdiv_leg_quad_p8p2_b1_by,   hdiv_leg_quad_p8p3_b1_by,   hdiv_leg_quad_p8p4_b1_by,   hdiv_leg_quad_p8p5_b1_by,   hdiv_leg_quad_p8p6_b1_by,   hdiv_leg_quad_p8p7_b1_by,   hdiv_leg_quad_p8p8_b1_by,   hdiv_leg_quad_p8p9_b1_by,   hdiv_leg_quad_p8p10_b1_by,   hdiv_leg_quad_p8p11_b1_by,   hdiv_leg_quad_p9p2_b1_by,   hdiv_leg_quad_p9p3_b1_by,   hdiv_leg_quad_p9p4_b1_by,   hdiv_leg_quad_p9p5_b1_by,   hdiv_leg_quad_p9p6_b1_by,   hdiv_leg_quad_p9p7_b1_by,   hdiv_leg_quad_p9p8_b1_by,   hdiv_leg_quad_p9p9_b1_by,   hdiv_leg_quad_p9p10_b1_by,   hdiv_leg_quad_p9p11_b1_by,   hdiv_leg_quad_p10p2_b1_by,   hdiv_leg_quad_p10p3_b1_by,   hdiv_leg_quad_p10p4_b1_by,   hdiv_leg_quad_p10p5_b1_by,   hdiv_leg_quad_p10p6_b1_by,   hdiv_leg_quad_p10p7_b1_by,   hdiv_leg_quad_p10p8_b1_by,   hdiv_leg_quad_p10p9_b1_by,   hdiv_leg_quad_p10p10_b1_by,   hdiv_leg_quad_p10p11_b1_by,   hdiv_leg_quad_p2p0_b2_by,   hdiv_leg_quad_p2p1_b2_by,   hdiv_leg_quad_p2p2_b2_by,   hdiv_leg_quad_p2p3_b2_by,   hdiv_leg_quad_p2p4_b2_by,   hdiv_leg_quad_p2p5_b2_by,   hdiv_leg_quad_p2p6_b2_by,   hdiv_leg_quad_p2p7_b2_by,   hdiv_leg_quad_p2p8_b2_by,   hdiv_leg_quad_p2p9_b2_by,   hdiv_leg_quad_p2p10_b2_by,   hdiv_leg_quad_p3p0_b2_by,   hdiv_leg_quad_p3p1_b2_by,   hdiv_leg_quad_p3p2_b2_by,   hdiv_leg_quad_p3p3_b2_by,   hdiv_leg_quad_p3p4_b2_by,   hdiv_leg_quad_p3p5_b2_by,   hdiv_leg_quad_p3p6_b2_by,   hdiv_leg_quad_p3p7_b2_by,   hdiv_leg_quad_p3p8_b2_by,   hdiv_leg_quad_p3p9_b2_by,   hdiv_leg_quad_p3p10_b2_by,   hdiv_leg_quad_p4p0_b2_by,   hdiv_leg_quad_p4p1_b2_by,   hdiv_leg_quad_p4p2_b2_by,   hdiv_leg_quad_p4p3_b2_by,   hdiv_leg_quad_p4p4_b2_by,   hdiv_leg_quad_p4p5_b2_by,   hdiv_leg_quad_p4p6_b2_by,   hdiv_leg_quad_p4p7_b2_by,   hdiv_leg_quad_p4p8_b2_by,   hdiv_leg_quad_p4p9_b2_by,   hdiv_leg_quad_p4p10_b2_by,   hdiv_leg_quad_p5p0_b2_by,   hdiv_leg_quad_p5p1_b2_by,   hdiv_leg_quad_p5p2_b2_by,   hdiv_leg_quad_p5p3_b2_by,   hdiv_leg_quad_p5p4_b2_by,   hdiv_leg_quad_p5p5_b2_by,   hdiv_leg_quad_p5p6_b2_by,   hdiv_leg_quad_p5p7_b2_by,   hdiv_leg_quad_p5p8_b2_by,   hdiv_leg_quad_p5p9_b2_by,   hdiv_leg_quad_p5p10_b2_by,   hdiv_leg_quad_p6p0_b2_by,   hdiv_leg_quad_p6p1_b2_by,   hdiv_leg_quad_p6p2_b2_by,   hdiv_leg_quad_p6p3_b2_by,   hdiv_leg_quad_p6p4_b2_by,   hdiv_leg_quad_p6p5_b2_by,   hdiv_leg_quad_p6p6_b2_by,   hdiv_leg_quad_p6p7_b2_by,   hdiv_leg_quad_p6p8_b2_by,   hdiv_leg_quad_p6p9_b2_by,   hdiv_leg_quad_p6p10_b2_by,   hdiv_leg_quad_p7p0_b2_by,   hdiv_leg_quad_p7p1_b2_by,   hdiv_leg_quad_p7p2_b2_by,   hdiv_leg_quad_p7p3_b2_by,   hdiv_leg_quad_p7p4_b2_by,   hdiv_leg_quad_p7p5_b2_by,   hdiv_leg_quad_p7p6_b2_by,   hdiv_leg_quad_p7p7_b2_by,   hdiv_leg_quad_p7p8_b2_by,   hdiv_leg_quad_p7p9_b2_by,   hdiv_leg_quad_p7p10_b2_by,   hdiv_leg_quad_p8p0_b2_by,   hdiv_leg_quad_p8p1_b2_by,   hdiv_leg_quad_p8p2_b2_by,   hdiv_leg_quad_p8p3_b2_by,   hdiv_leg_quad_p8p4_b2_by,   hdiv_leg_quad_p8p5_b2_by,   hdiv_leg_quad_p8p6_b2_by,   hdiv_leg_quad_p8p7_b2_by,   hdiv_leg_quad_p8p8_b2_by,   hdiv_leg_quad_p8p9_b2_by,   hdiv_leg_quad_p8p10_b2_by,   hdiv_leg_quad_p9p0_b2_by,   hdiv_leg_quad_p9p1_b2_by,   hdiv_leg_quad_p9p2_b2_by,   hdiv_leg_quad_p9p3_b2_by,   hdiv_leg_quad_p9p4_b2_by,   hdiv_leg_quad_p9p5_b2_by,   hdiv_leg_quad_p9p6_b2_by,   hdiv_leg_quad_p9p7_b2_by,   hdiv_leg_quad_p9p8_b2_by,   hdiv_leg_quad_p9p9_b2_by,   hdiv_leg_quad_p9p10_b2_by,   hdiv_leg_quad_p10p0_b2_by,   hdiv_leg_quad_p10p1_b2_by,   hdiv_leg_quad_p10p2_b2_by,   hdiv_leg_quad_p10p3_b2_by,   hdiv_leg_quad_p10p4_b2_by,   hdiv_leg_quad_p10p5_b2_by,   hdiv_leg_quad_p10p6_b2_by,   hdiv_leg_quad_p10p7_b2_by,   hdiv_leg_quad_p10p8_b2_by,   hdiv_leg_quad_p10p9_b2_by,   hdiv_leg_quad_p10p10_b2_by,   hdiv_leg_quad_p11p0_b2_by,   hdiv_leg_quad_p11p1_b2_by,   hdiv_leg_quad_p11p2_b2_by,   hdiv_leg_quad_p11p3_b2_by,   hdiv_leg_quad_p11p4_b2_by,   hdiv_leg_quad_p11p5_b2_by,   hdiv_leg_quad_p11p6_b2_by,   hdiv_leg_quad_p11p7_b2_by,   hdiv_leg_quad_p11p8_b2_by,   hdiv_leg_quad_p11p9_b2_by,   hdiv_leg_quad_p11p10_b2_by, };
 
     static int qb_0_1[] = { 88, };
       static int qb_0_2[] = { 88, 89, };
@@ -8618,44 +212,6 @@ namespace Hermes
       oo(0, 2),  oo(0, 3),  oo(0, 4),  oo(0, 5),  oo(0, 6),  oo(0, 7),  oo(0, 8),  oo(0, 9),  oo(0, 10),  oo(0, 11),  oo(1, 2),  oo(1, 3),  oo(1, 4),  oo(1, 5),  oo(1, 6),  oo(1, 7),  oo(1, 8),  oo(1, 9),  oo(1, 10),  oo(1, 11),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(2, 11),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(3, 11),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(4, 11),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(5, 11),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(6, 11),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(7, 11),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(8, 11),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(9, 11),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(10, 11),  oo(2, 0),  oo(2, 1),  oo(2, 2),  oo(2, 3),  oo(2, 4),  oo(2, 5),  oo(2, 6),  oo(2, 7),  oo(2, 8),  oo(2, 9),  oo(2, 10),  oo(3, 0),  oo(3, 1),  oo(3, 2),  oo(3, 3),  oo(3, 4),  oo(3, 5),  oo(3, 6),  oo(3, 7),  oo(3, 8),  oo(3, 9),  oo(3, 10),  oo(4, 0),  oo(4, 1),  oo(4, 2),  oo(4, 3),  oo(4, 4),  oo(4, 5),  oo(4, 6),  oo(4, 7),  oo(4, 8),  oo(4, 9),  oo(4, 10),  oo(5, 0),  oo(5, 1),  oo(5, 2),  oo(5, 3),  oo(5, 4),  oo(5, 5),  oo(5, 6),  oo(5, 7),  oo(5, 8),  oo(5, 9),  oo(5, 10),  oo(6, 0),  oo(6, 1),  oo(6, 2),  oo(6, 3),  oo(6, 4),  oo(6, 5),  oo(6, 6),  oo(6, 7),  oo(6, 8),  oo(6, 9),  oo(6, 10),  oo(7, 0),  oo(7, 1),  oo(7, 2),  oo(7, 3),  oo(7, 4),  oo(7, 5),  oo(7, 6),  oo(7, 7),  oo(7, 8),  oo(7, 9),  oo(7, 10),  oo(8, 0),  oo(8, 1),  oo(8, 2),  oo(8, 3),  oo(8, 4),  oo(8, 5),  oo(8, 6),  oo(8, 7),  oo(8, 8),  oo(8, 9),  oo(8, 10),  oo(9, 0),  oo(9, 1),  oo(9, 2),  oo(9, 3),  oo(9, 4),  oo(9, 5),  oo(9, 6),  oo(9, 7),  oo(9, 8),  oo(9, 9),  oo(9, 10),  oo(10, 0),  oo(10, 1),  oo(10, 2),  oo(10, 3),  oo(10, 4),  oo(10, 5),  oo(10, 6),  oo(10, 7),  oo(10, 8),  oo(10, 9),  oo(10, 10),  oo(11, 0),  oo(11, 1),  oo(11, 2),  oo(11, 3),  oo(11, 4),  oo(11, 5),  oo(11, 6),  oo(11, 7),  oo(11, 8),  oo(11, 9),  oo(11, 10),
     };
 
-    static Shapeset::shape_fn_t* hdiv_leg_quad_shape_fn_table[2] =
-    {
-      hdiv_leg_quad_fn_a,
-      hdiv_leg_quad_fn_b
-    };
-
-    static Shapeset::shape_fn_t* hdiv_leg_quad_shape_fn_table_x[2] =
-    {
-      hdiv_leg_quad_fn_ax,
-      hdiv_leg_quad_fn_bx
-    };
-
-    static Shapeset::shape_fn_t* hdiv_leg_quad_shape_fn_table_y[2] =
-    {
-      hdiv_leg_quad_fn_ay,
-      hdiv_leg_quad_fn_by
-    };
-
-    //// tables and class constructor ///////////////////////////////////////////////
-
-    static Shapeset::shape_fn_t** hdiv_leg_shape_fn_table[2] =
-    {
-      NULL,
-      hdiv_leg_quad_shape_fn_table
-    };
-
-    static Shapeset::shape_fn_t** hdiv_leg_shape_fn_table_x[2] =
-    {
-      NULL,
-      hdiv_leg_quad_shape_fn_table_x
-    };
-
-    static Shapeset::shape_fn_t** hdiv_leg_shape_fn_table_y[2] =
-    {
-      NULL,
-      hdiv_leg_quad_shape_fn_table_y
-    };
-
     static int* hdiv_leg_vertex_indices[2] =
     {
       NULL,
@@ -8686,16 +242,260 @@ namespace Hermes
       hdiv_leg_quad_index_to_order
     };
 
+    // The shape functions, see Shapeset::PolynomialTable.
+
+    static const int hdiv_leg_quad_start[] =
+    {
+      0, 2, 4, 6, 8, 8, 8, 8, 8, 10, 12, 14, 16, 16, 16, 16,
+      16, 18, 20, 22, 24, 24, 24, 24, 24, 26, 28, 30, 32, 32, 32, 32,
+      32, 34, 36, 38, 40, 40, 40, 40, 40, 42, 44, 46, 48, 48, 48, 48,
+      48, 50, 52, 54, 56, 56, 56, 56, 56, 58, 60, 62, 64, 64, 64, 64,
+      64, 66, 68, 70, 72, 72, 72, 72, 72, 74, 76, 78, 80, 80, 80, 80,
+      80, 82, 84, 86, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+      88, 88, 88, 88, 88, 88, 88, 90, 92, 94, 96, 98, 100, 102, 104, 106,
+      108, 110, 112, 114, 116, 118, 120, 122, 124, 126, 128, 130, 132, 134, 136, 138,
+      140, 142, 144, 146, 148, 150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170,
+      172, 174, 176, 178, 180, 182, 184, 186, 188, 190, 192, 194, 196, 198, 200, 202,
+      204, 206, 208, 210, 212, 214, 216, 218, 220, 222, 224, 226, 228, 230, 232, 234,
+      236, 238, 240, 242, 244, 246, 248, 250, 252, 254, 256, 258, 260, 262, 264, 266,
+      268, 270, 272, 274, 276, 278, 280, 282, 284, 286, 288, 290, 292, 294, 296, 298,
+      300, 302, 304, 306, 308, 308, 308, 308, 308, 310, 312, 314, 316, 316, 316, 316,
+      316, 318, 320, 322, 324, 324, 324, 324, 324, 326, 328, 330, 332, 332, 332, 332,
+      332, 334, 336, 338, 340, 340, 340, 340, 340, 342, 344, 346, 348, 348, 348, 348,
+      348, 350, 352, 354, 356, 356, 356, 356, 356, 358, 360, 362, 364, 364, 364, 364,
+      364, 366, 368, 370, 372, 372, 372, 372, 372, 374, 376, 378, 380, 380, 380, 380,
+      380, 382, 384, 386, 388, 388, 388, 388, 388, 390, 392, 394, 396, 398, 400, 402,
+      404, 406, 408, 410, 412, 414, 416, 418, 420, 422, 424, 426, 428, 430, 432, 434,
+      436, 438, 440, 442, 444, 446, 448, 450, 452, 454, 456, 458, 460, 462, 464, 466,
+      468, 470, 472, 474, 476, 478, 480, 482, 484, 486, 488, 490, 492, 494, 496, 498,
+      500, 502, 504, 506, 508, 510, 512, 514, 516, 518, 520, 522, 524, 526, 528, 530,
+      532, 534, 536, 538, 540, 542, 544, 546, 548, 550, 552, 554, 556, 558, 560, 562,
+      564, 566, 568, 570, 572, 574, 576, 578, 580, 582, 584, 586, 588, 590, 592, 594,
+      596, 598, 600, 602, 604, 606, 608, 610, 612, 614, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616, 616,
+      616, 616, 616, 616, 616, 616, 616, 616, 616,
+    };
+
+    static const unsigned char hdiv_leg_quad_degrees[] =
+    {
+      0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11, 0x01, 0x11,
+      0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x02, 0x12, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13, 0x03, 0x13,
+      0x04, 0x14, 0x04, 0x14, 0x04, 0x14, 0x04, 0x14, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15, 0x05, 0x15,
+      0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x06, 0x16, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17, 0x07, 0x17,
+      0x08, 0x18, 0x08, 0x18, 0x08, 0x18, 0x08, 0x18, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19, 0x09, 0x19,
+      0x0a, 0x1a, 0x0a, 0x1a, 0x0a, 0x1a, 0x0a, 0x1a, 0x00, 0x20, 0x01, 0x21, 0x02, 0x22, 0x03, 0x23,
+      0x04, 0x24, 0x05, 0x25, 0x06, 0x26, 0x07, 0x27, 0x08, 0x28, 0x09, 0x29, 0x0a, 0x2a, 0x10, 0x30,
+      0x11, 0x31, 0x12, 0x32, 0x13, 0x33, 0x14, 0x34, 0x15, 0x35, 0x16, 0x36, 0x17, 0x37, 0x18, 0x38,
+      0x19, 0x39, 0x1a, 0x3a, 0x20, 0x40, 0x21, 0x41, 0x22, 0x42, 0x23, 0x43, 0x24, 0x44, 0x25, 0x45,
+      0x26, 0x46, 0x27, 0x47, 0x28, 0x48, 0x29, 0x49, 0x2a, 0x4a, 0x30, 0x50, 0x31, 0x51, 0x32, 0x52,
+      0x33, 0x53, 0x34, 0x54, 0x35, 0x55, 0x36, 0x56, 0x37, 0x57, 0x38, 0x58, 0x39, 0x59, 0x3a, 0x5a,
+      0x40, 0x60, 0x41, 0x61, 0x42, 0x62, 0x43, 0x63, 0x44, 0x64, 0x45, 0x65, 0x46, 0x66, 0x47, 0x67,
+      0x48, 0x68, 0x49, 0x69, 0x4a, 0x6a, 0x50, 0x70, 0x51, 0x71, 0x52, 0x72, 0x53, 0x73, 0x54, 0x74,
+      0x55, 0x75, 0x56, 0x76, 0x57, 0x77, 0x58, 0x78, 0x59, 0x79, 0x5a, 0x7a, 0x60, 0x80, 0x61, 0x81,
+      0x62, 0x82, 0x63, 0x83, 0x64, 0x84, 0x65, 0x85, 0x66, 0x86, 0x67, 0x87, 0x68, 0x88, 0x69, 0x89,
+      0x6a, 0x8a, 0x70, 0x90, 0x71, 0x91, 0x72, 0x92, 0x73, 0x93, 0x74, 0x94, 0x75, 0x95, 0x76, 0x96,
+      0x77, 0x97, 0x78, 0x98, 0x79, 0x99, 0x7a, 0x9a, 0x80, 0xa0, 0x81, 0xa1, 0x82, 0xa2, 0x83, 0xa3,
+      0x84, 0xa4, 0x85, 0xa5, 0x86, 0xa6, 0x87, 0xa7, 0x88, 0xa8, 0x89, 0xa9, 0x8a, 0xaa, 0x90, 0xb0,
+      0x91, 0xb1, 0x92, 0xb2, 0x93, 0xb3, 0x94, 0xb4, 0x95, 0xb5, 0x96, 0xb6, 0x97, 0xb7, 0x98, 0xb8,
+      0x99, 0xb9, 0x9a, 0xba, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x10, 0x11, 0x10, 0x11,
+      0x10, 0x11, 0x10, 0x11, 0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x20, 0x21, 0x30, 0x31, 0x30, 0x31,
+      0x30, 0x31, 0x30, 0x31, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x40, 0x41, 0x50, 0x51, 0x50, 0x51,
+      0x50, 0x51, 0x50, 0x51, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x60, 0x61, 0x70, 0x71, 0x70, 0x71,
+      0x70, 0x71, 0x70, 0x71, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x80, 0x81, 0x90, 0x91, 0x90, 0x91,
+      0x90, 0x91, 0x90, 0x91, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0xa0, 0xa1, 0x00, 0x02, 0x01, 0x03,
+      0x02, 0x04, 0x03, 0x05, 0x04, 0x06, 0x05, 0x07, 0x06, 0x08, 0x07, 0x09, 0x08, 0x0a, 0x09, 0x0b,
+      0x10, 0x12, 0x11, 0x13, 0x12, 0x14, 0x13, 0x15, 0x14, 0x16, 0x15, 0x17, 0x16, 0x18, 0x17, 0x19,
+      0x18, 0x1a, 0x19, 0x1b, 0x20, 0x22, 0x21, 0x23, 0x22, 0x24, 0x23, 0x25, 0x24, 0x26, 0x25, 0x27,
+      0x26, 0x28, 0x27, 0x29, 0x28, 0x2a, 0x29, 0x2b, 0x30, 0x32, 0x31, 0x33, 0x32, 0x34, 0x33, 0x35,
+      0x34, 0x36, 0x35, 0x37, 0x36, 0x38, 0x37, 0x39, 0x38, 0x3a, 0x39, 0x3b, 0x40, 0x42, 0x41, 0x43,
+      0x42, 0x44, 0x43, 0x45, 0x44, 0x46, 0x45, 0x47, 0x46, 0x48, 0x47, 0x49, 0x48, 0x4a, 0x49, 0x4b,
+      0x50, 0x52, 0x51, 0x53, 0x52, 0x54, 0x53, 0x55, 0x54, 0x56, 0x55, 0x57, 0x56, 0x58, 0x57, 0x59,
+      0x58, 0x5a, 0x59, 0x5b, 0x60, 0x62, 0x61, 0x63, 0x62, 0x64, 0x63, 0x65, 0x64, 0x66, 0x65, 0x67,
+      0x66, 0x68, 0x67, 0x69, 0x68, 0x6a, 0x69, 0x6b, 0x70, 0x72, 0x71, 0x73, 0x72, 0x74, 0x73, 0x75,
+      0x74, 0x76, 0x75, 0x77, 0x76, 0x78, 0x77, 0x79, 0x78, 0x7a, 0x79, 0x7b, 0x80, 0x82, 0x81, 0x83,
+      0x82, 0x84, 0x83, 0x85, 0x84, 0x86, 0x85, 0x87, 0x86, 0x88, 0x87, 0x89, 0x88, 0x8a, 0x89, 0x8b,
+      0x90, 0x92, 0x91, 0x93, 0x92, 0x94, 0x93, 0x95, 0x94, 0x96, 0x95, 0x97, 0x96, 0x98, 0x97, 0x99,
+      0x98, 0x9a, 0x99, 0x9b, 0xa0, 0xa2, 0xa1, 0xa3, 0xa2, 0xa4, 0xa3, 0xa5, 0xa4, 0xa6, 0xa5, 0xa7,
+      0xa6, 0xa8, 0xa7, 0xa9, 0xa8, 0xaa, 0xa9, 0xab,
+    };
+
+    static const double hdiv_leg_quad_coefs[] =
+    {
+      0.5000000000000002, -0.5000000000000006, -0.5000000000000002, 0.5000000000000006,
+      -0.49999999999999967, -0.49999999999999983, 0.49999999999999967, 0.49999999999999983,
+      -0.5000000000000006, 0.5000000000000007, -0.5000000000000006, 0.5000000000000007,
+      -0.5000000000000002, -0.5000000000000007, -0.5000000000000002, -0.5000000000000007,
+      0.5000000000000004, -0.5000000000000011, -0.5000000000000004, 0.5000000000000011,
+      -0.5000000000000004, -0.5000000000000016, 0.5000000000000004, 0.5000000000000016,
+      -0.5000000000000007, 0.500000000000001, -0.5000000000000007, 0.500000000000001,
+      -0.5000000000000007, -0.5000000000000016, -0.5000000000000007, -0.5000000000000016,
+      0.500000000000001, -0.5000000000000009, -0.500000000000001, 0.5000000000000009,
+      -0.5000000000000011, -0.5000000000000002, 0.5000000000000011, 0.5000000000000002,
+      -0.5000000000000008, 0.5000000000000011, -0.5000000000000008, 0.5000000000000011,
+      -0.5000000000000014, -0.500000000000002, -0.5000000000000014, -0.500000000000002,
+      0.5000000000000011, -0.5000000000000009, -0.5000000000000011, 0.5000000000000009,
+      -0.500000000000001, -0.5000000000000019, 0.500000000000001, 0.5000000000000019,
+      -0.5000000000000013, 0.5000000000000013, -0.5000000000000013, 0.5000000000000013,
+      -0.5000000000000003, -0.500000000000002, -0.5000000000000003, -0.500000000000002,
+      0.5000000000000014, -0.5000000000000013, -0.5000000000000014, 0.5000000000000013,
+      -0.5000000000000007, -0.5000000000000004, 0.5000000000000007, 0.5000000000000004,
+      -0.4999999999999992, 0.4999999999999997, -0.4999999999999992, 0.4999999999999997,
+      -0.4999999999999991, -0.49999999999999944, -0.4999999999999991, -0.49999999999999944,
+      0.5000000000000031, -0.5000000000000029, -0.5000000000000031, 0.5000000000000029,
+      -0.500000000000003, -0.5000000000000032, 0.500000000000003, 0.5000000000000032,
+      0.40824829046386324, -0.408248290463863, 0.4082482904638634, -0.40824829046386296,
+      0.40824829046386363, -0.4082482904638638, 0.4082482904638634, -0.4082482904638637,
+      0.40824829046386374, -0.4082482904638635, 0.40824829046386374, -0.40824829046386346,
+      0.4082482904638638, -0.4082482904638639, 0.40824829046386396, -0.40824829046386424,
+      0.4082482904638645, -0.40824829046386407, 0.4082482904638624, -0.4082482904638625,
+      0.408248290463865, -0.4082482904638653, 0.31622776601683766, -0.3162277660168376,
+      0.3162277660168385, -0.3162277660168376, 0.31622776601683794, -0.31622776601683833,
+      0.31622776601683844, -0.3162277660168378, 0.3162277660168389, -0.31622776601683794,
+      0.31622776601683844, -0.31622776601683833, 0.3162277660168381, -0.3162277660168383,
+      0.31622776601683855, -0.31622776601683916, 0.3162277660168388, -0.3162277660168392,
+      0.316227766016837, -0.316227766016837, 0.31622776601683955, -0.31622776601683944,
+      0.2672612419124247, -0.26726124191242456, 0.26726124191242456, -0.2672612419124244,
+      0.267261241912425, -0.26726124191242473, 0.26726124191242506, -0.26726124191242456,
+      0.2672612419124244, -0.2672612419124246, 0.26726124191242456, -0.26726124191242445,
+      0.26726124191242456, -0.2672612419124245, 0.2672612419124249, -0.26726124191242495,
+      0.26726124191242523, -0.26726124191242445, 0.26726124191242395, -0.26726124191242423,
+      0.2672612419124261, -0.2672612419124261, 0.23570226039551584, -0.23570226039551564,
+      0.2357022603955157, -0.23570226039551598, 0.23570226039551628, -0.23570226039551614,
+      0.23570226039551628, -0.23570226039551626, 0.23570226039551628, -0.23570226039551614,
+      0.2357022603955161, -0.2357022603955159, 0.23570226039551592, -0.2357022603955163,
+      0.23570226039551614, -0.23570226039551637, 0.23570226039551634, -0.2357022603955163,
+      0.23570226039551528, -0.2357022603955156, 0.23570226039551717, -0.23570226039551734,
+      0.21320071635561047, -0.21320071635561028, 0.21320071635561075, -0.21320071635561058,
+      0.21320071635561078, -0.21320071635561041, 0.21320071635561078, -0.21320071635561066,
+      0.2132007163556109, -0.2132007163556105, 0.2132007163556106, -0.2132007163556106,
+      0.21320071635561058, -0.21320071635561103, 0.21320071635561091, -0.213200716355611,
+      0.21320071635561114, -0.21320071635561083, 0.21320071635561033, -0.21320071635561016,
+      0.21320071635561172, -0.2132007163556117, 0.19611613513818443, -0.19611613513818432,
+      0.19611613513818424, -0.19611613513818435, 0.1961161351381845, -0.19611613513818432,
+      0.19611613513818452, -0.19611613513818424, 0.19611613513818438, -0.19611613513818435,
+      0.19611613513818443, -0.1961161351381845, 0.19611613513818418, -0.19611613513818418,
+      0.19611613513818452, -0.19611613513818413, 0.19611613513818443, -0.1961161351381842,
+      0.19611613513818363, -0.19611613513818374, 0.1961161351381853, -0.19611613513818515,
+      0.18257418583505572, -0.18257418583505539, 0.18257418583505547, -0.18257418583505516,
+      0.18257418583505572, -0.18257418583505564, 0.1825741858350557, -0.1825741858350554,
+      0.18257418583505577, -0.18257418583505555, 0.18257418583505602, -0.1825741858350555,
+      0.1825741858350558, -0.18257418583505525, 0.18257418583505594, -0.18257418583505577,
+      0.18257418583505575, -0.18257418583505547, 0.1825741858350555, -0.18257418583505494,
+      0.18257418583505688, -0.1825741858350562, 0.17149858514250876, -0.17149858514250935,
+      0.171498585142509, -0.17149858514250926, 0.17149858514250915, -0.17149858514250943,
+      0.17149858514250887, -0.1714985851425092, 0.1714985851425092, -0.17149858514250907,
+      0.17149858514250915, -0.1714985851425094, 0.17149858514250924, -0.17149858514250946,
+      0.17149858514250899, -0.17149858514250926, 0.17149858514250915, -0.17149858514250943,
+      0.17149858514250862, -0.1714985851425088, 0.1714985851425099, -0.1714985851425101,
+      0.16222142113076282, -0.1622214211307622, 0.16222142113076288, -0.16222142113076193,
+      0.16222142113076293, -0.16222142113076224, 0.16222142113076288, -0.16222142113076238,
+      0.1622214211307628, -0.1622214211307623, 0.1622214211307627, -0.16222142113076232,
+      0.16222142113076302, -0.16222142113076232, 0.16222142113076285, -0.16222142113076238,
+      0.162221421130763, -0.16222142113076243, 0.16222142113076216, -0.1622214211307619,
+      0.16222142113076338, -0.16222142113076302, 0.15430334996209152, -0.15430334996209133,
+      0.1543033499620914, -0.15430334996209155, 0.15430334996209144, -0.15430334996209158,
+      0.15430334996209158, -0.15430334996209197, 0.15430334996209152, -0.15430334996209155,
+      0.15430334996209175, -0.15430334996209177, 0.15430334996209183, -0.15430334996209155,
+      0.1543033499620917, -0.15430334996209175, 0.1543033499620918, -0.1543033499620918,
+      0.15430334996209136, -0.15430334996209089, 0.15430334996209255, -0.1543033499620926,
+      0.49999999999999983, -0.5000000000000004, -0.49999999999999983, 0.5000000000000004,
+      -0.49999999999999983, -0.5000000000000004, 0.49999999999999983, 0.5000000000000004,
+      0.5000000000000004, -0.5000000000000003, 0.5000000000000004, -0.5000000000000003,
+      0.5000000000000004, 0.5000000000000004, 0.5000000000000004, 0.5000000000000004,
+      0.5000000000000004, -0.500000000000001, -0.5000000000000004, 0.500000000000001,
+      -0.5000000000000006, -0.500000000000001, 0.5000000000000006, 0.500000000000001,
+      0.500000000000001, -0.5000000000000007, 0.500000000000001, -0.5000000000000007,
+      0.5000000000000008, 0.500000000000001, 0.5000000000000008, 0.500000000000001,
+      0.5000000000000012, -0.5000000000000004, -0.5000000000000012, 0.5000000000000004,
+      -0.5000000000000012, -0.5000000000000006, 0.5000000000000012, 0.5000000000000006,
+      0.5000000000000011, -0.5000000000000013, 0.5000000000000011, -0.5000000000000013,
+      0.5000000000000011, 0.5000000000000013, 0.5000000000000011, 0.5000000000000013,
+      0.500000000000001, -0.500000000000001, -0.500000000000001, 0.500000000000001,
+      -0.5000000000000009, -0.5000000000000011, 0.5000000000000009, 0.5000000000000011,
+      0.500000000000001, -0.500000000000001, 0.500000000000001, -0.500000000000001,
+      0.500000000000001, 0.5000000000000012, 0.500000000000001, 0.5000000000000012,
+      0.5000000000000011, -0.5000000000000018, -0.5000000000000011, 0.5000000000000018,
+      -0.500000000000001, -0.5000000000000014, 0.500000000000001, 0.5000000000000014,
+      0.49999999999999906, -0.49999999999999933, 0.49999999999999906, -0.49999999999999933,
+      0.4999999999999991, 0.49999999999999933, 0.4999999999999991, 0.49999999999999933,
+      0.500000000000003, -0.5000000000000032, -0.500000000000003, 0.5000000000000032,
+      -0.5000000000000029, -0.5000000000000033, 0.5000000000000029, 0.5000000000000033,
+      -0.40824829046386324, 0.4082482904638633, -0.31622776601683766, 0.3162277660168378,
+      -0.267261241912425, 0.2672612419124245, -0.2357022603955156, 0.2357022603955157,
+      -0.21320071635561053, 0.21320071635561036, -0.19611613513818407, 0.19611613513818424,
+      -0.1825741858350557, 0.18257418583505522, -0.17149858514250876, 0.17149858514250915,
+      -0.16222142113076293, 0.16222142113076216, -0.15430334996209155, 0.15430334996209144,
+      -0.40824829046386324, 0.4082482904638627, -0.3162277660168379, 0.31622776601683816,
+      -0.26726124191242456, 0.26726124191242445, -0.23570226039551578, 0.235702260395516,
+      -0.2132007163556107, 0.2132007163556104, -0.19611613513818385, 0.19611613513818432,
+      -0.18257418583505572, 0.18257418583505536, -0.1714985851425089, 0.17149858514250915,
+      -0.16222142113076252, 0.16222142113076196, -0.15430334996209158, 0.1543033499620916,
+      -0.4082482904638636, 0.4082482904638634, -0.3162277660168384, 0.31622776601683794,
+      -0.26726124191242473, 0.26726124191242473, -0.23570226039551623, 0.23570226039551612,
+      -0.21320071635561091, 0.2132007163556105, -0.1961161351381844, 0.19611613513818404,
+      -0.1825741858350558, 0.1825741858350555, -0.17149858514250912, 0.17149858514250957,
+      -0.16222142113076277, 0.1622214211307625, -0.1543033499620915, 0.1543033499620917,
+      -0.4082482904638631, 0.4082482904638637, -0.31622776601683805, 0.3162277660168381,
+      -0.26726124191242495, 0.26726124191242484, -0.23570226039551617, 0.2357022603955163,
+      -0.21320071635561091, 0.21320071635561078, -0.19611613513818454, 0.1961161351381841,
+      -0.1825741858350559, 0.18257418583505552, -0.1714985851425088, 0.17149858514250935,
+      -0.16222142113076288, 0.1622214211307624, -0.15430334996209147, 0.15430334996209172,
+      -0.4082482904638635, 0.40824829046386346, -0.31622776601683855, 0.316227766016838,
+      -0.26726124191242456, 0.2672612419124247, -0.23570226039551614, 0.2357022603955162,
+      -0.2132007163556109, 0.21320071635561044, -0.19611613513818427, 0.19611613513818424,
+      -0.18257418583505583, 0.1825741858350552, -0.17149858514250912, 0.17149858514250896,
+      -0.1622214211307631, 0.16222142113076254, -0.1543033499620916, 0.1543033499620917,
+      -0.40824829046386385, 0.4082482904638635, -0.31622776601683805, 0.3162277660168381,
+      -0.2672612419124248, 0.26726124191242456, -0.23570226039551617, 0.23570226039551576,
+      -0.21320071635561055, 0.21320071635561078, -0.1961161351381844, 0.19611613513818443,
+      -0.18257418583505564, 0.18257418583505544, -0.17149858514250918, 0.1714985851425094,
+      -0.1622214211307629, 0.1622214211307623, -0.15430334996209177, 0.15430334996209158,
+      -0.4082482904638635, 0.40824829046386407, -0.31622776601683766, 0.31622776601683833,
+      -0.2672612419124245, 0.2672612419124249, -0.23570226039551612, 0.23570226039551628,
+      -0.21320071635561055, 0.21320071635561083, -0.19611613513818438, 0.19611613513818418,
+      -0.18257418583505566, 0.1825741858350555, -0.17149858514250924, 0.17149858514250943,
+      -0.16222142113076288, 0.16222142113076227, -0.1543033499620916, 0.15430334996209158,
+      -0.4082482904638639, 0.40824829046386424, -0.3162277660168382, 0.31622776601683905,
+      -0.267261241912425, 0.2672612419124249, -0.23570226039551626, 0.23570226039551623,
+      -0.2132007163556109, 0.21320071635561091, -0.19611613513818454, 0.1961161351381842,
+      -0.18257418583505575, 0.18257418583505564, -0.17149858514250904, 0.17149858514250926,
+      -0.16222142113076296, 0.16222142113076254, -0.15430334996209175, 0.15430334996209186,
+      -0.40824829046386446, 0.408248290463864, -0.31622776601683905, 0.31622776601683833,
+      -0.2672612419124251, 0.26726124191242473, -0.23570226039551634, 0.23570226039551645,
+      -0.21320071635561097, 0.2132007163556108, -0.1961161351381845, 0.19611613513818446,
+      -0.18257418583505583, 0.1825741858350557, -0.17149858514250912, 0.1714985851425093,
+      -0.16222142113076307, 0.16222142113076266, -0.15430334996209188, 0.15430334996209208,
+      -0.4082482904638627, 0.40824829046386235, -0.31622776601683694, 0.3162277660168369,
+      -0.2672612419124238, 0.26726124191242395, -0.2357022603955153, 0.23570226039551556,
+      -0.21320071635561008, 0.21320071635561014, -0.19611613513818363, 0.19611613513818393,
+      -0.18257418583505508, 0.18257418583505483, -0.17149858514250846, 0.17149858514250876,
+      -0.16222142113076213, 0.16222142113076182, -0.15430334996209108, 0.1543033499620912,
+      -0.40824829046386507, 0.40824829046386524, -0.31622776601683944, 0.3162277660168391,
+      -0.26726124191242584, 0.26726124191242584, -0.23570226039551717, 0.23570226039551728,
+      -0.21320071635561186, 0.2132007163556116, -0.19611613513818532, 0.19611613513818513,
+      -0.18257418583505658, 0.18257418583505627, -0.17149858514250985, 0.17149858514250998,
+      -0.16222142113076365, 0.16222142113076304, -0.15430334996209233, 0.15430334996209233,
+    };
+
+    static const Shapeset::PolynomialTable hdiv_leg_quad_polynomials = { 308, hdiv_leg_quad_start, hdiv_leg_quad_degrees, hdiv_leg_quad_coefs };
+
     int HdivShapesetLegendre::get_max_index(ElementMode2D mode) { return max_index[mode]; }
 
     HdivShapesetLegendre::HdivShapesetLegendre()
     {
-      shape_table[0] = hdiv_leg_shape_fn_table;
-      shape_table[1] = hdiv_leg_shape_fn_table_x;
-      shape_table[2] = hdiv_leg_shape_fn_table_y;
-      shape_table[3] = NULL;
-      shape_table[4] = NULL;
-      shape_table[5] = NULL;
+      polynomial_table[HERMES_MODE_TRIANGLE] = NULL;
+      polynomial_table[HERMES_MODE_QUAD] = &hdiv_leg_quad_polynomials;
 
       vertex_indices = hdiv_leg_vertex_indices;
       edge_indices = hdiv_leg_edge_indices;
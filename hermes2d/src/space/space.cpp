@@ -23,6 +23,8 @@
 #include "space_hdiv.h"
 #include "space_h2d_xml.h"
 #include "api2d.h"
+#include "refmap.h"
+#include "xml_stream_reader.h"
 #include <iostream>
 
 namespace Hermes
@@ -44,9 +46,13 @@ namespace Hermes
 			this->seq = g_space_seq;
 			this->was_assigned = -1;
 			this->ndof = 0;
+			this->asmlist_cache_seq = -1;
+			this->dof_numbering_template = NULL;
       this->proj_mat = NULL;
       this->chol_p = NULL;
+      this->bc_edge_points_mesh_seq = -1;
       this->vertex_functions_count = this->edge_functions_count = this->bubble_functions_count = 0;
+      this->dof_ordering = HERMES_DOF_ORDERING_BY_TYPE;
 
 			if(essential_bcs != NULL)
 				for(Hermes::vector<EssentialBoundaryCondition<double>*>::const_iterator it = essential_bcs->begin(); it != essential_bcs->end(); it++)
@@ -72,9 +78,13 @@ namespace Hermes
 			this->seq = g_space_seq;
 			this->was_assigned = -1;
 			this->ndof = 0;
+			this->asmlist_cache_seq = -1;
+			this->dof_numbering_template = NULL;
       this->proj_mat = NULL;
       this->chol_p = NULL;
+      this->bc_edge_points_mesh_seq = -1;
       this->vertex_functions_count = this->edge_functions_count = this->bubble_functions_count = 0;
+      this->dof_ordering = HERMES_DOF_ORDERING_BY_TYPE;
 
 			if(essential_bcs != NULL)
 				for(Hermes::vector<EssentialBoundaryCondition<std::complex<double> >*>::const_iterator it = essential_bcs->begin(); it != essential_bcs->end(); it++)
@@ -93,7 +103,9 @@ namespace Hermes
 			free_bc_data();
 			if(nsize) { ::free(ndata); nsize = 0; ndata = NULL; }
 			if(esize) { ::free(edata); edata = 0; edata = NULL; }
+			invalidate_assembly_list_cache();
 			this->seq = -1;
+			this->update_memory_usage();
 		}
 
 		template<>
@@ -102,7 +114,9 @@ namespace Hermes
 			free_bc_data();
 			if(nsize) { ::free(ndata); nsize = 0; ndata = NULL; }
 			if(esize) { ::free(edata); edata = 0; edata = NULL; }
+			invalidate_assembly_list_cache();
 			this->seq = -1;
+			this->update_memory_usage();
 		}
 
     template<>
@@ -166,24 +180,12 @@ namespace Hermes
     Space<double>::~Space()
     {
       free();
-
-      if(this->proj_mat != NULL)
-        delete [] this->proj_mat;
-      if(this->chol_p != NULL)
-        delete [] this->chol_p;
-
     }
 
     template<>
     Space<std::complex<double> >::~Space()
     {
       free();
-
-      if(this->proj_mat != NULL)
-        delete [] this->proj_mat;
-      if(this->chol_p != NULL)
-        delete [] this->chol_p;
-
     }
 
 		template<typename Scalar>
@@ -233,6 +235,66 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    void Space<Scalar>::shrink_to_fit()
+    {
+      // resize_tables() grows the tables from at least 1024 items.
+      int node_count = std::max(mesh->get_max_node_id(), 1024);
+      if(ndata != NULL && ndata_allocated > node_count)
+      {
+        ndata = (NodeData*)realloc(ndata, node_count * sizeof(NodeData));
+        ndata_allocated = node_count;
+      }
+
+      int element_count = std::max(mesh->get_max_element_id(), 1024);
+      if(edata != NULL && esize > element_count)
+      {
+        edata = (ElementData*) realloc(edata, sizeof(ElementData) * element_count);
+        esize = element_count;
+      }
+
+      invalidate_assembly_list_cache();
+      std::vector<int>().swap(this->asmlist_cache_start);
+      std::vector<int>().swap(this->asmlist_cache_cnt);
+      std::vector<int>().swap(this->asmlist_cache_idx);
+      std::vector<int>().swap(this->asmlist_cache_dof);
+      std::vector<Scalar>().swap(this->asmlist_cache_coef);
+
+      this->bc_edge_points.clear();
+      this->bc_edge_points_mesh_seq = -1;
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::remap_ids(const std::vector<int>& element_ids, const std::vector<int>& node_ids)
+    {
+      // The new ids are never greater than the old ones, the data move to the front in place.
+      if(edata != NULL)
+      {
+        int count = std::min(esize, (int)element_ids.size());
+        for (int id = 0; id < count; id++)
+          if(element_ids[id] >= 0 && element_ids[id] != id)
+            edata[element_ids[id]] = edata[id];
+        for (int id = std::min(mesh->get_max_element_id(), esize); id < esize; id++)
+        {
+          edata[id].order = -1;
+          edata[id].changed_in_last_adaptation = true;
+        }
+      }
+
+      if(ndata != NULL)
+      {
+        int count = std::min(nsize, (int)node_ids.size());
+        for (int id = 0; id < count; id++)
+          if(node_ids[id] >= 0 && node_ids[id] != id)
+            ndata[node_ids[id]] = ndata[id];
+      }
+
+      invalidate_assembly_list_cache();
+      this->bc_edge_points.clear();
+      this->bc_edge_points_mesh_seq = -1;
+      this->seq = g_space_seq++;
+    }
+
     template<typename Scalar>
     void Space<Scalar>::copy(const Space<Scalar>* space, Mesh* new_mesh)
     {
@@ -242,6 +304,7 @@ namespace Hermes
 
       this->essential_bcs = space->essential_bcs;
       this->shapeset = space->shapeset->clone();
+      this->dof_ordering = space->dof_ordering;
 
       new_mesh->copy(space->get_mesh());
       this->mesh = new_mesh;
@@ -615,8 +678,14 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    Space<Scalar>::ReferenceSpaceCreator::ReferenceSpaceCreator(const Space<Scalar>* coarse_space, const Mesh* ref_mesh, unsigned int order_increase) : coarse_space(coarse_space), ref_mesh(ref_mesh), order_increase(order_increase)
+    Space<Scalar>::ReferenceSpaceCreator::ReferenceSpaceCreator(const Space<Scalar>* coarse_space, const Mesh* ref_mesh, unsigned int order_increase) : coarse_space(coarse_space), ref_mesh(ref_mesh), order_increase(order_increase), previous_ref_space(NULL)
+    {
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::ReferenceSpaceCreator::set_previous_ref_space(const Space<Scalar>* previous_ref_space)
     {
+      this->previous_ref_space = previous_ref_space;
     }
 
     template<typename Scalar>
@@ -687,6 +756,9 @@ namespace Hermes
       /// Finish - MUST BE CALLED BEFORE RETURN.
       this->finish_construction(ref_space);
 
+      if(this->previous_ref_space != NULL && this->previous_ref_space->get_type() == ref_space->get_type())
+        ref_space->set_dof_numbering_template(this->previous_ref_space);
+
       // Assign dofs?
       if(assign_dofs)
         ref_space->assign_dofs();
@@ -743,6 +815,7 @@ namespace Hermes
     void Space<Scalar>::ReferenceSpaceCreator::finish_construction(Space<Scalar>* ref_space)
     {
       ref_space->seq = g_space_seq++;
+      ref_space->dof_ordering = this->coarse_space->dof_ordering;
 
       Element *e;
       for_all_active_elements(e, coarse_space->get_mesh())
@@ -915,10 +988,19 @@ namespace Hermes
       this->first_dof = next_dof = first_dof;
       this->stride = stride;
 
+      invalidate_assembly_list_cache();
+
       reset_dof_assignment();
       assign_vertex_dofs();
       assign_edge_dofs();
       assign_bubble_dofs();
+      if(this->dof_ordering == HERMES_DOF_ORDERING_HILBERT)
+        reorder_dofs_hilbert();
+      if(this->dof_numbering_template != NULL)
+      {
+        reorder_dofs_as_template();
+        this->dof_numbering_template = NULL;
+      }
 
       free_bc_data();
       update_essential_bc_values();
@@ -929,10 +1011,288 @@ namespace Hermes
       was_assigned = this->seq;
       this->ndof = (next_dof - first_dof) / stride;
 
+      // The single element refinements (adaptivity) are reported with the space assigned on the mesh.
+      this->mesh->update_memory_usage();
+      this->update_memory_usage();
+
       return this->ndof;
       check();
     }
 
+    template<typename Scalar>
+    void Space<Scalar>::set_dof_ordering(DofOrdering ordering)
+    {
+      this->dof_ordering = ordering;
+      this->seq = g_space_seq++;
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::set_dof_numbering_template(const Space<Scalar>* space)
+    {
+      this->dof_numbering_template = space;
+    }
+
+    // Gives the next positions to the block of count DOFs starting at dof, unless done already.
+    static void number_dof_block(int dof, int count, int first_dof, int stride, std::vector<int>& new_positions, int& next_position)
+    {
+      if(dof < 0 || count <= 0)
+        return;
+      int position = (dof - first_dof) / stride;
+      if(new_positions[position] >= 0)
+        return;
+      new_positions[position] = next_position;
+      next_position += count;
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::reorder_dofs_hilbert()
+    {
+      // The blocks (vertex, edge, bubble) keep their DOFs consecutive, so it is enough to move their first DOFs.
+      std::vector<int> new_positions((next_dof - first_dof) / stride, -1);
+      int next_position = 0;
+
+      Hermes::vector<Element*> ordered_elements;
+      mesh->get_active_elements_hilbert_order(ordered_elements);
+      for (unsigned int i = 0; i < ordered_elements.size(); i++)
+      {
+        Element* e = ordered_elements[i];
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
+          number_dof_block(ndata[e->vn[j]->id].dof, 1, first_dof, stride, new_positions, next_position);
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
+          number_dof_block(ndata[e->en[j]->id].dof, ndata[e->en[j]->id].n, first_dof, stride, new_positions, next_position);
+        number_dof_block(edata[e->id].bdof, edata[e->id].n, first_dof, stride, new_positions, next_position);
+      }
+
+      // The edge nodes not belonging to active elements (HcurlSpace numbers all of them).
+      for (int i = 0; i < mesh->get_max_node_id(); i++)
+      {
+        Node* node = mesh->get_node(i);
+        if(node->used && node->type == HERMES_TYPE_EDGE)
+          number_dof_block(ndata[i].dof, ndata[i].n, first_dof, stride, new_positions, next_position);
+      }
+
+      apply_dof_positions(new_positions);
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::apply_dof_positions(const std::vector<int>& new_positions)
+    {
+      for (int i = 0; i < mesh->get_max_node_id(); i++)
+      {
+        Node* node = mesh->get_node(i);
+        if(node->used && ndata[i].dof >= 0 && (node->type == HERMES_TYPE_VERTEX || ndata[i].n > 0))
+          ndata[i].dof = first_dof + new_positions[(ndata[i].dof - first_dof) / stride] * stride;
+      }
+      Element* e;
+      for_all_active_elements(e, mesh)
+        if(edata[e->id].n > 0)
+          edata[e->id].bdof = first_dof + new_positions[(edata[e->id].bdof - first_dof) / stride] * stride;
+    }
+
+    // The geometry identifying a vertex (one point), an edge (two) or an element (three or four) across meshes.
+    typedef std::vector<std::pair<double, double> > DofBlockKey;
+
+    static DofBlockKey dof_block_key(Node** vertices, int count)
+    {
+      DofBlockKey key;
+      for (int i = 0; i < count; i++)
+        key.push_back(std::pair<double, double>(vertices[i]->x, vertices[i]->y));
+      std::sort(key.begin(), key.end());
+      return key;
+    }
+
+    // A DOF block of the space being renumbered: its position, length, and the position the template has for it.
+    struct DofBlock
+    {
+      int position, count, template_position;
+      bool operator<(const DofBlock& other) const { return count > other.count; }
+    };
+
+    template<typename Scalar>
+    void Space<Scalar>::get_dof_blocks(std::map<DofBlockKey, std::pair<int, int> >& blocks) const
+    {
+      Element* e;
+      for_all_active_elements(e, this->mesh)
+      {
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
+        {
+          const NodeData& vnd = this->ndata[e->vn[j]->id];
+          if(vnd.dof >= 0)
+            blocks[dof_block_key(e->vn + j, 1)] = std::pair<int, int>((vnd.dof - this->first_dof) / this->stride, 1);
+          const NodeData& end = this->ndata[e->en[j]->id];
+          Node* edge_vertices[2] = { e->vn[j], e->vn[e->next_vert(j)] };
+          if(end.dof >= 0 && end.n > 0)
+            blocks[dof_block_key(edge_vertices, 2)] = std::pair<int, int>((end.dof - this->first_dof) / this->stride, end.n);
+        }
+        const ElementData& ed = this->edata[e->id];
+        if(ed.n > 0)
+          blocks[dof_block_key(e->vn, e->get_nvert())] = std::pair<int, int>((ed.bdof - this->first_dof) / this->stride, ed.n);
+      }
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::transfer_coefficients(const Space<Scalar>* space, const Scalar* coeff_vec, Scalar* new_coeff_vec) const
+    {
+      if(space == NULL)
+        throw Exceptions::NullException(1);
+      this->check();
+      space->check();
+
+      for (int i = 0; i < this->ndof; i++)
+        new_coeff_vec[this->first_dof + i * this->stride] = Scalar(0);
+
+      std::map<DofBlockKey, std::pair<int, int> > old_blocks, new_blocks;
+      space->get_dof_blocks(old_blocks);
+      this->get_dof_blocks(new_blocks);
+
+      // Both maps are sorted by the geometry, the common blocks are found by one merge.
+      std::map<DofBlockKey, std::pair<int, int> >::const_iterator it_old = old_blocks.begin(), it_new = new_blocks.begin();
+      while (it_old != old_blocks.end() && it_new != new_blocks.end())
+      {
+        if(it_old->first < it_new->first)
+          it_old++;
+        else if(it_new->first < it_old->first)
+          it_new++;
+        else
+        {
+          if(it_old->second.second == it_new->second.second)
+            for (int k = 0; k < it_new->second.second; k++)
+              new_coeff_vec[this->first_dof + (it_new->second.first + k) * this->stride] = coeff_vec[space->first_dof + (it_old->second.first + k) * space->stride];
+          it_old++;
+          it_new++;
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::reorder_dofs_as_template()
+    {
+      const Space<Scalar>* other = this->dof_numbering_template;
+      if(!other->is_up_to_date())
+        return;
+
+      // The DOF blocks of the template by their geometry.
+      std::map<DofBlockKey, std::pair<int, int> > template_blocks;
+      other->get_dof_blocks(template_blocks);
+      Element* e;
+
+      // The blocks of this space, matched to the template.
+      int num_positions = (next_dof - first_dof) / stride;
+      std::vector<DofBlock> blocks;
+      std::vector<char> listed(num_positions, 0);
+      for_all_active_elements(e, mesh)
+      {
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
+        {
+          Node* edge_vertices[2] = { e->vn[j], e->vn[e->next_vert(j)] };
+          const NodeData* nds[2] = { &ndata[e->vn[j]->id], &ndata[e->en[j]->id] };
+          for (int k = 0; k < 2; k++)
+          {
+            int count = k == 0 ? 1 : nds[k]->n;
+            if(nds[k]->dof < 0 || count <= 0 || listed[(nds[k]->dof - first_dof) / stride])
+              continue;
+            DofBlock block = { (nds[k]->dof - first_dof) / stride, count, -1 };
+            std::map<DofBlockKey, std::pair<int, int> >::const_iterator it = template_blocks.find(k == 0 ? dof_block_key(e->vn + j, 1) : dof_block_key(edge_vertices, 2));
+            if(it != template_blocks.end() && it->second.second == count)
+              block.template_position = it->second.first;
+            listed[block.position] = 1;
+            blocks.push_back(block);
+          }
+        }
+        if(edata[e->id].n > 0)
+        {
+          DofBlock block = { (edata[e->id].bdof - first_dof) / stride, edata[e->id].n, -1 };
+          std::map<DofBlockKey, std::pair<int, int> >::const_iterator it = template_blocks.find(dof_block_key(e->vn, e->get_nvert()));
+          if(it != template_blocks.end() && it->second.second == block.count)
+            block.template_position = it->second.first;
+          listed[block.position] = 1;
+          blocks.push_back(block);
+        }
+      }
+      // The edge nodes not belonging to active elements (HcurlSpace numbers all of them) are never matched.
+      for (int i = 0; i < mesh->get_max_node_id(); i++)
+      {
+        Node* node = mesh->get_node(i);
+        if(node->used && node->type == HERMES_TYPE_EDGE && ndata[i].dof >= 0 && ndata[i].n > 0 && !listed[(ndata[i].dof - first_dof) / stride])
+        {
+          DofBlock block = { (ndata[i].dof - first_dof) / stride, ndata[i].n, -1 };
+          listed[block.position] = 1;
+          blocks.push_back(block);
+        }
+      }
+
+      // The matched blocks keep their template positions if those are free and in range.
+      std::vector<int> new_positions(num_positions, -1);
+      std::vector<char> taken(num_positions, 0);
+      std::vector<DofBlock> unmatched;
+      for (unsigned int i = 0; i < blocks.size(); i++)
+      {
+        int p = blocks[i].template_position;
+        bool free_range = p >= 0 && p + blocks[i].count <= num_positions;
+        for (int k = 0; free_range && k < blocks[i].count; k++)
+          free_range = !taken[p + k];
+        if(free_range)
+        {
+          for (int k = 0; k < blocks[i].count; k++)
+            taken[p + k] = 1;
+          new_positions[blocks[i].position] = p;
+        }
+        else
+          unmatched.push_back(blocks[i]);
+      }
+
+      // The rest fills the holes, the longest blocks first, each into the shortest hole it fits in.
+      std::multimap<int, int> holes;
+      for (int p = 0; p < num_positions;)
+      {
+        if(taken[p])
+        {
+          p++;
+          continue;
+        }
+        int start = p;
+        while (p < num_positions && !taken[p])
+          p++;
+        holes.insert(std::pair<int, int>(p - start, start));
+      }
+      std::stable_sort(unmatched.begin(), unmatched.end());
+      bool all_placed = true;
+      for (unsigned int i = 0; i < unmatched.size() && all_placed; i++)
+      {
+        std::multimap<int, int>::iterator it = holes.lower_bound(unmatched[i].count);
+        if(it == holes.end())
+        {
+          all_placed = false;
+          break;
+        }
+        int length = it->first, start = it->second;
+        holes.erase(it);
+        new_positions[unmatched[i].position] = start;
+        if(length > unmatched[i].count)
+          holes.insert(std::pair<int, int>(length - unmatched[i].count, start + unmatched[i].count));
+      }
+
+      // If the holes are too fragmented, the matched blocks keep at least their order in the template.
+      if(!all_placed)
+      {
+        std::vector<std::pair<std::pair<int, int>, int> > order;
+        for (unsigned int i = 0; i < blocks.size(); i++)
+        {
+          int key = blocks[i].template_position >= 0 ? blocks[i].template_position : num_positions + blocks[i].position;
+          order.push_back(std::pair<std::pair<int, int>, int>(std::pair<int, int>(key, blocks[i].position), i));
+        }
+        std::sort(order.begin(), order.end());
+        int next_position = 0;
+        for (unsigned int i = 0; i < order.size(); i++)
+        {
+          new_positions[blocks[order[i].second].position] = next_position;
+          next_position += blocks[order[i].second].count;
+        }
+      }
+
+      apply_dof_positions(new_positions);
+    }
+
     template<typename Scalar>
     void Space<Scalar>::reset_dof_assignment()
     {
@@ -994,6 +1354,51 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("The space in get_element_assembly_list() is out of date. You need to update it with assign_dofs()"
         " any time the mesh changes.");
 
+      const int* idx;
+      const int* dof;
+      const Scalar* coef;
+      unsigned int cnt = get_element_assembly_list(e, idx, dof, coef);
+      if(cnt == (unsigned int) -1)
+      {
+        // Not an active element, the list is not cached.
+        get_element_assembly_list_internal(e, al);
+      }
+      else
+      {
+        while(al->cap < cnt)
+          al->enlarge();
+        memcpy(al->idx, idx, cnt * sizeof(int));
+        memcpy(al->dof, dof, cnt * sizeof(int));
+        memcpy(al->coef, coef, cnt * sizeof(Scalar));
+        al->cnt = cnt;
+      }
+      for(unsigned int i = 0; i < al->cnt; i++)
+        if(al->dof[i] >= 0)
+          al->dof[i] += first_dof;
+    }
+
+    template<typename Scalar>
+    unsigned int Space<Scalar>::get_element_assembly_list(Element* e, const int*& idx, const int*& dof, const Scalar*& coef) const
+    {
+      this->check();
+      if(!is_up_to_date())
+        throw Hermes::Exceptions::Exception("The space in get_element_assembly_list() is out of date. You need to update it with assign_dofs()"
+        " any time the mesh changes.");
+
+      update_assembly_list_cache();
+      if(e->id >= (int) this->asmlist_cache_cnt.size() || this->asmlist_cache_cnt[e->id] < 0)
+        return (unsigned int) -1;
+
+      int start = this->asmlist_cache_start[e->id];
+      idx = this->asmlist_cache_idx.empty() ? NULL : &this->asmlist_cache_idx[start];
+      dof = this->asmlist_cache_dof.empty() ? NULL : &this->asmlist_cache_dof[start];
+      coef = this->asmlist_cache_coef.empty() ? NULL : &this->asmlist_cache_coef[start];
+      return this->asmlist_cache_cnt[e->id];
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::get_element_assembly_list_internal(Element* e, AsmList<Scalar>* al) const
+    {
       // add vertex, edge and bubble functions to the assembly list
       al->cnt = 0;
       for (unsigned int i = 0; i < e->get_nvert(); i++)
@@ -1001,9 +1406,63 @@ namespace Hermes
       for (unsigned int i = 0; i < e->get_nvert(); i++)
         get_boundary_assembly_list_internal(e, i, al);
       get_bubble_assembly_list(e, al);
-      for(unsigned int i = 0; i < al->cnt; i++)
-        if(al->dof[i] >= 0)
-          al->dof[i] += first_dof;
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::update_assembly_list_cache() const
+    {
+      if(this->asmlist_cache_seq >= 0 && this->asmlist_cache_seq == this->seq)
+        return;
+#pragma omp critical (space_asmlist_cache)
+      if(this->asmlist_cache_seq < 0 || this->asmlist_cache_seq != this->seq)
+      {
+        int max_id = this->mesh->get_max_element_id();
+        this->asmlist_cache_start.assign(max_id, 0);
+        this->asmlist_cache_cnt.assign(max_id, -1);
+        this->asmlist_cache_idx.clear();
+        this->asmlist_cache_dof.clear();
+        this->asmlist_cache_coef.clear();
+
+        AsmList<Scalar> al;
+        Element* e;
+        for_all_active_elements(e, this->mesh)
+        {
+          get_element_assembly_list_internal(e, &al);
+          this->asmlist_cache_start[e->id] = (int) this->asmlist_cache_idx.size();
+          this->asmlist_cache_cnt[e->id] = (int) al.cnt;
+          this->asmlist_cache_idx.insert(this->asmlist_cache_idx.end(), al.idx, al.idx + al.cnt);
+          this->asmlist_cache_dof.insert(this->asmlist_cache_dof.end(), al.dof, al.dof + al.cnt);
+          this->asmlist_cache_coef.insert(this->asmlist_cache_coef.end(), al.coef, al.coef + al.cnt);
+        }
+        // The lists have to be complete before another thread sees the seq.
+#pragma omp flush
+        this->asmlist_cache_seq = this->seq;
+        this->update_memory_usage();
+      }
+    }
+
+    template<typename Scalar>
+    size_t Space<Scalar>::get_memory_usage() const
+    {
+      size_t usage = 0;
+      if(this->ndata != NULL)
+        usage += (size_t) this->ndata_allocated * sizeof(NodeData);
+      if(this->edata != NULL)
+        usage += (size_t) this->esize * sizeof(ElementData);
+      usage += (this->asmlist_cache_start.capacity() + this->asmlist_cache_cnt.capacity() + this->asmlist_cache_idx.capacity() + this->asmlist_cache_dof.capacity()) * sizeof(int);
+      usage += this->asmlist_cache_coef.capacity() * sizeof(Scalar);
+      return usage;
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::invalidate_assembly_list_cache()
+    {
+      this->asmlist_cache_seq = -1;
+      this->asmlist_cache_start.clear();
+      this->asmlist_cache_cnt.clear();
+      this->asmlist_cache_idx.clear();
+      this->asmlist_cache_dof.clear();
+      this->asmlist_cache_coef.clear();
     }
 
     template<typename Scalar>
@@ -1019,6 +1478,43 @@ namespace Hermes
           al->dof[i] += first_dof;
     }
 
+    template<typename Scalar>
+    bool Space<Scalar>::get_diagonal_mass_matrix(double* diag, unsigned int first_dof) const
+    {
+      this->check();
+      // The basis functions of different elements do not overlap only in L2 spaces.
+      if(this->get_type() != HERMES_L2_SPACE)
+        return false;
+
+      bool orthogonal[H2D_NUM_MODES];
+      for (int mode = 0; mode < H2D_NUM_MODES; mode++)
+        orthogonal[mode] = shapeset->is_orthogonal((ElementMode2D) mode);
+
+      RefMap refmap;
+      AsmList<Scalar> al;
+      Element* e;
+      for_all_active_elements(e, this->mesh)
+      {
+        ElementMode2D mode = e->get_mode();
+        if(!orthogonal[mode])
+          return false;
+        // With a constant jacobian the orthogonality on the reference element carries over.
+        refmap.set_active_element(e);
+        if(!refmap.is_jacobian_const())
+          return false;
+        double jac = refmap.get_const_jacobian();
+
+        get_element_assembly_list(e, &al, first_dof);
+        for (unsigned int k = 0; k < al.cnt; k++)
+          if(al.dof[k] >= 0)
+          {
+            double coef = std::abs(al.coef[k]);
+            diag[al.dof[k]] = coef * coef * jac * shapeset->get_norm_squared(al.idx[k], mode);
+          }
+      }
+      return true;
+    }
+
     template<typename Scalar>
     void Space<Scalar>::get_bubble_assembly_list(Element* e, AsmList<Scalar>* al) const
     {
@@ -1038,12 +1534,30 @@ namespace Hermes
       this->essential_bcs = essential_bcs;
     }
 
+    // The projection matrices by the shapeset id, nv and the component.
+    static std::map<std::pair<int, int>, std::pair<double**, double*> > g_projection_matrices;
+
     template<typename Scalar>
     void Space<Scalar>::precalculate_projection_matrix(int nv, double**& mat, double*& p)
     {
+      int component = (get_type() == HERMES_HDIV_SPACE) ? 1 : 0;
+      std::pair<int, int> key(shapeset->get_id(), 2 * nv + component);
+      bool found = false;
+#pragma omp critical (projection_matrices)
+      {
+        std::map<std::pair<int, int>, std::pair<double**, double*> >::const_iterator it = g_projection_matrices.find(key);
+        if(it != g_projection_matrices.end())
+        {
+          mat = it->second.first;
+          p = it->second.second;
+          found = true;
+        }
+      }
+      if(found)
+        return;
+
       int n = shapeset->get_max_order() + 1 - nv;
       mat = new_matrix<double>(n, n);
-      int component = (get_type() == HERMES_HDIV_SPACE) ? 1 : 0;
 
       Quad1DStd quad1d;
       for (int i = 0; i < n; i++)
@@ -1066,6 +1580,74 @@ namespace Hermes
 
       p = new double[n];
       choldc(mat, n, p);
+
+#pragma omp critical (projection_matrices)
+      {
+        std::map<std::pair<int, int>, std::pair<double**, double*> >::const_iterator it = g_projection_matrices.find(key);
+        if(it == g_projection_matrices.end())
+          g_projection_matrices[key] = std::pair<double**, double*>(mat, p);
+        else
+        {
+          // Another thread was faster.
+          delete [] mat;
+          delete [] p;
+          mat = it->second.first;
+          p = it->second.second;
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::get_bc_values(SurfPos* surf_pos, EssentialBoundaryCondition<Scalar>* bc, Scalar* values)
+    {
+      Quad1DStd quad1d;
+      int mo = quad1d.get_max_order();
+      int np = quad1d.get_num_points(mo) + 2;
+
+      if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_CONST)
+      {
+        for (int i = 0; i < np; i++)
+          values[i] = bc->value_const;
+        return;
+      }
+
+      if(this->bc_edge_points_mesh_seq != (int) this->mesh->get_seq())
+      {
+        this->bc_edge_points.clear();
+        this->bc_edge_points_mesh_seq = this->mesh->get_seq();
+      }
+
+      std::pair<std::pair<int, int>, std::pair<double, double> > key(std::pair<int, int>(surf_pos->base->id, surf_pos->surf_num), std::pair<double, double>(surf_pos->lo, surf_pos->hi));
+      typename std::map<std::pair<std::pair<int, int>, std::pair<double, double> >, BCEdgePoints>::iterator it = this->bc_edge_points.find(key);
+      if(it == this->bc_edge_points.end())
+      {
+        BCEdgePoints& points = this->bc_edge_points[key];
+        points.x.resize(np);
+        points.y.resize(np);
+        points.n_x.resize(np);
+        points.n_y.resize(np);
+        points.t_x.resize(np);
+        points.t_y.resize(np);
+
+        double2* pt = quad1d.get_points(mo);
+        Nurbs* nurbs = surf_pos->base->is_curved() ? surf_pos->base->cm->nurbs[surf_pos->surf_num] : NULL;
+        for (int i = 0; i < np; i++)
+        {
+          double t;
+          if(i < 2)
+            t = i == 0 ? surf_pos->lo : surf_pos->hi;
+          else
+          {
+            double tt = (pt[i - 2][0] + 1) * 0.5;
+            t = surf_pos->lo * (1.0 - tt) + surf_pos->hi * tt;
+          }
+          CurvMap::nurbs_edge(surf_pos->base, nurbs, surf_pos->surf_num, 2.0 * t - 1.0, points.x[i], points.y[i], points.n_x[i], points.n_y[i], points.t_x[i], points.t_y[i]);
+        }
+        it = this->bc_edge_points.find(key);
+      }
+
+      const BCEdgePoints& points = it->second;
+      bc->values(np, &points.x[0], &points.y[0], &points.n_x[0], &points.n_y[0], &points.t_x[0], &points.t_y[0], values);
     }
 
     template<typename Scalar>
@@ -1113,6 +1695,8 @@ namespace Hermes
     template<typename Scalar>
     void Space<Scalar>::update_essential_bc_values()
     {
+      // The Dirichlet lifts are the coefficients of the constrained DOFs in the assembly lists.
+      invalidate_assembly_list_cache();
       Element* e;
       for_all_base_elements(e, mesh)
       {
@@ -1194,9 +1778,25 @@ namespace Hermes
         if(!validate)
           parsing_flags = xml_schema::flags::dont_validate;
 
-        std::auto_ptr<XMLSpace::space> parsed_xml_space (XMLSpace::space_(filename, parsing_flags));
+        // Either the XSD object tree or the streaming reader (Hermes2DApi's xmlStreaming, no validation).
+        std::auto_ptr<XMLSpace::space> parsed_xml_space;
+        std::auto_ptr<XMLStreamReader> reader;
+        std::string space_type;
+        if(!validate && Hermes2DApi.get_xml_streaming())
+        {
+          reader.reset(new XMLStreamReader(filename));
+          if(!reader->next() || reader->name() != "space")
+            throw Hermes::Exceptions::SpaceLoadFailureException("The file %s is not a space file in Space::load.", filename);
+          if(reader->has_attribute("spaceType"))
+            space_type = reader->attribute("spaceType");
+        }
+        else
+        {
+          parsed_xml_space = XMLSpace::space_(filename, parsing_flags);
+          space_type = parsed_xml_space->spaceType().get();
+        }
 
-				if(!strcmp(parsed_xml_space->spaceType().get().c_str(),"h1"))
+				if(!strcmp(space_type.c_str(),"h1"))
 				{
 					space = new H1Space<Scalar>();
 					space->mesh = mesh;
@@ -1216,7 +1816,7 @@ namespace Hermes
 
 					space->precalculate_projection_matrix(2, space->proj_mat, space->chol_p);
 				}
-				else if (!strcmp(parsed_xml_space->spaceType().get().c_str(),"hcurl"))
+				else if (!strcmp(space_type.c_str(),"hcurl"))
 				{
 					space = new HcurlSpace<Scalar>();
 					space->mesh = mesh;
@@ -1238,7 +1838,7 @@ namespace Hermes
 
 					space->precalculate_projection_matrix(0, space->proj_mat, space->chol_p);
 				}
-				else if(!!strcmp(parsed_xml_space->spaceType().get().c_str(),"hdiv"))
+				else if(!!strcmp(space_type.c_str(),"hdiv"))
 				{
 					space = new HdivSpace<Scalar>();
 					space->mesh = mesh;
@@ -1260,7 +1860,7 @@ namespace Hermes
 
 					space->precalculate_projection_matrix(0, space->proj_mat, space->chol_p);
 				}
-				else if(strcmp(parsed_xml_space->spaceType().get().c_str(),"l2"))
+				else if(strcmp(space_type.c_str(),"l2"))
 				{
 					space = new L2Space<Scalar>();
 					space->mesh = mesh;
@@ -1290,7 +1890,7 @@ namespace Hermes
 				space->mesh_seq = space->mesh->get_seq();
 
 				// L2 space does not have any (strong) essential BCs.
-				if(essential_bcs != NULL && parsed_xml_space->spaceType().get().c_str() != "l2")
+				if(essential_bcs != NULL && space_type != "l2")
 					for(typename Hermes::vector<EssentialBoundaryCondition<Scalar>*>::const_iterator it = essential_bcs->begin(); it != essential_bcs->end(); it++)
 						for(unsigned int i = 0; i < (*it)->markers.size(); i++)
 							if(space->get_mesh()->boundary_markers_conversion.conversion_table_inverse.find((*it)->markers.at(i)) == space->get_mesh()->boundary_markers_conversion.conversion_table_inverse.end())
@@ -1299,13 +1899,32 @@ namespace Hermes
 				space->resize_tables();
 
         // Element data //
-        unsigned int elem_data_count = parsed_xml_space->element_data().size();
-        for (unsigned int elem_data_i = 0; elem_data_i < elem_data_count; elem_data_i++)
+        if(reader.get() != NULL)
+        {
+          while (reader->next())
+          {
+            if(reader->name() != "element_data")
+              continue;
+            int e_id = reader->int_attribute("e_id");
+            if(e_id < 0 || e_id >= space->esize)
+              throw Hermes::Exceptions::SpaceLoadFailureException("Element data of a non-existent element %d in Space::load.", e_id);
+            space->edata[e_id].order = reader->int_attribute("ord");
+            space->edata[e_id].bdof = reader->int_attribute("bd");
+            space->edata[e_id].n = reader->int_attribute("n");
+            const std::string& chgd = reader->attribute("chgd");
+            space->edata[e_id].changed_in_last_adaptation = (chgd == "true" || chgd == "1");
+          }
+        }
+        else
         {
-          space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].order = parsed_xml_space->element_data().at(elem_data_i).ord();
-          space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].bdof = parsed_xml_space->element_data().at(elem_data_i).bd();
-          space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].n = parsed_xml_space->element_data().at(elem_data_i).n();
-          space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].changed_in_last_adaptation = parsed_xml_space->element_data().at(elem_data_i).chgd();
+          unsigned int elem_data_count = parsed_xml_space->element_data().size();
+          for (unsigned int elem_data_i = 0; elem_data_i < elem_data_count; elem_data_i++)
+          {
+            space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].order = parsed_xml_space->element_data().at(elem_data_i).ord();
+            space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].bdof = parsed_xml_space->element_data().at(elem_data_i).bd();
+            space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].n = parsed_xml_space->element_data().at(elem_data_i).n();
+            space->edata[parsed_xml_space->element_data().at(elem_data_i).e_id()].changed_in_last_adaptation = parsed_xml_space->element_data().at(elem_data_i).chgd();
+          }
         }
 
         space->seq = g_space_seq++;
@@ -1320,6 +1939,292 @@ namespace Hermes
       }
     }
 
+    // The last character is the version of the format.
+    static const char binary_space_magic[8] = { 'H', '2', 'D', 'S', 'P', 'A', 'C', 1 };
+
+    static size_t aligned(size_t bytes)
+    {
+      return (bytes + 7) & ~((size_t) 7);
+    }
+
+    template<typename Scalar>
+    void Space<Scalar>::get_essential_markers(std::vector<std::string>& markers) const
+    {
+      markers.clear();
+      if(this->essential_bcs == NULL || this->get_type() == HERMES_L2_SPACE)
+        return;
+      for(std::map<int, std::string>::const_iterator it = this->mesh->boundary_markers_conversion.conversion_table.begin(); it != this->mesh->boundary_markers_conversion.conversion_table.end(); it++)
+        if(this->essential_bcs->get_boundary_condition(it->second) != NULL)
+          markers.push_back(it->second);
+      std::sort(markers.begin(), markers.end());
+    }
+
+    template<typename Scalar>
+    Space<Scalar>* Space<Scalar>::create_empty(SpaceType type, Mesh* mesh, Shapeset* shapeset)
+    {
+      Space<Scalar>* space;
+      switch(type)
+      {
+      case HERMES_H1_SPACE:
+        space = new H1Space<Scalar>();
+        space->shapeset = (shapeset == NULL) ? new H1Shapeset : shapeset;
+        break;
+      case HERMES_HCURL_SPACE:
+        space = new HcurlSpace<Scalar>();
+        space->shapeset = (shapeset == NULL) ? new HcurlShapeset : shapeset;
+        break;
+      case HERMES_HDIV_SPACE:
+        space = new HdivSpace<Scalar>();
+        space->shapeset = (shapeset == NULL) ? new HdivShapeset : shapeset;
+        break;
+      case HERMES_L2_SPACE:
+        space = new L2Space<Scalar>();
+        space->shapeset = (shapeset == NULL) ? new L2Shapeset : shapeset;
+        static_cast<L2Space<Scalar>*>(space)->ldata = NULL;
+        static_cast<L2Space<Scalar>*>(space)->lsize = 0;
+        break;
+      default:
+        throw Hermes::Exceptions::SpaceLoadFailureException("Unknown space type %d in Space::load_binary.", (int) type);
+      }
+      space->own_shapeset = (shapeset == NULL);
+      space->mesh = mesh;
+      if(space->shapeset->get_space_type() != type)
+      {
+        delete space;
+        throw Hermes::Exceptions::SpaceLoadFailureException("The shapeset does not match the saved space type in Space::load_binary.");
+      }
+
+      if(type == HERMES_H1_SPACE)
+        space->precalculate_projection_matrix(2, space->proj_mat, space->chol_p);
+      else if(type != HERMES_L2_SPACE)
+        space->precalculate_projection_matrix(0, space->proj_mat, space->chol_p);
+      return space;
+    }
+
+    template<typename Scalar>
+    bool Space<Scalar>::save_binary(const char *filename) const
+    {
+      this->check();
+      if(!this->is_up_to_date())
+        throw Hermes::Exceptions::Exception("The space in Space::save_binary() is out of date. You need to update it with assign_dofs() first.");
+
+      int num_elements = this->mesh->get_max_element_id();
+      std::vector<int> element_vertices(4 * num_elements, -1), element_data(4 * num_elements, -1);
+      for (int i = 0; i < num_elements; i++)
+      {
+        Element* e = this->mesh->get_element_fast(i);
+        if(!e->used)
+          continue;
+        for (unsigned int j = 0; j < e->get_nvert(); j++)
+          element_vertices[4 * i + j] = e->vn[j]->id;
+        if(i < this->esize)
+        {
+          element_data[4 * i] = this->edata[i].order;
+          element_data[4 * i + 1] = this->edata[i].bdof;
+          element_data[4 * i + 2] = this->edata[i].n;
+          element_data[4 * i + 3] = this->edata[i].changed_in_last_adaptation ? 1 : 0;
+        }
+      }
+
+      // Constrained nodes keep their baselists in the place of the DOF, they are stored as not assigned,
+      // update_constraints() rebuilds them when loading.
+      int num_nodes = this->mesh->get_max_node_id();
+      std::vector<int> node_info(3 * num_nodes, 0), node_data(2 * num_nodes, H2D_UNASSIGNED_DOF);
+      for (int i = 0; i < num_nodes; i++)
+      {
+        Node* node = this->mesh->get_node(i);
+        if(!node->used)
+          continue;
+        node_info[3 * i] = 1 + 2 * node->type;
+        node_info[3 * i + 1] = node->p1;
+        node_info[3 * i + 2] = node->p2;
+        if(i >= this->nsize)
+          continue;
+        bool constrained = (node->type == HERMES_TYPE_VERTEX) ? node->is_constrained_vertex() : (this->ndata[i].n < 0);
+        node_data[2 * i] = constrained ? H2D_UNASSIGNED_DOF : this->ndata[i].dof;
+        node_data[2 * i + 1] = this->ndata[i].n;
+      }
+
+      std::vector<std::string> markers;
+      this->get_essential_markers(markers);
+      std::vector<int> marker_offsets(1, 0);
+      std::string marker_chars;
+      for (unsigned int i = 0; i < markers.size(); i++)
+      {
+        marker_chars += markers[i];
+        marker_offsets.push_back(marker_chars.size());
+      }
+
+      BinaryHeader header;
+      memset(&header, 0, sizeof(BinaryHeader));
+      memcpy(header.magic, binary_space_magic, 8);
+      header.space_type = this->get_type();
+      header.num_elements = num_elements;
+      header.num_nodes = num_nodes;
+      header.first_dof = this->first_dof;
+      header.stride = this->stride;
+      header.next_dof = this->next_dof;
+      header.ndof = this->ndof;
+      header.vertex_functions_count = this->vertex_functions_count;
+      header.edge_functions_count = this->edge_functions_count;
+      header.bubble_functions_count = this->bubble_functions_count;
+      header.dof_ordering = this->dof_ordering;
+      header.num_essential_markers = markers.size();
+      header.num_marker_chars = marker_chars.size();
+
+      FILE* f = fopen(filename, "wb");
+      if(f == NULL)
+        throw Hermes::Exceptions::Exception("Could not create the space file %s.", filename);
+
+      const void* arrays[7] = { &header, element_vertices.empty() ? NULL : &element_vertices[0], element_data.empty() ? NULL : &element_data[0],
+        node_info.empty() ? NULL : &node_info[0], node_data.empty() ? NULL : &node_data[0], &marker_offsets[0], marker_chars.data() };
+      size_t bytes[7] = { sizeof(BinaryHeader), element_vertices.size() * sizeof(int), element_data.size() * sizeof(int),
+        node_info.size() * sizeof(int), node_data.size() * sizeof(int), marker_offsets.size() * sizeof(int), marker_chars.size() };
+      static const char zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+      bool ok = true;
+      for (int i = 0; i < 7; i++)
+      {
+        if(bytes[i] > 0)
+          ok = ok && fwrite(arrays[i], 1, bytes[i], f) == bytes[i];
+        // The last array is not padded.
+        if(i < 6)
+          ok = ok && fwrite(zeros, 1, aligned(bytes[i]) - bytes[i], f) == aligned(bytes[i]) - bytes[i];
+      }
+      fclose(f);
+      if(!ok)
+        throw Hermes::Exceptions::Exception("Error writing the space file %s.", filename);
+
+      return true;
+    }
+
+    template<typename Scalar>
+    Space<Scalar>* Space<Scalar>::load_binary(const char *filename, Mesh* mesh, EssentialBCs<Scalar>* essential_bcs, Shapeset* shapeset)
+    {
+      FILE* f = fopen(filename, "rb");
+      if(f == NULL)
+        throw Hermes::Exceptions::SpaceLoadFailureException("Space file %s not found.", filename);
+      fseek(f, 0, SEEK_END);
+      size_t length = ftell(f);
+      fseek(f, 0, SEEK_SET);
+      // Doubles for the alignment of the arrays.
+      std::vector<double> buffer(aligned(length) / sizeof(double) + 1);
+      char* data = (char*) &buffer[0];
+      size_t read = fread(data, 1, length, f);
+      fclose(f);
+      if(read != length)
+        throw Hermes::Exceptions::SpaceLoadFailureException("Error reading the file %s.", filename);
+
+      BinaryHeader header;
+      if(length < sizeof(BinaryHeader) || memcmp(data, binary_space_magic, 7) != 0)
+        throw Hermes::Exceptions::SpaceLoadFailureException("File %s: not a binary Hermes2D space.", filename);
+      memcpy(&header, data, sizeof(BinaryHeader));
+      if(header.magic[7] != binary_space_magic[7])
+        throw Hermes::Exceptions::SpaceLoadFailureException("File %s: unsupported version of the binary space format.", filename);
+      if(header.num_elements < 0 || header.num_nodes < 0 || header.num_essential_markers < 0 || header.num_marker_chars < 0 || header.stride < 1)
+        throw Hermes::Exceptions::SpaceLoadFailureException("File %s: invalid sizes in the header.", filename);
+
+      size_t position = aligned(sizeof(BinaryHeader));
+      const int* element_vertices = (const int*) (data + position);
+      position += aligned(4 * header.num_elements * sizeof(int));
+      const int* element_data = (const int*) (data + position);
+      position += aligned(4 * header.num_elements * sizeof(int));
+      const int* node_info = (const int*) (data + position);
+      position += aligned(3 * header.num_nodes * sizeof(int));
+      const int* node_data = (const int*) (data + position);
+      position += aligned(2 * header.num_nodes * sizeof(int));
+      const int* marker_offsets = (const int*) (data + position);
+      position += aligned((header.num_essential_markers + 1) * sizeof(int));
+      const char* marker_chars = data + position;
+      position += header.num_marker_chars;
+      if(position > length)
+        throw Hermes::Exceptions::SpaceLoadFailureException("File %s: the file is truncated.", filename);
+
+      // The elements have to be those the space was saved on.
+      if(header.num_elements != mesh->get_max_element_id())
+        throw Hermes::Exceptions::SpaceLoadFailureException("File %s: the space was saved on a different mesh.", filename);
+      for (int i = 0; i < header.num_elements; i++)
+      {
+        Element* e = mesh->get_element_fast(i);
+        for (unsigned int j = 0; j < 4; j++)
+          if(element_vertices[4 * i + j] != ((e->used && j < e->get_nvert()) ? e->vn[j]->id : -1))
+            throw Hermes::Exceptions::SpaceLoadFailureException("File %s: the space was saved on a different mesh (element #%d).", filename, i);
+      }
+
+      Space<Scalar>* space = create_empty((SpaceType) header.space_type, mesh, shapeset);
+      try
+      {
+        space->essential_bcs = essential_bcs;
+
+        // The DOFs depend on which boundary parts are essential.
+        std::vector<std::string> markers, saved_markers;
+        space->get_essential_markers(markers);
+        for (int i = 0; i < header.num_essential_markers; i++)
+        {
+          if(marker_offsets[i] < 0 || marker_offsets[i] > marker_offsets[i + 1] || marker_offsets[i + 1] > header.num_marker_chars)
+            throw Hermes::Exceptions::SpaceLoadFailureException("File %s: invalid marker #%d.", filename, i);
+          saved_markers.push_back(std::string(marker_chars + marker_offsets[i], marker_chars + marker_offsets[i + 1]));
+        }
+        if(markers != saved_markers)
+          throw Hermes::Exceptions::SpaceLoadFailureException("File %s: the essential BCs differ from those of the saved space.", filename);
+
+        space->resize_tables();
+        space->seq = g_space_seq++;
+        space->dof_ordering = (DofOrdering) header.dof_ordering;
+        for (int i = 0; i < header.num_elements && i < space->esize; i++)
+        {
+          if(element_vertices[4 * i] < 0)
+            continue;
+          space->edata[i].order = element_data[4 * i];
+          space->edata[i].bdof = element_data[4 * i + 1];
+          space->edata[i].n = element_data[4 * i + 2];
+          space->edata[i].changed_in_last_adaptation = element_data[4 * i + 3] != 0;
+        }
+
+        // With the same nodes the numbering is restored, otherwise it is done again for the loaded orders.
+        bool same_nodes = (header.num_nodes == mesh->get_max_node_id());
+        for (int i = 0; same_nodes && i < header.num_nodes; i++)
+        {
+          Node* node = mesh->get_node(i);
+          if(!node->used)
+            same_nodes = node_info[3 * i] == 0;
+          else
+            same_nodes = node_info[3 * i] == (int) (1 + 2 * node->type) && node_info[3 * i + 1] == node->p1 && node_info[3 * i + 2] == node->p2;
+        }
+        if(!same_nodes)
+        {
+          space->assign_dofs(header.first_dof, header.stride);
+          return space;
+        }
+
+        for (int i = 0; i < header.num_nodes && i < space->nsize; i++)
+        {
+          space->ndata[i].dof = node_data[2 * i];
+          space->ndata[i].n = node_data[2 * i + 1];
+        }
+        space->first_dof = header.first_dof;
+        space->stride = header.stride;
+        space->next_dof = header.next_dof;
+        space->vertex_functions_count = header.vertex_functions_count;
+        space->edge_functions_count = header.edge_functions_count;
+        space->bubble_functions_count = header.bubble_functions_count;
+
+        space->free_bc_data();
+        space->update_essential_bc_values();
+        space->update_constraints();
+        space->post_assign();
+
+        space->mesh_seq = mesh->get_seq();
+        space->was_assigned = space->seq;
+        space->ndof = header.ndof;
+      }
+      catch(...)
+      {
+        delete space;
+        throw;
+      }
+      return space;
+    }
+
     template class HERMES_API Space<double>;
     template class HERMES_API Space<std::complex<double> >;
   }
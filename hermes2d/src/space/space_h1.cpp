@@ -14,6 +14,7 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "space_h1.h"
+#include "api2d.h"
 namespace Hermes
 {
   namespace Hermes2D
@@ -133,72 +134,104 @@ namespace Hermes
     void H1Space<Scalar>::assign_edge_dofs()
     {
       // Edge dofs.
+      std::vector<Element*> elements;
       Element* e;
-      this->edge_functions_count = 0;
       for_all_active_elements(e, this->mesh)
+        elements.push_back(e);
+      int num_elements = (int)elements.size();
+
+      // What the numbering needs to know about the edges (their orders, constraints and essential BCs) depends
+      // on the edge alone, this is done in parallel; the numbering itself is the cheap sweep in the element order.
+      // -1 for a constrained edge node, -2 for an edge of an element without DOFs.
+      std::vector<int> edge_ndofs(4 * num_elements);
+      std::vector<char> edge_essential(4 * num_elements);
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel for num_threads(num_threads_used) schedule(dynamic, 1024)
+      for (int k = 0; k < num_elements; k++)
       {
-        int order = this->get_element_order(e->id);
-        if(order > 0)
+        Element* e = elements[k];
+        bool has_dofs = this->get_element_order(e->id) > 0;
+        for (unsigned int i = 0; i < e->get_nvert(); i++)
         {
-          for (unsigned int i = 0; i < e->get_nvert(); i++)
+          Node* en = e->en[i];
+          edge_essential[4 * k + i] = 0;
+          if(!has_dofs)
+            edge_ndofs[4 * k + i] = -2;
+          // If the edge node is not constrained, it gets dofs.
+          else if(en->ref > 1 || en->bnd || this->mesh->peek_vertex_node(en->p1, en->p2) != NULL)
           {
-            Node* vn = e->vn[i];
-            typename Space<Scalar>::NodeData* nd = this->ndata + vn->id;
-            Node* en = e->en[i];
-            nd = this->ndata + en->id;
-            if(nd->dof == this->H2D_UNASSIGNED_DOF)
+            edge_ndofs[4 * k + i] = this->get_edge_order_internal(en) - 1;
+            if(en->bnd && this->essential_bcs != NULL)
+              if(this->essential_bcs->get_boundary_condition(this->mesh->boundary_markers_conversion.get_user_marker(en->marker).marker) != NULL)
+                edge_essential[4 * k + i] = 1;
+          }
+          else
+            edge_ndofs[4 * k + i] = -1;
+        }
+      }
+
+      this->edge_functions_count = 0;
+      for (int k = 0; k < num_elements; k++)
+      {
+        Element* e = elements[k];
+        for (unsigned int i = 0; i < e->get_nvert(); i++)
+        {
+          int ndofs = edge_ndofs[4 * k + i];
+          if(ndofs == -2)
+            break;
+          typename Space<Scalar>::NodeData* nd = this->ndata + e->en[i]->id;
+          if(nd->dof == this->H2D_UNASSIGNED_DOF)
+          {
+            if(ndofs >= 0)
             {
-              // If the edge node is not constrained, assign it dofs.
-              if(en->ref > 1 || en->bnd || this->mesh->peek_vertex_node(en->p1, en->p2) != NULL)
+              nd->n = ndofs;
+              if(edge_essential[4 * k + i])
+                nd->dof = this->H2D_CONSTRAINED_DOF;
+              else
               {
-                int ndofs = this->get_edge_order_internal(en) - 1;
-                nd->n = ndofs;
-
-                if(en->bnd)
-                  if(this->essential_bcs != NULL)
-                    if(this->essential_bcs->get_boundary_condition(this->mesh->boundary_markers_conversion.get_user_marker(e->en[i]->marker).marker) != NULL)
-                      nd->dof = this->H2D_CONSTRAINED_DOF;
-                    else
-                    {
-                      nd->dof = this->next_dof;
-                      this->next_dof += ndofs * this->stride;
-                      this->edge_functions_count += ndofs;
-                    }
-                  else
-                  {
-                    nd->dof = this->next_dof;
-                    this->next_dof += ndofs * this->stride;
-                    this->edge_functions_count += ndofs;
-                  }
-                else
-                {
-                  nd->dof = this->next_dof;
-                  this->next_dof += ndofs * this->stride;
-                  this->edge_functions_count += ndofs;
-                }
+                nd->dof = this->next_dof;
+                this->next_dof += ndofs * this->stride;
+                this->edge_functions_count += ndofs;
               }
-              else // Constrained edge node.
-                nd->n = -1;
             }
+            else // Constrained edge node.
+              nd->n = -1;
           }
         }
       }
-
     }
+
     template<typename Scalar>
     void H1Space<Scalar>::assign_bubble_dofs()
     {
       // Bubble dofs.
+      std::vector<Element*> elements;
       Element* e;
-      this->bubble_functions_count = 0;
       for_all_active_elements(e, this->mesh)
+        elements.push_back(e);
+      int num_elements = (int)elements.size();
+
+      // The numbers of bubbles in parallel, then their first DOFs by a prefix sum in the element order.
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel for num_threads(num_threads_used) schedule(static)
+      for (int k = 0; k < num_elements; k++)
       {
-        int order = this->get_element_order(e->id);
-        if(order > 0)
+        Element* e = elements[k];
+        if(this->get_element_order(e->id) > 0)
+        {
+          typename Space<Scalar>::ElementData* ed = &this->edata[e->id];
+          ed->n = this->shapeset->get_num_bubbles(ed->order, e->get_mode());
+        }
+      }
+
+      this->bubble_functions_count = 0;
+      for (int k = 0; k < num_elements; k++)
+      {
+        Element* e = elements[k];
+        if(this->get_element_order(e->id) > 0)
         {
           typename Space<Scalar>::ElementData* ed = &this->edata[e->id];
           ed->bdof = this->next_dof;
-          ed->n = order ? this->shapeset->get_num_bubbles(ed->order, e->get_mode()) : 0;
           this->next_dof += ed->n * this->stride;
           this->bubble_functions_count += ed->n;
         }
@@ -270,32 +303,18 @@ namespace Hermes
       assert(order >= 1);
       Scalar* proj = new Scalar[order + 1];
 
-      if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_CONST)
-      {
-        proj[0] = proj[1] = bc->value_const;
-      } // If the BC is not constant.
-      else if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_FUNCTION)
-      {
-        surf_pos->t = surf_pos->lo;
-        // Find out the (x, y) coordinates for the first endpoint.
-        double x, y, n_x, n_y, t_x, t_y;
-        Nurbs* nurbs = surf_pos->base->is_curved() ? surf_pos->base->cm->nurbs[surf_pos->surf_num] : NULL;
-        CurvMap::nurbs_edge(surf_pos->base, nurbs, surf_pos->surf_num, 2.0*surf_pos->t - 1.0, x, y, n_x, n_y, t_x, t_y);
-        // Calculate.
-        proj[0] = bc->value(x, y, n_x, n_y, t_x, t_y);
-        surf_pos->t = surf_pos->hi;
-        // Find out the (x, y) coordinates for the second endpoint.
-        CurvMap::nurbs_edge(surf_pos->base, nurbs, surf_pos->surf_num, 2.0*surf_pos->t - 1.0, x, y, n_x, n_y, t_x, t_y);
-        // Calculate.
-        proj[1] = bc->value(x, y, n_x, n_y, t_x, t_y);
-      }
+      // The BC at the ends of the edge and at the integration points, evaluated once for all the edge functions.
+      Quad1DStd quad1d;
+      int mo = quad1d.get_max_order();
+      double2* pt = quad1d.get_points(mo);
+      Scalar* bc_values = new Scalar[quad1d.get_num_points(mo) + 2];
+      this->get_bc_values(surf_pos, bc, bc_values);
+      proj[0] = bc_values[0];
+      proj[1] = bc_values[1];
 
       if(order-- > 1)
       {
-        Quad1DStd quad1d;
         Scalar* rhs = proj + 2;
-        int mo = quad1d.get_max_order();
-        double2* pt = quad1d.get_points(mo);
 
         // get boundary values at integration points, construct rhs
         for (int i = 0; i < order; i++)
@@ -306,22 +325,8 @@ namespace Hermes
           {
             double t = (pt[j][0] + 1) * 0.5, s = 1.0 - t;
             Scalar l = proj[0] * s + proj[1] * t;
-            surf_pos->t = surf_pos->lo * s + surf_pos->hi * t;
-
-            if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_CONST)
-              rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
-              * (bc->value_const - l);
-            // If the BC is not constant.
-            else if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_FUNCTION)
-            {
-              // Find out the (x, y) coordinate.
-              double x, y, n_x, n_y, t_x, t_y;
-              Nurbs* nurbs = surf_pos->base->is_curved() ? surf_pos->base->cm->nurbs[surf_pos->surf_num] : NULL;
-              CurvMap::nurbs_edge(surf_pos->base, nurbs, surf_pos->surf_num, 2.0*surf_pos->t - 1.0, x, y, n_x, n_y, t_x, t_y);
-              // Calculate.
-              rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
-                * (bc->value(x, y, n_x, n_y, t_x, t_y) - l);
-            }
+            rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
+              * (bc_values[j + 2] - l);
           }
         }
 
@@ -329,6 +334,7 @@ namespace Hermes
         cholsl(this->proj_mat, order, this->chol_p, rhs, rhs);
       }
 
+      delete [] bc_values;
       return proj;
     }
 
@@ -412,7 +418,7 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    void H1Space<Scalar>::update_constrained_nodes(Element* e, EdgeInfo* ei0, EdgeInfo* ei1, EdgeInfo* ei2, EdgeInfo* ei3)
+    void H1Space<Scalar>::update_constrained_nodes(Element* e, EdgeInfo* ei0, EdgeInfo* ei1, EdgeInfo* ei2, EdgeInfo* ei3, Hermes::vector<void*>& baselists)
     {
       int j, k;
       EdgeInfo* ei[4] = { ei0, ei1, ei2, ei3 };
@@ -497,7 +503,7 @@ namespace Hermes
           typename Space<Scalar>::BaseComponent* edge_dofs;
           nd = &this->ndata[mid_vn->id];
           nd->baselist = merge_baselists(bl[0], nc[0], bl[1], nc[1], en, edge_dofs, nd->ncomponents);
-          this->bc_data.push_back(nd->baselist);
+          baselists.push_back(nd->baselist);
 
           // set edge node coeffs to function values of the edge functions
           double mid = (ei[i]->lo + ei[i]->hi) * 0.5;
@@ -538,27 +544,27 @@ namespace Hermes
         // recur to sons
         if(e->is_triangle())
         {
-          update_constrained_nodes(e->sons[0], half_ei[0][0], NULL, half_ei[2][1], NULL);
-          update_constrained_nodes(e->sons[1], half_ei[0][1], half_ei[1][0], NULL, NULL);
-          update_constrained_nodes(e->sons[2], NULL, half_ei[1][1], half_ei[2][0], NULL);
-          update_constrained_nodes(e->sons[3], NULL, NULL, NULL, NULL);
+          update_constrained_nodes(e->sons[0], half_ei[0][0], NULL, half_ei[2][1], NULL, baselists);
+          update_constrained_nodes(e->sons[1], half_ei[0][1], half_ei[1][0], NULL, NULL, baselists);
+          update_constrained_nodes(e->sons[2], NULL, half_ei[1][1], half_ei[2][0], NULL, baselists);
+          update_constrained_nodes(e->sons[3], NULL, NULL, NULL, NULL, baselists);
         }
         else if(e->sons[2] == NULL) // 'horizontally' split quad
         {
-          update_constrained_nodes(e->sons[0], ei[0], half_ei[1][0], NULL, half_ei[3][1]);
-          update_constrained_nodes(e->sons[1], NULL, half_ei[1][1], ei[2], half_ei[3][0]);
+          update_constrained_nodes(e->sons[0], ei[0], half_ei[1][0], NULL, half_ei[3][1], baselists);
+          update_constrained_nodes(e->sons[1], NULL, half_ei[1][1], ei[2], half_ei[3][0], baselists);
         }
         else if(e->sons[0] == NULL) // 'vertically' split quad
         {
-          update_constrained_nodes(e->sons[2], half_ei[0][0], NULL, half_ei[2][1], ei[3]);
-          update_constrained_nodes(e->sons[3], half_ei[0][1], ei[1], half_ei[2][0], NULL);
+          update_constrained_nodes(e->sons[2], half_ei[0][0], NULL, half_ei[2][1], ei[3], baselists);
+          update_constrained_nodes(e->sons[3], half_ei[0][1], ei[1], half_ei[2][0], NULL, baselists);
         }
         else // fully split quad
         {
-          update_constrained_nodes(e->sons[0], half_ei[0][0], NULL, NULL, half_ei[3][1]);
-          update_constrained_nodes(e->sons[1], half_ei[0][1], half_ei[1][0], NULL, NULL);
-          update_constrained_nodes(e->sons[2], NULL, half_ei[1][1], half_ei[2][0], NULL);
-          update_constrained_nodes(e->sons[3], NULL, NULL, half_ei[2][1], half_ei[3][0]);
+          update_constrained_nodes(e->sons[0], half_ei[0][0], NULL, NULL, half_ei[3][1], baselists);
+          update_constrained_nodes(e->sons[1], half_ei[0][1], half_ei[1][0], NULL, NULL, baselists);
+          update_constrained_nodes(e->sons[2], NULL, half_ei[1][1], half_ei[2][0], NULL, baselists);
+          update_constrained_nodes(e->sons[3], NULL, NULL, half_ei[2][1], half_ei[3][0], baselists);
         }
       }
     }
@@ -566,9 +572,24 @@ namespace Hermes
     template<typename Scalar>
     void H1Space<Scalar>::update_constraints()
     {
+      // The constraints inside the refinement tree of a base element only depend on the tree (a hanging node is
+      // constrained from the tree it was created in), the trees are processed in parallel.
+      std::vector<Element*> base_elements;
       Element* e;
       for_all_base_elements(e, this->mesh)
-        update_constrained_nodes(e, NULL, NULL, NULL, NULL);
+        base_elements.push_back(e);
+      int num_base_elements = (int)base_elements.size();
+
+      // The baselists allocated in each tree, added to bc_data in the order of the trees afterwards.
+      std::vector<Hermes::vector<void*> > tree_bc_data(num_base_elements);
+      int num_threads_used = Hermes2DApi.get_num_threads();
+#pragma omp parallel for num_threads(num_threads_used) schedule(dynamic, 1)
+      for (int k = 0; k < num_base_elements; k++)
+        update_constrained_nodes(base_elements[k], NULL, NULL, NULL, NULL, tree_bc_data[k]);
+
+      for (int k = 0; k < num_base_elements; k++)
+        for (unsigned int i = 0; i < tree_bc_data[k].size(); i++)
+          this->bc_data.push_back(tree_bc_data[k][i]);
     }
 
     template<typename Scalar>
@@ -194,34 +194,20 @@ namespace Hermes
       double el = sqrt(sqr(vn1->x - vn2->x) + sqr(vn1->y - vn2->y));
       el *= 0.5 * (surf_pos->hi - surf_pos->lo);
 
+      // The BC at the integration points, evaluated once for all the edge functions.
+      Scalar* bc_values = new Scalar[quad1d.get_num_points(mo) + 2];
+      this->get_bc_values(surf_pos, bc, bc_values);
+
       // get boundary values at integration points, construct rhs
       for (int i = 0; i <= order; i++)
       {
         rhs[i] = 0.0;
         int ii = this->shapeset->get_edge_index(0, 0, i, surf_pos->base->get_mode());
         for (int j = 0; j < quad1d.get_num_points(mo); j++)
-        {
-          double t = (pt[j][0] + 1) * 0.5, s = 1.0 - t;
-          surf_pos->t = surf_pos->lo * s + surf_pos->hi * t;
-
-          if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_CONST)
-          {
-            rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
-              * bc->value_const * el;
-          }
-          // If the BC is not constant.
-          else if(bc->get_value_type() == EssentialBoundaryCondition<Scalar>::BC_FUNCTION)
-          {
-            // Find out the (x, y) coordinate.
-            double x, y, n_x, n_y, t_x, t_y;
-            Nurbs* nurbs = surf_pos->base->is_curved() ? surf_pos->base->cm->nurbs[surf_pos->surf_num] : NULL;
-            CurvMap::nurbs_edge(surf_pos->base, nurbs, surf_pos->surf_num, 2.0*surf_pos->t - 1.0, x, y, n_x, n_y, t_x, t_y);
-            // Calculate.
-            rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
-              * bc->value(x, y, n_x, n_y, t_x, t_y) * el;
-          }
-        }
+          rhs[i] += pt[j][1] * this->shapeset->get_fn_value(ii, pt[j][0], -1.0, 0, surf_pos->base->get_mode())
+            * bc_values[j + 2] * el;
       }
+      delete [] bc_values;
 
       // solve the system using a precalculated Cholesky decomposed projection matrix
       cholsl(this->proj_mat, order + 1, this->chol_p, rhs, rhs);
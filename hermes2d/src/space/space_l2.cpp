@@ -96,6 +96,18 @@ namespace Hermes
       Space<Scalar>::resize_tables();
     }
 
+    template<typename Scalar>
+    void L2Space<Scalar>::shrink_to_fit()
+    {
+      int element_count = std::max(this->mesh->get_max_element_id(), 1000);
+      if(ldata != NULL && lsize > element_count)
+      {
+        ldata = (L2Data*) realloc(ldata, sizeof(L2Data) * element_count);
+        lsize = element_count;
+      }
+      Space<Scalar>::shrink_to_fit();
+    }
+
     template<typename Scalar>
     void L2Space<Scalar>::assign_bubble_dofs()
     {
@@ -116,21 +128,11 @@ namespace Hermes
     {}
 
     template<typename Scalar>
-    void L2Space<Scalar>::get_element_assembly_list(Element* e, AsmList<Scalar>* al, unsigned int first_dof) const
+    void L2Space<Scalar>::get_element_assembly_list_internal(Element* e, AsmList<Scalar>* al) const
     {
-      if(e->id >= this->esize || this->edata[e->id].order < 0)
-        throw Hermes::Exceptions::Exception("Uninitialized element order (id = #%d).", e->id);
-      if(!this->is_up_to_date())
-        throw Hermes::Exceptions::Exception("The space is out of date. You need to update it with assign_dofs()"
-        " any time the mesh changes.");
-
       // add bubble functions to the assembly list
       al->cnt = 0;
       get_bubble_assembly_list(e, al);
-
-      for(unsigned int i = 0; i < al->cnt; i++)
-        if(al->dof[i] >= 0)
-          al->dof[i] += first_dof;
     }
 
     template<typename Scalar>
@@ -23,7 +23,7 @@ namespace Hermes
     CubicSpline::CubicSpline(Hermes::vector<double> points, Hermes::vector<double> values,
       double bc_left, double bc_right,
       bool first_der_left, bool first_der_right,
-      bool extrapolate_der_left, bool extrapolate_der_right) : Hermes::Hermes1DFunction<double>(), points(points), values(values),
+      bool extrapolate_der_left, bool extrapolate_der_right) : Hermes::Hermes1DFunction<double>(), points(points), point_values(values),
       bc_left(bc_left), bc_right(bc_right), first_der_left(first_der_left),
       first_der_right(first_der_right), extrapolate_der_left(extrapolate_der_left),
       extrapolate_der_right(extrapolate_der_right)
@@ -39,7 +39,7 @@ namespace Hermes
     {
       coeffs.clear();  
       points.clear();
-      values.clear();
+      point_values.clear();
     };
 
     double CubicSpline::value(double x) const
@@ -47,7 +47,43 @@ namespace Hermes
       // For simple constant case.
       if(this->is_const)
         return const_value;
-      // For general case.
+      return evaluate_value(x);
+    };
+
+    double CubicSpline::derivative(double x) const
+    {
+      // For simple constant case.
+      if(this->is_const)
+        return 0.0;
+      return evaluate_derivative(x);
+    };
+
+    void CubicSpline::values(int n, const double* x, double* out) const
+    {
+      if(this->is_const)
+      {
+        for (int i = 0; i < n; i++)
+          out[i] = const_value;
+        return;
+      }
+      for (int i = 0; i < n; i++)
+        out[i] = evaluate_value(x[i]);
+    }
+
+    void CubicSpline::derivatives(int n, const double* x, double* out) const
+    {
+      if(this->is_const)
+      {
+        for (int i = 0; i < n; i++)
+          out[i] = 0.0;
+        return;
+      }
+      for (int i = 0; i < n; i++)
+        out[i] = evaluate_derivative(x[i]);
+    }
+
+    double CubicSpline::evaluate_value(double x) const
+    {
       int m = -1;
       if(!this->find_interval(x, m))
       {
@@ -76,15 +112,10 @@ namespace Hermes
       }
 
       return get_value_from_interval(x, m);
-    };
+    }
 
-    double CubicSpline::derivative(double x) const
+    double CubicSpline::evaluate_derivative(double x) const
     {
-      // For simple constant case.
-      if(this->is_const)
-        return 0.0;
-
-      // For general case.
       int m = -1;
       if(!this->find_interval(x, m))
       {
@@ -111,7 +142,7 @@ namespace Hermes
       }
 
       return get_derivative_from_interval(x, m);
-    };
+    }
 
     double CubicSpline::extrapolate_value(double point_end, double value_end,
       double derivative_end, double x_in) const
@@ -121,17 +152,14 @@ namespace Hermes
 
     double CubicSpline::get_value_from_interval(double x_in, int m) const
     {
-      double x2 = x_in * x_in;
-      double x3 = x2 * x_in;
-      return   this->coeffs[m].a + this->coeffs[m].b * x_in + this->coeffs[m].c * x2
-        + this->coeffs[m].d * x3;
+      const SplineCoeff& coeff = this->coeffs[m];
+      return coeff.a + x_in * (coeff.b + x_in * (coeff.c + x_in * coeff.d));
     }
 
     double CubicSpline::get_derivative_from_interval(double x_in, int m) const
     {
-      double x2 = x_in * x_in;
-      return this->coeffs[m].b + 2 * this->coeffs[m].c * x_in
-        + 3 * this->coeffs[m].d * x2;
+      const SplineCoeff& coeff = this->coeffs[m];
+      return coeff.b + x_in * (2 * coeff.c + x_in * 3 * coeff.d);
     }
 
     bool CubicSpline::find_interval(double x_in, int &m) const
@@ -144,6 +172,20 @@ namespace Hermes
       if(x_in < points[i_left]) return false;
       if(x_in > points[i_right]) return false;
 
+      // The lookup table - the bisection only among the intervals of the bin.
+      if(!bin_intervals.empty())
+      {
+        int bin = std::min((int)((x_in - points[0]) * bin_scale), (int)bin_intervals.size() - 1);
+        i_left = bin_intervals[bin];
+        if(bin + 1 < (int)bin_intervals.size())
+          i_right = std::min(bin_intervals[bin + 1] + 1, i_right);
+        // Rounding of the bin index.
+        while (i_left > 0 && points[i_left] >= x_in)
+          i_left--;
+        while (i_right < (int)points.size() - 1 && points[i_right] < x_in)
+          i_right++;
+      }
+
       while (i_left + 1 < i_right)
       {
         int i_mid = (i_left + i_right) / 2;
@@ -225,17 +267,17 @@ namespace Hermes
       int nelem = points.size() - 1;
 
       // Basic sanity checks.
-      if(points.empty() || values.empty())
+      if(points.empty() || point_values.empty())
       {
         this->warn("Empty points or values vector in CubicSpline, cancelling coefficients calculation.");
         return;
       }
-      if(points.size() < 2 || values.size() < 2)
+      if(points.size() < 2 || point_values.size() < 2)
       {
         this->warn("At least two points and values required in CubicSpline, cancelling coefficients calculation.");
         return;
       }
-      if(points.size() != values.size())
+      if(points.size() != point_values.size())
       {
         this->warn("Mismatched number of points and values in CubicSpline, cancelling coefficients calculation.");
         return;
@@ -273,8 +315,8 @@ namespace Hermes
       // Fill the rhs vector.
       for (int i = 0; i < nelem; i++)
       {
-        rhs[2*i] = values[i];
-        rhs[2*i + 1] = values[i + 1];
+        rhs[2*i] = point_values[i];
+        rhs[2*i + 1] = point_values[i + 1];
       }
 
       // Fill the matrix. Step 1 - match values at interval endpoints.
@@ -381,12 +423,25 @@ namespace Hermes
       // the points[] and values[] arrays are no longer
       // needed.
       point_left = points[0];
-      value_left = values[0];
+      value_left = point_values[0];
       derivative_left = get_derivative_from_interval(point_left, 0);
       point_right = points[points.size() - 1];
-      value_right = values[values.size() - 1];
+      value_right = point_values[point_values.size() - 1];
       derivative_right = get_derivative_from_interval(point_right, points.size() - 2);
 
+      // The lookup table of the intervals, about two bins per interval.
+      int bin_count = 2 * nelem;
+      bin_scale = bin_count / (point_right - point_left);
+      bin_intervals.resize(bin_count);
+      int m = 0;
+      for (int bin = 0; bin < bin_count; bin++)
+      {
+        double bin_start = point_left + bin / bin_scale;
+        while (m + 1 < nelem && points[m + 1] < bin_start)
+          m++;
+        bin_intervals[bin] = m;
+      }
+
       // Free the matrix and rhs vector.
       delete [] matrix;
       delete [] rhs;
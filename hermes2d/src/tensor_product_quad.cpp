@@ -0,0 +1,241 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "tensor_product_quad.h"
+#include "quadrature/quad_all.h"
+#include "shapeset/shapeset_common.h"
+#include <map>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    // Highest 1D Lobatto function index used by the quad shapesets.
+    static const int max_1d_index = 11;
+
+    static double lobatto_value(int k, double x)
+    {
+      switch(k)
+      {
+      case 0: return l0(x);
+      case 1: return l1(x);
+      case 2: return l2(x);
+      case 3: return l3(x);
+      case 4: return l4(x);
+      case 5: return l5(x);
+      case 6: return l6(x);
+      case 7: return l7(x);
+      case 8: return l8(x);
+      case 9: return l9(x);
+      case 10: return l10(x);
+      default: return l11(x);
+      }
+    }
+
+    static double lobatto_derivative(int k, double x)
+    {
+      switch(k)
+      {
+      case 0: return dl0(x);
+      case 1: return dl1(x);
+      case 2: return dl2(x);
+      case 3: return dl3(x);
+      case 4: return dl4(x);
+      case 5: return dl5(x);
+      case 6: return dl6(x);
+      case 7: return dl7(x);
+      case 8: return dl8(x);
+      case 9: return dl9(x);
+      case 10: return dl10(x);
+      default: return dl11(x);
+      }
+    }
+
+    // Detected structures, per shapeset id.
+    static std::map<int, TensorProductQuad> tensor_product_quads;
+
+    TensorProductQuad::TensorProductQuad() : tensor_product(false)
+    {
+    }
+
+    const TensorProductQuad* TensorProductQuad::get(Shapeset* shapeset)
+    {
+      if(shapeset->get_num_components() > 1)
+        return NULL;
+
+      TensorProductQuad* result;
+#pragma omp critical (tensor_product_quads)
+      {
+        std::map<int, TensorProductQuad>::iterator it = tensor_product_quads.find(shapeset->get_id());
+        if(it == tensor_product_quads.end())
+        {
+          result = &tensor_product_quads[shapeset->get_id()];
+          result->detect(shapeset);
+        }
+        else
+          result = &it->second;
+      }
+
+      return result->tensor_product ? result : NULL;
+    }
+
+    void TensorProductQuad::detect(Shapeset* shapeset)
+    {
+      // Generic points, no 1D function vanishes in them.
+      static const int num_test_points = 4;
+      static const double test_points[num_test_points][2] = { { 0.3137, -0.4271 }, { -0.7213, 0.1553 }, { 0.5879, 0.8311 }, { -0.2519, -0.6637 } };
+
+      this->tensor_product = true;
+      int num_indices = shapeset->get_max_index(HERMES_MODE_QUAD) + 1;
+      this->x_index.resize(num_indices);
+      this->y_index.resize(num_indices);
+      this->sign.resize(num_indices);
+
+      for(int index = 0; index < num_indices && this->tensor_product; index++)
+      {
+        double fn[num_test_points];
+        for(int pt_i = 0; pt_i < num_test_points; pt_i++)
+          fn[pt_i] = shapeset->get_fn_value(index, test_points[pt_i][0], test_points[pt_i][1], 0, HERMES_MODE_QUAD);
+
+        bool found = false;
+        for(int a = 0; a <= max_1d_index && !found; a++)
+        {
+          for(int b = 0; b <= max_1d_index && !found; b++)
+          {
+            double s = fn[0] / (lobatto_value(a, test_points[0][0]) * lobatto_value(b, test_points[0][1]));
+            if(std::abs(std::abs(s) - 1.0) > 1e-10)
+              continue;
+            s = s > 0 ? 1.0 : -1.0;
+
+            found = true;
+            for(int pt_i = 1; pt_i < num_test_points; pt_i++)
+              if(std::abs(fn[pt_i] - s * lobatto_value(a, test_points[pt_i][0]) * lobatto_value(b, test_points[pt_i][1])) > 1e-10 * (1.0 + std::abs(fn[pt_i])))
+                found = false;
+
+            if(found)
+            {
+              this->x_index[index] = a;
+              this->y_index[index] = b;
+              this->sign[index] = s;
+            }
+          }
+        }
+
+        if(!found)
+          this->tensor_product = false;
+      }
+    }
+
+    bool TensorProductQuad::has_indices(int cnt, int* idx) const
+    {
+      for(int i = 0; i < cnt; i++)
+        if(idx[i] < 0 || idx[i] >= (int)this->x_index.size())
+          return false;
+      return true;
+    }
+
+    template<typename Scalar>
+    void TensorProductQuad::assemble(int order, int n_test, int* test_idx, int n_base, int* base_idx, Scalar* mass, Scalar* diffusion, Scalar** result) const
+    {
+      const int n_1d = max_1d_index + 1;
+      int np = g_quad_1d_std.get_num_points(order);
+      double2* pt = g_quad_1d_std.get_points(order);
+
+      // 1D functions in the 1D points, [function][point].
+      double* val = new double[n_1d * np];
+      double* der = new double[n_1d * np];
+      for(int k = 0; k < n_1d; k++)
+        for(int i = 0; i < np; i++)
+        {
+          val[k * np + i] = lobatto_value(k, pt[i][0]);
+          der[k * np + i] = lobatto_derivative(k, pt[i][0]);
+        }
+
+      // Which 1D functions in x are used by the test / basis functions.
+      bool used_test[n_1d], used_base[n_1d];
+      memset(used_test, 0, sizeof(used_test));
+      memset(used_base, 0, sizeof(used_base));
+      for(int i = 0; i < n_test; i++)
+        used_test[this->x_index[test_idx[i]]] = true;
+      for(int j = 0; j < n_base; j++)
+        used_base[this->x_index[base_idx[j]]] = true;
+
+      // First contraction - over the points in x (point index = x_point * np + y_point).
+      // For the pair (a, c) of 1D functions in x of the test / basis function and every point in y:
+      // c0 - pairs with l_b(y) l_d(y), c1 - with l_b(y) l_d'(y), c2 - with l_b'(y) l_d(y), c3 - with l_b'(y) l_d'(y).
+      Scalar* c = new Scalar[4 * n_1d * n_1d * np];
+      for(int a = 0; a < n_1d; a++)
+      {
+        if(!used_test[a])
+          continue;
+        for(int c_i = 0; c_i < n_1d; c_i++)
+        {
+          if(!used_base[c_i])
+            continue;
+          Scalar* c_ac = c + 4 * (a * n_1d + c_i) * np;
+          for(int j = 0; j < np; j++)
+          {
+            Scalar c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+            for(int i = 0; i < np; i++)
+            {
+              int point = i * np + j;
+              double va = val[a * np + i], vc = val[c_i * np + i];
+              double da = der[a * np + i], dc = der[c_i * np + i];
+              if(mass != NULL)
+                c0 += mass[point] * va * vc;
+              if(diffusion != NULL)
+              {
+                Scalar* d = diffusion + 3 * point;
+                c0 += d[0] * da * dc;
+                c1 += d[1] * da * vc;
+                c2 += d[1] * va * dc;
+                c3 += d[2] * va * vc;
+              }
+            }
+            c_ac[4 * j] = c0;
+            c_ac[4 * j + 1] = c1;
+            c_ac[4 * j + 2] = c2;
+            c_ac[4 * j + 3] = c3;
+          }
+        }
+      }
+
+      // Second contraction - over the points in y.
+      for(int i = 0; i < n_test; i++)
+      {
+        int a = this->x_index[test_idx[i]];
+        double* vb = val + this->y_index[test_idx[i]] * np;
+        double* db = der + this->y_index[test_idx[i]] * np;
+        for(int j = 0; j < n_base; j++)
+        {
+          Scalar* c_ac = c + 4 * (a * n_1d + this->x_index[base_idx[j]]) * np;
+          double* vd = val + this->y_index[base_idx[j]] * np;
+          double* dd = der + this->y_index[base_idx[j]] * np;
+          Scalar value = 0;
+          for(int k = 0; k < np; k++)
+            value += c_ac[4 * k] * vb[k] * vd[k] + c_ac[4 * k + 1] * vb[k] * dd[k] + c_ac[4 * k + 2] * db[k] * vd[k] + c_ac[4 * k + 3] * db[k] * dd[k];
+          result[i][j] = this->sign[test_idx[i]] * this->sign[base_idx[j]] * value;
+        }
+      }
+
+      delete [] c;
+      delete [] val;
+      delete [] der;
+    }
+
+    template HERMES_API void TensorProductQuad::assemble<double>(int order, int n_test, int* test_idx, int n_base, int* base_idx, double* mass, double* diffusion, double** result) const;
+    template HERMES_API void TensorProductQuad::assemble<std::complex<double> >(int order, int n_test, int* test_idx, int n_base, int* base_idx, std::complex<double>* mass, std::complex<double>* diffusion, std::complex<double>** result) const;
+  }
+}
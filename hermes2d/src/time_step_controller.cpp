@@ -0,0 +1,258 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "time_step_controller.h"
+#include "global.h"
+#include <limits>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    template<typename Scalar>
+    TimeStepController<Scalar>::TimeStepController(RungeKutta<Scalar>* runge_kutta, double tolerance, int error_order, TimeStepControllerType type)
+      : runge_kutta(runge_kutta), error_order(error_order), safety_factor(0.9), min_factor(0.2), max_factor(5.0),
+      min_time_step(0.0), max_time_step(std::numeric_limits<double>::max()), max_rejections(20), time(0.0), time_step(0.0),
+      last_error(0.0), last_but_one_error(0.0), num_accepted(0), num_rejected(0)
+    {
+      if(runge_kutta == NULL)
+        throw Exceptions::NullException(1);
+      if(error_order < 1)
+        throw Exceptions::ValueException("error_order", error_order, 1);
+      set_tolerance(tolerance);
+
+      switch(type)
+      {
+      case HERMES_I_CONTROLLER:
+        set_betas(1.0, 0.0, 0.0);
+        break;
+      case HERMES_PI_CONTROLLER:
+        set_betas(0.7, -0.4, 0.0);
+        break;
+      case HERMES_PID_CONTROLLER:
+        set_betas(0.49, -0.34, 0.1);
+        break;
+      }
+    }
+
+    template<typename Scalar>
+    TimeStepController<Scalar>::~TimeStepController()
+    {
+      for(unsigned int i = 0; i < error_fns.size(); i++)
+        delete error_fns[i];
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_time(double time)
+    {
+      this->time = time;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_time_step(double time_step)
+    {
+      if(time_step <= 0.0)
+        throw Exceptions::ValueException("time_step", time_step, 0.0);
+      this->time_step = time_step;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_tolerance(double tolerance)
+    {
+      if(tolerance <= 0.0)
+        throw Exceptions::ValueException("tolerance", tolerance, 0.0);
+      this->tolerance = tolerance;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_betas(double beta1, double beta2, double beta3)
+    {
+      this->beta1 = beta1;
+      this->beta2 = beta2;
+      this->beta3 = beta3;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_safety_factor(double safety_factor)
+    {
+      if(safety_factor <= 0.0 || safety_factor > 1.0)
+        throw Exceptions::ValueException("safety_factor", safety_factor, 0.0, 1.0);
+      this->safety_factor = safety_factor;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_factor_limits(double min_factor, double max_factor)
+    {
+      if(min_factor <= 0.0 || min_factor >= 1.0)
+        throw Exceptions::ValueException("min_factor", min_factor, 0.0, 1.0);
+      if(max_factor <= 1.0)
+        throw Exceptions::ValueException("max_factor", max_factor, 1.0);
+      this->min_factor = min_factor;
+      this->max_factor = max_factor;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_time_step_limits(double min_time_step, double max_time_step)
+    {
+      if(min_time_step < 0.0)
+        throw Exceptions::ValueException("min_time_step", min_time_step, 0.0);
+      if(max_time_step <= min_time_step)
+        throw Exceptions::ValueException("max_time_step", max_time_step, min_time_step);
+      this->min_time_step = min_time_step;
+      this->max_time_step = max_time_step;
+    }
+
+    template<typename Scalar>
+    void TimeStepController<Scalar>::set_max_rejections(int max_rejections)
+    {
+      if(max_rejections < 0)
+        throw Exceptions::ValueException("max_rejections", max_rejections, 0);
+      this->max_rejections = max_rejections;
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::step_factor(double err, bool after_rejection) const
+    {
+      double k = this->error_order + 1.0;
+      double factor;
+      if(err <= 0.0)
+        factor = this->max_factor;
+      else
+      {
+        factor = this->safety_factor * std::pow(this->tolerance / err, this->beta1 / k);
+        // The history is only used for smooth sequences of accepted steps.
+        if(!after_rejection && this->last_error > 0.0)
+          factor *= std::pow(this->tolerance / this->last_error, this->beta2 / k);
+        if(!after_rejection && this->last_but_one_error > 0.0)
+          factor *= std::pow(this->tolerance / this->last_but_one_error, this->beta3 / k);
+      }
+
+      factor = std::max(this->min_factor, std::min(after_rejection ? 1.0 : this->max_factor, factor));
+      return factor;
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::step(Hermes::vector<Solution<Scalar>*> slns_time_prev, Hermes::vector<Solution<Scalar>*> slns_time_new)
+    {
+      if(this->time_step <= 0.0)
+        throw Exceptions::Exception("TimeStepController::step(): the initial time step has not been set.");
+
+      // The error functions are kept over the steps, vector_to_solutions() reinitializes them.
+      if(this->error_fns.empty())
+        for(unsigned int i = 0; i < slns_time_prev.size(); i++)
+          this->error_fns.push_back(new Solution<Scalar>());
+
+      bool rejected = false;
+      for(int rejections = 0; ; rejections++)
+      {
+        double h = std::max(this->min_time_step, std::min(this->max_time_step, this->time_step));
+        this->runge_kutta->set_time(this->time);
+        this->runge_kutta->set_time_step(h);
+
+        // A failure of the Newton's method is a rejection as well, its K vectors are not a good initial guess.
+        bool newton_failed = false;
+        try
+        {
+          this->runge_kutta->rk_time_step_newton(slns_time_prev, slns_time_new, this->error_fns);
+        }
+        catch(Exceptions::ValueException& e)
+        {
+          newton_failed = true;
+          this->runge_kutta->reset_K_vector();
+          this->info("\tTimeStepController: step %g at time %g failed: %s", h, this->time, e.what());
+        }
+
+        double err = 0.0;
+        if(!newton_failed)
+        {
+          double sln_norm = Global<Scalar>::calc_norms(slns_time_new);
+          err = Global<Scalar>::calc_norms(this->error_fns);
+          if(sln_norm > 0.0)
+            err /= sln_norm;
+        }
+
+        if(!newton_failed && (err <= this->tolerance || h <= this->min_time_step))
+        {
+          this->time += h;
+          this->time_step = h * this->step_factor(err, rejected);
+          this->last_but_one_error = this->last_error;
+          this->last_error = err;
+          this->num_accepted++;
+          this->info("\tTimeStepController: accepted step %g, error %g, next step %g.", h, err, this->time_step);
+          return h;
+        }
+
+        this->num_rejected++;
+        if(rejections >= this->max_rejections || h <= this->min_time_step)
+          throw Exceptions::Exception("TimeStepController::step(): the step at time %g was rejected %d times.", this->time, rejections + 1);
+
+        // Repeated from slns_time_prev, which rk_time_step_newton() does not change.
+        this->time_step = h * (newton_failed ? this->min_factor : this->step_factor(err, true));
+        if(!newton_failed)
+          this->info("\tTimeStepController: rejected step %g, error %g, new step %g.", h, err, this->time_step);
+        rejected = true;
+      }
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::step(Solution<Scalar>* sln_time_prev, Solution<Scalar>* sln_time_new)
+    {
+      Hermes::vector<Solution<Scalar>*> slns_time_prev;
+      slns_time_prev.push_back(sln_time_prev);
+      Hermes::vector<Solution<Scalar>*> slns_time_new;
+      slns_time_new.push_back(sln_time_new);
+      return step(slns_time_prev, slns_time_new);
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::get_time() const
+    {
+      return this->time;
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::get_time_step() const
+    {
+      return this->time_step;
+    }
+
+    template<typename Scalar>
+    double TimeStepController<Scalar>::get_last_error() const
+    {
+      return this->last_error;
+    }
+
+    template<typename Scalar>
+    Hermes::vector<Solution<Scalar>*> TimeStepController<Scalar>::get_error_fns() const
+    {
+      return this->error_fns;
+    }
+
+    template<typename Scalar>
+    int TimeStepController<Scalar>::get_num_accepted() const
+    {
+      return this->num_accepted;
+    }
+
+    template<typename Scalar>
+    int TimeStepController<Scalar>::get_num_rejected() const
+    {
+      return this->num_rejected;
+    }
+
+    template class HERMES_API TimeStepController<double>;
+    template class HERMES_API TimeStepController<std::complex<double> >;
+  }
+}
@@ -0,0 +1,413 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "image_renderer.h"
+#include "api2d.h"
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
+#include "view_data.cpp"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace Views
+    {
+      ImageRenderer::ImageRenderer(int width, int height) : lin(true), pixels(NULL), width(0), height(0),
+        pal_type(H2DV_PT_HUESCALE), pal_steps(50), range_auto(true), range_min(0.0), range_max(1.0), show_edges(false)
+      {
+        bg_color[0] = bg_color[1] = bg_color[2] = 255;
+        set_size(width, height);
+      }
+
+      ImageRenderer::~ImageRenderer()
+      {
+        ::free(pixels);
+      }
+
+      void ImageRenderer::set_size(int width, int height)
+      {
+        if(width < 1 || height < 1)
+          throw Exceptions::ValueException("width", width < 1 ? width : height, 1, 65535);
+        unsigned char* new_pixels = (unsigned char*)realloc(pixels, 3 * (size_t)width * height);
+        if(new_pixels == NULL)
+          throw Exceptions::Exception("Could not allocate memory for pixel data");
+        this->pixels = new_pixels;
+        this->width = width;
+        this->height = height;
+        memset(pixels, 255, 3 * (size_t)width * height);
+      }
+
+      void ImageRenderer::set_palette(ViewPaletteType type)
+      {
+        pal_type = type;
+      }
+
+      void ImageRenderer::set_num_palette_steps(int num)
+      {
+        if(num < 2) num = 2;
+        if(num > 256) num = 256;
+        pal_steps = num;
+      }
+
+      void ImageRenderer::set_min_max_range(double min, double max)
+      {
+        if(max < min)
+        {
+          std::swap(min, max);
+          this->warn("Upper bound set below the lower bound: reversing to (%f, %f).", min, max);
+        }
+        range_auto = false;
+        range_min = min;
+        range_max = max;
+      }
+
+      void ImageRenderer::auto_min_max_range()
+      {
+        range_auto = true;
+      }
+
+      void ImageRenderer::show_mesh(bool show)
+      {
+        show_edges = show;
+      }
+
+      void ImageRenderer::set_background_color(float r, float g, float b)
+      {
+        bg_color[0] = (unsigned char)(std::max(0.0f, std::min(r, 1.0f)) * 255);
+        bg_color[1] = (unsigned char)(std::max(0.0f, std::min(g, 1.0f)) * 255);
+        bg_color[2] = (unsigned char)(std::max(0.0f, std::min(b, 1.0f)) * 255);
+      }
+
+      const unsigned char* ImageRenderer::get_pixels() const
+      {
+        return pixels;
+      }
+
+      Linearizer* ImageRenderer::get_linearizer()
+      {
+        return &lin;
+      }
+
+      void ImageRenderer::get_palette_color(double x, unsigned char* color) const
+      {
+        // the palette is applied in pal_steps discrete steps, as the (GL_NEAREST) palette texture of View does
+        if(x < 0.0) x = 0.0;
+        else if(x > 1.0) x = 1.0;
+        x = std::min(std::floor(x * pal_steps), pal_steps - 1.0) / pal_steps;
+
+        if(pal_type == H2DV_PT_HUESCALE || pal_type == H2DV_PT_DEFAULT)
+        {
+          int n = (int)(x * num_pal_entries);
+          for(int i = 0; i < 3; i++)
+            color[i] = (unsigned char)(palette_data[n][i] * 255);
+        }
+        else if(pal_type == H2DV_PT_GRAYSCALE)
+          color[0] = color[1] = color[2] = (unsigned char)(x * 255);
+        else if(pal_type == H2DV_PT_INVGRAYSCALE)
+          color[0] = color[1] = color[2] = (unsigned char)((1.0 - x) * 255);
+        else
+          color[0] = color[1] = color[2] = 255;
+      }
+
+      void ImageRenderer::render(MeshFunction<double>* sln, int item, double eps)
+      {
+        lin.process_solution(sln, item, eps);
+
+        lin.lock_data();
+        for(size_t i = 0; i < 3 * (size_t)width * height; i += 3)
+          memcpy(pixels + i, bg_color, 3);
+
+        if(lin.get_num_vertices() == 0)
+        {
+          lin.unlock_data();
+          return;
+        }
+
+        // fit the bounding box of the vertices into the image, with a margin, keeping the aspect ratio
+        double min_x, max_x, min_y, max_y;
+        lin.calc_vertices_aabb(&min_x, &max_x, &min_y, &max_y);
+        const int margin = 10;
+        double size_x = std::max(max_x - min_x, 1e-12), size_y = std::max(max_y - min_y, 1e-12);
+        double scale = std::min(std::max(width - 2 * margin, 1) / size_x, std::max(height - 2 * margin, 1) / size_y);
+        double offset_x = (width - size_x * scale) / 2 - min_x * scale;
+        double offset_y = (height - size_y * scale) / 2 - min_y * scale;
+
+        double min = range_auto ? lin.get_min_value() : range_min;
+        double max = range_auto ? lin.get_max_value() : range_max;
+        double range = (max - min) > 1e-12 ? (max - min) : 1.0;
+
+        // horizontal bands of the image are rasterized in parallel, each thread writes its own rows only
+        int num_threads_used = Hermes2DApi.get_num_threads();
+        int band_size = std::max(1, (height + 4 * num_threads_used - 1) / (4 * num_threads_used));
+        int num_bands = (height + band_size - 1) / band_size;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads_used)
+        for(int band = 0; band < num_bands; band++)
+          rasterize_rows(band * band_size, std::min(height, (band + 1) * band_size), scale, offset_x, offset_y, min, range);
+
+        lin.unlock_data();
+      }
+
+      void ImageRenderer::rasterize_rows(int row_from, int row_to, double scale, double offset_x, double offset_y, double min, double range)
+      {
+        double3* verts = lin.get_vertices();
+        int3* tris = lin.get_triangles();
+        int num_tris = lin.get_num_triangles();
+
+        // image coordinates: x to the right, y downwards
+#define IMG_X(v) (verts[v][0] * scale + offset_x)
+#define IMG_Y(v) (this->height - (verts[v][1] * scale + offset_y))
+
+        for(int i = 0; i < num_tris; i++)
+        {
+          double x[3], y[3], c[3];
+          for(int j = 0; j < 3; j++)
+          {
+            x[j] = IMG_X(tris[i][j]);
+            y[j] = IMG_Y(tris[i][j]);
+            c[j] = (verts[tris[i][j]][2] - min) / range;
+          }
+
+          int py_from = std::max(row_from, (int)std::floor(std::min(y[0], std::min(y[1], y[2]))));
+          int py_to = std::min(row_to - 1, (int)std::ceil(std::max(y[0], std::max(y[1], y[2]))));
+          if(py_from > py_to)
+            continue;
+          int px_from = std::max(0, (int)std::floor(std::min(x[0], std::min(x[1], x[2]))));
+          int px_to = std::min(width - 1, (int)std::ceil(std::max(x[0], std::max(x[1], x[2]))));
+
+          double area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+          if(std::abs(area) < 1e-14)
+            continue;
+
+          for(int py = py_from; py <= py_to; py++)
+          {
+            double sy = py + 0.5;
+            for(int px = px_from; px <= px_to; px++)
+            {
+              double sx = px + 0.5;
+              // barycentric coordinates of the pixel center, a pixel on a shared edge goes to either triangle
+              double l1 = ((x[2] - x[1]) * (sy - y[1]) - (sx - x[1]) * (y[2] - y[1])) / area;
+              double l2 = ((x[0] - x[2]) * (sy - y[2]) - (sx - x[2]) * (y[0] - y[2])) / area;
+              double l3 = 1.0 - l1 - l2;
+              if(l1 < 0 || l2 < 0 || l3 < 0)
+                continue;
+              get_palette_color(l1 * c[0] + l2 * c[1] + l3 * c[2], pixels + 3 * ((size_t)py * width + px));
+            }
+          }
+        }
+
+        int2* edges = lin.get_edges();
+        int* edge_markers = lin.get_edge_markers();
+        int num_edges = lin.get_num_edges();
+        for(int i = 0; i < num_edges; i++)
+        {
+          if(!show_edges && edge_markers[i] == 0)
+            continue;
+
+          double x1 = IMG_X(edges[i][0]), y1 = IMG_Y(edges[i][0]);
+          double x2 = IMG_X(edges[i][1]), y2 = IMG_Y(edges[i][1]);
+          if(std::max(y1, y2) < row_from || std::min(y1, y2) >= row_to)
+            continue;
+
+          int steps = (int)std::ceil(std::max(std::abs(x2 - x1), std::abs(y2 - y1))) + 1;
+          for(int s = 0; s <= steps; s++)
+          {
+            double t = (double)s / steps;
+            int px = (int)(x1 + t * (x2 - x1));
+            int py = (int)(y1 + t * (y2 - y1));
+            if(py >= row_from && py < row_to && px >= 0 && px < width)
+              memset(pixels + 3 * ((size_t)py * width + px), 0, 3);
+          }
+        }
+#undef IMG_X
+#undef IMG_Y
+      }
+
+      void ImageRenderer::save_image(const char* filename) const
+      {
+        if(is_png_file_name(filename))
+          save_png(filename, pixels, width, height);
+        else
+          save_bmp(filename, pixels, width, height);
+      }
+
+      void ImageRenderer::save_image(MeshFunction<double>* sln, const char* filename, int item, double eps)
+      {
+        render(sln, item, eps);
+        save_image(filename);
+      }
+
+      bool ImageRenderer::is_png_file_name(const char* filename)
+      {
+        size_t len = strlen(filename);
+        return len >= 4 && filename[len - 4] == '.' && tolower(filename[len - 3]) == 'p'
+          && tolower(filename[len - 2]) == 'n' && tolower(filename[len - 1]) == 'g';
+      }
+
+      // CRC-32 as used by the PNG chunks.
+      static unsigned int png_crc(unsigned int crc, const unsigned char* data, size_t length)
+      {
+        static unsigned int table[256];
+        static bool table_ready = false;
+        if(!table_ready)
+        {
+          for(unsigned int n = 0; n < 256; n++)
+          {
+            unsigned int c = n;
+            for(int k = 0; k < 8; k++)
+              c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            table[n] = c;
+          }
+          table_ready = true;
+        }
+        crc = ~crc;
+        for(size_t i = 0; i < length; i++)
+          crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+        return ~crc;
+      }
+
+      static void png_put_uint32(std::vector<unsigned char>& out, unsigned int value)
+      {
+        out.push_back((unsigned char)(value >> 24));
+        out.push_back((unsigned char)(value >> 16));
+        out.push_back((unsigned char)(value >> 8));
+        out.push_back((unsigned char)value);
+      }
+
+      static void png_write_chunk(FILE* file, const char* type, const std::vector<unsigned char>& data)
+      {
+        std::vector<unsigned char> chunk;
+        png_put_uint32(chunk, (unsigned int)data.size());
+        chunk.insert(chunk.end(), type, type + 4);
+        chunk.insert(chunk.end(), data.begin(), data.end());
+        png_put_uint32(chunk, png_crc(0, &chunk[4], chunk.size() - 4));
+        if(fwrite(&chunk[0], 1, chunk.size(), file) != chunk.size())
+        {
+          fclose(file);
+          throw Exceptions::Exception("Error writing PNG chunk %s", type);
+        }
+      }
+
+      void ImageRenderer::save_png(const char* filename, const unsigned char* rgb, int width, int height)
+      {
+        // scanlines with the filter type 0 (none)
+        size_t row_bytes = 3 * (size_t)width;
+        std::vector<unsigned char> raw((row_bytes + 1) * height);
+        for(int i = 0; i < height; i++)
+        {
+          raw[i * (row_bytes + 1)] = 0;
+          memcpy(&raw[i * (row_bytes + 1) + 1], rgb + i * row_bytes, row_bytes);
+        }
+
+        std::vector<unsigned char> idat;
+#ifdef WITH_ZLIB
+        uLongf compressed_bytes = compressBound(raw.size());
+        idat.resize(compressed_bytes);
+        if(compress2(&idat[0], &compressed_bytes, &raw[0], raw.size(), Z_DEFAULT_COMPRESSION) != Z_OK)
+          throw Exceptions::Exception("zlib compression of the image failed");
+        idat.resize(compressed_bytes);
+#else
+        // a zlib stream of stored (not compressed) deflate blocks
+        idat.push_back(0x78);
+        idat.push_back(0x01);
+        unsigned int adler_a = 1, adler_b = 0;
+        for(size_t pos = 0; pos < raw.size() || pos == 0; )
+        {
+          size_t block = std::min(raw.size() - pos, (size_t)65535);
+          idat.push_back(pos + block == raw.size() ? 1 : 0);
+          idat.push_back((unsigned char)block);
+          idat.push_back((unsigned char)(block >> 8));
+          idat.push_back((unsigned char)~block);
+          idat.push_back((unsigned char)(~block >> 8));
+          idat.insert(idat.end(), raw.begin() + pos, raw.begin() + pos + block);
+          for(size_t i = pos; i < pos + block; i++)
+          {
+            adler_a = (adler_a + raw[i]) % 65521;
+            adler_b = (adler_b + adler_a) % 65521;
+          }
+          pos += block;
+          if(block == 0)
+            break;
+        }
+        png_put_uint32(idat, (adler_b << 16) | adler_a);
+#endif
+
+        FILE* file = fopen(filename, "wb");
+        if(file == NULL)
+          throw Exceptions::Exception("Could not open '%s' for writing", filename);
+
+        const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+        if(fwrite(signature, 1, 8, file) != 8)
+        {
+          fclose(file);
+          throw Exceptions::Exception("Error writing PNG signature");
+        }
+
+        std::vector<unsigned char> ihdr;
+        png_put_uint32(ihdr, width);
+        png_put_uint32(ihdr, height);
+        ihdr.push_back(8); // bit depth
+        ihdr.push_back(2); // color type: RGB
+        ihdr.push_back(0); // compression method
+        ihdr.push_back(0); // filter method
+        ihdr.push_back(0); // no interlace
+        png_write_chunk(file, "IHDR", ihdr);
+        png_write_chunk(file, "IDAT", idat);
+        png_write_chunk(file, "IEND", std::vector<unsigned char>());
+
+        fclose(file);
+      }
+
+      void ImageRenderer::save_bmp(const char* filename, const unsigned char* rgb, int width, int height)
+      {
+        // rows bottom to top, BGR, each padded to 4 bytes
+        size_t row_bytes = (3 * (size_t)width + 3) & ~(size_t)3;
+        size_t image_bytes = row_bytes * height;
+        std::vector<unsigned char> data(54 + image_bytes, 0);
+
+        unsigned int header[13] = { (unsigned int)(54 + image_bytes), 0, 54, 40, (unsigned int)width, (unsigned int)height,
+          1 | (24 << 16), 0, (unsigned int)image_bytes, 2835, 2835, 0, 0 };
+        data[0] = 'B';
+        data[1] = 'M';
+        for(int i = 0; i < 13; i++)
+          for(int j = 0; j < 4; j++)
+            data[2 + 4 * i + j] = (unsigned char)(header[i] >> (8 * j));
+
+        for(int i = 0; i < height; i++)
+        {
+          const unsigned char* src = rgb + 3 * (size_t)(height - 1 - i) * width;
+          unsigned char* dst = &data[54 + i * row_bytes];
+          for(int j = 0; j < width; j++)
+          {
+            dst[3 * j] = src[3 * j + 2];
+            dst[3 * j + 1] = src[3 * j + 1];
+            dst[3 * j + 2] = src[3 * j];
+          }
+        }
+
+        FILE* file = fopen(filename, "wb");
+        if(file == NULL)
+          throw Exceptions::Exception("Could not open '%s' for writing", filename);
+        if(fwrite(&data[0], 1, data.size(), file) != data.size())
+        {
+          fclose(file);
+          throw Exceptions::Exception("Error writing bitmap data");
+        }
+        fclose(file);
+      }
+    }
+  }
+}
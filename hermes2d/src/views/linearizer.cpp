@@ -17,6 +17,7 @@
 #include "refmap.h"
 #include "traverse.h"
 #include "exact_solution.h"
+#include "forms.h"
 #include "api2d.h"
 
 namespace Hermes
@@ -103,7 +104,8 @@ namespace Hermes
       double3*  lin_tables_quad[2] = { lin_pts_0_quad, lin_pts_1_quad };
       double3** lin_tables[2]      = { lin_tables_tri, lin_tables_quad };
 
-      Linearizer::Linearizer(bool auto_max) : LinearizerBase(auto_max), dmult(1.0), component(0), value_type(0), curvature_epsilon(1e-3)
+      Linearizer::Linearizer(bool auto_max) : LinearizerBase(auto_max), dmult(1.0), component(0), value_type(0), curvature_epsilon(1e-3), max_level(LIN_MAX_LEVEL),
+        update_mesh(NULL), update_mesh_seq(0), update_item(0)
       {
         verts = NULL;
         xdisp = NULL;
@@ -113,12 +115,12 @@ namespace Hermes
         tris_contours = NULL;
       }
 
-      void Linearizer::process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+      void Linearizer::process_triangle(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
         double* val, double* phx, double* phy, int* idx, bool curved)
       {
         double midval[3][3];
 
-        if(level < LIN_MAX_LEVEL)
+        if(level < this->max_level)
         {
           int i;
           if(!(level & 1))
@@ -130,9 +132,8 @@ namespace Hermes
               for (i = 0; i < lin_np_tri[1]; i++)
               {
                 double v = val[i];
-#pragma omp critical(max)
-                if(finite(v) && fabs(v) > max)
-                  max = fabs(v);
+                if(finite(v) && fabs(v) > td->max)
+                  td->max = fabs(v);
               }
               idx = tri_indices[0];
 
@@ -168,9 +169,9 @@ namespace Hermes
           // obtain linearized values and coordinates at the midpoints
           for (i = 0; i < 3; i++)
           {
-            midval[i][0] = (verts[iv0][i] + verts[iv1][i])*0.5;
-            midval[i][1] = (verts[iv1][i] + verts[iv2][i])*0.5;
-            midval[i][2] = (verts[iv2][i] + verts[iv0][i])*0.5;
+            midval[i][0] = (td->verts[iv0][i] + td->verts[iv1][i])*0.5;
+            midval[i][1] = (td->verts[iv1][i] + td->verts[iv2][i])*0.5;
+            midval[i][2] = (td->verts[iv2][i] + td->verts[iv0][i])*0.5;
           };
 
           // determine whether or not to split the element
@@ -182,7 +183,7 @@ namespace Hermes
           }
           else
           {
-            if(!auto_max && fabs(verts[iv0][2]) > max && fabs(verts[iv1][2]) > max && fabs(verts[iv2][2]) > max)
+            if(!auto_max && fabs(td->verts[iv0][2]) > td->max && fabs(td->verts[iv1][2]) > td->max && fabs(td->verts[iv2][2]) > td->max)
             {
               // do not split if the whole triangle is above the specified maximum value
               split = false;
@@ -193,7 +194,7 @@ namespace Hermes
               double err = fabs(val[idx[0]] - midval[2][0]) +
                 fabs(val[idx[1]] - midval[2][1]) +
                 fabs(val[idx[2]] - midval[2][2]);
-              split = !finite(err) || err > max*3*eps;
+              split = !finite(err) || err > td->max*3*eps;
             }
 
             // do the same for the curvature
@@ -212,7 +213,7 @@ namespace Hermes
             {
               split = (fabs(val[8] - 0.5*(midval[2][0] + midval[2][1])) +
                 fabs(val[9] - 0.5*(midval[2][1] + midval[2][2])) +
-                fabs(val[4] - 0.5*(midval[2][2] + midval[2][0]))) > max*3*eps;
+                fabs(val[4] - 0.5*(midval[2][2] + midval[2][0]))) > td->max*3*eps;
             }
           }
 
@@ -227,35 +228,35 @@ namespace Hermes
               }
 
               // obtain mid-edge vertices
-              int mid0 = get_vertex(iv0, iv1, midval[0][0], midval[1][0], val[idx[0]]);
-              int mid1 = get_vertex(iv1, iv2, midval[0][1], midval[1][1], val[idx[1]]);
-              int mid2 = get_vertex(iv2, iv0, midval[0][2], midval[1][2], val[idx[2]]);
+              int mid0 = get_vertex(td, iv0, iv1, midval[0][0], midval[1][0], val[idx[0]]);
+              int mid1 = get_vertex(td, iv1, iv2, midval[0][1], midval[1][1], val[idx[1]]);
+              int mid2 = get_vertex(td, iv2, iv0, midval[0][2], midval[1][2], val[idx[2]]);
 
               if(this->caughtException != NULL)
                 return;
 
               // recur to sub-elements
               this->push_transforms(fns, 0);
-              process_triangle(fns, iv0, mid0, mid2,  level + 1, val, phx, phy, tri_indices[1], curved);
+              process_triangle(td, fns, iv0, mid0, mid2,  level + 1, val, phx, phy, tri_indices[1], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 1);
-              process_triangle(fns, mid0, iv1, mid1,  level + 1, val, phx, phy, tri_indices[2], curved);
+              process_triangle(td, fns, mid0, iv1, mid1,  level + 1, val, phx, phy, tri_indices[2], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 2);
-              process_triangle(fns, mid2, mid1, iv2,  level + 1, val, phx, phy, tri_indices[3], curved);
+              process_triangle(td, fns, mid2, mid1, iv2,  level + 1, val, phx, phy, tri_indices[3], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 3);
-              process_triangle(fns, mid1, mid2, mid0, level + 1, val, phx, phy, tri_indices[4], curved);
+              process_triangle(td, fns, mid1, mid2, mid0, level + 1, val, phx, phy, tri_indices[4], curved);
               this->pop_transforms(fns);
               return;
           }
         }
 
         // no splitting: output a linear triangle
-        add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+        add_triangle(td, iv0, iv1, iv2, fns[0]->get_active_element()->marker);
       }
 
       void Linearizer::set_curvature_epsilon(double curvature_epsilon)
@@ -304,18 +305,18 @@ namespace Hermes
         }
       }
 
-      void Linearizer::process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+      void Linearizer::process_quad(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
         double* val, double* phx, double* phy, int* idx, bool curved)
       {
         double midval[3][5];
 
         // try not to split through the vertex with the largest value
-        int a = (verts[iv0][2] > verts[iv1][2]) ? iv0 : iv1;
-        int b = (verts[iv2][2] > verts[iv3][2]) ? iv2 : iv3;
-        a = (verts[a][2] > verts[b][2]) ? a : b;
+        int a = (td->verts[iv0][2] > td->verts[iv1][2]) ? iv0 : iv1;
+        int b = (td->verts[iv2][2] > td->verts[iv3][2]) ? iv2 : iv3;
+        a = (td->verts[a][2] > td->verts[b][2]) ? a : b;
         int flip = (a == iv1 || a == iv3) ? 1 : 0;
 
-        if(level < LIN_MAX_LEVEL)
+        if(level < this->max_level)
         {
           int i;
           if(!(level & 1)) // this is an optimization: do the following only every other time
@@ -327,15 +328,13 @@ namespace Hermes
               for (i = 0; i < lin_np_quad[1]; i++)
               {
                 double v = val[i];
-                if(finite(v) && fabs(v) > max)
-#pragma omp critical(max)
-                  if(finite(v) && fabs(v) > max)
-                    max = fabs(v);
+                if(finite(v) && fabs(v) > td->max)
+                  td->max = fabs(v);
               }
 
               // This is just to make some sense.
-              if(fabs(max) < 1E-10)
-                max = 1E-10;
+              if(fabs(td->max) < 1E-10)
+                td->max = 1E-10;
 
               idx = quad_indices[0];
 
@@ -369,15 +368,15 @@ namespace Hermes
           // obtain linearized values and coordinates at the midpoints
           for (i = 0; i < 3; i++)
           {
-            midval[i][0] = (verts[iv0][i] + verts[iv1][i]) * 0.5;
-            midval[i][1] = (verts[iv1][i] + verts[iv2][i]) * 0.5;
-            midval[i][2] = (verts[iv2][i] + verts[iv3][i]) * 0.5;
-            midval[i][3] = (verts[iv3][i] + verts[iv0][i]) * 0.5;
+            midval[i][0] = (td->verts[iv0][i] + td->verts[iv1][i]) * 0.5;
+            midval[i][1] = (td->verts[iv1][i] + td->verts[iv2][i]) * 0.5;
+            midval[i][2] = (td->verts[iv2][i] + td->verts[iv3][i]) * 0.5;
+            midval[i][3] = (td->verts[iv3][i] + td->verts[iv0][i]) * 0.5;
             midval[i][4] = (midval[i][0]  + midval[i][2])  * 0.5;
           };
 
           // the value of the middle point is not the average of the four vertex values, since quad == 2 triangles
-          midval[2][4] = flip ? (verts[iv0][2] + verts[iv2][2]) * 0.5 : (verts[iv1][2] + verts[iv3][2]) * 0.5;
+          midval[2][4] = flip ? (td->verts[iv0][2] + td->verts[iv2][2]) * 0.5 : (td->verts[iv1][2] + td->verts[iv3][2]) * 0.5;
 
           // determine whether or not to split the element
           int split;
@@ -388,8 +387,8 @@ namespace Hermes
           }
           else
           {
-            if(!auto_max && fabs(verts[iv0][2]) > max && fabs(verts[iv1][2]) > max
-              && fabs(verts[iv2][2]) > max && fabs(verts[iv3][2]) > max)
+            if(!auto_max && fabs(td->verts[iv0][2]) > td->max && fabs(td->verts[iv1][2]) > td->max
+              && fabs(td->verts[iv2][2]) > td->max && fabs(td->verts[iv3][2]) > td->max)
             {
               // do not split if the whole quad is above the specified maximum value
               split = 0;
@@ -400,7 +399,7 @@ namespace Hermes
               double herr = fabs(val[idx[1]] - midval[2][1]) + fabs(val[idx[3]] - midval[2][3]);
               double verr = fabs(val[idx[0]] - midval[2][0]) + fabs(val[idx[2]] - midval[2][2]);
               double err  = fabs(val[idx[4]] - midval[2][4]) + herr + verr;
-              split = (!finite(err) || err > max*4*eps) ? 3 : 0;
+              split = (!finite(err) || err > td->max*4*eps) ? 3 : 0;
 
               // decide whether to split horizontally or vertically only
               if(level > 0 && split)
@@ -428,7 +427,7 @@ namespace Hermes
               split = ((fabs(val[13] - 0.5*(midval[2][0] + midval[2][1])) +
                 fabs(val[17] - 0.5*(midval[2][1] + midval[2][2])) +
                 fabs(val[20] - 0.5*(midval[2][2] + midval[2][3])) +
-                fabs(val[9]  - 0.5*(midval[2][3] + midval[2][0]))) > max*4*eps) ? 3 : 0;
+                fabs(val[9]  - 0.5*(midval[2][3] + midval[2][0]))) > td->max*4*eps) ? 3 : 0;
             }
           }
 
@@ -444,11 +443,11 @@ namespace Hermes
 
               // obtain mid-edge and mid-element vertices
               int mid0, mid1, mid2, mid3, mid4;
-              if(split != 1) mid0 = get_vertex(iv0,  iv1,  midval[0][0], midval[1][0], val[idx[0]]);
-              if(split != 2) mid1 = get_vertex(iv1,  iv2,  midval[0][1], midval[1][1], val[idx[1]]);
-              if(split != 1) mid2 = get_vertex(iv2,  iv3,  midval[0][2], midval[1][2], val[idx[2]]);
-              if(split != 2) mid3 = get_vertex(iv3,  iv0,  midval[0][3], midval[1][3], val[idx[3]]);
-              if(split == 3) mid4 = get_vertex(mid0, mid2, midval[0][4], midval[1][4], val[idx[4]]);
+              if(split != 1) mid0 = get_vertex(td, iv0,  iv1,  midval[0][0], midval[1][0], val[idx[0]]);
+              if(split != 2) mid1 = get_vertex(td, iv1,  iv2,  midval[0][1], midval[1][1], val[idx[1]]);
+              if(split != 1) mid2 = get_vertex(td, iv2,  iv3,  midval[0][2], midval[1][2], val[idx[2]]);
+              if(split != 2) mid3 = get_vertex(td, iv3,  iv0,  midval[0][3], midval[1][3], val[idx[3]]);
+              if(split == 3) mid4 = get_vertex(td, mid0, mid2, midval[0][4], midval[1][4], val[idx[4]]);
 
               if(this->caughtException != NULL)
                 return;
@@ -457,40 +456,40 @@ namespace Hermes
               if(split == 3)
               {
                 this->push_transforms(fns, 0);
-                process_quad(fns, iv0, mid0, mid4, mid3, level + 1, val, phx, phy, quad_indices[1], curved);
+                process_quad(td, fns, iv0, mid0, mid4, mid3, level + 1, val, phx, phy, quad_indices[1], curved);
                 this->pop_transforms(fns);
 
                 this->push_transforms(fns, 1);
-                process_quad(fns, mid0, iv1, mid1, mid4, level + 1, val, phx, phy, quad_indices[2], curved);
+                process_quad(td, fns, mid0, iv1, mid1, mid4, level + 1, val, phx, phy, quad_indices[2], curved);
                 this->pop_transforms(fns);
 
                 this->push_transforms(fns, 2);
-                process_quad(fns, mid4, mid1, iv2, mid2, level + 1, val, phx, phy, quad_indices[3], curved);
+                process_quad(td, fns, mid4, mid1, iv2, mid2, level + 1, val, phx, phy, quad_indices[3], curved);
                 this->pop_transforms(fns);
 
                 this->push_transforms(fns, 3);
-                process_quad(fns, mid3, mid4, mid2, iv3, level + 1, val, phx, phy, quad_indices[4], curved);
+                process_quad(td, fns, mid3, mid4, mid2, iv3, level + 1, val, phx, phy, quad_indices[4], curved);
                 this->pop_transforms(fns);
               }
               else
                 if(split == 1) // h-split
                 {
                   this->push_transforms(fns, 4);
-                  process_quad(fns, iv0, iv1, mid1, mid3, level + 1, val, phx, phy, quad_indices[5], curved);
+                  process_quad(td, fns, iv0, iv1, mid1, mid3, level + 1, val, phx, phy, quad_indices[5], curved);
                   this->pop_transforms(fns);
 
                   this->push_transforms(fns, 5);
-                  process_quad(fns, mid3, mid1, iv2, iv3, level + 1, val, phx, phy, quad_indices[6], curved);
+                  process_quad(td, fns, mid3, mid1, iv2, iv3, level + 1, val, phx, phy, quad_indices[6], curved);
                   this->pop_transforms(fns);
                 }
                 else // v-split
                 {
                   this->push_transforms(fns, 6);
-                  process_quad(fns, iv0, mid0, mid2, iv3, level + 1, val, phx, phy, quad_indices[7], curved);
+                  process_quad(td, fns, iv0, mid0, mid2, iv3, level + 1, val, phx, phy, quad_indices[7], curved);
                   this->pop_transforms(fns);
 
                   this->push_transforms(fns, 7);
-                  process_quad(fns, mid0, iv1, iv2, mid2, level + 1, val, phx, phy, quad_indices[8], curved);
+                  process_quad(td, fns, mid0, iv1, iv2, mid2, level + 1, val, phx, phy, quad_indices[8], curved);
                   this->pop_transforms(fns);
                 }
                 return;
@@ -500,13 +499,13 @@ namespace Hermes
         // output two linear triangles,
         if(!flip)
         {
-          add_triangle(iv3, iv0, iv1, fns[0]->get_active_element()->marker);
-          add_triangle(iv1, iv2, iv3, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv3, iv0, iv1, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv1, iv2, iv3, fns[0]->get_active_element()->marker);
         }
         else
         {
-          add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
-          add_triangle(iv2, iv3, iv0, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv2, iv3, iv0, fns[0]->get_active_element()->marker);
         }
       }
 
@@ -519,6 +518,52 @@ namespace Hermes
         this->dmult = dmult;
       }
 
+      void Linearizer::process_state(ThreadData* td, MeshFunction<double>** fns, Element* e)
+      {
+        fns[0]->set_quad_order(0, this->item);
+        double* val = fns[0]->get_values(component, value_type);
+        if(val == NULL)
+          throw Hermes::Exceptions::Exception("Item not defined in the solution in Linearizer::process_solution.");
+
+        if(xdisp != NULL)
+          fns[1]->set_quad_order(0, H2D_FN_VAL);
+        if(ydisp != NULL)
+          fns[xdisp == NULL ? 1 : 2]->set_quad_order(0, H2D_FN_VAL);
+
+        double *dx = NULL;
+        double *dy = NULL;
+        if(xdisp != NULL)
+          dx = fns[1]->get_fn_values();
+        if(ydisp != NULL)
+          dy = fns[xdisp == NULL ? 1 : 2]->get_fn_values();
+
+        int iv[H2D_MAX_NUMBER_VERTICES];
+        for (unsigned int i = 0; i < e->get_nvert(); i++)
+        {
+          double f = val[i];
+          double x_disp = fns[0]->get_refmap()->get_phys_x(0)[i];
+          double y_disp = fns[0]->get_refmap()->get_phys_y(0)[i];
+          if(this->xdisp != NULL)
+            x_disp += dmult * dx[i];
+          if(this->ydisp != NULL)
+            y_disp += dmult * dy[i];
+
+          iv[i] = this->get_vertex(td, -fns[0]->get_active_element()->vn[i]->id, -fns[0]->get_active_element()->vn[i]->id, x_disp, y_disp, f);
+
+          if(this->caughtException != NULL)
+            return;
+        }
+
+        // recur to sub-elements
+        if(e->is_triangle())
+          process_triangle(td, fns, iv[0], iv[1], iv[2], 0, NULL, NULL, NULL, NULL, e->is_curved());
+        else
+          process_quad(td, fns, iv[0], iv[1], iv[2], iv[3], 0, NULL, NULL, NULL, NULL, e->is_curved());
+
+        for (unsigned int i = 0; i < e->get_nvert(); i++)
+          process_edge(td, iv[i], iv[e->next_vert(i)], e->en[i]->marker);
+      }
+
       void Linearizer::process_solution(MeshFunction<double>* sln, int item_, double eps)
       {
         // Important, sets the current caughtException to NULL.
@@ -528,8 +573,11 @@ namespace Hermes
         this->tick();
 
         // Initialization of 'global' stuff.
+        this->update_mesh = NULL;
         this->item = item_;
         this->eps = eps;
+        this->component = 0;
+        this->value_type = 0;
         //   get the component and desired value from item.
         if(item >= 0x40)
         {
@@ -553,17 +601,15 @@ namespace Hermes
         this->vertex_count = 0;
         this->triangle_count = 0;
         this->edges_count = 0;
-        //    reuse or allocate vertex, triangle and edge arrays.
-        this->verts = (double3*) realloc(this->verts, sizeof(double3) * this->vertex_size);
-        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
-        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
-        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
-        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
-        this->info = (int4*) malloc(sizeof(int4) * this->vertex_size);
         this->empty = false;
-        //    initialize the hash table
-        this->hash_table = (int*) malloc(sizeof(int) * this->vertex_size);
-        memset(this->hash_table, 0xff, sizeof(int) * this->vertex_size);
+        //    the vertices, triangles and edges of the threads, merged into the arrays of this instance in the end.
+        int num_threads_used = Hermes2DApi.get_num_threads();
+        ThreadData* thread_data = new ThreadData[num_threads_used];
+        for(int i = 0; i < num_threads_used; i++)
+        {
+          thread_data[i].init(this->vertex_size / num_threads_used, this->triangle_size / num_threads_used, this->edges_size / num_threads_used);
+          thread_data[i].max = this->max;
+        }
 
         // select the linearization quadratures
         Quad2D *old_quad, *old_quad_x = NULL, *old_quad_y = NULL;
@@ -583,8 +629,8 @@ namespace Hermes
           meshes.push_back(ydisp->get_mesh());
 
         // Parallelization
-        MeshFunction<double>*** fns = new MeshFunction<double>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        MeshFunction<double>*** fns = new MeshFunction<double>**[Hermes2DApi.get_num_threads()];
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           fns[i] = new MeshFunction<double>*[3];
           fns[i][0] = sln->clone();
@@ -602,8 +648,8 @@ namespace Hermes
           }
         }
 
-        Transformable*** trfs = new Transformable**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        Transformable*** trfs = new Transformable**[Hermes2DApi.get_num_threads()];
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trfs[i] = new Transformable*[3];
           trfs[i][0] = fns[i][0];
@@ -618,9 +664,9 @@ namespace Hermes
 
         trav_masterMax.begin(meshes.size(), &(meshes.front()));
 
-        Traverse* trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+        Traverse* trav = new Traverse[Hermes2DApi.get_num_threads()];
 
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].begin(meshes.size(), &(meshes.front()), trfs[i]);
           trav[i].stack = trav_masterMax.stack;
@@ -629,7 +675,6 @@ namespace Hermes
         int state_i;
 
 #define CHUNKSIZE 1
-        int num_threads_used = Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads);
 #pragma omp parallel shared(trav_masterMax) private(state_i) num_threads(num_threads_used)
         {
 #pragma omp for schedule(static, CHUNKSIZE)
@@ -644,12 +689,13 @@ namespace Hermes
               fns[omp_get_thread_num()][0]->set_quad_order(0, this->item);
               double* val = fns[omp_get_thread_num()][0]->get_values(component, value_type);
 
+              // the maxima of the threads, reduced below
+              double& thread_max = thread_data[omp_get_thread_num()].max;
               for (unsigned int i = 0; i < current_state.e[0]->get_nvert(); i++)
               {
                 double f = val[i];
-#pragma omp critical (max)
-                if(this->auto_max && finite(f) && fabs(f) > this->max)
-                  this->max = fabs(f);
+                if(this->auto_max && finite(f) && fabs(f) > thread_max)
+                  thread_max = fabs(f);
               }
             }
             catch(Hermes::Exceptions::Exception& e)
@@ -666,18 +712,24 @@ namespace Hermes
         }
 
         trav_masterMax.finish();
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
           trav[i].finish();
         delete [] trav;
 
+        // the maximum over the threads, the start of the maxima the threads refine by
+        for(int i = 0; i < num_threads_used; i++)
+          this->max = std::max(this->max, thread_data[i].max);
+        for(int i = 0; i < num_threads_used; i++)
+          thread_data[i].max = this->max;
+
         Traverse trav_master(true);
         num_states = trav_master.get_num_states(meshes);
 
         trav_master.begin(meshes.size(), &(meshes.front()));
 
-        trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+        trav = new Traverse[Hermes2DApi.get_num_threads()];
 
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].begin(meshes.size(), &(meshes.front()), trfs[i]);
           trav[i].stack = trav_master.stack;
@@ -698,51 +750,7 @@ namespace Hermes
 #pragma omp critical (get_next_state)
               current_state = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
 
-              fns[omp_get_thread_num()][0]->set_quad_order(0, this->item);
-              double* val = fns[omp_get_thread_num()][0]->get_values(component, value_type);
-              if(val == NULL)
-              {
-                delete [] trav;
-                throw Hermes::Exceptions::Exception("Item not defined in the solution in Linearizer::process_solution.");
-              }
-
-              if(xdisp != NULL)
-                fns[omp_get_thread_num()][1]->set_quad_order(0, H2D_FN_VAL);
-              if(ydisp != NULL)
-                fns[omp_get_thread_num()][xdisp == NULL ? 1 : 2]->set_quad_order(0, H2D_FN_VAL);
-
-              double *dx = NULL;
-              double *dy = NULL;
-              if(xdisp != NULL)
-                dx = fns[omp_get_thread_num()][1]->get_fn_values();
-              if(ydisp != NULL)
-                dy = fns[omp_get_thread_num()][xdisp == NULL ? 1 : 2]->get_fn_values();
-
-              int iv[H2D_MAX_NUMBER_VERTICES];
-              for (unsigned int i = 0; i < current_state.e[0]->get_nvert(); i++)
-              {
-                double f = val[i];
-                double x_disp = fns[omp_get_thread_num()][0]->get_refmap()->get_phys_x(0)[i];
-                double y_disp = fns[omp_get_thread_num()][0]->get_refmap()->get_phys_y(0)[i];
-                if(this->xdisp != NULL)
-                  x_disp += dmult * dx[i];
-                if(this->ydisp != NULL)
-                  y_disp += dmult * dy[i];
-
-                iv[i] = this->get_vertex(-fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, -fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, x_disp, y_disp, f);
-
-                if(this->caughtException != NULL)
-                  continue;
-              }
-
-              // recur to sub-elements
-              if(current_state.e[0]->is_triangle())
-                process_triangle(fns[omp_get_thread_num()], iv[0], iv[1], iv[2], 0, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
-              else
-                process_quad(fns[omp_get_thread_num()], iv[0], iv[1], iv[2], iv[3], 0, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
-
-              for (unsigned int i = 0; i < current_state.e[0]->get_nvert(); i++)
-                process_edge(iv[i], iv[current_state.e[0]->next_vert(i)], current_state.e[0]->en[i]->marker);
+              process_state(&thread_data[omp_get_thread_num()], fns[omp_get_thread_num()], current_state.e[0]);
             }
             catch(Hermes::Exceptions::Exception& e)
             {
@@ -758,7 +766,7 @@ namespace Hermes
         }
 
         trav_master.finish();
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].finish();
           for(unsigned int j = 0; j < (1 + (xdisp != NULL? 1 : 0) + (ydisp != NULL ? 1 : 0)); j++)
@@ -770,19 +778,227 @@ namespace Hermes
         delete [] trfs;
         delete [] trav;
 
+        if(this->caughtException != NULL)
+        {
+          delete [] thread_data;
+          this->unlock_data();
+          throw *(this->caughtException);
+        }
+
+        // one set of vertices (and the hash table of them), triangles and edges
+        merge_thread_data(thread_data, num_threads_used);
+        delete [] thread_data;
+
         // for contours, without regularization.
         this->tris_contours = (int3*) realloc(this->tris_contours, sizeof(int3) * this->triangle_count);
         memcpy(this->tris_contours, this->tris, this->triangle_count * sizeof(int3));
         triangle_contours_count = this->triangle_count;
 
-        if(this->caughtException != NULL)
+        regularize();
+
+        find_min_max();
+
+        // the hash table and info stay for update_solution(), which only evaluates the values (not the second derivatives)
+        if(this->xdisp == NULL && this->ydisp == NULL && this->value_type <= 2)
+        {
+          this->update_mesh = sln->get_mesh();
+          this->update_mesh_seq = sln->get_mesh()->get_seq();
+          this->update_item = item_;
+        }
+
+        this->unlock_data();
+
+        // select old quadratrues
+        sln->set_quad_2d(old_quad);
+        if(user_xdisp)
+          xdisp->set_quad_2d(old_quad_x);
+        else
+          delete xdisp;
+        if(user_ydisp)
+          ydisp->set_quad_2d(old_quad_y);
+        else
+          delete ydisp;
+      }
+
+      int Linearizer::add_vertex(int p1, int p2, double x, double y, double value)
+      {
+        if(p1 > p2) std::swap(p1, p2);
+        if(this->vertex_count >= this->vertex_size)
+        {
+          this->vertex_size *= 2;
+          double3* new_verts = (double3*) realloc(this->verts, sizeof(double3) * this->vertex_size);
+          int4* new_info = (int4*) realloc(this->info, sizeof(int4) * this->vertex_size);
+          int* new_hash_table = (int*) realloc(this->hash_table, sizeof(int) * this->vertex_size);
+          if(new_verts != NULL) this->verts = new_verts;
+          if(new_info != NULL) this->info = new_info;
+          if(new_hash_table != NULL) this->hash_table = new_hash_table;
+          if(new_verts == NULL || new_info == NULL || new_hash_table == NULL)
+            throw Hermes::Exceptions::Exception("Out of memory in Linearizer::update_solution.");
+
+          // the hash depends on the size, rehash the vertices
+          memset(this->hash_table, 0xff, sizeof(int) * this->vertex_size);
+          for (int i = 0; i < this->vertex_count; i++)
+          {
+            int index = this->hash(this->info[i][0], this->info[i][1]);
+            this->info[i][2] = this->hash_table[index];
+            this->hash_table[index] = i;
+          }
+        }
+
+        int i = this->vertex_count++;
+        this->verts[i][0] = x;
+        this->verts[i][1] = y;
+        this->verts[i][2] = value;
+        int index = this->hash(p1, p2);
+        this->info[i][0] = p1;
+        this->info[i][1] = p2;
+        this->info[i][2] = this->hash_table[index];
+        this->hash_table[index] = i;
+        return i;
+      }
+
+      // The values of the item (component, value_type) among the values get_pt_values() returns.
+      static double* pt_values_of_item(Func<double>* values, int num_components, int component, int value_type)
+      {
+        if(num_components == 1)
+          return value_type == 0 ? values->val : (value_type == 1 ? values->dx : values->dy);
+        if(component == 0)
+          return value_type == 0 ? values->val0 : (value_type == 1 ? values->dx0 : values->dy0);
+        return value_type == 0 ? values->val1 : (value_type == 1 ? values->dx1 : values->dy1);
+      }
+
+      void Linearizer::update_solution(MeshFunction<double>* sln, int item, double eps)
+      {
+        lock_data();
+        if(this->empty || this->update_mesh == NULL || this->update_mesh != sln->get_mesh() || this->update_mesh_seq != sln->get_mesh()->get_seq()
+          || this->update_item != item || this->xdisp != NULL || this->ydisp != NULL)
         {
+          try
+          {
+            process_solution(sln, item, eps);
+          }
+          catch(...)
+          {
+            this->unlock_data();
+            throw;
+          }
           this->unlock_data();
-          ::free(hash_table);
-          ::free(info);
-          throw *(this->caughtException);
+          return;
+        }
+
+        this->eps = eps;
+        int num_components = sln->get_num_components();
+
+        // the new values in the vertices, at once
+        std::vector<double> x(this->vertex_count + 1), y(this->vertex_count + 1);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          x[i] = this->verts[i][0];
+          y[i] = this->verts[i][1];
+        }
+        bool* found = new bool[this->vertex_count + 1];
+        Func<double>* values = sln->get_pt_values(this->vertex_count, &x[0], &y[0], found);
+        double* vertex_values = pt_values_of_item(values, num_components, component, value_type);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          if(!found[i])
+            continue;
+          this->verts[i][2] = vertex_values[i];
+          if(this->auto_max && finite(vertex_values[i]) && fabs(vertex_values[i]) > this->max)
+            this->max = fabs(vertex_values[i]);
+        }
+        values->free_fn();
+        delete values;
+        delete [] found;
+
+        // the edges of the triangles (vertex index pairs, the lower one first) and the new values in their midpoints
+        std::vector<uint64_t> tri_edges(3 * this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+          for (int j = 0; j < 3; j++)
+          {
+            uint64_t a = this->tris[i][j], b = this->tris[i][(j + 1) % 3];
+            tri_edges[3 * i + j] = (a < b) ? ((a << 32) | b) : ((b << 32) | a);
+          }
+        std::sort(tri_edges.begin(), tri_edges.end());
+        tri_edges.erase(std::unique(tri_edges.begin(), tri_edges.end()), tri_edges.end());
+        int num_tri_edges = (int) tri_edges.size();
+
+        double min_length2 = 1e100;
+        x.resize(num_tri_edges + 1);
+        y.resize(num_tri_edges + 1);
+        for (int i = 0; i < num_tri_edges; i++)
+        {
+          int a = (int) (tri_edges[i] >> 32), b = (int) (tri_edges[i] & 0xffffffff);
+          x[i] = (this->verts[a][0] + this->verts[b][0]) * 0.5;
+          y[i] = (this->verts[a][1] + this->verts[b][1]) * 0.5;
+          min_length2 = std::min(min_length2, sqr(this->verts[a][0] - this->verts[b][0]) + sqr(this->verts[a][1] - this->verts[b][1]));
+        }
+        found = new bool[num_tri_edges + 1];
+        values = sln->get_pt_values(num_tri_edges, &x[0], &y[0], found);
+        double* mid_values = pt_values_of_item(values, num_components, component, value_type);
+
+        // split the triangles with a too large error of the linear interpolation (as process_triangle() decides), but not
+        // below twice the size of the finest triangles so far, i.e. not much beyond the maximum level
+        std::vector<int> mid_vertex(num_tri_edges, -1);
+        bool any_split = false;
+        for (int i = 0; i < this->triangle_count; i++)
+        {
+          int e[3];
+          double err = 0.0, max_length2 = 0.0;
+          bool all_found = true;
+          for (int j = 0; j < 3; j++)
+          {
+            uint64_t a = this->tris[i][j], b = this->tris[i][(j + 1) % 3];
+            e[j] = (int) (std::lower_bound(tri_edges.begin(), tri_edges.end(), (a < b) ? ((a << 32) | b) : ((b << 32) | a)) - tri_edges.begin());
+            all_found = all_found && found[e[j]];
+            err += fabs(mid_values[e[j]] - (this->verts[a][2] + this->verts[b][2]) * 0.5);
+            max_length2 = std::max(max_length2, sqr(this->verts[a][0] - this->verts[b][0]) + sqr(this->verts[a][1] - this->verts[b][1]));
+          }
+          if(!all_found || !finite(err) || err <= this->max * 3 * eps || max_length2 <= 4 * min_length2)
+            continue;
+
+          for (int j = 0; j < 3; j++)
+            if(mid_vertex[e[j]] < 0)
+              mid_vertex[e[j]] = add_vertex(this->tris[i][j], this->tris[i][(j + 1) % 3], x[e[j]], y[e[j]], mid_values[e[j]]);
+          any_split = true;
+        }
+        values->free_fn();
+        delete values;
+        delete [] found;
+
+        if(any_split)
+        {
+          // the split triangles and their neighbors with the new hanging vertices are regularized, the edges subdivided
+          int old_triangle_count = this->triangle_count;
+          std::vector<int> old_tris(&this->tris[0][0], &this->tris[0][0] + 3 * old_triangle_count);
+          std::vector<int> old_tri_markers(this->tri_markers, this->tri_markers + old_triangle_count);
+          this->triangle_count = 0;
+          this->del_slot = -1;
+          for (int i = 0; i < old_triangle_count; i++)
+          {
+            int iv0 = old_tris[3 * i], iv1 = old_tris[3 * i + 1], iv2 = old_tris[3 * i + 2];
+            regularize_triangle(iv0, iv1, iv2, peek_vertex(iv0, iv1), peek_vertex(iv1, iv2), peek_vertex(iv2, iv0), old_tri_markers[i]);
+          }
+
+          int old_edges_count = this->edges_count;
+          std::vector<int> old_edges(&this->edges[0][0], &this->edges[0][0] + 2 * old_edges_count);
+          std::vector<int> old_edge_markers(this->edge_markers, this->edge_markers + old_edges_count);
+          this->edges_count = 0;
+          for (int i = 0; i < old_edges_count; i++)
+            process_edge(old_edges[2 * i], old_edges[2 * i + 1], old_edge_markers[i]);
+
+          this->tris_contours = (int3*) realloc(this->tris_contours, sizeof(int3) * this->triangle_count);
+          memcpy(this->tris_contours, this->tris, this->triangle_count * sizeof(int3));
+          this->triangle_contours_count = this->triangle_count;
         }
 
+        find_min_max();
+
+        this->unlock_data();
+      }
+
+      void Linearizer::regularize()
+      {
         // regularize the linear mesh
         for (int i = 0; i < this->triangle_count; i++)
         {
@@ -797,25 +1013,18 @@ namespace Hermes
             regularize_triangle(iv0, iv1, iv2, mid0, mid1, mid2, tri_markers[i]);
           }
         }
+      }
 
-        find_min_max();
-
-        this->unlock_data();
-
-        // select old quadratrues
-        sln->set_quad_2d(old_quad);
-        if(user_xdisp)
-          xdisp->set_quad_2d(old_quad_x);
-        else
-          delete xdisp;
-        if(user_ydisp)
-          ydisp->set_quad_2d(old_quad_y);
-        else
-          delete ydisp;
+      void Linearizer::set_max_level(int max_level)
+      {
+        if(max_level < 0)
+          throw Exceptions::ValueException("max_level", max_level, 0);
+        this->max_level = max_level;
+      }
 
-        // clean up
-        ::free(hash_table);
-        ::free(info);
+      int Linearizer::get_max_level() const
+      {
+        return this->max_level;
       }
 
       void Linearizer::find_min_max()
@@ -830,67 +1039,301 @@ namespace Hermes
         }
       }
 
-      int Linearizer::get_vertex(int p1, int p2, double x, double y, double value)
+      Linearizer::ThreadData::ThreadData() : verts(NULL), info(NULL), hash_table(NULL), keys(NULL), vertex_count(0), vertex_size(0),
+        tris(NULL), tri_markers(NULL), triangle_count(0), triangle_size(0), edges(NULL), edge_markers(NULL), edges_count(0), edges_size(0), max(-1e100)
+      {
+      }
+
+      Linearizer::ThreadData::~ThreadData()
+      {
+        ::free(verts);
+        ::free(info);
+        ::free(hash_table);
+        ::free(keys);
+        ::free(tris);
+        ::free(tri_markers);
+        ::free(edges);
+        ::free(edge_markers);
+      }
+
+      void Linearizer::ThreadData::init(int vertex_size, int triangle_size, int edges_size)
+      {
+        // a power of two, for the hash
+        this->vertex_size = 1024;
+        while(this->vertex_size < vertex_size)
+          this->vertex_size *= 2;
+        this->triangle_size = std::max(triangle_size, 1024);
+        this->edges_size = std::max(edges_size, 1024);
+
+        verts = (double3*) malloc(sizeof(double3) * this->vertex_size);
+        info = (int4*) malloc(sizeof(int4) * this->vertex_size);
+        keys = (uint64_t*) malloc(sizeof(uint64_t) * this->vertex_size);
+        hash_table = (int*) malloc(sizeof(int) * this->vertex_size);
+        memset(hash_table, 0xff, sizeof(int) * this->vertex_size);
+        tris = (int3*) malloc(sizeof(int3) * this->triangle_size);
+        tri_markers = (int*) malloc(sizeof(int) * this->triangle_size);
+        edges = (int2*) malloc(sizeof(int2) * this->edges_size);
+        edge_markers = (int*) malloc(sizeof(int) * this->edges_size);
+      }
+
+      int Linearizer::get_vertex(ThreadData* td, int p1, int p2, double x, double y, double value)
       {
-        // search for an existing vertex
+        // search for an existing vertex of the thread
         if(p1 > p2) std::swap(p1, p2);
-        int index = this->hash(p1, p2);
-        int i = 0;
-        if(index < this->vertex_count)
+        int index = vertex_hash(p1, p2, td->vertex_size);
+        int i = td->hash_table[index];
+        while (i >= 0)
         {
-          i = this->hash_table[index];
-          while (i >= 0 && i < this->vertex_count)
-          {
-            if(
-              this->info[i][0] == p1 && this->info[i][1] == p2 &&
-              (value == verts[i][2] || fabs(value - verts[i][2]) < this->max*1e-8) &&
-              (fabs(x - verts[i][0]) < 1e-8) &&
-              (fabs(y - verts[i][1]) < 1e-8)
-              )
-              return i;
-            // note that we won't return a vertex with a different value than the required one;
-            // this takes care for discontinuities in the solution, where more vertices
-            // with different values will be created
-            i = info[i][2];
-          }
+          if(
+            td->info[i][0] == p1 && td->info[i][1] == p2 &&
+            (value == td->verts[i][2] || fabs(value - td->verts[i][2]) < td->max*1e-8) &&
+            (fabs(x - td->verts[i][0]) < 1e-8) &&
+            (fabs(y - td->verts[i][1]) < 1e-8)
+            )
+            return i;
+          // note that we won't return a vertex with a different value than the required one;
+          // this takes care for discontinuities in the solution, where more vertices
+          // with different values will be created
+          i = td->info[i][2];
         }
 
         // if not found, create a new one
-#pragma omp critical(realloc_vertices)
         try
         {
-          i = add_vertex();
+          i = add_vertex(td);
         }
         catch(std::exception& e)
         {
+#pragma omp critical(linearizer_exception)
           if(this->caughtException == NULL)
             this->caughtException = new Hermes::Exceptions::Exception(e.what());
         }
-        if(this->caughtException != NULL)
-        {
+        if(i < 0)
           return -1;
-        }
-        verts[i][0] = x;
-        verts[i][1] = y;
-        verts[i][2] = value;
-        this->info[i][0] = p1;
-        this->info[i][1] = p2;
-        this->info[i][2] = hash_table[index];
-        this->hash_table[index] = i;
+
+        // the size may have changed
+        index = vertex_hash(p1, p2, td->vertex_size);
+        td->verts[i][0] = x;
+        td->verts[i][1] = y;
+        td->verts[i][2] = value;
+        td->keys[i] = vertex_key(td->keys, p1, p2);
+        td->info[i][0] = p1;
+        td->info[i][1] = p2;
+        td->info[i][2] = td->hash_table[index];
+        td->hash_table[index] = i;
         return i;
       }
 
-      int Linearizer::add_vertex()
+      int Linearizer::add_vertex(ThreadData* td)
       {
-        if(this->vertex_count >= this->vertex_size)
+        if(td->vertex_count >= td->vertex_size)
+        {
+          td->vertex_size *= 2;
+          double3* new_verts = (double3*) realloc(td->verts, sizeof(double3) * td->vertex_size);
+          int4* new_info = (int4*) realloc(td->info, sizeof(int4) * td->vertex_size);
+          uint64_t* new_keys = (uint64_t*) realloc(td->keys, sizeof(uint64_t) * td->vertex_size);
+          int* new_hash_table = (int*) realloc(td->hash_table, sizeof(int) * td->vertex_size);
+          if(new_verts != NULL) td->verts = new_verts;
+          if(new_info != NULL) td->info = new_info;
+          if(new_keys != NULL) td->keys = new_keys;
+          if(new_hash_table != NULL) td->hash_table = new_hash_table;
+          if(new_verts == NULL || new_info == NULL || new_keys == NULL || new_hash_table == NULL)
+            throw Hermes::Exceptions::Exception("Out of memory in Linearizer::process_solution.");
+
+          // the hash depends on the size, rehash the vertices
+          memset(td->hash_table, 0xff, sizeof(int) * td->vertex_size);
+          for (int i = 0; i < td->vertex_count; i++)
+          {
+            int index = vertex_hash(td->info[i][0], td->info[i][1], td->vertex_size);
+            td->info[i][2] = td->hash_table[index];
+            td->hash_table[index] = i;
+          }
+        }
+        return td->vertex_count++;
+      }
+
+      int Linearizer::peek_vertex(ThreadData* td, int p1, int p2)
+      {
+        // search for a vertex of the thread with parents p1, p2
+        if(p1 > p2) std::swap(p1, p2);
+        int i = td->hash_table[vertex_hash(p1, p2, td->vertex_size)];
+        while (i >= 0)
+        {
+          if(td->info[i][0] == p1 && td->info[i][1] == p2) return i;
+          i = td->info[i][2];
+        }
+        return -1;
+      }
+
+      void Linearizer::process_edge(ThreadData* td, int iv1, int iv2, int marker)
+      {
+        int mid = peek_vertex(td, iv1, iv2);
+        if(mid != -1)
+        {
+          process_edge(td, iv1, mid, marker);
+          process_edge(td, mid, iv2, marker);
+        }
+        else
+          add_edge(td, iv1, iv2, marker);
+      }
+
+      void Linearizer::add_edge(ThreadData* td, int iv1, int iv2, int marker)
+      {
+        if(td->edges_count >= td->edges_size)
+        {
+          td->edges_size *= 2;
+          td->edges = (int2*) realloc(td->edges, sizeof(int2) * td->edges_size);
+          td->edge_markers = (int*) realloc(td->edge_markers, sizeof(int) * td->edges_size);
+        }
+        td->edges[td->edges_count][0] = iv1;
+        td->edges[td->edges_count][1] = iv2;
+        td->edge_markers[td->edges_count++] = marker;
+      }
+
+      void Linearizer::add_triangle(ThreadData* td, int iv0, int iv1, int iv2, int marker)
+      {
+        if(td->triangle_count >= td->triangle_size)
+        {
+          td->triangle_size *= 2;
+          td->tris = (int3*) realloc(td->tris, sizeof(int3) * td->triangle_size);
+          td->tri_markers = (int*) realloc(td->tri_markers, sizeof(int) * td->triangle_size);
+        }
+        td->tris[td->triangle_count][0] = iv0;
+        td->tris[td->triangle_count][1] = iv1;
+        td->tris[td->triangle_count][2] = iv2;
+        td->tri_markers[td->triangle_count++] = marker;
+      }
+
+      void Linearizer::merge_thread_data(ThreadData* thread_data, int num_threads)
+      {
+        // the offsets of the threads in the concatenation of their vertices, triangles and edges
+        std::vector<int> vertex_offsets(num_threads + 1, 0), triangle_offsets(num_threads + 1, 0), edge_offsets(num_threads + 1, 0);
+        for (int t = 0; t < num_threads; t++)
+        {
+          vertex_offsets[t + 1] = vertex_offsets[t] + thread_data[t].vertex_count;
+          triangle_offsets[t + 1] = triangle_offsets[t] + thread_data[t].triangle_count;
+          edge_offsets[t + 1] = edge_offsets[t] + thread_data[t].edges_count;
+          this->max = std::max(this->max, thread_data[t].max);
+        }
+        int num_vertices = vertex_offsets[num_threads];
+
+        // the concatenated vertices, and the thread of each
+        std::vector<uint64_t> keys(num_vertices);
+        std::vector<int> vertex_thread(num_vertices);
+        for (int t = 0; t < num_threads; t++)
+          for (int i = 0; i < thread_data[t].vertex_count; i++)
+          {
+            keys[vertex_offsets[t] + i] = thread_data[t].keys[i];
+            vertex_thread[vertex_offsets[t] + i] = t;
+          }
+
+        // The duplicates (the same key, coordinates and value, from more threads) are found in buckets of the keys,
+        // in parallel. The first of the duplicates (in the concatenation) represents them all.
+        int num_buckets = std::max(1, num_vertices / 4);
+        std::vector<int> bucket_starts(num_buckets + 1, 0);
+        std::vector<int> bucket_vertices(num_vertices);
+        for (int g = 0; g < num_vertices; g++)
+          bucket_starts[(int) (keys[g] % num_buckets) + 1]++;
+        for (int b = 0; b < num_buckets; b++)
+          bucket_starts[b + 1] += bucket_starts[b];
+        {
+          std::vector<int> bucket_fill(bucket_starts.begin(), bucket_starts.end() - 1);
+          for (int g = 0; g < num_vertices; g++)
+            bucket_vertices[bucket_fill[(int) (keys[g] % num_buckets)]++] = g;
+        }
+
+        std::vector<int> representative(num_vertices);
+        int bucket_i;
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(num_threads)
+        for (bucket_i = 0; bucket_i < num_buckets; bucket_i++)
         {
+          for (int j = bucket_starts[bucket_i]; j < bucket_starts[bucket_i + 1]; j++)
+          {
+            int g = bucket_vertices[j];
+            double* vertex = thread_data[vertex_thread[g]].verts[g - vertex_offsets[vertex_thread[g]]];
+            representative[g] = g;
+            for (int k = bucket_starts[bucket_i]; k < j; k++)
+            {
+              int h = bucket_vertices[k];
+              if(representative[h] != h || keys[h] != keys[g])
+                continue;
+              double* other = thread_data[vertex_thread[h]].verts[h - vertex_offsets[vertex_thread[h]]];
+              if((fabs(vertex[0] - other[0]) < 1e-8) && (fabs(vertex[1] - other[1]) < 1e-8) &&
+                (vertex[2] == other[2] || fabs(vertex[2] - other[2]) < this->max*1e-8))
+              {
+                representative[g] = h;
+                break;
+              }
+            }
+          }
+        }
+
+        // the indices of the vertices of this instance
+        std::vector<int> new_index(num_vertices);
+        this->vertex_count = 0;
+        for (int g = 0; g < num_vertices; g++)
+          new_index[g] = (representative[g] == g) ? this->vertex_count++ : new_index[representative[g]];
+
+        // the vertices and their hash table, for the regularization and the edges
+        this->vertex_size = 1024;
+        while(this->vertex_size < this->vertex_count)
           this->vertex_size *= 2;
-          verts = (double3*) realloc(verts, sizeof(double3) * vertex_size);
-          this->info = (int4*) realloc(info, sizeof(int4) * vertex_size);
-          this->hash_table = (int*) realloc(hash_table, sizeof(int) * vertex_size);
-          memset(this->hash_table + this->vertex_size / 2, 0xff, sizeof(int) * this->vertex_size / 2);
+        this->verts = (double3*) realloc(this->verts, sizeof(double3) * this->vertex_size);
+        this->info = (int4*) realloc(this->info, sizeof(int4) * this->vertex_size);
+        this->hash_table = (int*) realloc(this->hash_table, sizeof(int) * this->vertex_size);
+        memset(this->hash_table, 0xff, sizeof(int) * this->vertex_size);
+        for (int g = 0; g < num_vertices; g++)
+        {
+          if(representative[g] != g)
+            continue;
+          int t = vertex_thread[g];
+          int local = g - vertex_offsets[t];
+          int i = new_index[g];
+          memcpy(this->verts[i], thread_data[t].verts[local], sizeof(double3));
+
+          // the parents in this instance (the negative ids of the mesh vertices stay)
+          int p1 = thread_data[t].info[local][0], p2 = thread_data[t].info[local][1];
+          if(p1 != p2)
+          {
+            p1 = new_index[vertex_offsets[t] + p1];
+            p2 = new_index[vertex_offsets[t] + p2];
+            if(p1 > p2) std::swap(p1, p2);
+          }
+          int index = this->hash(p1, p2);
+          this->info[i][0] = p1;
+          this->info[i][1] = p2;
+          this->info[i][2] = this->hash_table[index];
+          this->hash_table[index] = i;
+        }
+
+        // the triangles and edges
+        this->triangle_count = triangle_offsets[num_threads];
+        this->edges_count = edge_offsets[num_threads];
+        this->triangle_size = std::max(this->triangle_size, this->triangle_count);
+        this->edges_size = std::max(this->edges_size, this->edges_count);
+        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
+        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
+        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
+        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
+
+        int t;
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+        for (t = 0; t < num_threads; t++)
+        {
+          const int* thread_index = new_index.empty() ? NULL : &new_index[0] + vertex_offsets[t];
+          for (int i = 0; i < thread_data[t].triangle_count; i++)
+          {
+            for (int j = 0; j < 3; j++)
+              this->tris[triangle_offsets[t] + i][j] = thread_index[thread_data[t].tris[i][j]];
+            this->tri_markers[triangle_offsets[t] + i] = thread_data[t].tri_markers[i];
+          }
+          for (int i = 0; i < thread_data[t].edges_count; i++)
+          {
+            for (int j = 0; j < 2; j++)
+              this->edges[edge_offsets[t] + i][j] = thread_index[thread_data[t].edges[i][j]];
+            this->edge_markers[edge_offsets[t] + i] = thread_data[t].edge_markers[i];
+          }
         }
-        return this->vertex_count++;
       }
 
       void Linearizer::free()
@@ -905,6 +1348,11 @@ namespace Hermes
           ::free(tris_contours);
           tris_contours = NULL;
         }
+        ::free(hash_table);
+        hash_table = NULL;
+        ::free(info);
+        info = NULL;
+        update_mesh = NULL;
 
         LinearizerBase::free();
       }
@@ -967,6 +1415,304 @@ namespace Hermes
         fclose(f);
       }
 
+      void Linearizer::save_solution_vtu(MeshFunction<double>* sln, const char* filename, const char* quantity_name,
+        bool mode_3D, int item, double eps, bool compress)
+      {
+        Hermes::vector<MeshFunction<double>*> slns;
+        slns.push_back(sln);
+        Hermes::vector<const char*> quantity_names;
+        quantity_names.push_back(quantity_name);
+        this->save_solution_vtu(slns, quantity_names, filename, mode_3D, item, eps, compress);
+      }
+
+      void Linearizer::save_solution_vtu(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<const char*> quantity_names,
+        const char* filename, bool mode_3D, int item, double eps, bool compress)
+      {
+        if(slns.empty() || slns.size() != quantity_names.size())
+          throw Exceptions::LengthException(1, 2, slns.size(), quantity_names.size());
+        if(slns.size() > 1 && (this->xdisp != NULL || this->ydisp != NULL))
+          throw Hermes::Exceptions::Exception("More functions in one VTU file need the Linearizer without a displacement.");
+
+        process_solution(slns[0], item, eps);
+        lock_data();
+
+        std::vector<float> points(3 * this->vertex_count);
+        std::vector<VtuField> fields(slns.size());
+        fields[0].values.resize(this->vertex_count);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = mode_3D ? (float) this->verts[i][2] : 0.0f;
+          fields[0].values[i] = (float) this->verts[i][2];
+        }
+
+        std::vector<int> connectivity(3 * this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+          for (int j = 0; j < 3; j++)
+            connectivity[3 * i + j] = this->tris[i][j];
+
+        // The further functions in the vertices, located in their meshes at once.
+        if(slns.size() > 1)
+        {
+          int component_item = (item >= 0x40) ? (item >> 6) : item;
+          int value_index = 0;
+          while(!(component_item & 1))
+          {
+            component_item >>= 1;
+            value_index++;
+          }
+          std::vector<double> x(this->vertex_count), y(this->vertex_count);
+          for (int i = 0; i < this->vertex_count; i++)
+          {
+            x[i] = this->verts[i][0];
+            y[i] = this->verts[i][1];
+          }
+          for (unsigned int sln_i = 1; sln_i < slns.size(); sln_i++)
+          {
+            Func<double>* values = slns[sln_i]->get_pt_values(this->vertex_count, x.empty() ? NULL : &x[0], y.empty() ? NULL : &y[0]);
+            double* value = NULL;
+            if(slns[sln_i]->get_num_components() == 1)
+              value = (value_index == 0) ? values->val : (value_index == 1 ? values->dx : (value_index == 2 ? values->dy : NULL));
+            else if(value_index == 0)
+              value = (item >= 0x40) ? values->val1 : values->val0;
+            if(value == NULL)
+            {
+              values->free_fn();
+              delete values;
+              unlock_data();
+              throw Hermes::Exceptions::Exception("The item of the function %s is not available in the vertices.", quantity_names[sln_i]);
+            }
+            fields[sln_i].values.resize(this->vertex_count);
+            for (int i = 0; i < this->vertex_count; i++)
+              fields[sln_i].values[i] = (float) value[i];
+            values->free_fn();
+            delete values;
+          }
+        }
+
+        for (unsigned int i = 0; i < slns.size(); i++)
+        {
+          fields[i].name = quantity_names[i];
+          fields[i].num_components = 1;
+          fields[i].cell_data = false;
+        }
+        unlock_data();
+
+        // The triangle type of VTK is 5.
+        save_vtu(filename, points, 3, 5, connectivity, fields, compress);
+      }
+
+      void Linearizer::save_vtu_piece(ThreadData* td, const char* piece_file, const char* quantity_name, bool mode_3D, bool compress)
+      {
+        merge_thread_data(td, 1);
+        regularize();
+
+        std::vector<float> points(3 * this->vertex_count);
+        std::vector<VtuField> fields(1);
+        fields[0].name = quantity_name;
+        fields[0].num_components = 1;
+        fields[0].cell_data = false;
+        fields[0].values.resize(this->vertex_count);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = mode_3D ? (float) this->verts[i][2] : 0.0f;
+          fields[0].values[i] = (float) this->verts[i][2];
+        }
+        std::vector<int> connectivity(3 * this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+          for (int j = 0; j < 3; j++)
+            connectivity[3 * i + j] = this->tris[i][j];
+
+        ::free(this->hash_table);
+        ::free(this->info);
+        this->hash_table = NULL;
+        this->info = NULL;
+
+        // the next piece starts from scratch
+        td->vertex_count = td->triangle_count = td->edges_count = 0;
+        memset(td->hash_table, 0xff, sizeof(int) * td->vertex_size);
+
+        // The triangle type of VTK is 5.
+        save_vtu(piece_file, points, 3, 5, connectivity, fields, compress);
+      }
+
+      void Linearizer::save_solution_vtu_pieces(MeshFunction<double>* sln, const char* filename, const char* quantity_name,
+        int states_per_piece, bool mode_3D, int item_, double eps, bool compress)
+      {
+        if(states_per_piece < 1)
+          throw Exceptions::ValueException("states_per_piece", states_per_piece, 1);
+
+        // Important, sets the current caughtException to NULL.
+        this->caughtException = NULL;
+
+        lock_data();
+        this->tick();
+
+        // Initialization of 'global' stuff, as in process_solution().
+        this->item = item_;
+        this->eps = eps;
+        this->component = 0;
+        this->value_type = 0;
+        if(item >= 0x40)
+        {
+          component = 1;
+          this->item >>= 6;
+        }
+        while (!(item & 1))
+        {
+          this->item >>= 1;
+          value_type++;
+        }
+        this->item = item_;
+
+        // The functions (of one thread), with the linearization quadrature.
+        Hermes::vector<const Mesh*> meshes;
+        MeshFunction<double>* fns[3];
+        Transformable* trfs[3];
+        int num_fns = 0;
+        fns[num_fns] = sln->clone();
+        fns[num_fns]->set_refmap(new RefMap);
+        meshes.push_back(sln->get_mesh());
+        num_fns++;
+        if(xdisp != NULL)
+        {
+          fns[num_fns] = xdisp->clone();
+          meshes.push_back(xdisp->get_mesh());
+          num_fns++;
+        }
+        if(ydisp != NULL)
+        {
+          fns[num_fns] = ydisp->clone();
+          meshes.push_back(ydisp->get_mesh());
+          num_fns++;
+        }
+        for (int i = 0; i < num_fns; i++)
+        {
+          fns[i]->set_quad_2d(&g_quad_lin);
+          trfs[i] = fns[i];
+        }
+
+        // The piece files, next to the .pvtu one.
+        std::string base_name(filename);
+        size_t dot = base_name.rfind('.');
+        if(dot != std::string::npos && base_name.find_first_of("/\\", dot) == std::string::npos)
+          base_name.erase(dot);
+        size_t directory_end = base_name.find_last_of("/\\");
+        std::vector<std::string> piece_files;
+
+        // The arrays of one piece only.
+        ThreadData td;
+        int piece_size = std::min(states_per_piece, 1 << 20);
+        td.init(16 * piece_size, 24 * piece_size, 16 * piece_size);
+
+        try
+        {
+          Traverse::State* current_state;
+
+          // estimate the maximum solution value from the vertices
+          if(this->auto_max)
+          {
+            Traverse trav_max(true);
+            trav_max.begin(num_fns, &(meshes.front()), trfs);
+            try
+            {
+              while((current_state = trav_max.get_next_state()) != NULL)
+              {
+                fns[0]->set_quad_order(0, this->item);
+                double* val = fns[0]->get_values(component, value_type);
+                if(val == NULL)
+                  throw Hermes::Exceptions::Exception("Item not defined in the solution in Linearizer::save_solution_vtu_pieces.");
+                for (unsigned int i = 0; i < current_state->e[0]->get_nvert(); i++)
+                  if(finite(val[i]) && fabs(val[i]) > this->max)
+                    this->max = fabs(val[i]);
+              }
+            }
+            catch(...)
+            {
+              trav_max.finish();
+              throw;
+            }
+            trav_max.finish();
+          }
+          td.max = this->max;
+
+          // linearize and write the pieces
+          Traverse trav(true);
+          trav.begin(num_fns, &(meshes.front()), trfs);
+          try
+          {
+            int piece_states = 0;
+            bool last = false;
+            while(this->caughtException == NULL && !last)
+            {
+              current_state = trav.get_next_state();
+              last = (current_state == NULL);
+              if(!last)
+              {
+                process_state(&td, fns, current_state->e[0]);
+                piece_states++;
+              }
+
+              // a full piece, or the rest (an empty piece for no states at all)
+              if(this->caughtException == NULL && (piece_states == states_per_piece || (last && (piece_states > 0 || piece_files.empty()))))
+              {
+                char number[32];
+                sprintf(number, "_%d.vtu", (int) piece_files.size());
+                std::string piece_file = base_name + number;
+                save_vtu_piece(&td, piece_file.c_str(), quantity_name, mode_3D, compress);
+                piece_files.push_back(directory_end == std::string::npos ? piece_file : piece_file.substr(directory_end + 1));
+                piece_states = 0;
+              }
+            }
+          }
+          catch(...)
+          {
+            trav.finish();
+            throw;
+          }
+          trav.finish();
+        }
+        catch(Hermes::Exceptions::Exception& e)
+        {
+          if(this->caughtException == NULL)
+            this->caughtException = e.clone();
+        }
+        catch(std::exception& e)
+        {
+          if(this->caughtException == NULL)
+            this->caughtException = new Hermes::Exceptions::Exception(e.what());
+        }
+
+        for (int i = 0; i < num_fns; i++)
+          delete fns[i];
+
+        // the index of the pieces
+        if(this->caughtException == NULL)
+        {
+          std::vector<VtuField> fields(1);
+          fields[0].name = quantity_name;
+          fields[0].num_components = 1;
+          fields[0].cell_data = false;
+          try
+          {
+            save_pvtu(filename, piece_files, fields);
+          }
+          catch(Hermes::Exceptions::Exception& e)
+          {
+            this->caughtException = e.clone();
+          }
+        }
+
+        free();
+        this->unlock_data();
+
+        if(this->caughtException != NULL)
+          throw *(this->caughtException);
+      }
+
       void Linearizer::calc_vertices_aabb(double* min_x, double* max_x, double* min_y, double* max_y) const
       {
         if(verts == NULL)
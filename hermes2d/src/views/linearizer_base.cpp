@@ -19,6 +19,9 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "linearizer_base.h"
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif
 namespace Hermes
 {
   namespace Hermes2D
@@ -224,6 +227,28 @@ namespace Hermes
         }
       }
 
+      int LinearizerBase::vertex_hash(int p1, int p2, int vertex_size)
+      {
+        return (984120265*p1 + 125965121*p2) & (vertex_size - 1);
+      }
+
+      // The key of a vertex, the same in all the threads: the id of the mesh vertex (p1 == p2 == -id),
+      // or a combination of the keys of the parent vertices of a mid-edge vertex.
+      uint64_t LinearizerBase::vertex_key(const uint64_t* keys, int p1, int p2)
+      {
+        static const uint64_t mesh_vertex = (uint64_t) 1 << 63;
+        if(p1 == p2)
+          return mesh_vertex | (uint64_t) (-p1);
+        uint64_t a = std::min(keys[p1], keys[p2]), b = std::max(keys[p1], keys[p2]);
+        uint64_t h = a * 0x9E3779B97F4A7C15ULL + b;
+        h ^= h >> 31;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 29;
+        h += b * 0x94D049BB133111EBULL;
+        h ^= h >> 32;
+        return h & ~mesh_vertex;
+      }
+
       int LinearizerBase::hash(int p1, int p2)
       {
         return (984120265*p1 + 125965121*p2) & (vertex_size - 1);
@@ -291,6 +316,130 @@ namespace Hermes
       {
         return this->edges_count;
       }
+
+      // Appends one array to the appended section of a VTU file: the raw bytes behind their UInt32 size, or a single zlib
+      // block behind the header of vtkZLibDataCompressor (the number of blocks, the block size, the size of the last
+      // partial block and the compressed size).
+      static void append_vtu_block(std::string& appended, const void* data, size_t bytes, bool compress)
+      {
+        if(!compress)
+        {
+          unsigned int size = (unsigned int) bytes;
+          appended.append((const char*) &size, sizeof(unsigned int));
+          appended.append((const char*) data, bytes);
+          return;
+        }
+#ifdef WITH_ZLIB
+        uLongf compressed_bytes = compressBound(bytes);
+        std::vector<Bytef> compressed(compressed_bytes + 1);
+        if(bytes > 0 && compress2(&compressed[0], &compressed_bytes, (const Bytef*) data, bytes, Z_BEST_SPEED) != Z_OK)
+          throw Hermes::Exceptions::Exception("Compression of the VTU data failed.");
+        if(bytes == 0)
+          compressed_bytes = 0;
+        unsigned int header[4] = { bytes > 0 ? 1 : 0, (unsigned int) bytes, 0, (unsigned int) compressed_bytes };
+        appended.append((const char*) header, bytes > 0 ? 4 * sizeof(unsigned int) : 3 * sizeof(unsigned int));
+        appended.append((const char*) &compressed[0], compressed_bytes);
+#else
+        throw Hermes::Exceptions::Exception("Compressed VTU output needs Hermes built WITH_ZLIB.");
+#endif
+      }
+
+      void LinearizerBase::save_vtu(const char* filename, const std::vector<float>& points, int cell_size, int cell_type,
+        const std::vector<int>& connectivity, const std::vector<VtuField>& fields, bool compress)
+      {
+        int num_points = points.size() / 3;
+        int num_cells = connectivity.size() / cell_size;
+
+        std::vector<int> offsets(num_cells);
+        for (int i = 0; i < num_cells; i++)
+          offsets[i] = (i + 1) * cell_size;
+        std::vector<unsigned char> types(num_cells, (unsigned char) cell_type);
+
+        // The appended section, and the offsets of the arrays in it.
+        std::string appended;
+        std::vector<size_t> field_offsets;
+        for (unsigned int i = 0; i < fields.size(); i++)
+        {
+          field_offsets.push_back(appended.size());
+          append_vtu_block(appended, fields[i].values.empty() ? NULL : &fields[i].values[0], fields[i].values.size() * sizeof(float), compress);
+        }
+        size_t points_offset = appended.size();
+        append_vtu_block(appended, points.empty() ? NULL : &points[0], points.size() * sizeof(float), compress);
+        size_t connectivity_offset = appended.size();
+        append_vtu_block(appended, connectivity.empty() ? NULL : &connectivity[0], connectivity.size() * sizeof(int), compress);
+        size_t offsets_offset = appended.size();
+        append_vtu_block(appended, offsets.empty() ? NULL : &offsets[0], offsets.size() * sizeof(int), compress);
+        size_t types_offset = appended.size();
+        append_vtu_block(appended, types.empty() ? NULL : &types[0], types.size(), compress);
+
+        FILE* f = fopen(filename, "wb");
+        if(f == NULL)
+          throw Hermes::Exceptions::Exception("Could not open %s for writing.", filename);
+
+        int one = 1;
+        bool little_endian = (*(char*) &one == 1);
+        fprintf(f, "<?xml version=\"1.0\"?>\n");
+        fprintf(f, "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"%s\"%s>\n", little_endian ? "LittleEndian" : "BigEndian",
+          compress ? " compressor=\"vtkZLibDataCompressor\"" : "");
+        fprintf(f, "  <UnstructuredGrid>\n");
+        fprintf(f, "    <Piece NumberOfPoints=\"%d\" NumberOfCells=\"%d\">\n", num_points, num_cells);
+        for (int cell_data = 0; cell_data < 2; cell_data++)
+        {
+          fprintf(f, cell_data ? "      <CellData>\n" : "      <PointData>\n");
+          for (unsigned int i = 0; i < fields.size(); i++)
+            if(fields[i].cell_data == (cell_data == 1))
+              fprintf(f, "        <DataArray type=\"Float32\" Name=\"%s\" NumberOfComponents=\"%d\" format=\"appended\" offset=\"%lu\"/>\n",
+                fields[i].name.c_str(), fields[i].num_components, (unsigned long) field_offsets[i]);
+          fprintf(f, cell_data ? "      </CellData>\n" : "      </PointData>\n");
+        }
+        fprintf(f, "      <Points>\n");
+        fprintf(f, "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"appended\" offset=\"%lu\"/>\n", (unsigned long) points_offset);
+        fprintf(f, "      </Points>\n");
+        fprintf(f, "      <Cells>\n");
+        fprintf(f, "        <DataArray type=\"Int32\" Name=\"connectivity\" format=\"appended\" offset=\"%lu\"/>\n", (unsigned long) connectivity_offset);
+        fprintf(f, "        <DataArray type=\"Int32\" Name=\"offsets\" format=\"appended\" offset=\"%lu\"/>\n", (unsigned long) offsets_offset);
+        fprintf(f, "        <DataArray type=\"UInt8\" Name=\"types\" format=\"appended\" offset=\"%lu\"/>\n", (unsigned long) types_offset);
+        fprintf(f, "      </Cells>\n");
+        fprintf(f, "    </Piece>\n");
+        fprintf(f, "  </UnstructuredGrid>\n");
+        fprintf(f, "  <AppendedData encoding=\"raw\">\n_");
+        bool ok = fwrite(appended.data(), 1, appended.size(), f) == appended.size();
+        fprintf(f, "\n  </AppendedData>\n");
+        fprintf(f, "</VTKFile>\n");
+        ok = (fclose(f) == 0) && ok;
+        if(!ok)
+          throw Hermes::Exceptions::Exception("Error writing the file %s.", filename);
+      }
+
+      void LinearizerBase::save_pvtu(const char* filename, const std::vector<std::string>& piece_files, const std::vector<VtuField>& fields)
+      {
+        FILE* f = fopen(filename, "wb");
+        if(f == NULL)
+          throw Hermes::Exceptions::Exception("Could not open %s for writing.", filename);
+
+        int one = 1;
+        bool little_endian = (*(char*) &one == 1);
+        fprintf(f, "<?xml version=\"1.0\"?>\n");
+        fprintf(f, "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"%s\">\n", little_endian ? "LittleEndian" : "BigEndian");
+        fprintf(f, "  <PUnstructuredGrid GhostLevel=\"0\">\n");
+        for (int cell_data = 0; cell_data < 2; cell_data++)
+        {
+          fprintf(f, cell_data ? "    <PCellData>\n" : "    <PPointData>\n");
+          for (unsigned int i = 0; i < fields.size(); i++)
+            if(fields[i].cell_data == (cell_data == 1))
+              fprintf(f, "      <PDataArray type=\"Float32\" Name=\"%s\" NumberOfComponents=\"%d\"/>\n", fields[i].name.c_str(), fields[i].num_components);
+          fprintf(f, cell_data ? "    </PCellData>\n" : "    </PPointData>\n");
+        }
+        fprintf(f, "    <PPoints>\n");
+        fprintf(f, "      <PDataArray type=\"Float32\" NumberOfComponents=\"3\"/>\n");
+        fprintf(f, "    </PPoints>\n");
+        for (unsigned int i = 0; i < piece_files.size(); i++)
+          fprintf(f, "    <Piece Source=\"%s\"/>\n", piece_files[i].c_str());
+        fprintf(f, "  </PUnstructuredGrid>\n");
+        fprintf(f, "</VTKFile>\n");
+        if(fclose(f) != 0)
+          throw Hermes::Exceptions::Exception("Error writing the file %s.", filename);
+      }
     }
   }
 }
\ No newline at end of file
@@ -0,0 +1,812 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "multi_linearizer.h"
+#include "refmap.h"
+#include "traverse.h"
+#include "api2d.h"
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    namespace Views
+    {
+      MultiLinearizer::MultiLinearizer() : LinearizerBase(true), curvature_epsilon(1e-3), num_fields(0), master(ALL_FIELDS)
+      {
+        verts = NULL;
+        values = NULL;
+      }
+
+      MultiLinearizer::~MultiLinearizer()
+      {
+        free();
+      }
+
+      bool MultiLinearizer::drives_refinement(int field) const
+      {
+        return this->master == ALL_FIELDS || this->master == field;
+      }
+
+      void MultiLinearizer::push_transforms(MeshFunction<double>** fns, int transform)
+      {
+        for (int f = 0; f < this->num_fields; f++)
+          fns[f]->push_transform(transform);
+      }
+
+      void MultiLinearizer::pop_transforms(MeshFunction<double>** fns)
+      {
+        for (int f = 0; f < this->num_fields; f++)
+          fns[f]->pop_transform();
+      }
+
+      void MultiLinearizer::process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+        double** val, double* phx, double* phy, int* idx, bool curved)
+      {
+        // the values of all the functions, if obtained on this level
+        std::vector<double*> level_val;
+        int iv[3] = { iv0, iv1, iv2 };
+
+        if(level < LIN_MAX_LEVEL)
+        {
+          int i;
+          if(!(level & 1))
+          {
+            // obtain the values of all the functions
+            level_val.resize(this->num_fields);
+            for (int f = 0; f < this->num_fields; f++)
+            {
+              fns[f]->set_quad_order(1, this->items[f]);
+              level_val[f] = fns[f]->get_values(this->components[f], this->value_types[f]);
+              for (i = 0; i < lin_np_tri[1]; i++)
+                if(finite(level_val[f][i]) && fabs(level_val[f][i]) > this->field_max[f])
+                  this->field_max[f] = fabs(level_val[f][i]);
+            }
+            val = &level_val[0];
+            idx = tri_indices[0];
+
+            if(curved)
+            {
+              // obtain physical element coordinates
+              RefMap* refmap = fns[0]->get_refmap();
+              phx = refmap->get_phys_x(1);
+              phy = refmap->get_phys_y(1);
+            }
+          }
+
+          // obtain linearized coordinates at the midpoints
+          double midx[3], midy[3];
+          for (i = 0; i < 3; i++)
+          {
+            midx[i] = (verts[iv[i]][0] + verts[iv[(i + 1) % 3]][0]) * 0.5;
+            midy[i] = (verts[iv[i]][1] + verts[iv[(i + 1) % 3]][1]) * 0.5;
+          }
+
+          // determine whether or not to split the element
+          bool split = false;
+          if(eps >= 1.0)
+          {
+            // if eps > 1, the user wants a fixed number of refinements (no adaptivity)
+            split = ((level + 5) < eps);
+          }
+          else
+          {
+            for (int f = 0; f < this->num_fields && !split; f++)
+            {
+              if(!drives_refinement(f))
+                continue;
+
+              // linearized values at the midpoints
+              double mid[3];
+              for (i = 0; i < 3; i++)
+                mid[i] = (values[iv[i] * this->num_fields + f] + values[iv[(i + 1) % 3] * this->num_fields + f]) * 0.5;
+
+              // calculate the approximate error of linearizing the normalized function
+              double err = fabs(val[f][idx[0]] - mid[0]) + fabs(val[f][idx[1]] - mid[1]) + fabs(val[f][idx[2]] - mid[2]);
+              split = !finite(err) || err > this->field_max[f] * 3 * eps;
+
+              // do extra tests at level 0, so as not to miss some functions with zero error at edge midpoints
+              if(level == 0 && !split)
+              {
+                split = (fabs(val[f][8] - 0.5 * (mid[0] + mid[1])) +
+                  fabs(val[f][9] - 0.5 * (mid[1] + mid[2])) +
+                  fabs(val[f][4] - 0.5 * (mid[2] + mid[0]))) > this->field_max[f] * 3 * eps;
+              }
+            }
+
+            // do the same for the curvature
+            if(!split && curved)
+            {
+              for (i = 0; i < 3; i++)
+                if(sqr(phx[idx[i]] - midx[i]) + sqr(phy[idx[i]] - midy[i]) > sqr(fns[0]->get_active_element()->get_diameter() * this->get_curvature_epsilon()))
+                {
+                  split = true;
+                  break;
+                }
+            }
+          }
+
+          // split the triangle if the error is too large, otherwise produce a linear triangle
+          if(split)
+          {
+            if(curved)
+              for (i = 0; i < 3; i++)
+              {
+                midx[i] = phx[idx[i]];
+                midy[i] = phy[idx[i]];
+              }
+
+            // obtain mid-edge vertices
+            int mid[3];
+            std::vector<double> mid_value(this->num_fields);
+            for (i = 0; i < 3; i++)
+            {
+              for (int f = 0; f < this->num_fields; f++)
+                mid_value[f] = val[f][idx[i]];
+              mid[i] = get_vertex(iv[i], iv[(i + 1) % 3], midx[i], midy[i], &mid_value[0]);
+            }
+
+            if(this->caughtException != NULL)
+              return;
+
+            // recur to sub-elements
+            this->push_transforms(fns, 0);
+            process_triangle(fns, iv0, mid[0], mid[2], level + 1, val, phx, phy, tri_indices[1], curved);
+            this->pop_transforms(fns);
+
+            this->push_transforms(fns, 1);
+            process_triangle(fns, mid[0], iv1, mid[1], level + 1, val, phx, phy, tri_indices[2], curved);
+            this->pop_transforms(fns);
+
+            this->push_transforms(fns, 2);
+            process_triangle(fns, mid[2], mid[1], iv2, level + 1, val, phx, phy, tri_indices[3], curved);
+            this->pop_transforms(fns);
+
+            this->push_transforms(fns, 3);
+            process_triangle(fns, mid[1], mid[2], mid[0], level + 1, val, phx, phy, tri_indices[4], curved);
+            this->pop_transforms(fns);
+            return;
+          }
+        }
+
+        // no splitting: output a linear triangle
+        add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+      }
+
+      void MultiLinearizer::process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+        double** val, double* phx, double* phy, int* idx, bool curved)
+      {
+        // the values of all the functions, if obtained on this level
+        std::vector<double*> level_val;
+        int iv[4] = { iv0, iv1, iv2, iv3 };
+
+        // try not to split through the vertex with the largest value (of the master function, or the first one)
+        int flip_field = (this->master == ALL_FIELDS) ? 0 : this->master;
+        int a = (values[iv0 * this->num_fields + flip_field] > values[iv1 * this->num_fields + flip_field]) ? iv0 : iv1;
+        int b = (values[iv2 * this->num_fields + flip_field] > values[iv3 * this->num_fields + flip_field]) ? iv2 : iv3;
+        a = (values[a * this->num_fields + flip_field] > values[b * this->num_fields + flip_field]) ? a : b;
+        int flip = (a == iv1 || a == iv3) ? 1 : 0;
+
+        if(level < LIN_MAX_LEVEL)
+        {
+          int i;
+          if(!(level & 1)) // this is an optimization: do the following only every other time
+          {
+            // obtain the values of all the functions
+            level_val.resize(this->num_fields);
+            for (int f = 0; f < this->num_fields; f++)
+            {
+              fns[f]->set_quad_order(1, this->items[f]);
+              level_val[f] = fns[f]->get_values(this->components[f], this->value_types[f]);
+              for (i = 0; i < lin_np_quad[1]; i++)
+                if(finite(level_val[f][i]) && fabs(level_val[f][i]) > this->field_max[f])
+                  this->field_max[f] = fabs(level_val[f][i]);
+            }
+            val = &level_val[0];
+            idx = quad_indices[0];
+
+            if(curved)
+            {
+              RefMap* refmap = fns[0]->get_refmap();
+              phx = refmap->get_phys_x(1);
+              phy = refmap->get_phys_y(1);
+            }
+          }
+
+          // obtain linearized coordinates at the midpoints
+          double midx[5], midy[5];
+          for (i = 0; i < 4; i++)
+          {
+            midx[i] = (verts[iv[i]][0] + verts[iv[(i + 1) % 4]][0]) * 0.5;
+            midy[i] = (verts[iv[i]][1] + verts[iv[(i + 1) % 4]][1]) * 0.5;
+          }
+          midx[4] = (midx[0] + midx[2]) * 0.5;
+          midy[4] = (midy[0] + midy[2]) * 0.5;
+
+          // determine whether or not to split the element
+          int split = 0;
+          if(eps >= 1.0)
+          {
+            // if eps > 1, the user wants a fixed number of refinements (no adaptivity)
+            split = (level < eps) ? 3 : 0;
+          }
+          else
+          {
+            // the splits the functions ask for are combined
+            for (int f = 0; f < this->num_fields && split != 3; f++)
+            {
+              if(!drives_refinement(f))
+                continue;
+
+              // linearized values at the midpoints
+              double mid[5];
+              for (i = 0; i < 4; i++)
+                mid[i] = (values[iv[i] * this->num_fields + f] + values[iv[(i + 1) % 4] * this->num_fields + f]) * 0.5;
+              // the value of the middle point is not the average of the four vertex values, since quad == 2 triangles
+              mid[4] = flip ? (values[iv0 * this->num_fields + f] + values[iv2 * this->num_fields + f]) * 0.5
+                : (values[iv1 * this->num_fields + f] + values[iv3 * this->num_fields + f]) * 0.5;
+
+              // calculate the approximate error of linearizing the normalized function
+              double herr = fabs(val[f][idx[1]] - mid[1]) + fabs(val[f][idx[3]] - mid[3]);
+              double verr = fabs(val[f][idx[0]] - mid[0]) + fabs(val[f][idx[2]] - mid[2]);
+              double err  = fabs(val[f][idx[4]] - mid[4]) + herr + verr;
+              int field_split = (!finite(err) || err > this->field_max[f] * 4 * eps) ? 3 : 0;
+
+              // decide whether to split horizontally or vertically only
+              if(level > 0 && field_split)
+              {
+                if(herr > 5 * verr)
+                  field_split = 1; // h-split
+                else if(verr > 5 * herr)
+                  field_split = 2; // v-split
+              }
+
+              // do extra tests at level 0, so as not to miss some functions with zero error at edge midpoints
+              if(level == 0 && !field_split)
+              {
+                field_split = ((fabs(val[f][13] - 0.5 * (mid[0] + mid[1])) +
+                  fabs(val[f][17] - 0.5 * (mid[1] + mid[2])) +
+                  fabs(val[f][20] - 0.5 * (mid[2] + mid[3])) +
+                  fabs(val[f][9]  - 0.5 * (mid[3] + mid[0]))) > this->field_max[f] * 4 * eps) ? 3 : 0;
+              }
+              split |= field_split;
+            }
+
+            // also decide whether to split because of the curvature
+            if(split != 3 && curved)
+            {
+              double cm2 = sqr(fns[0]->get_active_element()->get_diameter() * this->get_curvature_epsilon());
+              if(sqr(phx[idx[1]] - midx[1]) + sqr(phy[idx[1]] - midy[1]) > cm2 ||
+                sqr(phx[idx[3]] - midx[3]) + sqr(phy[idx[3]] - midy[3]) > cm2) split |= 1;
+              if(sqr(phx[idx[0]] - midx[0]) + sqr(phy[idx[0]] - midy[0]) > cm2 ||
+                sqr(phx[idx[2]] - midx[2]) + sqr(phy[idx[2]] - midy[2]) > cm2) split |= 2;
+            }
+          }
+
+          // split the quad if the error is too large, otherwise produce two linear triangles
+          if(split)
+          {
+            if(curved)
+              for (i = 0; i < 5; i++)
+              {
+                midx[i] = phx[idx[i]];
+                midy[i] = phy[idx[i]];
+              }
+
+            // obtain mid-edge and mid-element vertices
+            int mid[5];
+            std::vector<double> mid_value(this->num_fields);
+            for (i = 0; i < 4; i++)
+            {
+              // the mid-edge vertices of the edges not split are not needed
+              if((split == 1 && !(i & 1)) || (split == 2 && (i & 1)))
+                continue;
+              for (int f = 0; f < this->num_fields; f++)
+                mid_value[f] = val[f][idx[i]];
+              mid[i] = get_vertex(iv[i], iv[(i + 1) % 4], midx[i], midy[i], &mid_value[0]);
+            }
+            if(split == 3)
+            {
+              for (int f = 0; f < this->num_fields; f++)
+                mid_value[f] = val[f][idx[4]];
+              mid[4] = get_vertex(mid[0], mid[2], midx[4], midy[4], &mid_value[0]);
+            }
+
+            if(this->caughtException != NULL)
+              return;
+
+            // recur to sub-elements
+            if(split == 3)
+            {
+              this->push_transforms(fns, 0);
+              process_quad(fns, iv0, mid[0], mid[4], mid[3], level + 1, val, phx, phy, quad_indices[1], curved);
+              this->pop_transforms(fns);
+
+              this->push_transforms(fns, 1);
+              process_quad(fns, mid[0], iv1, mid[1], mid[4], level + 1, val, phx, phy, quad_indices[2], curved);
+              this->pop_transforms(fns);
+
+              this->push_transforms(fns, 2);
+              process_quad(fns, mid[4], mid[1], iv2, mid[2], level + 1, val, phx, phy, quad_indices[3], curved);
+              this->pop_transforms(fns);
+
+              this->push_transforms(fns, 3);
+              process_quad(fns, mid[3], mid[4], mid[2], iv3, level + 1, val, phx, phy, quad_indices[4], curved);
+              this->pop_transforms(fns);
+            }
+            else if(split == 1) // h-split
+            {
+              this->push_transforms(fns, 4);
+              process_quad(fns, iv0, iv1, mid[1], mid[3], level + 1, val, phx, phy, quad_indices[5], curved);
+              this->pop_transforms(fns);
+
+              this->push_transforms(fns, 5);
+              process_quad(fns, mid[3], mid[1], iv2, iv3, level + 1, val, phx, phy, quad_indices[6], curved);
+              this->pop_transforms(fns);
+            }
+            else // v-split
+            {
+              this->push_transforms(fns, 6);
+              process_quad(fns, iv0, mid[0], mid[2], iv3, level + 1, val, phx, phy, quad_indices[7], curved);
+              this->pop_transforms(fns);
+
+              this->push_transforms(fns, 7);
+              process_quad(fns, mid[0], iv1, iv2, mid[2], level + 1, val, phx, phy, quad_indices[8], curved);
+              this->pop_transforms(fns);
+            }
+            return;
+          }
+        }
+
+        // output two linear triangles,
+        if(!flip)
+        {
+          add_triangle(iv3, iv0, iv1, fns[0]->get_active_element()->marker);
+          add_triangle(iv1, iv2, iv3, fns[0]->get_active_element()->marker);
+        }
+        else
+        {
+          add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+          add_triangle(iv2, iv3, iv0, fns[0]->get_active_element()->marker);
+        }
+      }
+
+      void MultiLinearizer::process_solutions(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<int> items_, double eps, int master)
+      {
+        // Important, sets the current caughtException to NULL.
+        this->caughtException = NULL;
+
+        // sanity checks
+        if(slns.empty())
+          throw Hermes::Exceptions::Exception("No functions passed to MultiLinearizer::process_solutions().");
+        if(!items_.empty() && items_.size() != slns.size())
+          throw Exceptions::LengthException(2, items_.size(), slns.size());
+        if(master != ALL_FIELDS && (master < 0 || master >= (int)slns.size()))
+          throw Exceptions::ValueException("master", master, 0, slns.size() - 1);
+        for (unsigned int f = 0; f < slns.size(); f++)
+          if(slns[f] == NULL)
+            throw Hermes::Exceptions::Exception("One of the functions is NULL in MultiLinearizer::process_solutions().");
+
+        lock_data();
+        this->tick();
+
+        // Initialization of 'global' stuff.
+        this->num_fields = slns.size();
+        this->master = master;
+        this->eps = eps;
+        //   get the component and desired value from the items.
+        this->items.resize(this->num_fields);
+        this->components.assign(this->num_fields, 0);
+        this->value_types.assign(this->num_fields, 0);
+        for (int f = 0; f < this->num_fields; f++)
+        {
+          int item = items_.empty() ? H2D_FN_VAL_0 : items_[f];
+          this->items[f] = item;
+          if(item >= 0x40)
+          {
+            this->components[f] = 1;
+            item >>= 6;
+          }
+          while (!(item & 1))
+          {
+            item >>= 1;
+            this->value_types[f]++;
+          }
+        }
+
+        // Initialization of computation stuff.
+        //    sizes.
+        Hermes::vector<const Mesh*> meshes;
+        int nn = 0;
+        for (int f = 0; f < this->num_fields; f++)
+        {
+          meshes.push_back(slns[f]->get_mesh());
+          nn = std::max(nn, slns[f]->get_mesh()->get_num_elements());
+        }
+        this->vertex_size = std::max(100 * nn, std::max(this->vertex_size, 50000));
+        this->triangle_size = std::max(150 * nn, std::max(this->triangle_size, 75000));
+        this->edges_size = std::max(100 * nn, std::max(this->edges_size, 50000));
+        //    counts.
+        this->vertex_count = 0;
+        this->triangle_count = 0;
+        this->edges_count = 0;
+        //    reuse or allocate vertex, triangle and edge arrays.
+        this->verts = (double2*) realloc(this->verts, sizeof(double2) * this->vertex_size);
+        this->values = (double*) realloc(this->values, sizeof(double) * this->num_fields * this->vertex_size);
+        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
+        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
+        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
+        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
+        this->info = (int4*) malloc(sizeof(int4) * this->vertex_size);
+        this->empty = false;
+        //    initialize the hash table
+        this->hash_table = (int*) malloc(sizeof(int) * this->vertex_size);
+        memset(this->hash_table, 0xff, sizeof(int) * this->vertex_size);
+
+        // One traversal of the union mesh of all the functions, for both the passes below.
+        Traverse trav_master(true);
+        int num_states;
+        Traverse::State** states = trav_master.get_states(meshes, num_states);
+
+        // The functions of the threads, clones with the linearization quadrature.
+        int num_threads_used = std::max(1, std::min(num_states, (int)Hermes2DApi.get_num_threads()));
+        std::vector<std::vector<MeshFunction<double>*> > fns(num_threads_used);
+        std::vector<std::vector<Transformable*> > trfs(num_threads_used);
+        for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+          for (int f = 0; f < this->num_fields; f++)
+          {
+            MeshFunction<double>* fn = slns[f]->clone();
+            fn->set_refmap(new RefMap);
+            fn->set_quad_2d(&g_quad_lin);
+            fns[thread_i].push_back(fn);
+            trfs[thread_i].push_back(fn);
+          }
+
+        Traverse* trav = new Traverse[num_threads_used];
+        for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+          trav[thread_i].begin(meshes.size(), &(meshes.front()), &(trfs[thread_i].front()));
+
+        // Estimate the maximum absolute values from the vertices, in parallel.
+        std::vector<std::vector<double> > thread_max(num_threads_used, std::vector<double>(this->num_fields, 0.0));
+        int state_i;
+#pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads_used)
+        for (state_i = 0; state_i < num_states; state_i++)
+        {
+          if(this->caughtException != NULL)
+            continue;
+          try
+          {
+            int thread_i = omp_get_thread_num();
+            trav[thread_i].set_active_state(states[state_i]);
+            for (int f = 0; f < this->num_fields; f++)
+            {
+              if(states[state_i]->e[f] == NULL)
+                continue;
+              fns[thread_i][f]->set_quad_order(0, this->items[f]);
+              double* val = fns[thread_i][f]->get_values(this->components[f], this->value_types[f]);
+              if(val == NULL)
+                throw Hermes::Exceptions::Exception("Item not defined in the solution in MultiLinearizer::process_solutions.");
+              for (int i = 0; i < states[state_i]->e[f]->get_nvert(); i++)
+                if(finite(val[i]) && fabs(val[i]) > thread_max[thread_i][f])
+                  thread_max[thread_i][f] = fabs(val[i]);
+            }
+          }
+          catch(Hermes::Exceptions::Exception& e)
+          {
+#pragma omp critical (multi_linearizer_exception)
+            if(this->caughtException == NULL)
+              this->caughtException = e.clone();
+          }
+          catch(std::exception& e)
+          {
+#pragma omp critical (multi_linearizer_exception)
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(e.what());
+          }
+        }
+
+        this->field_max.assign(this->num_fields, 0.0);
+        for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+          for (int f = 0; f < this->num_fields; f++)
+            this->field_max[f] = std::max(this->field_max[f], thread_max[thread_i][f]);
+        // This is just to make some sense.
+        for (int f = 0; f < this->num_fields; f++)
+          if(this->field_max[f] < 1E-10)
+            this->field_max[f] = 1E-10;
+
+        // The tessellation, in one thread - the vertices are shared by the neighboring (sub-)elements through the hash table.
+        MeshFunction<double>** state_fns = &(fns[0].front());
+        std::vector<double*> val(this->num_fields);
+        std::vector<double> vertex_value(this->num_fields);
+        for (state_i = 0; state_i < num_states && this->caughtException == NULL; state_i++)
+        {
+          try
+          {
+            Traverse::State* current_state = states[state_i];
+            trav[0].set_active_state(current_state);
+
+            for (int f = 0; f < this->num_fields; f++)
+            {
+              state_fns[f]->set_quad_order(0, this->items[f]);
+              val[f] = state_fns[f]->get_values(this->components[f], this->value_types[f]);
+            }
+
+            // The vertices of the (sub-)element are those of an element it is not a sub-element of, if there is one;
+            // otherwise the coordinates tell the vertices apart, as in Linearizer.
+            Element* e = current_state->e[0];
+            for (int f = 0; f < this->num_fields; f++)
+              if(current_state->e[f] != NULL && current_state->sub_idx[f] == 0)
+              {
+                e = current_state->e[f];
+                break;
+              }
+
+            RefMap* refmap = state_fns[0]->get_refmap();
+            int iv[H2D_MAX_NUMBER_VERTICES];
+            for (int i = 0; i < e->get_nvert(); i++)
+            {
+              for (int f = 0; f < this->num_fields; f++)
+                vertex_value[f] = val[f][i];
+              iv[i] = this->get_vertex(-e->vn[i]->id, -e->vn[i]->id, refmap->get_phys_x(0)[i], refmap->get_phys_y(0)[i], &vertex_value[0]);
+            }
+            if(this->caughtException != NULL)
+              break;
+
+            // recur to sub-elements
+            if(e->is_triangle())
+              process_triangle(state_fns, iv[0], iv[1], iv[2], 0, NULL, NULL, NULL, NULL, current_state->e[0]->is_curved());
+            else
+              process_quad(state_fns, iv[0], iv[1], iv[2], iv[3], 0, NULL, NULL, NULL, NULL, current_state->e[0]->is_curved());
+
+            for (int i = 0; i < e->get_nvert(); i++)
+              process_edge(iv[i], iv[(i + 1) % e->get_nvert()], e->en[i]->marker);
+          }
+          catch(Hermes::Exceptions::Exception& e)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = e.clone();
+          }
+          catch(std::exception& e)
+          {
+            if(this->caughtException == NULL)
+              this->caughtException = new Hermes::Exceptions::Exception(e.what());
+          }
+        }
+
+        for (int thread_i = 0; thread_i < num_threads_used; thread_i++)
+        {
+          trav[thread_i].finish();
+          for (int f = 0; f < this->num_fields; f++)
+            delete fns[thread_i][f];
+        }
+        delete [] trav;
+        Traverse::free_states(states, num_states);
+
+        if(this->caughtException != NULL)
+        {
+          this->unlock_data();
+          ::free(hash_table);
+          ::free(info);
+          throw *(this->caughtException);
+        }
+
+        // regularize the linear mesh
+        for (int i = 0; i < this->triangle_count; i++)
+        {
+          int iv0 = tris[i][0], iv1 = tris[i][1], iv2 = tris[i][2];
+
+          int mid0 = peek_vertex(iv0, iv1);
+          int mid1 = peek_vertex(iv1, iv2);
+          int mid2 = peek_vertex(iv2, iv0);
+          if(mid0 >= 0 || mid1 >= 0 || mid2 >= 0)
+          {
+            this->del_slot = i;
+            regularize_triangle(iv0, iv1, iv2, mid0, mid1, mid2, tri_markers[i]);
+          }
+        }
+
+        find_min_max();
+
+        this->unlock_data();
+
+        // clean up
+        ::free(hash_table);
+        ::free(info);
+      }
+
+      void MultiLinearizer::save_solutions_vtu(Hermes::vector<MeshFunction<double>*> slns, Hermes::vector<const char*> quantity_names,
+        const char* filename, Hermes::vector<int> items, double eps, int master, bool compress)
+      {
+        if(slns.size() != quantity_names.size())
+          throw Exceptions::LengthException(1, 2, slns.size(), quantity_names.size());
+
+        process_solutions(slns, items, eps, master);
+        lock_data();
+
+        std::vector<float> points(3 * this->vertex_count);
+        std::vector<VtuField> fields(this->num_fields);
+        for (int f = 0; f < this->num_fields; f++)
+        {
+          fields[f].name = quantity_names[f];
+          fields[f].num_components = 1;
+          fields[f].cell_data = false;
+          fields[f].values.resize(this->vertex_count);
+        }
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = 0.0f;
+          for (int f = 0; f < this->num_fields; f++)
+            fields[f].values[i] = (float) this->values[i * this->num_fields + f];
+        }
+
+        std::vector<int> connectivity(3 * this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+          for (int j = 0; j < 3; j++)
+            connectivity[3 * i + j] = this->tris[i][j];
+        unlock_data();
+
+        // The triangle type of VTK is 5.
+        save_vtu(filename, points, 3, 5, connectivity, fields, compress);
+      }
+
+      void MultiLinearizer::find_min_max()
+      {
+        // find min & max vertex values of all the functions
+        this->field_min_val.assign(this->num_fields, 1e100);
+        this->field_max_val.assign(this->num_fields, -1e100);
+        for (int i = 0; i < this->vertex_count; i++)
+          for (int f = 0; f < this->num_fields; f++)
+          {
+            double v = values[i * this->num_fields + f];
+            if(finite(v) && v < field_min_val[f]) field_min_val[f] = v;
+            if(finite(v) && v > field_max_val[f]) field_max_val[f] = v;
+          }
+
+        // the range of the base class is that of the function driving the refinement (the first one for all of them)
+        int range_field = (this->master == ALL_FIELDS) ? 0 : this->master;
+        this->min_val = field_min_val[range_field];
+        this->max_val = field_max_val[range_field];
+      }
+
+      int MultiLinearizer::get_vertex(int p1, int p2, double x, double y, const double* value)
+      {
+        // search for an existing vertex
+        if(p1 > p2) std::swap(p1, p2);
+        int index = this->hash(p1, p2);
+        int i = 0;
+        if(index < this->vertex_count)
+        {
+          i = this->hash_table[index];
+          while (i >= 0 && i < this->vertex_count)
+          {
+            if(this->info[i][0] == p1 && this->info[i][1] == p2 && (fabs(x - verts[i][0]) < 1e-8) && (fabs(y - verts[i][1]) < 1e-8))
+            {
+              // note that we won't return a vertex with different values than the required ones;
+              // this takes care for discontinuities in the functions, where more vertices
+              // with different values will be created
+              bool same_values = true;
+              for (int f = 0; f < this->num_fields && same_values; f++)
+              {
+                double v = values[i * this->num_fields + f];
+                same_values = (value[f] == v || fabs(value[f] - v) < this->field_max[f] * 1e-8);
+              }
+              if(same_values)
+                return i;
+            }
+            i = info[i][2];
+          }
+        }
+
+        // if not found, create a new one
+        try
+        {
+          i = add_vertex();
+        }
+        catch(std::exception& e)
+        {
+          if(this->caughtException == NULL)
+            this->caughtException = new Hermes::Exceptions::Exception(e.what());
+        }
+        if(this->caughtException != NULL)
+          return -1;
+
+        verts[i][0] = x;
+        verts[i][1] = y;
+        memcpy(values + i * this->num_fields, value, sizeof(double) * this->num_fields);
+        this->info[i][0] = p1;
+        this->info[i][1] = p2;
+        this->info[i][2] = hash_table[index];
+        this->hash_table[index] = i;
+        return i;
+      }
+
+      int MultiLinearizer::add_vertex()
+      {
+        if(this->vertex_count >= this->vertex_size)
+        {
+          this->vertex_size *= 2;
+          verts = (double2*) realloc(verts, sizeof(double2) * vertex_size);
+          values = (double*) realloc(values, sizeof(double) * this->num_fields * vertex_size);
+          this->info = (int4*) realloc(info, sizeof(int4) * vertex_size);
+          this->hash_table = (int*) realloc(hash_table, sizeof(int) * vertex_size);
+          memset(this->hash_table + this->vertex_size / 2, 0xff, sizeof(int) * this->vertex_size / 2);
+        }
+        return this->vertex_count++;
+      }
+
+      int MultiLinearizer::get_num_fields() const
+      {
+        return this->num_fields;
+      }
+
+      int MultiLinearizer::get_num_vertices()
+      {
+        return this->vertex_count;
+      }
+
+      double2* MultiLinearizer::get_vertices()
+      {
+        return this->verts;
+      }
+
+      double* MultiLinearizer::get_values()
+      {
+        return this->values;
+      }
+
+      double MultiLinearizer::get_min_value(int field) const
+      {
+        if(field < 0 || field >= (int)this->field_min_val.size())
+          throw Exceptions::ValueException("field", field, 0, (int)this->field_min_val.size() - 1);
+        return this->field_min_val[field];
+      }
+
+      double MultiLinearizer::get_max_value(int field) const
+      {
+        if(field < 0 || field >= (int)this->field_max_val.size())
+          throw Exceptions::ValueException("field", field, 0, (int)this->field_max_val.size() - 1);
+        return this->field_max_val[field];
+      }
+
+      void MultiLinearizer::set_curvature_epsilon(double curvature_epsilon)
+      {
+        this->curvature_epsilon = curvature_epsilon;
+      }
+
+      double MultiLinearizer::get_curvature_epsilon()
+      {
+        return this->curvature_epsilon;
+      }
+
+      void MultiLinearizer::free()
+      {
+        if(verts != NULL)
+        {
+          ::free(verts);
+          verts = NULL;
+        }
+        if(values != NULL)
+        {
+          ::free(values);
+          values = NULL;
+        }
+
+        LinearizerBase::free();
+      }
+    }
+  }
+}
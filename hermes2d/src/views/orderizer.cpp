@@ -16,6 +16,7 @@
 #include "orderizer.h"
 #include "space.h"
 #include "refmap.h"
+#include "api2d.h"
 #include "linear_data.cpp"
 
 namespace Hermes
@@ -117,25 +118,40 @@ namespace Hermes
         triangle_count = 0;
         edges_count = 0;
 
-        // estimate the required number of vertices and triangles
         Mesh* mesh = space->get_mesh();
         if(mesh == NULL)
         {
           throw Hermes::Exceptions::Exception("Mesh is NULL in Orderizer:process_space().");
         }
-        int nn = mesh->get_num_active_elements();
-        this->vertex_size = std::max(this->vertex_size, 77 * nn);
-        this->triangle_size = std::max(this->triangle_size, 64 * nn);
-        this->edges_size = std::max(this->edges_size, 16 * nn);
-        this->label_size = std::max(this->label_size, nn + 10);
-        cl1 = cl2 = cl3 = label_size;
+
+        // The active elements and the start of the vertices, triangles and edge slots of each of them; every element
+        // has a fixed number of them (by its mode), the elements are tessellated independently into their slots.
+        Hermes::vector<Element*> elements;
+        Element* e;
+        for_all_active_elements(e, mesh)
+          elements.push_back(e);
+        int num_elements = elements.size();
+        std::vector<int> vertex_starts(num_elements + 1, 0), triangle_starts(num_elements + 1, 0), edge_starts(num_elements + 1, 0);
+        for (int i = 0; i < num_elements; i++)
+        {
+          int mode = elements[i]->get_mode();
+          vertex_starts[i + 1] = vertex_starts[i] + quad_ord.get_num_points(type, elements[i]->get_mode());
+          triangle_starts[i + 1] = triangle_starts[i] + num_elem[mode][type];
+          edge_starts[i + 1] = edge_starts[i] + num_edge[mode][type];
+        }
 
         // reuse or allocate vertex, triangle and edge arrays
+        this->vertex_size = std::max(this->vertex_size, vertex_starts[num_elements]);
+        this->triangle_size = std::max(this->triangle_size, triangle_starts[num_elements]);
+        this->edges_size = std::max(this->edges_size, edge_starts[num_elements]);
+        this->label_size = std::max(this->label_size, num_elements + 10);
+        cl1 = cl2 = cl3 = label_size;
+
         verts = (double3*) realloc(verts, sizeof(double3) * vertex_size);
-				this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
-				this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
-				this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
-				this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
+        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
+        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
+        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
+        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
         tris_orders = (int*) realloc(tris_orders, sizeof(int) * triangle_size);
         info = NULL;
         this->empty = false;
@@ -143,66 +159,141 @@ namespace Hermes
         ltext = (char**) realloc(ltext, sizeof(char*) * label_size);
         lbox = (double2*) realloc(lbox, sizeof(double2) * label_size);
 
-        int oo, o[6];
-
-        RefMap refmap;
-        refmap.set_quad_2d(&quad_ord);
+        // the edges taken in each element slot, those not taken are squeezed out below
+        std::vector<char> edge_taken(edge_starts[num_elements], 0);
 
         // make a mesh illustrating the distribution of polynomial orders over the space
-        Element* e;
-        for_all_active_elements(e, mesh)
+        int element_i;
+#pragma omp parallel private(element_i) num_threads(Hermes2DApi.get_num_threads())
         {
-          oo = o[4] = o[5] = space->get_element_order(e->id);
-          for (unsigned int k = 0; k < e->get_nvert(); k++)
-            o[k] = space->get_edge_order(e, k);
-
-          refmap.set_active_element(e);
-          double* x = refmap.get_phys_x(type);
-          double* y = refmap.get_phys_y(type);
-
-          double3* pt = quad_ord.get_points(type, e->get_mode());
-          int np = quad_ord.get_num_points(type, e->get_mode());
-          int id[80];
-          assert(np <= 80);
+          RefMap refmap;
+          refmap.set_quad_2d(&quad_ord);
 
-          int mode = e->get_mode();
-          if(e->is_quad())
+#pragma omp for schedule(dynamic, 64)
+          for (element_i = 0; element_i < num_elements; element_i++)
           {
-            o[4] = H2D_GET_H_ORDER(oo);
-            o[5] = H2D_GET_V_ORDER(oo);
-          }
-          make_vert(lvert[label_count], x[0], y[0], o[4]);
+            Element* e = elements[element_i];
+            int oo, o[6];
+            oo = o[4] = o[5] = space->get_element_order(e->id);
+            for (unsigned int k = 0; k < e->get_nvert(); k++)
+              o[k] = space->get_edge_order(e, k);
+
+            refmap.set_active_element(e);
+            double* x = refmap.get_phys_x(type);
+            double* y = refmap.get_phys_y(type);
+
+            double3* pt = quad_ord.get_points(type, e->get_mode());
+            int np = quad_ord.get_num_points(type, e->get_mode());
+            int id[80];
+            assert(np <= 80);
+
+            int mode = e->get_mode();
+            if(e->is_quad())
+            {
+              o[4] = H2D_GET_H_ORDER(oo);
+              o[5] = H2D_GET_V_ORDER(oo);
+            }
+            int vertex_i = vertex_starts[element_i];
+            lvert[element_i] = vertex_i;
+            verts[vertex_i][0] = x[0];
+            verts[vertex_i][1] = y[0];
+            verts[vertex_i][2] = o[4];
 
-          for (int i = 1; i < np; i++)
-            make_vert(id[i-1], x[i], y[i], o[(int) pt[i][2]]);
+            for (int i = 1; i < np; i++)
+            {
+              id[i-1] = vertex_i + i;
+              verts[vertex_i + i][0] = x[i];
+              verts[vertex_i + i][1] = y[i];
+              verts[vertex_i + i][2] = o[(int) pt[i][2]];
+            }
 
-          for (int i = 0; i < num_elem[mode][type]; i++)
-            this->add_triangle(id[ord_elem[mode][type][i][0]], id[ord_elem[mode][type][i][1]], id[ord_elem[mode][type][i][2]], o[4], e->marker);
+            for (int i = 0; i < num_elem[mode][type]; i++)
+            {
+              int triangle_i = triangle_starts[element_i] + i;
+              for (int j = 0; j < 3; j++)
+                this->tris[triangle_i][j] = id[ord_elem[mode][type][i][j]];
+              tris_orders[triangle_i] = o[4];
+              this->tri_markers[triangle_i] = e->marker;
+            }
 
-          for (int i = 0; i < num_edge[mode][type]; i++)
-          {
-            if(e->en[ord_edge[mode][type][i][2]]->bnd || (y[ord_edge[mode][type][i][0] + 1] < y[ord_edge[mode][type][i][1] + 1]) ||
-              ((y[ord_edge[mode][type][i][0] + 1] == y[ord_edge[mode][type][i][1] + 1]) &&
-              (x[ord_edge[mode][type][i][0] + 1] < x[ord_edge[mode][type][i][1] + 1])))
+            for (int i = 0; i < num_edge[mode][type]; i++)
             {
-              LinearizerBase::add_edge(id[ord_edge[mode][type][i][0]], id[ord_edge[mode][type][i][1]], e->en[ord_edge[mode][type][i][2]]->marker);
+              if(e->en[ord_edge[mode][type][i][2]]->bnd || (y[ord_edge[mode][type][i][0] + 1] < y[ord_edge[mode][type][i][1] + 1]) ||
+                ((y[ord_edge[mode][type][i][0] + 1] == y[ord_edge[mode][type][i][1] + 1]) &&
+                (x[ord_edge[mode][type][i][0] + 1] < x[ord_edge[mode][type][i][1] + 1])))
+              {
+                int edge_i = edge_starts[element_i] + i;
+                this->edges[edge_i][0] = id[ord_edge[mode][type][i][0]];
+                this->edges[edge_i][1] = id[ord_edge[mode][type][i][1]];
+                this->edge_markers[edge_i] = e->en[ord_edge[mode][type][i][2]]->marker;
+                edge_taken[edge_i] = 1;
+              }
             }
-          }
 
-          double xmin = 1e100, ymin = 1e100, xmax = -1e100, ymax = -1e100;
-          for (unsigned int k = 0; k < e->get_nvert(); k++)
-          {
-            if(e->vn[k]->x < xmin) xmin = e->vn[k]->x;
-            if(e->vn[k]->x > xmax) xmax = e->vn[k]->x;
-            if(e->vn[k]->y < ymin) ymin = e->vn[k]->y;
-            if(e->vn[k]->y > ymax) ymax = e->vn[k]->y;
+            double xmin = 1e100, ymin = 1e100, xmax = -1e100, ymax = -1e100;
+            for (unsigned int k = 0; k < e->get_nvert(); k++)
+            {
+              if(e->vn[k]->x < xmin) xmin = e->vn[k]->x;
+              if(e->vn[k]->x > xmax) xmax = e->vn[k]->x;
+              if(e->vn[k]->y < ymin) ymin = e->vn[k]->y;
+              if(e->vn[k]->y > ymax) ymax = e->vn[k]->y;
+            }
+            lbox[element_i][0] = xmax - xmin;
+            lbox[element_i][1] = ymax - ymin;
+            ltext[element_i] = labels[o[4]][o[5]];
           }
-          lbox[label_count][0] = xmax - xmin;
-          lbox[label_count][1] = ymax - ymin;
-          ltext[label_count++] = labels[o[4]][o[5]];
+
+          refmap.set_quad_2d(&g_quad_2d_std);
+        }
+
+        vertex_count = vertex_starts[num_elements];
+        triangle_count = triangle_starts[num_elements];
+        label_count = num_elements;
+        for (int i = 0; i < edge_starts[num_elements]; i++)
+        {
+          if(!edge_taken[i])
+            continue;
+          this->edges[edges_count][0] = this->edges[i][0];
+          this->edges[edges_count][1] = this->edges[i][1];
+          this->edge_markers[edges_count++] = this->edge_markers[i];
+        }
+      }
+
+      template<typename Scalar>
+      void Orderizer::save_orders_binary(const Space<Scalar>* space, const char* file_name)
+      {
+        if(space == NULL) throw Hermes::Exceptions::Exception("Space is NULL in Orderizer:save_orders_binary().");
+        if(!space->is_up_to_date())
+          throw Hermes::Exceptions::Exception("The space is not up to date.");
+        const Mesh* mesh = space->get_mesh();
+        if(mesh == NULL)
+          throw Hermes::Exceptions::Exception("Mesh is NULL in Orderizer:save_orders_binary().");
+
+        std::vector<int> ids;
+        std::vector<int> orders;
+        ids.reserve(mesh->get_num_active_elements());
+        orders.reserve(2 * mesh->get_num_active_elements());
+        Element* e;
+        for_all_active_elements(e, mesh)
+        {
+          int order = space->get_element_order(e->id);
+          ids.push_back(e->id);
+          orders.push_back(e->is_quad() ? H2D_GET_H_ORDER(order) : order);
+          orders.push_back(e->is_quad() ? H2D_GET_V_ORDER(order) : order);
         }
 
-        refmap.set_quad_2d(&g_quad_2d_std);
+        FILE* f = fopen(file_name, "wb");
+        if(f == NULL) throw Hermes::Exceptions::Exception("Could not open %s for writing.", file_name);
+        int n = ids.size();
+        bool written = (fwrite(&n, sizeof(int), 1, f) == 1);
+        if(n > 0)
+        {
+          written = written && (fwrite(&ids[0], sizeof(int), n, f) == (size_t) n);
+          written = written && (fwrite(&orders[0], sizeof(int), 2 * n, f) == (size_t) (2 * n));
+        }
+        fclose(f);
+        if(!written)
+          throw Hermes::Exceptions::Exception("Could not write the element orders to %s.", file_name);
       }
 
       void Orderizer::add_triangle(int iv0, int iv1, int iv2, int order, int marker)
@@ -367,6 +458,64 @@ namespace Hermes
         fclose(f);
       }
 
+      template<typename Scalar>
+      void Orderizer::save_orders_vtu(const Space<Scalar>* space, const char* file_name, bool compress)
+      {
+        process_space(space);
+        lock_data();
+
+        std::vector<float> points(3 * this->vertex_count);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = 0.0f;
+        }
+
+        std::vector<int> connectivity(3 * this->triangle_count);
+        std::vector<VtuField> fields(1);
+        fields[0].name = "Mesh";
+        fields[0].num_components = 1;
+        fields[0].cell_data = true;
+        fields[0].values.resize(this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+        {
+          for (int j = 0; j < 3; j++)
+            connectivity[3 * i + j] = this->tris[i][j];
+          fields[0].values[i] = (float) this->tris_orders[i];
+        }
+        unlock_data();
+
+        // The triangle type of VTK is 5.
+        save_vtu(file_name, points, 3, 5, connectivity, fields, compress);
+      }
+
+      template<typename Scalar>
+      void Orderizer::save_mesh_vtu(const Space<Scalar>* space, const char* file_name, bool compress)
+      {
+        process_space(space);
+        lock_data();
+
+        std::vector<float> points(3 * this->vertex_count);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = 0.0f;
+        }
+
+        std::vector<int> connectivity(2 * this->edges_count);
+        for (int i = 0; i < this->edges_count; i++)
+        {
+          connectivity[2 * i] = this->edges[i][0];
+          connectivity[2 * i + 1] = this->edges[i][1];
+        }
+        unlock_data();
+
+        // The line type of VTK is 3.
+        save_vtu(file_name, points, 2, 3, connectivity, std::vector<VtuField>(), compress);
+      }
+
       int Orderizer::get_labels(int*& lvert, char**& ltext, double2*& lbox) const
       {
         lvert = this->lvert;
@@ -395,6 +544,12 @@ namespace Hermes
       template HERMES_API void Orderizer::save_orders_vtk<std::complex<double> >(const Space<std::complex<double> >* space, const char* file_name);
       template HERMES_API void Orderizer::save_mesh_vtk<double>(const Space<double>* space, const char* file_name);
       template HERMES_API void Orderizer::save_mesh_vtk<std::complex<double> >(const Space<std::complex<double> >* space, const char* file_name);
+      template HERMES_API void Orderizer::save_orders_vtu<double>(const Space<double>* space, const char* file_name, bool compress);
+      template HERMES_API void Orderizer::save_orders_vtu<std::complex<double> >(const Space<std::complex<double> >* space, const char* file_name, bool compress);
+      template HERMES_API void Orderizer::save_mesh_vtu<double>(const Space<double>* space, const char* file_name, bool compress);
+      template HERMES_API void Orderizer::save_mesh_vtu<std::complex<double> >(const Space<std::complex<double> >* space, const char* file_name, bool compress);
+      template HERMES_API void Orderizer::save_orders_binary<double>(const Space<double>* space, const char* file_name);
+      template HERMES_API void Orderizer::save_orders_binary<std::complex<double> >(const Space<std::complex<double> >* space, const char* file_name);
       template HERMES_API void Orderizer::process_space<double>(const Space<double>* space);
       template HERMES_API void Orderizer::process_space<std::complex<double> >(const Space<std::complex<double> >* space);
     }
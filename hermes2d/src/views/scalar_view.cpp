@@ -57,8 +57,11 @@ namespace Hermes
         edges_color[0] = 0.5f; edges_color[1] = 0.4f; edges_color[2] = 0.4f;
 
         show_values = true;
+        incremental_linearization = false;
         lin_updated = false;
-        gl_coord_buffer = 0; gl_index_buffer = 0; gl_edge_inx_buffer = 0;
+        gl_coord_buffer = 0; gl_index_buffer = 0; gl_edge_inx_buffer = 0; gl_contour_buffer = 0;
+        gl_edge_cnt = gl_marked_edge_cnt = gl_contour_vert_cnt = 0;
+        gl_contours_valid = false;
 
         do_zoom_to_fit = true;
         is_constant = false;
@@ -147,6 +150,17 @@ namespace Hermes
           glDeleteBuffersARB(1, &gl_index_buffer);
           gl_index_buffer = 0;
         }
+        if(gl_edge_inx_buffer != 0)
+        {
+          glDeleteBuffersARB(1, &gl_edge_inx_buffer);
+          gl_edge_inx_buffer = 0;
+        }
+        if(gl_contour_buffer != 0)
+        {
+          glDeleteBuffersARB(1, &gl_contour_buffer);
+          gl_contour_buffer = 0;
+        }
+        gl_contours_valid = false;
 
         //call of parent implementation
         View::on_close();
@@ -164,7 +178,10 @@ namespace Hermes
         lin->set_displacement(xdisp, ydisp, dmult);
         lin->lock_data();
 
-        lin->process_solution(sln, item, eps);
+        if(incremental_linearization)
+          lin->update_solution(sln, item, eps);
+        else
+          lin->process_solution(sln, item, eps);
 
         update_mesh_info();
 
@@ -603,7 +620,7 @@ namespace Hermes
         return y + 1.0;
       }
 
-      void ScalarView::draw_tri_contours(double3* vert, int3* tri)
+      void ScalarView::calc_tri_contours(double3* vert, int3* tri, std::vector<float>& lines)
       {
         // sort the vertices by their value, keep track of the permutation sign
         int i, idx[3], perm = 0;
@@ -646,8 +663,11 @@ namespace Hermes
             double x2 = (1.0 - rt) * vert[idx[r1]][0] + rt * vert[idx[r2]][0];
             double y2 = (1.0 - rt) * vert[idx[r1]][1] + rt * vert[idx[r2]][1];
 
-            if(perm & 1) { glVertex2d(x1, y1); glVertex2d(x2, y2); }
-            else { glVertex2d(x2, y2); glVertex2d(x1, y1); }
+            if(perm & 1) { std::swap(x1, x2); std::swap(y1, y2); }
+            lines.push_back((float)x2);
+            lines.push_back((float)y2);
+            lines.push_back((float)x1);
+            lines.push_back((float)y1);
 
             val += cont_step;
           }
@@ -658,9 +678,12 @@ namespace Hermes
 
       void ScalarView::prepare_gl_geometry()
       {
+        // The geometry is uploaded once per new linearization (show(), a change of the range), redraws (panning,
+        // zooming) only issue the draw calls.
         if(lin_updated)
         {
           lin_updated = false;
+          gl_contours_valid = false;
 
           try
           {
@@ -680,7 +703,7 @@ namespace Hermes
               if(gl_index_buffer == 0)
                 glGenBuffersARB(1, &gl_index_buffer);
               glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, gl_index_buffer);
-              glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLint) * tri_cnt * 3, NULL, GL_DYNAMIC_DRAW_ARB);
+              glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLint) * tri_cnt * 3, NULL, GL_STATIC_DRAW_ARB);
               GLenum err = glGetError();
               if(err != GL_NO_ERROR)
                 throw std::runtime_error("unable to allocate vertex buffer: " + err);
@@ -719,7 +742,7 @@ namespace Hermes
               if(gl_coord_buffer == 0)
                 glGenBuffersARB(1, &gl_coord_buffer);
               glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_coord_buffer);
-              glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(GLVertex2) * vert_cnt, NULL, GL_DYNAMIC_DRAW_ARB);
+              glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(GLVertex2) * vert_cnt, NULL, GL_STATIC_DRAW_ARB);
               GLenum err = glGetError();
               if(err != GL_NO_ERROR)
                 throw std::runtime_error("unable to allocate coord buffer: " + err);
@@ -738,19 +761,39 @@ namespace Hermes
               gl_verts[i] = GLVertex2((float)verts[i][0], (float)verts[i][1], (float)((verts[i][2] - range_min) * value_irange));
             glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
 
-            //allocate edge indices
-            if(gl_edge_inx_buffer == 0)
+            glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+
+            //fill edge indices: the edges with a nonzero marker first, so that either only them or all the edges are drawn by one call
+            int2* edges = lin->get_edges();
+            int* edge_markers = lin->get_edge_markers();
+            int edge_cnt = lin->get_num_edges();
+            std::vector<GLuint> edge_indices(2 * edge_cnt + 2);
+            gl_marked_edge_cnt = 0;
+            for(int pass = 0, pos = 0; pass < 2; pass++)
             {
-              glGenBuffersARB(1, &gl_edge_inx_buffer);
-              glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
-              glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(GLuint) * H2DV_GL_MAX_EDGE_BUFFER * 2, NULL, GL_DYNAMIC_DRAW_ARB);
-              GLenum err = glGetError();
-              if(err != GL_NO_ERROR) { //if it fails, no problem
-                glDeleteBuffersARB(1, &gl_edge_inx_buffer);
-                gl_edge_inx_buffer = 0;
+              for(int i = 0; i < edge_cnt; i++)
+              {
+                if((edge_markers[i] != 0) == (pass == 0))
+                {
+                  edge_indices[pos++] = (GLuint)edges[i][0];
+                  edge_indices[pos++] = (GLuint)edges[i][1];
+                }
               }
+              if(pass == 0)
+                gl_marked_edge_cnt = pos / 2;
             }
-            glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+            gl_edge_cnt = edge_cnt;
+
+            if(gl_edge_inx_buffer == 0)
+              glGenBuffersARB(1, &gl_edge_inx_buffer);
+            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
+            glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sizeof(GLuint) * 2 * edge_cnt, &edge_indices[0], GL_STATIC_DRAW_ARB);
+            GLenum err = glGetError();
+            if(err != GL_NO_ERROR) { //if it fails, no problem
+              glDeleteBuffersARB(1, &gl_edge_inx_buffer);
+              gl_edge_inx_buffer = 0;
+            }
+            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
           }
           catch(std::exception &e)
           { //out-of-memory or any other failure
@@ -836,56 +879,23 @@ namespace Hermes
       {
         glColor3fv(edges_color);
         bool displayed = false;
-        if(gl_edge_inx_buffer != 0) {//VBO
-          //prepage GL
-          glEnableClientState(GL_VERTEX_ARRAY);
-
-          //map edge buffer
-          glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
-          GLuint *gl_inx_buffer = (GLuint*)glMapBufferARB(GL_ARRAY_BUFFER_ARB, GL_WRITE_ONLY);
-          GLenum err = glGetError();
-          if(err == GL_NO_ERROR) {//render edges
-            unsigned int buffer_inx = 0;
-						int2* edges = lin->get_edges();
-            int* edge_markers = lin->get_edge_markers();
-            int edge_cnt = lin->get_num_edges();
-            for (int i = 0; i < edge_cnt; i++) //TODO: we could draw only left-right, top-bottom ones
-            {
-							const int2 &edge = edges[i];
-              const int &edge_marker = edge_markers[i];
-              if(show_edges || edge_marker != 0) { //select internal edges to draw
-                gl_inx_buffer[buffer_inx] = (GLuint)edge[0];
-                gl_inx_buffer[buffer_inx + 1] = (GLuint)edge[1];
-                buffer_inx += 2;
-              }
-
-              //render buffer if it is full or if this is the last edge processed
-              if(buffer_inx == (2*H2DV_GL_MAX_EDGE_BUFFER) || (buffer_inx > 0 && i == (edge_cnt-1)))
-              {
-                glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
-
-                //bind vertices and buffers
-                glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_coord_buffer);
-                glVertexPointer(2, GL_FLOAT, sizeof(GLVertex2), GL_BUFFER_OFFSET(0));
-                glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
-
-                //render
-                glDrawElements(GL_LINES, buffer_inx, GL_UNSIGNED_INT, GL_BUFFER_OFFSET(0));
+        if(gl_edge_inx_buffer != 0 && gl_coord_buffer != 0) {//VBO
+          int cnt = show_edges ? gl_edge_cnt : gl_marked_edge_cnt;
+          if(cnt > 0)
+          {
+            glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_coord_buffer);
+            glVertexPointer(2, GL_FLOAT, sizeof(GLVertex2), GL_BUFFER_OFFSET(0));
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
 
-                //map edge buffer
-                glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
-                glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_edge_inx_buffer);
-                gl_inx_buffer = (GLuint*)glMapBufferARB(GL_ARRAY_BUFFER_ARB, GL_WRITE_ONLY);
-                buffer_inx = 0;
-              }
-            }
-            glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+            glDrawElements(GL_LINES, 2 * cnt, GL_UNSIGNED_INT, GL_BUFFER_OFFSET(0));
 
             //GL cleanup
             glDisableClientState(GL_VERTEX_ARRAY);
-
-            displayed = true;
+            glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+            glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
           }
+          displayed = true;
         }
 
         //safe fallback
@@ -896,6 +906,65 @@ namespace Hermes
         }
       }
 
+      void ScalarView::prepare_gl_contours()
+      {
+        if(gl_contours_valid && gl_cont_step == cont_step && gl_cont_orig == cont_orig)
+          return;
+
+        // calculate the contours once, redraws reuse them until lin or the contour settings change
+        contour_lines.clear();
+        double3* vert = lin->get_vertices();
+        int3* tris = lin->get_contour_triangles();
+        for (int i = 0; i < lin->get_num_contour_triangles(); i++)
+        {
+          if(finite(vert[tris[i][0]][2]) && finite(vert[tris[i][1]][2]) && finite(vert[tris[i][2]][2]))
+            calc_tri_contours(vert, &tris[i], contour_lines);
+        }
+        gl_contour_vert_cnt = (int)contour_lines.size() / 2;
+        gl_cont_step = cont_step;
+        gl_cont_orig = cont_orig;
+        gl_contours_valid = true;
+
+        if(!GLEW_ARB_vertex_buffer_object || gl_contour_vert_cnt == 0)
+          return;
+        if(gl_contour_buffer == 0)
+          glGenBuffersARB(1, &gl_contour_buffer);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_contour_buffer);
+        glBufferDataARB(GL_ARRAY_BUFFER_ARB, sizeof(float) * contour_lines.size(), &contour_lines[0], GL_STATIC_DRAW_ARB);
+        GLenum err = glGetError();
+        if(err != GL_NO_ERROR) { //if it fails, the lines are drawn from the host memory
+          glDeleteBuffersARB(1, &gl_contour_buffer);
+          gl_contour_buffer = 0;
+        }
+        else //the lines are in the buffer
+          std::vector<float>().swap(contour_lines);
+        glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+      }
+
+      void ScalarView::draw_contours_2d()
+      {
+        prepare_gl_contours();
+        if(gl_contour_vert_cnt == 0)
+          return;
+
+        glColor3fv(cont_color);
+        if(gl_contour_buffer != 0)
+        {
+          glBindBufferARB(GL_ARRAY_BUFFER_ARB, gl_contour_buffer);
+          glVertexPointer(2, GL_FLOAT, 0, GL_BUFFER_OFFSET(0));
+        }
+        else
+          glVertexPointer(2, GL_FLOAT, 0, &contour_lines[0]);
+        glEnableClientState(GL_VERTEX_ARRAY);
+
+        glDrawArrays(GL_LINES, 0, gl_contour_vert_cnt);
+
+        //GL cleanup
+        glDisableClientState(GL_VERTEX_ARRAY);
+        if(gl_contour_buffer != 0)
+          glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+      }
+
       void ScalarView::draw_normals_3d()
       {
         double normal_xzscale = 1.0 / xzscale, normal_yscale = 1.0 / yscale;
@@ -1031,20 +1100,7 @@ namespace Hermes
           // draw contours
           glDisable(GL_TEXTURE_1D);
           if(contours)
-          {
-            tris = lin->get_contour_triangles();
-            glColor3fv(cont_color);
-            glBegin(GL_LINES);
-            for (i = 0; i < lin->get_num_contour_triangles(); i++)
-            {
-              if(finite(vert[tris[i][0]][2]) && finite(vert[tris[i][1]][2]) && finite(vert[tris[i][2]][2]))
-              {
-                draw_tri_contours(vert, &tris[i]);
-              }
-            }
-            tris = lin->get_triangles();
-            glEnd();
-          }
+            draw_contours_2d();
 
           // draw edges and boundary of mesh
           draw_edges_2d();
@@ -17,6 +17,8 @@
 #include <GL/freeglut.h>
 #include "global.h"
 #include "stream_view.h"
+#include "refmap.h"
+#include "api2d.h"
 
 namespace Hermes
 {
@@ -34,7 +36,10 @@ namespace Hermes
         root_y_min = 1e100;
         root_x_max = -1e100;
         root_y_max = -1e100;
-        root = NULL;
+        streamlines = NULL;
+        streamlength = NULL;
+        mesh = NULL;
+        mesh_seq = 0;
       }
 
       StreamView::StreamView(char* title, WinGeom* wg)
@@ -47,7 +52,10 @@ namespace Hermes
         root_y_min = 1e100;
         root_x_max = -1e100;
         root_y_max = -1e100;
-        root = NULL;
+        streamlines = NULL;
+        streamlength = NULL;
+        mesh = NULL;
+        mesh_seq = 0;
       }
 
       void StreamView::show(MeshFunction<double>* xsln, MeshFunction<double>* ysln, int marker, double step, double eps)
@@ -78,113 +86,96 @@ namespace Hermes
           return false;
       }
 
-      void StreamView::add_element_to_tree(Node* father, int e_idx, double x_min, double x_max, double y_min, double y_max)
+      void StreamView::build_triangle_index(const Mesh* mesh)
       {
+        this->mesh = mesh;
+        this->mesh_seq = mesh->get_seq();
+        // the index is built before the threads look the points up
+        mesh->get_element_locator();
+
         double4* vert = vec->get_vertices();
         int3* xtris = vec->get_triangles();
-        if(father->leaf == true)
+        int num_triangles = vec->get_num_triangles();
+
+        // the element of the center of each triangle, the triangles of the union mesh are inside of the elements
+        triangle_elements.resize(num_triangles);
+        int i;
+#pragma omp parallel for schedule(static) num_threads(Hermes2DApi.get_num_threads())
+        for (i = 0; i < num_triangles; i++)
         {
-          father->elements[father->num_elem++] = e_idx;
-          if(father->num_elem >= 100) // too many elements
-          {
-            father->leaf = false;
-            for (int k = 0; k < 2; k++)
-            {
-              father->sons[k] = new Node;
-              father->sons[k]->level = father->level + 1;
-              father->sons[k]->leaf = true;
-              father->sons[k]->num_elem = 0;
-            }
-            for (int i = 0; i < father->num_elem; i++)
-              add_element_to_tree(father, father->elements[i], x_min, x_max, y_min, y_max);
-          }
+          double x = (vert[xtris[i][0]][0] + vert[xtris[i][1]][0] + vert[xtris[i][2]][0]) / 3.0;
+          double y = (vert[xtris[i][0]][1] + vert[xtris[i][1]][1] + vert[xtris[i][2]][1]) / 3.0;
+          Element* e = RefMap::element_on_physical_coordinates(mesh, x, y);
+          triangle_elements[i] = (e == NULL) ? -1 : e->id;
         }
-        else
+
+        element_triangle_starts.assign(mesh->get_max_element_id() + 2, 0);
+        unassigned_triangles.clear();
+        for (i = 0; i < num_triangles; i++)
         {
-          double x_mid = (x_min + x_max)/2;
-          double y_mid = (y_min + y_max)/2;
-          int3& tri = xtris[e_idx];
-          if(father->level % 2) // level = 1, 3, 5, ...
-          {
-            if(vert[tri[0]][1] <= y_mid || vert[tri[1]][1] <= y_mid || vert[tri[2]][1] <= y_mid)
-              add_element_to_tree(father->sons[0], e_idx, x_min, x_max, y_min, y_mid);
-            if(vert[tri[0]][1] >= y_mid || vert[tri[1]][1] >= y_mid || vert[tri[2]][1] >= y_mid)
-              add_element_to_tree(father->sons[1], e_idx, x_min, x_max, y_mid, y_max);
-          }
-          else // level 0, 2, 4, ...
-          {
-            if(vert[tri[0]][0] <= x_mid || vert[tri[1]][0] <= x_mid || vert[tri[2]][0] <= x_mid)
-              add_element_to_tree(father->sons[0], e_idx, x_min, x_mid, y_min, y_max);
-            if(vert[tri[0]][0] >= x_mid || vert[tri[1]][0] >= x_mid || vert[tri[2]][0] >= x_mid)
-              add_element_to_tree(father->sons[1], e_idx, x_mid, x_max, y_min, y_max);
-          }
+          if(triangle_elements[i] >= 0)
+            element_triangle_starts[triangle_elements[i] + 1]++;
+          else
+            unassigned_triangles.push_back(i);
         }
+        for (unsigned int j = 1; j < element_triangle_starts.size(); j++)
+          element_triangle_starts[j] += element_triangle_starts[j - 1];
+        element_triangles.resize(element_triangle_starts.back());
+        std::vector<int> fill(element_triangle_starts.begin(), element_triangle_starts.end() - 1);
+        for (i = 0; i < num_triangles; i++)
+          if(triangle_elements[i] >= 0)
+            element_triangles[fill[triangle_elements[i]]++] = i;
       }
 
-      void StreamView::build_tree()
+      int StreamView::find_triangle(double x, double y, int& hint, double3& bar)
       {
-        root->leaf = true;
-        root->level = 0;
-        root->num_elem = 0;
-        for (int i = 0; i < vec->get_num_triangles(); i++)
+        // the triangle of the previous point, then the other triangles of its element
+        if(hint >= 0)
         {
-          add_element_to_tree(root, i, root_x_min, root_x_max, root_y_min, root_y_max);
+          if(is_in_triangle(hint, x, y, bar))
+            return hint;
+          int id = triangle_elements[hint];
+          if(id >= 0 && mesh_seq == mesh->get_seq())
+            for (int j = element_triangle_starts[id]; j < element_triangle_starts[id + 1]; j++)
+              if(is_in_triangle(element_triangles[j], x, y, bar))
+                return (hint = element_triangles[j]);
         }
-      }
 
-      int StreamView::find_triangle_in_tree(double x, double y, Node* father, double x_min, double x_max, double y_min, double y_max, double3& bar)
-      {
-        if(father->leaf == true)
+        if(mesh_seq == mesh->get_seq())
         {
-          double4* vert = vec->get_vertices();
-          int3* xtris = vec->get_triangles();
-          for (int idx = 0; idx < father->num_elem; idx++)
-          {
-            int i = father->elements[idx];
-            if(is_in_triangle(i, x, y, bar)) return i;
-          }
-          return -1;
+          // the element of the point from the spatial index of the mesh
+          Element* e = RefMap::element_on_physical_coordinates(mesh, x, y);
+          if(e != NULL)
+            for (int j = element_triangle_starts[e->id]; j < element_triangle_starts[e->id + 1]; j++)
+              if(is_in_triangle(element_triangles[j], x, y, bar))
+                return (hint = element_triangles[j]);
+          for (unsigned int j = 0; j < unassigned_triangles.size(); j++)
+            if(is_in_triangle(unassigned_triangles[j], x, y, bar))
+              return (hint = unassigned_triangles[j]);
         }
         else
         {
-          double x_mid = (x_max + x_min)/2;
-          double y_mid = (y_max + y_min)/2;
-          if(father->level % 2) // level = 1, 3, 5, ...
-            if(y <= y_mid)
-              return find_triangle_in_tree(x, y, father->sons[0], x_min, x_max, y_min, y_mid, bar);
-            else
-              return find_triangle_in_tree(x, y, father->sons[1], x_min, x_max, y_mid, y_max, bar);
-          else // level 0, 2, 4, ...
-            if(x <= x_mid)
-              return find_triangle_in_tree(x, y, father->sons[0], x_min, x_mid, y_min, y_max, bar);
-            else
-              return find_triangle_in_tree(x, y, father->sons[1], x_mid, x_max, y_min, y_max, bar);
+          // the mesh changed since show(), the element ids do not hold anymore
+          for (int i = 0; i < vec->get_num_triangles(); i++)
+            if(is_in_triangle(i, x, y, bar))
+              return (hint = i);
         }
+        return -1;
       }
 
-      bool StreamView::get_solution_values(double x, double y, double& xval, double& yval)
+      bool StreamView::get_solution_values(double x, double y, int& hint, double& xval, double& yval)
       {
         double4* vert = vec->get_vertices();
         int3* xtris = vec->get_triangles();
         double3 bar;
         int e_idx;
-        if((e_idx = find_triangle_in_tree(x, y, root, root_x_min, root_x_max, root_y_min, root_y_max, bar)) == -1) return false;
+        if((e_idx = find_triangle(x, y, hint, bar)) == -1) return false;
         int3& tri = xtris[e_idx];
         xval = bar[0] * vert[tri[0]][2] + bar[1] * vert[tri[1]][2] + bar[2] * vert[tri[2]][2];
         yval = bar[0] * vert[tri[0]][3] + bar[1] * vert[tri[1]][3] + bar[2] * vert[tri[2]][3];
         return true;
       }
 
-      void StreamView::delete_tree(Node* father)
-      {
-        if(father->leaf == false)
-        {
-          delete_tree(father->sons[0]);
-          delete_tree(father->sons[1]);
-        }
-        delete [] father;
-      }
-
       int StreamView::create_streamline(double x_start, double y_start, int idx)
       {
         double ODE_EPS = 1e-5;
@@ -197,6 +188,8 @@ namespace Hermes
         bool tau_ok = false;
         bool end = false;
         bool almost_end_of_domain = false;
+        // the triangle of the last evaluated point, the steps stay mostly in it or in its element
+        int hint = -1;
 
         double k1, k2, k3, k4, k5;
         double l1, l2, l3, l4, l5;
@@ -205,7 +198,7 @@ namespace Hermes
 
         while(1)
         {
-          if(get_solution_values(x, y, k1, l1) == false) // point (x, y) does not lie in the domain
+          if(get_solution_values(x, y, hint, k1, l1) == false) // point (x, y) does not lie in the domain
           {
             tau = tau/2;  // draw streamline to the end of the domain
             if(tau < min_tau) break;
@@ -230,13 +223,13 @@ namespace Hermes
 
             // Merson's adaptive Runge-Kutta method
             x1 = x + 1.0/3.0 * tau * k1; y1 = y + 1.0/3.0 * tau * l1;
-            if(get_solution_values(x1, y1, k2, l2) == false) {  almost_end_of_domain = true;  continue;  }
+            if(get_solution_values(x1, y1, hint, k2, l2) == false) {  almost_end_of_domain = true;  continue;  }
             x2 = x + 1.0/6.0 * tau * (k1 + k2); y2 = y + 1.0/6.0 * tau * (l1 + l2);
-            if(get_solution_values(x2, y2, k3, l3) == false) {  almost_end_of_domain = true;  continue;  }
+            if(get_solution_values(x2, y2, hint, k3, l3) == false) {  almost_end_of_domain = true;  continue;  }
             x3 = x + tau * (0.125 * k1 + 0.375 * k3); y3 = y + tau * (0.125 * l1 + 0.375 * l3);
-            if(get_solution_values(x3, y3, k4, l4) == false) {  almost_end_of_domain = true;  continue;  }
+            if(get_solution_values(x3, y3, hint, k4, l4) == false) {  almost_end_of_domain = true;  continue;  }
             x4 = x + tau * (0.5 * k1 - 1.5 * k3 + 2.0 * k4); y4 = y + tau * (0.5 * l1 - 1.5 * l3 + 2.0 * l4);
-            if(get_solution_values(x4, y4, k5, l5) == false) {  almost_end_of_domain = true;  continue;  }
+            if(get_solution_values(x4, y4, hint, k5, l5) == false) {  almost_end_of_domain = true;  continue;  }
             x5 = x + tau * 1.0/6.0 * (k1 + 4.0 * k4 + k5); y5 = y + tau * 1.0/6.0 * (l1 + 4.0 * l4 + l5);
 
             // error according to Merson
@@ -405,16 +398,18 @@ namespace Hermes
         max_mag = vec->get_max_value();
 
         this->tick();
-        root = new Node;
-        build_tree();
+        build_triangle_index(xsln->get_mesh());
 
         double2* initial_points;
         find_initial_points(marker, step, initial_points);
 
         streamlines = (double2**) malloc(sizeof(double2*) * (num_stream));
         streamlength = (int*) malloc(sizeof(int) * (num_stream));
-        for (int i = 0; i < num_stream; i++)
-          streamlength[i] =  create_streamline(initial_points[i][0], initial_points[i][1], i);
+        // the streamlines are independent, each of them is integrated by one thread
+        int i;
+#pragma omp parallel for schedule(dynamic, 1) num_threads(Hermes2DApi.get_num_threads())
+        for (i = 0; i < num_stream; i++)
+          streamlength[i] = create_streamline(initial_points[i][0], initial_points[i][1], i);
 
         delete [] initial_points;
 
@@ -429,7 +424,7 @@ namespace Hermes
 
       void StreamView::add_streamline(double x, double y)
       {
-        if(root == NULL)
+        if(mesh == NULL)
           throw Hermes::Exceptions::Exception("Function add_streamline must be called after StreamView::show().");
         this->tick();
         streamlines = (double2**) realloc(streamlines, sizeof(double2*) * (num_stream + 1));
@@ -607,11 +602,10 @@ namespace Hermes
 
       StreamView::~StreamView()
       {
-        delete_tree(root);
         for (int i = 0; i < num_stream; i++)
           delete [] streamlines[i];
-        delete [] streamlines;
-        delete [] streamlength;
+        ::free(streamlines);
+        ::free(streamlength);
         delete vec;
       }
     }
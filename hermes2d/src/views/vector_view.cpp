@@ -18,6 +18,7 @@
 #include <GL/freeglut.h>
 #include "global.h"
 #include "vector_view.h"
+#include "api2d.h"
 
 namespace Hermes
 {
@@ -36,6 +37,7 @@ namespace Hermes
         lines = false;
         pmode = false;
         length_coef = 1.0;
+        arrows_valid = false;
       }
 
       VectorView::VectorView(char* title, WinGeom* wg)
@@ -49,6 +51,7 @@ namespace Hermes
         lines = false;
         pmode = false;
         length_coef = 1.0;
+        arrows_valid = false;
       }
 
       VectorView::~VectorView()
@@ -84,6 +87,7 @@ namespace Hermes
           range_max = vec->get_max_value(); 
         }
         vec->calc_vertices_aabb(&vertices_min_x, &vertices_max_x, &vertices_min_y, &vertices_max_y);
+        arrows_valid = false;
         vec->unlock_data();
 
         create();
@@ -192,104 +196,21 @@ namespace Hermes
         }
       }
 
-      void VectorView::on_display()
+      void VectorView::calculate_arrows(double4* vert, double2* tvert, int3* xtris, int num_triangles)
       {
-        set_ortho_projection();
-        glDisable(GL_LIGHTING);
-        glDisable(GL_DEPTH_TEST);
-        glDisable(GL_TEXTURE_1D);
-        glPolygonMode(GL_FRONT_AND_BACK, pmode ? GL_LINE : GL_FILL);
-
         // initial grid point and grid step
         double gt = gs;
         if(hexa) gt *= sqrt(3.0)/2.0;
 
-        double max_length = 0.0;
-
-        // transform all vertices
-        vec->lock_data();
+        // The triangles are independent, the arrows of each thread are appended in the order of the threads.
+        int num_threads_used = Hermes2DApi.get_num_threads();
+        std::vector<std::vector<double> > arrows_per_thread(num_threads_used);
         int i;
-        int nv = vec->get_num_vertices();
-        double4* vert = vec->get_vertices();
-        double2* tvert = new double2[nv];
-
-        for (i = 0; i < nv; i++)
-        {
-          tvert[i][0] = transform_x(vert[i][0]);
-          tvert[i][1] = transform_y(vert[i][1]);
-
-          // find max length of vectors
-          double length = sqr(vert[i][2]) + sqr(vert[i][3]);
-          if(length > max_length) max_length = length;
-        }
-        max_length = sqrt(max_length);
-
-        // value range
-        double min = range_min, max = range_max;
-        if(range_auto) { min = vec->get_min_value(); max = vec->get_max_value(); }
-        double irange = 1.0 / (max - min);
-        // special case: constant solution
-        if(fabs(min - max) < 1e-8) { irange = 1.0; min -= 0.5; }
-
-        // draw all triangles
-        int3* xtris = vec->get_triangles();
-
-        if(mode != 1) glEnable(GL_TEXTURE_1D);
-        glBindTexture(GL_TEXTURE_1D, gl_pallete_tex_id);
-        glBegin(GL_TRIANGLES);
-        glColor3f(0.95f, 0.95f, 0.95f);
-        for (i = 0; i < vec->get_num_triangles(); i++)
+#pragma omp parallel private(i) num_threads(num_threads_used)
         {
-          double mag = sqrt(sqr(vert[xtris[i][0]][2]) + sqr(vert[xtris[i][0]][3]));
-          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
-          glVertex2d(tvert[xtris[i][0]][0], tvert[xtris[i][0]][1]);
-
-          mag = sqrt(sqr(vert[xtris[i][1]][2]) + sqr(vert[xtris[i][1]][3]));
-          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
-          glVertex2d(tvert[xtris[i][1]][0], tvert[xtris[i][1]][1]);
-
-          mag = sqrt(sqr(vert[xtris[i][2]][2]) + sqr(vert[xtris[i][2]][3]));
-          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
-          glVertex2d(tvert[xtris[i][2]][0], tvert[xtris[i][2]][1]);
-        }
-        glEnd();
-        glDisable(GL_TEXTURE_1D);
-
-        // draw all edges
-        /*if(mode == 0) glColor3f(0.3, 0.3, 0.3);
-        else*/ glColor3f(0.5, 0.5, 0.5);
-        glBegin(GL_LINES);
-        int2* edges = vec->get_edges();
-        for (i = 0; i < vec->get_num_edges(); i++)
-        {
-          if(lines || edges[i][2] != 0)
-          {
-            glVertex2d(tvert[edges[i][0]][0], tvert[edges[i][0]][1]);
-            glVertex2d(tvert[edges[i][1]][0], tvert[edges[i][1]][1]);
-          }
-        }
-        glEnd();
-
-        // draw dashed edges
-        if(lines)
-        {
-          glEnable(GL_LINE_STIPPLE);
-          glLineStipple(1, 0xCCCC);
-          glBegin(GL_LINES);
-          int2* dashes = vec->get_dashes();
-          for (i = 0; i < vec->get_num_dashes(); i++)
-          {
-            glVertex2d(tvert[dashes[i][0]][0], tvert[dashes[i][0]][1]);
-            glVertex2d(tvert[dashes[i][1]][0], tvert[dashes[i][1]][1]);
-          }
-          glEnd();
-          glDisable(GL_LINE_STIPPLE);
-        }
-
-        // draw arrows
-        if(mode != 2)
-        {
-          for (i = 0; i < vec->get_num_triangles(); i++)
+          std::vector<double>& thread_arrows = arrows_per_thread[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+          for (i = 0; i < num_triangles; i++)
           {
             double miny = 1e100;
             int idx = -1, k, l1, l2, r2, r1, s;
@@ -372,7 +293,10 @@ namespace Hermes
                   // plot the arrow
                   xval = -a[0]*x - b[0]*lry - d[0];
                   yval = -a[1]*x - b[1]*lry - d[1];
-                  plot_arrow(x, lry, xval, yval, max, min, gs);
+                  thread_arrows.push_back(x);
+                  thread_arrows.push_back(lry);
+                  thread_arrows.push_back(xval);
+                  thread_arrows.push_back(yval);
                   x += gs;
                 }
                 // move to the next line
@@ -397,6 +321,115 @@ namespace Hermes
           }
         }
 
+        arrows.clear();
+        for (int t = 0; t < num_threads_used; t++)
+          arrows.insert(arrows.end(), arrows_per_thread[t].begin(), arrows_per_thread[t].end());
+      }
+
+      void VectorView::on_display()
+      {
+        set_ortho_projection();
+        glDisable(GL_LIGHTING);
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_TEXTURE_1D);
+        glPolygonMode(GL_FRONT_AND_BACK, pmode ? GL_LINE : GL_FILL);
+
+        double max_length = 0.0;
+
+        // transform all vertices
+        vec->lock_data();
+        int i;
+        int nv = vec->get_num_vertices();
+        double4* vert = vec->get_vertices();
+        double2* tvert = new double2[nv];
+
+        for (i = 0; i < nv; i++)
+        {
+          tvert[i][0] = transform_x(vert[i][0]);
+          tvert[i][1] = transform_y(vert[i][1]);
+
+          // find max length of vectors
+          double length = sqr(vert[i][2]) + sqr(vert[i][3]);
+          if(length > max_length) max_length = length;
+        }
+        max_length = sqrt(max_length);
+
+        // value range
+        double min = range_min, max = range_max;
+        if(range_auto) { min = vec->get_min_value(); max = vec->get_max_value(); }
+        double irange = 1.0 / (max - min);
+        // special case: constant solution
+        if(fabs(min - max) < 1e-8) { irange = 1.0; min -= 0.5; }
+
+        // draw all triangles
+        int3* xtris = vec->get_triangles();
+
+        if(mode != 1) glEnable(GL_TEXTURE_1D);
+        glBindTexture(GL_TEXTURE_1D, gl_pallete_tex_id);
+        glBegin(GL_TRIANGLES);
+        glColor3f(0.95f, 0.95f, 0.95f);
+        for (i = 0; i < vec->get_num_triangles(); i++)
+        {
+          double mag = sqrt(sqr(vert[xtris[i][0]][2]) + sqr(vert[xtris[i][0]][3]));
+          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
+          glVertex2d(tvert[xtris[i][0]][0], tvert[xtris[i][0]][1]);
+
+          mag = sqrt(sqr(vert[xtris[i][1]][2]) + sqr(vert[xtris[i][1]][3]));
+          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
+          glVertex2d(tvert[xtris[i][1]][0], tvert[xtris[i][1]][1]);
+
+          mag = sqrt(sqr(vert[xtris[i][2]][2]) + sqr(vert[xtris[i][2]][3]));
+          glTexCoord2d((mag -min) * irange * tex_scale + tex_shift, 0.0);
+          glVertex2d(tvert[xtris[i][2]][0], tvert[xtris[i][2]][1]);
+        }
+        glEnd();
+        glDisable(GL_TEXTURE_1D);
+
+        // draw all edges
+        /*if(mode == 0) glColor3f(0.3, 0.3, 0.3);
+        else*/ glColor3f(0.5, 0.5, 0.5);
+        glBegin(GL_LINES);
+        int2* edges = vec->get_edges();
+        for (i = 0; i < vec->get_num_edges(); i++)
+        {
+          if(lines || edges[i][2] != 0)
+          {
+            glVertex2d(tvert[edges[i][0]][0], tvert[edges[i][0]][1]);
+            glVertex2d(tvert[edges[i][1]][0], tvert[edges[i][1]][1]);
+          }
+        }
+        glEnd();
+
+        // draw dashed edges
+        if(lines)
+        {
+          glEnable(GL_LINE_STIPPLE);
+          glLineStipple(1, 0xCCCC);
+          glBegin(GL_LINES);
+          int2* dashes = vec->get_dashes();
+          for (i = 0; i < vec->get_num_dashes(); i++)
+          {
+            glVertex2d(tvert[dashes[i][0]][0], tvert[dashes[i][0]][1]);
+            glVertex2d(tvert[dashes[i][1]][0], tvert[dashes[i][1]][1]);
+          }
+          glEnd();
+          glDisable(GL_LINE_STIPPLE);
+        }
+
+        // draw arrows
+        if(mode != 2)
+        {
+          double key[11] = { scale, trans_x, trans_y, center_x, center_y, gx, gy, gs, hexa ? 1.0 : 0.0, (double) output_width, (double) output_height };
+          if(!arrows_valid || memcmp(key, arrows_key, sizeof(key)))
+          {
+            calculate_arrows(vert, tvert, xtris, vec->get_num_triangles());
+            memcpy(arrows_key, key, sizeof(key));
+            arrows_valid = true;
+          }
+          for (unsigned int j = 0; j < arrows.size(); j += 4)
+            plot_arrow(arrows[j], arrows[j + 1], arrows[j + 2], arrows[j + 3], max, min, gs);
+        }
+
         delete [] tvert;
         vec->unlock_data();
       }
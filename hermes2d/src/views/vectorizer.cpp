@@ -41,52 +41,292 @@ namespace Hermes
         ydisp = NULL;
       }
 
-      int Vectorizer::get_vertex(int p1, int p2, double x, double y, double xvalue, double yvalue)
+      Vectorizer::ThreadData::ThreadData() : verts(NULL), info(NULL), hash_table(NULL), keys(NULL), vertex_count(0), vertex_size(0),
+        tris(NULL), tri_markers(NULL), triangle_count(0), triangle_size(0), edges(NULL), edge_markers(NULL), edges_count(0), edges_size(0), max(-1e100)
       {
-        // search for an existing vertex
+      }
+
+      Vectorizer::ThreadData::~ThreadData()
+      {
+        ::free(verts);
+        ::free(info);
+        ::free(hash_table);
+        ::free(keys);
+        ::free(tris);
+        ::free(tri_markers);
+        ::free(edges);
+        ::free(edge_markers);
+      }
+
+      void Vectorizer::ThreadData::init(int vertex_size, int triangle_size, int edges_size)
+      {
+        // a power of two, for the hash
+        this->vertex_size = 1024;
+        while(this->vertex_size < vertex_size)
+          this->vertex_size *= 2;
+        this->triangle_size = std::max(triangle_size, 1024);
+        this->edges_size = std::max(edges_size, 1024);
+
+        verts = (double4*) malloc(sizeof(double4) * this->vertex_size);
+        info = (int4*) malloc(sizeof(int4) * this->vertex_size);
+        keys = (uint64_t*) malloc(sizeof(uint64_t) * this->vertex_size);
+        hash_table = (int*) malloc(sizeof(int) * this->vertex_size);
+        memset(hash_table, 0xff, sizeof(int) * this->vertex_size);
+        tris = (int3*) malloc(sizeof(int3) * this->triangle_size);
+        tri_markers = (int*) malloc(sizeof(int) * this->triangle_size);
+        edges = (int2*) malloc(sizeof(int2) * this->edges_size);
+        edge_markers = (int*) malloc(sizeof(int) * this->edges_size);
+      }
+
+      int Vectorizer::get_vertex(ThreadData* td, int p1, int p2, double x, double y, double xvalue, double yvalue)
+      {
+        // search for an existing vertex of the thread
         if(p1 > p2) std::swap(p1, p2);
-        int index = this->hash(p1, p2);
-        int i = 0;
-        if(index < this->vertex_count)
+        int index = vertex_hash(p1, p2, td->vertex_size);
+        int i = td->hash_table[index];
+        while (i >= 0)
         {
-          i = this->hash_table[index];
-          while (i >= 0 && i < this->vertex_count)
-          {
-            if(this->info[i][0] == p1 && this->info[i][1] == p2)
-              return i;
-            // note that we won't return a vertex with a different value than the required one;
-            // this takes care for discontinuities in the solution, where more vertices
-            // with different values will be created
-            i = info[i][2];
-          }
+          if(td->info[i][0] == p1 && td->info[i][1] == p2)
+            return i;
+          i = td->info[i][2];
         }
 
         // if not found, create a new one
-#pragma omp critical(realloc_vertices)
         try
         {
-          i = add_vertex();
+          i = add_vertex(td);
         }
         catch(std::exception& e)
         {
+#pragma omp critical(vectorizer_exception)
           if(this->caughtException == NULL)
             this->caughtException = new Hermes::Exceptions::Exception(e.what());
         }
-        if(this->caughtException != NULL)
-        {
+        if(i < 0)
           return -1;
-        }
-        verts[i][0] = x;
-        verts[i][1] = y;
-        verts[i][2] = xvalue;
-        verts[i][3] = yvalue;
-        this->info[i][0] = p1;
-        this->info[i][1] = p2;
-        this->info[i][2] = this->hash_table[index];
-        this->hash_table[index] = i;
+
+        // the size may have changed
+        index = vertex_hash(p1, p2, td->vertex_size);
+        td->verts[i][0] = x;
+        td->verts[i][1] = y;
+        td->verts[i][2] = xvalue;
+        td->verts[i][3] = yvalue;
+        td->keys[i] = vertex_key(td->keys, p1, p2);
+        td->info[i][0] = p1;
+        td->info[i][1] = p2;
+        td->info[i][2] = td->hash_table[index];
+        td->hash_table[index] = i;
         return i;
       }
 
+      int Vectorizer::add_vertex(ThreadData* td)
+      {
+        if(td->vertex_count >= td->vertex_size)
+        {
+          td->vertex_size *= 2;
+          double4* new_verts = (double4*) realloc(td->verts, sizeof(double4) * td->vertex_size);
+          int4* new_info = (int4*) realloc(td->info, sizeof(int4) * td->vertex_size);
+          uint64_t* new_keys = (uint64_t*) realloc(td->keys, sizeof(uint64_t) * td->vertex_size);
+          int* new_hash_table = (int*) realloc(td->hash_table, sizeof(int) * td->vertex_size);
+          if(new_verts != NULL) td->verts = new_verts;
+          if(new_info != NULL) td->info = new_info;
+          if(new_keys != NULL) td->keys = new_keys;
+          if(new_hash_table != NULL) td->hash_table = new_hash_table;
+          if(new_verts == NULL || new_info == NULL || new_keys == NULL || new_hash_table == NULL)
+            throw Hermes::Exceptions::Exception("Out of memory in Vectorizer::process_solution.");
+
+          // the hash depends on the size, rehash the vertices
+          memset(td->hash_table, 0xff, sizeof(int) * td->vertex_size);
+          for (int i = 0; i < td->vertex_count; i++)
+          {
+            int index = vertex_hash(td->info[i][0], td->info[i][1], td->vertex_size);
+            td->info[i][2] = td->hash_table[index];
+            td->hash_table[index] = i;
+          }
+        }
+        return td->vertex_count++;
+      }
+
+      int Vectorizer::peek_vertex(ThreadData* td, int p1, int p2)
+      {
+        // search for a vertex of the thread with parents p1, p2
+        if(p1 > p2) std::swap(p1, p2);
+        int i = td->hash_table[vertex_hash(p1, p2, td->vertex_size)];
+        while (i >= 0)
+        {
+          if(td->info[i][0] == p1 && td->info[i][1] == p2) return i;
+          i = td->info[i][2];
+        }
+        return -1;
+      }
+
+      void Vectorizer::process_edge(ThreadData* td, int iv1, int iv2, int marker)
+      {
+        int mid = peek_vertex(td, iv1, iv2);
+        if(mid != -1)
+        {
+          process_edge(td, iv1, mid, marker);
+          process_edge(td, mid, iv2, marker);
+        }
+        else
+        {
+          if(td->edges_count >= td->edges_size)
+          {
+            td->edges_size *= 2;
+            td->edges = (int2*) realloc(td->edges, sizeof(int2) * td->edges_size);
+            td->edge_markers = (int*) realloc(td->edge_markers, sizeof(int) * td->edges_size);
+          }
+          td->edges[td->edges_count][0] = iv1;
+          td->edges[td->edges_count][1] = iv2;
+          td->edge_markers[td->edges_count++] = marker;
+        }
+      }
+
+      void Vectorizer::add_triangle(ThreadData* td, int iv0, int iv1, int iv2, int marker)
+      {
+        if(td->triangle_count >= td->triangle_size)
+        {
+          td->triangle_size *= 2;
+          td->tris = (int3*) realloc(td->tris, sizeof(int3) * td->triangle_size);
+          td->tri_markers = (int*) realloc(td->tri_markers, sizeof(int) * td->triangle_size);
+        }
+        td->tris[td->triangle_count][0] = iv0;
+        td->tris[td->triangle_count][1] = iv1;
+        td->tris[td->triangle_count][2] = iv2;
+        td->tri_markers[td->triangle_count++] = marker;
+      }
+
+      void Vectorizer::merge_thread_data(ThreadData* thread_data, int num_threads)
+      {
+        // the offsets of the threads in the concatenation of their vertices, triangles and edges
+        std::vector<int> vertex_offsets(num_threads + 1, 0), triangle_offsets(num_threads + 1, 0), edge_offsets(num_threads + 1, 0);
+        for (int t = 0; t < num_threads; t++)
+        {
+          vertex_offsets[t + 1] = vertex_offsets[t] + thread_data[t].vertex_count;
+          triangle_offsets[t + 1] = triangle_offsets[t] + thread_data[t].triangle_count;
+          edge_offsets[t + 1] = edge_offsets[t] + thread_data[t].edges_count;
+          this->max = std::max(this->max, thread_data[t].max);
+        }
+        int num_vertices = vertex_offsets[num_threads];
+
+        // the concatenated vertices, and the thread of each
+        std::vector<uint64_t> keys(num_vertices);
+        std::vector<int> vertex_thread(num_vertices);
+        for (int t = 0; t < num_threads; t++)
+          for (int i = 0; i < thread_data[t].vertex_count; i++)
+          {
+            keys[vertex_offsets[t] + i] = thread_data[t].keys[i];
+            vertex_thread[vertex_offsets[t] + i] = t;
+          }
+
+        // The duplicates (the same key and coordinates, from more threads) are found in buckets of the keys, in parallel;
+        // as in get_vertex(), the values do not matter. The first of the duplicates represents them all.
+        int num_buckets = std::max(1, num_vertices / 4);
+        std::vector<int> bucket_starts(num_buckets + 1, 0);
+        std::vector<int> bucket_vertices(num_vertices);
+        for (int g = 0; g < num_vertices; g++)
+          bucket_starts[(int) (keys[g] % num_buckets) + 1]++;
+        for (int b = 0; b < num_buckets; b++)
+          bucket_starts[b + 1] += bucket_starts[b];
+        {
+          std::vector<int> bucket_fill(bucket_starts.begin(), bucket_starts.end() - 1);
+          for (int g = 0; g < num_vertices; g++)
+            bucket_vertices[bucket_fill[(int) (keys[g] % num_buckets)]++] = g;
+        }
+
+        std::vector<int> representative(num_vertices);
+        int bucket_i;
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(num_threads)
+        for (bucket_i = 0; bucket_i < num_buckets; bucket_i++)
+        {
+          for (int j = bucket_starts[bucket_i]; j < bucket_starts[bucket_i + 1]; j++)
+          {
+            int g = bucket_vertices[j];
+            double* vertex = thread_data[vertex_thread[g]].verts[g - vertex_offsets[vertex_thread[g]]];
+            representative[g] = g;
+            for (int k = bucket_starts[bucket_i]; k < j; k++)
+            {
+              int h = bucket_vertices[k];
+              if(representative[h] != h || keys[h] != keys[g])
+                continue;
+              double* other = thread_data[vertex_thread[h]].verts[h - vertex_offsets[vertex_thread[h]]];
+              if((fabs(vertex[0] - other[0]) < 1e-8) && (fabs(vertex[1] - other[1]) < 1e-8))
+              {
+                representative[g] = h;
+                break;
+              }
+            }
+          }
+        }
+
+        // the indices of the vertices of this instance
+        std::vector<int> new_index(num_vertices);
+        this->vertex_count = 0;
+        for (int g = 0; g < num_vertices; g++)
+          new_index[g] = (representative[g] == g) ? this->vertex_count++ : new_index[representative[g]];
+
+        // the vertices and their hash table, for the regularization
+        this->vertex_size = 1024;
+        while(this->vertex_size < this->vertex_count)
+          this->vertex_size *= 2;
+        this->verts = (double4*) realloc(this->verts, sizeof(double4) * this->vertex_size);
+        this->info = (int4*) realloc(this->info, sizeof(int4) * this->vertex_size);
+        this->hash_table = (int*) realloc(this->hash_table, sizeof(int) * this->vertex_size);
+        memset(this->hash_table, 0xff, sizeof(int) * this->vertex_size);
+        for (int g = 0; g < num_vertices; g++)
+        {
+          if(representative[g] != g)
+            continue;
+          int t = vertex_thread[g];
+          int local = g - vertex_offsets[t];
+          int i = new_index[g];
+          memcpy(this->verts[i], thread_data[t].verts[local], sizeof(double4));
+
+          // the parents in this instance (the negative ids of the mesh vertices stay)
+          int p1 = thread_data[t].info[local][0], p2 = thread_data[t].info[local][1];
+          if(p1 != p2)
+          {
+            p1 = new_index[vertex_offsets[t] + p1];
+            p2 = new_index[vertex_offsets[t] + p2];
+            if(p1 > p2) std::swap(p1, p2);
+          }
+          int index = this->hash(p1, p2);
+          this->info[i][0] = p1;
+          this->info[i][1] = p2;
+          this->info[i][2] = this->hash_table[index];
+          this->hash_table[index] = i;
+        }
+
+        // the triangles and edges
+        this->triangle_count = triangle_offsets[num_threads];
+        this->edges_count = edge_offsets[num_threads];
+        this->triangle_size = std::max(this->triangle_size, this->triangle_count);
+        this->edges_size = std::max(this->edges_size, this->edges_count);
+        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
+        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
+        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
+        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
+
+        int t;
+#pragma omp parallel for schedule(static, 1) num_threads(num_threads)
+        for (t = 0; t < num_threads; t++)
+        {
+          const int* thread_index = new_index.empty() ? NULL : &new_index[0] + vertex_offsets[t];
+          for (int i = 0; i < thread_data[t].triangle_count; i++)
+          {
+            for (int j = 0; j < 3; j++)
+              this->tris[triangle_offsets[t] + i][j] = thread_index[thread_data[t].tris[i][j]];
+            this->tri_markers[triangle_offsets[t] + i] = thread_data[t].tri_markers[i];
+          }
+          for (int i = 0; i < thread_data[t].edges_count; i++)
+          {
+            for (int j = 0; j < 2; j++)
+              this->edges[edge_offsets[t] + i][j] = thread_index[thread_data[t].edges[i][j]];
+            this->edge_markers[edge_offsets[t] + i] = thread_data[t].edge_markers[i];
+          }
+        }
+      }
+
       void Vectorizer::set_displacement(MeshFunction<double>* xdisp, MeshFunction<double>* ydisp, double dmult)
       {
         this->xdisp = xdisp;
@@ -135,7 +375,7 @@ namespace Hermes
         }
       }
 
-      void Vectorizer::process_triangle(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
+      void Vectorizer::process_triangle(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int level,
         double* xval, double* yval, double* phx, double* phy, int* idx, bool curved)
       {
         double midval[4][3];
@@ -153,9 +393,8 @@ namespace Hermes
             for (i = 0; i < lin_np_tri[1]; i++)
             {
               double m = (sqrt(sqr(xval[i]) + sqr(yval[i])));
-#pragma omp critical(max)
-              if(finite(m) && fabs(m) > max)
-                max = fabs(m);
+              if(finite(m) && fabs(m) > td->max)
+                td->max = fabs(m);
             }
 
             idx = tri_indices[0];
@@ -191,9 +430,9 @@ namespace Hermes
           // obtain linearized values and coordinates at the midpoints
           for (i = 0; i < 4; i++)
           {
-            midval[i][0] = (verts[iv0][i] + verts[iv1][i])*0.5;
-            midval[i][1] = (verts[iv1][i] + verts[iv2][i])*0.5;
-            midval[i][2] = (verts[iv2][i] + verts[iv0][i])*0.5;
+            midval[i][0] = (td->verts[iv0][i] + td->verts[iv1][i])*0.5;
+            midval[i][1] = (td->verts[iv1][i] + td->verts[iv2][i])*0.5;
+            midval[i][2] = (td->verts[iv2][i] + td->verts[iv0][i])*0.5;
           };
 
           // determine whether or not to split the element
@@ -209,7 +448,7 @@ namespace Hermes
             double err = fabs(sqrt(sqr(xval[idx[0]]) + sqr(yval[idx[0]])) - sqrt(sqr(midval[2][0]) + sqr(midval[3][0]))) +
               fabs(sqrt(sqr(xval[idx[1]]) + sqr(yval[idx[1]])) - sqrt(sqr(midval[2][1]) + sqr(midval[3][1]))) +
               fabs(sqrt(sqr(xval[idx[2]]) + sqr(yval[idx[2]])) - sqrt(sqr(midval[2][2]) + sqr(midval[3][2])));
-            split = !finite(err) || err > max*3*eps;
+            split = !finite(err) || err > td->max*3*eps;
 
 
             // do the same for the curvature
@@ -228,7 +467,7 @@ namespace Hermes
             {
               split = (fabs(sqrt(sqr(xval[8]) + sqr(yval[8])) - 0.5*(sqrt(sqr(midval[2][0]) + sqr(midval[3][0])) + sqrt(sqr(midval[2][1]) + sqr(midval[3][1])))) +
                 fabs(sqrt(sqr(xval[9]) + sqr(yval[9])) - 0.5*(sqrt(sqr(midval[2][1]) + sqr(midval[3][1])) + sqrt(sqr(midval[2][2]) + sqr(midval[3][2])))) +
-                fabs(sqrt(sqr(xval[4]) + sqr(yval[4])) - 0.5*(sqrt(sqr(midval[2][2]) + sqr(midval[3][2])) + sqrt(sqr(midval[2][0]) + sqr(midval[3][0]))))) > max*3*eps;
+                fabs(sqrt(sqr(xval[4]) + sqr(yval[4])) - 0.5*(sqrt(sqr(midval[2][2]) + sqr(midval[3][2])) + sqrt(sqr(midval[2][0]) + sqr(midval[3][0]))))) > td->max*3*eps;
             }
           }
 
@@ -243,28 +482,28 @@ namespace Hermes
               }
 
               // obtain mid-edge vertices
-              int mid0 = get_vertex(iv0, iv1, midval[0][0], midval[1][0], xval[idx[0]], yval[idx[0]]);
-              int mid1 = get_vertex(iv1, iv2, midval[0][1], midval[1][1], xval[idx[1]], yval[idx[1]]);
-              int mid2 = get_vertex(iv2, iv0, midval[0][2], midval[1][2], xval[idx[2]], yval[idx[2]]);
+              int mid0 = get_vertex(td, iv0, iv1, midval[0][0], midval[1][0], xval[idx[0]], yval[idx[0]]);
+              int mid1 = get_vertex(td, iv1, iv2, midval[0][1], midval[1][1], xval[idx[1]], yval[idx[1]]);
+              int mid2 = get_vertex(td, iv2, iv0, midval[0][2], midval[1][2], xval[idx[2]], yval[idx[2]]);
 
               if(this->caughtException != NULL)
                 return;
 
               // recur to sub-elements
               this->push_transforms(fns, 0);
-              process_triangle(fns, iv0, mid0, mid2,  level + 1, xval, yval, phx, phy, tri_indices[1], curved);
+              process_triangle(td, fns, iv0, mid0, mid2,  level + 1, xval, yval, phx, phy, tri_indices[1], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 1);
-              process_triangle(fns, mid0, iv1, mid1,  level + 1, xval, yval, phx, phy, tri_indices[2], curved);
+              process_triangle(td, fns, mid0, iv1, mid1,  level + 1, xval, yval, phx, phy, tri_indices[2], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 2);
-              process_triangle(fns, mid2, mid1, iv2,  level + 1, xval, yval, phx, phy, tri_indices[3], curved);
+              process_triangle(td, fns, mid2, mid1, iv2,  level + 1, xval, yval, phx, phy, tri_indices[3], curved);
               this->pop_transforms(fns);
 
               this->push_transforms(fns, 3);
-              process_triangle(fns, mid1, mid2, mid0, level + 1, xval, yval, phx, phy, tri_indices[4], curved);
+              process_triangle(td, fns, mid1, mid2, mid0, level + 1, xval, yval, phx, phy, tri_indices[4], curved);
               this->pop_transforms(fns);
 
               return;
@@ -272,18 +511,18 @@ namespace Hermes
         }
 
         // no splitting: output a linear triangle
-        add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+        add_triangle(td, iv0, iv1, iv2, fns[0]->get_active_element()->marker);
       }
 
-      void Vectorizer::process_quad(MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
+      void Vectorizer::process_quad(ThreadData* td, MeshFunction<double>** fns, int iv0, int iv1, int iv2, int iv3, int level,
         double* xval, double* yval, double* phx, double* phy, int* idx, bool curved)
       {
         double midval[4][5];
 
         // try not to split through the vertex with the largest value
-        int a = (sqr(verts[iv1][2]) + sqr(verts[iv1][3]) > sqr(verts[iv0][2]) + sqr(verts[iv0][3])) ? iv0 : iv1;
-        int b = (sqr(verts[iv2][2]) + sqr(verts[iv2][3]) > sqr(verts[iv3][2]) + sqr(verts[iv3][3])) ? iv2 : iv3;
-        a = (sqr(verts[a][2]) + sqr(verts[a][3]) > sqr(verts[b][2]) + sqr(verts[b][3])) ? a : b;
+        int a = (sqr(td->verts[iv1][2]) + sqr(td->verts[iv1][3]) > sqr(td->verts[iv0][2]) + sqr(td->verts[iv0][3])) ? iv0 : iv1;
+        int b = (sqr(td->verts[iv2][2]) + sqr(td->verts[iv2][3]) > sqr(td->verts[iv3][2]) + sqr(td->verts[iv3][3])) ? iv2 : iv3;
+        a = (sqr(td->verts[a][2]) + sqr(td->verts[a][3]) > sqr(td->verts[b][2]) + sqr(td->verts[b][3])) ? a : b;
         int flip = (a == iv1 || a == iv3) ? 1 : 0;
 
         if(level < LIN_MAX_LEVEL)
@@ -299,15 +538,13 @@ namespace Hermes
             for (i = 0; i < lin_np_quad[1]; i++)
             {
               double m = sqrt(sqr(xval[i]) + sqr(yval[i]));
-              if(finite(m) && fabs(m) > max)
-#pragma omp critical(max)
-                if(finite(m) && fabs(m) > max)
-                  max = fabs(m);
+              if(finite(m) && fabs(m) > td->max)
+                td->max = fabs(m);
             }
 
             // This is just to make some sense.
-            if(fabs(max) < 1E-10)
-              max = 1E-10;
+            if(fabs(td->max) < 1E-10)
+              td->max = 1E-10;
 
             idx = quad_indices[0];
 
@@ -341,10 +578,10 @@ namespace Hermes
           // obtain linearized values and coordinates at the midpoints
           for (i = 0; i < 4; i++)
           {
-            midval[i][0] = (verts[iv0][i] + verts[iv1][i]) * 0.5;
-            midval[i][1] = (verts[iv1][i] + verts[iv2][i]) * 0.5;
-            midval[i][2] = (verts[iv2][i] + verts[iv3][i]) * 0.5;
-            midval[i][3] = (verts[iv3][i] + verts[iv0][i]) * 0.5;
+            midval[i][0] = (td->verts[iv0][i] + td->verts[iv1][i]) * 0.5;
+            midval[i][1] = (td->verts[iv1][i] + td->verts[iv2][i]) * 0.5;
+            midval[i][2] = (td->verts[iv2][i] + td->verts[iv3][i]) * 0.5;
+            midval[i][3] = (td->verts[iv3][i] + td->verts[iv0][i]) * 0.5;
             midval[i][4] = (midval[i][0]  + midval[i][2])  * 0.5;
           };
 
@@ -357,8 +594,8 @@ namespace Hermes
           else
           {
             // the value of the middle point is not the average of the four vertex values, since quad == 2 triangles
-            midval[2][4] = flip ? (verts[iv0][2] + verts[iv2][2]) * 0.5 : (verts[iv1][2] + verts[iv3][2]) * 0.5;
-            midval[3][4] = flip ? (verts[iv0][3] + verts[iv2][3]) * 0.5 : (verts[iv1][3] + verts[iv3][3]) * 0.5;
+            midval[2][4] = flip ? (td->verts[iv0][2] + td->verts[iv2][2]) * 0.5 : (td->verts[iv1][2] + td->verts[iv3][2]) * 0.5;
+            midval[3][4] = flip ? (td->verts[iv0][3] + td->verts[iv2][3]) * 0.5 : (td->verts[iv1][3] + td->verts[iv3][3]) * 0.5;
 
             // calculate the approximate error of linearizing the normalized solution
             double err = fabs(sqrt(sqr(xval[idx[0]]) + sqr(yval[idx[0]])) - sqrt(sqr(midval[2][0]) + sqr(midval[3][0]))) +
@@ -366,7 +603,7 @@ namespace Hermes
               fabs(sqrt(sqr(xval[idx[2]]) + sqr(yval[idx[2]])) - sqrt(sqr(midval[2][2]) + sqr(midval[3][2]))) +
               fabs(sqrt(sqr(xval[idx[3]]) + sqr(yval[idx[3]])) - sqrt(sqr(midval[2][3]) + sqr(midval[3][3]))) +
               fabs(sqrt(sqr(xval[idx[4]]) + sqr(yval[idx[4]])) - sqrt(sqr(midval[2][4]) + sqr(midval[3][4])));
-            split = !finite(err) || err > max*40*eps;
+            split = !finite(err) || err > td->max*40*eps;
 
             // do the same for the curvature
             if(curved && !split)
@@ -386,7 +623,7 @@ namespace Hermes
                 fabs(sqrt(sqr(xval[17]) + sqr(yval[17])) - 0.5*(sqrt(sqr(midval[2][1]) + sqr(midval[3][1])) + sqrt(sqr(midval[2][2]) + sqr(midval[3][2])))) +
                 fabs(sqrt(sqr(xval[20]) + sqr(yval[20])) - 0.5*(sqrt(sqr(midval[2][2]) + sqr(midval[3][2])) + sqrt(sqr(midval[2][3]) + sqr(midval[3][3])))) +
                 fabs(sqrt(sqr(xval[9]) + sqr(yval[9]))  - 0.5*(sqrt(sqr(midval[2][3]) + sqr(midval[3][3])) + sqrt(sqr(midval[2][0]) + sqr(midval[3][0]))));
-              split = !finite(err) || (err) > max*4*eps;
+              split = !finite(err) || (err) > td->max*4*eps;
             }
           }
 
@@ -403,30 +640,30 @@ namespace Hermes
             }
 
             // obtain mid-edge and mid-element vertices
-            int mid0 = get_vertex(iv0,  iv1,  midval[0][0], midval[1][0], xval[idx[0]], yval[idx[0]]);
-            int mid1 = get_vertex(iv1,  iv2,  midval[0][1], midval[1][1], xval[idx[1]], yval[idx[1]]);
-            int mid2 = get_vertex(iv2,  iv3,  midval[0][2], midval[1][2], xval[idx[2]], yval[idx[2]]);
-            int mid3 = get_vertex(iv3,  iv0,  midval[0][3], midval[1][3], xval[idx[3]], yval[idx[3]]);
-            int mid4 = get_vertex(mid0, mid2, midval[0][4], midval[1][4], xval[idx[4]], yval[idx[4]]);
+            int mid0 = get_vertex(td, iv0,  iv1,  midval[0][0], midval[1][0], xval[idx[0]], yval[idx[0]]);
+            int mid1 = get_vertex(td, iv1,  iv2,  midval[0][1], midval[1][1], xval[idx[1]], yval[idx[1]]);
+            int mid2 = get_vertex(td, iv2,  iv3,  midval[0][2], midval[1][2], xval[idx[2]], yval[idx[2]]);
+            int mid3 = get_vertex(td, iv3,  iv0,  midval[0][3], midval[1][3], xval[idx[3]], yval[idx[3]]);
+            int mid4 = get_vertex(td, mid0, mid2, midval[0][4], midval[1][4], xval[idx[4]], yval[idx[4]]);
 
             if(this->caughtException != NULL)
               return;
 
             // recur to sub-elements
             this->push_transforms(fns, 0);
-            process_quad(fns, iv0, mid0, mid4, mid3, level + 1, xval, yval, phx, phy, quad_indices[1], curved); 
+            process_quad(td, fns, iv0, mid0, mid4, mid3, level + 1, xval, yval, phx, phy, quad_indices[1], curved); 
             this->pop_transforms(fns);
 
             this->push_transforms(fns, 1);
-            process_quad(fns, mid0, iv1, mid1, mid4, level + 1, xval, yval, phx, phy, quad_indices[2], curved); 
+            process_quad(td, fns, mid0, iv1, mid1, mid4, level + 1, xval, yval, phx, phy, quad_indices[2], curved); 
             this->pop_transforms(fns);
 
             this->push_transforms(fns, 2);
-            process_quad(fns, mid4, mid1, iv2, mid2, level + 1, xval, yval, phx, phy, quad_indices[3], curved); 
+            process_quad(td, fns, mid4, mid1, iv2, mid2, level + 1, xval, yval, phx, phy, quad_indices[3], curved); 
             this->pop_transforms(fns);
 
             this->push_transforms(fns, 3);
-            process_quad(fns, mid3, mid4, mid2, iv3, level + 1, xval, yval, phx, phy, quad_indices[4], curved);
+            process_quad(td, fns, mid3, mid4, mid2, iv3, level + 1, xval, yval, phx, phy, quad_indices[4], curved);
             this->pop_transforms(fns);
             return;
           }
@@ -435,13 +672,13 @@ namespace Hermes
         // output two linear triangles,
         if(!flip)
         {
-          add_triangle(iv3, iv0, iv1, fns[0]->get_active_element()->marker);
-          add_triangle(iv1, iv2, iv3, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv3, iv0, iv1, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv1, iv2, iv3, fns[0]->get_active_element()->marker);
         }
         else
         {
-          add_triangle(iv0, iv1, iv2, fns[0]->get_active_element()->marker);
-          add_triangle(iv2, iv3, iv0, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv0, iv1, iv2, fns[0]->get_active_element()->marker);
+          add_triangle(td, iv2, iv3, iv0, fns[0]->get_active_element()->marker);
         }
       }
 
@@ -514,19 +751,17 @@ namespace Hermes
         edges_count = 0;
         dashes_count = 0;
 
-        // reuse or allocate vertex, triangle and edge arrays
-        this->verts = (double4*) realloc(this->verts, sizeof(double4) * vertex_size);
-        this->tris = (int3*) realloc(this->tris, sizeof(int3) * this->triangle_size);
-        this->tri_markers = (int*) realloc(this->tri_markers, sizeof(int) * this->triangle_size);
-        this->edges = (int2*) realloc(this->edges, sizeof(int2) * this->edges_size);
-        this->edge_markers = (int*) realloc(this->edge_markers, sizeof(int) * this->edges_size);
         this->dashes = (int2*) realloc(this->dashes, sizeof(int2) * dashes_size);
-        info = (int4*) malloc(sizeof(int4) * vertex_size);
         this->empty = false;
 
-        // initialize the hash table
-        hash_table = (int*) malloc(sizeof(int) * vertex_size);
-        memset(hash_table, 0xff, sizeof(int) * vertex_size);
+        // the vertices, triangles and edges of the threads, merged into the arrays of this instance in the end
+        int num_threads_used = Hermes2DApi.get_num_threads();
+        ThreadData* thread_data = new ThreadData[num_threads_used];
+        for(int i = 0; i < num_threads_used; i++)
+        {
+          thread_data[i].init(this->vertex_size / num_threads_used, this->triangle_size / num_threads_used, this->edges_size / num_threads_used);
+          thread_data[i].max = this->max;
+        }
 
         // select the linearization quadrature
         Quad2D *old_quad_x, *old_quad_y;
@@ -547,8 +782,8 @@ namespace Hermes
           meshes.push_back(ydisp->get_mesh());
 
         // Parallelization
-        MeshFunction<double>*** fns = new MeshFunction<double>**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        MeshFunction<double>*** fns = new MeshFunction<double>**[Hermes2DApi.get_num_threads()];
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           fns[i] = new MeshFunction<double>*[4];
           fns[i][0] = xsln->clone();
@@ -569,8 +804,8 @@ namespace Hermes
           }
         }
 
-        Transformable*** trfs = new Transformable**[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        Transformable*** trfs = new Transformable**[Hermes2DApi.get_num_threads()];
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trfs[i] = new Transformable*[4];
           trfs[i][0] = fns[i][0];
@@ -611,9 +846,9 @@ namespace Hermes
 
         trav_masterMax.begin(meshes.size(), &(meshes.front()));
 
-        Traverse* trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+        Traverse* trav = new Traverse[Hermes2DApi.get_num_threads()];
 
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].begin(meshes.size(), &(meshes.front()), trfs[i]);
           trav[i].stack = trav_masterMax.stack;
@@ -622,7 +857,6 @@ namespace Hermes
         int state_i;
 
 #define CHUNKSIZE 1
-        int num_threads_used = Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads);
 #pragma omp parallel shared(trav_masterMax) private(state_i) num_threads(num_threads_used)
         {
 #pragma omp for schedule(static, CHUNKSIZE)
@@ -639,13 +873,14 @@ namespace Hermes
               double* xval = fns[omp_get_thread_num()][0]->get_values(component_x, value_type_x);
               double* yval = fns[omp_get_thread_num()][1]->get_values(component_y, value_type_y);
 
+              // the maxima of the threads, reduced below
+              double& thread_max = thread_data[omp_get_thread_num()].max;
               for (unsigned int i = 0; i < current_state.e[0]->get_nvert(); i++)
               {
                 double fx = xval[i];
                 double fy = yval[i];
-#pragma omp critical(max)
-                if(fabs(sqrt(fx*fx + fy*fy)) > max)
-                  max = fabs(sqrt(fx*fx + fy*fy));
+                if(fabs(sqrt(fx*fx + fy*fy)) > thread_max)
+                  thread_max = fabs(sqrt(fx*fx + fy*fy));
               }
             }
             catch(Hermes::Exceptions::Exception& e)
@@ -662,18 +897,24 @@ namespace Hermes
         }
 
         trav_masterMax.finish();
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
           trav[i].finish();
         delete [] trav;
 
+        // the maximum over the threads, the start of the maxima the threads refine by
+        for(int i = 0; i < num_threads_used; i++)
+          this->max = std::max(this->max, thread_data[i].max);
+        for(int i = 0; i < num_threads_used; i++)
+          thread_data[i].max = this->max;
+
         Traverse trav_master(true);
         num_states = trav_master.get_num_states(meshes);
 
         trav_master.begin(meshes.size(), &(meshes.front()));
 
-        trav = new Traverse[Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads)];
+        trav = new Traverse[Hermes2DApi.get_num_threads()];
 
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].begin(meshes.size(), &(meshes.front()), trfs[i]);
           trav[i].stack = trav_master.stack;
@@ -693,16 +934,14 @@ namespace Hermes
 
 #pragma omp critical (get_next_state)
               current_state = trav[omp_get_thread_num()].get_next_state(&trav_master.top, &trav_master.id);
+              ThreadData* td = &thread_data[omp_get_thread_num()];
 
               fns[omp_get_thread_num()][0]->set_quad_order(0, xitem);
               fns[omp_get_thread_num()][1]->set_quad_order(0, yitem);
               double* xval = fns[omp_get_thread_num()][0]->get_values(component_x, value_type_x);
               double* yval = fns[omp_get_thread_num()][1]->get_values(component_y, value_type_y);
               if(xval == NULL || yval == NULL)
-              {
-                delete [] trav;
                 throw Hermes::Exceptions::Exception("Item not defined in the solution in Linearizer::process_solution.");
-              }
 
               if(xdisp != NULL)
                 fns[omp_get_thread_num()][2]->set_quad_order(0, H2D_FN_VAL);
@@ -729,7 +968,7 @@ namespace Hermes
                 if(this->ydisp != NULL)
                   y_disp += dmult * dy[i];
 
-                iv[i] = this->get_vertex(-fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, -fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, x_disp, y_disp, fx, fy);
+                iv[i] = this->get_vertex(td, -fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, -fns[omp_get_thread_num()][0]->get_active_element()->vn[i]->id, x_disp, y_disp, fx, fy);
 
                 if(this->caughtException != NULL)
                   continue;
@@ -737,12 +976,12 @@ namespace Hermes
 
               // recur to sub-elements
               if(current_state.e[0]->is_triangle())
-                process_triangle(fns[omp_get_thread_num()], iv[0], iv[1], iv[2], 0, NULL, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
+                process_triangle(td, fns[omp_get_thread_num()], iv[0], iv[1], iv[2], 0, NULL, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
               else
-                process_quad(fns[omp_get_thread_num()], iv[0], iv[1], iv[2], iv[3], 0, NULL, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
+                process_quad(td, fns[omp_get_thread_num()], iv[0], iv[1], iv[2], iv[3], 0, NULL, NULL, NULL, NULL, NULL, current_state.e[0]->is_curved());
 
               for (unsigned int i = 0; i < current_state.e[0]->get_nvert(); i++)
-                process_edge(iv[i], iv[current_state.e[0]->next_vert(i)], current_state.e[0]->en[i]->marker);
+                process_edge(td, iv[i], iv[current_state.e[0]->next_vert(i)], current_state.e[0]->en[i]->marker);
             }
             catch(Hermes::Exceptions::Exception& e)
             {
@@ -758,7 +997,7 @@ namespace Hermes
         }
 
         trav_master.finish();
-        for(unsigned int i = 0; i < Hermes2DApi.get_integral_param_value(Hermes::Hermes2D::numThreads); i++)
+        for(unsigned int i = 0; i < Hermes2DApi.get_num_threads(); i++)
         {
           trav[i].finish();
           for(unsigned int j = 0; j < (2 + (xdisp != NULL? 1 : 0) + (ydisp != NULL ? 1 : 0)); j++)
@@ -770,6 +1009,17 @@ namespace Hermes
         delete [] trfs;
         delete [] trav;
 
+        if(this->caughtException != NULL)
+        {
+          delete [] thread_data;
+          this->unlock_data();
+          throw *(this->caughtException);
+        }
+
+        // one set of vertices (and the hash table of them), triangles and edges
+        merge_thread_data(thread_data, num_threads_used);
+        delete [] thread_data;
+
         // regularize the linear mesh
         for (int i = 0; i < this->triangle_count; i++)
         {
@@ -801,6 +1051,8 @@ namespace Hermes
         // clean up
         ::free(this->hash_table);
         ::free(this->info);
+        this->hash_table = NULL;
+        this->info = NULL;
       }
 
       void Vectorizer::free()
@@ -841,6 +1093,38 @@ namespace Hermes
         return this->dashes_size;
       }
 
+      void Vectorizer::save_solution_vtu(MeshFunction<double>* xsln, MeshFunction<double>* ysln, const char* filename, const char* quantity_name,
+        int xitem, int yitem, double eps, bool compress)
+      {
+        process_solution(xsln, ysln, xitem, yitem, eps);
+        lock_data();
+
+        std::vector<float> points(3 * this->vertex_count);
+        std::vector<VtuField> fields(1);
+        fields[0].name = quantity_name;
+        fields[0].num_components = 3;
+        fields[0].cell_data = false;
+        fields[0].values.resize(3 * this->vertex_count);
+        for (int i = 0; i < this->vertex_count; i++)
+        {
+          points[3 * i] = (float) this->verts[i][0];
+          points[3 * i + 1] = (float) this->verts[i][1];
+          points[3 * i + 2] = 0.0f;
+          fields[0].values[3 * i] = (float) this->verts[i][2];
+          fields[0].values[3 * i + 1] = (float) this->verts[i][3];
+          fields[0].values[3 * i + 2] = 0.0f;
+        }
+
+        std::vector<int> connectivity(3 * this->triangle_count);
+        for (int i = 0; i < this->triangle_count; i++)
+          for (int j = 0; j < 3; j++)
+            connectivity[3 * i + j] = this->tris[i][j];
+        unlock_data();
+
+        // The triangle type of VTK is 5.
+        save_vtu(filename, points, 3, 5, connectivity, fields, compress);
+      }
+
       double4* Vectorizer::get_vertices()
       {
         return this->verts;
@@ -850,19 +1134,6 @@ namespace Hermes
         return this->vertex_count;
       }
 
-      int Vectorizer::add_vertex()
-      {
-        if(this->vertex_count >= this->vertex_size)
-        {
-          this->vertex_size *= 2;
-          verts = (double4*) realloc(verts, sizeof(double4) * vertex_size);
-          this->info = (int4*) realloc(info, sizeof(int4) * vertex_size);
-          this->hash_table = (int*) realloc(hash_table, sizeof(int) * vertex_size);
-          memset(this->hash_table + this->vertex_size / 2, 0xff, sizeof(int) * this->vertex_size / 2);
-        }
-        return this->vertex_count++;
-      }
-
       void Vectorizer::add_dash(int iv1, int iv2)
       {
         if(this->dashes_count >= this->dashes_size)
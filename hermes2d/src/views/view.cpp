@@ -25,6 +25,7 @@
 #include "global.h"
 #include "view_support.h"
 #include "view.h"
+#include "image_renderer.h"
 #include "solution.h"
 #include "view_data.cpp"
 
@@ -838,6 +839,20 @@ namespace Hermes
 
       void View::save_screenshot_internal(const char *file_name)
       {
+        if(ImageRenderer::is_png_file_name(file_name))
+        {
+          // RGB rows from the framebuffer (bottom to top), flipped for the PNG
+          std::vector<unsigned char> rgb(3 * output_width * output_height);
+          glPixelStorei(GL_PACK_ALIGNMENT, 1);
+          glReadPixels(0, 0, output_width, output_height, GL_RGB, GL_UNSIGNED_BYTE, &rgb[0]);
+          for(int i = 0; i < output_height / 2; i++)
+            std::swap_ranges(rgb.begin() + 3 * i * output_width, rgb.begin() + 3 * (i + 1) * output_width,
+            rgb.begin() + 3 * (output_height - 1 - i) * output_width);
+          ImageRenderer::save_png(file_name, &rgb[0], output_width, output_height);
+          printf("Image \"%s\" saved.\n", file_name);
+          return;
+        }
+
         BitmapFileHeader file_header;
         BitmapInfoHeader info_header;
 
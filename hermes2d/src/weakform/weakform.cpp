@@ -22,6 +22,7 @@
 #include "shapeset_hc_all.h"
 #include "shapeset_hd_all.h"
 #include "shapeset_h1_all.h"
+#include <algorithm>
 using namespace Hermes::Algebra::DenseMatrixOperations;
 namespace Hermes
 {
@@ -122,6 +123,7 @@ namespace Hermes
           newExt.push_back(otherWf->forms[i]->ext[ext_i]->clone());
         this->forms.back()->set_ext(newExt);
         this->forms.back()->wf = this;
+        this->forms.back()->position = i;
 
         if(dynamic_cast<MatrixFormVol<Scalar>*>(otherWf->forms[i]) != NULL)
           this->mfvol.push_back(dynamic_cast<MatrixFormVol<Scalar>*>(this->forms.back()));
@@ -179,12 +181,55 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    Form<Scalar>::Form() : scaling_factor(1.0), u_ext_offset(0), wf(NULL)
+    Form<Scalar>::Form() : scaling_factor(1.0), u_ext_offset(0), wf(NULL), position(-1), order_caching(false),
+      integration_order(-1), integration_order_increase(0), quad_2d(NULL), assembly_target(0)
     {
       areas.push_back(HERMES_ANY);
       stage_time = 0.0;
     }
 
+    template<typename Scalar>
+    void Form<Scalar>::set_order_caching(bool to_set)
+    {
+      this->order_caching = to_set;
+    }
+
+    template<typename Scalar>
+    void Form<Scalar>::set_integration_order(int order)
+    {
+      this->integration_order = order;
+    }
+
+    template<typename Scalar>
+    void Form<Scalar>::set_integration_order_increase(int increase)
+    {
+      this->integration_order_increase = increase;
+    }
+
+    template<typename Scalar>
+    void Form<Scalar>::set_quad_2d(Quad2D* quad)
+    {
+      this->quad_2d = quad;
+    }
+
+    template<typename Scalar>
+    bool Form<Scalar>::has_own_quadrature() const
+    {
+      return this->integration_order >= 0 || this->integration_order_increase < 0 || this->quad_2d != NULL;
+    }
+
+    template<typename Scalar>
+    void Form<Scalar>::set_assembly_target(unsigned int target)
+    {
+      this->assembly_target = target;
+    }
+
+    template<typename Scalar>
+    unsigned int Form<Scalar>::get_assembly_target() const
+    {
+      return this->assembly_target;
+    }
+
     template<typename Scalar>
     Form<Scalar>::~Form()
     {
@@ -253,7 +298,7 @@ namespace Hermes
 
     template<typename Scalar>
     MatrixForm<Scalar>::MatrixForm(unsigned int i, unsigned int j) :
-    Form<Scalar>(), sym(HERMES_NONSYM), i(i), j(j), previous_iteration_space_index(-1)
+    Form<Scalar>(), sym(HERMES_NONSYM), time_dependent(false), i(i), j(j), previous_iteration_space_index(-1)
     {
     }
 
@@ -278,10 +323,58 @@ namespace Hermes
       return Hermes::Ord();
     }
 
+    template<typename Scalar>
+    void MatrixForm<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+      unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+    {
+      for (unsigned int i = 0; i < n_test; i++)
+      {
+        if(v[i] == NULL)
+          continue;
+        for (unsigned int j = symmetric ? i : 0; j < n_base; j++)
+        {
+          if(u[j] == NULL)
+            continue;
+          result[i][j] = this->value(n, wt, u_ext, u[j], v[i], e, ext);
+        }
+      }
+    }
+
     template<typename Scalar>
     MatrixFormVol<Scalar>::MatrixFormVol(unsigned int i, unsigned int j) :
-    MatrixForm<Scalar>(i, j)
+    MatrixForm<Scalar>(i, j), sum_factorization(false), reference_matrices(false), constant_coefficients(false)
+    {
+    }
+
+    template<typename Scalar>
+    void MatrixFormVol<Scalar>::set_sum_factorization(bool to_set)
+    {
+      this->sum_factorization = to_set;
+    }
+
+    template<typename Scalar>
+    void MatrixFormVol<Scalar>::set_reference_matrices(bool to_set)
+    {
+      this->reference_matrices = to_set;
+    }
+
+    template<typename Scalar>
+    bool MatrixFormVol<Scalar>::get_reference_coefficients(Scalar& mass, Scalar& diffusion) const
     {
+      return false;
+    }
+
+    template<typename Scalar>
+    void MatrixFormVol<Scalar>::set_constant_coefficients(bool to_set)
+    {
+      this->constant_coefficients = to_set;
+    }
+
+    template<typename Scalar>
+    bool MatrixFormVol<Scalar>::get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+      Scalar* mass, Scalar* diffusion) const
+    {
+      return false;
     }
 
     template<typename Scalar>
@@ -363,7 +456,7 @@ namespace Hermes
 
     template<typename Scalar>
     VectorForm<Scalar>::VectorForm(unsigned int i) :
-    Form<Scalar>(), i(i)
+    Form<Scalar>(), i(i), load_case(0)
     {
     }
 
@@ -399,6 +492,18 @@ namespace Hermes
       return Hermes::Ord();
     }
 
+    template<typename Scalar>
+    void VectorForm<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+      unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+    {
+      for (unsigned int i = 0; i < n_test; i++)
+      {
+        if(v[i] == NULL)
+          continue;
+        result[i] = this->value(n, wt, u_ext, v[i], e, ext);
+      }
+    }
+
     template<typename Scalar>
     VectorFormVol<Scalar>* VectorFormVol<Scalar>::clone() const
     {
@@ -474,6 +579,7 @@ namespace Hermes
       }
 
       form->set_weakform(this);
+      form->position = forms.size();
       mfvol.push_back(form);
       forms.push_back(form);
     }
@@ -485,6 +591,7 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Invalid equation number.");
 
       form->set_weakform(this);
+      form->position = forms.size();
       mfsurf.push_back(form);
       forms.push_back(form);
     }
@@ -496,6 +603,7 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Invalid equation number.");
 
       form->set_weakform(this);
+      form->position = forms.size();
       mfDG.push_back(form);
       forms.push_back(form);
     }
@@ -506,6 +614,7 @@ namespace Hermes
       if(form->i >= neq)
         throw Hermes::Exceptions::Exception("Invalid equation number.");
       form->set_weakform(this);
+      form->position = forms.size();
       vfvol.push_back(form);
       forms.push_back(form);
     }
@@ -517,6 +626,7 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Invalid equation number.");
 
       form->set_weakform(this);
+      form->position = forms.size();
       vfsurf.push_back(form);
       forms.push_back(form);
     }
@@ -528,10 +638,108 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Invalid equation number.");
 
       form->set_weakform(this);
+      form->position = forms.size();
       vfDG.push_back(form);
       forms.push_back(form);
     }
 
+    template<typename Scalar>
+    void WeakForm<Scalar>::add_forms(const WeakForm<Scalar>* other, unsigned int assembly_target)
+    {
+      if(other->neq != this->neq)
+        throw Hermes::Exceptions::Exception("The weak formulations of WeakForm::add_forms() have different numbers of equations.");
+      // The indices of the external functions of the whole WeakForm would not be the ones of the forms any more.
+      if(!other->ext.empty())
+        throw Hermes::Exceptions::Exception("WeakForm::add_forms() needs the external functions of the forms, not of the whole WeakForm.");
+
+      for(unsigned int i = 0; i < other->forms.size(); i++)
+      {
+        Form<Scalar>* form = other->forms[i];
+        if(dynamic_cast<MatrixFormVol<Scalar>*>(form) != NULL)
+        {
+          MatrixFormVol<Scalar>* form_clone = dynamic_cast<MatrixFormVol<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_matrix_form(form_clone);
+        }
+        else if(dynamic_cast<MatrixFormSurf<Scalar>*>(form) != NULL)
+        {
+          MatrixFormSurf<Scalar>* form_clone = dynamic_cast<MatrixFormSurf<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_matrix_form_surf(form_clone);
+        }
+        else if(dynamic_cast<MatrixFormDG<Scalar>*>(form) != NULL)
+        {
+          MatrixFormDG<Scalar>* form_clone = dynamic_cast<MatrixFormDG<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_matrix_form_DG(form_clone);
+        }
+        else if(dynamic_cast<VectorFormVol<Scalar>*>(form) != NULL)
+        {
+          VectorFormVol<Scalar>* form_clone = dynamic_cast<VectorFormVol<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_vector_form(form_clone);
+        }
+        else if(dynamic_cast<VectorFormSurf<Scalar>*>(form) != NULL)
+        {
+          VectorFormSurf<Scalar>* form_clone = dynamic_cast<VectorFormSurf<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_vector_form_surf(form_clone);
+        }
+        else if(dynamic_cast<VectorFormDG<Scalar>*>(form) != NULL)
+        {
+          VectorFormDG<Scalar>* form_clone = dynamic_cast<VectorFormDG<Scalar>*>(form)->clone();
+          form_clone->assembly_target = assembly_target;
+          this->add_vector_form_DG(form_clone);
+        }
+      }
+    }
+
+    /// Orders the forms by their total time, descending.
+    class FormProfileTimeCompare
+    {
+    public:
+      FormProfileTimeCompare(const std::vector<FormProfile>& forms) : forms(forms) {}
+      bool operator()(unsigned int a, unsigned int b) const
+      {
+        return this->forms[a].get_evaluation_time() + this->forms[a].ord_time > this->forms[b].get_evaluation_time() + this->forms[b].ord_time;
+      }
+    private:
+      const std::vector<FormProfile>& forms;
+    };
+
+    template<typename Scalar>
+    void WeakForm<Scalar>::print_form_profile(const AssemblyProfile& profile) const
+    {
+      if(profile.forms.empty())
+      {
+        this->info("No form profile, see DiscreteProblem::set_form_profiling().");
+        return;
+      }
+
+      std::vector<unsigned int> order;
+      for(unsigned int i = 0; i < profile.forms.size() && i < this->forms.size(); i++)
+        order.push_back(i);
+      std::sort(order.begin(), order.end(), FormProfileTimeCompare(profile.forms));
+
+      this->info("Forms by time (the evaluation times estimated from every %d-th evaluation):", H2D_FORM_PROFILE_SAMPLING);
+      for(unsigned int k = 0; k < order.size(); k++)
+      {
+        const FormProfile& form_profile = profile.forms[order[k]];
+        Form<Scalar>* form = this->forms[order[k]];
+        char description[64];
+        if(dynamic_cast<MatrixForm<Scalar>*>(form) != NULL)
+          sprintf(description, "matrix form %s (%u, %u)", dynamic_cast<MatrixFormVol<Scalar>*>(form) != NULL ? "vol" : (dynamic_cast<MatrixFormSurf<Scalar>*>(form) != NULL ? "surf" : "DG"),
+            dynamic_cast<MatrixForm<Scalar>*>(form)->i, dynamic_cast<MatrixForm<Scalar>*>(form)->j);
+        else
+          sprintf(description, "vector form %s (%u)", dynamic_cast<VectorFormVol<Scalar>*>(form) != NULL ? "vol" : (dynamic_cast<VectorFormSurf<Scalar>*>(form) != NULL ? "surf" : "DG"),
+            dynamic_cast<VectorForm<Scalar>*>(form)->i);
+
+        this->info("\t#%u %s: %f s value(), %llu evaluations, average order %.1f, average points %.1f, %llu skipped; %f s ord(), %llu calls.",
+          order[k], description, form_profile.get_evaluation_time(), form_profile.evaluations, form_profile.get_average_order(), form_profile.get_average_points(),
+          form_profile.skipped, form_profile.ord_time, form_profile.ord_calls);
+      }
+    }
+
     template<typename Scalar>
     Hermes::vector<Form<Scalar> *> WeakForm<Scalar>::get_forms() const
     {
@@ -26,6 +26,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->setSymFlag(HERMES_SYM);
       }
 
@@ -34,6 +35,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, std::string area, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->setSymFlag(HERMES_SYM);
         this->set_area(area);
       }
@@ -65,6 +67,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->setSymFlag(HERMES_SYM);
       }
 
@@ -73,6 +76,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, std::string area, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->setSymFlag(HERMES_SYM);
         this->set_area(area);
       }
@@ -104,6 +108,7 @@ namespace Hermes
         (unsigned int i, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
       }
 
       template<typename Scalar>
@@ -111,6 +116,7 @@ namespace Hermes
         (unsigned int i, std::string area, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->set_area(area);
       }
 
@@ -141,6 +147,7 @@ namespace Hermes
         (unsigned int i, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
       }
 
       template<typename Scalar>
@@ -148,6 +155,7 @@ namespace Hermes
         (unsigned int i, std::string area, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->set_area(area);
       }
 
@@ -178,6 +186,7 @@ namespace Hermes
         (unsigned int i, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
       }
 
       template<typename Scalar>
@@ -185,6 +194,7 @@ namespace Hermes
         (unsigned int i, std::string area, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->set_area(area);
       }
 
@@ -215,6 +225,7 @@ namespace Hermes
         (unsigned int i, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
       }
 
       template<typename Scalar>
@@ -222,6 +233,7 @@ namespace Hermes
         (unsigned int i, std::string area, double lambda, double mu)
         : VectorFormVol<Scalar>(i), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->set_area(area);
       }
 
@@ -252,6 +264,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
       }
 
       template<typename Scalar>
@@ -259,6 +272,7 @@ namespace Hermes
         (unsigned int i, unsigned int j, std::string area, double lambda, double mu)
         : MatrixFormVol<Scalar>(i, j), lambda(lambda), mu(mu)
       {
+        this->set_order_caching();
         this->set_area(area);
       }
 
@@ -21,11 +21,52 @@ namespace Hermes
   {
     namespace WeakFormsH1
     {
+      // Weighted sums over the integration points in value_block() - the vectorized kernels of integrals/h1.h for real weights.
+      static inline double weighted_v(int n, double* w, double* v)
+      {
+        return int_v_kernel(n, w, v);
+      }
+
+      static inline std::complex<double> weighted_v(int n, std::complex<double>* w, double* v)
+      {
+        std::complex<double> result = 0;
+        for (int i = 0; i < n; i++)
+          result += w[i] * v[i];
+        return result;
+      }
+
+      static inline double weighted_u_v(int n, double* w, double* u, double* v)
+      {
+        return int_u_v_kernel(n, w, u, v);
+      }
+
+      static inline std::complex<double> weighted_u_v(int n, std::complex<double>* w, double* u, double* v)
+      {
+        std::complex<double> result = 0;
+        for (int i = 0; i < n; i++)
+          result += w[i] * u[i] * v[i];
+        return result;
+      }
+
+      static inline double weighted_grad_u_grad_v(int n, double* w, Func<double>* u, Func<double>* v)
+      {
+        return int_grad_u_grad_v_kernel(n, w, u->dx, u->dy, v->dx, v->dy);
+      }
+
+      static inline std::complex<double> weighted_grad_u_grad_v(int n, std::complex<double>* w, Func<double>* u, Func<double>* v)
+      {
+        std::complex<double> result = 0;
+        for (int i = 0; i < n; i++)
+          result += w[i] * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i]);
+        return result;
+      }
+
       template<>
       DefaultMatrixFormVol<double>::DefaultMatrixFormVol
         (int i, int j, std::string area, Hermes2DFunction<double>* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<double>(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
 
@@ -37,6 +78,7 @@ namespace Hermes
         (int i, int j, std::string area, Hermes2DFunction<std::complex<double> >* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<std::complex<double> >(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
         
@@ -51,6 +93,7 @@ namespace Hermes
         Hermes2DFunction<double>* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<double>(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
         
@@ -64,6 +107,7 @@ namespace Hermes
         Hermes2DFunction<std::complex<double> >* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<std::complex<double> >(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
         
@@ -131,6 +175,65 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultMatrixFormVol<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+      {
+        // The coefficient does not depend on the basis / test functions - evaluate it only once per point.
+        Scalar* weighted_coeff = new Scalar[n];
+        for (int i = 0; i < n; i++)
+        {
+          if(gt == HERMES_PLANAR)
+            weighted_coeff[i] = wt[i] * coeff->value(e->x[i], e->y[i]);
+          else if(gt == HERMES_AXISYM_X)
+            weighted_coeff[i] = wt[i] * e->y[i] * coeff->value(e->x[i], e->y[i]);
+          else
+            weighted_coeff[i] = wt[i] * e->x[i] * coeff->value(e->x[i], e->y[i]);
+        }
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+        {
+          if(v[test_i] == NULL)
+            continue;
+          double* v_val = v[test_i]->val;
+          for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+          {
+            if(u[base_i] == NULL)
+              continue;
+            result[test_i][base_i] = weighted_u_v(n, weighted_coeff, u[base_i]->val, v_val);
+          }
+        }
+
+        delete [] weighted_coeff;
+      }
+
+      template<typename Scalar>
+      bool DefaultMatrixFormVol<Scalar>::get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+        Scalar* mass, Scalar* diffusion) const
+      {
+        for (int i = 0; i < n; i++)
+        {
+          if(gt == HERMES_PLANAR)
+            mass[i] = wt[i] * coeff->value(e->x[i], e->y[i]);
+          else if(gt == HERMES_AXISYM_X)
+            mass[i] = wt[i] * e->y[i] * coeff->value(e->x[i], e->y[i]);
+          else
+            mass[i] = wt[i] * e->x[i] * coeff->value(e->x[i], e->y[i]);
+          diffusion[i] = 0.0;
+        }
+        return true;
+      }
+
+      template<typename Scalar>
+      bool DefaultMatrixFormVol<Scalar>::get_reference_coefficients(Scalar& mass, Scalar& diffusion) const
+      {
+        if(gt != HERMES_PLANAR || !coeff->is_constant())
+          return false;
+        mass = coeff->value(0.0, 0.0);
+        diffusion = 0.0;
+        return true;
+      }
+
       template<typename Scalar>
       MatrixFormVol<Scalar>* DefaultMatrixFormVol<Scalar>::clone() const
       {
@@ -143,6 +246,7 @@ namespace Hermes
         SymFlag sym, GeomType gt)
         : MatrixFormVol<Scalar>(i, j), idx_j(j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
         
@@ -156,6 +260,7 @@ namespace Hermes
         Hermes1DFunction<Scalar>* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<Scalar>(i, j), idx_j(j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
         
@@ -173,34 +278,42 @@ namespace Hermes
       Scalar DefaultJacobianDiffusion<Scalar>::value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *u,
         Func<double> *v, Geom<double> *e, Func<Scalar> **ext) const
       {
+        // The coefficient and its derivative in all the points at once.
+        Scalar* coeff_val = new Scalar[n];
+        Scalar* coeff_der = new Scalar[n];
+        coeff->values(n, u_ext[idx_j]->val, coeff_val);
+        coeff->derivatives(n, u_ext[idx_j]->val, coeff_der);
+
         Scalar result = 0;
         if(gt == HERMES_PLANAR) {
           for (int i = 0; i < n; i++) {
-            result += wt[i] * (coeff->derivative(u_ext[idx_j]->val[i]) * u->val[i] *
+            result += wt[i] * (coeff_der[i] * u->val[i] *
               (u_ext[idx_j]->dx[i] * v->dx[i] + u_ext[idx_j]->dy[i] * v->dy[i])
-              + coeff->value(u_ext[idx_j]->val[i])
+              + coeff_val[i]
               * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i]));
           }
         }
         else {
           if(gt == HERMES_AXISYM_X) {
             for (int i = 0; i < n; i++) {
-              result += wt[i] * e->y[i] * (coeff->derivative(u_ext[idx_j]->val[i]) * u->val[i] *
+              result += wt[i] * e->y[i] * (coeff_der[i] * u->val[i] *
                 (u_ext[idx_j]->dx[i] * v->dx[i] + u_ext[idx_j]->dy[i] * v->dy[i])
-                + coeff->value(u_ext[idx_j]->val[i])
+                + coeff_val[i]
                 * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i]));
             }
           }
           else {
             for (int i = 0; i < n; i++) {
-              result += wt[i] * e->x[i] * (coeff->derivative(u_ext[idx_j]->val[i]) * u->val[i] *
+              result += wt[i] * e->x[i] * (coeff_der[i] * u->val[i] *
                 (u_ext[idx_j]->dx[i] * v->dx[i] + u_ext[idx_j]->dy[i] * v->dy[i])
-                + coeff->value(u_ext[idx_j]->val[i])
+                + coeff_val[i]
                 * (u->dx[i] * v->dx[i] + u->dy[i] * v->dy[i]));
             }
           }
         }
 
+        delete [] coeff_val;
+        delete [] coeff_der;
         return result;
       }
 
@@ -239,6 +352,82 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultJacobianDiffusion<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+      {
+        // The coefficient and its derivative only depend on the previous iteration - evaluate them only once per point.
+        Scalar* weighted_coeff_val = new Scalar[n];
+        Scalar* weighted_coeff_der = new Scalar[n];
+        coeff->values(n, u_ext[idx_j]->val, weighted_coeff_val);
+        coeff->derivatives(n, u_ext[idx_j]->val, weighted_coeff_der);
+        for (int i = 0; i < n; i++)
+        {
+          double weight;
+          if(gt == HERMES_PLANAR)
+            weight = wt[i];
+          else if(gt == HERMES_AXISYM_X)
+            weight = wt[i] * e->y[i];
+          else
+            weight = wt[i] * e->x[i];
+          weighted_coeff_val[i] *= weight;
+          weighted_coeff_der[i] *= weight;
+        }
+
+        // The derivative term of a test function, without the basis function value.
+        Scalar* der_term = new Scalar[n];
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+        {
+          if(v[test_i] == NULL)
+            continue;
+          Func<double>* v_fn = v[test_i];
+          for (int i = 0; i < n; i++)
+            der_term[i] = weighted_coeff_der[i] * (u_ext[idx_j]->dx[i] * v_fn->dx[i] + u_ext[idx_j]->dy[i] * v_fn->dy[i]);
+
+          for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+          {
+            if(u[base_i] == NULL)
+              continue;
+            result[test_i][base_i] = weighted_v(n, der_term, u[base_i]->val) + weighted_grad_u_grad_v(n, weighted_coeff_val, u[base_i], v_fn);
+          }
+        }
+
+        delete [] der_term;
+        delete [] weighted_coeff_val;
+        delete [] weighted_coeff_der;
+      }
+
+      template<typename Scalar>
+      bool DefaultJacobianDiffusion<Scalar>::get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+        Scalar* mass, Scalar* diffusion) const
+      {
+        // The term with the derivative of the coefficient is not of the diffusion type.
+        if(!coeff->is_constant())
+          return false;
+
+        for (int i = 0; i < n; i++)
+        {
+          mass[i] = 0.0;
+          if(gt == HERMES_PLANAR)
+            diffusion[i] = wt[i] * coeff->value(0.0);
+          else if(gt == HERMES_AXISYM_X)
+            diffusion[i] = wt[i] * e->y[i] * coeff->value(0.0);
+          else
+            diffusion[i] = wt[i] * e->x[i] * coeff->value(0.0);
+        }
+        return true;
+      }
+
+      template<typename Scalar>
+      bool DefaultJacobianDiffusion<Scalar>::get_reference_coefficients(Scalar& mass, Scalar& diffusion) const
+      {
+        if(gt != HERMES_PLANAR || !coeff->is_constant())
+          return false;
+        mass = 0.0;
+        diffusion = coeff->value(0.0);
+        return true;
+      }
+
       template<typename Scalar>
       MatrixFormVol<Scalar>* DefaultJacobianDiffusion<Scalar>::clone() const
       {
@@ -251,6 +440,7 @@ namespace Hermes
         SymFlag sym, GeomType gt)
         : MatrixFormVol<Scalar>(i, j), idx_j(j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
         
@@ -263,6 +453,7 @@ namespace Hermes
         Hermes1DFunction<Scalar>* coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<Scalar>(i, j), idx_j(j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
         
@@ -328,6 +519,55 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultMatrixFormDiffusion<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+      {
+        double* weights = new double[n];
+        for (int i = 0; i < n; i++)
+        {
+          if(gt == HERMES_PLANAR)
+            weights[i] = wt[i];
+          else if(gt == HERMES_AXISYM_X)
+            weights[i] = wt[i] * e->y[i];
+          else
+            weights[i] = wt[i] * e->x[i];
+        }
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+        {
+          if(v[test_i] == NULL)
+            continue;
+          double* v_dx = v[test_i]->dx;
+          double* v_dy = v[test_i]->dy;
+          for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+          {
+            if(u[base_i] == NULL)
+              continue;
+            result[test_i][base_i] = int_grad_u_grad_v_kernel(n, weights, u[base_i]->dx, u[base_i]->dy, v_dx, v_dy);
+          }
+        }
+
+        delete [] weights;
+      }
+
+      template<typename Scalar>
+      bool DefaultMatrixFormDiffusion<Scalar>::get_tensor_product_coefficients(int n, double *wt, Func<Scalar> *u_ext[], Geom<double> *e, Func<Scalar> **ext,
+        Scalar* mass, Scalar* diffusion) const
+      {
+        for (int i = 0; i < n; i++)
+        {
+          mass[i] = 0.0;
+          if(gt == HERMES_PLANAR)
+            diffusion[i] = wt[i];
+          else if(gt == HERMES_AXISYM_X)
+            diffusion[i] = wt[i] * e->y[i];
+          else
+            diffusion[i] = wt[i] * e->x[i];
+        }
+        return true;
+      }
+
       template<typename Scalar>
       MatrixFormVol<Scalar>* DefaultMatrixFormDiffusion<Scalar>::clone() const
       {
@@ -342,6 +582,7 @@ namespace Hermes
         : MatrixFormVol<Scalar>(i, j),
         idx_j(j), coeff1(coeff1), coeff2(coeff2), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         if(gt != HERMES_PLANAR) throw Hermes::Exceptions::Exception("Axisymmetric advection forms not implemented yet.");
@@ -359,6 +600,7 @@ namespace Hermes
         : MatrixFormVol<Scalar>(i, j),
         idx_j(j), coeff1(coeff1), coeff2(coeff2), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         if(gt != HERMES_PLANAR) throw Hermes::Exceptions::Exception("Axisymmetric advection forms not implemented yet.");
@@ -417,6 +659,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormVol<Scalar>(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -429,6 +672,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormVol<Scalar>(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -467,6 +711,29 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultVectorFormVol<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+        unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+      {
+        // The coefficient does not depend on the test functions - evaluate it only once per point.
+        Scalar* weighted_coeff = new Scalar[n];
+        for (int i = 0; i < n; i++)
+        {
+          if(gt == HERMES_PLANAR)
+            weighted_coeff[i] = wt[i] * coeff->value(e->x[i], e->y[i]);
+          else if(gt == HERMES_AXISYM_X)
+            weighted_coeff[i] = wt[i] * e->y[i] * coeff->value(e->x[i], e->y[i]);
+          else
+            weighted_coeff[i] = wt[i] * e->x[i] * coeff->value(e->x[i], e->y[i]);
+        }
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          if(v[test_i] != NULL)
+            result[test_i] = weighted_v(n, weighted_coeff, v[test_i]->val);
+
+        delete [] weighted_coeff;
+      }
+
       template<typename Scalar>
       Ord DefaultVectorFormVol<Scalar>::ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *v,
         Geom<Ord> *e, Func<Ord> **ext) const
@@ -505,6 +772,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormVol<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -517,6 +785,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormVol<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -555,6 +824,29 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultResidualVol<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+        unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+      {
+        // Everything but the test function, once per point.
+        Scalar* weighted_coeff = new Scalar[n];
+        for (int i = 0; i < n; i++)
+        {
+          if(gt == HERMES_PLANAR)
+            weighted_coeff[i] = wt[i] * coeff->value(e->x[i], e->y[i]) * u_ext[idx_i]->val[i];
+          else if(gt == HERMES_AXISYM_X)
+            weighted_coeff[i] = wt[i] * e->y[i] * coeff->value(e->x[i], e->y[i]) * u_ext[idx_i]->val[i];
+          else
+            weighted_coeff[i] = wt[i] * e->x[i] * coeff->value(e->x[i], e->y[i]) * u_ext[idx_i]->val[i];
+        }
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          if(v[test_i] != NULL)
+            result[test_i] = weighted_v(n, weighted_coeff, v[test_i]->val);
+
+        delete [] weighted_coeff;
+      }
+
       template<typename Scalar>
       Ord DefaultResidualVol<Scalar>::ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *v,
         Geom<Ord> *e, Func<Ord> **ext) const
@@ -592,6 +884,7 @@ namespace Hermes
         Hermes1DFunction<Scalar>* coeff, GeomType gt)
         : VectorFormVol<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -603,6 +896,7 @@ namespace Hermes
         Hermes1DFunction<Scalar>* coeff, GeomType gt)
         : VectorFormVol<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -620,31 +914,63 @@ namespace Hermes
       Scalar DefaultResidualDiffusion<Scalar>::value(int n, double *wt, Func<Scalar> *u_ext[], Func<double> *v,
         Geom<double> *e, Func<Scalar> **ext) const
       {
+        Scalar* coeff_val = new Scalar[n];
+        coeff->values(n, u_ext[idx_i]->val, coeff_val);
+
         Scalar result = 0;
         if(gt == HERMES_PLANAR) {
           for (int i = 0; i < n; i++) {
-            result += wt[i] * coeff->value(u_ext[idx_i]->val[i])
+            result += wt[i] * coeff_val[i]
               * (u_ext[idx_i]->dx[i] * v->dx[i] + u_ext[idx_i]->dy[i] * v->dy[i]);
           }
         }
         else {
           if(gt == HERMES_AXISYM_X) {
             for (int i = 0; i < n; i++) {
-              result += wt[i] * e->y[i] * coeff->value(u_ext[idx_i]->val[i])
+              result += wt[i] * e->y[i] * coeff_val[i]
                 * (u_ext[idx_i]->dx[i] * v->dx[i] + u_ext[idx_i]->dy[i] * v->dy[i]);
             }
           }
           else {
             for (int i = 0; i < n; i++) {
-              result += wt[i] * e->x[i] * coeff->value(u_ext[idx_i]->val[i])
+              result += wt[i] * e->x[i] * coeff_val[i]
                 * (u_ext[idx_i]->dx[i] * v->dx[i] + u_ext[idx_i]->dy[i] * v->dy[i]);
             }
           }
         }
 
+        delete [] coeff_val;
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultResidualDiffusion<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+        unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+      {
+        // The flux coeff(u) * grad(u) does not depend on the test functions - evaluate it only once per point.
+        Scalar* flux_x = new Scalar[n];
+        Scalar* flux_y = new Scalar[n];
+        // The coefficient values first, flux_x is overwritten point by point.
+        coeff->values(n, u_ext[idx_i]->val, flux_x);
+        for (int i = 0; i < n; i++)
+        {
+          Scalar weighted_coeff = wt[i] * flux_x[i];
+          if(gt == HERMES_AXISYM_X)
+            weighted_coeff *= e->y[i];
+          else if(gt == HERMES_AXISYM_Y)
+            weighted_coeff *= e->x[i];
+          flux_x[i] = weighted_coeff * u_ext[idx_i]->dx[i];
+          flux_y[i] = weighted_coeff * u_ext[idx_i]->dy[i];
+        }
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          if(v[test_i] != NULL)
+            result[test_i] = weighted_v(n, flux_x, v[test_i]->dx) + weighted_v(n, flux_y, v[test_i]->dy);
+
+        delete [] flux_x;
+        delete [] flux_y;
+      }
+
       template<typename Scalar>
       Ord DefaultResidualDiffusion<Scalar>::ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *v,
         Geom<Ord> *e, Func<Ord> **ext) const
@@ -672,6 +998,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormVol<Scalar>(i), idx_i(i), coeff1(coeff1), coeff2(coeff2), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         if(gt != HERMES_PLANAR) throw Hermes::Exceptions::Exception("Axisymmetric advection forms not implemented yet.");
@@ -689,6 +1016,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i),
         idx_i(i), coeff1(coeff1), coeff2(coeff2), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         if(gt != HERMES_PLANAR) throw Hermes::Exceptions::Exception("Axisymmetric advection forms not implemented yet.");
@@ -719,6 +1047,23 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultResidualAdvection<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **v,
+        unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar *result) const
+      {
+        // Everything but the test function, once per point.
+        Scalar* weighted_coeff = new Scalar[n];
+        Func<Scalar>* u_prev = u_ext[idx_i];
+        for (int i = 0; i < n; i++)
+          weighted_coeff[i] = wt[i] * (coeff1->value(u_prev->val[i]) * u_prev->dx[i] + coeff2->value(u_prev->val[i]) * u_prev->dy[i]);
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+          if(v[test_i] != NULL)
+            result[test_i] = weighted_v(n, weighted_coeff, v[test_i]->val);
+
+        delete [] weighted_coeff;
+      }
+
       template<typename Scalar>
       Ord DefaultResidualAdvection<Scalar>::ord(int n, double *wt, Func<Ord> *u_ext[], Func<Ord> *v,
         Geom<Ord> *e, Func<Ord> **ext) const
@@ -744,6 +1089,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormSurf<Scalar>(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -756,6 +1102,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormSurf<Scalar>(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -834,6 +1181,7 @@ namespace Hermes
         : MatrixFormSurf<Scalar>(i, j),
         idx_j(j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -846,6 +1194,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormSurf<Scalar>(i, j), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -897,6 +1246,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -909,6 +1259,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -986,6 +1337,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
@@ -998,6 +1350,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), idx_i(i), coeff(coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If coeff is HERMES_ONE, initialize it to be constant 1.0.
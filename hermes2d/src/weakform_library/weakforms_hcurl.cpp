@@ -15,6 +15,7 @@
 
 #include "weakforms_hcurl.h"
 #include "../forms.h"
+#include "../integrals/h1.h"
 namespace Hermes
 {
   namespace Hermes2D
@@ -28,6 +29,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormVol<Scalar>(i, j), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
 
@@ -42,6 +44,7 @@ namespace Hermes
         Hermes2DFunction<Scalar>* f_coeff, SymFlag sym, GeomType gt)
         : MatrixFormVol<Scalar>(i, j), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
 
@@ -85,6 +88,27 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultMatrixFormVol<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+      {
+        if(gt != HERMES_PLANAR)
+          throw Hermes::Exceptions::Exception("Axisymmetric Hcurl forms not implemented yet.");
+
+        // E \cdot F = E0 F0 + E1 F1, the same reduction as the one of the gradients.
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+        {
+          if(v[test_i] == NULL)
+            continue;
+          for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+          {
+            if(u[base_i] == NULL)
+              continue;
+            result[test_i][base_i] = const_coeff * int_grad_u_grad_v_kernel(n, wt, u[base_i]->val0, u[base_i]->val1, v[test_i]->val0, v[test_i]->val1);
+          }
+        }
+      }
+
       template<typename Scalar>
       MatrixFormVol<Scalar>* DefaultMatrixFormVol<Scalar>::clone() const
       {
@@ -98,6 +122,7 @@ namespace Hermes
         : MatrixFormVol<Scalar>(i, j),
         idx_j(j), const_coeff(const_coeff), spline_coeff(c_spline), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         this->setSymFlag(sym);
 
@@ -113,6 +138,7 @@ namespace Hermes
         : MatrixFormVol<Scalar>(i, j),
         idx_j(j), const_coeff(const_coeff), spline_coeff(c_spline), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         this->setSymFlag(sym);
 
@@ -157,6 +183,26 @@ namespace Hermes
         return result;
       }
 
+      template<typename Scalar>
+      void DefaultJacobianCurlCurl<Scalar>::value_block(int n, double *wt, Func<Scalar> *u_ext[], Func<double> **u, Func<double> **v,
+        unsigned int n_base, unsigned int n_test, Geom<double> *e, Func<Scalar> **ext, Scalar **result, bool symmetric) const
+      {
+        if(gt != HERMES_PLANAR)
+          throw Hermes::Exceptions::Exception("Axisymmetric Hcurl forms not implemented yet.");
+
+        for (unsigned int test_i = 0; test_i < n_test; test_i++)
+        {
+          if(v[test_i] == NULL)
+            continue;
+          for (unsigned int base_i = symmetric ? test_i : 0; base_i < n_base; base_i++)
+          {
+            if(u[base_i] == NULL)
+              continue;
+            result[test_i][base_i] = const_coeff * int_u_v_kernel(n, wt, u[base_i]->curl, v[test_i]->curl);
+          }
+        }
+      }
+
       template<typename Scalar>
       MatrixFormVol<Scalar>* DefaultJacobianCurlCurl<Scalar>::clone() const
       {
@@ -170,6 +216,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i), const_coeff0(const_coeff0), const_coeff1(const_coeff1),
         function_coeff0(f_coeff0), function_coeff1(f_coeff1), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
 
         // If f_coeff0 is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
@@ -187,6 +234,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i), const_coeff0(const_coeff0), const_coeff1(const_coeff1),
         function_coeff0(f_coeff0), function_coeff1(f_coeff1), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         
         // If f_coeff0 is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
@@ -236,6 +284,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i),
         idx_i(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
 
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
@@ -250,6 +299,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i),
         idx_i(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
 
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
@@ -311,6 +361,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i),
         idx_i(i), const_coeff(const_coeff), spline_coeff(c_spline), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
 
         // If spline is HERMES_DEFAULT_SPLINE, initialize it to be constant 1.0.
@@ -325,6 +376,7 @@ namespace Hermes
         : VectorFormVol<Scalar>(i),
         idx_i(i), const_coeff(const_coeff), spline_coeff(c_spline), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
 
         // If spline is HERMES_DEFAULT_SPLINE, initialize it to be constant 1.0.
@@ -394,6 +446,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormSurf<Scalar>(i, j), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
@@ -406,6 +459,7 @@ namespace Hermes
         GeomType gt)
         : MatrixFormSurf<Scalar>(i, j), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
@@ -459,6 +513,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
@@ -471,6 +526,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
         else throw Hermes::Exceptions::Exception("Nonconstant functions in Hcurl forms not implemented yet.");
@@ -527,6 +583,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_area(area);
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
@@ -539,6 +596,7 @@ namespace Hermes
         GeomType gt)
         : VectorFormSurf<Scalar>(i), const_coeff(const_coeff), function_coeff(f_coeff), gt(gt)
       {
+        this->set_order_caching();
         this->set_areas(areas);
         // If f_coeff is HERMES_DEFAULT_FUNCTION, initialize it to be constant 1.0.
         if(f_coeff == HERMES_DEFAULT_FUNCTION) this->function_coeff = new Hermes2DFunction<Scalar>(1.0);
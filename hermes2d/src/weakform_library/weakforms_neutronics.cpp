@@ -14,6 +14,8 @@
 // along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "weakforms_neutronics.h"
+#include "../discrete_problem.h"
+#include "vector_kernels.h"
 
 #include <algorithm>
 #include <iomanip>
@@ -876,6 +878,7 @@ namespace Hermes
                 keff_iteration_forms.push_back(keff_iteration_form);
                 this->add_vector_form(keff_iteration_form);
               }
+              this->set_ext(iterates);
             }
 
             template<typename Scalar>
@@ -889,6 +892,44 @@ namespace Hermes
               for(int i = 0; i < keff_iteration_forms.size(); i++)
                 keff_iteration_forms[i]->update_keff(new_keff);
             }
+
+            template<typename Scalar>
+            DefaultWeakFormShiftedLoss<Scalar>::DefaultWeakFormShiftedLoss( const MaterialPropertyMaps& matprop, Mesh *mesh,
+              double fission_shift,
+              GeomType geom_type ) : WeakForm<Scalar>(matprop.get_G())
+            {
+              bool2 Ss_nnz = matprop.get_scattering_multigroup_structure();
+              bool1 chi_nnz = matprop.get_fission_multigroup_structure();
+
+              for (unsigned int gto = 0; gto < matprop.get_G(); gto++)
+              {
+                this->add_matrix_form(new DiffusionReaction::Jacobian<Scalar>(gto, matprop, mesh, geom_type));
+
+                for (unsigned int gfrom = 0; gfrom < matprop.get_G(); gfrom++)
+                {
+                  if(Ss_nnz[gto][gfrom])
+                    this->add_matrix_form(new Scattering::Jacobian<Scalar>(gto, gfrom, matprop, mesh, geom_type));
+
+                  // The fission Jacobian is -F.
+                  if(fission_shift != 0.0 && chi_nnz[gto])
+                  {
+                    FissionYield::Jacobian<Scalar>* fission_form = new FissionYield::Jacobian<Scalar>(gto, gfrom, matprop, mesh, geom_type);
+                    fission_form->setScalingFactor(fission_shift);
+                    this->add_matrix_form(fission_form);
+                  }
+                }
+              }
+            }
+
+            template<typename Scalar>
+            DefaultWeakFormFissionSource<Scalar>::DefaultWeakFormFissionSource( const MaterialPropertyMaps& matprop, Mesh *mesh,
+              Hermes::vector<MeshFunction<Scalar>*>& iterates,
+              GeomType geom_type ) : WeakForm<Scalar>(matprop.get_G())
+            {
+              this->set_ext(iterates);
+              for (unsigned int gto = 0; gto < matprop.get_G(); gto++)
+                this->add_vector_form(new FissionYield::OuterIterationForm<Scalar>( gto, matprop, mesh, iterates, 1.0, geom_type ));
+            }
           }
         }
 
@@ -903,6 +944,133 @@ namespace Hermes
                 result[i] += nu[j] * Sigma_f[j] * values.at(j)[i];
             }
           }
+
+          KeffEigenvalueIteration::KeffEigenvalueIteration(const MaterialProperties::Diffusion::MaterialPropertyMaps& matprop, Hermes::vector<const Space<double>*> spaces,
+            GeomType geom_type) : Hermes::Mixins::Loggable(true), matprop(matprop), spaces(spaces), geom_type(geom_type),
+            keff_shift(0.0), keff_tolerance(1e-6), source_tolerance(1e-5), max_iterations(1000), keff(1.0), num_iterations(0)
+          {
+            if(spaces.size() != matprop.get_G())
+              throw Hermes::Exceptions::LengthException(2, spaces.size(), matprop.get_G());
+          }
+
+          void KeffEigenvalueIteration::set_wielandt_shift(double keff_shift)
+          {
+            if(keff_shift < 0.0)
+              throw Hermes::Exceptions::ValueException("keff_shift", keff_shift, 0.0);
+            this->keff_shift = keff_shift;
+          }
+
+          void KeffEigenvalueIteration::set_tolerance(double keff_tolerance, double source_tolerance)
+          {
+            this->keff_tolerance = keff_tolerance;
+            this->source_tolerance = source_tolerance;
+          }
+
+          void KeffEigenvalueIteration::set_max_iterations(int max_iterations)
+          {
+            this->max_iterations = max_iterations;
+          }
+
+          double KeffEigenvalueIteration::solve(Hermes::vector<MeshFunction<double>*> initial_guess, Hermes::vector<Solution<double>*> solutions)
+          {
+            if(initial_guess.size() != spaces.size())
+              throw Hermes::Exceptions::LengthException(1, initial_guess.size(), spaces.size());
+            if(solutions.size() != spaces.size())
+              throw Hermes::Exceptions::LengthException(2, solutions.size(), spaces.size());
+
+            Mesh* mesh = spaces[0]->get_mesh();
+            int ndof = Space<double>::get_num_dofs(spaces);
+            // Eigenvalue of the shifted problem (L - mu_shift F)^{-1} F is 1 / (1/keff - mu_shift).
+            double mu_shift = keff_shift > 0.0 ? 1.0 / keff_shift : 0.0;
+
+            // The shifted loss operator - assembled and factorized once.
+            CompleteWeakForms::Diffusion::DefaultWeakFormShiftedLoss<double> wf_loss(matprop, mesh, mu_shift, geom_type);
+            DiscreteProblem<double> dp_loss(&wf_loss, spaces);
+            SparseMatrix<double>* matrix = create_matrix<double>();
+            Vector<double>* rhs = create_vector<double>();
+            dp_loss.assemble(matrix);
+            rhs->alloc(ndof);
+            LinearMatrixSolver<double>* matrix_solver = create_linear_solver<double>(matrix, rhs);
+
+            // The fission source - only its vector forms are assembled in the iterations.
+            Hermes::vector<MeshFunction<double>*> iterates = initial_guess;
+            CompleteWeakForms::Diffusion::DefaultWeakFormFissionSource<double> wf_source(matprop, mesh, iterates, geom_type);
+            DiscreteProblem<double> dp_source(&wf_source, spaces);
+            Vector<double>* source_vector = create_vector<double>();
+
+            double* source = new double[ndof];
+            double* new_source = new double[ndof];
+            double* flux = new double[ndof];
+
+            // The source vector forms are the residual, -F phi.
+            dp_source.assemble(source_vector);
+            source_vector->change_sign();
+            source_vector->extract(source);
+            double source_norm = Hermes::Algebra::VectorKernels::nrm2(ndof, source);
+            if(source_norm == 0.0)
+              throw Hermes::Exceptions::Exception("KeffEigenvalueIteration: the fission source of the initial guess is zero.");
+            Hermes::Algebra::VectorKernels::scale(ndof, 1.0 / source_norm, source);
+
+            Hermes::vector<MeshFunction<double>*> solution_iterates;
+            for (unsigned int i = 0; i < solutions.size(); i++)
+              solution_iterates.push_back(solutions[i]);
+            wf_source.set_ext(solution_iterates);
+
+            bool converged = false;
+            for (this->num_iterations = 1; this->num_iterations <= this->max_iterations; this->num_iterations++)
+            {
+              rhs->zero();
+              rhs->add_vector(source);
+              if(!matrix_solver->solve())
+                throw Hermes::Exceptions::LinearMatrixSolverException("KeffEigenvalueIteration: the solve with the loss operator failed.");
+              if(this->num_iterations == 1)
+                matrix_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+              memcpy(flux, matrix_solver->get_sln_vector(), ndof * sizeof(double));
+              Solution<double>::vector_to_solutions(flux, spaces, solutions);
+
+              dp_source.assemble(source_vector);
+              source_vector->change_sign();
+              source_vector->extract(new_source);
+
+              // The Rayleigh quotient of the shifted problem in the source vectors.
+              double rho = Hermes::Algebra::VectorKernels::dot(ndof, new_source, source);
+              if(rho <= 0.0)
+                throw Hermes::Exceptions::Exception("KeffEigenvalueIteration: the fission source changed its sign, the Wielandt shift %g is below keff.", this->keff_shift);
+              double new_keff = 1.0 / (mu_shift + 1.0 / rho);
+
+              double new_source_norm = Hermes::Algebra::VectorKernels::nrm2(ndof, new_source);
+              Hermes::Algebra::VectorKernels::scale(ndof, 1.0 / new_source_norm, new_source);
+              double source_change = Hermes::Algebra::VectorKernels::diff_nrm2(ndof, new_source, source);
+              double keff_change = std::abs(new_keff - this->keff) / new_keff;
+              this->keff = new_keff;
+              std::swap(source, new_source);
+
+              this->info("KeffEigenvalueIteration: iteration %d, keff = %.8f, change of keff %g, of the source %g.", this->num_iterations, this->keff, keff_change, source_change);
+              if(this->num_iterations > 1 && keff_change <= this->keff_tolerance && source_change <= this->source_tolerance)
+              {
+                converged = true;
+                // Normalized with the source.
+                Hermes::Algebra::VectorKernels::scale(ndof, 1.0 / new_source_norm, flux);
+                Solution<double>::vector_to_solutions(flux, spaces, solutions);
+                break;
+              }
+            }
+            if(!converged)
+            {
+              this->num_iterations = this->max_iterations;
+              this->warn("KeffEigenvalueIteration: no convergence in %d iterations.", this->max_iterations);
+            }
+
+            delete [] source;
+            delete [] new_source;
+            delete [] flux;
+            delete source_vector;
+            delete matrix_solver;
+            delete matrix;
+            delete rhs;
+
+            return this->keff;
+          }
         }
       }
       namespace Monoenergetic
@@ -972,6 +1140,12 @@ namespace Hermes
 
             template class HERMES_API DefaultWeakFormSourceIteration<double>;
             template class HERMES_API DefaultWeakFormSourceIteration<std::complex<double> >;
+
+            template class HERMES_API DefaultWeakFormShiftedLoss<double>;
+            template class HERMES_API DefaultWeakFormShiftedLoss<std::complex<double> >;
+
+            template class HERMES_API DefaultWeakFormFissionSource<double>;
+            template class HERMES_API DefaultWeakFormFissionSource<std::complex<double> >;
           }
         }
       }
@@ -0,0 +1,222 @@
+// This file is part of Hermes2D.
+//
+// Hermes2D is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "xml_stream_reader.h"
+#include <cstdio>
+#include <cstdlib>
+
+namespace Hermes
+{
+  namespace Hermes2D
+  {
+    static bool is_xml_space(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    XMLStreamReader::XMLStreamReader(const char* filename) : filename(filename), position(0)
+    {
+      FILE* file = fopen(filename, "rb");
+      if(file == NULL)
+        throw Hermes::Exceptions::Exception("Unable to open the file %s.", filename);
+      fseek(file, 0, SEEK_END);
+      long length = ftell(file);
+      fseek(file, 0, SEEK_SET);
+      if(length > 0)
+      {
+        buffer.resize(length);
+        size_t read = fread(&buffer[0], 1, length, file);
+        if(read != (size_t) length)
+        {
+          fclose(file);
+          throw Hermes::Exceptions::Exception("Error reading the file %s.", filename);
+        }
+      }
+      fclose(file);
+    }
+
+    XMLStreamReader::~XMLStreamReader()
+    {
+    }
+
+    void XMLStreamReader::skip_past(const char* terminator)
+    {
+      size_t end = buffer.find(terminator, position);
+      if(end == std::string::npos)
+        throw Hermes::Exceptions::Exception("File %s: unterminated markup.", filename.c_str());
+      position = end + strlen(terminator);
+    }
+
+    void XMLStreamReader::skip_spaces()
+    {
+      while (position < buffer.length() && is_xml_space(buffer[position]))
+        position++;
+    }
+
+    bool XMLStreamReader::next()
+    {
+      while (true)
+      {
+        position = buffer.find('<', position);
+        if(position == std::string::npos)
+        {
+          position = buffer.length();
+          return false;
+        }
+
+        // Declarations, processing instructions, comments, CDATA, end tags.
+        if(buffer.compare(position, 4, "<!--") == 0)
+          skip_past("-->");
+        else if(buffer.compare(position, 9, "<![CDATA[") == 0)
+          skip_past("]]>");
+        else if(buffer.compare(position, 2, "<?") == 0)
+          skip_past("?>");
+        else if(buffer.compare(position, 2, "<!") == 0 || buffer.compare(position, 2, "</") == 0)
+          skip_past(">");
+        else
+          break;
+      }
+
+      // The name.
+      position++;
+      size_t name_start = position;
+      while (position < buffer.length() && !is_xml_space(buffer[position]) && buffer[position] != '>' && buffer[position] != '/')
+        position++;
+      element_name.assign(buffer, name_start, position - name_start);
+      size_t colon = element_name.find(':');
+      if(colon != std::string::npos)
+        element_name.erase(0, colon + 1);
+      if(element_name.empty())
+        throw Hermes::Exceptions::Exception("File %s: an element without a name.", filename.c_str());
+
+      // The attributes.
+      attributes.clear();
+      while (true)
+      {
+        skip_spaces();
+        if(position >= buffer.length())
+          throw Hermes::Exceptions::Exception("File %s: unterminated element %s.", filename.c_str(), element_name.c_str());
+        if(buffer[position] == '>')
+        {
+          position++;
+          return true;
+        }
+        if(buffer[position] == '/')
+        {
+          skip_past(">");
+          return true;
+        }
+
+        size_t attribute_start = position;
+        while (position < buffer.length() && !is_xml_space(buffer[position]) && buffer[position] != '=')
+          position++;
+        std::string attribute_name(buffer, attribute_start, position - attribute_start);
+        skip_spaces();
+        if(position >= buffer.length() || buffer[position] != '=')
+          throw Hermes::Exceptions::Exception("File %s: attribute %s of element %s without a value.", filename.c_str(), attribute_name.c_str(), element_name.c_str());
+        position++;
+        skip_spaces();
+        if(position >= buffer.length() || (buffer[position] != '"' && buffer[position] != '\''))
+          throw Hermes::Exceptions::Exception("File %s: unquoted value of attribute %s.", filename.c_str(), attribute_name.c_str());
+        char quote = buffer[position++];
+        size_t value_end = buffer.find(quote, position);
+        if(value_end == std::string::npos)
+          throw Hermes::Exceptions::Exception("File %s: unterminated value of attribute %s.", filename.c_str(), attribute_name.c_str());
+
+        // Namespace declarations and the schema location are of no interest.
+        if(attribute_name.compare(0, 5, "xmlns") != 0 && attribute_name.find(':') == std::string::npos)
+        {
+          attributes.push_back(std::make_pair(attribute_name, std::string(buffer, position, value_end - position)));
+          decode_entities(attributes.back().second);
+        }
+        position = value_end + 1;
+      }
+    }
+
+    void XMLStreamReader::decode_entities(std::string& value) const
+    {
+      size_t amp = value.find('&');
+      while (amp != std::string::npos)
+      {
+        size_t semicolon = value.find(';', amp);
+        if(semicolon == std::string::npos)
+          return;
+        std::string entity(value, amp + 1, semicolon - amp - 1);
+        std::string replacement;
+        if(entity == "lt") replacement = "<";
+        else if(entity == "gt") replacement = ">";
+        else if(entity == "amp") replacement = "&";
+        else if(entity == "quot") replacement = "\"";
+        else if(entity == "apos") replacement = "'";
+        else if(!entity.empty() && entity[0] == '#')
+        {
+          long code = (entity.length() > 1 && (entity[1] == 'x' || entity[1] == 'X')) ? strtol(entity.c_str() + 2, NULL, 16) : strtol(entity.c_str() + 1, NULL, 10);
+          // The markers and numbers are ASCII.
+          replacement = (code > 0 && code < 128) ? std::string(1, (char) code) : std::string("?");
+        }
+        else
+        {
+          amp = value.find('&', amp + 1);
+          continue;
+        }
+        value.replace(amp, semicolon - amp + 1, replacement);
+        amp = value.find('&', amp + replacement.length());
+      }
+    }
+
+    const std::string& XMLStreamReader::name() const
+    {
+      return this->element_name;
+    }
+
+    bool XMLStreamReader::has_attribute(const char* attribute_name) const
+    {
+      for (unsigned int i = 0; i < attributes.size(); i++)
+        if(attributes[i].first == attribute_name)
+          return true;
+      return false;
+    }
+
+    const std::string& XMLStreamReader::attribute(const char* attribute_name) const
+    {
+      for (unsigned int i = 0; i < attributes.size(); i++)
+        if(attributes[i].first == attribute_name)
+          return attributes[i].second;
+      throw Hermes::Exceptions::Exception("File %s: element %s without the attribute %s.", filename.c_str(), element_name.c_str(), attribute_name);
+    }
+
+    int XMLStreamReader::int_attribute(const char* attribute_name) const
+    {
+      const std::string& value = attribute(attribute_name);
+      char* end;
+      long result = strtol(value.c_str(), &end, 10);
+      while (is_xml_space(*end)) end++;
+      if(end == value.c_str() || *end != '\0')
+        throw Hermes::Exceptions::Exception("File %s: attribute %s of element %s is not an integer.", filename.c_str(), attribute_name, element_name.c_str());
+      return (int) result;
+    }
+
+    double XMLStreamReader::double_attribute(const char* attribute_name) const
+    {
+      const std::string& value = attribute(attribute_name);
+      char* end;
+      double result = strtod(value.c_str(), &end);
+      while (is_xml_space(*end)) end++;
+      if(end == value.c_str() || *end != '\0')
+        throw Hermes::Exceptions::Exception("File %s: attribute %s of element %s is not a number.", filename.c_str(), attribute_name, element_name.c_str());
+      return result;
+    }
+  }
+}
@@ -4,11 +4,10 @@
 #include <stdio.h>
 
 using namespace RefinementSelectors;
-using Teuchos::RCP;
-using Teuchos::rcp;
+using namespace Hermes::Solvers;
 
 //  This example solves a simple eigenproblem in a square. 
-//  Python and Pysparse must be installed. 
+//  The eigensolver (shift-invert Lanczos) factorizes the shifted matrix by the selected matrix solver. 
 //
 //  PDE: -Laplace u + (x*x + y*y)u = lambda_k u,
 //  where lambda_0, lambda_1, ... are the eigenvalues.
@@ -22,10 +21,10 @@ using Teuchos::rcp;
 const int NUMBER_OF_EIGENVALUES = 50;             // Desired number of eigenvalues.
 const int P_INIT = 4;                             // Uniform polynomial degree of mesh elements.
 const int INIT_REF_NUM = 3;                       // Number of initial mesh refinements.
-const double TARGET_VALUE = 2.0;                  // PySparse parameter: Eigenvalues in the vicinity of 
+const double TARGET_VALUE = 2.0;                  // Eigensolver parameter: Eigenvalues in the vicinity of 
                                                   // this number will be computed. 
-const double TOL = 1e-10;                         // Pysparse parameter: Error tolerance.
-const int MAX_ITER = 1000;                        // PySparse parameter: Maximum number of iterations.
+const double TOL = 1e-10;                         // Eigensolver parameter: Error tolerance.
+const int MAX_ITER = 1000;                        // Eigensolver parameter: Maximum number of restarts.
 
 int main(int argc, char* argv[])
 {
@@ -53,19 +52,19 @@ int main(int argc, char* argv[])
   WeakFormEigenRight wf_right;
 
   // Initialize matrices.
-  RCP<SparseMatrix<double> > matrix_left = rcp(new CSCMatrix<double>());
-  RCP<SparseMatrix<double> > matrix_right = rcp(new CSCMatrix<double>());
+  CSCMatrix<double>* matrix_left = new CSCMatrix<double>();
+  CSCMatrix<double>* matrix_right = new CSCMatrix<double>();
 
   // Assemble the matrices.
   DiscreteProblem<double> dp_left(&wf_left, &space);
-  dp_left.assemble(matrix_left.get());
+  dp_left.assemble(matrix_left);
   DiscreteProblem<double> dp_right(&wf_right, &space);
-  dp_right.assemble(matrix_right.get());
+  dp_right.assemble(matrix_right);
 
   EigenSolver<double> es(matrix_left, matrix_right);
-  info("Calling Pysparse...");
+  info("Calling the eigensolver...");
   es.solve(NUMBER_OF_EIGENVALUES, TARGET_VALUE, TOL, MAX_ITER);
-  info("Pysparse finished.");
+  info("Eigensolver finished.");
   es.print_eigenvalues();
 
   // Initializing solution vector, solution and ScalarView.
@@ -94,6 +93,10 @@ int main(int argc, char* argv[])
     Views::View::wait(Views::HERMES_WAIT_KEYPRESS);
   }
 
+  delete [] eigenval;
+  delete matrix_left;
+  delete matrix_right;
+
   return 0; 
 };
 
@@ -1,12 +1,11 @@
 #include "fct.h"
 
-Flux_Correction::Flux_Correction(double theta)
+Flux_Correction::Flux_Correction(double theta) : fct_algebra(theta)
 {
   this->theta = theta;
   fct = NULL; 
   space =NULL;			
   al = new AsmList<double>;	 
-  P_plus= NULL;  P_minus= NULL;  Q_plus= NULL;  Q_minus= NULL;   R_plus= NULL;  R_minus= NULL;
 };
 Flux_Correction::~Flux_Correction()
 {
@@ -17,13 +16,8 @@ Flux_Correction::~Flux_Correction()
 
 void Flux_Correction::free()
 {
-  if(P_plus!=NULL)  delete [] P_plus;
-  if(P_minus!=NULL) delete [] P_minus;
-  if(Q_plus!=NULL)  delete [] Q_plus;
-  if(Q_minus!=NULL) delete [] Q_minus;
-  if(R_plus!=NULL)  delete [] R_plus;
-  if(R_minus!=NULL) delete [] R_minus;
   if(fct!=NULL) delete [] fct; 
+  fct = NULL;
 
 };
 
@@ -35,9 +29,6 @@ void Flux_Correction::init(Space<double>* new_space)
   space = new_space;					
   int ndof = space->get_num_dofs();
   fct = new bool[ndof];	
-  P_plus = new double[ndof]; P_minus = new double[ndof];
-  Q_plus = new double[ndof]; Q_minus = new double[ndof];	
-  R_plus = new double[ndof]; R_minus = new double[ndof];
   for(int i=0; i<ndof;i++)
     fct[i]=false;	
   Element* e =NULL;
@@ -103,6 +94,7 @@ void Flux_Correction::init(Space<double>* new_space)
     }
   }
 
+  fct_algebra.set_fct_dofs(fct, ndof);
 }
 
 
@@ -111,49 +103,9 @@ UMFPackMatrix<double>* Flux_Correction::artificialDiffusion(UMFPackMatrix<double
 {
   if(fct==NULL) 
     throw Exceptions::Exception("fct-list=NULL");
-  int size = conv_matrix->get_size();
-  int nnz = conv_matrix->get_nnz();
-  double a,b;
   UMFPackMatrix<double>* diffusion = new UMFPackMatrix<double>;  
-  diffusion->create(size, nnz, conv_matrix->get_Ap(), conv_matrix->get_Ai(),conv_matrix->get_Ax());
-  diffusion->zero();  
-
-  double* Ax = conv_matrix->get_Ax();
-  int* Ai = conv_matrix->get_Ai();
-  int* Ap = conv_matrix->get_Ap();
-
-  for(int j = 0; j<size; j++)
-  { //iterate through columns
-    if(fct[j]== false) continue;
-    for(int indx = Ap[j]; indx<Ap[j+1];indx++)
-    {	
-      int i = Ai[indx];	
-      if(fct[i]== false) continue;
-      if(j<i)
-      {
-        a= -Ax[indx];
-        b= -conv_matrix->get(j,i);     
-        if((a>=b)&&(a>0.0))
-        {
-          diffusion->add(j,i,a);
-          diffusion->add(i,j,a);	
-          diffusion->add(j,j,-a);
-          diffusion->add(i,i,-a);	
-        }
-        else if((b>a)&&(b>0.0))
-        {
-          diffusion->add(i,j,b);
-          diffusion->add(j,i,b);
-          diffusion->add(j,j,-b);
-          diffusion->add(i,i,-b);
-        }
-      }
-    }
-  }
-
-
+  fct_algebra.artificial_diffusion(conv_matrix, diffusion);
   return diffusion;
-
 }
 
 
@@ -162,34 +114,7 @@ UMFPackMatrix<double>* Flux_Correction::massLumping(UMFPackMatrix<double>* mass_
   if(fct==NULL)
     throw Exceptions::Exception("fct-list=NULL");
   UMFPackMatrix<double>* lumped_matrix = new UMFPackMatrix<double>;   //M_L
-  int size = mass_matrix->get_size();
-  int nnz = mass_matrix->get_nnz();
-  lumped_matrix->create(size, nnz, mass_matrix->get_Ap(), mass_matrix->get_Ai(),mass_matrix->get_Ax());
-  double* Ax = lumped_matrix->get_Ax();
-  int* Ai = lumped_matrix->get_Ai();
-  int* Ap = lumped_matrix->get_Ap();
-  double a =0.0;
-
-  for(int j = 0; j<size; j++)
-  { //iterate through columns
-    if(fct[j]== false) continue;
-    for(int indx = Ap[j]; indx<Ap[j+1];indx++)
-    {	
-      int i = Ai[indx];	
-      if(fct[i]== false) continue;
-      if(j<i)
-      {
-        a = Ax[indx];
-        if(a!=0.0)
-        {
-          lumped_matrix->add(i,i,a);    
-          lumped_matrix->add(j,j,a);    
-          lumped_matrix->add(i,j,-a);	  
-          lumped_matrix->add(j,i,-a);	
-        }	
-      }
-    }
-  }
+  fct_algebra.mass_lumping(mass_matrix, lumped_matrix);
   return lumped_matrix;
 }
 
@@ -203,97 +128,7 @@ void Flux_Correction::antidiffusiveFlux(UMFPackMatrix<double>* mass_matrix,UMFPa
   int* smooth_dof =NULL;
   if(regEst!=NULL) smooth_dof = regEst->get_smooth_dofs(space,u_L,mass_matrix);		
 
-  int ndof = conv_matrix->get_size();
-  double alpha,f, plus, minus,mass, diff;
-  double* Ax_mass = mass_matrix->get_Ax();
-  int* Ai_mass = mass_matrix->get_Ai();
-  int* Ap_mass = mass_matrix->get_Ap();
-
-  for(int i=0; i<ndof;i++){ P_plus[i]=0.0; P_minus[i]=0.0; Q_plus[i]=0.; Q_minus[i]=0.; flux_scalar[i]=0.0;}
-
-  //Compute P&Q
-  for(int j = 0; j<ndof; j++)
-  { 
-    if(fct[j]== false) continue;
-    for(int indx = Ap_mass[j]; indx<Ap_mass[j+1];indx++)
-    {	
-      int i = Ai_mass[indx];	
-      if(fct[i]== false) continue;
-      if(((mass=Ax_mass[indx])!=0.)&&(j<i))
-      {
-        diff = diffusion->get(i,j);
-        f = (mass/time_step+ diff*theta)*(u_high[i]- u_high[j])
-          -(mass/time_step - diff*(1.-theta)) *(u_old[i]- u_old[j]);	
-        if( (f*(u_L[j]- u_L[i])) > 0.0) f = 0.0; //prelimiting step										
-        if(f>0.0)	
-        { 
-          P_plus[i]+=f;
-          P_minus[j]-=f;
-        }
-        else if (f<0.0)
-        {
-          P_minus[i]+=f;
-          P_plus[j]-=f;
-        }										
-        f = lumped_matrix->get(i,i)*(u_L[j]-u_L[i])/time_step; 
-        if(f>Q_plus[i]) Q_plus[i] = f;				
-        if(f<Q_minus[i]) Q_minus[i] = f;			
-        f= lumped_matrix->get(j,j)*(u_L[i]-u_L[j])/time_step;
-        if(f>Q_plus[j]) Q_plus[j] = f;	
-        if(f<Q_minus[j]) Q_minus[j] = f;
-      }							
-    }			
-  }
-
-  //Compute R	
-  for(int i=0; i<ndof;i++)
-  {
-    if(fct[i]== false) continue;
-    plus = 1.0; minus = 1.0;		
-    if(P_plus[i]!=0.0)  plus = Q_plus[i]/P_plus[i];		
-    if(P_minus[i]!=0.0) minus = Q_minus[i]/P_minus[i];			
-    if(plus>=1.0) R_plus[i]= 1.0;
-    else 	     R_plus[i]= plus;
-    if(minus>=1.0) R_minus[i]= 1.0;
-    else 	     R_minus[i]= minus;
-    if(smooth_dof!=NULL)
-    {
-      if(smooth_dof[i]==1){ R_plus[i]= 1.0;R_minus[i]= 1.0;}
-    }	
-  }
-
-  //Compute alpha & f_i
-  alpha = 1.0;
-  for(int j = 0; j<ndof; j++)
-  { 
-    if(fct[j]== false) continue;
-    for(int indx = Ap_mass[j]; indx<Ap_mass[j+1];indx++)
-    {	
-      int i = Ai_mass[indx];	
-      if(fct[i]== false) continue;
-      if(((mass=Ax_mass[indx])!=0.)&&(j<i))
-      {
-        diff = diffusion->get(i,j);
-        f = (mass/time_step+ diff*theta)*(u_high[i]- u_high[j])
-          -(mass/time_step - diff*(1.-theta)) *(u_old[i]- u_old[j]);	
-        if( (f*(u_L[j]- u_L[i])) > 0.0) f = 0.0; //prelimiting step										
-        if(f>0.)
-        {					
-          if(R_plus[i]>R_minus[j]) alpha = R_minus[j];
-          else 	alpha = R_plus[i];
-        }
-        else if(f<0.)
-        {
-          if(R_minus[i]>R_plus[j]) alpha = R_plus[j];
-          else 	alpha = R_minus[i]; 
-        }									
-        flux_scalar[i] += alpha*f;
-        flux_scalar[j] -= alpha*f;		
-      }
-    }			
-  }
-
-
+  fct_algebra.antidiffusive_fluxes(mass_matrix, lumped_matrix, diffusion, u_high, u_L, u_old, time_step, flux_scalar, smooth_dof);
 }
 
 //FCT for projection 
@@ -302,101 +137,14 @@ void Flux_Correction::lumped_flux_limiter(UMFPackMatrix<double>* mass_matrix,UMF
   if(fct==NULL) throw Exceptions::Exception("fct-list=NULL");
   int ndof = mass_matrix->get_size();
   double* rhs = new double[ndof];
+  double* flux = new double[ndof];
   lumped_matrix->multiply_with_vector(u_L, rhs); 
 
-  double alpha,f, plus, minus,mass;
-
-  double* Ax_mass = mass_matrix->get_Ax();
-  int* Ai_mass = mass_matrix->get_Ai();
-  int* Ap_mass = mass_matrix->get_Ap();
-
-
-  for(int i=0; i<ndof;i++){ P_plus[i]=0.0;P_minus[i]=0.0;Q_plus[i]=0.;Q_minus[i]=0.;}
-  //Compute P&Q
-  for(int j = 0; j<ndof; j++)
-  { 
-    if(fct[j]== false) continue;
-    for(int indx = Ap_mass[j]; indx<Ap_mass[j+1];indx++)
-    {	
-      int i = Ai_mass[indx];
-      if(fct[i]== false) continue;	
-      if(((mass=Ax_mass[indx])!=0.)&&(j<i))
-      {
-        f = mass*(u_H[i]- u_H[j]);
-        if( (f*(u_L[j]- u_L[i])) > 0.0) f = 0.0; //prelimiting step										
-        if(f>0.0)	
-        { 
-          P_plus[i]+=f;
-          P_minus[j]-=f;
-        }
-        else if(f<0.0)
-        {
-          P_minus[i]+=f;
-          P_plus[j]-=f;
-        }										
-        f = lumped_matrix->get(i,i)*(u_L[j]-u_L[i]); 
-        if(f>Q_plus[i]) Q_plus[i] = f;				
-        if(f<Q_minus[i]) Q_minus[i] = f;			
-        f= lumped_matrix->get(j,j)*(u_L[i]-u_L[j]);
-        if(f>Q_plus[j]) Q_plus[j] = f;	
-        if(f<Q_minus[j]) Q_minus[j] = f;	
-      }
-    }			
-  }
-
-
-  //Compute R
-  for(int i=0; i<ndof;i++)
-  {
-    if(fct[i]== false) continue;	
-    plus = 1.0; minus = 1.0;		
-    if(P_plus[i]!=0.0)  plus = Q_plus[i]/P_plus[i];		
-    if(P_minus[i]!=0.0) minus = Q_minus[i]/P_minus[i];			
-    if(plus>=1.0) R_plus[i]= 1.0;
-    else 	     R_plus[i]= plus;
-    if(minus>=1.0) R_minus[i]= 1.0;
-    else 	     R_minus[i]= minus;	
-    if(smooth_dof!=NULL)
-    {
-      if(smooth_dof[i]==1){ R_plus[i]= 1.0;R_minus[i]= 1.0;}
-    }		
-  }	
-
-  //Compute alpha & f_i
-  alpha = 1.0;
-  for(int j = 0; j<ndof; j++)
-  { 
-    if(fct[j]== false) continue;
-    for(int indx = Ap_mass[j]; indx<Ap_mass[j+1];indx++)
-    {	
-      int i = Ai_mass[indx];	
-      if(fct[i]== false) continue;
-      if(((mass=Ax_mass[indx])!=0.)&&(j<i))
-      {
-        f = mass*(u_H[i]- u_H[j]);
-        if( (f*(u_L[j]- u_L[i])) > 0.0) f = 0.0; //prelimiting step										
-        if(f>0.)
-        {					
-          if(R_plus[i]>R_minus[j]) alpha = R_minus[j];
-          else 	alpha = R_plus[i];
-        }
-        else if(f<0.)
-        {
-          if(R_minus[i]>R_plus[j]) alpha = R_plus[j];
-          else 	alpha = R_minus[i]; 
-        }									
-        rhs[i] += alpha*f;
-        rhs[j] -= alpha*f;									
-
-      }
-    }			
-  }
-
-
+  fct_algebra.projection_fluxes(mass_matrix, lumped_matrix, u_H, u_L, flux, smooth_dof);
+  for(int i=0; i<ndof;i++) rhs[i] += flux[i];
 
   UMFPackVector<double>* vec_rhs = new UMFPackVector<double>(ndof);	
   vec_rhs->zero(); vec_rhs->add_vector(rhs);
-  double* sol =NULL;
   UMFPackLinearMatrixSolver<double>* lowOrd = new UMFPackLinearMatrixSolver<double>(lumped_matrix,vec_rhs);	
   try
   {
@@ -411,6 +159,7 @@ void Flux_Correction::lumped_flux_limiter(UMFPackMatrix<double>* mass_matrix,UMF
 
   delete lowOrd;	
   delete vec_rhs;
+  delete [] flux;
   delete [] rhs;
 }
 
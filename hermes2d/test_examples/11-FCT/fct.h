@@ -36,12 +36,8 @@ double theta;
 	bool* fct;
 	Space<double>* space;
 	AsmList<double>*  al;
-	 double* P_plus; 
-	 double* P_minus; 
-	 double* Q_plus; 
-	 double* Q_minus;  
-	 double* R_plus; 
-	 double* R_minus;
+	/// The limiter over the CSC arrays of the matrices.
+	Hermes::Algebra::FluxCorrectedTransport fct_algebra;
 
 
 
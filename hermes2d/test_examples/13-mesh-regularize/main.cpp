@@ -0,0 +1,108 @@
+#include "hermes2d.h"
+
+using namespace Hermes;
+using namespace Hermes::Hermes2D;
+
+//  This test regularizes a mesh where all the coarse elements need refining in the first pass
+//  of Mesh::regularize(), and checks the resulting mesh and the returned array of parents.
+//
+//  Mesh: square (0, 1) x (0, 1) refined uniformly to a grid of GRID x GRID elements, then
+//  every other element refined twice, leaving two-level hanging nodes on all the edges of the rest.
+//
+//  The following parameters can be changed:
+
+// Number of initial uniform mesh refinements.
+const int INIT_REF_NUM = 4;
+// Number of elements of the grid in each direction, 2^INIT_REF_NUM.
+const int GRID = 16;
+
+// Returns the key of the vertex node in the middle of the edge (p1, p2).
+static std::pair<int, int> edge_key(int p1, int p2)
+{
+  return p1 < p2 ? std::make_pair(p1, p2) : std::make_pair(p2, p1);
+}
+
+int main(int argc, char* argv[])
+{
+  // Load the mesh.
+  Mesh mesh;
+  MeshReaderH2D mloader;
+  mloader.load("square.mesh", &mesh);
+
+  // Perform initial mesh refinements.
+  for (int i = 0; i < INIT_REF_NUM; i++)
+    mesh.refine_all_elements();
+
+  // Refine the elements of the grid in a checkerboard pattern twice.
+  Element* e;
+  Hermes::vector<int> black;
+  for_all_active_elements(e, &mesh)
+  {
+    double x = 0.0, y = 0.0;
+    for (int i = 0; i < e->get_nvert(); i++)
+    {
+      x += e->vn[i]->x / e->get_nvert();
+      y += e->vn[i]->y / e->get_nvert();
+    }
+    if(((int) (x * GRID) + (int) (y * GRID)) % 2 == 0)
+      black.push_back(e->id);
+  }
+  for (unsigned int i = 0; i < black.size(); i++)
+  {
+    mesh.refine_element_id(black[i]);
+    e = mesh.get_element(black[i]);
+    for (int k = 0; k < 4; k++)
+      mesh.refine_element_id(e->sons[k]->id);
+  }
+
+  std::vector<char> was_active(mesh.get_max_element_id(), 0);
+  for_all_active_elements(e, &mesh)
+    was_active[e->id] = 1;
+
+  int* parents = mesh.regularize(1);
+
+  bool success = true;
+
+  // Every element active before the regularization is its own parent, the new ones
+  // have the nearest ancestor that was active before.
+  for_all_active_elements(e, &mesh)
+  {
+    Element* ancestor = e;
+    while (ancestor != NULL && (ancestor->id >= (int) was_active.size() || !was_active[ancestor->id]))
+      ancestor = ancestor->parent;
+    if(ancestor == NULL || parents[e->id] != ancestor->id)
+      success = false;
+  }
+  ::free(parents);
+
+  // No edge of an active element may carry more than one level of hanging nodes.
+  Node* node;
+  std::map<std::pair<int, int>, int> middles;
+  for_all_vertex_nodes(node, &mesh)
+    if(node->p1 >= 0)
+      middles[edge_key(node->p1, node->p2)] = node->id;
+
+  for_all_active_elements(e, &mesh)
+  {
+    for (int i = 0; i < e->get_nvert(); i++)
+    {
+      int v1 = e->vn[i]->id, v2 = e->vn[(i + 1) % e->get_nvert()]->id;
+      std::map<std::pair<int, int>, int>::iterator mid = middles.find(edge_key(v1, v2));
+      if(mid == middles.end())
+        continue;
+      if(middles.count(edge_key(v1, mid->second)) || middles.count(edge_key(mid->second, v2)))
+        success = false;
+    }
+  }
+
+  if(success)
+  {
+    printf("Success!\n");
+    return 0;
+  }
+  else
+  {
+    printf("Failure!\n");
+    return -1;
+  }
+}
@@ -0,0 +1,417 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+/*! \file main.cpp
+\brief Micro-benchmarks of the matrix and solver kernels of HermesCommon.
+
+The matrix kernels work on the pattern of a structured n x n mesh of quadrilaterals with (p + 1)^2 nodal DOFs
+per element (the continuous Q_p elements), the local blocks are those of an SPD matrix. The solvers are measured
+on a matrix and a right-hand side dumped in DF_HERMES_BIN (--matrix, --rhs), or on the matrix of the pattern.
+
+Parameters:
+  --n N ... elements in each direction (default 200),
+  --p N ... polynomial degree (default 2),
+  --threads N ... threads of the threaded variants (default omp_get_max_threads()),
+  --repeat N ... measured repetitions of every kernel (default 5), the minimum and the median are reported,
+  --matrix file --rhs file ... the system for the solvers,
+  --output file ... JSON results (default hermes_common-benchmarks.json).
+*/
+#include "hermes_common.h"
+#include <algorithm>
+#include <fstream>
+
+using namespace Hermes;
+using namespace Hermes::Algebra;
+using namespace Hermes::Algebra::DenseMatrixOperations;
+using namespace Hermes::Solvers;
+
+/// Times of the repetitions of one kernel.
+struct KernelResult
+{
+  std::string name;
+  std::vector<double> times;
+  /// The amount of work of one repetition (entries added, nonzeros multiplied, ...) for the throughput.
+  double work;
+  std::string work_unit;
+};
+
+/// The mesh pattern: element e has the DOFs dofs[e * nloc], ..., dofs[e * nloc + nloc - 1].
+struct Pattern
+{
+  int ndof;
+  int nelem;
+  int nloc;
+  std::vector<int> dofs;
+  /// The local block (the same for all the elements).
+  double** block;
+};
+
+static void build_pattern(Pattern& pattern, int n, int p)
+{
+  int row_length = n * p + 1;
+  pattern.ndof = row_length * row_length;
+  pattern.nelem = n * n;
+  pattern.nloc = (p + 1) * (p + 1);
+  pattern.dofs.resize(pattern.nelem * pattern.nloc);
+  for(int i = 0; i < n; i++)
+    for(int j = 0; j < n; j++)
+      for(int a = 0; a <= p; a++)
+        for(int b = 0; b <= p; b++)
+          pattern.dofs[(i * n + j) * pattern.nloc + a * (p + 1) + b] = (i * p + a) * row_length + j * p + b;
+
+  // (nloc + 1) I - J is positive definite (eigenvalues 1 and nloc + 1), so is the assembled matrix.
+  pattern.block = new_matrix<double>(pattern.nloc, pattern.nloc);
+  for(int i = 0; i < pattern.nloc; i++)
+    for(int j = 0; j < pattern.nloc; j++)
+      pattern.block[i][j] = (i == j) ? pattern.nloc : -1.0;
+}
+
+static void build_structure(SparseMatrix<double>* matrix, const Pattern& pattern)
+{
+  matrix->prealloc(pattern.ndof);
+  for(int e = 0; e < pattern.nelem; e++)
+  {
+    const int* dofs = &pattern.dofs[e * pattern.nloc];
+    for(int i = 0; i < pattern.nloc; i++)
+      for(int j = 0; j < pattern.nloc; j++)
+        matrix->pre_add_ij(dofs[i], dofs[j]);
+  }
+  matrix->alloc();
+}
+
+/// The CSC arrays of the pattern built directly (sorted unique rows of every column), as create_structure() takes them.
+static void build_csc_arrays(const Pattern& pattern, std::vector<int>& Ap, std::vector<int>& Ai)
+{
+  std::vector<std::vector<int> > columns(pattern.ndof);
+  for(int e = 0; e < pattern.nelem; e++)
+  {
+    const int* dofs = &pattern.dofs[e * pattern.nloc];
+    for(int j = 0; j < pattern.nloc; j++)
+      for(int i = 0; i < pattern.nloc; i++)
+        columns[dofs[j]].push_back(dofs[i]);
+  }
+  Ap.assign(pattern.ndof + 1, 0);
+  Ai.clear();
+  for(int col = 0; col < pattern.ndof; col++)
+  {
+    std::sort(columns[col].begin(), columns[col].end());
+    columns[col].erase(std::unique(columns[col].begin(), columns[col].end()), columns[col].end());
+    Ai.insert(Ai.end(), columns[col].begin(), columns[col].end());
+    Ap[col + 1] = (int) Ai.size();
+  }
+}
+
+static void add_blocks(SparseMatrix<double>* matrix, const Pattern& pattern, int threads)
+{
+#pragma omp parallel for num_threads(threads) schedule(static)
+  for(int e = 0; e < pattern.nelem; e++)
+  {
+    int* dofs = const_cast<int*>(&pattern.dofs[e * pattern.nloc]);
+    matrix->add(pattern.nloc, pattern.nloc, pattern.block, dofs, dofs);
+  }
+  matrix->finish();
+}
+
+static void add_vector_blocks(Vector<double>* vector, const Pattern& pattern, const std::vector<double>& values, int threads)
+{
+#pragma omp parallel for num_threads(threads) schedule(static)
+  for(int e = 0; e < pattern.nelem; e++)
+  {
+    unsigned int* dofs = (unsigned int*) &pattern.dofs[e * pattern.nloc];
+    vector->add(pattern.nloc, dofs, const_cast<double*>(&values[0]));
+  }
+  vector->finish();
+}
+
+class Harness
+{
+public:
+  Harness(int repeat) : repeat(repeat) {}
+
+  /// Measures kernel (a functor) repeat times, setup (called before every repetition) is not measured.
+  template<typename Setup, typename Kernel>
+  void run(const std::string& name, double work, const char* work_unit, Setup setup, Kernel kernel)
+  {
+    KernelResult result;
+    result.name = name;
+    result.work = work;
+    result.work_unit = work_unit;
+    for(int i = 0; i < this->repeat; i++)
+    {
+      setup();
+      double start = omp_get_wtime();
+      kernel();
+      result.times.push_back(omp_get_wtime() - start);
+    }
+    std::sort(result.times.begin(), result.times.end());
+    std::cout << name << ": min " << result.times.front() << " s, median " << result.times[result.times.size() / 2] << " s" << std::endl;
+    this->results.push_back(result);
+  }
+
+  void save(const char* filename, int n, int p, int threads, int ndof, int nnz) const
+  {
+    std::ofstream out(filename);
+    if(!out)
+      throw Exceptions::Exception("Could not open %s for writing.", filename);
+    out.precision(9);
+    out << "{\n";
+    out << "  \"parameters\": { \"n\": " << n << ", \"p\": " << p << ", \"threads\": " << threads << ", \"repeat\": " << this->repeat
+      << ", \"ndof\": " << ndof << ", \"nnz\": " << nnz << " },\n";
+    out << "  \"kernels\": [\n";
+    for(unsigned int i = 0; i < this->results.size(); i++)
+    {
+      const KernelResult& result = this->results[i];
+      double min = result.times.front(), median = result.times[result.times.size() / 2];
+      out << "    { \"name\": \"" << result.name << "\", \"min\": " << min << ", \"median\": " << median
+        << ", \"max\": " << result.times.back() << ", \"work\": " << result.work << ", \"work_unit\": \"" << result.work_unit
+        << "\", \"throughput\": " << (min > 0.0 ? result.work / min : 0.0) << " }" << (i + 1 < this->results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+  }
+
+private:
+  int repeat;
+  std::vector<KernelResult> results;
+};
+
+// The functors of the kernels (no lambdas - C++98).
+struct Nothing { void operator()() const {} };
+
+struct BuildStructure
+{
+  BuildStructure(CSCMatrix<double>* matrix, const Pattern& pattern) : matrix(matrix), pattern(pattern) {}
+  void operator()() const { build_structure(matrix, pattern); }
+  CSCMatrix<double>* matrix;
+  const Pattern& pattern;
+};
+
+struct CreateStructure
+{
+  CreateStructure(CSCMatrix<double>* matrix, const Pattern& pattern) : matrix(matrix), pattern(pattern) {}
+  void operator()() const
+  {
+    std::vector<int> Ap, Ai;
+    build_csc_arrays(pattern, Ap, Ai);
+    matrix->create_structure(pattern.ndof, &Ap[0], &Ai[0]);
+  }
+  CSCMatrix<double>* matrix;
+  const Pattern& pattern;
+};
+
+struct FreeMatrix
+{
+  FreeMatrix(SparseMatrix<double>* matrix) : matrix(matrix) {}
+  void operator()() const { matrix->free(); }
+  SparseMatrix<double>* matrix;
+};
+
+struct ZeroMatrix
+{
+  ZeroMatrix(SparseMatrix<double>* matrix) : matrix(matrix) {}
+  void operator()() const { matrix->zero(); }
+  SparseMatrix<double>* matrix;
+};
+
+struct AddBlocks
+{
+  AddBlocks(SparseMatrix<double>* matrix, const Pattern& pattern, int threads) : matrix(matrix), pattern(pattern), threads(threads) {}
+  void operator()() const { add_blocks(matrix, pattern, threads); }
+  SparseMatrix<double>* matrix;
+  const Pattern& pattern;
+  int threads;
+};
+
+struct Multiply
+{
+  Multiply(CSCMatrix<double>* matrix, double* in, double* out) : matrix(matrix), in(in), out(out) {}
+  void operator()() const { matrix->multiply_with_vector(in, out); }
+  CSCMatrix<double>* matrix;
+  double* in;
+  double* out;
+};
+
+struct ZeroVector
+{
+  ZeroVector(Vector<double>* vector) : vector(vector) {}
+  void operator()() const { vector->zero(); }
+  Vector<double>* vector;
+};
+
+struct AddVectorBlocks
+{
+  AddVectorBlocks(Vector<double>* vector, const Pattern& pattern, const std::vector<double>& values, int threads) : vector(vector), pattern(pattern), values(values), threads(threads) {}
+  void operator()() const { add_vector_blocks(vector, pattern, values, threads); }
+  Vector<double>* vector;
+  const Pattern& pattern;
+  const std::vector<double>& values;
+  int threads;
+};
+
+struct Solve
+{
+  Solve(LinearMatrixSolver<double>* solver) : solver(solver) {}
+  void operator()() const
+  {
+    if(!solver->solve())
+      throw Exceptions::Exception("The solver failed.");
+  }
+  LinearMatrixSolver<double>* solver;
+};
+
+struct SetScheme
+{
+  SetScheme(LinearMatrixSolver<double>* solver, FactorizationScheme scheme) : solver(solver), scheme(scheme) {}
+  void operator()() const { solver->set_factorization_scheme(scheme); }
+  LinearMatrixSolver<double>* solver;
+  FactorizationScheme scheme;
+};
+
+/// Copies the CSC matrix and the vector to the types of the current solver (HermesCommonApi matrixSolverType).
+static void copy_system(CSCMatrix<double>* csc, Vector<double>* rhs, SparseMatrix<double>* matrix, Vector<double>* vector)
+{
+  int n = csc->get_size();
+  matrix->create_structure(n, csc->get_Ap(), csc->get_Ai());
+  for(int col = 0; col < n; col++)
+    for(int k = csc->get_Ap()[col]; k < csc->get_Ap()[col + 1]; k++)
+      matrix->add(csc->get_Ai()[k], col, csc->get_Ax()[k]);
+  matrix->finish();
+  vector->alloc(n);
+  for(int i = 0; i < n; i++)
+    vector->add(i, rhs->get(i));
+  vector->finish();
+}
+
+int main(int argc, char* argv[])
+{
+  int n = 200, p = 2, threads = omp_get_max_threads(), repeat = 5;
+  const char* matrix_file = NULL;
+  const char* rhs_file = NULL;
+  const char* output = "hermes_common-benchmarks.json";
+
+  try
+  {
+    for(int i = 1; i < argc; i++)
+    {
+      std::string arg(argv[i]);
+      if(i + 1 == argc)
+        throw Exceptions::Exception("Missing value of the parameter %s.", argv[i]);
+      if(arg == "--n")
+        n = atoi(argv[++i]);
+      else if(arg == "--p")
+        p = atoi(argv[++i]);
+      else if(arg == "--threads")
+        threads = atoi(argv[++i]);
+      else if(arg == "--repeat")
+        repeat = atoi(argv[++i]);
+      else if(arg == "--matrix")
+        matrix_file = argv[++i];
+      else if(arg == "--rhs")
+        rhs_file = argv[++i];
+      else if(arg == "--output")
+        output = argv[++i];
+      else
+        throw Exceptions::Exception("Unknown parameter %s.", argv[i]);
+    }
+    if(n < 1 || p < 1 || threads < 1 || repeat < 1 || ((matrix_file == NULL) != (rhs_file == NULL)))
+      throw Exceptions::Exception("Invalid parameters.");
+
+    Pattern pattern;
+    build_pattern(pattern, n, p);
+    double entries = (double) pattern.nelem * pattern.nloc * pattern.nloc;
+    Harness harness(repeat);
+
+    // Sparse structure.
+    CSCMatrix<double> matrix;
+    harness.run("pattern_pre_add_ij", entries, "entries", FreeMatrix(&matrix), BuildStructure(&matrix, pattern));
+    harness.run("pattern_create_structure", entries, "entries", FreeMatrix(&matrix), CreateStructure(&matrix, pattern));
+    int nnz = matrix.get_nnz();
+
+    // CSCMatrix::add() of the local blocks.
+    harness.run("csc_add_serial", entries, "entries", ZeroMatrix(&matrix), AddBlocks(&matrix, pattern, 1));
+    harness.run("csc_add_threaded", entries, "entries", ZeroMatrix(&matrix), AddBlocks(&matrix, pattern, threads));
+
+    // Matrix-vector product.
+    std::vector<double> in(pattern.ndof, 1.0), out(pattern.ndof, 0.0);
+    harness.run("csc_multiply_with_vector", nnz, "nonzeros", Nothing(), Multiply(&matrix, &in[0], &out[0]));
+
+    // UMFPackVector::add() of the local vectors.
+    UMFPackVector<double> vector(pattern.ndof);
+    std::vector<double> local_values(pattern.nloc, 1.0);
+    double vector_entries = (double) pattern.nelem * pattern.nloc;
+    harness.run("umfpack_vector_add_serial", vector_entries, "entries", ZeroVector(&vector), AddVectorBlocks(&vector, pattern, local_values, 1));
+    harness.run("umfpack_vector_add_threaded", vector_entries, "entries", ZeroVector(&vector), AddVectorBlocks(&vector, pattern, local_values, threads));
+
+    // The system for the solvers - loaded, or the one of the pattern with the right-hand side of ones.
+    CSCMatrix<double> system_matrix;
+    UMFPackVector<double> system_rhs;
+    if(matrix_file != NULL)
+    {
+      system_matrix.load(matrix_file);
+      system_rhs.load(rhs_file);
+    }
+    else
+    {
+      std::vector<int> Ap, Ai;
+      build_csc_arrays(pattern, Ap, Ai);
+      system_matrix.create_structure(pattern.ndof, &Ap[0], &Ai[0]);
+      add_blocks(&system_matrix, pattern, threads);
+      system_rhs.alloc(pattern.ndof);
+      for(int i = 0; i < pattern.ndof; i++)
+        system_rhs.set(i, 1.0);
+    }
+
+    // Every backend built in: the first solve factorizes, the others reuse the factorization.
+    const MatrixSolverType solver_types[] = { SOLVER_UMFPACK, SOLVER_SUPERLU, SOLVER_MUMPS, SOLVER_PETSC, SOLVER_AMESOS, SOLVER_AZTECOO, SOLVER_KRYLOV };
+    const char* solver_names[] = { "umfpack", "superlu", "mumps", "petsc", "amesos", "aztecoo", "krylov" };
+    for(unsigned int solver_i = 0; solver_i < sizeof(solver_types) / sizeof(MatrixSolverType); solver_i++)
+    {
+      HermesCommonApi.set_integral_param_value(matrixSolverType, solver_types[solver_i]);
+      SparseMatrix<double>* solver_matrix;
+      try
+      {
+        solver_matrix = create_matrix<double>();
+      }
+      catch(Exceptions::Exception&)
+      {
+        // Not built in.
+        continue;
+      }
+      Vector<double>* solver_rhs = create_vector<double>();
+      copy_system(&system_matrix, &system_rhs, solver_matrix, solver_rhs);
+      LinearMatrixSolver<double>* solver = create_linear_solver<double>(solver_matrix, solver_rhs);
+
+      std::string name = std::string("solver_") + solver_names[solver_i];
+      harness.run(name + "_factorize_solve", system_matrix.get_nnz(), "nonzeros", SetScheme(solver, HERMES_FACTORIZE_FROM_SCRATCH), Solve(solver));
+      harness.run(name + "_solve", system_matrix.get_nnz(), "nonzeros", SetScheme(solver, HERMES_REUSE_FACTORIZATION_COMPLETELY), Solve(solver));
+
+      delete solver;
+      delete solver_matrix;
+      delete solver_rhs;
+    }
+
+    harness.save(output, n, p, threads, pattern.ndof, nnz);
+    delete [] pattern.block;
+  }
+  catch(std::exception& e)
+  {
+    std::cout << e.what() << std::endl;
+    return -1;
+  }
+  return 0;
+}
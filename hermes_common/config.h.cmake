@@ -11,11 +11,16 @@
 
 #cmakedefine WITH_UMFPACK
 #cmakedefine WITH_MUMPS
+#cmakedefine WITH_MUMPS_MIXED_PRECISION
 #cmakedefine WITH_SUPERLU
 #cmakedefine WITH_PETSC
 #cmakedefine WITH_HDF5
 #cmakedefine WITH_EXODUSII
+#cmakedefine WITH_ZLIB
+#cmakedefine WITH_NUMA
+#cmakedefine WITH_CUDA
 #cmakedefine WITH_MPI
+#cmakedefine WITH_METIS
 
 // stacktrace
 #cmakedefine WITH_STACKTRACE
@@ -35,6 +40,9 @@
 // no logo
 #cmakedefine HERMES_NO_LOGO
 
+// the most detailed messages compiled in
+#cmakedefine HERMES_LOG_LEVEL ${HERMES_LOG_LEVEL}
+
 // GLUT
 #cmakedefine NOGLUT
 
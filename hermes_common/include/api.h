@@ -24,6 +24,7 @@
 
 #include "compat.h"
 #include <map>
+#include <vector>
 
 namespace Hermes
 {
@@ -31,7 +32,22 @@ namespace Hermes
   enum HermesCommonApiParam
   {
     exceptionsPrintCallstack,
-    matrixSolverType
+    matrixSolverType,
+    /// Threads of the direct solvers that can use them (SuperLU_MT), 0 (default) means omp_get_max_threads().
+    /// Set also by Hermes2DApi numThreads, so that the solve uses the threads of the assembly.
+    matrixSolverNumThreads,
+    /// Placement of the pages of the matrix values and of the vectors on the NUMA nodes (NumaPlacement),
+    /// HERMES_NUMA_FIRST_TOUCH by default.
+    numaPlacement
+  };
+
+  /// Values of the parameter numaPlacement.
+  enum NumaPlacement
+  {
+    /// The threads zero the parts of the new arrays they work on (static schedule), the pages are placed on their nodes.
+    HERMES_NUMA_FIRST_TOUCH = 0,
+    /// The pages are spread round-robin over all the nodes (needs WITH_NUMA, first touch otherwise).
+    HERMES_NUMA_INTERLEAVED = 1
   };
 
   /// API Class containing settings for the whole HermesCommon.
@@ -56,11 +72,40 @@ namespace Hermes
     /// The storage of parameters.
     /// This storage is not optimized for speed, but for comfort of users.
     /// There should not be any parameters, values of which are sought very often, because of the above reason.
+    /// The ones that are have the cached typed accessors below.
     std::map<HermesCommonApiParam, Parameter*> parameters;
 
   public:
     int get_integral_param_value(HermesCommonApiParam);
     void set_integral_param_value(HermesCommonApiParam, int value);
+
+    /// Typed accessors of the parameters read in the hot paths (matrix and solver creation).
+    /// The values are cached when set, no lookup in the storage.
+    /// The value of matrixSolverType (a MatrixSolverType).
+    int get_matrix_solver_type() const { return this->matrix_solver_type; }
+    /// The value of matrixSolverNumThreads.
+    int get_matrix_solver_num_threads() const { return this->matrix_solver_num_threads; }
+    /// The value of exceptionsPrintCallstack.
+    bool get_exceptions_print_callstack() const { return this->exceptions_print_callstack; }
+    /// The value of numaPlacement.
+    int get_numa_placement() const { return this->numa_placement; }
+
+    /// Change notification: the callback is called with the parameter, its new value and data after every
+    /// set_integral_param_value(), e.g. for the values cached outside of the Api.
+    typedef void (*ParamChangedCallback)(HermesCommonApiParam param, int value, void* data);
+    void add_param_changed_callback(ParamChangedCallback callback, void* data = NULL);
+    void remove_param_changed_callback(ParamChangedCallback callback, void* data = NULL);
+
+  private:
+    /// Refreshes the cached values from the storage.
+    void update_cached_values();
+
+    int matrix_solver_type;
+    int matrix_solver_num_threads;
+    bool exceptions_print_callstack;
+    int numa_placement;
+
+    std::vector<std::pair<ParamChangedCallback, void*> > param_changed_callbacks;
   };
 
   /// Global instance used inside Hermes which is also accessible to users.
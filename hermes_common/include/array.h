@@ -19,6 +19,7 @@
 #define __HERMES_COMMON_ARRAY_H
 
 #include <vector>
+#include <algorithm>
 #include <limits.h>
 
 #ifndef INVALID_IDX
@@ -35,6 +36,8 @@ namespace Hermes
     /// a list of unused items is maintained. Unused items (and their id numbers) are
     /// reused when new items are added to the array. The type 'TYPE' must contain the
     /// members 'id' and 'unused' in order to be usable by this class.
+    /// The numbers of the used items of the pages are kept, copy() copies only the ids of the pages without used items
+    /// (e.g. left by unrefinements), and defragment() moves the used items to the lowest ids (see Mesh::defragment()).
     /// \todo Is this dimension independent?
     template<class TYPE>
     class Array
@@ -42,6 +45,8 @@ namespace Hermes
     protected:
       Hermes::vector<TYPE*> pages; ///< \todo standard array for maximum access speed
       Hermes::vector<int> unused;
+      /// Number of the used items of every page (pages may be allocated beyond size, see reserve()).
+      Hermes::vector<int> page_items;
       int  size, nitems;
       bool append_only;
 
@@ -62,21 +67,33 @@ namespace Hermes
       ~Array() { free(); }
 
       /// Makes this array to hold a copy of another one.
+      /// Of the pages without used items only the ids and the usage flags are set (they are what add() reuses).
       void copy(const Array& array)
       {
         free();
 
-        pages = array.pages;
         unused = array.unused;
         size = array.size;
         nitems = array.nitems;
         append_only = array.append_only;
 
-        for (unsigned i = 0; i < pages.size(); i++)
+        // The pages reserved beyond size are not copied.
+        int num_pages = (size + HERMES_PAGE_MASK) >> HERMES_PAGE_BITS;
+        page_items.assign(array.page_items.begin(), array.page_items.begin() + num_pages);
+        for (int i = 0; i < num_pages; i++)
         {
           TYPE* new_page = new TYPE[HERMES_PAGE_SIZE];
-          memcpy(new_page, pages[i], sizeof(TYPE) * HERMES_PAGE_SIZE);
-          pages[i] = new_page;
+          if(page_items[i] > 0)
+            memcpy(new_page, array.pages[i], sizeof(TYPE) * HERMES_PAGE_SIZE);
+          else
+          {
+            for (int j = 0; j < HERMES_PAGE_SIZE; j++)
+            {
+              new_page[j].id = (i << HERMES_PAGE_BITS) + j;
+              new_page[j].used = 0;
+            }
+          }
+          pages.push_back(new_page);
         }
       }
 
@@ -86,9 +103,34 @@ namespace Hermes
         for (unsigned i = 0; i < pages.size(); i++) delete [] pages[i];
         pages.clear();
         unused.clear();
+        page_items.clear();
         size = nitems = 0;
       }
 
+      /// Allocates the pages for count new items at once (those not taking the unused ones), so that the following
+      /// add() calls do not allocate (e.g. for the sons of a batch of refined elements).
+      void reserve(int count)
+      {
+        int appended = append_only ? count : count - (int)unused.size();
+        if(appended <= 0)
+          return;
+        int num_pages = (size + appended + HERMES_PAGE_MASK) >> HERMES_PAGE_BITS;
+        pages.reserve(num_pages);
+        while ((int)pages.size() < num_pages)
+        {
+          pages.push_back(new TYPE[HERMES_PAGE_SIZE]);
+          page_items.push_back(0);
+        }
+      }
+
+      /// Adds count new items (as add() one by one would), their pointers stored to items.
+      void add(int count, TYPE** items)
+      {
+        reserve(count);
+        for (int i = 0; i < count; i++)
+          items[i] = add();
+      }
+
       /// Sets or resets the append-only mode. In append-only mode new
       /// elements are only added to the end of the array.
       /// This can be useful eg. when refining all elements of a mesh
@@ -116,10 +158,11 @@ namespace Hermes
         TYPE* item;
         if (unused.empty() || append_only)
         {
-          if (!(size & HERMES_PAGE_MASK))
+          if ((size >> HERMES_PAGE_BITS) >= (int)pages.size())
           {
             TYPE* new_page = new TYPE[HERMES_PAGE_SIZE];
             pages.push_back(new_page);
+            page_items.push_back(0);
           }
           item = pages[size >> HERMES_PAGE_BITS] + (size & HERMES_PAGE_MASK);
           item->id = size++;
@@ -132,6 +175,7 @@ namespace Hermes
           item = pages[id >> HERMES_PAGE_BITS] + (id & HERMES_PAGE_MASK);
           item->used = 1;
         }
+        page_items[item->id >> HERMES_PAGE_BITS]++;
         nitems++;
         return item;
       }
@@ -147,9 +191,64 @@ namespace Hermes
         assert(item->used);
         item->used = 0;
         unused.push_back(id);
+        page_items[id >> HERMES_PAGE_BITS]--;
         nitems--;
       }
 
+      /// The compaction of the items with ids >= start: new_ids[id] is the id the item id gets (the used items keep
+      /// their order and those below start their ids), -1 for the unused ones. Nothing is moved, see defragment().
+      void get_defragmented_ids(int start, std::vector<int>& new_ids) const
+      {
+        new_ids.resize(size);
+        int next_id = start;
+        for (int id = 0; id < size; id++)
+        {
+          if(!get(id).used)
+            new_ids[id] = -1;
+          else
+            new_ids[id] = (id < start) ? id : next_id++;
+        }
+      }
+
+      /// Moves the items to the ids of get_defragmented_ids(start, new_ids), and frees the pages left empty at the end.
+      /// Only the ids of the items change, the references to them (the pointers, the ids) are to be updated by the caller.
+      void defragment(int start, const std::vector<int>& new_ids)
+      {
+        int new_size = std::min(start, size);
+        for (int id = 0; id < size; id++)
+        {
+          int new_id = new_ids[id];
+          if(new_id < 0)
+            continue;
+          if(new_id != id)
+          {
+            TYPE& item = get(new_id);
+            item = get(id);
+            item.id = new_id;
+            get(id).used = 0;
+          }
+          if(new_id >= new_size)
+            new_size = new_id + 1;
+        }
+
+        int num_pages = (new_size + HERMES_PAGE_MASK) >> HERMES_PAGE_BITS;
+        for (unsigned int i = num_pages; i < pages.size(); i++)
+          delete [] pages[i];
+        pages.resize(num_pages);
+        size = new_size;
+
+        // Only the unused ids below start remain.
+        unused.clear();
+        page_items.assign(num_pages, 0);
+        for (int id = 0; id < size; id++)
+        {
+          if(get(id).used)
+            page_items[id >> HERMES_PAGE_BITS]++;
+          else
+            unused.push_back(id);
+        }
+      }
+
       // Iterators
 
       /// Get the first index that is present and is equal to or greater than the passed \c idx.
@@ -240,6 +339,7 @@ namespace Hermes
           TYPE* new_page = new TYPE[HERMES_PAGE_SIZE];
           memset(new_page, 0, sizeof(TYPE) * HERMES_PAGE_SIZE);
           pages.push_back(new_page);
+          page_items.push_back(0);
           size -= HERMES_PAGE_SIZE;
         }
         this->size = pages.size() * HERMES_PAGE_SIZE;
@@ -252,7 +352,11 @@ namespace Hermes
       {
         nitems = 0;
         for (int i = start; i < size; i++)
-          if (get(i).used) nitems++;
+          if (get(i).used)
+          {
+            nitems++;
+            page_items[i >> HERMES_PAGE_BITS]++;
+          }
           else unused.push_back(i);
       }
 
@@ -260,10 +364,11 @@ namespace Hermes
       /// This is a special-purpose function used to create empty element slots.
       void skip_slot()
       {
-        if (!(size & HERMES_PAGE_MASK))
+        if ((size >> HERMES_PAGE_BITS) >= (int)pages.size())
         {
           TYPE* new_page = new TYPE[HERMES_PAGE_SIZE];
           pages.push_back(new_page);
+          page_items.push_back(0);
         }
         TYPE* item = pages[size >> HERMES_PAGE_BITS] + (size & HERMES_PAGE_MASK);
         item->id = size++;
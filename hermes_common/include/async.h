@@ -0,0 +1,83 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file async.h
+\brief Asynchronous tasks (futures) and their dependencies, for pipelining independent stages.
+*/
+#ifndef __HERMES_COMMON_ASYNC_H
+#define __HERMES_COMMON_ASYNC_H
+
+#include "common.h"
+#include "exceptions.h"
+
+namespace Hermes
+{
+  /// \brief A task running on its own thread - the future of an asynchronous call
+  /// (e.g. DiscreteProblem::assemble_async(), LinearMatrixSolver::solve_async()).
+  ///
+  /// The tasks form a graph through depends_on(): a started task waits for its dependencies before it runs,
+  /// so e.g. the assembling of the next block may run while the previous block is being factorized and the solve
+  /// of the next block waits for both. The task parallelizes inside itself as usual (OpenMP), the threads of the
+  /// tasks running at the same time share the cores.
+  /// The objects the task works on must not be touched by other threads until wait() returns.
+  ///
+  /// Derived classes implement run() and call join() in their destructors (before their members are destroyed).
+  class HERMES_API AsyncTask
+  {
+  public:
+    AsyncTask();
+    /// Waits for the task, its exception (if any) is not rethrown.
+    virtual ~AsyncTask();
+
+    /// The task starts running only after the task finished. Called before start().
+    void depends_on(AsyncTask* task);
+
+    /// Starts the task on a new thread.
+    void start();
+
+    /// Waits until the task finished and rethrows its exception (also if a dependency failed).
+    void wait();
+
+    /// The task has finished (successfully or not).
+    bool is_finished();
+
+    /// Starts all the tasks (not started yet) and waits for all of them, rethrows the first exception.
+    static void run_all(std::vector<AsyncTask*>& tasks);
+
+  protected:
+    /// The work of the task.
+    virtual void run() = 0;
+
+    /// Waits until the task finished, without rethrowing its exception.
+    void join();
+
+  private:
+    static void* thread_function(void* data);
+
+    std::vector<AsyncTask*> dependencies;
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t finished_condition;
+    bool started;
+    bool finished;
+    bool joined;
+    /// The exception of run() (or of a dependency), NULL if there was none.
+    Hermes::Exceptions::Exception* caught_exception;
+  };
+}
+#endif
@@ -60,6 +60,13 @@
 #else
   inline int omp_get_num_threads( ) { return 1; }
   inline int omp_get_thread_num( ) { return 0; }
+  inline int omp_get_max_threads( ) { return 1; }
+  inline double omp_get_wtime( ) { return (double) clock() / CLOCKS_PER_SEC; }
+  typedef int omp_lock_t;
+  inline void omp_init_lock(omp_lock_t*) { }
+  inline void omp_destroy_lock(omp_lock_t*) { }
+  inline void omp_set_lock(omp_lock_t*) { }
+  inline void omp_unset_lock(omp_lock_t*) { }
 #endif
 
 typedef int int2[2];
@@ -167,6 +174,15 @@ namespace Hermes
   #define HERMES_EC_WARNING 'W' ///< An event code: warnings. \internal
   #define HERMES_EC_INFO 'I' ///< An event code: info about results. \internal
 
+  /* log levels */
+  #define HERMES_LOG_LEVEL_ERROR 1 ///< A log level: errors only. \internal
+  #define HERMES_LOG_LEVEL_WARNING 2 ///< A log level: errors and warnings. \internal
+  #define HERMES_LOG_LEVEL_INFO 3 ///< A log level: all messages. \internal
+  /// The most detailed messages compiled in, the other ones are skipped without formatting. \internal \ingroup g_logging
+  #ifndef HERMES_LOG_LEVEL
+  #  define HERMES_LOG_LEVEL HERMES_LOG_LEVEL_INFO
+  #endif
+
   /// A size of a delimiter in a log file. \internal \ingroup g_logging
   #define HERMES_LOG_FILE_DELIM_SIZE 80
   #define BUF_SZ 2048
@@ -24,6 +24,7 @@
 #include "solvers/nonlinear_solver.h"
 #include "solvers/amesos_solver.h"
 #include "solvers/aztecoo_solver.h"
+#include "solvers/krylov_solver.h"
 #include "solvers/epetra.h"
 #include "solvers/mumps_solver.h"
 #include "solvers/newton_solver_nox.h"
@@ -31,13 +32,17 @@
 #include "solvers/umfpack_solver.h"
 #include "solvers/superlu_solver.h"
 #include "solvers/precond.h"
+#include "solvers/precond_saddle_point.h"
 #include "solvers/precond_ifpack.h"
 #include "solvers/precond_ml.h"
 #include "solvers/eigensolver.h"
+#include "solvers/flux_corrected_transport.h"
 #include "hermes_function.h"
 #include "compat.h"
 #include "callstack.h"
 #include "vector.h"
+#include "vector_kernels.h"
+#include "async.h"
 #include "tables.h"
 #include "array.h"
 #include "qsort.h"
@@ -60,6 +60,13 @@ namespace Hermes
     /// One-dimensional function derivative integration order.
     virtual Hermes::Ord derivative(Hermes::Ord x) const;
 
+    /// Values in n points at once, out[i] = value(x[i]) - one virtual call per batch (e.g. all the quadrature points
+    /// of an element). The default calls value() per point, descendants evaluated very often override it.
+    virtual void values(int n, const Scalar* x, Scalar* out) const;
+
+    /// Derivatives in n points at once, out[i] = derivative(x[i]), see values().
+    virtual void derivatives(int n, const Scalar* x, Scalar* out) const;
+
     /// The function is constant.
     /// Returns the value of is_const.
     bool is_constant() const;
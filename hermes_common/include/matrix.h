@@ -36,7 +36,9 @@ namespace Hermes
     SOLVER_MUMPS,
     SOLVER_SUPERLU,
     SOLVER_AMESOS,
-    SOLVER_AZTECOO
+    SOLVER_AZTECOO,
+    /// The built-in Krylov solvers (Solvers::KrylovSolver) over SELLMatrix / SimpleVector, no external library needed.
+    SOLVER_KRYLOV
   };
 
   /// \brief Namespace containing classes for vector / matrix operations.
@@ -271,7 +273,10 @@ namespace Hermes
       /// next lines contains row column and value
       DF_PLAIN_ASCII,
       /// \brief Hermes binary format
-      ///
+      /// The arrays as they are in memory (native byte order), written by one fwrite each, after a 64-byte header
+      /// ("HERMESX" / "HERMESR" + version byte 2, sizeof(Scalar), size and nnz as ints). Every array starts at a multiple
+      /// of 64 bytes, the file can be mapped to memory and used without parsing (CSCMatrix::load(), UMFPackVector::load()).
+      /// Matrix: Ap, Ai, Ax (CSC), vector: the values.
       DF_HERMES_BIN,
       DF_MATRIX_MARKET ///< Matrix Market which can be read by pysparse library
     };
@@ -287,11 +292,15 @@ namespace Hermes
 
       /// constructor of matrix
       /// @param[in] size size of matrix
-      Matrix(unsigned int size) { this->size = size;};
+      Matrix(unsigned int size) { this->size = size; this->conflict_free_assembly = false;};
 
       virtual ~Matrix() {};
 
-      Matrix() { this->size = 0;};
+      Matrix() { this->size = 0; this->conflict_free_assembly = false;};
+
+      /// Promise that no two threads will add() to the same row at the same time (e.g. a coloured assembly),
+      /// so the matrix types synchronizing add() may skip the synchronization.
+      void set_conflict_free_assembly(bool to_set = true) { this->conflict_free_assembly = to_set; }
 
       /// allocate the memory for stiffness matrix and right-hand side
       virtual void alloc() = 0;
@@ -341,6 +350,9 @@ namespace Hermes
     protected:
 
       unsigned int size;  ///< matrix size
+
+      /// See set_conflict_free_assembly().
+      bool conflict_free_assembly;
     };
 
     /// \brief General (abstract) sparse matrix representation in Hermes.
@@ -364,11 +376,45 @@ namespace Hermes
       /// @param[in] col  - column index
       virtual void pre_add_ij(unsigned int row, unsigned int col);
 
+      /// Creates the whole structure at once (instead of prealloc(), pre_add_ij() and alloc()).
+      /// @param[in] n - number of unknowns
+      /// @param[in] Ap - index to Ai where each column starts (size is n + 1)
+      /// @param[in] Ai - row indices of the nonzeros, sorted and without duplicities in every column
+      virtual void create_structure(unsigned int n, int* Ap, int* Ai);
+
       /// Finish manipulation with matrix (called before solving)
       virtual void finish() { }
 
+      /// Begins thread-private assembly for (at most) num_threads threads.
+      /// If supported by the matrix type, the values passed to add() by every thread are first stored in the thread's private buffer,
+      /// together with the key set by set_assembly_key(), and summed into the matrix in finish() ordered by the keys.
+      /// The result is then the same regardless of the number of threads used.
+      /// Matrix types not supporting this keep adding the values directly.
+      virtual void begin_thread_private_assembly(int num_threads) { }
+
+      /// Sets the (non-negative) key, e.g. the index of the assembled element, the subsequent add() calls of the calling thread belong to.
+      /// See begin_thread_private_assembly().
+      virtual void set_assembly_key(int key) { }
+
       virtual unsigned int get_size() { return this->size; }
 
+      /// Finds the positions of the entries of a local block in the storage of the matrix,
+      /// so that the block can later be added by add_at_positions() without any search.
+      /// Only valid until the matrix structure changes (free(), alloc()).
+      /// @param[in] m         - number of rows of the block
+      /// @param[in] n         - number of columns of the block
+      /// @param[in] rows      - array with row indexes (negative ones are skipped)
+      /// @param[in] cols      - array with column indexes (negative ones are skipped)
+      /// @param[out] positions - m * n array, positions[i * n + j] is the position of the entry (rows[i], cols[j]), -1 for skipped entries.
+      /// @return false if the matrix type does not support this.
+      virtual bool get_positions(unsigned int m, unsigned int n, int *rows, int *cols, int *positions) { return false; }
+
+      /// Adds a local block to the positions obtained by get_positions().
+      virtual void add_at_positions(unsigned int m, unsigned int n, Scalar **mat, int *positions)
+      {
+        throw Hermes::Exceptions::Exception("add_at_positions() undefined.");
+      };
+
       /// Add matrix
       /// @param mat matrix to add
       virtual void add_sparse_matrix(SparseMatrix* mat)
@@ -477,13 +523,221 @@ namespace Hermes
       int mem_size;
     };
 
+    /// \brief Block sparse row (node-blocked) matrix.
+    /// The unknowns are grouped into nodes of block_size components (e.g. the components of a vector-valued field in one DOF),
+    /// and a dense block_size x block_size block is stored for every pair of coupled nodes. That means one column index
+    /// per block instead of one per entry, and all the components of a node next to each other in the matrix-vector product.
+    /// The grouping is set by set_blocks() before the structure is built (prealloc(), pre_add_ij(), alloc()),
+    /// by default every unknown is a node of its own.
+    template<typename Scalar>
+    class HERMES_API BSRMatrix : public SparseMatrix<Scalar>
+    {
+    public:
+      BSRMatrix();
+      virtual ~BSRMatrix();
+
+      /// Grouping of the unknowns into nodes.
+      /// @param[in] size number of unknowns (the size of the matrix)
+      /// @param[in] block_size number of components of a node
+      /// @param[in] num_blocks number of nodes
+      /// @param[in] dof_block node of every unknown
+      /// @param[in] dof_component component of every unknown in its node, no two unknowns may share the node and the component
+      void set_blocks(unsigned int size, unsigned int block_size, unsigned int num_blocks, int* dof_block, int* dof_component);
+
+      /// Number of components of a node.
+      unsigned int get_block_size() const;
+      /// Number of nodes.
+      unsigned int get_num_blocks() const;
+
+      virtual void prealloc(unsigned int n);
+      virtual void pre_add_ij(unsigned int row, unsigned int col);
+      virtual void alloc();
+      virtual void free();
+      virtual Scalar get(unsigned int m, unsigned int n);
+      virtual void zero();
+      virtual void add(unsigned int m, unsigned int n, Scalar v);
+      /// The local matrix is added node by node - all the entries belonging to a pair of nodes are added to their block at once,
+      /// found by one search (pass all the components of the local unknowns together to make use of it).
+      virtual void add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols);
+      virtual void add_to_diagonal(Scalar v);
+      virtual bool dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt = DF_MATLAB_SPARSE, char* number_format = "%lf");
+      virtual unsigned int get_matrix_size() const;
+      /// Number of stored entries (the zeros in the blocks included).
+      virtual unsigned int get_nnz() const;
+      virtual double get_fill_in() const;
+      virtual void multiply_with_vector(Scalar* vector_in, Scalar* vector_out);
+      virtual void multiply_with_Scalar(Scalar value);
+
+    protected:
+      /// Number of components of a node.
+      unsigned int block_size;
+      /// Number of nodes.
+      unsigned int num_blocks;
+      /// Number of unknowns the grouping is set for.
+      unsigned int blocks_size;
+      /// Node and component of every unknown.
+      int* dof_block;
+      int* dof_component;
+      /// Unknown of every component of every node (block * block_size + component), -1 for none.
+      int* block_dof;
+
+      /// Index to Bj / blocks in Bx where each block row starts (size is num_blocks + 1).
+      int* Bp;
+      /// Block column indices.
+      int* Bj;
+      /// Blocks, each stored row by row (block_size * block_size entries).
+      Scalar* Bx;
+      /// Number of blocks ( = Bp[num_blocks]).
+      unsigned int nnzb;
+
+      /// Index of the block (block_row, block_col) in Bj, -1 if not in the structure.
+      int find_block(int block_row, int block_col) const;
+
+      /// Every unknown a node of its own.
+      void set_trivial_blocks(unsigned int size);
+      void free_blocks();
+    };
+
+    /// \brief General CSR Matrix class.
+    /// The matrix stored row by row. The matrix-vector product only gathers from the input vector and every row is written
+    /// by one thread, so it runs in parallel over the rows without any synchronization. The product with the transposed
+    /// matrix goes over the transposed structure (built on the first use, the values are shared with the matrix), so it is
+    /// a gather as well. The conversions from / to the CSC arrays (CSCMatrix) are one counting sort, O(size + nnz).
+    template<typename Scalar>
+    class HERMES_API CSRMatrix : public SparseMatrix<Scalar>
+    {
+    public:
+      CSRMatrix();
+      virtual ~CSRMatrix();
+
+      /// Creates the matrix from the CSR arrays (copied).
+      /// @param[in] size size of matrix (num of rows and columns)
+      /// @param[in] nnz number of nonzero values
+      /// @param[in] ap index to aj/ax, where each row starts (size is matrix size + 1)
+      /// @param[in] aj column indices (sorted in every row)
+      /// @param[in] ax values
+      void create(unsigned int size, unsigned int nnz, int* ap, int* aj, Scalar* ax);
+      /// Creates the matrix from the CSC arrays of the same matrix (e.g. those of CSCMatrix).
+      void create_from_CSC(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
+      /// Fills the CSC arrays of the matrix - ap of size + 1 entries, ai and ax of get_nnz() entries, allocated by the caller.
+      void get_CSC(int* ap, int* ai, Scalar* ax);
+
+      virtual void pre_add_ij(unsigned int row, unsigned int col);
+      virtual void alloc();
+      /// The structure given by the CSC arrays, without the pages.
+      virtual void create_structure(unsigned int n, int* Ap, int* Ai);
+      virtual void free();
+      virtual Scalar get(unsigned int m, unsigned int n);
+      virtual void zero();
+      virtual void add(unsigned int m, unsigned int n, Scalar v);
+      virtual void add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols);
+      virtual void add_to_diagonal(Scalar v);
+      virtual bool dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt = DF_MATLAB_SPARSE, char* number_format = "%lf");
+      virtual unsigned int get_matrix_size() const;
+      virtual unsigned int get_nnz() const;
+      virtual double get_fill_in() const;
+      virtual int get_num_row_entries(unsigned int row);
+      /// vector_out = A * vector_in, in parallel over the rows.
+      virtual void multiply_with_vector(Scalar* vector_in, Scalar* vector_out);
+      /// vector_out = A^T * vector_in, in parallel over the rows of A^T.
+      void multiply_with_vector_transposed(Scalar* vector_in, Scalar* vector_out);
+      virtual void multiply_with_Scalar(Scalar value);
+      virtual CSRMatrix* duplicate();
+
+      /// Exposes pointers to the CSR arrays.
+      int *get_Ap();
+      int *get_Aj();
+      Scalar *get_Ax();
+
+    protected:
+      /// Matrix entries (row-wise).
+      Scalar *Ax;
+      /// Column indices of values in Ax.
+      int *Aj;
+      /// Index to Ax/Aj, where each row starts.
+      int *Ap;
+      /// Number of non-zero entries ( =  Ap[size]).
+      unsigned int nnz;
+
+      /// The transposed structure - rows of A^T (i.e. columns of A), their column indices and the positions of the entries in Ax.
+      /// NULL until the first multiply_with_vector_transposed().
+      int *At_p;
+      int *At_j;
+      int *At_position;
+      void free_transposed();
+
+      /// The transposition of a compressed structure (CSR <-> CSC) by a counting sort.
+      /// t_p (size + 1), t_i, positions (p[size] entries) are allocated by the caller, positions[k] is the index in i of the k-th transposed entry.
+      static void transpose_structure(unsigned int size, int* p, int* i, int* t_p, int* t_i, int* positions);
+    };
+
+    /// \brief Sliced ELLPACK (SELL-C-sigma) matrix for the matrix-vector product of high-order matrices.
+    /// Assembled as a CSRMatrix, finish() then stores a copy of the values in the SELL-C-sigma format - the rows are sorted
+    /// by their length within the windows of sigma rows and cut into chunks of chunk_size rows, every chunk padded to its
+    /// longest row and stored column by column. The product then loads chunk_size values (and gathers chunk_size entries of
+    /// the input vector) at once, so the long uneven rows of the vertex unknowns vectorize (AVX-512 / AVX2 for real matrices).
+    /// Changing the values after finish() makes multiply_with_vector() convert them again before the product.
+    template<typename Scalar>
+    class HERMES_API SELLMatrix : public CSRMatrix<Scalar>
+    {
+    public:
+      /// Rows in a chunk, a multiple of the SIMD width of doubles.
+      static const int chunk_size = 8;
+
+      /// \param[in] sigma Size of the windows the rows are sorted in, a multiple of chunk_size. Larger windows need
+      /// less padding, smaller ones keep the rows closer to their original order (and the cache locality of the input vector).
+      SELLMatrix(unsigned int sigma = 256);
+      virtual ~SELLMatrix();
+
+      /// Converts the assembled values (and the structure, if it changed) to the SELL-C-sigma format.
+      virtual void finish();
+
+      virtual void alloc();
+      virtual void create_structure(unsigned int n, int* Ap, int* Ai);
+      virtual void free();
+      virtual void zero();
+      virtual void add(unsigned int m, unsigned int n, Scalar v);
+      virtual void add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols);
+      virtual void multiply_with_Scalar(Scalar value);
+      /// vector_out = A * vector_in, in parallel over the chunks.
+      virtual void multiply_with_vector(Scalar* vector_in, Scalar* vector_out);
+      virtual SELLMatrix* duplicate();
+
+      /// Stored entries including the padding, relative to the nonzeros (1.0 = no padding).
+      double get_padding_ratio();
+
+    protected:
+      unsigned int sigma;
+      unsigned int num_chunks;
+      /// Index to Sx/Sj, where each chunk starts (num_chunks + 1 entries), the width of a chunk is (Sp[c + 1] - Sp[c]) / chunk_size.
+      int *Sp;
+      /// Column indices and values, column by column in every chunk. The padding has the column 0 and the value 0.
+      int *Sj;
+      Scalar *Sx;
+      /// Position of every stored entry in Ax, -1 for the padding.
+      int *S_position;
+      /// Row of every slot of the chunks (num_chunks * chunk_size entries), -1 for the slots past the last row.
+      int *S_row;
+      /// Whether Sx holds the current values of Ax.
+      bool sell_up_to_date;
+
+      void build_sell_structure();
+      void free_sell();
+    };
+
     /// \brief General (abstract) vector representation in Hermes.
     template<typename Scalar>
     class HERMES_API Vector : public Hermes::Mixins::Loggable
     {
     public:
+      Vector() : conflict_free_assembly(false) { }
+
       virtual ~Vector() { }
 
+      /// Promise that no two threads will add() to the same entry at the same time (e.g. a coloured assembly),
+      /// so the vector types synchronizing add() may skip the synchronization.
+      void set_conflict_free_assembly(bool to_set = true) { this->conflict_free_assembly = to_set; }
+
       /// allocate memory for storing ndofs elements
       ///
       /// @param[in] ndofs - number of elements of the vector
@@ -546,6 +800,39 @@ namespace Hermes
     protected:
       /// size of vector
       unsigned int size;
+
+      /// See set_conflict_free_assembly().
+      bool conflict_free_assembly;
+    };
+
+    /// \brief Vector stored in one contiguous array, without any external library (used with the built-in solvers).
+    template <typename Scalar>
+    class HERMES_API SimpleVector : public Vector<Scalar>
+    {
+    public:
+      SimpleVector();
+      /// Constructor of vector with specific size.
+      /// @param[in] size size of vector
+      SimpleVector(unsigned int size);
+      virtual ~SimpleVector();
+      virtual void alloc(unsigned int ndofs);
+      virtual void free();
+      virtual Scalar get(unsigned int idx);
+      virtual void extract(Scalar *v) const;
+      virtual void zero();
+      virtual void change_sign();
+      virtual void set(unsigned int idx, Scalar y);
+      virtual void add(unsigned int idx, Scalar y);
+      virtual void add(unsigned int n, unsigned int *idx, Scalar *y);
+      virtual void add_vector(Vector<Scalar>* vec);
+      virtual void add_vector(Scalar* vec);
+      virtual bool dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt = DF_MATLAB_SPARSE, char* number_format = "%lf");
+
+      /// @return pointer to array with vector data
+      Scalar *get_c_array();
+
+    protected:
+      Scalar *v;
     };
 
     /// \brief Function returning a vector according to the users's choice.
@@ -63,6 +63,23 @@ namespace Hermes
       /// Returns the current value of verbose_callback;
       callbackFn get_verbose_callback() const;
 
+      /// Run-time filter of all the messages (of the instances and of Static), HERMES_LOG_LEVEL_INFO by default.
+      /// The messages above the level are skipped before being formatted. The level can not exceed the
+      /// compile-time HERMES_LOG_LEVEL.
+      static void set_log_level(int level);
+      static int get_log_level();
+
+      /// Asynchronous logging: the messages of the instances are formatted into a ring buffer of the calling
+      /// thread and written out (console, log file, callbacks) by a background thread, so that the verbose
+      /// output of parallel assembly does not serialize the threads on the logger. Off by default.
+      /// The messages of one thread keep their order, the messages of all threads are written in the order
+      /// they were issued. Switching off writes out everything buffered.
+      static void set_asynchronous_logging(bool to_set);
+      static bool get_asynchronous_logging();
+
+      /// Writes out all the buffered messages now (also done when the program exits).
+      static void flush_log();
+
       /// For static logging in user programs.
       class HERMES_API Static
       {
@@ -90,7 +107,13 @@ namespace Hermes
       /** \param[in] code An event code, e.g., ::HERMES_EC_ERROR.
       *  \param[in] text A message. A C-style string.
       *  \return True if the message was written. False if it failed due to some reasone. */
-      bool write_console(const char code, const char* text) const;
+      static bool write_console(const char code, const char* text);
+
+      /// Whether the messages of the level are to be formatted and written (the compile-time and the run-time filter).
+      static bool log_level_enabled(int level)
+      {
+        return level <= HERMES_LOG_LEVEL && level <= log_level;
+      }
 
       /// Info about a log record. Used for output log function. \internal
       class HERMES_API HermesLogEventInfo
@@ -104,7 +127,7 @@ namespace Hermes
         const int src_line;       ///< A line in the source file at which the event was generated.
       };
 
-      HermesLogEventInfo* hermes_build_log_info(char event) const;
+      static HermesLogEventInfo* hermes_build_log_info(char event);
 
       /// \brief Logging output monitor. \internal \ingroup g_logging
       /** This class protects a logging function __hermes_log_message_if() in multithreded environment. */
@@ -148,6 +171,28 @@ namespace Hermes
       *  \param[in] msg A message. */
       void hermes_log_message(const char code, const char* msg) const;
 
+      /// Writes one message to the console, the log file and the callback, called inside logger_monitor.
+      /// \param[in] file The opened log file, NULL - opened (and closed) here.
+      static void write_log_message(const char code, const char* msg, callbackFn callback, FILE* file);
+
+      /// Opens the log file for appending, writes the delimiter on the first write, NULL if there is no log file.
+      static FILE* open_log_file();
+
+      /// The ring buffer of the messages of one thread (asynchronous logging). \internal
+      class LogRing;
+
+      /// The ring of the calling thread, created on the first message.
+      static LogRing* get_thread_ring();
+
+      /// Writes out all the messages in the rings, called inside logger_monitor.
+      static void drain_rings();
+
+      /// The body of the background thread writing out the rings.
+      static void* flusher_thread(void* arg);
+
+      static int log_level;
+      static volatile bool asynchronous_logging;
+
       /// Verbose output.
       /// Set to 'true' by default.
       bool verbose_output;
@@ -54,6 +54,12 @@ namespace Hermes
       /// @param[in] name - name of the preconditioner[ none | jacobi | neumann | least-squares ]
       virtual void set_precond(const char *name);
 
+      /// Matrix-free mode - the system matrix is applied by op->apply() in every iteration,
+      /// the matrix passed to the constructor is not used (may be NULL). Real problems only.
+      /// Aztec internal preconditioners need the matrix, only user preconditioners (set_precond(Precond<Scalar>*)) can be used.
+      /// @param[in] op - the operator, NULL switches the matrix-free mode off
+      void set_operator(DiscreteProblemInterface<Scalar> *op);
+
       AztecOOSolver(EpetraMatrix<Scalar> *m, EpetraVector<Scalar> *rhs);
       virtual ~AztecOOSolver();
       virtual bool solve();
@@ -76,6 +82,35 @@ namespace Hermes
       EpetraMatrix<Scalar> *m;
       EpetraVector<Scalar> *rhs;
 
+      /// Matrix-free operator, see set_operator().
+      DiscreteProblemInterface<Scalar> *op;
+
+      /// \brief Epetra_Operator wrapper of DiscreteProblemInterface::apply().
+      class MatrixFreeOperator : public Epetra_Operator
+      {
+      public:
+        MatrixFreeOperator(DiscreteProblemInterface<Scalar> *op, const Epetra_BlockMap &map);
+        virtual ~MatrixFreeOperator();
+
+        // Epetra_Operator interface
+        virtual int SetUseTranspose(bool UseTranspose) { return -1; }
+        virtual int Apply(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const;
+        virtual int ApplyInverse(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const { return -1; }
+        virtual double NormInf() const { return 0.0; }
+        virtual const char *Label() const { return "Hermes::Solvers::AztecOOSolver::MatrixFreeOperator"; }
+        virtual bool UseTranspose() const { return false; }
+        virtual bool HasNormInf() const { return false; }
+        virtual const Epetra_Comm &Comm() const { return map.Comm(); }
+        virtual const Epetra_Map &OperatorDomainMap() const { return map; }
+        virtual const Epetra_Map &OperatorRangeMap() const { return map; }
+
+      protected:
+        DiscreteProblemInterface<Scalar> *op;
+        Epetra_Map map;
+        /// Contiguous copies of the vectors passed to op->apply().
+        Scalar *x, *y;
+      };
+
       Precond<Scalar> *pc;
 
       template<typename T> friend LinearMatrixSolver<T>* create_linear_solver(Matrix<T>* matrix, Vector<T>* rhs);
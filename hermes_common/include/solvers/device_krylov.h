@@ -0,0 +1,95 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file device_krylov.h
+\brief DeviceKrylov class, the CG and BiCGStab iterations of KrylovSolver on a CUDA device.
+*/
+#ifndef __HERMES_COMMON_DEVICE_KRYLOV_H_
+#define __HERMES_COMMON_DEVICE_KRYLOV_H_
+#include "../config.h"
+#ifdef WITH_CUDA
+#include "common.h"
+#include "exceptions.h"
+#include <cublas_v2.h>
+#include <cusparse.h>
+
+namespace Hermes
+{
+  namespace Solvers
+  {
+    /// \brief The device part of KrylovSolver::set_device(): the CSR matrix and the vectors of the iterations live in the
+    /// device memory, the matrix-vector products are done by cuSPARSE (cusparseSpMV), the vector operations and the Jacobi
+    /// preconditioner by cuBLAS. Only the scalars of the iterations (the dot products, the norms) return to the host.
+    /// The device arrays are kept between the solves and reallocated only when the size or the number of nonzeros grows.
+    ///
+    /// @ingroup solvers
+    template <typename Scalar>
+    class HERMES_API DeviceKrylov
+    {
+    public:
+      DeviceKrylov();
+      ~DeviceKrylov();
+
+      /// Copies the CSR arrays of the matrix to the device.
+      void set_matrix(int size, int nnz, const int* ap, const int* aj, const Scalar* ax);
+      /// Copies the inverted diagonal of the Jacobi preconditioner to the device, NULL - no preconditioner.
+      void set_jacobi(const Scalar* inv_diag);
+
+      /// The iterations of KrylovSolver::solve_cg() / solve_bicgstab().
+      /// @param[in] b - the right-hand side (host)
+      /// @param[in,out] x - the initial guess, the solution on return (host)
+      /// @param[in] nonzero_initial_guess - false: x is zero
+      /// @param[out] residual - the relative residual norm reached
+      /// @return the number of iterations
+      int solve_cg(const Scalar* b, double b_norm, Scalar* x, bool nonzero_initial_guess, double tolerance, int max_iters, double& residual);
+      int solve_bicgstab(const Scalar* b, double b_norm, Scalar* x, bool nonzero_initial_guess, double tolerance, int max_iters, double& residual);
+
+    protected:
+      cublasHandle_t cublas;
+      cusparseHandle_t cusparse;
+      cusparseSpMatDescr_t matrix;
+      cusparseDnVecDescr_t vec_x, vec_y;
+
+      int size, nnz;
+      /// The allocated lengths of the arrays.
+      int size_allocated, nnz_allocated;
+      int *ap, *aj;
+      Scalar *ax;
+      /// Inverted diagonal, NULL - no preconditioner.
+      Scalar *inv_diag;
+      bool jacobi;
+      /// The vectors of the iterations (b, x and 7 work vectors) in one allocation of 9 * size_allocated entries.
+      Scalar *vectors;
+      /// The work buffer of cusparseSpMV().
+      void *spmv_buffer;
+      size_t spmv_buffer_size;
+
+      /// y = alpha A x + beta y.
+      void multiply(Scalar alpha, Scalar *x, Scalar beta, Scalar *y);
+      /// z = M^{-1} r.
+      void apply_preconditioner(Scalar *r, Scalar *z);
+      /// r = b - A x, just the copy of b if x is zero.
+      void initial_residual(Scalar *b, Scalar *x, Scalar *r, bool nonzero_initial_guess);
+
+      void free_matrix();
+      void free_vectors();
+    };
+  }
+}
+#endif
+#endif
@@ -59,6 +59,10 @@ namespace Hermes
       virtual void assemble(Scalar* coeff_vec, Vector<Scalar>* rhs = NULL,
         bool force_diagonal_blocks = false, Table* block_weights = NULL) = 0;
 
+      /// Matrix-free operator application y = J * x, without forming the matrix.
+      /// Used by iterative solvers in the matrix-free mode (AztecOOSolver::set_operator()).
+      virtual void apply(const Scalar* x, Scalar* y) = 0;
+
     protected:
       /// Preassembling.
       /// Precalculate matrix sparse structure.
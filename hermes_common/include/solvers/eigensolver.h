@@ -17,74 +17,111 @@
 // along with Hermes2D; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
 /*! \file eigensolver.h
-    \brief class for solving Eigenproblems. Currently using Python.
+    \brief EigenSolver class, the shift-invert Lanczos method for the generalized eigenproblems.
 */
 #ifndef __HERMES_EIGENSOLVER_H
 #define __HERMES_EIGENSOLVER_H
 
 #include "config.h"
-#ifdef WITH_PYTHON
+#ifdef WITH_UMFPACK
 
 #include "matrix.h"
-
-#include "python_API/python_api.h"
-
-// RCP
-#ifndef WITH_TRILINOS
-#include "Teuchos_RCP.hpp"
-#else
-#include "Teuchos_RCP.hpp"
-#endif
+#include "umfpack_solver.h"
+#include "mixins.h"
 
 namespace Hermes
 {
-
-using Teuchos::RCP;
-using Teuchos::Ptr;
-using Teuchos::rcp;
-using Teuchos::null;
-
-
-template <typename Scalar>
-class HERMES_API EigenSolver
-{
-public:
-    EigenSolver(const RCP<Algebra::Matrix<Scalar> > &A, const RCP<Algebra::Matrix<Scalar> > &B);
-
-
-    // Solves for 'n_eigs' eigenvectors, around the 'target_value'. Use
-    // 'get_eigenvalue' and 'get_eigenvector' to retrieve the
-    // eigenvalues/eigenvectors:
-    void solve(int n_eigs = 4, double target_value = -1, double tol = 1e-6,
-            int max_iter = 150);
-
-    // Returns the number of calculated eigenvalues
-    int get_n_eigs()
+  namespace Solvers
+  {
+    /// \brief Eigenpairs of the generalized eigenproblem A x = lambda B x nearest to a target value.
+    ///
+    /// A is symmetric and B symmetric positive definite (e.g. the stiffness and the mass matrix). The thick-restart
+    /// Lanczos method is applied to the shift-invert operator (A - sigma B)^{-1} B in the B inner product, sigma being
+    /// the target value, so the eigenvalues closest to sigma converge first. A - sigma B is assembled in the matrix
+    /// type of the selected matrix solver (HermesCommonApi.get_matrix_solver_type()) and factorized once, all the
+    /// following solves reuse the factorization (HERMES_REUSE_FACTORIZATION_COMPLETELY). With an iterative solver
+    /// every solve iterates, and its tolerance has to be well below the one of the eigensolver.
+    ///
+    /// Only the real (double) problems are supported.
+    /// @ingroup solvers
+    template <typename Scalar>
+    class HERMES_API EigenSolver : public Hermes::Mixins::Loggable
     {
-        return this->n_eigs;
-    }
-    // Returns the i-th eigenvalue
-    double get_eigenvalue(int i);
-    // Returns the i-th eigenvector. A pointer will be returned into an
-    // internal array, as well as the size of the vector. You don't own the
-    // memory and it will be deallocated once the EigenSolver() class is
-    // deleted. You need to make a copy of it if you want to store it
-    // permanently.
-    void get_eigenvector(int i, double **vec, int *n);
-
-    void print_eigenvalues()
-    {
-        printf("Eigenvalues:\n");
-        for (int i = 0; i < this->get_n_eigs(); i++)
-            printf("%3d: %f\n", i, this->get_eigenvalue(i));
-    }
-
-private:
-    RCP<Algebra::Matrix<Scalar> > A, B;
-    int n_eigs;
-    Python p;
-};
-
+    public:
+      /// The matrices are not copied or deleted, they have to stay unchanged during solve().
+      EigenSolver(CSCMatrix<Scalar>* A, CSCMatrix<Scalar>* B);
+      virtual ~EigenSolver();
+
+      /// Solves for 'n_eigs' eigenpairs around the 'target_value'. Use
+      /// 'get_eigenvalue' and 'get_eigenvector' to retrieve the
+      /// eigenvalues/eigenvectors (sorted by the eigenvalue).
+      /// @param[in] tol - the relative residual of the converged Ritz pairs of the shift-invert operator.
+      /// @param[in] max_iter - the maximum number of the restarts. The pairs not converged by then are returned
+      /// with a warning.
+      void solve(int n_eigs = 4, double target_value = -1, double tol = 1e-6,
+        int max_iter = 150);
+
+      /// Number of the Lanczos vectors (the dimension of the search space), default max(2 n_eigs + 1, n_eigs + 20).
+      /// More vectors take more memory and fewer restarts.
+      void set_num_lanczos_vectors(int num_lanczos_vectors);
+
+      /// Returns the number of calculated eigenvalues.
+      int get_n_eigs() const;
+      /// Returns the i-th eigenvalue.
+      double get_eigenvalue(int i) const;
+      /// Returns the i-th eigenvector (B-normalized). A pointer will be returned into an
+      /// internal array, as well as the size of the vector. You don't own the
+      /// memory and it will be deallocated once the EigenSolver() class is
+      /// deleted. You need to make a copy of it if you want to store it
+      /// permanently.
+      void get_eigenvector(int i, double **vec, int *n);
+
+      /// Number of the restarts and the solves with A - sigma B of the last solve().
+      int get_num_restarts() const;
+      int get_num_solves() const;
+
+      void print_eigenvalues();
+
+    private:
+      /// Assembles A - sigma B (the union of the sparsity patterns) and sets up its solver.
+      void init_shifted_solver(double sigma);
+      void free_shifted_solver();
+
+      /// y = (A - sigma B)^{-1} Bx.
+      void apply_operator(double* Bx, double* y);
+
+      /// Orthogonalizes w against the first count vectors of V in the B inner product (Gram-Schmidt, twice).
+      /// @param[out] coeffs - the sum of the coefficients of both passes (may be NULL).
+      void orthogonalize(double* w, int count, double* coeffs);
+
+      /// A random vector (deterministic sequence).
+      void random_vector(double* v);
+
+      CSCMatrix<Scalar>* A;
+      CSCMatrix<Scalar>* B;
+      int size;
+      int num_lanczos_vectors;
+      int num_allocated_vectors;
+
+      /// The shifted matrix, its right-hand side and solver.
+      SparseMatrix<Scalar>* shifted_matrix;
+      Vector<Scalar>* shifted_rhs;
+      LinearMatrixSolver<Scalar>* shifted_solver;
+
+      /// The Lanczos vectors and their products with B.
+      double** V;
+      double** BV;
+
+      /// The results.
+      int n_eigs;
+      double* eigenvalues;
+      double* eigenvectors;
+
+      int num_restarts;
+      int num_solves;
+      unsigned int random_state;
+    };
+  }
 }
 
 #endif
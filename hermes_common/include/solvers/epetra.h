@@ -80,6 +80,16 @@ namespace Hermes
       virtual unsigned int get_nnz() const;
       virtual double get_fill_in() const;
 
+      /// Hash of the sparsity pattern (the column indices of the rows, FNV-1a), to recognize a matrix of the same structure
+      /// (see MlPrecond::set_reuse(), IfpackPrecond::set_reuse()).
+      unsigned long get_structure_hash() const;
+
+      /// Wraps the CSR arrays (e.g. those of CSRMatrix) without copying them (the View mode of Epetra_CrsMatrix) -
+      /// they must outlive the matrix. The complex matrix keeps the real and imaginary parts separately, so it copies them.
+      /// @param[in] ap index to aj/ax, where each row starts (size is matrix size + 1)
+      /// @param[in] aj column indices (sorted in every row)
+      void create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, Scalar* ax);
+
     protected:
       Epetra_BlockMap *std_map;
       Epetra_CrsGraph *grph;
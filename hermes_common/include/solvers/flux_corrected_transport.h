@@ -0,0 +1,98 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file flux_corrected_transport.h
+\brief FluxCorrectedTransport class, the algebraic flux correction (FCT) of the convection problems.
+*/
+#ifndef __HERMES_COMMON_FLUX_CORRECTED_TRANSPORT_H_
+#define __HERMES_COMMON_FLUX_CORRECTED_TRANSPORT_H_
+
+#include "config.h"
+#ifdef WITH_UMFPACK
+#include "umfpack_solver.h"
+
+namespace Hermes
+{
+  namespace Algebra
+  {
+    /// \brief Algebraic flux correction (Kuzmin, Moeller, Turek) on the CSC arrays of the matrices.
+    ///
+    /// The low order operator is the convection matrix K plus the artificial diffusion D (discrete upwinding) with the
+    /// lumped mass matrix M_L, the antidiffusive fluxes f_ij between the pairs of the coupled DOFs are limited by the
+    /// Zalesak limiter. Every pass goes once over the columns of the matrices in parallel: a column j only writes the
+    /// entries and the nodal quantities of the DOF j (each flux is evaluated from both of its ends, f_ji = -f_ij), so
+    /// there are no critical sections, and the transposed entries are found by a binary search in the (sorted) column,
+    /// no CSCMatrix::get() / add(). The matrices need a symmetric sparsity structure, the mass matrix and D the same one.
+    ///
+    /// Only the pairs of the DOFs marked for FCT (set_fct_dofs(), all by default) are corrected, e.g. the vertex
+    /// DOFs of the linear elements in hp-meshes.
+    /// @ingroup solvers
+    class HERMES_API FluxCorrectedTransport
+    {
+    public:
+      /// @param[in] theta - the theta-scheme of the time discretization (0 explicit, 1 implicit).
+      FluxCorrectedTransport(double theta);
+      virtual ~FluxCorrectedTransport();
+
+      /// The DOFs the correction applies to (copied), NULL for all of them.
+      void set_fct_dofs(const bool* fct_dofs, int size);
+
+      /// D, d_ij = max(0, -k_ij, -k_ji) for i != j, d_jj = - sum_i d_ij, in the structure of K.
+      /// @param[out] diffusion - created by CSCMatrix::create(), e.g. an UMFPackMatrix.
+      void artificial_diffusion(CSCMatrix<double>* conv_matrix, CSCMatrix<double>* diffusion);
+
+      /// M_L, the row sums of the mass matrix on the diagonal, in the structure of the mass matrix.
+      /// @param[out] lumped_matrix - created by CSCMatrix::create().
+      void mass_lumping(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix);
+
+      /// The limited antidiffusive fluxes of a time step, flux[i] = sum_j alpha_ij f_ij with
+      /// f_ij = (m_ij / tau + theta d_ij) (u_high_i - u_high_j) - (m_ij / tau - (1 - theta) d_ij) (u_old_i - u_old_j),
+      /// prelimited to zero if they are directed down the gradient of the low order solution u_L.
+      /// @param[in] smooth_dofs - the DOFs (== 1) left unlimited (alpha = 1), may be NULL.
+      void antidiffusive_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix, CSCMatrix<double>* diffusion,
+        double* u_high, double* u_L, double* u_old, double time_step, double* flux, const int* smooth_dofs = NULL);
+
+      /// The limited fluxes of the constrained projection, flux[i] = sum_j alpha_ij m_ij (u_high_i - u_high_j), the
+      /// bounds are those of the lumped projection u_L.
+      void projection_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix,
+        double* u_high, double* u_L, double* flux, const int* smooth_dofs = NULL);
+
+    protected:
+      /// The two passes - the fluxes, the sums P, the bounds Q and the Zalesak factors R per DOF, then the limited sums.
+      /// diffusion and u_old are NULL for the projection (time_step 1).
+      void limit_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix, CSCMatrix<double>* diffusion,
+        double* u_high, double* u_L, double* u_old, double time_step, double* flux, const int* smooth_dofs);
+
+      /// Whether the DOF i is corrected.
+      inline bool is_fct_dof(int i) const { return this->fct_dofs.empty() || this->fct_dofs[i]; }
+
+      /// The position of the entry (row, col) in the CSC arrays, -1 if not in the structure.
+      static int find_entry(int* Ap, int* Ai, int row, int col);
+
+      double theta;
+      std::vector<bool> fct_dofs;
+
+      /// The Zalesak factors per DOF, and the prelimited fluxes per entry of the mass matrix (f_ji in the column j) kept
+      /// between the two passes.
+      std::vector<double> R_plus, R_minus;
+      std::vector<double> entry_fluxes;
+    };
+  }
+}
+#endif
+#endif
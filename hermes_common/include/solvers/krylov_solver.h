@@ -0,0 +1,175 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file krylov_solver.h
+\brief KrylovSolver class, the built-in preconditioned iterative solvers.
+*/
+#ifndef __HERMES_COMMON_KRYLOV_SOLVER_H_
+#define __HERMES_COMMON_KRYLOV_SOLVER_H_
+#include "linear_matrix_solver.h"
+
+namespace Hermes
+{
+  namespace Preconditioners
+  {
+    template <typename Scalar> class SaddlePointPrecond;
+  }
+
+  namespace Solvers
+  {
+    template <typename Scalar> class DeviceKrylov;
+
+    /// \brief A linear operator given by its action, see KrylovSolver::set_operator().
+    template <typename Scalar>
+    class LinearOperator
+    {
+    public:
+      virtual ~LinearOperator() {}
+      /// y = A x
+      virtual void apply(Scalar *x, Scalar *y) = 0;
+    };
+
+    /// \brief Built-in preconditioned Krylov solvers (CG, restarted GMRES, BiCGStab), no external library needed.
+    ///
+    /// Works on the CSR arrays of the matrix (CSRMatrix, SELLMatrix - created by create_matrix() for SOLVER_KRYLOV).
+    /// The iterations start from zero and stop when ||b - Ax|| <= tolerance * ||b||. The matrix-vector products, the dot
+    /// products and the Jacobi and block-Jacobi preconditioners run in parallel, the triangular solves of the ILU(0)
+    /// preconditioner are sequential (block-Jacobi is ILU(0) of the diagonal blocks, one block per thread by default).
+    /// GMRES is preconditioned from the right, so its residual is the true one, CG needs a Hermitian positive definite
+    /// matrix (and preconditioner).
+    ///
+    /// @ingroup solvers
+    template <typename Scalar>
+    class HERMES_API KrylovSolver : public IterSolver<Scalar>
+    {
+    public:
+      KrylovSolver(CSRMatrix<Scalar> *m, SimpleVector<Scalar> *rhs);
+      virtual ~KrylovSolver();
+
+      /// Set the type of the solver.
+      /// @param[in] solver - name of the solver [ cg | gmres | bicgstab ]
+      void set_solver(const char *solver);
+
+      /// Set the preconditioner.
+      /// @param[in] name - name of the preconditioner [ none | jacobi | ilu | block-jacobi ]
+      virtual void set_precond(const char *name);
+
+      /// User preconditioner, applied by Precond::apply(). create() and compute() are called in solve()
+      /// (once, with HERMES_REUSE_FACTORIZATION_COMPLETELY). Not deleted by the solver.
+      virtual void set_precond(Precond<Scalar> *pc);
+
+      /// HERMES_REUSE_FACTORIZATION_COMPLETELY keeps the preconditioner of the previous solve (e.g. for a fixed Jacobian),
+      /// anything else computes it again from the current matrix.
+      virtual void set_factorization_scheme(FactorizationScheme reuse_scheme);
+
+      /// Matrix-free solve: the products by the operator instead of the matrix (which is not used then and may be NULL,
+      /// the size is the length of the rhs). The preconditioner is the operator precond (z = M^{-1} r) or none,
+      /// the ones set by set_precond() are not used. NULL switches back to the matrix. Not deleted by the solver.
+      void set_operator(LinearOperator<Scalar> *op, LinearOperator<Scalar> *precond = NULL);
+
+      /// Dimension of the Krylov subspace of GMRES between the restarts (default 30).
+      void set_gmres_restart(int restart);
+
+      /// Number of the diagonal blocks of the block-Jacobi preconditioner, 0 (default) means one per thread.
+      void set_num_blocks(int num_blocks);
+
+      /// Run CG and BiCGStab with no or the Jacobi preconditioner on the CUDA device (Hermes built WITH_CUDA, see DeviceKrylov):
+      /// the matrix is copied to the device in every solve, the iterations do not leave it. The other combinations
+      /// (GMRES, the ILU and user preconditioners, set_operator()) stay on the host.
+      void set_device(bool to_set = true);
+
+      virtual bool solve();
+      virtual int get_matrix_size();
+      virtual int get_num_iters();
+      /// Relative residual norm of the last solve.
+      virtual double get_residual();
+
+    protected:
+      enum Method
+      {
+        KrylovCG,
+        KrylovGMRES,
+        KrylovBiCGStab
+      };
+
+      enum PreconditionerType
+      {
+        PreconditionerNone,
+        PreconditionerJacobi,
+        PreconditionerILU,
+        PreconditionerBlockJacobi,
+        PreconditionerUser
+      };
+
+      CSRMatrix<Scalar> *m;
+      SimpleVector<Scalar> *rhs;
+
+      Method method;
+      PreconditionerType preconditioner;
+      int gmres_restart;
+      int num_blocks;
+      bool reuse_preconditioner;
+      /// See set_precond(Precond<Scalar>*).
+      Precond<Scalar> *pc;
+      /// See set_operator().
+      LinearOperator<Scalar> *op;
+      LinearOperator<Scalar> *op_precond;
+
+      /// The iterations start from the initial guess (see IterSolver::set_initial_guess()), not from zero.
+      bool nonzero_initial_guess;
+
+      /// See set_device(), the device part created in the first solve on the device.
+      bool use_device;
+      DeviceKrylov<Scalar> *device;
+      /// The solve on the device, false if the configuration is not supported there.
+      bool solve_on_device(Scalar *b, double b_norm);
+
+      int num_iters;
+      double residual;
+
+      /// Jacobi - the inverted diagonal, (block) ILU(0) - the factors in the structure of the matrix
+      /// (the strictly lower part of L with the unit diagonal left out, U including the diagonal).
+      Scalar *precond_values;
+      /// Position of the diagonal entry of every row in the CSR arrays.
+      int *diag_position;
+      /// Rows of the (block) ILU(0) blocks, block b is [block_starts[b], block_starts[b + 1]).
+      std::vector<int> block_starts;
+      /// Size of the matrix the preconditioner was computed for, -1 if none.
+      int precond_size;
+
+      /// (Re)computes the preconditioner of the current matrix.
+      void setup_preconditioner();
+      void free_preconditioner();
+      /// z = M^{-1} r.
+      void apply_preconditioner(Scalar *r, Scalar *z);
+      /// y = A x (the matrix or the operator).
+      void multiply(Scalar *x, Scalar *y);
+      /// r = b - A x, just the copy of b if the iterations start from zero.
+      void initial_residual(Scalar *b, Scalar *x, Scalar *r);
+
+      /// The methods, sln holds the initial guess (zero) on entry.
+      void solve_cg(Scalar *b, double b_norm);
+      void solve_gmres(Scalar *b, double b_norm);
+      void solve_bicgstab(Scalar *b, double b_norm);
+
+      /// Uses the preconditioners of its diagonal blocks.
+      template<typename T> friend class Hermes::Preconditioners::SaddlePointPrecond;
+    };
+  }
+}
+#endif
@@ -26,6 +26,7 @@
 #include "dp_interface.h"
 #include "exceptions.h"
 #include "mixins.h"
+#include "async.h"
 
 using namespace Hermes::Algebra;
 
@@ -67,6 +68,10 @@ namespace Hermes
     ///&nbsp;              previously created preconditioner, \c HERMES_REUSE_FACTORIZATION_COMPLETELY
     ///&nbsp;              indicates that the preconditioner may be reused completely for future solves.
     ///
+    /// UMFPack, SuperLU and MUMPS treat \c HERMES_FACTORIZE_FROM_SCRATCH as \c HERMES_REUSE_MATRIX_REORDERING
+    /// when the sparsity pattern is that of the previous factorization (e.g. the Newton iterations),
+    /// see DirectSolver::set_reuse_symbolic_on_same_structure().
+    ///
     /// <b>Typical scenario:</b>
     /// When \c rhsonly was set to \c true for the assembly phase,
     /// \c HERMES_REUSE_FACTORIZATION_COMPLETELY should be set for the following solution phase.
@@ -83,6 +88,8 @@ namespace Hermes
       ///< factorization.
     };
 
+    template <typename Scalar> class LinearMatrixSolveTask;
+
     /// \brief Abstract class for defining solver interface.
     ///
     ///\todo Adjust interface to support faster update of matrix and rhs
@@ -100,6 +107,18 @@ namespace Hermes
       /// @return true on succes
       virtual bool solve() = 0;
 
+      /// Solve the transposed system A^T x = b with the matrix and the rhs of solve() (not conjugated in the complex case).
+      /// Used for the adjoint (dual) problems. The factorization of the last solve() is reused, if any,
+      /// so the matrix must not have been changed since then. Only UMFPackLinearMatrixSolver supports it so far.
+      /// @return true on succes
+      virtual bool solve_transposed();
+
+      /// Starts solve() on its own thread (see AsyncTask), e.g. to assemble the next block while this one is being factorized.
+      /// The matrix, the rhs and this solver must not be touched until the task's wait() returned.
+      /// @param[in] dependency - the solve starts after this task finished (e.g. the assembling of the matrix), NULL - right away
+      /// @return the started task, deleted by the caller (the destructor waits for it)
+      LinearMatrixSolveTask<Scalar>* solve_async(AsyncTask* dependency = NULL);
+
       /// Get solution vector.
       /// @return solution vector ( #sln )
       Scalar *get_sln_vector();
@@ -127,6 +146,24 @@ namespace Hermes
       double time;  ///< Time spent on solving (in secs).
     };
 
+    /// \brief The asynchronous LinearMatrixSolver::solve().
+    template <typename Scalar>
+    class HERMES_API LinearMatrixSolveTask : public AsyncTask
+    {
+    public:
+      LinearMatrixSolveTask(LinearMatrixSolver<Scalar>* solver);
+      virtual ~LinearMatrixSolveTask();
+
+      /// The return value of solve(), valid after wait().
+      bool get_result() const;
+
+    protected:
+      virtual void run();
+
+      LinearMatrixSolver<Scalar>* solver;
+      bool result;
+    };
+
     /// \brief Base class for defining interface for direct linear solvers.
     /// Internal, though utilizable for defining interfaces to other algebraic packages.
     template <typename Scalar>
@@ -134,12 +171,51 @@ namespace Hermes
     {
     public:
       DirectSolver(unsigned int factorization_scheme = HERMES_FACTORIZE_FROM_SCRATCH)
-        : LinearMatrixSolver<Scalar>(), factorization_scheme(factorization_scheme) {};
+        : LinearMatrixSolver<Scalar>(), factorization_scheme(factorization_scheme),
+        reuse_symbolic_on_same_structure(true), symbolic_structure_hash(0), has_symbolic_structure_hash(false),
+        mixed_precision(false), max_refinement_steps(10), refinement_tolerance(1e-12), num_refinement_steps(-1) {};
+
+      /// With HERMES_FACTORIZE_FROM_SCRATCH, keep the symbolic analysis (reordering) of the previous factorization
+      /// and redo only the numeric one if the sparsity pattern of the matrix has not changed (default true).
+      /// The pattern is compared by a hash of the index arrays.
+      void set_reuse_symbolic_on_same_structure(bool to_set = true);
+
+      /// Factorize a single precision copy of the matrix and recover the double precision accuracy by iterative refinement
+      /// with the double precision matrix (for well-conditioned problems - the factors take half the memory).
+      /// Only MumpsSolver (built WITH_MUMPS_MIXED_PRECISION) supports it, the other solvers keep factorizing in double precision.
+      /// If the refinement does not reach the tolerance, the system is solved in double precision.
+      /// @param[in] max_refinement_steps - maximum number of the refinement steps (single precision solves)
+      /// @param[in] refinement_tolerance - relative residual norm to reach
+      virtual void set_mixed_precision(bool to_set = true, int max_refinement_steps = 10, double refinement_tolerance = 1e-12);
+
+      /// Refinement steps of the last solve, -1 if it was done in double precision.
+      int get_num_refinement_steps() const;
 
     protected:
       virtual void set_factorization_scheme(FactorizationScheme reuse_scheme);
 
       unsigned int factorization_scheme;
+
+      /// Hash of the index arrays of a sparse matrix (FNV-1a), their sizes included.
+      static unsigned long hash_structure(const int* first, unsigned int first_size, const int* second, unsigned int second_size);
+
+      /// To be called when a factorization from scratch is about to be done:
+      /// returns HERMES_REUSE_MATRIX_REORDERING if the structure is the one of the kept symbolic analysis,
+      /// HERMES_FACTORIZE_FROM_SCRATCH (and records the structure) otherwise.
+      /// @param[in] structure_hash - hash_structure() of the current matrix
+      /// @param[in] have_symbolic - there is a symbolic analysis to reuse
+      unsigned int check_structure(unsigned long structure_hash, bool have_symbolic);
+
+      bool reuse_symbolic_on_same_structure;
+      /// Structure of the last symbolic analysis.
+      unsigned long symbolic_structure_hash;
+      bool has_symbolic_structure_hash;
+
+      /// See set_mixed_precision().
+      bool mixed_precision;
+      int max_refinement_steps;
+      double refinement_tolerance;
+      int num_refinement_steps;
     };
 
     /// \brief  Abstract class for defining interface for iterative solvers.
@@ -148,7 +224,8 @@ namespace Hermes
     class IterSolver : public LinearMatrixSolver<Scalar>
     {
     public:
-      IterSolver() : LinearMatrixSolver<Scalar>(), max_iters(10000), tolerance(1e-8), precond_yes(false) {};
+      IterSolver() : LinearMatrixSolver<Scalar>(), max_iters(10000), tolerance(1e-8), precond_yes(false), initial_guess(NULL), initial_guess_size(0) {};
+      virtual ~IterSolver();
 
       virtual int get_num_iters() = 0;
       virtual double get_residual() = 0;
@@ -165,10 +242,20 @@ namespace Hermes
 
       virtual void set_precond(Precond<Scalar> *pc) = 0;
 
+      /// The following solves start from (a copy of) this vector instead of zero, e.g. from the solution of the previous
+      /// step of an adaptivity loop or a time stepping, if it has the size of the matrix. NULL switches back to zero.
+      /// Used by KrylovSolver and AztecOOSolver (real).
+      /// @param[in] initial_guess - the vector, size entries
+      void set_initial_guess(Scalar* initial_guess, unsigned int size);
+
     protected:
       int max_iters;          ///< Maximum number of iterations.
       double tolerance;       ///< Convergence tolerance.
       bool precond_yes;
+
+      /// See set_initial_guess().
+      Scalar* initial_guess;
+      unsigned int initial_guess_size;
     };
 
     /// \brief Function returning a solver according to the users's choice.
@@ -31,6 +31,10 @@ extern "C"
 #include <mumps_c_types.h>
 #include <dmumps_c.h>
 #include <zmumps_c.h>
+#ifdef WITH_MUMPS_MIXED_PRECISION
+#include <smumps_c.h>
+#include <cmumps_c.h>
+#endif
 }
 
 #ifdef WITH_MPI
@@ -71,6 +75,25 @@ namespace Hermes
       typedef double mumps_Scalar;
     };
 
+#ifdef WITH_MUMPS_MIXED_PRECISION
+    /** Single precision Mumps structures of the mixed precision solves */
+    template <typename Scalar> struct mumps_single_type;
+
+    template <>
+    struct mumps_single_type<std::complex<double> >
+    {
+      typedef CMUMPS_STRUC_C mumps_struct;
+      typedef CMUMPS_COMPLEX mumps_Scalar;
+    };
+
+    template <>
+    struct mumps_single_type<double>
+    {
+      typedef SMUMPS_STRUC_C mumps_struct;
+      typedef float mumps_Scalar;
+    };
+#endif
+
     /** \brief Matrix used with MUMPS solver */
     template <typename Scalar>
     class MumpsMatrix : public SparseMatrix<Scalar>
@@ -110,6 +133,9 @@ namespace Hermes
       void multiply_with_Scalar(Scalar value);
       /// Creates matrix using size, nnz, and the three arrays.
       void create(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
+      /// Wraps the CSC arrays (e.g. those of CSCMatrix) without copying them - they must outlive the matrix
+      /// and are not deleted by it. Only the coordinate indices MUMPS needs (irn, jcn) are created.
+      void create_view(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
       /// Duplicates a matrix (including allocation).
       MumpsMatrix* duplicate();
 
@@ -121,6 +147,7 @@ namespace Hermes
       typename mumps_type<Scalar>::mumps_Scalar *Ax; ///< Matrix entries (column-wise).
       int *Ai;          ///< Row indices of values in Ax.
       unsigned int *Ap;          ///< Index to Ax/Ai, where each column starts.
+      bool owner;       ///< Are Ap, Ai, Ax owned (false for create_view())?
 
       friend class Solvers::MumpsSolver<Scalar>;
       template<typename T> friend SparseMatrix<T>*  create_matrix();
@@ -193,8 +220,29 @@ namespace Hermes
       bool reinit();
       /// True if solver is inited.
       bool inited;
+
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      /// Single precision factorization and double precision refinement (see DirectSolver::set_mixed_precision()).
+      virtual void set_mixed_precision(bool to_set = true, int max_refinement_steps = 10, double refinement_tolerance = 1e-12);
+
+      /// @return false if the factorization failed or the refinement did not converge.
+      bool solve_mixed_precision();
+      /// (Re)initialize the single precision instance of MUMPS.
+      bool reinit_single();
+
+      /// MUMPS structure of the single precision factorization.
+      typename mumps_single_type<Scalar>::mumps_struct single_param;
+      /// Single precision copy of the matrix entries.
+      typename mumps_single_type<Scalar>::mumps_Scalar *single_Ax;
+      bool single_inited;
+      /// Structure of the single precision analysis.
+      unsigned long single_structure_hash;
+#endif
     private:
       void mumps_c(typename mumps_type<Scalar>::mumps_struct * param);  //wrapper around dmums_c or zmumps_c
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      void mumps_c(typename mumps_single_type<Scalar>::mumps_struct * param);  //wrapper around smumps_c or cmumps_c
+#endif
     };
   }
 }
@@ -46,12 +46,12 @@ namespace Hermes
 
       Scalar *get_sln_vector();
 
-      /// Set the name of the iterative method employed by AztecOO (ignored
+      /// Set the name of the iterative method employed by AztecOO or KrylovSolver (ignored
       /// by the other solvers).
       /// \param[in] preconditioner_name See the attribute preconditioner.
       void set_iterative_method(const char* iterative_method_name);
 
-      /// Set the name of the preconditioner employed by AztecOO (ignored by
+      /// Set the name of the preconditioner employed by AztecOO or KrylovSolver (ignored by
       /// the other solvers).
       /// \param[in] preconditioner_name See the attribute preconditioner.
       void set_preconditioner(const char* preconditioner_name);
@@ -71,13 +71,13 @@ namespace Hermes
 
       /// Name of the iterative method employed by AztecOO (ignored
       /// by the other solvers).
-      /// Possibilities: gmres, cg, cgs, tfqmr, bicgstab.
+      /// Possibilities: gmres, cg, cgs, tfqmr, bicgstab (KrylovSolver: gmres, cg, bicgstab).
       char* iterative_method;
 
       /// Name of the preconditioner employed by AztecOO (ignored by
       /// the other solvers).
       /// Possibilities: none, jacobi, neumann, least-squares, or a
-      ///  preconditioner from IFPACK (see solver/aztecoo.h).
+      ///  preconditioner from IFPACK (see solver/aztecoo.h), KrylovSolver: none, jacobi, ilu, block-jacobi.
       char* preconditioner;
     };
   }
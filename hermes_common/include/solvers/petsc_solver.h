@@ -44,6 +44,8 @@ namespace Hermes
   namespace Algebra
   {
     /// \brief Wrapper of PETSc matrix, to store matrices used with PETSc in its native format.
+    /// With MPI (WITH_MPI) and more than one process the matrix is distributed (MPIAIJ) by blocks of rows, entries may be added
+    /// to any row, those of the other processes' rows are sent in finish(). get() returns only the entries of this process' rows.
     template <typename Scalar>
     class PetscMatrix : public SparseMatrix<Scalar>
     {
@@ -93,6 +95,11 @@ namespace Hermes
       /// @param[in] ax values
       ///  @todo same input parameters acts differen as in superlu
       void create(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
+      /// Wraps the CSR arrays (e.g. those of CSRMatrix) without copying them (MatCreateSeqAIJWithArrays) - they must
+      /// outlive the matrix. PETSc is built with complex scalars, so real values are converted (into values).
+      /// @param[in] ap index to aj/ax, where each row starts (size is matrix size + 1)
+      /// @param[in] aj column indices (sorted in every row)
+      void create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, Scalar* ax);
       // Duplicates a matrix (including allocation).
       PetscMatrix* duplicate();
     protected:
@@ -102,11 +109,14 @@ namespace Hermes
       unsigned int nnz;
       /// Is matrix inited (allocated)?
       bool inited;
+      /// Values of a matrix created from arrays (create(), create_view()) - PETSc does not copy them, NULL if not needed.
+      PetscScalar* values;
 
       friend class Solvers::PetscLinearMatrixSolver<Scalar>;
     };
 
     /// Wrapper of PETSc vector, to store vectors used with PETSc in its native format.
+    /// Distributed like PetscMatrix, extract() gathers the whole vector to every process.
     ///
     template <typename Scalar>
     class PetscVector : public Vector<Scalar>
@@ -38,6 +38,64 @@ namespace Hermes
   /// Namespace containing objects for preconditioners.
   namespace Preconditioners
   {
+    /// Reuse of a preconditioner between its create() / compute() calls with a matrix of the same structure,
+    /// as in the Newton's or time stepping loops (MlPrecond::set_reuse(), IfpackPrecond::set_reuse()).
+    enum PrecondReuse
+    {
+      /// Everything is built again for every matrix (default).
+      HERMES_PRECOND_REBUILD,
+      /// The part given by the structure is kept (the ML aggregates and prolongators, the IFPACK graph and symbolic
+      /// factorization), the values (the smoothers, the coarse matrices, the numeric factorization) are recomputed.
+      HERMES_PRECOND_REUSE_STRUCTURE,
+      /// The preconditioner of the previous matrix is used as it is.
+      HERMES_PRECOND_REUSE_COMPLETELY
+    };
+
+    /// The bookkeeping of PrecondReuse: whether a preconditioner has to be built from scratch for a matrix.
+    class PrecondReuseState
+    {
+    public:
+      PrecondReuseState() : reuse(HERMES_PRECOND_REBUILD), rebuild_every(0), num_reuses(0), matrix(NULL), structure_hash(0), built(false) {}
+
+      /// @param[in] rebuild_every - the preconditioner is built from scratch after this number of reuses at the latest (0 - no limit)
+      void set(PrecondReuse reuse, int rebuild_every)
+      {
+        this->reuse = reuse;
+        this->rebuild_every = rebuild_every;
+      }
+
+      /// To be called in create(): true if the preconditioner has to be built from scratch - the first matrix,
+      /// another matrix object or structure, HERMES_PRECOND_REBUILD, or rebuild_every reuses since the last build.
+      bool needs_rebuild(const void* matrix, unsigned long structure_hash)
+      {
+        bool rebuild = !this->built || this->reuse == HERMES_PRECOND_REBUILD || matrix != this->matrix || structure_hash != this->structure_hash
+          || (this->rebuild_every > 0 && this->num_reuses >= this->rebuild_every);
+        if(rebuild)
+        {
+          this->num_reuses = 0;
+          this->matrix = matrix;
+          this->structure_hash = structure_hash;
+          this->built = true;
+        }
+        else
+          this->num_reuses++;
+        return rebuild;
+      }
+
+      /// Forget the preconditioner (e.g. destroyed).
+      void reset()
+      {
+        this->built = false;
+      }
+
+      PrecondReuse reuse;
+      int rebuild_every;
+      int num_reuses;
+      const void* matrix;
+      unsigned long structure_hash;
+      bool built;
+    };
+
     /// \brief Abstract class to define interface for preconditioners.
     ///
     /// @ingroup preconds
@@ -52,6 +110,12 @@ namespace Hermes
       virtual void destroy() = 0;
       virtual void compute() = 0;
 
+      /// z = M^{-1} r, the application used by the built-in solvers (KrylovSolver).
+      virtual void apply(Scalar *r, Scalar *z)
+      {
+        throw Hermes::Exceptions::MethodNotOverridenException("Precond<Scalar>::apply");
+      }
+
 #ifdef HAVE_EPETRA
       virtual Epetra_Operator *get_obj() = 0;
 
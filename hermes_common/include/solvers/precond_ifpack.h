@@ -57,6 +57,12 @@ namespace Hermes
       void set_param(const char *name, const char *value);
       void set_param(const char *name, int value);
       void set_param(const char *name, double value);
+
+      /// Reuse for the next matrices of the same structure (the same EpetraMatrix, e.g. the Jacobians of the Newton's
+      /// iterations): HERMES_PRECOND_REUSE_STRUCTURE keeps the preconditioner object with its graph and symbolic
+      /// factorization (Initialize()) and recomputes only the values (Compute()), HERMES_PRECOND_REUSE_COMPLETELY keeps all.
+      /// @param[in] rebuild_every - the preconditioner is built from scratch after this number of reuses at the latest (0 - no limit)
+      void set_reuse(PrecondReuse reuse, int rebuild_every = 0);
     protected:
 
       virtual Epetra_Operator *get_obj() { return prec; }
@@ -84,6 +90,10 @@ namespace Hermes
       const char *type;
       int overlap;
 
+      /// See set_reuse(), rebuild - the last create() built the preconditioner from scratch.
+      PrecondReuseState reuse_state;
+      bool rebuild;
+
       friend class AztecOOSolver<Scalar>;
     };
   }
@@ -50,6 +50,12 @@ namespace Hermes
       void set_param(const char *name, const char *value);
       void set_param(const char *name, int value);
       void set_param(const char *name, double value);
+
+      /// Reuse of the hierarchy for the next matrices of the same structure (the same EpetraMatrix, e.g. the Jacobians
+      /// of the Newton's iterations): HERMES_PRECOND_REUSE_STRUCTURE keeps the aggregates and the prolongators and recomputes
+      /// the coarse matrices and the smoothers (ML's ReComputePreconditioner()), HERMES_PRECOND_REUSE_COMPLETELY keeps all.
+      /// @param[in] rebuild_every - the hierarchy is built from scratch after this number of reuses at the latest (0 - no limit)
+      void set_reuse(PrecondReuse reuse, int rebuild_every = 0);
     protected:
       virtual Epetra_Operator *get_obj() { return prec; }
 
@@ -73,6 +79,10 @@ namespace Hermes
       EpetraMatrix<Scalar> *mat;
       unsigned owner:1;
 
+      /// See set_reuse(), rebuild - the last create() built the preconditioner from scratch.
+      PrecondReuseState reuse_state;
+      bool rebuild;
+
       friend class AztecOOSolver<Scalar>;
     };
   }
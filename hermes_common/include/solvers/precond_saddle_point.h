@@ -0,0 +1,115 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file precond_saddle_point.h
+\brief SaddlePointPrecond class, the block preconditioner of the mixed (saddle point) systems for KrylovSolver.
+*/
+#ifndef __HERMES_COMMON_PRECOND_SADDLE_POINT_H_
+#define __HERMES_COMMON_PRECOND_SADDLE_POINT_H_
+
+#include "precond.h"
+#include "krylov_solver.h"
+
+namespace Hermes
+{
+  namespace Preconditioners
+  {
+    /// \brief Block preconditioner of the saddle point systems [A C; B D] of the mixed methods (e.g. Darcy flow with
+    /// the velocity in an Hdiv space and the pressure in an L2 space), for the built-in KrylovSolver (set_precond()).
+    ///
+    /// The first num_first_block unknowns are those of the first (velocity) block, the rest those of the second
+    /// (pressure) block - the order of the spaces of the discrete problem. compute() splits the monolithic CSR matrix
+    /// into the blocks A, C, B, D and forms the approximate Schur complement S = D - B diag(A)^{-1} C (the velocity mass
+    /// matrix A lumped to its diagonal), or takes the user's approximation (set_schur_approximation(), e.g. the pressure
+    /// mass matrix of Stokes problems). A and S are then approximately inverted by the ILU(0) (or the block-Jacobi ILU(0))
+    /// preconditioner of KrylovSolver.
+    ///
+    /// The application is block upper triangular, z_2 = S^{-1} r_2, z_1 = A^{-1} (r_1 - C z_2), or block diagonal
+    /// (set_block_diagonal()). It is a fixed linear operator, so it can be used with the restarted GMRES and BiCGStab.
+    ///
+    /// @ingroup preconds
+    template <typename Scalar>
+    class HERMES_API SaddlePointPrecond : public Precond<Scalar>
+    {
+    public:
+      /// @param[in] num_first_block - the number of the unknowns of the first (velocity) block.
+      SaddlePointPrecond(int num_first_block);
+      virtual ~SaddlePointPrecond();
+
+      /// The block diagonal application diag(A, S)^{-1} instead of the block upper triangular one.
+      void set_block_diagonal(bool block_diagonal = true);
+
+      /// The preconditioner of the blocks [ ilu | block-jacobi ], ilu by default.
+      void set_block_precond(const char *name);
+
+      /// The approximation of the Schur complement (the size of the second block, with the diagonal entries in its
+      /// structure) instead of D - B diag(A)^{-1} C. Not copied, it has to live until the preconditioner is computed again
+      /// or deleted. NULL switches back to the lumped one.
+      void set_schur_approximation(CSRMatrix<Scalar>* schur_approximation);
+
+      virtual void create(Matrix<Scalar> *mat);
+      virtual void destroy();
+      virtual void compute();
+      virtual void apply(Scalar *r, Scalar *z);
+
+      /// The blocks of the last compute(), the first diagonal block A and the approximate Schur complement.
+      CSRMatrix<Scalar>* get_first_block();
+      CSRMatrix<Scalar>* get_schur_complement();
+
+#ifdef HAVE_EPETRA
+      virtual Epetra_Operator *get_obj() { return NULL; }
+      virtual const Epetra_Comm &Comm() const { throw Hermes::Exceptions::Exception("SaddlePointPrecond is only for KrylovSolver."); }
+      virtual const Epetra_Map &OperatorDomainMap() const { throw Hermes::Exceptions::Exception("SaddlePointPrecond is only for KrylovSolver."); }
+      virtual const Epetra_Map &OperatorRangeMap() const { throw Hermes::Exceptions::Exception("SaddlePointPrecond is only for KrylovSolver."); }
+#endif
+
+    protected:
+      /// One block of the matrix, rows [row_start, row_end) and columns [col_start, col_end), into CSR arrays.
+      void extract_block(int row_start, int row_end, int col_start, int col_end, bool diagonal_in_structure,
+        std::vector<int>& ap, std::vector<int>& aj, std::vector<Scalar>& ax);
+
+      /// y = M x for a block M in CSR arrays.
+      static void multiply_block(int rows, const std::vector<int>& ap, const std::vector<int>& aj, const std::vector<Scalar>& ax, Scalar *x, Scalar *y);
+
+      /// S = D - B diag(A)^{-1} C, the row-by-row sparse product (the structure of D kept, including the diagonal).
+      void calculate_schur_complement();
+
+      int num_first_block;
+      bool block_diagonal;
+      const char *block_precond;
+      CSRMatrix<Scalar>* schur_approximation;
+
+      CSRMatrix<Scalar>* mat;
+      int size;
+
+      /// The off-diagonal blocks C (first x second) and B (second x first).
+      std::vector<int> C_ap, C_aj, B_ap, B_aj;
+      std::vector<Scalar> C_ax, B_ax;
+
+      /// The diagonal blocks and their preconditioners (only the preconditioner of KrylovSolver is used).
+      CSRMatrix<Scalar>* A;
+      CSRMatrix<Scalar>* S;
+      Hermes::Solvers::KrylovSolver<Scalar>* A_solver;
+      Hermes::Solvers::KrylovSolver<Scalar>* S_solver;
+
+      /// Work vector of the size of the first block.
+      Scalar* work;
+    };
+  }
+}
+#endif
@@ -139,6 +139,9 @@ namespace Hermes
       /// @param[in] ai row indices
       /// @param[in] ax values
       void create(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
+      /// Wraps the CSC arrays (e.g. those of CSCMatrix) without copying them - they must outlive the matrix
+      /// and are not deleted by it. Parameters as in create().
+      void create_view(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax);
       // Duplicates a matrix (including allocation).
       SuperLUMatrix<Scalar>* duplicate();
 
@@ -152,6 +155,8 @@ namespace Hermes
       unsigned int *Ap;
       /// Number of non-zero entries ( =  Ap[size]).
       unsigned int nnz;
+      /// Are the arrays owned (false for create_view())?
+      bool owner;
 
       friend class Solvers::SuperLUSolver<Scalar>;
       template<typename T> friend SparseMatrix<T>*  create_matrix();
@@ -203,6 +208,11 @@ namespace Hermes
       virtual bool solve();
       virtual int get_matrix_size();
 
+      /// Number of threads of the factorization (SuperLU_MT only, ignored by the sequential SuperLU).
+      /// Default: HermesCommonApi matrixSolverNumThreads (Hermes2DApi numThreads), omp_get_max_threads() if not set.
+      /// Takes effect in the next factorization.
+      void set_num_threads(int num_threads);
+
     protected:
       /// Matrix to solve.
       SuperLUMatrix<Scalar> *m;
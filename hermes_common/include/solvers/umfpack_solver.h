@@ -62,6 +62,8 @@ namespace Hermes
       CSCMatrix(unsigned int size);
       virtual ~CSCMatrix();
       virtual void alloc();
+      /// The pattern is already in the CSC format - taken as it is.
+      virtual void create_structure(unsigned int n, int* Ap, int* Ai);
       virtual void free();
       virtual Scalar get(unsigned int m, unsigned int n);
       virtual void zero();
@@ -70,6 +72,8 @@ namespace Hermes
       /// Add matrix.
       /// @param[in] mat matrix to be added
       virtual void add_matrix(CSCMatrix<Scalar>* mat);
+      /// Add matrix of the same type (entrywise if the sparse structure is the same).
+      virtual void add_sparse_matrix(SparseMatrix<Scalar>* mat);
       /// Add matrix to diagonal.
       /// @param[in] num_stages matrix is added to num_stages positions. num_stages * size(added matrix) = size(target matrix)
       /// @param[in] mat added matrix
@@ -81,16 +85,29 @@ namespace Hermes
       /// @param[in] mat added matrix
       virtual void add_as_block(unsigned int i, unsigned int j, CSCMatrix<Scalar>* mat);
       virtual void add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols);
+      virtual bool get_positions(unsigned int m, unsigned int n, int *rows, int *cols, int *positions);
+      virtual void add_at_positions(unsigned int m, unsigned int n, Scalar **mat, int *positions);
       virtual bool dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt = DF_MATLAB_SPARSE, char* number_format = "%lf");
       virtual unsigned int get_matrix_size() const;
       virtual unsigned int get_nnz() const;
       virtual double get_fill_in() const;
 
+      /// Thread-private assembly, see SparseMatrix::begin_thread_private_assembly().
+      /// The buffered values are summed into Ax in finish(), ordered by (position, key, order of insertion).
+      virtual void begin_thread_private_assembly(int num_threads);
+      virtual void set_assembly_key(int key);
+      virtual void finish();
+
       // Applies the matrix to vector_in and saves result to vector_out.
       void multiply_with_vector(Scalar* vector_in, Scalar* vector_out);
       // Multiplies matrix with a Scalar.
       void multiply_with_Scalar(Scalar value);
 
+      /// Loads a matrix dumped in DF_HERMES_BIN. The file is mapped to memory (read on Windows), the arrays point into it,
+      /// nothing is parsed or copied. The changes of the values stay private to this matrix, the file is not modified.
+      /// Throws an exception if the file is not a CSC matrix dump (version 2) of this Scalar type.
+      void load(const char* filename);
+
       // Duplicates a matrix (including allocation).
       CSCMatrix* duplicate();
       // Exposes pointers to the CSC arrays.
@@ -113,6 +130,32 @@ namespace Hermes
       int *Ap;
       /// Number of non-zero entries ( =  Ap[size]).
       unsigned int nnz;
+
+      /// One value stored by a thread during thread-private assembly.
+      struct ThreadPrivateEntry
+      {
+        /// Index to Ax.
+        int position;
+        /// Assembly key at the time of insertion.
+        int key;
+        Scalar value;
+      };
+      /// Per-thread buffers (NULL if thread-private assembly is not on).
+      Hermes::vector<ThreadPrivateEntry>* thread_private_entries;
+      /// Per-thread current assembly keys.
+      int* thread_private_keys;
+      /// Number of the buffers.
+      int thread_private_count;
+      /// Sums the buffers into Ax and deallocates them.
+      void finish_thread_private_assembly();
+
+      /// The file loaded by load() the arrays point into (NULL if they are allocated).
+      char* binary_dump;
+      size_t binary_dump_length;
+
+      /// Adds v to Ax[position], thread-safe.
+      void add_to_position(int position, Scalar v);
+
       template <typename T> friend class Hermes::Solvers::UMFPackLinearMatrixSolver;
       template <typename T> friend class Hermes::Solvers::UMFPackIterator;
       template<typename T> friend SparseMatrix<T>*  create_matrix();
@@ -139,6 +182,10 @@ namespace Hermes
       virtual ~UMFPackVector();
       virtual void alloc(unsigned int ndofs);
       virtual void free();
+      /// Adds the per-thread buffers of the parallel add() to the vector.
+      virtual void finish();
+      /// The value of a finished vector (see finish()) - the values added in parallel since then are not in it yet.
+      /// The bulk accessors (get_c_array(), extract(), dump(), set(), add_vector(), change_sign()) reduce the per-thread buffers themselves.
       virtual Scalar get(unsigned int idx);
       virtual void extract(Scalar *v) const;
       virtual void zero();
@@ -150,6 +197,9 @@ namespace Hermes
       virtual void add_vector(Scalar* vec);
       virtual bool dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt = DF_MATLAB_SPARSE, char* number_format = "%lf");
 
+      /// Loads a vector dumped in DF_HERMES_BIN, mapped to memory as CSCMatrix::load().
+      void load(const char* filename);
+
       /// @return pointer to array with vector data
       /// \sa #v
       Scalar *get_c_array();
@@ -157,6 +207,23 @@ namespace Hermes
     protected:
       /// UMFPack specific data structures for storing the rhs.
       Scalar *v;
+
+      /// Per-thread buffers of add() called by several threads (unless conflict_free_assembly), so that the threads
+      /// never synchronize. Thread t allocates thread_v[t] on its first add(), the buffers are added to v (in parallel)
+      /// by finish() and by the bulk accessors, not by get().
+      Scalar **thread_v;
+      /// Does thread_v[t] hold values not added to v yet?
+      bool *thread_v_used;
+      int num_thread_buffers;
+      /// The buffer of the calling thread, NULL if called by a single thread (or a thread beyond num_thread_buffers).
+      Scalar* get_thread_buffer();
+      /// Adds the used buffers to v and zeroes them.
+      void reduce_thread_buffers();
+      void alloc_thread_buffers();
+
+      /// The file loaded by load() v points into (NULL if v is allocated).
+      char* binary_dump;
+      size_t binary_dump_length;
       template <typename T> friend class Hermes::Solvers::UMFPackLinearMatrixSolver;
       template <typename T> friend class Hermes::Solvers::UMFPackIterator;
       template<typename T> friend Vector<T>* Hermes::Algebra::create_vector();
@@ -177,6 +244,8 @@ namespace Hermes
       UMFPackLinearMatrixSolver(UMFPackMatrix<Scalar> *m, UMFPackVector<Scalar> *rhs);
       virtual ~UMFPackLinearMatrixSolver();
       virtual bool solve();
+      /// Reuses the numeric factorization of the last solve().
+      virtual bool solve_transposed();
       virtual int get_matrix_size();
 
       /// Matrix to solve.
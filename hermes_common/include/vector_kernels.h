@@ -0,0 +1,137 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file vector_kernels.h
+\brief BLAS-1 operations on the coefficient arrays and vectors.
+*/
+#ifndef __HERMES_COMMON_VECTOR_KERNELS_H
+#define __HERMES_COMMON_VECTOR_KERNELS_H
+
+#include "common.h"
+#include "compat.h"
+
+namespace Hermes
+{
+  namespace Algebra
+  {
+    template<typename Scalar> class Vector;
+
+    /// \brief BLAS-1 operations (copy, scale, axpy, dot, nrm2) on arrays of length n.
+    /// The loops are simple enough to be vectorized by the compiler, long arrays are split among the OpenMP threads
+    /// (static schedule). The complex dot product conjugates the first argument.
+    namespace VectorKernels
+    {
+      /// Arrays shorter than this are processed by the calling thread only.
+      const int parallel_threshold = 16384;
+
+      /// y = x
+      template<typename Scalar>
+      HERMES_API void copy(int n, const Scalar* x, Scalar* y);
+
+      /// x = 0
+      template<typename Scalar>
+      HERMES_API void zero(int n, Scalar* x);
+
+      /// x = 0 for a newly allocated array, placing its pages on the NUMA nodes (HermesCommonApi numaPlacement):
+      /// every thread of the assembly (matrixSolverNumThreads, i.e. Hermes2D numThreads) zeroes - first touches -
+      /// the contiguous part it gets in the static schedule, or the pages are interleaved over all the nodes.
+      /// Only the pages not touched yet are placed (the constructors of std::complex touch them in new[]).
+      /// The threads should be bound to the cores (e.g. OMP_PROC_BIND=true), otherwise they migrate away from their pages.
+      template<typename Scalar>
+      HERMES_API void first_touch_zero(int n, Scalar* x);
+
+      /// x = a * x
+      template<typename Scalar>
+      HERMES_API void scale(int n, Scalar a, Scalar* x);
+
+      /// y = a * x + y
+      template<typename Scalar>
+      HERMES_API void axpy(int n, Scalar a, const Scalar* x, Scalar* y);
+
+      /// y = a * x + b * y
+      template<typename Scalar>
+      HERMES_API void axpby(int n, Scalar a, const Scalar* x, Scalar b, Scalar* y);
+
+      /// w = a * x + y (w may be neither x nor y)
+      template<typename Scalar>
+      HERMES_API void waxpy(int n, Scalar a, const Scalar* x, const Scalar* y, Scalar* w);
+
+      /// sum conj(x_i) y_i
+      HERMES_API double dot(int n, const double* x, const double* y);
+      HERMES_API std::complex<double> dot(int n, const std::complex<double>* x, const std::complex<double>* y);
+
+      /// ||x||_2
+      template<typename Scalar>
+      HERMES_API double nrm2(int n, const Scalar* x);
+
+      /// ||x - y||_2
+      template<typename Scalar>
+      HERMES_API double diff_nrm2(int n, const Scalar* x, const Scalar* y);
+
+      /// ||vec||_2 (of the values extracted by Vector::extract()).
+      template<typename Scalar>
+      HERMES_API double nrm2(Vector<Scalar>* vec);
+
+      /// *y += a, safe against the other threads without a critical section: an atomic update, the complex number
+      /// (laid out as its real and imaginary part, double[2]) by two atomic updates of the parts.
+      inline void atomic_add(double* y, double a)
+      {
+#pragma omp atomic
+        *y += a;
+      }
+
+      inline void atomic_add(std::complex<double>* y, std::complex<double> a)
+      {
+        double* parts = reinterpret_cast<double*>(y);
+        double re = a.real(), im = a.imag();
+#pragma omp atomic
+        parts[0] += re;
+#pragma omp atomic
+        parts[1] += im;
+      }
+
+      /// sum x_{i * stride}, i < n, by pairwise summation (the rounding error grows with log n instead of n),
+      /// the order of the additions depends on n only.
+      HERMES_API double pairwise_sum(int n, const double* x, int stride = 1);
+
+      /// Compensated (Kahan-Babuska) summation of a sequence of terms.
+      class CompensatedSum
+      {
+      public:
+        CompensatedSum() : sum(0.0), compensation(0.0) {}
+
+        inline void add(double term)
+        {
+          double t = sum + term;
+          if(std::abs(sum) >= std::abs(term))
+            compensation += (sum - t) + term;
+          else
+            compensation += (term - t) + sum;
+          sum = t;
+        }
+
+        inline double value() const { return sum + compensation; }
+
+      private:
+        double sum;
+        double compensation;
+      };
+    }
+  }
+}
+#endif
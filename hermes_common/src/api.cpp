@@ -42,6 +42,10 @@ namespace Hermes
 
     this->parameters.insert(std::pair<HermesCommonApiParam, Parameter*> (Hermes::exceptionsPrintCallstack,new Parameter(0)));
     this->parameters.insert(std::pair<HermesCommonApiParam, Parameter*> (Hermes::matrixSolverType,new Parameter(SOLVER_UMFPACK)));
+    this->parameters.insert(std::pair<HermesCommonApiParam, Parameter*> (Hermes::matrixSolverNumThreads,new Parameter(0)));
+    this->parameters.insert(std::pair<HermesCommonApiParam, Parameter*> (Hermes::numaPlacement,new Parameter(HERMES_NUMA_FIRST_TOUCH)));
+
+    this->update_cached_values();
   }
 
   Api::~Api()
@@ -65,6 +69,36 @@ namespace Hermes
       throw Hermes::Exceptions::Exception("Wrong Hermes::Api parameter name:%i", param);
     this->parameters.find(param)->second->user_set = true;
     this->parameters.find(param)->second->user_val = value;
+
+    this->update_cached_values();
+
+    for(unsigned int i = 0; i < this->param_changed_callbacks.size(); i++)
+      this->param_changed_callbacks[i].first(param, value, this->param_changed_callbacks[i].second);
+  }
+
+  void Api::update_cached_values()
+  {
+    this->matrix_solver_type = this->get_integral_param_value(Hermes::matrixSolverType);
+    this->matrix_solver_num_threads = this->get_integral_param_value(Hermes::matrixSolverNumThreads);
+    this->exceptions_print_callstack = this->get_integral_param_value(Hermes::exceptionsPrintCallstack) == 1;
+    this->numa_placement = this->get_integral_param_value(Hermes::numaPlacement);
+  }
+
+  void Api::add_param_changed_callback(ParamChangedCallback callback, void* data)
+  {
+    this->param_changed_callbacks.push_back(std::pair<ParamChangedCallback, void*>(callback, data));
+  }
+
+  void Api::remove_param_changed_callback(ParamChangedCallback callback, void* data)
+  {
+    for(unsigned int i = 0; i < this->param_changed_callbacks.size(); i++)
+    {
+      if(this->param_changed_callbacks[i].first == callback && this->param_changed_callbacks[i].second == data)
+      {
+        this->param_changed_callbacks.erase(this->param_changed_callbacks.begin() + i);
+        return;
+      }
+    }
   }
 
   Hermes::Api HermesCommonApi;
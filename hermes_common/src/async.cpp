@@ -0,0 +1,152 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file async.cpp
+\brief Asynchronous tasks (futures) and their dependencies, for pipelining independent stages.
+*/
+#include "async.h"
+
+namespace Hermes
+{
+  AsyncTask::AsyncTask() : started(false), finished(false), joined(false), caught_exception(NULL)
+  {
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&finished_condition, NULL);
+  }
+
+  AsyncTask::~AsyncTask()
+  {
+    join();
+    delete caught_exception;
+    pthread_cond_destroy(&finished_condition);
+    pthread_mutex_destroy(&mutex);
+  }
+
+  void AsyncTask::depends_on(AsyncTask* task)
+  {
+    if(this->started)
+      throw Hermes::Exceptions::Exception("AsyncTask::depends_on() called on a started task.");
+    if(task == NULL)
+      throw Hermes::Exceptions::NullException(1);
+    this->dependencies.push_back(task);
+  }
+
+  void AsyncTask::start()
+  {
+    if(this->started)
+      throw Hermes::Exceptions::Exception("AsyncTask::start() called on a started task.");
+    this->started = true;
+    if(pthread_create(&this->thread, NULL, thread_function, this) != 0)
+    {
+      // No thread - the task runs right here.
+      this->joined = true;
+      thread_function(this);
+    }
+  }
+
+  void* AsyncTask::thread_function(void* data)
+  {
+    AsyncTask* task = (AsyncTask*)data;
+    Hermes::Exceptions::Exception* exception = NULL;
+    for(unsigned int i = 0; i < task->dependencies.size() && exception == NULL; i++)
+    {
+      AsyncTask* dependency = task->dependencies[i];
+      pthread_mutex_lock(&dependency->mutex);
+      while(!dependency->finished)
+        pthread_cond_wait(&dependency->finished_condition, &dependency->mutex);
+      if(dependency->caught_exception != NULL)
+        exception = new Hermes::Exceptions::Exception("A dependency of the task failed: %s", dependency->caught_exception->what());
+      pthread_mutex_unlock(&dependency->mutex);
+    }
+
+    if(exception == NULL)
+    {
+      try
+      {
+        task->run();
+      }
+      catch(Hermes::Exceptions::Exception& e)
+      {
+        exception = e.clone();
+      }
+      catch(std::exception& e)
+      {
+        exception = new Hermes::Exceptions::Exception(e.what());
+      }
+    }
+
+    pthread_mutex_lock(&task->mutex);
+    task->caught_exception = exception;
+    task->finished = true;
+    pthread_cond_broadcast(&task->finished_condition);
+    pthread_mutex_unlock(&task->mutex);
+    return NULL;
+  }
+
+  void AsyncTask::join()
+  {
+    if(!this->started)
+      return;
+    bool to_join = false;
+    pthread_mutex_lock(&this->mutex);
+    while(!this->finished)
+      pthread_cond_wait(&this->finished_condition, &this->mutex);
+    if(!this->joined)
+    {
+      this->joined = true;
+      to_join = true;
+    }
+    pthread_mutex_unlock(&this->mutex);
+    if(to_join)
+      pthread_join(this->thread, NULL);
+  }
+
+  void AsyncTask::wait()
+  {
+    if(!this->started)
+      throw Hermes::Exceptions::Exception("AsyncTask::wait() called on a task that was not started.");
+    join();
+    if(this->caught_exception != NULL)
+      throw *(this->caught_exception);
+  }
+
+  bool AsyncTask::is_finished()
+  {
+    bool to_return;
+    pthread_mutex_lock(&this->mutex);
+    to_return = this->finished;
+    pthread_mutex_unlock(&this->mutex);
+    return to_return;
+  }
+
+  void AsyncTask::run_all(std::vector<AsyncTask*>& tasks)
+  {
+    for(unsigned int i = 0; i < tasks.size(); i++)
+      if(!tasks[i]->started)
+        tasks[i]->start();
+    Hermes::Exceptions::Exception* exception = NULL;
+    for(unsigned int i = 0; i < tasks.size(); i++)
+    {
+      tasks[i]->join();
+      if(exception == NULL && tasks[i]->caught_exception != NULL)
+        exception = tasks[i]->caught_exception;
+    }
+    if(exception != NULL)
+      throw *exception;
+  }
+}
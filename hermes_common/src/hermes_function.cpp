@@ -118,6 +118,32 @@ namespace Hermes
     }
   };
 
+  template<typename Scalar>
+  void Hermes1DFunction<Scalar>::values(int n, const Scalar* x, Scalar* out) const
+  {
+    if(this->is_const)
+    {
+      for (int i = 0; i < n; i++)
+        out[i] = const_value;
+      return;
+    }
+    for (int i = 0; i < n; i++)
+      out[i] = this->value(x[i]);
+  };
+
+  template<typename Scalar>
+  void Hermes1DFunction<Scalar>::derivatives(int n, const Scalar* x, Scalar* out) const
+  {
+    if(this->is_const)
+    {
+      for (int i = 0; i < n; i++)
+        out[i] = Scalar(0);
+      return;
+    }
+    for (int i = 0; i < n; i++)
+      out[i] = this->derivative(x[i]);
+  };
+
   template<typename Scalar>
   Hermes2DFunction<Scalar>::Hermes2DFunction()
   {
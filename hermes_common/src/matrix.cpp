@@ -21,6 +21,7 @@
 */
 #include "common.h"
 #include "matrix.h"
+#include "vector_kernels.h"
 #include "callstack.h"
 
 #include "solvers/linear_matrix_solver.h"
@@ -33,6 +34,9 @@
 #include "solvers/aztecoo_solver.h"
 #include "qsort.h"
 #include "api.h"
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
 
 void Hermes::Algebra::DenseMatrixOperations::ludcmp(double **a, int n, int *indx, double *d)
 {
@@ -171,6 +175,16 @@ void Hermes::Algebra::SparseMatrix<Scalar>::pre_add_ij(unsigned int row, unsigne
   pages[col]->idx[pages[col]->count++] = row;
 }
 
+template<typename Scalar>
+void Hermes::Algebra::SparseMatrix<Scalar>::create_structure(unsigned int n, int* Ap, int* Ai)
+{
+  this->prealloc(n);
+  for (unsigned int col = 0; col < n; col++)
+    for (int i = Ap[col]; i < Ap[col + 1]; i++)
+      this->pre_add_ij(Ai[i], col);
+  this->alloc();
+}
+
 template<typename Scalar>
 int Hermes::Algebra::SparseMatrix<Scalar>::sort_and_store_indices(Page *page, int *buffer, int *max)
 {
@@ -204,10 +218,1102 @@ int Hermes::Algebra::SparseMatrix<Scalar>::get_num_indices()
   return total;
 }
 
+namespace Hermes
+{
+  namespace Algebra
+  {
+    template<typename Scalar>
+    BSRMatrix<Scalar>::BSRMatrix() : block_size(1), num_blocks(0), blocks_size(0), dof_block(NULL), dof_component(NULL), block_dof(NULL),
+      Bp(NULL), Bj(NULL), Bx(NULL), nnzb(0)
+    {
+    }
+
+    template<typename Scalar>
+    BSRMatrix<Scalar>::~BSRMatrix()
+    {
+      this->free();
+      this->free_blocks();
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::free_blocks()
+    {
+      delete [] this->dof_block;
+      delete [] this->dof_component;
+      delete [] this->block_dof;
+      this->dof_block = this->dof_component = this->block_dof = NULL;
+      this->blocks_size = 0;
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::set_blocks(unsigned int size, unsigned int block_size, unsigned int num_blocks, int* dof_block, int* dof_component)
+    {
+      if(block_size < 1)
+        throw Exceptions::ValueException("block_size", block_size, 1);
+
+      this->free_blocks();
+      this->block_size = block_size;
+      this->num_blocks = num_blocks;
+      this->blocks_size = size;
+      this->dof_block = new int[size];
+      this->dof_component = new int[size];
+      this->block_dof = new int[num_blocks * block_size];
+      memcpy(this->dof_block, dof_block, size * sizeof(int));
+      memcpy(this->dof_component, dof_component, size * sizeof(int));
+      for(unsigned int i = 0; i < num_blocks * block_size; i++)
+        this->block_dof[i] = -1;
+
+      for(unsigned int i = 0; i < size; i++)
+      {
+        if(dof_block[i] < 0 || dof_block[i] >= (int)num_blocks || dof_component[i] < 0 || dof_component[i] >= (int)block_size)
+          throw Exceptions::Exception("Unknown %i out of the nodes in BSRMatrix::set_blocks().", i);
+        int position = dof_block[i] * block_size + dof_component[i];
+        if(this->block_dof[position] != -1)
+          throw Exceptions::Exception("Unknowns %i and %i share a component of a node in BSRMatrix::set_blocks().", this->block_dof[position], i);
+        this->block_dof[position] = i;
+      }
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::set_trivial_blocks(unsigned int size)
+    {
+      int* trivial_block = new int[size];
+      int* trivial_component = new int[size];
+      for(unsigned int i = 0; i < size; i++)
+      {
+        trivial_block[i] = i;
+        trivial_component[i] = 0;
+      }
+      this->set_blocks(size, 1, size, trivial_block, trivial_component);
+      delete [] trivial_block;
+      delete [] trivial_component;
+    }
+
+    template<typename Scalar>
+    unsigned int BSRMatrix<Scalar>::get_block_size() const
+    {
+      return this->block_size;
+    }
+
+    template<typename Scalar>
+    unsigned int BSRMatrix<Scalar>::get_num_blocks() const
+    {
+      return this->num_blocks;
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::prealloc(unsigned int n)
+    {
+      if(this->blocks_size != n)
+        this->set_trivial_blocks(n);
+      SparseMatrix<Scalar>::prealloc(n);
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::pre_add_ij(unsigned int row, unsigned int col)
+    {
+      // The pages are kept per block row here.
+      SparseMatrix<Scalar>::pre_add_ij(this->dof_block[col], this->dof_block[row]);
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::alloc()
+    {
+      assert(this->pages != NULL);
+
+      Bp = new int[this->num_blocks + 1];
+      int bjsize = this->get_num_indices();
+      Bj = new int[bjsize];
+
+      // Sort the block column indices and remove duplicities, insert into Bj.
+      unsigned int i;
+      int pos = 0;
+      for (i = 0; i < this->num_blocks; i++)
+      {
+        Bp[i] = pos;
+        pos += this->sort_and_store_indices(this->pages[i], Bj + pos, Bj + bjsize);
+      }
+      Bp[i] = pos;
+
+      delete [] this->pages;
+      this->pages = NULL;
+
+      nnzb = Bp[this->num_blocks];
+
+      Bx = new Scalar[nnzb * this->block_size * this->block_size];
+      memset(Bx, 0, sizeof(Scalar) * nnzb * this->block_size * this->block_size);
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::free()
+    {
+      nnzb = 0;
+      delete [] Bp;
+      Bp = NULL;
+      delete [] Bj;
+      Bj = NULL;
+      delete [] Bx;
+      Bx = NULL;
+    }
+
+    template<typename Scalar>
+    int BSRMatrix<Scalar>::find_block(int block_row, int block_col) const
+    {
+      int* begin = Bj + Bp[block_row];
+      int* end = Bj + Bp[block_row + 1];
+      int* it = std::lower_bound(begin, end, block_col);
+      if(it == end || *it != block_col)
+        return -1;
+      return it - Bj;
+    }
+
+    template<typename Scalar>
+    Scalar BSRMatrix<Scalar>::get(unsigned int m, unsigned int n)
+    {
+      int block = find_block(this->dof_block[m], this->dof_block[n]);
+      if(block < 0)
+        return 0.0;
+      return Bx[(block * this->block_size + this->dof_component[m]) * this->block_size + this->dof_component[n]];
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::zero()
+    {
+      memset(Bx, 0, sizeof(Scalar) * nnzb * this->block_size * this->block_size);
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar v)
+    {
+      if(v != 0.0)   // ignore zero values.
+      {
+        int block = find_block(this->dof_block[m], this->dof_block[n]);
+        // Make sure we are adding to an existing block.
+        if(block < 0)
+          throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", m, n);
+
+        Scalar* entry = Bx + (block * this->block_size + this->dof_component[m]) * this->block_size + this->dof_component[n];
+        if(this->conflict_free_assembly)
+          *entry += v;
+        else
+          VectorKernels::atomic_add(entry, v);
+      }
+    }
+
+    // Orders local unknowns by their nodes.
+    class BSRLocalOrder
+    {
+    public:
+      BSRLocalOrder(int* indices, int* dof_block) : indices(indices), dof_block(dof_block) {}
+      bool operator()(int a, int b) const { return dof_block[indices[a]] < dof_block[indices[b]]; }
+      int* indices;
+      int* dof_block;
+    };
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols)
+    {
+      // Local rows and columns (without the negative, i.e. Dirichlet ones) ordered by the nodes.
+      int* local_rows = new int[m + n];
+      int* local_cols = local_rows + m;
+      unsigned int rows_cnt = 0, cols_cnt = 0;
+      for (unsigned int i = 0; i < m; i++)
+        if(rows[i] >= 0)
+          local_rows[rows_cnt++] = i;
+      for (unsigned int j = 0; j < n; j++)
+        if(cols[j] >= 0)
+          local_cols[cols_cnt++] = j;
+      std::stable_sort(local_rows, local_rows + rows_cnt, BSRLocalOrder(rows, this->dof_block));
+      std::stable_sort(local_cols, local_cols + cols_cnt, BSRLocalOrder(cols, this->dof_block));
+
+      unsigned int bs = this->block_size;
+      for (unsigned int row_begin = 0, row_end; row_begin < rows_cnt; row_begin = row_end)
+      {
+        int block_row = this->dof_block[rows[local_rows[row_begin]]];
+        for (row_end = row_begin + 1; row_end < rows_cnt && this->dof_block[rows[local_rows[row_end]]] == block_row; row_end++);
+
+        for (unsigned int col_begin = 0, col_end; col_begin < cols_cnt; col_begin = col_end)
+        {
+          int block_col = this->dof_block[cols[local_cols[col_begin]]];
+          for (col_end = col_begin + 1; col_end < cols_cnt && this->dof_block[cols[local_cols[col_end]]] == block_col; col_end++);
+
+          // One search for all the entries of the pair of nodes.
+          int block = find_block(block_row, block_col);
+          if(block < 0)
+          {
+            for (unsigned int i = row_begin; i < row_end; i++)
+              for (unsigned int j = col_begin; j < col_end; j++)
+                if(mat[local_rows[i]][local_cols[j]] != 0.0)
+                {
+                  delete [] local_rows;
+                  throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", rows[local_rows[i]], cols[local_cols[j]]);
+                }
+            continue;
+          }
+
+          Scalar* block_values = Bx + block * bs * bs;
+          if(this->conflict_free_assembly)
+          {
+            for (unsigned int i = row_begin; i < row_end; i++)
+              for (unsigned int j = col_begin; j < col_end; j++)
+                block_values[this->dof_component[rows[local_rows[i]]] * bs + this->dof_component[cols[local_cols[j]]]] += mat[local_rows[i]][local_cols[j]];
+          }
+          else
+          {
+#pragma omp critical (BSRMatrix)
+            for (unsigned int i = row_begin; i < row_end; i++)
+              for (unsigned int j = col_begin; j < col_end; j++)
+                block_values[this->dof_component[rows[local_rows[i]]] * bs + this->dof_component[cols[local_cols[j]]]] += mat[local_rows[i]][local_cols[j]];
+          }
+        }
+      }
+
+      delete [] local_rows;
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::add_to_diagonal(Scalar v)
+    {
+      for (unsigned int i = 0; i < this->size; i++)
+        add(i, i, v);
+    }
+
+    template<typename Scalar>
+    bool BSRMatrix<Scalar>::dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt, char* number_format)
+    {
+      unsigned int bs = this->block_size;
+      switch (fmt)
+      {
+      case DF_MATLAB_SPARSE:
+        fprintf(file, "%% Size: %dx%d\n%% Nonzeros: %d\ntemp = zeros(%d, 3);\ntemp =[\n",
+          this->size, this->size, this->get_nnz(), this->get_nnz());
+        for (unsigned int block_row = 0; block_row < this->num_blocks; block_row++)
+          for (int block = Bp[block_row]; block < Bp[block_row + 1]; block++)
+            for (unsigned int a = 0; a < bs; a++)
+              for (unsigned int b = 0; b < bs; b++)
+              {
+                int row = this->block_dof[block_row * bs + a], col = this->block_dof[Bj[block] * bs + b];
+                if(row < 0 || col < 0)
+                  continue;
+                fprintf(file, "%d %d ", row + 1, col + 1);
+                Hermes::Helpers::fprint_num(file, Bx[(block * bs + a) * bs + b], number_format);
+                fprintf(file, "\n");
+              }
+        fprintf(file, "];\n%s = spconvert(temp);\n", var_name);
+        return true;
+
+      default:
+        return false;
+      }
+    }
+
+    template<typename Scalar>
+    unsigned int BSRMatrix<Scalar>::get_matrix_size() const
+    {
+      return this->size;
+    }
+
+    template<typename Scalar>
+    unsigned int BSRMatrix<Scalar>::get_nnz() const
+    {
+      return nnzb * this->block_size * this->block_size;
+    }
+
+    template<typename Scalar>
+    double BSRMatrix<Scalar>::get_fill_in() const
+    {
+      return this->get_nnz() / (double) (this->size * this->size);
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::multiply_with_vector(Scalar* vector_in, Scalar* vector_out)
+    {
+      unsigned int bs = this->block_size;
+      for (unsigned int i = 0; i < this->size; i++)
+        vector_out[i] = 0;
+
+      // The vector_in components of a node gathered once per block column.
+      Scalar* x = new Scalar[bs];
+      for (unsigned int block_row = 0; block_row < this->num_blocks; block_row++)
+      {
+        for (int block = Bp[block_row]; block < Bp[block_row + 1]; block++)
+        {
+          for (unsigned int b = 0; b < bs; b++)
+          {
+            int col = this->block_dof[Bj[block] * bs + b];
+            x[b] = col < 0 ? 0.0 : vector_in[col];
+          }
+          Scalar* block_values = Bx + block * bs * bs;
+          for (unsigned int a = 0; a < bs; a++)
+          {
+            int row = this->block_dof[block_row * bs + a];
+            if(row < 0)
+              continue;
+            Scalar y = 0;
+            for (unsigned int b = 0; b < bs; b++)
+              y += block_values[a * bs + b] * x[b];
+            vector_out[row] += y;
+          }
+        }
+      }
+      delete [] x;
+    }
+
+    template<typename Scalar>
+    void BSRMatrix<Scalar>::multiply_with_Scalar(Scalar value)
+    {
+      for (unsigned int i = 0; i < nnzb * this->block_size * this->block_size; i++)
+        Bx[i] *= value;
+    }
+
+    template class HERMES_API BSRMatrix<double>;
+    template class HERMES_API BSRMatrix<std::complex<double> >;
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>::CSRMatrix() : Ax(NULL), Aj(NULL), Ap(NULL), nnz(0), At_p(NULL), At_j(NULL), At_position(NULL)
+    {
+    }
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>::~CSRMatrix()
+    {
+      this->free();
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::transpose_structure(unsigned int size, int* p, int* i, int* t_p, int* t_i, int* positions)
+    {
+      // Counts of the entries in the transposed rows, then their starts.
+      memset(t_p, 0, (size + 1) * sizeof(int));
+      for (int k = 0; k < p[size]; k++)
+        t_p[i[k] + 1]++;
+      for (unsigned int row = 0; row < size; row++)
+        t_p[row + 1] += t_p[row];
+
+      // Going through the source rows in order keeps the transposed rows sorted.
+      int* next = new int[size];
+      memcpy(next, t_p, size * sizeof(int));
+      for (unsigned int row = 0; row < size; row++)
+        for (int k = p[row]; k < p[row + 1]; k++)
+        {
+          int position = next[i[k]]++;
+          t_i[position] = row;
+          positions[position] = k;
+        }
+      delete [] next;
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::create(unsigned int size, unsigned int nnz, int* ap, int* aj, Scalar* ax)
+    {
+      this->free();
+      this->size = size;
+      this->nnz = nnz;
+      this->Ap = new int[this->size + 1];
+      this->Aj = new int[this->nnz];
+      this->Ax = new Scalar[this->nnz];
+      memcpy(this->Ap, ap, (this->size + 1) * sizeof(int));
+      memcpy(this->Aj, aj, this->nnz * sizeof(int));
+      memcpy(this->Ax, ax, this->nnz * sizeof(Scalar));
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::create_from_CSC(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax)
+    {
+      this->free();
+      this->size = size;
+      this->nnz = nnz;
+      this->Ap = new int[this->size + 1];
+      this->Aj = new int[this->nnz];
+      this->Ax = new Scalar[this->nnz];
+      int* positions = new int[this->nnz];
+      // The CSC arrays of A are the CSR arrays of A^T.
+      transpose_structure(size, ap, ai, this->Ap, this->Aj, positions);
+      for (unsigned int k = 0; k < this->nnz; k++)
+        this->Ax[k] = ax[positions[k]];
+      delete [] positions;
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::get_CSC(int* ap, int* ai, Scalar* ax)
+    {
+      int* positions = new int[this->nnz];
+      transpose_structure(this->size, this->Ap, this->Aj, ap, ai, positions);
+      for (unsigned int k = 0; k < this->nnz; k++)
+        ax[k] = this->Ax[positions[k]];
+      delete [] positions;
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::pre_add_ij(unsigned int row, unsigned int col)
+    {
+      // The pages are kept per row here.
+      SparseMatrix<Scalar>::pre_add_ij(col, row);
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::alloc()
+    {
+      assert(this->pages != NULL);
+      this->free_transposed();
+
+      Ap = new int[this->size + 1];
+      int ajsize = this->get_num_indices();
+      Aj = new int[ajsize];
+
+      // Sort the column indices and remove duplicities, insert into Aj.
+      unsigned int i;
+      int pos = 0;
+      for (i = 0; i < this->size; i++)
+      {
+        Ap[i] = pos;
+        pos += this->sort_and_store_indices(this->pages[i], Aj + pos, Aj + ajsize);
+      }
+      Ap[i] = pos;
+
+      delete [] this->pages;
+      this->pages = NULL;
+
+      nnz = Ap[this->size];
+
+      Ax = new Scalar[nnz];
+      memset(Ax, 0, sizeof(Scalar) * nnz);
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::create_structure(unsigned int n, int* Ap, int* Ai)
+    {
+      this->free();
+      this->size = n;
+      this->nnz = Ap[n];
+      this->Ap = new int[n + 1];
+      this->Aj = new int[this->nnz];
+      int* positions = new int[this->nnz];
+      transpose_structure(n, Ap, Ai, this->Ap, this->Aj, positions);
+      delete [] positions;
+      this->Ax = new Scalar[this->nnz];
+      memset(this->Ax, 0, sizeof(Scalar) * this->nnz);
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::free_transposed()
+    {
+      delete [] At_p;
+      At_p = NULL;
+      delete [] At_j;
+      At_j = NULL;
+      delete [] At_position;
+      At_position = NULL;
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::free()
+    {
+      this->free_transposed();
+      nnz = 0;
+      delete [] Ap;
+      Ap = NULL;
+      delete [] Aj;
+      Aj = NULL;
+      delete [] Ax;
+      Ax = NULL;
+    }
+
+    template<typename Scalar>
+    Scalar CSRMatrix<Scalar>::get(unsigned int m, unsigned int n)
+    {
+      int* begin = Aj + Ap[m];
+      int* end = Aj + Ap[m + 1];
+      int* it = std::lower_bound(begin, end, (int)n);
+      if(it == end || *it != (int)n)
+        return 0.0;
+      return Ax[it - Aj];
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::zero()
+    {
+      memset(Ax, 0, sizeof(Scalar) * nnz);
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar v)
+    {
+      if(v != 0.0)   // ignore zero values.
+      {
+        int* begin = Aj + Ap[m];
+        int* end = Aj + Ap[m + 1];
+        int* it = std::lower_bound(begin, end, (int)n);
+        // Make sure we are adding to an existing non-zero entry.
+        if(it == end || *it != (int)n)
+          throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", m, n);
+
+        if(this->conflict_free_assembly)
+          Ax[it - Aj] += v;
+        else
+          VectorKernels::atomic_add(Ax + (it - Aj), v);
+      }
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols)
+    {
+      // The positions first, then all the values at once (one critical section for the local matrix).
+      int* positions = new int[m * n];
+      for (unsigned int i = 0; i < m; i++)
+      {
+        for (unsigned int j = 0; j < n; j++)
+        {
+          positions[i * n + j] = -1;
+          if(rows[i] < 0 || cols[j] < 0 || mat[i][j] == 0.0)
+            continue;
+          int* begin = Aj + Ap[rows[i]];
+          int* end = Aj + Ap[rows[i] + 1];
+          int* it = std::lower_bound(begin, end, cols[j]);
+          if(it == end || *it != cols[j])
+          {
+            delete [] positions;
+            throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", rows[i], cols[j]);
+          }
+          positions[i * n + j] = it - Aj;
+        }
+      }
+
+      if(this->conflict_free_assembly)
+      {
+        for (unsigned int i = 0; i < m; i++)
+          for (unsigned int j = 0; j < n; j++)
+            if(positions[i * n + j] >= 0)
+              Ax[positions[i * n + j]] += mat[i][j];
+      }
+      else
+      {
+#pragma omp critical (CSRMatrix)
+        for (unsigned int i = 0; i < m; i++)
+          for (unsigned int j = 0; j < n; j++)
+            if(positions[i * n + j] >= 0)
+              Ax[positions[i * n + j]] += mat[i][j];
+      }
+
+      delete [] positions;
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::add_to_diagonal(Scalar v)
+    {
+      for (unsigned int i = 0; i < this->size; i++)
+        add(i, i, v);
+    }
+
+    template<typename Scalar>
+    bool CSRMatrix<Scalar>::dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt, char* number_format)
+    {
+      switch (fmt)
+      {
+      case DF_MATLAB_SPARSE:
+        fprintf(file, "%% Size: %dx%d\n%% Nonzeros: %d\ntemp = zeros(%d, 3);\ntemp =[\n",
+          this->size, this->size, nnz, nnz);
+        for (unsigned int row = 0; row < this->size; row++)
+          for (int k = Ap[row]; k < Ap[row + 1]; k++)
+          {
+            fprintf(file, "%d %d ", row + 1, Aj[k] + 1);
+            Hermes::Helpers::fprint_num(file, Ax[k], number_format);
+            fprintf(file, "\n");
+          }
+        fprintf(file, "];\n%s = spconvert(temp);\n", var_name);
+        return true;
+
+      default:
+        return false;
+      }
+    }
+
+    template<typename Scalar>
+    unsigned int CSRMatrix<Scalar>::get_matrix_size() const
+    {
+      return this->size;
+    }
+
+    template<typename Scalar>
+    unsigned int CSRMatrix<Scalar>::get_nnz() const
+    {
+      return nnz;
+    }
+
+    template<typename Scalar>
+    double CSRMatrix<Scalar>::get_fill_in() const
+    {
+      return nnz / (double) (this->size * this->size);
+    }
+
+    template<typename Scalar>
+    int CSRMatrix<Scalar>::get_num_row_entries(unsigned int row)
+    {
+      return Ap[row + 1] - Ap[row];
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::multiply_with_vector(Scalar* vector_in, Scalar* vector_out)
+    {
+      int size = this->size;
+#pragma omp parallel for schedule(static)
+      for (int row = 0; row < size; row++)
+      {
+        Scalar y = 0;
+        for (int k = Ap[row]; k < Ap[row + 1]; k++)
+          y += Ax[k] * vector_in[Aj[k]];
+        vector_out[row] = y;
+      }
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::multiply_with_vector_transposed(Scalar* vector_in, Scalar* vector_out)
+    {
+      if(At_p == NULL)
+      {
+        At_p = new int[this->size + 1];
+        At_j = new int[nnz];
+        At_position = new int[nnz];
+        transpose_structure(this->size, Ap, Aj, At_p, At_j, At_position);
+      }
+
+      int size = this->size;
+#pragma omp parallel for schedule(static)
+      for (int row = 0; row < size; row++)
+      {
+        Scalar y = 0;
+        for (int k = At_p[row]; k < At_p[row + 1]; k++)
+          y += Ax[At_position[k]] * vector_in[At_j[k]];
+        vector_out[row] = y;
+      }
+    }
+
+    template<typename Scalar>
+    void CSRMatrix<Scalar>::multiply_with_Scalar(Scalar value)
+    {
+      for (unsigned int k = 0; k < nnz; k++)
+        Ax[k] *= value;
+    }
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>* CSRMatrix<Scalar>::duplicate()
+    {
+      CSRMatrix<Scalar>* new_matrix = new CSRMatrix<Scalar>();
+      new_matrix->create(this->size, nnz, Ap, Aj, Ax);
+      return new_matrix;
+    }
+
+    template<typename Scalar>
+    int *CSRMatrix<Scalar>::get_Ap()
+    {
+      return this->Ap;
+    }
+
+    template<typename Scalar>
+    int *CSRMatrix<Scalar>::get_Aj()
+    {
+      return this->Aj;
+    }
+
+    template<typename Scalar>
+    Scalar *CSRMatrix<Scalar>::get_Ax()
+    {
+      return this->Ax;
+    }
+
+    template class HERMES_API CSRMatrix<double>;
+    template class HERMES_API CSRMatrix<std::complex<double> >;
+
+    // One chunk of the SELL-C-sigma product, y[r] = sum over the columns j of the chunk of values[j][r] * vector_in[columns[j][r]].
+    template<typename Scalar>
+    static inline void sell_multiply_chunk(int width, const Scalar* values, const int* columns, const Scalar* vector_in, Scalar* y)
+    {
+      const int chunk_size = SELLMatrix<Scalar>::chunk_size;
+      for (int r = 0; r < chunk_size; r++)
+        y[r] = 0;
+      for (int j = 0; j < width; j++, values += chunk_size, columns += chunk_size)
+        for (int r = 0; r < chunk_size; r++)
+          y[r] += values[r] * vector_in[columns[r]];
+    }
+
+    // Real chunks with one (AVX-512) or two (AVX2) gathers per column of the chunk.
+    static inline void sell_multiply_chunk(int width, const double* values, const int* columns, const double* vector_in, double* y)
+    {
+#if defined(__AVX512F__)
+      __m512d sum = _mm512_setzero_pd();
+      for (int j = 0; j < width; j++, values += 8, columns += 8)
+      {
+        __m512d x = _mm512_i32gather_pd(_mm256_loadu_si256((const __m256i*)columns), vector_in, 8);
+        sum = _mm512_fmadd_pd(_mm512_loadu_pd(values), x, sum);
+      }
+      _mm512_storeu_pd(y, sum);
+#elif defined(__AVX2__) && defined(__FMA__)
+      __m256d sum_0 = _mm256_setzero_pd();
+      __m256d sum_1 = _mm256_setzero_pd();
+      for (int j = 0; j < width; j++, values += 8, columns += 8)
+      {
+        __m256d x_0 = _mm256_i32gather_pd(vector_in, _mm_loadu_si128((const __m128i*)columns), 8);
+        __m256d x_1 = _mm256_i32gather_pd(vector_in, _mm_loadu_si128((const __m128i*)(columns + 4)), 8);
+        sum_0 = _mm256_fmadd_pd(_mm256_loadu_pd(values), x_0, sum_0);
+        sum_1 = _mm256_fmadd_pd(_mm256_loadu_pd(values + 4), x_1, sum_1);
+      }
+      _mm256_storeu_pd(y, sum_0);
+      _mm256_storeu_pd(y + 4, sum_1);
+#else
+      sell_multiply_chunk<double>(width, values, columns, vector_in, y);
+#endif
+    }
+
+    // Orders the rows of a sigma-window by decreasing length.
+    class SELLRowLengthComparator
+    {
+    public:
+      SELLRowLengthComparator(int* Ap) : Ap(Ap) {}
+      bool operator()(int a, int b) const { return Ap[a + 1] - Ap[a] > Ap[b + 1] - Ap[b]; }
+    private:
+      int* Ap;
+    };
+
+    template<typename Scalar>
+    SELLMatrix<Scalar>::SELLMatrix(unsigned int sigma) : CSRMatrix<Scalar>(), sigma(sigma), num_chunks(0), Sp(NULL), Sj(NULL), Sx(NULL), S_position(NULL), S_row(NULL), sell_up_to_date(false)
+    {
+      if(sigma == 0 || sigma % chunk_size)
+        throw Hermes::Exceptions::Exception("SELLMatrix: sigma (%u) has to be a positive multiple of the chunk size (%i).", sigma, (int)chunk_size);
+    }
+
+    template<typename Scalar>
+    SELLMatrix<Scalar>::~SELLMatrix()
+    {
+      this->free();
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::free_sell()
+    {
+      num_chunks = 0;
+      sell_up_to_date = false;
+      delete [] Sp;
+      Sp = NULL;
+      delete [] Sj;
+      Sj = NULL;
+      delete [] Sx;
+      Sx = NULL;
+      delete [] S_position;
+      S_position = NULL;
+      delete [] S_row;
+      S_row = NULL;
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::build_sell_structure()
+    {
+      this->free_sell();
+      num_chunks = (this->size + chunk_size - 1) / chunk_size;
+
+      // Rows sorted by length within every window, the padding slots of the last chunk are -1.
+      S_row = new int[num_chunks * chunk_size];
+      for (unsigned int i = 0; i < num_chunks * chunk_size; i++)
+        S_row[i] = i < this->size ? (int)i : -1;
+      for (unsigned int window = 0; window < this->size; window += sigma)
+        std::stable_sort(S_row + window, S_row + std::min(window + sigma, this->size), SELLRowLengthComparator(this->Ap));
+
+      Sp = new int[num_chunks + 1];
+      Sp[0] = 0;
+      for (unsigned int c = 0; c < num_chunks; c++)
+      {
+        int width = 0;
+        for (int r = 0; r < chunk_size; r++)
+        {
+          int row = S_row[c * chunk_size + r];
+          if(row >= 0)
+            width = std::max(width, this->Ap[row + 1] - this->Ap[row]);
+        }
+        Sp[c + 1] = Sp[c] + width * chunk_size;
+      }
+
+      Sj = new int[Sp[num_chunks]];
+      S_position = new int[Sp[num_chunks]];
+      Sx = new Scalar[Sp[num_chunks]];
+      for (unsigned int c = 0; c < num_chunks; c++)
+      {
+        int width = (Sp[c + 1] - Sp[c]) / chunk_size;
+        for (int r = 0; r < chunk_size; r++)
+        {
+          int row = S_row[c * chunk_size + r];
+          int length = row >= 0 ? this->Ap[row + 1] - this->Ap[row] : 0;
+          for (int j = 0; j < width; j++)
+          {
+            int slot = Sp[c] + j * chunk_size + r;
+            Sj[slot] = j < length ? this->Aj[this->Ap[row] + j] : 0;
+            S_position[slot] = j < length ? this->Ap[row] + j : -1;
+          }
+        }
+      }
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::finish()
+    {
+      if(this->Ap == NULL)
+        return;
+      if(Sp == NULL)
+        this->build_sell_structure();
+
+      int num_entries = Sp[num_chunks];
+#pragma omp parallel for schedule(static)
+      for (int k = 0; k < num_entries; k++)
+        Sx[k] = S_position[k] >= 0 ? this->Ax[S_position[k]] : Scalar(0);
+      sell_up_to_date = true;
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::alloc()
+    {
+      this->free_sell();
+      CSRMatrix<Scalar>::alloc();
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::create_structure(unsigned int n, int* Ap, int* Ai)
+    {
+      this->free_sell();
+      CSRMatrix<Scalar>::create_structure(n, Ap, Ai);
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::free()
+    {
+      this->free_sell();
+      CSRMatrix<Scalar>::free();
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::zero()
+    {
+      sell_up_to_date = false;
+      CSRMatrix<Scalar>::zero();
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar v)
+    {
+      sell_up_to_date = false;
+      CSRMatrix<Scalar>::add(m, n, v);
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::add(unsigned int m, unsigned int n, Scalar **mat, int *rows, int *cols)
+    {
+      sell_up_to_date = false;
+      CSRMatrix<Scalar>::add(m, n, mat, rows, cols);
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::multiply_with_Scalar(Scalar value)
+    {
+      sell_up_to_date = false;
+      CSRMatrix<Scalar>::multiply_with_Scalar(value);
+    }
+
+    template<typename Scalar>
+    void SELLMatrix<Scalar>::multiply_with_vector(Scalar* vector_in, Scalar* vector_out)
+    {
+      if(!sell_up_to_date)
+        this->finish();
+
+      int num_chunks = this->num_chunks;
+#pragma omp parallel for schedule(static)
+      for (int c = 0; c < num_chunks; c++)
+      {
+        Scalar y[chunk_size];
+        sell_multiply_chunk((Sp[c + 1] - Sp[c]) / chunk_size, Sx + Sp[c], Sj + Sp[c], vector_in, y);
+        for (int r = 0; r < chunk_size; r++)
+          if(S_row[c * chunk_size + r] >= 0)
+            vector_out[S_row[c * chunk_size + r]] = y[r];
+      }
+    }
+
+    template<typename Scalar>
+    SELLMatrix<Scalar>* SELLMatrix<Scalar>::duplicate()
+    {
+      SELLMatrix<Scalar>* new_matrix = new SELLMatrix<Scalar>(sigma);
+      new_matrix->create(this->size, this->nnz, this->Ap, this->Aj, this->Ax);
+      return new_matrix;
+    }
+
+    template<typename Scalar>
+    double SELLMatrix<Scalar>::get_padding_ratio()
+    {
+      if(Sp == NULL)
+        this->finish();
+      return this->nnz ? Sp[num_chunks] / (double) this->nnz : 1.0;
+    }
+
+    template class HERMES_API SELLMatrix<double>;
+    template class HERMES_API SELLMatrix<std::complex<double> >;
+
+    template<typename Scalar>
+    SimpleVector<Scalar>::SimpleVector() : v(NULL)
+    {
+      this->size = 0;
+    }
+
+    template<typename Scalar>
+    SimpleVector<Scalar>::SimpleVector(unsigned int size) : v(NULL)
+    {
+      this->size = size;
+      this->alloc(size);
+    }
+
+    template<typename Scalar>
+    SimpleVector<Scalar>::~SimpleVector()
+    {
+      free();
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::alloc(unsigned int n)
+    {
+      free();
+      this->size = n;
+      v = new Scalar[n];
+      this->zero();
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::zero()
+    {
+      memset(v, 0, this->size * sizeof(Scalar));
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::change_sign()
+    {
+      VectorKernels::scale(this->size, Scalar(-1.), v);
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::free()
+    {
+      delete [] v;
+      v = NULL;
+      this->size = 0;
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::set(unsigned int idx, Scalar y)
+    {
+      v[idx] = y;
+    }
+
+    template<>
+    void SimpleVector<double>::add(unsigned int idx, double y)
+    {
+      if(this->conflict_free_assembly)
+        v[idx] += y;
+      else
+      {
+#pragma omp atomic
+        v[idx] += y;
+      }
+    }
+
+    template<>
+    void SimpleVector<std::complex<double> >::add(unsigned int idx, std::complex<double> y)
+    {
+      if(this->conflict_free_assembly)
+        v[idx] += y;
+      else
+        VectorKernels::atomic_add(v + idx, y);
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::add(unsigned int n, unsigned int *idx, Scalar *y)
+    {
+      if(this->conflict_free_assembly)
+      {
+        for (unsigned int i = 0; i < n; i++)
+          v[idx[i]] += y[i];
+      }
+      else
+      {
+        for (unsigned int i = 0; i < n; i++)
+          this->add(idx[i], y[i]);
+      }
+    }
+
+    template<typename Scalar>
+    Scalar SimpleVector<Scalar>::get(unsigned int idx)
+    {
+      return v[idx];
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::extract(Scalar *v) const
+    {
+      memcpy(v, this->v, this->size * sizeof(Scalar));
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::add_vector(Vector<Scalar>* vec)
+    {
+      assert(this->length() == vec->length());
+      Scalar* values = new Scalar[this->length()];
+      vec->extract(values);
+      VectorKernels::axpy(this->length(), Scalar(1.), values, this->v);
+      delete [] values;
+    }
+
+    template<typename Scalar>
+    void SimpleVector<Scalar>::add_vector(Scalar* vec)
+    {
+      VectorKernels::axpy(this->length(), Scalar(1.), vec, this->v);
+    }
+
+    template<typename Scalar>
+    Scalar *SimpleVector<Scalar>::get_c_array()
+    {
+      return this->v;
+    }
+
+    template<typename Scalar>
+    bool SimpleVector<Scalar>::dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt, char* number_format)
+    {
+      switch (fmt)
+      {
+      case DF_MATLAB_SPARSE:
+        fprintf(file, "%% Size: %dx1\n%s =[\n", this->size, var_name);
+        for (unsigned int i = 0; i < this->size; i++)
+        {
+          Hermes::Helpers::fprint_num(file, v[i], number_format);
+          fprintf(file, "\n");
+        }
+        fprintf(file, " ];\n");
+        return true;
+
+      case DF_PLAIN_ASCII:
+        fprintf(file, "\n");
+        for (unsigned int i = 0; i < this->size; i++)
+        {
+          Hermes::Helpers::fprint_num(file, v[i], number_format);
+          fprintf(file, "\n");
+        }
+        return true;
+
+      default:
+        return false;
+      }
+    }
+
+    template class HERMES_API SimpleVector<double>;
+    template class HERMES_API SimpleVector<std::complex<double> >;
+  }
+}
+
 template<typename Scalar>
 SparseMatrix<Scalar>* Hermes::Algebra::create_matrix()
 {
-  switch (Hermes::HermesCommonApi.get_integral_param_value(Hermes::matrixSolverType))
+  switch (Hermes::HermesCommonApi.get_matrix_solver_type())
   {
   case Hermes::SOLVER_AMESOS:
     {
@@ -263,6 +1369,11 @@ SparseMatrix<Scalar>* Hermes::Algebra::create_matrix()
 #endif
       break;
     }
+  case Hermes::SOLVER_KRYLOV:
+    {
+      return new SELLMatrix<Scalar>;
+      break;
+    }
   default:
     throw Hermes::Exceptions::Exception("Unknown matrix solver requested in create_matrix().");
   }
@@ -272,7 +1383,7 @@ SparseMatrix<Scalar>* Hermes::Algebra::create_matrix()
 template<typename Scalar>
 Vector<Scalar>* Hermes::Algebra::create_vector()
 {
-  switch (Hermes::HermesCommonApi.get_integral_param_value(Hermes::matrixSolverType))
+  switch (Hermes::HermesCommonApi.get_matrix_solver_type())
   {
   case Hermes::SOLVER_AMESOS:
     {
@@ -328,6 +1439,11 @@ Vector<Scalar>* Hermes::Algebra::create_vector()
 #endif
       break;
     }
+  case Hermes::SOLVER_KRYLOV:
+    {
+      return new SimpleVector<Scalar>;
+      break;
+    }
   default:
     throw Hermes::Exceptions::Exception("Unknown matrix solver requested in create_vector().");
   }
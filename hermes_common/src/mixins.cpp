@@ -16,15 +16,103 @@
 #include <map>
 #include <string>
 #include "common.h"
+#ifndef WIN32
+#include <unistd.h>
+#endif
+
+/// Number of the messages a thread buffers (asynchronous logging), a thread with the full ring writes out by itself.
+#define HERMES_LOG_RING_SIZE 64
+/// Interval of the background thread writing out the buffered messages (ms).
+#define HERMES_LOG_FLUSH_INTERVAL 10
+
+#ifdef _MSC_VER
+#  define HERMES_LOG_BARRIER() MemoryBarrier()
+#  define HERMES_LOG_NEXT_SEQUENCE(sequence) InterlockedIncrement64(&sequence)
+#else
+#  define HERMES_LOG_BARRIER() __sync_synchronize()
+#  define HERMES_LOG_NEXT_SEQUENCE(sequence) __sync_add_and_fetch(&sequence, 1)
+#endif
 
 namespace Hermes
 {
   namespace Mixins
   {
+    /// Single producer (the owning thread) - single consumer (drain_rings() inside logger_monitor) ring,
+    /// the producer does not lock anything.
+    class Loggable::LogRing
+    {
+    public:
+      LogRing() : head(0), tail(0), retired(false)
+      {
+      }
+
+      struct Record
+      {
+        long long sequence;
+        char code;
+        callbackFn callback;
+        char text[BUF_SZ];
+
+        static bool compare(const Record* a, const Record* b)
+        {
+          return a->sequence < b->sequence;
+        }
+      };
+
+      Record records[HERMES_LOG_RING_SIZE];
+      /// Written only by the owning thread, after the record.
+      volatile unsigned int head;
+      /// Written only by the drain, after the records were written out.
+      volatile unsigned int tail;
+      /// The owning thread has exited, the ring is deleted when empty.
+      volatile bool retired;
+
+      /// All the rings, inside logger_monitor.
+      static std::vector<LogRing*> rings;
+      /// The ring of the thread.
+      static pthread_key_t key;
+      static pthread_once_t key_once;
+      /// The order of the messages of all the threads.
+      static volatile long long sequence;
+      static pthread_t flusher;
+
+      static void create_key()
+      {
+        pthread_key_create(&key, retire);
+      }
+
+      /// Called when the owning thread exits.
+      static void retire(void* ring)
+      {
+        HERMES_LOG_BARRIER();
+        ((LogRing*)ring)->retired = true;
+      }
+    };
+
     Loggable::LoggerMonitor Loggable::logger_monitor;
 
     std::map<std::string, bool> Loggable::logger_written;
 
+    int Loggable::log_level = HERMES_LOG_LEVEL_INFO;
+    volatile bool Loggable::asynchronous_logging = false;
+
+    std::vector<Loggable::LogRing*> Loggable::LogRing::rings;
+    pthread_key_t Loggable::LogRing::key;
+    pthread_once_t Loggable::LogRing::key_once = PTHREAD_ONCE_INIT;
+    volatile long long Loggable::LogRing::sequence = 0;
+    pthread_t Loggable::LogRing::flusher;
+
+    /// Stops the background thread and writes out the buffered messages when the program exits.
+    /// Defined after the members above, so that it is destroyed before them.
+    static class LogFlushAtExit
+    {
+    public:
+      ~LogFlushAtExit()
+      {
+        Loggable::set_asynchronous_logging(false);
+      }
+    } log_flush_at_exit;
+
     Loggable::Loggable(bool verbose_output, callbackFn verbose_callback) : verbose_output(verbose_output), verbose_callback(verbose_callback)
     {
     }
@@ -41,6 +129,9 @@ namespace Hermes
 
     void Loggable::Static::info(const char* msg, ...)
     {
+      if(!log_level_enabled(HERMES_LOG_LEVEL_INFO))
+        return;
+
       char text[BUF_SZ];
       char* text_contents = text + 1;
 
@@ -95,6 +186,9 @@ namespace Hermes
 
     void Loggable::Static::warn(const char* msg, ...)
     {
+      if(!log_level_enabled(HERMES_LOG_LEVEL_WARNING))
+        return;
+
       char text[BUF_SZ];
       char* text_contents = text + 1;
 
@@ -149,6 +243,9 @@ namespace Hermes
 
     void Loggable::Static::error(const char* msg, ...)
     {
+      if(!log_level_enabled(HERMES_LOG_LEVEL_ERROR))
+        return;
+
       char text[BUF_SZ];
       char* text_contents = text + 1;
 
@@ -203,7 +300,7 @@ namespace Hermes
 
     void Loggable::error(const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_ERROR))
         return;
 
       char text[BUF_SZ];
@@ -223,7 +320,7 @@ namespace Hermes
 
     void Loggable::error_if(bool cond, const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_ERROR))
         return;
 
       if(cond)
@@ -246,7 +343,7 @@ namespace Hermes
 
     void Loggable::warn(const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_WARNING))
         return;
 
       char text[BUF_SZ];
@@ -266,7 +363,7 @@ namespace Hermes
 
     void Loggable::warn_if(bool cond, const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_WARNING))
         return;
 
       if(cond)
@@ -288,7 +385,7 @@ namespace Hermes
     }
     void Loggable::info(const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_INFO))
         return;
 
       char text[BUF_SZ];
@@ -307,7 +404,7 @@ namespace Hermes
     }
     void Loggable::info_if(bool cond, const char* msg, ...) const
     {
-      if(!this->verbose_output)
+      if(!this->verbose_output || !log_level_enabled(HERMES_LOG_LEVEL_INFO))
         return;
 
       if(cond)
@@ -328,7 +425,7 @@ namespace Hermes
       }
     }
 
-    bool Loggable::write_console(const char code, const char* text) const
+    bool Loggable::write_console(const char code, const char* text)
     {
       //Windows platform
     #ifdef WIN32
@@ -395,7 +492,7 @@ namespace Hermes
     #endif
     }
 
-    Loggable::HermesLogEventInfo* Loggable::hermes_build_log_info(char event) const
+    Loggable::HermesLogEventInfo* Loggable::hermes_build_log_info(char event)
     {
         return new Loggable::HermesLogEventInfo(event, HERMES_LOG_FILE, __CURRENT_FUNCTION, __FILE__, __LINE__);
     }
@@ -421,63 +518,230 @@ namespace Hermes
 
     void Loggable::hermes_log_message(const char code, const char* msg) const
     {
+      if(asynchronous_logging)
+      {
+        LogRing* ring = get_thread_ring();
+        unsigned int head = ring->head;
+        if(head - ring->tail < HERMES_LOG_RING_SIZE)
+        {
+          LogRing::Record& record = ring->records[head % HERMES_LOG_RING_SIZE];
+          record.sequence = HERMES_LOG_NEXT_SEQUENCE(LogRing::sequence);
+          record.code = code;
+          record.callback = this->verbose_callback;
+          strncpy(record.text, msg, BUF_SZ - 1);
+          record.text[BUF_SZ - 1] = '\0';
+
+          // The record has to be complete before the drain sees it.
+          HERMES_LOG_BARRIER();
+          ring->head = head + 1;
+          return;
+        }
+        // The ring is full - written out below together with everything buffered, to keep the order.
+      }
+
       logger_monitor.enter();
 
+      drain_rings();
+
+      FILE* file = open_log_file();
+      write_log_message(code, msg, this->verbose_callback, file);
+      if(file != NULL)
+        fclose(file);
+
+      logger_monitor.leave();
+    }
+
+    void Loggable::write_log_message(const char code, const char* msg, callbackFn callback, FILE* file)
+    {
       //print the message
       if(!write_console(code, msg))
         printf("%s", msg);  //safe fallback
       printf("\n");  //write a new line
 
-      HermesLogEventInfo* info = this->hermes_build_log_info(code);
-
       //print to file
-      if(info->log_file != NULL)
+      if(file != NULL)
       {
-        FILE* file = fopen(info->log_file, "at");
-        if(file != NULL)
+        HermesLogEventInfo* info = hermes_build_log_info(code);
+
+        //build a long version of location
+        std::ostringstream location;
+        location << '(';
+        if(info->src_function != NULL)
         {
-          //check whether log file was already written
-          std::map<std::string, bool>::const_iterator found = logger_written.find(info->log_file);
-          if(found == logger_written.end()) {  //first write, write delimited to a file
-            logger_written[info->log_file] = true;
-            fprintf(file, "\n");
-            for(int i = 0; i < HERMES_LOG_FILE_DELIM_SIZE; i++)
-              fprintf(file, "-");
-            fprintf(file, "\n\n");
-          }
-
-          //build a long version of location
-          std::ostringstream location;
-          location << '(';
-          if(info->src_function != NULL)
-          {
-            location << info->src_function;
-            if(info->src_file != NULL)
-              location << '@';
-          }
+          location << info->src_function;
           if(info->src_file != NULL)
-            location << info->src_file << ':' << info->src_line;
-          location << ')';
-
-          //get time
-          time_t now;
-          time(&now);
-          struct tm* now_tm = gmtime(&now);
-          char time_buf[BUF_SZ];
-          strftime(time_buf, BUF_SZ, "%y%m%d-%H:%M", now_tm);
-
-          //write
-          fprintf(file, "%s\t%s %s\n", time_buf, msg, location.str().c_str());
+            location << '@';
+        }
+        if(info->src_file != NULL)
+          location << info->src_file << ':' << info->src_line;
+        location << ')';
+
+        //get time
+        time_t now;
+        time(&now);
+        struct tm* now_tm = gmtime(&now);
+        char time_buf[BUF_SZ];
+        strftime(time_buf, BUF_SZ, "%y%m%d-%H:%M", now_tm);
+
+        //write
+        fprintf(file, "%s\t%s %s\n", time_buf, msg, location.str().c_str());
+
+        if(callback != NULL)
+          callback(msg);
+
+        delete info;
+      }
+    }
+
+    FILE* Loggable::open_log_file()
+    {
+      const char* log_file = HERMES_LOG_FILE;
+      if(log_file == NULL)
+        return NULL;
+
+      FILE* file = fopen(log_file, "at");
+      if(file != NULL)
+      {
+        //check whether log file was already written
+        std::map<std::string, bool>::const_iterator found = logger_written.find(log_file);
+        if(found == logger_written.end()) {  //first write, write delimited to a file
+          logger_written[log_file] = true;
+          fprintf(file, "\n");
+          for(int i = 0; i < HERMES_LOG_FILE_DELIM_SIZE; i++)
+            fprintf(file, "-");
+          fprintf(file, "\n\n");
+        }
+      }
+      return file;
+    }
+
+    Loggable::LogRing* Loggable::get_thread_ring()
+    {
+      pthread_once(&LogRing::key_once, LogRing::create_key);
+      LogRing* ring = (LogRing*)pthread_getspecific(LogRing::key);
+      if(ring == NULL)
+      {
+        ring = new LogRing();
+        pthread_setspecific(LogRing::key, ring);
+        logger_monitor.enter();
+        LogRing::rings.push_back(ring);
+        logger_monitor.leave();
+      }
+      return ring;
+    }
+
+    void Loggable::drain_rings()
+    {
+      if(LogRing::rings.empty())
+        return;
+
+      // Collect the records of all the rings and write them out in the order they were issued.
+      std::vector<LogRing::Record*> records;
+      std::vector<unsigned int> heads(LogRing::rings.size());
+      for(unsigned int i = 0; i < LogRing::rings.size(); i++)
+      {
+        LogRing* ring = LogRing::rings[i];
+        heads[i] = ring->head;
+        HERMES_LOG_BARRIER();
+        for(unsigned int j = ring->tail; j != heads[i]; j++)
+          records.push_back(&ring->records[j % HERMES_LOG_RING_SIZE]);
+      }
+
+      if(!records.empty())
+      {
+        std::sort(records.begin(), records.end(), LogRing::Record::compare);
+
+        // One open of the log file for the whole batch.
+        FILE* file = open_log_file();
+        for(unsigned int i = 0; i < records.size(); i++)
+          write_log_message(records[i]->code, records[i]->text, records[i]->callback, file);
+        if(file != NULL)
           fclose(file);
+        fflush(stdout);
+      }
+
+      // The records can be reused by the producers only now.
+      HERMES_LOG_BARRIER();
+      for(unsigned int i = 0; i < LogRing::rings.size(); i++)
+        LogRing::rings[i]->tail = heads[i];
 
-          if(this->verbose_callback != NULL)
-            this->verbose_callback(msg);
+      // The rings of the exited threads.
+      for(unsigned int i = 0; i < LogRing::rings.size();)
+      {
+        LogRing* ring = LogRing::rings[i];
+        if(ring->retired && ring->tail == ring->head)
+        {
+          delete ring;
+          LogRing::rings.erase(LogRing::rings.begin() + i);
         }
+        else
+          i++;
       }
+    }
 
-      delete info;
+    void* Loggable::flusher_thread(void* arg)
+    {
+      while(asynchronous_logging)
+      {
+        flush_log();
+
+        //wait
+#ifdef WIN32
+        Sleep(HERMES_LOG_FLUSH_INTERVAL);
+#else
+        usleep(HERMES_LOG_FLUSH_INTERVAL * 1000);
+#endif
+      }
+      return NULL;
+    }
 
+    void Loggable::flush_log()
+    {
+      logger_monitor.enter();
+      drain_rings();
+      logger_monitor.leave();
+    }
+
+    void Loggable::set_asynchronous_logging(bool to_set)
+    {
+      logger_monitor.enter();
+      if(to_set == asynchronous_logging)
+      {
+        logger_monitor.leave();
+        return;
+      }
+      asynchronous_logging = to_set;
+      if(to_set && pthread_create(&LogRing::flusher, NULL, flusher_thread, NULL) != 0)
+      {
+        asynchronous_logging = false;
+        logger_monitor.leave();
+        throw Hermes::Exceptions::Exception("Could not start the logging thread.");
+      }
       logger_monitor.leave();
+
+      if(!to_set)
+      {
+        // The flusher takes logger_monitor, it can only be joined outside of it.
+        pthread_join(LogRing::flusher, NULL);
+        flush_log();
+      }
+    }
+
+    bool Loggable::get_asynchronous_logging()
+    {
+      return asynchronous_logging;
+    }
+
+    void Loggable::set_log_level(int level)
+    {
+      if(level < 0 || level > HERMES_LOG_LEVEL_INFO)
+        throw Hermes::Exceptions::Exception("Wrong log level %d, use HERMES_LOG_LEVEL_ERROR .. HERMES_LOG_LEVEL_INFO (0 - no messages).", level);
+      log_level = level;
+    }
+
+    int Loggable::get_log_level()
+    {
+      return log_level;
     }
 
     void Loggable::set_verbose_output(bool to_set)
@@ -31,7 +31,7 @@ namespace Hermes
   {
     template<typename Scalar>
     AztecOOSolver<Scalar>::AztecOOSolver(EpetraMatrix<Scalar> *m, EpetraVector<Scalar> *rhs)
-      : IterSolver<Scalar>(), m(m), rhs(rhs)
+      : IterSolver<Scalar>(), m(m), rhs(rhs), op(NULL)
     {
       pc = NULL;
     }
@@ -106,6 +106,49 @@ namespace Hermes
       aztec.SetAztecOption(AZ_precond, az_precond);
     }
 
+    template<typename Scalar>
+    void AztecOOSolver<Scalar>::set_operator(DiscreteProblemInterface<Scalar> *op)
+    {
+      this->op = op;
+    }
+
+    template<typename Scalar>
+    AztecOOSolver<Scalar>::MatrixFreeOperator::MatrixFreeOperator(DiscreteProblemInterface<Scalar> *op, const Epetra_BlockMap &map)
+      : op(op), map(map.NumGlobalElements(), 0, map.Comm())
+    {
+      x = new Scalar[op->get_num_dofs()];
+      y = new Scalar[op->get_num_dofs()];
+    }
+
+    template<typename Scalar>
+    AztecOOSolver<Scalar>::MatrixFreeOperator::~MatrixFreeOperator()
+    {
+      delete [] x;
+      delete [] y;
+    }
+
+    template<>
+    int AztecOOSolver<double>::MatrixFreeOperator::Apply(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const
+    {
+      int ndof = op->get_num_dofs();
+      for (int vec_i = 0; vec_i < X.NumVectors(); vec_i++)
+      {
+        for (int i = 0; i < ndof; i++)
+          x[i] = X[vec_i][i];
+        op->apply(x, y);
+        for (int i = 0; i < ndof; i++)
+          Y[vec_i][i] = y[i];
+      }
+      return 0;
+    }
+
+    template<>
+    int AztecOOSolver<std::complex<double> >::MatrixFreeOperator::Apply(const Epetra_MultiVector &X, Epetra_MultiVector &Y) const
+    {
+      // The complex problems are solved as real ones of the double size (Komplex), not supported matrix-free.
+      return -1;
+    }
+
     template<typename Scalar>
     void AztecOOSolver<Scalar>::set_option(int option, int value)
     {
@@ -121,23 +164,33 @@ namespace Hermes
     template<typename Scalar>
     int AztecOOSolver<Scalar>::get_matrix_size()
     {
-      return m->size;
+      return op != NULL ? op->get_num_dofs() : m->size;
     }
 
     template<>
     bool AztecOOSolver<double>::solve()
     {
-      assert(m != NULL);
+      assert(m != NULL || op != NULL);
       assert(rhs != NULL);
-      assert(m->size == rhs->size);
+      assert(op != NULL || m->size == rhs->size);
+      assert(op == NULL || op->get_num_dofs() == rhs->size);
 
       // no output
       aztec.SetAztecOption(AZ_output, AZ_none);  // AZ_all | AZ_warnings | AZ_last | AZ_summary
 
       // setup the problem
-      aztec.SetUserMatrix(m->mat);
+      MatrixFreeOperator* matrix_free_operator = NULL;
+      if(op != NULL)
+      {
+        matrix_free_operator = new MatrixFreeOperator(op, *rhs->std_map);
+        aztec.SetUserOperator(matrix_free_operator);
+      }
+      else
+        aztec.SetUserMatrix(m->mat);
       aztec.SetRHS(rhs->vec);
       Epetra_Vector x(*rhs->std_map);
+      if(this->initial_guess != NULL && this->initial_guess_size == rhs->size)
+        for (unsigned int i = 0; i < rhs->size; i++) x[i] = this->initial_guess[i];
       aztec.SetLHS(&x);
 
       if(pc != NULL)
@@ -154,17 +207,21 @@ namespace Hermes
       this->time = this->accumulated();
 
       delete [] this->sln;
-      this->sln = new double[m->size];
-      memset(this->sln, 0, m->size * sizeof(double));
+      this->sln = new double[rhs->size];
+      memset(this->sln, 0, rhs->size * sizeof(double));
 
       // copy the solution into sln vector
-      for (unsigned int i = 0; i < m->size; i++) this->sln[i] = x[i];
+      for (unsigned int i = 0; i < rhs->size; i++) this->sln[i] = x[i];
+
+      delete matrix_free_operator;
       return true;
     }
 
     template<>
     bool AztecOOSolver<std::complex<double> >::solve()
     {
+      if(op != NULL)
+        throw Hermes::Exceptions::Exception("The matrix-free mode of AztecOOSolver is not supported for complex problems.");
       assert(m != NULL);
       assert(rhs != NULL);
       assert(m->size == rhs->size);
@@ -0,0 +1,349 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file device_krylov.cpp
+\brief DeviceKrylov class, the CG and BiCGStab iterations of KrylovSolver on a CUDA device.
+*/
+#include "config.h"
+#ifdef WITH_CUDA
+#include "device_krylov.h"
+#include "exceptions.h"
+#include <cuda_runtime.h>
+
+namespace Hermes
+{
+  namespace Solvers
+  {
+    static void check_cuda(cudaError_t status, const char* call)
+    {
+      if(status != cudaSuccess)
+        throw Hermes::Exceptions::Exception("DeviceKrylov: %s failed: %s.", call, cudaGetErrorString(status));
+    }
+
+    static void check_cublas(cublasStatus_t status, const char* call)
+    {
+      if(status != CUBLAS_STATUS_SUCCESS)
+        throw Hermes::Exceptions::Exception("DeviceKrylov: %s failed (cuBLAS status %i).", call, (int)status);
+    }
+
+    static void check_cusparse(cusparseStatus_t status, const char* call)
+    {
+      if(status != CUSPARSE_STATUS_SUCCESS)
+        throw Hermes::Exceptions::Exception("DeviceKrylov: %s failed: %s.", call, cusparseGetErrorString(status));
+    }
+
+    // The cuBLAS calls of the two scalar types, dot conjugates the first vector (as VectorKernels::dot).
+    static cudaDataType value_type(double) { return CUDA_R_64F; }
+    static cudaDataType value_type(std::complex<double>) { return CUDA_C_64F; }
+
+    static void device_axpy(cublasHandle_t h, int n, double a, const double* x, double* y)
+    {
+      check_cublas(cublasDaxpy(h, n, &a, x, 1, y, 1), "cublasDaxpy");
+    }
+    static void device_axpy(cublasHandle_t h, int n, std::complex<double> a, const std::complex<double>* x, std::complex<double>* y)
+    {
+      check_cublas(cublasZaxpy(h, n, (const cuDoubleComplex*)&a, (const cuDoubleComplex*)x, 1, (cuDoubleComplex*)y, 1), "cublasZaxpy");
+    }
+
+    static void device_scal(cublasHandle_t h, int n, double a, double* x)
+    {
+      check_cublas(cublasDscal(h, n, &a, x, 1), "cublasDscal");
+    }
+    static void device_scal(cublasHandle_t h, int n, std::complex<double> a, std::complex<double>* x)
+    {
+      check_cublas(cublasZscal(h, n, (const cuDoubleComplex*)&a, (cuDoubleComplex*)x, 1), "cublasZscal");
+    }
+
+    static double device_dot(cublasHandle_t h, int n, const double* x, const double* y)
+    {
+      double result;
+      check_cublas(cublasDdot(h, n, x, 1, y, 1, &result), "cublasDdot");
+      return result;
+    }
+    static std::complex<double> device_dot(cublasHandle_t h, int n, const std::complex<double>* x, const std::complex<double>* y)
+    {
+      std::complex<double> result;
+      check_cublas(cublasZdotc(h, n, (const cuDoubleComplex*)x, 1, (const cuDoubleComplex*)y, 1, (cuDoubleComplex*)&result), "cublasZdotc");
+      return result;
+    }
+
+    static double device_nrm2(cublasHandle_t h, int n, const double* x)
+    {
+      double result;
+      check_cublas(cublasDnrm2(h, n, x, 1, &result), "cublasDnrm2");
+      return result;
+    }
+    static double device_nrm2(cublasHandle_t h, int n, const std::complex<double>* x)
+    {
+      double result;
+      check_cublas(cublasDznrm2(h, n, (const cuDoubleComplex*)x, 1, &result), "cublasDznrm2");
+      return result;
+    }
+
+    // z = diag(d) r, the vectors as n x 1 matrices.
+    static void device_diag_multiply(cublasHandle_t h, int n, const double* d, const double* r, double* z)
+    {
+      check_cublas(cublasDdgmm(h, CUBLAS_SIDE_LEFT, n, 1, r, n, d, 1, z, n), "cublasDdgmm");
+    }
+    static void device_diag_multiply(cublasHandle_t h, int n, const std::complex<double>* d, const std::complex<double>* r, std::complex<double>* z)
+    {
+      check_cublas(cublasZdgmm(h, CUBLAS_SIDE_LEFT, n, 1, (const cuDoubleComplex*)r, n, (const cuDoubleComplex*)d, 1, (cuDoubleComplex*)z, n), "cublasZdgmm");
+    }
+
+    template<typename Scalar>
+    DeviceKrylov<Scalar>::DeviceKrylov() : matrix(NULL), vec_x(NULL), vec_y(NULL), size(0), nnz(0), size_allocated(0), nnz_allocated(0),
+      ap(NULL), aj(NULL), ax(NULL), inv_diag(NULL), jacobi(false), vectors(NULL), spmv_buffer(NULL), spmv_buffer_size(0)
+    {
+      check_cublas(cublasCreate(&this->cublas), "cublasCreate");
+      check_cusparse(cusparseCreate(&this->cusparse), "cusparseCreate");
+      // The scalars (alpha, the dot products) are on the host.
+      check_cublas(cublasSetPointerMode(this->cublas, CUBLAS_POINTER_MODE_HOST), "cublasSetPointerMode");
+    }
+
+    template<typename Scalar>
+    DeviceKrylov<Scalar>::~DeviceKrylov()
+    {
+      this->free_matrix();
+      this->free_vectors();
+      cusparseDestroy(this->cusparse);
+      cublasDestroy(this->cublas);
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::free_matrix()
+    {
+      if(this->matrix != NULL)
+        cusparseDestroySpMat(this->matrix);
+      this->matrix = NULL;
+      cudaFree(this->ap);
+      cudaFree(this->aj);
+      cudaFree(this->ax);
+      cudaFree(this->spmv_buffer);
+      this->ap = this->aj = NULL;
+      this->ax = NULL;
+      this->spmv_buffer = NULL;
+      this->spmv_buffer_size = 0;
+      this->nnz_allocated = 0;
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::free_vectors()
+    {
+      if(this->vec_x != NULL)
+        cusparseDestroyDnVec(this->vec_x);
+      if(this->vec_y != NULL)
+        cusparseDestroyDnVec(this->vec_y);
+      this->vec_x = this->vec_y = NULL;
+      cudaFree(this->vectors);
+      cudaFree(this->inv_diag);
+      this->vectors = NULL;
+      this->inv_diag = NULL;
+      this->size_allocated = 0;
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::set_matrix(int size, int nnz, const int* ap, const int* aj, const Scalar* ax)
+    {
+      if(size > this->size_allocated || nnz > this->nnz_allocated)
+      {
+        // The row pointers have size + 1 entries, so they are reallocated with the vectors as well.
+        this->free_matrix();
+        this->free_vectors();
+        check_cuda(cudaMalloc((void**)&this->ap, (size + 1) * sizeof(int)), "cudaMalloc");
+        check_cuda(cudaMalloc((void**)&this->aj, nnz * sizeof(int)), "cudaMalloc");
+        check_cuda(cudaMalloc((void**)&this->ax, nnz * sizeof(Scalar)), "cudaMalloc");
+        check_cuda(cudaMalloc((void**)&this->vectors, 9 * size * sizeof(Scalar)), "cudaMalloc");
+        check_cuda(cudaMalloc((void**)&this->inv_diag, size * sizeof(Scalar)), "cudaMalloc");
+        this->size_allocated = size;
+        this->nnz_allocated = nnz;
+      }
+      this->size = size;
+      this->nnz = nnz;
+
+      check_cuda(cudaMemcpy(this->ap, ap, (size + 1) * sizeof(int), cudaMemcpyHostToDevice), "cudaMemcpy");
+      check_cuda(cudaMemcpy(this->aj, aj, nnz * sizeof(int), cudaMemcpyHostToDevice), "cudaMemcpy");
+      check_cuda(cudaMemcpy(this->ax, ax, nnz * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+
+      // The descriptors follow the current size, the dense vectors get their arrays in multiply().
+      if(this->matrix != NULL)
+        cusparseDestroySpMat(this->matrix);
+      if(this->vec_x != NULL)
+        cusparseDestroyDnVec(this->vec_x);
+      if(this->vec_y != NULL)
+        cusparseDestroyDnVec(this->vec_y);
+      cudaDataType type = value_type(Scalar());
+      check_cusparse(cusparseCreateCsr(&this->matrix, size, size, nnz, this->ap, this->aj, this->ax,
+        CUSPARSE_INDEX_32I, CUSPARSE_INDEX_32I, CUSPARSE_INDEX_BASE_ZERO, type), "cusparseCreateCsr");
+      check_cusparse(cusparseCreateDnVec(&this->vec_x, size, this->vectors, type), "cusparseCreateDnVec");
+      check_cusparse(cusparseCreateDnVec(&this->vec_y, size, this->vectors + size, type), "cusparseCreateDnVec");
+
+      Scalar alpha = 1.0, beta = 0.0;
+      size_t buffer_size = 0;
+      check_cusparse(cusparseSpMV_bufferSize(this->cusparse, CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha, this->matrix, this->vec_x, &beta, this->vec_y,
+        type, CUSPARSE_SPMV_ALG_DEFAULT, &buffer_size), "cusparseSpMV_bufferSize");
+      if(buffer_size > this->spmv_buffer_size)
+      {
+        cudaFree(this->spmv_buffer);
+        check_cuda(cudaMalloc(&this->spmv_buffer, buffer_size), "cudaMalloc");
+        this->spmv_buffer_size = buffer_size;
+      }
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::set_jacobi(const Scalar* inv_diag)
+    {
+      this->jacobi = (inv_diag != NULL);
+      if(this->jacobi)
+        check_cuda(cudaMemcpy(this->inv_diag, inv_diag, this->size * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::multiply(Scalar alpha, Scalar *x, Scalar beta, Scalar *y)
+    {
+      check_cusparse(cusparseDnVecSetValues(this->vec_x, x), "cusparseDnVecSetValues");
+      check_cusparse(cusparseDnVecSetValues(this->vec_y, y), "cusparseDnVecSetValues");
+      check_cusparse(cusparseSpMV(this->cusparse, CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha, this->matrix, this->vec_x, &beta, this->vec_y,
+        value_type(Scalar()), CUSPARSE_SPMV_ALG_DEFAULT, this->spmv_buffer), "cusparseSpMV");
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::apply_preconditioner(Scalar *r, Scalar *z)
+    {
+      if(this->jacobi)
+        device_diag_multiply(this->cublas, this->size, this->inv_diag, r, z);
+      else
+        check_cuda(cudaMemcpy(z, r, this->size * sizeof(Scalar), cudaMemcpyDeviceToDevice), "cudaMemcpy");
+    }
+
+    template<typename Scalar>
+    void DeviceKrylov<Scalar>::initial_residual(Scalar *b, Scalar *x, Scalar *r, bool nonzero_initial_guess)
+    {
+      check_cuda(cudaMemcpy(r, b, this->size * sizeof(Scalar), cudaMemcpyDeviceToDevice), "cudaMemcpy");
+      if(nonzero_initial_guess)
+        this->multiply(-1.0, x, 1.0, r);
+    }
+
+    template<typename Scalar>
+    int DeviceKrylov<Scalar>::solve_cg(const Scalar* b_host, double b_norm, Scalar* x_host, bool nonzero_initial_guess, double tolerance, int max_iters, double& residual)
+    {
+      int n = this->size;
+      Scalar *b = this->vectors, *x = b + n, *r = x + n, *z = r + n, *p = z + n, *q = p + n;
+      check_cuda(cudaMemcpy(b, b_host, n * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+      check_cuda(cudaMemcpy(x, x_host, n * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+
+      this->initial_residual(b, x, r, nonzero_initial_guess);
+      this->apply_preconditioner(r, z);
+      check_cuda(cudaMemcpy(p, z, n * sizeof(Scalar), cudaMemcpyDeviceToDevice), "cudaMemcpy");
+      Scalar rz = device_dot(this->cublas, n, r, z);
+      residual = 1.0;
+
+      int num_iters = 0;
+      while (num_iters < max_iters)
+      {
+        this->multiply(1.0, p, 0.0, q);
+        Scalar pq = device_dot(this->cublas, n, p, q);
+        if(pq == Scalar(0))
+          break;
+        Scalar alpha = rz / pq;
+        device_axpy(this->cublas, n, alpha, p, x);
+        device_axpy(this->cublas, n, -alpha, q, r);
+        num_iters++;
+
+        residual = device_nrm2(this->cublas, n, r) / b_norm;
+        if(residual <= tolerance)
+          break;
+
+        this->apply_preconditioner(r, z);
+        Scalar rz_new = device_dot(this->cublas, n, r, z);
+        Scalar beta = rz_new / rz;
+        rz = rz_new;
+        // p = z + beta p
+        device_scal(this->cublas, n, beta, p);
+        device_axpy(this->cublas, n, Scalar(1.0), z, p);
+      }
+
+      check_cuda(cudaMemcpy(x_host, x, n * sizeof(Scalar), cudaMemcpyDeviceToHost), "cudaMemcpy");
+      return num_iters;
+    }
+
+    template<typename Scalar>
+    int DeviceKrylov<Scalar>::solve_bicgstab(const Scalar* b_host, double b_norm, Scalar* x_host, bool nonzero_initial_guess, double tolerance, int max_iters, double& residual)
+    {
+      int n = this->size;
+      Scalar *b = this->vectors, *x = b + n, *r = x + n, *r0 = r + n, *p = r0 + n, *v = p + n, *p_hat = v + n, *s_hat = p_hat + n, *t = s_hat + n;
+      check_cuda(cudaMemcpy(b, b_host, n * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+      check_cuda(cudaMemcpy(x, x_host, n * sizeof(Scalar), cudaMemcpyHostToDevice), "cudaMemcpy");
+
+      this->initial_residual(b, x, r, nonzero_initial_guess);
+      check_cuda(cudaMemcpy(r0, r, n * sizeof(Scalar), cudaMemcpyDeviceToDevice), "cudaMemcpy");
+      check_cuda(cudaMemset(p, 0, n * sizeof(Scalar)), "cudaMemset");
+      check_cuda(cudaMemset(v, 0, n * sizeof(Scalar)), "cudaMemset");
+      Scalar rho = 1, alpha = 1, omega = 1;
+      residual = 1.0;
+
+      int num_iters = 0;
+      while (num_iters < max_iters)
+      {
+        Scalar rho_new = device_dot(this->cublas, n, r0, r);
+        if(rho_new == Scalar(0))
+          break;
+        Scalar beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+        // p = r + beta (p - omega v)
+        device_axpy(this->cublas, n, -omega, v, p);
+        device_scal(this->cublas, n, beta, p);
+        device_axpy(this->cublas, n, Scalar(1.0), r, p);
+
+        this->apply_preconditioner(p, p_hat);
+        this->multiply(1.0, p_hat, 0.0, v);
+        Scalar r0v = device_dot(this->cublas, n, r0, v);
+        if(r0v == Scalar(0))
+          break;
+        alpha = rho / r0v;
+        // s = r - alpha v is kept in r.
+        device_axpy(this->cublas, n, -alpha, v, r);
+        device_axpy(this->cublas, n, alpha, p_hat, x);
+        num_iters++;
+
+        residual = device_nrm2(this->cublas, n, r) / b_norm;
+        if(residual <= tolerance)
+          break;
+
+        this->apply_preconditioner(r, s_hat);
+        this->multiply(1.0, s_hat, 0.0, t);
+        double tt = device_nrm2(this->cublas, n, t);
+        if(tt == 0.0)
+          break;
+        omega = device_dot(this->cublas, n, t, r) / (tt * tt);
+        device_axpy(this->cublas, n, omega, s_hat, x);
+        device_axpy(this->cublas, n, -omega, t, r);
+
+        residual = device_nrm2(this->cublas, n, r) / b_norm;
+        if(residual <= tolerance || omega == Scalar(0))
+          break;
+      }
+
+      check_cuda(cudaMemcpy(x_host, x, n * sizeof(Scalar), cudaMemcpyDeviceToHost), "cudaMemcpy");
+      return num_iters;
+    }
+
+    template class HERMES_API DeviceKrylov<double>;
+    template class HERMES_API DeviceKrylov<std::complex<double> >;
+  }
+}
+#endif
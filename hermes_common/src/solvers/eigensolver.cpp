@@ -0,0 +1,484 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file eigensolver.cpp
+\brief EigenSolver class, the shift-invert Lanczos method for the generalized eigenproblems.
+*/
+#include "config.h"
+#ifdef WITH_UMFPACK
+#include "eigensolver.h"
+#include "vector_kernels.h"
+#include <algorithm>
+#include <limits>
+
+namespace Hermes
+{
+  namespace Solvers
+  {
+    using Hermes::Algebra::VectorKernels::dot;
+    using Hermes::Algebra::VectorKernels::axpy;
+    using Hermes::Algebra::VectorKernels::scale;
+
+    /// Eigenvalues and eigenvectors of the symmetric matrix T (m x m, row-wise) by the cyclic Jacobi method.
+    /// T is overwritten, the eigenvalues are in theta, the eigenvectors in the columns of S.
+    static void symmetric_eigenproblem(int m, double* T, double* theta, double* S)
+    {
+      for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++)
+          S[i * m + j] = (i == j) ? 1.0 : 0.0;
+
+      for (int sweep = 0; sweep < 100; sweep++)
+      {
+        double off = 0.0, diag = 0.0;
+        for (int i = 0; i < m; i++)
+        {
+          diag += T[i * m + i] * T[i * m + i];
+          for (int j = i + 1; j < m; j++)
+            off += T[i * m + j] * T[i * m + j];
+        }
+        if(off <= 1e-30 * diag)
+          break;
+
+        for (int p = 0; p < m; p++)
+        {
+          for (int q = p + 1; q < m; q++)
+          {
+            double tpq = T[p * m + q];
+            if(tpq == 0.0)
+              continue;
+            // The rotation zeroing T[p][q].
+            double tau = (T[q * m + q] - T[p * m + p]) / (2.0 * tpq);
+            double t = (tau >= 0.0 ? 1.0 : -1.0) / (std::abs(tau) + std::sqrt(1.0 + tau * tau));
+            double c = 1.0 / std::sqrt(1.0 + t * t), s = t * c;
+            for (int k = 0; k < m; k++)
+            {
+              double tkp = T[k * m + p], tkq = T[k * m + q];
+              T[k * m + p] = c * tkp - s * tkq;
+              T[k * m + q] = s * tkp + c * tkq;
+            }
+            for (int k = 0; k < m; k++)
+            {
+              double tpk = T[p * m + k], tqk = T[q * m + k];
+              T[p * m + k] = c * tpk - s * tqk;
+              T[q * m + k] = s * tpk + c * tqk;
+            }
+            for (int k = 0; k < m; k++)
+            {
+              double skp = S[k * m + p], skq = S[k * m + q];
+              S[k * m + p] = c * skp - s * skq;
+              S[k * m + q] = s * skp + c * skq;
+            }
+          }
+        }
+      }
+
+      for (int i = 0; i < m; i++)
+        theta[i] = T[i * m + i];
+    }
+
+    /// Orders the Ritz values by the magnitude (the eigenvalues nearest to the shift first).
+    class RitzValueOrder
+    {
+    public:
+      RitzValueOrder(const double* theta) : theta(theta) {}
+      bool operator()(int a, int b) const { return std::abs(theta[a]) > std::abs(theta[b]); }
+    private:
+      const double* theta;
+    };
+
+    /// Orders the eigenvalues.
+    class EigenvalueOrder
+    {
+    public:
+      EigenvalueOrder(const double* lambda) : lambda(lambda) {}
+      bool operator()(int a, int b) const { return lambda[a] < lambda[b]; }
+    private:
+      const double* lambda;
+    };
+
+    template<typename Scalar>
+    EigenSolver<Scalar>::EigenSolver(CSCMatrix<Scalar>* A, CSCMatrix<Scalar>* B) : Hermes::Mixins::Loggable(true),
+      A(A), B(B), size(0), num_lanczos_vectors(0), num_allocated_vectors(0), shifted_matrix(NULL), shifted_rhs(NULL), shifted_solver(NULL),
+      V(NULL), BV(NULL), n_eigs(0), eigenvalues(NULL), eigenvectors(NULL), num_restarts(0), num_solves(0), random_state(0)
+    {
+      if(A == NULL || B == NULL)
+        throw Hermes::Exceptions::NullException(A == NULL ? 1 : 2);
+    }
+
+    template<typename Scalar>
+    EigenSolver<Scalar>::~EigenSolver()
+    {
+      this->free_shifted_solver();
+      delete [] this->eigenvalues;
+      delete [] this->eigenvectors;
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::set_num_lanczos_vectors(int num_lanczos_vectors)
+    {
+      if(num_lanczos_vectors < 0)
+        throw Hermes::Exceptions::ValueException("num_lanczos_vectors", num_lanczos_vectors, 0);
+      this->num_lanczos_vectors = num_lanczos_vectors;
+    }
+
+    template<typename Scalar>
+    int EigenSolver<Scalar>::get_n_eigs() const
+    {
+      return this->n_eigs;
+    }
+
+    template<typename Scalar>
+    double EigenSolver<Scalar>::get_eigenvalue(int i) const
+    {
+      if(i < 0 || i >= this->n_eigs)
+        throw Hermes::Exceptions::ValueException("i", i, 0, this->n_eigs - 1);
+      return this->eigenvalues[i];
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::get_eigenvector(int i, double **vec, int *n)
+    {
+      if(i < 0 || i >= this->n_eigs)
+        throw Hermes::Exceptions::ValueException("i", i, 0, this->n_eigs - 1);
+      *vec = this->eigenvectors + (size_t) i * this->size;
+      *n = this->size;
+    }
+
+    template<typename Scalar>
+    int EigenSolver<Scalar>::get_num_restarts() const
+    {
+      return this->num_restarts;
+    }
+
+    template<typename Scalar>
+    int EigenSolver<Scalar>::get_num_solves() const
+    {
+      return this->num_solves;
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::print_eigenvalues()
+    {
+      printf("Eigenvalues:\n");
+      for (int i = 0; i < this->get_n_eigs(); i++)
+        printf("%3d: %f\n", i, this->get_eigenvalue(i));
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::init_shifted_solver(double sigma)
+    {
+      this->shifted_matrix = create_matrix<Scalar>();
+      this->shifted_rhs = create_vector<Scalar>();
+
+      int *Ap = A->get_Ap(), *Ai = A->get_Ai(), *Bp = B->get_Ap(), *Bi = B->get_Ai();
+      Scalar *Ax = A->get_Ax(), *Bx = B->get_Ax();
+
+      this->shifted_matrix->prealloc(this->size);
+      for (int j = 0; j < this->size; j++)
+      {
+        for (int k = Ap[j]; k < Ap[j + 1]; k++)
+          this->shifted_matrix->pre_add_ij(Ai[k], j);
+        for (int k = Bp[j]; k < Bp[j + 1]; k++)
+          this->shifted_matrix->pre_add_ij(Bi[k], j);
+      }
+      this->shifted_matrix->alloc();
+      for (int j = 0; j < this->size; j++)
+      {
+        for (int k = Ap[j]; k < Ap[j + 1]; k++)
+          this->shifted_matrix->add(Ai[k], j, Ax[k]);
+        if(sigma != 0.0)
+          for (int k = Bp[j]; k < Bp[j + 1]; k++)
+            this->shifted_matrix->add(Bi[k], j, -sigma * Bx[k]);
+      }
+      this->shifted_matrix->finish();
+
+      this->shifted_rhs->alloc(this->size);
+      this->shifted_solver = create_linear_solver<Scalar>(this->shifted_matrix, this->shifted_rhs);
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::free_shifted_solver()
+    {
+      delete this->shifted_solver;
+      this->shifted_solver = NULL;
+      delete this->shifted_matrix;
+      this->shifted_matrix = NULL;
+      delete this->shifted_rhs;
+      this->shifted_rhs = NULL;
+
+      if(this->V != NULL)
+      {
+        for (int i = 0; i < this->num_allocated_vectors; i++)
+        {
+          delete [] this->V[i];
+          delete [] this->BV[i];
+        }
+        delete [] this->V;
+        delete [] this->BV;
+        this->V = this->BV = NULL;
+        this->num_allocated_vectors = 0;
+      }
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::apply_operator(double* Bx, double* y)
+    {
+      this->shifted_rhs->zero();
+      this->shifted_rhs->add_vector(Bx);
+      this->shifted_rhs->finish();
+      if(!this->shifted_solver->solve())
+        throw Hermes::Exceptions::LinearMatrixSolverException("EigenSolver: the solve with the shifted matrix failed.");
+      // The factorization (or the preconditioner) of the first solve is kept.
+      if(this->num_solves++ == 0)
+        this->shifted_solver->set_factorization_scheme(HERMES_REUSE_FACTORIZATION_COMPLETELY);
+      memcpy(y, this->shifted_solver->get_sln_vector(), this->size * sizeof(double));
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::orthogonalize(double* w, int count, double* coeffs)
+    {
+      if(coeffs != NULL)
+        memset(coeffs, 0, count * sizeof(double));
+      // Classical Gram-Schmidt done twice is as stable as the modified one, and its dot products are independent.
+      double* h = new double[count];
+      for (int pass = 0; pass < 2; pass++)
+      {
+        for (int i = 0; i < count; i++)
+          h[i] = dot(this->size, this->BV[i], w);
+        for (int i = 0; i < count; i++)
+        {
+          axpy(this->size, -h[i], this->V[i], w);
+          if(coeffs != NULL)
+            coeffs[i] += h[i];
+        }
+      }
+      delete [] h;
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::random_vector(double* v)
+    {
+      for (int i = 0; i < this->size; i++)
+      {
+        this->random_state = this->random_state * 1664525u + 1013904223u;
+        v[i] = (this->random_state >> 8) / 16777216.0 - 0.5;
+      }
+    }
+
+    template<typename Scalar>
+    void EigenSolver<Scalar>::solve(int n_eigs, double target_value, double tol, int max_iter)
+    {
+      if(A->get_size() != B->get_size())
+        throw Hermes::Exceptions::Exception("EigenSolver: the matrices have different sizes (%i and %i).", A->get_size(), B->get_size());
+      this->size = A->get_size();
+      if(n_eigs < 1 || n_eigs > this->size)
+        throw Hermes::Exceptions::ValueException("n_eigs", n_eigs, 1, this->size);
+      if(tol <= 0.0)
+        throw Hermes::Exceptions::ValueException("tol", tol, 0.0);
+
+      int n = this->size;
+      int m = this->num_lanczos_vectors > 0 ? this->num_lanczos_vectors : std::max(2 * n_eigs + 1, n_eigs + 20);
+      m = std::min(std::max(m, n_eigs + 1), n);
+
+      this->free_shifted_solver();
+      delete [] this->eigenvalues;
+      delete [] this->eigenvectors;
+      this->eigenvalues = NULL;
+      this->eigenvectors = NULL;
+      this->n_eigs = 0;
+      this->num_restarts = 0;
+      this->num_solves = 0;
+      this->random_state = 12345u;
+
+      this->init_shifted_solver(target_value);
+      this->V = new double*[m + 1];
+      this->BV = new double*[m + 1];
+      for (int i = 0; i <= m; i++)
+      {
+        this->V[i] = new double[n];
+        this->BV[i] = new double[n];
+      }
+      this->num_allocated_vectors = m + 1;
+
+      // The projection of the operator (row-wise, symmetric), its eigenpairs and their order.
+      double* T = new double[m * m];
+      double* T_work = new double[m * m];
+      double* S = new double[m * m];
+      double* theta = new double[m];
+      int* order = new int[m];
+      double* coeffs = new double[m + 1];
+      double* w = new double[n];
+      double* Bw = new double[n];
+      memset(T, 0, m * m * sizeof(double));
+
+      // The B-normalized start vector.
+      this->random_vector(this->V[0]);
+      B->multiply_with_vector(this->V[0], this->BV[0]);
+      double nrm = std::sqrt(dot(n, this->V[0], this->BV[0]));
+      if(!(nrm > 0.0))
+        throw Hermes::Exceptions::Exception("EigenSolver: the matrix B is not positive definite.");
+      scale(n, 1.0 / nrm, this->V[0]);
+      scale(n, 1.0 / nrm, this->BV[0]);
+
+      // The number of the kept Ritz vectors (after a restart), beta of the last Lanczos step.
+      int kept = 0;
+      double beta = 0.0;
+      int converged = 0;
+      while(true)
+      {
+        // Lanczos steps from the kept vectors to m vectors.
+        for (int j = kept; j < m; j++)
+        {
+          this->apply_operator(this->BV[j], w);
+          this->orthogonalize(w, j + 1, coeffs);
+          T[j * m + j] = coeffs[j];
+
+          B->multiply_with_vector(w, Bw);
+          beta = std::sqrt(std::max(dot(n, w, Bw), 0.0));
+          // An invariant subspace - the next vector is a random one orthogonal to the previous ones.
+          if(beta <= 1e-12 * std::abs(T[j * m + j]) || beta == 0.0)
+          {
+            beta = 0.0;
+            if(j + 1 == m)
+            {
+              memset(this->V[m], 0, n * sizeof(double));
+              memset(this->BV[m], 0, n * sizeof(double));
+              break;
+            }
+            this->random_vector(w);
+            this->orthogonalize(w, j + 1, NULL);
+            B->multiply_with_vector(w, Bw);
+            double w_nrm = std::sqrt(std::max(dot(n, w, Bw), 0.0));
+            if(!(w_nrm > 0.0))
+              throw Hermes::Exceptions::Exception("EigenSolver: the Lanczos process broke down.");
+            scale(n, 1.0 / w_nrm, w);
+            scale(n, 1.0 / w_nrm, Bw);
+          }
+          else
+          {
+            scale(n, 1.0 / beta, w);
+            scale(n, 1.0 / beta, Bw);
+          }
+          memcpy(this->V[j + 1], w, n * sizeof(double));
+          memcpy(this->BV[j + 1], Bw, n * sizeof(double));
+          if(j + 1 < m)
+            T[j * m + j + 1] = T[(j + 1) * m + j] = beta;
+        }
+
+        // Ritz pairs, the wanted ones are the largest in magnitude.
+        memcpy(T_work, T, m * m * sizeof(double));
+        symmetric_eigenproblem(m, T_work, theta, S);
+        for (int i = 0; i < m; i++)
+          order[i] = i;
+        std::sort(order, order + m, RitzValueOrder(theta));
+
+        converged = 0;
+        for (int i = 0; i < n_eigs; i++)
+        {
+          int k = order[i];
+          if(std::abs(beta * S[(m - 1) * m + k]) <= tol * std::abs(theta[k]))
+            converged++;
+        }
+        this->info("EigenSolver: restart %i, %i of %i eigenpairs converged.", this->num_restarts, converged, n_eigs);
+        if(converged == n_eigs || this->num_restarts >= max_iter)
+          break;
+
+        // Thick restart - the best Ritz vectors and the last Lanczos vector are kept.
+        int keep = std::min(m - 1, n_eigs + (m - n_eigs) / 2);
+        double** new_V = new double*[keep];
+        double** new_BV = new double*[keep];
+        for (int i = 0; i < keep; i++)
+        {
+          new_V[i] = new double[n];
+          new_BV[i] = new double[n];
+          memset(new_V[i], 0, n * sizeof(double));
+          memset(new_BV[i], 0, n * sizeof(double));
+          for (int l = 0; l < m; l++)
+          {
+            double s = S[l * m + order[i]];
+            axpy(n, s, this->V[l], new_V[i]);
+            axpy(n, s, this->BV[l], new_BV[i]);
+          }
+        }
+        for (int i = 0; i < keep; i++)
+        {
+          memcpy(this->V[i], new_V[i], n * sizeof(double));
+          memcpy(this->BV[i], new_BV[i], n * sizeof(double));
+          delete [] new_V[i];
+          delete [] new_BV[i];
+        }
+        delete [] new_V;
+        delete [] new_BV;
+        memcpy(this->V[keep], this->V[m], n * sizeof(double));
+        memcpy(this->BV[keep], this->BV[m], n * sizeof(double));
+
+        // The projection is diagonal in the kept Ritz vectors, coupled to the last Lanczos vector by beta s_m.
+        memset(T, 0, m * m * sizeof(double));
+        for (int i = 0; i < keep; i++)
+        {
+          T[i * m + i] = theta[order[i]];
+          T[i * m + keep] = T[keep * m + i] = beta * S[(m - 1) * m + order[i]];
+        }
+        kept = keep;
+        this->num_restarts++;
+      }
+
+      if(converged < n_eigs)
+        this->warn("EigenSolver: only %i of %i eigenpairs converged in %i restarts.", converged, n_eigs, max_iter);
+
+      // Eigenpairs of the original problem, lambda = sigma + 1 / theta, sorted by lambda.
+      this->n_eigs = n_eigs;
+      double* lambda = new double[n_eigs];
+      int* lambda_order = new int[n_eigs];
+      for (int i = 0; i < n_eigs; i++)
+      {
+        double t = theta[order[i]];
+        lambda[i] = (t == 0.0) ? std::numeric_limits<double>::infinity() : target_value + 1.0 / t;
+        lambda_order[i] = i;
+      }
+      std::sort(lambda_order, lambda_order + n_eigs, EigenvalueOrder(lambda));
+
+      this->eigenvalues = new double[n_eigs];
+      this->eigenvectors = new double[(size_t) n_eigs * n];
+      memset(this->eigenvectors, 0, (size_t) n_eigs * n * sizeof(double));
+      for (int i = 0; i < n_eigs; i++)
+      {
+        int k = order[lambda_order[i]];
+        this->eigenvalues[i] = lambda[lambda_order[i]];
+        double* x = this->eigenvectors + (size_t) i * n;
+        for (int l = 0; l < m; l++)
+          axpy(n, S[l * m + k], this->V[l], x);
+      }
+
+      delete [] lambda;
+      delete [] lambda_order;
+      delete [] T;
+      delete [] T_work;
+      delete [] S;
+      delete [] theta;
+      delete [] order;
+      delete [] coeffs;
+      delete [] w;
+      delete [] Bw;
+      this->free_shifted_solver();
+    }
+
+    template class HERMES_API EigenSolver<double>;
+  }
+}
+#endif
@@ -293,6 +293,77 @@ namespace Hermes
       return mat->NumGlobalNonzeros();
     }
 
+    template<typename Scalar>
+    unsigned long EpetraMatrix<Scalar>::get_structure_hash() const
+    {
+      unsigned long hash = 2166136261UL;
+      const unsigned long prime = 16777619UL;
+      const Epetra_CrsGraph& graph = mat->Graph();
+      int num_rows = graph.NumMyRows();
+      hash = (hash ^ (unsigned int)num_rows) * prime;
+      for (int row = 0; row < num_rows; row++)
+      {
+        int num_indices;
+        int* indices;
+        graph.ExtractMyRowView(row, num_indices, indices);
+        hash = (hash ^ (unsigned int)num_indices) * prime;
+        for (int i = 0; i < num_indices; i++)
+          hash = (hash ^ (unsigned int)indices[i]) * prime;
+      }
+      return hash;
+    }
+
+    template<>
+    void EpetraMatrix<double>::create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, double* ax)
+    {
+      free();
+      this->owner = true;
+      this->size = size;
+      std_map = new Epetra_Map(size, 0, seq_comm);
+
+      std::vector<int> row_nnz(size + 1);
+      for (unsigned int row = 0; row < size; row++)
+        row_nnz[row] = ap[row + 1] - ap[row];
+
+      // In the View mode the matrix keeps the pointers to the rows of ax / aj, the column map is the row map,
+      // so the (local) indices are the ones of aj.
+      mat = new Epetra_CrsMatrix(View, *(Epetra_Map*)std_map, *(Epetra_Map*)std_map, &row_nnz[0], true);
+      for (unsigned int row = 0; row < size; row++)
+        if(mat->InsertMyValues(row, row_nnz[row], ax + ap[row], aj + ap[row]) != 0)
+          throw Hermes::Exceptions::Exception("Failed to create the view of row %d in the Epetra matrix.", row);
+      mat->FillComplete();
+    }
+
+    template<>
+    void EpetraMatrix<std::complex<double> >::create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, std::complex<double>* ax)
+    {
+      free();
+      this->owner = true;
+      this->size = size;
+      std_map = new Epetra_Map(size, 0, seq_comm);
+
+      std::vector<int> row_nnz(size + 1);
+      for (unsigned int row = 0; row < size; row++)
+        row_nnz[row] = ap[row + 1] - ap[row];
+
+      // The real and imaginary parts are stored separately, so they are copied.
+      mat = new Epetra_CrsMatrix(Copy, *(Epetra_Map*)std_map, *(Epetra_Map*)std_map, &row_nnz[0], true);
+      mat_im = new Epetra_CrsMatrix(Copy, *(Epetra_Map*)std_map, *(Epetra_Map*)std_map, &row_nnz[0], true);
+      std::vector<double> re(nnz + 1), im(nnz + 1);
+      for (unsigned int k = 0; k < nnz; k++)
+      {
+        re[k] = ax[k].real();
+        im[k] = ax[k].imag();
+      }
+      for (unsigned int row = 0; row < size; row++)
+      {
+        mat->InsertMyValues(row, row_nnz[row], &re[ap[row]], aj + ap[row]);
+        mat_im->InsertMyValues(row, row_nnz[row], &im[ap[row]], aj + ap[row]);
+      }
+      mat->FillComplete();
+      mat_im->FillComplete();
+    }
+
     template<typename Scalar>
     EpetraVector<Scalar>::EpetraVector()
     {
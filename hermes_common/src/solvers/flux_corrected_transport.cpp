@@ -0,0 +1,280 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file flux_corrected_transport.cpp
+\brief FluxCorrectedTransport class, the algebraic flux correction (FCT) of the convection problems.
+*/
+#include "flux_corrected_transport.h"
+#ifdef WITH_UMFPACK
+#include "callstack.h"
+
+namespace Hermes
+{
+  namespace Algebra
+  {
+    FluxCorrectedTransport::FluxCorrectedTransport(double theta) : theta(theta)
+    {
+    }
+
+    FluxCorrectedTransport::~FluxCorrectedTransport()
+    {
+    }
+
+    void FluxCorrectedTransport::set_fct_dofs(const bool* fct_dofs, int size)
+    {
+      if(fct_dofs == NULL)
+        this->fct_dofs.clear();
+      else
+        this->fct_dofs.assign(fct_dofs, fct_dofs + size);
+    }
+
+    int FluxCorrectedTransport::find_entry(int* Ap, int* Ai, int row, int col)
+    {
+      int* it = std::lower_bound(Ai + Ap[col], Ai + Ap[col + 1], row);
+      if(it == Ai + Ap[col + 1] || *it != row)
+        return -1;
+      return (int)(it - Ai);
+    }
+
+    void FluxCorrectedTransport::artificial_diffusion(CSCMatrix<double>* conv_matrix, CSCMatrix<double>* diffusion)
+    {
+      int size = conv_matrix->get_size();
+      int* Ap = conv_matrix->get_Ap();
+      int* Ai = conv_matrix->get_Ai();
+      double* Ax = conv_matrix->get_Ax();
+      if(!this->fct_dofs.empty() && (int)this->fct_dofs.size() != size)
+        throw Hermes::Exceptions::LengthException(1, this->fct_dofs.size(), size);
+
+      double* D_Ax = new double[Ap[size]];
+      bool diagonal_missing = false;
+
+#pragma omp parallel for schedule(static) reduction(||:diagonal_missing)
+      for (int j = 0; j < size; j++)
+      {
+        int diagonal = -1;
+        double sum = 0.0;
+        for (int indx = Ap[j]; indx < Ap[j + 1]; indx++)
+        {
+          int i = Ai[indx];
+          D_Ax[indx] = 0.0;
+          if(i == j)
+          {
+            diagonal = indx;
+            continue;
+          }
+          if(!is_fct_dof(i) || !is_fct_dof(j))
+            continue;
+          int transposed = find_entry(Ap, Ai, j, i);
+          double d = std::max(0.0, -Ax[indx]);
+          if(transposed >= 0)
+            d = std::max(d, -Ax[transposed]);
+          D_Ax[indx] = d;
+          sum += d;
+        }
+        if(diagonal >= 0)
+          D_Ax[diagonal] = -sum;
+        else if(sum != 0.0)
+          diagonal_missing = true;
+      }
+
+      if(diagonal_missing)
+      {
+        delete [] D_Ax;
+        throw Hermes::Exceptions::Exception("FluxCorrectedTransport: a diagonal entry missing in the structure of the convection matrix.");
+      }
+      diffusion->free();
+      diffusion->create(size, Ap[size], Ap, Ai, D_Ax);
+      delete [] D_Ax;
+    }
+
+    void FluxCorrectedTransport::mass_lumping(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix)
+    {
+      int size = mass_matrix->get_size();
+      int* Ap = mass_matrix->get_Ap();
+      int* Ai = mass_matrix->get_Ai();
+      double* Ax = mass_matrix->get_Ax();
+      if(!this->fct_dofs.empty() && (int)this->fct_dofs.size() != size)
+        throw Hermes::Exceptions::LengthException(1, this->fct_dofs.size(), size);
+
+      double* L_Ax = new double[Ap[size]];
+      bool diagonal_missing = false;
+
+#pragma omp parallel for schedule(static) reduction(||:diagonal_missing)
+      for (int j = 0; j < size; j++)
+      {
+        int diagonal = -1;
+        double sum = 0.0;
+        for (int indx = Ap[j]; indx < Ap[j + 1]; indx++)
+        {
+          int i = Ai[indx];
+          L_Ax[indx] = Ax[indx];
+          if(i == j)
+            diagonal = indx;
+          else if(is_fct_dof(i) && is_fct_dof(j))
+          {
+            sum += Ax[indx];
+            L_Ax[indx] = 0.0;
+          }
+        }
+        if(diagonal >= 0)
+          L_Ax[diagonal] += sum;
+        else if(sum != 0.0)
+          diagonal_missing = true;
+      }
+
+      if(diagonal_missing)
+      {
+        delete [] L_Ax;
+        throw Hermes::Exceptions::Exception("FluxCorrectedTransport: a diagonal entry missing in the structure of the mass matrix.");
+      }
+      lumped_matrix->free();
+      lumped_matrix->create(size, Ap[size], Ap, Ai, L_Ax);
+      delete [] L_Ax;
+    }
+
+    void FluxCorrectedTransport::antidiffusive_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix, CSCMatrix<double>* diffusion,
+      double* u_high, double* u_L, double* u_old, double time_step, double* flux, const int* smooth_dofs)
+    {
+      if(diffusion == NULL || u_old == NULL)
+        throw Hermes::Exceptions::NullException(diffusion == NULL ? 3 : 6);
+      this->limit_fluxes(mass_matrix, lumped_matrix, diffusion, u_high, u_L, u_old, time_step, flux, smooth_dofs);
+    }
+
+    void FluxCorrectedTransport::projection_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix,
+      double* u_high, double* u_L, double* flux, const int* smooth_dofs)
+    {
+      this->limit_fluxes(mass_matrix, lumped_matrix, NULL, u_high, u_L, NULL, 1.0, flux, smooth_dofs);
+    }
+
+    void FluxCorrectedTransport::limit_fluxes(CSCMatrix<double>* mass_matrix, CSCMatrix<double>* lumped_matrix, CSCMatrix<double>* diffusion,
+      double* u_high, double* u_L, double* u_old, double time_step, double* flux, const int* smooth_dofs)
+    {
+      int size = mass_matrix->get_size();
+      int* Ap = mass_matrix->get_Ap();
+      int* Ai = mass_matrix->get_Ai();
+      double* Ax = mass_matrix->get_Ax();
+      int* L_Ap = lumped_matrix->get_Ap();
+      int* L_Ai = lumped_matrix->get_Ai();
+      double* L_Ax = lumped_matrix->get_Ax();
+      int* D_Ap = diffusion == NULL ? NULL : diffusion->get_Ap();
+      int* D_Ai = diffusion == NULL ? NULL : diffusion->get_Ai();
+      double* D_Ax = diffusion == NULL ? NULL : diffusion->get_Ax();
+      if((int)lumped_matrix->get_size() != size)
+        throw Hermes::Exceptions::LengthException(2, lumped_matrix->get_size(), size);
+      if(diffusion != NULL && (int)diffusion->get_size() != size)
+        throw Hermes::Exceptions::LengthException(3, diffusion->get_size(), size);
+      if(!this->fct_dofs.empty() && (int)this->fct_dofs.size() != size)
+        throw Hermes::Exceptions::LengthException(1, this->fct_dofs.size(), size);
+
+      this->R_plus.resize(size);
+      this->R_minus.resize(size);
+      this->entry_fluxes.resize(Ap[size]);
+      double inv_time_step = 1.0 / time_step;
+
+      // The fluxes f_ji, P, Q and R of the DOF j. The flux of a pair is evaluated from the entries of the column of the
+      // smaller DOF (the transposed entry looked up otherwise), so that f_ij = -f_ji holds exactly.
+#pragma omp parallel for schedule(static)
+      for (int j = 0; j < size; j++)
+      {
+        this->R_plus[j] = this->R_minus[j] = 1.0;
+        if(!is_fct_dof(j))
+          continue;
+
+        int diagonal = find_entry(L_Ap, L_Ai, j, j);
+        double lumped = diagonal < 0 ? 0.0 : L_Ax[diagonal];
+        double P_plus = 0.0, P_minus = 0.0, Q_plus = 0.0, Q_minus = 0.0;
+        for (int indx = Ap[j]; indx < Ap[j + 1]; indx++)
+        {
+          int i = Ai[indx];
+          this->entry_fluxes[indx] = 0.0;
+          if(i == j || !is_fct_dof(i))
+            continue;
+
+          // The entries (max(i, j), min(i, j)).
+          double mass;
+          int col = std::min(i, j), row = std::max(i, j);
+          if(col == j)
+            mass = Ax[indx];
+          else
+          {
+            int transposed = find_entry(Ap, Ai, row, col);
+            mass = transposed < 0 ? 0.0 : Ax[transposed];
+          }
+          if(mass == 0.0)
+            continue;
+
+          double f;
+          if(diffusion == NULL)
+            f = mass * (u_high[row] - u_high[col]);
+          else
+          {
+            int d_indx = find_entry(D_Ap, D_Ai, row, col);
+            double diff = d_indx < 0 ? 0.0 : D_Ax[d_indx];
+            f = (mass * inv_time_step + diff * theta) * (u_high[row] - u_high[col])
+              - (mass * inv_time_step - diff * (1. - theta)) * (u_old[row] - u_old[col]);
+          }
+          // Prelimiting.
+          if(f * (u_L[col] - u_L[row]) > 0.0)
+            f = 0.0;
+          // f_ji.
+          if(row != j)
+            f = -f;
+          this->entry_fluxes[indx] = f;
+
+          if(f > 0.0)
+            P_plus += f;
+          else if(f < 0.0)
+            P_minus += f;
+          double q = lumped * (u_L[i] - u_L[j]) * inv_time_step;
+          if(q > Q_plus)
+            Q_plus = q;
+          if(q < Q_minus)
+            Q_minus = q;
+        }
+
+        if(smooth_dofs != NULL && smooth_dofs[j] == 1)
+          continue;
+        if(P_plus != 0.0)
+          this->R_plus[j] = std::min(1.0, Q_plus / P_plus);
+        if(P_minus != 0.0)
+          this->R_minus[j] = std::min(1.0, Q_minus / P_minus);
+      }
+
+      // The limited sums, alpha_ji = min(R+_j, R-_i) for f_ji > 0, min(R-_j, R+_i) for f_ji < 0.
+#pragma omp parallel for schedule(static)
+      for (int j = 0; j < size; j++)
+      {
+        double sum = 0.0;
+        if(is_fct_dof(j))
+        {
+          for (int indx = Ap[j]; indx < Ap[j + 1]; indx++)
+          {
+            double f = this->entry_fluxes[indx];
+            int i = Ai[indx];
+            if(f > 0.0)
+              sum += std::min(this->R_plus[j], this->R_minus[i]) * f;
+            else if(f < 0.0)
+              sum += std::min(this->R_minus[j], this->R_plus[i]) * f;
+          }
+        }
+        flux[j] = sum;
+      }
+    }
+  }
+}
+#endif
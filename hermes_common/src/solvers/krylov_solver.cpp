@@ -0,0 +1,673 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file krylov_solver.cpp
+\brief KrylovSolver class, the built-in preconditioned iterative solvers.
+*/
+#include "krylov_solver.h"
+#include "device_krylov.h"
+#include "vector_kernels.h"
+#include "callstack.h"
+
+namespace Hermes
+{
+  namespace Solvers
+  {
+    static inline double conj_value(double x) { return x; }
+    static inline std::complex<double> conj_value(std::complex<double> x) { return std::conj(x); }
+
+    using Hermes::Algebra::VectorKernels::dot;
+    using Hermes::Algebra::VectorKernels::axpy;
+
+    template<typename Scalar>
+    static double norm(int n, Scalar *a)
+    {
+      return Hermes::Algebra::VectorKernels::nrm2(n, a);
+    }
+
+    template<typename Scalar>
+    KrylovSolver<Scalar>::KrylovSolver(CSRMatrix<Scalar> *m, SimpleVector<Scalar> *rhs)
+      : IterSolver<Scalar>(), m(m), rhs(rhs), method(KrylovGMRES), preconditioner(PreconditionerNone), gmres_restart(30), num_blocks(0),
+      reuse_preconditioner(false), pc(NULL), op(NULL), op_precond(NULL), nonzero_initial_guess(false), use_device(false), device(NULL), num_iters(0), residual(0.0), precond_values(NULL), diag_position(NULL), precond_size(-1)
+    {
+    }
+
+    template<typename Scalar>
+    KrylovSolver<Scalar>::~KrylovSolver()
+    {
+      this->free_preconditioner();
+#ifdef WITH_CUDA
+      delete this->device;
+#endif
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_device(bool to_set)
+    {
+#ifdef WITH_CUDA
+      this->use_device = to_set;
+#else
+      if(to_set)
+        this->warn("KrylovSolver: Hermes was built without CUDA (WITH_CUDA), the solver stays on the host.");
+#endif
+    }
+
+    template<typename Scalar>
+    bool KrylovSolver<Scalar>::solve_on_device(Scalar *b, double b_norm)
+    {
+#ifdef WITH_CUDA
+      if(!this->use_device || this->op != NULL || this->method == KrylovGMRES
+        || (this->preconditioner != PreconditionerNone && this->preconditioner != PreconditionerJacobi))
+        return false;
+
+      if(this->device == NULL)
+        this->device = new DeviceKrylov<Scalar>();
+      int size = m->get_size();
+      this->device->set_matrix(size, m->get_Ap()[size], m->get_Ap(), m->get_Aj(), m->get_Ax());
+      this->device->set_jacobi(this->preconditioner == PreconditionerJacobi ? this->precond_values : NULL);
+      if(this->method == KrylovCG)
+        this->num_iters = this->device->solve_cg(b, b_norm, this->sln, this->nonzero_initial_guess, this->tolerance, this->max_iters, this->residual);
+      else
+        this->num_iters = this->device->solve_bicgstab(b, b_norm, this->sln, this->nonzero_initial_guess, this->tolerance, this->max_iters, this->residual);
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_solver(const char *solver)
+    {
+      if(strcasecmp(solver, "cg") == 0)
+        this->method = KrylovCG;
+      else if(strcasecmp(solver, "gmres") == 0)
+        this->method = KrylovGMRES;
+      else if(strcasecmp(solver, "bicgstab") == 0)
+        this->method = KrylovBiCGStab;
+      else
+        throw Hermes::Exceptions::Exception("KrylovSolver: unknown iterative method '%s' (cg | gmres | bicgstab).", solver);
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_precond(const char *name)
+    {
+      PreconditionerType preconditioner;
+      if(strcasecmp(name, "none") == 0)
+        preconditioner = PreconditionerNone;
+      else if(strcasecmp(name, "jacobi") == 0)
+        preconditioner = PreconditionerJacobi;
+      else if(strcasecmp(name, "ilu") == 0 || strcasecmp(name, "ilu0") == 0)
+        preconditioner = PreconditionerILU;
+      else if(strcasecmp(name, "block-jacobi") == 0)
+        preconditioner = PreconditionerBlockJacobi;
+      else
+        throw Hermes::Exceptions::Exception("KrylovSolver: unknown preconditioner '%s' (none | jacobi | ilu | block-jacobi).", name);
+
+      if(preconditioner != this->preconditioner)
+        this->free_preconditioner();
+      this->preconditioner = preconditioner;
+      this->pc = NULL;
+      this->precond_yes = (preconditioner != PreconditionerNone);
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_precond(Precond<Scalar> *pc)
+    {
+      this->free_preconditioner();
+      this->pc = pc;
+      this->preconditioner = (pc != NULL) ? PreconditionerUser : PreconditionerNone;
+      this->precond_yes = (pc != NULL);
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_operator(LinearOperator<Scalar> *op, LinearOperator<Scalar> *precond)
+    {
+      this->op = op;
+      this->op_precond = (op != NULL) ? precond : NULL;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::multiply(Scalar *x, Scalar *y)
+    {
+      if(this->op != NULL)
+        this->op->apply(x, y);
+      else
+        m->multiply_with_vector(x, y);
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_factorization_scheme(FactorizationScheme reuse_scheme)
+    {
+      this->reuse_preconditioner = (reuse_scheme == HERMES_REUSE_FACTORIZATION_COMPLETELY);
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_gmres_restart(int restart)
+    {
+      if(restart < 1)
+        throw Hermes::Exceptions::ValueException("restart", restart, 1);
+      this->gmres_restart = restart;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::set_num_blocks(int num_blocks)
+    {
+      this->num_blocks = num_blocks;
+      this->free_preconditioner();
+    }
+
+    template<typename Scalar>
+    int KrylovSolver<Scalar>::get_matrix_size()
+    {
+      return (this->op != NULL) ? rhs->length() : m->get_size();
+    }
+
+    template<typename Scalar>
+    int KrylovSolver<Scalar>::get_num_iters()
+    {
+      return this->num_iters;
+    }
+
+    template<typename Scalar>
+    double KrylovSolver<Scalar>::get_residual()
+    {
+      return this->residual;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::free_preconditioner()
+    {
+      delete [] precond_values;
+      precond_values = NULL;
+      delete [] diag_position;
+      diag_position = NULL;
+      block_starts.clear();
+      precond_size = -1;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::setup_preconditioner()
+    {
+      int size = m->get_size();
+      if(this->preconditioner == PreconditionerNone || (this->reuse_preconditioner && this->precond_size == size))
+        return;
+      this->free_preconditioner();
+
+      if(this->preconditioner == PreconditionerUser)
+      {
+        this->pc->create(m);
+        this->pc->compute();
+        precond_size = size;
+        return;
+      }
+
+      int *Ap = m->get_Ap();
+      int *Aj = m->get_Aj();
+      Scalar *Ax = m->get_Ax();
+
+      diag_position = new int[size];
+      for (int i = 0; i < size; i++)
+      {
+        int *it = std::lower_bound(Aj + Ap[i], Aj + Ap[i + 1], i);
+        if(it == Aj + Ap[i + 1] || *it != i)
+          throw Hermes::Exceptions::Exception("KrylovSolver: the diagonal entry of the row %i is not in the matrix structure.", i);
+        diag_position[i] = it - Aj;
+      }
+
+      if(this->preconditioner == PreconditionerJacobi)
+      {
+        // The inverted diagonal.
+        precond_values = new Scalar[size];
+        for (int i = 0; i < size; i++)
+        {
+          if(Ax[diag_position[i]] == Scalar(0))
+            throw Hermes::Exceptions::Exception("KrylovSolver: zero diagonal entry in the row %i, Jacobi preconditioner not possible.", i);
+          precond_values[i] = Scalar(1) / Ax[diag_position[i]];
+        }
+        precond_size = size;
+        return;
+      }
+
+      // (Block) ILU(0) - the couplings between the blocks are dropped, so the blocks are factorized independently.
+      int blocks = 1;
+      if(this->preconditioner == PreconditionerBlockJacobi)
+      {
+        blocks = this->num_blocks > 0 ? this->num_blocks : omp_get_max_threads();
+        blocks = std::max(1, std::min(blocks, size));
+      }
+      block_starts.resize(blocks + 1);
+      for (int b = 0; b <= blocks; b++)
+        block_starts[b] = (int)(((long long)size * b) / blocks);
+
+      precond_values = new Scalar[m->get_nnz()];
+      memcpy(precond_values, Ax, m->get_nnz() * sizeof(Scalar));
+      Scalar *lu = precond_values;
+
+      int zero_pivot_row = -1;
+#pragma omp parallel for schedule(dynamic, 1)
+      for (int b = 0; b < blocks; b++)
+      {
+        int block_start = block_starts[b], block_end = block_starts[b + 1];
+        for (int i = block_start; i < block_end; i++)
+        {
+          // Row i minus the multiples of the rows above it (IKJ variant), only on the structure of the row.
+          for (int k = Ap[i]; k < diag_position[i]; k++)
+          {
+            int c = Aj[k];
+            if(c < block_start)
+              continue;
+            lu[k] /= lu[diag_position[c]];
+
+            // Both rows are sorted, merge the rest of row i with the upper part of row c.
+            int j = k + 1, l = diag_position[c] + 1;
+            while (j < Ap[i + 1] && l < Ap[c + 1] && Aj[l] < block_end)
+            {
+              if(Aj[j] == Aj[l])
+                lu[j++] -= lu[k] * lu[l++];
+              else if(Aj[j] < Aj[l])
+                j++;
+              else
+                l++;
+            }
+          }
+          if(lu[diag_position[i]] == Scalar(0))
+          {
+#pragma omp critical (KrylovSolver_zero_pivot)
+            zero_pivot_row = i;
+            break;
+          }
+        }
+      }
+
+      if(zero_pivot_row >= 0)
+      {
+        this->free_preconditioner();
+        throw Hermes::Exceptions::Exception("KrylovSolver: zero pivot in the row %i of the ILU(0) factorization.", zero_pivot_row);
+      }
+      precond_size = size;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::apply_preconditioner(Scalar *r, Scalar *z)
+    {
+      int size = this->get_matrix_size();
+      if(this->op != NULL)
+      {
+        if(this->op_precond != NULL)
+          this->op_precond->apply(r, z);
+        else
+          memcpy(z, r, size * sizeof(Scalar));
+        return;
+      }
+
+      if(this->preconditioner == PreconditionerNone)
+      {
+        memcpy(z, r, size * sizeof(Scalar));
+        return;
+      }
+
+      if(this->preconditioner == PreconditionerUser)
+      {
+        this->pc->apply(r, z);
+        return;
+      }
+
+      if(this->preconditioner == PreconditionerJacobi)
+      {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++)
+          z[i] = precond_values[i] * r[i];
+        return;
+      }
+
+      int *Ap = m->get_Ap();
+      int *Aj = m->get_Aj();
+      Scalar *lu = precond_values;
+      int blocks = (int)block_starts.size() - 1;
+#pragma omp parallel for schedule(dynamic, 1)
+      for (int b = 0; b < blocks; b++)
+      {
+        int block_start = block_starts[b], block_end = block_starts[b + 1];
+        // L y = r, the unit diagonal of L is not stored.
+        for (int i = block_start; i < block_end; i++)
+        {
+          Scalar y = r[i];
+          for (int k = Ap[i]; k < diag_position[i]; k++)
+            if(Aj[k] >= block_start)
+              y -= lu[k] * z[Aj[k]];
+          z[i] = y;
+        }
+        // U z = y.
+        for (int i = block_end - 1; i >= block_start; i--)
+        {
+          Scalar y = z[i];
+          for (int k = diag_position[i] + 1; k < Ap[i + 1] && Aj[k] < block_end; k++)
+            y -= lu[k] * z[Aj[k]];
+          z[i] = y / lu[diag_position[i]];
+        }
+      }
+    }
+
+    template<typename Scalar>
+    bool KrylovSolver<Scalar>::solve()
+    {
+      assert(m != NULL || op != NULL);
+      assert(rhs != NULL);
+      assert(op != NULL || m->get_size() == rhs->length());
+
+      this->tick();
+
+      int size = this->get_matrix_size();
+      if(this->op == NULL)
+      {
+        // SELLMatrix converts the values for its product here, unless that was done after the assembly already.
+        m->finish();
+        this->setup_preconditioner();
+      }
+
+      if(this->sln != NULL)
+        delete [] this->sln;
+      this->sln = new Scalar[size];
+      memset(this->sln, 0, size * sizeof(Scalar));
+
+      this->num_iters = 0;
+      this->residual = 0.0;
+      Scalar *b = rhs->get_c_array();
+      double b_norm = norm(size, b);
+      this->nonzero_initial_guess = false;
+      if(b_norm > 0.0)
+      {
+        if(this->initial_guess != NULL && this->initial_guess_size == (unsigned int)size)
+        {
+          memcpy(this->sln, this->initial_guess, size * sizeof(Scalar));
+          this->nonzero_initial_guess = true;
+        }
+        if(!this->solve_on_device(b, b_norm))
+        switch (this->method)
+        {
+        case KrylovCG:
+          this->solve_cg(b, b_norm);
+          break;
+        case KrylovGMRES:
+          this->solve_gmres(b, b_norm);
+          break;
+        case KrylovBiCGStab:
+          this->solve_bicgstab(b, b_norm);
+          break;
+        }
+      }
+
+      this->tick();
+      this->time = this->accumulated();
+
+      this->error = (this->residual <= this->tolerance) ? 0 : 1;
+      if(this->error)
+        this->warn("KrylovSolver: no convergence in %i iterations, relative residual %g.", this->num_iters, this->residual);
+      return this->error == 0;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::initial_residual(Scalar *b, Scalar *x, Scalar *r)
+    {
+      int size = this->get_matrix_size();
+      if(!this->nonzero_initial_guess)
+      {
+        memcpy(r, b, size * sizeof(Scalar));
+        return;
+      }
+      this->multiply(x, r);
+#pragma omp parallel for schedule(static)
+      for (int i = 0; i < size; i++)
+        r[i] = b[i] - r[i];
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::solve_cg(Scalar *b, double b_norm)
+    {
+      int size = this->get_matrix_size();
+      Scalar *x = this->sln;
+      Scalar *r = new Scalar[size];
+      Scalar *z = new Scalar[size];
+      Scalar *p = new Scalar[size];
+      Scalar *q = new Scalar[size];
+
+      this->initial_residual(b, x, r);
+      this->apply_preconditioner(r, z);
+      memcpy(p, z, size * sizeof(Scalar));
+      Scalar rz = dot(size, r, z);
+      this->residual = 1.0;
+
+      while (this->num_iters < this->max_iters)
+      {
+        this->multiply(p, q);
+        Scalar pq = dot(size, p, q);
+        if(pq == Scalar(0))
+          break;
+        Scalar alpha = rz / pq;
+        axpy(size, alpha, p, x);
+        axpy(size, -alpha, q, r);
+        this->num_iters++;
+
+        this->residual = norm(size, r) / b_norm;
+        if(this->residual <= this->tolerance)
+          break;
+
+        this->apply_preconditioner(r, z);
+        Scalar rz_new = dot(size, r, z);
+        Scalar beta = rz_new / rz;
+        rz = rz_new;
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++)
+          p[i] = z[i] + beta * p[i];
+      }
+
+      delete [] r;
+      delete [] z;
+      delete [] p;
+      delete [] q;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::solve_gmres(Scalar *b, double b_norm)
+    {
+      int size = this->get_matrix_size();
+      int restart = this->gmres_restart;
+      Scalar *x = this->sln;
+
+      // Krylov basis, Hessenberg matrix (column-wise, H[j][i] = h_ij), Givens rotations and the rotated residual.
+      Scalar **V = new Scalar*[restart + 1];
+      for (int i = 0; i <= restart; i++)
+        V[i] = new Scalar[size];
+      Scalar **H = new Scalar*[restart];
+      for (int j = 0; j < restart; j++)
+        H[j] = new Scalar[restart + 1];
+      Scalar *c = new Scalar[restart];
+      Scalar *s = new Scalar[restart];
+      Scalar *g = new Scalar[restart + 1];
+      Scalar *z = new Scalar[size];
+      Scalar *w = new Scalar[size];
+
+      this->residual = 1.0;
+      bool converged = false;
+      while (!converged && this->num_iters < this->max_iters)
+      {
+        // r = b - A x
+        this->multiply(x, w);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++)
+          V[0][i] = b[i] - w[i];
+        double beta = norm(size, V[0]);
+        this->residual = beta / b_norm;
+        if(this->residual <= this->tolerance)
+          break;
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++)
+          V[0][i] /= beta;
+        memset(g, 0, (restart + 1) * sizeof(Scalar));
+        g[0] = beta;
+
+        int k = 0;
+        while (k < restart && this->num_iters < this->max_iters)
+        {
+          // w = A M^{-1} v_k, orthogonalized by the modified Gram-Schmidt.
+          this->apply_preconditioner(V[k], z);
+          this->multiply(z, w);
+          for (int i = 0; i <= k; i++)
+          {
+            H[k][i] = dot(size, V[i], w);
+            axpy(size, -H[k][i], V[i], w);
+          }
+          double h_next = norm(size, w);
+          H[k][k + 1] = h_next;
+          if(h_next > 0.0)
+          {
+#pragma omp parallel for schedule(static)
+            for (int i = 0; i < size; i++)
+              V[k + 1][i] = w[i] / h_next;
+          }
+
+          // The previous rotations applied to the new column, then the one eliminating h_{k+1,k}.
+          for (int i = 0; i < k; i++)
+          {
+            Scalar h_i = H[k][i];
+            H[k][i] = conj_value(c[i]) * h_i + conj_value(s[i]) * H[k][i + 1];
+            H[k][i + 1] = -s[i] * h_i + c[i] * H[k][i + 1];
+          }
+          double denominator = std::sqrt(std::abs(H[k][k]) * std::abs(H[k][k]) + h_next * h_next);
+          if(denominator == 0.0)
+            break;
+          c[k] = H[k][k] / denominator;
+          s[k] = H[k][k + 1] / denominator;
+          H[k][k] = denominator;
+          H[k][k + 1] = 0;
+          g[k + 1] = -s[k] * g[k];
+          g[k] = conj_value(c[k]) * g[k];
+
+          k++;
+          this->num_iters++;
+          this->residual = std::abs(g[k]) / b_norm;
+          if(this->residual <= this->tolerance || h_next == 0.0)
+          {
+            converged = true;
+            break;
+          }
+        }
+
+        // H y = g (upper triangular), x = x + M^{-1} V y.
+        for (int i = k - 1; i >= 0; i--)
+        {
+          for (int j = i + 1; j < k; j++)
+            g[i] -= H[j][i] * g[j];
+          g[i] /= H[i][i];
+        }
+        memset(w, 0, size * sizeof(Scalar));
+        for (int i = 0; i < k; i++)
+          axpy(size, g[i], V[i], w);
+        this->apply_preconditioner(w, z);
+        axpy(size, Scalar(1), z, x);
+
+        if(k == 0)
+          break;
+      }
+
+      for (int i = 0; i <= restart; i++)
+        delete [] V[i];
+      delete [] V;
+      for (int j = 0; j < restart; j++)
+        delete [] H[j];
+      delete [] H;
+      delete [] c;
+      delete [] s;
+      delete [] g;
+      delete [] z;
+      delete [] w;
+    }
+
+    template<typename Scalar>
+    void KrylovSolver<Scalar>::solve_bicgstab(Scalar *b, double b_norm)
+    {
+      int size = this->get_matrix_size();
+      Scalar *x = this->sln;
+      Scalar *r = new Scalar[size];
+      Scalar *r0 = new Scalar[size];
+      Scalar *p = new Scalar[size];
+      Scalar *v = new Scalar[size];
+      Scalar *p_hat = new Scalar[size];
+      Scalar *s_hat = new Scalar[size];
+      Scalar *t = new Scalar[size];
+
+      this->initial_residual(b, x, r);
+      memcpy(r0, r, size * sizeof(Scalar));
+      memset(p, 0, size * sizeof(Scalar));
+      memset(v, 0, size * sizeof(Scalar));
+      Scalar rho = 1, alpha = 1, omega = 1;
+      this->residual = 1.0;
+
+      while (this->num_iters < this->max_iters)
+      {
+        Scalar rho_new = dot(size, r0, r);
+        if(rho_new == Scalar(0))
+          break;
+        Scalar beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++)
+          p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+        this->apply_preconditioner(p, p_hat);
+        this->multiply(p_hat, v);
+        Scalar r0v = dot(size, r0, v);
+        if(r0v == Scalar(0))
+          break;
+        alpha = rho / r0v;
+        // s = r - alpha v is kept in r.
+        axpy(size, -alpha, v, r);
+        axpy(size, alpha, p_hat, x);
+        this->num_iters++;
+
+        this->residual = norm(size, r) / b_norm;
+        if(this->residual <= this->tolerance)
+          break;
+
+        this->apply_preconditioner(r, s_hat);
+        this->multiply(s_hat, t);
+        double tt = norm(size, t);
+        if(tt == 0.0)
+          break;
+        omega = dot(size, t, r) / (tt * tt);
+        axpy(size, omega, s_hat, x);
+        axpy(size, -omega, t, r);
+
+        this->residual = norm(size, r) / b_norm;
+        if(this->residual <= this->tolerance || omega == Scalar(0))
+          break;
+      }
+
+      delete [] r;
+      delete [] r0;
+      delete [] p;
+      delete [] v;
+      delete [] p_hat;
+      delete [] s_hat;
+      delete [] t;
+    }
+
+    template class HERMES_API KrylovSolver<double>;
+    template class HERMES_API KrylovSolver<std::complex<double> >;
+  }
+}
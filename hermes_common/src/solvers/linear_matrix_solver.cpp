@@ -27,6 +27,7 @@
 #include "mumps_solver.h"
 #include "newton_solver_nox.h"
 #include "aztecoo_solver.h"
+#include "krylov_solver.h"
 #include "api.h"
 
 using namespace Hermes::Algebra;
@@ -67,6 +68,46 @@ namespace Hermes
       return time;
     }
 
+    template<typename Scalar>
+    bool LinearMatrixSolver<Scalar>::solve_transposed()
+    {
+      throw Exceptions::MethodNotOverridenException("LinearMatrixSolver<Scalar>::solve_transposed");
+      return false;
+    }
+
+    template<typename Scalar>
+    LinearMatrixSolveTask<Scalar>* LinearMatrixSolver<Scalar>::solve_async(AsyncTask* dependency)
+    {
+      LinearMatrixSolveTask<Scalar>* task = new LinearMatrixSolveTask<Scalar>(this);
+      if(dependency != NULL)
+        task->depends_on(dependency);
+      task->start();
+      return task;
+    }
+
+    template<typename Scalar>
+    LinearMatrixSolveTask<Scalar>::LinearMatrixSolveTask(LinearMatrixSolver<Scalar>* solver) : solver(solver), result(false)
+    {
+    }
+
+    template<typename Scalar>
+    LinearMatrixSolveTask<Scalar>::~LinearMatrixSolveTask()
+    {
+      this->join();
+    }
+
+    template<typename Scalar>
+    bool LinearMatrixSolveTask<Scalar>::get_result() const
+    {
+      return this->result;
+    }
+
+    template<typename Scalar>
+    void LinearMatrixSolveTask<Scalar>::run()
+    {
+      this->result = this->solver->solve();
+    }
+
     template<typename Scalar>
     void LinearMatrixSolver<Scalar>::set_factorization_scheme()
     {
@@ -77,7 +118,7 @@ namespace Hermes
     LinearMatrixSolver<Scalar>* create_linear_solver(Matrix<Scalar>* matrix, Vector<Scalar>* rhs)
     {
       Vector<Scalar>* rhs_dummy = NULL;
-      switch (Hermes::HermesCommonApi.get_integral_param_value(Hermes::matrixSolverType))
+      switch (Hermes::HermesCommonApi.get_matrix_solver_type())
       {
       case Hermes::SOLVER_AZTECOO:
         {
@@ -139,6 +180,12 @@ namespace Hermes
 #endif
           break;
         }
+      case Hermes::SOLVER_KRYLOV:
+        {
+          if(rhs != NULL) return new KrylovSolver<Scalar>(static_cast<CSRMatrix<Scalar>*>(matrix), static_cast<SimpleVector<Scalar>*>(rhs));
+          else return new KrylovSolver<Scalar>(static_cast<CSRMatrix<Scalar>*>(matrix), static_cast<SimpleVector<Scalar>*>(rhs_dummy));
+          break;
+        }
       default:
         throw Hermes::Exceptions::Exception("Unknown matrix solver requested in create_linear_solver().");
       }
@@ -151,6 +198,70 @@ namespace Hermes
       factorization_scheme = reuse_scheme;
     }
 
+    template<typename Scalar>
+    void DirectSolver<Scalar>::set_reuse_symbolic_on_same_structure(bool to_set)
+    {
+      this->reuse_symbolic_on_same_structure = to_set;
+    }
+
+    template<typename Scalar>
+    void DirectSolver<Scalar>::set_mixed_precision(bool to_set, int max_refinement_steps, double refinement_tolerance)
+    {
+      if(to_set)
+        this->warn("Mixed precision solves are not available for this solver, factorizing in double precision.");
+    }
+
+    template<typename Scalar>
+    int DirectSolver<Scalar>::get_num_refinement_steps() const
+    {
+      return this->num_refinement_steps;
+    }
+
+    template<typename Scalar>
+    unsigned long DirectSolver<Scalar>::hash_structure(const int* first, unsigned int first_size, const int* second, unsigned int second_size)
+    {
+      unsigned long hash = 2166136261UL;
+      const unsigned long prime = 16777619UL;
+      hash = (hash ^ first_size) * prime;
+      hash = (hash ^ second_size) * prime;
+      for(unsigned int i = 0; i < first_size; i++)
+        hash = (hash ^ (unsigned int)first[i]) * prime;
+      for(unsigned int i = 0; i < second_size; i++)
+        hash = (hash ^ (unsigned int)second[i]) * prime;
+      return hash;
+    }
+
+    template<typename Scalar>
+    unsigned int DirectSolver<Scalar>::check_structure(unsigned long structure_hash, bool have_symbolic)
+    {
+      if(this->reuse_symbolic_on_same_structure && have_symbolic && this->has_symbolic_structure_hash && structure_hash == this->symbolic_structure_hash)
+        return HERMES_REUSE_MATRIX_REORDERING;
+
+      this->symbolic_structure_hash = structure_hash;
+      this->has_symbolic_structure_hash = true;
+      return HERMES_FACTORIZE_FROM_SCRATCH;
+    }
+
+    template<typename Scalar>
+    IterSolver<Scalar>::~IterSolver()
+    {
+      delete [] this->initial_guess;
+    }
+
+    template<typename Scalar>
+    void IterSolver<Scalar>::set_initial_guess(Scalar* initial_guess, unsigned int size)
+    {
+      delete [] this->initial_guess;
+      this->initial_guess = NULL;
+      this->initial_guess_size = 0;
+      if(initial_guess != NULL)
+      {
+        this->initial_guess = new Scalar[size];
+        memcpy(this->initial_guess, initial_guess, size * sizeof(Scalar));
+        this->initial_guess_size = size;
+      }
+    }
+
     template<typename Scalar>
     void IterSolver<Scalar>::set_tolerance(double tol)
     {
@@ -169,6 +280,8 @@ namespace Hermes
 
     template class HERMES_API LinearMatrixSolver<double>;
     template class HERMES_API LinearMatrixSolver<std::complex<double> >;
+    template class HERMES_API LinearMatrixSolveTask<double>;
+    template class HERMES_API LinearMatrixSolveTask<std::complex<double> >;
     template class HERMES_API DirectSolver<double>;
     template class HERMES_API DirectSolver<std::complex<double> >;
     template class HERMES_API IterSolver<double>;
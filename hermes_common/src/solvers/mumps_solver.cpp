@@ -32,6 +32,10 @@ namespace Hermes
     {
       extern void dmumps_c(DMUMPS_STRUC_C *mumps_param_ptr);
       extern void zmumps_c(ZMUMPS_STRUC_C *mumps_param_ptr);
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      extern void smumps_c(SMUMPS_STRUC_C *mumps_param_ptr);
+      extern void cmumps_c(CMUMPS_STRUC_C *mumps_param_ptr);
+#endif
     }
 
 #define USE_COMM_WORLD  -987654
@@ -77,6 +81,7 @@ namespace Hermes
       Ax = NULL;
       Ap = NULL;
       Ai = NULL;
+      owner = true;
     }
 
     template<typename Scalar>
@@ -125,9 +130,16 @@ namespace Hermes
     void MumpsMatrix<Scalar>::free()
     {
       nnz = 0;
-      delete [] Ap; Ap = NULL;
-      delete [] Ai; Ai = NULL;
-      delete [] Ax; Ax = NULL;
+      if(owner)
+      {
+        delete [] Ap;
+        delete [] Ai;
+        delete [] Ax;
+      }
+      Ap = NULL;
+      Ai = NULL;
+      Ax = NULL;
+      owner = true;
       delete [] irn; irn = NULL;
       delete [] jcn; jcn = NULL;
     }
@@ -179,8 +191,13 @@ namespace Hermes
         throw Hermes::Exceptions::Exception("Sparse matrix entry not found");
       // Add offset to the n-th column.
       pos += Ap[n];
+      if(this->conflict_free_assembly)
+        Ax[pos] += v;
+      else
+      {
 #pragma omp critical (MumpsMatrix_add)
-      Ax[pos] += v;
+        Ax[pos] += v;
+      }
       irn[pos] = m + 1;  // MUMPS is indexing from 1
       jcn[pos] = n + 1;
     }
@@ -398,6 +415,30 @@ namespace Hermes
         irn[i] = ai[i];
       }
     }
+
+    template<typename Scalar>
+    void MumpsMatrix<Scalar>::create_view(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax)
+    {
+      this->free();
+      this->size = size;
+      this->nnz = nnz;
+      this->Ap = reinterpret_cast<unsigned int*>(ap);
+      this->Ai = ai;
+      // std::complex<double> has the layout of ZMUMPS_COMPLEX.
+      this->Ax = reinterpret_cast<typename mumps_type<Scalar>::mumps_Scalar*>(ax);
+      this->owner = false;
+
+      // MUMPS is indexing from 1.
+      this->irn = new int[nnz];
+      this->jcn = new int[nnz];
+      for (unsigned int col = 0; col < size; col++)
+        for (int i = ap[col]; i < ap[col + 1]; i++)
+        {
+          irn[i] = ai[i] + 1;
+          jcn[i] = col + 1;
+        }
+    }
+
     // Duplicates a matrix (including allocation).
     template<typename Scalar>
     MumpsMatrix<Scalar>* MumpsMatrix<Scalar>::duplicate()
@@ -478,16 +519,29 @@ namespace Hermes
     template<typename Scalar>
     void MumpsVector<Scalar>::add(unsigned int idx, Scalar y)
     {
-      #pragma omp critical (MumpsVector_add)
-      v[idx] += y;
+      if(this->conflict_free_assembly)
+        v[idx] += y;
+      else
+      {
+        #pragma omp critical (MumpsVector_add)
+        v[idx] += y;
+      }
     }
 
     template<typename Scalar>
     void MumpsVector<Scalar>::add(unsigned int n, unsigned int *idx, Scalar *y)
     {
-      for (unsigned int i = 0; i < n; i++)
+      if(this->conflict_free_assembly)
       {
-        v[idx[i]] += y[i];
+        for (unsigned int i = 0; i < n; i++)
+          v[idx[i]] += y[i];
+      }
+      else
+      {
+        // One lock for the whole batch.
+        #pragma omp critical (MumpsVector_add)
+        for (unsigned int i = 0; i < n; i++)
+          v[idx[i]] += y[i];
       }
     }
 
@@ -572,7 +626,9 @@ namespace Hermes
 #define JOB_END                     -2
 #define JOB_ANALYZE_FACTORIZE_SOLVE  6
 #define JOB_FACTORIZE_SOLVE          5
+#define JOB_ANALYZE_FACTORIZE        4
 #define JOB_SOLVE                    3
+#define JOB_FACTORIZE                2
 
     template<>
     void MumpsSolver<double>::mumps_c(mumps_type<double>::mumps_struct * param)
@@ -586,6 +642,48 @@ namespace Hermes
       zmumps_c(param);
     }
 
+#ifdef WITH_MUMPS_MIXED_PRECISION
+    template<>
+    void MumpsSolver<double>::mumps_c(mumps_single_type<double>::mumps_struct * param)
+    {
+      smumps_c(param);
+    }
+
+    template<>
+    void MumpsSolver<std::complex<double> >::mumps_c(mumps_single_type<std::complex<double> >::mumps_struct * param)
+    {
+      cmumps_c(param);
+    }
+
+    /// Conversions to and from the single precision entries.
+    inline void to_single(float& s, double x)
+    {
+      s = (float)x;
+    }
+
+    inline void to_single(CMUMPS_COMPLEX& s, const ZMUMPS_COMPLEX& x)
+    {
+      s.r = (float)x.r;
+      s.i = (float)x.i;
+    }
+
+    inline void to_single(CMUMPS_COMPLEX& s, const std::complex<double>& x)
+    {
+      s.r = (float)x.real();
+      s.i = (float)x.imag();
+    }
+
+    inline double from_single(float s)
+    {
+      return s;
+    }
+
+    inline std::complex<double> from_single(const CMUMPS_COMPLEX& s)
+    {
+      return std::complex<double>(s.r, s.i);
+    }
+#endif
+
     template<typename Scalar>
     bool MumpsSolver<Scalar>::check_status()
     {
@@ -651,6 +749,13 @@ namespace Hermes
       param.rhs = NULL;
       param.INFOG(33) = -999; // see the case HERMES_REUSE_MATRIX_REORDERING_AND_SCALING
       // in setup_factorization()
+
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      single_param.rhs = NULL;
+      single_Ax = NULL;
+      single_inited = false;
+      single_structure_hash = 0;
+#endif
     }
 
     template<typename Scalar>
@@ -664,6 +769,15 @@ namespace Hermes
       }
 
       if(param.rhs != NULL) delete [] param.rhs;
+
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      if(single_inited)
+      {
+        single_param.job = JOB_END;
+        mumps_c(&single_param);
+      }
+      if(single_Ax != NULL) delete [] single_Ax;
+#endif
     }
 
     template<typename Scalar>
@@ -681,6 +795,21 @@ namespace Hermes
 
       this->tick();
 
+#ifdef WITH_MUMPS_MIXED_PRECISION
+      if(this->mixed_precision)
+      {
+        if(solve_mixed_precision())
+        {
+          this->tick();
+          this->time = this->accumulated();
+          this->info("MUMPS: mixed precision solve, %d refinement steps, %s.", this->num_refinement_steps, this->last_str().c_str());
+          return true;
+        }
+        this->warn("MUMPS: the mixed precision solve did not converge, solving in double precision.");
+      }
+#endif
+      this->num_refinement_steps = -1;
+
       // Prepare the MUMPS data structure with input for the solver driver
       // (according to the chosen factorization reuse strategy), as well as
       // the system matrix.
@@ -726,6 +855,10 @@ namespace Hermes
           this->factorization_scheme == HERMES_REUSE_FACTORIZATION_COMPLETELY )
           eff_fact_scheme = HERMES_FACTORIZE_FROM_SCRATCH;
 
+      // Same pattern as the last analysis - redo only the factorization.
+      if(eff_fact_scheme == HERMES_FACTORIZE_FROM_SCRATCH)
+        eff_fact_scheme = this->check_structure(this->hash_structure(m->irn, m->nnz, m->jcn, m->nnz), inited);
+
       switch (eff_fact_scheme)
       {
       case HERMES_FACTORIZE_FROM_SCRATCH:
@@ -746,6 +879,13 @@ namespace Hermes
         param.ICNTL(8) = 7;
         param.job = JOB_FACTORIZE_SOLVE;
 
+        // The matrix may have been reallocated (with the same structure).
+        param.n = m->size;
+        param.nz = m->nnz;
+        param.irn = m->irn;
+        param.jcn = m->jcn;
+        param.a = m->Ax;
+
         break;
       case HERMES_REUSE_MATRIX_REORDERING_AND_SCALING:
         // Perform scaling along with reordering during the symbolic analysis phase
@@ -771,6 +911,151 @@ namespace Hermes
       return true;
     }
 
+#ifdef WITH_MUMPS_MIXED_PRECISION
+    template<typename Scalar>
+    void MumpsSolver<Scalar>::set_mixed_precision(bool to_set, int max_refinement_steps, double refinement_tolerance)
+    {
+      this->mixed_precision = to_set;
+      this->max_refinement_steps = max_refinement_steps;
+      this->refinement_tolerance = refinement_tolerance;
+    }
+
+    template<typename Scalar>
+    bool MumpsSolver<Scalar>::reinit_single()
+    {
+      if(single_inited)
+      {
+        single_param.job = JOB_END;
+        mumps_c(&single_param);
+      }
+
+      single_param.job = JOB_INIT;
+      single_param.par = 1;
+      single_param.sym = 0;
+      single_param.comm_fortran = USE_COMM_WORLD;
+
+      mumps_c(&single_param);
+      single_inited = (single_param.INFOG(1) == 0);
+
+      if(single_inited)
+      {
+        // No printings.
+        single_param.ICNTL(1) = -1;
+        single_param.ICNTL(2) = -1;
+        single_param.ICNTL(3) = -1;
+        single_param.ICNTL(4) = 0;
+
+        single_param.ICNTL(20) = 0;
+        single_param.ICNTL(21) = 0;
+
+        single_param.ICNTL(6) = 7;
+        single_param.ICNTL(8) = 77;
+      }
+
+      return single_inited;
+    }
+
+    template<typename Scalar>
+    bool MumpsSolver<Scalar>::solve_mixed_precision()
+    {
+      unsigned int size = m->size;
+      unsigned int nnz = m->nnz;
+
+      // Factorize the single precision copy of the matrix (keep the analysis if the structure has not changed).
+      if(!single_inited || this->factorization_scheme != HERMES_REUSE_FACTORIZATION_COMPLETELY)
+      {
+        unsigned long structure_hash = this->hash_structure(m->irn, nnz, m->jcn, nnz);
+        bool reuse_analysis = single_inited && structure_hash == single_structure_hash
+          && (this->reuse_symbolic_on_same_structure || this->factorization_scheme != HERMES_FACTORIZE_FROM_SCRATCH);
+        if(!reuse_analysis)
+        {
+          if(!reinit_single())
+            return false;
+          single_structure_hash = structure_hash;
+        }
+
+        if(single_Ax != NULL)
+          delete [] single_Ax;
+        single_Ax = new typename mumps_single_type<Scalar>::mumps_Scalar[nnz];
+        for (unsigned int i = 0; i < nnz; i++)
+          to_single(single_Ax[i], m->Ax[i]);
+
+        single_param.n = size;
+        single_param.nz = nnz;
+        single_param.irn = m->irn;
+        single_param.jcn = m->jcn;
+        single_param.a = single_Ax;
+        single_param.job = reuse_analysis ? JOB_FACTORIZE : JOB_ANALYZE_FACTORIZE;
+        mumps_c(&single_param);
+        if(single_param.INFOG(1) < 0)
+        {
+          this->warn("MUMPS: single precision factorization failed, INFOG(1) = %d.", single_param.INFOG(1));
+          // Analyze again next time.
+          reinit_single();
+          single_structure_hash = 0;
+          return false;
+        }
+      }
+
+      // Iterative refinement, the residual in double precision.
+      Scalar* b = rhs->v;
+      double b_norm = 0.;
+      for (unsigned int i = 0; i < size; i++)
+        b_norm += std::abs(b[i]) * std::abs(b[i]);
+      b_norm = std::sqrt(b_norm);
+
+      Scalar* x = new Scalar[size];
+      memset(x, 0, size * sizeof(Scalar));
+      Scalar* r = new Scalar[size];
+      memcpy(r, b, size * sizeof(Scalar));
+      typename mumps_single_type<Scalar>::mumps_Scalar* correction = new typename mumps_single_type<Scalar>::mumps_Scalar[size];
+      single_param.rhs = correction;
+
+      this->num_refinement_steps = 0;
+      bool converged = (b_norm == 0.);
+      while(!converged && this->num_refinement_steps < this->max_refinement_steps)
+      {
+        for (unsigned int i = 0; i < size; i++)
+          to_single(correction[i], r[i]);
+        single_param.job = JOB_SOLVE;
+        mumps_c(&single_param);
+        if(single_param.INFOG(1) < 0)
+          break;
+        this->num_refinement_steps++;
+
+        for (unsigned int i = 0; i < size; i++)
+          x[i] += from_single(correction[i]);
+
+        memcpy(r, b, size * sizeof(Scalar));
+        for (unsigned int k = 0; k < nnz; k++)
+          r[m->irn[k] - 1] -= mumps_to_Scalar(m->Ax[k]) * x[m->jcn[k] - 1];
+
+        double r_norm = 0.;
+        for (unsigned int i = 0; i < size; i++)
+          r_norm += std::abs(r[i]) * std::abs(r[i]);
+        r_norm = std::sqrt(r_norm);
+        // Stops on NaN as well (overflow of the single precision).
+        if(!(r_norm == r_norm))
+          break;
+        converged = (r_norm <= this->refinement_tolerance * b_norm);
+      }
+
+      single_param.rhs = NULL;
+      delete [] correction;
+      delete [] r;
+
+      if(!converged)
+      {
+        delete [] x;
+        return false;
+      }
+
+      delete [] this->sln;
+      this->sln = x;
+      return true;
+    }
+#endif
+
     template class HERMES_API MumpsSolver<double>;
     template class HERMES_API MumpsSolver<std::complex<double> >;
   }
@@ -24,8 +24,6 @@
 #include "petsc_solver.h"
 #include "callstack.h"
 
-/// \todo Check #ifdef WITH_MPI and use the parallel methods from PETSc accordingly.
-
 namespace Hermes
 {
   namespace Algebra
@@ -45,6 +43,47 @@ namespace Hermes
       delete [] py;
     }
 
+    /// With MPI and more than one process the matrices and vectors are distributed over PETSC_COMM_WORLD (MPIAIJ, MPI vectors),
+    /// every process owns a contiguous block of the rows (PETSC_DECIDE). Every process adds the entries of its own subdomain
+    /// (e.g. DiscreteProblem::set_subdomain()) to any rows, the entries of the other processes' rows are sent in finish().
+    static bool is_distributed()
+    {
+#ifdef WITH_MPI
+      int size;
+      MPI_Comm_size(PETSC_COMM_WORLD, &size);
+      return size > 1;
+#else
+      return false;
+#endif
+    }
+
+    static MPI_Comm get_petsc_comm()
+    {
+      return is_distributed() ? PETSC_COMM_WORLD : PETSC_COMM_SELF;
+    }
+
+    /// All the values of the vector x of the length size, in the distributed case gathered to every process.
+    template<typename Scalar>
+    static void gather_values(Vec x, unsigned int size, Scalar* v)
+    {
+      int *idx = new int[size];
+      for (unsigned int i = 0; i < size; i++) idx[i] = i;
+      if(is_distributed())
+      {
+        VecScatter ctx;
+        Vec all;
+        VecScatterCreateToAll(x, &ctx, &all);
+        VecScatterBegin(ctx, x, all, INSERT_VALUES, SCATTER_FORWARD);
+        VecScatterEnd(ctx, x, all, INSERT_VALUES, SCATTER_FORWARD);
+        vec_get_value(all, size, idx, v);
+        VecScatterDestroy(ctx);
+        VecDestroy(all);
+      }
+      else
+        vec_get_value(x, size, idx, v);
+      delete [] idx;
+    }
+
     int remove_petsc_object()
     {
       PetscTruth petsc_initialized, petsc_finalized;
@@ -58,8 +97,9 @@ namespace Hermes
       {
         int ierr = PetscFinalize();
         CHKERRQ(ierr);
-        this->info("PETSc finalized. No more PETSc usage allowed until application restart.");
+        Hermes::Mixins::Loggable::Static::info("PETSc finalized. No more PETSc usage allowed until application restart.");
       }
+      return 0;
     }
 
     int add_petsc_object()
@@ -80,12 +120,14 @@ namespace Hermes
       }
 
       num_petsc_objects++;
+      return 0;
     }
 
     template<typename Scalar>
     PetscMatrix<Scalar>::PetscMatrix()
     {
       inited = false;
+      values = NULL;
       add_petsc_object();
     }
 
@@ -118,13 +160,39 @@ namespace Hermes
       // stote the number of nonzeros
       nnz = pos;
       delete [] this->pages; this->pages = NULL;
-      delete [] ai;
 
-      //
-      MatCreateSeqAIJ(PETSC_COMM_SELF, this->size, this->size, 0, nnz_array, &matrix);
+      if(is_distributed())
+      {
+        // The rows of this process (the split of PETSC_DECIDE), their nonzeros in the diagonal block (the columns
+        // of this process) and outside of it. Every process knows the whole structure.
+        PetscInt local_size = PETSC_DECIDE, global_size = this->size, end = 0;
+        PetscSplitOwnership(PETSC_COMM_WORLD, &local_size, &global_size);
+        MPI_Scan(&local_size, &end, 1, MPIU_INT, MPI_SUM, PETSC_COMM_WORLD);
+        PetscInt start = end - local_size;
+        int *d_nnz = new int[local_size];
+        int *o_nnz = new int[local_size];
+        pos = 0;
+        for (int i = 0; i < start; i++)
+          pos += nnz_array[i];
+        for (int i = 0; i < local_size; i++)
+        {
+          d_nnz[i] = o_nnz[i] = 0;
+          for (int k = 0; k < nnz_array[start + i]; k++, pos++)
+            if(ai[pos] >= start && ai[pos] < end)
+              d_nnz[i]++;
+            else
+              o_nnz[i]++;
+        }
+        MatCreateMPIAIJ(PETSC_COMM_WORLD, local_size, local_size, this->size, this->size, 0, d_nnz, 0, o_nnz, &matrix);
+        delete [] d_nnz;
+        delete [] o_nnz;
+      }
+      else
+        MatCreateSeqAIJ(PETSC_COMM_SELF, this->size, this->size, 0, nnz_array, &matrix);
       //  MatSetOption(matrix, MAT_ROW_ORIENTED);
       //  MatSetOption(matrix, MAT_ROWS_SORTED);
 
+      delete [] ai;
       delete [] nnz_array;
 
       inited = true;
@@ -135,6 +203,8 @@ namespace Hermes
     {
       if(inited) MatDestroy(matrix);
       inited = false;
+      delete [] values;
+      values = NULL;
     }
 
     template<typename Scalar>
@@ -183,6 +253,7 @@ namespace Hermes
     {
       if(v != 0.0)
       {    // ignore zero values.
+        // PETSc itself is not thread-safe, the critical section stays even for a conflict-free assembly.
         #pragma omp critical (PetscMatrix_add)
           MatSetValue(matrix, (PetscInt) m, (PetscInt) n, to_petsc(v), ADD_VALUES);
       }
@@ -193,7 +264,10 @@ namespace Hermes
     template<typename Scalar>
     void PetscMatrix<Scalar>::add_to_diagonal(Scalar v)
     {
-      for (unsigned int i = 0; i<this->size; i++)
+      // Distributed - every process adds to its own rows only.
+      PetscInt start, end;
+      MatGetOwnershipRange(matrix, &start, &end);
+      for (PetscInt i = start; i < end; i++)
       {
         add(i, i, v);
       }
@@ -216,7 +290,7 @@ namespace Hermes
       switch (fmt)
       {
       case DF_MATLAB_SPARSE: //only to stdout
-        PetscViewer  viewer = PETSC_VIEWER_STDOUT_SELF;
+        PetscViewer  viewer = is_distributed() ? PETSC_VIEWER_STDOUT_WORLD : PETSC_VIEWER_STDOUT_SELF;
         PetscViewerSetFormat(viewer, PETSC_VIEWER_ASCII_MATLAB);
         MatView(matrix, viewer);
         return true;
@@ -307,13 +381,33 @@ namespace Hermes
     template<typename Scalar>
     void PetscMatrix<Scalar>::create(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax)
     {
+      free();
       this->size = size;
       this->nnz = nnz;
-      PetscScalar* pax = new PetscScalar[nnz];
+      // PETSc uses the array, it must live with the matrix.
+      values = new PetscScalar[nnz];
       for (unsigned i = 0;i<nnz;i++)
-        pax[i] = to_petsc(ax[i]);
-      MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, size, size, ap, ai, pax, &matrix);
-      delete pax;
+        values[i] = to_petsc(ax[i]);
+      MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, size, size, ap, ai, values, &matrix);
+      inited = true;
+    }
+
+    template<>
+    void PetscMatrix<double>::create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, double* ax)
+    {
+      // The indices are wrapped, the values have to be converted to the complex PetscScalar.
+      create(size, nnz, ap, aj, ax);
+    }
+
+    template<>
+    void PetscMatrix<std::complex<double> >::create_view(unsigned int size, unsigned int nnz, int* ap, int* aj, std::complex<double>* ax)
+    {
+      free();
+      this->size = size;
+      this->nnz = nnz;
+      // std::complex<double> has the layout of the complex PetscScalar.
+      MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, size, size, ap, aj, reinterpret_cast<PetscScalar*>(ax), &matrix);
+      inited = true;
     }
 
     template<typename Scalar>
@@ -345,7 +439,10 @@ namespace Hermes
     {
       free();
       this->size = n;
-      VecCreateSeq(PETSC_COMM_SELF, this->size, &vec);
+      if(is_distributed())
+        VecCreateMPI(PETSC_COMM_WORLD, PETSC_DECIDE, this->size, &vec);
+      else
+        VecCreateSeq(PETSC_COMM_SELF, this->size, &vec);
       inited = true;
     }
 
@@ -384,10 +481,7 @@ namespace Hermes
     template<typename Scalar>
     void PetscVector<Scalar>::extract(Scalar *v) const
     {
-      int *idx = new int[this->size];
-      for (unsigned int i = 0; i < this->size; i++) idx[i] = i;
-      vec_get_value(vec, this->size, idx, v);
-      delete [] idx;
+      gather_values(vec, this->size, v);
     }
 
     template<typename Scalar>
@@ -399,14 +493,7 @@ namespace Hermes
     template<typename Scalar>
     void PetscVector<Scalar>::change_sign()
     {
-      PetscScalar* y = new PetscScalar[this->size];
-      int *idx = new int[this->size];
-      for (unsigned int i = 0; i < this->size; i++) idx[i] = i;
-      VecGetValues(vec, this->size, idx, y);
-      for (unsigned int i = 0; i < this->size; i++) y[i] *= -1.;
-      VecSetValues(vec, this->size, idx, y, INSERT_VALUES);
-      delete [] y;
-      delete [] idx;
+      VecScale(vec, -1.);
     }
 
     template<typename Scalar>
@@ -425,7 +512,7 @@ namespace Hermes
     template<typename Scalar>
     void PetscVector<Scalar>::add(unsigned int n, unsigned int *idx, Scalar *y)
     {
-      PetscScalar py;
+#pragma omp critical (PetscVector_add)
       for (unsigned int i = 0; i < n; i++)
       {
         VecSetValue(vec, idx[i], to_petsc(y[i]), ADD_VALUES);
@@ -451,7 +538,7 @@ namespace Hermes
       switch (fmt)
       {
       case DF_MATLAB_SPARSE: //only to stdout
-        PetscViewer  viewer = PETSC_VIEWER_STDOUT_SELF;
+        PetscViewer  viewer = is_distributed() ? PETSC_VIEWER_STDOUT_WORLD : PETSC_VIEWER_STDOUT_SELF;
         PetscViewerSetFormat(viewer, PETSC_VIEWER_ASCII_MATLAB);
         VecView(vec, viewer);
         return true;
@@ -480,9 +567,9 @@ namespace Hermes
     }
 
     template<typename Scalar>
-    bool PetscLinearMatrixSolver<Scalar>::get_matrix_size()
+    int PetscLinearMatrixSolver<Scalar>::get_matrix_size()
     {
-      return m->size();
+      return m->size;
     }
 
     template<typename Scalar>
@@ -497,7 +584,7 @@ namespace Hermes
 
       this->tick();
 
-      KSPCreate(PETSC_COMM_WORLD, &ksp);
+      KSPCreate(get_petsc_comm(), &ksp);
 
       KSPSetOperators(ksp, m->matrix, m->matrix, DIFFERENT_NONZERO_PATTERN);
       KSPSetFromOptions(ksp);
@@ -514,13 +601,8 @@ namespace Hermes
       this->sln = new Scalar[m->size];
       memset(this->sln, 0, m->size * sizeof(Scalar));
 
-      // index map vector (basic serial code uses the map sln[i] = x[i] for all dofs.
-      int *idx = new int[m->size];
-      for (unsigned int i = 0; i < m->size; i++) idx[i] = i;
-
-      // copy solution to the output solution vector
-      vec_get_value(x, m->size, idx, this->sln);
-      delete [] idx;
+      // copy solution to the output solution vector (distributed - gathered to every process).
+      gather_values(x, m->size, this->sln);
 
       KSPDestroy(ksp);
       VecDestroy(x);
@@ -38,6 +38,7 @@ namespace Hermes
       this->prec = NULL;
       this->owner = true;
       this->mat = NULL;
+      this->rebuild = true;
 
       this->cls = cls;
       this->type = type;
@@ -49,6 +50,7 @@ namespace Hermes
       this->prec = NULL;
       this->owner = true;
       this->mat = NULL;
+      this->rebuild = true;
 
       this->cls = cls;
       this->type = type;
@@ -61,6 +63,7 @@ namespace Hermes
       this->prec = ipc;
       this->owner = false;
       this->mat = NULL;    // FIXME: take the matrix from ipc
+      this->rebuild = true;
     }
 
     template<typename Scalar>
@@ -87,12 +90,28 @@ namespace Hermes
       ilist.set(name, value);
     }
 
+    template<typename Scalar>
+    void IfpackPrecond<Scalar>::set_reuse(PrecondReuse reuse, int rebuild_every)
+    {
+      this->reuse_state.set(reuse, rebuild_every);
+    }
+
     template<typename Scalar>
     void IfpackPrecond<Scalar>::create(Matrix<Scalar> *m)
     {
       EpetraMatrix<Scalar> *mt = static_cast<EpetraMatrix<Scalar> *>(m);
       assert(mt != NULL);
       mat = mt;
+      // The structure is hashed only if it may be reused.
+      unsigned long structure_hash = (this->reuse_state.reuse == HERMES_PRECOND_REBUILD) ? 0 : mat->get_structure_hash();
+      this->rebuild = this->reuse_state.needs_rebuild(mat->mat, structure_hash) || prec == NULL;
+      if(!this->rebuild)
+        return;
+      if(owner)
+      {
+        delete prec;
+        prec = NULL;
+      }
       if(strcmp(cls, "point-relax") == 0)
       {
         create_point_relax(mat, type);
@@ -172,7 +191,8 @@ namespace Hermes
     void IfpackPrecond<Scalar>::compute()
     {
       assert(prec != NULL);
-      prec->Compute();
+      if(this->rebuild || this->reuse_state.reuse != HERMES_PRECOND_REUSE_COMPLETELY || !prec->IsComputed())
+        prec->Compute();
     }
 
     template<typename Scalar>
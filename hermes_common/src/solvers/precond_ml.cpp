@@ -29,6 +29,7 @@ namespace Hermes
       this->prec = NULL;
       this->owner = true;
       this->mat = NULL;
+      this->rebuild = true;
 
       if(strcmp(type, "sa") == 0) ML_Epetra::SetDefaults("SA", mlist);
       else if(strcmp(type, "dd") == 0) ML_Epetra::SetDefaults("DD", mlist);
@@ -40,6 +41,7 @@ namespace Hermes
       this->prec = mpc;
       this->owner = false;
       this->mat = NULL;      // FIXME: get the matrix from mpc
+      this->rebuild = true;
     }
 
     template<typename Scalar>
@@ -66,12 +68,25 @@ namespace Hermes
       mlist.set(name, value);
     }
 
+    template<typename Scalar>
+    void MlPrecond<Scalar>::set_reuse(PrecondReuse reuse, int rebuild_every)
+    {
+      this->reuse_state.set(reuse, rebuild_every);
+      // ML keeps what ReComputePreconditioner() needs only if asked before the hierarchy is built.
+      mlist.set("reuse: enable", reuse == HERMES_PRECOND_REUSE_STRUCTURE);
+    }
+
     template<typename Scalar>
     void MlPrecond<Scalar>::create(Matrix<Scalar> *m)
     {
       EpetraMatrix<Scalar> *mt = static_cast<EpetraMatrix<Scalar> *>(m);
       assert(mt != NULL);
       mat = mt;
+      // The structure is hashed only if it may be reused.
+      unsigned long structure_hash = (this->reuse_state.reuse == HERMES_PRECOND_REBUILD) ? 0 : mat->get_structure_hash();
+      this->rebuild = this->reuse_state.needs_rebuild(mat->mat, structure_hash) || prec == NULL;
+      if(!this->rebuild)
+        return;
       delete prec;
       prec = new ML_Epetra::MultiLevelPreconditioner(*mat->mat, mlist, false);
     }
@@ -81,13 +96,17 @@ namespace Hermes
     {
       assert(prec != NULL);
       prec->DestroyPreconditioner();
+      this->reuse_state.reset();
     }
 
     template<typename Scalar>
     void MlPrecond<Scalar>::compute()
     {
       assert(prec != NULL);
-      prec->ComputePreconditioner();
+      if(this->rebuild || !prec->IsPreconditionerComputed())
+        prec->ComputePreconditioner();
+      else if(this->reuse_state.reuse == HERMES_PRECOND_REUSE_STRUCTURE)
+        prec->ReComputePreconditioner();
     }
 
     template<typename Scalar>
@@ -0,0 +1,286 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file precond_saddle_point.cpp
+\brief SaddlePointPrecond class, the block preconditioner of the mixed (saddle point) systems for KrylovSolver.
+*/
+#include "precond_saddle_point.h"
+#include "callstack.h"
+
+namespace Hermes
+{
+  namespace Preconditioners
+  {
+    template<typename Scalar>
+    SaddlePointPrecond<Scalar>::SaddlePointPrecond(int num_first_block)
+      : num_first_block(num_first_block), block_diagonal(false), block_precond("ilu"), schur_approximation(NULL), mat(NULL), size(0),
+      A(NULL), S(NULL), A_solver(NULL), S_solver(NULL), work(NULL)
+    {
+      if(num_first_block < 1)
+        throw Hermes::Exceptions::ValueException("num_first_block", num_first_block, 1);
+    }
+
+    template<typename Scalar>
+    SaddlePointPrecond<Scalar>::~SaddlePointPrecond()
+    {
+      this->destroy();
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::set_block_diagonal(bool block_diagonal)
+    {
+      this->block_diagonal = block_diagonal;
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::set_block_precond(const char *name)
+    {
+      if(strcasecmp(name, "ilu") == 0 || strcasecmp(name, "ilu0") == 0)
+        this->block_precond = "ilu";
+      else if(strcasecmp(name, "block-jacobi") == 0)
+        this->block_precond = "block-jacobi";
+      else
+        throw Hermes::Exceptions::Exception("SaddlePointPrecond: unknown block preconditioner '%s' (ilu | block-jacobi).", name);
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::set_schur_approximation(CSRMatrix<Scalar>* schur_approximation)
+    {
+      this->schur_approximation = schur_approximation;
+    }
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>* SaddlePointPrecond<Scalar>::get_first_block()
+    {
+      return this->A;
+    }
+
+    template<typename Scalar>
+    CSRMatrix<Scalar>* SaddlePointPrecond<Scalar>::get_schur_complement()
+    {
+      return this->S;
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::create(Matrix<Scalar> *mat)
+    {
+      this->mat = dynamic_cast<CSRMatrix<Scalar>*>(mat);
+      if(this->mat == NULL)
+        throw Hermes::Exceptions::Exception("SaddlePointPrecond: the matrix has to be a CSRMatrix (the matrix of KrylovSolver).");
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::destroy()
+    {
+      delete A_solver;
+      A_solver = NULL;
+      delete S_solver;
+      S_solver = NULL;
+      delete A;
+      A = NULL;
+      if(S != this->schur_approximation)
+        delete S;
+      S = NULL;
+      delete [] work;
+      work = NULL;
+      C_ap.clear(); C_aj.clear(); C_ax.clear();
+      B_ap.clear(); B_aj.clear(); B_ax.clear();
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::extract_block(int row_start, int row_end, int col_start, int col_end, bool diagonal_in_structure,
+      std::vector<int>& ap, std::vector<int>& aj, std::vector<Scalar>& ax)
+    {
+      int *Ap = mat->get_Ap();
+      int *Aj = mat->get_Aj();
+      Scalar *Ax = mat->get_Ax();
+
+      ap.assign(1, 0);
+      aj.clear();
+      ax.clear();
+      for (int i = row_start; i < row_end; i++)
+      {
+        // The columns are sorted, the block is a contiguous part of the row.
+        int* first = std::lower_bound(Aj + Ap[i], Aj + Ap[i + 1], col_start);
+        int* last = std::lower_bound(first, Aj + Ap[i + 1], col_end);
+        bool diagonal_missing = diagonal_in_structure && !std::binary_search(first, last, i);
+        for (int* it = first; it != last; it++)
+        {
+          if(diagonal_missing && *it > i)
+          {
+            aj.push_back(i - col_start);
+            ax.push_back(Scalar(0));
+            diagonal_missing = false;
+          }
+          aj.push_back(*it - col_start);
+          ax.push_back(Ax[it - Aj]);
+        }
+        if(diagonal_missing)
+        {
+          aj.push_back(i - col_start);
+          ax.push_back(Scalar(0));
+        }
+        ap.push_back((int)aj.size());
+      }
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::multiply_block(int rows, const std::vector<int>& ap, const std::vector<int>& aj, const std::vector<Scalar>& ax, Scalar *x, Scalar *y)
+    {
+#pragma omp parallel for schedule(static)
+      for (int i = 0; i < rows; i++)
+      {
+        Scalar sum = Scalar(0);
+        for (int k = ap[i]; k < ap[i + 1]; k++)
+          sum += ax[k] * x[aj[k]];
+        y[i] = sum;
+      }
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::calculate_schur_complement()
+    {
+      int n1 = this->num_first_block, n2 = this->size - this->num_first_block;
+
+      // The lumped A.
+      int *A_Ap = A->get_Ap();
+      int *A_Aj = A->get_Aj();
+      Scalar *A_Ax = A->get_Ax();
+      std::vector<Scalar> inv_diagonal(n1);
+      for (int k = 0; k < n1; k++)
+      {
+        int *it = std::lower_bound(A_Aj + A_Ap[k], A_Aj + A_Ap[k + 1], k);
+        if(it == A_Aj + A_Ap[k + 1] || *it != k || A_Ax[it - A_Aj] == Scalar(0))
+          throw Hermes::Exceptions::Exception("SaddlePointPrecond: zero diagonal entry in the row %i of the first block.", k);
+        inv_diagonal[k] = Scalar(1) / A_Ax[it - A_Aj];
+      }
+
+      // D, with the diagonal in the structure.
+      std::vector<int> D_ap, D_aj;
+      std::vector<Scalar> D_ax;
+      this->extract_block(n1, this->size, n1, this->size, true, D_ap, D_aj, D_ax);
+
+      // Row by row (Gustavson), a dense accumulator over the columns of the second block.
+      std::vector<int> S_ap(1, 0), S_aj;
+      std::vector<Scalar> S_ax;
+      std::vector<Scalar> accumulator(n2, Scalar(0));
+      std::vector<int> position(n2, -1);
+      std::vector<int> columns;
+      for (int i = 0; i < n2; i++)
+      {
+        columns.clear();
+        for (int k = D_ap[i]; k < D_ap[i + 1]; k++)
+        {
+          position[D_aj[k]] = (int)columns.size();
+          columns.push_back(D_aj[k]);
+          accumulator[D_aj[k]] = D_ax[k];
+        }
+        for (int k = B_ap[i]; k < B_ap[i + 1]; k++)
+        {
+          Scalar b = B_ax[k] * inv_diagonal[B_aj[k]];
+          int c_row = B_aj[k];
+          for (int l = C_ap[c_row]; l < C_ap[c_row + 1]; l++)
+          {
+            int j = C_aj[l];
+            if(position[j] < 0)
+            {
+              position[j] = (int)columns.size();
+              columns.push_back(j);
+              accumulator[j] = Scalar(0);
+            }
+            accumulator[j] -= b * C_ax[l];
+          }
+        }
+        std::sort(columns.begin(), columns.end());
+        for (unsigned int k = 0; k < columns.size(); k++)
+        {
+          S_aj.push_back(columns[k]);
+          S_ax.push_back(accumulator[columns[k]]);
+          position[columns[k]] = -1;
+        }
+        S_ap.push_back((int)S_aj.size());
+      }
+
+      this->S = new CSRMatrix<Scalar>();
+      this->S->create(n2, S_aj.size(), &S_ap[0], S_aj.empty() ? NULL : &S_aj[0], S_ax.empty() ? NULL : &S_ax[0]);
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::compute()
+    {
+      if(this->mat == NULL)
+        throw Hermes::Exceptions::Exception("SaddlePointPrecond: create() has to be called before compute().");
+      this->destroy();
+
+      this->size = this->mat->get_size();
+      int n1 = this->num_first_block, n2 = this->size - this->num_first_block;
+      if(n2 < 1)
+        throw Hermes::Exceptions::Exception("SaddlePointPrecond: the first block (%i) has to be smaller than the matrix (%i).", n1, this->size);
+      if(this->schur_approximation != NULL && (int)this->schur_approximation->get_size() != n2)
+        throw Hermes::Exceptions::LengthException(1, this->schur_approximation->get_size(), n2);
+
+      // The blocks.
+      std::vector<int> ap, aj;
+      std::vector<Scalar> ax;
+      this->extract_block(0, n1, 0, n1, true, ap, aj, ax);
+      this->A = new CSRMatrix<Scalar>();
+      this->A->create(n1, aj.size(), &ap[0], &aj[0], &ax[0]);
+      this->extract_block(0, n1, n1, this->size, false, C_ap, C_aj, C_ax);
+      this->extract_block(n1, this->size, 0, n1, false, B_ap, B_aj, B_ax);
+
+      if(this->schur_approximation != NULL)
+        this->S = this->schur_approximation;
+      else
+        this->calculate_schur_complement();
+
+      // The preconditioners of the diagonal blocks.
+      this->A_solver = new Hermes::Solvers::KrylovSolver<Scalar>(this->A, NULL);
+      this->A_solver->set_precond(this->block_precond);
+      this->A_solver->setup_preconditioner();
+      this->S_solver = new Hermes::Solvers::KrylovSolver<Scalar>(this->S, NULL);
+      this->S_solver->set_precond(this->block_precond);
+      this->S_solver->setup_preconditioner();
+
+      this->work = new Scalar[n1];
+    }
+
+    template<typename Scalar>
+    void SaddlePointPrecond<Scalar>::apply(Scalar *r, Scalar *z)
+    {
+      int n1 = this->num_first_block;
+
+      // z_2 = S^{-1} r_2.
+      this->S_solver->apply_preconditioner(r + n1, z + n1);
+
+      // z_1 = A^{-1} (r_1 - C z_2).
+      if(this->block_diagonal)
+        memcpy(this->work, r, n1 * sizeof(Scalar));
+      else
+      {
+        multiply_block(n1, C_ap, C_aj, C_ax, z + n1, this->work);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < n1; i++)
+          this->work[i] = r[i] - this->work[i];
+      }
+      this->A_solver->apply_preconditioner(this->work, z);
+    }
+
+    template class HERMES_API SaddlePointPrecond<double>;
+    template class HERMES_API SaddlePointPrecond<std::complex<double> >;
+  }
+}
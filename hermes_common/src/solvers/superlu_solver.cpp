@@ -24,6 +24,7 @@
 #ifdef WITH_SUPERLU
 #include "superlu_solver.h"
 #include "callstack.h"
+#include "api.h"
 
 namespace Hermes
 {
@@ -120,6 +121,7 @@ namespace Hermes
       Ax = NULL;
       Ap = NULL;
       Ai = NULL;
+      owner = true;
     }
 
     template<typename Scalar>
@@ -160,9 +162,16 @@ namespace Hermes
     void SuperLUMatrix<Scalar>::free()
     {
       nnz = 0;
-      delete [] Ap; Ap = NULL;
-      delete [] Ai; Ai = NULL;
-      delete [] Ax; Ax = NULL;
+      if(owner)
+      {
+        delete [] Ap;
+        delete [] Ai;
+        delete [] Ax;
+      }
+      Ap = NULL;
+      Ai = NULL;
+      Ax = NULL;
+      owner = true;
     }
 
     template<typename Scalar>
@@ -195,8 +204,13 @@ namespace Hermes
           throw Hermes::Exceptions::Exception("Sparse matrix entry not found");
         // Add offset to the n-th column.
         pos += Ap[n];
-        #pragma omp critical (SuperLUMatrix_add)
+        if(this->conflict_free_assembly)
           Ax[pos] += v;
+        else
+        {
+          #pragma omp critical (SuperLUMatrix_add)
+            Ax[pos] += v;
+        }
       }
     }
 
@@ -368,8 +382,21 @@ namespace Hermes
         this->Ai[i] = ai[i];
       }
     }
-    // Duplicates a matrix (including allocation).
 
+    template<typename Scalar>
+    void SuperLUMatrix<Scalar>::create_view(unsigned int size, unsigned int nnz, int* ap, int* ai, Scalar* ax)
+    {
+      this->free();
+      this->size = size;
+      this->nnz = nnz;
+      // The column starts are nonnegative, so the int array is a valid unsigned one.
+      this->Ap = reinterpret_cast<unsigned int*>(ap);
+      this->Ai = ai;
+      this->Ax = ax;
+      this->owner = false;
+    }
+
+    // Duplicates a matrix (including allocation).
     template<typename Scalar>
     SuperLUMatrix<Scalar>* SuperLUMatrix<Scalar>::duplicate()
     {
@@ -573,13 +600,7 @@ namespace Hermes
 
       // Set the default input options:
 #ifdef SLU_MT
-      // I am not sure if this will work well on Windows:
-      // http://stackoverflow.com/questions/631664/accessing-environment-variables-in-c
-      char *nt_var = getenv("OMP_NUM_THREADS");
-      if(nt_var)
-        options.nprocs          = std::max(1, atoi(nt_var));
-      else
-        options.nprocs          = 1;
+      set_num_threads(HermesCommonApi.get_matrix_solver_num_threads());
 
       options.fact              = EQUILIBRATE;  // Rescale the matrix if neccessary.
       options.trans             = NOTRANS;      // Not solving the transposed problem.
@@ -645,6 +666,14 @@ namespace Hermes
       return m->size;
     }
 
+    template<typename Scalar>
+    void SuperLUSolver<Scalar>::set_num_threads(int num_threads)
+    {
+#ifdef SLU_MT
+      options.nprocs = num_threads > 0 ? num_threads : std::max(1, omp_get_max_threads());
+#endif
+    }
+
     template<typename Scalar>
     bool SuperLUSolver<Scalar>::solve()
     {
@@ -836,6 +865,10 @@ namespace Hermes
       else
         eff_fact_scheme = this->factorization_scheme;
 
+      // Same pattern as the last factorization - reuse the column permutation and the elimination tree.
+      if(eff_fact_scheme == HERMES_FACTORIZE_FROM_SCRATCH)
+        eff_fact_scheme = this->check_structure(this->hash_structure((int*)m->Ap, m->size + 1, m->Ai, m->nnz), inited);
+
       // Prepare factorization structures. In case of a particular reuse scheme, comments are given
       // to clarify which arguments will be reused and which will be reset by the dgssvx (zgssvx) routine.
       // It was determined empirically by running the dlinsolx2 example from SuperLU, setting options.Fact
@@ -893,6 +926,9 @@ namespace Hermes
         // L, U matrices may be reused without reallocating.
         // SLU_DESTROY_L(&L);
         // SLU_DESTROY_U(&U);
+
+        // New values of the matrix.
+        A_changed = true;
         break;
       case HERMES_REUSE_MATRIX_REORDERING_AND_SCALING:
         // needed from previous:      etree, perm_c, perm_r, L, U
@@ -905,6 +941,7 @@ namespace Hermes
 #else
         options.Fact = SamePattern_SameRowPerm;
 #endif
+        A_changed = true;
         break;
       case HERMES_REUSE_FACTORIZATION_COMPLETELY:
         // needed from previous:      perm_c, perm_r, equed, L, U
@@ -22,11 +22,19 @@
 #include "config.h"
 #ifdef WITH_UMFPACK
 #include "umfpack_solver.h"
+#include "vector_kernels.h"
 
 extern "C"
 {
 #include <umfpack.h>
 }
+#ifndef WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
 
 namespace Hermes
 {
@@ -59,6 +67,134 @@ namespace Hermes
       return mid;
     }
 
+    // The DF_HERMES_BIN files (version 2): a 64-byte header, then the arrays, each starting at a multiple of 64 bytes,
+    // so that a mapped file can be used as it is.
+    static const char binary_dump_version = 2;
+    static const size_t binary_dump_alignment = 64;
+
+    struct BinaryDumpHeader
+    {
+      /// "HERMESX" (matrix) or "HERMESR" (vector) and the version.
+      char magic[8];
+      int scalar_size;
+      unsigned int size;
+      /// 0 for a vector.
+      unsigned int nnz;
+      char padding[44];
+    };
+
+    // Offsets of the arrays of the given lengths (bytes), offsets[num_arrays] is the length of the file.
+    static void binary_dump_offsets(const size_t* array_bytes, int num_arrays, size_t* offsets)
+    {
+      size_t offset = sizeof(BinaryDumpHeader);
+      for (int i = 0; i < num_arrays; i++)
+      {
+        offsets[i] = (offset + binary_dump_alignment - 1) / binary_dump_alignment * binary_dump_alignment;
+        offset = offsets[i] + array_bytes[i];
+      }
+      offsets[num_arrays] = offset;
+    }
+
+    static void binary_dump_fwrite(const void* ptr, size_t bytes, FILE* file)
+    {
+      if(fwrite(ptr, 1, bytes, file) != bytes || ferror(file))
+        throw Hermes::Exceptions::Exception("Error writing to file: %s", strerror(ferror(file)));
+    }
+
+    // Writes the header and the arrays (one fwrite each, plus the padding).
+    static void write_binary_dump(FILE* file, const char* magic, int scalar_size,
+      unsigned int size, unsigned int nnz, const void** arrays, const size_t* array_bytes, int num_arrays)
+    {
+      static const char zeros[binary_dump_alignment] = { 0 };
+
+      BinaryDumpHeader header;
+      memset(&header, 0, sizeof(BinaryDumpHeader));
+      memcpy(header.magic, magic, 7);
+      header.magic[7] = binary_dump_version;
+      header.scalar_size = scalar_size;
+      header.size = size;
+      header.nnz = nnz;
+      binary_dump_fwrite(&header, sizeof(BinaryDumpHeader), file);
+
+      size_t offsets[4];
+      binary_dump_offsets(array_bytes, num_arrays, offsets);
+      size_t position = sizeof(BinaryDumpHeader);
+      for (int i = 0; i < num_arrays; i++)
+      {
+        if(offsets[i] > position)
+          binary_dump_fwrite(zeros, offsets[i] - position, file);
+        if(array_bytes[i] > 0)
+          binary_dump_fwrite(arrays[i], array_bytes[i], file);
+        position = offsets[i] + array_bytes[i];
+      }
+    }
+
+    static void release_binary_dump(char* data, size_t length)
+    {
+#ifdef WIN32
+      delete [] data;
+#else
+      munmap(data, length);
+#endif
+    }
+
+    // Maps (reads on Windows) the whole file, checks the header. The mapping is private and writable, the changes
+    // made to the loaded matrix / vector are not written back to the file.
+    static char* load_binary_dump(const char* filename, const char* magic, int scalar_size, BinaryDumpHeader& header, size_t& length)
+    {
+      char* data;
+#ifdef WIN32
+      FILE* file = fopen(filename, "rb");
+      if(file == NULL)
+        throw Hermes::Exceptions::Exception("Unable to open the file %s.", filename);
+      fseek(file, 0, SEEK_END);
+      length = ftell(file);
+      fseek(file, 0, SEEK_SET);
+      data = new char[length];
+      size_t read = fread(data, 1, length, file);
+      fclose(file);
+      if(read != length)
+      {
+        delete [] data;
+        throw Hermes::Exceptions::Exception("Error reading the file %s.", filename);
+      }
+#else
+      int fd = open(filename, O_RDONLY);
+      if(fd < 0)
+        throw Hermes::Exceptions::Exception("Unable to open the file %s.", filename);
+      struct stat file_stat;
+      if(fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+      {
+        close(fd);
+        throw Hermes::Exceptions::Exception("Unable to read the file %s.", filename);
+      }
+      length = file_stat.st_size;
+      void* mapped = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      close(fd);
+      if(mapped == MAP_FAILED)
+        throw Hermes::Exceptions::Exception("Unable to map the file %s: %s.", filename, strerror(errno));
+      data = (char*)mapped;
+#endif
+
+      const char* problem = NULL;
+      if(length < sizeof(BinaryDumpHeader) || memcmp(data, magic, 7) != 0)
+        problem = "not a Hermes binary dump of this type";
+      else
+      {
+        memcpy(&header, data, sizeof(BinaryDumpHeader));
+        if(header.magic[7] != binary_dump_version)
+          problem = "unsupported version of the Hermes binary dump";
+        else if(header.scalar_size != scalar_size)
+          problem = "the scalar type does not match";
+      }
+      if(problem != NULL)
+      {
+        release_binary_dump(data, length);
+        throw Hermes::Exceptions::Exception("Unable to load the file %s: %s.", filename, problem);
+      }
+      return data;
+    }
+
     template<typename Scalar>
     CSCMatrix<Scalar>::CSCMatrix()
     {
@@ -66,12 +202,22 @@ namespace Hermes
       Ap = NULL;
       Ai = NULL;
       Ax = NULL;
+      thread_private_entries = NULL;
+      thread_private_keys = NULL;
+      thread_private_count = 0;
+      binary_dump = NULL;
+      binary_dump_length = 0;
     }
 
     template<typename Scalar>
     CSCMatrix<Scalar>::CSCMatrix(unsigned int size)
     {
       this->size = size;
+      thread_private_entries = NULL;
+      thread_private_keys = NULL;
+      thread_private_count = 0;
+      binary_dump = NULL;
+      binary_dump_length = 0;
       this->alloc();
     }
 
@@ -127,13 +273,45 @@ namespace Hermes
       nnz = Ap[this->size];
 
       Ax = new Scalar[nnz];
-      memset(Ax, 0, sizeof(Scalar) * nnz);
+      VectorKernels::first_touch_zero((int) nnz, Ax);
+    }
+
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::create_structure(unsigned int n, int* Ap, int* Ai)
+    {
+      this->size = n;
+      nnz = Ap[n];
+
+      this->Ap = new int[n + 1];
+      memcpy(this->Ap, Ap, (n + 1) * sizeof(int));
+      this->Ai = new int[nnz];
+      memcpy(this->Ai, Ai, nnz * sizeof(int));
+
+      Ax = new Scalar[nnz];
+      VectorKernels::first_touch_zero((int) nnz, Ax);
     }
 
     template<typename Scalar>
     void CSCMatrix<Scalar>::free()
     {
+      if(thread_private_entries != NULL)
+      {
+        delete [] thread_private_entries;
+        delete [] thread_private_keys;
+        thread_private_entries = NULL;
+        thread_private_keys = NULL;
+        thread_private_count = 0;
+      }
       nnz = 0;
+      if(binary_dump != NULL)
+      {
+        release_binary_dump(binary_dump, binary_dump_length);
+        binary_dump = NULL;
+        binary_dump_length = 0;
+        Ap = NULL;
+        Ai = NULL;
+        Ax = NULL;
+      }
       if(Ap != NULL)
       {
         delete [] Ap;
@@ -166,7 +344,50 @@ namespace Hermes
     template<typename Scalar>
     void CSCMatrix<Scalar>::zero()
     {
-      memset(Ax, 0, sizeof(Scalar) * nnz);
+      VectorKernels::zero((int) nnz, Ax);
+    }
+
+    template<>
+    void CSCMatrix<double>::add_to_position(int position, double v)
+    {
+      if(thread_private_entries != NULL)
+      {
+        int thread_number = omp_get_thread_num();
+        ThreadPrivateEntry entry;
+        entry.position = position;
+        entry.key = thread_private_keys[thread_number];
+        entry.value = v;
+        thread_private_entries[thread_number].push_back(entry);
+        return;
+      }
+
+      if(this->conflict_free_assembly)
+        Ax[position] += v;
+      else
+      {
+#pragma omp atomic
+        Ax[position] += v;
+      }
+    }
+
+    template<>
+    void CSCMatrix<std::complex<double> >::add_to_position(int position, std::complex<double> v)
+    {
+      if(thread_private_entries != NULL)
+      {
+        int thread_number = omp_get_thread_num();
+        ThreadPrivateEntry entry;
+        entry.position = position;
+        entry.key = thread_private_keys[thread_number];
+        entry.value = v;
+        thread_private_entries[thread_number].push_back(entry);
+        return;
+      }
+
+      if(this->conflict_free_assembly)
+        Ax[position] += v;
+      else
+        VectorKernels::atomic_add(Ax + position, v);
     }
 
     template<>
@@ -183,8 +404,7 @@ namespace Hermes
           throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", m, n);
         }
 
-#pragma omp atomic
-        Ax[Ap[n] + pos] += v;
+        add_to_position(Ap[n] + pos, v);
       }
     }
 
@@ -202,11 +422,98 @@ namespace Hermes
           throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", m, n);
         }
 
-#pragma omp critical
-        Ax[Ap[n] + pos] += v;
+        add_to_position(Ap[n] + pos, v);
       }
     }
 
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::begin_thread_private_assembly(int num_threads)
+    {
+      if(num_threads < 1)
+        throw Exceptions::ValueException("num_threads", num_threads, 1);
+
+      if(thread_private_entries != NULL)
+        finish_thread_private_assembly();
+
+      thread_private_count = num_threads;
+      thread_private_entries = new Hermes::vector<ThreadPrivateEntry>[num_threads];
+      thread_private_keys = new int[num_threads];
+      memset(thread_private_keys, 0, num_threads * sizeof(int));
+    }
+
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::set_assembly_key(int key)
+    {
+      if(thread_private_entries != NULL)
+        thread_private_keys[omp_get_thread_num()] = key;
+    }
+
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::finish()
+    {
+      if(thread_private_entries != NULL)
+        finish_thread_private_assembly();
+    }
+
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::finish_thread_private_assembly()
+    {
+      // Gather all entries, in the order of threads.
+      int entries_count = 0;
+      int max_key = 0;
+      for(int thread_i = 0; thread_i < thread_private_count; thread_i++)
+      {
+        entries_count += thread_private_entries[thread_i].size();
+        for(unsigned int entry_i = 0; entry_i < thread_private_entries[thread_i].size(); entry_i++)
+          if(thread_private_entries[thread_i][entry_i].key > max_key)
+            max_key = thread_private_entries[thread_i][entry_i].key;
+      }
+
+      ThreadPrivateEntry* entries = new ThreadPrivateEntry[entries_count];
+      ThreadPrivateEntry* sorted_entries = new ThreadPrivateEntry[entries_count];
+      int running_index = 0;
+      for(int thread_i = 0; thread_i < thread_private_count; thread_i++)
+      {
+        for(unsigned int entry_i = 0; entry_i < thread_private_entries[thread_i].size(); entry_i++)
+          entries[running_index++] = thread_private_entries[thread_i][entry_i];
+        thread_private_entries[thread_i].clear();
+      }
+
+      // Two stable counting sorts - by the key, then by the position.
+      // Entries with the same key come from one thread, so their order of insertion is preserved,
+      // and the summation order per position does not depend on the distribution of keys among threads.
+      int* counts = new int[std::max(max_key + 1, (int)nnz) + 1];
+
+      memset(counts, 0, (max_key + 2) * sizeof(int));
+      for(int entry_i = 0; entry_i < entries_count; entry_i++)
+        counts[entries[entry_i].key + 1]++;
+      for(int key_i = 0; key_i < max_key + 1; key_i++)
+        counts[key_i + 1] += counts[key_i];
+      for(int entry_i = 0; entry_i < entries_count; entry_i++)
+        sorted_entries[counts[entries[entry_i].key]++] = entries[entry_i];
+
+      memset(counts, 0, (nnz + 1) * sizeof(int));
+      for(int entry_i = 0; entry_i < entries_count; entry_i++)
+        counts[sorted_entries[entry_i].position + 1]++;
+      for(unsigned int position_i = 0; position_i < nnz; position_i++)
+        counts[position_i + 1] += counts[position_i];
+      for(int entry_i = 0; entry_i < entries_count; entry_i++)
+        entries[counts[sorted_entries[entry_i].position]++] = sorted_entries[entry_i];
+
+      for(int entry_i = 0; entry_i < entries_count; entry_i++)
+        Ax[entries[entry_i].position] += entries[entry_i].value;
+
+      delete [] counts;
+      delete [] entries;
+      delete [] sorted_entries;
+
+      delete [] thread_private_entries;
+      delete [] thread_private_keys;
+      thread_private_entries = NULL;
+      thread_private_keys = NULL;
+      thread_private_count = 0;
+    }
+
     template<typename Scalar>
     void CSCMatrix<Scalar>::add_to_diagonal_blocks(int num_stages, CSCMatrix<Scalar>* mat_block)
     {
@@ -226,6 +533,25 @@ namespace Hermes
       add_to_diagonal_blocks(num_stages, static_cast<CSCMatrix<Scalar>*>(mat));
     }
 
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::add_sparse_matrix(SparseMatrix<Scalar>* mat)
+    {
+      CSCMatrix<Scalar>* csc_mat = dynamic_cast<CSCMatrix<Scalar>*>(mat);
+      if(csc_mat == NULL)
+        throw Hermes::Exceptions::Exception("CSCMatrix<Scalar>::add_sparse_matrix() needs a CSCMatrix.");
+
+      // The same sparse structure (e.g. a duplicate()): entry by entry.
+      if(csc_mat->size == this->size && csc_mat->nnz == this->nnz
+        && !memcmp(csc_mat->Ap, this->Ap, (this->size + 1) * sizeof(int)) && !memcmp(csc_mat->Ai, this->Ai, this->nnz * sizeof(int)))
+      {
+        for(unsigned int i = 0; i < this->nnz; i++)
+          this->Ax[i] += csc_mat->Ax[i];
+        return;
+      }
+
+      add_matrix(csc_mat);
+    }
+
     template<typename Scalar>
     unsigned int CSCMatrix<Scalar>::get_nnz() const
     {
@@ -318,6 +644,35 @@ namespace Hermes
             add(rows[i], cols[j], mat[i][j]);
     }
 
+    template<typename Scalar>
+    bool CSCMatrix<Scalar>::get_positions(unsigned int m, unsigned int n, int *rows, int *cols, int *positions)
+    {
+      for (unsigned int i = 0; i < m; i++)       // rows
+      {
+        for (unsigned int j = 0; j < n; j++)     // cols
+        {
+          positions[i * n + j] = -1;
+          if(rows[i] < 0 || cols[j] < 0) // Dir. dofs.
+            continue;
+
+          int pos = find_position(Ai + Ap[cols[j]], Ap[cols[j] + 1] - Ap[cols[j]], rows[i]);
+          if(pos < 0)
+            throw Hermes::Exceptions::Exception("Sparse matrix entry not found: [%i, %i]", rows[i], cols[j]);
+          positions[i * n + j] = Ap[cols[j]] + pos;
+        }
+      }
+      return true;
+    }
+
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::add_at_positions(unsigned int m, unsigned int n, Scalar **mat, int *positions)
+    {
+      for (unsigned int i = 0; i < m; i++)       // rows
+        for (unsigned int j = 0; j < n; j++)     // cols
+          if(positions[i * n + j] >= 0 && mat[i][j] != 0.0)
+            add_to_position(positions[i * n + j], mat[i][j]);
+    }
+
     double inline real(double x)
     {
       return x;
@@ -382,14 +737,9 @@ namespace Hermes
 
       case DF_HERMES_BIN:
         {
-          hermes_fwrite("HERMESX\001", 1, 8, file);
-          int ssize = sizeof(double);
-          hermes_fwrite(&ssize, sizeof(int), 1, file);
-          hermes_fwrite(&this->size, sizeof(int), 1, file);
-          hermes_fwrite(&nnz, sizeof(int), 1, file);
-          hermes_fwrite(Ap, sizeof(int), this->size + 1, file);
-          hermes_fwrite(Ai, sizeof(int), nnz, file);
-          hermes_fwrite(Ax, sizeof(double), nnz, file);
+          const void* arrays[3] = { Ap, Ai, Ax };
+          size_t array_bytes[3] = { (this->size + 1) * sizeof(int), nnz * sizeof(int), nnz * sizeof(double) };
+          write_binary_dump(file, "HERMESX", sizeof(double), this->size, nnz, arrays, array_bytes, 3);
           return true;
         }
 
@@ -487,14 +837,9 @@ namespace Hermes
 
       case DF_HERMES_BIN:
         {
-          hermes_fwrite("HERMESX\001", 1, 8, file);
-          int ssize = sizeof(std::complex<double>);
-          hermes_fwrite(&ssize, sizeof(int), 1, file);
-          hermes_fwrite(&this->size, sizeof(int), 1, file);
-          hermes_fwrite(&nnz, sizeof(int), 1, file);
-          hermes_fwrite(Ap, sizeof(int), this->size + 1, file);
-          hermes_fwrite(Ai, sizeof(int), nnz, file);
-          hermes_fwrite(Ax, sizeof(std::complex<double>), nnz, file);
+          const void* arrays[3] = { Ap, Ai, Ax };
+          size_t array_bytes[3] = { (this->size + 1) * sizeof(int), nnz * sizeof(int), nnz * sizeof(std::complex<double>) };
+          write_binary_dump(file, "HERMESX", sizeof(std::complex<double>), this->size, nnz, arrays, array_bytes, 3);
           return true;
         }
 
@@ -576,6 +921,32 @@ namespace Hermes
       }
     }
 
+    template<typename Scalar>
+    void CSCMatrix<Scalar>::load(const char* filename)
+    {
+      free();
+      BinaryDumpHeader header;
+      size_t length;
+      char* data = load_binary_dump(filename, "HERMESX", sizeof(Scalar), header, length);
+
+      size_t offsets[4];
+      size_t array_bytes[3] = { (header.size + 1) * sizeof(int), header.nnz * sizeof(int), header.nnz * sizeof(Scalar) };
+      binary_dump_offsets(array_bytes, 3, offsets);
+      if(length < offsets[3])
+      {
+        release_binary_dump(data, length);
+        throw Hermes::Exceptions::Exception("Unable to load the file %s: the file is truncated.", filename);
+      }
+
+      this->size = header.size;
+      this->nnz = header.nnz;
+      this->Ap = (int*)(data + offsets[0]);
+      this->Ai = (int*)(data + offsets[1]);
+      this->Ax = (Scalar*)(data + offsets[2]);
+      this->binary_dump = data;
+      this->binary_dump_length = length;
+    }
+
     template<typename Scalar>
     CSCMatrix<Scalar>* CSCMatrix<Scalar>::duplicate()
     {
@@ -606,6 +977,11 @@ namespace Hermes
     UMFPackVector<Scalar>::UMFPackVector()
     {
       v = NULL;
+      thread_v = NULL;
+      thread_v_used = NULL;
+      num_thread_buffers = 0;
+      binary_dump = NULL;
+      binary_dump_length = 0;
       this->size = 0;
     }
 
@@ -613,6 +989,11 @@ namespace Hermes
     UMFPackVector<Scalar>::UMFPackVector(unsigned int size)
     {
       v = NULL;
+      thread_v = NULL;
+      thread_v_used = NULL;
+      num_thread_buffers = 0;
+      binary_dump = NULL;
+      binary_dump_length = 0;
       this->size = size;
       this->alloc(size);
     }
@@ -629,54 +1010,196 @@ namespace Hermes
       free();
       this->size = n;
       v = new Scalar[n];
-      this->zero();
+      alloc_thread_buffers();
+      VectorKernels::first_touch_zero((int) n, v);
+    }
+
+    template<typename Scalar>
+    void UMFPackVector<Scalar>::alloc_thread_buffers()
+    {
+      num_thread_buffers = omp_get_max_threads();
+      thread_v = new Scalar*[num_thread_buffers];
+      thread_v_used = new bool[num_thread_buffers];
+      for (int i = 0; i < num_thread_buffers; i++)
+      {
+        thread_v[i] = NULL;
+        thread_v_used[i] = false;
+      }
+    }
+
+    template<typename Scalar>
+    void UMFPackVector<Scalar>::load(const char* filename)
+    {
+      free();
+      BinaryDumpHeader header;
+      size_t length;
+      char* data = load_binary_dump(filename, "HERMESR", sizeof(Scalar), header, length);
+
+      size_t offsets[2];
+      size_t array_bytes[1] = { header.size * sizeof(Scalar) };
+      binary_dump_offsets(array_bytes, 1, offsets);
+      if(length < offsets[1])
+      {
+        release_binary_dump(data, length);
+        throw Hermes::Exceptions::Exception("Unable to load the file %s: the file is truncated.", filename);
+      }
+
+      this->size = header.size;
+      this->v = (Scalar*)(data + offsets[0]);
+      this->binary_dump = data;
+      this->binary_dump_length = length;
+      alloc_thread_buffers();
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::zero()
     {
-      memset(v, 0, this->size * sizeof(Scalar));
+      VectorKernels::zero((int) this->size, v);
+      for (int i = 0; i < num_thread_buffers; i++)
+        if(thread_v_used[i])
+        {
+          memset(thread_v[i], 0, this->size * sizeof(Scalar));
+          thread_v_used[i] = false;
+        }
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::change_sign()
     {
-      for (unsigned int i = 0; i < this->size; i++) v[i] *= -1.;
+      reduce_thread_buffers();
+      VectorKernels::scale(this->size, Scalar(-1.), v);
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::free()
     {
-      delete [] v;
+      if(binary_dump != NULL)
+      {
+        release_binary_dump(binary_dump, binary_dump_length);
+        binary_dump = NULL;
+        binary_dump_length = 0;
+      }
+      else
+        delete [] v;
       v = NULL;
+      for (int i = 0; i < num_thread_buffers; i++)
+        delete [] thread_v[i];
+      delete [] thread_v;
+      thread_v = NULL;
+      delete [] thread_v_used;
+      thread_v_used = NULL;
+      num_thread_buffers = 0;
       this->size = 0;
     }
 
+    template<typename Scalar>
+    void UMFPackVector<Scalar>::finish()
+    {
+      reduce_thread_buffers();
+    }
+
+    template<typename Scalar>
+    Scalar* UMFPackVector<Scalar>::get_thread_buffer()
+    {
+      if(omp_get_num_threads() == 1)
+        return NULL;
+      int thread = omp_get_thread_num();
+      if(thread >= num_thread_buffers)
+        return NULL;
+      // Only the thread itself touches its slot.
+      if(thread_v[thread] == NULL)
+      {
+        thread_v[thread] = new Scalar[this->size];
+        memset(thread_v[thread], 0, this->size * sizeof(Scalar));
+      }
+      if(!thread_v_used[thread])
+        thread_v_used[thread] = true;
+      return thread_v[thread];
+    }
+
+    template<typename Scalar>
+    void UMFPackVector<Scalar>::reduce_thread_buffers()
+    {
+      std::vector<Scalar*> used;
+      for (int i = 0; i < num_thread_buffers; i++)
+        if(thread_v_used[i])
+        {
+          used.push_back(thread_v[i]);
+          thread_v_used[i] = false;
+        }
+      if(used.empty())
+        return;
+
+      int size = this->size;
+      int num_used = used.size();
+#pragma omp parallel for schedule(static)
+      for (int i = 0; i < size; i++)
+      {
+        for (int j = 0; j < num_used; j++)
+        {
+          v[i] += used[j][i];
+          used[j][i] = 0.;
+        }
+      }
+    }
+
     template<typename Scalar>
     void UMFPackVector<Scalar>::set(unsigned int idx, Scalar y)
     {
+      reduce_thread_buffers();
       v[idx] = y;
     }
 
     template<>
     void UMFPackVector<double>::add(unsigned int idx, double y)
     {
+      if(this->conflict_free_assembly)
+        v[idx] += y;
+      else
+      {
+        double* buffer = get_thread_buffer();
+        if(buffer != NULL)
+          buffer[idx] += y;
+        else
+        {
 #pragma omp atomic
-      v[idx] += y;
+          v[idx] += y;
+        }
+      }
     }
 
     template<>
     void UMFPackVector<std::complex<double> >::add(unsigned int idx, std::complex<double> y)
     {
-#pragma omp critical(UMFPackVector_add)
-      v[idx] += y;
+      if(this->conflict_free_assembly)
+        v[idx] += y;
+      else
+      {
+        std::complex<double>* buffer = get_thread_buffer();
+        if(buffer != NULL)
+          buffer[idx] += y;
+        else
+          VectorKernels::atomic_add(v + idx, y);
+      }
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::add(unsigned int n, unsigned int *idx, Scalar *y)
     {
+      Scalar* target = v;
+      if(!this->conflict_free_assembly && omp_get_num_threads() > 1)
+      {
+        target = get_thread_buffer();
+        // A thread without a buffer synchronizes every entry.
+        if(target == NULL)
+        {
+          for (unsigned int i = 0; i < n; i++)
+            this->add(idx[i], y[i]);
+          return;
+        }
+      }
       for (unsigned int i = 0; i < n; i++)
-        v[idx[i]] += y[i];
+        target[idx[i]] += y[i];
     }
 
     template<typename Scalar>
@@ -689,30 +1212,41 @@ namespace Hermes
     void UMFPackVector<Scalar>::extract(Scalar *v) const
     {
       memcpy(v, this->v, this->size * sizeof(Scalar));
+      for (int i = 0; i < num_thread_buffers; i++)
+        if(thread_v_used[i])
+          for (unsigned int j = 0; j < this->size; j++)
+            v[j] += thread_v[i][j];
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::add_vector(Vector<Scalar>* vec)
     {
       assert(this->length() == vec->length());
-      for (unsigned int i = 0; i < this->length(); i++) this->v[i] += vec->get(i);
+      reduce_thread_buffers();
+      Scalar* values = new Scalar[this->length()];
+      vec->extract(values);
+      VectorKernels::axpy(this->length(), Scalar(1.), values, this->v);
+      delete [] values;
     }
 
     template<typename Scalar>
     void UMFPackVector<Scalar>::add_vector(Scalar* vec)
     {
-      for (unsigned int i = 0; i < this->length(); i++) this->v[i] += vec[i];
+      reduce_thread_buffers();
+      VectorKernels::axpy(this->length(), Scalar(1.), vec, this->v);
     }
 
     template<typename Scalar>
     Scalar *UMFPackVector<Scalar>::get_c_array()
     {
+      reduce_thread_buffers();
       return this->v;
     }
 
     template<>
     bool UMFPackVector<double>::dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt, char* number_format)
     {
+      reduce_thread_buffers();
       switch (fmt)
       {
       case DF_MATLAB_SPARSE:
@@ -727,11 +1261,9 @@ namespace Hermes
 
       case DF_HERMES_BIN:
         {
-          hermes_fwrite("HERMESR\001", 1, 8, file);
-          int ssize = sizeof(double);
-          hermes_fwrite(&ssize, sizeof(int), 1, file);
-          hermes_fwrite(&this->size, sizeof(int), 1, file);
-          hermes_fwrite(v, sizeof(double), this->size, file);
+          const void* arrays[1] = { v };
+          size_t array_bytes[1] = { this->size * sizeof(double) };
+          write_binary_dump(file, "HERMESR", sizeof(double), this->size, 0, arrays, array_bytes, 1);
           return true;
         }
 
@@ -755,6 +1287,7 @@ namespace Hermes
     template<>
     bool UMFPackVector<std::complex<double> >::dump(FILE *file, const char *var_name, EMatrixDumpFormat fmt, char* number_format)
     {
+      reduce_thread_buffers();
       switch (fmt)
       {
       case DF_MATLAB_SPARSE:
@@ -769,11 +1302,9 @@ namespace Hermes
 
       case DF_HERMES_BIN:
         {
-          hermes_fwrite("HERMESR\001", 1, 8, file);
-          int ssize = sizeof(std::complex<double>);
-          hermes_fwrite(&ssize, sizeof(int), 1, file);
-          hermes_fwrite(&this->size, sizeof(int), 1, file);
-          hermes_fwrite(v, sizeof(std::complex<double>), this->size, file);
+          const void* arrays[1] = { v };
+          size_t array_bytes[1] = { this->size * sizeof(std::complex<double>) };
+          write_binary_dump(file, "HERMESR", sizeof(std::complex<double>), this->size, 0, arrays, array_bytes, 1);
           return true;
         }
 
@@ -874,6 +1405,10 @@ namespace Hermes
       else
         eff_fact_scheme = factorization_scheme;
 
+      // Same pattern as the last symbolic analysis - redo only the numeric factorization.
+      if(eff_fact_scheme == HERMES_FACTORIZE_FROM_SCRATCH)
+        eff_fact_scheme = this->check_structure(this->hash_structure(m->get_Ap(), m->get_size() + 1, m->get_Ai(), m->get_nnz()), symbolic != NULL);
+
       int status;
       switch(eff_fact_scheme)
       {
@@ -936,6 +1471,10 @@ namespace Hermes
       else
         eff_fact_scheme = factorization_scheme;
 
+      // Same pattern as the last symbolic analysis - redo only the numeric factorization.
+      if(eff_fact_scheme == HERMES_FACTORIZE_FROM_SCRATCH)
+        eff_fact_scheme = this->check_structure(this->hash_structure(m->get_Ap(), m->get_size() + 1, m->get_Ai(), m->get_nnz()), symbolic != NULL);
+
       int status;
       switch(eff_fact_scheme)
       {
@@ -1048,6 +1587,67 @@ namespace Hermes
       return true;
     }
 
+    template<>
+    bool UMFPackLinearMatrixSolver<double>::solve_transposed()
+    {
+      assert(m != NULL);
+      assert(rhs != NULL);
+      assert(m->get_size() == rhs->length());
+
+      this->tick();
+
+      if(numeric == NULL && !setup_factorization())
+        throw Exceptions::LinearMatrixSolverException("LU factorization could not be completed.");
+
+      if(sln != NULL)
+        delete [] sln;
+      sln = new double[m->get_size()];
+      memset(sln, 0, m->get_size() * sizeof(double));
+      int status = umfpack_di_solve(UMFPACK_At, m->get_Ap(), m->get_Ai(), m->get_Ax(), sln, rhs->get_c_array(), numeric, NULL, NULL);
+      if(status != UMFPACK_OK)
+      {
+        check_status("umfpack_di_solve", status);
+        return false;
+      }
+
+      this->tick();
+      time = this->accumulated();
+
+      return true;
+    }
+
+    template<>
+    bool UMFPackLinearMatrixSolver<std::complex<double> >::solve_transposed()
+    {
+      assert(m != NULL);
+      assert(rhs != NULL);
+      assert(m->get_size() == rhs->length());
+
+      this->tick();
+      if(numeric == NULL && !setup_factorization())
+      {
+        this->warn("LU factorization could not be completed.");
+        return false;
+      }
+
+      if(sln)
+        delete [] sln;
+      sln = new std::complex<double>[m->get_size()];
+      memset(sln, 0, m->get_size() * sizeof(std::complex<double>));
+      // UMFPACK_Aat is the array transpose (without the complex conjugation).
+      int status = umfpack_zi_solve(UMFPACK_Aat, m->get_Ap(), m->get_Ai(), (double *)m->get_Ax(), NULL, (double*) sln, NULL, (double *)rhs->get_c_array(), NULL, numeric, NULL, NULL);
+      if(status != UMFPACK_OK)
+      {
+        check_status("umfpack_zi_solve", status);
+        return false;
+      }
+
+      this->tick();
+      time = this->accumulated();
+
+      return true;
+    }
+
     template<typename Scalar>
     void UMFPackLinearMatrixSolver<Scalar>::check_status(const char *fn_name, int status)
     {
@@ -0,0 +1,284 @@
+// This file is part of HermesCommon
+//
+// Copyright (c) 2009 hp-FEM group at the University of Nevada, Reno (UNR).
+// Email: hpfem-group@unr.edu, home page: http://hpfem.org/.
+//
+// Hermes2D is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published
+// by the Free Software Foundation; either version 2 of the License,
+// or (at your option) any later version.
+//
+// Hermes2D is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with Hermes2D; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+/*! \file vector_kernels.cpp
+\brief BLAS-1 operations on the coefficient arrays and vectors.
+*/
+#include "vector_kernels.h"
+#include "matrix.h"
+#include "api.h"
+#ifdef WITH_NUMA
+#include <numa.h>
+#endif
+
+namespace Hermes
+{
+  namespace Algebra
+  {
+    namespace VectorKernels
+    {
+      static inline double abs2(double x) { return x * x; }
+      static inline double abs2(std::complex<double> x) { return x.real() * x.real() + x.imag() * x.imag(); }
+      // The product of the parts, without the recovery of the infinite / NaN results of the complex multiplication
+      // (a library call per element), so that the complex loops vectorize as the real ones.
+      static inline double multiply(double a, double x) { return a * x; }
+      static inline std::complex<double> multiply(std::complex<double> a, std::complex<double> x)
+      {
+        return std::complex<double>(a.real() * x.real() - a.imag() * x.imag(), a.real() * x.imag() + a.imag() * x.real());
+      }
+
+      template<typename Scalar>
+      void copy(int n, const Scalar* x, Scalar* y)
+      {
+        if(n < parallel_threshold)
+        {
+          memcpy(y, x, n * sizeof(Scalar));
+          return;
+        }
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < n; i++)
+          y[i] = x[i];
+      }
+
+      template<typename Scalar>
+      void zero(int n, Scalar* x)
+      {
+        if(n < parallel_threshold)
+        {
+          memset(x, 0, n * sizeof(Scalar));
+          return;
+        }
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < n; i++)
+          x[i] = Scalar(0);
+      }
+
+      template<typename Scalar>
+      void first_touch_zero(int n, Scalar* x)
+      {
+#ifdef WITH_NUMA
+        if(HermesCommonApi.get_numa_placement() == HERMES_NUMA_INTERLEAVED && numa_available() != -1)
+          numa_interleave_memory(x, n * sizeof(Scalar), numa_all_nodes_ptr);
+#endif
+        int num_threads = HermesCommonApi.get_matrix_solver_num_threads();
+        if(num_threads <= 0)
+          num_threads = omp_get_max_threads();
+        if(n < parallel_threshold || num_threads == 1)
+        {
+          memset(x, 0, n * sizeof(Scalar));
+          return;
+        }
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int i = 0; i < n; i++)
+          x[i] = Scalar(0);
+      }
+
+      template<typename Scalar>
+      void scale(int n, Scalar a, Scalar* x)
+      {
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+        for (int i = 0; i < n; i++)
+          x[i] = multiply(a, x[i]);
+      }
+
+      template<typename Scalar>
+      void axpy(int n, Scalar a, const Scalar* x, Scalar* y)
+      {
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+        for (int i = 0; i < n; i++)
+          y[i] += multiply(a, x[i]);
+      }
+
+      template<typename Scalar>
+      void axpby(int n, Scalar a, const Scalar* x, Scalar b, Scalar* y)
+      {
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+        for (int i = 0; i < n; i++)
+          y[i] = multiply(a, x[i]) + multiply(b, y[i]);
+      }
+
+      template<typename Scalar>
+      void waxpy(int n, Scalar a, const Scalar* x, const Scalar* y, Scalar* w)
+      {
+#pragma omp parallel for schedule(static) if(n >= parallel_threshold)
+        for (int i = 0; i < n; i++)
+          w[i] = multiply(a, x[i]) + y[i];
+      }
+
+      // The reductions are summed chunk by chunk (parallel_threshold entries each, the chunks split among the threads)
+      // and the partial sums of the chunks pairwise - the result does not depend on the number of threads.
+      static inline int num_chunks(int n) { return (n + parallel_threshold - 1) / parallel_threshold; }
+
+      double dot(int n, const double* x, const double* y)
+      {
+        int chunks = num_chunks(n);
+        if(chunks <= 1)
+        {
+          double result = 0.0;
+          for (int i = 0; i < n; i++)
+            result += x[i] * y[i];
+          return result;
+        }
+        double* partial = new double[chunks];
+#pragma omp parallel for schedule(static)
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+          double result = 0.0;
+          int end = std::min(n, (chunk + 1) * parallel_threshold);
+          for (int i = chunk * parallel_threshold; i < end; i++)
+            result += x[i] * y[i];
+          partial[chunk] = result;
+        }
+        double result = pairwise_sum(chunks, partial);
+        delete [] partial;
+        return result;
+      }
+
+      std::complex<double> dot(int n, const std::complex<double>* x, const std::complex<double>* y)
+      {
+        int chunks = num_chunks(n);
+        if(chunks <= 1)
+        {
+          double re = 0.0, im = 0.0;
+          for (int i = 0; i < n; i++)
+          {
+            re += x[i].real() * y[i].real() + x[i].imag() * y[i].imag();
+            im += x[i].real() * y[i].imag() - x[i].imag() * y[i].real();
+          }
+          return std::complex<double>(re, im);
+        }
+        // The real and imaginary parts interleaved in the partial sums.
+        double* partial = new double[2 * chunks];
+#pragma omp parallel for schedule(static)
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+          double re = 0.0, im = 0.0;
+          int end = std::min(n, (chunk + 1) * parallel_threshold);
+          for (int i = chunk * parallel_threshold; i < end; i++)
+          {
+            re += x[i].real() * y[i].real() + x[i].imag() * y[i].imag();
+            im += x[i].real() * y[i].imag() - x[i].imag() * y[i].real();
+          }
+          partial[2 * chunk] = re;
+          partial[2 * chunk + 1] = im;
+        }
+        std::complex<double> result(pairwise_sum(chunks, partial, 2), pairwise_sum(chunks, partial + 1, 2));
+        delete [] partial;
+        return result;
+      }
+
+      template<typename Scalar>
+      double nrm2(int n, const Scalar* x)
+      {
+        int chunks = num_chunks(n);
+        if(chunks <= 1)
+        {
+          double result = 0.0;
+          for (int i = 0; i < n; i++)
+            result += abs2(x[i]);
+          return std::sqrt(result);
+        }
+        double* partial = new double[chunks];
+#pragma omp parallel for schedule(static)
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+          double result = 0.0;
+          int end = std::min(n, (chunk + 1) * parallel_threshold);
+          for (int i = chunk * parallel_threshold; i < end; i++)
+            result += abs2(x[i]);
+          partial[chunk] = result;
+        }
+        double result = pairwise_sum(chunks, partial);
+        delete [] partial;
+        return std::sqrt(result);
+      }
+
+      template<typename Scalar>
+      double diff_nrm2(int n, const Scalar* x, const Scalar* y)
+      {
+        int chunks = num_chunks(n);
+        if(chunks <= 1)
+        {
+          double result = 0.0;
+          for (int i = 0; i < n; i++)
+            result += abs2(x[i] - y[i]);
+          return std::sqrt(result);
+        }
+        double* partial = new double[chunks];
+#pragma omp parallel for schedule(static)
+        for (int chunk = 0; chunk < chunks; chunk++)
+        {
+          double result = 0.0;
+          int end = std::min(n, (chunk + 1) * parallel_threshold);
+          for (int i = chunk * parallel_threshold; i < end; i++)
+            result += abs2(x[i] - y[i]);
+          partial[chunk] = result;
+        }
+        double result = pairwise_sum(chunks, partial);
+        delete [] partial;
+        return std::sqrt(result);
+      }
+
+      template<typename Scalar>
+      double nrm2(Vector<Scalar>* vec)
+      {
+        int n = vec->length();
+        Scalar* values = new Scalar[n];
+        vec->extract(values);
+        double result = nrm2(n, values);
+        delete [] values;
+        return result;
+      }
+
+      double pairwise_sum(int n, const double* x, int stride)
+      {
+        // Short blocks summed directly.
+        if(n <= 8)
+        {
+          double result = 0.0;
+          for (int i = 0; i < n; i++)
+            result += x[i * stride];
+          return result;
+        }
+        int half = n / 2;
+        return pairwise_sum(half, x, stride) + pairwise_sum(n - half, x + half * stride, stride);
+      }
+
+      template HERMES_API void copy<double>(int n, const double* x, double* y);
+      template HERMES_API void copy<std::complex<double> >(int n, const std::complex<double>* x, std::complex<double>* y);
+      template HERMES_API void zero<double>(int n, double* x);
+      template HERMES_API void zero<std::complex<double> >(int n, std::complex<double>* x);
+      template HERMES_API void first_touch_zero<double>(int n, double* x);
+      template HERMES_API void first_touch_zero<std::complex<double> >(int n, std::complex<double>* x);
+      template HERMES_API void scale<double>(int n, double a, double* x);
+      template HERMES_API void scale<std::complex<double> >(int n, std::complex<double> a, std::complex<double>* x);
+      template HERMES_API void axpy<double>(int n, double a, const double* x, double* y);
+      template HERMES_API void axpy<std::complex<double> >(int n, std::complex<double> a, const std::complex<double>* x, std::complex<double>* y);
+      template HERMES_API void axpby<double>(int n, double a, const double* x, double b, double* y);
+      template HERMES_API void axpby<std::complex<double> >(int n, std::complex<double> a, const std::complex<double>* x, std::complex<double> b, std::complex<double>* y);
+      template HERMES_API void waxpy<double>(int n, double a, const double* x, const double* y, double* w);
+      template HERMES_API void waxpy<std::complex<double> >(int n, std::complex<double> a, const std::complex<double>* x, const std::complex<double>* y, std::complex<double>* w);
+      template HERMES_API double nrm2<double>(int n, const double* x);
+      template HERMES_API double nrm2<std::complex<double> >(int n, const std::complex<double>* x);
+      template HERMES_API double diff_nrm2<double>(int n, const double* x, const double* y);
+      template HERMES_API double diff_nrm2<std::complex<double> >(int n, const std::complex<double>* x, const std::complex<double>* y);
+      template HERMES_API double nrm2<double>(Vector<double>* vec);
+      template HERMES_API double nrm2<std::complex<double> >(Vector<std::complex<double> >* vec);
+    }
+  }
+}